@@ -0,0 +1,9881 @@
+
+obj/user/testkbd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 2e 06 00 00       	call   80066f <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb e2 8f 00 00 00 	movabs $0x8fe2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i, r;
+
+	// Spin for a bit to let the console quiet
+	for (i = 0; i < 10; ++i)
+  800069:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800070:	eb 16                	jmp    800088 <umain+0x45>
+		sys_yield();
+  800072:	49 89 df             	mov    %rbx,%r15
+  800075:	48 b8 07 96 ff ff ff 	movabs $0xffffffffffff9607,%rax
+  80007c:	ff ff ff 
+  80007f:	48 01 d8             	add    %rbx,%rax
+  800082:	ff d0                	call   *%rax
+	for (i = 0; i < 10; ++i)
+  800084:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  800088:	83 7d ec 09          	cmpl   $0x9,-0x14(%rbp)
+  80008c:	7e e4                	jle    800072 <umain+0x2f>
+
+	close(0);
+  80008e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800093:	49 89 df             	mov    %rbx,%r15
+  800096:	48 b8 c4 a1 ff ff ff 	movabs $0xffffffffffffa1c4,%rax
+  80009d:	ff ff ff 
+  8000a0:	48 01 d8             	add    %rbx,%rax
+  8000a3:	ff d0                	call   *%rax
+	if ((r = opencons()) < 0)
+  8000a5:	49 89 df             	mov    %rbx,%r15
+  8000a8:	48 b8 8b 73 ff ff ff 	movabs $0xffffffffffff738b,%rax
+  8000af:	ff ff ff 
+  8000b2:	48 01 d8             	add    %rbx,%rax
+  8000b5:	ff d0                	call   *%rax
+  8000b7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8000ba:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8000be:	79 44                	jns    800104 <umain+0xc1>
+		panic("opencons: %e", r);
+  8000c0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8000c3:	89 c1                	mov    %eax,%ecx
+  8000c5:	48 b8 50 d5 ff ff ff 	movabs $0xffffffffffffd550,%rax
+  8000cc:	ff ff ff 
+  8000cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000d3:	48 89 c2             	mov    %rax,%rdx
+  8000d6:	be 0f 00 00 00       	mov    $0xf,%esi
+  8000db:	48 b8 5d d5 ff ff ff 	movabs $0xffffffffffffd55d,%rax
+  8000e2:	ff ff ff 
+  8000e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000e9:	48 89 c7             	mov    %rax,%rdi
+  8000ec:	49 89 df             	mov    %rbx,%r15
+  8000ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f4:	49 b8 49 77 ff ff ff 	movabs $0xffffffffffff7749,%r8
+  8000fb:	ff ff ff 
+  8000fe:	49 01 d8             	add    %rbx,%r8
+  800101:	41 ff d0             	call   *%r8
+	if (r != 0)
+  800104:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800108:	74 44                	je     80014e <umain+0x10b>
+		panic("first opencons used fd %d", r);
+  80010a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80010d:	89 c1                	mov    %eax,%ecx
+  80010f:	48 b8 6c d5 ff ff ff 	movabs $0xffffffffffffd56c,%rax
+  800116:	ff ff ff 
+  800119:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80011d:	48 89 c2             	mov    %rax,%rdx
+  800120:	be 11 00 00 00       	mov    $0x11,%esi
+  800125:	48 b8 5d d5 ff ff ff 	movabs $0xffffffffffffd55d,%rax
+  80012c:	ff ff ff 
+  80012f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800133:	48 89 c7             	mov    %rax,%rdi
+  800136:	49 89 df             	mov    %rbx,%r15
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	49 b8 49 77 ff ff ff 	movabs $0xffffffffffff7749,%r8
+  800145:	ff ff ff 
+  800148:	49 01 d8             	add    %rbx,%r8
+  80014b:	41 ff d0             	call   *%r8
+	if ((r = dup(0, 1)) < 0)
+  80014e:	be 01 00 00 00       	mov    $0x1,%esi
+  800153:	bf 00 00 00 00       	mov    $0x0,%edi
+  800158:	49 89 df             	mov    %rbx,%r15
+  80015b:	48 b8 7d a2 ff ff ff 	movabs $0xffffffffffffa27d,%rax
+  800162:	ff ff ff 
+  800165:	48 01 d8             	add    %rbx,%rax
+  800168:	ff d0                	call   *%rax
+  80016a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80016d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800171:	79 44                	jns    8001b7 <umain+0x174>
+		panic("dup: %e", r);
+  800173:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800176:	89 c1                	mov    %eax,%ecx
+  800178:	48 b8 86 d5 ff ff ff 	movabs $0xffffffffffffd586,%rax
+  80017f:	ff ff ff 
+  800182:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800186:	48 89 c2             	mov    %rax,%rdx
+  800189:	be 13 00 00 00       	mov    $0x13,%esi
+  80018e:	48 b8 5d d5 ff ff ff 	movabs $0xffffffffffffd55d,%rax
+  800195:	ff ff ff 
+  800198:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80019c:	48 89 c7             	mov    %rax,%rdi
+  80019f:	49 89 df             	mov    %rbx,%r15
+  8001a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a7:	49 b8 49 77 ff ff ff 	movabs $0xffffffffffff7749,%r8
+  8001ae:	ff ff ff 
+  8001b1:	49 01 d8             	add    %rbx,%r8
+  8001b4:	41 ff d0             	call   *%r8
+
+	for(;;){
+		char *buf;
+
+		buf = readline("Type a line: ");
+  8001b7:	48 b8 8e d5 ff ff ff 	movabs $0xffffffffffffd58e,%rax
+  8001be:	ff ff ff 
+  8001c1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001c5:	48 89 c7             	mov    %rax,%rdi
+  8001c8:	49 89 df             	mov    %rbx,%r15
+  8001cb:	48 b8 4e 87 ff ff ff 	movabs $0xffffffffffff874e,%rax
+  8001d2:	ff ff ff 
+  8001d5:	48 01 d8             	add    %rbx,%rax
+  8001d8:	ff d0                	call   *%rax
+  8001da:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		if (buf != NULL){
+  8001de:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8001e3:	74 7d                	je     800262 <umain+0x21f>
+			fprintf(1, "%s\n", buf);
+  8001e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8001e9:	48 89 c2             	mov    %rax,%rdx
+  8001ec:	48 b8 9c d5 ff ff ff 	movabs $0xffffffffffffd59c,%rax
+  8001f3:	ff ff ff 
+  8001f6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001fa:	48 89 c6             	mov    %rax,%rsi
+  8001fd:	bf 01 00 00 00       	mov    $0x1,%edi
+  800202:	49 89 df             	mov    %rbx,%r15
+  800205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020a:	48 b9 be b6 ff ff ff 	movabs $0xffffffffffffb6be,%rcx
+  800211:	ff ff ff 
+  800214:	48 01 d9             	add    %rbx,%rcx
+  800217:	ff d1                	call   *%rcx
+			if (!strcmp(buf,"exit")){
+  800219:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80021d:	48 ba a0 d5 ff ff ff 	movabs $0xffffffffffffd5a0,%rdx
+  800224:	ff ff ff 
+  800227:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80022b:	48 89 d6             	mov    %rdx,%rsi
+  80022e:	48 89 c7             	mov    %rax,%rdi
+  800231:	49 89 df             	mov    %rbx,%r15
+  800234:	48 b8 59 8b ff ff ff 	movabs $0xffffffffffff8b59,%rax
+  80023b:	ff ff ff 
+  80023e:	48 01 d8             	add    %rbx,%rax
+  800241:	ff d0                	call   *%rax
+  800243:	85 c0                	test   %eax,%eax
+  800245:	0f 85 6c ff ff ff    	jne    8001b7 <umain+0x174>
+				exit();
+  80024b:	49 89 df             	mov    %rbx,%r15
+  80024e:	48 b8 ff 76 ff ff ff 	movabs $0xffffffffffff76ff,%rax
+  800255:	ff ff ff 
+  800258:	48 01 d8             	add    %rbx,%rax
+  80025b:	ff d0                	call   *%rax
+  80025d:	e9 55 ff ff ff       	jmp    8001b7 <umain+0x174>
+			}
+		}
+		else
+			fprintf(1, "(end of file received)\n");
+  800262:	48 b8 a5 d5 ff ff ff 	movabs $0xffffffffffffd5a5,%rax
+  800269:	ff ff ff 
+  80026c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800270:	48 89 c6             	mov    %rax,%rsi
+  800273:	bf 01 00 00 00       	mov    $0x1,%edi
+  800278:	49 89 df             	mov    %rbx,%r15
+  80027b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800280:	48 ba be b6 ff ff ff 	movabs $0xffffffffffffb6be,%rdx
+  800287:	ff ff ff 
+  80028a:	48 01 da             	add    %rbx,%rdx
+  80028d:	ff d2                	call   *%rdx
+	for(;;){
+  80028f:	e9 23 ff ff ff       	jmp    8001b7 <umain+0x174>
+
+0000000000800294 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  800294:	55                   	push   %rbp
+  800295:	48 89 e5             	mov    %rsp,%rbp
+  800298:	41 57                	push   %r15
+  80029a:	48 83 ec 28          	sub    $0x28,%rsp
+  80029e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80029e <cputchar+0xa>
+  8002a5:	49 bb 92 8d 00 00 00 	movabs $0x8d92,%r11
+  8002ac:	00 00 00 
+  8002af:	4c 01 d8             	add    %r11,%rax
+  8002b2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8002b5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8002b8:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8002bb:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8002bf:	be 01 00 00 00       	mov    $0x1,%esi
+  8002c4:	48 89 d7             	mov    %rdx,%rdi
+  8002c7:	49 89 c7             	mov    %rax,%r15
+  8002ca:	48 ba a4 94 ff ff ff 	movabs $0xffffffffffff94a4,%rdx
+  8002d1:	ff ff ff 
+  8002d4:	48 01 c2             	add    %rax,%rdx
+  8002d7:	ff d2                	call   *%rdx
+}
+  8002d9:	90                   	nop
+  8002da:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8002de:	c9                   	leave
+  8002df:	c3                   	ret
+
+00000000008002e0 <getchar>:
+
+int
+getchar(void)
+{
+  8002e0:	55                   	push   %rbp
+  8002e1:	48 89 e5             	mov    %rsp,%rbp
+  8002e4:	41 57                	push   %r15
+  8002e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8002ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8002ea <getchar+0xa>
+  8002f1:	49 bb 46 8d 00 00 00 	movabs $0x8d46,%r11
+  8002f8:	00 00 00 
+  8002fb:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8002fe:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  800302:	ba 01 00 00 00       	mov    $0x1,%edx
+  800307:	48 89 ce             	mov    %rcx,%rsi
+  80030a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80030f:	49 89 c7             	mov    %rax,%r15
+  800312:	48 b9 7c a4 ff ff ff 	movabs $0xffffffffffffa47c,%rcx
+  800319:	ff ff ff 
+  80031c:	48 01 c1             	add    %rax,%rcx
+  80031f:	ff d1                	call   *%rcx
+  800321:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  800324:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800328:	79 05                	jns    80032f <getchar+0x4f>
+		return r;
+  80032a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80032d:	eb 14                	jmp    800343 <getchar+0x63>
+	if (r < 1)
+  80032f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800333:	7f 07                	jg     80033c <getchar+0x5c>
+		return -E_EOF;
+  800335:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80033a:	eb 07                	jmp    800343 <getchar+0x63>
+	return c;
+  80033c:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  800340:	0f b6 c0             	movzbl %al,%eax
+}
+  800343:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800347:	c9                   	leave
+  800348:	c3                   	ret
+
+0000000000800349 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  800349:	55                   	push   %rbp
+  80034a:	48 89 e5             	mov    %rsp,%rbp
+  80034d:	41 57                	push   %r15
+  80034f:	53                   	push   %rbx
+  800350:	48 83 ec 20          	sub    $0x20,%rsp
+  800354:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800354 <iscons+0xb>
+  80035b:	49 bb dc 8c 00 00 00 	movabs $0x8cdc,%r11
+  800362:	00 00 00 
+  800365:	4c 01 db             	add    %r11,%rbx
+  800368:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80036b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80036f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800372:	48 89 d6             	mov    %rdx,%rsi
+  800375:	89 c7                	mov    %eax,%edi
+  800377:	49 89 df             	mov    %rbx,%r15
+  80037a:	48 b8 35 9f ff ff ff 	movabs $0xffffffffffff9f35,%rax
+  800381:	ff ff ff 
+  800384:	48 01 d8             	add    %rbx,%rax
+  800387:	ff d0                	call   *%rax
+  800389:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80038c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800390:	79 05                	jns    800397 <iscons+0x4e>
+		return r;
+  800392:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800395:	eb 1b                	jmp    8003b2 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  800397:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80039b:	8b 10                	mov    (%rax),%edx
+  80039d:	48 b8 30 00 00 00 00 	movabs $0x30,%rax
+  8003a4:	00 00 00 
+  8003a7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8003aa:	39 c2                	cmp    %eax,%edx
+  8003ac:	0f 94 c0             	sete   %al
+  8003af:	0f b6 c0             	movzbl %al,%eax
+}
+  8003b2:	48 83 c4 20          	add    $0x20,%rsp
+  8003b6:	5b                   	pop    %rbx
+  8003b7:	41 5f                	pop    %r15
+  8003b9:	5d                   	pop    %rbp
+  8003ba:	c3                   	ret
+
+00000000008003bb <opencons>:
+
+int
+opencons(void)
+{
+  8003bb:	55                   	push   %rbp
+  8003bc:	48 89 e5             	mov    %rsp,%rbp
+  8003bf:	41 57                	push   %r15
+  8003c1:	53                   	push   %rbx
+  8003c2:	48 83 ec 10          	sub    $0x10,%rsp
+  8003c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8003c6 <opencons+0xb>
+  8003cd:	49 bb 6a 8c 00 00 00 	movabs $0x8c6a,%r11
+  8003d4:	00 00 00 
+  8003d7:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8003da:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8003de:	48 89 c7             	mov    %rax,%rdi
+  8003e1:	49 89 df             	mov    %rbx,%r15
+  8003e4:	48 b8 7f 9e ff ff ff 	movabs $0xffffffffffff9e7f,%rax
+  8003eb:	ff ff ff 
+  8003ee:	48 01 d8             	add    %rbx,%rax
+  8003f1:	ff d0                	call   *%rax
+  8003f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8003f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8003fa:	79 05                	jns    800401 <opencons+0x46>
+		return r;
+  8003fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003ff:	eb 68                	jmp    800469 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800401:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800405:	ba 07 04 00 00       	mov    $0x407,%edx
+  80040a:	48 89 c6             	mov    %rax,%rsi
+  80040d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800412:	49 89 df             	mov    %rbx,%r15
+  800415:	48 b8 5c 96 ff ff ff 	movabs $0xffffffffffff965c,%rax
+  80041c:	ff ff ff 
+  80041f:	48 01 d8             	add    %rbx,%rax
+  800422:	ff d0                	call   *%rax
+  800424:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800427:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80042b:	79 05                	jns    800432 <opencons+0x77>
+		return r;
+  80042d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800430:	eb 37                	jmp    800469 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  800432:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800436:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  80043d:	00 00 00 
+  800440:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  800443:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  800445:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800449:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  800450:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800454:	48 89 c7             	mov    %rax,%rdi
+  800457:	49 89 df             	mov    %rbx,%r15
+  80045a:	48 b8 05 9e ff ff ff 	movabs $0xffffffffffff9e05,%rax
+  800461:	ff ff ff 
+  800464:	48 01 d8             	add    %rbx,%rax
+  800467:	ff d0                	call   *%rax
+}
+  800469:	48 83 c4 10          	add    $0x10,%rsp
+  80046d:	5b                   	pop    %rbx
+  80046e:	41 5f                	pop    %r15
+  800470:	5d                   	pop    %rbp
+  800471:	c3                   	ret
+
+0000000000800472 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  800472:	55                   	push   %rbp
+  800473:	48 89 e5             	mov    %rsp,%rbp
+  800476:	41 57                	push   %r15
+  800478:	53                   	push   %rbx
+  800479:	48 83 ec 30          	sub    $0x30,%rsp
+  80047d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80047d <devcons_read+0xb>
+  800484:	49 bb b3 8b 00 00 00 	movabs $0x8bb3,%r11
+  80048b:	00 00 00 
+  80048e:	4c 01 db             	add    %r11,%rbx
+  800491:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800495:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800499:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  80049d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8004a2:	75 19                	jne    8004bd <devcons_read+0x4b>
+		return 0;
+  8004a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a9:	eb 55                	jmp    800500 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8004ab:	49 89 df             	mov    %rbx,%r15
+  8004ae:	48 b8 07 96 ff ff ff 	movabs $0xffffffffffff9607,%rax
+  8004b5:	ff ff ff 
+  8004b8:	48 01 d8             	add    %rbx,%rax
+  8004bb:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8004bd:	49 89 df             	mov    %rbx,%r15
+  8004c0:	48 b8 03 95 ff ff ff 	movabs $0xffffffffffff9503,%rax
+  8004c7:	ff ff ff 
+  8004ca:	48 01 d8             	add    %rbx,%rax
+  8004cd:	ff d0                	call   *%rax
+  8004cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8004d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8004d6:	74 d3                	je     8004ab <devcons_read+0x39>
+	if (c < 0)
+  8004d8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8004dc:	79 05                	jns    8004e3 <devcons_read+0x71>
+		return c;
+  8004de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8004e1:	eb 1d                	jmp    800500 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8004e3:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8004e7:	75 07                	jne    8004f0 <devcons_read+0x7e>
+		return 0;
+  8004e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ee:	eb 10                	jmp    800500 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  8004f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8004f3:	89 c2                	mov    %eax,%edx
+  8004f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8004f9:	88 10                	mov    %dl,(%rax)
+	return 1;
+  8004fb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800500:	48 83 c4 30          	add    $0x30,%rsp
+  800504:	5b                   	pop    %rbx
+  800505:	41 5f                	pop    %r15
+  800507:	5d                   	pop    %rbp
+  800508:	c3                   	ret
+
+0000000000800509 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  800509:	55                   	push   %rbp
+  80050a:	48 89 e5             	mov    %rsp,%rbp
+  80050d:	41 57                	push   %r15
+  80050f:	53                   	push   %rbx
+  800510:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  800517:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800517 <devcons_write+0xe>
+  80051e:	49 bb 19 8b 00 00 00 	movabs $0x8b19,%r11
+  800525:	00 00 00 
+  800528:	4c 01 db             	add    %r11,%rbx
+  80052b:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  800532:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  800539:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  800540:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800547:	e9 80 00 00 00       	jmp    8005cc <devcons_write+0xc3>
+		m = n - tot;
+  80054c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800553:	89 c2                	mov    %eax,%edx
+  800555:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800558:	29 c2                	sub    %eax,%edx
+  80055a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  80055d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800560:	83 f8 7f             	cmp    $0x7f,%eax
+  800563:	76 07                	jbe    80056c <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  800565:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  80056c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80056f:	48 63 d0             	movslq %eax,%rdx
+  800572:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800575:	48 63 c8             	movslq %eax,%rcx
+  800578:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80057f:	48 01 c1             	add    %rax,%rcx
+  800582:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  800589:	48 89 ce             	mov    %rcx,%rsi
+  80058c:	48 89 c7             	mov    %rax,%rdi
+  80058f:	49 89 df             	mov    %rbx,%r15
+  800592:	48 b8 80 8d ff ff ff 	movabs $0xffffffffffff8d80,%rax
+  800599:	ff ff ff 
+  80059c:	48 01 d8             	add    %rbx,%rax
+  80059f:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8005a1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8005a4:	48 63 d0             	movslq %eax,%rdx
+  8005a7:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8005ae:	48 89 d6             	mov    %rdx,%rsi
+  8005b1:	48 89 c7             	mov    %rax,%rdi
+  8005b4:	49 89 df             	mov    %rbx,%r15
+  8005b7:	48 b8 a4 94 ff ff ff 	movabs $0xffffffffffff94a4,%rax
+  8005be:	ff ff ff 
+  8005c1:	48 01 d8             	add    %rbx,%rax
+  8005c4:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8005c6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8005c9:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8005cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8005cf:	48 98                	cltq
+  8005d1:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8005d8:	0f 82 6e ff ff ff    	jb     80054c <devcons_write+0x43>
+	}
+	return tot;
+  8005de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8005e1:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8005e8:	5b                   	pop    %rbx
+  8005e9:	41 5f                	pop    %r15
+  8005eb:	5d                   	pop    %rbp
+  8005ec:	c3                   	ret
+
+00000000008005ed <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  8005ed:	55                   	push   %rbp
+  8005ee:	48 89 e5             	mov    %rsp,%rbp
+  8005f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8005f5 <devcons_close+0x8>
+  8005fc:	49 bb 3b 8a 00 00 00 	movabs $0x8a3b,%r11
+  800603:	00 00 00 
+  800606:	4c 01 d8             	add    %r11,%rax
+  800609:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  80060d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800612:	c9                   	leave
+  800613:	c3                   	ret
+
+0000000000800614 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800614:	55                   	push   %rbp
+  800615:	48 89 e5             	mov    %rsp,%rbp
+  800618:	41 57                	push   %r15
+  80061a:	48 83 ec 18          	sub    $0x18,%rsp
+  80061e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80061e <devcons_stat+0xa>
+  800625:	49 bb 12 8a 00 00 00 	movabs $0x8a12,%r11
+  80062c:	00 00 00 
+  80062f:	4c 01 d8             	add    %r11,%rax
+  800632:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800636:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  80063a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80063e:	48 b9 c2 d5 ff ff ff 	movabs $0xffffffffffffd5c2,%rcx
+  800645:	ff ff ff 
+  800648:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80064c:	48 89 ce             	mov    %rcx,%rsi
+  80064f:	48 89 d7             	mov    %rdx,%rdi
+  800652:	49 89 c7             	mov    %rax,%r15
+  800655:	48 ba a0 89 ff ff ff 	movabs $0xffffffffffff89a0,%rdx
+  80065c:	ff ff ff 
+  80065f:	48 01 c2             	add    %rax,%rdx
+  800662:	ff d2                	call   *%rdx
+	return 0;
+  800664:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800669:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80066d:	c9                   	leave
+  80066e:	c3                   	ret
+
+000000000080066f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80066f:	55                   	push   %rbp
+  800670:	48 89 e5             	mov    %rsp,%rbp
+  800673:	41 57                	push   %r15
+  800675:	53                   	push   %rbx
+  800676:	48 83 ec 20          	sub    $0x20,%rsp
+  80067a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80067a <libmain+0xb>
+  800681:	49 bb b6 89 00 00 00 	movabs $0x89b6,%r11
+  800688:	00 00 00 
+  80068b:	4c 01 db             	add    %r11,%rbx
+  80068e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800691:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800695:	49 89 df             	mov    %rbx,%r15
+  800698:	48 b8 b3 95 ff ff ff 	movabs $0xffffffffffff95b3,%rax
+  80069f:	ff ff ff 
+  8006a2:	48 01 d8             	add    %rbx,%rax
+  8006a5:	ff d0                	call   *%rax
+  8006a7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8006aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8006ad:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8006b2:	48 98                	cltq
+  8006b4:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8006bb:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8006c2:	ff ff ff 
+  8006c5:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8006c9:	48 01 c2             	add    %rax,%rdx
+  8006cc:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  8006d3:	00 00 00 
+  8006d6:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8006da:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8006de:	7e 15                	jle    8006f5 <libmain+0x86>
+		binaryname = argv[0];
+  8006e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8006e4:	48 8b 00             	mov    (%rax),%rax
+  8006e7:	48 ba 68 00 00 00 00 	movabs $0x68,%rdx
+  8006ee:	00 00 00 
+  8006f1:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8006f5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8006f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8006fc:	48 89 d6             	mov    %rdx,%rsi
+  8006ff:	89 c7                	mov    %eax,%edi
+  800701:	49 89 df             	mov    %rbx,%r15
+  800704:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  80070b:	ff ff ff 
+  80070e:	48 01 d8             	add    %rbx,%rax
+  800711:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800713:	49 89 df             	mov    %rbx,%r15
+  800716:	48 b8 ff 76 ff ff ff 	movabs $0xffffffffffff76ff,%rax
+  80071d:	ff ff ff 
+  800720:	48 01 d8             	add    %rbx,%rax
+  800723:	ff d0                	call   *%rax
+}
+  800725:	90                   	nop
+  800726:	48 83 c4 20          	add    $0x20,%rsp
+  80072a:	5b                   	pop    %rbx
+  80072b:	41 5f                	pop    %r15
+  80072d:	5d                   	pop    %rbp
+  80072e:	c3                   	ret
+
+000000000080072f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80072f:	55                   	push   %rbp
+  800730:	48 89 e5             	mov    %rsp,%rbp
+  800733:	41 57                	push   %r15
+  800735:	53                   	push   %rbx
+  800736:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800736 <exit+0x7>
+  80073d:	49 bb fa 88 00 00 00 	movabs $0x88fa,%r11
+  800744:	00 00 00 
+  800747:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80074a:	49 89 df             	mov    %rbx,%r15
+  80074d:	48 b8 30 a2 ff ff ff 	movabs $0xffffffffffffa230,%rax
+  800754:	ff ff ff 
+  800757:	48 01 d8             	add    %rbx,%rax
+  80075a:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80075c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800761:	49 89 df             	mov    %rbx,%r15
+  800764:	48 b8 57 95 ff ff ff 	movabs $0xffffffffffff9557,%rax
+  80076b:	ff ff ff 
+  80076e:	48 01 d8             	add    %rbx,%rax
+  800771:	ff d0                	call   *%rax
+}
+  800773:	90                   	nop
+  800774:	5b                   	pop    %rbx
+  800775:	41 5f                	pop    %r15
+  800777:	5d                   	pop    %rbp
+  800778:	c3                   	ret
+
+0000000000800779 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800779:	55                   	push   %rbp
+  80077a:	48 89 e5             	mov    %rsp,%rbp
+  80077d:	41 57                	push   %r15
+  80077f:	41 54                	push   %r12
+  800781:	53                   	push   %rbx
+  800782:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800789:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800789 <_panic+0x10>
+  800790:	49 bb a7 88 00 00 00 	movabs $0x88a7,%r11
+  800797:	00 00 00 
+  80079a:	4c 01 db             	add    %r11,%rbx
+  80079d:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8007a4:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8007aa:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8007b1:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8007b8:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8007bf:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8007c6:	84 c0                	test   %al,%al
+  8007c8:	74 26                	je     8007f0 <_panic+0x77>
+  8007ca:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8007d1:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8007d8:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8007dc:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8007e0:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8007e4:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8007e8:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8007ec:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8007f0:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8007f7:	00 00 00 
+  8007fa:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800801:	00 00 00 
+  800804:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800808:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80080f:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800816:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80081d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  800824:	ff ff ff 
+  800827:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80082b:	4c 8b 20             	mov    (%rax),%r12
+  80082e:	49 89 df             	mov    %rbx,%r15
+  800831:	48 b8 b3 95 ff ff ff 	movabs $0xffffffffffff95b3,%rax
+  800838:	ff ff ff 
+  80083b:	48 01 d8             	add    %rbx,%rax
+  80083e:	ff d0                	call   *%rax
+  800840:	89 c6                	mov    %eax,%esi
+  800842:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800848:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80084f:	41 89 d0             	mov    %edx,%r8d
+  800852:	48 89 c1             	mov    %rax,%rcx
+  800855:	4c 89 e2             	mov    %r12,%rdx
+  800858:	48 b8 d8 d5 ff ff ff 	movabs $0xffffffffffffd5d8,%rax
+  80085f:	ff ff ff 
+  800862:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800866:	48 89 c7             	mov    %rax,%rdi
+  800869:	49 89 df             	mov    %rbx,%r15
+  80086c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800871:	49 b9 20 7a ff ff ff 	movabs $0xffffffffffff7a20,%r9
+  800878:	ff ff ff 
+  80087b:	49 01 d9             	add    %rbx,%r9
+  80087e:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800881:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800888:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80088f:	48 89 d6             	mov    %rdx,%rsi
+  800892:	48 89 c7             	mov    %rax,%rdi
+  800895:	49 89 df             	mov    %rbx,%r15
+  800898:	48 b8 40 79 ff ff ff 	movabs $0xffffffffffff7940,%rax
+  80089f:	ff ff ff 
+  8008a2:	48 01 d8             	add    %rbx,%rax
+  8008a5:	ff d0                	call   *%rax
+	cprintf("\n");
+  8008a7:	48 b8 fb d5 ff ff ff 	movabs $0xffffffffffffd5fb,%rax
+  8008ae:	ff ff ff 
+  8008b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008b5:	48 89 c7             	mov    %rax,%rdi
+  8008b8:	49 89 df             	mov    %rbx,%r15
+  8008bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c0:	48 ba 20 7a ff ff ff 	movabs $0xffffffffffff7a20,%rdx
+  8008c7:	ff ff ff 
+  8008ca:	48 01 da             	add    %rbx,%rdx
+  8008cd:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8008cf:	cc                   	int3
+  8008d0:	eb fd                	jmp    8008cf <_panic+0x156>
+
+00000000008008d2 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8008d2:	55                   	push   %rbp
+  8008d3:	48 89 e5             	mov    %rsp,%rbp
+  8008d6:	41 57                	push   %r15
+  8008d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8008dc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008dc <putch+0xa>
+  8008e3:	49 bb 54 87 00 00 00 	movabs $0x8754,%r11
+  8008ea:	00 00 00 
+  8008ed:	4c 01 d8             	add    %r11,%rax
+  8008f0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8008f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8008f7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8008fb:	8b 12                	mov    (%rdx),%edx
+  8008fd:	8d 72 01             	lea    0x1(%rdx),%esi
+  800900:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800904:	89 31                	mov    %esi,(%rcx)
+  800906:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800909:	89 ce                	mov    %ecx,%esi
+  80090b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80090f:	48 63 d2             	movslq %edx,%rdx
+  800912:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800917:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80091b:	8b 12                	mov    (%rdx),%edx
+  80091d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800923:	75 33                	jne    800958 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800925:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800929:	8b 12                	mov    (%rdx),%edx
+  80092b:	48 63 d2             	movslq %edx,%rdx
+  80092e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800932:	48 83 c1 08          	add    $0x8,%rcx
+  800936:	48 89 d6             	mov    %rdx,%rsi
+  800939:	48 89 cf             	mov    %rcx,%rdi
+  80093c:	49 89 c7             	mov    %rax,%r15
+  80093f:	48 ba a4 94 ff ff ff 	movabs $0xffffffffffff94a4,%rdx
+  800946:	ff ff ff 
+  800949:	48 01 c2             	add    %rax,%rdx
+  80094c:	ff d2                	call   *%rdx
+        b->idx = 0;
+  80094e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800952:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800958:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80095c:	8b 40 04             	mov    0x4(%rax),%eax
+  80095f:	8d 50 01             	lea    0x1(%rax),%edx
+  800962:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800966:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800969:	90                   	nop
+  80096a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80096e:	c9                   	leave
+  80096f:	c3                   	ret
+
+0000000000800970 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800970:	55                   	push   %rbp
+  800971:	48 89 e5             	mov    %rsp,%rbp
+  800974:	41 57                	push   %r15
+  800976:	53                   	push   %rbx
+  800977:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80097e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80097e <vcprintf+0xe>
+  800985:	49 bb b2 86 00 00 00 	movabs $0x86b2,%r11
+  80098c:	00 00 00 
+  80098f:	4c 01 db             	add    %r11,%rbx
+  800992:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800999:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8009a0:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8009a7:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8009ae:	48 8b 06             	mov    (%rsi),%rax
+  8009b1:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8009b5:	48 89 01             	mov    %rax,(%rcx)
+  8009b8:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8009bc:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8009c0:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8009c4:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8009cb:	00 00 00 
+    b.cnt = 0;
+  8009ce:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8009d5:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8009d8:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8009df:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8009e6:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8009ed:	48 89 c6             	mov    %rax,%rsi
+  8009f0:	48 b8 a2 78 ff ff ff 	movabs $0xffffffffffff78a2,%rax
+  8009f7:	ff ff ff 
+  8009fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009fe:	48 89 c7             	mov    %rax,%rdi
+  800a01:	49 89 df             	mov    %rbx,%r15
+  800a04:	48 b8 64 7e ff ff ff 	movabs $0xffffffffffff7e64,%rax
+  800a0b:	ff ff ff 
+  800a0e:	48 01 d8             	add    %rbx,%rax
+  800a11:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800a13:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800a19:	48 98                	cltq
+  800a1b:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800a22:	48 83 c2 08          	add    $0x8,%rdx
+  800a26:	48 89 c6             	mov    %rax,%rsi
+  800a29:	48 89 d7             	mov    %rdx,%rdi
+  800a2c:	49 89 df             	mov    %rbx,%r15
+  800a2f:	48 b8 a4 94 ff ff ff 	movabs $0xffffffffffff94a4,%rax
+  800a36:	ff ff ff 
+  800a39:	48 01 d8             	add    %rbx,%rax
+  800a3c:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800a3e:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800a44:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800a4b:	5b                   	pop    %rbx
+  800a4c:	41 5f                	pop    %r15
+  800a4e:	5d                   	pop    %rbp
+  800a4f:	c3                   	ret
+
+0000000000800a50 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800a50:	55                   	push   %rbp
+  800a51:	48 89 e5             	mov    %rsp,%rbp
+  800a54:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800a5b:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800a5b <cprintf+0xb>
+  800a62:	49 bb d5 85 00 00 00 	movabs $0x85d5,%r11
+  800a69:	00 00 00 
+  800a6c:	4d 01 da             	add    %r11,%r10
+  800a6f:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800a76:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800a7d:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800a84:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800a8b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800a92:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800a99:	84 c0                	test   %al,%al
+  800a9b:	74 20                	je     800abd <cprintf+0x6d>
+  800a9d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800aa1:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800aa5:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800aa9:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800aad:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ab1:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ab5:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800ab9:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800abd:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800ac4:	00 00 00 
+  800ac7:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800ace:	00 00 00 
+  800ad1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ad5:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800adc:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800ae3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800aea:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800af1:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800af8:	48 8b 06             	mov    (%rsi),%rax
+  800afb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800aff:	48 89 01             	mov    %rax,(%rcx)
+  800b02:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800b06:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800b0a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800b0e:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800b15:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800b1c:	48 89 d6             	mov    %rdx,%rsi
+  800b1f:	48 89 c7             	mov    %rax,%rdi
+  800b22:	48 b8 40 79 ff ff ff 	movabs $0xffffffffffff7940,%rax
+  800b29:	ff ff ff 
+  800b2c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800b30:	ff d0                	call   *%rax
+  800b32:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800b38:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800b3e:	c9                   	leave
+  800b3f:	c3                   	ret
+
+0000000000800b40 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800b40:	55                   	push   %rbp
+  800b41:	48 89 e5             	mov    %rsp,%rbp
+  800b44:	53                   	push   %rbx
+  800b45:	48 83 ec 38          	sub    $0x38,%rsp
+  800b49:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800b49 <printnum+0x9>
+  800b50:	49 bb e7 84 00 00 00 	movabs $0x84e7,%r11
+  800b57:	00 00 00 
+  800b5a:	4c 01 db             	add    %r11,%rbx
+  800b5d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b61:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800b65:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800b69:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800b6c:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800b70:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800b74:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800b77:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800b7b:	72 58                	jb     800bd5 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800b7d:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800b80:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800b83:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800b86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8f:	48 f7 f6             	div    %rsi
+  800b92:	49 89 c2             	mov    %rax,%r10
+  800b95:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800b98:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800b9b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800b9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba3:	41 89 c9             	mov    %ecx,%r9d
+  800ba6:	41 89 f8             	mov    %edi,%r8d
+  800ba9:	89 d1                	mov    %edx,%ecx
+  800bab:	4c 89 d2             	mov    %r10,%rdx
+  800bae:	48 89 c7             	mov    %rax,%rdi
+  800bb1:	48 b8 10 7b ff ff ff 	movabs $0xffffffffffff7b10,%rax
+  800bb8:	ff ff ff 
+  800bbb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800bbf:	ff d0                	call   *%rax
+  800bc1:	eb 1c                	jmp    800bdf <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800bc3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800bc7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800bca:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800bce:	48 89 d6             	mov    %rdx,%rsi
+  800bd1:	89 c7                	mov    %eax,%edi
+  800bd3:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800bd5:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800bd9:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800bdd:	7f e4                	jg     800bc3 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800bdf:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800be2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800be6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800beb:	48 f7 f1             	div    %rcx
+  800bee:	48 b8 37 d7 ff ff ff 	movabs $0xffffffffffffd737,%rax
+  800bf5:	ff ff ff 
+  800bf8:	48 01 d8             	add    %rbx,%rax
+  800bfb:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800bff:	0f be c0             	movsbl %al,%eax
+  800c02:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800c06:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800c0a:	48 89 d6             	mov    %rdx,%rsi
+  800c0d:	89 c7                	mov    %eax,%edi
+  800c0f:	ff d1                	call   *%rcx
+}
+  800c11:	90                   	nop
+  800c12:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c16:	c9                   	leave
+  800c17:	c3                   	ret
+
+0000000000800c18 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800c18:	55                   	push   %rbp
+  800c19:	48 89 e5             	mov    %rsp,%rbp
+  800c1c:	48 83 ec 20          	sub    $0x20,%rsp
+  800c20:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c20 <getuint+0x8>
+  800c27:	49 bb 10 84 00 00 00 	movabs $0x8410,%r11
+  800c2e:	00 00 00 
+  800c31:	4c 01 d8             	add    %r11,%rax
+  800c34:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c38:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800c3b:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800c3f:	7e 4f                	jle    800c90 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800c41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c45:	8b 00                	mov    (%rax),%eax
+  800c47:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4a:	77 24                	ja     800c70 <getuint+0x58>
+  800c4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c50:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c58:	8b 00                	mov    (%rax),%eax
+  800c5a:	89 c0                	mov    %eax,%eax
+  800c5c:	48 01 d0             	add    %rdx,%rax
+  800c5f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c63:	8b 12                	mov    (%rdx),%edx
+  800c65:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c68:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c6c:	89 0a                	mov    %ecx,(%rdx)
+  800c6e:	eb 14                	jmp    800c84 <getuint+0x6c>
+  800c70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c74:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c78:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c7c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c80:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c84:	48 8b 00             	mov    (%rax),%rax
+  800c87:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800c8b:	e9 9d 00 00 00       	jmp    800d2d <getuint+0x115>
+	else if (lflag)
+  800c90:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800c94:	74 4c                	je     800ce2 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800c96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c9a:	8b 00                	mov    (%rax),%eax
+  800c9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9f:	77 24                	ja     800cc5 <getuint+0xad>
+  800ca1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ca5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ca9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cad:	8b 00                	mov    (%rax),%eax
+  800caf:	89 c0                	mov    %eax,%eax
+  800cb1:	48 01 d0             	add    %rdx,%rax
+  800cb4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cb8:	8b 12                	mov    (%rdx),%edx
+  800cba:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800cbd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cc1:	89 0a                	mov    %ecx,(%rdx)
+  800cc3:	eb 14                	jmp    800cd9 <getuint+0xc1>
+  800cc5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cc9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ccd:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800cd1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cd5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800cd9:	48 8b 00             	mov    (%rax),%rax
+  800cdc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800ce0:	eb 4b                	jmp    800d2d <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800ce2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ce6:	8b 00                	mov    (%rax),%eax
+  800ce8:	83 f8 2f             	cmp    $0x2f,%eax
+  800ceb:	77 24                	ja     800d11 <getuint+0xf9>
+  800ced:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cf1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800cf5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cf9:	8b 00                	mov    (%rax),%eax
+  800cfb:	89 c0                	mov    %eax,%eax
+  800cfd:	48 01 d0             	add    %rdx,%rax
+  800d00:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d04:	8b 12                	mov    (%rdx),%edx
+  800d06:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800d09:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d0d:	89 0a                	mov    %ecx,(%rdx)
+  800d0f:	eb 14                	jmp    800d25 <getuint+0x10d>
+  800d11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d15:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d19:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d1d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d21:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d25:	8b 00                	mov    (%rax),%eax
+  800d27:	89 c0                	mov    %eax,%eax
+  800d29:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800d2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800d31:	c9                   	leave
+  800d32:	c3                   	ret
+
+0000000000800d33 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800d33:	55                   	push   %rbp
+  800d34:	48 89 e5             	mov    %rsp,%rbp
+  800d37:	48 83 ec 20          	sub    $0x20,%rsp
+  800d3b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800d3b <printfloat+0x8>
+  800d42:	49 bb f5 82 00 00 00 	movabs $0x82f5,%r11
+  800d49:	00 00 00 
+  800d4c:	4c 01 d8             	add    %r11,%rax
+  800d4f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800d53:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800d57:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800d5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d5f:	48 85 c0             	test   %rax,%rax
+  800d62:	79 12                	jns    800d76 <printfloat+0x43>
+		putch('-',putdat);
+  800d64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d68:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d6c:	48 89 c6             	mov    %rax,%rsi
+  800d6f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d74:	ff d2                	call   *%rdx
+	
+}
+  800d76:	90                   	nop
+  800d77:	c9                   	leave
+  800d78:	c3                   	ret
+
+0000000000800d79 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800d79:	55                   	push   %rbp
+  800d7a:	48 89 e5             	mov    %rsp,%rbp
+  800d7d:	48 83 ec 20          	sub    $0x20,%rsp
+  800d81:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800d81 <getint+0x8>
+  800d88:	49 bb af 82 00 00 00 	movabs $0x82af,%r11
+  800d8f:	00 00 00 
+  800d92:	4c 01 d8             	add    %r11,%rax
+  800d95:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d99:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800d9c:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800da0:	7e 4f                	jle    800df1 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800da2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800da6:	8b 00                	mov    (%rax),%eax
+  800da8:	83 f8 2f             	cmp    $0x2f,%eax
+  800dab:	77 24                	ja     800dd1 <getint+0x58>
+  800dad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800db1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800db5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800db9:	8b 00                	mov    (%rax),%eax
+  800dbb:	89 c0                	mov    %eax,%eax
+  800dbd:	48 01 d0             	add    %rdx,%rax
+  800dc0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800dc4:	8b 12                	mov    (%rdx),%edx
+  800dc6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800dc9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800dcd:	89 0a                	mov    %ecx,(%rdx)
+  800dcf:	eb 14                	jmp    800de5 <getint+0x6c>
+  800dd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dd5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800dd9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ddd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800de1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800de5:	48 8b 00             	mov    (%rax),%rax
+  800de8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800dec:	e9 9d 00 00 00       	jmp    800e8e <getint+0x115>
+	else if (lflag)
+  800df1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800df5:	74 4c                	je     800e43 <getint+0xca>
+		x=va_arg(*ap, long);
+  800df7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dfb:	8b 00                	mov    (%rax),%eax
+  800dfd:	83 f8 2f             	cmp    $0x2f,%eax
+  800e00:	77 24                	ja     800e26 <getint+0xad>
+  800e02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e06:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800e0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e0e:	8b 00                	mov    (%rax),%eax
+  800e10:	89 c0                	mov    %eax,%eax
+  800e12:	48 01 d0             	add    %rdx,%rax
+  800e15:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e19:	8b 12                	mov    (%rdx),%edx
+  800e1b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800e1e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e22:	89 0a                	mov    %ecx,(%rdx)
+  800e24:	eb 14                	jmp    800e3a <getint+0xc1>
+  800e26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e2a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e2e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800e32:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e36:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800e3a:	48 8b 00             	mov    (%rax),%rax
+  800e3d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800e41:	eb 4b                	jmp    800e8e <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800e43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e47:	8b 00                	mov    (%rax),%eax
+  800e49:	83 f8 2f             	cmp    $0x2f,%eax
+  800e4c:	77 24                	ja     800e72 <getint+0xf9>
+  800e4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e52:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800e56:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e5a:	8b 00                	mov    (%rax),%eax
+  800e5c:	89 c0                	mov    %eax,%eax
+  800e5e:	48 01 d0             	add    %rdx,%rax
+  800e61:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e65:	8b 12                	mov    (%rdx),%edx
+  800e67:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800e6a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e6e:	89 0a                	mov    %ecx,(%rdx)
+  800e70:	eb 14                	jmp    800e86 <getint+0x10d>
+  800e72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e76:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e7a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800e7e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e82:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800e86:	8b 00                	mov    (%rax),%eax
+  800e88:	48 98                	cltq
+  800e8a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800e8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800e92:	c9                   	leave
+  800e93:	c3                   	ret
+
+0000000000800e94 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800e94:	55                   	push   %rbp
+  800e95:	48 89 e5             	mov    %rsp,%rbp
+  800e98:	41 57                	push   %r15
+  800e9a:	41 55                	push   %r13
+  800e9c:	41 54                	push   %r12
+  800e9e:	53                   	push   %rbx
+  800e9f:	48 83 ec 60          	sub    $0x60,%rsp
+  800ea3:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800ea3 <vprintfmt+0xf>
+  800eaa:	49 bb 8d 81 00 00 00 	movabs $0x818d,%r11
+  800eb1:	00 00 00 
+  800eb4:	4d 01 dc             	add    %r11,%r12
+  800eb7:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800ebb:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800ebf:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800ec3:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800ec7:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800ece:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800ed2:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800ed6:	48 8b 06             	mov    (%rsi),%rax
+  800ed9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800edd:	48 89 01             	mov    %rax,(%rcx)
+  800ee0:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ee4:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800ee8:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800eec:	eb 17                	jmp    800f05 <vprintfmt+0x71>
+			if (ch == '\0')
+  800eee:	85 db                	test   %ebx,%ebx
+  800ef0:	0f 84 97 05 00 00    	je     80148d <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800ef6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800efa:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800efe:	48 89 c6             	mov    %rax,%rsi
+  800f01:	89 df                	mov    %ebx,%edi
+  800f03:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800f05:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f09:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f0d:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800f11:	0f b6 00             	movzbl (%rax),%eax
+  800f14:	0f b6 d8             	movzbl %al,%ebx
+  800f17:	83 fb 25             	cmp    $0x25,%ebx
+  800f1a:	75 d2                	jne    800eee <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800f1c:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800f20:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800f27:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800f2e:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800f35:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800f3c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f40:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f44:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800f48:	0f b6 00             	movzbl (%rax),%eax
+  800f4b:	0f b6 d8             	movzbl %al,%ebx
+  800f4e:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800f51:	83 f8 55             	cmp    $0x55,%eax
+  800f54:	0f 87 00 05 00 00    	ja     80145a <vprintfmt+0x5c6>
+  800f5a:	89 c0                	mov    %eax,%eax
+  800f5c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800f63:	00 
+  800f64:	48 8d 05 25 58 00 00 	lea    0x5825(%rip),%rax        # 806790 <.LC18+0xc>
+  800f6b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800f6f:	48 8d 15 1a 58 00 00 	lea    0x581a(%rip),%rdx        # 806790 <.LC18+0xc>
+  800f76:	48 01 d0             	add    %rdx,%rax
+  800f79:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800f7b:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800f7f:	eb bb                	jmp    800f3c <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800f81:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800f85:	eb b5                	jmp    800f3c <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800f87:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800f8e:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800f91:	89 d0                	mov    %edx,%eax
+  800f93:	c1 e0 02             	shl    $0x2,%eax
+  800f96:	01 d0                	add    %edx,%eax
+  800f98:	01 c0                	add    %eax,%eax
+  800f9a:	01 d8                	add    %ebx,%eax
+  800f9c:	83 e8 30             	sub    $0x30,%eax
+  800f9f:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800fa2:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800fa6:	0f b6 00             	movzbl (%rax),%eax
+  800fa9:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800fac:	83 fb 2f             	cmp    $0x2f,%ebx
+  800faf:	7e 60                	jle    801011 <vprintfmt+0x17d>
+  800fb1:	83 fb 39             	cmp    $0x39,%ebx
+  800fb4:	7f 5b                	jg     801011 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800fb6:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800fbb:	eb d1                	jmp    800f8e <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800fbd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800fc0:	83 f8 2f             	cmp    $0x2f,%eax
+  800fc3:	77 17                	ja     800fdc <vprintfmt+0x148>
+  800fc5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800fc9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800fcc:	89 d2                	mov    %edx,%edx
+  800fce:	48 01 d0             	add    %rdx,%rax
+  800fd1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800fd4:	83 c2 08             	add    $0x8,%edx
+  800fd7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800fda:	eb 0c                	jmp    800fe8 <vprintfmt+0x154>
+  800fdc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800fe0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800fe4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800fe8:	8b 00                	mov    (%rax),%eax
+  800fea:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800fed:	eb 23                	jmp    801012 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800fef:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ff3:	0f 89 43 ff ff ff    	jns    800f3c <vprintfmt+0xa8>
+				width = 0;
+  800ff9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  801000:	e9 37 ff ff ff       	jmp    800f3c <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  801005:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  80100c:	e9 2b ff ff ff       	jmp    800f3c <vprintfmt+0xa8>
+			goto process_precision;
+  801011:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  801012:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801016:	0f 89 20 ff ff ff    	jns    800f3c <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  80101c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80101f:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  801022:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  801029:	e9 0e ff ff ff       	jmp    800f3c <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  80102e:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  801032:	e9 05 ff ff ff       	jmp    800f3c <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  801037:	83 fb 39             	cmp    $0x39,%ebx
+  80103a:	7f 0b                	jg     801047 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  80103c:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  80103f:	c1 e0 08             	shl    $0x8,%eax
+  801042:	01 45 bc             	add    %eax,-0x44(%rbp)
+  801045:	eb 21                	jmp    801068 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  801047:	83 fb 60             	cmp    $0x60,%ebx
+  80104a:	7e 10                	jle    80105c <vprintfmt+0x1c8>
+  80104c:	83 fb 66             	cmp    $0x66,%ebx
+  80104f:	7f 0b                	jg     80105c <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  801051:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  801054:	c1 e0 08             	shl    $0x8,%eax
+  801057:	01 45 bc             	add    %eax,-0x44(%rbp)
+  80105a:	eb 0c                	jmp    801068 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  80105c:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  801063:	e9 04 01 00 00       	jmp    80116c <vprintfmt+0x2d8>
+  801068:	e9 ff 00 00 00       	jmp    80116c <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  80106d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801070:	83 f8 2f             	cmp    $0x2f,%eax
+  801073:	77 17                	ja     80108c <vprintfmt+0x1f8>
+  801075:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801079:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80107c:	89 d2                	mov    %edx,%edx
+  80107e:	48 01 d0             	add    %rdx,%rax
+  801081:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801084:	83 c2 08             	add    $0x8,%edx
+  801087:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80108a:	eb 0c                	jmp    801098 <vprintfmt+0x204>
+  80108c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801090:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801094:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801098:	8b 00                	mov    (%rax),%eax
+  80109a:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80109e:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8010a2:	48 89 d6             	mov    %rdx,%rsi
+  8010a5:	89 c7                	mov    %eax,%edi
+  8010a7:	ff d1                	call   *%rcx
+			break;
+  8010a9:	e9 da 03 00 00       	jmp    801488 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  8010ae:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8010b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8010b4:	77 17                	ja     8010cd <vprintfmt+0x239>
+  8010b6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8010ba:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8010bd:	89 d2                	mov    %edx,%edx
+  8010bf:	48 01 d0             	add    %rdx,%rax
+  8010c2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8010c5:	83 c2 08             	add    $0x8,%edx
+  8010c8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8010cb:	eb 0c                	jmp    8010d9 <vprintfmt+0x245>
+  8010cd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8010d1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8010d5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8010d9:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  8010db:	85 db                	test   %ebx,%ebx
+  8010dd:	79 02                	jns    8010e1 <vprintfmt+0x24d>
+				err = -err;
+  8010df:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8010e1:	83 fb 15             	cmp    $0x15,%ebx
+  8010e4:	7f 19                	jg     8010ff <vprintfmt+0x26b>
+  8010e6:	48 ba 30 01 00 00 00 	movabs $0x130,%rdx
+  8010ed:	00 00 00 
+  8010f0:	48 63 c3             	movslq %ebx,%rax
+  8010f3:	4c 01 e2             	add    %r12,%rdx
+  8010f6:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  8010fa:	4d 85 ed             	test   %r13,%r13
+  8010fd:	75 36                	jne    801135 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  8010ff:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801103:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801107:	89 d9                	mov    %ebx,%ecx
+  801109:	48 ba 48 d7 ff ff ff 	movabs $0xffffffffffffd748,%rdx
+  801110:	ff ff ff 
+  801113:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  801117:	48 89 c7             	mov    %rax,%rdi
+  80111a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80111f:	49 b8 6b 84 ff ff ff 	movabs $0xffffffffffff846b,%r8
+  801126:	ff ff ff 
+  801129:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  80112d:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  801130:	e9 53 03 00 00       	jmp    801488 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  801135:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801139:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80113d:	4c 89 e9             	mov    %r13,%rcx
+  801140:	48 ba 51 d7 ff ff ff 	movabs $0xffffffffffffd751,%rdx
+  801147:	ff ff ff 
+  80114a:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  80114e:	48 89 c7             	mov    %rax,%rdi
+  801151:	b8 00 00 00 00       	mov    $0x0,%eax
+  801156:	49 b8 6b 84 ff ff ff 	movabs $0xffffffffffff846b,%r8
+  80115d:	ff ff ff 
+  801160:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  801164:	41 ff d0             	call   *%r8
+			break;
+  801167:	e9 1c 03 00 00       	jmp    801488 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  80116c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80116f:	83 f8 2f             	cmp    $0x2f,%eax
+  801172:	77 17                	ja     80118b <vprintfmt+0x2f7>
+  801174:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801178:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80117b:	89 d2                	mov    %edx,%edx
+  80117d:	48 01 d0             	add    %rdx,%rax
+  801180:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801183:	83 c2 08             	add    $0x8,%edx
+  801186:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801189:	eb 0c                	jmp    801197 <vprintfmt+0x303>
+  80118b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80118f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801193:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801197:	4c 8b 28             	mov    (%rax),%r13
+  80119a:	4d 85 ed             	test   %r13,%r13
+  80119d:	75 0e                	jne    8011ad <vprintfmt+0x319>
+				p = "(null)";
+  80119f:	48 b8 54 d7 ff ff ff 	movabs $0xffffffffffffd754,%rax
+  8011a6:	ff ff ff 
+  8011a9:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  8011ad:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8011b1:	0f 8e 84 00 00 00    	jle    80123b <vprintfmt+0x3a7>
+  8011b7:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  8011bb:	74 7e                	je     80123b <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8011bd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8011c0:	48 98                	cltq
+  8011c2:	48 89 c6             	mov    %rax,%rsi
+  8011c5:	4c 89 ef             	mov    %r13,%rdi
+  8011c8:	4d 89 e7             	mov    %r12,%r15
+  8011cb:	48 b8 4e 89 ff ff ff 	movabs $0xffffffffffff894e,%rax
+  8011d2:	ff ff ff 
+  8011d5:	4c 01 e0             	add    %r12,%rax
+  8011d8:	ff d0                	call   *%rax
+  8011da:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  8011dd:	eb 17                	jmp    8011f6 <vprintfmt+0x362>
+					putch(padc, putdat);
+  8011df:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  8011e3:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  8011e7:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8011eb:	48 89 d6             	mov    %rdx,%rsi
+  8011ee:	89 c7                	mov    %eax,%edi
+  8011f0:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8011f2:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8011f6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8011fa:	7f e3                	jg     8011df <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8011fc:	eb 3d                	jmp    80123b <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8011fe:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  801202:	74 1e                	je     801222 <vprintfmt+0x38e>
+  801204:	83 fb 1f             	cmp    $0x1f,%ebx
+  801207:	7e 05                	jle    80120e <vprintfmt+0x37a>
+  801209:	83 fb 7e             	cmp    $0x7e,%ebx
+  80120c:	7e 14                	jle    801222 <vprintfmt+0x38e>
+					putch('?', putdat);
+  80120e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801212:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801216:	48 89 c6             	mov    %rax,%rsi
+  801219:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80121e:	ff d2                	call   *%rdx
+  801220:	eb 15                	jmp    801237 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  801222:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801225:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  801228:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80122c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801230:	48 89 c6             	mov    %rax,%rsi
+  801233:	89 cf                	mov    %ecx,%edi
+  801235:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801237:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80123b:	4c 89 e8             	mov    %r13,%rax
+  80123e:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  801242:	0f b6 00             	movzbl (%rax),%eax
+  801245:	0f be d8             	movsbl %al,%ebx
+  801248:	85 db                	test   %ebx,%ebx
+  80124a:	74 28                	je     801274 <vprintfmt+0x3e0>
+  80124c:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801250:	78 ac                	js     8011fe <vprintfmt+0x36a>
+  801252:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  801256:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80125a:	79 a2                	jns    8011fe <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  80125c:	eb 16                	jmp    801274 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  80125e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801262:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801266:	48 89 c6             	mov    %rax,%rsi
+  801269:	bf 20 00 00 00       	mov    $0x20,%edi
+  80126e:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  801270:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801274:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801278:	7f e4                	jg     80125e <vprintfmt+0x3ca>
+			break;
+  80127a:	e9 09 02 00 00       	jmp    801488 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  80127f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801283:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801287:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80128b:	0f b6 00             	movzbl (%rax),%eax
+  80128e:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  801291:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  801292:	83 fb 2f             	cmp    $0x2f,%ebx
+  801295:	0f 8e ac fd ff ff    	jle    801047 <vprintfmt+0x1b3>
+  80129b:	e9 97 fd ff ff       	jmp    801037 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  8012a0:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8012a4:	be 03 00 00 00       	mov    $0x3,%esi
+  8012a9:	48 89 c7             	mov    %rax,%rdi
+  8012ac:	48 b8 49 7d ff ff ff 	movabs $0xffffffffffff7d49,%rax
+  8012b3:	ff ff ff 
+  8012b6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012ba:	ff d0                	call   *%rax
+  8012bc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  8012c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012c4:	48 85 c0             	test   %rax,%rax
+  8012c7:	79 1d                	jns    8012e6 <vprintfmt+0x452>
+				putch('-', putdat);
+  8012c9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8012cd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8012d1:	48 89 c6             	mov    %rax,%rsi
+  8012d4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8012d9:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  8012db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012df:	48 f7 d8             	neg    %rax
+  8012e2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  8012e6:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8012ed:	e9 de 00 00 00       	jmp    8013d0 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  8012f2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8012f6:	be 03 00 00 00       	mov    $0x3,%esi
+  8012fb:	48 89 c7             	mov    %rax,%rdi
+  8012fe:	48 b8 e8 7b ff ff ff 	movabs $0xffffffffffff7be8,%rax
+  801305:	ff ff ff 
+  801308:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80130c:	ff d0                	call   *%rax
+  80130e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801312:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801319:	e9 b2 00 00 00       	jmp    8013d0 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  80131e:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801322:	be 03 00 00 00       	mov    $0x3,%esi
+  801327:	48 89 c7             	mov    %rax,%rdi
+  80132a:	48 b8 e8 7b ff ff ff 	movabs $0xffffffffffff7be8,%rax
+  801331:	ff ff ff 
+  801334:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801338:	ff d0                	call   *%rax
+  80133a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  80133e:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801345:	e9 86 00 00 00       	jmp    8013d0 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80134a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80134e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801352:	48 89 c6             	mov    %rax,%rsi
+  801355:	bf 30 00 00 00       	mov    $0x30,%edi
+  80135a:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  80135c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801360:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801364:	48 89 c6             	mov    %rax,%rsi
+  801367:	bf 78 00 00 00       	mov    $0x78,%edi
+  80136c:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  80136e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801371:	83 f8 2f             	cmp    $0x2f,%eax
+  801374:	77 17                	ja     80138d <vprintfmt+0x4f9>
+  801376:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80137a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80137d:	89 d2                	mov    %edx,%edx
+  80137f:	48 01 d0             	add    %rdx,%rax
+  801382:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801385:	83 c2 08             	add    $0x8,%edx
+  801388:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80138b:	eb 0c                	jmp    801399 <vprintfmt+0x505>
+  80138d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801391:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801395:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801399:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  80139c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8013a0:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8013a7:	eb 27                	jmp    8013d0 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8013a9:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8013ad:	be 03 00 00 00       	mov    $0x3,%esi
+  8013b2:	48 89 c7             	mov    %rax,%rdi
+  8013b5:	48 b8 e8 7b ff ff ff 	movabs $0xffffffffffff7be8,%rax
+  8013bc:	ff ff ff 
+  8013bf:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013c3:	ff d0                	call   *%rax
+  8013c5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8013c9:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8013d0:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8013d5:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8013d8:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8013db:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8013df:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8013e3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8013e7:	45 89 c1             	mov    %r8d,%r9d
+  8013ea:	41 89 f8             	mov    %edi,%r8d
+  8013ed:	48 89 c7             	mov    %rax,%rdi
+  8013f0:	48 b8 10 7b ff ff ff 	movabs $0xffffffffffff7b10,%rax
+  8013f7:	ff ff ff 
+  8013fa:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013fe:	ff d0                	call   *%rax
+			break;
+  801400:	e9 83 00 00 00       	jmp    801488 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801405:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801409:	be 03 00 00 00       	mov    $0x3,%esi
+  80140e:	48 89 c7             	mov    %rax,%rdi
+  801411:	48 b8 e8 7b ff ff ff 	movabs $0xffffffffffff7be8,%rax
+  801418:	ff ff ff 
+  80141b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80141f:	ff d0                	call   *%rax
+  801421:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801425:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801429:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80142d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801431:	48 89 ce             	mov    %rcx,%rsi
+  801434:	48 89 c7             	mov    %rax,%rdi
+  801437:	48 b8 03 7d ff ff ff 	movabs $0xffffffffffff7d03,%rax
+  80143e:	ff ff ff 
+  801441:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801445:	ff d0                	call   *%rax
+	
+			break;
+  801447:	eb 3f                	jmp    801488 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801449:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80144d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801451:	48 89 c6             	mov    %rax,%rsi
+  801454:	89 df                	mov    %ebx,%edi
+  801456:	ff d2                	call   *%rdx
+			break;
+  801458:	eb 2e                	jmp    801488 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80145a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80145e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801462:	48 89 c6             	mov    %rax,%rsi
+  801465:	bf 25 00 00 00       	mov    $0x25,%edi
+  80146a:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80146c:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801471:	eb 05                	jmp    801478 <vprintfmt+0x5e4>
+  801473:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801478:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80147c:	48 83 e8 01          	sub    $0x1,%rax
+  801480:	0f b6 00             	movzbl (%rax),%eax
+  801483:	3c 25                	cmp    $0x25,%al
+  801485:	75 ec                	jne    801473 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801487:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801488:	e9 78 fa ff ff       	jmp    800f05 <vprintfmt+0x71>
+				return;
+  80148d:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80148e:	48 83 c4 60          	add    $0x60,%rsp
+  801492:	5b                   	pop    %rbx
+  801493:	41 5c                	pop    %r12
+  801495:	41 5d                	pop    %r13
+  801497:	41 5f                	pop    %r15
+  801499:	5d                   	pop    %rbp
+  80149a:	c3                   	ret
+
+000000000080149b <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8014a6:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8014a6 <printfmt+0xb>
+  8014ad:	49 bb 8a 7b 00 00 00 	movabs $0x7b8a,%r11
+  8014b4:	00 00 00 
+  8014b7:	4d 01 da             	add    %r11,%r10
+  8014ba:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8014c1:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8014c8:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8014cf:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8014d6:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8014dd:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8014e4:	84 c0                	test   %al,%al
+  8014e6:	74 20                	je     801508 <printfmt+0x6d>
+  8014e8:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8014ec:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8014f0:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8014f4:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8014f8:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8014fc:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801500:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801504:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801508:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80150f:	00 00 00 
+  801512:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801519:	00 00 00 
+  80151c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801520:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801527:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80152e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801535:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80153c:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801543:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80154a:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801551:	48 89 c7             	mov    %rax,%rdi
+  801554:	48 b8 64 7e ff ff ff 	movabs $0xffffffffffff7e64,%rax
+  80155b:	ff ff ff 
+  80155e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801562:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801564:	90                   	nop
+  801565:	c9                   	leave
+  801566:	c3                   	ret
+
+0000000000801567 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801567:	55                   	push   %rbp
+  801568:	48 89 e5             	mov    %rsp,%rbp
+  80156b:	48 83 ec 10          	sub    $0x10,%rsp
+  80156f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80156f <sprintputch+0x8>
+  801576:	49 bb c1 7a 00 00 00 	movabs $0x7ac1,%r11
+  80157d:	00 00 00 
+  801580:	4c 01 d8             	add    %r11,%rax
+  801583:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801586:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  80158a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80158e:	8b 40 10             	mov    0x10(%rax),%eax
+  801591:	8d 50 01             	lea    0x1(%rax),%edx
+  801594:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801598:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  80159b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80159f:	48 8b 10             	mov    (%rax),%rdx
+  8015a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015a6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8015aa:	48 39 c2             	cmp    %rax,%rdx
+  8015ad:	73 17                	jae    8015c6 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8015af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015b3:	48 8b 00             	mov    (%rax),%rax
+  8015b6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8015ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8015be:	48 89 0a             	mov    %rcx,(%rdx)
+  8015c1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8015c4:	88 10                	mov    %dl,(%rax)
+}
+  8015c6:	90                   	nop
+  8015c7:	c9                   	leave
+  8015c8:	c3                   	ret
+
+00000000008015c9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8015c9:	55                   	push   %rbp
+  8015ca:	48 89 e5             	mov    %rsp,%rbp
+  8015cd:	53                   	push   %rbx
+  8015ce:	48 83 ec 58          	sub    $0x58,%rsp
+  8015d2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015d2 <vsnprintf+0x9>
+  8015d9:	49 bb 5e 7a 00 00 00 	movabs $0x7a5e,%r11
+  8015e0:	00 00 00 
+  8015e3:	4c 01 d8             	add    %r11,%rax
+  8015e6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8015ea:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8015ed:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8015f1:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8015f5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8015f9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8015fd:	48 8b 0e             	mov    (%rsi),%rcx
+  801600:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801604:	48 89 0a             	mov    %rcx,(%rdx)
+  801607:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  80160b:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  80160f:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801613:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801617:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80161b:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  80161e:	48 63 d2             	movslq %edx,%rdx
+  801621:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801625:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801629:	48 01 ca             	add    %rcx,%rdx
+  80162c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801630:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801637:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80163c:	74 06                	je     801644 <vsnprintf+0x7b>
+  80163e:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801642:	7f 07                	jg     80164b <vsnprintf+0x82>
+		return -E_INVAL;
+  801644:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801649:	eb 34                	jmp    80167f <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  80164b:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  80164f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801653:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801657:	48 bf 37 85 ff ff ff 	movabs $0xffffffffffff8537,%rdi
+  80165e:	ff ff ff 
+  801661:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801665:	49 b8 64 7e ff ff ff 	movabs $0xffffffffffff7e64,%r8
+  80166c:	ff ff ff 
+  80166f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801673:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801675:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801679:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80167c:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80167f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801683:	c9                   	leave
+  801684:	c3                   	ret
+
+0000000000801685 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801685:	55                   	push   %rbp
+  801686:	48 89 e5             	mov    %rsp,%rbp
+  801689:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801690:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801690 <snprintf+0xb>
+  801697:	49 bb a0 79 00 00 00 	movabs $0x79a0,%r11
+  80169e:	00 00 00 
+  8016a1:	4d 01 da             	add    %r11,%r10
+  8016a4:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8016ab:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8016b1:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8016b8:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8016bf:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8016c6:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8016cd:	84 c0                	test   %al,%al
+  8016cf:	74 20                	je     8016f1 <snprintf+0x6c>
+  8016d1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8016d5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8016d9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8016dd:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8016e1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8016e5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8016e9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8016ed:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8016f1:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8016f8:	00 00 00 
+  8016fb:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801702:	00 00 00 
+  801705:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801709:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801710:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801717:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  80171e:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801725:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80172c:	48 8b 06             	mov    (%rsi),%rax
+  80172f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801733:	48 89 01             	mov    %rax,(%rcx)
+  801736:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80173a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80173e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801742:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801749:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801750:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801756:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80175d:	48 89 c7             	mov    %rax,%rdi
+  801760:	48 b8 99 85 ff ff ff 	movabs $0xffffffffffff8599,%rax
+  801767:	ff ff ff 
+  80176a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80176e:	ff d0                	call   *%rax
+  801770:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801776:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80177c:	c9                   	leave
+  80177d:	c3                   	ret
+
+000000000080177e <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  80177e:	55                   	push   %rbp
+  80177f:	48 89 e5             	mov    %rsp,%rbp
+  801782:	41 57                	push   %r15
+  801784:	53                   	push   %rbx
+  801785:	48 83 ec 20          	sub    $0x20,%rsp
+  801789:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801789 <readline+0xb>
+  801790:	49 bb a7 78 00 00 00 	movabs $0x78a7,%r11
+  801797:	00 00 00 
+  80179a:	4c 01 db             	add    %r11,%rbx
+  80179d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  8017a1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017a6:	74 34                	je     8017dc <readline+0x5e>
+		fprintf(1, "%s", prompt);
+  8017a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ac:	48 89 c2             	mov    %rax,%rdx
+  8017af:	48 b8 10 da ff ff ff 	movabs $0xffffffffffffda10,%rax
+  8017b6:	ff ff ff 
+  8017b9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8017bd:	48 89 c6             	mov    %rax,%rsi
+  8017c0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8017c5:	49 89 df             	mov    %rbx,%r15
+  8017c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017cd:	48 b9 be b6 ff ff ff 	movabs $0xffffffffffffb6be,%rcx
+  8017d4:	ff ff ff 
+  8017d7:	48 01 d9             	add    %rbx,%rcx
+  8017da:	ff d1                	call   *%rcx
+#endif
+
+	i = 0;
+  8017dc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	echoing = iscons(0);
+  8017e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017e8:	49 89 df             	mov    %rbx,%r15
+  8017eb:	48 b8 19 73 ff ff ff 	movabs $0xffffffffffff7319,%rax
+  8017f2:	ff ff ff 
+  8017f5:	48 01 d8             	add    %rbx,%rax
+  8017f8:	ff d0                	call   *%rax
+  8017fa:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	while (1) {
+		c = getchar();
+  8017fd:	49 89 df             	mov    %rbx,%r15
+  801800:	48 b8 b0 72 ff ff ff 	movabs $0xffffffffffff72b0,%rax
+  801807:	ff ff ff 
+  80180a:	48 01 d8             	add    %rbx,%rax
+  80180d:	ff d0                	call   *%rax
+  80180f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+		if (c < 0) {
+  801812:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801816:	79 3d                	jns    801855 <readline+0xd7>
+			if (c != -E_EOF)
+  801818:	83 7d e4 f7          	cmpl   $0xfffffff7,-0x1c(%rbp)
+  80181c:	74 2d                	je     80184b <readline+0xcd>
+				cprintf("read error: %e\n", c);
+  80181e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801821:	89 c6                	mov    %eax,%esi
+  801823:	48 b8 13 da ff ff ff 	movabs $0xffffffffffffda13,%rax
+  80182a:	ff ff ff 
+  80182d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801831:	48 89 c7             	mov    %rax,%rdi
+  801834:	49 89 df             	mov    %rbx,%r15
+  801837:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183c:	48 ba 20 7a ff ff ff 	movabs $0xffffffffffff7a20,%rdx
+  801843:	ff ff ff 
+  801846:	48 01 da             	add    %rbx,%rdx
+  801849:	ff d2                	call   *%rdx
+			return NULL;
+  80184b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801850:	e9 de 00 00 00       	jmp    801933 <readline+0x1b5>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  801855:	83 7d e4 08          	cmpl   $0x8,-0x1c(%rbp)
+  801859:	74 06                	je     801861 <readline+0xe3>
+  80185b:	83 7d e4 7f          	cmpl   $0x7f,-0x1c(%rbp)
+  80185f:	75 2c                	jne    80188d <readline+0x10f>
+  801861:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801865:	7e 26                	jle    80188d <readline+0x10f>
+			if (echoing)
+  801867:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80186b:	74 17                	je     801884 <readline+0x106>
+				cputchar('\b');
+  80186d:	bf 08 00 00 00       	mov    $0x8,%edi
+  801872:	49 89 df             	mov    %rbx,%r15
+  801875:	48 b8 64 72 ff ff ff 	movabs $0xffffffffffff7264,%rax
+  80187c:	ff ff ff 
+  80187f:	48 01 d8             	add    %rbx,%rax
+  801882:	ff d0                	call   *%rax
+			i--;
+  801884:	83 6d ec 01          	subl   $0x1,-0x14(%rbp)
+  801888:	e9 a1 00 00 00       	jmp    80192e <readline+0x1b0>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  80188d:	83 7d e4 1f          	cmpl   $0x1f,-0x1c(%rbp)
+  801891:	7e 48                	jle    8018db <readline+0x15d>
+  801893:	81 7d ec fe 03 00 00 	cmpl   $0x3fe,-0x14(%rbp)
+  80189a:	7f 3f                	jg     8018db <readline+0x15d>
+			if (echoing)
+  80189c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8018a0:	74 17                	je     8018b9 <readline+0x13b>
+				cputchar(c);
+  8018a2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8018a5:	89 c7                	mov    %eax,%edi
+  8018a7:	49 89 df             	mov    %rbx,%r15
+  8018aa:	48 b8 64 72 ff ff ff 	movabs $0xffffffffffff7264,%rax
+  8018b1:	ff ff ff 
+  8018b4:	48 01 d8             	add    %rbx,%rax
+  8018b7:	ff d0                	call   *%rax
+			buf[i++] = c;
+  8018b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8018bc:	8d 50 01             	lea    0x1(%rax),%edx
+  8018bf:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  8018c2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8018c5:	89 d1                	mov    %edx,%ecx
+  8018c7:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8018ce:	00 00 00 
+  8018d1:	48 98                	cltq
+  8018d3:	48 01 da             	add    %rbx,%rdx
+  8018d6:	88 0c 02             	mov    %cl,(%rdx,%rax,1)
+  8018d9:	eb 53                	jmp    80192e <readline+0x1b0>
+		} else if (c == '\n' || c == '\r') {
+  8018db:	83 7d e4 0a          	cmpl   $0xa,-0x1c(%rbp)
+  8018df:	74 0a                	je     8018eb <readline+0x16d>
+  8018e1:	83 7d e4 0d          	cmpl   $0xd,-0x1c(%rbp)
+  8018e5:	0f 85 12 ff ff ff    	jne    8017fd <readline+0x7f>
+			if (echoing)
+  8018eb:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8018ef:	74 17                	je     801908 <readline+0x18a>
+				cputchar('\n');
+  8018f1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8018f6:	49 89 df             	mov    %rbx,%r15
+  8018f9:	48 b8 64 72 ff ff ff 	movabs $0xffffffffffff7264,%rax
+  801900:	ff ff ff 
+  801903:	48 01 d8             	add    %rbx,%rax
+  801906:	ff d0                	call   *%rax
+			buf[i] = 0;
+  801908:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  80190f:	00 00 00 
+  801912:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801915:	48 98                	cltq
+  801917:	48 01 da             	add    %rbx,%rdx
+  80191a:	c6 04 02 00          	movb   $0x0,(%rdx,%rax,1)
+			return buf;
+  80191e:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  801925:	00 00 00 
+  801928:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80192c:	eb 05                	jmp    801933 <readline+0x1b5>
+		c = getchar();
+  80192e:	e9 ca fe ff ff       	jmp    8017fd <readline+0x7f>
+		}
+	}
+}
+  801933:	48 83 c4 20          	add    $0x20,%rsp
+  801937:	5b                   	pop    %rbx
+  801938:	41 5f                	pop    %r15
+  80193a:	5d                   	pop    %rbp
+  80193b:	c3                   	ret
+
+000000000080193c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80193c:	55                   	push   %rbp
+  80193d:	48 89 e5             	mov    %rsp,%rbp
+  801940:	48 83 ec 18          	sub    $0x18,%rsp
+  801944:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801944 <strlen+0x8>
+  80194b:	49 bb ec 76 00 00 00 	movabs $0x76ec,%r11
+  801952:	00 00 00 
+  801955:	4c 01 d8             	add    %r11,%rax
+  801958:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80195c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801963:	eb 09                	jmp    80196e <strlen+0x32>
+		n++;
+  801965:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801969:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80196e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801972:	0f b6 00             	movzbl (%rax),%eax
+  801975:	84 c0                	test   %al,%al
+  801977:	75 ec                	jne    801965 <strlen+0x29>
+	return n;
+  801979:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80197c:	c9                   	leave
+  80197d:	c3                   	ret
+
+000000000080197e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80197e:	55                   	push   %rbp
+  80197f:	48 89 e5             	mov    %rsp,%rbp
+  801982:	48 83 ec 20          	sub    $0x20,%rsp
+  801986:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801986 <strnlen+0x8>
+  80198d:	49 bb aa 76 00 00 00 	movabs $0x76aa,%r11
+  801994:	00 00 00 
+  801997:	4c 01 d8             	add    %r11,%rax
+  80199a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80199e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8019a2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8019a9:	eb 0e                	jmp    8019b9 <strnlen+0x3b>
+		n++;
+  8019ab:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8019af:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8019b4:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8019b9:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8019be:	74 0b                	je     8019cb <strnlen+0x4d>
+  8019c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019c4:	0f b6 00             	movzbl (%rax),%eax
+  8019c7:	84 c0                	test   %al,%al
+  8019c9:	75 e0                	jne    8019ab <strnlen+0x2d>
+	return n;
+  8019cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8019ce:	c9                   	leave
+  8019cf:	c3                   	ret
+
+00000000008019d0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8019d0:	55                   	push   %rbp
+  8019d1:	48 89 e5             	mov    %rsp,%rbp
+  8019d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8019d8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019d8 <strcpy+0x8>
+  8019df:	49 bb 58 76 00 00 00 	movabs $0x7658,%r11
+  8019e6:	00 00 00 
+  8019e9:	4c 01 d8             	add    %r11,%rax
+  8019ec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019f0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8019f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019f8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8019fc:	90                   	nop
+  8019fd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801a01:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801a05:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801a09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a0d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a11:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a15:	0f b6 12             	movzbl (%rdx),%edx
+  801a18:	88 10                	mov    %dl,(%rax)
+  801a1a:	0f b6 00             	movzbl (%rax),%eax
+  801a1d:	84 c0                	test   %al,%al
+  801a1f:	75 dc                	jne    8019fd <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801a21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a25:	c9                   	leave
+  801a26:	c3                   	ret
+
+0000000000801a27 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801a27:	55                   	push   %rbp
+  801a28:	48 89 e5             	mov    %rsp,%rbp
+  801a2b:	53                   	push   %rbx
+  801a2c:	48 83 ec 20          	sub    $0x20,%rsp
+  801a30:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801a30 <strcat+0x9>
+  801a37:	49 bb 00 76 00 00 00 	movabs $0x7600,%r11
+  801a3e:	00 00 00 
+  801a41:	4c 01 db             	add    %r11,%rbx
+  801a44:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801a48:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801a4c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a50:	48 89 c7             	mov    %rax,%rdi
+  801a53:	48 b8 0c 89 ff ff ff 	movabs $0xffffffffffff890c,%rax
+  801a5a:	ff ff ff 
+  801a5d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801a61:	ff d0                	call   *%rax
+  801a63:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801a66:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a69:	48 63 d0             	movslq %eax,%rdx
+  801a6c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a70:	48 01 c2             	add    %rax,%rdx
+  801a73:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a77:	48 89 c6             	mov    %rax,%rsi
+  801a7a:	48 89 d7             	mov    %rdx,%rdi
+  801a7d:	48 b8 a0 89 ff ff ff 	movabs $0xffffffffffff89a0,%rax
+  801a84:	ff ff ff 
+  801a87:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801a8b:	ff d0                	call   *%rax
+	return dst;
+  801a8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801a91:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a95:	c9                   	leave
+  801a96:	c3                   	ret
+
+0000000000801a97 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801a97:	55                   	push   %rbp
+  801a98:	48 89 e5             	mov    %rsp,%rbp
+  801a9b:	48 83 ec 28          	sub    $0x28,%rsp
+  801a9f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a9f <strncpy+0x8>
+  801aa6:	49 bb 91 75 00 00 00 	movabs $0x7591,%r11
+  801aad:	00 00 00 
+  801ab0:	4c 01 d8             	add    %r11,%rax
+  801ab3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ab7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801abb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801abf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ac3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801ac7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801ace:	00 
+  801acf:	eb 2a                	jmp    801afb <strncpy+0x64>
+		*dst++ = *src;
+  801ad1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ad5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ad9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801add:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801ae1:	0f b6 12             	movzbl (%rdx),%edx
+  801ae4:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801ae6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801aea:	0f b6 00             	movzbl (%rax),%eax
+  801aed:	84 c0                	test   %al,%al
+  801aef:	74 05                	je     801af6 <strncpy+0x5f>
+			src++;
+  801af1:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801af6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801afb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aff:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801b03:	72 cc                	jb     801ad1 <strncpy+0x3a>
+	}
+	return ret;
+  801b05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801b09:	c9                   	leave
+  801b0a:	c3                   	ret
+
+0000000000801b0b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801b0b:	55                   	push   %rbp
+  801b0c:	48 89 e5             	mov    %rsp,%rbp
+  801b0f:	48 83 ec 28          	sub    $0x28,%rsp
+  801b13:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b13 <strlcpy+0x8>
+  801b1a:	49 bb 1d 75 00 00 00 	movabs $0x751d,%r11
+  801b21:	00 00 00 
+  801b24:	4c 01 d8             	add    %r11,%rax
+  801b27:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b2b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801b2f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801b33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b37:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801b3b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801b40:	74 3d                	je     801b7f <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801b42:	eb 1d                	jmp    801b61 <strlcpy+0x56>
+			*dst++ = *src++;
+  801b44:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801b48:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801b4c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801b50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b54:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801b58:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b5c:	0f b6 12             	movzbl (%rdx),%edx
+  801b5f:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801b61:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801b66:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801b6b:	74 0b                	je     801b78 <strlcpy+0x6d>
+  801b6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b71:	0f b6 00             	movzbl (%rax),%eax
+  801b74:	84 c0                	test   %al,%al
+  801b76:	75 cc                	jne    801b44 <strlcpy+0x39>
+		*dst = '\0';
+  801b78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b7c:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801b7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b83:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801b87:	c9                   	leave
+  801b88:	c3                   	ret
+
+0000000000801b89 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801b89:	55                   	push   %rbp
+  801b8a:	48 89 e5             	mov    %rsp,%rbp
+  801b8d:	48 83 ec 10          	sub    $0x10,%rsp
+  801b91:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b91 <strcmp+0x8>
+  801b98:	49 bb 9f 74 00 00 00 	movabs $0x749f,%r11
+  801b9f:	00 00 00 
+  801ba2:	4c 01 d8             	add    %r11,%rax
+  801ba5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ba9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801bad:	eb 0a                	jmp    801bb9 <strcmp+0x30>
+		p++, q++;
+  801baf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801bb4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801bb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bbd:	0f b6 00             	movzbl (%rax),%eax
+  801bc0:	84 c0                	test   %al,%al
+  801bc2:	74 12                	je     801bd6 <strcmp+0x4d>
+  801bc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bc8:	0f b6 10             	movzbl (%rax),%edx
+  801bcb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bcf:	0f b6 00             	movzbl (%rax),%eax
+  801bd2:	38 c2                	cmp    %al,%dl
+  801bd4:	74 d9                	je     801baf <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801bd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bda:	0f b6 00             	movzbl (%rax),%eax
+  801bdd:	0f b6 d0             	movzbl %al,%edx
+  801be0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801be4:	0f b6 00             	movzbl (%rax),%eax
+  801be7:	0f b6 c0             	movzbl %al,%eax
+  801bea:	29 c2                	sub    %eax,%edx
+  801bec:	89 d0                	mov    %edx,%eax
+}
+  801bee:	c9                   	leave
+  801bef:	c3                   	ret
+
+0000000000801bf0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801bf0:	55                   	push   %rbp
+  801bf1:	48 89 e5             	mov    %rsp,%rbp
+  801bf4:	48 83 ec 18          	sub    $0x18,%rsp
+  801bf8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801bf8 <strncmp+0x8>
+  801bff:	49 bb 38 74 00 00 00 	movabs $0x7438,%r11
+  801c06:	00 00 00 
+  801c09:	4c 01 d8             	add    %r11,%rax
+  801c0c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c10:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c14:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801c18:	eb 0f                	jmp    801c29 <strncmp+0x39>
+		n--, p++, q++;
+  801c1a:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801c1f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c24:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801c29:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801c2e:	74 1d                	je     801c4d <strncmp+0x5d>
+  801c30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c34:	0f b6 00             	movzbl (%rax),%eax
+  801c37:	84 c0                	test   %al,%al
+  801c39:	74 12                	je     801c4d <strncmp+0x5d>
+  801c3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c3f:	0f b6 10             	movzbl (%rax),%edx
+  801c42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c46:	0f b6 00             	movzbl (%rax),%eax
+  801c49:	38 c2                	cmp    %al,%dl
+  801c4b:	74 cd                	je     801c1a <strncmp+0x2a>
+	if (n == 0)
+  801c4d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801c52:	75 07                	jne    801c5b <strncmp+0x6b>
+		return 0;
+  801c54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c59:	eb 16                	jmp    801c71 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801c5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c5f:	0f b6 00             	movzbl (%rax),%eax
+  801c62:	0f b6 d0             	movzbl %al,%edx
+  801c65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c69:	0f b6 00             	movzbl (%rax),%eax
+  801c6c:	0f b6 c0             	movzbl %al,%eax
+  801c6f:	29 c2                	sub    %eax,%edx
+}
+  801c71:	89 d0                	mov    %edx,%eax
+  801c73:	c9                   	leave
+  801c74:	c3                   	ret
+
+0000000000801c75 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801c75:	55                   	push   %rbp
+  801c76:	48 89 e5             	mov    %rsp,%rbp
+  801c79:	48 83 ec 10          	sub    $0x10,%rsp
+  801c7d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c7d <strchr+0x8>
+  801c84:	49 bb b3 73 00 00 00 	movabs $0x73b3,%r11
+  801c8b:	00 00 00 
+  801c8e:	4c 01 d8             	add    %r11,%rax
+  801c91:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c95:	89 f0                	mov    %esi,%eax
+  801c97:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801c9a:	eb 17                	jmp    801cb3 <strchr+0x3e>
+		if (*s == c)
+  801c9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ca0:	0f b6 00             	movzbl (%rax),%eax
+  801ca3:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801ca6:	75 06                	jne    801cae <strchr+0x39>
+			return (char *) s;
+  801ca8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cac:	eb 15                	jmp    801cc3 <strchr+0x4e>
+	for (; *s; s++)
+  801cae:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801cb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cb7:	0f b6 00             	movzbl (%rax),%eax
+  801cba:	84 c0                	test   %al,%al
+  801cbc:	75 de                	jne    801c9c <strchr+0x27>
+	return 0;
+  801cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cc3:	c9                   	leave
+  801cc4:	c3                   	ret
+
+0000000000801cc5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801cc5:	55                   	push   %rbp
+  801cc6:	48 89 e5             	mov    %rsp,%rbp
+  801cc9:	48 83 ec 10          	sub    $0x10,%rsp
+  801ccd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ccd <strfind+0x8>
+  801cd4:	49 bb 63 73 00 00 00 	movabs $0x7363,%r11
+  801cdb:	00 00 00 
+  801cde:	4c 01 d8             	add    %r11,%rax
+  801ce1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ce5:	89 f0                	mov    %esi,%eax
+  801ce7:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801cea:	eb 11                	jmp    801cfd <strfind+0x38>
+		if (*s == c)
+  801cec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cf0:	0f b6 00             	movzbl (%rax),%eax
+  801cf3:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801cf6:	74 12                	je     801d0a <strfind+0x45>
+	for (; *s; s++)
+  801cf8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801cfd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d01:	0f b6 00             	movzbl (%rax),%eax
+  801d04:	84 c0                	test   %al,%al
+  801d06:	75 e4                	jne    801cec <strfind+0x27>
+  801d08:	eb 01                	jmp    801d0b <strfind+0x46>
+			break;
+  801d0a:	90                   	nop
+	return (char *) s;
+  801d0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801d0f:	c9                   	leave
+  801d10:	c3                   	ret
+
+0000000000801d11 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801d11:	55                   	push   %rbp
+  801d12:	48 89 e5             	mov    %rsp,%rbp
+  801d15:	48 83 ec 18          	sub    $0x18,%rsp
+  801d19:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d19 <memset+0x8>
+  801d20:	49 bb 17 73 00 00 00 	movabs $0x7317,%r11
+  801d27:	00 00 00 
+  801d2a:	4c 01 d8             	add    %r11,%rax
+  801d2d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d31:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801d34:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801d38:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d3d:	75 06                	jne    801d45 <memset+0x34>
+		return v;
+  801d3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d43:	eb 69                	jmp    801dae <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801d45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d49:	83 e0 03             	and    $0x3,%eax
+  801d4c:	48 85 c0             	test   %rax,%rax
+  801d4f:	75 48                	jne    801d99 <memset+0x88>
+  801d51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d55:	83 e0 03             	and    $0x3,%eax
+  801d58:	48 85 c0             	test   %rax,%rax
+  801d5b:	75 3c                	jne    801d99 <memset+0x88>
+		c &= 0xFF;
+  801d5d:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801d64:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801d67:	c1 e0 18             	shl    $0x18,%eax
+  801d6a:	89 c2                	mov    %eax,%edx
+  801d6c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801d6f:	c1 e0 10             	shl    $0x10,%eax
+  801d72:	09 c2                	or     %eax,%edx
+  801d74:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801d77:	c1 e0 08             	shl    $0x8,%eax
+  801d7a:	09 d0                	or     %edx,%eax
+  801d7c:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801d7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d83:	48 c1 e8 02          	shr    $0x2,%rax
+  801d87:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801d8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d8e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801d91:	48 89 d7             	mov    %rdx,%rdi
+  801d94:	fc                   	cld
+  801d95:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801d97:	eb 11                	jmp    801daa <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801d99:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d9d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801da0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801da4:	48 89 d7             	mov    %rdx,%rdi
+  801da7:	fc                   	cld
+  801da8:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801daa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801dae:	c9                   	leave
+  801daf:	c3                   	ret
+
+0000000000801db0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801db0:	55                   	push   %rbp
+  801db1:	48 89 e5             	mov    %rsp,%rbp
+  801db4:	48 83 ec 28          	sub    $0x28,%rsp
+  801db8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801db8 <memmove+0x8>
+  801dbf:	49 bb 78 72 00 00 00 	movabs $0x7278,%r11
+  801dc6:	00 00 00 
+  801dc9:	4c 01 d8             	add    %r11,%rax
+  801dcc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801dd0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801dd4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801dd8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ddc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801de0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801de4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801de8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dec:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801df0:	0f 83 88 00 00 00    	jae    801e7e <memmove+0xce>
+  801df6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801dfa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dfe:	48 01 d0             	add    %rdx,%rax
+  801e01:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801e05:	73 77                	jae    801e7e <memmove+0xce>
+		s += n;
+  801e07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e0b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801e0f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e13:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801e17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e1b:	83 e0 03             	and    $0x3,%eax
+  801e1e:	48 85 c0             	test   %rax,%rax
+  801e21:	75 3b                	jne    801e5e <memmove+0xae>
+  801e23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e27:	83 e0 03             	and    $0x3,%eax
+  801e2a:	48 85 c0             	test   %rax,%rax
+  801e2d:	75 2f                	jne    801e5e <memmove+0xae>
+  801e2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e33:	83 e0 03             	and    $0x3,%eax
+  801e36:	48 85 c0             	test   %rax,%rax
+  801e39:	75 23                	jne    801e5e <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801e3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e3f:	48 83 e8 04          	sub    $0x4,%rax
+  801e43:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e47:	48 83 ea 04          	sub    $0x4,%rdx
+  801e4b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801e4f:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801e53:	48 89 c7             	mov    %rax,%rdi
+  801e56:	48 89 d6             	mov    %rdx,%rsi
+  801e59:	fd                   	std
+  801e5a:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801e5c:	eb 1d                	jmp    801e7b <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801e5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e62:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e6a:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801e6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e72:	48 89 d7             	mov    %rdx,%rdi
+  801e75:	48 89 c1             	mov    %rax,%rcx
+  801e78:	fd                   	std
+  801e79:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801e7b:	fc                   	cld
+  801e7c:	eb 57                	jmp    801ed5 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801e7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e82:	83 e0 03             	and    $0x3,%eax
+  801e85:	48 85 c0             	test   %rax,%rax
+  801e88:	75 36                	jne    801ec0 <memmove+0x110>
+  801e8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e8e:	83 e0 03             	and    $0x3,%eax
+  801e91:	48 85 c0             	test   %rax,%rax
+  801e94:	75 2a                	jne    801ec0 <memmove+0x110>
+  801e96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e9a:	83 e0 03             	and    $0x3,%eax
+  801e9d:	48 85 c0             	test   %rax,%rax
+  801ea0:	75 1e                	jne    801ec0 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801ea2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ea6:	48 c1 e8 02          	shr    $0x2,%rax
+  801eaa:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801ead:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801eb1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801eb5:	48 89 c7             	mov    %rax,%rdi
+  801eb8:	48 89 d6             	mov    %rdx,%rsi
+  801ebb:	fc                   	cld
+  801ebc:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801ebe:	eb 15                	jmp    801ed5 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801ec0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ec4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ec8:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801ecc:	48 89 c7             	mov    %rax,%rdi
+  801ecf:	48 89 d6             	mov    %rdx,%rsi
+  801ed2:	fc                   	cld
+  801ed3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801ed5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801ed9:	c9                   	leave
+  801eda:	c3                   	ret
+
+0000000000801edb <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801edb:	55                   	push   %rbp
+  801edc:	48 89 e5             	mov    %rsp,%rbp
+  801edf:	48 83 ec 18          	sub    $0x18,%rsp
+  801ee3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ee3 <memcpy+0x8>
+  801eea:	49 bb 4d 71 00 00 00 	movabs $0x714d,%r11
+  801ef1:	00 00 00 
+  801ef4:	4c 01 d8             	add    %r11,%rax
+  801ef7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801efb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801eff:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801f03:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f07:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801f0b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801f0f:	48 89 cf             	mov    %rcx,%rdi
+  801f12:	48 b9 80 8d ff ff ff 	movabs $0xffffffffffff8d80,%rcx
+  801f19:	ff ff ff 
+  801f1c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801f20:	ff d0                	call   *%rax
+}
+  801f22:	c9                   	leave
+  801f23:	c3                   	ret
+
+0000000000801f24 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801f24:	55                   	push   %rbp
+  801f25:	48 89 e5             	mov    %rsp,%rbp
+  801f28:	48 83 ec 28          	sub    $0x28,%rsp
+  801f2c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f2c <memcmp+0x8>
+  801f33:	49 bb 04 71 00 00 00 	movabs $0x7104,%r11
+  801f3a:	00 00 00 
+  801f3d:	4c 01 d8             	add    %r11,%rax
+  801f40:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f44:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801f48:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801f4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f50:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801f54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f58:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801f5c:	eb 34                	jmp    801f92 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801f5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f62:	0f b6 10             	movzbl (%rax),%edx
+  801f65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f69:	0f b6 00             	movzbl (%rax),%eax
+  801f6c:	38 c2                	cmp    %al,%dl
+  801f6e:	74 18                	je     801f88 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801f70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f74:	0f b6 00             	movzbl (%rax),%eax
+  801f77:	0f b6 d0             	movzbl %al,%edx
+  801f7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f7e:	0f b6 00             	movzbl (%rax),%eax
+  801f81:	0f b6 c0             	movzbl %al,%eax
+  801f84:	29 c2                	sub    %eax,%edx
+  801f86:	eb 20                	jmp    801fa8 <memcmp+0x84>
+		s1++, s2++;
+  801f88:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801f8d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801f92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f96:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801f9a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801f9e:	48 85 c0             	test   %rax,%rax
+  801fa1:	75 bb                	jne    801f5e <memcmp+0x3a>
+	}
+
+	return 0;
+  801fa3:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801fa8:	89 d0                	mov    %edx,%eax
+  801faa:	c9                   	leave
+  801fab:	c3                   	ret
+
+0000000000801fac <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801fac:	55                   	push   %rbp
+  801fad:	48 89 e5             	mov    %rsp,%rbp
+  801fb0:	48 83 ec 28          	sub    $0x28,%rsp
+  801fb4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fb4 <memfind+0x8>
+  801fbb:	49 bb 7c 70 00 00 00 	movabs $0x707c,%r11
+  801fc2:	00 00 00 
+  801fc5:	4c 01 d8             	add    %r11,%rax
+  801fc8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801fcc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801fcf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801fd3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801fd7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fdb:	48 01 d0             	add    %rdx,%rax
+  801fde:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801fe2:	eb 13                	jmp    801ff7 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801fe4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fe8:	0f b6 00             	movzbl (%rax),%eax
+  801feb:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801fee:	38 d0                	cmp    %dl,%al
+  801ff0:	74 11                	je     802003 <memfind+0x57>
+	for (; s < ends; s++)
+  801ff2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801ff7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ffb:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801fff:	72 e3                	jb     801fe4 <memfind+0x38>
+  802001:	eb 01                	jmp    802004 <memfind+0x58>
+			break;
+  802003:	90                   	nop
+	return (void *) s;
+  802004:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802008:	c9                   	leave
+  802009:	c3                   	ret
+
+000000000080200a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80200a:	55                   	push   %rbp
+  80200b:	48 89 e5             	mov    %rsp,%rbp
+  80200e:	48 83 ec 38          	sub    $0x38,%rsp
+  802012:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802012 <strtol+0x8>
+  802019:	49 bb 1e 70 00 00 00 	movabs $0x701e,%r11
+  802020:	00 00 00 
+  802023:	4c 01 d8             	add    %r11,%rax
+  802026:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80202a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80202e:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  802031:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  802038:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80203f:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802040:	eb 05                	jmp    802047 <strtol+0x3d>
+		s++;
+  802042:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  802047:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80204b:	0f b6 00             	movzbl (%rax),%eax
+  80204e:	3c 20                	cmp    $0x20,%al
+  802050:	74 f0                	je     802042 <strtol+0x38>
+  802052:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802056:	0f b6 00             	movzbl (%rax),%eax
+  802059:	3c 09                	cmp    $0x9,%al
+  80205b:	74 e5                	je     802042 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  80205d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802061:	0f b6 00             	movzbl (%rax),%eax
+  802064:	3c 2b                	cmp    $0x2b,%al
+  802066:	75 07                	jne    80206f <strtol+0x65>
+		s++;
+  802068:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80206d:	eb 17                	jmp    802086 <strtol+0x7c>
+	else if (*s == '-')
+  80206f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802073:	0f b6 00             	movzbl (%rax),%eax
+  802076:	3c 2d                	cmp    $0x2d,%al
+  802078:	75 0c                	jne    802086 <strtol+0x7c>
+		s++, neg = 1;
+  80207a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80207f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802086:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80208a:	74 06                	je     802092 <strtol+0x88>
+  80208c:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802090:	75 28                	jne    8020ba <strtol+0xb0>
+  802092:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802096:	0f b6 00             	movzbl (%rax),%eax
+  802099:	3c 30                	cmp    $0x30,%al
+  80209b:	75 1d                	jne    8020ba <strtol+0xb0>
+  80209d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020a1:	48 83 c0 01          	add    $0x1,%rax
+  8020a5:	0f b6 00             	movzbl (%rax),%eax
+  8020a8:	3c 78                	cmp    $0x78,%al
+  8020aa:	75 0e                	jne    8020ba <strtol+0xb0>
+		s += 2, base = 16;
+  8020ac:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8020b1:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8020b8:	eb 2c                	jmp    8020e6 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  8020ba:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8020be:	75 19                	jne    8020d9 <strtol+0xcf>
+  8020c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020c4:	0f b6 00             	movzbl (%rax),%eax
+  8020c7:	3c 30                	cmp    $0x30,%al
+  8020c9:	75 0e                	jne    8020d9 <strtol+0xcf>
+		s++, base = 8;
+  8020cb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8020d0:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8020d7:	eb 0d                	jmp    8020e6 <strtol+0xdc>
+	else if (base == 0)
+  8020d9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8020dd:	75 07                	jne    8020e6 <strtol+0xdc>
+		base = 10;
+  8020df:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8020e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ea:	0f b6 00             	movzbl (%rax),%eax
+  8020ed:	3c 2f                	cmp    $0x2f,%al
+  8020ef:	7e 1d                	jle    80210e <strtol+0x104>
+  8020f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020f5:	0f b6 00             	movzbl (%rax),%eax
+  8020f8:	3c 39                	cmp    $0x39,%al
+  8020fa:	7f 12                	jg     80210e <strtol+0x104>
+			dig = *s - '0';
+  8020fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802100:	0f b6 00             	movzbl (%rax),%eax
+  802103:	0f be c0             	movsbl %al,%eax
+  802106:	83 e8 30             	sub    $0x30,%eax
+  802109:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80210c:	eb 4e                	jmp    80215c <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  80210e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802112:	0f b6 00             	movzbl (%rax),%eax
+  802115:	3c 60                	cmp    $0x60,%al
+  802117:	7e 1d                	jle    802136 <strtol+0x12c>
+  802119:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80211d:	0f b6 00             	movzbl (%rax),%eax
+  802120:	3c 7a                	cmp    $0x7a,%al
+  802122:	7f 12                	jg     802136 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  802124:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802128:	0f b6 00             	movzbl (%rax),%eax
+  80212b:	0f be c0             	movsbl %al,%eax
+  80212e:	83 e8 57             	sub    $0x57,%eax
+  802131:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802134:	eb 26                	jmp    80215c <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  802136:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80213a:	0f b6 00             	movzbl (%rax),%eax
+  80213d:	3c 40                	cmp    $0x40,%al
+  80213f:	7e 47                	jle    802188 <strtol+0x17e>
+  802141:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802145:	0f b6 00             	movzbl (%rax),%eax
+  802148:	3c 5a                	cmp    $0x5a,%al
+  80214a:	7f 3c                	jg     802188 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  80214c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802150:	0f b6 00             	movzbl (%rax),%eax
+  802153:	0f be c0             	movsbl %al,%eax
+  802156:	83 e8 37             	sub    $0x37,%eax
+  802159:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  80215c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80215f:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802162:	7d 23                	jge    802187 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  802164:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802169:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80216c:	48 98                	cltq
+  80216e:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802173:	48 89 c2             	mov    %rax,%rdx
+  802176:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802179:	48 98                	cltq
+  80217b:	48 01 d0             	add    %rdx,%rax
+  80217e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  802182:	e9 5f ff ff ff       	jmp    8020e6 <strtol+0xdc>
+			break;
+  802187:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802188:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80218d:	74 0b                	je     80219a <strtol+0x190>
+		*endptr = (char *) s;
+  80218f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802193:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802197:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  80219a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80219e:	74 09                	je     8021a9 <strtol+0x19f>
+  8021a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021a4:	48 f7 d8             	neg    %rax
+  8021a7:	eb 04                	jmp    8021ad <strtol+0x1a3>
+  8021a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8021ad:	c9                   	leave
+  8021ae:	c3                   	ret
+
+00000000008021af <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  8021af:	55                   	push   %rbp
+  8021b0:	48 89 e5             	mov    %rsp,%rbp
+  8021b3:	53                   	push   %rbx
+  8021b4:	48 83 ec 30          	sub    $0x30,%rsp
+  8021b8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8021b8 <strstr+0x9>
+  8021bf:	49 bb 78 6e 00 00 00 	movabs $0x6e78,%r11
+  8021c6:	00 00 00 
+  8021c9:	4c 01 db             	add    %r11,%rbx
+  8021cc:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  8021d0:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  8021d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021d8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8021dc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8021e0:	0f b6 00             	movzbl (%rax),%eax
+  8021e3:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  8021e6:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  8021ea:	75 06                	jne    8021f2 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  8021ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021f0:	eb 73                	jmp    802265 <strstr+0xb6>
+
+	len = strlen(str);
+  8021f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021f6:	48 89 c7             	mov    %rax,%rdi
+  8021f9:	48 b8 0c 89 ff ff ff 	movabs $0xffffffffffff890c,%rax
+  802200:	ff ff ff 
+  802203:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802207:	ff d0                	call   *%rax
+  802209:	48 98                	cltq
+  80220b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  80220f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802213:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802217:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80221b:	0f b6 00             	movzbl (%rax),%eax
+  80221e:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  802221:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  802225:	75 07                	jne    80222e <strstr+0x7f>
+				return (char *) 0;
+  802227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222c:	eb 37                	jmp    802265 <strstr+0xb6>
+		} while (sc != c);
+  80222e:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  802232:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  802235:	75 d8                	jne    80220f <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  802237:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80223b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80223f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802243:	48 89 ce             	mov    %rcx,%rsi
+  802246:	48 89 c7             	mov    %rax,%rdi
+  802249:	48 b8 c0 8b ff ff ff 	movabs $0xffffffffffff8bc0,%rax
+  802250:	ff ff ff 
+  802253:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802257:	ff d0                	call   *%rax
+  802259:	85 c0                	test   %eax,%eax
+  80225b:	75 b2                	jne    80220f <strstr+0x60>
+
+	return (char *) (in - 1);
+  80225d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802261:	48 83 e8 01          	sub    $0x1,%rax
+}
+  802265:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802269:	c9                   	leave
+  80226a:	c3                   	ret
+
+000000000080226b <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  80226b:	55                   	push   %rbp
+  80226c:	48 89 e5             	mov    %rsp,%rbp
+  80226f:	41 57                	push   %r15
+  802271:	53                   	push   %rbx
+  802272:	48 83 ec 40          	sub    $0x40,%rsp
+  802276:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 802276 <syscall+0xb>
+  80227d:	49 bb ba 6d 00 00 00 	movabs $0x6dba,%r11
+  802284:	00 00 00 
+  802287:	4d 01 da             	add    %r11,%r10
+  80228a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80228d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  802290:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  802294:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802298:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80229c:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  8022a0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8022a3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8022a7:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8022ab:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8022af:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8022b3:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8022b7:	4c 89 c3             	mov    %r8,%rbx
+  8022ba:	cd 30                	int    $0x30
+  8022bc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  8022c0:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8022c4:	74 52                	je     802318 <syscall+0xad>
+  8022c6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8022cb:	7e 4b                	jle    802318 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8022cd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8022d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8022d4:	49 89 d0             	mov    %rdx,%r8
+  8022d7:	89 c1                	mov    %eax,%ecx
+  8022d9:	48 b8 23 da ff ff ff 	movabs $0xffffffffffffda23,%rax
+  8022e0:	ff ff ff 
+  8022e3:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8022e7:	48 89 c2             	mov    %rax,%rdx
+  8022ea:	be 23 00 00 00       	mov    $0x23,%esi
+  8022ef:	48 b8 40 da ff ff ff 	movabs $0xffffffffffffda40,%rax
+  8022f6:	ff ff ff 
+  8022f9:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8022fd:	48 89 c7             	mov    %rax,%rdi
+  802300:	4d 89 d7             	mov    %r10,%r15
+  802303:	b8 00 00 00 00       	mov    $0x0,%eax
+  802308:	49 b9 49 77 ff ff ff 	movabs $0xffffffffffff7749,%r9
+  80230f:	ff ff ff 
+  802312:	4d 01 d1             	add    %r10,%r9
+  802315:	41 ff d1             	call   *%r9
+
+	return ret;
+  802318:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80231c:	48 83 c4 40          	add    $0x40,%rsp
+  802320:	5b                   	pop    %rbx
+  802321:	41 5f                	pop    %r15
+  802323:	5d                   	pop    %rbp
+  802324:	c3                   	ret
+
+0000000000802325 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  802325:	55                   	push   %rbp
+  802326:	48 89 e5             	mov    %rsp,%rbp
+  802329:	41 57                	push   %r15
+  80232b:	41 56                	push   %r14
+  80232d:	41 55                	push   %r13
+  80232f:	41 54                	push   %r12
+  802331:	53                   	push   %rbx
+  802332:	48 83 ec 48          	sub    $0x48,%rsp
+  802336:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 802336 <syscall_words+0x11>
+  80233d:	49 bb fa 6c 00 00 00 	movabs $0x6cfa,%r11
+  802344:	00 00 00 
+  802347:	4d 01 de             	add    %r11,%r14
+  80234a:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80234d:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  802350:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  802354:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802358:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  80235c:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  802360:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802365:	74 09                	je     802370 <syscall_words+0x4b>
+  802367:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80236b:	48 8b 00             	mov    (%rax),%rax
+  80236e:	eb 05                	jmp    802375 <syscall_words+0x50>
+  802370:	b8 00 00 00 00       	mov    $0x0,%eax
+  802375:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  802378:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80237d:	74 0a                	je     802389 <syscall_words+0x64>
+  80237f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802383:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802387:	eb 05                	jmp    80238e <syscall_words+0x69>
+  802389:	b8 00 00 00 00       	mov    $0x0,%eax
+  80238e:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  802391:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802396:	74 0a                	je     8023a2 <syscall_words+0x7d>
+  802398:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80239c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8023a0:	eb 05                	jmp    8023a7 <syscall_words+0x82>
+  8023a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a7:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  8023aa:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8023af:	74 0a                	je     8023bb <syscall_words+0x96>
+  8023b1:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8023b5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8023b9:	eb 05                	jmp    8023c0 <syscall_words+0x9b>
+  8023bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c0:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  8023c3:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8023c8:	74 0a                	je     8023d4 <syscall_words+0xaf>
+  8023ca:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8023ce:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8023d2:	eb 05                	jmp    8023d9 <syscall_words+0xb4>
+  8023d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d9:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  8023dc:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8023e1:	74 0a                	je     8023ed <syscall_words+0xc8>
+  8023e3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8023e7:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8023eb:	eb 05                	jmp    8023f2 <syscall_words+0xcd>
+  8023ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f2:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  8023f5:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8023f8:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8023fc:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802400:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  802404:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  802408:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80240c:	cd 30                	int    $0x30
+  80240e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  802412:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802417:	74 50                	je     802469 <syscall_words+0x144>
+		words[0] = r8;
+  802419:	4c 89 c2             	mov    %r8,%rdx
+  80241c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802420:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802423:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802427:	48 83 c0 08          	add    $0x8,%rax
+  80242b:	4c 89 ca             	mov    %r9,%rdx
+  80242e:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802431:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802435:	48 83 c0 10          	add    $0x10,%rax
+  802439:	4c 89 d2             	mov    %r10,%rdx
+  80243c:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  80243f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802443:	48 83 c0 18          	add    $0x18,%rax
+  802447:	4c 89 da             	mov    %r11,%rdx
+  80244a:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  80244d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802451:	48 83 c0 20          	add    $0x20,%rax
+  802455:	4c 89 e2             	mov    %r12,%rdx
+  802458:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  80245b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80245f:	48 83 c0 28          	add    $0x28,%rax
+  802463:	4c 89 ea             	mov    %r13,%rdx
+  802466:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  802469:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80246d:	74 52                	je     8024c1 <syscall_words+0x19c>
+  80246f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802474:	7e 4b                	jle    8024c1 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802476:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80247a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80247d:	49 89 d0             	mov    %rdx,%r8
+  802480:	89 c1                	mov    %eax,%ecx
+  802482:	48 b8 23 da ff ff ff 	movabs $0xffffffffffffda23,%rax
+  802489:	ff ff ff 
+  80248c:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802490:	48 89 c2             	mov    %rax,%rdx
+  802493:	be 4e 00 00 00       	mov    $0x4e,%esi
+  802498:	48 b8 40 da ff ff ff 	movabs $0xffffffffffffda40,%rax
+  80249f:	ff ff ff 
+  8024a2:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8024a6:	48 89 c7             	mov    %rax,%rdi
+  8024a9:	4d 89 f7             	mov    %r14,%r15
+  8024ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b1:	49 b9 49 77 ff ff ff 	movabs $0xffffffffffff7749,%r9
+  8024b8:	ff ff ff 
+  8024bb:	4d 01 f1             	add    %r14,%r9
+  8024be:	41 ff d1             	call   *%r9
+
+	return ret;
+  8024c1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8024c5:	48 83 c4 48          	add    $0x48,%rsp
+  8024c9:	5b                   	pop    %rbx
+  8024ca:	41 5c                	pop    %r12
+  8024cc:	41 5d                	pop    %r13
+  8024ce:	41 5e                	pop    %r14
+  8024d0:	41 5f                	pop    %r15
+  8024d2:	5d                   	pop    %rbp
+  8024d3:	c3                   	ret
+
+00000000008024d4 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8024d4:	55                   	push   %rbp
+  8024d5:	48 89 e5             	mov    %rsp,%rbp
+  8024d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8024dc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024dc <sys_cputs+0x8>
+  8024e3:	49 bb 54 6b 00 00 00 	movabs $0x6b54,%r11
+  8024ea:	00 00 00 
+  8024ed:	4c 01 d8             	add    %r11,%rax
+  8024f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8024f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024fc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802500:	48 83 ec 08          	sub    $0x8,%rsp
+  802504:	6a 00                	push   $0x0
+  802506:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80250c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802512:	be 00 00 00 00       	mov    $0x0,%esi
+  802517:	bf 00 00 00 00       	mov    $0x0,%edi
+  80251c:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802523:	ff ff ff 
+  802526:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80252a:	ff d0                	call   *%rax
+  80252c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802530:	90                   	nop
+  802531:	c9                   	leave
+  802532:	c3                   	ret
+
+0000000000802533 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802533:	55                   	push   %rbp
+  802534:	48 89 e5             	mov    %rsp,%rbp
+  802537:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802537 <sys_cgetc+0x4>
+  80253e:	49 bb f9 6a 00 00 00 	movabs $0x6af9,%r11
+  802545:	00 00 00 
+  802548:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80254b:	48 83 ec 08          	sub    $0x8,%rsp
+  80254f:	6a 00                	push   $0x0
+  802551:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802557:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80255d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802562:	ba 00 00 00 00       	mov    $0x0,%edx
+  802567:	be 00 00 00 00       	mov    $0x0,%esi
+  80256c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802571:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802578:	ff ff ff 
+  80257b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80257f:	ff d0                	call   *%rax
+  802581:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802585:	c9                   	leave
+  802586:	c3                   	ret
+
+0000000000802587 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802587:	55                   	push   %rbp
+  802588:	48 89 e5             	mov    %rsp,%rbp
+  80258b:	48 83 ec 10          	sub    $0x10,%rsp
+  80258f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80258f <sys_env_destroy+0x8>
+  802596:	49 bb a1 6a 00 00 00 	movabs $0x6aa1,%r11
+  80259d:	00 00 00 
+  8025a0:	4c 01 d8             	add    %r11,%rax
+  8025a3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8025a6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025a9:	48 63 d2             	movslq %edx,%rdx
+  8025ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b0:	6a 00                	push   $0x0
+  8025b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8025c8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025cd:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  8025d4:	ff ff ff 
+  8025d7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025db:	ff d0                	call   *%rax
+  8025dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025e1:	c9                   	leave
+  8025e2:	c3                   	ret
+
+00000000008025e3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8025e3:	55                   	push   %rbp
+  8025e4:	48 89 e5             	mov    %rsp,%rbp
+  8025e7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025e7 <sys_getenvid+0x4>
+  8025ee:	49 bb 49 6a 00 00 00 	movabs $0x6a49,%r11
+  8025f5:	00 00 00 
+  8025f8:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8025fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ff:	6a 00                	push   $0x0
+  802601:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802607:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80260d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802612:	ba 00 00 00 00       	mov    $0x0,%edx
+  802617:	be 00 00 00 00       	mov    $0x0,%esi
+  80261c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802621:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802628:	ff ff ff 
+  80262b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80262f:	ff d0                	call   *%rax
+  802631:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802635:	c9                   	leave
+  802636:	c3                   	ret
+
+0000000000802637 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802637:	55                   	push   %rbp
+  802638:	48 89 e5             	mov    %rsp,%rbp
+  80263b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80263b <sys_yield+0x4>
+  802642:	49 bb f5 69 00 00 00 	movabs $0x69f5,%r11
+  802649:	00 00 00 
+  80264c:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80264f:	48 83 ec 08          	sub    $0x8,%rsp
+  802653:	6a 00                	push   $0x0
+  802655:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80265b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802661:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802666:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266b:	be 00 00 00 00       	mov    $0x0,%esi
+  802670:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802675:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  80267c:	ff ff ff 
+  80267f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802683:	ff d0                	call   *%rax
+  802685:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802689:	90                   	nop
+  80268a:	c9                   	leave
+  80268b:	c3                   	ret
+
+000000000080268c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80268c:	55                   	push   %rbp
+  80268d:	48 89 e5             	mov    %rsp,%rbp
+  802690:	48 83 ec 10          	sub    $0x10,%rsp
+  802694:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802694 <sys_page_alloc+0x8>
+  80269b:	49 bb 9c 69 00 00 00 	movabs $0x699c,%r11
+  8026a2:	00 00 00 
+  8026a5:	4c 01 d8             	add    %r11,%rax
+  8026a8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026ab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026af:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8026b2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026b5:	48 63 f2             	movslq %edx,%rsi
+  8026b8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026bc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026bf:	48 63 d2             	movslq %edx,%rdx
+  8026c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8026c6:	6a 00                	push   $0x0
+  8026c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026ce:	49 89 f0             	mov    %rsi,%r8
+  8026d1:	be 01 00 00 00       	mov    $0x1,%esi
+  8026d6:	bf 04 00 00 00       	mov    $0x4,%edi
+  8026db:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  8026e2:	ff ff ff 
+  8026e5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026e9:	ff d0                	call   *%rax
+  8026eb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026ef:	c9                   	leave
+  8026f0:	c3                   	ret
+
+00000000008026f1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8026f1:	55                   	push   %rbp
+  8026f2:	48 89 e5             	mov    %rsp,%rbp
+  8026f5:	48 83 ec 20          	sub    $0x20,%rsp
+  8026f9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026f9 <sys_page_map+0x8>
+  802700:	49 bb 37 69 00 00 00 	movabs $0x6937,%r11
+  802707:	00 00 00 
+  80270a:	4c 01 d8             	add    %r11,%rax
+  80270d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802710:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802714:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802717:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80271b:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80271f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802722:	48 63 f2             	movslq %edx,%rsi
+  802725:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802729:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80272c:	48 63 fa             	movslq %edx,%rdi
+  80272f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802733:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802736:	48 63 d2             	movslq %edx,%rdx
+  802739:	48 83 ec 08          	sub    $0x8,%rsp
+  80273d:	56                   	push   %rsi
+  80273e:	4d 89 c1             	mov    %r8,%r9
+  802741:	49 89 f8             	mov    %rdi,%r8
+  802744:	be 01 00 00 00       	mov    $0x1,%esi
+  802749:	bf 05 00 00 00       	mov    $0x5,%edi
+  80274e:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802755:	ff ff ff 
+  802758:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80275c:	ff d0                	call   *%rax
+  80275e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802762:	c9                   	leave
+  802763:	c3                   	ret
+
+0000000000802764 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802764:	55                   	push   %rbp
+  802765:	48 89 e5             	mov    %rsp,%rbp
+  802768:	48 83 ec 10          	sub    $0x10,%rsp
+  80276c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80276c <sys_page_unmap+0x8>
+  802773:	49 bb c4 68 00 00 00 	movabs $0x68c4,%r11
+  80277a:	00 00 00 
+  80277d:	4c 01 d8             	add    %r11,%rax
+  802780:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802783:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802787:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80278b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80278e:	48 63 d2             	movslq %edx,%rdx
+  802791:	48 83 ec 08          	sub    $0x8,%rsp
+  802795:	6a 00                	push   $0x0
+  802797:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80279d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027a3:	be 01 00 00 00       	mov    $0x1,%esi
+  8027a8:	bf 06 00 00 00       	mov    $0x6,%edi
+  8027ad:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  8027b4:	ff ff ff 
+  8027b7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027bb:	ff d0                	call   *%rax
+  8027bd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027c1:	c9                   	leave
+  8027c2:	c3                   	ret
+
+00000000008027c3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8027c3:	55                   	push   %rbp
+  8027c4:	48 89 e5             	mov    %rsp,%rbp
+  8027c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8027cb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027cb <sys_env_set_status+0x8>
+  8027d2:	49 bb 65 68 00 00 00 	movabs $0x6865,%r11
+  8027d9:	00 00 00 
+  8027dc:	4c 01 d8             	add    %r11,%rax
+  8027df:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027e2:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8027e5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027e8:	48 63 ca             	movslq %edx,%rcx
+  8027eb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027ee:	48 63 d2             	movslq %edx,%rdx
+  8027f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8027f5:	6a 00                	push   $0x0
+  8027f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802803:	be 01 00 00 00       	mov    $0x1,%esi
+  802808:	bf 08 00 00 00       	mov    $0x8,%edi
+  80280d:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802814:	ff ff ff 
+  802817:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80281b:	ff d0                	call   *%rax
+  80281d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802821:	c9                   	leave
+  802822:	c3                   	ret
+
+0000000000802823 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802823:	55                   	push   %rbp
+  802824:	48 89 e5             	mov    %rsp,%rbp
+  802827:	48 83 ec 10          	sub    $0x10,%rsp
+  80282b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80282b <sys_env_set_trapframe+0x8>
+  802832:	49 bb 05 68 00 00 00 	movabs $0x6805,%r11
+  802839:	00 00 00 
+  80283c:	4c 01 d8             	add    %r11,%rax
+  80283f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802842:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802846:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80284a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80284d:	48 63 d2             	movslq %edx,%rdx
+  802850:	48 83 ec 08          	sub    $0x8,%rsp
+  802854:	6a 00                	push   $0x0
+  802856:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80285c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802862:	be 01 00 00 00       	mov    $0x1,%esi
+  802867:	bf 09 00 00 00       	mov    $0x9,%edi
+  80286c:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802873:	ff ff ff 
+  802876:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80287a:	ff d0                	call   *%rax
+  80287c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802880:	c9                   	leave
+  802881:	c3                   	ret
+
+0000000000802882 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802882:	55                   	push   %rbp
+  802883:	48 89 e5             	mov    %rsp,%rbp
+  802886:	48 83 ec 10          	sub    $0x10,%rsp
+  80288a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80288a <sys_env_set_pgfault_upcall+0x8>
+  802891:	49 bb a6 67 00 00 00 	movabs $0x67a6,%r11
+  802898:	00 00 00 
+  80289b:	4c 01 d8             	add    %r11,%rax
+  80289e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028a1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8028a5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028a9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8028ac:	48 63 d2             	movslq %edx,%rdx
+  8028af:	48 83 ec 08          	sub    $0x8,%rsp
+  8028b3:	6a 00                	push   $0x0
+  8028b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028c1:	be 01 00 00 00       	mov    $0x1,%esi
+  8028c6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8028cb:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  8028d2:	ff ff ff 
+  8028d5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028d9:	ff d0                	call   *%rax
+  8028db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028df:	c9                   	leave
+  8028e0:	c3                   	ret
+
+00000000008028e1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8028e1:	55                   	push   %rbp
+  8028e2:	48 89 e5             	mov    %rsp,%rbp
+  8028e5:	48 83 ec 20          	sub    $0x20,%rsp
+  8028e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028e9 <sys_ipc_try_send+0x8>
+  8028f0:	49 bb 47 67 00 00 00 	movabs $0x6747,%r11
+  8028f7:	00 00 00 
+  8028fa:	4c 01 d8             	add    %r11,%rax
+  8028fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802900:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802904:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802908:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80290b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80290e:	48 63 fa             	movslq %edx,%rdi
+  802911:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802915:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802918:	48 63 d2             	movslq %edx,%rdx
+  80291b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80291f:	48 83 ec 08          	sub    $0x8,%rsp
+  802923:	6a 00                	push   $0x0
+  802925:	49 89 f9             	mov    %rdi,%r9
+  802928:	49 89 f0             	mov    %rsi,%r8
+  80292b:	be 00 00 00 00       	mov    $0x0,%esi
+  802930:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802935:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  80293c:	ff ff ff 
+  80293f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802943:	ff d0                	call   *%rax
+  802945:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802949:	c9                   	leave
+  80294a:	c3                   	ret
+
+000000000080294b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80294b:	55                   	push   %rbp
+  80294c:	48 89 e5             	mov    %rsp,%rbp
+  80294f:	48 83 ec 20          	sub    $0x20,%rsp
+  802953:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802953 <sys_ipc_send+0x8>
+  80295a:	49 bb dd 66 00 00 00 	movabs $0x66dd,%r11
+  802961:	00 00 00 
+  802964:	4c 01 d8             	add    %r11,%rax
+  802967:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80296a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80296e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802972:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802975:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802978:	48 63 fa             	movslq %edx,%rdi
+  80297b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80297f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802982:	48 63 d2             	movslq %edx,%rdx
+  802985:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802989:	48 83 ec 08          	sub    $0x8,%rsp
+  80298d:	6a 00                	push   $0x0
+  80298f:	49 89 f9             	mov    %rdi,%r9
+  802992:	49 89 f0             	mov    %rsi,%r8
+  802995:	be 00 00 00 00       	mov    $0x0,%esi
+  80299a:	bf 17 00 00 00       	mov    $0x17,%edi
+  80299f:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  8029a6:	ff ff ff 
+  8029a9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029ad:	ff d0                	call   *%rax
+  8029af:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029b3:	c9                   	leave
+  8029b4:	c3                   	ret
+
+00000000008029b5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8029b5:	55                   	push   %rbp
+  8029b6:	48 89 e5             	mov    %rsp,%rbp
+  8029b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8029bd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029bd <sys_ipc_recv+0x8>
+  8029c4:	49 bb 73 66 00 00 00 	movabs $0x6673,%r11
+  8029cb:	00 00 00 
+  8029ce:	4c 01 d8             	add    %r11,%rax
+  8029d1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8029d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029d9:	6a 00                	push   $0x0
+  8029db:	6a 00                	push   $0x0
+  8029dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029ee:	be 01 00 00 00       	mov    $0x1,%esi
+  8029f3:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8029f8:	49 ba f5 92 ff ff ff 	movabs $0xffffffffffff92f5,%r10
+  8029ff:	ff ff ff 
+  802a02:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a06:	ff d0                	call   *%rax
+  802a08:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a0c:	c9                   	leave
+  802a0d:	c3                   	ret
+
+0000000000802a0e <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802a0e:	55                   	push   %rbp
+  802a0f:	48 89 e5             	mov    %rsp,%rbp
+  802a12:	48 83 ec 30          	sub    $0x30,%rsp
+  802a16:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a16 <sys_ipc_call+0x8>
+  802a1d:	49 bb 1a 66 00 00 00 	movabs $0x661a,%r11
+  802a24:	00 00 00 
+  802a27:	4c 01 d8             	add    %r11,%rax
+  802a2a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802a2d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a31:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802a35:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802a38:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802a3c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802a40:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802a44:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802a47:	4c 63 c2             	movslq %edx,%r8
+  802a4a:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802a4e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802a51:	48 63 d2             	movslq %edx,%rdx
+  802a54:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a58:	ff 75 d8             	push   -0x28(%rbp)
+  802a5b:	56                   	push   %rsi
+  802a5c:	4d 89 c1             	mov    %r8,%r9
+  802a5f:	49 89 f8             	mov    %rdi,%r8
+  802a62:	be 00 00 00 00       	mov    $0x0,%esi
+  802a67:	bf 18 00 00 00       	mov    $0x18,%edi
+  802a6c:	49 ba f5 92 ff ff ff 	movabs $0xffffffffffff92f5,%r10
+  802a73:	ff ff ff 
+  802a76:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a7a:	ff d0                	call   *%rax
+  802a7c:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802a80:	c9                   	leave
+  802a81:	c3                   	ret
+
+0000000000802a82 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802a82:	55                   	push   %rbp
+  802a83:	48 89 e5             	mov    %rsp,%rbp
+  802a86:	48 83 ec 30          	sub    $0x30,%rsp
+  802a8a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a8a <sys_ipc_reply_recv+0x8>
+  802a91:	49 bb a6 65 00 00 00 	movabs $0x65a6,%r11
+  802a98:	00 00 00 
+  802a9b:	4c 01 d8             	add    %r11,%rax
+  802a9e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802aa1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802aa5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802aa9:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802aac:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802ab0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802ab4:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802ab8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802abb:	4c 63 c2             	movslq %edx,%r8
+  802abe:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802ac2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802ac5:	48 63 d2             	movslq %edx,%rdx
+  802ac8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802acc:	ff 75 d8             	push   -0x28(%rbp)
+  802acf:	56                   	push   %rsi
+  802ad0:	4d 89 c1             	mov    %r8,%r9
+  802ad3:	49 89 f8             	mov    %rdi,%r8
+  802ad6:	be 00 00 00 00       	mov    $0x0,%esi
+  802adb:	bf 19 00 00 00       	mov    $0x19,%edi
+  802ae0:	49 ba f5 92 ff ff ff 	movabs $0xffffffffffff92f5,%r10
+  802ae7:	ff ff ff 
+  802aea:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802aee:	ff d0                	call   *%rax
+  802af0:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802af4:	c9                   	leave
+  802af5:	c3                   	ret
+
+0000000000802af6 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802af6:	55                   	push   %rbp
+  802af7:	48 89 e5             	mov    %rsp,%rbp
+  802afa:	48 83 ec 10          	sub    $0x10,%rsp
+  802afe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802afe <sys_env_set_priority+0x8>
+  802b05:	49 bb 32 65 00 00 00 	movabs $0x6532,%r11
+  802b0c:	00 00 00 
+  802b0f:	4c 01 d8             	add    %r11,%rax
+  802b12:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b15:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802b18:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802b1b:	48 63 ca             	movslq %edx,%rcx
+  802b1e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802b21:	48 63 d2             	movslq %edx,%rdx
+  802b24:	48 83 ec 08          	sub    $0x8,%rsp
+  802b28:	6a 00                	push   $0x0
+  802b2a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b30:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b36:	be 01 00 00 00       	mov    $0x1,%esi
+  802b3b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802b40:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802b47:	ff ff ff 
+  802b4a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b4e:	ff d0                	call   *%rax
+  802b50:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b54:	c9                   	leave
+  802b55:	c3                   	ret
+
+0000000000802b56 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802b56:	55                   	push   %rbp
+  802b57:	48 89 e5             	mov    %rsp,%rbp
+  802b5a:	48 83 ec 10          	sub    $0x10,%rsp
+  802b5e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b5e <sys_env_set_affinity+0x8>
+  802b65:	49 bb d2 64 00 00 00 	movabs $0x64d2,%r11
+  802b6c:	00 00 00 
+  802b6f:	4c 01 d8             	add    %r11,%rax
+  802b72:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b75:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802b78:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802b7b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802b7e:	48 63 d2             	movslq %edx,%rdx
+  802b81:	48 83 ec 08          	sub    $0x8,%rsp
+  802b85:	6a 00                	push   $0x0
+  802b87:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b93:	be 01 00 00 00       	mov    $0x1,%esi
+  802b98:	bf 10 00 00 00       	mov    $0x10,%edi
+  802b9d:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802ba4:	ff ff ff 
+  802ba7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802bab:	ff d0                	call   *%rax
+  802bad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bb1:	c9                   	leave
+  802bb2:	c3                   	ret
+
+0000000000802bb3 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802bb3:	55                   	push   %rbp
+  802bb4:	48 89 e5             	mov    %rsp,%rbp
+  802bb7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802bb7 <sys_time_msec+0x4>
+  802bbe:	49 bb 79 64 00 00 00 	movabs $0x6479,%r11
+  802bc5:	00 00 00 
+  802bc8:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802bcb:	48 83 ec 08          	sub    $0x8,%rsp
+  802bcf:	6a 00                	push   $0x0
+  802bd1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bd7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802bdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802be2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be7:	be 00 00 00 00       	mov    $0x0,%esi
+  802bec:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802bf1:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802bf8:	ff ff ff 
+  802bfb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802bff:	ff d0                	call   *%rax
+  802c01:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c05:	c9                   	leave
+  802c06:	c3                   	ret
+
+0000000000802c07 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802c07:	55                   	push   %rbp
+  802c08:	48 89 e5             	mov    %rsp,%rbp
+  802c0b:	48 83 ec 10          	sub    $0x10,%rsp
+  802c0f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c0f <sys_sleep_usec+0x8>
+  802c16:	49 bb 21 64 00 00 00 	movabs $0x6421,%r11
+  802c1d:	00 00 00 
+  802c20:	4c 01 d8             	add    %r11,%rax
+  802c23:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802c27:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c2b:	48 83 ec 08          	sub    $0x8,%rsp
+  802c2f:	6a 00                	push   $0x0
+  802c31:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c37:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c42:	be 00 00 00 00       	mov    $0x0,%esi
+  802c47:	bf 11 00 00 00       	mov    $0x11,%edi
+  802c4c:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802c53:	ff ff ff 
+  802c56:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c5a:	ff d0                	call   *%rax
+  802c5c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c60:	c9                   	leave
+  802c61:	c3                   	ret
+
+0000000000802c62 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802c62:	55                   	push   %rbp
+  802c63:	48 89 e5             	mov    %rsp,%rbp
+  802c66:	48 83 ec 10          	sub    $0x10,%rsp
+  802c6a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c6a <sys_page_alloc_huge+0x8>
+  802c71:	49 bb c6 63 00 00 00 	movabs $0x63c6,%r11
+  802c78:	00 00 00 
+  802c7b:	4c 01 d8             	add    %r11,%rax
+  802c7e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802c81:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802c85:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802c88:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802c8b:	48 63 f2             	movslq %edx,%rsi
+  802c8e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802c92:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802c95:	48 63 d2             	movslq %edx,%rdx
+  802c98:	48 83 ec 08          	sub    $0x8,%rsp
+  802c9c:	6a 00                	push   $0x0
+  802c9e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ca4:	49 89 f0             	mov    %rsi,%r8
+  802ca7:	be 01 00 00 00       	mov    $0x1,%esi
+  802cac:	bf 12 00 00 00       	mov    $0x12,%edi
+  802cb1:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802cb8:	ff ff ff 
+  802cbb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802cbf:	ff d0                	call   *%rax
+  802cc1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802cc5:	c9                   	leave
+  802cc6:	c3                   	ret
+
+0000000000802cc7 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802cc7:	55                   	push   %rbp
+  802cc8:	48 89 e5             	mov    %rsp,%rbp
+  802ccb:	48 83 ec 10          	sub    $0x10,%rsp
+  802ccf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ccf <sys_page_map_batch+0x8>
+  802cd6:	49 bb 61 63 00 00 00 	movabs $0x6361,%r11
+  802cdd:	00 00 00 
+  802ce0:	4c 01 d8             	add    %r11,%rax
+  802ce3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802ce7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802ceb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802cef:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802cf3:	48 83 ec 08          	sub    $0x8,%rsp
+  802cf7:	6a 00                	push   $0x0
+  802cf9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802cff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d05:	be 01 00 00 00       	mov    $0x1,%esi
+  802d0a:	bf 13 00 00 00       	mov    $0x13,%edi
+  802d0f:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802d16:	ff ff ff 
+  802d19:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802d1d:	ff d0                	call   *%rax
+  802d1f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d23:	c9                   	leave
+  802d24:	c3                   	ret
+
+0000000000802d25 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802d25:	55                   	push   %rbp
+  802d26:	48 89 e5             	mov    %rsp,%rbp
+  802d29:	48 83 ec 10          	sub    $0x10,%rsp
+  802d2d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d2d <sys_page_alloc_batch+0x8>
+  802d34:	49 bb 03 63 00 00 00 	movabs $0x6303,%r11
+  802d3b:	00 00 00 
+  802d3e:	4c 01 d8             	add    %r11,%rax
+  802d41:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d45:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802d49:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d4d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802d51:	48 83 ec 08          	sub    $0x8,%rsp
+  802d55:	6a 00                	push   $0x0
+  802d57:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d5d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d63:	be 01 00 00 00       	mov    $0x1,%esi
+  802d68:	bf 14 00 00 00       	mov    $0x14,%edi
+  802d6d:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802d74:	ff ff ff 
+  802d77:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802d7b:	ff d0                	call   *%rax
+  802d7d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d81:	c9                   	leave
+  802d82:	c3                   	ret
+
+0000000000802d83 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802d83:	55                   	push   %rbp
+  802d84:	48 89 e5             	mov    %rsp,%rbp
+  802d87:	48 83 ec 10          	sub    $0x10,%rsp
+  802d8b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d8b <sys_page_unmap_batch+0x8>
+  802d92:	49 bb a5 62 00 00 00 	movabs $0x62a5,%r11
+  802d99:	00 00 00 
+  802d9c:	4c 01 d8             	add    %r11,%rax
+  802d9f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802da3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802da7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802dab:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802daf:	48 83 ec 08          	sub    $0x8,%rsp
+  802db3:	6a 00                	push   $0x0
+  802db5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802dbb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802dc1:	be 01 00 00 00       	mov    $0x1,%esi
+  802dc6:	bf 15 00 00 00       	mov    $0x15,%edi
+  802dcb:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802dd2:	ff ff ff 
+  802dd5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802dd9:	ff d0                	call   *%rax
+  802ddb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ddf:	c9                   	leave
+  802de0:	c3                   	ret
+
+0000000000802de1 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802de1:	55                   	push   %rbp
+  802de2:	48 89 e5             	mov    %rsp,%rbp
+  802de5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802de5 <sys_fork+0x4>
+  802dec:	49 bb 4b 62 00 00 00 	movabs $0x624b,%r11
+  802df3:	00 00 00 
+  802df6:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802df9:	48 83 ec 08          	sub    $0x8,%rsp
+  802dfd:	6a 00                	push   $0x0
+  802dff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e10:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e15:	be 00 00 00 00       	mov    $0x0,%esi
+  802e1a:	bf 16 00 00 00       	mov    $0x16,%edi
+  802e1f:	49 ba 3b 92 ff ff ff 	movabs $0xffffffffffff923b,%r10
+  802e26:	ff ff ff 
+  802e29:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802e2d:	ff d0                	call   *%rax
+  802e2f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e33:	c9                   	leave
+  802e34:	c3                   	ret
+
+0000000000802e35 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  802e35:	55                   	push   %rbp
+  802e36:	48 89 e5             	mov    %rsp,%rbp
+  802e39:	48 83 ec 08          	sub    $0x8,%rsp
+  802e3d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e3d <fd2num+0x8>
+  802e44:	49 bb f3 61 00 00 00 	movabs $0x61f3,%r11
+  802e4b:	00 00 00 
+  802e4e:	4c 01 d8             	add    %r11,%rax
+  802e51:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802e55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e59:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802e60:	ff ff ff 
+  802e63:	48 01 d0             	add    %rdx,%rax
+  802e66:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802e6a:	c9                   	leave
+  802e6b:	c3                   	ret
+
+0000000000802e6c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802e6c:	55                   	push   %rbp
+  802e6d:	48 89 e5             	mov    %rsp,%rbp
+  802e70:	48 83 ec 08          	sub    $0x8,%rsp
+  802e74:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e74 <fd2data+0x8>
+  802e7b:	49 bb bc 61 00 00 00 	movabs $0x61bc,%r11
+  802e82:	00 00 00 
+  802e85:	4c 01 d8             	add    %r11,%rax
+  802e88:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  802e8c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e90:	48 89 d7             	mov    %rdx,%rdi
+  802e93:	48 ba 05 9e ff ff ff 	movabs $0xffffffffffff9e05,%rdx
+  802e9a:	ff ff ff 
+  802e9d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802ea1:	ff d0                	call   *%rax
+  802ea3:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802ea9:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802ead:	c9                   	leave
+  802eae:	c3                   	ret
+
+0000000000802eaf <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802eaf:	55                   	push   %rbp
+  802eb0:	48 89 e5             	mov    %rsp,%rbp
+  802eb3:	48 83 ec 18          	sub    $0x18,%rsp
+  802eb7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802eb7 <fd_alloc+0x8>
+  802ebe:	49 bb 79 61 00 00 00 	movabs $0x6179,%r11
+  802ec5:	00 00 00 
+  802ec8:	4c 01 d8             	add    %r11,%rax
+  802ecb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802ecf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802ed6:	eb 75                	jmp    802f4d <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  802ed8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802edb:	48 63 d2             	movslq %edx,%rdx
+  802ede:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802ee5:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802ee9:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802eed:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ef1:	48 89 d1             	mov    %rdx,%rcx
+  802ef4:	48 c1 e9 15          	shr    $0x15,%rcx
+  802ef8:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802eff:	ff ff ff 
+  802f02:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802f06:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802f0a:	83 e2 01             	and    $0x1,%edx
+  802f0d:	48 85 d2             	test   %rdx,%rdx
+  802f10:	74 25                	je     802f37 <fd_alloc+0x88>
+  802f12:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802f16:	48 89 d1             	mov    %rdx,%rcx
+  802f19:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802f1d:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802f24:	ff ff ff 
+  802f27:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802f2b:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802f2f:	83 e2 01             	and    $0x1,%edx
+  802f32:	48 85 d2             	test   %rdx,%rdx
+  802f35:	75 12                	jne    802f49 <fd_alloc+0x9a>
+			*fd_store = fd;
+  802f37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f3b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802f3f:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802f42:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f47:	eb 1a                	jmp    802f63 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802f49:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802f4d:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802f51:	7e 85                	jle    802ed8 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802f53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f57:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802f5e:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802f63:	c9                   	leave
+  802f64:	c3                   	ret
+
+0000000000802f65 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802f65:	55                   	push   %rbp
+  802f66:	48 89 e5             	mov    %rsp,%rbp
+  802f69:	48 83 ec 20          	sub    $0x20,%rsp
+  802f6d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f6d <fd_lookup+0x8>
+  802f74:	49 bb c3 60 00 00 00 	movabs $0x60c3,%r11
+  802f7b:	00 00 00 
+  802f7e:	4c 01 d8             	add    %r11,%rax
+  802f81:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f84:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802f88:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f8c:	78 06                	js     802f94 <fd_lookup+0x2f>
+  802f8e:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802f92:	7e 07                	jle    802f9b <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802f94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f99:	eb 73                	jmp    80300e <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802f9b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802f9e:	48 63 d2             	movslq %edx,%rdx
+  802fa1:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802fa8:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802fac:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802fb0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802fb4:	48 89 d1             	mov    %rdx,%rcx
+  802fb7:	48 c1 e9 15          	shr    $0x15,%rcx
+  802fbb:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802fc2:	ff ff ff 
+  802fc5:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802fc9:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802fcd:	83 e2 01             	and    $0x1,%edx
+  802fd0:	48 85 d2             	test   %rdx,%rdx
+  802fd3:	74 22                	je     802ff7 <fd_lookup+0x92>
+  802fd5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802fd9:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802fdd:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  802fe4:	ff ff ff 
+  802fe7:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802feb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fef:	83 e0 01             	and    $0x1,%eax
+  802ff2:	48 85 c0             	test   %rax,%rax
+  802ff5:	75 07                	jne    802ffe <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802ff7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ffc:	eb 10                	jmp    80300e <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802ffe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803002:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803006:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803009:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80300e:	c9                   	leave
+  80300f:	c3                   	ret
+
+0000000000803010 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803010:	55                   	push   %rbp
+  803011:	48 89 e5             	mov    %rsp,%rbp
+  803014:	41 57                	push   %r15
+  803016:	53                   	push   %rbx
+  803017:	48 83 ec 30          	sub    $0x30,%rsp
+  80301b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80301b <fd_close+0xb>
+  803022:	49 bb 15 60 00 00 00 	movabs $0x6015,%r11
+  803029:	00 00 00 
+  80302c:	4c 01 db             	add    %r11,%rbx
+  80302f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803033:	89 f0                	mov    %esi,%eax
+  803035:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803038:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80303c:	48 89 c7             	mov    %rax,%rdi
+  80303f:	48 b8 05 9e ff ff ff 	movabs $0xffffffffffff9e05,%rax
+  803046:	ff ff ff 
+  803049:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80304d:	ff d0                	call   *%rax
+  80304f:	89 c2                	mov    %eax,%edx
+  803051:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803055:	48 89 c6             	mov    %rax,%rsi
+  803058:	89 d7                	mov    %edx,%edi
+  80305a:	48 b8 35 9f ff ff ff 	movabs $0xffffffffffff9f35,%rax
+  803061:	ff ff ff 
+  803064:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803068:	ff d0                	call   *%rax
+  80306a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80306d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803071:	78 0a                	js     80307d <fd_close+0x6d>
+	    || fd != fd2)
+  803073:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803077:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  80307b:	74 12                	je     80308f <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  80307d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803081:	74 05                	je     803088 <fd_close+0x78>
+  803083:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803086:	eb 7a                	jmp    803102 <fd_close+0xf2>
+  803088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308d:	eb 73                	jmp    803102 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80308f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803093:	8b 00                	mov    (%rax),%eax
+  803095:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803099:	48 89 d6             	mov    %rdx,%rsi
+  80309c:	89 c7                	mov    %eax,%edi
+  80309e:	48 b8 db a0 ff ff ff 	movabs $0xffffffffffffa0db,%rax
+  8030a5:	ff ff ff 
+  8030a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030ac:	ff d0                	call   *%rax
+  8030ae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8030b1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8030b5:	78 2a                	js     8030e1 <fd_close+0xd1>
+		if (dev->dev_close)
+  8030b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030bb:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8030bf:	48 85 c0             	test   %rax,%rax
+  8030c2:	74 16                	je     8030da <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8030c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030c8:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8030cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030d0:	48 89 c7             	mov    %rax,%rdi
+  8030d3:	ff d2                	call   *%rdx
+  8030d5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8030d8:	eb 07                	jmp    8030e1 <fd_close+0xd1>
+		else
+			r = 0;
+  8030da:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8030e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030e5:	48 89 c6             	mov    %rax,%rsi
+  8030e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030ed:	49 89 df             	mov    %rbx,%r15
+  8030f0:	48 b8 34 97 ff ff ff 	movabs $0xffffffffffff9734,%rax
+  8030f7:	ff ff ff 
+  8030fa:	48 01 d8             	add    %rbx,%rax
+  8030fd:	ff d0                	call   *%rax
+	return r;
+  8030ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803102:	48 83 c4 30          	add    $0x30,%rsp
+  803106:	5b                   	pop    %rbx
+  803107:	41 5f                	pop    %r15
+  803109:	5d                   	pop    %rbp
+  80310a:	c3                   	ret
+
+000000000080310b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80310b:	55                   	push   %rbp
+  80310c:	48 89 e5             	mov    %rsp,%rbp
+  80310f:	41 57                	push   %r15
+  803111:	48 83 ec 28          	sub    $0x28,%rsp
+  803115:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803115 <dev_lookup+0xa>
+  80311c:	49 bb 1b 5f 00 00 00 	movabs $0x5f1b,%r11
+  803123:	00 00 00 
+  803126:	4c 01 d9             	add    %r11,%rcx
+  803129:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80312c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803130:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803137:	eb 45                	jmp    80317e <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803139:	48 ba f0 01 00 00 00 	movabs $0x1f0,%rdx
+  803140:	00 00 00 
+  803143:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803146:	48 98                	cltq
+  803148:	48 01 ca             	add    %rcx,%rdx
+  80314b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80314f:	8b 00                	mov    (%rax),%eax
+  803151:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803154:	75 24                	jne    80317a <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803156:	48 ba f0 01 00 00 00 	movabs $0x1f0,%rdx
+  80315d:	00 00 00 
+  803160:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803163:	48 98                	cltq
+  803165:	48 01 ca             	add    %rcx,%rdx
+  803168:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80316c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803170:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803173:	b8 00 00 00 00       	mov    $0x0,%eax
+  803178:	eb 74                	jmp    8031ee <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  80317a:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80317e:	48 ba f0 01 00 00 00 	movabs $0x1f0,%rdx
+  803185:	00 00 00 
+  803188:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80318b:	48 98                	cltq
+  80318d:	48 01 ca             	add    %rcx,%rdx
+  803190:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803194:	48 85 c0             	test   %rax,%rax
+  803197:	75 a0                	jne    803139 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803199:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8031a0:	ff ff ff 
+  8031a3:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8031a7:	48 8b 00             	mov    (%rax),%rax
+  8031aa:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8031b0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8031b3:	89 c6                	mov    %eax,%esi
+  8031b5:	48 b8 50 da ff ff ff 	movabs $0xffffffffffffda50,%rax
+  8031bc:	ff ff ff 
+  8031bf:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8031c3:	48 89 c7             	mov    %rax,%rdi
+  8031c6:	49 89 cf             	mov    %rcx,%r15
+  8031c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ce:	49 b8 20 7a ff ff ff 	movabs $0xffffffffffff7a20,%r8
+  8031d5:	ff ff ff 
+  8031d8:	49 01 c8             	add    %rcx,%r8
+  8031db:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8031de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031e2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8031e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8031ee:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8031f2:	c9                   	leave
+  8031f3:	c3                   	ret
+
+00000000008031f4 <close>:
+
+int
+close(int fdnum)
+{
+  8031f4:	55                   	push   %rbp
+  8031f5:	48 89 e5             	mov    %rsp,%rbp
+  8031f8:	53                   	push   %rbx
+  8031f9:	48 83 ec 28          	sub    $0x28,%rsp
+  8031fd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031fd <close+0x9>
+  803204:	49 bb 33 5e 00 00 00 	movabs $0x5e33,%r11
+  80320b:	00 00 00 
+  80320e:	4c 01 db             	add    %r11,%rbx
+  803211:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803214:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803218:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80321b:	48 89 d6             	mov    %rdx,%rsi
+  80321e:	89 c7                	mov    %eax,%edi
+  803220:	48 b8 35 9f ff ff ff 	movabs $0xffffffffffff9f35,%rax
+  803227:	ff ff ff 
+  80322a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80322e:	ff d0                	call   *%rax
+  803230:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803233:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803237:	79 05                	jns    80323e <close+0x4a>
+		return r;
+  803239:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80323c:	eb 1c                	jmp    80325a <close+0x66>
+	else
+		return fd_close(fd, 1);
+  80323e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803242:	be 01 00 00 00       	mov    $0x1,%esi
+  803247:	48 89 c7             	mov    %rax,%rdi
+  80324a:	48 b8 e0 9f ff ff ff 	movabs $0xffffffffffff9fe0,%rax
+  803251:	ff ff ff 
+  803254:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803258:	ff d0                	call   *%rax
+}
+  80325a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80325e:	c9                   	leave
+  80325f:	c3                   	ret
+
+0000000000803260 <close_all>:
+
+void
+close_all(void)
+{
+  803260:	55                   	push   %rbp
+  803261:	48 89 e5             	mov    %rsp,%rbp
+  803264:	53                   	push   %rbx
+  803265:	48 83 ec 18          	sub    $0x18,%rsp
+  803269:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803269 <close_all+0x9>
+  803270:	49 bb c7 5d 00 00 00 	movabs $0x5dc7,%r11
+  803277:	00 00 00 
+  80327a:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80327d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803284:	eb 19                	jmp    80329f <close_all+0x3f>
+		close(i);
+  803286:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803289:	89 c7                	mov    %eax,%edi
+  80328b:	48 b8 c4 a1 ff ff ff 	movabs $0xffffffffffffa1c4,%rax
+  803292:	ff ff ff 
+  803295:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803299:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  80329b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80329f:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8032a3:	7e e1                	jle    803286 <close_all+0x26>
+}
+  8032a5:	90                   	nop
+  8032a6:	90                   	nop
+  8032a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032ab:	c9                   	leave
+  8032ac:	c3                   	ret
+
+00000000008032ad <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8032ad:	55                   	push   %rbp
+  8032ae:	48 89 e5             	mov    %rsp,%rbp
+  8032b1:	41 57                	push   %r15
+  8032b3:	53                   	push   %rbx
+  8032b4:	48 83 ec 40          	sub    $0x40,%rsp
+  8032b8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032b8 <dup+0xb>
+  8032bf:	49 bb 78 5d 00 00 00 	movabs $0x5d78,%r11
+  8032c6:	00 00 00 
+  8032c9:	4c 01 db             	add    %r11,%rbx
+  8032cc:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8032cf:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8032d2:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8032d6:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8032d9:	48 89 d6             	mov    %rdx,%rsi
+  8032dc:	89 c7                	mov    %eax,%edi
+  8032de:	48 b8 35 9f ff ff ff 	movabs $0xffffffffffff9f35,%rax
+  8032e5:	ff ff ff 
+  8032e8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032ec:	ff d0                	call   *%rax
+  8032ee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032f1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032f5:	79 08                	jns    8032ff <dup+0x52>
+		return r;
+  8032f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032fa:	e9 a4 01 00 00       	jmp    8034a3 <dup+0x1f6>
+	close(newfdnum);
+  8032ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803302:	89 c7                	mov    %eax,%edi
+  803304:	48 b8 c4 a1 ff ff ff 	movabs $0xffffffffffffa1c4,%rax
+  80330b:	ff ff ff 
+  80330e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803312:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803314:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803317:	48 98                	cltq
+  803319:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80331f:	48 c1 e0 0c          	shl    $0xc,%rax
+  803323:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803327:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80332b:	48 89 c7             	mov    %rax,%rdi
+  80332e:	48 b8 3c 9e ff ff ff 	movabs $0xffffffffffff9e3c,%rax
+  803335:	ff ff ff 
+  803338:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80333c:	ff d0                	call   *%rax
+  80333e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803342:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803346:	48 89 c7             	mov    %rax,%rdi
+  803349:	48 b8 3c 9e ff ff ff 	movabs $0xffffffffffff9e3c,%rax
+  803350:	ff ff ff 
+  803353:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803357:	ff d0                	call   *%rax
+  803359:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80335d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803361:	48 c1 e8 15          	shr    $0x15,%rax
+  803365:	48 89 c2             	mov    %rax,%rdx
+  803368:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  80336f:	ff ff ff 
+  803372:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803376:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80337a:	83 e0 01             	and    $0x1,%eax
+  80337d:	48 85 c0             	test   %rax,%rax
+  803380:	74 7f                	je     803401 <dup+0x154>
+  803382:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803386:	48 c1 e8 0c          	shr    $0xc,%rax
+  80338a:	48 89 c2             	mov    %rax,%rdx
+  80338d:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803394:	ff ff ff 
+  803397:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80339b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80339f:	83 e0 01             	and    $0x1,%eax
+  8033a2:	48 85 c0             	test   %rax,%rax
+  8033a5:	74 5a                	je     803401 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8033a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033ab:	48 c1 e8 0c          	shr    $0xc,%rax
+  8033af:	48 89 c2             	mov    %rax,%rdx
+  8033b2:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8033b9:	ff ff ff 
+  8033bc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033c0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033c4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8033c9:	89 c1                	mov    %eax,%ecx
+  8033cb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8033cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033d3:	41 89 c8             	mov    %ecx,%r8d
+  8033d6:	48 89 d1             	mov    %rdx,%rcx
+  8033d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033de:	48 89 c6             	mov    %rax,%rsi
+  8033e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033e6:	49 89 df             	mov    %rbx,%r15
+  8033e9:	48 b8 c1 96 ff ff ff 	movabs $0xffffffffffff96c1,%rax
+  8033f0:	ff ff ff 
+  8033f3:	48 01 d8             	add    %rbx,%rax
+  8033f6:	ff d0                	call   *%rax
+  8033f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8033fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8033ff:	78 5f                	js     803460 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803401:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803405:	48 c1 e8 0c          	shr    $0xc,%rax
+  803409:	48 89 c2             	mov    %rax,%rdx
+  80340c:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803413:	ff ff ff 
+  803416:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80341a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80341e:	25 07 0e 00 00       	and    $0xe07,%eax
+  803423:	89 c1                	mov    %eax,%ecx
+  803425:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803429:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80342d:	41 89 c8             	mov    %ecx,%r8d
+  803430:	48 89 d1             	mov    %rdx,%rcx
+  803433:	ba 00 00 00 00       	mov    $0x0,%edx
+  803438:	48 89 c6             	mov    %rax,%rsi
+  80343b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803440:	49 89 df             	mov    %rbx,%r15
+  803443:	48 b8 c1 96 ff ff ff 	movabs $0xffffffffffff96c1,%rax
+  80344a:	ff ff ff 
+  80344d:	48 01 d8             	add    %rbx,%rax
+  803450:	ff d0                	call   *%rax
+  803452:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803455:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803459:	78 08                	js     803463 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  80345b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80345e:	eb 43                	jmp    8034a3 <dup+0x1f6>
+			goto err;
+  803460:	90                   	nop
+  803461:	eb 01                	jmp    803464 <dup+0x1b7>
+		goto err;
+  803463:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803464:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803468:	48 89 c6             	mov    %rax,%rsi
+  80346b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803470:	49 89 df             	mov    %rbx,%r15
+  803473:	48 b8 34 97 ff ff ff 	movabs $0xffffffffffff9734,%rax
+  80347a:	ff ff ff 
+  80347d:	48 01 d8             	add    %rbx,%rax
+  803480:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803482:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803486:	48 89 c6             	mov    %rax,%rsi
+  803489:	bf 00 00 00 00       	mov    $0x0,%edi
+  80348e:	49 89 df             	mov    %rbx,%r15
+  803491:	48 b8 34 97 ff ff ff 	movabs $0xffffffffffff9734,%rax
+  803498:	ff ff ff 
+  80349b:	48 01 d8             	add    %rbx,%rax
+  80349e:	ff d0                	call   *%rax
+	return r;
+  8034a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8034a3:	48 83 c4 40          	add    $0x40,%rsp
+  8034a7:	5b                   	pop    %rbx
+  8034a8:	41 5f                	pop    %r15
+  8034aa:	5d                   	pop    %rbp
+  8034ab:	c3                   	ret
+
+00000000008034ac <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8034ac:	55                   	push   %rbp
+  8034ad:	48 89 e5             	mov    %rsp,%rbp
+  8034b0:	41 57                	push   %r15
+  8034b2:	53                   	push   %rbx
+  8034b3:	48 83 ec 40          	sub    $0x40,%rsp
+  8034b7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034b7 <read+0xb>
+  8034be:	49 bb 79 5b 00 00 00 	movabs $0x5b79,%r11
+  8034c5:	00 00 00 
+  8034c8:	4c 01 db             	add    %r11,%rbx
+  8034cb:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8034ce:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8034d2:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8034d6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8034da:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8034dd:	48 89 d6             	mov    %rdx,%rsi
+  8034e0:	89 c7                	mov    %eax,%edi
+  8034e2:	48 b8 35 9f ff ff ff 	movabs $0xffffffffffff9f35,%rax
+  8034e9:	ff ff ff 
+  8034ec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034f0:	ff d0                	call   *%rax
+  8034f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034f9:	78 28                	js     803523 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8034fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034ff:	8b 00                	mov    (%rax),%eax
+  803501:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803505:	48 89 d6             	mov    %rdx,%rsi
+  803508:	89 c7                	mov    %eax,%edi
+  80350a:	48 b8 db a0 ff ff ff 	movabs $0xffffffffffffa0db,%rax
+  803511:	ff ff ff 
+  803514:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803518:	ff d0                	call   *%rax
+  80351a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80351d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803521:	79 08                	jns    80352b <read+0x7f>
+		return r;
+  803523:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803526:	e9 8b 00 00 00       	jmp    8035b6 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80352b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80352f:	8b 40 08             	mov    0x8(%rax),%eax
+  803532:	83 e0 03             	and    $0x3,%eax
+  803535:	83 f8 01             	cmp    $0x1,%eax
+  803538:	75 4b                	jne    803585 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80353a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803541:	ff ff ff 
+  803544:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803548:	48 8b 00             	mov    (%rax),%rax
+  80354b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803551:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803554:	89 c6                	mov    %eax,%esi
+  803556:	48 b8 6f da ff ff ff 	movabs $0xffffffffffffda6f,%rax
+  80355d:	ff ff ff 
+  803560:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803564:	48 89 c7             	mov    %rax,%rdi
+  803567:	49 89 df             	mov    %rbx,%r15
+  80356a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80356f:	48 b9 20 7a ff ff ff 	movabs $0xffffffffffff7a20,%rcx
+  803576:	ff ff ff 
+  803579:	48 01 d9             	add    %rbx,%rcx
+  80357c:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80357e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803583:	eb 31                	jmp    8035b6 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803585:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803589:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80358d:	48 85 c0             	test   %rax,%rax
+  803590:	75 07                	jne    803599 <read+0xed>
+		return -E_NOT_SUPP;
+  803592:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803597:	eb 1d                	jmp    8035b6 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803599:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80359d:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8035a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035a5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8035a9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8035ad:	48 89 ce             	mov    %rcx,%rsi
+  8035b0:	48 89 c7             	mov    %rax,%rdi
+  8035b3:	41 ff d0             	call   *%r8
+}
+  8035b6:	48 83 c4 40          	add    $0x40,%rsp
+  8035ba:	5b                   	pop    %rbx
+  8035bb:	41 5f                	pop    %r15
+  8035bd:	5d                   	pop    %rbp
+  8035be:	c3                   	ret
+
+00000000008035bf <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8035bf:	55                   	push   %rbp
+  8035c0:	48 89 e5             	mov    %rsp,%rbp
+  8035c3:	53                   	push   %rbx
+  8035c4:	48 83 ec 38          	sub    $0x38,%rsp
+  8035c8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035c8 <readn+0x9>
+  8035cf:	49 bb 68 5a 00 00 00 	movabs $0x5a68,%r11
+  8035d6:	00 00 00 
+  8035d9:	4c 01 db             	add    %r11,%rbx
+  8035dc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8035df:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8035e3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8035e7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8035ee:	eb 4b                	jmp    80363b <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8035f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8035f3:	48 98                	cltq
+  8035f5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8035f9:	48 29 c2             	sub    %rax,%rdx
+  8035fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8035ff:	48 63 c8             	movslq %eax,%rcx
+  803602:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803606:	48 01 c1             	add    %rax,%rcx
+  803609:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80360c:	48 89 ce             	mov    %rcx,%rsi
+  80360f:	89 c7                	mov    %eax,%edi
+  803611:	48 b8 7c a4 ff ff ff 	movabs $0xffffffffffffa47c,%rax
+  803618:	ff ff ff 
+  80361b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80361f:	ff d0                	call   *%rax
+  803621:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803624:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803628:	79 05                	jns    80362f <readn+0x70>
+			return m;
+  80362a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80362d:	eb 1d                	jmp    80364c <readn+0x8d>
+		if (m == 0)
+  80362f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803633:	74 13                	je     803648 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803635:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803638:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80363b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80363e:	48 98                	cltq
+  803640:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803644:	72 aa                	jb     8035f0 <readn+0x31>
+  803646:	eb 01                	jmp    803649 <readn+0x8a>
+			break;
+  803648:	90                   	nop
+	}
+	return tot;
+  803649:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80364c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803650:	c9                   	leave
+  803651:	c3                   	ret
+
+0000000000803652 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803652:	55                   	push   %rbp
+  803653:	48 89 e5             	mov    %rsp,%rbp
+  803656:	41 57                	push   %r15
+  803658:	53                   	push   %rbx
+  803659:	48 83 ec 40          	sub    $0x40,%rsp
+  80365d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80365d <write+0xb>
+  803664:	49 bb d3 59 00 00 00 	movabs $0x59d3,%r11
+  80366b:	00 00 00 
+  80366e:	4c 01 db             	add    %r11,%rbx
+  803671:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803674:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803678:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80367c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803680:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803683:	48 89 d6             	mov    %rdx,%rsi
+  803686:	89 c7                	mov    %eax,%edi
+  803688:	48 b8 35 9f ff ff ff 	movabs $0xffffffffffff9f35,%rax
+  80368f:	ff ff ff 
+  803692:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803696:	ff d0                	call   *%rax
+  803698:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80369b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80369f:	78 28                	js     8036c9 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8036a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036a5:	8b 00                	mov    (%rax),%eax
+  8036a7:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8036ab:	48 89 d6             	mov    %rdx,%rsi
+  8036ae:	89 c7                	mov    %eax,%edi
+  8036b0:	48 b8 db a0 ff ff ff 	movabs $0xffffffffffffa0db,%rax
+  8036b7:	ff ff ff 
+  8036ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036be:	ff d0                	call   *%rax
+  8036c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8036c3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036c7:	79 08                	jns    8036d1 <write+0x7f>
+		return r;
+  8036c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036cc:	e9 8a 00 00 00       	jmp    80375b <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8036d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036d5:	8b 40 08             	mov    0x8(%rax),%eax
+  8036d8:	83 e0 03             	and    $0x3,%eax
+  8036db:	85 c0                	test   %eax,%eax
+  8036dd:	75 4b                	jne    80372a <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8036df:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8036e6:	ff ff ff 
+  8036e9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8036ed:	48 8b 00             	mov    (%rax),%rax
+  8036f0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8036f6:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8036f9:	89 c6                	mov    %eax,%esi
+  8036fb:	48 b8 8b da ff ff ff 	movabs $0xffffffffffffda8b,%rax
+  803702:	ff ff ff 
+  803705:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803709:	48 89 c7             	mov    %rax,%rdi
+  80370c:	49 89 df             	mov    %rbx,%r15
+  80370f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803714:	48 b9 20 7a ff ff ff 	movabs $0xffffffffffff7a20,%rcx
+  80371b:	ff ff ff 
+  80371e:	48 01 d9             	add    %rbx,%rcx
+  803721:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803723:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803728:	eb 31                	jmp    80375b <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80372a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80372e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803732:	48 85 c0             	test   %rax,%rax
+  803735:	75 07                	jne    80373e <write+0xec>
+		return -E_NOT_SUPP;
+  803737:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80373c:	eb 1d                	jmp    80375b <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  80373e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803742:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803746:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80374a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80374e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803752:	48 89 ce             	mov    %rcx,%rsi
+  803755:	48 89 c7             	mov    %rax,%rdi
+  803758:	41 ff d0             	call   *%r8
+}
+  80375b:	48 83 c4 40          	add    $0x40,%rsp
+  80375f:	5b                   	pop    %rbx
+  803760:	41 5f                	pop    %r15
+  803762:	5d                   	pop    %rbp
+  803763:	c3                   	ret
+
+0000000000803764 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803764:	55                   	push   %rbp
+  803765:	48 89 e5             	mov    %rsp,%rbp
+  803768:	48 83 ec 18          	sub    $0x18,%rsp
+  80376c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80376c <seek+0x8>
+  803773:	49 bb c4 58 00 00 00 	movabs $0x58c4,%r11
+  80377a:	00 00 00 
+  80377d:	4c 01 d8             	add    %r11,%rax
+  803780:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803783:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803786:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  80378a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80378d:	48 89 ce             	mov    %rcx,%rsi
+  803790:	89 d7                	mov    %edx,%edi
+  803792:	48 ba 35 9f ff ff ff 	movabs $0xffffffffffff9f35,%rdx
+  803799:	ff ff ff 
+  80379c:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8037a0:	ff d0                	call   *%rax
+  8037a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037a9:	79 05                	jns    8037b0 <seek+0x4c>
+		return r;
+  8037ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037ae:	eb 0f                	jmp    8037bf <seek+0x5b>
+	fd->fd_offset = offset;
+  8037b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037b4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8037b7:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8037ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037bf:	c9                   	leave
+  8037c0:	c3                   	ret
+
+00000000008037c1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8037c1:	55                   	push   %rbp
+  8037c2:	48 89 e5             	mov    %rsp,%rbp
+  8037c5:	41 57                	push   %r15
+  8037c7:	53                   	push   %rbx
+  8037c8:	48 83 ec 30          	sub    $0x30,%rsp
+  8037cc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037cc <ftruncate+0xb>
+  8037d3:	49 bb 64 58 00 00 00 	movabs $0x5864,%r11
+  8037da:	00 00 00 
+  8037dd:	4c 01 db             	add    %r11,%rbx
+  8037e0:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8037e3:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8037e6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8037ea:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8037ed:	48 89 d6             	mov    %rdx,%rsi
+  8037f0:	89 c7                	mov    %eax,%edi
+  8037f2:	48 b8 35 9f ff ff ff 	movabs $0xffffffffffff9f35,%rax
+  8037f9:	ff ff ff 
+  8037fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803800:	ff d0                	call   *%rax
+  803802:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803805:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803809:	78 28                	js     803833 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80380b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80380f:	8b 00                	mov    (%rax),%eax
+  803811:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803815:	48 89 d6             	mov    %rdx,%rsi
+  803818:	89 c7                	mov    %eax,%edi
+  80381a:	48 b8 db a0 ff ff ff 	movabs $0xffffffffffffa0db,%rax
+  803821:	ff ff ff 
+  803824:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803828:	ff d0                	call   *%rax
+  80382a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80382d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803831:	79 08                	jns    80383b <ftruncate+0x7a>
+		return r;
+  803833:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803836:	e9 83 00 00 00       	jmp    8038be <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80383b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80383f:	8b 40 08             	mov    0x8(%rax),%eax
+  803842:	83 e0 03             	and    $0x3,%eax
+  803845:	85 c0                	test   %eax,%eax
+  803847:	75 4b                	jne    803894 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803849:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803850:	ff ff ff 
+  803853:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803857:	48 8b 00             	mov    (%rax),%rax
+  80385a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803860:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803863:	89 c6                	mov    %eax,%esi
+  803865:	48 b8 a8 da ff ff ff 	movabs $0xffffffffffffdaa8,%rax
+  80386c:	ff ff ff 
+  80386f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803873:	48 89 c7             	mov    %rax,%rdi
+  803876:	49 89 df             	mov    %rbx,%r15
+  803879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80387e:	48 b9 20 7a ff ff ff 	movabs $0xffffffffffff7a20,%rcx
+  803885:	ff ff ff 
+  803888:	48 01 d9             	add    %rbx,%rcx
+  80388b:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80388d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803892:	eb 2a                	jmp    8038be <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803894:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803898:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80389c:	48 85 c0             	test   %rax,%rax
+  80389f:	75 07                	jne    8038a8 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8038a1:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8038a6:	eb 16                	jmp    8038be <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8038a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038ac:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8038b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8038b4:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8038b7:	89 d6                	mov    %edx,%esi
+  8038b9:	48 89 c7             	mov    %rax,%rdi
+  8038bc:	ff d1                	call   *%rcx
+}
+  8038be:	48 83 c4 30          	add    $0x30,%rsp
+  8038c2:	5b                   	pop    %rbx
+  8038c3:	41 5f                	pop    %r15
+  8038c5:	5d                   	pop    %rbp
+  8038c6:	c3                   	ret
+
+00000000008038c7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8038c7:	55                   	push   %rbp
+  8038c8:	48 89 e5             	mov    %rsp,%rbp
+  8038cb:	53                   	push   %rbx
+  8038cc:	48 83 ec 38          	sub    $0x38,%rsp
+  8038d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038d0 <fstat+0x9>
+  8038d7:	49 bb 60 57 00 00 00 	movabs $0x5760,%r11
+  8038de:	00 00 00 
+  8038e1:	4c 01 db             	add    %r11,%rbx
+  8038e4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8038e7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8038eb:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8038ef:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8038f2:	48 89 d6             	mov    %rdx,%rsi
+  8038f5:	89 c7                	mov    %eax,%edi
+  8038f7:	48 b8 35 9f ff ff ff 	movabs $0xffffffffffff9f35,%rax
+  8038fe:	ff ff ff 
+  803901:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803905:	ff d0                	call   *%rax
+  803907:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80390a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80390e:	78 28                	js     803938 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803910:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803914:	8b 00                	mov    (%rax),%eax
+  803916:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80391a:	48 89 d6             	mov    %rdx,%rsi
+  80391d:	89 c7                	mov    %eax,%edi
+  80391f:	48 b8 db a0 ff ff ff 	movabs $0xffffffffffffa0db,%rax
+  803926:	ff ff ff 
+  803929:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80392d:	ff d0                	call   *%rax
+  80392f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803932:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803936:	79 05                	jns    80393d <fstat+0x76>
+		return r;
+  803938:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80393b:	eb 5e                	jmp    80399b <fstat+0xd4>
+	if (!dev->dev_stat)
+  80393d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803941:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803945:	48 85 c0             	test   %rax,%rax
+  803948:	75 07                	jne    803951 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  80394a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80394f:	eb 4a                	jmp    80399b <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803951:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803955:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803958:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80395c:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803963:	00 00 00 
+	stat->st_isdir = 0;
+  803966:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80396a:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803971:	00 00 00 
+	stat->st_dev = dev;
+  803974:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803978:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80397c:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  803983:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803987:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80398b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80398f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803993:	48 89 d6             	mov    %rdx,%rsi
+  803996:	48 89 c7             	mov    %rax,%rdi
+  803999:	ff d1                	call   *%rcx
+}
+  80399b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80399f:	c9                   	leave
+  8039a0:	c3                   	ret
+
+00000000008039a1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8039a1:	55                   	push   %rbp
+  8039a2:	48 89 e5             	mov    %rsp,%rbp
+  8039a5:	41 57                	push   %r15
+  8039a7:	53                   	push   %rbx
+  8039a8:	48 83 ec 20          	sub    $0x20,%rsp
+  8039ac:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039ac <stat+0xb>
+  8039b3:	49 bb 84 56 00 00 00 	movabs $0x5684,%r11
+  8039ba:	00 00 00 
+  8039bd:	4c 01 db             	add    %r11,%rbx
+  8039c0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8039c4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8039c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8039cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8039d1:	48 89 c7             	mov    %rax,%rdi
+  8039d4:	49 89 df             	mov    %rbx,%r15
+  8039d7:	48 b8 4b ac ff ff ff 	movabs $0xffffffffffffac4b,%rax
+  8039de:	ff ff ff 
+  8039e1:	48 01 d8             	add    %rbx,%rax
+  8039e4:	ff d0                	call   *%rax
+  8039e6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8039e9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039ed:	79 05                	jns    8039f4 <stat+0x53>
+		return fd;
+  8039ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039f2:	eb 37                	jmp    803a2b <stat+0x8a>
+	r = fstat(fd, stat);
+  8039f4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8039f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039fb:	48 89 d6             	mov    %rdx,%rsi
+  8039fe:	89 c7                	mov    %eax,%edi
+  803a00:	48 b8 97 a8 ff ff ff 	movabs $0xffffffffffffa897,%rax
+  803a07:	ff ff ff 
+  803a0a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a0e:	ff d0                	call   *%rax
+  803a10:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803a13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a16:	89 c7                	mov    %eax,%edi
+  803a18:	48 b8 c4 a1 ff ff ff 	movabs $0xffffffffffffa1c4,%rax
+  803a1f:	ff ff ff 
+  803a22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a26:	ff d0                	call   *%rax
+	return r;
+  803a28:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803a2b:	48 83 c4 20          	add    $0x20,%rsp
+  803a2f:	5b                   	pop    %rbx
+  803a30:	41 5f                	pop    %r15
+  803a32:	5d                   	pop    %rbp
+  803a33:	c3                   	ret
+
+0000000000803a34 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803a34:	55                   	push   %rbp
+  803a35:	48 89 e5             	mov    %rsp,%rbp
+  803a38:	41 57                	push   %r15
+  803a3a:	53                   	push   %rbx
+  803a3b:	48 83 ec 10          	sub    $0x10,%rsp
+  803a3f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a3f <fsipc+0xb>
+  803a46:	49 bb f1 55 00 00 00 	movabs $0x55f1,%r11
+  803a4d:	00 00 00 
+  803a50:	4c 01 db             	add    %r11,%rbx
+  803a53:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803a56:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803a5a:	48 b8 d0 13 00 00 00 	movabs $0x13d0,%rax
+  803a61:	00 00 00 
+  803a64:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803a67:	85 c0                	test   %eax,%eax
+  803a69:	75 24                	jne    803a8f <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a6b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a70:	49 89 df             	mov    %rbx,%r15
+  803a73:	48 b8 0e d4 ff ff ff 	movabs $0xffffffffffffd40e,%rax
+  803a7a:	ff ff ff 
+  803a7d:	48 01 d8             	add    %rbx,%rax
+  803a80:	ff d0                	call   *%rax
+  803a82:	48 ba d0 13 00 00 00 	movabs $0x13d0,%rdx
+  803a89:	00 00 00 
+  803a8c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  803a8f:	48 b8 d0 13 00 00 00 	movabs $0x13d0,%rax
+  803a96:	00 00 00 
+  803a99:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803a9c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803aa0:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803aa3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803aa9:	49 89 d0             	mov    %rdx,%r8
+  803aac:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803ab1:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803ab8:	00 00 00 
+  803abb:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803abf:	89 c7                	mov    %eax,%edi
+  803ac1:	49 89 df             	mov    %rbx,%r15
+  803ac4:	48 b8 2d ce ff ff ff 	movabs $0xffffffffffffce2d,%rax
+  803acb:	ff ff ff 
+  803ace:	48 01 d8             	add    %rbx,%rax
+  803ad1:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  803ad3:	48 83 c4 10          	add    $0x10,%rsp
+  803ad7:	5b                   	pop    %rbx
+  803ad8:	41 5f                	pop    %r15
+  803ada:	5d                   	pop    %rbp
+  803adb:	c3                   	ret
+
+0000000000803adc <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803adc:	55                   	push   %rbp
+  803add:	48 89 e5             	mov    %rsp,%rbp
+  803ae0:	41 57                	push   %r15
+  803ae2:	53                   	push   %rbx
+  803ae3:	48 83 ec 20          	sub    $0x20,%rsp
+  803ae7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ae7 <fsipc_words+0xb>
+  803aee:	49 bb 49 55 00 00 00 	movabs $0x5549,%r11
+  803af5:	00 00 00 
+  803af8:	4c 01 db             	add    %r11,%rbx
+  803afb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803afe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803b02:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  803b06:	48 b8 d0 13 00 00 00 	movabs $0x13d0,%rax
+  803b0d:	00 00 00 
+  803b10:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803b13:	85 c0                	test   %eax,%eax
+  803b15:	75 24                	jne    803b3b <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803b17:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b1c:	49 89 df             	mov    %rbx,%r15
+  803b1f:	48 b8 0e d4 ff ff ff 	movabs $0xffffffffffffd40e,%rax
+  803b26:	ff ff ff 
+  803b29:	48 01 d8             	add    %rbx,%rax
+  803b2c:	ff d0                	call   *%rax
+  803b2e:	48 ba d0 13 00 00 00 	movabs $0x13d0,%rdx
+  803b35:	00 00 00 
+  803b38:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803b3b:	48 b8 d0 13 00 00 00 	movabs $0x13d0,%rax
+  803b42:	00 00 00 
+  803b45:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803b48:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803b4c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803b50:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803b53:	89 c7                	mov    %eax,%edi
+  803b55:	49 89 df             	mov    %rbx,%r15
+  803b58:	48 b8 18 cf ff ff ff 	movabs $0xffffffffffffcf18,%rax
+  803b5f:	ff ff ff 
+  803b62:	48 01 d8             	add    %rbx,%rax
+  803b65:	ff d0                	call   *%rax
+}
+  803b67:	48 83 c4 20          	add    $0x20,%rsp
+  803b6b:	5b                   	pop    %rbx
+  803b6c:	41 5f                	pop    %r15
+  803b6e:	5d                   	pop    %rbp
+  803b6f:	c3                   	ret
+
+0000000000803b70 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803b70:	55                   	push   %rbp
+  803b71:	48 89 e5             	mov    %rsp,%rbp
+  803b74:	41 57                	push   %r15
+  803b76:	53                   	push   %rbx
+  803b77:	48 83 ec 40          	sub    $0x40,%rsp
+  803b7b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b7b <fsipc_pages+0xb>
+  803b82:	49 bb b5 54 00 00 00 	movabs $0x54b5,%r11
+  803b89:	00 00 00 
+  803b8c:	4c 01 db             	add    %r11,%rbx
+  803b8f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803b92:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803b96:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  803b9a:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  803b9d:	48 b8 d0 13 00 00 00 	movabs $0x13d0,%rax
+  803ba4:	00 00 00 
+  803ba7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803baa:	85 c0                	test   %eax,%eax
+  803bac:	75 24                	jne    803bd2 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803bae:	bf 01 00 00 00       	mov    $0x1,%edi
+  803bb3:	49 89 df             	mov    %rbx,%r15
+  803bb6:	48 b8 0e d4 ff ff ff 	movabs $0xffffffffffffd40e,%rax
+  803bbd:	ff ff ff 
+  803bc0:	48 01 d8             	add    %rbx,%rax
+  803bc3:	ff d0                	call   *%rax
+  803bc5:	48 ba d0 13 00 00 00 	movabs $0x13d0,%rdx
+  803bcc:	00 00 00 
+  803bcf:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  803bd2:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803bd7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  803bdb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803bde:	48 98                	cltq
+  803be0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  803be4:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  803be8:	0f 95 c0             	setne  %al
+  803beb:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803bee:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803bf5:	00 
+  803bf6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803bfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bfe:	48 01 d0             	add    %rdx,%rax
+  803c01:	48 83 e8 01          	sub    $0x1,%rax
+  803c05:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803c09:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c12:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803c16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c1a:	48 29 d0             	sub    %rdx,%rax
+  803c1d:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803c21:	41 89 c2             	mov    %eax,%r10d
+  803c24:	48 b8 d0 13 00 00 00 	movabs $0x13d0,%rax
+  803c2b:	00 00 00 
+  803c2e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803c31:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  803c35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c39:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803c3c:	48 83 ec 08          	sub    $0x8,%rsp
+  803c40:	6a 40                	push   $0x40
+  803c42:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  803c47:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  803c4e:	00 
+  803c4f:	6a 05                	push   $0x5
+  803c51:	41 89 f9             	mov    %edi,%r9d
+  803c54:	49 89 c8             	mov    %rcx,%r8
+  803c57:	44 89 d1             	mov    %r10d,%ecx
+  803c5a:	89 c7                	mov    %eax,%edi
+  803c5c:	49 89 df             	mov    %rbx,%r15
+  803c5f:	48 b8 16 d0 ff ff ff 	movabs $0xffffffffffffd016,%rax
+  803c66:	ff ff ff 
+  803c69:	48 01 d8             	add    %rbx,%rax
+  803c6c:	ff d0                	call   *%rax
+  803c6e:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  803c72:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c76:	5b                   	pop    %rbx
+  803c77:	41 5f                	pop    %r15
+  803c79:	5d                   	pop    %rbp
+  803c7a:	c3                   	ret
+
+0000000000803c7b <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  803c7b:	55                   	push   %rbp
+  803c7c:	48 89 e5             	mov    %rsp,%rbp
+  803c7f:	41 57                	push   %r15
+  803c81:	53                   	push   %rbx
+  803c82:	48 83 ec 20          	sub    $0x20,%rsp
+  803c86:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c86 <open+0xb>
+  803c8d:	49 bb aa 53 00 00 00 	movabs $0x53aa,%r11
+  803c94:	00 00 00 
+  803c97:	4c 01 db             	add    %r11,%rbx
+  803c9a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803c9e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  803ca1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ca5:	48 89 c7             	mov    %rax,%rdi
+  803ca8:	49 89 df             	mov    %rbx,%r15
+  803cab:	48 b8 0c 89 ff ff ff 	movabs $0xffffffffffff890c,%rax
+  803cb2:	ff ff ff 
+  803cb5:	48 01 d8             	add    %rbx,%rax
+  803cb8:	ff d0                	call   *%rax
+  803cba:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803cbf:	7e 0a                	jle    803ccb <open+0x50>
+		return -E_BAD_PATH;
+  803cc1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803cc6:	e9 18 01 00 00       	jmp    803de3 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  803ccb:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803ccf:	48 89 c7             	mov    %rax,%rdi
+  803cd2:	49 89 df             	mov    %rbx,%r15
+  803cd5:	48 b8 7f 9e ff ff ff 	movabs $0xffffffffffff9e7f,%rax
+  803cdc:	ff ff ff 
+  803cdf:	48 01 d8             	add    %rbx,%rax
+  803ce2:	ff d0                	call   *%rax
+  803ce4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ce7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ceb:	74 08                	je     803cf5 <open+0x7a>
+		return r;
+  803ced:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cf0:	e9 ee 00 00 00       	jmp    803de3 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  803cf5:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803cfc:	00 00 00 
+  803cff:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803d02:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  803d09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d0d:	48 89 c6             	mov    %rax,%rsi
+  803d10:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803d17:	00 00 00 
+  803d1a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d1e:	48 89 c7             	mov    %rax,%rdi
+  803d21:	49 89 df             	mov    %rbx,%r15
+  803d24:	48 b8 a0 89 ff ff ff 	movabs $0xffffffffffff89a0,%rax
+  803d2b:	ff ff ff 
+  803d2e:	48 01 d8             	add    %rbx,%rax
+  803d31:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  803d33:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d37:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  803d3c:	48 89 c6             	mov    %rax,%rsi
+  803d3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d44:	49 89 df             	mov    %rbx,%r15
+  803d47:	48 b8 5c 96 ff ff ff 	movabs $0xffffffffffff965c,%rax
+  803d4e:	ff ff ff 
+  803d51:	48 01 d8             	add    %rbx,%rax
+  803d54:	ff d0                	call   *%rax
+  803d56:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d59:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d5d:	74 23                	je     803d82 <open+0x107>
+		fd_close(fd,0);
+  803d5f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d63:	be 00 00 00 00       	mov    $0x0,%esi
+  803d68:	48 89 c7             	mov    %rax,%rdi
+  803d6b:	49 89 df             	mov    %rbx,%r15
+  803d6e:	48 b8 e0 9f ff ff ff 	movabs $0xffffffffffff9fe0,%rax
+  803d75:	ff ff ff 
+  803d78:	48 01 d8             	add    %rbx,%rax
+  803d7b:	ff d0                	call   *%rax
+		return r;
+  803d7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d80:	eb 61                	jmp    803de3 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  803d82:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d86:	48 89 c6             	mov    %rax,%rsi
+  803d89:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d8e:	48 b8 04 aa ff ff ff 	movabs $0xffffffffffffaa04,%rax
+  803d95:	ff ff ff 
+  803d98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d9c:	ff d0                	call   *%rax
+  803d9e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803da1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803da5:	74 23                	je     803dca <open+0x14f>
+		fd_close(fd,0);
+  803da7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dab:	be 00 00 00 00       	mov    $0x0,%esi
+  803db0:	48 89 c7             	mov    %rax,%rdi
+  803db3:	49 89 df             	mov    %rbx,%r15
+  803db6:	48 b8 e0 9f ff ff ff 	movabs $0xffffffffffff9fe0,%rax
+  803dbd:	ff ff ff 
+  803dc0:	48 01 d8             	add    %rbx,%rax
+  803dc3:	ff d0                	call   *%rax
+		return r;
+  803dc5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dc8:	eb 19                	jmp    803de3 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  803dca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dce:	48 89 c7             	mov    %rax,%rdi
+  803dd1:	49 89 df             	mov    %rbx,%r15
+  803dd4:	48 b8 05 9e ff ff ff 	movabs $0xffffffffffff9e05,%rax
+  803ddb:	ff ff ff 
+  803dde:	48 01 d8             	add    %rbx,%rax
+  803de1:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  803de3:	48 83 c4 20          	add    $0x20,%rsp
+  803de7:	5b                   	pop    %rbx
+  803de8:	41 5f                	pop    %r15
+  803dea:	5d                   	pop    %rbp
+  803deb:	c3                   	ret
+
+0000000000803dec <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  803dec:	55                   	push   %rbp
+  803ded:	48 89 e5             	mov    %rsp,%rbp
+  803df0:	48 83 ec 20          	sub    $0x20,%rsp
+  803df4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803df4 <devfile_flush+0x8>
+  803dfb:	49 bb 3c 52 00 00 00 	movabs $0x523c,%r11
+  803e02:	00 00 00 
+  803e05:	4c 01 d8             	add    %r11,%rax
+  803e08:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  803e0c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803e10:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803e13:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  803e16:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  803e1a:	ba 04 00 00 00       	mov    $0x4,%edx
+  803e1f:	48 89 ce             	mov    %rcx,%rsi
+  803e22:	bf 06 00 00 00       	mov    $0x6,%edi
+  803e27:	48 b9 ac aa ff ff ff 	movabs $0xffffffffffffaaac,%rcx
+  803e2e:	ff ff ff 
+  803e31:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803e35:	ff d0                	call   *%rax
+}
+  803e37:	c9                   	leave
+  803e38:	c3                   	ret
+
+0000000000803e39 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803e39:	55                   	push   %rbp
+  803e3a:	48 89 e5             	mov    %rsp,%rbp
+  803e3d:	41 57                	push   %r15
+  803e3f:	53                   	push   %rbx
+  803e40:	48 83 ec 60          	sub    $0x60,%rsp
+  803e44:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e44 <devfile_read+0xb>
+  803e4b:	49 bb ec 51 00 00 00 	movabs $0x51ec,%r11
+  803e52:	00 00 00 
+  803e55:	4c 01 db             	add    %r11,%rbx
+  803e58:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803e5c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803e60:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  803e64:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803e68:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  803e6c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803e70:	8b 50 0c             	mov    0xc(%rax),%edx
+  803e73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e77:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803e79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e7d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  803e81:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  803e85:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803e89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e8e:	ba 10 00 00 00       	mov    $0x10,%edx
+  803e93:	48 89 c6             	mov    %rax,%rsi
+  803e96:	bf 03 00 00 00       	mov    $0x3,%edi
+  803e9b:	48 b8 40 ab ff ff ff 	movabs $0xffffffffffffab40,%rax
+  803ea2:	ff ff ff 
+  803ea5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ea9:	ff d0                	call   *%rax
+  803eab:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803eae:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803eb2:	79 05                	jns    803eb9 <devfile_read+0x80>
+		return r;
+  803eb4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803eb7:	eb 64                	jmp    803f1d <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  803eb9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ebc:	48 63 d0             	movslq %eax,%rdx
+  803ebf:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803ec3:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  803ec8:	48 01 c1             	add    %rax,%rcx
+  803ecb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803ecf:	48 89 ce             	mov    %rcx,%rsi
+  803ed2:	48 89 c7             	mov    %rax,%rdi
+  803ed5:	49 89 df             	mov    %rbx,%r15
+  803ed8:	48 b8 80 8d ff ff ff 	movabs $0xffffffffffff8d80,%rax
+  803edf:	ff ff ff 
+  803ee2:	48 01 d8             	add    %rbx,%rax
+  803ee5:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  803ee7:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803eee:	ff ff ff 
+  803ef1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803ef5:	48 8b 00             	mov    (%rax),%rax
+  803ef8:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803efe:	89 c6                	mov    %eax,%esi
+  803f00:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  803f05:	48 89 c7             	mov    %rax,%rdi
+  803f08:	49 89 df             	mov    %rbx,%r15
+  803f0b:	48 b8 c8 d3 ff ff ff 	movabs $0xffffffffffffd3c8,%rax
+  803f12:	ff ff ff 
+  803f15:	48 01 d8             	add    %rbx,%rax
+  803f18:	ff d0                	call   *%rax
+	return r;
+  803f1a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803f1d:	48 83 c4 60          	add    $0x60,%rsp
+  803f21:	5b                   	pop    %rbx
+  803f22:	41 5f                	pop    %r15
+  803f24:	5d                   	pop    %rbp
+  803f25:	c3                   	ret
+
+0000000000803f26 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803f26:	55                   	push   %rbp
+  803f27:	48 89 e5             	mov    %rsp,%rbp
+  803f2a:	41 57                	push   %r15
+  803f2c:	53                   	push   %rbx
+  803f2d:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803f31:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f31 <devfile_write+0xb>
+  803f38:	49 bb ff 50 00 00 00 	movabs $0x50ff,%r11
+  803f3f:	00 00 00 
+  803f42:	4c 01 db             	add    %r11,%rbx
+  803f45:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803f49:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803f4d:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803f54:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803f58:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803f5c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  803f63:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803f67:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803f6e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f71:	48 63 d0             	movslq %eax,%rdx
+  803f74:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f78:	48 39 c2             	cmp    %rax,%rdx
+  803f7b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803f7f:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  803f86:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803f8d:	00 
+  803f8e:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803f95:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f99:	48 01 d0             	add    %rdx,%rax
+  803f9c:	48 83 e8 01          	sub    $0x1,%rax
+  803fa0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803fa4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fa8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fad:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803fb1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fb5:	48 29 d0             	sub    %rdx,%rax
+  803fb8:	48 c1 e8 0c          	shr    $0xc,%rax
+  803fbc:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803fbf:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803fc2:	89 c6                	mov    %eax,%esi
+  803fc4:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803fc9:	48 89 c7             	mov    %rax,%rdi
+  803fcc:	49 89 df             	mov    %rbx,%r15
+  803fcf:	48 b8 82 d3 ff ff ff 	movabs $0xffffffffffffd382,%rax
+  803fd6:	ff ff ff 
+  803fd9:	48 01 d8             	add    %rbx,%rax
+  803fdc:	ff d0                	call   *%rax
+  803fde:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803fe1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803fe5:	79 08                	jns    803fef <devfile_write+0xc9>
+		return r;
+  803fe7:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803fea:	e9 8f 00 00 00       	jmp    80407e <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803fef:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803ff6:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803ffa:	48 89 c6             	mov    %rax,%rsi
+  803ffd:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804002:	48 89 c7             	mov    %rax,%rdi
+  804005:	49 89 df             	mov    %rbx,%r15
+  804008:	48 b8 80 8d ff ff ff 	movabs $0xffffffffffff8d80,%rax
+  80400f:	ff ff ff 
+  804012:	48 01 d8             	add    %rbx,%rax
+  804015:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804017:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80401b:	8b 50 0c             	mov    0xc(%rax),%edx
+  80401e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804022:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804024:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804028:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80402f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804033:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804036:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80403a:	89 d1                	mov    %edx,%ecx
+  80403c:	ba 10 00 00 00       	mov    $0x10,%edx
+  804041:	48 89 c6             	mov    %rax,%rsi
+  804044:	bf 04 00 00 00       	mov    $0x4,%edi
+  804049:	48 b8 40 ab ff ff ff 	movabs $0xffffffffffffab40,%rax
+  804050:	ff ff ff 
+  804053:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804057:	ff d0                	call   *%rax
+  804059:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  80405c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80405f:	89 c6                	mov    %eax,%esi
+  804061:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804066:	48 89 c7             	mov    %rax,%rdi
+  804069:	49 89 df             	mov    %rbx,%r15
+  80406c:	48 b8 c8 d3 ff ff ff 	movabs $0xffffffffffffd3c8,%rax
+  804073:	ff ff ff 
+  804076:	48 01 d8             	add    %rbx,%rax
+  804079:	ff d0                	call   *%rax
+	return r;
+  80407b:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  80407e:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804082:	5b                   	pop    %rbx
+  804083:	41 5f                	pop    %r15
+  804085:	5d                   	pop    %rbp
+  804086:	c3                   	ret
+
+0000000000804087 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804087:	55                   	push   %rbp
+  804088:	48 89 e5             	mov    %rsp,%rbp
+  80408b:	41 57                	push   %r15
+  80408d:	53                   	push   %rbx
+  80408e:	48 83 ec 20          	sub    $0x20,%rsp
+  804092:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804092 <devfile_stat+0xb>
+  804099:	49 bb 9e 4f 00 00 00 	movabs $0x4f9e,%r11
+  8040a0:	00 00 00 
+  8040a3:	4c 01 db             	add    %r11,%rbx
+  8040a6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8040aa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8040ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040b2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8040b5:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8040bc:	00 00 00 
+  8040bf:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8040c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8040c7:	bf 05 00 00 00       	mov    $0x5,%edi
+  8040cc:	48 b8 04 aa ff ff ff 	movabs $0xffffffffffffaa04,%rax
+  8040d3:	ff ff ff 
+  8040d6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040da:	ff d0                	call   *%rax
+  8040dc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040df:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040e3:	79 05                	jns    8040ea <devfile_stat+0x63>
+		return r;
+  8040e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040e8:	eb 65                	jmp    80414f <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8040ea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040ee:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8040f5:	00 00 00 
+  8040f8:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8040fc:	48 89 d6             	mov    %rdx,%rsi
+  8040ff:	48 89 c7             	mov    %rax,%rdi
+  804102:	49 89 df             	mov    %rbx,%r15
+  804105:	48 b8 a0 89 ff ff ff 	movabs $0xffffffffffff89a0,%rax
+  80410c:	ff ff ff 
+  80410f:	48 01 d8             	add    %rbx,%rax
+  804112:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804114:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  80411b:	00 00 00 
+  80411e:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804125:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804129:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80412f:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  804136:	00 00 00 
+  804139:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804140:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804144:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  80414a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80414f:	48 83 c4 20          	add    $0x20,%rsp
+  804153:	5b                   	pop    %rbx
+  804154:	41 5f                	pop    %r15
+  804156:	5d                   	pop    %rbp
+  804157:	c3                   	ret
+
+0000000000804158 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804158:	55                   	push   %rbp
+  804159:	48 89 e5             	mov    %rsp,%rbp
+  80415c:	48 83 ec 20          	sub    $0x20,%rsp
+  804160:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804160 <devfile_trunc+0x8>
+  804167:	49 bb d0 4e 00 00 00 	movabs $0x4ed0,%r11
+  80416e:	00 00 00 
+  804171:	4c 01 d8             	add    %r11,%rax
+  804174:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804178:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  80417b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80417f:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804182:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804185:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804188:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  80418b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80418f:	ba 08 00 00 00       	mov    $0x8,%edx
+  804194:	48 89 ce             	mov    %rcx,%rsi
+  804197:	bf 02 00 00 00       	mov    $0x2,%edi
+  80419c:	48 b9 ac aa ff ff ff 	movabs $0xffffffffffffaaac,%rcx
+  8041a3:	ff ff ff 
+  8041a6:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8041aa:	ff d0                	call   *%rax
+}
+  8041ac:	c9                   	leave
+  8041ad:	c3                   	ret
+
+00000000008041ae <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8041ae:	55                   	push   %rbp
+  8041af:	48 89 e5             	mov    %rsp,%rbp
+  8041b2:	41 57                	push   %r15
+  8041b4:	53                   	push   %rbx
+  8041b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8041b9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041b9 <remove+0xb>
+  8041c0:	49 bb 77 4e 00 00 00 	movabs $0x4e77,%r11
+  8041c7:	00 00 00 
+  8041ca:	4c 01 db             	add    %r11,%rbx
+  8041cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8041d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041d5:	48 89 c7             	mov    %rax,%rdi
+  8041d8:	49 89 df             	mov    %rbx,%r15
+  8041db:	48 b8 0c 89 ff ff ff 	movabs $0xffffffffffff890c,%rax
+  8041e2:	ff ff ff 
+  8041e5:	48 01 d8             	add    %rbx,%rax
+  8041e8:	ff d0                	call   *%rax
+  8041ea:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8041ef:	7e 07                	jle    8041f8 <remove+0x4a>
+		return -E_BAD_PATH;
+  8041f1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8041f6:	eb 44                	jmp    80423c <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8041f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041fc:	48 89 c6             	mov    %rax,%rsi
+  8041ff:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  804206:	00 00 00 
+  804209:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80420d:	48 89 c7             	mov    %rax,%rdi
+  804210:	49 89 df             	mov    %rbx,%r15
+  804213:	48 b8 a0 89 ff ff ff 	movabs $0xffffffffffff89a0,%rax
+  80421a:	ff ff ff 
+  80421d:	48 01 d8             	add    %rbx,%rax
+  804220:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804222:	be 00 00 00 00       	mov    $0x0,%esi
+  804227:	bf 07 00 00 00       	mov    $0x7,%edi
+  80422c:	48 b8 04 aa ff ff ff 	movabs $0xffffffffffffaa04,%rax
+  804233:	ff ff ff 
+  804236:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80423a:	ff d0                	call   *%rax
+}
+  80423c:	48 83 c4 10          	add    $0x10,%rsp
+  804240:	5b                   	pop    %rbx
+  804241:	41 5f                	pop    %r15
+  804243:	5d                   	pop    %rbp
+  804244:	c3                   	ret
+
+0000000000804245 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804245:	55                   	push   %rbp
+  804246:	48 89 e5             	mov    %rsp,%rbp
+  804249:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804249 <sync+0x4>
+  804250:	49 bb e7 4d 00 00 00 	movabs $0x4de7,%r11
+  804257:	00 00 00 
+  80425a:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  80425d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804262:	be 00 00 00 00       	mov    $0x0,%esi
+  804267:	bf 08 00 00 00       	mov    $0x8,%edi
+  80426c:	48 b9 ac aa ff ff ff 	movabs $0xffffffffffffaaac,%rcx
+  804273:	ff ff ff 
+  804276:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80427a:	ff d0                	call   *%rax
+}
+  80427c:	5d                   	pop    %rbp
+  80427d:	c3                   	ret
+
+000000000080427e <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  80427e:	55                   	push   %rbp
+  80427f:	48 89 e5             	mov    %rsp,%rbp
+  804282:	41 57                	push   %r15
+  804284:	53                   	push   %rbx
+  804285:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  80428c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80428c <copy+0xe>
+  804293:	49 bb a4 4d 00 00 00 	movabs $0x4da4,%r11
+  80429a:	00 00 00 
+  80429d:	4c 01 db             	add    %r11,%rbx
+  8042a0:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8042a7:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8042ae:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8042b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8042ba:	48 89 c7             	mov    %rax,%rdi
+  8042bd:	48 b8 4b ac ff ff ff 	movabs $0xffffffffffffac4b,%rax
+  8042c4:	ff ff ff 
+  8042c7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042cb:	ff d0                	call   *%rax
+  8042cd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8042d0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042d4:	79 35                	jns    80430b <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8042d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042d9:	89 c6                	mov    %eax,%esi
+  8042db:	48 b8 ce da ff ff ff 	movabs $0xffffffffffffdace,%rax
+  8042e2:	ff ff ff 
+  8042e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042e9:	48 89 c7             	mov    %rax,%rdi
+  8042ec:	49 89 df             	mov    %rbx,%r15
+  8042ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042f4:	48 ba 20 7a ff ff ff 	movabs $0xffffffffffff7a20,%rdx
+  8042fb:	ff ff ff 
+  8042fe:	48 01 da             	add    %rbx,%rdx
+  804301:	ff d2                	call   *%rdx
+		return fd_src;
+  804303:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804306:	e9 d7 01 00 00       	jmp    8044e2 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  80430b:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804312:	be 01 01 00 00       	mov    $0x101,%esi
+  804317:	48 89 c7             	mov    %rax,%rdi
+  80431a:	48 b8 4b ac ff ff ff 	movabs $0xffffffffffffac4b,%rax
+  804321:	ff ff ff 
+  804324:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804328:	ff d0                	call   *%rax
+  80432a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  80432d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804331:	0f 89 df 00 00 00    	jns    804416 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804337:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80433a:	89 c6                	mov    %eax,%esi
+  80433c:	48 b8 e4 da ff ff ff 	movabs $0xffffffffffffdae4,%rax
+  804343:	ff ff ff 
+  804346:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80434a:	48 89 c7             	mov    %rax,%rdi
+  80434d:	49 89 df             	mov    %rbx,%r15
+  804350:	b8 00 00 00 00       	mov    $0x0,%eax
+  804355:	48 ba 20 7a ff ff ff 	movabs $0xffffffffffff7a20,%rdx
+  80435c:	ff ff ff 
+  80435f:	48 01 da             	add    %rbx,%rdx
+  804362:	ff d2                	call   *%rdx
+		close(fd_src);
+  804364:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804367:	89 c7                	mov    %eax,%edi
+  804369:	49 89 df             	mov    %rbx,%r15
+  80436c:	48 b8 c4 a1 ff ff ff 	movabs $0xffffffffffffa1c4,%rax
+  804373:	ff ff ff 
+  804376:	48 01 d8             	add    %rbx,%rax
+  804379:	ff d0                	call   *%rax
+		return fd_dest;
+  80437b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80437e:	e9 5f 01 00 00       	jmp    8044e2 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804383:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804386:	48 63 d0             	movslq %eax,%rdx
+  804389:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804390:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804393:	48 89 ce             	mov    %rcx,%rsi
+  804396:	89 c7                	mov    %eax,%edi
+  804398:	49 89 df             	mov    %rbx,%r15
+  80439b:	48 b8 22 a6 ff ff ff 	movabs $0xffffffffffffa622,%rax
+  8043a2:	ff ff ff 
+  8043a5:	48 01 d8             	add    %rbx,%rax
+  8043a8:	ff d0                	call   *%rax
+  8043aa:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8043ad:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8043b1:	79 63                	jns    804416 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8043b3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8043b6:	89 c6                	mov    %eax,%esi
+  8043b8:	48 b8 fe da ff ff ff 	movabs $0xffffffffffffdafe,%rax
+  8043bf:	ff ff ff 
+  8043c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043c6:	48 89 c7             	mov    %rax,%rdi
+  8043c9:	49 89 df             	mov    %rbx,%r15
+  8043cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043d1:	48 ba 20 7a ff ff ff 	movabs $0xffffffffffff7a20,%rdx
+  8043d8:	ff ff ff 
+  8043db:	48 01 da             	add    %rbx,%rdx
+  8043de:	ff d2                	call   *%rdx
+			close(fd_src);
+  8043e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043e3:	89 c7                	mov    %eax,%edi
+  8043e5:	49 89 df             	mov    %rbx,%r15
+  8043e8:	48 b8 c4 a1 ff ff ff 	movabs $0xffffffffffffa1c4,%rax
+  8043ef:	ff ff ff 
+  8043f2:	48 01 d8             	add    %rbx,%rax
+  8043f5:	ff d0                	call   *%rax
+			close(fd_dest);
+  8043f7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8043fa:	89 c7                	mov    %eax,%edi
+  8043fc:	49 89 df             	mov    %rbx,%r15
+  8043ff:	48 b8 c4 a1 ff ff ff 	movabs $0xffffffffffffa1c4,%rax
+  804406:	ff ff ff 
+  804409:	48 01 d8             	add    %rbx,%rax
+  80440c:	ff d0                	call   *%rax
+			return write_size;
+  80440e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804411:	e9 cc 00 00 00       	jmp    8044e2 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804416:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  80441d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804420:	ba 00 02 00 00       	mov    $0x200,%edx
+  804425:	48 89 ce             	mov    %rcx,%rsi
+  804428:	89 c7                	mov    %eax,%edi
+  80442a:	49 89 df             	mov    %rbx,%r15
+  80442d:	48 b8 7c a4 ff ff ff 	movabs $0xffffffffffffa47c,%rax
+  804434:	ff ff ff 
+  804437:	48 01 d8             	add    %rbx,%rax
+  80443a:	ff d0                	call   *%rax
+  80443c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80443f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804443:	0f 8f 3a ff ff ff    	jg     804383 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804449:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80444d:	79 60                	jns    8044af <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  80444f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804452:	89 c6                	mov    %eax,%esi
+  804454:	48 b8 11 db ff ff ff 	movabs $0xffffffffffffdb11,%rax
+  80445b:	ff ff ff 
+  80445e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804462:	48 89 c7             	mov    %rax,%rdi
+  804465:	49 89 df             	mov    %rbx,%r15
+  804468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80446d:	48 ba 20 7a ff ff ff 	movabs $0xffffffffffff7a20,%rdx
+  804474:	ff ff ff 
+  804477:	48 01 da             	add    %rbx,%rdx
+  80447a:	ff d2                	call   *%rdx
+		close(fd_src);
+  80447c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80447f:	89 c7                	mov    %eax,%edi
+  804481:	49 89 df             	mov    %rbx,%r15
+  804484:	48 b8 c4 a1 ff ff ff 	movabs $0xffffffffffffa1c4,%rax
+  80448b:	ff ff ff 
+  80448e:	48 01 d8             	add    %rbx,%rax
+  804491:	ff d0                	call   *%rax
+		close(fd_dest);
+  804493:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804496:	89 c7                	mov    %eax,%edi
+  804498:	49 89 df             	mov    %rbx,%r15
+  80449b:	48 b8 c4 a1 ff ff ff 	movabs $0xffffffffffffa1c4,%rax
+  8044a2:	ff ff ff 
+  8044a5:	48 01 d8             	add    %rbx,%rax
+  8044a8:	ff d0                	call   *%rax
+		return read_size;
+  8044aa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8044ad:	eb 33                	jmp    8044e2 <copy+0x264>
+	}
+	close(fd_src);
+  8044af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044b2:	89 c7                	mov    %eax,%edi
+  8044b4:	49 89 df             	mov    %rbx,%r15
+  8044b7:	48 b8 c4 a1 ff ff ff 	movabs $0xffffffffffffa1c4,%rax
+  8044be:	ff ff ff 
+  8044c1:	48 01 d8             	add    %rbx,%rax
+  8044c4:	ff d0                	call   *%rax
+	close(fd_dest);
+  8044c6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8044c9:	89 c7                	mov    %eax,%edi
+  8044cb:	49 89 df             	mov    %rbx,%r15
+  8044ce:	48 b8 c4 a1 ff ff ff 	movabs $0xffffffffffffa1c4,%rax
+  8044d5:	ff ff ff 
+  8044d8:	48 01 d8             	add    %rbx,%rax
+  8044db:	ff d0                	call   *%rax
+	return 0;
+  8044dd:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  8044e2:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  8044e9:	5b                   	pop    %rbx
+  8044ea:	41 5f                	pop    %r15
+  8044ec:	5d                   	pop    %rbp
+  8044ed:	c3                   	ret
+
+00000000008044ee <writebuf>:
+};
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  8044ee:	55                   	push   %rbp
+  8044ef:	48 89 e5             	mov    %rsp,%rbp
+  8044f2:	41 57                	push   %r15
+  8044f4:	48 83 ec 28          	sub    $0x28,%rsp
+  8044f8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8044f8 <writebuf+0xa>
+  8044ff:	49 bb 38 4b 00 00 00 	movabs $0x4b38,%r11
+  804506:	00 00 00 
+  804509:	4c 01 d8             	add    %r11,%rax
+  80450c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	if (b->error > 0) {
+  804510:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804514:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804517:	85 d2                	test   %edx,%edx
+  804519:	7e 68                	jle    804583 <writebuf+0x95>
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  80451b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80451f:	8b 52 04             	mov    0x4(%rdx),%edx
+  804522:	48 63 d2             	movslq %edx,%rdx
+  804525:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804529:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+  80452d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804531:	8b 09                	mov    (%rcx),%ecx
+  804533:	89 cf                	mov    %ecx,%edi
+  804535:	49 89 c7             	mov    %rax,%r15
+  804538:	48 b9 22 a6 ff ff ff 	movabs $0xffffffffffffa622,%rcx
+  80453f:	ff ff ff 
+  804542:	48 01 c1             	add    %rax,%rcx
+  804545:	ff d1                	call   *%rcx
+  804547:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		if (result > 0)
+  80454a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80454e:	7e 13                	jle    804563 <writebuf+0x75>
+			b->result += result;
+  804550:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804554:	8b 50 08             	mov    0x8(%rax),%edx
+  804557:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80455a:	01 c2                	add    %eax,%edx
+  80455c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804560:	89 50 08             	mov    %edx,0x8(%rax)
+		if (result != b->idx) // error, or wrote less than supplied
+  804563:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804567:	8b 40 04             	mov    0x4(%rax),%eax
+  80456a:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80456d:	74 14                	je     804583 <writebuf+0x95>
+			b->error = (result < 0 ? result : 0);
+  80456f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804572:	ba 00 00 00 00       	mov    $0x0,%edx
+  804577:	85 c0                	test   %eax,%eax
+  804579:	0f 4e d0             	cmovle %eax,%edx
+  80457c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804580:	89 50 0c             	mov    %edx,0xc(%rax)
+	}
+}
+  804583:	90                   	nop
+  804584:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804588:	c9                   	leave
+  804589:	c3                   	ret
+
+000000000080458a <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80458a:	55                   	push   %rbp
+  80458b:	48 89 e5             	mov    %rsp,%rbp
+  80458e:	48 83 ec 20          	sub    $0x20,%rsp
+  804592:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804592 <putch+0x8>
+  804599:	49 bb 9e 4a 00 00 00 	movabs $0x4a9e,%r11
+  8045a0:	00 00 00 
+  8045a3:	4c 01 d8             	add    %r11,%rax
+  8045a6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8045a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct printbuf *b = (struct printbuf *) thunk;
+  8045ad:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8045b1:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	b->buf[b->idx++] = ch;
+  8045b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045b9:	8b 52 04             	mov    0x4(%rdx),%edx
+  8045bc:	8d 72 01             	lea    0x1(%rdx),%esi
+  8045bf:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8045c3:	89 71 04             	mov    %esi,0x4(%rcx)
+  8045c6:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8045c9:	89 ce                	mov    %ecx,%esi
+  8045cb:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8045cf:	48 63 d2             	movslq %edx,%rdx
+  8045d2:	40 88 74 11 10       	mov    %sil,0x10(%rcx,%rdx,1)
+	if (b->idx == 256) {
+  8045d7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045db:	8b 52 04             	mov    0x4(%rdx),%edx
+  8045de:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8045e4:	75 22                	jne    804608 <putch+0x7e>
+		writebuf(b);
+  8045e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045ea:	48 89 d7             	mov    %rdx,%rdi
+  8045ed:	48 ba be b4 ff ff ff 	movabs $0xffffffffffffb4be,%rdx
+  8045f4:	ff ff ff 
+  8045f7:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8045fb:	ff d0                	call   *%rax
+		b->idx = 0;
+  8045fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804601:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+	}
+}
+  804608:	90                   	nop
+  804609:	c9                   	leave
+  80460a:	c3                   	ret
+
+000000000080460b <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  80460b:	55                   	push   %rbp
+  80460c:	48 89 e5             	mov    %rsp,%rbp
+  80460f:	41 57                	push   %r15
+  804611:	53                   	push   %rbx
+  804612:	48 81 ec 30 01 00 00 	sub    $0x130,%rsp
+  804619:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804619 <vfprintf+0xe>
+  804620:	49 bb 17 4a 00 00 00 	movabs $0x4a17,%r11
+  804627:	00 00 00 
+  80462a:	4c 01 db             	add    %r11,%rbx
+  80462d:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  804633:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  80463a:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+	struct printbuf b;
+
+	b.fd = fd;
+  804641:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  804647:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+	b.idx = 0;
+  80464d:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  804654:	00 00 00 
+	b.result = 0;
+  804657:	c7 85 e8 fe ff ff 00 	movl   $0x0,-0x118(%rbp)
+  80465e:	00 00 00 
+	b.error = 1;
+  804661:	c7 85 ec fe ff ff 01 	movl   $0x1,-0x114(%rbp)
+  804668:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  80466b:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  804672:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  804679:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  804680:	48 89 c6             	mov    %rax,%rsi
+  804683:	48 b8 5a b5 ff ff ff 	movabs $0xffffffffffffb55a,%rax
+  80468a:	ff ff ff 
+  80468d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804691:	48 89 c7             	mov    %rax,%rdi
+  804694:	49 89 df             	mov    %rbx,%r15
+  804697:	48 b8 64 7e ff ff ff 	movabs $0xffffffffffff7e64,%rax
+  80469e:	ff ff ff 
+  8046a1:	48 01 d8             	add    %rbx,%rax
+  8046a4:	ff d0                	call   *%rax
+	if (b.idx > 0)
+  8046a6:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  8046ac:	85 c0                	test   %eax,%eax
+  8046ae:	7e 1a                	jle    8046ca <vfprintf+0xbf>
+		writebuf(&b);
+  8046b0:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8046b7:	48 89 c7             	mov    %rax,%rdi
+  8046ba:	48 b8 be b4 ff ff ff 	movabs $0xffffffffffffb4be,%rax
+  8046c1:	ff ff ff 
+  8046c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046c8:	ff d0                	call   *%rax
+
+	return (b.result ? b.result : b.error);
+  8046ca:	8b 85 e8 fe ff ff    	mov    -0x118(%rbp),%eax
+  8046d0:	85 c0                	test   %eax,%eax
+  8046d2:	74 08                	je     8046dc <vfprintf+0xd1>
+  8046d4:	8b 85 e8 fe ff ff    	mov    -0x118(%rbp),%eax
+  8046da:	eb 06                	jmp    8046e2 <vfprintf+0xd7>
+  8046dc:	8b 85 ec fe ff ff    	mov    -0x114(%rbp),%eax
+}
+  8046e2:	48 81 c4 30 01 00 00 	add    $0x130,%rsp
+  8046e9:	5b                   	pop    %rbx
+  8046ea:	41 5f                	pop    %r15
+  8046ec:	5d                   	pop    %rbp
+  8046ed:	c3                   	ret
+
+00000000008046ee <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8046ee:	55                   	push   %rbp
+  8046ef:	48 89 e5             	mov    %rsp,%rbp
+  8046f2:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8046f9:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8046f9 <fprintf+0xb>
+  804700:	49 bb 37 49 00 00 00 	movabs $0x4937,%r11
+  804707:	00 00 00 
+  80470a:	4d 01 da             	add    %r11,%r10
+  80470d:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  804713:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80471a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  804721:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804728:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80472f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804736:	84 c0                	test   %al,%al
+  804738:	74 20                	je     80475a <fprintf+0x6c>
+  80473a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80473e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804742:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804746:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80474a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80474e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804752:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804756:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80475a:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  804761:	00 00 00 
+  804764:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80476b:	00 00 00 
+  80476e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804772:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804779:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804780:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	cnt = vfprintf(fd, fmt, ap);
+  804787:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80478e:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  804795:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  80479b:	48 89 ce             	mov    %rcx,%rsi
+  80479e:	89 c7                	mov    %eax,%edi
+  8047a0:	48 b8 db b5 ff ff ff 	movabs $0xffffffffffffb5db,%rax
+  8047a7:	ff ff ff 
+  8047aa:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8047ae:	ff d0                	call   *%rax
+  8047b0:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(ap);
+
+	return cnt;
+  8047b6:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8047bc:	c9                   	leave
+  8047bd:	c3                   	ret
+
+00000000008047be <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8047be:	55                   	push   %rbp
+  8047bf:	48 89 e5             	mov    %rsp,%rbp
+  8047c2:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8047c9:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8047c9 <printf+0xb>
+  8047d0:	49 bb 67 48 00 00 00 	movabs $0x4867,%r11
+  8047d7:	00 00 00 
+  8047da:	4d 01 da             	add    %r11,%r10
+  8047dd:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8047e4:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8047eb:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8047f2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8047f9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804800:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804807:	84 c0                	test   %al,%al
+  804809:	74 20                	je     80482b <printf+0x6d>
+  80480b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80480f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804813:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804817:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80481b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80481f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804823:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804827:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80482b:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  804832:	00 00 00 
+  804835:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80483c:	00 00 00 
+  80483f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804843:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80484a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804851:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	cnt = vfprintf(1, fmt, ap);
+  804858:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80485f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  804866:	48 89 c6             	mov    %rax,%rsi
+  804869:	bf 01 00 00 00       	mov    $0x1,%edi
+  80486e:	48 b8 db b5 ff ff ff 	movabs $0xffffffffffffb5db,%rax
+  804875:	ff ff ff 
+  804878:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80487c:	ff d0                	call   *%rax
+  80487e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(ap);
+
+	return cnt;
+  804884:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80488a:	c9                   	leave
+  80488b:	c3                   	ret
+
+000000000080488c <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  80488c:	55                   	push   %rbp
+  80488d:	48 89 e5             	mov    %rsp,%rbp
+  804890:	41 57                	push   %r15
+  804892:	53                   	push   %rbx
+  804893:	48 83 ec 20          	sub    $0x20,%rsp
+  804897:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804897 <fd2sockid+0xb>
+  80489e:	49 bb 99 47 00 00 00 	movabs $0x4799,%r11
+  8048a5:	00 00 00 
+  8048a8:	4c 01 db             	add    %r11,%rbx
+  8048ab:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8048ae:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8048b2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048b5:	48 89 d6             	mov    %rdx,%rsi
+  8048b8:	89 c7                	mov    %eax,%edi
+  8048ba:	49 89 df             	mov    %rbx,%r15
+  8048bd:	48 b8 35 9f ff ff ff 	movabs $0xffffffffffff9f35,%rax
+  8048c4:	ff ff ff 
+  8048c7:	48 01 d8             	add    %rbx,%rax
+  8048ca:	ff d0                	call   *%rax
+  8048cc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8048cf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8048d3:	79 05                	jns    8048da <fd2sockid+0x4e>
+		return r;
+  8048d5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048d8:	eb 25                	jmp    8048ff <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8048da:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048de:	8b 10                	mov    (%rax),%edx
+  8048e0:	48 b8 b0 00 00 00 00 	movabs $0xb0,%rax
+  8048e7:	00 00 00 
+  8048ea:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8048ed:	39 c2                	cmp    %eax,%edx
+  8048ef:	74 07                	je     8048f8 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  8048f1:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8048f6:	eb 07                	jmp    8048ff <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8048f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048fc:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8048ff:	48 83 c4 20          	add    $0x20,%rsp
+  804903:	5b                   	pop    %rbx
+  804904:	41 5f                	pop    %r15
+  804906:	5d                   	pop    %rbp
+  804907:	c3                   	ret
+
+0000000000804908 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804908:	55                   	push   %rbp
+  804909:	48 89 e5             	mov    %rsp,%rbp
+  80490c:	41 57                	push   %r15
+  80490e:	53                   	push   %rbx
+  80490f:	48 83 ec 20          	sub    $0x20,%rsp
+  804913:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804913 <alloc_sockfd+0xb>
+  80491a:	49 bb 1d 47 00 00 00 	movabs $0x471d,%r11
+  804921:	00 00 00 
+  804924:	4c 01 db             	add    %r11,%rbx
+  804927:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  80492a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80492e:	48 89 c7             	mov    %rax,%rdi
+  804931:	49 89 df             	mov    %rbx,%r15
+  804934:	48 b8 7f 9e ff ff ff 	movabs $0xffffffffffff9e7f,%rax
+  80493b:	ff ff ff 
+  80493e:	48 01 d8             	add    %rbx,%rax
+  804941:	ff d0                	call   *%rax
+  804943:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804946:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80494a:	78 2c                	js     804978 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80494c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804950:	ba 07 04 00 00       	mov    $0x407,%edx
+  804955:	48 89 c6             	mov    %rax,%rsi
+  804958:	bf 00 00 00 00       	mov    $0x0,%edi
+  80495d:	49 89 df             	mov    %rbx,%r15
+  804960:	48 b8 5c 96 ff ff ff 	movabs $0xffffffffffff965c,%rax
+  804967:	ff ff ff 
+  80496a:	48 01 d8             	add    %rbx,%rax
+  80496d:	ff d0                	call   *%rax
+  80496f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804972:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804976:	79 1c                	jns    804994 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804978:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80497b:	89 c7                	mov    %eax,%edi
+  80497d:	49 89 df             	mov    %rbx,%r15
+  804980:	48 b8 cc c0 ff ff ff 	movabs $0xffffffffffffc0cc,%rax
+  804987:	ff ff ff 
+  80498a:	48 01 d8             	add    %rbx,%rax
+  80498d:	ff d0                	call   *%rax
+		return r;
+  80498f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804992:	eb 41                	jmp    8049d5 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804994:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804998:	48 ba b0 00 00 00 00 	movabs $0xb0,%rdx
+  80499f:	00 00 00 
+  8049a2:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8049a5:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  8049a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049ab:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  8049b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049b6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8049b9:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  8049bc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049c0:	48 89 c7             	mov    %rax,%rdi
+  8049c3:	49 89 df             	mov    %rbx,%r15
+  8049c6:	48 b8 05 9e ff ff ff 	movabs $0xffffffffffff9e05,%rax
+  8049cd:	ff ff ff 
+  8049d0:	48 01 d8             	add    %rbx,%rax
+  8049d3:	ff d0                	call   *%rax
+}
+  8049d5:	48 83 c4 20          	add    $0x20,%rsp
+  8049d9:	5b                   	pop    %rbx
+  8049da:	41 5f                	pop    %r15
+  8049dc:	5d                   	pop    %rbp
+  8049dd:	c3                   	ret
+
+00000000008049de <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8049de:	55                   	push   %rbp
+  8049df:	48 89 e5             	mov    %rsp,%rbp
+  8049e2:	41 57                	push   %r15
+  8049e4:	53                   	push   %rbx
+  8049e5:	48 83 ec 30          	sub    $0x30,%rsp
+  8049e9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049e9 <accept+0xb>
+  8049f0:	49 bb 47 46 00 00 00 	movabs $0x4647,%r11
+  8049f7:	00 00 00 
+  8049fa:	4c 01 db             	add    %r11,%rbx
+  8049fd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804a00:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804a04:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804a08:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804a0b:	89 c7                	mov    %eax,%edi
+  804a0d:	48 b8 5c b8 ff ff ff 	movabs $0xffffffffffffb85c,%rax
+  804a14:	ff ff ff 
+  804a17:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a1b:	ff d0                	call   *%rax
+  804a1d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a20:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a24:	79 05                	jns    804a2b <accept+0x4d>
+		return r;
+  804a26:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a29:	eb 45                	jmp    804a70 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804a2b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a2f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804a33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a36:	48 89 ce             	mov    %rcx,%rsi
+  804a39:	89 c7                	mov    %eax,%edi
+  804a3b:	49 89 df             	mov    %rbx,%r15
+  804a3e:	48 b8 3a bf ff ff ff 	movabs $0xffffffffffffbf3a,%rax
+  804a45:	ff ff ff 
+  804a48:	48 01 d8             	add    %rbx,%rax
+  804a4b:	ff d0                	call   *%rax
+  804a4d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a50:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a54:	79 05                	jns    804a5b <accept+0x7d>
+		return r;
+  804a56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a59:	eb 15                	jmp    804a70 <accept+0x92>
+	return alloc_sockfd(r);
+  804a5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a5e:	89 c7                	mov    %eax,%edi
+  804a60:	48 b8 d8 b8 ff ff ff 	movabs $0xffffffffffffb8d8,%rax
+  804a67:	ff ff ff 
+  804a6a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a6e:	ff d0                	call   *%rax
+}
+  804a70:	48 83 c4 30          	add    $0x30,%rsp
+  804a74:	5b                   	pop    %rbx
+  804a75:	41 5f                	pop    %r15
+  804a77:	5d                   	pop    %rbp
+  804a78:	c3                   	ret
+
+0000000000804a79 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804a79:	55                   	push   %rbp
+  804a7a:	48 89 e5             	mov    %rsp,%rbp
+  804a7d:	41 57                	push   %r15
+  804a7f:	53                   	push   %rbx
+  804a80:	48 83 ec 20          	sub    $0x20,%rsp
+  804a84:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a84 <bind+0xb>
+  804a8b:	49 bb ac 45 00 00 00 	movabs $0x45ac,%r11
+  804a92:	00 00 00 
+  804a95:	4c 01 db             	add    %r11,%rbx
+  804a98:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804a9b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804a9f:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804aa2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804aa5:	89 c7                	mov    %eax,%edi
+  804aa7:	48 b8 5c b8 ff ff ff 	movabs $0xffffffffffffb85c,%rax
+  804aae:	ff ff ff 
+  804ab1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ab5:	ff d0                	call   *%rax
+  804ab7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804aba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804abe:	79 05                	jns    804ac5 <bind+0x4c>
+		return r;
+  804ac0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ac3:	eb 21                	jmp    804ae6 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804ac5:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804ac8:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804acc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804acf:	48 89 ce             	mov    %rcx,%rsi
+  804ad2:	89 c7                	mov    %eax,%edi
+  804ad4:	49 89 df             	mov    %rbx,%r15
+  804ad7:	48 b8 e6 bf ff ff ff 	movabs $0xffffffffffffbfe6,%rax
+  804ade:	ff ff ff 
+  804ae1:	48 01 d8             	add    %rbx,%rax
+  804ae4:	ff d0                	call   *%rax
+}
+  804ae6:	48 83 c4 20          	add    $0x20,%rsp
+  804aea:	5b                   	pop    %rbx
+  804aeb:	41 5f                	pop    %r15
+  804aed:	5d                   	pop    %rbp
+  804aee:	c3                   	ret
+
+0000000000804aef <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804aef:	55                   	push   %rbp
+  804af0:	48 89 e5             	mov    %rsp,%rbp
+  804af3:	41 57                	push   %r15
+  804af5:	53                   	push   %rbx
+  804af6:	48 83 ec 20          	sub    $0x20,%rsp
+  804afa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804afa <shutdown+0xb>
+  804b01:	49 bb 36 45 00 00 00 	movabs $0x4536,%r11
+  804b08:	00 00 00 
+  804b0b:	4c 01 db             	add    %r11,%rbx
+  804b0e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804b11:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804b14:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b17:	89 c7                	mov    %eax,%edi
+  804b19:	48 b8 5c b8 ff ff ff 	movabs $0xffffffffffffb85c,%rax
+  804b20:	ff ff ff 
+  804b23:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b27:	ff d0                	call   *%rax
+  804b29:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b2c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b30:	79 05                	jns    804b37 <shutdown+0x48>
+		return r;
+  804b32:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b35:	eb 1c                	jmp    804b53 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804b37:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804b3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b3d:	89 d6                	mov    %edx,%esi
+  804b3f:	89 c7                	mov    %eax,%edi
+  804b41:	49 89 df             	mov    %rbx,%r15
+  804b44:	48 b8 7b c0 ff ff ff 	movabs $0xffffffffffffc07b,%rax
+  804b4b:	ff ff ff 
+  804b4e:	48 01 d8             	add    %rbx,%rax
+  804b51:	ff d0                	call   *%rax
+}
+  804b53:	48 83 c4 20          	add    $0x20,%rsp
+  804b57:	5b                   	pop    %rbx
+  804b58:	41 5f                	pop    %r15
+  804b5a:	5d                   	pop    %rbp
+  804b5b:	c3                   	ret
+
+0000000000804b5c <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804b5c:	55                   	push   %rbp
+  804b5d:	48 89 e5             	mov    %rsp,%rbp
+  804b60:	41 57                	push   %r15
+  804b62:	53                   	push   %rbx
+  804b63:	48 83 ec 10          	sub    $0x10,%rsp
+  804b67:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b67 <devsock_close+0xb>
+  804b6e:	49 bb c9 44 00 00 00 	movabs $0x44c9,%r11
+  804b75:	00 00 00 
+  804b78:	4c 01 db             	add    %r11,%rbx
+  804b7b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804b7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b83:	48 89 c7             	mov    %rax,%rdi
+  804b86:	49 89 df             	mov    %rbx,%r15
+  804b89:	48 b8 9d d4 ff ff ff 	movabs $0xffffffffffffd49d,%rax
+  804b90:	ff ff ff 
+  804b93:	48 01 d8             	add    %rbx,%rax
+  804b96:	ff d0                	call   *%rax
+  804b98:	83 f8 01             	cmp    $0x1,%eax
+  804b9b:	75 1d                	jne    804bba <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804b9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ba1:	8b 40 0c             	mov    0xc(%rax),%eax
+  804ba4:	89 c7                	mov    %eax,%edi
+  804ba6:	49 89 df             	mov    %rbx,%r15
+  804ba9:	48 b8 cc c0 ff ff ff 	movabs $0xffffffffffffc0cc,%rax
+  804bb0:	ff ff ff 
+  804bb3:	48 01 d8             	add    %rbx,%rax
+  804bb6:	ff d0                	call   *%rax
+  804bb8:	eb 05                	jmp    804bbf <devsock_close+0x63>
+	else
+		return 0;
+  804bba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804bbf:	48 83 c4 10          	add    $0x10,%rsp
+  804bc3:	5b                   	pop    %rbx
+  804bc4:	41 5f                	pop    %r15
+  804bc6:	5d                   	pop    %rbp
+  804bc7:	c3                   	ret
+
+0000000000804bc8 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804bc8:	55                   	push   %rbp
+  804bc9:	48 89 e5             	mov    %rsp,%rbp
+  804bcc:	41 57                	push   %r15
+  804bce:	53                   	push   %rbx
+  804bcf:	48 83 ec 20          	sub    $0x20,%rsp
+  804bd3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804bd3 <connect+0xb>
+  804bda:	49 bb 5d 44 00 00 00 	movabs $0x445d,%r11
+  804be1:	00 00 00 
+  804be4:	4c 01 db             	add    %r11,%rbx
+  804be7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804bea:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804bee:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804bf1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804bf4:	89 c7                	mov    %eax,%edi
+  804bf6:	48 b8 5c b8 ff ff ff 	movabs $0xffffffffffffb85c,%rax
+  804bfd:	ff ff ff 
+  804c00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c04:	ff d0                	call   *%rax
+  804c06:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c09:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c0d:	79 05                	jns    804c14 <connect+0x4c>
+		return r;
+  804c0f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c12:	eb 21                	jmp    804c35 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  804c14:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804c17:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804c1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c1e:	48 89 ce             	mov    %rcx,%rsi
+  804c21:	89 c7                	mov    %eax,%edi
+  804c23:	49 89 df             	mov    %rbx,%r15
+  804c26:	48 b8 14 c1 ff ff ff 	movabs $0xffffffffffffc114,%rax
+  804c2d:	ff ff ff 
+  804c30:	48 01 d8             	add    %rbx,%rax
+  804c33:	ff d0                	call   *%rax
+}
+  804c35:	48 83 c4 20          	add    $0x20,%rsp
+  804c39:	5b                   	pop    %rbx
+  804c3a:	41 5f                	pop    %r15
+  804c3c:	5d                   	pop    %rbp
+  804c3d:	c3                   	ret
+
+0000000000804c3e <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804c3e:	55                   	push   %rbp
+  804c3f:	48 89 e5             	mov    %rsp,%rbp
+  804c42:	41 57                	push   %r15
+  804c44:	53                   	push   %rbx
+  804c45:	48 83 ec 20          	sub    $0x20,%rsp
+  804c49:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c49 <listen+0xb>
+  804c50:	49 bb e7 43 00 00 00 	movabs $0x43e7,%r11
+  804c57:	00 00 00 
+  804c5a:	4c 01 db             	add    %r11,%rbx
+  804c5d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804c60:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804c63:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c66:	89 c7                	mov    %eax,%edi
+  804c68:	48 b8 5c b8 ff ff ff 	movabs $0xffffffffffffb85c,%rax
+  804c6f:	ff ff ff 
+  804c72:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c76:	ff d0                	call   *%rax
+  804c78:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c7b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c7f:	79 05                	jns    804c86 <listen+0x48>
+		return r;
+  804c81:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c84:	eb 1c                	jmp    804ca2 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804c86:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804c89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c8c:	89 d6                	mov    %edx,%esi
+  804c8e:	89 c7                	mov    %eax,%edi
+  804c90:	49 89 df             	mov    %rbx,%r15
+  804c93:	48 b8 a9 c1 ff ff ff 	movabs $0xffffffffffffc1a9,%rax
+  804c9a:	ff ff ff 
+  804c9d:	48 01 d8             	add    %rbx,%rax
+  804ca0:	ff d0                	call   *%rax
+}
+  804ca2:	48 83 c4 20          	add    $0x20,%rsp
+  804ca6:	5b                   	pop    %rbx
+  804ca7:	41 5f                	pop    %r15
+  804ca9:	5d                   	pop    %rbp
+  804caa:	c3                   	ret
+
+0000000000804cab <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804cab:	55                   	push   %rbp
+  804cac:	48 89 e5             	mov    %rsp,%rbp
+  804caf:	41 57                	push   %r15
+  804cb1:	48 83 ec 28          	sub    $0x28,%rsp
+  804cb5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804cb5 <devsock_read+0xa>
+  804cbc:	49 bb 7b 43 00 00 00 	movabs $0x437b,%r11
+  804cc3:	00 00 00 
+  804cc6:	4c 01 d8             	add    %r11,%rax
+  804cc9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804ccd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804cd1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  804cd5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804cd9:	41 89 d0             	mov    %edx,%r8d
+  804cdc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ce0:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804ce3:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804ce7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804cec:	44 89 c2             	mov    %r8d,%edx
+  804cef:	49 89 c7             	mov    %rax,%r15
+  804cf2:	49 b8 fa c1 ff ff ff 	movabs $0xffffffffffffc1fa,%r8
+  804cf9:	ff ff ff 
+  804cfc:	49 01 c0             	add    %rax,%r8
+  804cff:	41 ff d0             	call   *%r8
+}
+  804d02:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804d06:	c9                   	leave
+  804d07:	c3                   	ret
+
+0000000000804d08 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804d08:	55                   	push   %rbp
+  804d09:	48 89 e5             	mov    %rsp,%rbp
+  804d0c:	41 57                	push   %r15
+  804d0e:	48 83 ec 28          	sub    $0x28,%rsp
+  804d12:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d12 <devsock_write+0xa>
+  804d19:	49 bb 1e 43 00 00 00 	movabs $0x431e,%r11
+  804d20:	00 00 00 
+  804d23:	4c 01 d8             	add    %r11,%rax
+  804d26:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d2a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804d2e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  804d32:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804d36:	41 89 d0             	mov    %edx,%r8d
+  804d39:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d3d:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804d40:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804d44:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804d49:	44 89 c2             	mov    %r8d,%edx
+  804d4c:	49 89 c7             	mov    %rax,%r15
+  804d4f:	49 b8 17 c3 ff ff ff 	movabs $0xffffffffffffc317,%r8
+  804d56:	ff ff ff 
+  804d59:	49 01 c0             	add    %rax,%r8
+  804d5c:	41 ff d0             	call   *%r8
+}
+  804d5f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804d63:	c9                   	leave
+  804d64:	c3                   	ret
+
+0000000000804d65 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  804d65:	55                   	push   %rbp
+  804d66:	48 89 e5             	mov    %rsp,%rbp
+  804d69:	41 57                	push   %r15
+  804d6b:	48 83 ec 18          	sub    $0x18,%rsp
+  804d6f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d6f <devsock_stat+0xa>
+  804d76:	49 bb c1 42 00 00 00 	movabs $0x42c1,%r11
+  804d7d:	00 00 00 
+  804d80:	4c 01 d8             	add    %r11,%rax
+  804d83:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d87:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804d8b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804d8f:	48 b9 2c db ff ff ff 	movabs $0xffffffffffffdb2c,%rcx
+  804d96:	ff ff ff 
+  804d99:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804d9d:	48 89 ce             	mov    %rcx,%rsi
+  804da0:	48 89 d7             	mov    %rdx,%rdi
+  804da3:	49 89 c7             	mov    %rax,%r15
+  804da6:	48 ba a0 89 ff ff ff 	movabs $0xffffffffffff89a0,%rdx
+  804dad:	ff ff ff 
+  804db0:	48 01 c2             	add    %rax,%rdx
+  804db3:	ff d2                	call   *%rdx
+	return 0;
+  804db5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804dba:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804dbe:	c9                   	leave
+  804dbf:	c3                   	ret
+
+0000000000804dc0 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804dc0:	55                   	push   %rbp
+  804dc1:	48 89 e5             	mov    %rsp,%rbp
+  804dc4:	41 57                	push   %r15
+  804dc6:	53                   	push   %rbx
+  804dc7:	48 83 ec 20          	sub    $0x20,%rsp
+  804dcb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804dcb <socket+0xb>
+  804dd2:	49 bb 65 42 00 00 00 	movabs $0x4265,%r11
+  804dd9:	00 00 00 
+  804ddc:	4c 01 db             	add    %r11,%rbx
+  804ddf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804de2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  804de5:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  804de8:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804deb:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804dee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804df1:	89 ce                	mov    %ecx,%esi
+  804df3:	89 c7                	mov    %eax,%edi
+  804df5:	49 89 df             	mov    %rbx,%r15
+  804df8:	48 b8 ee c4 ff ff ff 	movabs $0xffffffffffffc4ee,%rax
+  804dff:	ff ff ff 
+  804e02:	48 01 d8             	add    %rbx,%rax
+  804e05:	ff d0                	call   *%rax
+  804e07:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e0a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e0e:	79 05                	jns    804e15 <socket+0x55>
+		return r;
+  804e10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e13:	eb 15                	jmp    804e2a <socket+0x6a>
+	return alloc_sockfd(r);
+  804e15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e18:	89 c7                	mov    %eax,%edi
+  804e1a:	48 b8 d8 b8 ff ff ff 	movabs $0xffffffffffffb8d8,%rax
+  804e21:	ff ff ff 
+  804e24:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e28:	ff d0                	call   *%rax
+}
+  804e2a:	48 83 c4 20          	add    $0x20,%rsp
+  804e2e:	5b                   	pop    %rbx
+  804e2f:	41 5f                	pop    %r15
+  804e31:	5d                   	pop    %rbp
+  804e32:	c3                   	ret
+
+0000000000804e33 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  804e33:	55                   	push   %rbp
+  804e34:	48 89 e5             	mov    %rsp,%rbp
+  804e37:	41 57                	push   %r15
+  804e39:	53                   	push   %rbx
+  804e3a:	48 83 ec 10          	sub    $0x10,%rsp
+  804e3e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e3e <nsipc+0xb>
+  804e45:	49 bb f2 41 00 00 00 	movabs $0x41f2,%r11
+  804e4c:	00 00 00 
+  804e4f:	4c 01 db             	add    %r11,%rbx
+  804e52:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  804e55:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804e5c:	00 00 00 
+  804e5f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804e62:	85 c0                	test   %eax,%eax
+  804e64:	75 24                	jne    804e8a <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804e66:	bf 02 00 00 00       	mov    $0x2,%edi
+  804e6b:	49 89 df             	mov    %rbx,%r15
+  804e6e:	48 b8 0e d4 ff ff ff 	movabs $0xffffffffffffd40e,%rax
+  804e75:	ff ff ff 
+  804e78:	48 01 d8             	add    %rbx,%rax
+  804e7b:	ff d0                	call   *%rax
+  804e7d:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804e84:	00 00 00 
+  804e87:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  804e8a:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804e91:	00 00 00 
+  804e94:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804e97:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804e9a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804ea0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804ea6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804eab:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804eb2:	00 00 00 
+  804eb5:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804eb9:	89 c7                	mov    %eax,%edi
+  804ebb:	49 89 df             	mov    %rbx,%r15
+  804ebe:	48 b8 2d ce ff ff ff 	movabs $0xffffffffffffce2d,%rax
+  804ec5:	ff ff ff 
+  804ec8:	48 01 d8             	add    %rbx,%rax
+  804ecb:	ff d0                	call   *%rax
+}
+  804ecd:	48 83 c4 10          	add    $0x10,%rsp
+  804ed1:	5b                   	pop    %rbx
+  804ed2:	41 5f                	pop    %r15
+  804ed4:	5d                   	pop    %rbp
+  804ed5:	c3                   	ret
+
+0000000000804ed6 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  804ed6:	55                   	push   %rbp
+  804ed7:	48 89 e5             	mov    %rsp,%rbp
+  804eda:	41 57                	push   %r15
+  804edc:	53                   	push   %rbx
+  804edd:	48 83 ec 20          	sub    $0x20,%rsp
+  804ee1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ee1 <nsipc_words+0xb>
+  804ee8:	49 bb 4f 41 00 00 00 	movabs $0x414f,%r11
+  804eef:	00 00 00 
+  804ef2:	4c 01 db             	add    %r11,%rbx
+  804ef5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804ef8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804efc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  804f00:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804f07:	00 00 00 
+  804f0a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804f0d:	85 c0                	test   %eax,%eax
+  804f0f:	75 24                	jne    804f35 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804f11:	bf 02 00 00 00       	mov    $0x2,%edi
+  804f16:	49 89 df             	mov    %rbx,%r15
+  804f19:	48 b8 0e d4 ff ff ff 	movabs $0xffffffffffffd40e,%rax
+  804f20:	ff ff ff 
+  804f23:	48 01 d8             	add    %rbx,%rax
+  804f26:	ff d0                	call   *%rax
+  804f28:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804f2f:	00 00 00 
+  804f32:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  804f35:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804f3c:	00 00 00 
+  804f3f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804f42:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804f46:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f4a:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804f4d:	89 c7                	mov    %eax,%edi
+  804f4f:	49 89 df             	mov    %rbx,%r15
+  804f52:	48 b8 18 cf ff ff ff 	movabs $0xffffffffffffcf18,%rax
+  804f59:	ff ff ff 
+  804f5c:	48 01 d8             	add    %rbx,%rax
+  804f5f:	ff d0                	call   *%rax
+}
+  804f61:	48 83 c4 20          	add    $0x20,%rsp
+  804f65:	5b                   	pop    %rbx
+  804f66:	41 5f                	pop    %r15
+  804f68:	5d                   	pop    %rbp
+  804f69:	c3                   	ret
+
+0000000000804f6a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804f6a:	55                   	push   %rbp
+  804f6b:	48 89 e5             	mov    %rsp,%rbp
+  804f6e:	41 57                	push   %r15
+  804f70:	53                   	push   %rbx
+  804f71:	48 83 ec 30          	sub    $0x30,%rsp
+  804f75:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f75 <nsipc_accept+0xb>
+  804f7c:	49 bb bb 40 00 00 00 	movabs $0x40bb,%r11
+  804f83:	00 00 00 
+  804f86:	4c 01 db             	add    %r11,%rbx
+  804f89:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804f8c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804f90:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  804f94:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804f9b:	00 00 00 
+  804f9e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fa1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  804fa4:	bf 01 00 00 00       	mov    $0x1,%edi
+  804fa9:	48 b8 03 be ff ff ff 	movabs $0xffffffffffffbe03,%rax
+  804fb0:	ff ff ff 
+  804fb3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fb7:	ff d0                	call   *%rax
+  804fb9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804fbc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804fc0:	78 48                	js     80500a <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  804fc2:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  804fc9:	00 00 00 
+  804fcc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fd0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  804fd4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fd8:	8b 40 10             	mov    0x10(%rax),%eax
+  804fdb:	89 c2                	mov    %eax,%edx
+  804fdd:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804fe1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fe5:	48 89 ce             	mov    %rcx,%rsi
+  804fe8:	48 89 c7             	mov    %rax,%rdi
+  804feb:	49 89 df             	mov    %rbx,%r15
+  804fee:	48 b8 80 8d ff ff ff 	movabs $0xffffffffffff8d80,%rax
+  804ff5:	ff ff ff 
+  804ff8:	48 01 d8             	add    %rbx,%rax
+  804ffb:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  804ffd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805001:	8b 50 10             	mov    0x10(%rax),%edx
+  805004:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805008:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  80500a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80500d:	48 83 c4 30          	add    $0x30,%rsp
+  805011:	5b                   	pop    %rbx
+  805012:	41 5f                	pop    %r15
+  805014:	5d                   	pop    %rbp
+  805015:	c3                   	ret
+
+0000000000805016 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805016:	55                   	push   %rbp
+  805017:	48 89 e5             	mov    %rsp,%rbp
+  80501a:	41 57                	push   %r15
+  80501c:	53                   	push   %rbx
+  80501d:	48 83 ec 10          	sub    $0x10,%rsp
+  805021:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805021 <nsipc_bind+0xb>
+  805028:	49 bb 0f 40 00 00 00 	movabs $0x400f,%r11
+  80502f:	00 00 00 
+  805032:	4c 01 db             	add    %r11,%rbx
+  805035:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805038:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80503c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  80503f:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  805046:	00 00 00 
+  805049:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80504c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80504f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805052:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805056:	48 89 c6             	mov    %rax,%rsi
+  805059:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  805060:	00 00 00 
+  805063:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805067:	48 89 c7             	mov    %rax,%rdi
+  80506a:	49 89 df             	mov    %rbx,%r15
+  80506d:	48 b8 80 8d ff ff ff 	movabs $0xffffffffffff8d80,%rax
+  805074:	ff ff ff 
+  805077:	48 01 d8             	add    %rbx,%rax
+  80507a:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  80507c:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  805083:	00 00 00 
+  805086:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805089:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  80508d:	bf 02 00 00 00       	mov    $0x2,%edi
+  805092:	48 b8 03 be ff ff ff 	movabs $0xffffffffffffbe03,%rax
+  805099:	ff ff ff 
+  80509c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050a0:	ff d0                	call   *%rax
+}
+  8050a2:	48 83 c4 10          	add    $0x10,%rsp
+  8050a6:	5b                   	pop    %rbx
+  8050a7:	41 5f                	pop    %r15
+  8050a9:	5d                   	pop    %rbp
+  8050aa:	c3                   	ret
+
+00000000008050ab <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8050ab:	55                   	push   %rbp
+  8050ac:	48 89 e5             	mov    %rsp,%rbp
+  8050af:	48 83 ec 20          	sub    $0x20,%rsp
+  8050b3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050b3 <nsipc_shutdown+0x8>
+  8050ba:	49 bb 7d 3f 00 00 00 	movabs $0x3f7d,%r11
+  8050c1:	00 00 00 
+  8050c4:	4c 01 d8             	add    %r11,%rax
+  8050c7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8050ca:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8050cd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8050d0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  8050d3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8050d6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  8050d9:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8050dd:	ba 08 00 00 00       	mov    $0x8,%edx
+  8050e2:	48 89 ce             	mov    %rcx,%rsi
+  8050e5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8050ea:	48 b9 a6 be ff ff ff 	movabs $0xffffffffffffbea6,%rcx
+  8050f1:	ff ff ff 
+  8050f4:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8050f8:	ff d0                	call   *%rax
+}
+  8050fa:	c9                   	leave
+  8050fb:	c3                   	ret
+
+00000000008050fc <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8050fc:	55                   	push   %rbp
+  8050fd:	48 89 e5             	mov    %rsp,%rbp
+  805100:	48 83 ec 20          	sub    $0x20,%rsp
+  805104:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805104 <nsipc_close+0x8>
+  80510b:	49 bb 2c 3f 00 00 00 	movabs $0x3f2c,%r11
+  805112:	00 00 00 
+  805115:	4c 01 d8             	add    %r11,%rax
+  805118:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  80511b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80511e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805121:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805125:	ba 04 00 00 00       	mov    $0x4,%edx
+  80512a:	48 89 ce             	mov    %rcx,%rsi
+  80512d:	bf 04 00 00 00       	mov    $0x4,%edi
+  805132:	48 b9 a6 be ff ff ff 	movabs $0xffffffffffffbea6,%rcx
+  805139:	ff ff ff 
+  80513c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805140:	ff d0                	call   *%rax
+}
+  805142:	c9                   	leave
+  805143:	c3                   	ret
+
+0000000000805144 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805144:	55                   	push   %rbp
+  805145:	48 89 e5             	mov    %rsp,%rbp
+  805148:	41 57                	push   %r15
+  80514a:	53                   	push   %rbx
+  80514b:	48 83 ec 10          	sub    $0x10,%rsp
+  80514f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80514f <nsipc_connect+0xb>
+  805156:	49 bb e1 3e 00 00 00 	movabs $0x3ee1,%r11
+  80515d:	00 00 00 
+  805160:	4c 01 db             	add    %r11,%rbx
+  805163:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805166:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80516a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  80516d:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  805174:	00 00 00 
+  805177:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80517a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80517d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805180:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805184:	48 89 c6             	mov    %rax,%rsi
+  805187:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  80518e:	00 00 00 
+  805191:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805195:	48 89 c7             	mov    %rax,%rdi
+  805198:	49 89 df             	mov    %rbx,%r15
+  80519b:	48 b8 80 8d ff ff ff 	movabs $0xffffffffffff8d80,%rax
+  8051a2:	ff ff ff 
+  8051a5:	48 01 d8             	add    %rbx,%rax
+  8051a8:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8051aa:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8051b1:	00 00 00 
+  8051b4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8051b7:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8051bb:	bf 05 00 00 00       	mov    $0x5,%edi
+  8051c0:	48 b8 03 be ff ff ff 	movabs $0xffffffffffffbe03,%rax
+  8051c7:	ff ff ff 
+  8051ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051ce:	ff d0                	call   *%rax
+}
+  8051d0:	48 83 c4 10          	add    $0x10,%rsp
+  8051d4:	5b                   	pop    %rbx
+  8051d5:	41 5f                	pop    %r15
+  8051d7:	5d                   	pop    %rbp
+  8051d8:	c3                   	ret
+
+00000000008051d9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8051d9:	55                   	push   %rbp
+  8051da:	48 89 e5             	mov    %rsp,%rbp
+  8051dd:	48 83 ec 20          	sub    $0x20,%rsp
+  8051e1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8051e1 <nsipc_listen+0x8>
+  8051e8:	49 bb 4f 3e 00 00 00 	movabs $0x3e4f,%r11
+  8051ef:	00 00 00 
+  8051f2:	4c 01 d8             	add    %r11,%rax
+  8051f5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8051f8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  8051fb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8051fe:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805201:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805204:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805207:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80520b:	ba 08 00 00 00       	mov    $0x8,%edx
+  805210:	48 89 ce             	mov    %rcx,%rsi
+  805213:	bf 06 00 00 00       	mov    $0x6,%edi
+  805218:	48 b9 a6 be ff ff ff 	movabs $0xffffffffffffbea6,%rcx
+  80521f:	ff ff ff 
+  805222:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805226:	ff d0                	call   *%rax
+}
+  805228:	c9                   	leave
+  805229:	c3                   	ret
+
+000000000080522a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80522a:	55                   	push   %rbp
+  80522b:	48 89 e5             	mov    %rsp,%rbp
+  80522e:	41 57                	push   %r15
+  805230:	53                   	push   %rbx
+  805231:	48 83 ec 30          	sub    $0x30,%rsp
+  805235:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805235 <nsipc_recv+0xb>
+  80523c:	49 bb fb 3d 00 00 00 	movabs $0x3dfb,%r11
+  805243:	00 00 00 
+  805246:	4c 01 db             	add    %r11,%rbx
+  805249:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80524c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805250:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805253:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805256:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80525d:	00 00 00 
+  805260:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805263:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805266:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80526d:	00 00 00 
+  805270:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805273:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805277:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80527e:	00 00 00 
+  805281:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805284:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805288:	bf 07 00 00 00       	mov    $0x7,%edi
+  80528d:	48 b8 03 be ff ff ff 	movabs $0xffffffffffffbe03,%rax
+  805294:	ff ff ff 
+  805297:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80529b:	ff d0                	call   *%rax
+  80529d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052a0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052a4:	0f 88 91 00 00 00    	js     80533b <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8052aa:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8052b1:	7f 08                	jg     8052bb <nsipc_recv+0x91>
+  8052b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052b6:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8052b9:	7e 50                	jle    80530b <nsipc_recv+0xe1>
+  8052bb:	48 b8 33 db ff ff ff 	movabs $0xffffffffffffdb33,%rax
+  8052c2:	ff ff ff 
+  8052c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052c9:	48 89 c1             	mov    %rax,%rcx
+  8052cc:	48 b8 48 db ff ff ff 	movabs $0xffffffffffffdb48,%rax
+  8052d3:	ff ff ff 
+  8052d6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052da:	48 89 c2             	mov    %rax,%rdx
+  8052dd:	be 79 00 00 00       	mov    $0x79,%esi
+  8052e2:	48 b8 5d db ff ff ff 	movabs $0xffffffffffffdb5d,%rax
+  8052e9:	ff ff ff 
+  8052ec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052f0:	48 89 c7             	mov    %rax,%rdi
+  8052f3:	49 89 df             	mov    %rbx,%r15
+  8052f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052fb:	49 b8 49 77 ff ff ff 	movabs $0xffffffffffff7749,%r8
+  805302:	ff ff ff 
+  805305:	49 01 d8             	add    %rbx,%r8
+  805308:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80530b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80530e:	48 63 d0             	movslq %eax,%rdx
+  805311:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805315:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  80531c:	00 00 00 
+  80531f:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805323:	48 89 ce             	mov    %rcx,%rsi
+  805326:	48 89 c7             	mov    %rax,%rdi
+  805329:	49 89 df             	mov    %rbx,%r15
+  80532c:	48 b8 80 8d ff ff ff 	movabs $0xffffffffffff8d80,%rax
+  805333:	ff ff ff 
+  805336:	48 01 d8             	add    %rbx,%rax
+  805339:	ff d0                	call   *%rax
+	}
+
+	return r;
+  80533b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80533e:	48 83 c4 30          	add    $0x30,%rsp
+  805342:	5b                   	pop    %rbx
+  805343:	41 5f                	pop    %r15
+  805345:	5d                   	pop    %rbp
+  805346:	c3                   	ret
+
+0000000000805347 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805347:	55                   	push   %rbp
+  805348:	48 89 e5             	mov    %rsp,%rbp
+  80534b:	41 57                	push   %r15
+  80534d:	53                   	push   %rbx
+  80534e:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805355:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805355 <nsipc_send+0xe>
+  80535c:	49 bb db 3c 00 00 00 	movabs $0x3cdb,%r11
+  805363:	00 00 00 
+  805366:	4c 01 db             	add    %r11,%rbx
+  805369:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  80536f:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805376:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  80537c:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805382:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805386:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  80538a:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  805391:	00 00 00 
+  805394:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805397:	85 c0                	test   %eax,%eax
+  805399:	75 24                	jne    8053bf <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80539b:	bf 02 00 00 00       	mov    $0x2,%edi
+  8053a0:	49 89 df             	mov    %rbx,%r15
+  8053a3:	48 b8 0e d4 ff ff ff 	movabs $0xffffffffffffd40e,%rax
+  8053aa:	ff ff ff 
+  8053ad:	48 01 d8             	add    %rbx,%rax
+  8053b0:	ff d0                	call   *%rax
+  8053b2:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  8053b9:	00 00 00 
+  8053bc:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8053bf:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8053c5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8053c8:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  8053cf:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8053d2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8053d5:	39 c2                	cmp    %eax,%edx
+  8053d7:	0f 4e c2             	cmovle %edx,%eax
+  8053da:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  8053e0:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8053e6:	48 63 d0             	movslq %eax,%rdx
+  8053e9:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8053f0:	48 89 c6             	mov    %rax,%rsi
+  8053f3:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  8053fa:	00 00 00 
+  8053fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805401:	48 89 c7             	mov    %rax,%rdi
+  805404:	49 89 df             	mov    %rbx,%r15
+  805407:	48 b8 80 8d ff ff ff 	movabs $0xffffffffffff8d80,%rax
+  80540e:	ff ff ff 
+  805411:	48 01 d8             	add    %rbx,%rax
+  805414:	ff d0                	call   *%rax
+	req->req_s = s;
+  805416:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80541a:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805420:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805422:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805426:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  80542c:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  80542f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805433:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805439:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  80543c:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  805443:	00 00 00 
+  805446:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80544a:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  80544e:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805455:	00 
+  805456:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80545c:	48 63 d0             	movslq %eax,%rdx
+  80545f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805463:	48 01 d0             	add    %rdx,%rax
+  805466:	48 83 e8 01          	sub    $0x1,%rax
+  80546a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80546e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805472:	ba 00 00 00 00       	mov    $0x0,%edx
+  805477:	48 f7 75 d8          	divq   -0x28(%rbp)
+  80547b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80547f:	48 29 d0             	sub    %rdx,%rax
+  805482:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805488:	85 c0                	test   %eax,%eax
+  80548a:	0f 48 c2             	cmovs  %edx,%eax
+  80548d:	c1 f8 0c             	sar    $0xc,%eax
+  805490:	48 98                	cltq
+  805492:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  805496:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80549a:	48 85 c0             	test   %rax,%rax
+  80549d:	0f 95 c0             	setne  %al
+  8054a0:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8054a3:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8054aa:	00 
+  8054ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8054af:	48 83 c0 0b          	add    $0xb,%rax
+  8054b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8054b7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8054bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054c0:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8054c4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8054c8:	48 29 d0             	sub    %rdx,%rax
+  8054cb:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8054cf:	89 c7                	mov    %eax,%edi
+  8054d1:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8054d8:	00 00 00 
+  8054db:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8054de:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  8054e2:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  8054e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8054ea:	6a 00                	push   $0x0
+  8054ec:	6a 00                	push   $0x0
+  8054ee:	6a 05                	push   $0x5
+  8054f0:	41 89 f1             	mov    %esi,%r9d
+  8054f3:	49 89 c8             	mov    %rcx,%r8
+  8054f6:	89 f9                	mov    %edi,%ecx
+  8054f8:	be 08 00 00 00       	mov    $0x8,%esi
+  8054fd:	89 c7                	mov    %eax,%edi
+  8054ff:	49 89 df             	mov    %rbx,%r15
+  805502:	48 b8 16 d0 ff ff ff 	movabs $0xffffffffffffd016,%rax
+  805509:	ff ff ff 
+  80550c:	48 01 d8             	add    %rbx,%rax
+  80550f:	ff d0                	call   *%rax
+  805511:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805515:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805519:	5b                   	pop    %rbx
+  80551a:	41 5f                	pop    %r15
+  80551c:	5d                   	pop    %rbp
+  80551d:	c3                   	ret
+
+000000000080551e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80551e:	55                   	push   %rbp
+  80551f:	48 89 e5             	mov    %rsp,%rbp
+  805522:	48 83 ec 10          	sub    $0x10,%rsp
+  805526:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805526 <nsipc_socket+0x8>
+  80552d:	49 bb 0a 3b 00 00 00 	movabs $0x3b0a,%r11
+  805534:	00 00 00 
+  805537:	4c 01 d8             	add    %r11,%rax
+  80553a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80553d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805540:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805543:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  80554a:	00 00 00 
+  80554d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805550:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805553:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  80555a:	00 00 00 
+  80555d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805560:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805564:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  80556b:	00 00 00 
+  80556e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805571:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  805575:	bf 09 00 00 00       	mov    $0x9,%edi
+  80557a:	48 ba 03 be ff ff ff 	movabs $0xffffffffffffbe03,%rdx
+  805581:	ff ff ff 
+  805584:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805588:	ff d0                	call   *%rax
+}
+  80558a:	c9                   	leave
+  80558b:	c3                   	ret
+
+000000000080558c <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  80558c:	55                   	push   %rbp
+  80558d:	48 89 e5             	mov    %rsp,%rbp
+  805590:	41 57                	push   %r15
+  805592:	53                   	push   %rbx
+  805593:	48 83 ec 30          	sub    $0x30,%rsp
+  805597:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805597 <pipe+0xb>
+  80559e:	49 bb 99 3a 00 00 00 	movabs $0x3a99,%r11
+  8055a5:	00 00 00 
+  8055a8:	4c 01 db             	add    %r11,%rbx
+  8055ab:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8055af:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8055b3:	48 89 c7             	mov    %rax,%rdi
+  8055b6:	49 89 df             	mov    %rbx,%r15
+  8055b9:	48 b8 7f 9e ff ff ff 	movabs $0xffffffffffff9e7f,%rax
+  8055c0:	ff ff ff 
+  8055c3:	48 01 d8             	add    %rbx,%rax
+  8055c6:	ff d0                	call   *%rax
+  8055c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055cf:	0f 88 12 02 00 00    	js     8057e7 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8055d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8055d9:	ba 07 04 00 00       	mov    $0x407,%edx
+  8055de:	48 89 c6             	mov    %rax,%rsi
+  8055e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055e6:	49 89 df             	mov    %rbx,%r15
+  8055e9:	48 b8 5c 96 ff ff ff 	movabs $0xffffffffffff965c,%rax
+  8055f0:	ff ff ff 
+  8055f3:	48 01 d8             	add    %rbx,%rax
+  8055f6:	ff d0                	call   *%rax
+  8055f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055ff:	0f 88 e2 01 00 00    	js     8057e7 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805605:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805609:	48 89 c7             	mov    %rax,%rdi
+  80560c:	49 89 df             	mov    %rbx,%r15
+  80560f:	48 b8 7f 9e ff ff ff 	movabs $0xffffffffffff9e7f,%rax
+  805616:	ff ff ff 
+  805619:	48 01 d8             	add    %rbx,%rax
+  80561c:	ff d0                	call   *%rax
+  80561e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805621:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805625:	0f 88 9b 01 00 00    	js     8057c6 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80562b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80562f:	ba 07 04 00 00       	mov    $0x407,%edx
+  805634:	48 89 c6             	mov    %rax,%rsi
+  805637:	bf 00 00 00 00       	mov    $0x0,%edi
+  80563c:	49 89 df             	mov    %rbx,%r15
+  80563f:	48 b8 5c 96 ff ff ff 	movabs $0xffffffffffff965c,%rax
+  805646:	ff ff ff 
+  805649:	48 01 d8             	add    %rbx,%rax
+  80564c:	ff d0                	call   *%rax
+  80564e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805651:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805655:	0f 88 6b 01 00 00    	js     8057c6 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  80565b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80565f:	48 89 c7             	mov    %rax,%rdi
+  805662:	49 89 df             	mov    %rbx,%r15
+  805665:	48 b8 3c 9e ff ff ff 	movabs $0xffffffffffff9e3c,%rax
+  80566c:	ff ff ff 
+  80566f:	48 01 d8             	add    %rbx,%rax
+  805672:	ff d0                	call   *%rax
+  805674:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805678:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80567c:	ba 07 04 00 00       	mov    $0x407,%edx
+  805681:	48 89 c6             	mov    %rax,%rsi
+  805684:	bf 00 00 00 00       	mov    $0x0,%edi
+  805689:	49 89 df             	mov    %rbx,%r15
+  80568c:	48 b8 5c 96 ff ff ff 	movabs $0xffffffffffff965c,%rax
+  805693:	ff ff ff 
+  805696:	48 01 d8             	add    %rbx,%rax
+  805699:	ff d0                	call   *%rax
+  80569b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80569e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056a2:	0f 88 fd 00 00 00    	js     8057a5 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8056a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8056ac:	48 89 c7             	mov    %rax,%rdi
+  8056af:	49 89 df             	mov    %rbx,%r15
+  8056b2:	48 b8 3c 9e ff ff ff 	movabs $0xffffffffffff9e3c,%rax
+  8056b9:	ff ff ff 
+  8056bc:	48 01 d8             	add    %rbx,%rax
+  8056bf:	ff d0                	call   *%rax
+  8056c1:	48 89 c2             	mov    %rax,%rdx
+  8056c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056c8:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8056ce:	48 89 d1             	mov    %rdx,%rcx
+  8056d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056d6:	48 89 c6             	mov    %rax,%rsi
+  8056d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056de:	49 89 df             	mov    %rbx,%r15
+  8056e1:	48 b8 c1 96 ff ff ff 	movabs $0xffffffffffff96c1,%rax
+  8056e8:	ff ff ff 
+  8056eb:	48 01 d8             	add    %rbx,%rax
+  8056ee:	ff d0                	call   *%rax
+  8056f0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056f3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056f7:	0f 88 87 00 00 00    	js     805784 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  8056fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805701:	48 ba f0 00 00 00 00 	movabs $0xf0,%rdx
+  805708:	00 00 00 
+  80570b:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80570e:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805710:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805714:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  80571b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80571f:	48 ba f0 00 00 00 00 	movabs $0xf0,%rdx
+  805726:	00 00 00 
+  805729:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80572c:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  80572e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805732:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805739:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80573d:	48 89 c7             	mov    %rax,%rdi
+  805740:	49 89 df             	mov    %rbx,%r15
+  805743:	48 b8 05 9e ff ff ff 	movabs $0xffffffffffff9e05,%rax
+  80574a:	ff ff ff 
+  80574d:	48 01 d8             	add    %rbx,%rax
+  805750:	ff d0                	call   *%rax
+  805752:	89 c2                	mov    %eax,%edx
+  805754:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805758:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  80575a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80575e:	48 89 c7             	mov    %rax,%rdi
+  805761:	49 89 df             	mov    %rbx,%r15
+  805764:	48 b8 05 9e ff ff ff 	movabs $0xffffffffffff9e05,%rax
+  80576b:	ff ff ff 
+  80576e:	48 01 d8             	add    %rbx,%rax
+  805771:	ff d0                	call   *%rax
+  805773:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805777:	48 83 c2 04          	add    $0x4,%rdx
+  80577b:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  80577d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805782:	eb 67                	jmp    8057eb <pipe+0x25f>
+		goto err3;
+  805784:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  805785:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805789:	48 89 c6             	mov    %rax,%rsi
+  80578c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805791:	49 89 df             	mov    %rbx,%r15
+  805794:	48 b8 34 97 ff ff ff 	movabs $0xffffffffffff9734,%rax
+  80579b:	ff ff ff 
+  80579e:	48 01 d8             	add    %rbx,%rax
+  8057a1:	ff d0                	call   *%rax
+  8057a3:	eb 01                	jmp    8057a6 <pipe+0x21a>
+		goto err2;
+  8057a5:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  8057a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057aa:	48 89 c6             	mov    %rax,%rsi
+  8057ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057b2:	49 89 df             	mov    %rbx,%r15
+  8057b5:	48 b8 34 97 ff ff ff 	movabs $0xffffffffffff9734,%rax
+  8057bc:	ff ff ff 
+  8057bf:	48 01 d8             	add    %rbx,%rax
+  8057c2:	ff d0                	call   *%rax
+  8057c4:	eb 01                	jmp    8057c7 <pipe+0x23b>
+		goto err1;
+  8057c6:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  8057c7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057cb:	48 89 c6             	mov    %rax,%rsi
+  8057ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057d3:	49 89 df             	mov    %rbx,%r15
+  8057d6:	48 b8 34 97 ff ff ff 	movabs $0xffffffffffff9734,%rax
+  8057dd:	ff ff ff 
+  8057e0:	48 01 d8             	add    %rbx,%rax
+  8057e3:	ff d0                	call   *%rax
+  8057e5:	eb 01                	jmp    8057e8 <pipe+0x25c>
+		goto err;
+  8057e7:	90                   	nop
+err:
+	return r;
+  8057e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8057eb:	48 83 c4 30          	add    $0x30,%rsp
+  8057ef:	5b                   	pop    %rbx
+  8057f0:	41 5f                	pop    %r15
+  8057f2:	5d                   	pop    %rbp
+  8057f3:	c3                   	ret
+
+00000000008057f4 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8057f4:	55                   	push   %rbp
+  8057f5:	48 89 e5             	mov    %rsp,%rbp
+  8057f8:	41 57                	push   %r15
+  8057fa:	41 54                	push   %r12
+  8057fc:	53                   	push   %rbx
+  8057fd:	48 83 ec 28          	sub    $0x28,%rsp
+  805801:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805801 <_pipeisclosed+0xd>
+  805808:	49 bb 2f 38 00 00 00 	movabs $0x382f,%r11
+  80580f:	00 00 00 
+  805812:	4c 01 db             	add    %r11,%rbx
+  805815:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805819:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80581d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805824:	ff ff ff 
+  805827:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80582b:	48 8b 00             	mov    (%rax),%rax
+  80582e:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805834:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805837:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80583b:	48 89 c7             	mov    %rax,%rdi
+  80583e:	49 89 df             	mov    %rbx,%r15
+  805841:	48 b8 9d d4 ff ff ff 	movabs $0xffffffffffffd49d,%rax
+  805848:	ff ff ff 
+  80584b:	48 01 d8             	add    %rbx,%rax
+  80584e:	ff d0                	call   *%rax
+  805850:	41 89 c4             	mov    %eax,%r12d
+  805853:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805857:	48 89 c7             	mov    %rax,%rdi
+  80585a:	49 89 df             	mov    %rbx,%r15
+  80585d:	48 b8 9d d4 ff ff ff 	movabs $0xffffffffffffd49d,%rax
+  805864:	ff ff ff 
+  805867:	48 01 d8             	add    %rbx,%rax
+  80586a:	ff d0                	call   *%rax
+  80586c:	41 39 c4             	cmp    %eax,%r12d
+  80586f:	0f 94 c0             	sete   %al
+  805872:	0f b6 c0             	movzbl %al,%eax
+  805875:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805878:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80587f:	ff ff ff 
+  805882:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805886:	48 8b 00             	mov    (%rax),%rax
+  805889:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80588f:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805892:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805895:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805898:	75 05                	jne    80589f <_pipeisclosed+0xab>
+			return ret;
+  80589a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80589d:	eb 63                	jmp    805902 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  80589f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058a2:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8058a5:	0f 84 72 ff ff ff    	je     80581d <_pipeisclosed+0x29>
+  8058ab:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  8058af:	0f 85 68 ff ff ff    	jne    80581d <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8058b5:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8058bc:	ff ff ff 
+  8058bf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058c3:	48 8b 00             	mov    (%rax),%rax
+  8058c6:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  8058cc:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8058cf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058d2:	89 c6                	mov    %eax,%esi
+  8058d4:	48 b8 6e db ff ff ff 	movabs $0xffffffffffffdb6e,%rax
+  8058db:	ff ff ff 
+  8058de:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8058e2:	48 89 c7             	mov    %rax,%rdi
+  8058e5:	49 89 df             	mov    %rbx,%r15
+  8058e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058ed:	49 b8 20 7a ff ff ff 	movabs $0xffffffffffff7a20,%r8
+  8058f4:	ff ff ff 
+  8058f7:	49 01 d8             	add    %rbx,%r8
+  8058fa:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8058fd:	e9 1b ff ff ff       	jmp    80581d <_pipeisclosed+0x29>
+	}
+}
+  805902:	48 83 c4 28          	add    $0x28,%rsp
+  805906:	5b                   	pop    %rbx
+  805907:	41 5c                	pop    %r12
+  805909:	41 5f                	pop    %r15
+  80590b:	5d                   	pop    %rbp
+  80590c:	c3                   	ret
+
+000000000080590d <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  80590d:	55                   	push   %rbp
+  80590e:	48 89 e5             	mov    %rsp,%rbp
+  805911:	41 57                	push   %r15
+  805913:	53                   	push   %rbx
+  805914:	48 83 ec 30          	sub    $0x30,%rsp
+  805918:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805918 <pipeisclosed+0xb>
+  80591f:	49 bb 18 37 00 00 00 	movabs $0x3718,%r11
+  805926:	00 00 00 
+  805929:	4c 01 db             	add    %r11,%rbx
+  80592c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80592f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805933:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805936:	48 89 d6             	mov    %rdx,%rsi
+  805939:	89 c7                	mov    %eax,%edi
+  80593b:	49 89 df             	mov    %rbx,%r15
+  80593e:	48 b8 35 9f ff ff ff 	movabs $0xffffffffffff9f35,%rax
+  805945:	ff ff ff 
+  805948:	48 01 d8             	add    %rbx,%rax
+  80594b:	ff d0                	call   *%rax
+  80594d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805950:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805954:	79 05                	jns    80595b <pipeisclosed+0x4e>
+		return r;
+  805956:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805959:	eb 3b                	jmp    805996 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  80595b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80595f:	48 89 c7             	mov    %rax,%rdi
+  805962:	49 89 df             	mov    %rbx,%r15
+  805965:	48 b8 3c 9e ff ff ff 	movabs $0xffffffffffff9e3c,%rax
+  80596c:	ff ff ff 
+  80596f:	48 01 d8             	add    %rbx,%rax
+  805972:	ff d0                	call   *%rax
+  805974:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805978:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80597c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805980:	48 89 d6             	mov    %rdx,%rsi
+  805983:	48 89 c7             	mov    %rax,%rdi
+  805986:	48 b8 c4 c7 ff ff ff 	movabs $0xffffffffffffc7c4,%rax
+  80598d:	ff ff ff 
+  805990:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805994:	ff d0                	call   *%rax
+}
+  805996:	48 83 c4 30          	add    $0x30,%rsp
+  80599a:	5b                   	pop    %rbx
+  80599b:	41 5f                	pop    %r15
+  80599d:	5d                   	pop    %rbp
+  80599e:	c3                   	ret
+
+000000000080599f <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80599f:	55                   	push   %rbp
+  8059a0:	48 89 e5             	mov    %rsp,%rbp
+  8059a3:	41 57                	push   %r15
+  8059a5:	53                   	push   %rbx
+  8059a6:	48 83 ec 40          	sub    $0x40,%rsp
+  8059aa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059aa <devpipe_read+0xb>
+  8059b1:	49 bb 86 36 00 00 00 	movabs $0x3686,%r11
+  8059b8:	00 00 00 
+  8059bb:	4c 01 db             	add    %r11,%rbx
+  8059be:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8059c2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8059c6:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  8059ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8059ce:	48 89 c7             	mov    %rax,%rdi
+  8059d1:	49 89 df             	mov    %rbx,%r15
+  8059d4:	48 b8 3c 9e ff ff ff 	movabs $0xffffffffffff9e3c,%rax
+  8059db:	ff ff ff 
+  8059de:	48 01 d8             	add    %rbx,%rax
+  8059e1:	ff d0                	call   *%rax
+  8059e3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8059e7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8059eb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8059ef:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8059f6:	00 
+  8059f7:	e9 a1 00 00 00       	jmp    805a9d <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8059fc:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805a01:	74 09                	je     805a0c <devpipe_read+0x6d>
+				return i;
+  805a03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a07:	e9 9f 00 00 00       	jmp    805aab <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805a0c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805a10:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805a14:	48 89 d6             	mov    %rdx,%rsi
+  805a17:	48 89 c7             	mov    %rax,%rdi
+  805a1a:	48 b8 c4 c7 ff ff ff 	movabs $0xffffffffffffc7c4,%rax
+  805a21:	ff ff ff 
+  805a24:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a28:	ff d0                	call   *%rax
+  805a2a:	85 c0                	test   %eax,%eax
+  805a2c:	74 07                	je     805a35 <devpipe_read+0x96>
+				return 0;
+  805a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a33:	eb 76                	jmp    805aab <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805a35:	49 89 df             	mov    %rbx,%r15
+  805a38:	48 b8 07 96 ff ff ff 	movabs $0xffffffffffff9607,%rax
+  805a3f:	ff ff ff 
+  805a42:	48 01 d8             	add    %rbx,%rax
+  805a45:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805a47:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a4b:	8b 10                	mov    (%rax),%edx
+  805a4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a51:	8b 40 04             	mov    0x4(%rax),%eax
+  805a54:	39 c2                	cmp    %eax,%edx
+  805a56:	74 a4                	je     8059fc <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805a58:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a5c:	8b 10                	mov    (%rax),%edx
+  805a5e:	89 d0                	mov    %edx,%eax
+  805a60:	c1 f8 1f             	sar    $0x1f,%eax
+  805a63:	c1 e8 1b             	shr    $0x1b,%eax
+  805a66:	01 c2                	add    %eax,%edx
+  805a68:	83 e2 1f             	and    $0x1f,%edx
+  805a6b:	29 c2                	sub    %eax,%edx
+  805a6d:	89 d6                	mov    %edx,%esi
+  805a6f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805a73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a77:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805a7b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805a7f:	48 63 c6             	movslq %esi,%rax
+  805a82:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805a87:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805a89:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a8d:	8b 00                	mov    (%rax),%eax
+  805a8f:	8d 50 01             	lea    0x1(%rax),%edx
+  805a92:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a96:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805a98:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805a9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805aa1:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805aa5:	72 a0                	jb     805a47 <devpipe_read+0xa8>
+	}
+	return i;
+  805aa7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805aab:	48 83 c4 40          	add    $0x40,%rsp
+  805aaf:	5b                   	pop    %rbx
+  805ab0:	41 5f                	pop    %r15
+  805ab2:	5d                   	pop    %rbp
+  805ab3:	c3                   	ret
+
+0000000000805ab4 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805ab4:	55                   	push   %rbp
+  805ab5:	48 89 e5             	mov    %rsp,%rbp
+  805ab8:	41 57                	push   %r15
+  805aba:	53                   	push   %rbx
+  805abb:	48 83 ec 40          	sub    $0x40,%rsp
+  805abf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805abf <devpipe_write+0xb>
+  805ac6:	49 bb 71 35 00 00 00 	movabs $0x3571,%r11
+  805acd:	00 00 00 
+  805ad0:	4c 01 db             	add    %r11,%rbx
+  805ad3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805ad7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805adb:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805adf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805ae3:	48 89 c7             	mov    %rax,%rdi
+  805ae6:	49 89 df             	mov    %rbx,%r15
+  805ae9:	48 b8 3c 9e ff ff ff 	movabs $0xffffffffffff9e3c,%rax
+  805af0:	ff ff ff 
+  805af3:	48 01 d8             	add    %rbx,%rax
+  805af6:	ff d0                	call   *%rax
+  805af8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805afc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805b00:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805b04:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805b0b:	00 
+  805b0c:	e9 a0 00 00 00       	jmp    805bb1 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805b11:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805b15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b19:	48 89 d6             	mov    %rdx,%rsi
+  805b1c:	48 89 c7             	mov    %rax,%rdi
+  805b1f:	48 b8 c4 c7 ff ff ff 	movabs $0xffffffffffffc7c4,%rax
+  805b26:	ff ff ff 
+  805b29:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b2d:	ff d0                	call   *%rax
+  805b2f:	85 c0                	test   %eax,%eax
+  805b31:	74 0a                	je     805b3d <devpipe_write+0x89>
+				return 0;
+  805b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b38:	e9 82 00 00 00       	jmp    805bbf <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805b3d:	49 89 df             	mov    %rbx,%r15
+  805b40:	48 b8 07 96 ff ff ff 	movabs $0xffffffffffff9607,%rax
+  805b47:	ff ff ff 
+  805b4a:	48 01 d8             	add    %rbx,%rax
+  805b4d:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805b4f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b53:	8b 40 04             	mov    0x4(%rax),%eax
+  805b56:	48 63 d0             	movslq %eax,%rdx
+  805b59:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b5d:	8b 00                	mov    (%rax),%eax
+  805b5f:	48 98                	cltq
+  805b61:	48 83 c0 20          	add    $0x20,%rax
+  805b65:	48 39 c2             	cmp    %rax,%rdx
+  805b68:	73 a7                	jae    805b11 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805b6a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805b6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b72:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805b76:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b7a:	8b 50 04             	mov    0x4(%rax),%edx
+  805b7d:	89 d0                	mov    %edx,%eax
+  805b7f:	c1 f8 1f             	sar    $0x1f,%eax
+  805b82:	c1 e8 1b             	shr    $0x1b,%eax
+  805b85:	01 c2                	add    %eax,%edx
+  805b87:	83 e2 1f             	and    $0x1f,%edx
+  805b8a:	29 c2                	sub    %eax,%edx
+  805b8c:	89 d0                	mov    %edx,%eax
+  805b8e:	0f b6 09             	movzbl (%rcx),%ecx
+  805b91:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805b95:	48 98                	cltq
+  805b97:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805b9b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b9f:	8b 40 04             	mov    0x4(%rax),%eax
+  805ba2:	8d 50 01             	lea    0x1(%rax),%edx
+  805ba5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ba9:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805bac:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805bb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bb5:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805bb9:	72 94                	jb     805b4f <devpipe_write+0x9b>
+	}
+
+	return i;
+  805bbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805bbf:	48 83 c4 40          	add    $0x40,%rsp
+  805bc3:	5b                   	pop    %rbx
+  805bc4:	41 5f                	pop    %r15
+  805bc6:	5d                   	pop    %rbp
+  805bc7:	c3                   	ret
+
+0000000000805bc8 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805bc8:	55                   	push   %rbp
+  805bc9:	48 89 e5             	mov    %rsp,%rbp
+  805bcc:	41 57                	push   %r15
+  805bce:	53                   	push   %rbx
+  805bcf:	48 83 ec 20          	sub    $0x20,%rsp
+  805bd3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bd3 <devpipe_stat+0xb>
+  805bda:	49 bb 5d 34 00 00 00 	movabs $0x345d,%r11
+  805be1:	00 00 00 
+  805be4:	4c 01 db             	add    %r11,%rbx
+  805be7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805beb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805bef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805bf3:	48 89 c7             	mov    %rax,%rdi
+  805bf6:	49 89 df             	mov    %rbx,%r15
+  805bf9:	48 b8 3c 9e ff ff ff 	movabs $0xffffffffffff9e3c,%rax
+  805c00:	ff ff ff 
+  805c03:	48 01 d8             	add    %rbx,%rax
+  805c06:	ff d0                	call   *%rax
+  805c08:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805c0c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c10:	48 ba 81 db ff ff ff 	movabs $0xffffffffffffdb81,%rdx
+  805c17:	ff ff ff 
+  805c1a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805c1e:	48 89 d6             	mov    %rdx,%rsi
+  805c21:	48 89 c7             	mov    %rax,%rdi
+  805c24:	49 89 df             	mov    %rbx,%r15
+  805c27:	48 b8 a0 89 ff ff ff 	movabs $0xffffffffffff89a0,%rax
+  805c2e:	ff ff ff 
+  805c31:	48 01 d8             	add    %rbx,%rax
+  805c34:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805c36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c3a:	8b 50 04             	mov    0x4(%rax),%edx
+  805c3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c41:	8b 00                	mov    (%rax),%eax
+  805c43:	29 c2                	sub    %eax,%edx
+  805c45:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c49:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805c4f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c53:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805c5a:	00 00 00 
+	stat->st_dev = &devpipe;
+  805c5d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c61:	48 ba f0 00 00 00 00 	movabs $0xf0,%rdx
+  805c68:	00 00 00 
+  805c6b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805c6f:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805c76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c7b:	48 83 c4 20          	add    $0x20,%rsp
+  805c7f:	5b                   	pop    %rbx
+  805c80:	41 5f                	pop    %r15
+  805c82:	5d                   	pop    %rbp
+  805c83:	c3                   	ret
+
+0000000000805c84 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805c84:	55                   	push   %rbp
+  805c85:	48 89 e5             	mov    %rsp,%rbp
+  805c88:	41 57                	push   %r15
+  805c8a:	53                   	push   %rbx
+  805c8b:	48 83 ec 10          	sub    $0x10,%rsp
+  805c8f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c8f <devpipe_close+0xb>
+  805c96:	49 bb a1 33 00 00 00 	movabs $0x33a1,%r11
+  805c9d:	00 00 00 
+  805ca0:	4c 01 db             	add    %r11,%rbx
+  805ca3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805ca7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cab:	48 89 c6             	mov    %rax,%rsi
+  805cae:	bf 00 00 00 00       	mov    $0x0,%edi
+  805cb3:	49 89 df             	mov    %rbx,%r15
+  805cb6:	48 b8 34 97 ff ff ff 	movabs $0xffffffffffff9734,%rax
+  805cbd:	ff ff ff 
+  805cc0:	48 01 d8             	add    %rbx,%rax
+  805cc3:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  805cc5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cc9:	48 89 c7             	mov    %rax,%rdi
+  805ccc:	49 89 df             	mov    %rbx,%r15
+  805ccf:	48 b8 3c 9e ff ff ff 	movabs $0xffffffffffff9e3c,%rax
+  805cd6:	ff ff ff 
+  805cd9:	48 01 d8             	add    %rbx,%rax
+  805cdc:	ff d0                	call   *%rax
+  805cde:	48 89 c6             	mov    %rax,%rsi
+  805ce1:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ce6:	49 89 df             	mov    %rbx,%r15
+  805ce9:	48 b8 34 97 ff ff ff 	movabs $0xffffffffffff9734,%rax
+  805cf0:	ff ff ff 
+  805cf3:	48 01 d8             	add    %rbx,%rax
+  805cf6:	ff d0                	call   *%rax
+}
+  805cf8:	48 83 c4 10          	add    $0x10,%rsp
+  805cfc:	5b                   	pop    %rbx
+  805cfd:	41 5f                	pop    %r15
+  805cff:	5d                   	pop    %rbp
+  805d00:	c3                   	ret
+
+0000000000805d01 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805d01:	55                   	push   %rbp
+  805d02:	48 89 e5             	mov    %rsp,%rbp
+  805d05:	41 57                	push   %r15
+  805d07:	53                   	push   %rbx
+  805d08:	48 83 ec 30          	sub    $0x30,%rsp
+  805d0c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d0c <ipc_recv+0xb>
+  805d13:	49 bb 24 33 00 00 00 	movabs $0x3324,%r11
+  805d1a:	00 00 00 
+  805d1d:	4c 01 db             	add    %r11,%rbx
+  805d20:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805d24:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805d28:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  805d2c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805d31:	75 0e                	jne    805d41 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  805d33:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805d3a:	00 00 00 
+  805d3d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  805d41:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805d45:	48 89 c7             	mov    %rax,%rdi
+  805d48:	49 89 df             	mov    %rbx,%r15
+  805d4b:	48 b8 85 99 ff ff ff 	movabs $0xffffffffffff9985,%rax
+  805d52:	ff ff ff 
+  805d55:	48 01 d8             	add    %rbx,%rax
+  805d58:	ff d0                	call   *%rax
+  805d5a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  805d5d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805d62:	74 2a                	je     805d8e <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  805d64:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d68:	75 19                	jne    805d83 <ipc_recv+0x82>
+  805d6a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805d71:	ff ff ff 
+  805d74:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d78:	48 8b 00             	mov    (%rax),%rax
+  805d7b:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805d81:	eb 05                	jmp    805d88 <ipc_recv+0x87>
+  805d83:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d88:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805d8c:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  805d8e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805d93:	74 2a                	je     805dbf <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805d95:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d99:	75 19                	jne    805db4 <ipc_recv+0xb3>
+  805d9b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805da2:	ff ff ff 
+  805da5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805da9:	48 8b 00             	mov    (%rax),%rax
+  805dac:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805db2:	eb 05                	jmp    805db9 <ipc_recv+0xb8>
+  805db4:	b8 00 00 00 00       	mov    $0x0,%eax
+  805db9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805dbd:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  805dbf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805dc3:	74 05                	je     805dca <ipc_recv+0xc9>
+		return res;
+  805dc5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805dc8:	eb 17                	jmp    805de1 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805dca:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805dd1:	ff ff ff 
+  805dd4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805dd8:	48 8b 00             	mov    (%rax),%rax
+  805ddb:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805de1:	48 83 c4 30          	add    $0x30,%rsp
+  805de5:	5b                   	pop    %rbx
+  805de6:	41 5f                	pop    %r15
+  805de8:	5d                   	pop    %rbp
+  805de9:	c3                   	ret
+
+0000000000805dea <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805dea:	55                   	push   %rbp
+  805deb:	48 89 e5             	mov    %rsp,%rbp
+  805dee:	41 57                	push   %r15
+  805df0:	53                   	push   %rbx
+  805df1:	48 83 ec 20          	sub    $0x20,%rsp
+  805df5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805df5 <ipc_send+0xb>
+  805dfc:	49 bb 3b 32 00 00 00 	movabs $0x323b,%r11
+  805e03:	00 00 00 
+  805e06:	4c 01 db             	add    %r11,%rbx
+  805e09:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805e0c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805e0f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805e13:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  805e16:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805e1b:	75 0e                	jne    805e2b <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  805e1d:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805e24:	00 00 00 
+  805e27:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  805e2b:	90                   	nop
+  805e2c:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805e2f:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805e32:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805e36:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e39:	89 c7                	mov    %eax,%edi
+  805e3b:	49 89 df             	mov    %rbx,%r15
+  805e3e:	48 b8 1b 99 ff ff ff 	movabs $0xffffffffffff991b,%rax
+  805e45:	ff ff ff 
+  805e48:	48 01 d8             	add    %rbx,%rax
+  805e4b:	ff d0                	call   *%rax
+  805e4d:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  805e50:	74 da                	je     805e2c <ipc_send+0x42>
+		;
+}
+  805e52:	90                   	nop
+  805e53:	90                   	nop
+  805e54:	48 83 c4 20          	add    $0x20,%rsp
+  805e58:	5b                   	pop    %rbx
+  805e59:	41 5f                	pop    %r15
+  805e5b:	5d                   	pop    %rbp
+  805e5c:	c3                   	ret
+
+0000000000805e5d <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805e5d:	55                   	push   %rbp
+  805e5e:	48 89 e5             	mov    %rsp,%rbp
+  805e61:	41 57                	push   %r15
+  805e63:	53                   	push   %rbx
+  805e64:	48 83 ec 40          	sub    $0x40,%rsp
+  805e68:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e68 <ipc_call+0xb>
+  805e6f:	49 bb c8 31 00 00 00 	movabs $0x31c8,%r11
+  805e76:	00 00 00 
+  805e79:	4c 01 db             	add    %r11,%rbx
+  805e7c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805e7f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805e82:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805e86:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805e89:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805e8d:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805e91:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805e96:	75 0e                	jne    805ea6 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805e98:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805e9f:	00 00 00 
+  805ea2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805ea6:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805eab:	75 0e                	jne    805ebb <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805ead:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805eb4:	00 00 00 
+  805eb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805ebb:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805ebe:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805ec2:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805ec5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805ec9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ecc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805ed2:	49 89 f8             	mov    %rdi,%r8
+  805ed5:	89 c7                	mov    %eax,%edi
+  805ed7:	49 89 df             	mov    %rbx,%r15
+  805eda:	48 b8 de 99 ff ff ff 	movabs $0xffffffffffff99de,%rax
+  805ee1:	ff ff ff 
+  805ee4:	48 01 d8             	add    %rbx,%rax
+  805ee7:	ff d0                	call   *%rax
+  805ee9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805eec:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805ef1:	74 2a                	je     805f1d <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805ef3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ef7:	75 19                	jne    805f12 <ipc_call+0xb5>
+  805ef9:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805f00:	ff ff ff 
+  805f03:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805f07:	48 8b 00             	mov    (%rax),%rax
+  805f0a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805f10:	eb 05                	jmp    805f17 <ipc_call+0xba>
+  805f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f17:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805f1b:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805f1d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f21:	74 05                	je     805f28 <ipc_call+0xcb>
+		return r;
+  805f23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f26:	eb 17                	jmp    805f3f <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  805f28:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805f2f:	ff ff ff 
+  805f32:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805f36:	48 8b 00             	mov    (%rax),%rax
+  805f39:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805f3f:	48 83 c4 40          	add    $0x40,%rsp
+  805f43:	5b                   	pop    %rbx
+  805f44:	41 5f                	pop    %r15
+  805f46:	5d                   	pop    %rbp
+  805f47:	c3                   	ret
+
+0000000000805f48 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805f48:	55                   	push   %rbp
+  805f49:	48 89 e5             	mov    %rsp,%rbp
+  805f4c:	41 57                	push   %r15
+  805f4e:	53                   	push   %rbx
+  805f4f:	48 83 ec 70          	sub    $0x70,%rsp
+  805f53:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f53 <ipc_callw+0xb>
+  805f5a:	49 bb dd 30 00 00 00 	movabs $0x30dd,%r11
+  805f61:	00 00 00 
+  805f64:	4c 01 db             	add    %r11,%rbx
+  805f67:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805f6a:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805f6d:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805f71:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805f75:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805f7a:	76 0a                	jbe    805f86 <ipc_callw+0x3e>
+		return -E_INVAL;
+  805f7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805f81:	e9 b7 00 00 00       	jmp    80603d <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805f86:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805f8a:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805f8e:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805f92:	48 89 ce             	mov    %rcx,%rsi
+  805f95:	48 89 c7             	mov    %rax,%rdi
+  805f98:	49 89 df             	mov    %rbx,%r15
+  805f9b:	48 b8 80 8d ff ff ff 	movabs $0xffffffffffff8d80,%rax
+  805fa2:	ff ff ff 
+  805fa5:	48 01 d8             	add    %rbx,%rax
+  805fa8:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805faa:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805fb1:	00 
+  805fb2:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805fb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fba:	48 01 d0             	add    %rdx,%rax
+  805fbd:	48 83 e8 01          	sub    $0x1,%rax
+  805fc1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805fc5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805fc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  805fce:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805fd2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805fd6:	48 29 d0             	sub    %rdx,%rax
+  805fd9:	48 c1 e8 03          	shr    $0x3,%rax
+  805fdd:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805fe1:	89 c1                	mov    %eax,%ecx
+  805fe3:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805fe6:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805fea:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805fed:	49 89 d1             	mov    %rdx,%r9
+  805ff0:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805ff7:	00 00 00 
+  805ffa:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806001:	00 00 00 
+  806004:	89 c7                	mov    %eax,%edi
+  806006:	49 89 df             	mov    %rbx,%r15
+  806009:	48 b8 de 99 ff ff ff 	movabs $0xffffffffffff99de,%rax
+  806010:	ff ff ff 
+  806013:	48 01 d8             	add    %rbx,%rax
+  806016:	ff d0                	call   *%rax
+  806018:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  80601b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80601f:	74 05                	je     806026 <ipc_callw+0xde>
+		return r;
+  806021:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806024:	eb 17                	jmp    80603d <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  806026:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80602d:	ff ff ff 
+  806030:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806034:	48 8b 00             	mov    (%rax),%rax
+  806037:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80603d:	48 83 c4 70          	add    $0x70,%rsp
+  806041:	5b                   	pop    %rbx
+  806042:	41 5f                	pop    %r15
+  806044:	5d                   	pop    %rbp
+  806045:	c3                   	ret
+
+0000000000806046 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  806046:	55                   	push   %rbp
+  806047:	48 89 e5             	mov    %rsp,%rbp
+  80604a:	41 57                	push   %r15
+  80604c:	53                   	push   %rbx
+  80604d:	48 83 ec 40          	sub    $0x40,%rsp
+  806051:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806051 <ipc_callv+0xb>
+  806058:	49 bb df 2f 00 00 00 	movabs $0x2fdf,%r11
+  80605f:	00 00 00 
+  806062:	4c 01 db             	add    %r11,%rbx
+  806065:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  806068:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  80606b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80606f:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806072:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  806076:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  80607a:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806081:	00 00 00 
+  806084:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806088:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  80608c:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806090:	74 11                	je     8060a3 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806092:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806096:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  80609a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80609d:	c1 e0 14             	shl    $0x14,%eax
+  8060a0:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  8060a3:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  8060a7:	74 14                	je     8060bd <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  8060a9:	8b 45 20             	mov    0x20(%rbp),%eax
+  8060ac:	83 e8 01             	sub    $0x1,%eax
+  8060af:	48 63 d0             	movslq %eax,%rdx
+  8060b2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8060b6:	48 09 d0             	or     %rdx,%rax
+  8060b9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  8060bd:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8060c0:	c1 e0 10             	shl    $0x10,%eax
+  8060c3:	0b 45 10             	or     0x10(%rbp),%eax
+  8060c6:	89 c1                	mov    %eax,%ecx
+  8060c8:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  8060cb:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8060cf:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8060d3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8060d7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8060da:	4d 89 c1             	mov    %r8,%r9
+  8060dd:	49 89 f8             	mov    %rdi,%r8
+  8060e0:	89 c7                	mov    %eax,%edi
+  8060e2:	49 89 df             	mov    %rbx,%r15
+  8060e5:	48 b8 de 99 ff ff ff 	movabs $0xffffffffffff99de,%rax
+  8060ec:	ff ff ff 
+  8060ef:	48 01 d8             	add    %rbx,%rax
+  8060f2:	ff d0                	call   *%rax
+  8060f4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8060f7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8060fb:	74 05                	je     806102 <ipc_callv+0xbc>
+		return r;
+  8060fd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806100:	eb 17                	jmp    806119 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806102:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806109:	ff ff ff 
+  80610c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806110:	48 8b 00             	mov    (%rax),%rax
+  806113:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806119:	48 83 c4 40          	add    $0x40,%rsp
+  80611d:	5b                   	pop    %rbx
+  80611e:	41 5f                	pop    %r15
+  806120:	5d                   	pop    %rbp
+  806121:	c3                   	ret
+
+0000000000806122 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806122:	55                   	push   %rbp
+  806123:	48 89 e5             	mov    %rsp,%rbp
+  806126:	41 57                	push   %r15
+  806128:	53                   	push   %rbx
+  806129:	48 83 ec 40          	sub    $0x40,%rsp
+  80612d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80612d <ipc_reply_recv+0xb>
+  806134:	49 bb 03 2f 00 00 00 	movabs $0x2f03,%r11
+  80613b:	00 00 00 
+  80613e:	4c 01 db             	add    %r11,%rbx
+  806141:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806144:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806147:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80614b:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  80614e:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806152:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806156:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80615b:	75 0e                	jne    80616b <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  80615d:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806164:	00 00 00 
+  806167:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80616b:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806170:	75 0e                	jne    806180 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806172:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806179:	00 00 00 
+  80617c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806180:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806183:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806187:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80618b:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80618e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806192:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806195:	4d 89 c1             	mov    %r8,%r9
+  806198:	49 89 f8             	mov    %rdi,%r8
+  80619b:	89 c7                	mov    %eax,%edi
+  80619d:	49 89 df             	mov    %rbx,%r15
+  8061a0:	48 b8 52 9a ff ff ff 	movabs $0xffffffffffff9a52,%rax
+  8061a7:	ff ff ff 
+  8061aa:	48 01 d8             	add    %rbx,%rax
+  8061ad:	ff d0                	call   *%rax
+  8061af:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  8061b2:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8061b7:	74 2a                	je     8061e3 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8061b9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061bd:	75 19                	jne    8061d8 <ipc_reply_recv+0xb6>
+  8061bf:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8061c6:	ff ff ff 
+  8061c9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8061cd:	48 8b 00             	mov    (%rax),%rax
+  8061d0:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8061d6:	eb 05                	jmp    8061dd <ipc_reply_recv+0xbb>
+  8061d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8061e1:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  8061e3:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  8061e8:	74 2a                	je     806214 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8061ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061ee:	75 19                	jne    806209 <ipc_reply_recv+0xe7>
+  8061f0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8061f7:	ff ff ff 
+  8061fa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8061fe:	48 8b 00             	mov    (%rax),%rax
+  806201:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806207:	eb 05                	jmp    80620e <ipc_reply_recv+0xec>
+  806209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80620e:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806212:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806214:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806218:	74 05                	je     80621f <ipc_reply_recv+0xfd>
+		return r;
+  80621a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80621d:	eb 17                	jmp    806236 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  80621f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806226:	ff ff ff 
+  806229:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80622d:	48 8b 00             	mov    (%rax),%rax
+  806230:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806236:	48 83 c4 40          	add    $0x40,%rsp
+  80623a:	5b                   	pop    %rbx
+  80623b:	41 5f                	pop    %r15
+  80623d:	5d                   	pop    %rbp
+  80623e:	c3                   	ret
+
+000000000080623f <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  80623f:	55                   	push   %rbp
+  806240:	48 89 e5             	mov    %rsp,%rbp
+  806243:	41 57                	push   %r15
+  806245:	53                   	push   %rbx
+  806246:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  80624d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80624d <ipc_window_batch+0xe>
+  806254:	49 bb e3 2d 00 00 00 	movabs $0x2de3,%r11
+  80625b:	00 00 00 
+  80625e:	4c 01 db             	add    %r11,%rbx
+  806261:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806267:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  80626e:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806274:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  80627a:	e9 15 01 00 00       	jmp    806394 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  80627f:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806285:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806288:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  80628f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806292:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806295:	39 c2                	cmp    %eax,%edx
+  806297:	0f 4e c2             	cmovle %edx,%eax
+  80629a:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  80629d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8062a4:	eb 6b                	jmp    806311 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  8062a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062a9:	48 98                	cltq
+  8062ab:	48 c1 e0 05          	shl    $0x5,%rax
+  8062af:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8062b3:	48 01 e8             	add    %rbp,%rax
+  8062b6:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  8062bc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  8062c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062c5:	c1 e0 0c             	shl    $0xc,%eax
+  8062c8:	48 63 d0             	movslq %eax,%rdx
+  8062cb:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  8062d2:	48 01 c2             	add    %rax,%rdx
+  8062d5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062d8:	48 98                	cltq
+  8062da:	48 c1 e0 05          	shl    $0x5,%rax
+  8062de:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8062e2:	48 01 e8             	add    %rbp,%rax
+  8062e5:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  8062eb:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  8062ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062f1:	48 98                	cltq
+  8062f3:	48 c1 e0 05          	shl    $0x5,%rax
+  8062f7:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8062fb:	48 01 e8             	add    %rbp,%rax
+  8062fe:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806305:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  80630b:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  80630d:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806311:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806314:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806317:	7c 8d                	jl     8062a6 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806319:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806320:	74 27                	je     806349 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806322:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806325:	48 63 d0             	movslq %eax,%rdx
+  806328:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  80632f:	48 89 d6             	mov    %rdx,%rsi
+  806332:	48 89 c7             	mov    %rax,%rdi
+  806335:	49 89 df             	mov    %rbx,%r15
+  806338:	48 b8 f5 9c ff ff ff 	movabs $0xffffffffffff9cf5,%rax
+  80633f:	ff ff ff 
+  806342:	48 01 d8             	add    %rbx,%rax
+  806345:	ff d0                	call   *%rax
+  806347:	eb 25                	jmp    80636e <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806349:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80634c:	48 63 d0             	movslq %eax,%rdx
+  80634f:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806356:	48 89 d6             	mov    %rdx,%rsi
+  806359:	48 89 c7             	mov    %rax,%rdi
+  80635c:	49 89 df             	mov    %rbx,%r15
+  80635f:	48 b8 53 9d ff ff ff 	movabs $0xffffffffffff9d53,%rax
+  806366:	ff ff ff 
+  806369:	48 01 d8             	add    %rbx,%rax
+  80636c:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  80636e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806371:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806375:	79 05                	jns    80637c <ipc_window_batch+0x13d>
+			return r;
+  806377:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80637a:	eb 2a                	jmp    8063a6 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  80637c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80637f:	c1 e0 0c             	shl    $0xc,%eax
+  806382:	48 98                	cltq
+  806384:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  80638b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80638e:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806394:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  80639b:	0f 8f de fe ff ff    	jg     80627f <ipc_window_batch+0x40>
+	}
+	return 0;
+  8063a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8063a6:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  8063ad:	5b                   	pop    %rbx
+  8063ae:	41 5f                	pop    %r15
+  8063b0:	5d                   	pop    %rbp
+  8063b1:	c3                   	ret
+
+00000000008063b2 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  8063b2:	55                   	push   %rbp
+  8063b3:	48 89 e5             	mov    %rsp,%rbp
+  8063b6:	48 83 ec 10          	sub    $0x10,%rsp
+  8063ba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8063ba <ipc_map_window+0x8>
+  8063c1:	49 bb 76 2c 00 00 00 	movabs $0x2c76,%r11
+  8063c8:	00 00 00 
+  8063cb:	4c 01 d8             	add    %r11,%rax
+  8063ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8063d2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  8063d5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8063d8:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8063dc:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8063e1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8063e6:	49 b8 0f d2 ff ff ff 	movabs $0xffffffffffffd20f,%r8
+  8063ed:	ff ff ff 
+  8063f0:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8063f4:	ff d0                	call   *%rax
+}
+  8063f6:	c9                   	leave
+  8063f7:	c3                   	ret
+
+00000000008063f8 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  8063f8:	55                   	push   %rbp
+  8063f9:	48 89 e5             	mov    %rsp,%rbp
+  8063fc:	48 83 ec 10          	sub    $0x10,%rsp
+  806400:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806400 <ipc_unmap_window+0x8>
+  806407:	49 bb 30 2c 00 00 00 	movabs $0x2c30,%r11
+  80640e:	00 00 00 
+  806411:	4c 01 d8             	add    %r11,%rax
+  806414:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806418:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  80641b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80641e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806422:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806427:	bf 00 00 00 00       	mov    $0x0,%edi
+  80642c:	49 b8 0f d2 ff ff ff 	movabs $0xffffffffffffd20f,%r8
+  806433:	ff ff ff 
+  806436:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80643a:	ff d0                	call   *%rax
+}
+  80643c:	c9                   	leave
+  80643d:	c3                   	ret
+
+000000000080643e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80643e:	55                   	push   %rbp
+  80643f:	48 89 e5             	mov    %rsp,%rbp
+  806442:	48 83 ec 18          	sub    $0x18,%rsp
+  806446:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806446 <ipc_find_env+0x8>
+  80644d:	49 bb ea 2b 00 00 00 	movabs $0x2bea,%r11
+  806454:	00 00 00 
+  806457:	4c 01 d8             	add    %r11,%rax
+  80645a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  80645d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806464:	eb 57                	jmp    8064bd <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806466:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  80646d:	ff ff ff 
+  806470:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806474:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806477:	48 63 d2             	movslq %edx,%rdx
+  80647a:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806481:	48 01 ca             	add    %rcx,%rdx
+  806484:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  80648b:	8b 12                	mov    (%rdx),%edx
+  80648d:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806490:	75 27                	jne    8064b9 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806492:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  806499:	ff ff ff 
+  80649c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8064a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8064a3:	48 98                	cltq
+  8064a5:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8064ac:	48 01 d0             	add    %rdx,%rax
+  8064af:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8064b5:	8b 00                	mov    (%rax),%eax
+  8064b7:	eb 12                	jmp    8064cb <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  8064b9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8064bd:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8064c4:	7e a0                	jle    806466 <ipc_find_env+0x28>
+	}
+	return 0;
+  8064c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8064cb:	c9                   	leave
+  8064cc:	c3                   	ret
+
+00000000008064cd <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8064cd:	55                   	push   %rbp
+  8064ce:	48 89 e5             	mov    %rsp,%rbp
+  8064d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8064d5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8064d5 <pageref+0x8>
+  8064dc:	49 bb 5b 2b 00 00 00 	movabs $0x2b5b,%r11
+  8064e3:	00 00 00 
+  8064e6:	4c 01 d8             	add    %r11,%rax
+  8064e9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  8064ed:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8064f1:	48 89 d1             	mov    %rdx,%rcx
+  8064f4:	48 c1 e9 15          	shr    $0x15,%rcx
+  8064f8:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8064ff:	ff ff ff 
+  806502:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806506:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80650a:	83 e2 01             	and    $0x1,%edx
+  80650d:	48 85 d2             	test   %rdx,%rdx
+  806510:	75 07                	jne    806519 <pageref+0x4c>
+		return 0;
+  806512:	b8 00 00 00 00       	mov    $0x0,%eax
+  806517:	eb 64                	jmp    80657d <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806519:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80651d:	48 89 d1             	mov    %rdx,%rcx
+  806520:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806524:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80652b:	ff ff ff 
+  80652e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806532:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806536:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  80653a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80653e:	83 e2 01             	and    $0x1,%edx
+  806541:	48 85 d2             	test   %rdx,%rdx
+  806544:	75 07                	jne    80654d <pageref+0x80>
+		return 0;
+  806546:	b8 00 00 00 00       	mov    $0x0,%eax
+  80654b:	eb 30                	jmp    80657d <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  80654d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806551:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806555:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  80655c:	ff ff ff 
+  80655f:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806563:	48 89 d0             	mov    %rdx,%rax
+  806566:	48 01 c0             	add    %rax,%rax
+  806569:	48 01 d0             	add    %rdx,%rax
+  80656c:	48 c1 e0 03          	shl    $0x3,%rax
+  806570:	48 01 c8             	add    %rcx,%rax
+  806573:	48 83 c0 08          	add    $0x8,%rax
+  806577:	0f b7 00             	movzwl (%rax),%eax
+  80657a:	0f b7 c0             	movzwl %ax,%eax
+}
+  80657d:	c9                   	leave
+  80657e:	c3                   	ret
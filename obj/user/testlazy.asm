@@ -0,0 +1,10874 @@
+
+obj/user/testlazy:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 0b 05 00 00       	call   80054c <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+#define VA	((char *) 0xB0000000)
+#define NPAGES	16
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 30          	sub    $0x30,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800065:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	physaddr_t zero;
+	int i, r;
+
+	for (i = 0; i < NPAGES; i++)
+  800069:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800070:	e9 80 00 00 00       	jmp    8000f5 <umain+0xb2>
+		if ((r = sys_page_alloc(0, VA + i * PGSIZE,
+  800075:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800078:	c1 e0 0c             	shl    $0xc,%eax
+  80007b:	48 98                	cltq
+  80007d:	ba 00 00 00 b0       	mov    $0xb0000000,%edx
+  800082:	48 01 d0             	add    %rdx,%rax
+  800085:	ba 07 10 00 00       	mov    $0x1007,%edx
+  80008a:	48 89 c6             	mov    %rax,%rsi
+  80008d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800092:	49 89 df             	mov    %rbx,%r15
+  800095:	48 b8 6b 93 ff ff ff 	movabs $0xffffffffffff936b,%rax
+  80009c:	ff ff ff 
+  80009f:	48 01 d8             	add    %rbx,%rax
+  8000a2:	ff d0                	call   *%rax
+  8000a4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8000a7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8000ab:	79 44                	jns    8000f1 <umain+0xae>
+					PTE_P|PTE_U|PTE_W|PTE_LAZY)) < 0)
+			panic("sys_page_alloc: %e", r);
+  8000ad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8000b0:	89 c1                	mov    %eax,%ecx
+  8000b2:	48 b8 88 e0 ff ff ff 	movabs $0xffffffffffffe088,%rax
+  8000b9:	ff ff ff 
+  8000bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000c0:	48 89 c2             	mov    %rax,%rdx
+  8000c3:	be 13 00 00 00       	mov    $0x13,%esi
+  8000c8:	48 b8 9b e0 ff ff ff 	movabs $0xffffffffffffe09b,%rax
+  8000cf:	ff ff ff 
+  8000d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000d6:	48 89 c7             	mov    %rax,%rdi
+  8000d9:	49 89 df             	mov    %rbx,%r15
+  8000dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e1:	49 b8 16 76 ff ff ff 	movabs $0xffffffffffff7616,%r8
+  8000e8:	ff ff ff 
+  8000eb:	49 01 d8             	add    %rbx,%r8
+  8000ee:	41 ff d0             	call   *%r8
+	for (i = 0; i < NPAGES; i++)
+  8000f1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8000f5:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+  8000f9:	0f 8e 76 ff ff ff    	jle    800075 <umain+0x32>
+
+	zero = PTE_ADDR(uvpt[PGNUM(VA)]);
+  8000ff:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  800106:	ff ff ff 
+  800109:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80010d:	48 8b 80 00 00 58 00 	mov    0x580000(%rax),%rax
+  800114:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80011a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	for (i = 0; i < NPAGES; i++) {
+  80011e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800125:	e9 f2 00 00 00       	jmp    80021c <umain+0x1d9>
+		if (VA[i * PGSIZE] != 0 || VA[i * PGSIZE + PGSIZE - 1] != 0)
+  80012a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80012d:	c1 e0 0c             	shl    $0xc,%eax
+  800130:	48 98                	cltq
+  800132:	ba 00 00 00 b0       	mov    $0xb0000000,%edx
+  800137:	48 01 d0             	add    %rdx,%rax
+  80013a:	0f b6 00             	movzbl (%rax),%eax
+  80013d:	84 c0                	test   %al,%al
+  80013f:	75 1a                	jne    80015b <umain+0x118>
+  800141:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800144:	83 c0 01             	add    $0x1,%eax
+  800147:	c1 e0 0c             	shl    $0xc,%eax
+  80014a:	48 98                	cltq
+  80014c:	ba ff ff ff af       	mov    $0xafffffff,%edx
+  800151:	48 01 d0             	add    %rdx,%rax
+  800154:	0f b6 00             	movzbl (%rax),%eax
+  800157:	84 c0                	test   %al,%al
+  800159:	74 44                	je     80019f <umain+0x15c>
+			panic("lazy page %d not zero", i);
+  80015b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80015e:	89 c1                	mov    %eax,%ecx
+  800160:	48 b8 ab e0 ff ff ff 	movabs $0xffffffffffffe0ab,%rax
+  800167:	ff ff ff 
+  80016a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80016e:	48 89 c2             	mov    %rax,%rdx
+  800171:	be 18 00 00 00       	mov    $0x18,%esi
+  800176:	48 b8 9b e0 ff ff ff 	movabs $0xffffffffffffe09b,%rax
+  80017d:	ff ff ff 
+  800180:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800184:	48 89 c7             	mov    %rax,%rdi
+  800187:	49 89 df             	mov    %rbx,%r15
+  80018a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018f:	49 b8 16 76 ff ff ff 	movabs $0xffffffffffff7616,%r8
+  800196:	ff ff ff 
+  800199:	49 01 d8             	add    %rbx,%r8
+  80019c:	41 ff d0             	call   *%r8
+		if (PTE_ADDR(uvpt[PGNUM(VA + i * PGSIZE)]) != zero)
+  80019f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001a2:	c1 e0 0c             	shl    $0xc,%eax
+  8001a5:	48 98                	cltq
+  8001a7:	ba 00 00 00 b0       	mov    $0xb0000000,%edx
+  8001ac:	48 01 d0             	add    %rdx,%rax
+  8001af:	48 c1 e8 0c          	shr    $0xc,%rax
+  8001b3:	48 89 c2             	mov    %rax,%rdx
+  8001b6:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8001bd:	ff ff ff 
+  8001c0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8001c4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8001c8:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8001ce:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  8001d2:	74 44                	je     800218 <umain+0x1d5>
+			panic("lazy page %d allocated by a read", i);
+  8001d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001d7:	89 c1                	mov    %eax,%ecx
+  8001d9:	48 b8 c8 e0 ff ff ff 	movabs $0xffffffffffffe0c8,%rax
+  8001e0:	ff ff ff 
+  8001e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001e7:	48 89 c2             	mov    %rax,%rdx
+  8001ea:	be 1a 00 00 00       	mov    $0x1a,%esi
+  8001ef:	48 b8 9b e0 ff ff ff 	movabs $0xffffffffffffe09b,%rax
+  8001f6:	ff ff ff 
+  8001f9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001fd:	48 89 c7             	mov    %rax,%rdi
+  800200:	49 89 df             	mov    %rbx,%r15
+  800203:	b8 00 00 00 00       	mov    $0x0,%eax
+  800208:	49 b8 16 76 ff ff ff 	movabs $0xffffffffffff7616,%r8
+  80020f:	ff ff ff 
+  800212:	49 01 d8             	add    %rbx,%r8
+  800215:	41 ff d0             	call   *%r8
+	for (i = 0; i < NPAGES; i++) {
+  800218:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80021c:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+  800220:	0f 8e 04 ff ff ff    	jle    80012a <umain+0xe7>
+	}
+	cprintf("reads share the zero page %s\n",
+		uvpt[PGNUM(VA)] & PTE_W ? "wrong" : "right");
+  800226:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80022d:	ff ff ff 
+  800230:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800234:	48 8b 80 00 00 58 00 	mov    0x580000(%rax),%rax
+  80023b:	83 e0 02             	and    $0x2,%eax
+	cprintf("reads share the zero page %s\n",
+  80023e:	48 85 c0             	test   %rax,%rax
+  800241:	74 10                	je     800253 <umain+0x210>
+  800243:	48 b8 e9 e0 ff ff ff 	movabs $0xffffffffffffe0e9,%rax
+  80024a:	ff ff ff 
+  80024d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800251:	eb 0e                	jmp    800261 <umain+0x21e>
+  800253:	48 b8 ef e0 ff ff ff 	movabs $0xffffffffffffe0ef,%rax
+  80025a:	ff ff ff 
+  80025d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800261:	48 89 c6             	mov    %rax,%rsi
+  800264:	48 b8 f5 e0 ff ff ff 	movabs $0xffffffffffffe0f5,%rax
+  80026b:	ff ff ff 
+  80026e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800272:	48 89 c7             	mov    %rax,%rdi
+  800275:	49 89 df             	mov    %rbx,%r15
+  800278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027d:	48 ba ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%rdx
+  800284:	ff ff ff 
+  800287:	48 01 da             	add    %rbx,%rdx
+  80028a:	ff d2                	call   *%rdx
+
+	VA[PGSIZE] = 'p';
+  80028c:	b8 00 10 00 b0       	mov    $0xb0001000,%eax
+  800291:	c6 00 70             	movb   $0x70,(%rax)
+	cprintf("a write allocates a page %s\n",
+		PTE_ADDR(uvpt[PGNUM(VA + PGSIZE)]) != zero
+  800294:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80029b:	ff ff ff 
+  80029e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8002a2:	48 8b 80 08 00 58 00 	mov    0x580008(%rax),%rax
+  8002a9:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+	cprintf("a write allocates a page %s\n",
+  8002af:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  8002b3:	74 66                	je     80031b <umain+0x2d8>
+		&& (uvpt[PGNUM(VA + PGSIZE)] & PTE_W)
+  8002b5:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8002bc:	ff ff ff 
+  8002bf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8002c3:	48 8b 80 08 00 58 00 	mov    0x580008(%rax),%rax
+  8002ca:	83 e0 02             	and    $0x2,%eax
+  8002cd:	48 85 c0             	test   %rax,%rax
+  8002d0:	74 49                	je     80031b <umain+0x2d8>
+		&& PTE_ADDR(uvpt[PGNUM(VA)]) == zero
+  8002d2:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8002d9:	ff ff ff 
+  8002dc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8002e0:	48 8b 80 00 00 58 00 	mov    0x580000(%rax),%rax
+  8002e7:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8002ed:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  8002f1:	75 28                	jne    80031b <umain+0x2d8>
+		&& VA[0] == 0 && VA[PGSIZE + 1] == 0 ? "right" : "wrong");
+  8002f3:	b8 00 00 00 b0       	mov    $0xb0000000,%eax
+  8002f8:	0f b6 00             	movzbl (%rax),%eax
+  8002fb:	84 c0                	test   %al,%al
+  8002fd:	75 1c                	jne    80031b <umain+0x2d8>
+  8002ff:	b8 01 10 00 b0       	mov    $0xb0001001,%eax
+  800304:	0f b6 00             	movzbl (%rax),%eax
+  800307:	84 c0                	test   %al,%al
+  800309:	75 10                	jne    80031b <umain+0x2d8>
+	cprintf("a write allocates a page %s\n",
+  80030b:	48 b8 ef e0 ff ff ff 	movabs $0xffffffffffffe0ef,%rax
+  800312:	ff ff ff 
+  800315:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800319:	eb 0e                	jmp    800329 <umain+0x2e6>
+  80031b:	48 b8 e9 e0 ff ff ff 	movabs $0xffffffffffffe0e9,%rax
+  800322:	ff ff ff 
+  800325:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800329:	48 89 c6             	mov    %rax,%rsi
+  80032c:	48 b8 13 e1 ff ff ff 	movabs $0xffffffffffffe113,%rax
+  800333:	ff ff ff 
+  800336:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80033a:	48 89 c7             	mov    %rax,%rdi
+  80033d:	49 89 df             	mov    %rbx,%r15
+  800340:	b8 00 00 00 00       	mov    $0x0,%eax
+  800345:	48 ba ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%rdx
+  80034c:	ff ff ff 
+  80034f:	48 01 da             	add    %rbx,%rdx
+  800352:	ff d2                	call   *%rdx
+
+	// Neither the child's writes nor its reads may show up here.
+	if ((r = fork()) < 0)
+  800354:	49 89 df             	mov    %rbx,%r15
+  800357:	48 b8 fa a2 ff ff ff 	movabs $0xffffffffffffa2fa,%rax
+  80035e:	ff ff ff 
+  800361:	48 01 d8             	add    %rbx,%rax
+  800364:	ff d0                	call   *%rax
+  800366:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800369:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80036d:	79 44                	jns    8003b3 <umain+0x370>
+		panic("fork: %e", r);
+  80036f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800372:	89 c1                	mov    %eax,%ecx
+  800374:	48 b8 30 e1 ff ff ff 	movabs $0xffffffffffffe130,%rax
+  80037b:	ff ff ff 
+  80037e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800382:	48 89 c2             	mov    %rax,%rdx
+  800385:	be 28 00 00 00       	mov    $0x28,%esi
+  80038a:	48 b8 9b e0 ff ff ff 	movabs $0xffffffffffffe09b,%rax
+  800391:	ff ff ff 
+  800394:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800398:	48 89 c7             	mov    %rax,%rdi
+  80039b:	49 89 df             	mov    %rbx,%r15
+  80039e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a3:	49 b8 16 76 ff ff ff 	movabs $0xffffffffffff7616,%r8
+  8003aa:	ff ff ff 
+  8003ad:	49 01 d8             	add    %rbx,%r8
+  8003b0:	41 ff d0             	call   *%r8
+	if (r == 0) {
+  8003b3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8003b7:	75 6c                	jne    800425 <umain+0x3e2>
+		if (VA[PGSIZE] != 'p')
+  8003b9:	b8 00 10 00 b0       	mov    $0xb0001000,%eax
+  8003be:	0f b6 00             	movzbl (%rax),%eax
+  8003c1:	3c 70                	cmp    $0x70,%al
+  8003c3:	74 3e                	je     800403 <umain+0x3c0>
+			panic("child does not see parent's write");
+  8003c5:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  8003cc:	ff ff ff 
+  8003cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003d3:	48 89 c2             	mov    %rax,%rdx
+  8003d6:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8003db:	48 b8 9b e0 ff ff ff 	movabs $0xffffffffffffe09b,%rax
+  8003e2:	ff ff ff 
+  8003e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003e9:	48 89 c7             	mov    %rax,%rdi
+  8003ec:	49 89 df             	mov    %rbx,%r15
+  8003ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f4:	48 b9 16 76 ff ff ff 	movabs $0xffffffffffff7616,%rcx
+  8003fb:	ff ff ff 
+  8003fe:	48 01 d9             	add    %rbx,%rcx
+  800401:	ff d1                	call   *%rcx
+		VA[0] = 'c';
+  800403:	b8 00 00 00 b0       	mov    $0xb0000000,%eax
+  800408:	c6 00 63             	movb   $0x63,(%rax)
+		VA[PGSIZE] = 'c';
+  80040b:	b8 00 10 00 b0       	mov    $0xb0001000,%eax
+  800410:	c6 00 63             	movb   $0x63,(%rax)
+		exit();
+  800413:	49 89 df             	mov    %rbx,%r15
+  800416:	48 b8 cc 75 ff ff ff 	movabs $0xffffffffffff75cc,%rax
+  80041d:	ff ff ff 
+  800420:	48 01 d8             	add    %rbx,%rax
+  800423:	ff d0                	call   *%rax
+	}
+	wait(r);
+  800425:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800428:	89 c7                	mov    %eax,%edi
+  80042a:	49 89 df             	mov    %rbx,%r15
+  80042d:	48 b8 ce d1 ff ff ff 	movabs $0xffffffffffffd1ce,%rax
+  800434:	ff ff ff 
+  800437:	48 01 d8             	add    %rbx,%rax
+  80043a:	ff d0                	call   *%rax
+	cprintf("fork handles lazy pages %s\n",
+		VA[0] == 0 && VA[PGSIZE] == 'p'
+  80043c:	b8 00 00 00 b0       	mov    $0xb0000000,%eax
+  800441:	0f b6 00             	movzbl (%rax),%eax
+	cprintf("fork handles lazy pages %s\n",
+  800444:	84 c0                	test   %al,%al
+  800446:	75 3d                	jne    800485 <umain+0x442>
+		VA[0] == 0 && VA[PGSIZE] == 'p'
+  800448:	b8 00 10 00 b0       	mov    $0xb0001000,%eax
+  80044d:	0f b6 00             	movzbl (%rax),%eax
+  800450:	3c 70                	cmp    $0x70,%al
+  800452:	75 31                	jne    800485 <umain+0x442>
+		&& PTE_ADDR(uvpt[PGNUM(VA)]) == zero ? "right" : "wrong");
+  800454:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80045b:	ff ff ff 
+  80045e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800462:	48 8b 80 00 00 58 00 	mov    0x580000(%rax),%rax
+  800469:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80046f:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  800473:	75 10                	jne    800485 <umain+0x442>
+	cprintf("fork handles lazy pages %s\n",
+  800475:	48 b8 ef e0 ff ff ff 	movabs $0xffffffffffffe0ef,%rax
+  80047c:	ff ff ff 
+  80047f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800483:	eb 0e                	jmp    800493 <umain+0x450>
+  800485:	48 b8 e9 e0 ff ff ff 	movabs $0xffffffffffffe0e9,%rax
+  80048c:	ff ff ff 
+  80048f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800493:	48 89 c6             	mov    %rax,%rsi
+  800496:	48 b8 62 e1 ff ff ff 	movabs $0xffffffffffffe162,%rax
+  80049d:	ff ff ff 
+  8004a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004a4:	48 89 c7             	mov    %rax,%rdi
+  8004a7:	49 89 df             	mov    %rbx,%r15
+  8004aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004af:	48 ba ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%rdx
+  8004b6:	ff ff ff 
+  8004b9:	48 01 da             	add    %rbx,%rdx
+  8004bc:	ff d2                	call   *%rdx
+
+	r = sys_page_map(0, VA, 0, VA + NPAGES * PGSIZE,
+  8004be:	41 b8 05 10 00 00    	mov    $0x1005,%r8d
+  8004c4:	b8 00 00 01 b0       	mov    $0xb0010000,%eax
+  8004c9:	48 89 c1             	mov    %rax,%rcx
+  8004cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d1:	b8 00 00 00 b0       	mov    $0xb0000000,%eax
+  8004d6:	48 89 c6             	mov    %rax,%rsi
+  8004d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004de:	49 89 df             	mov    %rbx,%r15
+  8004e1:	48 b8 d0 93 ff ff ff 	movabs $0xffffffffffff93d0,%rax
+  8004e8:	ff ff ff 
+  8004eb:	48 01 d8             	add    %rbx,%rax
+  8004ee:	ff d0                	call   *%rax
+  8004f0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 PTE_P|PTE_U|PTE_LAZY);
+	cprintf("PTE_LAZY only for allocation %s\n",
+  8004f3:	83 7d dc fd          	cmpl   $0xfffffffd,-0x24(%rbp)
+  8004f7:	75 10                	jne    800509 <umain+0x4c6>
+  8004f9:	48 b8 ef e0 ff ff ff 	movabs $0xffffffffffffe0ef,%rax
+  800500:	ff ff ff 
+  800503:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800507:	eb 0e                	jmp    800517 <umain+0x4d4>
+  800509:	48 b8 e9 e0 ff ff ff 	movabs $0xffffffffffffe0e9,%rax
+  800510:	ff ff ff 
+  800513:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800517:	48 89 c6             	mov    %rax,%rsi
+  80051a:	48 b8 80 e1 ff ff ff 	movabs $0xffffffffffffe180,%rax
+  800521:	ff ff ff 
+  800524:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800528:	48 89 c7             	mov    %rax,%rdi
+  80052b:	49 89 df             	mov    %rbx,%r15
+  80052e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800533:	48 ba ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%rdx
+  80053a:	ff ff ff 
+  80053d:	48 01 da             	add    %rbx,%rdx
+  800540:	ff d2                	call   *%rdx
+		r == -E_INVAL ? "right" : "wrong");
+}
+  800542:	90                   	nop
+  800543:	48 83 c4 30          	add    $0x30,%rsp
+  800547:	5b                   	pop    %rbx
+  800548:	41 5f                	pop    %r15
+  80054a:	5d                   	pop    %rbp
+  80054b:	c3                   	ret
+
+000000000080054c <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80054c:	55                   	push   %rbp
+  80054d:	48 89 e5             	mov    %rsp,%rbp
+  800550:	41 57                	push   %r15
+  800552:	53                   	push   %rbx
+  800553:	48 83 ec 20          	sub    $0x20,%rsp
+  800557:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800557 <libmain+0xb>
+  80055e:	49 bb e9 8a 00 00 00 	movabs $0x8ae9,%r11
+  800565:	00 00 00 
+  800568:	4c 01 db             	add    %r11,%rbx
+  80056b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80056e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800572:	49 89 df             	mov    %rbx,%r15
+  800575:	48 b8 c2 92 ff ff ff 	movabs $0xffffffffffff92c2,%rax
+  80057c:	ff ff ff 
+  80057f:	48 01 d8             	add    %rbx,%rax
+  800582:	ff d0                	call   *%rax
+  800584:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800587:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80058a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80058f:	48 98                	cltq
+  800591:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800598:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80059f:	ff ff ff 
+  8005a2:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8005a6:	48 01 c2             	add    %rax,%rdx
+  8005a9:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8005b0:	00 00 00 
+  8005b3:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8005b7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8005bb:	7e 15                	jle    8005d2 <libmain+0x86>
+		binaryname = argv[0];
+  8005bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8005c1:	48 8b 00             	mov    (%rax),%rax
+  8005c4:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  8005cb:	00 00 00 
+  8005ce:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8005d2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8005d6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8005d9:	48 89 d6             	mov    %rdx,%rsi
+  8005dc:	89 c7                	mov    %eax,%edi
+  8005de:	49 89 df             	mov    %rbx,%r15
+  8005e1:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  8005e8:	ff ff ff 
+  8005eb:	48 01 d8             	add    %rbx,%rax
+  8005ee:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8005f0:	49 89 df             	mov    %rbx,%r15
+  8005f3:	48 b8 cc 75 ff ff ff 	movabs $0xffffffffffff75cc,%rax
+  8005fa:	ff ff ff 
+  8005fd:	48 01 d8             	add    %rbx,%rax
+  800600:	ff d0                	call   *%rax
+}
+  800602:	90                   	nop
+  800603:	48 83 c4 20          	add    $0x20,%rsp
+  800607:	5b                   	pop    %rbx
+  800608:	41 5f                	pop    %r15
+  80060a:	5d                   	pop    %rbp
+  80060b:	c3                   	ret
+
+000000000080060c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80060c:	55                   	push   %rbp
+  80060d:	48 89 e5             	mov    %rsp,%rbp
+  800610:	41 57                	push   %r15
+  800612:	53                   	push   %rbx
+  800613:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800613 <exit+0x7>
+  80061a:	49 bb 2d 8a 00 00 00 	movabs $0x8a2d,%r11
+  800621:	00 00 00 
+  800624:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800627:	49 89 df             	mov    %rbx,%r15
+  80062a:	48 b8 cb aa ff ff ff 	movabs $0xffffffffffffaacb,%rax
+  800631:	ff ff ff 
+  800634:	48 01 d8             	add    %rbx,%rax
+  800637:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800639:	bf 00 00 00 00       	mov    $0x0,%edi
+  80063e:	49 89 df             	mov    %rbx,%r15
+  800641:	48 b8 66 92 ff ff ff 	movabs $0xffffffffffff9266,%rax
+  800648:	ff ff ff 
+  80064b:	48 01 d8             	add    %rbx,%rax
+  80064e:	ff d0                	call   *%rax
+}
+  800650:	90                   	nop
+  800651:	5b                   	pop    %rbx
+  800652:	41 5f                	pop    %r15
+  800654:	5d                   	pop    %rbp
+  800655:	c3                   	ret
+
+0000000000800656 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800656:	55                   	push   %rbp
+  800657:	48 89 e5             	mov    %rsp,%rbp
+  80065a:	41 57                	push   %r15
+  80065c:	41 54                	push   %r12
+  80065e:	53                   	push   %rbx
+  80065f:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800666:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800666 <_panic+0x10>
+  80066d:	49 bb da 89 00 00 00 	movabs $0x89da,%r11
+  800674:	00 00 00 
+  800677:	4c 01 db             	add    %r11,%rbx
+  80067a:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800681:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800687:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80068e:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800695:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80069c:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8006a3:	84 c0                	test   %al,%al
+  8006a5:	74 26                	je     8006cd <_panic+0x77>
+  8006a7:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8006ae:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8006b5:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8006b9:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8006bd:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8006c1:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8006c5:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8006c9:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8006cd:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8006d4:	00 00 00 
+  8006d7:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8006de:	00 00 00 
+  8006e1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006e5:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8006ec:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8006f3:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8006fa:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800701:	ff ff ff 
+  800704:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800708:	4c 8b 20             	mov    (%rax),%r12
+  80070b:	49 89 df             	mov    %rbx,%r15
+  80070e:	48 b8 c2 92 ff ff ff 	movabs $0xffffffffffff92c2,%rax
+  800715:	ff ff ff 
+  800718:	48 01 d8             	add    %rbx,%rax
+  80071b:	ff d0                	call   *%rax
+  80071d:	89 c6                	mov    %eax,%esi
+  80071f:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800725:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80072c:	41 89 d0             	mov    %edx,%r8d
+  80072f:	48 89 c1             	mov    %rax,%rcx
+  800732:	4c 89 e2             	mov    %r12,%rdx
+  800735:	48 b8 b0 e1 ff ff ff 	movabs $0xffffffffffffe1b0,%rax
+  80073c:	ff ff ff 
+  80073f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800743:	48 89 c7             	mov    %rax,%rdi
+  800746:	49 89 df             	mov    %rbx,%r15
+  800749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074e:	49 b9 ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%r9
+  800755:	ff ff ff 
+  800758:	49 01 d9             	add    %rbx,%r9
+  80075b:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80075e:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800765:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80076c:	48 89 d6             	mov    %rdx,%rsi
+  80076f:	48 89 c7             	mov    %rax,%rdi
+  800772:	49 89 df             	mov    %rbx,%r15
+  800775:	48 b8 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%rax
+  80077c:	ff ff ff 
+  80077f:	48 01 d8             	add    %rbx,%rax
+  800782:	ff d0                	call   *%rax
+	cprintf("\n");
+  800784:	48 b8 d3 e1 ff ff ff 	movabs $0xffffffffffffe1d3,%rax
+  80078b:	ff ff ff 
+  80078e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800792:	48 89 c7             	mov    %rax,%rdi
+  800795:	49 89 df             	mov    %rbx,%r15
+  800798:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079d:	48 ba ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%rdx
+  8007a4:	ff ff ff 
+  8007a7:	48 01 da             	add    %rbx,%rdx
+  8007aa:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8007ac:	cc                   	int3
+  8007ad:	eb fd                	jmp    8007ac <_panic+0x156>
+
+00000000008007af <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8007af:	55                   	push   %rbp
+  8007b0:	48 89 e5             	mov    %rsp,%rbp
+  8007b3:	41 57                	push   %r15
+  8007b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8007b9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007b9 <putch+0xa>
+  8007c0:	49 bb 87 88 00 00 00 	movabs $0x8887,%r11
+  8007c7:	00 00 00 
+  8007ca:	4c 01 d8             	add    %r11,%rax
+  8007cd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8007d0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8007d4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007d8:	8b 12                	mov    (%rdx),%edx
+  8007da:	8d 72 01             	lea    0x1(%rdx),%esi
+  8007dd:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8007e1:	89 31                	mov    %esi,(%rcx)
+  8007e3:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8007e6:	89 ce                	mov    %ecx,%esi
+  8007e8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8007ec:	48 63 d2             	movslq %edx,%rdx
+  8007ef:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8007f4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007f8:	8b 12                	mov    (%rdx),%edx
+  8007fa:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800800:	75 33                	jne    800835 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800802:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800806:	8b 12                	mov    (%rdx),%edx
+  800808:	48 63 d2             	movslq %edx,%rdx
+  80080b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80080f:	48 83 c1 08          	add    $0x8,%rcx
+  800813:	48 89 d6             	mov    %rdx,%rsi
+  800816:	48 89 cf             	mov    %rcx,%rdi
+  800819:	49 89 c7             	mov    %rax,%r15
+  80081c:	48 ba b3 91 ff ff ff 	movabs $0xffffffffffff91b3,%rdx
+  800823:	ff ff ff 
+  800826:	48 01 c2             	add    %rax,%rdx
+  800829:	ff d2                	call   *%rdx
+        b->idx = 0;
+  80082b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80082f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800835:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800839:	8b 40 04             	mov    0x4(%rax),%eax
+  80083c:	8d 50 01             	lea    0x1(%rax),%edx
+  80083f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800843:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800846:	90                   	nop
+  800847:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80084b:	c9                   	leave
+  80084c:	c3                   	ret
+
+000000000080084d <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  80084d:	55                   	push   %rbp
+  80084e:	48 89 e5             	mov    %rsp,%rbp
+  800851:	41 57                	push   %r15
+  800853:	53                   	push   %rbx
+  800854:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80085b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80085b <vcprintf+0xe>
+  800862:	49 bb e5 87 00 00 00 	movabs $0x87e5,%r11
+  800869:	00 00 00 
+  80086c:	4c 01 db             	add    %r11,%rbx
+  80086f:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800876:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  80087d:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800884:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  80088b:	48 8b 06             	mov    (%rsi),%rax
+  80088e:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800892:	48 89 01             	mov    %rax,(%rcx)
+  800895:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800899:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80089d:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8008a1:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8008a8:	00 00 00 
+    b.cnt = 0;
+  8008ab:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8008b2:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8008b5:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8008bc:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8008c3:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8008ca:	48 89 c6             	mov    %rax,%rsi
+  8008cd:	48 b8 6f 77 ff ff ff 	movabs $0xffffffffffff776f,%rax
+  8008d4:	ff ff ff 
+  8008d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008db:	48 89 c7             	mov    %rax,%rdi
+  8008de:	49 89 df             	mov    %rbx,%r15
+  8008e1:	48 b8 31 7d ff ff ff 	movabs $0xffffffffffff7d31,%rax
+  8008e8:	ff ff ff 
+  8008eb:	48 01 d8             	add    %rbx,%rax
+  8008ee:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8008f0:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8008f6:	48 98                	cltq
+  8008f8:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8008ff:	48 83 c2 08          	add    $0x8,%rdx
+  800903:	48 89 c6             	mov    %rax,%rsi
+  800906:	48 89 d7             	mov    %rdx,%rdi
+  800909:	49 89 df             	mov    %rbx,%r15
+  80090c:	48 b8 b3 91 ff ff ff 	movabs $0xffffffffffff91b3,%rax
+  800913:	ff ff ff 
+  800916:	48 01 d8             	add    %rbx,%rax
+  800919:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  80091b:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800921:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800928:	5b                   	pop    %rbx
+  800929:	41 5f                	pop    %r15
+  80092b:	5d                   	pop    %rbp
+  80092c:	c3                   	ret
+
+000000000080092d <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  80092d:	55                   	push   %rbp
+  80092e:	48 89 e5             	mov    %rsp,%rbp
+  800931:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800938:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800938 <cprintf+0xb>
+  80093f:	49 bb 08 87 00 00 00 	movabs $0x8708,%r11
+  800946:	00 00 00 
+  800949:	4d 01 da             	add    %r11,%r10
+  80094c:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800953:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80095a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800961:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800968:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80096f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800976:	84 c0                	test   %al,%al
+  800978:	74 20                	je     80099a <cprintf+0x6d>
+  80097a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80097e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800982:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800986:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80098a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80098e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800992:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800996:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  80099a:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8009a1:	00 00 00 
+  8009a4:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8009ab:	00 00 00 
+  8009ae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8009b2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8009b9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8009c0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8009c7:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8009ce:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8009d5:	48 8b 06             	mov    (%rsi),%rax
+  8009d8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8009dc:	48 89 01             	mov    %rax,(%rcx)
+  8009df:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8009e3:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8009e7:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8009eb:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8009f2:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8009f9:	48 89 d6             	mov    %rdx,%rsi
+  8009fc:	48 89 c7             	mov    %rax,%rdi
+  8009ff:	48 b8 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%rax
+  800a06:	ff ff ff 
+  800a09:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800a0d:	ff d0                	call   *%rax
+  800a0f:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800a15:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800a1b:	c9                   	leave
+  800a1c:	c3                   	ret
+
+0000000000800a1d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800a1d:	55                   	push   %rbp
+  800a1e:	48 89 e5             	mov    %rsp,%rbp
+  800a21:	53                   	push   %rbx
+  800a22:	48 83 ec 38          	sub    $0x38,%rsp
+  800a26:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800a26 <printnum+0x9>
+  800a2d:	49 bb 1a 86 00 00 00 	movabs $0x861a,%r11
+  800a34:	00 00 00 
+  800a37:	4c 01 db             	add    %r11,%rbx
+  800a3a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a3e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800a42:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800a46:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800a49:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800a4d:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800a51:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800a54:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800a58:	72 58                	jb     800ab2 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800a5a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800a5d:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800a60:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800a63:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a6c:	48 f7 f6             	div    %rsi
+  800a6f:	49 89 c2             	mov    %rax,%r10
+  800a72:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800a75:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800a78:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800a7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a80:	41 89 c9             	mov    %ecx,%r9d
+  800a83:	41 89 f8             	mov    %edi,%r8d
+  800a86:	89 d1                	mov    %edx,%ecx
+  800a88:	4c 89 d2             	mov    %r10,%rdx
+  800a8b:	48 89 c7             	mov    %rax,%rdi
+  800a8e:	48 b8 dd 79 ff ff ff 	movabs $0xffffffffffff79dd,%rax
+  800a95:	ff ff ff 
+  800a98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a9c:	ff d0                	call   *%rax
+  800a9e:	eb 1c                	jmp    800abc <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800aa0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800aa4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800aa7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800aab:	48 89 d6             	mov    %rdx,%rsi
+  800aae:	89 c7                	mov    %eax,%edi
+  800ab0:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800ab2:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800ab6:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800aba:	7f e4                	jg     800aa0 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800abc:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800abf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ac3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ac8:	48 f7 f1             	div    %rcx
+  800acb:	48 b8 0f e3 ff ff ff 	movabs $0xffffffffffffe30f,%rax
+  800ad2:	ff ff ff 
+  800ad5:	48 01 d8             	add    %rbx,%rax
+  800ad8:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800adc:	0f be c0             	movsbl %al,%eax
+  800adf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800ae3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800ae7:	48 89 d6             	mov    %rdx,%rsi
+  800aea:	89 c7                	mov    %eax,%edi
+  800aec:	ff d1                	call   *%rcx
+}
+  800aee:	90                   	nop
+  800aef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800af3:	c9                   	leave
+  800af4:	c3                   	ret
+
+0000000000800af5 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800af5:	55                   	push   %rbp
+  800af6:	48 89 e5             	mov    %rsp,%rbp
+  800af9:	48 83 ec 20          	sub    $0x20,%rsp
+  800afd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800afd <getuint+0x8>
+  800b04:	49 bb 43 85 00 00 00 	movabs $0x8543,%r11
+  800b0b:	00 00 00 
+  800b0e:	4c 01 d8             	add    %r11,%rax
+  800b11:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b15:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800b18:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800b1c:	7e 4f                	jle    800b6d <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800b1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b22:	8b 00                	mov    (%rax),%eax
+  800b24:	83 f8 2f             	cmp    $0x2f,%eax
+  800b27:	77 24                	ja     800b4d <getuint+0x58>
+  800b29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b2d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b35:	8b 00                	mov    (%rax),%eax
+  800b37:	89 c0                	mov    %eax,%eax
+  800b39:	48 01 d0             	add    %rdx,%rax
+  800b3c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b40:	8b 12                	mov    (%rdx),%edx
+  800b42:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b45:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b49:	89 0a                	mov    %ecx,(%rdx)
+  800b4b:	eb 14                	jmp    800b61 <getuint+0x6c>
+  800b4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b51:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b55:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b59:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b5d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b61:	48 8b 00             	mov    (%rax),%rax
+  800b64:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b68:	e9 9d 00 00 00       	jmp    800c0a <getuint+0x115>
+	else if (lflag)
+  800b6d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800b71:	74 4c                	je     800bbf <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800b73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b77:	8b 00                	mov    (%rax),%eax
+  800b79:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7c:	77 24                	ja     800ba2 <getuint+0xad>
+  800b7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b82:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b8a:	8b 00                	mov    (%rax),%eax
+  800b8c:	89 c0                	mov    %eax,%eax
+  800b8e:	48 01 d0             	add    %rdx,%rax
+  800b91:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b95:	8b 12                	mov    (%rdx),%edx
+  800b97:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b9a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b9e:	89 0a                	mov    %ecx,(%rdx)
+  800ba0:	eb 14                	jmp    800bb6 <getuint+0xc1>
+  800ba2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800baa:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800bae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bb2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800bb6:	48 8b 00             	mov    (%rax),%rax
+  800bb9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800bbd:	eb 4b                	jmp    800c0a <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800bbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bc3:	8b 00                	mov    (%rax),%eax
+  800bc5:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc8:	77 24                	ja     800bee <getuint+0xf9>
+  800bca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bce:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800bd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bd6:	8b 00                	mov    (%rax),%eax
+  800bd8:	89 c0                	mov    %eax,%eax
+  800bda:	48 01 d0             	add    %rdx,%rax
+  800bdd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800be1:	8b 12                	mov    (%rdx),%edx
+  800be3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800be6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bea:	89 0a                	mov    %ecx,(%rdx)
+  800bec:	eb 14                	jmp    800c02 <getuint+0x10d>
+  800bee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bf2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800bf6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800bfa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bfe:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c02:	8b 00                	mov    (%rax),%eax
+  800c04:	89 c0                	mov    %eax,%eax
+  800c06:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800c0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800c0e:	c9                   	leave
+  800c0f:	c3                   	ret
+
+0000000000800c10 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800c10:	55                   	push   %rbp
+  800c11:	48 89 e5             	mov    %rsp,%rbp
+  800c14:	48 83 ec 20          	sub    $0x20,%rsp
+  800c18:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c18 <printfloat+0x8>
+  800c1f:	49 bb 28 84 00 00 00 	movabs $0x8428,%r11
+  800c26:	00 00 00 
+  800c29:	4c 01 d8             	add    %r11,%rax
+  800c2c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800c30:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800c34:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800c38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c3c:	48 85 c0             	test   %rax,%rax
+  800c3f:	79 12                	jns    800c53 <printfloat+0x43>
+		putch('-',putdat);
+  800c41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c45:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c49:	48 89 c6             	mov    %rax,%rsi
+  800c4c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c51:	ff d2                	call   *%rdx
+	
+}
+  800c53:	90                   	nop
+  800c54:	c9                   	leave
+  800c55:	c3                   	ret
+
+0000000000800c56 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800c56:	55                   	push   %rbp
+  800c57:	48 89 e5             	mov    %rsp,%rbp
+  800c5a:	48 83 ec 20          	sub    $0x20,%rsp
+  800c5e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c5e <getint+0x8>
+  800c65:	49 bb e2 83 00 00 00 	movabs $0x83e2,%r11
+  800c6c:	00 00 00 
+  800c6f:	4c 01 d8             	add    %r11,%rax
+  800c72:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c76:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800c79:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800c7d:	7e 4f                	jle    800cce <getint+0x78>
+		x=va_arg(*ap, long long);
+  800c7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c83:	8b 00                	mov    (%rax),%eax
+  800c85:	83 f8 2f             	cmp    $0x2f,%eax
+  800c88:	77 24                	ja     800cae <getint+0x58>
+  800c8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c8e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c96:	8b 00                	mov    (%rax),%eax
+  800c98:	89 c0                	mov    %eax,%eax
+  800c9a:	48 01 d0             	add    %rdx,%rax
+  800c9d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ca1:	8b 12                	mov    (%rdx),%edx
+  800ca3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ca6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800caa:	89 0a                	mov    %ecx,(%rdx)
+  800cac:	eb 14                	jmp    800cc2 <getint+0x6c>
+  800cae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cb2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800cb6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800cba:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cbe:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800cc2:	48 8b 00             	mov    (%rax),%rax
+  800cc5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800cc9:	e9 9d 00 00 00       	jmp    800d6b <getint+0x115>
+	else if (lflag)
+  800cce:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800cd2:	74 4c                	je     800d20 <getint+0xca>
+		x=va_arg(*ap, long);
+  800cd4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cd8:	8b 00                	mov    (%rax),%eax
+  800cda:	83 f8 2f             	cmp    $0x2f,%eax
+  800cdd:	77 24                	ja     800d03 <getint+0xad>
+  800cdf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ce3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ce7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ceb:	8b 00                	mov    (%rax),%eax
+  800ced:	89 c0                	mov    %eax,%eax
+  800cef:	48 01 d0             	add    %rdx,%rax
+  800cf2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cf6:	8b 12                	mov    (%rdx),%edx
+  800cf8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800cfb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cff:	89 0a                	mov    %ecx,(%rdx)
+  800d01:	eb 14                	jmp    800d17 <getint+0xc1>
+  800d03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d07:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d0b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d0f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d13:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d17:	48 8b 00             	mov    (%rax),%rax
+  800d1a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800d1e:	eb 4b                	jmp    800d6b <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800d20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d24:	8b 00                	mov    (%rax),%eax
+  800d26:	83 f8 2f             	cmp    $0x2f,%eax
+  800d29:	77 24                	ja     800d4f <getint+0xf9>
+  800d2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d2f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800d33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d37:	8b 00                	mov    (%rax),%eax
+  800d39:	89 c0                	mov    %eax,%eax
+  800d3b:	48 01 d0             	add    %rdx,%rax
+  800d3e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d42:	8b 12                	mov    (%rdx),%edx
+  800d44:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800d47:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d4b:	89 0a                	mov    %ecx,(%rdx)
+  800d4d:	eb 14                	jmp    800d63 <getint+0x10d>
+  800d4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d53:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d57:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d5b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d5f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d63:	8b 00                	mov    (%rax),%eax
+  800d65:	48 98                	cltq
+  800d67:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800d6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800d6f:	c9                   	leave
+  800d70:	c3                   	ret
+
+0000000000800d71 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800d71:	55                   	push   %rbp
+  800d72:	48 89 e5             	mov    %rsp,%rbp
+  800d75:	41 57                	push   %r15
+  800d77:	41 55                	push   %r13
+  800d79:	41 54                	push   %r12
+  800d7b:	53                   	push   %rbx
+  800d7c:	48 83 ec 60          	sub    $0x60,%rsp
+  800d80:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800d80 <vprintfmt+0xf>
+  800d87:	49 bb c0 82 00 00 00 	movabs $0x82c0,%r11
+  800d8e:	00 00 00 
+  800d91:	4d 01 dc             	add    %r11,%r12
+  800d94:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800d98:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800d9c:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800da0:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800da4:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800dab:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800daf:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800db3:	48 8b 06             	mov    (%rsi),%rax
+  800db6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800dba:	48 89 01             	mov    %rax,(%rcx)
+  800dbd:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800dc5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800dc9:	eb 17                	jmp    800de2 <vprintfmt+0x71>
+			if (ch == '\0')
+  800dcb:	85 db                	test   %ebx,%ebx
+  800dcd:	0f 84 97 05 00 00    	je     80136a <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800dd3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dd7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ddb:	48 89 c6             	mov    %rax,%rsi
+  800dde:	89 df                	mov    %ebx,%edi
+  800de0:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800de2:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800de6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800dea:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800dee:	0f b6 00             	movzbl (%rax),%eax
+  800df1:	0f b6 d8             	movzbl %al,%ebx
+  800df4:	83 fb 25             	cmp    $0x25,%ebx
+  800df7:	75 d2                	jne    800dcb <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800df9:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800dfd:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800e04:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800e0b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800e12:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800e19:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800e1d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800e21:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800e25:	0f b6 00             	movzbl (%rax),%eax
+  800e28:	0f b6 d8             	movzbl %al,%ebx
+  800e2b:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800e2e:	83 f8 55             	cmp    $0x55,%eax
+  800e31:	0f 87 00 05 00 00    	ja     801337 <vprintfmt+0x5c6>
+  800e37:	89 c0                	mov    %eax,%eax
+  800e39:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800e40:	00 
+  800e41:	48 8d 05 30 65 00 00 	lea    0x6530(%rip),%rax        # 807378 <.LC18+0xc>
+  800e48:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800e4c:	48 8d 15 25 65 00 00 	lea    0x6525(%rip),%rdx        # 807378 <.LC18+0xc>
+  800e53:	48 01 d0             	add    %rdx,%rax
+  800e56:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800e58:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800e5c:	eb bb                	jmp    800e19 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800e5e:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800e62:	eb b5                	jmp    800e19 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800e64:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800e6b:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800e6e:	89 d0                	mov    %edx,%eax
+  800e70:	c1 e0 02             	shl    $0x2,%eax
+  800e73:	01 d0                	add    %edx,%eax
+  800e75:	01 c0                	add    %eax,%eax
+  800e77:	01 d8                	add    %ebx,%eax
+  800e79:	83 e8 30             	sub    $0x30,%eax
+  800e7c:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800e7f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800e83:	0f b6 00             	movzbl (%rax),%eax
+  800e86:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800e89:	83 fb 2f             	cmp    $0x2f,%ebx
+  800e8c:	7e 60                	jle    800eee <vprintfmt+0x17d>
+  800e8e:	83 fb 39             	cmp    $0x39,%ebx
+  800e91:	7f 5b                	jg     800eee <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800e93:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800e98:	eb d1                	jmp    800e6b <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800e9a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e9d:	83 f8 2f             	cmp    $0x2f,%eax
+  800ea0:	77 17                	ja     800eb9 <vprintfmt+0x148>
+  800ea2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ea6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ea9:	89 d2                	mov    %edx,%edx
+  800eab:	48 01 d0             	add    %rdx,%rax
+  800eae:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800eb1:	83 c2 08             	add    $0x8,%edx
+  800eb4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800eb7:	eb 0c                	jmp    800ec5 <vprintfmt+0x154>
+  800eb9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ebd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ec1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ec5:	8b 00                	mov    (%rax),%eax
+  800ec7:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800eca:	eb 23                	jmp    800eef <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800ecc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ed0:	0f 89 43 ff ff ff    	jns    800e19 <vprintfmt+0xa8>
+				width = 0;
+  800ed6:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800edd:	e9 37 ff ff ff       	jmp    800e19 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800ee2:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800ee9:	e9 2b ff ff ff       	jmp    800e19 <vprintfmt+0xa8>
+			goto process_precision;
+  800eee:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800eef:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ef3:	0f 89 20 ff ff ff    	jns    800e19 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800ef9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800efc:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800eff:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800f06:	e9 0e ff ff ff       	jmp    800e19 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800f0b:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800f0f:	e9 05 ff ff ff       	jmp    800e19 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800f14:	83 fb 39             	cmp    $0x39,%ebx
+  800f17:	7f 0b                	jg     800f24 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800f19:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800f1c:	c1 e0 08             	shl    $0x8,%eax
+  800f1f:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800f22:	eb 21                	jmp    800f45 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800f24:	83 fb 60             	cmp    $0x60,%ebx
+  800f27:	7e 10                	jle    800f39 <vprintfmt+0x1c8>
+  800f29:	83 fb 66             	cmp    $0x66,%ebx
+  800f2c:	7f 0b                	jg     800f39 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800f2e:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800f31:	c1 e0 08             	shl    $0x8,%eax
+  800f34:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800f37:	eb 0c                	jmp    800f45 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800f39:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800f40:	e9 04 01 00 00       	jmp    801049 <vprintfmt+0x2d8>
+  800f45:	e9 ff 00 00 00       	jmp    801049 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800f4a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800f50:	77 17                	ja     800f69 <vprintfmt+0x1f8>
+  800f52:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f56:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f59:	89 d2                	mov    %edx,%edx
+  800f5b:	48 01 d0             	add    %rdx,%rax
+  800f5e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f61:	83 c2 08             	add    $0x8,%edx
+  800f64:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f67:	eb 0c                	jmp    800f75 <vprintfmt+0x204>
+  800f69:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f6d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f71:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f75:	8b 00                	mov    (%rax),%eax
+  800f77:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800f7b:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800f7f:	48 89 d6             	mov    %rdx,%rsi
+  800f82:	89 c7                	mov    %eax,%edi
+  800f84:	ff d1                	call   *%rcx
+			break;
+  800f86:	e9 da 03 00 00       	jmp    801365 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800f8b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f8e:	83 f8 2f             	cmp    $0x2f,%eax
+  800f91:	77 17                	ja     800faa <vprintfmt+0x239>
+  800f93:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f97:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f9a:	89 d2                	mov    %edx,%edx
+  800f9c:	48 01 d0             	add    %rdx,%rax
+  800f9f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800fa2:	83 c2 08             	add    $0x8,%edx
+  800fa5:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800fa8:	eb 0c                	jmp    800fb6 <vprintfmt+0x245>
+  800faa:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800fae:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800fb2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800fb6:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800fb8:	85 db                	test   %ebx,%ebx
+  800fba:	79 02                	jns    800fbe <vprintfmt+0x24d>
+				err = -err;
+  800fbc:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800fbe:	83 fb 15             	cmp    $0x15,%ebx
+  800fc1:	7f 19                	jg     800fdc <vprintfmt+0x26b>
+  800fc3:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800fca:	00 00 00 
+  800fcd:	48 63 c3             	movslq %ebx,%rax
+  800fd0:	4c 01 e2             	add    %r12,%rdx
+  800fd3:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800fd7:	4d 85 ed             	test   %r13,%r13
+  800fda:	75 36                	jne    801012 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800fdc:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800fe0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800fe4:	89 d9                	mov    %ebx,%ecx
+  800fe6:	48 ba 20 e3 ff ff ff 	movabs $0xffffffffffffe320,%rdx
+  800fed:	ff ff ff 
+  800ff0:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800ff4:	48 89 c7             	mov    %rax,%rdi
+  800ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ffc:	49 b8 38 83 ff ff ff 	movabs $0xffffffffffff8338,%r8
+  801003:	ff ff ff 
+  801006:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  80100a:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  80100d:	e9 53 03 00 00       	jmp    801365 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  801012:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801016:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80101a:	4c 89 e9             	mov    %r13,%rcx
+  80101d:	48 ba 29 e3 ff ff ff 	movabs $0xffffffffffffe329,%rdx
+  801024:	ff ff ff 
+  801027:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  80102b:	48 89 c7             	mov    %rax,%rdi
+  80102e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801033:	49 b8 38 83 ff ff ff 	movabs $0xffffffffffff8338,%r8
+  80103a:	ff ff ff 
+  80103d:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  801041:	41 ff d0             	call   *%r8
+			break;
+  801044:	e9 1c 03 00 00       	jmp    801365 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  801049:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80104c:	83 f8 2f             	cmp    $0x2f,%eax
+  80104f:	77 17                	ja     801068 <vprintfmt+0x2f7>
+  801051:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801055:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801058:	89 d2                	mov    %edx,%edx
+  80105a:	48 01 d0             	add    %rdx,%rax
+  80105d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801060:	83 c2 08             	add    $0x8,%edx
+  801063:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801066:	eb 0c                	jmp    801074 <vprintfmt+0x303>
+  801068:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80106c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801070:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801074:	4c 8b 28             	mov    (%rax),%r13
+  801077:	4d 85 ed             	test   %r13,%r13
+  80107a:	75 0e                	jne    80108a <vprintfmt+0x319>
+				p = "(null)";
+  80107c:	48 b8 2c e3 ff ff ff 	movabs $0xffffffffffffe32c,%rax
+  801083:	ff ff ff 
+  801086:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  80108a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80108e:	0f 8e 84 00 00 00    	jle    801118 <vprintfmt+0x3a7>
+  801094:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  801098:	74 7e                	je     801118 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80109a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80109d:	48 98                	cltq
+  80109f:	48 89 c6             	mov    %rax,%rsi
+  8010a2:	4c 89 ef             	mov    %r13,%rdi
+  8010a5:	4d 89 e7             	mov    %r12,%r15
+  8010a8:	48 b8 5d 86 ff ff ff 	movabs $0xffffffffffff865d,%rax
+  8010af:	ff ff ff 
+  8010b2:	4c 01 e0             	add    %r12,%rax
+  8010b5:	ff d0                	call   *%rax
+  8010b7:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  8010ba:	eb 17                	jmp    8010d3 <vprintfmt+0x362>
+					putch(padc, putdat);
+  8010bc:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  8010c0:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  8010c4:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8010c8:	48 89 d6             	mov    %rdx,%rsi
+  8010cb:	89 c7                	mov    %eax,%edi
+  8010cd:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8010cf:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8010d3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8010d7:	7f e3                	jg     8010bc <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8010d9:	eb 3d                	jmp    801118 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8010db:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8010df:	74 1e                	je     8010ff <vprintfmt+0x38e>
+  8010e1:	83 fb 1f             	cmp    $0x1f,%ebx
+  8010e4:	7e 05                	jle    8010eb <vprintfmt+0x37a>
+  8010e6:	83 fb 7e             	cmp    $0x7e,%ebx
+  8010e9:	7e 14                	jle    8010ff <vprintfmt+0x38e>
+					putch('?', putdat);
+  8010eb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010ef:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010f3:	48 89 c6             	mov    %rax,%rsi
+  8010f6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8010fb:	ff d2                	call   *%rdx
+  8010fd:	eb 15                	jmp    801114 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  8010ff:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801102:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  801105:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801109:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80110d:	48 89 c6             	mov    %rax,%rsi
+  801110:	89 cf                	mov    %ecx,%edi
+  801112:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801114:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801118:	4c 89 e8             	mov    %r13,%rax
+  80111b:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  80111f:	0f b6 00             	movzbl (%rax),%eax
+  801122:	0f be d8             	movsbl %al,%ebx
+  801125:	85 db                	test   %ebx,%ebx
+  801127:	74 28                	je     801151 <vprintfmt+0x3e0>
+  801129:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80112d:	78 ac                	js     8010db <vprintfmt+0x36a>
+  80112f:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  801133:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801137:	79 a2                	jns    8010db <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  801139:	eb 16                	jmp    801151 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  80113b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80113f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801143:	48 89 c6             	mov    %rax,%rsi
+  801146:	bf 20 00 00 00       	mov    $0x20,%edi
+  80114b:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  80114d:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801151:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801155:	7f e4                	jg     80113b <vprintfmt+0x3ca>
+			break;
+  801157:	e9 09 02 00 00       	jmp    801365 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  80115c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801160:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801164:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801168:	0f b6 00             	movzbl (%rax),%eax
+  80116b:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  80116e:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  80116f:	83 fb 2f             	cmp    $0x2f,%ebx
+  801172:	0f 8e ac fd ff ff    	jle    800f24 <vprintfmt+0x1b3>
+  801178:	e9 97 fd ff ff       	jmp    800f14 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  80117d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801181:	be 03 00 00 00       	mov    $0x3,%esi
+  801186:	48 89 c7             	mov    %rax,%rdi
+  801189:	48 b8 16 7c ff ff ff 	movabs $0xffffffffffff7c16,%rax
+  801190:	ff ff ff 
+  801193:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801197:	ff d0                	call   *%rax
+  801199:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  80119d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011a1:	48 85 c0             	test   %rax,%rax
+  8011a4:	79 1d                	jns    8011c3 <vprintfmt+0x452>
+				putch('-', putdat);
+  8011a6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8011aa:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8011ae:	48 89 c6             	mov    %rax,%rsi
+  8011b1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8011b6:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  8011b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011bc:	48 f7 d8             	neg    %rax
+  8011bf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  8011c3:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8011ca:	e9 de 00 00 00       	jmp    8012ad <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  8011cf:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8011d3:	be 03 00 00 00       	mov    $0x3,%esi
+  8011d8:	48 89 c7             	mov    %rax,%rdi
+  8011db:	48 b8 b5 7a ff ff ff 	movabs $0xffffffffffff7ab5,%rax
+  8011e2:	ff ff ff 
+  8011e5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011e9:	ff d0                	call   *%rax
+  8011eb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  8011ef:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8011f6:	e9 b2 00 00 00       	jmp    8012ad <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  8011fb:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8011ff:	be 03 00 00 00       	mov    $0x3,%esi
+  801204:	48 89 c7             	mov    %rax,%rdi
+  801207:	48 b8 b5 7a ff ff ff 	movabs $0xffffffffffff7ab5,%rax
+  80120e:	ff ff ff 
+  801211:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801215:	ff d0                	call   *%rax
+  801217:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  80121b:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801222:	e9 86 00 00 00       	jmp    8012ad <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  801227:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80122b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80122f:	48 89 c6             	mov    %rax,%rsi
+  801232:	bf 30 00 00 00       	mov    $0x30,%edi
+  801237:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801239:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80123d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801241:	48 89 c6             	mov    %rax,%rsi
+  801244:	bf 78 00 00 00       	mov    $0x78,%edi
+  801249:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  80124b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80124e:	83 f8 2f             	cmp    $0x2f,%eax
+  801251:	77 17                	ja     80126a <vprintfmt+0x4f9>
+  801253:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801257:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80125a:	89 d2                	mov    %edx,%edx
+  80125c:	48 01 d0             	add    %rdx,%rax
+  80125f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801262:	83 c2 08             	add    $0x8,%edx
+  801265:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801268:	eb 0c                	jmp    801276 <vprintfmt+0x505>
+  80126a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80126e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801272:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801276:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801279:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  80127d:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801284:	eb 27                	jmp    8012ad <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801286:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80128a:	be 03 00 00 00       	mov    $0x3,%esi
+  80128f:	48 89 c7             	mov    %rax,%rdi
+  801292:	48 b8 b5 7a ff ff ff 	movabs $0xffffffffffff7ab5,%rax
+  801299:	ff ff ff 
+  80129c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012a0:	ff d0                	call   *%rax
+  8012a2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8012a6:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8012ad:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8012b2:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8012b5:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8012b8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8012bc:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8012c0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8012c4:	45 89 c1             	mov    %r8d,%r9d
+  8012c7:	41 89 f8             	mov    %edi,%r8d
+  8012ca:	48 89 c7             	mov    %rax,%rdi
+  8012cd:	48 b8 dd 79 ff ff ff 	movabs $0xffffffffffff79dd,%rax
+  8012d4:	ff ff ff 
+  8012d7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012db:	ff d0                	call   *%rax
+			break;
+  8012dd:	e9 83 00 00 00       	jmp    801365 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  8012e2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8012e6:	be 03 00 00 00       	mov    $0x3,%esi
+  8012eb:	48 89 c7             	mov    %rax,%rdi
+  8012ee:	48 b8 b5 7a ff ff ff 	movabs $0xffffffffffff7ab5,%rax
+  8012f5:	ff ff ff 
+  8012f8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012fc:	ff d0                	call   *%rax
+  8012fe:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801302:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801306:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80130a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80130e:	48 89 ce             	mov    %rcx,%rsi
+  801311:	48 89 c7             	mov    %rax,%rdi
+  801314:	48 b8 d0 7b ff ff ff 	movabs $0xffffffffffff7bd0,%rax
+  80131b:	ff ff ff 
+  80131e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801322:	ff d0                	call   *%rax
+	
+			break;
+  801324:	eb 3f                	jmp    801365 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801326:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80132a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80132e:	48 89 c6             	mov    %rax,%rsi
+  801331:	89 df                	mov    %ebx,%edi
+  801333:	ff d2                	call   *%rdx
+			break;
+  801335:	eb 2e                	jmp    801365 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801337:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80133b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80133f:	48 89 c6             	mov    %rax,%rsi
+  801342:	bf 25 00 00 00       	mov    $0x25,%edi
+  801347:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801349:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80134e:	eb 05                	jmp    801355 <vprintfmt+0x5e4>
+  801350:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801355:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801359:	48 83 e8 01          	sub    $0x1,%rax
+  80135d:	0f b6 00             	movzbl (%rax),%eax
+  801360:	3c 25                	cmp    $0x25,%al
+  801362:	75 ec                	jne    801350 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801364:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801365:	e9 78 fa ff ff       	jmp    800de2 <vprintfmt+0x71>
+				return;
+  80136a:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80136b:	48 83 c4 60          	add    $0x60,%rsp
+  80136f:	5b                   	pop    %rbx
+  801370:	41 5c                	pop    %r12
+  801372:	41 5d                	pop    %r13
+  801374:	41 5f                	pop    %r15
+  801376:	5d                   	pop    %rbp
+  801377:	c3                   	ret
+
+0000000000801378 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801378:	55                   	push   %rbp
+  801379:	48 89 e5             	mov    %rsp,%rbp
+  80137c:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801383:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801383 <printfmt+0xb>
+  80138a:	49 bb bd 7c 00 00 00 	movabs $0x7cbd,%r11
+  801391:	00 00 00 
+  801394:	4d 01 da             	add    %r11,%r10
+  801397:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80139e:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8013a5:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8013ac:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8013b3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8013ba:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8013c1:	84 c0                	test   %al,%al
+  8013c3:	74 20                	je     8013e5 <printfmt+0x6d>
+  8013c5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8013c9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8013cd:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8013d1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8013d5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8013d9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8013dd:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8013e1:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8013e5:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8013ec:	00 00 00 
+  8013ef:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8013f6:	00 00 00 
+  8013f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8013fd:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801404:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80140b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801412:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801419:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801420:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801427:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80142e:	48 89 c7             	mov    %rax,%rdi
+  801431:	48 b8 31 7d ff ff ff 	movabs $0xffffffffffff7d31,%rax
+  801438:	ff ff ff 
+  80143b:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80143f:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801441:	90                   	nop
+  801442:	c9                   	leave
+  801443:	c3                   	ret
+
+0000000000801444 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801444:	55                   	push   %rbp
+  801445:	48 89 e5             	mov    %rsp,%rbp
+  801448:	48 83 ec 10          	sub    $0x10,%rsp
+  80144c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80144c <sprintputch+0x8>
+  801453:	49 bb f4 7b 00 00 00 	movabs $0x7bf4,%r11
+  80145a:	00 00 00 
+  80145d:	4c 01 d8             	add    %r11,%rax
+  801460:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801463:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801467:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80146b:	8b 40 10             	mov    0x10(%rax),%eax
+  80146e:	8d 50 01             	lea    0x1(%rax),%edx
+  801471:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801475:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801478:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80147c:	48 8b 10             	mov    (%rax),%rdx
+  80147f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801483:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801487:	48 39 c2             	cmp    %rax,%rdx
+  80148a:	73 17                	jae    8014a3 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80148c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801490:	48 8b 00             	mov    (%rax),%rax
+  801493:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801497:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80149b:	48 89 0a             	mov    %rcx,(%rdx)
+  80149e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8014a1:	88 10                	mov    %dl,(%rax)
+}
+  8014a3:	90                   	nop
+  8014a4:	c9                   	leave
+  8014a5:	c3                   	ret
+
+00000000008014a6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8014a6:	55                   	push   %rbp
+  8014a7:	48 89 e5             	mov    %rsp,%rbp
+  8014aa:	53                   	push   %rbx
+  8014ab:	48 83 ec 58          	sub    $0x58,%rsp
+  8014af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014af <vsnprintf+0x9>
+  8014b6:	49 bb 91 7b 00 00 00 	movabs $0x7b91,%r11
+  8014bd:	00 00 00 
+  8014c0:	4c 01 d8             	add    %r11,%rax
+  8014c3:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8014c7:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8014ca:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8014ce:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8014d2:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8014d6:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8014da:	48 8b 0e             	mov    (%rsi),%rcx
+  8014dd:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8014e1:	48 89 0a             	mov    %rcx,(%rdx)
+  8014e4:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8014e8:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8014ec:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8014f0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8014f4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8014f8:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8014fb:	48 63 d2             	movslq %edx,%rdx
+  8014fe:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801502:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801506:	48 01 ca             	add    %rcx,%rdx
+  801509:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80150d:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801514:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801519:	74 06                	je     801521 <vsnprintf+0x7b>
+  80151b:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  80151f:	7f 07                	jg     801528 <vsnprintf+0x82>
+		return -E_INVAL;
+  801521:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801526:	eb 34                	jmp    80155c <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801528:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  80152c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801530:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801534:	48 bf 04 84 ff ff ff 	movabs $0xffffffffffff8404,%rdi
+  80153b:	ff ff ff 
+  80153e:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801542:	49 b8 31 7d ff ff ff 	movabs $0xffffffffffff7d31,%r8
+  801549:	ff ff ff 
+  80154c:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801550:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801552:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801556:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801559:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80155c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801560:	c9                   	leave
+  801561:	c3                   	ret
+
+0000000000801562 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801562:	55                   	push   %rbp
+  801563:	48 89 e5             	mov    %rsp,%rbp
+  801566:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80156d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80156d <snprintf+0xb>
+  801574:	49 bb d3 7a 00 00 00 	movabs $0x7ad3,%r11
+  80157b:	00 00 00 
+  80157e:	4d 01 da             	add    %r11,%r10
+  801581:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801588:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80158e:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801595:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80159c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8015a3:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8015aa:	84 c0                	test   %al,%al
+  8015ac:	74 20                	je     8015ce <snprintf+0x6c>
+  8015ae:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8015b2:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8015b6:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8015ba:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8015be:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8015c2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8015c6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8015ca:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8015ce:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8015d5:	00 00 00 
+  8015d8:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8015df:	00 00 00 
+  8015e2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8015e6:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8015ed:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8015f4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8015fb:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801602:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801609:	48 8b 06             	mov    (%rsi),%rax
+  80160c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801610:	48 89 01             	mov    %rax,(%rcx)
+  801613:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801617:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80161b:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  80161f:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801626:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  80162d:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801633:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80163a:	48 89 c7             	mov    %rax,%rdi
+  80163d:	48 b8 66 84 ff ff ff 	movabs $0xffffffffffff8466,%rax
+  801644:	ff ff ff 
+  801647:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80164b:	ff d0                	call   *%rax
+  80164d:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801653:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801659:	c9                   	leave
+  80165a:	c3                   	ret
+
+000000000080165b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80165b:	55                   	push   %rbp
+  80165c:	48 89 e5             	mov    %rsp,%rbp
+  80165f:	48 83 ec 18          	sub    $0x18,%rsp
+  801663:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801663 <strlen+0x8>
+  80166a:	49 bb dd 79 00 00 00 	movabs $0x79dd,%r11
+  801671:	00 00 00 
+  801674:	4c 01 d8             	add    %r11,%rax
+  801677:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80167b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801682:	eb 09                	jmp    80168d <strlen+0x32>
+		n++;
+  801684:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801688:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80168d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801691:	0f b6 00             	movzbl (%rax),%eax
+  801694:	84 c0                	test   %al,%al
+  801696:	75 ec                	jne    801684 <strlen+0x29>
+	return n;
+  801698:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80169b:	c9                   	leave
+  80169c:	c3                   	ret
+
+000000000080169d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80169d:	55                   	push   %rbp
+  80169e:	48 89 e5             	mov    %rsp,%rbp
+  8016a1:	48 83 ec 20          	sub    $0x20,%rsp
+  8016a5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016a5 <strnlen+0x8>
+  8016ac:	49 bb 9b 79 00 00 00 	movabs $0x799b,%r11
+  8016b3:	00 00 00 
+  8016b6:	4c 01 d8             	add    %r11,%rax
+  8016b9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016bd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8016c1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8016c8:	eb 0e                	jmp    8016d8 <strnlen+0x3b>
+		n++;
+  8016ca:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8016ce:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8016d3:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8016d8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8016dd:	74 0b                	je     8016ea <strnlen+0x4d>
+  8016df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e3:	0f b6 00             	movzbl (%rax),%eax
+  8016e6:	84 c0                	test   %al,%al
+  8016e8:	75 e0                	jne    8016ca <strnlen+0x2d>
+	return n;
+  8016ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8016ed:	c9                   	leave
+  8016ee:	c3                   	ret
+
+00000000008016ef <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8016ef:	55                   	push   %rbp
+  8016f0:	48 89 e5             	mov    %rsp,%rbp
+  8016f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8016f7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016f7 <strcpy+0x8>
+  8016fe:	49 bb 49 79 00 00 00 	movabs $0x7949,%r11
+  801705:	00 00 00 
+  801708:	4c 01 d8             	add    %r11,%rax
+  80170b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80170f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801713:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801717:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80171b:	90                   	nop
+  80171c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801720:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801724:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801728:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80172c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801730:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801734:	0f b6 12             	movzbl (%rdx),%edx
+  801737:	88 10                	mov    %dl,(%rax)
+  801739:	0f b6 00             	movzbl (%rax),%eax
+  80173c:	84 c0                	test   %al,%al
+  80173e:	75 dc                	jne    80171c <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801740:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801744:	c9                   	leave
+  801745:	c3                   	ret
+
+0000000000801746 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801746:	55                   	push   %rbp
+  801747:	48 89 e5             	mov    %rsp,%rbp
+  80174a:	53                   	push   %rbx
+  80174b:	48 83 ec 20          	sub    $0x20,%rsp
+  80174f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80174f <strcat+0x9>
+  801756:	49 bb f1 78 00 00 00 	movabs $0x78f1,%r11
+  80175d:	00 00 00 
+  801760:	4c 01 db             	add    %r11,%rbx
+  801763:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801767:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80176b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80176f:	48 89 c7             	mov    %rax,%rdi
+  801772:	48 b8 1b 86 ff ff ff 	movabs $0xffffffffffff861b,%rax
+  801779:	ff ff ff 
+  80177c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801780:	ff d0                	call   *%rax
+  801782:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801785:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801788:	48 63 d0             	movslq %eax,%rdx
+  80178b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80178f:	48 01 c2             	add    %rax,%rdx
+  801792:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801796:	48 89 c6             	mov    %rax,%rsi
+  801799:	48 89 d7             	mov    %rdx,%rdi
+  80179c:	48 b8 af 86 ff ff ff 	movabs $0xffffffffffff86af,%rax
+  8017a3:	ff ff ff 
+  8017a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8017aa:	ff d0                	call   *%rax
+	return dst;
+  8017ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8017b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+
+00000000008017b6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8017b6:	55                   	push   %rbp
+  8017b7:	48 89 e5             	mov    %rsp,%rbp
+  8017ba:	48 83 ec 28          	sub    $0x28,%rsp
+  8017be:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017be <strncpy+0x8>
+  8017c5:	49 bb 82 78 00 00 00 	movabs $0x7882,%r11
+  8017cc:	00 00 00 
+  8017cf:	4c 01 d8             	add    %r11,%rax
+  8017d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017d6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017da:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8017de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017e2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8017e6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8017ed:	00 
+  8017ee:	eb 2a                	jmp    80181a <strncpy+0x64>
+		*dst++ = *src;
+  8017f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017f8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8017fc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801800:	0f b6 12             	movzbl (%rdx),%edx
+  801803:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801805:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801809:	0f b6 00             	movzbl (%rax),%eax
+  80180c:	84 c0                	test   %al,%al
+  80180e:	74 05                	je     801815 <strncpy+0x5f>
+			src++;
+  801810:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801815:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80181a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801822:	72 cc                	jb     8017f0 <strncpy+0x3a>
+	}
+	return ret;
+  801824:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801828:	c9                   	leave
+  801829:	c3                   	ret
+
+000000000080182a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80182a:	55                   	push   %rbp
+  80182b:	48 89 e5             	mov    %rsp,%rbp
+  80182e:	48 83 ec 28          	sub    $0x28,%rsp
+  801832:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801832 <strlcpy+0x8>
+  801839:	49 bb 0e 78 00 00 00 	movabs $0x780e,%r11
+  801840:	00 00 00 
+  801843:	4c 01 d8             	add    %r11,%rax
+  801846:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80184a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80184e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801852:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801856:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80185a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80185f:	74 3d                	je     80189e <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801861:	eb 1d                	jmp    801880 <strlcpy+0x56>
+			*dst++ = *src++;
+  801863:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801867:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80186b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80186f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801873:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801877:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80187b:	0f b6 12             	movzbl (%rdx),%edx
+  80187e:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801880:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801885:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80188a:	74 0b                	je     801897 <strlcpy+0x6d>
+  80188c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801890:	0f b6 00             	movzbl (%rax),%eax
+  801893:	84 c0                	test   %al,%al
+  801895:	75 cc                	jne    801863 <strlcpy+0x39>
+		*dst = '\0';
+  801897:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80189b:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80189e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018a2:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8018a6:	c9                   	leave
+  8018a7:	c3                   	ret
+
+00000000008018a8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8018a8:	55                   	push   %rbp
+  8018a9:	48 89 e5             	mov    %rsp,%rbp
+  8018ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8018b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018b0 <strcmp+0x8>
+  8018b7:	49 bb 90 77 00 00 00 	movabs $0x7790,%r11
+  8018be:	00 00 00 
+  8018c1:	4c 01 d8             	add    %r11,%rax
+  8018c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018c8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8018cc:	eb 0a                	jmp    8018d8 <strcmp+0x30>
+		p++, q++;
+  8018ce:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018d3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8018d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018dc:	0f b6 00             	movzbl (%rax),%eax
+  8018df:	84 c0                	test   %al,%al
+  8018e1:	74 12                	je     8018f5 <strcmp+0x4d>
+  8018e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e7:	0f b6 10             	movzbl (%rax),%edx
+  8018ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018ee:	0f b6 00             	movzbl (%rax),%eax
+  8018f1:	38 c2                	cmp    %al,%dl
+  8018f3:	74 d9                	je     8018ce <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8018f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018f9:	0f b6 00             	movzbl (%rax),%eax
+  8018fc:	0f b6 d0             	movzbl %al,%edx
+  8018ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801903:	0f b6 00             	movzbl (%rax),%eax
+  801906:	0f b6 c0             	movzbl %al,%eax
+  801909:	29 c2                	sub    %eax,%edx
+  80190b:	89 d0                	mov    %edx,%eax
+}
+  80190d:	c9                   	leave
+  80190e:	c3                   	ret
+
+000000000080190f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80190f:	55                   	push   %rbp
+  801910:	48 89 e5             	mov    %rsp,%rbp
+  801913:	48 83 ec 18          	sub    $0x18,%rsp
+  801917:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801917 <strncmp+0x8>
+  80191e:	49 bb 29 77 00 00 00 	movabs $0x7729,%r11
+  801925:	00 00 00 
+  801928:	4c 01 d8             	add    %r11,%rax
+  80192b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80192f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801933:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801937:	eb 0f                	jmp    801948 <strncmp+0x39>
+		n--, p++, q++;
+  801939:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80193e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801943:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801948:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80194d:	74 1d                	je     80196c <strncmp+0x5d>
+  80194f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801953:	0f b6 00             	movzbl (%rax),%eax
+  801956:	84 c0                	test   %al,%al
+  801958:	74 12                	je     80196c <strncmp+0x5d>
+  80195a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80195e:	0f b6 10             	movzbl (%rax),%edx
+  801961:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801965:	0f b6 00             	movzbl (%rax),%eax
+  801968:	38 c2                	cmp    %al,%dl
+  80196a:	74 cd                	je     801939 <strncmp+0x2a>
+	if (n == 0)
+  80196c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801971:	75 07                	jne    80197a <strncmp+0x6b>
+		return 0;
+  801973:	ba 00 00 00 00       	mov    $0x0,%edx
+  801978:	eb 16                	jmp    801990 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80197a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80197e:	0f b6 00             	movzbl (%rax),%eax
+  801981:	0f b6 d0             	movzbl %al,%edx
+  801984:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801988:	0f b6 00             	movzbl (%rax),%eax
+  80198b:	0f b6 c0             	movzbl %al,%eax
+  80198e:	29 c2                	sub    %eax,%edx
+}
+  801990:	89 d0                	mov    %edx,%eax
+  801992:	c9                   	leave
+  801993:	c3                   	ret
+
+0000000000801994 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801994:	55                   	push   %rbp
+  801995:	48 89 e5             	mov    %rsp,%rbp
+  801998:	48 83 ec 10          	sub    $0x10,%rsp
+  80199c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80199c <strchr+0x8>
+  8019a3:	49 bb a4 76 00 00 00 	movabs $0x76a4,%r11
+  8019aa:	00 00 00 
+  8019ad:	4c 01 d8             	add    %r11,%rax
+  8019b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019b4:	89 f0                	mov    %esi,%eax
+  8019b6:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8019b9:	eb 17                	jmp    8019d2 <strchr+0x3e>
+		if (*s == c)
+  8019bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019bf:	0f b6 00             	movzbl (%rax),%eax
+  8019c2:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8019c5:	75 06                	jne    8019cd <strchr+0x39>
+			return (char *) s;
+  8019c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019cb:	eb 15                	jmp    8019e2 <strchr+0x4e>
+	for (; *s; s++)
+  8019cd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019d6:	0f b6 00             	movzbl (%rax),%eax
+  8019d9:	84 c0                	test   %al,%al
+  8019db:	75 de                	jne    8019bb <strchr+0x27>
+	return 0;
+  8019dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019e2:	c9                   	leave
+  8019e3:	c3                   	ret
+
+00000000008019e4 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8019e4:	55                   	push   %rbp
+  8019e5:	48 89 e5             	mov    %rsp,%rbp
+  8019e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8019ec:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019ec <strfind+0x8>
+  8019f3:	49 bb 54 76 00 00 00 	movabs $0x7654,%r11
+  8019fa:	00 00 00 
+  8019fd:	4c 01 d8             	add    %r11,%rax
+  801a00:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a04:	89 f0                	mov    %esi,%eax
+  801a06:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801a09:	eb 11                	jmp    801a1c <strfind+0x38>
+		if (*s == c)
+  801a0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a0f:	0f b6 00             	movzbl (%rax),%eax
+  801a12:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801a15:	74 12                	je     801a29 <strfind+0x45>
+	for (; *s; s++)
+  801a17:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a20:	0f b6 00             	movzbl (%rax),%eax
+  801a23:	84 c0                	test   %al,%al
+  801a25:	75 e4                	jne    801a0b <strfind+0x27>
+  801a27:	eb 01                	jmp    801a2a <strfind+0x46>
+			break;
+  801a29:	90                   	nop
+	return (char *) s;
+  801a2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a2e:	c9                   	leave
+  801a2f:	c3                   	ret
+
+0000000000801a30 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801a30:	55                   	push   %rbp
+  801a31:	48 89 e5             	mov    %rsp,%rbp
+  801a34:	48 83 ec 18          	sub    $0x18,%rsp
+  801a38:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a38 <memset+0x8>
+  801a3f:	49 bb 08 76 00 00 00 	movabs $0x7608,%r11
+  801a46:	00 00 00 
+  801a49:	4c 01 d8             	add    %r11,%rax
+  801a4c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a50:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801a53:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801a57:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a5c:	75 06                	jne    801a64 <memset+0x34>
+		return v;
+  801a5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a62:	eb 69                	jmp    801acd <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801a64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a68:	83 e0 03             	and    $0x3,%eax
+  801a6b:	48 85 c0             	test   %rax,%rax
+  801a6e:	75 48                	jne    801ab8 <memset+0x88>
+  801a70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a74:	83 e0 03             	and    $0x3,%eax
+  801a77:	48 85 c0             	test   %rax,%rax
+  801a7a:	75 3c                	jne    801ab8 <memset+0x88>
+		c &= 0xFF;
+  801a7c:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801a83:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a86:	c1 e0 18             	shl    $0x18,%eax
+  801a89:	89 c2                	mov    %eax,%edx
+  801a8b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a8e:	c1 e0 10             	shl    $0x10,%eax
+  801a91:	09 c2                	or     %eax,%edx
+  801a93:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a96:	c1 e0 08             	shl    $0x8,%eax
+  801a99:	09 d0                	or     %edx,%eax
+  801a9b:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801a9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aa2:	48 c1 e8 02          	shr    $0x2,%rax
+  801aa6:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801aa9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aad:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801ab0:	48 89 d7             	mov    %rdx,%rdi
+  801ab3:	fc                   	cld
+  801ab4:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801ab6:	eb 11                	jmp    801ac9 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801ab8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801abc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801abf:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801ac3:	48 89 d7             	mov    %rdx,%rdi
+  801ac6:	fc                   	cld
+  801ac7:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801ac9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801acd:	c9                   	leave
+  801ace:	c3                   	ret
+
+0000000000801acf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801acf:	55                   	push   %rbp
+  801ad0:	48 89 e5             	mov    %rsp,%rbp
+  801ad3:	48 83 ec 28          	sub    $0x28,%rsp
+  801ad7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ad7 <memmove+0x8>
+  801ade:	49 bb 69 75 00 00 00 	movabs $0x7569,%r11
+  801ae5:	00 00 00 
+  801ae8:	4c 01 d8             	add    %r11,%rax
+  801aeb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801aef:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801af3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801af7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801afb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801aff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b03:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801b07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b0b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801b0f:	0f 83 88 00 00 00    	jae    801b9d <memmove+0xce>
+  801b15:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b19:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b1d:	48 01 d0             	add    %rdx,%rax
+  801b20:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801b24:	73 77                	jae    801b9d <memmove+0xce>
+		s += n;
+  801b26:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b2a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801b2e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b32:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801b36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b3a:	83 e0 03             	and    $0x3,%eax
+  801b3d:	48 85 c0             	test   %rax,%rax
+  801b40:	75 3b                	jne    801b7d <memmove+0xae>
+  801b42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b46:	83 e0 03             	and    $0x3,%eax
+  801b49:	48 85 c0             	test   %rax,%rax
+  801b4c:	75 2f                	jne    801b7d <memmove+0xae>
+  801b4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b52:	83 e0 03             	and    $0x3,%eax
+  801b55:	48 85 c0             	test   %rax,%rax
+  801b58:	75 23                	jne    801b7d <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801b5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b5e:	48 83 e8 04          	sub    $0x4,%rax
+  801b62:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b66:	48 83 ea 04          	sub    $0x4,%rdx
+  801b6a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801b6e:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801b72:	48 89 c7             	mov    %rax,%rdi
+  801b75:	48 89 d6             	mov    %rdx,%rsi
+  801b78:	fd                   	std
+  801b79:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801b7b:	eb 1d                	jmp    801b9a <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801b7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b81:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b89:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801b8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b91:	48 89 d7             	mov    %rdx,%rdi
+  801b94:	48 89 c1             	mov    %rax,%rcx
+  801b97:	fd                   	std
+  801b98:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801b9a:	fc                   	cld
+  801b9b:	eb 57                	jmp    801bf4 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801b9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ba1:	83 e0 03             	and    $0x3,%eax
+  801ba4:	48 85 c0             	test   %rax,%rax
+  801ba7:	75 36                	jne    801bdf <memmove+0x110>
+  801ba9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bad:	83 e0 03             	and    $0x3,%eax
+  801bb0:	48 85 c0             	test   %rax,%rax
+  801bb3:	75 2a                	jne    801bdf <memmove+0x110>
+  801bb5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb9:	83 e0 03             	and    $0x3,%eax
+  801bbc:	48 85 c0             	test   %rax,%rax
+  801bbf:	75 1e                	jne    801bdf <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801bc1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bc5:	48 c1 e8 02          	shr    $0x2,%rax
+  801bc9:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801bcc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bd0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bd4:	48 89 c7             	mov    %rax,%rdi
+  801bd7:	48 89 d6             	mov    %rdx,%rsi
+  801bda:	fc                   	cld
+  801bdb:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801bdd:	eb 15                	jmp    801bf4 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801bdf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801be3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801be7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801beb:	48 89 c7             	mov    %rax,%rdi
+  801bee:	48 89 d6             	mov    %rdx,%rsi
+  801bf1:	fc                   	cld
+  801bf2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801bf4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801bf8:	c9                   	leave
+  801bf9:	c3                   	ret
+
+0000000000801bfa <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801bfa:	55                   	push   %rbp
+  801bfb:	48 89 e5             	mov    %rsp,%rbp
+  801bfe:	48 83 ec 18          	sub    $0x18,%rsp
+  801c02:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c02 <memcpy+0x8>
+  801c09:	49 bb 3e 74 00 00 00 	movabs $0x743e,%r11
+  801c10:	00 00 00 
+  801c13:	4c 01 d8             	add    %r11,%rax
+  801c16:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c1a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c1e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801c22:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c26:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801c2a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801c2e:	48 89 cf             	mov    %rcx,%rdi
+  801c31:	48 b9 8f 8a ff ff ff 	movabs $0xffffffffffff8a8f,%rcx
+  801c38:	ff ff ff 
+  801c3b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801c3f:	ff d0                	call   *%rax
+}
+  801c41:	c9                   	leave
+  801c42:	c3                   	ret
+
+0000000000801c43 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801c43:	55                   	push   %rbp
+  801c44:	48 89 e5             	mov    %rsp,%rbp
+  801c47:	48 83 ec 28          	sub    $0x28,%rsp
+  801c4b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c4b <memcmp+0x8>
+  801c52:	49 bb f5 73 00 00 00 	movabs $0x73f5,%r11
+  801c59:	00 00 00 
+  801c5c:	4c 01 d8             	add    %r11,%rax
+  801c5f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c63:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801c67:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801c6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c6f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801c73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c77:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801c7b:	eb 34                	jmp    801cb1 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801c7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c81:	0f b6 10             	movzbl (%rax),%edx
+  801c84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c88:	0f b6 00             	movzbl (%rax),%eax
+  801c8b:	38 c2                	cmp    %al,%dl
+  801c8d:	74 18                	je     801ca7 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801c8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c93:	0f b6 00             	movzbl (%rax),%eax
+  801c96:	0f b6 d0             	movzbl %al,%edx
+  801c99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c9d:	0f b6 00             	movzbl (%rax),%eax
+  801ca0:	0f b6 c0             	movzbl %al,%eax
+  801ca3:	29 c2                	sub    %eax,%edx
+  801ca5:	eb 20                	jmp    801cc7 <memcmp+0x84>
+		s1++, s2++;
+  801ca7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801cac:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801cb1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb5:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801cb9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801cbd:	48 85 c0             	test   %rax,%rax
+  801cc0:	75 bb                	jne    801c7d <memcmp+0x3a>
+	}
+
+	return 0;
+  801cc2:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801cc7:	89 d0                	mov    %edx,%eax
+  801cc9:	c9                   	leave
+  801cca:	c3                   	ret
+
+0000000000801ccb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801ccb:	55                   	push   %rbp
+  801ccc:	48 89 e5             	mov    %rsp,%rbp
+  801ccf:	48 83 ec 28          	sub    $0x28,%rsp
+  801cd3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801cd3 <memfind+0x8>
+  801cda:	49 bb 6d 73 00 00 00 	movabs $0x736d,%r11
+  801ce1:	00 00 00 
+  801ce4:	4c 01 d8             	add    %r11,%rax
+  801ce7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ceb:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801cee:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801cf2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cf6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cfa:	48 01 d0             	add    %rdx,%rax
+  801cfd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801d01:	eb 13                	jmp    801d16 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801d03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d07:	0f b6 00             	movzbl (%rax),%eax
+  801d0a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801d0d:	38 d0                	cmp    %dl,%al
+  801d0f:	74 11                	je     801d22 <memfind+0x57>
+	for (; s < ends; s++)
+  801d11:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801d16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d1a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801d1e:	72 e3                	jb     801d03 <memfind+0x38>
+  801d20:	eb 01                	jmp    801d23 <memfind+0x58>
+			break;
+  801d22:	90                   	nop
+	return (void *) s;
+  801d23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d27:	c9                   	leave
+  801d28:	c3                   	ret
+
+0000000000801d29 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801d29:	55                   	push   %rbp
+  801d2a:	48 89 e5             	mov    %rsp,%rbp
+  801d2d:	48 83 ec 38          	sub    $0x38,%rsp
+  801d31:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d31 <strtol+0x8>
+  801d38:	49 bb 0f 73 00 00 00 	movabs $0x730f,%r11
+  801d3f:	00 00 00 
+  801d42:	4c 01 d8             	add    %r11,%rax
+  801d45:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d49:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d4d:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801d50:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801d57:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801d5e:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801d5f:	eb 05                	jmp    801d66 <strtol+0x3d>
+		s++;
+  801d61:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801d66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d6a:	0f b6 00             	movzbl (%rax),%eax
+  801d6d:	3c 20                	cmp    $0x20,%al
+  801d6f:	74 f0                	je     801d61 <strtol+0x38>
+  801d71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d75:	0f b6 00             	movzbl (%rax),%eax
+  801d78:	3c 09                	cmp    $0x9,%al
+  801d7a:	74 e5                	je     801d61 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801d7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d80:	0f b6 00             	movzbl (%rax),%eax
+  801d83:	3c 2b                	cmp    $0x2b,%al
+  801d85:	75 07                	jne    801d8e <strtol+0x65>
+		s++;
+  801d87:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d8c:	eb 17                	jmp    801da5 <strtol+0x7c>
+	else if (*s == '-')
+  801d8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d92:	0f b6 00             	movzbl (%rax),%eax
+  801d95:	3c 2d                	cmp    $0x2d,%al
+  801d97:	75 0c                	jne    801da5 <strtol+0x7c>
+		s++, neg = 1;
+  801d99:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d9e:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801da5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801da9:	74 06                	je     801db1 <strtol+0x88>
+  801dab:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801daf:	75 28                	jne    801dd9 <strtol+0xb0>
+  801db1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801db5:	0f b6 00             	movzbl (%rax),%eax
+  801db8:	3c 30                	cmp    $0x30,%al
+  801dba:	75 1d                	jne    801dd9 <strtol+0xb0>
+  801dbc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dc0:	48 83 c0 01          	add    $0x1,%rax
+  801dc4:	0f b6 00             	movzbl (%rax),%eax
+  801dc7:	3c 78                	cmp    $0x78,%al
+  801dc9:	75 0e                	jne    801dd9 <strtol+0xb0>
+		s += 2, base = 16;
+  801dcb:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801dd0:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801dd7:	eb 2c                	jmp    801e05 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801dd9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ddd:	75 19                	jne    801df8 <strtol+0xcf>
+  801ddf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801de3:	0f b6 00             	movzbl (%rax),%eax
+  801de6:	3c 30                	cmp    $0x30,%al
+  801de8:	75 0e                	jne    801df8 <strtol+0xcf>
+		s++, base = 8;
+  801dea:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801def:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801df6:	eb 0d                	jmp    801e05 <strtol+0xdc>
+	else if (base == 0)
+  801df8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801dfc:	75 07                	jne    801e05 <strtol+0xdc>
+		base = 10;
+  801dfe:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801e05:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e09:	0f b6 00             	movzbl (%rax),%eax
+  801e0c:	3c 2f                	cmp    $0x2f,%al
+  801e0e:	7e 1d                	jle    801e2d <strtol+0x104>
+  801e10:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e14:	0f b6 00             	movzbl (%rax),%eax
+  801e17:	3c 39                	cmp    $0x39,%al
+  801e19:	7f 12                	jg     801e2d <strtol+0x104>
+			dig = *s - '0';
+  801e1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e1f:	0f b6 00             	movzbl (%rax),%eax
+  801e22:	0f be c0             	movsbl %al,%eax
+  801e25:	83 e8 30             	sub    $0x30,%eax
+  801e28:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e2b:	eb 4e                	jmp    801e7b <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801e2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e31:	0f b6 00             	movzbl (%rax),%eax
+  801e34:	3c 60                	cmp    $0x60,%al
+  801e36:	7e 1d                	jle    801e55 <strtol+0x12c>
+  801e38:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e3c:	0f b6 00             	movzbl (%rax),%eax
+  801e3f:	3c 7a                	cmp    $0x7a,%al
+  801e41:	7f 12                	jg     801e55 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801e43:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e47:	0f b6 00             	movzbl (%rax),%eax
+  801e4a:	0f be c0             	movsbl %al,%eax
+  801e4d:	83 e8 57             	sub    $0x57,%eax
+  801e50:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e53:	eb 26                	jmp    801e7b <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801e55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e59:	0f b6 00             	movzbl (%rax),%eax
+  801e5c:	3c 40                	cmp    $0x40,%al
+  801e5e:	7e 47                	jle    801ea7 <strtol+0x17e>
+  801e60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e64:	0f b6 00             	movzbl (%rax),%eax
+  801e67:	3c 5a                	cmp    $0x5a,%al
+  801e69:	7f 3c                	jg     801ea7 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801e6b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e6f:	0f b6 00             	movzbl (%rax),%eax
+  801e72:	0f be c0             	movsbl %al,%eax
+  801e75:	83 e8 37             	sub    $0x37,%eax
+  801e78:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801e7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e7e:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801e81:	7d 23                	jge    801ea6 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801e83:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e88:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801e8b:	48 98                	cltq
+  801e8d:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801e92:	48 89 c2             	mov    %rax,%rdx
+  801e95:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e98:	48 98                	cltq
+  801e9a:	48 01 d0             	add    %rdx,%rax
+  801e9d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801ea1:	e9 5f ff ff ff       	jmp    801e05 <strtol+0xdc>
+			break;
+  801ea6:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ea7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801eac:	74 0b                	je     801eb9 <strtol+0x190>
+		*endptr = (char *) s;
+  801eae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801eb2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801eb6:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801eb9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ebd:	74 09                	je     801ec8 <strtol+0x19f>
+  801ebf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ec3:	48 f7 d8             	neg    %rax
+  801ec6:	eb 04                	jmp    801ecc <strtol+0x1a3>
+  801ec8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801ecc:	c9                   	leave
+  801ecd:	c3                   	ret
+
+0000000000801ece <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801ece:	55                   	push   %rbp
+  801ecf:	48 89 e5             	mov    %rsp,%rbp
+  801ed2:	53                   	push   %rbx
+  801ed3:	48 83 ec 30          	sub    $0x30,%rsp
+  801ed7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801ed7 <strstr+0x9>
+  801ede:	49 bb 69 71 00 00 00 	movabs $0x7169,%r11
+  801ee5:	00 00 00 
+  801ee8:	4c 01 db             	add    %r11,%rbx
+  801eeb:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801eef:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801ef3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ef7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801efb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801eff:	0f b6 00             	movzbl (%rax),%eax
+  801f02:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801f05:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801f09:	75 06                	jne    801f11 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801f0b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f0f:	eb 73                	jmp    801f84 <strstr+0xb6>
+
+	len = strlen(str);
+  801f11:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f15:	48 89 c7             	mov    %rax,%rdi
+  801f18:	48 b8 1b 86 ff ff ff 	movabs $0xffffffffffff861b,%rax
+  801f1f:	ff ff ff 
+  801f22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801f26:	ff d0                	call   *%rax
+  801f28:	48 98                	cltq
+  801f2a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801f2e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f32:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801f36:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801f3a:	0f b6 00             	movzbl (%rax),%eax
+  801f3d:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801f40:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801f44:	75 07                	jne    801f4d <strstr+0x7f>
+				return (char *) 0;
+  801f46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4b:	eb 37                	jmp    801f84 <strstr+0xb6>
+		} while (sc != c);
+  801f4d:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801f51:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801f54:	75 d8                	jne    801f2e <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801f56:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f5a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801f5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f62:	48 89 ce             	mov    %rcx,%rsi
+  801f65:	48 89 c7             	mov    %rax,%rdi
+  801f68:	48 b8 cf 88 ff ff ff 	movabs $0xffffffffffff88cf,%rax
+  801f6f:	ff ff ff 
+  801f72:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801f76:	ff d0                	call   *%rax
+  801f78:	85 c0                	test   %eax,%eax
+  801f7a:	75 b2                	jne    801f2e <strstr+0x60>
+
+	return (char *) (in - 1);
+  801f7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f80:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801f84:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f88:	c9                   	leave
+  801f89:	c3                   	ret
+
+0000000000801f8a <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801f8a:	55                   	push   %rbp
+  801f8b:	48 89 e5             	mov    %rsp,%rbp
+  801f8e:	41 57                	push   %r15
+  801f90:	53                   	push   %rbx
+  801f91:	48 83 ec 40          	sub    $0x40,%rsp
+  801f95:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801f95 <syscall+0xb>
+  801f9c:	49 bb ab 70 00 00 00 	movabs $0x70ab,%r11
+  801fa3:	00 00 00 
+  801fa6:	4d 01 da             	add    %r11,%r10
+  801fa9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801fac:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801faf:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801fb3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801fb7:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801fbb:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801fbf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801fc2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801fc6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801fca:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801fce:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801fd2:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801fd6:	4c 89 c3             	mov    %r8,%rbx
+  801fd9:	cd 30                	int    $0x30
+  801fdb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801fdf:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801fe3:	74 52                	je     802037 <syscall+0xad>
+  801fe5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801fea:	7e 4b                	jle    802037 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fec:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ff0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ff3:	49 89 d0             	mov    %rdx,%r8
+  801ff6:	89 c1                	mov    %eax,%ecx
+  801ff8:	48 b8 e8 e5 ff ff ff 	movabs $0xffffffffffffe5e8,%rax
+  801fff:	ff ff ff 
+  802002:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  802006:	48 89 c2             	mov    %rax,%rdx
+  802009:	be 23 00 00 00       	mov    $0x23,%esi
+  80200e:	48 b8 05 e6 ff ff ff 	movabs $0xffffffffffffe605,%rax
+  802015:	ff ff ff 
+  802018:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80201c:	48 89 c7             	mov    %rax,%rdi
+  80201f:	4d 89 d7             	mov    %r10,%r15
+  802022:	b8 00 00 00 00       	mov    $0x0,%eax
+  802027:	49 b9 16 76 ff ff ff 	movabs $0xffffffffffff7616,%r9
+  80202e:	ff ff ff 
+  802031:	4d 01 d1             	add    %r10,%r9
+  802034:	41 ff d1             	call   *%r9
+
+	return ret;
+  802037:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80203b:	48 83 c4 40          	add    $0x40,%rsp
+  80203f:	5b                   	pop    %rbx
+  802040:	41 5f                	pop    %r15
+  802042:	5d                   	pop    %rbp
+  802043:	c3                   	ret
+
+0000000000802044 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  802044:	55                   	push   %rbp
+  802045:	48 89 e5             	mov    %rsp,%rbp
+  802048:	41 57                	push   %r15
+  80204a:	41 56                	push   %r14
+  80204c:	41 55                	push   %r13
+  80204e:	41 54                	push   %r12
+  802050:	53                   	push   %rbx
+  802051:	48 83 ec 48          	sub    $0x48,%rsp
+  802055:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 802055 <syscall_words+0x11>
+  80205c:	49 bb eb 6f 00 00 00 	movabs $0x6feb,%r11
+  802063:	00 00 00 
+  802066:	4d 01 de             	add    %r11,%r14
+  802069:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80206c:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  80206f:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  802073:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802077:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  80207b:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  80207f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802084:	74 09                	je     80208f <syscall_words+0x4b>
+  802086:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80208a:	48 8b 00             	mov    (%rax),%rax
+  80208d:	eb 05                	jmp    802094 <syscall_words+0x50>
+  80208f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802094:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  802097:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80209c:	74 0a                	je     8020a8 <syscall_words+0x64>
+  80209e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020a2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020a6:	eb 05                	jmp    8020ad <syscall_words+0x69>
+  8020a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ad:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  8020b0:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8020b5:	74 0a                	je     8020c1 <syscall_words+0x7d>
+  8020b7:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020bb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8020bf:	eb 05                	jmp    8020c6 <syscall_words+0x82>
+  8020c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c6:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  8020c9:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8020ce:	74 0a                	je     8020da <syscall_words+0x96>
+  8020d0:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020d4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8020d8:	eb 05                	jmp    8020df <syscall_words+0x9b>
+  8020da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020df:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  8020e2:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8020e7:	74 0a                	je     8020f3 <syscall_words+0xaf>
+  8020e9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020ed:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8020f1:	eb 05                	jmp    8020f8 <syscall_words+0xb4>
+  8020f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f8:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  8020fb:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802100:	74 0a                	je     80210c <syscall_words+0xc8>
+  802102:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802106:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80210a:	eb 05                	jmp    802111 <syscall_words+0xcd>
+  80210c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802111:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  802114:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802117:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80211b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80211f:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  802123:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  802127:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80212b:	cd 30                	int    $0x30
+  80212d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  802131:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802136:	74 50                	je     802188 <syscall_words+0x144>
+		words[0] = r8;
+  802138:	4c 89 c2             	mov    %r8,%rdx
+  80213b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80213f:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802142:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802146:	48 83 c0 08          	add    $0x8,%rax
+  80214a:	4c 89 ca             	mov    %r9,%rdx
+  80214d:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802150:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802154:	48 83 c0 10          	add    $0x10,%rax
+  802158:	4c 89 d2             	mov    %r10,%rdx
+  80215b:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  80215e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802162:	48 83 c0 18          	add    $0x18,%rax
+  802166:	4c 89 da             	mov    %r11,%rdx
+  802169:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  80216c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802170:	48 83 c0 20          	add    $0x20,%rax
+  802174:	4c 89 e2             	mov    %r12,%rdx
+  802177:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  80217a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80217e:	48 83 c0 28          	add    $0x28,%rax
+  802182:	4c 89 ea             	mov    %r13,%rdx
+  802185:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  802188:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80218c:	74 52                	je     8021e0 <syscall_words+0x19c>
+  80218e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802193:	7e 4b                	jle    8021e0 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802195:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802199:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80219c:	49 89 d0             	mov    %rdx,%r8
+  80219f:	89 c1                	mov    %eax,%ecx
+  8021a1:	48 b8 e8 e5 ff ff ff 	movabs $0xffffffffffffe5e8,%rax
+  8021a8:	ff ff ff 
+  8021ab:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8021af:	48 89 c2             	mov    %rax,%rdx
+  8021b2:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8021b7:	48 b8 05 e6 ff ff ff 	movabs $0xffffffffffffe605,%rax
+  8021be:	ff ff ff 
+  8021c1:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8021c5:	48 89 c7             	mov    %rax,%rdi
+  8021c8:	4d 89 f7             	mov    %r14,%r15
+  8021cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d0:	49 b9 16 76 ff ff ff 	movabs $0xffffffffffff7616,%r9
+  8021d7:	ff ff ff 
+  8021da:	4d 01 f1             	add    %r14,%r9
+  8021dd:	41 ff d1             	call   *%r9
+
+	return ret;
+  8021e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8021e4:	48 83 c4 48          	add    $0x48,%rsp
+  8021e8:	5b                   	pop    %rbx
+  8021e9:	41 5c                	pop    %r12
+  8021eb:	41 5d                	pop    %r13
+  8021ed:	41 5e                	pop    %r14
+  8021ef:	41 5f                	pop    %r15
+  8021f1:	5d                   	pop    %rbp
+  8021f2:	c3                   	ret
+
+00000000008021f3 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8021f3:	55                   	push   %rbp
+  8021f4:	48 89 e5             	mov    %rsp,%rbp
+  8021f7:	48 83 ec 10          	sub    $0x10,%rsp
+  8021fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021fb <sys_cputs+0x8>
+  802202:	49 bb 45 6e 00 00 00 	movabs $0x6e45,%r11
+  802209:	00 00 00 
+  80220c:	4c 01 d8             	add    %r11,%rax
+  80220f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802213:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802217:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80221b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80221f:	48 83 ec 08          	sub    $0x8,%rsp
+  802223:	6a 00                	push   $0x0
+  802225:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80222b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802231:	be 00 00 00 00       	mov    $0x0,%esi
+  802236:	bf 00 00 00 00       	mov    $0x0,%edi
+  80223b:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802242:	ff ff ff 
+  802245:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802249:	ff d0                	call   *%rax
+  80224b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80224f:	90                   	nop
+  802250:	c9                   	leave
+  802251:	c3                   	ret
+
+0000000000802252 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802252:	55                   	push   %rbp
+  802253:	48 89 e5             	mov    %rsp,%rbp
+  802256:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802256 <sys_cgetc+0x4>
+  80225d:	49 bb ea 6d 00 00 00 	movabs $0x6dea,%r11
+  802264:	00 00 00 
+  802267:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80226a:	48 83 ec 08          	sub    $0x8,%rsp
+  80226e:	6a 00                	push   $0x0
+  802270:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802276:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80227c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802281:	ba 00 00 00 00       	mov    $0x0,%edx
+  802286:	be 00 00 00 00       	mov    $0x0,%esi
+  80228b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802290:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802297:	ff ff ff 
+  80229a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80229e:	ff d0                	call   *%rax
+  8022a0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a4:	c9                   	leave
+  8022a5:	c3                   	ret
+
+00000000008022a6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8022a6:	55                   	push   %rbp
+  8022a7:	48 89 e5             	mov    %rsp,%rbp
+  8022aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8022ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022ae <sys_env_destroy+0x8>
+  8022b5:	49 bb 92 6d 00 00 00 	movabs $0x6d92,%r11
+  8022bc:	00 00 00 
+  8022bf:	4c 01 d8             	add    %r11,%rax
+  8022c2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8022c5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022c8:	48 63 d2             	movslq %edx,%rdx
+  8022cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8022cf:	6a 00                	push   $0x0
+  8022d1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8022e7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022ec:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  8022f3:	ff ff ff 
+  8022f6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022fa:	ff d0                	call   *%rax
+  8022fc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802300:	c9                   	leave
+  802301:	c3                   	ret
+
+0000000000802302 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802302:	55                   	push   %rbp
+  802303:	48 89 e5             	mov    %rsp,%rbp
+  802306:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802306 <sys_getenvid+0x4>
+  80230d:	49 bb 3a 6d 00 00 00 	movabs $0x6d3a,%r11
+  802314:	00 00 00 
+  802317:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80231a:	48 83 ec 08          	sub    $0x8,%rsp
+  80231e:	6a 00                	push   $0x0
+  802320:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802326:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80232c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802331:	ba 00 00 00 00       	mov    $0x0,%edx
+  802336:	be 00 00 00 00       	mov    $0x0,%esi
+  80233b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802340:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802347:	ff ff ff 
+  80234a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80234e:	ff d0                	call   *%rax
+  802350:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802354:	c9                   	leave
+  802355:	c3                   	ret
+
+0000000000802356 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802356:	55                   	push   %rbp
+  802357:	48 89 e5             	mov    %rsp,%rbp
+  80235a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80235a <sys_yield+0x4>
+  802361:	49 bb e6 6c 00 00 00 	movabs $0x6ce6,%r11
+  802368:	00 00 00 
+  80236b:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80236e:	48 83 ec 08          	sub    $0x8,%rsp
+  802372:	6a 00                	push   $0x0
+  802374:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80237a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802380:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802385:	ba 00 00 00 00       	mov    $0x0,%edx
+  80238a:	be 00 00 00 00       	mov    $0x0,%esi
+  80238f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802394:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  80239b:	ff ff ff 
+  80239e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023a2:	ff d0                	call   *%rax
+  8023a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a8:	90                   	nop
+  8023a9:	c9                   	leave
+  8023aa:	c3                   	ret
+
+00000000008023ab <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8023ab:	55                   	push   %rbp
+  8023ac:	48 89 e5             	mov    %rsp,%rbp
+  8023af:	48 83 ec 10          	sub    $0x10,%rsp
+  8023b3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023b3 <sys_page_alloc+0x8>
+  8023ba:	49 bb 8d 6c 00 00 00 	movabs $0x6c8d,%r11
+  8023c1:	00 00 00 
+  8023c4:	4c 01 d8             	add    %r11,%rax
+  8023c7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023ce:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8023d1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023d4:	48 63 f2             	movslq %edx,%rsi
+  8023d7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023db:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023de:	48 63 d2             	movslq %edx,%rdx
+  8023e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e5:	6a 00                	push   $0x0
+  8023e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023ed:	49 89 f0             	mov    %rsi,%r8
+  8023f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8023f5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8023fa:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802401:	ff ff ff 
+  802404:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802408:	ff d0                	call   *%rax
+  80240a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80240e:	c9                   	leave
+  80240f:	c3                   	ret
+
+0000000000802410 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802410:	55                   	push   %rbp
+  802411:	48 89 e5             	mov    %rsp,%rbp
+  802414:	48 83 ec 20          	sub    $0x20,%rsp
+  802418:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802418 <sys_page_map+0x8>
+  80241f:	49 bb 28 6c 00 00 00 	movabs $0x6c28,%r11
+  802426:	00 00 00 
+  802429:	4c 01 d8             	add    %r11,%rax
+  80242c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80242f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802433:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802436:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80243a:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80243e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802441:	48 63 f2             	movslq %edx,%rsi
+  802444:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802448:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80244b:	48 63 fa             	movslq %edx,%rdi
+  80244e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802452:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802455:	48 63 d2             	movslq %edx,%rdx
+  802458:	48 83 ec 08          	sub    $0x8,%rsp
+  80245c:	56                   	push   %rsi
+  80245d:	4d 89 c1             	mov    %r8,%r9
+  802460:	49 89 f8             	mov    %rdi,%r8
+  802463:	be 01 00 00 00       	mov    $0x1,%esi
+  802468:	bf 05 00 00 00       	mov    $0x5,%edi
+  80246d:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802474:	ff ff ff 
+  802477:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80247b:	ff d0                	call   *%rax
+  80247d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802481:	c9                   	leave
+  802482:	c3                   	ret
+
+0000000000802483 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802483:	55                   	push   %rbp
+  802484:	48 89 e5             	mov    %rsp,%rbp
+  802487:	48 83 ec 10          	sub    $0x10,%rsp
+  80248b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80248b <sys_page_unmap+0x8>
+  802492:	49 bb b5 6b 00 00 00 	movabs $0x6bb5,%r11
+  802499:	00 00 00 
+  80249c:	4c 01 d8             	add    %r11,%rax
+  80249f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8024a6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024aa:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024ad:	48 63 d2             	movslq %edx,%rdx
+  8024b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b4:	6a 00                	push   $0x0
+  8024b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8024c7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8024cc:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  8024d3:	ff ff ff 
+  8024d6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024da:	ff d0                	call   *%rax
+  8024dc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024e0:	c9                   	leave
+  8024e1:	c3                   	ret
+
+00000000008024e2 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8024e2:	55                   	push   %rbp
+  8024e3:	48 89 e5             	mov    %rsp,%rbp
+  8024e6:	48 83 ec 10          	sub    $0x10,%rsp
+  8024ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024ea <sys_env_set_status+0x8>
+  8024f1:	49 bb 56 6b 00 00 00 	movabs $0x6b56,%r11
+  8024f8:	00 00 00 
+  8024fb:	4c 01 d8             	add    %r11,%rax
+  8024fe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802501:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802504:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802507:	48 63 ca             	movslq %edx,%rcx
+  80250a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80250d:	48 63 d2             	movslq %edx,%rdx
+  802510:	48 83 ec 08          	sub    $0x8,%rsp
+  802514:	6a 00                	push   $0x0
+  802516:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80251c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802522:	be 01 00 00 00       	mov    $0x1,%esi
+  802527:	bf 08 00 00 00       	mov    $0x8,%edi
+  80252c:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802533:	ff ff ff 
+  802536:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80253a:	ff d0                	call   *%rax
+  80253c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802540:	c9                   	leave
+  802541:	c3                   	ret
+
+0000000000802542 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802542:	55                   	push   %rbp
+  802543:	48 89 e5             	mov    %rsp,%rbp
+  802546:	48 83 ec 10          	sub    $0x10,%rsp
+  80254a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80254a <sys_env_set_trapframe+0x8>
+  802551:	49 bb f6 6a 00 00 00 	movabs $0x6af6,%r11
+  802558:	00 00 00 
+  80255b:	4c 01 d8             	add    %r11,%rax
+  80255e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802561:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802565:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802569:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80256c:	48 63 d2             	movslq %edx,%rdx
+  80256f:	48 83 ec 08          	sub    $0x8,%rsp
+  802573:	6a 00                	push   $0x0
+  802575:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80257b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802581:	be 01 00 00 00       	mov    $0x1,%esi
+  802586:	bf 09 00 00 00       	mov    $0x9,%edi
+  80258b:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802592:	ff ff ff 
+  802595:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802599:	ff d0                	call   *%rax
+  80259b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80259f:	c9                   	leave
+  8025a0:	c3                   	ret
+
+00000000008025a1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8025a1:	55                   	push   %rbp
+  8025a2:	48 89 e5             	mov    %rsp,%rbp
+  8025a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8025a9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025a9 <sys_env_set_pgfault_upcall+0x8>
+  8025b0:	49 bb 97 6a 00 00 00 	movabs $0x6a97,%r11
+  8025b7:	00 00 00 
+  8025ba:	4c 01 d8             	add    %r11,%rax
+  8025bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025c0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8025c4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025c8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025cb:	48 63 d2             	movslq %edx,%rdx
+  8025ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8025d2:	6a 00                	push   $0x0
+  8025d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8025e5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8025ea:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  8025f1:	ff ff ff 
+  8025f4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025f8:	ff d0                	call   *%rax
+  8025fa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025fe:	c9                   	leave
+  8025ff:	c3                   	ret
+
+0000000000802600 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802600:	55                   	push   %rbp
+  802601:	48 89 e5             	mov    %rsp,%rbp
+  802604:	48 83 ec 20          	sub    $0x20,%rsp
+  802608:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802608 <sys_ipc_try_send+0x8>
+  80260f:	49 bb 38 6a 00 00 00 	movabs $0x6a38,%r11
+  802616:	00 00 00 
+  802619:	4c 01 d8             	add    %r11,%rax
+  80261c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80261f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802623:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802627:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80262a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80262d:	48 63 fa             	movslq %edx,%rdi
+  802630:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802634:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802637:	48 63 d2             	movslq %edx,%rdx
+  80263a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80263e:	48 83 ec 08          	sub    $0x8,%rsp
+  802642:	6a 00                	push   $0x0
+  802644:	49 89 f9             	mov    %rdi,%r9
+  802647:	49 89 f0             	mov    %rsi,%r8
+  80264a:	be 00 00 00 00       	mov    $0x0,%esi
+  80264f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802654:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  80265b:	ff ff ff 
+  80265e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802662:	ff d0                	call   *%rax
+  802664:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802668:	c9                   	leave
+  802669:	c3                   	ret
+
+000000000080266a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80266a:	55                   	push   %rbp
+  80266b:	48 89 e5             	mov    %rsp,%rbp
+  80266e:	48 83 ec 20          	sub    $0x20,%rsp
+  802672:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802672 <sys_ipc_send+0x8>
+  802679:	49 bb ce 69 00 00 00 	movabs $0x69ce,%r11
+  802680:	00 00 00 
+  802683:	4c 01 d8             	add    %r11,%rax
+  802686:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802689:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80268d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802691:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802694:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802697:	48 63 fa             	movslq %edx,%rdi
+  80269a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80269e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026a1:	48 63 d2             	movslq %edx,%rdx
+  8026a4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ac:	6a 00                	push   $0x0
+  8026ae:	49 89 f9             	mov    %rdi,%r9
+  8026b1:	49 89 f0             	mov    %rsi,%r8
+  8026b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b9:	bf 17 00 00 00       	mov    $0x17,%edi
+  8026be:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  8026c5:	ff ff ff 
+  8026c8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026cc:	ff d0                	call   *%rax
+  8026ce:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026d2:	c9                   	leave
+  8026d3:	c3                   	ret
+
+00000000008026d4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8026d4:	55                   	push   %rbp
+  8026d5:	48 89 e5             	mov    %rsp,%rbp
+  8026d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8026dc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026dc <sys_ipc_recv+0x8>
+  8026e3:	49 bb 64 69 00 00 00 	movabs $0x6964,%r11
+  8026ea:	00 00 00 
+  8026ed:	4c 01 d8             	add    %r11,%rax
+  8026f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8026f4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026f8:	6a 00                	push   $0x0
+  8026fa:	6a 00                	push   $0x0
+  8026fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802702:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802708:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80270d:	be 01 00 00 00       	mov    $0x1,%esi
+  802712:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802717:	49 ba 04 90 ff ff ff 	movabs $0xffffffffffff9004,%r10
+  80271e:	ff ff ff 
+  802721:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802725:	ff d0                	call   *%rax
+  802727:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80272b:	c9                   	leave
+  80272c:	c3                   	ret
+
+000000000080272d <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  80272d:	55                   	push   %rbp
+  80272e:	48 89 e5             	mov    %rsp,%rbp
+  802731:	48 83 ec 30          	sub    $0x30,%rsp
+  802735:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802735 <sys_ipc_call+0x8>
+  80273c:	49 bb 0b 69 00 00 00 	movabs $0x690b,%r11
+  802743:	00 00 00 
+  802746:	4c 01 d8             	add    %r11,%rax
+  802749:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80274c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802750:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802754:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802757:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80275b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  80275f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802763:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802766:	4c 63 c2             	movslq %edx,%r8
+  802769:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80276d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802770:	48 63 d2             	movslq %edx,%rdx
+  802773:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802777:	ff 75 d8             	push   -0x28(%rbp)
+  80277a:	56                   	push   %rsi
+  80277b:	4d 89 c1             	mov    %r8,%r9
+  80277e:	49 89 f8             	mov    %rdi,%r8
+  802781:	be 00 00 00 00       	mov    $0x0,%esi
+  802786:	bf 18 00 00 00       	mov    $0x18,%edi
+  80278b:	49 ba 04 90 ff ff ff 	movabs $0xffffffffffff9004,%r10
+  802792:	ff ff ff 
+  802795:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802799:	ff d0                	call   *%rax
+  80279b:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  80279f:	c9                   	leave
+  8027a0:	c3                   	ret
+
+00000000008027a1 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8027a1:	55                   	push   %rbp
+  8027a2:	48 89 e5             	mov    %rsp,%rbp
+  8027a5:	48 83 ec 30          	sub    $0x30,%rsp
+  8027a9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027a9 <sys_ipc_reply_recv+0x8>
+  8027b0:	49 bb 97 68 00 00 00 	movabs $0x6897,%r11
+  8027b7:	00 00 00 
+  8027ba:	4c 01 d8             	add    %r11,%rax
+  8027bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027c0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027c4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8027c8:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8027cb:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8027cf:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8027d3:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8027d7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027da:	4c 63 c2             	movslq %edx,%r8
+  8027dd:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8027e1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027e4:	48 63 d2             	movslq %edx,%rdx
+  8027e7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027eb:	ff 75 d8             	push   -0x28(%rbp)
+  8027ee:	56                   	push   %rsi
+  8027ef:	4d 89 c1             	mov    %r8,%r9
+  8027f2:	49 89 f8             	mov    %rdi,%r8
+  8027f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8027fa:	bf 19 00 00 00       	mov    $0x19,%edi
+  8027ff:	49 ba 04 90 ff ff ff 	movabs $0xffffffffffff9004,%r10
+  802806:	ff ff ff 
+  802809:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80280d:	ff d0                	call   *%rax
+  80280f:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802813:	c9                   	leave
+  802814:	c3                   	ret
+
+0000000000802815 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802815:	55                   	push   %rbp
+  802816:	48 89 e5             	mov    %rsp,%rbp
+  802819:	48 83 ec 10          	sub    $0x10,%rsp
+  80281d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80281d <sys_env_set_priority+0x8>
+  802824:	49 bb 23 68 00 00 00 	movabs $0x6823,%r11
+  80282b:	00 00 00 
+  80282e:	4c 01 d8             	add    %r11,%rax
+  802831:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802834:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802837:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80283a:	48 63 ca             	movslq %edx,%rcx
+  80283d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802840:	48 63 d2             	movslq %edx,%rdx
+  802843:	48 83 ec 08          	sub    $0x8,%rsp
+  802847:	6a 00                	push   $0x0
+  802849:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80284f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802855:	be 01 00 00 00       	mov    $0x1,%esi
+  80285a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80285f:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802866:	ff ff ff 
+  802869:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80286d:	ff d0                	call   *%rax
+  80286f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802873:	c9                   	leave
+  802874:	c3                   	ret
+
+0000000000802875 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802875:	55                   	push   %rbp
+  802876:	48 89 e5             	mov    %rsp,%rbp
+  802879:	48 83 ec 10          	sub    $0x10,%rsp
+  80287d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80287d <sys_env_set_affinity+0x8>
+  802884:	49 bb c3 67 00 00 00 	movabs $0x67c3,%r11
+  80288b:	00 00 00 
+  80288e:	4c 01 d8             	add    %r11,%rax
+  802891:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802894:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802897:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  80289a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80289d:	48 63 d2             	movslq %edx,%rdx
+  8028a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a4:	6a 00                	push   $0x0
+  8028a6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028b2:	be 01 00 00 00       	mov    $0x1,%esi
+  8028b7:	bf 10 00 00 00       	mov    $0x10,%edi
+  8028bc:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  8028c3:	ff ff ff 
+  8028c6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028ca:	ff d0                	call   *%rax
+  8028cc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028d0:	c9                   	leave
+  8028d1:	c3                   	ret
+
+00000000008028d2 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8028d2:	55                   	push   %rbp
+  8028d3:	48 89 e5             	mov    %rsp,%rbp
+  8028d6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028d6 <sys_time_msec+0x4>
+  8028dd:	49 bb 6a 67 00 00 00 	movabs $0x676a,%r11
+  8028e4:	00 00 00 
+  8028e7:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8028ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8028ee:	6a 00                	push   $0x0
+  8028f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802901:	ba 00 00 00 00       	mov    $0x0,%edx
+  802906:	be 00 00 00 00       	mov    $0x0,%esi
+  80290b:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802910:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802917:	ff ff ff 
+  80291a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80291e:	ff d0                	call   *%rax
+  802920:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802924:	c9                   	leave
+  802925:	c3                   	ret
+
+0000000000802926 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802926:	55                   	push   %rbp
+  802927:	48 89 e5             	mov    %rsp,%rbp
+  80292a:	48 83 ec 10          	sub    $0x10,%rsp
+  80292e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80292e <sys_sleep_usec+0x8>
+  802935:	49 bb 12 67 00 00 00 	movabs $0x6712,%r11
+  80293c:	00 00 00 
+  80293f:	4c 01 d8             	add    %r11,%rax
+  802942:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802946:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80294a:	48 83 ec 08          	sub    $0x8,%rsp
+  80294e:	6a 00                	push   $0x0
+  802950:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802956:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80295c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802961:	be 00 00 00 00       	mov    $0x0,%esi
+  802966:	bf 11 00 00 00       	mov    $0x11,%edi
+  80296b:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802972:	ff ff ff 
+  802975:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802979:	ff d0                	call   *%rax
+  80297b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80297f:	c9                   	leave
+  802980:	c3                   	ret
+
+0000000000802981 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802981:	55                   	push   %rbp
+  802982:	48 89 e5             	mov    %rsp,%rbp
+  802985:	48 83 ec 10          	sub    $0x10,%rsp
+  802989:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802989 <sys_page_alloc_huge+0x8>
+  802990:	49 bb b7 66 00 00 00 	movabs $0x66b7,%r11
+  802997:	00 00 00 
+  80299a:	4c 01 d8             	add    %r11,%rax
+  80299d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8029a0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8029a4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8029a7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8029aa:	48 63 f2             	movslq %edx,%rsi
+  8029ad:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8029b1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8029b4:	48 63 d2             	movslq %edx,%rdx
+  8029b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8029bb:	6a 00                	push   $0x0
+  8029bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029c3:	49 89 f0             	mov    %rsi,%r8
+  8029c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8029cb:	bf 12 00 00 00       	mov    $0x12,%edi
+  8029d0:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  8029d7:	ff ff ff 
+  8029da:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029de:	ff d0                	call   *%rax
+  8029e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029e4:	c9                   	leave
+  8029e5:	c3                   	ret
+
+00000000008029e6 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8029e6:	55                   	push   %rbp
+  8029e7:	48 89 e5             	mov    %rsp,%rbp
+  8029ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8029ee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029ee <sys_page_map_batch+0x8>
+  8029f5:	49 bb 52 66 00 00 00 	movabs $0x6652,%r11
+  8029fc:	00 00 00 
+  8029ff:	4c 01 d8             	add    %r11,%rax
+  802a02:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a06:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802a0a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a0e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a12:	48 83 ec 08          	sub    $0x8,%rsp
+  802a16:	6a 00                	push   $0x0
+  802a18:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a1e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a24:	be 01 00 00 00       	mov    $0x1,%esi
+  802a29:	bf 13 00 00 00       	mov    $0x13,%edi
+  802a2e:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802a35:	ff ff ff 
+  802a38:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a3c:	ff d0                	call   *%rax
+  802a3e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a42:	c9                   	leave
+  802a43:	c3                   	ret
+
+0000000000802a44 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802a44:	55                   	push   %rbp
+  802a45:	48 89 e5             	mov    %rsp,%rbp
+  802a48:	48 83 ec 10          	sub    $0x10,%rsp
+  802a4c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a4c <sys_page_alloc_batch+0x8>
+  802a53:	49 bb f4 65 00 00 00 	movabs $0x65f4,%r11
+  802a5a:	00 00 00 
+  802a5d:	4c 01 d8             	add    %r11,%rax
+  802a60:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a64:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802a68:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a6c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a70:	48 83 ec 08          	sub    $0x8,%rsp
+  802a74:	6a 00                	push   $0x0
+  802a76:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a82:	be 01 00 00 00       	mov    $0x1,%esi
+  802a87:	bf 14 00 00 00       	mov    $0x14,%edi
+  802a8c:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802a93:	ff ff ff 
+  802a96:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a9a:	ff d0                	call   *%rax
+  802a9c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802aa0:	c9                   	leave
+  802aa1:	c3                   	ret
+
+0000000000802aa2 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802aa2:	55                   	push   %rbp
+  802aa3:	48 89 e5             	mov    %rsp,%rbp
+  802aa6:	48 83 ec 10          	sub    $0x10,%rsp
+  802aaa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802aaa <sys_page_unmap_batch+0x8>
+  802ab1:	49 bb 96 65 00 00 00 	movabs $0x6596,%r11
+  802ab8:	00 00 00 
+  802abb:	4c 01 d8             	add    %r11,%rax
+  802abe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802ac2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802ac6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802aca:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802ace:	48 83 ec 08          	sub    $0x8,%rsp
+  802ad2:	6a 00                	push   $0x0
+  802ad4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ada:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ae0:	be 01 00 00 00       	mov    $0x1,%esi
+  802ae5:	bf 15 00 00 00       	mov    $0x15,%edi
+  802aea:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802af1:	ff ff ff 
+  802af4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802af8:	ff d0                	call   *%rax
+  802afa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802afe:	c9                   	leave
+  802aff:	c3                   	ret
+
+0000000000802b00 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802b00:	55                   	push   %rbp
+  802b01:	48 89 e5             	mov    %rsp,%rbp
+  802b04:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b04 <sys_fork+0x4>
+  802b0b:	49 bb 3c 65 00 00 00 	movabs $0x653c,%r11
+  802b12:	00 00 00 
+  802b15:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802b18:	48 83 ec 08          	sub    $0x8,%rsp
+  802b1c:	6a 00                	push   $0x0
+  802b1e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b24:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b34:	be 00 00 00 00       	mov    $0x0,%esi
+  802b39:	bf 16 00 00 00       	mov    $0x16,%edi
+  802b3e:	49 ba 4a 8f ff ff ff 	movabs $0xffffffffffff8f4a,%r10
+  802b45:	ff ff ff 
+  802b48:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b4c:	ff d0                	call   *%rax
+  802b4e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b52:	c9                   	leave
+  802b53:	c3                   	ret
+
+0000000000802b54 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802b54:	55                   	push   %rbp
+  802b55:	48 89 e5             	mov    %rsp,%rbp
+  802b58:	41 57                	push   %r15
+  802b5a:	53                   	push   %rbx
+  802b5b:	48 83 ec 40          	sub    $0x40,%rsp
+  802b5f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b5f <pgfault+0xb>
+  802b66:	49 bb e1 64 00 00 00 	movabs $0x64e1,%r11
+  802b6d:	00 00 00 
+  802b70:	4c 01 db             	add    %r11,%rbx
+  802b73:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  802b77:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b7b:	48 8b 00             	mov    (%rax),%rax
+  802b7e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802b82:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b86:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802b8a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  802b8d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b91:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802b95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b99:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b9f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802ba3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ba6:	83 e0 02             	and    $0x2,%eax
+  802ba9:	85 c0                	test   %eax,%eax
+  802bab:	0f 84 91 03 00 00    	je     802f42 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802bb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bb5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802bb9:	48 89 c2             	mov    %rax,%rdx
+  802bbc:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802bc3:	ff ff ff 
+  802bc6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802bca:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bce:	83 e0 01             	and    $0x1,%eax
+  802bd1:	48 85 c0             	test   %rax,%rax
+  802bd4:	0f 84 a7 01 00 00    	je     802d81 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802bda:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bde:	48 c1 e8 15          	shr    $0x15,%rax
+  802be2:	48 89 c2             	mov    %rax,%rdx
+  802be5:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802bec:	ff ff ff 
+  802bef:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802bf3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bf7:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802bfc:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802c02:	0f 85 79 01 00 00    	jne    802d81 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802c08:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c0c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802c10:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c14:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802c1a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802c1e:	ba 07 00 00 00       	mov    $0x7,%edx
+  802c23:	be 00 00 60 00       	mov    $0x600000,%esi
+  802c28:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c2d:	49 89 df             	mov    %rbx,%r15
+  802c30:	48 b8 41 99 ff ff ff 	movabs $0xffffffffffff9941,%rax
+  802c37:	ff ff ff 
+  802c3a:	48 01 d8             	add    %rbx,%rax
+  802c3d:	ff d0                	call   *%rax
+  802c3f:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802c42:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802c46:	79 44                	jns    802c8c <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802c48:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802c4b:	89 c1                	mov    %eax,%ecx
+  802c4d:	48 b8 18 e6 ff ff ff 	movabs $0xffffffffffffe618,%rax
+  802c54:	ff ff ff 
+  802c57:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c5b:	48 89 c2             	mov    %rax,%rdx
+  802c5e:	be 20 00 00 00       	mov    $0x20,%esi
+  802c63:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  802c6a:	ff ff ff 
+  802c6d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c71:	48 89 c7             	mov    %rax,%rdi
+  802c74:	49 89 df             	mov    %rbx,%r15
+  802c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7c:	49 b8 16 76 ff ff ff 	movabs $0xffffffffffff7616,%r8
+  802c83:	ff ff ff 
+  802c86:	49 01 d8             	add    %rbx,%r8
+  802c89:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802c8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c90:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802c95:	48 89 c6             	mov    %rax,%rsi
+  802c98:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802c9d:	49 89 df             	mov    %rbx,%r15
+  802ca0:	48 b8 ba 8b ff ff ff 	movabs $0xffffffffffff8bba,%rax
+  802ca7:	ff ff ff 
+  802caa:	48 01 d8             	add    %rbx,%rax
+  802cad:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802caf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cb3:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802cb9:	48 89 c1             	mov    %rax,%rcx
+  802cbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cc1:	be 00 00 60 00       	mov    $0x600000,%esi
+  802cc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ccb:	49 89 df             	mov    %rbx,%r15
+  802cce:	48 b8 d0 93 ff ff ff 	movabs $0xffffffffffff93d0,%rax
+  802cd5:	ff ff ff 
+  802cd8:	48 01 d8             	add    %rbx,%rax
+  802cdb:	ff d0                	call   *%rax
+  802cdd:	85 c0                	test   %eax,%eax
+  802cdf:	74 3e                	je     802d1f <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802ce1:	48 b8 43 e6 ff ff ff 	movabs $0xffffffffffffe643,%rax
+  802ce8:	ff ff ff 
+  802ceb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cef:	48 89 c2             	mov    %rax,%rdx
+  802cf2:	be 23 00 00 00       	mov    $0x23,%esi
+  802cf7:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  802cfe:	ff ff ff 
+  802d01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d05:	48 89 c7             	mov    %rax,%rdi
+  802d08:	49 89 df             	mov    %rbx,%r15
+  802d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d10:	48 b9 16 76 ff ff ff 	movabs $0xffffffffffff7616,%rcx
+  802d17:	ff ff ff 
+  802d1a:	48 01 d9             	add    %rbx,%rcx
+  802d1d:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802d1f:	be 00 00 60 00       	mov    $0x600000,%esi
+  802d24:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d29:	49 89 df             	mov    %rbx,%r15
+  802d2c:	48 b8 43 94 ff ff ff 	movabs $0xffffffffffff9443,%rax
+  802d33:	ff ff ff 
+  802d36:	48 01 d8             	add    %rbx,%rax
+  802d39:	ff d0                	call   *%rax
+  802d3b:	85 c0                	test   %eax,%eax
+  802d3d:	0f 84 3d 02 00 00    	je     802f80 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802d43:	48 b8 58 e6 ff ff ff 	movabs $0xffffffffffffe658,%rax
+  802d4a:	ff ff ff 
+  802d4d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d51:	48 89 c2             	mov    %rax,%rdx
+  802d54:	be 25 00 00 00       	mov    $0x25,%esi
+  802d59:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  802d60:	ff ff ff 
+  802d63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d67:	48 89 c7             	mov    %rax,%rdi
+  802d6a:	49 89 df             	mov    %rbx,%r15
+  802d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d72:	48 b9 16 76 ff ff ff 	movabs $0xffffffffffff7616,%rcx
+  802d79:	ff ff ff 
+  802d7c:	48 01 d9             	add    %rbx,%rcx
+  802d7f:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802d81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d85:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d89:	48 89 c2             	mov    %rax,%rdx
+  802d8c:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d93:	ff ff ff 
+  802d96:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d9a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d9e:	25 00 08 00 00       	and    $0x800,%eax
+  802da3:	48 85 c0             	test   %rax,%rax
+  802da6:	0f 84 58 01 00 00    	je     802f04 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802dac:	ba 07 00 00 00       	mov    $0x7,%edx
+  802db1:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802db6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dbb:	49 89 df             	mov    %rbx,%r15
+  802dbe:	48 b8 6b 93 ff ff ff 	movabs $0xffffffffffff936b,%rax
+  802dc5:	ff ff ff 
+  802dc8:	48 01 d8             	add    %rbx,%rax
+  802dcb:	ff d0                	call   *%rax
+  802dcd:	85 c0                	test   %eax,%eax
+  802dcf:	74 3e                	je     802e0f <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802dd1:	48 b8 6f e6 ff ff ff 	movabs $0xffffffffffffe66f,%rax
+  802dd8:	ff ff ff 
+  802ddb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ddf:	48 89 c2             	mov    %rax,%rdx
+  802de2:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802de7:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  802dee:	ff ff ff 
+  802df1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802df5:	48 89 c7             	mov    %rax,%rdi
+  802df8:	49 89 df             	mov    %rbx,%r15
+  802dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e00:	48 b9 16 76 ff ff ff 	movabs $0xffffffffffff7616,%rcx
+  802e07:	ff ff ff 
+  802e0a:	48 01 d9             	add    %rbx,%rcx
+  802e0d:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802e0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e13:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e18:	48 89 c6             	mov    %rax,%rsi
+  802e1b:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802e20:	49 89 df             	mov    %rbx,%r15
+  802e23:	48 b8 ba 8b ff ff ff 	movabs $0xffffffffffff8bba,%rax
+  802e2a:	ff ff ff 
+  802e2d:	48 01 d8             	add    %rbx,%rax
+  802e30:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802e32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e36:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802e3c:	48 89 c1             	mov    %rax,%rcx
+  802e3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e44:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802e49:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e4e:	49 89 df             	mov    %rbx,%r15
+  802e51:	48 b8 d0 93 ff ff ff 	movabs $0xffffffffffff93d0,%rax
+  802e58:	ff ff ff 
+  802e5b:	48 01 d8             	add    %rbx,%rax
+  802e5e:	ff d0                	call   *%rax
+  802e60:	85 c0                	test   %eax,%eax
+  802e62:	74 3e                	je     802ea2 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802e64:	48 b8 43 e6 ff ff ff 	movabs $0xffffffffffffe643,%rax
+  802e6b:	ff ff ff 
+  802e6e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e72:	48 89 c2             	mov    %rax,%rdx
+  802e75:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802e7a:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  802e81:	ff ff ff 
+  802e84:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e88:	48 89 c7             	mov    %rax,%rdi
+  802e8b:	49 89 df             	mov    %rbx,%r15
+  802e8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e93:	48 b9 16 76 ff ff ff 	movabs $0xffffffffffff7616,%rcx
+  802e9a:	ff ff ff 
+  802e9d:	48 01 d9             	add    %rbx,%rcx
+  802ea0:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802ea2:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802ea7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eac:	49 89 df             	mov    %rbx,%r15
+  802eaf:	48 b8 43 94 ff ff ff 	movabs $0xffffffffffff9443,%rax
+  802eb6:	ff ff ff 
+  802eb9:	48 01 d8             	add    %rbx,%rax
+  802ebc:	ff d0                	call   *%rax
+  802ebe:	85 c0                	test   %eax,%eax
+  802ec0:	0f 84 bb 00 00 00    	je     802f81 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802ec6:	48 b8 58 e6 ff ff ff 	movabs $0xffffffffffffe658,%rax
+  802ecd:	ff ff ff 
+  802ed0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ed4:	48 89 c2             	mov    %rax,%rdx
+  802ed7:	be 32 00 00 00       	mov    $0x32,%esi
+  802edc:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  802ee3:	ff ff ff 
+  802ee6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802eea:	48 89 c7             	mov    %rax,%rdi
+  802eed:	49 89 df             	mov    %rbx,%r15
+  802ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef5:	48 b9 16 76 ff ff ff 	movabs $0xffffffffffff7616,%rcx
+  802efc:	ff ff ff 
+  802eff:	48 01 d9             	add    %rbx,%rcx
+  802f02:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802f04:	48 b8 88 e6 ff ff ff 	movabs $0xffffffffffffe688,%rax
+  802f0b:	ff ff ff 
+  802f0e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f12:	48 89 c2             	mov    %rax,%rdx
+  802f15:	be 36 00 00 00       	mov    $0x36,%esi
+  802f1a:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  802f21:	ff ff ff 
+  802f24:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f28:	48 89 c7             	mov    %rax,%rdi
+  802f2b:	49 89 df             	mov    %rbx,%r15
+  802f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f33:	48 b9 16 76 ff ff ff 	movabs $0xffffffffffff7616,%rcx
+  802f3a:	ff ff ff 
+  802f3d:	48 01 d9             	add    %rbx,%rcx
+  802f40:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802f42:	48 b8 a7 e6 ff ff ff 	movabs $0xffffffffffffe6a7,%rax
+  802f49:	ff ff ff 
+  802f4c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f50:	48 89 c2             	mov    %rax,%rdx
+  802f53:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802f58:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  802f5f:	ff ff ff 
+  802f62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f66:	48 89 c7             	mov    %rax,%rdi
+  802f69:	49 89 df             	mov    %rbx,%r15
+  802f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f71:	48 b9 16 76 ff ff ff 	movabs $0xffffffffffff7616,%rcx
+  802f78:	ff ff ff 
+  802f7b:	48 01 d9             	add    %rbx,%rcx
+  802f7e:	ff d1                	call   *%rcx
+			return;
+  802f80:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802f81:	48 83 c4 40          	add    $0x40,%rsp
+  802f85:	5b                   	pop    %rbx
+  802f86:	41 5f                	pop    %r15
+  802f88:	5d                   	pop    %rbp
+  802f89:	c3                   	ret
+
+0000000000802f8a <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802f8a:	55                   	push   %rbp
+  802f8b:	48 89 e5             	mov    %rsp,%rbp
+  802f8e:	41 57                	push   %r15
+  802f90:	53                   	push   %rbx
+  802f91:	48 83 ec 10          	sub    $0x10,%rsp
+  802f95:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f95 <fork_flush+0xb>
+  802f9c:	49 bb ab 60 00 00 00 	movabs $0x60ab,%r11
+  802fa3:	00 00 00 
+  802fa6:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802fa9:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802fb0:	00 00 00 
+  802fb3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fb7:	48 85 c0             	test   %rax,%rax
+  802fba:	0f 84 81 00 00 00    	je     803041 <fork_flush+0xb7>
+  802fc0:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802fc7:	00 00 00 
+  802fca:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fce:	48 89 c6             	mov    %rax,%rsi
+  802fd1:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802fd8:	00 00 00 
+  802fdb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fdf:	48 89 c7             	mov    %rax,%rdi
+  802fe2:	49 89 df             	mov    %rbx,%r15
+  802fe5:	48 b8 a6 99 ff ff ff 	movabs $0xffffffffffff99a6,%rax
+  802fec:	ff ff ff 
+  802fef:	48 01 d8             	add    %rbx,%rax
+  802ff2:	ff d0                	call   *%rax
+  802ff4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ff7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ffb:	79 44                	jns    803041 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802ffd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803000:	89 c1                	mov    %eax,%ecx
+  803002:	48 b8 c0 e6 ff ff ff 	movabs $0xffffffffffffe6c0,%rax
+  803009:	ff ff ff 
+  80300c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803010:	48 89 c2             	mov    %rax,%rdx
+  803013:	be 56 00 00 00       	mov    $0x56,%esi
+  803018:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  80301f:	ff ff ff 
+  803022:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803026:	48 89 c7             	mov    %rax,%rdi
+  803029:	49 89 df             	mov    %rbx,%r15
+  80302c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803031:	49 b8 16 76 ff ff ff 	movabs $0xffffffffffff7616,%r8
+  803038:	ff ff ff 
+  80303b:	49 01 d8             	add    %rbx,%r8
+  80303e:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  803041:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803048:	00 00 00 
+  80304b:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803052:	00 
+}
+  803053:	90                   	nop
+  803054:	48 83 c4 10          	add    $0x10,%rsp
+  803058:	5b                   	pop    %rbx
+  803059:	41 5f                	pop    %r15
+  80305b:	5d                   	pop    %rbp
+  80305c:	c3                   	ret
+
+000000000080305d <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  80305d:	55                   	push   %rbp
+  80305e:	48 89 e5             	mov    %rsp,%rbp
+  803061:	53                   	push   %rbx
+  803062:	48 83 ec 28          	sub    $0x28,%rsp
+  803066:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803066 <fork_map+0x9>
+  80306d:	49 bb da 5f 00 00 00 	movabs $0x5fda,%r11
+  803074:	00 00 00 
+  803077:	4c 01 db             	add    %r11,%rbx
+  80307a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80307d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803081:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  803084:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80308b:	00 00 00 
+  80308e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803092:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  803098:	75 10                	jne    8030aa <fork_map+0x4d>
+		fork_flush();
+  80309a:	48 b8 4a 9f ff ff ff 	movabs $0xffffffffffff9f4a,%rax
+  8030a1:	ff ff ff 
+  8030a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030a8:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  8030aa:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  8030b1:	00 00 00 
+  8030b4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030b8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8030bc:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  8030c3:	00 00 00 
+  8030c6:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  8030ca:	48 c1 e0 05          	shl    $0x5,%rax
+  8030ce:	48 89 c2             	mov    %rax,%rdx
+  8030d1:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  8030d8:	00 00 00 
+  8030db:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030df:	48 01 d0             	add    %rdx,%rax
+  8030e2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  8030e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030ea:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  8030f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030f4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8030f8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  8030fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803100:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803103:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  803106:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80310a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80310e:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  803112:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803116:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803119:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  80311c:	90                   	nop
+  80311d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803121:	c9                   	leave
+  803122:	c3                   	ret
+
+0000000000803123 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  803123:	55                   	push   %rbp
+  803124:	48 89 e5             	mov    %rsp,%rbp
+  803127:	53                   	push   %rbx
+  803128:	48 83 ec 28          	sub    $0x28,%rsp
+  80312c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80312c <duppage+0x9>
+  803133:	49 bb 14 5f 00 00 00 	movabs $0x5f14,%r11
+  80313a:	00 00 00 
+  80313d:	4c 01 db             	add    %r11,%rbx
+  803140:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803143:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  803146:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803149:	48 c1 e0 0c          	shl    $0xc,%rax
+  80314d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  803151:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803158:	ff ff ff 
+  80315b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80315f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803162:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803166:	25 00 04 00 00       	and    $0x400,%eax
+  80316b:	48 85 c0             	test   %rax,%rax
+  80316e:	74 42                	je     8031b2 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  803170:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803177:	ff ff ff 
+  80317a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80317e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803181:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803185:	25 07 0e 00 00       	and    $0xe07,%eax
+  80318a:	89 c2                	mov    %eax,%edx
+  80318c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803190:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803193:	48 89 ce             	mov    %rcx,%rsi
+  803196:	89 c7                	mov    %eax,%edi
+  803198:	48 b8 1d a0 ff ff ff 	movabs $0xffffffffffffa01d,%rax
+  80319f:	ff ff ff 
+  8031a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031a6:	ff d0                	call   *%rax
+		return 0;
+  8031a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ad:	e9 ae 00 00 00       	jmp    803260 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  8031b2:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8031b9:	ff ff ff 
+  8031bc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031c0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8031c3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031c7:	83 e0 02             	and    $0x2,%eax
+  8031ca:	48 85 c0             	test   %rax,%rax
+  8031cd:	75 1f                	jne    8031ee <duppage+0xcb>
+  8031cf:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8031d6:	ff ff ff 
+  8031d9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031dd:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8031e0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031e4:	25 00 08 00 00       	and    $0x800,%eax
+  8031e9:	48 85 c0             	test   %rax,%rax
+  8031ec:	74 4c                	je     80323a <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  8031ee:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  8031f5:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8031f8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8031fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031ff:	48 89 ce             	mov    %rcx,%rsi
+  803202:	89 c7                	mov    %eax,%edi
+  803204:	48 b8 1d a0 ff ff ff 	movabs $0xffffffffffffa01d,%rax
+  80320b:	ff ff ff 
+  80320e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803212:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  803214:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803217:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80321b:	48 89 c6             	mov    %rax,%rsi
+  80321e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803223:	48 b8 1d a0 ff ff ff 	movabs $0xffffffffffffa01d,%rax
+  80322a:	ff ff ff 
+  80322d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803231:	ff d0                	call   *%rax
+		return 0;
+  803233:	b8 00 00 00 00       	mov    $0x0,%eax
+  803238:	eb 26                	jmp    803260 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  80323a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80323e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803241:	ba 05 00 00 00       	mov    $0x5,%edx
+  803246:	48 89 ce             	mov    %rcx,%rsi
+  803249:	89 c7                	mov    %eax,%edi
+  80324b:	48 b8 1d a0 ff ff ff 	movabs $0xffffffffffffa01d,%rax
+  803252:	ff ff ff 
+  803255:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803259:	ff d0                	call   *%rax
+		return 0;
+  80325b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  803260:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803264:	c9                   	leave
+  803265:	c3                   	ret
+
+0000000000803266 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  803266:	55                   	push   %rbp
+  803267:	48 89 e5             	mov    %rsp,%rbp
+  80326a:	53                   	push   %rbx
+  80326b:	48 83 ec 28          	sub    $0x28,%rsp
+  80326f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80326f <duphuge+0x9>
+  803276:	49 bb d1 5d 00 00 00 	movabs $0x5dd1,%r11
+  80327d:	00 00 00 
+  803280:	4c 01 db             	add    %r11,%rbx
+  803283:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803286:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  80328a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80328e:	48 c1 e8 15          	shr    $0x15,%rax
+  803292:	48 89 c2             	mov    %rax,%rdx
+  803295:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80329c:	ff ff ff 
+  80329f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032a3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032a7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  8032ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032af:	25 00 04 00 00       	and    $0x400,%eax
+  8032b4:	48 85 c0             	test   %rax,%rax
+  8032b7:	74 0e                	je     8032c7 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  8032b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032bd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8032c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032c5:	eb 1e                	jmp    8032e5 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  8032c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032cb:	25 02 08 00 00       	and    $0x802,%eax
+  8032d0:	48 85 c0             	test   %rax,%rax
+  8032d3:	74 09                	je     8032de <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  8032d5:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  8032dc:	eb 07                	jmp    8032e5 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  8032de:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  8032e5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8032e8:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8032ec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8032ef:	48 89 ce             	mov    %rcx,%rsi
+  8032f2:	89 c7                	mov    %eax,%edi
+  8032f4:	48 b8 1d a0 ff ff ff 	movabs $0xffffffffffffa01d,%rax
+  8032fb:	ff ff ff 
+  8032fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803302:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  803304:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803307:	25 00 08 00 00       	and    $0x800,%eax
+  80330c:	85 c0                	test   %eax,%eax
+  80330e:	74 1f                	je     80332f <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  803310:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803313:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803317:	48 89 c6             	mov    %rax,%rsi
+  80331a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80331f:	48 b8 1d a0 ff ff ff 	movabs $0xffffffffffffa01d,%rax
+  803326:	ff ff ff 
+  803329:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80332d:	ff d0                	call   *%rax
+	return 0;
+  80332f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803334:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803338:	c9                   	leave
+  803339:	c3                   	ret
+
+000000000080333a <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  80333a:	55                   	push   %rbp
+  80333b:	48 89 e5             	mov    %rsp,%rbp
+  80333e:	41 57                	push   %r15
+  803340:	53                   	push   %rbx
+  803341:	48 83 ec 10          	sub    $0x10,%rsp
+  803345:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803345 <fork+0xb>
+  80334c:	49 bb fb 5c 00 00 00 	movabs $0x5cfb,%r11
+  803353:	00 00 00 
+  803356:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  803359:	49 89 df             	mov    %rbx,%r15
+  80335c:	48 b8 c0 9a ff ff ff 	movabs $0xffffffffffff9ac0,%rax
+  803363:	ff ff ff 
+  803366:	48 01 d8             	add    %rbx,%rax
+  803369:	ff d0                	call   *%rax
+  80336b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80336e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803372:	75 42                	jne    8033b6 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803374:	49 89 df             	mov    %rbx,%r15
+  803377:	48 b8 c2 92 ff ff ff 	movabs $0xffffffffffff92c2,%rax
+  80337e:	ff ff ff 
+  803381:	48 01 d8             	add    %rbx,%rax
+  803384:	ff d0                	call   *%rax
+  803386:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80338b:	48 98                	cltq
+  80338d:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803394:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80339b:	ff ff ff 
+  80339e:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8033a2:	48 01 c2             	add    %rax,%rdx
+  8033a5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8033ac:	ff ff ff 
+  8033af:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033b3:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  8033b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8033b9:	48 83 c4 10          	add    $0x10,%rsp
+  8033bd:	5b                   	pop    %rbx
+  8033be:	41 5f                	pop    %r15
+  8033c0:	5d                   	pop    %rbp
+  8033c1:	c3                   	ret
+
+00000000008033c2 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  8033c2:	55                   	push   %rbp
+  8033c3:	48 89 e5             	mov    %rsp,%rbp
+  8033c6:	41 57                	push   %r15
+  8033c8:	53                   	push   %rbx
+  8033c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8033cd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033cd <ufork+0xb>
+  8033d4:	49 bb 73 5c 00 00 00 	movabs $0x5c73,%r11
+  8033db:	00 00 00 
+  8033de:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  8033e1:	48 b8 14 9b ff ff ff 	movabs $0xffffffffffff9b14,%rax
+  8033e8:	ff ff ff 
+  8033eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033ef:	48 89 c7             	mov    %rax,%rdi
+  8033f2:	49 89 df             	mov    %rbx,%r15
+  8033f5:	48 b8 82 d6 ff ff ff 	movabs $0xffffffffffffd682,%rax
+  8033fc:	ff ff ff 
+  8033ff:	48 01 d8             	add    %rbx,%rax
+  803402:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  803404:	b8 07 00 00 00       	mov    $0x7,%eax
+  803409:	cd 30                	int    $0x30
+  80340b:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  80340e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  803411:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  803414:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803418:	0f 84 03 02 00 00    	je     803621 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  80341e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803425:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  803426:	e9 28 01 00 00       	jmp    803553 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  80342b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80342f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803433:	48 89 c2             	mov    %rax,%rdx
+  803436:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80343d:	ff ff ff 
+  803440:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803444:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803448:	83 e0 01             	and    $0x1,%eax
+  80344b:	48 85 c0             	test   %rax,%rax
+  80344e:	0f 84 f7 00 00 00    	je     80354b <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  803454:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803458:	48 c1 e8 15          	shr    $0x15,%rax
+  80345c:	48 89 c2             	mov    %rax,%rdx
+  80345f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803466:	ff ff ff 
+  803469:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80346d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803471:	25 81 00 00 00       	and    $0x81,%eax
+  803476:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  80347c:	75 29                	jne    8034a7 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  80347e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803482:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803485:	48 89 d6             	mov    %rdx,%rsi
+  803488:	89 c7                	mov    %eax,%edi
+  80348a:	48 b8 26 a2 ff ff ff 	movabs $0xffffffffffffa226,%rax
+  803491:	ff ff ff 
+  803494:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803498:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  80349a:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8034a1:	00 
+  8034a2:	e9 ac 00 00 00       	jmp    803553 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  8034a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034ab:	48 c1 e8 15          	shr    $0x15,%rax
+  8034af:	48 89 c2             	mov    %rax,%rdx
+  8034b2:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8034b9:	ff ff ff 
+  8034bc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034c0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034c4:	83 e0 01             	and    $0x1,%eax
+  8034c7:	48 85 c0             	test   %rax,%rax
+  8034ca:	74 75                	je     803541 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  8034cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034d0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034d4:	48 89 c2             	mov    %rax,%rdx
+  8034d7:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8034de:	ff ff ff 
+  8034e1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034e5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034e9:	83 e0 01             	and    $0x1,%eax
+  8034ec:	48 85 c0             	test   %rax,%rax
+  8034ef:	74 46                	je     803537 <ufork+0x175>
+  8034f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034f5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034f9:	48 89 c2             	mov    %rax,%rdx
+  8034fc:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803503:	ff ff ff 
+  803506:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80350a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80350e:	83 e0 04             	and    $0x4,%eax
+  803511:	48 85 c0             	test   %rax,%rax
+  803514:	74 21                	je     803537 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  803516:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80351a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80351e:	89 c2                	mov    %eax,%edx
+  803520:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803523:	89 d6                	mov    %edx,%esi
+  803525:	89 c7                	mov    %eax,%edi
+  803527:	48 b8 e3 a0 ff ff ff 	movabs $0xffffffffffffa0e3,%rax
+  80352e:	ff ff ff 
+  803531:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803535:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  803537:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  80353e:	00 
+  80353f:	eb 12                	jmp    803553 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803541:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803548:	00 
+  803549:	eb 08                	jmp    803553 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  80354b:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803552:	40 
+		for (; addr < USTACKTOP;){
+  803553:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  803558:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80355c:	0f 83 c9 fe ff ff    	jae    80342b <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803562:	48 b8 4a 9f ff ff ff 	movabs $0xffffffffffff9f4a,%rax
+  803569:	ff ff ff 
+  80356c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803570:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803572:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803575:	ba 07 00 00 00       	mov    $0x7,%edx
+  80357a:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80357f:	48 89 ce             	mov    %rcx,%rsi
+  803582:	89 c7                	mov    %eax,%edi
+  803584:	49 89 df             	mov    %rbx,%r15
+  803587:	48 b8 6b 93 ff ff ff 	movabs $0xffffffffffff936b,%rax
+  80358e:	ff ff ff 
+  803591:	48 01 d8             	add    %rbx,%rax
+  803594:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  803596:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803599:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8035a0:	ff ff ff 
+  8035a3:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8035a7:	48 89 d6             	mov    %rdx,%rsi
+  8035aa:	89 c7                	mov    %eax,%edi
+  8035ac:	49 89 df             	mov    %rbx,%r15
+  8035af:	48 b8 61 95 ff ff ff 	movabs $0xffffffffffff9561,%rax
+  8035b6:	ff ff ff 
+  8035b9:	48 01 d8             	add    %rbx,%rax
+  8035bc:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  8035be:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8035c1:	be 02 00 00 00       	mov    $0x2,%esi
+  8035c6:	89 c7                	mov    %eax,%edi
+  8035c8:	49 89 df             	mov    %rbx,%r15
+  8035cb:	48 b8 a2 94 ff ff ff 	movabs $0xffffffffffff94a2,%rax
+  8035d2:	ff ff ff 
+  8035d5:	48 01 d8             	add    %rbx,%rax
+  8035d8:	ff d0                	call   *%rax
+  8035da:	85 c0                	test   %eax,%eax
+  8035dc:	74 3e                	je     80361c <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  8035de:	48 b8 e7 e6 ff ff ff 	movabs $0xffffffffffffe6e7,%rax
+  8035e5:	ff ff ff 
+  8035e8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035ec:	48 89 c2             	mov    %rax,%rdx
+  8035ef:	be 07 01 00 00       	mov    $0x107,%esi
+  8035f4:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  8035fb:	ff ff ff 
+  8035fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803602:	48 89 c7             	mov    %rax,%rdi
+  803605:	49 89 df             	mov    %rbx,%r15
+  803608:	b8 00 00 00 00       	mov    $0x0,%eax
+  80360d:	48 b9 16 76 ff ff ff 	movabs $0xffffffffffff7616,%rcx
+  803614:	ff ff ff 
+  803617:	48 01 d9             	add    %rbx,%rcx
+  80361a:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  80361c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80361f:	eb 59                	jmp    80367a <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803621:	49 89 df             	mov    %rbx,%r15
+  803624:	48 b8 c2 92 ff ff ff 	movabs $0xffffffffffff92c2,%rax
+  80362b:	ff ff ff 
+  80362e:	48 01 d8             	add    %rbx,%rax
+  803631:	ff d0                	call   *%rax
+  803633:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803638:	48 98                	cltq
+  80363a:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803641:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803648:	ff ff ff 
+  80364b:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80364f:	48 01 c2             	add    %rax,%rdx
+  803652:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803659:	ff ff ff 
+  80365c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803660:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803663:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80366a:	00 00 00 
+  80366d:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803674:	00 
+		return 0;
+  803675:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  80367a:	48 83 c4 10          	add    $0x10,%rsp
+  80367e:	5b                   	pop    %rbx
+  80367f:	41 5f                	pop    %r15
+  803681:	5d                   	pop    %rbp
+  803682:	c3                   	ret
+
+0000000000803683 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803683:	55                   	push   %rbp
+  803684:	48 89 e5             	mov    %rsp,%rbp
+  803687:	41 57                	push   %r15
+  803689:	48 83 ec 08          	sub    $0x8,%rsp
+  80368d:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80368d <sfork+0xa>
+  803694:	49 bb b3 59 00 00 00 	movabs $0x59b3,%r11
+  80369b:	00 00 00 
+  80369e:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  8036a1:	48 b8 02 e7 ff ff ff 	movabs $0xffffffffffffe702,%rax
+  8036a8:	ff ff ff 
+  8036ab:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8036af:	48 89 c2             	mov    %rax,%rdx
+  8036b2:	be 1a 01 00 00       	mov    $0x11a,%esi
+  8036b7:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  8036be:	ff ff ff 
+  8036c1:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8036c5:	48 89 c7             	mov    %rax,%rdi
+  8036c8:	49 89 cf             	mov    %rcx,%r15
+  8036cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d0:	49 b8 16 76 ff ff ff 	movabs $0xffffffffffff7616,%r8
+  8036d7:	ff ff ff 
+  8036da:	49 01 c8             	add    %rcx,%r8
+  8036dd:	41 ff d0             	call   *%r8
+
+00000000008036e0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  8036e0:	55                   	push   %rbp
+  8036e1:	48 89 e5             	mov    %rsp,%rbp
+  8036e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8036e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8036e8 <fd2num+0x8>
+  8036ef:	49 bb 58 59 00 00 00 	movabs $0x5958,%r11
+  8036f6:	00 00 00 
+  8036f9:	4c 01 d8             	add    %r11,%rax
+  8036fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803700:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803704:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80370b:	ff ff ff 
+  80370e:	48 01 d0             	add    %rdx,%rax
+  803711:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803715:	c9                   	leave
+  803716:	c3                   	ret
+
+0000000000803717 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803717:	55                   	push   %rbp
+  803718:	48 89 e5             	mov    %rsp,%rbp
+  80371b:	48 83 ec 08          	sub    $0x8,%rsp
+  80371f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80371f <fd2data+0x8>
+  803726:	49 bb 21 59 00 00 00 	movabs $0x5921,%r11
+  80372d:	00 00 00 
+  803730:	4c 01 d8             	add    %r11,%rax
+  803733:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803737:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80373b:	48 89 d7             	mov    %rdx,%rdi
+  80373e:	48 ba a0 a6 ff ff ff 	movabs $0xffffffffffffa6a0,%rdx
+  803745:	ff ff ff 
+  803748:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80374c:	ff d0                	call   *%rax
+  80374e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803754:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803758:	c9                   	leave
+  803759:	c3                   	ret
+
+000000000080375a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80375a:	55                   	push   %rbp
+  80375b:	48 89 e5             	mov    %rsp,%rbp
+  80375e:	48 83 ec 18          	sub    $0x18,%rsp
+  803762:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803762 <fd_alloc+0x8>
+  803769:	49 bb de 58 00 00 00 	movabs $0x58de,%r11
+  803770:	00 00 00 
+  803773:	4c 01 d8             	add    %r11,%rax
+  803776:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80377a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803781:	eb 75                	jmp    8037f8 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803783:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803786:	48 63 d2             	movslq %edx,%rdx
+  803789:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803790:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803794:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803798:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80379c:	48 89 d1             	mov    %rdx,%rcx
+  80379f:	48 c1 e9 15          	shr    $0x15,%rcx
+  8037a3:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8037aa:	ff ff ff 
+  8037ad:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8037b1:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8037b5:	83 e2 01             	and    $0x1,%edx
+  8037b8:	48 85 d2             	test   %rdx,%rdx
+  8037bb:	74 25                	je     8037e2 <fd_alloc+0x88>
+  8037bd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8037c1:	48 89 d1             	mov    %rdx,%rcx
+  8037c4:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8037c8:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8037cf:	ff ff ff 
+  8037d2:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8037d6:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8037da:	83 e2 01             	and    $0x1,%edx
+  8037dd:	48 85 d2             	test   %rdx,%rdx
+  8037e0:	75 12                	jne    8037f4 <fd_alloc+0x9a>
+			*fd_store = fd;
+  8037e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037e6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8037ea:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8037ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f2:	eb 1a                	jmp    80380e <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  8037f4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8037f8:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8037fc:	7e 85                	jle    803783 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  8037fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803802:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803809:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  80380e:	c9                   	leave
+  80380f:	c3                   	ret
+
+0000000000803810 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803810:	55                   	push   %rbp
+  803811:	48 89 e5             	mov    %rsp,%rbp
+  803814:	48 83 ec 20          	sub    $0x20,%rsp
+  803818:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803818 <fd_lookup+0x8>
+  80381f:	49 bb 28 58 00 00 00 	movabs $0x5828,%r11
+  803826:	00 00 00 
+  803829:	4c 01 d8             	add    %r11,%rax
+  80382c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80382f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803833:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803837:	78 06                	js     80383f <fd_lookup+0x2f>
+  803839:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80383d:	7e 07                	jle    803846 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  80383f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803844:	eb 73                	jmp    8038b9 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803846:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803849:	48 63 d2             	movslq %edx,%rdx
+  80384c:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803853:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803857:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80385b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80385f:	48 89 d1             	mov    %rdx,%rcx
+  803862:	48 c1 e9 15          	shr    $0x15,%rcx
+  803866:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80386d:	ff ff ff 
+  803870:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803874:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803878:	83 e2 01             	and    $0x1,%edx
+  80387b:	48 85 d2             	test   %rdx,%rdx
+  80387e:	74 22                	je     8038a2 <fd_lookup+0x92>
+  803880:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803884:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803888:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  80388f:	ff ff ff 
+  803892:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803896:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80389a:	83 e0 01             	and    $0x1,%eax
+  80389d:	48 85 c0             	test   %rax,%rax
+  8038a0:	75 07                	jne    8038a9 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8038a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038a7:	eb 10                	jmp    8038b9 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  8038a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8038b1:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  8038b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038b9:	c9                   	leave
+  8038ba:	c3                   	ret
+
+00000000008038bb <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  8038bb:	55                   	push   %rbp
+  8038bc:	48 89 e5             	mov    %rsp,%rbp
+  8038bf:	41 57                	push   %r15
+  8038c1:	53                   	push   %rbx
+  8038c2:	48 83 ec 30          	sub    $0x30,%rsp
+  8038c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038c6 <fd_close+0xb>
+  8038cd:	49 bb 7a 57 00 00 00 	movabs $0x577a,%r11
+  8038d4:	00 00 00 
+  8038d7:	4c 01 db             	add    %r11,%rbx
+  8038da:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8038de:	89 f0                	mov    %esi,%eax
+  8038e0:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8038e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038e7:	48 89 c7             	mov    %rax,%rdi
+  8038ea:	48 b8 a0 a6 ff ff ff 	movabs $0xffffffffffffa6a0,%rax
+  8038f1:	ff ff ff 
+  8038f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038f8:	ff d0                	call   *%rax
+  8038fa:	89 c2                	mov    %eax,%edx
+  8038fc:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803900:	48 89 c6             	mov    %rax,%rsi
+  803903:	89 d7                	mov    %edx,%edi
+  803905:	48 b8 d0 a7 ff ff ff 	movabs $0xffffffffffffa7d0,%rax
+  80390c:	ff ff ff 
+  80390f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803913:	ff d0                	call   *%rax
+  803915:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803918:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80391c:	78 0a                	js     803928 <fd_close+0x6d>
+	    || fd != fd2)
+  80391e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803922:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803926:	74 12                	je     80393a <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803928:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80392c:	74 05                	je     803933 <fd_close+0x78>
+  80392e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803931:	eb 7a                	jmp    8039ad <fd_close+0xf2>
+  803933:	b8 00 00 00 00       	mov    $0x0,%eax
+  803938:	eb 73                	jmp    8039ad <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80393a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80393e:	8b 00                	mov    (%rax),%eax
+  803940:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803944:	48 89 d6             	mov    %rdx,%rsi
+  803947:	89 c7                	mov    %eax,%edi
+  803949:	48 b8 76 a9 ff ff ff 	movabs $0xffffffffffffa976,%rax
+  803950:	ff ff ff 
+  803953:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803957:	ff d0                	call   *%rax
+  803959:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80395c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803960:	78 2a                	js     80398c <fd_close+0xd1>
+		if (dev->dev_close)
+  803962:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803966:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80396a:	48 85 c0             	test   %rax,%rax
+  80396d:	74 16                	je     803985 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  80396f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803973:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803977:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80397b:	48 89 c7             	mov    %rax,%rdi
+  80397e:	ff d2                	call   *%rdx
+  803980:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803983:	eb 07                	jmp    80398c <fd_close+0xd1>
+		else
+			r = 0;
+  803985:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  80398c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803990:	48 89 c6             	mov    %rax,%rsi
+  803993:	bf 00 00 00 00       	mov    $0x0,%edi
+  803998:	49 89 df             	mov    %rbx,%r15
+  80399b:	48 b8 43 94 ff ff ff 	movabs $0xffffffffffff9443,%rax
+  8039a2:	ff ff ff 
+  8039a5:	48 01 d8             	add    %rbx,%rax
+  8039a8:	ff d0                	call   *%rax
+	return r;
+  8039aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8039ad:	48 83 c4 30          	add    $0x30,%rsp
+  8039b1:	5b                   	pop    %rbx
+  8039b2:	41 5f                	pop    %r15
+  8039b4:	5d                   	pop    %rbp
+  8039b5:	c3                   	ret
+
+00000000008039b6 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8039b6:	55                   	push   %rbp
+  8039b7:	48 89 e5             	mov    %rsp,%rbp
+  8039ba:	41 57                	push   %r15
+  8039bc:	48 83 ec 28          	sub    $0x28,%rsp
+  8039c0:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8039c0 <dev_lookup+0xa>
+  8039c7:	49 bb 80 56 00 00 00 	movabs $0x5680,%r11
+  8039ce:	00 00 00 
+  8039d1:	4c 01 d9             	add    %r11,%rcx
+  8039d4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8039d7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8039db:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8039e2:	eb 45                	jmp    803a29 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  8039e4:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  8039eb:	00 00 00 
+  8039ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039f1:	48 98                	cltq
+  8039f3:	48 01 ca             	add    %rcx,%rdx
+  8039f6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8039fa:	8b 00                	mov    (%rax),%eax
+  8039fc:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  8039ff:	75 24                	jne    803a25 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803a01:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803a08:	00 00 00 
+  803a0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a0e:	48 98                	cltq
+  803a10:	48 01 ca             	add    %rcx,%rdx
+  803a13:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a1b:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803a1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a23:	eb 74                	jmp    803a99 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803a25:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803a29:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803a30:	00 00 00 
+  803a33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a36:	48 98                	cltq
+  803a38:	48 01 ca             	add    %rcx,%rdx
+  803a3b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a3f:	48 85 c0             	test   %rax,%rax
+  803a42:	75 a0                	jne    8039e4 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803a44:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803a4b:	ff ff ff 
+  803a4e:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803a52:	48 8b 00             	mov    (%rax),%rax
+  803a55:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803a5b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803a5e:	89 c6                	mov    %eax,%esi
+  803a60:	48 b8 18 e7 ff ff ff 	movabs $0xffffffffffffe718,%rax
+  803a67:	ff ff ff 
+  803a6a:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803a6e:	48 89 c7             	mov    %rax,%rdi
+  803a71:	49 89 cf             	mov    %rcx,%r15
+  803a74:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a79:	49 b8 ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%r8
+  803a80:	ff ff ff 
+  803a83:	49 01 c8             	add    %rcx,%r8
+  803a86:	41 ff d0             	call   *%r8
+	*dev = 0;
+  803a89:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a8d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  803a94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803a99:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803a9d:	c9                   	leave
+  803a9e:	c3                   	ret
+
+0000000000803a9f <close>:
+
+int
+close(int fdnum)
+{
+  803a9f:	55                   	push   %rbp
+  803aa0:	48 89 e5             	mov    %rsp,%rbp
+  803aa3:	53                   	push   %rbx
+  803aa4:	48 83 ec 28          	sub    $0x28,%rsp
+  803aa8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803aa8 <close+0x9>
+  803aaf:	49 bb 98 55 00 00 00 	movabs $0x5598,%r11
+  803ab6:	00 00 00 
+  803ab9:	4c 01 db             	add    %r11,%rbx
+  803abc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803abf:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803ac3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ac6:	48 89 d6             	mov    %rdx,%rsi
+  803ac9:	89 c7                	mov    %eax,%edi
+  803acb:	48 b8 d0 a7 ff ff ff 	movabs $0xffffffffffffa7d0,%rax
+  803ad2:	ff ff ff 
+  803ad5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ad9:	ff d0                	call   *%rax
+  803adb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ade:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ae2:	79 05                	jns    803ae9 <close+0x4a>
+		return r;
+  803ae4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ae7:	eb 1c                	jmp    803b05 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803ae9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803aed:	be 01 00 00 00       	mov    $0x1,%esi
+  803af2:	48 89 c7             	mov    %rax,%rdi
+  803af5:	48 b8 7b a8 ff ff ff 	movabs $0xffffffffffffa87b,%rax
+  803afc:	ff ff ff 
+  803aff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b03:	ff d0                	call   *%rax
+}
+  803b05:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b09:	c9                   	leave
+  803b0a:	c3                   	ret
+
+0000000000803b0b <close_all>:
+
+void
+close_all(void)
+{
+  803b0b:	55                   	push   %rbp
+  803b0c:	48 89 e5             	mov    %rsp,%rbp
+  803b0f:	53                   	push   %rbx
+  803b10:	48 83 ec 18          	sub    $0x18,%rsp
+  803b14:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b14 <close_all+0x9>
+  803b1b:	49 bb 2c 55 00 00 00 	movabs $0x552c,%r11
+  803b22:	00 00 00 
+  803b25:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803b28:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803b2f:	eb 19                	jmp    803b4a <close_all+0x3f>
+		close(i);
+  803b31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b34:	89 c7                	mov    %eax,%edi
+  803b36:	48 b8 5f aa ff ff ff 	movabs $0xffffffffffffaa5f,%rax
+  803b3d:	ff ff ff 
+  803b40:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b44:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803b46:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803b4a:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803b4e:	7e e1                	jle    803b31 <close_all+0x26>
+}
+  803b50:	90                   	nop
+  803b51:	90                   	nop
+  803b52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b56:	c9                   	leave
+  803b57:	c3                   	ret
+
+0000000000803b58 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  803b58:	55                   	push   %rbp
+  803b59:	48 89 e5             	mov    %rsp,%rbp
+  803b5c:	41 57                	push   %r15
+  803b5e:	53                   	push   %rbx
+  803b5f:	48 83 ec 40          	sub    $0x40,%rsp
+  803b63:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b63 <dup+0xb>
+  803b6a:	49 bb dd 54 00 00 00 	movabs $0x54dd,%r11
+  803b71:	00 00 00 
+  803b74:	4c 01 db             	add    %r11,%rbx
+  803b77:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803b7a:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803b7d:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803b81:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803b84:	48 89 d6             	mov    %rdx,%rsi
+  803b87:	89 c7                	mov    %eax,%edi
+  803b89:	48 b8 d0 a7 ff ff ff 	movabs $0xffffffffffffa7d0,%rax
+  803b90:	ff ff ff 
+  803b93:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b97:	ff d0                	call   *%rax
+  803b99:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b9c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ba0:	79 08                	jns    803baa <dup+0x52>
+		return r;
+  803ba2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ba5:	e9 a4 01 00 00       	jmp    803d4e <dup+0x1f6>
+	close(newfdnum);
+  803baa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bad:	89 c7                	mov    %eax,%edi
+  803baf:	48 b8 5f aa ff ff ff 	movabs $0xffffffffffffaa5f,%rax
+  803bb6:	ff ff ff 
+  803bb9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bbd:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803bbf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bc2:	48 98                	cltq
+  803bc4:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803bca:	48 c1 e0 0c          	shl    $0xc,%rax
+  803bce:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803bd2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bd6:	48 89 c7             	mov    %rax,%rdi
+  803bd9:	48 b8 d7 a6 ff ff ff 	movabs $0xffffffffffffa6d7,%rax
+  803be0:	ff ff ff 
+  803be3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803be7:	ff d0                	call   *%rax
+  803be9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803bed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803bf1:	48 89 c7             	mov    %rax,%rdi
+  803bf4:	48 b8 d7 a6 ff ff ff 	movabs $0xffffffffffffa6d7,%rax
+  803bfb:	ff ff ff 
+  803bfe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c02:	ff d0                	call   *%rax
+  803c04:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  803c08:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c0c:	48 c1 e8 15          	shr    $0x15,%rax
+  803c10:	48 89 c2             	mov    %rax,%rdx
+  803c13:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803c1a:	ff ff ff 
+  803c1d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c21:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803c25:	83 e0 01             	and    $0x1,%eax
+  803c28:	48 85 c0             	test   %rax,%rax
+  803c2b:	74 7f                	je     803cac <dup+0x154>
+  803c2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c31:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c35:	48 89 c2             	mov    %rax,%rdx
+  803c38:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803c3f:	ff ff ff 
+  803c42:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c46:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803c4a:	83 e0 01             	and    $0x1,%eax
+  803c4d:	48 85 c0             	test   %rax,%rax
+  803c50:	74 5a                	je     803cac <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803c52:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c56:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c5a:	48 89 c2             	mov    %rax,%rdx
+  803c5d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803c64:	ff ff ff 
+  803c67:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c6b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803c6f:	25 07 0e 00 00       	and    $0xe07,%eax
+  803c74:	89 c1                	mov    %eax,%ecx
+  803c76:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803c7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c7e:	41 89 c8             	mov    %ecx,%r8d
+  803c81:	48 89 d1             	mov    %rdx,%rcx
+  803c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c89:	48 89 c6             	mov    %rax,%rsi
+  803c8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c91:	49 89 df             	mov    %rbx,%r15
+  803c94:	48 b8 d0 93 ff ff ff 	movabs $0xffffffffffff93d0,%rax
+  803c9b:	ff ff ff 
+  803c9e:	48 01 d8             	add    %rbx,%rax
+  803ca1:	ff d0                	call   *%rax
+  803ca3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ca6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803caa:	78 5f                	js     803d0b <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803cac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cb0:	48 c1 e8 0c          	shr    $0xc,%rax
+  803cb4:	48 89 c2             	mov    %rax,%rdx
+  803cb7:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803cbe:	ff ff ff 
+  803cc1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803cc5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803cc9:	25 07 0e 00 00       	and    $0xe07,%eax
+  803cce:	89 c1                	mov    %eax,%ecx
+  803cd0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cd4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803cd8:	41 89 c8             	mov    %ecx,%r8d
+  803cdb:	48 89 d1             	mov    %rdx,%rcx
+  803cde:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ce3:	48 89 c6             	mov    %rax,%rsi
+  803ce6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ceb:	49 89 df             	mov    %rbx,%r15
+  803cee:	48 b8 d0 93 ff ff ff 	movabs $0xffffffffffff93d0,%rax
+  803cf5:	ff ff ff 
+  803cf8:	48 01 d8             	add    %rbx,%rax
+  803cfb:	ff d0                	call   *%rax
+  803cfd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d00:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d04:	78 08                	js     803d0e <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803d06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803d09:	eb 43                	jmp    803d4e <dup+0x1f6>
+			goto err;
+  803d0b:	90                   	nop
+  803d0c:	eb 01                	jmp    803d0f <dup+0x1b7>
+		goto err;
+  803d0e:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803d0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d13:	48 89 c6             	mov    %rax,%rsi
+  803d16:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d1b:	49 89 df             	mov    %rbx,%r15
+  803d1e:	48 b8 43 94 ff ff ff 	movabs $0xffffffffffff9443,%rax
+  803d25:	ff ff ff 
+  803d28:	48 01 d8             	add    %rbx,%rax
+  803d2b:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803d2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d31:	48 89 c6             	mov    %rax,%rsi
+  803d34:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d39:	49 89 df             	mov    %rbx,%r15
+  803d3c:	48 b8 43 94 ff ff ff 	movabs $0xffffffffffff9443,%rax
+  803d43:	ff ff ff 
+  803d46:	48 01 d8             	add    %rbx,%rax
+  803d49:	ff d0                	call   *%rax
+	return r;
+  803d4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803d4e:	48 83 c4 40          	add    $0x40,%rsp
+  803d52:	5b                   	pop    %rbx
+  803d53:	41 5f                	pop    %r15
+  803d55:	5d                   	pop    %rbp
+  803d56:	c3                   	ret
+
+0000000000803d57 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803d57:	55                   	push   %rbp
+  803d58:	48 89 e5             	mov    %rsp,%rbp
+  803d5b:	41 57                	push   %r15
+  803d5d:	53                   	push   %rbx
+  803d5e:	48 83 ec 40          	sub    $0x40,%rsp
+  803d62:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d62 <read+0xb>
+  803d69:	49 bb de 52 00 00 00 	movabs $0x52de,%r11
+  803d70:	00 00 00 
+  803d73:	4c 01 db             	add    %r11,%rbx
+  803d76:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803d79:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803d7d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803d81:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803d85:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803d88:	48 89 d6             	mov    %rdx,%rsi
+  803d8b:	89 c7                	mov    %eax,%edi
+  803d8d:	48 b8 d0 a7 ff ff ff 	movabs $0xffffffffffffa7d0,%rax
+  803d94:	ff ff ff 
+  803d97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d9b:	ff d0                	call   *%rax
+  803d9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803da0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803da4:	78 28                	js     803dce <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803da6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803daa:	8b 00                	mov    (%rax),%eax
+  803dac:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803db0:	48 89 d6             	mov    %rdx,%rsi
+  803db3:	89 c7                	mov    %eax,%edi
+  803db5:	48 b8 76 a9 ff ff ff 	movabs $0xffffffffffffa976,%rax
+  803dbc:	ff ff ff 
+  803dbf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dc3:	ff d0                	call   *%rax
+  803dc5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803dc8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803dcc:	79 08                	jns    803dd6 <read+0x7f>
+		return r;
+  803dce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dd1:	e9 8b 00 00 00       	jmp    803e61 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803dd6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dda:	8b 40 08             	mov    0x8(%rax),%eax
+  803ddd:	83 e0 03             	and    $0x3,%eax
+  803de0:	83 f8 01             	cmp    $0x1,%eax
+  803de3:	75 4b                	jne    803e30 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803de5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803dec:	ff ff ff 
+  803def:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803df3:	48 8b 00             	mov    (%rax),%rax
+  803df6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803dfc:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803dff:	89 c6                	mov    %eax,%esi
+  803e01:	48 b8 37 e7 ff ff ff 	movabs $0xffffffffffffe737,%rax
+  803e08:	ff ff ff 
+  803e0b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e0f:	48 89 c7             	mov    %rax,%rdi
+  803e12:	49 89 df             	mov    %rbx,%r15
+  803e15:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e1a:	48 b9 ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%rcx
+  803e21:	ff ff ff 
+  803e24:	48 01 d9             	add    %rbx,%rcx
+  803e27:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803e29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e2e:	eb 31                	jmp    803e61 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803e30:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e34:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803e38:	48 85 c0             	test   %rax,%rax
+  803e3b:	75 07                	jne    803e44 <read+0xed>
+		return -E_NOT_SUPP;
+  803e3d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803e42:	eb 1d                	jmp    803e61 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803e44:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e48:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803e4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e50:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e54:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e58:	48 89 ce             	mov    %rcx,%rsi
+  803e5b:	48 89 c7             	mov    %rax,%rdi
+  803e5e:	41 ff d0             	call   *%r8
+}
+  803e61:	48 83 c4 40          	add    $0x40,%rsp
+  803e65:	5b                   	pop    %rbx
+  803e66:	41 5f                	pop    %r15
+  803e68:	5d                   	pop    %rbp
+  803e69:	c3                   	ret
+
+0000000000803e6a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803e6a:	55                   	push   %rbp
+  803e6b:	48 89 e5             	mov    %rsp,%rbp
+  803e6e:	53                   	push   %rbx
+  803e6f:	48 83 ec 38          	sub    $0x38,%rsp
+  803e73:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e73 <readn+0x9>
+  803e7a:	49 bb cd 51 00 00 00 	movabs $0x51cd,%r11
+  803e81:	00 00 00 
+  803e84:	4c 01 db             	add    %r11,%rbx
+  803e87:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803e8a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803e8e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803e92:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803e99:	eb 4b                	jmp    803ee6 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803e9b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e9e:	48 98                	cltq
+  803ea0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803ea4:	48 29 c2             	sub    %rax,%rdx
+  803ea7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803eaa:	48 63 c8             	movslq %eax,%rcx
+  803ead:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803eb1:	48 01 c1             	add    %rax,%rcx
+  803eb4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803eb7:	48 89 ce             	mov    %rcx,%rsi
+  803eba:	89 c7                	mov    %eax,%edi
+  803ebc:	48 b8 17 ad ff ff ff 	movabs $0xffffffffffffad17,%rax
+  803ec3:	ff ff ff 
+  803ec6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803eca:	ff d0                	call   *%rax
+  803ecc:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803ecf:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803ed3:	79 05                	jns    803eda <readn+0x70>
+			return m;
+  803ed5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ed8:	eb 1d                	jmp    803ef7 <readn+0x8d>
+		if (m == 0)
+  803eda:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803ede:	74 13                	je     803ef3 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803ee0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ee3:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803ee6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ee9:	48 98                	cltq
+  803eeb:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803eef:	72 aa                	jb     803e9b <readn+0x31>
+  803ef1:	eb 01                	jmp    803ef4 <readn+0x8a>
+			break;
+  803ef3:	90                   	nop
+	}
+	return tot;
+  803ef4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803ef7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803efb:	c9                   	leave
+  803efc:	c3                   	ret
+
+0000000000803efd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803efd:	55                   	push   %rbp
+  803efe:	48 89 e5             	mov    %rsp,%rbp
+  803f01:	41 57                	push   %r15
+  803f03:	53                   	push   %rbx
+  803f04:	48 83 ec 40          	sub    $0x40,%rsp
+  803f08:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f08 <write+0xb>
+  803f0f:	49 bb 38 51 00 00 00 	movabs $0x5138,%r11
+  803f16:	00 00 00 
+  803f19:	4c 01 db             	add    %r11,%rbx
+  803f1c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803f1f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803f23:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803f27:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803f2b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803f2e:	48 89 d6             	mov    %rdx,%rsi
+  803f31:	89 c7                	mov    %eax,%edi
+  803f33:	48 b8 d0 a7 ff ff ff 	movabs $0xffffffffffffa7d0,%rax
+  803f3a:	ff ff ff 
+  803f3d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f41:	ff d0                	call   *%rax
+  803f43:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f46:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f4a:	78 28                	js     803f74 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803f4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f50:	8b 00                	mov    (%rax),%eax
+  803f52:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803f56:	48 89 d6             	mov    %rdx,%rsi
+  803f59:	89 c7                	mov    %eax,%edi
+  803f5b:	48 b8 76 a9 ff ff ff 	movabs $0xffffffffffffa976,%rax
+  803f62:	ff ff ff 
+  803f65:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f69:	ff d0                	call   *%rax
+  803f6b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f6e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f72:	79 08                	jns    803f7c <write+0x7f>
+		return r;
+  803f74:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f77:	e9 8a 00 00 00       	jmp    804006 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803f7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f80:	8b 40 08             	mov    0x8(%rax),%eax
+  803f83:	83 e0 03             	and    $0x3,%eax
+  803f86:	85 c0                	test   %eax,%eax
+  803f88:	75 4b                	jne    803fd5 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803f8a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803f91:	ff ff ff 
+  803f94:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803f98:	48 8b 00             	mov    (%rax),%rax
+  803f9b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803fa1:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803fa4:	89 c6                	mov    %eax,%esi
+  803fa6:	48 b8 53 e7 ff ff ff 	movabs $0xffffffffffffe753,%rax
+  803fad:	ff ff ff 
+  803fb0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fb4:	48 89 c7             	mov    %rax,%rdi
+  803fb7:	49 89 df             	mov    %rbx,%r15
+  803fba:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fbf:	48 b9 ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%rcx
+  803fc6:	ff ff ff 
+  803fc9:	48 01 d9             	add    %rbx,%rcx
+  803fcc:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803fce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fd3:	eb 31                	jmp    804006 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803fd5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fd9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803fdd:	48 85 c0             	test   %rax,%rax
+  803fe0:	75 07                	jne    803fe9 <write+0xec>
+		return -E_NOT_SUPP;
+  803fe2:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803fe7:	eb 1d                	jmp    804006 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803fe9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fed:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803ff1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ff5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803ff9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803ffd:	48 89 ce             	mov    %rcx,%rsi
+  804000:	48 89 c7             	mov    %rax,%rdi
+  804003:	41 ff d0             	call   *%r8
+}
+  804006:	48 83 c4 40          	add    $0x40,%rsp
+  80400a:	5b                   	pop    %rbx
+  80400b:	41 5f                	pop    %r15
+  80400d:	5d                   	pop    %rbp
+  80400e:	c3                   	ret
+
+000000000080400f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80400f:	55                   	push   %rbp
+  804010:	48 89 e5             	mov    %rsp,%rbp
+  804013:	48 83 ec 18          	sub    $0x18,%rsp
+  804017:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804017 <seek+0x8>
+  80401e:	49 bb 29 50 00 00 00 	movabs $0x5029,%r11
+  804025:	00 00 00 
+  804028:	4c 01 d8             	add    %r11,%rax
+  80402b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80402e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804031:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  804035:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804038:	48 89 ce             	mov    %rcx,%rsi
+  80403b:	89 d7                	mov    %edx,%edi
+  80403d:	48 ba d0 a7 ff ff ff 	movabs $0xffffffffffffa7d0,%rdx
+  804044:	ff ff ff 
+  804047:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80404b:	ff d0                	call   *%rax
+  80404d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804050:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804054:	79 05                	jns    80405b <seek+0x4c>
+		return r;
+  804056:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804059:	eb 0f                	jmp    80406a <seek+0x5b>
+	fd->fd_offset = offset;
+  80405b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80405f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804062:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  804065:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80406a:	c9                   	leave
+  80406b:	c3                   	ret
+
+000000000080406c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80406c:	55                   	push   %rbp
+  80406d:	48 89 e5             	mov    %rsp,%rbp
+  804070:	41 57                	push   %r15
+  804072:	53                   	push   %rbx
+  804073:	48 83 ec 30          	sub    $0x30,%rsp
+  804077:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804077 <ftruncate+0xb>
+  80407e:	49 bb c9 4f 00 00 00 	movabs $0x4fc9,%r11
+  804085:	00 00 00 
+  804088:	4c 01 db             	add    %r11,%rbx
+  80408b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80408e:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804091:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804095:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804098:	48 89 d6             	mov    %rdx,%rsi
+  80409b:	89 c7                	mov    %eax,%edi
+  80409d:	48 b8 d0 a7 ff ff ff 	movabs $0xffffffffffffa7d0,%rax
+  8040a4:	ff ff ff 
+  8040a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040ab:	ff d0                	call   *%rax
+  8040ad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040b0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040b4:	78 28                	js     8040de <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8040b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040ba:	8b 00                	mov    (%rax),%eax
+  8040bc:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8040c0:	48 89 d6             	mov    %rdx,%rsi
+  8040c3:	89 c7                	mov    %eax,%edi
+  8040c5:	48 b8 76 a9 ff ff ff 	movabs $0xffffffffffffa976,%rax
+  8040cc:	ff ff ff 
+  8040cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040d3:	ff d0                	call   *%rax
+  8040d5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040d8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040dc:	79 08                	jns    8040e6 <ftruncate+0x7a>
+		return r;
+  8040de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040e1:	e9 83 00 00 00       	jmp    804169 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8040e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040ea:	8b 40 08             	mov    0x8(%rax),%eax
+  8040ed:	83 e0 03             	and    $0x3,%eax
+  8040f0:	85 c0                	test   %eax,%eax
+  8040f2:	75 4b                	jne    80413f <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  8040f4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8040fb:	ff ff ff 
+  8040fe:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804102:	48 8b 00             	mov    (%rax),%rax
+  804105:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80410b:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80410e:	89 c6                	mov    %eax,%esi
+  804110:	48 b8 70 e7 ff ff ff 	movabs $0xffffffffffffe770,%rax
+  804117:	ff ff ff 
+  80411a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80411e:	48 89 c7             	mov    %rax,%rdi
+  804121:	49 89 df             	mov    %rbx,%r15
+  804124:	b8 00 00 00 00       	mov    $0x0,%eax
+  804129:	48 b9 ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%rcx
+  804130:	ff ff ff 
+  804133:	48 01 d9             	add    %rbx,%rcx
+  804136:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804138:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80413d:	eb 2a                	jmp    804169 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  80413f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804143:	48 8b 40 30          	mov    0x30(%rax),%rax
+  804147:	48 85 c0             	test   %rax,%rax
+  80414a:	75 07                	jne    804153 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  80414c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804151:	eb 16                	jmp    804169 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  804153:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804157:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80415b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80415f:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  804162:	89 d6                	mov    %edx,%esi
+  804164:	48 89 c7             	mov    %rax,%rdi
+  804167:	ff d1                	call   *%rcx
+}
+  804169:	48 83 c4 30          	add    $0x30,%rsp
+  80416d:	5b                   	pop    %rbx
+  80416e:	41 5f                	pop    %r15
+  804170:	5d                   	pop    %rbp
+  804171:	c3                   	ret
+
+0000000000804172 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  804172:	55                   	push   %rbp
+  804173:	48 89 e5             	mov    %rsp,%rbp
+  804176:	53                   	push   %rbx
+  804177:	48 83 ec 38          	sub    $0x38,%rsp
+  80417b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80417b <fstat+0x9>
+  804182:	49 bb c5 4e 00 00 00 	movabs $0x4ec5,%r11
+  804189:	00 00 00 
+  80418c:	4c 01 db             	add    %r11,%rbx
+  80418f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804192:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804196:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80419a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80419d:	48 89 d6             	mov    %rdx,%rsi
+  8041a0:	89 c7                	mov    %eax,%edi
+  8041a2:	48 b8 d0 a7 ff ff ff 	movabs $0xffffffffffffa7d0,%rax
+  8041a9:	ff ff ff 
+  8041ac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041b0:	ff d0                	call   *%rax
+  8041b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041b9:	78 28                	js     8041e3 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8041bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041bf:	8b 00                	mov    (%rax),%eax
+  8041c1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8041c5:	48 89 d6             	mov    %rdx,%rsi
+  8041c8:	89 c7                	mov    %eax,%edi
+  8041ca:	48 b8 76 a9 ff ff ff 	movabs $0xffffffffffffa976,%rax
+  8041d1:	ff ff ff 
+  8041d4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041d8:	ff d0                	call   *%rax
+  8041da:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041dd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041e1:	79 05                	jns    8041e8 <fstat+0x76>
+		return r;
+  8041e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041e6:	eb 5e                	jmp    804246 <fstat+0xd4>
+	if (!dev->dev_stat)
+  8041e8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041ec:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8041f0:	48 85 c0             	test   %rax,%rax
+  8041f3:	75 07                	jne    8041fc <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8041f5:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8041fa:	eb 4a                	jmp    804246 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8041fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804200:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  804203:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804207:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80420e:	00 00 00 
+	stat->st_isdir = 0;
+  804211:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804215:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80421c:	00 00 00 
+	stat->st_dev = dev;
+  80421f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804223:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804227:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  80422e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804232:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  804236:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80423a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80423e:	48 89 d6             	mov    %rdx,%rsi
+  804241:	48 89 c7             	mov    %rax,%rdi
+  804244:	ff d1                	call   *%rcx
+}
+  804246:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80424a:	c9                   	leave
+  80424b:	c3                   	ret
+
+000000000080424c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80424c:	55                   	push   %rbp
+  80424d:	48 89 e5             	mov    %rsp,%rbp
+  804250:	41 57                	push   %r15
+  804252:	53                   	push   %rbx
+  804253:	48 83 ec 20          	sub    $0x20,%rsp
+  804257:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804257 <stat+0xb>
+  80425e:	49 bb e9 4d 00 00 00 	movabs $0x4de9,%r11
+  804265:	00 00 00 
+  804268:	4c 01 db             	add    %r11,%rbx
+  80426b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80426f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804273:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804277:	be 00 00 00 00       	mov    $0x0,%esi
+  80427c:	48 89 c7             	mov    %rax,%rdi
+  80427f:	49 89 df             	mov    %rbx,%r15
+  804282:	48 b8 e6 b4 ff ff ff 	movabs $0xffffffffffffb4e6,%rax
+  804289:	ff ff ff 
+  80428c:	48 01 d8             	add    %rbx,%rax
+  80428f:	ff d0                	call   *%rax
+  804291:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804294:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804298:	79 05                	jns    80429f <stat+0x53>
+		return fd;
+  80429a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80429d:	eb 37                	jmp    8042d6 <stat+0x8a>
+	r = fstat(fd, stat);
+  80429f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8042a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042a6:	48 89 d6             	mov    %rdx,%rsi
+  8042a9:	89 c7                	mov    %eax,%edi
+  8042ab:	48 b8 32 b1 ff ff ff 	movabs $0xffffffffffffb132,%rax
+  8042b2:	ff ff ff 
+  8042b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042b9:	ff d0                	call   *%rax
+  8042bb:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8042be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042c1:	89 c7                	mov    %eax,%edi
+  8042c3:	48 b8 5f aa ff ff ff 	movabs $0xffffffffffffaa5f,%rax
+  8042ca:	ff ff ff 
+  8042cd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042d1:	ff d0                	call   *%rax
+	return r;
+  8042d3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8042d6:	48 83 c4 20          	add    $0x20,%rsp
+  8042da:	5b                   	pop    %rbx
+  8042db:	41 5f                	pop    %r15
+  8042dd:	5d                   	pop    %rbp
+  8042de:	c3                   	ret
+
+00000000008042df <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8042df:	55                   	push   %rbp
+  8042e0:	48 89 e5             	mov    %rsp,%rbp
+  8042e3:	41 57                	push   %r15
+  8042e5:	53                   	push   %rbx
+  8042e6:	48 83 ec 10          	sub    $0x10,%rsp
+  8042ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042ea <fsipc+0xb>
+  8042f1:	49 bb 56 4d 00 00 00 	movabs $0x4d56,%r11
+  8042f8:	00 00 00 
+  8042fb:	4c 01 db             	add    %r11,%rbx
+  8042fe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804301:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  804305:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80430c:	00 00 00 
+  80430f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804312:	85 c0                	test   %eax,%eax
+  804314:	75 24                	jne    80433a <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804316:	bf 01 00 00 00       	mov    $0x1,%edi
+  80431b:	49 89 df             	mov    %rbx,%r15
+  80431e:	48 b8 41 df ff ff ff 	movabs $0xffffffffffffdf41,%rax
+  804325:	ff ff ff 
+  804328:	48 01 d8             	add    %rbx,%rax
+  80432b:	ff d0                	call   *%rax
+  80432d:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804334:	00 00 00 
+  804337:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  80433a:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804341:	00 00 00 
+  804344:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804347:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80434b:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80434e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804354:	49 89 d0             	mov    %rdx,%r8
+  804357:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80435c:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804363:	00 00 00 
+  804366:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80436a:	89 c7                	mov    %eax,%edi
+  80436c:	49 89 df             	mov    %rbx,%r15
+  80436f:	48 b8 60 d9 ff ff ff 	movabs $0xffffffffffffd960,%rax
+  804376:	ff ff ff 
+  804379:	48 01 d8             	add    %rbx,%rax
+  80437c:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  80437e:	48 83 c4 10          	add    $0x10,%rsp
+  804382:	5b                   	pop    %rbx
+  804383:	41 5f                	pop    %r15
+  804385:	5d                   	pop    %rbp
+  804386:	c3                   	ret
+
+0000000000804387 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  804387:	55                   	push   %rbp
+  804388:	48 89 e5             	mov    %rsp,%rbp
+  80438b:	41 57                	push   %r15
+  80438d:	53                   	push   %rbx
+  80438e:	48 83 ec 20          	sub    $0x20,%rsp
+  804392:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804392 <fsipc_words+0xb>
+  804399:	49 bb ae 4c 00 00 00 	movabs $0x4cae,%r11
+  8043a0:	00 00 00 
+  8043a3:	4c 01 db             	add    %r11,%rbx
+  8043a6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8043a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8043ad:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8043b1:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8043b8:	00 00 00 
+  8043bb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8043be:	85 c0                	test   %eax,%eax
+  8043c0:	75 24                	jne    8043e6 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8043c2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8043c7:	49 89 df             	mov    %rbx,%r15
+  8043ca:	48 b8 41 df ff ff ff 	movabs $0xffffffffffffdf41,%rax
+  8043d1:	ff ff ff 
+  8043d4:	48 01 d8             	add    %rbx,%rax
+  8043d7:	ff d0                	call   *%rax
+  8043d9:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8043e0:	00 00 00 
+  8043e3:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  8043e6:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8043ed:	00 00 00 
+  8043f0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8043f3:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8043f7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8043fb:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8043fe:	89 c7                	mov    %eax,%edi
+  804400:	49 89 df             	mov    %rbx,%r15
+  804403:	48 b8 4b da ff ff ff 	movabs $0xffffffffffffda4b,%rax
+  80440a:	ff ff ff 
+  80440d:	48 01 d8             	add    %rbx,%rax
+  804410:	ff d0                	call   *%rax
+}
+  804412:	48 83 c4 20          	add    $0x20,%rsp
+  804416:	5b                   	pop    %rbx
+  804417:	41 5f                	pop    %r15
+  804419:	5d                   	pop    %rbp
+  80441a:	c3                   	ret
+
+000000000080441b <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  80441b:	55                   	push   %rbp
+  80441c:	48 89 e5             	mov    %rsp,%rbp
+  80441f:	41 57                	push   %r15
+  804421:	53                   	push   %rbx
+  804422:	48 83 ec 40          	sub    $0x40,%rsp
+  804426:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804426 <fsipc_pages+0xb>
+  80442d:	49 bb 1a 4c 00 00 00 	movabs $0x4c1a,%r11
+  804434:	00 00 00 
+  804437:	4c 01 db             	add    %r11,%rbx
+  80443a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80443d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804441:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804445:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  804448:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80444f:	00 00 00 
+  804452:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804455:	85 c0                	test   %eax,%eax
+  804457:	75 24                	jne    80447d <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804459:	bf 01 00 00 00       	mov    $0x1,%edi
+  80445e:	49 89 df             	mov    %rbx,%r15
+  804461:	48 b8 41 df ff ff ff 	movabs $0xffffffffffffdf41,%rax
+  804468:	ff ff ff 
+  80446b:	48 01 d8             	add    %rbx,%rax
+  80446e:	ff d0                	call   *%rax
+  804470:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804477:	00 00 00 
+  80447a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  80447d:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804482:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804486:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804489:	48 98                	cltq
+  80448b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  80448f:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804493:	0f 95 c0             	setne  %al
+  804496:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804499:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8044a0:	00 
+  8044a1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8044a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044a9:	48 01 d0             	add    %rdx,%rax
+  8044ac:	48 83 e8 01          	sub    $0x1,%rax
+  8044b0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8044b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044bd:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8044c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044c5:	48 29 d0             	sub    %rdx,%rax
+  8044c8:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  8044cc:	41 89 c2             	mov    %eax,%r10d
+  8044cf:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8044d6:	00 00 00 
+  8044d9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8044dc:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  8044e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8044e4:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8044e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8044eb:	6a 40                	push   $0x40
+  8044ed:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  8044f2:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  8044f9:	00 
+  8044fa:	6a 05                	push   $0x5
+  8044fc:	41 89 f9             	mov    %edi,%r9d
+  8044ff:	49 89 c8             	mov    %rcx,%r8
+  804502:	44 89 d1             	mov    %r10d,%ecx
+  804505:	89 c7                	mov    %eax,%edi
+  804507:	49 89 df             	mov    %rbx,%r15
+  80450a:	48 b8 49 db ff ff ff 	movabs $0xffffffffffffdb49,%rax
+  804511:	ff ff ff 
+  804514:	48 01 d8             	add    %rbx,%rax
+  804517:	ff d0                	call   *%rax
+  804519:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80451d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804521:	5b                   	pop    %rbx
+  804522:	41 5f                	pop    %r15
+  804524:	5d                   	pop    %rbp
+  804525:	c3                   	ret
+
+0000000000804526 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804526:	55                   	push   %rbp
+  804527:	48 89 e5             	mov    %rsp,%rbp
+  80452a:	41 57                	push   %r15
+  80452c:	53                   	push   %rbx
+  80452d:	48 83 ec 20          	sub    $0x20,%rsp
+  804531:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804531 <open+0xb>
+  804538:	49 bb 0f 4b 00 00 00 	movabs $0x4b0f,%r11
+  80453f:	00 00 00 
+  804542:	4c 01 db             	add    %r11,%rbx
+  804545:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804549:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  80454c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804550:	48 89 c7             	mov    %rax,%rdi
+  804553:	49 89 df             	mov    %rbx,%r15
+  804556:	48 b8 1b 86 ff ff ff 	movabs $0xffffffffffff861b,%rax
+  80455d:	ff ff ff 
+  804560:	48 01 d8             	add    %rbx,%rax
+  804563:	ff d0                	call   *%rax
+  804565:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80456a:	7e 0a                	jle    804576 <open+0x50>
+		return -E_BAD_PATH;
+  80456c:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804571:	e9 18 01 00 00       	jmp    80468e <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804576:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80457a:	48 89 c7             	mov    %rax,%rdi
+  80457d:	49 89 df             	mov    %rbx,%r15
+  804580:	48 b8 1a a7 ff ff ff 	movabs $0xffffffffffffa71a,%rax
+  804587:	ff ff ff 
+  80458a:	48 01 d8             	add    %rbx,%rax
+  80458d:	ff d0                	call   *%rax
+  80458f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804592:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804596:	74 08                	je     8045a0 <open+0x7a>
+		return r;
+  804598:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80459b:	e9 ee 00 00 00       	jmp    80468e <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  8045a0:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8045a7:	00 00 00 
+  8045aa:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045ad:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  8045b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045b8:	48 89 c6             	mov    %rax,%rsi
+  8045bb:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8045c2:	00 00 00 
+  8045c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045c9:	48 89 c7             	mov    %rax,%rdi
+  8045cc:	49 89 df             	mov    %rbx,%r15
+  8045cf:	48 b8 af 86 ff ff ff 	movabs $0xffffffffffff86af,%rax
+  8045d6:	ff ff ff 
+  8045d9:	48 01 d8             	add    %rbx,%rax
+  8045dc:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  8045de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045e2:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  8045e7:	48 89 c6             	mov    %rax,%rsi
+  8045ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045ef:	49 89 df             	mov    %rbx,%r15
+  8045f2:	48 b8 6b 93 ff ff ff 	movabs $0xffffffffffff936b,%rax
+  8045f9:	ff ff ff 
+  8045fc:	48 01 d8             	add    %rbx,%rax
+  8045ff:	ff d0                	call   *%rax
+  804601:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804604:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804608:	74 23                	je     80462d <open+0x107>
+		fd_close(fd,0);
+  80460a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80460e:	be 00 00 00 00       	mov    $0x0,%esi
+  804613:	48 89 c7             	mov    %rax,%rdi
+  804616:	49 89 df             	mov    %rbx,%r15
+  804619:	48 b8 7b a8 ff ff ff 	movabs $0xffffffffffffa87b,%rax
+  804620:	ff ff ff 
+  804623:	48 01 d8             	add    %rbx,%rax
+  804626:	ff d0                	call   *%rax
+		return r;
+  804628:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80462b:	eb 61                	jmp    80468e <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  80462d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804631:	48 89 c6             	mov    %rax,%rsi
+  804634:	bf 01 00 00 00       	mov    $0x1,%edi
+  804639:	48 b8 9f b2 ff ff ff 	movabs $0xffffffffffffb29f,%rax
+  804640:	ff ff ff 
+  804643:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804647:	ff d0                	call   *%rax
+  804649:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80464c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804650:	74 23                	je     804675 <open+0x14f>
+		fd_close(fd,0);
+  804652:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804656:	be 00 00 00 00       	mov    $0x0,%esi
+  80465b:	48 89 c7             	mov    %rax,%rdi
+  80465e:	49 89 df             	mov    %rbx,%r15
+  804661:	48 b8 7b a8 ff ff ff 	movabs $0xffffffffffffa87b,%rax
+  804668:	ff ff ff 
+  80466b:	48 01 d8             	add    %rbx,%rax
+  80466e:	ff d0                	call   *%rax
+		return r;
+  804670:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804673:	eb 19                	jmp    80468e <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804675:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804679:	48 89 c7             	mov    %rax,%rdi
+  80467c:	49 89 df             	mov    %rbx,%r15
+  80467f:	48 b8 a0 a6 ff ff ff 	movabs $0xffffffffffffa6a0,%rax
+  804686:	ff ff ff 
+  804689:	48 01 d8             	add    %rbx,%rax
+  80468c:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  80468e:	48 83 c4 20          	add    $0x20,%rsp
+  804692:	5b                   	pop    %rbx
+  804693:	41 5f                	pop    %r15
+  804695:	5d                   	pop    %rbp
+  804696:	c3                   	ret
+
+0000000000804697 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804697:	55                   	push   %rbp
+  804698:	48 89 e5             	mov    %rsp,%rbp
+  80469b:	48 83 ec 20          	sub    $0x20,%rsp
+  80469f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80469f <devfile_flush+0x8>
+  8046a6:	49 bb a1 49 00 00 00 	movabs $0x49a1,%r11
+  8046ad:	00 00 00 
+  8046b0:	4c 01 d8             	add    %r11,%rax
+  8046b3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8046b7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8046bb:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8046be:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  8046c1:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8046c5:	ba 04 00 00 00       	mov    $0x4,%edx
+  8046ca:	48 89 ce             	mov    %rcx,%rsi
+  8046cd:	bf 06 00 00 00       	mov    $0x6,%edi
+  8046d2:	48 b9 47 b3 ff ff ff 	movabs $0xffffffffffffb347,%rcx
+  8046d9:	ff ff ff 
+  8046dc:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8046e0:	ff d0                	call   *%rax
+}
+  8046e2:	c9                   	leave
+  8046e3:	c3                   	ret
+
+00000000008046e4 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  8046e4:	55                   	push   %rbp
+  8046e5:	48 89 e5             	mov    %rsp,%rbp
+  8046e8:	41 57                	push   %r15
+  8046ea:	53                   	push   %rbx
+  8046eb:	48 83 ec 60          	sub    $0x60,%rsp
+  8046ef:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046ef <devfile_read+0xb>
+  8046f6:	49 bb 51 49 00 00 00 	movabs $0x4951,%r11
+  8046fd:	00 00 00 
+  804700:	4c 01 db             	add    %r11,%rbx
+  804703:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804707:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80470b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80470f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804713:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804717:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80471b:	8b 50 0c             	mov    0xc(%rax),%edx
+  80471e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804722:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804724:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804728:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80472c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804730:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804734:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804739:	ba 10 00 00 00       	mov    $0x10,%edx
+  80473e:	48 89 c6             	mov    %rax,%rsi
+  804741:	bf 03 00 00 00       	mov    $0x3,%edi
+  804746:	48 b8 db b3 ff ff ff 	movabs $0xffffffffffffb3db,%rax
+  80474d:	ff ff ff 
+  804750:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804754:	ff d0                	call   *%rax
+  804756:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804759:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80475d:	79 05                	jns    804764 <devfile_read+0x80>
+		return r;
+  80475f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804762:	eb 64                	jmp    8047c8 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804764:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804767:	48 63 d0             	movslq %eax,%rdx
+  80476a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80476e:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804773:	48 01 c1             	add    %rax,%rcx
+  804776:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80477a:	48 89 ce             	mov    %rcx,%rsi
+  80477d:	48 89 c7             	mov    %rax,%rdi
+  804780:	49 89 df             	mov    %rbx,%r15
+  804783:	48 b8 8f 8a ff ff ff 	movabs $0xffffffffffff8a8f,%rax
+  80478a:	ff ff ff 
+  80478d:	48 01 d8             	add    %rbx,%rax
+  804790:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804792:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804799:	ff ff ff 
+  80479c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8047a0:	48 8b 00             	mov    (%rax),%rax
+  8047a3:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8047a9:	89 c6                	mov    %eax,%esi
+  8047ab:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8047b0:	48 89 c7             	mov    %rax,%rdi
+  8047b3:	49 89 df             	mov    %rbx,%r15
+  8047b6:	48 b8 fb de ff ff ff 	movabs $0xffffffffffffdefb,%rax
+  8047bd:	ff ff ff 
+  8047c0:	48 01 d8             	add    %rbx,%rax
+  8047c3:	ff d0                	call   *%rax
+	return r;
+  8047c5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  8047c8:	48 83 c4 60          	add    $0x60,%rsp
+  8047cc:	5b                   	pop    %rbx
+  8047cd:	41 5f                	pop    %r15
+  8047cf:	5d                   	pop    %rbp
+  8047d0:	c3                   	ret
+
+00000000008047d1 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8047d1:	55                   	push   %rbp
+  8047d2:	48 89 e5             	mov    %rsp,%rbp
+  8047d5:	41 57                	push   %r15
+  8047d7:	53                   	push   %rbx
+  8047d8:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  8047dc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047dc <devfile_write+0xb>
+  8047e3:	49 bb 64 48 00 00 00 	movabs $0x4864,%r11
+  8047ea:	00 00 00 
+  8047ed:	4c 01 db             	add    %r11,%rbx
+  8047f0:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  8047f4:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  8047f8:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  8047ff:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804803:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804807:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  80480e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804812:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804819:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80481c:	48 63 d0             	movslq %eax,%rdx
+  80481f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804823:	48 39 c2             	cmp    %rax,%rdx
+  804826:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80482a:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804831:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804838:	00 
+  804839:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804840:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804844:	48 01 d0             	add    %rdx,%rax
+  804847:	48 83 e8 01          	sub    $0x1,%rax
+  80484b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80484f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804853:	ba 00 00 00 00       	mov    $0x0,%edx
+  804858:	48 f7 75 d0          	divq   -0x30(%rbp)
+  80485c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804860:	48 29 d0             	sub    %rdx,%rax
+  804863:	48 c1 e8 0c          	shr    $0xc,%rax
+  804867:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  80486a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80486d:	89 c6                	mov    %eax,%esi
+  80486f:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804874:	48 89 c7             	mov    %rax,%rdi
+  804877:	49 89 df             	mov    %rbx,%r15
+  80487a:	48 b8 b5 de ff ff ff 	movabs $0xffffffffffffdeb5,%rax
+  804881:	ff ff ff 
+  804884:	48 01 d8             	add    %rbx,%rax
+  804887:	ff d0                	call   *%rax
+  804889:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  80488c:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804890:	79 08                	jns    80489a <devfile_write+0xc9>
+		return r;
+  804892:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804895:	e9 8f 00 00 00       	jmp    804929 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  80489a:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8048a1:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  8048a5:	48 89 c6             	mov    %rax,%rsi
+  8048a8:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8048ad:	48 89 c7             	mov    %rax,%rdi
+  8048b0:	49 89 df             	mov    %rbx,%r15
+  8048b3:	48 b8 8f 8a ff ff ff 	movabs $0xffffffffffff8a8f,%rax
+  8048ba:	ff ff ff 
+  8048bd:	48 01 d8             	add    %rbx,%rax
+  8048c0:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  8048c2:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8048c6:	8b 50 0c             	mov    0xc(%rax),%edx
+  8048c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048cd:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8048cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048d3:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8048da:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  8048de:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  8048e1:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8048e5:	89 d1                	mov    %edx,%ecx
+  8048e7:	ba 10 00 00 00       	mov    $0x10,%edx
+  8048ec:	48 89 c6             	mov    %rax,%rsi
+  8048ef:	bf 04 00 00 00       	mov    $0x4,%edi
+  8048f4:	48 b8 db b3 ff ff ff 	movabs $0xffffffffffffb3db,%rax
+  8048fb:	ff ff ff 
+  8048fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804902:	ff d0                	call   *%rax
+  804904:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804907:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80490a:	89 c6                	mov    %eax,%esi
+  80490c:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804911:	48 89 c7             	mov    %rax,%rdi
+  804914:	49 89 df             	mov    %rbx,%r15
+  804917:	48 b8 fb de ff ff ff 	movabs $0xffffffffffffdefb,%rax
+  80491e:	ff ff ff 
+  804921:	48 01 d8             	add    %rbx,%rax
+  804924:	ff d0                	call   *%rax
+	return r;
+  804926:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804929:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  80492d:	5b                   	pop    %rbx
+  80492e:	41 5f                	pop    %r15
+  804930:	5d                   	pop    %rbp
+  804931:	c3                   	ret
+
+0000000000804932 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804932:	55                   	push   %rbp
+  804933:	48 89 e5             	mov    %rsp,%rbp
+  804936:	41 57                	push   %r15
+  804938:	53                   	push   %rbx
+  804939:	48 83 ec 20          	sub    $0x20,%rsp
+  80493d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80493d <devfile_stat+0xb>
+  804944:	49 bb 03 47 00 00 00 	movabs $0x4703,%r11
+  80494b:	00 00 00 
+  80494e:	4c 01 db             	add    %r11,%rbx
+  804951:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804955:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804959:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80495d:	8b 40 0c             	mov    0xc(%rax),%eax
+  804960:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804967:	00 00 00 
+  80496a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80496d:	be 00 00 00 00       	mov    $0x0,%esi
+  804972:	bf 05 00 00 00       	mov    $0x5,%edi
+  804977:	48 b8 9f b2 ff ff ff 	movabs $0xffffffffffffb29f,%rax
+  80497e:	ff ff ff 
+  804981:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804985:	ff d0                	call   *%rax
+  804987:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80498a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80498e:	79 05                	jns    804995 <devfile_stat+0x63>
+		return r;
+  804990:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804993:	eb 65                	jmp    8049fa <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804995:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804999:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8049a0:	00 00 00 
+  8049a3:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8049a7:	48 89 d6             	mov    %rdx,%rsi
+  8049aa:	48 89 c7             	mov    %rax,%rdi
+  8049ad:	49 89 df             	mov    %rbx,%r15
+  8049b0:	48 b8 af 86 ff ff ff 	movabs $0xffffffffffff86af,%rax
+  8049b7:	ff ff ff 
+  8049ba:	48 01 d8             	add    %rbx,%rax
+  8049bd:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8049bf:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8049c6:	00 00 00 
+  8049c9:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  8049d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049d4:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8049da:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8049e1:	00 00 00 
+  8049e4:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  8049eb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049ef:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  8049f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049fa:	48 83 c4 20          	add    $0x20,%rsp
+  8049fe:	5b                   	pop    %rbx
+  8049ff:	41 5f                	pop    %r15
+  804a01:	5d                   	pop    %rbp
+  804a02:	c3                   	ret
+
+0000000000804a03 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804a03:	55                   	push   %rbp
+  804a04:	48 89 e5             	mov    %rsp,%rbp
+  804a07:	48 83 ec 20          	sub    $0x20,%rsp
+  804a0b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804a0b <devfile_trunc+0x8>
+  804a12:	49 bb 35 46 00 00 00 	movabs $0x4635,%r11
+  804a19:	00 00 00 
+  804a1c:	4c 01 d8             	add    %r11,%rax
+  804a1f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804a23:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  804a26:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804a2a:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804a2d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804a30:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804a33:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  804a36:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804a3a:	ba 08 00 00 00       	mov    $0x8,%edx
+  804a3f:	48 89 ce             	mov    %rcx,%rsi
+  804a42:	bf 02 00 00 00       	mov    $0x2,%edi
+  804a47:	48 b9 47 b3 ff ff ff 	movabs $0xffffffffffffb347,%rcx
+  804a4e:	ff ff ff 
+  804a51:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804a55:	ff d0                	call   *%rax
+}
+  804a57:	c9                   	leave
+  804a58:	c3                   	ret
+
+0000000000804a59 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  804a59:	55                   	push   %rbp
+  804a5a:	48 89 e5             	mov    %rsp,%rbp
+  804a5d:	41 57                	push   %r15
+  804a5f:	53                   	push   %rbx
+  804a60:	48 83 ec 10          	sub    $0x10,%rsp
+  804a64:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a64 <remove+0xb>
+  804a6b:	49 bb dc 45 00 00 00 	movabs $0x45dc,%r11
+  804a72:	00 00 00 
+  804a75:	4c 01 db             	add    %r11,%rbx
+  804a78:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  804a7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a80:	48 89 c7             	mov    %rax,%rdi
+  804a83:	49 89 df             	mov    %rbx,%r15
+  804a86:	48 b8 1b 86 ff ff ff 	movabs $0xffffffffffff861b,%rax
+  804a8d:	ff ff ff 
+  804a90:	48 01 d8             	add    %rbx,%rax
+  804a93:	ff d0                	call   *%rax
+  804a95:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804a9a:	7e 07                	jle    804aa3 <remove+0x4a>
+		return -E_BAD_PATH;
+  804a9c:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804aa1:	eb 44                	jmp    804ae7 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  804aa3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804aa7:	48 89 c6             	mov    %rax,%rsi
+  804aaa:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804ab1:	00 00 00 
+  804ab4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ab8:	48 89 c7             	mov    %rax,%rdi
+  804abb:	49 89 df             	mov    %rbx,%r15
+  804abe:	48 b8 af 86 ff ff ff 	movabs $0xffffffffffff86af,%rax
+  804ac5:	ff ff ff 
+  804ac8:	48 01 d8             	add    %rbx,%rax
+  804acb:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804acd:	be 00 00 00 00       	mov    $0x0,%esi
+  804ad2:	bf 07 00 00 00       	mov    $0x7,%edi
+  804ad7:	48 b8 9f b2 ff ff ff 	movabs $0xffffffffffffb29f,%rax
+  804ade:	ff ff ff 
+  804ae1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ae5:	ff d0                	call   *%rax
+}
+  804ae7:	48 83 c4 10          	add    $0x10,%rsp
+  804aeb:	5b                   	pop    %rbx
+  804aec:	41 5f                	pop    %r15
+  804aee:	5d                   	pop    %rbp
+  804aef:	c3                   	ret
+
+0000000000804af0 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804af0:	55                   	push   %rbp
+  804af1:	48 89 e5             	mov    %rsp,%rbp
+  804af4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804af4 <sync+0x4>
+  804afb:	49 bb 4c 45 00 00 00 	movabs $0x454c,%r11
+  804b02:	00 00 00 
+  804b05:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  804b08:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b0d:	be 00 00 00 00       	mov    $0x0,%esi
+  804b12:	bf 08 00 00 00       	mov    $0x8,%edi
+  804b17:	48 b9 47 b3 ff ff ff 	movabs $0xffffffffffffb347,%rcx
+  804b1e:	ff ff ff 
+  804b21:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804b25:	ff d0                	call   *%rax
+}
+  804b27:	5d                   	pop    %rbp
+  804b28:	c3                   	ret
+
+0000000000804b29 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  804b29:	55                   	push   %rbp
+  804b2a:	48 89 e5             	mov    %rsp,%rbp
+  804b2d:	41 57                	push   %r15
+  804b2f:	53                   	push   %rbx
+  804b30:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  804b37:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b37 <copy+0xe>
+  804b3e:	49 bb 09 45 00 00 00 	movabs $0x4509,%r11
+  804b45:	00 00 00 
+  804b48:	4c 01 db             	add    %r11,%rbx
+  804b4b:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804b52:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  804b59:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  804b60:	be 00 00 00 00       	mov    $0x0,%esi
+  804b65:	48 89 c7             	mov    %rax,%rdi
+  804b68:	48 b8 e6 b4 ff ff ff 	movabs $0xffffffffffffb4e6,%rax
+  804b6f:	ff ff ff 
+  804b72:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b76:	ff d0                	call   *%rax
+  804b78:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  804b7b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b7f:	79 35                	jns    804bb6 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  804b81:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b84:	89 c6                	mov    %eax,%esi
+  804b86:	48 b8 96 e7 ff ff ff 	movabs $0xffffffffffffe796,%rax
+  804b8d:	ff ff ff 
+  804b90:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b94:	48 89 c7             	mov    %rax,%rdi
+  804b97:	49 89 df             	mov    %rbx,%r15
+  804b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b9f:	48 ba ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%rdx
+  804ba6:	ff ff ff 
+  804ba9:	48 01 da             	add    %rbx,%rdx
+  804bac:	ff d2                	call   *%rdx
+		return fd_src;
+  804bae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bb1:	e9 d7 01 00 00       	jmp    804d8d <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  804bb6:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804bbd:	be 01 01 00 00       	mov    $0x101,%esi
+  804bc2:	48 89 c7             	mov    %rax,%rdi
+  804bc5:	48 b8 e6 b4 ff ff ff 	movabs $0xffffffffffffb4e6,%rax
+  804bcc:	ff ff ff 
+  804bcf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bd3:	ff d0                	call   *%rax
+  804bd5:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  804bd8:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804bdc:	0f 89 df 00 00 00    	jns    804cc1 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804be2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804be5:	89 c6                	mov    %eax,%esi
+  804be7:	48 b8 ac e7 ff ff ff 	movabs $0xffffffffffffe7ac,%rax
+  804bee:	ff ff ff 
+  804bf1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bf5:	48 89 c7             	mov    %rax,%rdi
+  804bf8:	49 89 df             	mov    %rbx,%r15
+  804bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c00:	48 ba ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%rdx
+  804c07:	ff ff ff 
+  804c0a:	48 01 da             	add    %rbx,%rdx
+  804c0d:	ff d2                	call   *%rdx
+		close(fd_src);
+  804c0f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c12:	89 c7                	mov    %eax,%edi
+  804c14:	49 89 df             	mov    %rbx,%r15
+  804c17:	48 b8 5f aa ff ff ff 	movabs $0xffffffffffffaa5f,%rax
+  804c1e:	ff ff ff 
+  804c21:	48 01 d8             	add    %rbx,%rax
+  804c24:	ff d0                	call   *%rax
+		return fd_dest;
+  804c26:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c29:	e9 5f 01 00 00       	jmp    804d8d <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804c2e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804c31:	48 63 d0             	movslq %eax,%rdx
+  804c34:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804c3b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c3e:	48 89 ce             	mov    %rcx,%rsi
+  804c41:	89 c7                	mov    %eax,%edi
+  804c43:	49 89 df             	mov    %rbx,%r15
+  804c46:	48 b8 bd ae ff ff ff 	movabs $0xffffffffffffaebd,%rax
+  804c4d:	ff ff ff 
+  804c50:	48 01 d8             	add    %rbx,%rax
+  804c53:	ff d0                	call   *%rax
+  804c55:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804c58:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804c5c:	79 63                	jns    804cc1 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804c5e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804c61:	89 c6                	mov    %eax,%esi
+  804c63:	48 b8 c6 e7 ff ff ff 	movabs $0xffffffffffffe7c6,%rax
+  804c6a:	ff ff ff 
+  804c6d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c71:	48 89 c7             	mov    %rax,%rdi
+  804c74:	49 89 df             	mov    %rbx,%r15
+  804c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c7c:	48 ba ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%rdx
+  804c83:	ff ff ff 
+  804c86:	48 01 da             	add    %rbx,%rdx
+  804c89:	ff d2                	call   *%rdx
+			close(fd_src);
+  804c8b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c8e:	89 c7                	mov    %eax,%edi
+  804c90:	49 89 df             	mov    %rbx,%r15
+  804c93:	48 b8 5f aa ff ff ff 	movabs $0xffffffffffffaa5f,%rax
+  804c9a:	ff ff ff 
+  804c9d:	48 01 d8             	add    %rbx,%rax
+  804ca0:	ff d0                	call   *%rax
+			close(fd_dest);
+  804ca2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804ca5:	89 c7                	mov    %eax,%edi
+  804ca7:	49 89 df             	mov    %rbx,%r15
+  804caa:	48 b8 5f aa ff ff ff 	movabs $0xffffffffffffaa5f,%rax
+  804cb1:	ff ff ff 
+  804cb4:	48 01 d8             	add    %rbx,%rax
+  804cb7:	ff d0                	call   *%rax
+			return write_size;
+  804cb9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804cbc:	e9 cc 00 00 00       	jmp    804d8d <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804cc1:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804cc8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ccb:	ba 00 02 00 00       	mov    $0x200,%edx
+  804cd0:	48 89 ce             	mov    %rcx,%rsi
+  804cd3:	89 c7                	mov    %eax,%edi
+  804cd5:	49 89 df             	mov    %rbx,%r15
+  804cd8:	48 b8 17 ad ff ff ff 	movabs $0xffffffffffffad17,%rax
+  804cdf:	ff ff ff 
+  804ce2:	48 01 d8             	add    %rbx,%rax
+  804ce5:	ff d0                	call   *%rax
+  804ce7:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804cea:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804cee:	0f 8f 3a ff ff ff    	jg     804c2e <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804cf4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804cf8:	79 60                	jns    804d5a <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804cfa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804cfd:	89 c6                	mov    %eax,%esi
+  804cff:	48 b8 d9 e7 ff ff ff 	movabs $0xffffffffffffe7d9,%rax
+  804d06:	ff ff ff 
+  804d09:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d0d:	48 89 c7             	mov    %rax,%rdi
+  804d10:	49 89 df             	mov    %rbx,%r15
+  804d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d18:	48 ba ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%rdx
+  804d1f:	ff ff ff 
+  804d22:	48 01 da             	add    %rbx,%rdx
+  804d25:	ff d2                	call   *%rdx
+		close(fd_src);
+  804d27:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d2a:	89 c7                	mov    %eax,%edi
+  804d2c:	49 89 df             	mov    %rbx,%r15
+  804d2f:	48 b8 5f aa ff ff ff 	movabs $0xffffffffffffaa5f,%rax
+  804d36:	ff ff ff 
+  804d39:	48 01 d8             	add    %rbx,%rax
+  804d3c:	ff d0                	call   *%rax
+		close(fd_dest);
+  804d3e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d41:	89 c7                	mov    %eax,%edi
+  804d43:	49 89 df             	mov    %rbx,%r15
+  804d46:	48 b8 5f aa ff ff ff 	movabs $0xffffffffffffaa5f,%rax
+  804d4d:	ff ff ff 
+  804d50:	48 01 d8             	add    %rbx,%rax
+  804d53:	ff d0                	call   *%rax
+		return read_size;
+  804d55:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804d58:	eb 33                	jmp    804d8d <copy+0x264>
+	}
+	close(fd_src);
+  804d5a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d5d:	89 c7                	mov    %eax,%edi
+  804d5f:	49 89 df             	mov    %rbx,%r15
+  804d62:	48 b8 5f aa ff ff ff 	movabs $0xffffffffffffaa5f,%rax
+  804d69:	ff ff ff 
+  804d6c:	48 01 d8             	add    %rbx,%rax
+  804d6f:	ff d0                	call   *%rax
+	close(fd_dest);
+  804d71:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d74:	89 c7                	mov    %eax,%edi
+  804d76:	49 89 df             	mov    %rbx,%r15
+  804d79:	48 b8 5f aa ff ff ff 	movabs $0xffffffffffffaa5f,%rax
+  804d80:	ff ff ff 
+  804d83:	48 01 d8             	add    %rbx,%rax
+  804d86:	ff d0                	call   *%rax
+	return 0;
+  804d88:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804d8d:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804d94:	5b                   	pop    %rbx
+  804d95:	41 5f                	pop    %r15
+  804d97:	5d                   	pop    %rbp
+  804d98:	c3                   	ret
+
+0000000000804d99 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804d99:	55                   	push   %rbp
+  804d9a:	48 89 e5             	mov    %rsp,%rbp
+  804d9d:	41 57                	push   %r15
+  804d9f:	53                   	push   %rbx
+  804da0:	48 83 ec 20          	sub    $0x20,%rsp
+  804da4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804da4 <fd2sockid+0xb>
+  804dab:	49 bb 9c 42 00 00 00 	movabs $0x429c,%r11
+  804db2:	00 00 00 
+  804db5:	4c 01 db             	add    %r11,%rbx
+  804db8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804dbb:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804dbf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804dc2:	48 89 d6             	mov    %rdx,%rsi
+  804dc5:	89 c7                	mov    %eax,%edi
+  804dc7:	49 89 df             	mov    %rbx,%r15
+  804dca:	48 b8 d0 a7 ff ff ff 	movabs $0xffffffffffffa7d0,%rax
+  804dd1:	ff ff ff 
+  804dd4:	48 01 d8             	add    %rbx,%rax
+  804dd7:	ff d0                	call   *%rax
+  804dd9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ddc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804de0:	79 05                	jns    804de7 <fd2sockid+0x4e>
+		return r;
+  804de2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804de5:	eb 25                	jmp    804e0c <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804de7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804deb:	8b 10                	mov    (%rax),%edx
+  804ded:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  804df4:	00 00 00 
+  804df7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804dfa:	39 c2                	cmp    %eax,%edx
+  804dfc:	74 07                	je     804e05 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804dfe:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804e03:	eb 07                	jmp    804e0c <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804e05:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e09:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804e0c:	48 83 c4 20          	add    $0x20,%rsp
+  804e10:	5b                   	pop    %rbx
+  804e11:	41 5f                	pop    %r15
+  804e13:	5d                   	pop    %rbp
+  804e14:	c3                   	ret
+
+0000000000804e15 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804e15:	55                   	push   %rbp
+  804e16:	48 89 e5             	mov    %rsp,%rbp
+  804e19:	41 57                	push   %r15
+  804e1b:	53                   	push   %rbx
+  804e1c:	48 83 ec 20          	sub    $0x20,%rsp
+  804e20:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e20 <alloc_sockfd+0xb>
+  804e27:	49 bb 20 42 00 00 00 	movabs $0x4220,%r11
+  804e2e:	00 00 00 
+  804e31:	4c 01 db             	add    %r11,%rbx
+  804e34:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804e37:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804e3b:	48 89 c7             	mov    %rax,%rdi
+  804e3e:	49 89 df             	mov    %rbx,%r15
+  804e41:	48 b8 1a a7 ff ff ff 	movabs $0xffffffffffffa71a,%rax
+  804e48:	ff ff ff 
+  804e4b:	48 01 d8             	add    %rbx,%rax
+  804e4e:	ff d0                	call   *%rax
+  804e50:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e53:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e57:	78 2c                	js     804e85 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804e59:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e5d:	ba 07 04 00 00       	mov    $0x407,%edx
+  804e62:	48 89 c6             	mov    %rax,%rsi
+  804e65:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e6a:	49 89 df             	mov    %rbx,%r15
+  804e6d:	48 b8 6b 93 ff ff ff 	movabs $0xffffffffffff936b,%rax
+  804e74:	ff ff ff 
+  804e77:	48 01 d8             	add    %rbx,%rax
+  804e7a:	ff d0                	call   *%rax
+  804e7c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e7f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e83:	79 1c                	jns    804ea1 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804e85:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e88:	89 c7                	mov    %eax,%edi
+  804e8a:	49 89 df             	mov    %rbx,%r15
+  804e8d:	48 b8 c9 c5 ff ff ff 	movabs $0xffffffffffffc5c9,%rax
+  804e94:	ff ff ff 
+  804e97:	48 01 d8             	add    %rbx,%rax
+  804e9a:	ff d0                	call   *%rax
+		return r;
+  804e9c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e9f:	eb 41                	jmp    804ee2 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804ea1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ea5:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  804eac:	00 00 00 
+  804eaf:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804eb2:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804eb4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804eb8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804ebf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ec3:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804ec6:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804ec9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ecd:	48 89 c7             	mov    %rax,%rdi
+  804ed0:	49 89 df             	mov    %rbx,%r15
+  804ed3:	48 b8 a0 a6 ff ff ff 	movabs $0xffffffffffffa6a0,%rax
+  804eda:	ff ff ff 
+  804edd:	48 01 d8             	add    %rbx,%rax
+  804ee0:	ff d0                	call   *%rax
+}
+  804ee2:	48 83 c4 20          	add    $0x20,%rsp
+  804ee6:	5b                   	pop    %rbx
+  804ee7:	41 5f                	pop    %r15
+  804ee9:	5d                   	pop    %rbp
+  804eea:	c3                   	ret
+
+0000000000804eeb <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804eeb:	55                   	push   %rbp
+  804eec:	48 89 e5             	mov    %rsp,%rbp
+  804eef:	41 57                	push   %r15
+  804ef1:	53                   	push   %rbx
+  804ef2:	48 83 ec 30          	sub    $0x30,%rsp
+  804ef6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ef6 <accept+0xb>
+  804efd:	49 bb 4a 41 00 00 00 	movabs $0x414a,%r11
+  804f04:	00 00 00 
+  804f07:	4c 01 db             	add    %r11,%rbx
+  804f0a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804f0d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804f11:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804f15:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f18:	89 c7                	mov    %eax,%edi
+  804f1a:	48 b8 59 bd ff ff ff 	movabs $0xffffffffffffbd59,%rax
+  804f21:	ff ff ff 
+  804f24:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f28:	ff d0                	call   *%rax
+  804f2a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f2d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f31:	79 05                	jns    804f38 <accept+0x4d>
+		return r;
+  804f33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f36:	eb 45                	jmp    804f7d <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804f38:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804f3c:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804f40:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f43:	48 89 ce             	mov    %rcx,%rsi
+  804f46:	89 c7                	mov    %eax,%edi
+  804f48:	49 89 df             	mov    %rbx,%r15
+  804f4b:	48 b8 37 c4 ff ff ff 	movabs $0xffffffffffffc437,%rax
+  804f52:	ff ff ff 
+  804f55:	48 01 d8             	add    %rbx,%rax
+  804f58:	ff d0                	call   *%rax
+  804f5a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f5d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f61:	79 05                	jns    804f68 <accept+0x7d>
+		return r;
+  804f63:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f66:	eb 15                	jmp    804f7d <accept+0x92>
+	return alloc_sockfd(r);
+  804f68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f6b:	89 c7                	mov    %eax,%edi
+  804f6d:	48 b8 d5 bd ff ff ff 	movabs $0xffffffffffffbdd5,%rax
+  804f74:	ff ff ff 
+  804f77:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f7b:	ff d0                	call   *%rax
+}
+  804f7d:	48 83 c4 30          	add    $0x30,%rsp
+  804f81:	5b                   	pop    %rbx
+  804f82:	41 5f                	pop    %r15
+  804f84:	5d                   	pop    %rbp
+  804f85:	c3                   	ret
+
+0000000000804f86 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804f86:	55                   	push   %rbp
+  804f87:	48 89 e5             	mov    %rsp,%rbp
+  804f8a:	41 57                	push   %r15
+  804f8c:	53                   	push   %rbx
+  804f8d:	48 83 ec 20          	sub    $0x20,%rsp
+  804f91:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f91 <bind+0xb>
+  804f98:	49 bb af 40 00 00 00 	movabs $0x40af,%r11
+  804f9f:	00 00 00 
+  804fa2:	4c 01 db             	add    %r11,%rbx
+  804fa5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804fa8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804fac:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804faf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fb2:	89 c7                	mov    %eax,%edi
+  804fb4:	48 b8 59 bd ff ff ff 	movabs $0xffffffffffffbd59,%rax
+  804fbb:	ff ff ff 
+  804fbe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fc2:	ff d0                	call   *%rax
+  804fc4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804fc7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804fcb:	79 05                	jns    804fd2 <bind+0x4c>
+		return r;
+  804fcd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fd0:	eb 21                	jmp    804ff3 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804fd2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804fd5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804fd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fdc:	48 89 ce             	mov    %rcx,%rsi
+  804fdf:	89 c7                	mov    %eax,%edi
+  804fe1:	49 89 df             	mov    %rbx,%r15
+  804fe4:	48 b8 e3 c4 ff ff ff 	movabs $0xffffffffffffc4e3,%rax
+  804feb:	ff ff ff 
+  804fee:	48 01 d8             	add    %rbx,%rax
+  804ff1:	ff d0                	call   *%rax
+}
+  804ff3:	48 83 c4 20          	add    $0x20,%rsp
+  804ff7:	5b                   	pop    %rbx
+  804ff8:	41 5f                	pop    %r15
+  804ffa:	5d                   	pop    %rbp
+  804ffb:	c3                   	ret
+
+0000000000804ffc <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804ffc:	55                   	push   %rbp
+  804ffd:	48 89 e5             	mov    %rsp,%rbp
+  805000:	41 57                	push   %r15
+  805002:	53                   	push   %rbx
+  805003:	48 83 ec 20          	sub    $0x20,%rsp
+  805007:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805007 <shutdown+0xb>
+  80500e:	49 bb 39 40 00 00 00 	movabs $0x4039,%r11
+  805015:	00 00 00 
+  805018:	4c 01 db             	add    %r11,%rbx
+  80501b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80501e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805021:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805024:	89 c7                	mov    %eax,%edi
+  805026:	48 b8 59 bd ff ff ff 	movabs $0xffffffffffffbd59,%rax
+  80502d:	ff ff ff 
+  805030:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805034:	ff d0                	call   *%rax
+  805036:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805039:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80503d:	79 05                	jns    805044 <shutdown+0x48>
+		return r;
+  80503f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805042:	eb 1c                	jmp    805060 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  805044:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805047:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80504a:	89 d6                	mov    %edx,%esi
+  80504c:	89 c7                	mov    %eax,%edi
+  80504e:	49 89 df             	mov    %rbx,%r15
+  805051:	48 b8 78 c5 ff ff ff 	movabs $0xffffffffffffc578,%rax
+  805058:	ff ff ff 
+  80505b:	48 01 d8             	add    %rbx,%rax
+  80505e:	ff d0                	call   *%rax
+}
+  805060:	48 83 c4 20          	add    $0x20,%rsp
+  805064:	5b                   	pop    %rbx
+  805065:	41 5f                	pop    %r15
+  805067:	5d                   	pop    %rbp
+  805068:	c3                   	ret
+
+0000000000805069 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  805069:	55                   	push   %rbp
+  80506a:	48 89 e5             	mov    %rsp,%rbp
+  80506d:	41 57                	push   %r15
+  80506f:	53                   	push   %rbx
+  805070:	48 83 ec 10          	sub    $0x10,%rsp
+  805074:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805074 <devsock_close+0xb>
+  80507b:	49 bb cc 3f 00 00 00 	movabs $0x3fcc,%r11
+  805082:	00 00 00 
+  805085:	4c 01 db             	add    %r11,%rbx
+  805088:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  80508c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805090:	48 89 c7             	mov    %rax,%rdi
+  805093:	49 89 df             	mov    %rbx,%r15
+  805096:	48 b8 d0 df ff ff ff 	movabs $0xffffffffffffdfd0,%rax
+  80509d:	ff ff ff 
+  8050a0:	48 01 d8             	add    %rbx,%rax
+  8050a3:	ff d0                	call   *%rax
+  8050a5:	83 f8 01             	cmp    $0x1,%eax
+  8050a8:	75 1d                	jne    8050c7 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  8050aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050ae:	8b 40 0c             	mov    0xc(%rax),%eax
+  8050b1:	89 c7                	mov    %eax,%edi
+  8050b3:	49 89 df             	mov    %rbx,%r15
+  8050b6:	48 b8 c9 c5 ff ff ff 	movabs $0xffffffffffffc5c9,%rax
+  8050bd:	ff ff ff 
+  8050c0:	48 01 d8             	add    %rbx,%rax
+  8050c3:	ff d0                	call   *%rax
+  8050c5:	eb 05                	jmp    8050cc <devsock_close+0x63>
+	else
+		return 0;
+  8050c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050cc:	48 83 c4 10          	add    $0x10,%rsp
+  8050d0:	5b                   	pop    %rbx
+  8050d1:	41 5f                	pop    %r15
+  8050d3:	5d                   	pop    %rbp
+  8050d4:	c3                   	ret
+
+00000000008050d5 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8050d5:	55                   	push   %rbp
+  8050d6:	48 89 e5             	mov    %rsp,%rbp
+  8050d9:	41 57                	push   %r15
+  8050db:	53                   	push   %rbx
+  8050dc:	48 83 ec 20          	sub    $0x20,%rsp
+  8050e0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050e0 <connect+0xb>
+  8050e7:	49 bb 60 3f 00 00 00 	movabs $0x3f60,%r11
+  8050ee:	00 00 00 
+  8050f1:	4c 01 db             	add    %r11,%rbx
+  8050f4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8050f7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8050fb:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8050fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805101:	89 c7                	mov    %eax,%edi
+  805103:	48 b8 59 bd ff ff ff 	movabs $0xffffffffffffbd59,%rax
+  80510a:	ff ff ff 
+  80510d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805111:	ff d0                	call   *%rax
+  805113:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805116:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80511a:	79 05                	jns    805121 <connect+0x4c>
+		return r;
+  80511c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80511f:	eb 21                	jmp    805142 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  805121:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805124:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805128:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80512b:	48 89 ce             	mov    %rcx,%rsi
+  80512e:	89 c7                	mov    %eax,%edi
+  805130:	49 89 df             	mov    %rbx,%r15
+  805133:	48 b8 11 c6 ff ff ff 	movabs $0xffffffffffffc611,%rax
+  80513a:	ff ff ff 
+  80513d:	48 01 d8             	add    %rbx,%rax
+  805140:	ff d0                	call   *%rax
+}
+  805142:	48 83 c4 20          	add    $0x20,%rsp
+  805146:	5b                   	pop    %rbx
+  805147:	41 5f                	pop    %r15
+  805149:	5d                   	pop    %rbp
+  80514a:	c3                   	ret
+
+000000000080514b <listen>:
+
+int
+listen(int s, int backlog)
+{
+  80514b:	55                   	push   %rbp
+  80514c:	48 89 e5             	mov    %rsp,%rbp
+  80514f:	41 57                	push   %r15
+  805151:	53                   	push   %rbx
+  805152:	48 83 ec 20          	sub    $0x20,%rsp
+  805156:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805156 <listen+0xb>
+  80515d:	49 bb ea 3e 00 00 00 	movabs $0x3eea,%r11
+  805164:	00 00 00 
+  805167:	4c 01 db             	add    %r11,%rbx
+  80516a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80516d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805170:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805173:	89 c7                	mov    %eax,%edi
+  805175:	48 b8 59 bd ff ff ff 	movabs $0xffffffffffffbd59,%rax
+  80517c:	ff ff ff 
+  80517f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805183:	ff d0                	call   *%rax
+  805185:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805188:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80518c:	79 05                	jns    805193 <listen+0x48>
+		return r;
+  80518e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805191:	eb 1c                	jmp    8051af <listen+0x64>
+	return nsipc_listen(r, backlog);
+  805193:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805196:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805199:	89 d6                	mov    %edx,%esi
+  80519b:	89 c7                	mov    %eax,%edi
+  80519d:	49 89 df             	mov    %rbx,%r15
+  8051a0:	48 b8 a6 c6 ff ff ff 	movabs $0xffffffffffffc6a6,%rax
+  8051a7:	ff ff ff 
+  8051aa:	48 01 d8             	add    %rbx,%rax
+  8051ad:	ff d0                	call   *%rax
+}
+  8051af:	48 83 c4 20          	add    $0x20,%rsp
+  8051b3:	5b                   	pop    %rbx
+  8051b4:	41 5f                	pop    %r15
+  8051b6:	5d                   	pop    %rbp
+  8051b7:	c3                   	ret
+
+00000000008051b8 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  8051b8:	55                   	push   %rbp
+  8051b9:	48 89 e5             	mov    %rsp,%rbp
+  8051bc:	41 57                	push   %r15
+  8051be:	48 83 ec 28          	sub    $0x28,%rsp
+  8051c2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8051c2 <devsock_read+0xa>
+  8051c9:	49 bb 7e 3e 00 00 00 	movabs $0x3e7e,%r11
+  8051d0:	00 00 00 
+  8051d3:	4c 01 d8             	add    %r11,%rax
+  8051d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8051da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8051de:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8051e2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8051e6:	41 89 d0             	mov    %edx,%r8d
+  8051e9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8051ed:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8051f0:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8051f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8051f9:	44 89 c2             	mov    %r8d,%edx
+  8051fc:	49 89 c7             	mov    %rax,%r15
+  8051ff:	49 b8 f7 c6 ff ff ff 	movabs $0xffffffffffffc6f7,%r8
+  805206:	ff ff ff 
+  805209:	49 01 c0             	add    %rax,%r8
+  80520c:	41 ff d0             	call   *%r8
+}
+  80520f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805213:	c9                   	leave
+  805214:	c3                   	ret
+
+0000000000805215 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805215:	55                   	push   %rbp
+  805216:	48 89 e5             	mov    %rsp,%rbp
+  805219:	41 57                	push   %r15
+  80521b:	48 83 ec 28          	sub    $0x28,%rsp
+  80521f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80521f <devsock_write+0xa>
+  805226:	49 bb 21 3e 00 00 00 	movabs $0x3e21,%r11
+  80522d:	00 00 00 
+  805230:	4c 01 d8             	add    %r11,%rax
+  805233:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805237:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80523b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80523f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805243:	41 89 d0             	mov    %edx,%r8d
+  805246:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80524a:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80524d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805251:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805256:	44 89 c2             	mov    %r8d,%edx
+  805259:	49 89 c7             	mov    %rax,%r15
+  80525c:	49 b8 14 c8 ff ff ff 	movabs $0xffffffffffffc814,%r8
+  805263:	ff ff ff 
+  805266:	49 01 c0             	add    %rax,%r8
+  805269:	41 ff d0             	call   *%r8
+}
+  80526c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805270:	c9                   	leave
+  805271:	c3                   	ret
+
+0000000000805272 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805272:	55                   	push   %rbp
+  805273:	48 89 e5             	mov    %rsp,%rbp
+  805276:	41 57                	push   %r15
+  805278:	48 83 ec 18          	sub    $0x18,%rsp
+  80527c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80527c <devsock_stat+0xa>
+  805283:	49 bb c4 3d 00 00 00 	movabs $0x3dc4,%r11
+  80528a:	00 00 00 
+  80528d:	4c 01 d8             	add    %r11,%rax
+  805290:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805294:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805298:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80529c:	48 b9 f4 e7 ff ff ff 	movabs $0xffffffffffffe7f4,%rcx
+  8052a3:	ff ff ff 
+  8052a6:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8052aa:	48 89 ce             	mov    %rcx,%rsi
+  8052ad:	48 89 d7             	mov    %rdx,%rdi
+  8052b0:	49 89 c7             	mov    %rax,%r15
+  8052b3:	48 ba af 86 ff ff ff 	movabs $0xffffffffffff86af,%rdx
+  8052ba:	ff ff ff 
+  8052bd:	48 01 c2             	add    %rax,%rdx
+  8052c0:	ff d2                	call   *%rdx
+	return 0;
+  8052c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8052c7:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8052cb:	c9                   	leave
+  8052cc:	c3                   	ret
+
+00000000008052cd <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8052cd:	55                   	push   %rbp
+  8052ce:	48 89 e5             	mov    %rsp,%rbp
+  8052d1:	41 57                	push   %r15
+  8052d3:	53                   	push   %rbx
+  8052d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8052d8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052d8 <socket+0xb>
+  8052df:	49 bb 68 3d 00 00 00 	movabs $0x3d68,%r11
+  8052e6:	00 00 00 
+  8052e9:	4c 01 db             	add    %r11,%rbx
+  8052ec:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8052ef:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8052f2:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8052f5:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8052f8:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8052fb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8052fe:	89 ce                	mov    %ecx,%esi
+  805300:	89 c7                	mov    %eax,%edi
+  805302:	49 89 df             	mov    %rbx,%r15
+  805305:	48 b8 eb c9 ff ff ff 	movabs $0xffffffffffffc9eb,%rax
+  80530c:	ff ff ff 
+  80530f:	48 01 d8             	add    %rbx,%rax
+  805312:	ff d0                	call   *%rax
+  805314:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805317:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80531b:	79 05                	jns    805322 <socket+0x55>
+		return r;
+  80531d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805320:	eb 15                	jmp    805337 <socket+0x6a>
+	return alloc_sockfd(r);
+  805322:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805325:	89 c7                	mov    %eax,%edi
+  805327:	48 b8 d5 bd ff ff ff 	movabs $0xffffffffffffbdd5,%rax
+  80532e:	ff ff ff 
+  805331:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805335:	ff d0                	call   *%rax
+}
+  805337:	48 83 c4 20          	add    $0x20,%rsp
+  80533b:	5b                   	pop    %rbx
+  80533c:	41 5f                	pop    %r15
+  80533e:	5d                   	pop    %rbp
+  80533f:	c3                   	ret
+
+0000000000805340 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805340:	55                   	push   %rbp
+  805341:	48 89 e5             	mov    %rsp,%rbp
+  805344:	41 57                	push   %r15
+  805346:	53                   	push   %rbx
+  805347:	48 83 ec 10          	sub    $0x10,%rsp
+  80534b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80534b <nsipc+0xb>
+  805352:	49 bb f5 3c 00 00 00 	movabs $0x3cf5,%r11
+  805359:	00 00 00 
+  80535c:	4c 01 db             	add    %r11,%rbx
+  80535f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805362:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805369:	00 00 00 
+  80536c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80536f:	85 c0                	test   %eax,%eax
+  805371:	75 24                	jne    805397 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805373:	bf 02 00 00 00       	mov    $0x2,%edi
+  805378:	49 89 df             	mov    %rbx,%r15
+  80537b:	48 b8 41 df ff ff ff 	movabs $0xffffffffffffdf41,%rax
+  805382:	ff ff ff 
+  805385:	48 01 d8             	add    %rbx,%rax
+  805388:	ff d0                	call   *%rax
+  80538a:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805391:	00 00 00 
+  805394:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805397:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80539e:	00 00 00 
+  8053a1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8053a4:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8053a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8053ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8053b3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8053b8:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8053bf:	00 00 00 
+  8053c2:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8053c6:	89 c7                	mov    %eax,%edi
+  8053c8:	49 89 df             	mov    %rbx,%r15
+  8053cb:	48 b8 60 d9 ff ff ff 	movabs $0xffffffffffffd960,%rax
+  8053d2:	ff ff ff 
+  8053d5:	48 01 d8             	add    %rbx,%rax
+  8053d8:	ff d0                	call   *%rax
+}
+  8053da:	48 83 c4 10          	add    $0x10,%rsp
+  8053de:	5b                   	pop    %rbx
+  8053df:	41 5f                	pop    %r15
+  8053e1:	5d                   	pop    %rbp
+  8053e2:	c3                   	ret
+
+00000000008053e3 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  8053e3:	55                   	push   %rbp
+  8053e4:	48 89 e5             	mov    %rsp,%rbp
+  8053e7:	41 57                	push   %r15
+  8053e9:	53                   	push   %rbx
+  8053ea:	48 83 ec 20          	sub    $0x20,%rsp
+  8053ee:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053ee <nsipc_words+0xb>
+  8053f5:	49 bb 52 3c 00 00 00 	movabs $0x3c52,%r11
+  8053fc:	00 00 00 
+  8053ff:	4c 01 db             	add    %r11,%rbx
+  805402:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805405:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805409:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  80540d:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805414:	00 00 00 
+  805417:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80541a:	85 c0                	test   %eax,%eax
+  80541c:	75 24                	jne    805442 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80541e:	bf 02 00 00 00       	mov    $0x2,%edi
+  805423:	49 89 df             	mov    %rbx,%r15
+  805426:	48 b8 41 df ff ff ff 	movabs $0xffffffffffffdf41,%rax
+  80542d:	ff ff ff 
+  805430:	48 01 d8             	add    %rbx,%rax
+  805433:	ff d0                	call   *%rax
+  805435:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  80543c:	00 00 00 
+  80543f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805442:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805449:	00 00 00 
+  80544c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80544f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805453:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805457:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80545a:	89 c7                	mov    %eax,%edi
+  80545c:	49 89 df             	mov    %rbx,%r15
+  80545f:	48 b8 4b da ff ff ff 	movabs $0xffffffffffffda4b,%rax
+  805466:	ff ff ff 
+  805469:	48 01 d8             	add    %rbx,%rax
+  80546c:	ff d0                	call   *%rax
+}
+  80546e:	48 83 c4 20          	add    $0x20,%rsp
+  805472:	5b                   	pop    %rbx
+  805473:	41 5f                	pop    %r15
+  805475:	5d                   	pop    %rbp
+  805476:	c3                   	ret
+
+0000000000805477 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805477:	55                   	push   %rbp
+  805478:	48 89 e5             	mov    %rsp,%rbp
+  80547b:	41 57                	push   %r15
+  80547d:	53                   	push   %rbx
+  80547e:	48 83 ec 30          	sub    $0x30,%rsp
+  805482:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805482 <nsipc_accept+0xb>
+  805489:	49 bb be 3b 00 00 00 	movabs $0x3bbe,%r11
+  805490:	00 00 00 
+  805493:	4c 01 db             	add    %r11,%rbx
+  805496:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805499:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80549d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8054a1:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8054a8:	00 00 00 
+  8054ab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054ae:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8054b1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8054b6:	48 b8 00 c3 ff ff ff 	movabs $0xffffffffffffc300,%rax
+  8054bd:	ff ff ff 
+  8054c0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054c4:	ff d0                	call   *%rax
+  8054c6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054c9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054cd:	78 48                	js     805517 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  8054cf:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  8054d6:	00 00 00 
+  8054d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054dd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8054e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054e5:	8b 40 10             	mov    0x10(%rax),%eax
+  8054e8:	89 c2                	mov    %eax,%edx
+  8054ea:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8054ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054f2:	48 89 ce             	mov    %rcx,%rsi
+  8054f5:	48 89 c7             	mov    %rax,%rdi
+  8054f8:	49 89 df             	mov    %rbx,%r15
+  8054fb:	48 b8 8f 8a ff ff ff 	movabs $0xffffffffffff8a8f,%rax
+  805502:	ff ff ff 
+  805505:	48 01 d8             	add    %rbx,%rax
+  805508:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  80550a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80550e:	8b 50 10             	mov    0x10(%rax),%edx
+  805511:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805515:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805517:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80551a:	48 83 c4 30          	add    $0x30,%rsp
+  80551e:	5b                   	pop    %rbx
+  80551f:	41 5f                	pop    %r15
+  805521:	5d                   	pop    %rbp
+  805522:	c3                   	ret
+
+0000000000805523 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805523:	55                   	push   %rbp
+  805524:	48 89 e5             	mov    %rsp,%rbp
+  805527:	41 57                	push   %r15
+  805529:	53                   	push   %rbx
+  80552a:	48 83 ec 10          	sub    $0x10,%rsp
+  80552e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80552e <nsipc_bind+0xb>
+  805535:	49 bb 12 3b 00 00 00 	movabs $0x3b12,%r11
+  80553c:	00 00 00 
+  80553f:	4c 01 db             	add    %r11,%rbx
+  805542:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805545:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805549:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  80554c:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805553:	00 00 00 
+  805556:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805559:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80555c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80555f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805563:	48 89 c6             	mov    %rax,%rsi
+  805566:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  80556d:	00 00 00 
+  805570:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805574:	48 89 c7             	mov    %rax,%rdi
+  805577:	49 89 df             	mov    %rbx,%r15
+  80557a:	48 b8 8f 8a ff ff ff 	movabs $0xffffffffffff8a8f,%rax
+  805581:	ff ff ff 
+  805584:	48 01 d8             	add    %rbx,%rax
+  805587:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805589:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805590:	00 00 00 
+  805593:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805596:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  80559a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80559f:	48 b8 00 c3 ff ff ff 	movabs $0xffffffffffffc300,%rax
+  8055a6:	ff ff ff 
+  8055a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055ad:	ff d0                	call   *%rax
+}
+  8055af:	48 83 c4 10          	add    $0x10,%rsp
+  8055b3:	5b                   	pop    %rbx
+  8055b4:	41 5f                	pop    %r15
+  8055b6:	5d                   	pop    %rbp
+  8055b7:	c3                   	ret
+
+00000000008055b8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8055b8:	55                   	push   %rbp
+  8055b9:	48 89 e5             	mov    %rsp,%rbp
+  8055bc:	48 83 ec 20          	sub    $0x20,%rsp
+  8055c0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8055c0 <nsipc_shutdown+0x8>
+  8055c7:	49 bb 80 3a 00 00 00 	movabs $0x3a80,%r11
+  8055ce:	00 00 00 
+  8055d1:	4c 01 d8             	add    %r11,%rax
+  8055d4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8055d7:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8055da:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8055dd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  8055e0:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8055e3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  8055e6:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8055ea:	ba 08 00 00 00       	mov    $0x8,%edx
+  8055ef:	48 89 ce             	mov    %rcx,%rsi
+  8055f2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8055f7:	48 b9 a3 c3 ff ff ff 	movabs $0xffffffffffffc3a3,%rcx
+  8055fe:	ff ff ff 
+  805601:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805605:	ff d0                	call   *%rax
+}
+  805607:	c9                   	leave
+  805608:	c3                   	ret
+
+0000000000805609 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805609:	55                   	push   %rbp
+  80560a:	48 89 e5             	mov    %rsp,%rbp
+  80560d:	48 83 ec 20          	sub    $0x20,%rsp
+  805611:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805611 <nsipc_close+0x8>
+  805618:	49 bb 2f 3a 00 00 00 	movabs $0x3a2f,%r11
+  80561f:	00 00 00 
+  805622:	4c 01 d8             	add    %r11,%rax
+  805625:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805628:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80562b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  80562e:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805632:	ba 04 00 00 00       	mov    $0x4,%edx
+  805637:	48 89 ce             	mov    %rcx,%rsi
+  80563a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80563f:	48 b9 a3 c3 ff ff ff 	movabs $0xffffffffffffc3a3,%rcx
+  805646:	ff ff ff 
+  805649:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80564d:	ff d0                	call   *%rax
+}
+  80564f:	c9                   	leave
+  805650:	c3                   	ret
+
+0000000000805651 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805651:	55                   	push   %rbp
+  805652:	48 89 e5             	mov    %rsp,%rbp
+  805655:	41 57                	push   %r15
+  805657:	53                   	push   %rbx
+  805658:	48 83 ec 10          	sub    $0x10,%rsp
+  80565c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80565c <nsipc_connect+0xb>
+  805663:	49 bb e4 39 00 00 00 	movabs $0x39e4,%r11
+  80566a:	00 00 00 
+  80566d:	4c 01 db             	add    %r11,%rbx
+  805670:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805673:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805677:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  80567a:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805681:	00 00 00 
+  805684:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805687:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80568a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80568d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805691:	48 89 c6             	mov    %rax,%rsi
+  805694:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  80569b:	00 00 00 
+  80569e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056a2:	48 89 c7             	mov    %rax,%rdi
+  8056a5:	49 89 df             	mov    %rbx,%r15
+  8056a8:	48 b8 8f 8a ff ff ff 	movabs $0xffffffffffff8a8f,%rax
+  8056af:	ff ff ff 
+  8056b2:	48 01 d8             	add    %rbx,%rax
+  8056b5:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8056b7:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8056be:	00 00 00 
+  8056c1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8056c4:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8056c8:	bf 05 00 00 00       	mov    $0x5,%edi
+  8056cd:	48 b8 00 c3 ff ff ff 	movabs $0xffffffffffffc300,%rax
+  8056d4:	ff ff ff 
+  8056d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056db:	ff d0                	call   *%rax
+}
+  8056dd:	48 83 c4 10          	add    $0x10,%rsp
+  8056e1:	5b                   	pop    %rbx
+  8056e2:	41 5f                	pop    %r15
+  8056e4:	5d                   	pop    %rbp
+  8056e5:	c3                   	ret
+
+00000000008056e6 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8056e6:	55                   	push   %rbp
+  8056e7:	48 89 e5             	mov    %rsp,%rbp
+  8056ea:	48 83 ec 20          	sub    $0x20,%rsp
+  8056ee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8056ee <nsipc_listen+0x8>
+  8056f5:	49 bb 52 39 00 00 00 	movabs $0x3952,%r11
+  8056fc:	00 00 00 
+  8056ff:	4c 01 d8             	add    %r11,%rax
+  805702:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805705:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805708:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80570b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  80570e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805711:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805714:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805718:	ba 08 00 00 00       	mov    $0x8,%edx
+  80571d:	48 89 ce             	mov    %rcx,%rsi
+  805720:	bf 06 00 00 00       	mov    $0x6,%edi
+  805725:	48 b9 a3 c3 ff ff ff 	movabs $0xffffffffffffc3a3,%rcx
+  80572c:	ff ff ff 
+  80572f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805733:	ff d0                	call   *%rax
+}
+  805735:	c9                   	leave
+  805736:	c3                   	ret
+
+0000000000805737 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805737:	55                   	push   %rbp
+  805738:	48 89 e5             	mov    %rsp,%rbp
+  80573b:	41 57                	push   %r15
+  80573d:	53                   	push   %rbx
+  80573e:	48 83 ec 30          	sub    $0x30,%rsp
+  805742:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805742 <nsipc_recv+0xb>
+  805749:	49 bb fe 38 00 00 00 	movabs $0x38fe,%r11
+  805750:	00 00 00 
+  805753:	4c 01 db             	add    %r11,%rbx
+  805756:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805759:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80575d:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805760:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805763:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80576a:	00 00 00 
+  80576d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805770:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805773:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80577a:	00 00 00 
+  80577d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805780:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805784:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80578b:	00 00 00 
+  80578e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805791:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805795:	bf 07 00 00 00       	mov    $0x7,%edi
+  80579a:	48 b8 00 c3 ff ff ff 	movabs $0xffffffffffffc300,%rax
+  8057a1:	ff ff ff 
+  8057a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057a8:	ff d0                	call   *%rax
+  8057aa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057b1:	0f 88 91 00 00 00    	js     805848 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8057b7:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8057be:	7f 08                	jg     8057c8 <nsipc_recv+0x91>
+  8057c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057c3:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8057c6:	7e 50                	jle    805818 <nsipc_recv+0xe1>
+  8057c8:	48 b8 fb e7 ff ff ff 	movabs $0xffffffffffffe7fb,%rax
+  8057cf:	ff ff ff 
+  8057d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057d6:	48 89 c1             	mov    %rax,%rcx
+  8057d9:	48 b8 10 e8 ff ff ff 	movabs $0xffffffffffffe810,%rax
+  8057e0:	ff ff ff 
+  8057e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057e7:	48 89 c2             	mov    %rax,%rdx
+  8057ea:	be 79 00 00 00       	mov    $0x79,%esi
+  8057ef:	48 b8 25 e8 ff ff ff 	movabs $0xffffffffffffe825,%rax
+  8057f6:	ff ff ff 
+  8057f9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057fd:	48 89 c7             	mov    %rax,%rdi
+  805800:	49 89 df             	mov    %rbx,%r15
+  805803:	b8 00 00 00 00       	mov    $0x0,%eax
+  805808:	49 b8 16 76 ff ff ff 	movabs $0xffffffffffff7616,%r8
+  80580f:	ff ff ff 
+  805812:	49 01 d8             	add    %rbx,%r8
+  805815:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805818:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80581b:	48 63 d0             	movslq %eax,%rdx
+  80581e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805822:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805829:	00 00 00 
+  80582c:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805830:	48 89 ce             	mov    %rcx,%rsi
+  805833:	48 89 c7             	mov    %rax,%rdi
+  805836:	49 89 df             	mov    %rbx,%r15
+  805839:	48 b8 8f 8a ff ff ff 	movabs $0xffffffffffff8a8f,%rax
+  805840:	ff ff ff 
+  805843:	48 01 d8             	add    %rbx,%rax
+  805846:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805848:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80584b:	48 83 c4 30          	add    $0x30,%rsp
+  80584f:	5b                   	pop    %rbx
+  805850:	41 5f                	pop    %r15
+  805852:	5d                   	pop    %rbp
+  805853:	c3                   	ret
+
+0000000000805854 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805854:	55                   	push   %rbp
+  805855:	48 89 e5             	mov    %rsp,%rbp
+  805858:	41 57                	push   %r15
+  80585a:	53                   	push   %rbx
+  80585b:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805862:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805862 <nsipc_send+0xe>
+  805869:	49 bb de 37 00 00 00 	movabs $0x37de,%r11
+  805870:	00 00 00 
+  805873:	4c 01 db             	add    %r11,%rbx
+  805876:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  80587c:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805883:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805889:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  80588f:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805893:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805897:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80589e:	00 00 00 
+  8058a1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8058a4:	85 c0                	test   %eax,%eax
+  8058a6:	75 24                	jne    8058cc <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8058a8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8058ad:	49 89 df             	mov    %rbx,%r15
+  8058b0:	48 b8 41 df ff ff ff 	movabs $0xffffffffffffdf41,%rax
+  8058b7:	ff ff ff 
+  8058ba:	48 01 d8             	add    %rbx,%rax
+  8058bd:	ff d0                	call   *%rax
+  8058bf:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8058c6:	00 00 00 
+  8058c9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8058cc:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8058d2:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8058d5:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  8058dc:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8058df:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8058e2:	39 c2                	cmp    %eax,%edx
+  8058e4:	0f 4e c2             	cmovle %edx,%eax
+  8058e7:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  8058ed:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8058f3:	48 63 d0             	movslq %eax,%rdx
+  8058f6:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8058fd:	48 89 c6             	mov    %rax,%rsi
+  805900:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805907:	00 00 00 
+  80590a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80590e:	48 89 c7             	mov    %rax,%rdi
+  805911:	49 89 df             	mov    %rbx,%r15
+  805914:	48 b8 8f 8a ff ff ff 	movabs $0xffffffffffff8a8f,%rax
+  80591b:	ff ff ff 
+  80591e:	48 01 d8             	add    %rbx,%rax
+  805921:	ff d0                	call   *%rax
+	req->req_s = s;
+  805923:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805927:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  80592d:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  80592f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805933:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805939:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  80593c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805940:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805946:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805949:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805950:	00 00 00 
+  805953:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805957:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  80595b:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805962:	00 
+  805963:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805969:	48 63 d0             	movslq %eax,%rdx
+  80596c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805970:	48 01 d0             	add    %rdx,%rax
+  805973:	48 83 e8 01          	sub    $0x1,%rax
+  805977:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80597b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80597f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805984:	48 f7 75 d8          	divq   -0x28(%rbp)
+  805988:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80598c:	48 29 d0             	sub    %rdx,%rax
+  80598f:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805995:	85 c0                	test   %eax,%eax
+  805997:	0f 48 c2             	cmovs  %edx,%eax
+  80599a:	c1 f8 0c             	sar    $0xc,%eax
+  80599d:	48 98                	cltq
+  80599f:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  8059a3:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8059a7:	48 85 c0             	test   %rax,%rax
+  8059aa:	0f 95 c0             	setne  %al
+  8059ad:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8059b0:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8059b7:	00 
+  8059b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8059bc:	48 83 c0 0b          	add    $0xb,%rax
+  8059c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8059c4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8059c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8059cd:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8059d1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8059d5:	48 29 d0             	sub    %rdx,%rax
+  8059d8:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8059dc:	89 c7                	mov    %eax,%edi
+  8059de:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8059e5:	00 00 00 
+  8059e8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8059eb:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  8059ef:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  8059f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8059f7:	6a 00                	push   $0x0
+  8059f9:	6a 00                	push   $0x0
+  8059fb:	6a 05                	push   $0x5
+  8059fd:	41 89 f1             	mov    %esi,%r9d
+  805a00:	49 89 c8             	mov    %rcx,%r8
+  805a03:	89 f9                	mov    %edi,%ecx
+  805a05:	be 08 00 00 00       	mov    $0x8,%esi
+  805a0a:	89 c7                	mov    %eax,%edi
+  805a0c:	49 89 df             	mov    %rbx,%r15
+  805a0f:	48 b8 49 db ff ff ff 	movabs $0xffffffffffffdb49,%rax
+  805a16:	ff ff ff 
+  805a19:	48 01 d8             	add    %rbx,%rax
+  805a1c:	ff d0                	call   *%rax
+  805a1e:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805a22:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805a26:	5b                   	pop    %rbx
+  805a27:	41 5f                	pop    %r15
+  805a29:	5d                   	pop    %rbp
+  805a2a:	c3                   	ret
+
+0000000000805a2b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805a2b:	55                   	push   %rbp
+  805a2c:	48 89 e5             	mov    %rsp,%rbp
+  805a2f:	48 83 ec 10          	sub    $0x10,%rsp
+  805a33:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805a33 <nsipc_socket+0x8>
+  805a3a:	49 bb 0d 36 00 00 00 	movabs $0x360d,%r11
+  805a41:	00 00 00 
+  805a44:	4c 01 d8             	add    %r11,%rax
+  805a47:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805a4a:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805a4d:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805a50:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805a57:	00 00 00 
+  805a5a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805a5d:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805a60:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805a67:	00 00 00 
+  805a6a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805a6d:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805a71:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805a78:	00 00 00 
+  805a7b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805a7e:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  805a82:	bf 09 00 00 00       	mov    $0x9,%edi
+  805a87:	48 ba 00 c3 ff ff ff 	movabs $0xffffffffffffc300,%rdx
+  805a8e:	ff ff ff 
+  805a91:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805a95:	ff d0                	call   *%rax
+}
+  805a97:	c9                   	leave
+  805a98:	c3                   	ret
+
+0000000000805a99 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805a99:	55                   	push   %rbp
+  805a9a:	48 89 e5             	mov    %rsp,%rbp
+  805a9d:	41 57                	push   %r15
+  805a9f:	53                   	push   %rbx
+  805aa0:	48 83 ec 30          	sub    $0x30,%rsp
+  805aa4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805aa4 <pipe+0xb>
+  805aab:	49 bb 9c 35 00 00 00 	movabs $0x359c,%r11
+  805ab2:	00 00 00 
+  805ab5:	4c 01 db             	add    %r11,%rbx
+  805ab8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805abc:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805ac0:	48 89 c7             	mov    %rax,%rdi
+  805ac3:	49 89 df             	mov    %rbx,%r15
+  805ac6:	48 b8 1a a7 ff ff ff 	movabs $0xffffffffffffa71a,%rax
+  805acd:	ff ff ff 
+  805ad0:	48 01 d8             	add    %rbx,%rax
+  805ad3:	ff d0                	call   *%rax
+  805ad5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ad8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805adc:	0f 88 12 02 00 00    	js     805cf4 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805ae2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ae6:	ba 07 04 00 00       	mov    $0x407,%edx
+  805aeb:	48 89 c6             	mov    %rax,%rsi
+  805aee:	bf 00 00 00 00       	mov    $0x0,%edi
+  805af3:	49 89 df             	mov    %rbx,%r15
+  805af6:	48 b8 6b 93 ff ff ff 	movabs $0xffffffffffff936b,%rax
+  805afd:	ff ff ff 
+  805b00:	48 01 d8             	add    %rbx,%rax
+  805b03:	ff d0                	call   *%rax
+  805b05:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b08:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b0c:	0f 88 e2 01 00 00    	js     805cf4 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805b12:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805b16:	48 89 c7             	mov    %rax,%rdi
+  805b19:	49 89 df             	mov    %rbx,%r15
+  805b1c:	48 b8 1a a7 ff ff ff 	movabs $0xffffffffffffa71a,%rax
+  805b23:	ff ff ff 
+  805b26:	48 01 d8             	add    %rbx,%rax
+  805b29:	ff d0                	call   *%rax
+  805b2b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b2e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b32:	0f 88 9b 01 00 00    	js     805cd3 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805b38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b3c:	ba 07 04 00 00       	mov    $0x407,%edx
+  805b41:	48 89 c6             	mov    %rax,%rsi
+  805b44:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b49:	49 89 df             	mov    %rbx,%r15
+  805b4c:	48 b8 6b 93 ff ff ff 	movabs $0xffffffffffff936b,%rax
+  805b53:	ff ff ff 
+  805b56:	48 01 d8             	add    %rbx,%rax
+  805b59:	ff d0                	call   *%rax
+  805b5b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b5e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b62:	0f 88 6b 01 00 00    	js     805cd3 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  805b68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b6c:	48 89 c7             	mov    %rax,%rdi
+  805b6f:	49 89 df             	mov    %rbx,%r15
+  805b72:	48 b8 d7 a6 ff ff ff 	movabs $0xffffffffffffa6d7,%rax
+  805b79:	ff ff ff 
+  805b7c:	48 01 d8             	add    %rbx,%rax
+  805b7f:	ff d0                	call   *%rax
+  805b81:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805b85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b89:	ba 07 04 00 00       	mov    $0x407,%edx
+  805b8e:	48 89 c6             	mov    %rax,%rsi
+  805b91:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b96:	49 89 df             	mov    %rbx,%r15
+  805b99:	48 b8 6b 93 ff ff ff 	movabs $0xffffffffffff936b,%rax
+  805ba0:	ff ff ff 
+  805ba3:	48 01 d8             	add    %rbx,%rax
+  805ba6:	ff d0                	call   *%rax
+  805ba8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805bab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805baf:	0f 88 fd 00 00 00    	js     805cb2 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805bb5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805bb9:	48 89 c7             	mov    %rax,%rdi
+  805bbc:	49 89 df             	mov    %rbx,%r15
+  805bbf:	48 b8 d7 a6 ff ff ff 	movabs $0xffffffffffffa6d7,%rax
+  805bc6:	ff ff ff 
+  805bc9:	48 01 d8             	add    %rbx,%rax
+  805bcc:	ff d0                	call   *%rax
+  805bce:	48 89 c2             	mov    %rax,%rdx
+  805bd1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bd5:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805bdb:	48 89 d1             	mov    %rdx,%rcx
+  805bde:	ba 00 00 00 00       	mov    $0x0,%edx
+  805be3:	48 89 c6             	mov    %rax,%rsi
+  805be6:	bf 00 00 00 00       	mov    $0x0,%edi
+  805beb:	49 89 df             	mov    %rbx,%r15
+  805bee:	48 b8 d0 93 ff ff ff 	movabs $0xffffffffffff93d0,%rax
+  805bf5:	ff ff ff 
+  805bf8:	48 01 d8             	add    %rbx,%rax
+  805bfb:	ff d0                	call   *%rax
+  805bfd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c00:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c04:	0f 88 87 00 00 00    	js     805c91 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805c0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c0e:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805c15:	00 00 00 
+  805c18:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805c1b:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805c1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c21:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805c28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c2c:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805c33:	00 00 00 
+  805c36:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805c39:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805c3b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c3f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805c46:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c4a:	48 89 c7             	mov    %rax,%rdi
+  805c4d:	49 89 df             	mov    %rbx,%r15
+  805c50:	48 b8 a0 a6 ff ff ff 	movabs $0xffffffffffffa6a0,%rax
+  805c57:	ff ff ff 
+  805c5a:	48 01 d8             	add    %rbx,%rax
+  805c5d:	ff d0                	call   *%rax
+  805c5f:	89 c2                	mov    %eax,%edx
+  805c61:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805c65:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805c67:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c6b:	48 89 c7             	mov    %rax,%rdi
+  805c6e:	49 89 df             	mov    %rbx,%r15
+  805c71:	48 b8 a0 a6 ff ff ff 	movabs $0xffffffffffffa6a0,%rax
+  805c78:	ff ff ff 
+  805c7b:	48 01 d8             	add    %rbx,%rax
+  805c7e:	ff d0                	call   *%rax
+  805c80:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805c84:	48 83 c2 04          	add    $0x4,%rdx
+  805c88:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c8f:	eb 67                	jmp    805cf8 <pipe+0x25f>
+		goto err3;
+  805c91:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  805c92:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c96:	48 89 c6             	mov    %rax,%rsi
+  805c99:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c9e:	49 89 df             	mov    %rbx,%r15
+  805ca1:	48 b8 43 94 ff ff ff 	movabs $0xffffffffffff9443,%rax
+  805ca8:	ff ff ff 
+  805cab:	48 01 d8             	add    %rbx,%rax
+  805cae:	ff d0                	call   *%rax
+  805cb0:	eb 01                	jmp    805cb3 <pipe+0x21a>
+		goto err2;
+  805cb2:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  805cb3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805cb7:	48 89 c6             	mov    %rax,%rsi
+  805cba:	bf 00 00 00 00       	mov    $0x0,%edi
+  805cbf:	49 89 df             	mov    %rbx,%r15
+  805cc2:	48 b8 43 94 ff ff ff 	movabs $0xffffffffffff9443,%rax
+  805cc9:	ff ff ff 
+  805ccc:	48 01 d8             	add    %rbx,%rax
+  805ccf:	ff d0                	call   *%rax
+  805cd1:	eb 01                	jmp    805cd4 <pipe+0x23b>
+		goto err1;
+  805cd3:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805cd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805cd8:	48 89 c6             	mov    %rax,%rsi
+  805cdb:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ce0:	49 89 df             	mov    %rbx,%r15
+  805ce3:	48 b8 43 94 ff ff ff 	movabs $0xffffffffffff9443,%rax
+  805cea:	ff ff ff 
+  805ced:	48 01 d8             	add    %rbx,%rax
+  805cf0:	ff d0                	call   *%rax
+  805cf2:	eb 01                	jmp    805cf5 <pipe+0x25c>
+		goto err;
+  805cf4:	90                   	nop
+err:
+	return r;
+  805cf5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805cf8:	48 83 c4 30          	add    $0x30,%rsp
+  805cfc:	5b                   	pop    %rbx
+  805cfd:	41 5f                	pop    %r15
+  805cff:	5d                   	pop    %rbp
+  805d00:	c3                   	ret
+
+0000000000805d01 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805d01:	55                   	push   %rbp
+  805d02:	48 89 e5             	mov    %rsp,%rbp
+  805d05:	41 57                	push   %r15
+  805d07:	41 54                	push   %r12
+  805d09:	53                   	push   %rbx
+  805d0a:	48 83 ec 28          	sub    $0x28,%rsp
+  805d0e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d0e <_pipeisclosed+0xd>
+  805d15:	49 bb 32 33 00 00 00 	movabs $0x3332,%r11
+  805d1c:	00 00 00 
+  805d1f:	4c 01 db             	add    %r11,%rbx
+  805d22:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805d26:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805d2a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805d31:	ff ff ff 
+  805d34:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d38:	48 8b 00             	mov    (%rax),%rax
+  805d3b:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805d41:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805d44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d48:	48 89 c7             	mov    %rax,%rdi
+  805d4b:	49 89 df             	mov    %rbx,%r15
+  805d4e:	48 b8 d0 df ff ff ff 	movabs $0xffffffffffffdfd0,%rax
+  805d55:	ff ff ff 
+  805d58:	48 01 d8             	add    %rbx,%rax
+  805d5b:	ff d0                	call   *%rax
+  805d5d:	41 89 c4             	mov    %eax,%r12d
+  805d60:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d64:	48 89 c7             	mov    %rax,%rdi
+  805d67:	49 89 df             	mov    %rbx,%r15
+  805d6a:	48 b8 d0 df ff ff ff 	movabs $0xffffffffffffdfd0,%rax
+  805d71:	ff ff ff 
+  805d74:	48 01 d8             	add    %rbx,%rax
+  805d77:	ff d0                	call   *%rax
+  805d79:	41 39 c4             	cmp    %eax,%r12d
+  805d7c:	0f 94 c0             	sete   %al
+  805d7f:	0f b6 c0             	movzbl %al,%eax
+  805d82:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805d85:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805d8c:	ff ff ff 
+  805d8f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d93:	48 8b 00             	mov    (%rax),%rax
+  805d96:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805d9c:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805d9f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805da2:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805da5:	75 05                	jne    805dac <_pipeisclosed+0xab>
+			return ret;
+  805da7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805daa:	eb 63                	jmp    805e0f <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805dac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805daf:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805db2:	0f 84 72 ff ff ff    	je     805d2a <_pipeisclosed+0x29>
+  805db8:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805dbc:	0f 85 68 ff ff ff    	jne    805d2a <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805dc2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805dc9:	ff ff ff 
+  805dcc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805dd0:	48 8b 00             	mov    (%rax),%rax
+  805dd3:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805dd9:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805ddc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ddf:	89 c6                	mov    %eax,%esi
+  805de1:	48 b8 36 e8 ff ff ff 	movabs $0xffffffffffffe836,%rax
+  805de8:	ff ff ff 
+  805deb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805def:	48 89 c7             	mov    %rax,%rdi
+  805df2:	49 89 df             	mov    %rbx,%r15
+  805df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dfa:	49 b8 ed 78 ff ff ff 	movabs $0xffffffffffff78ed,%r8
+  805e01:	ff ff ff 
+  805e04:	49 01 d8             	add    %rbx,%r8
+  805e07:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  805e0a:	e9 1b ff ff ff       	jmp    805d2a <_pipeisclosed+0x29>
+	}
+}
+  805e0f:	48 83 c4 28          	add    $0x28,%rsp
+  805e13:	5b                   	pop    %rbx
+  805e14:	41 5c                	pop    %r12
+  805e16:	41 5f                	pop    %r15
+  805e18:	5d                   	pop    %rbp
+  805e19:	c3                   	ret
+
+0000000000805e1a <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  805e1a:	55                   	push   %rbp
+  805e1b:	48 89 e5             	mov    %rsp,%rbp
+  805e1e:	41 57                	push   %r15
+  805e20:	53                   	push   %rbx
+  805e21:	48 83 ec 30          	sub    $0x30,%rsp
+  805e25:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e25 <pipeisclosed+0xb>
+  805e2c:	49 bb 1b 32 00 00 00 	movabs $0x321b,%r11
+  805e33:	00 00 00 
+  805e36:	4c 01 db             	add    %r11,%rbx
+  805e39:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805e3c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805e40:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805e43:	48 89 d6             	mov    %rdx,%rsi
+  805e46:	89 c7                	mov    %eax,%edi
+  805e48:	49 89 df             	mov    %rbx,%r15
+  805e4b:	48 b8 d0 a7 ff ff ff 	movabs $0xffffffffffffa7d0,%rax
+  805e52:	ff ff ff 
+  805e55:	48 01 d8             	add    %rbx,%rax
+  805e58:	ff d0                	call   *%rax
+  805e5a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e5d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e61:	79 05                	jns    805e68 <pipeisclosed+0x4e>
+		return r;
+  805e63:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e66:	eb 3b                	jmp    805ea3 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805e68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e6c:	48 89 c7             	mov    %rax,%rdi
+  805e6f:	49 89 df             	mov    %rbx,%r15
+  805e72:	48 b8 d7 a6 ff ff ff 	movabs $0xffffffffffffa6d7,%rax
+  805e79:	ff ff ff 
+  805e7c:	48 01 d8             	add    %rbx,%rax
+  805e7f:	ff d0                	call   *%rax
+  805e81:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805e85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e89:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805e8d:	48 89 d6             	mov    %rdx,%rsi
+  805e90:	48 89 c7             	mov    %rax,%rdi
+  805e93:	48 b8 c1 cc ff ff ff 	movabs $0xffffffffffffccc1,%rax
+  805e9a:	ff ff ff 
+  805e9d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ea1:	ff d0                	call   *%rax
+}
+  805ea3:	48 83 c4 30          	add    $0x30,%rsp
+  805ea7:	5b                   	pop    %rbx
+  805ea8:	41 5f                	pop    %r15
+  805eaa:	5d                   	pop    %rbp
+  805eab:	c3                   	ret
+
+0000000000805eac <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805eac:	55                   	push   %rbp
+  805ead:	48 89 e5             	mov    %rsp,%rbp
+  805eb0:	41 57                	push   %r15
+  805eb2:	53                   	push   %rbx
+  805eb3:	48 83 ec 40          	sub    $0x40,%rsp
+  805eb7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805eb7 <devpipe_read+0xb>
+  805ebe:	49 bb 89 31 00 00 00 	movabs $0x3189,%r11
+  805ec5:	00 00 00 
+  805ec8:	4c 01 db             	add    %r11,%rbx
+  805ecb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805ecf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805ed3:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805ed7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805edb:	48 89 c7             	mov    %rax,%rdi
+  805ede:	49 89 df             	mov    %rbx,%r15
+  805ee1:	48 b8 d7 a6 ff ff ff 	movabs $0xffffffffffffa6d7,%rax
+  805ee8:	ff ff ff 
+  805eeb:	48 01 d8             	add    %rbx,%rax
+  805eee:	ff d0                	call   *%rax
+  805ef0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805ef4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805ef8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805efc:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805f03:	00 
+  805f04:	e9 a1 00 00 00       	jmp    805faa <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805f09:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805f0e:	74 09                	je     805f19 <devpipe_read+0x6d>
+				return i;
+  805f10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f14:	e9 9f 00 00 00       	jmp    805fb8 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805f19:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805f1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805f21:	48 89 d6             	mov    %rdx,%rsi
+  805f24:	48 89 c7             	mov    %rax,%rdi
+  805f27:	48 b8 c1 cc ff ff ff 	movabs $0xffffffffffffccc1,%rax
+  805f2e:	ff ff ff 
+  805f31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f35:	ff d0                	call   *%rax
+  805f37:	85 c0                	test   %eax,%eax
+  805f39:	74 07                	je     805f42 <devpipe_read+0x96>
+				return 0;
+  805f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f40:	eb 76                	jmp    805fb8 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805f42:	49 89 df             	mov    %rbx,%r15
+  805f45:	48 b8 16 93 ff ff ff 	movabs $0xffffffffffff9316,%rax
+  805f4c:	ff ff ff 
+  805f4f:	48 01 d8             	add    %rbx,%rax
+  805f52:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805f54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f58:	8b 10                	mov    (%rax),%edx
+  805f5a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f5e:	8b 40 04             	mov    0x4(%rax),%eax
+  805f61:	39 c2                	cmp    %eax,%edx
+  805f63:	74 a4                	je     805f09 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805f65:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f69:	8b 10                	mov    (%rax),%edx
+  805f6b:	89 d0                	mov    %edx,%eax
+  805f6d:	c1 f8 1f             	sar    $0x1f,%eax
+  805f70:	c1 e8 1b             	shr    $0x1b,%eax
+  805f73:	01 c2                	add    %eax,%edx
+  805f75:	83 e2 1f             	and    $0x1f,%edx
+  805f78:	29 c2                	sub    %eax,%edx
+  805f7a:	89 d6                	mov    %edx,%esi
+  805f7c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805f80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f84:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805f88:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805f8c:	48 63 c6             	movslq %esi,%rax
+  805f8f:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805f94:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805f96:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f9a:	8b 00                	mov    (%rax),%eax
+  805f9c:	8d 50 01             	lea    0x1(%rax),%edx
+  805f9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805fa3:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805fa5:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805faa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fae:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805fb2:	72 a0                	jb     805f54 <devpipe_read+0xa8>
+	}
+	return i;
+  805fb4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805fb8:	48 83 c4 40          	add    $0x40,%rsp
+  805fbc:	5b                   	pop    %rbx
+  805fbd:	41 5f                	pop    %r15
+  805fbf:	5d                   	pop    %rbp
+  805fc0:	c3                   	ret
+
+0000000000805fc1 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805fc1:	55                   	push   %rbp
+  805fc2:	48 89 e5             	mov    %rsp,%rbp
+  805fc5:	41 57                	push   %r15
+  805fc7:	53                   	push   %rbx
+  805fc8:	48 83 ec 40          	sub    $0x40,%rsp
+  805fcc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fcc <devpipe_write+0xb>
+  805fd3:	49 bb 74 30 00 00 00 	movabs $0x3074,%r11
+  805fda:	00 00 00 
+  805fdd:	4c 01 db             	add    %r11,%rbx
+  805fe0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805fe4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805fe8:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805fec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805ff0:	48 89 c7             	mov    %rax,%rdi
+  805ff3:	49 89 df             	mov    %rbx,%r15
+  805ff6:	48 b8 d7 a6 ff ff ff 	movabs $0xffffffffffffa6d7,%rax
+  805ffd:	ff ff ff 
+  806000:	48 01 d8             	add    %rbx,%rax
+  806003:	ff d0                	call   *%rax
+  806005:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806009:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80600d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806011:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806018:	00 
+  806019:	e9 a0 00 00 00       	jmp    8060be <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  80601e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806022:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806026:	48 89 d6             	mov    %rdx,%rsi
+  806029:	48 89 c7             	mov    %rax,%rdi
+  80602c:	48 b8 c1 cc ff ff ff 	movabs $0xffffffffffffccc1,%rax
+  806033:	ff ff ff 
+  806036:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80603a:	ff d0                	call   *%rax
+  80603c:	85 c0                	test   %eax,%eax
+  80603e:	74 0a                	je     80604a <devpipe_write+0x89>
+				return 0;
+  806040:	b8 00 00 00 00       	mov    $0x0,%eax
+  806045:	e9 82 00 00 00       	jmp    8060cc <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  80604a:	49 89 df             	mov    %rbx,%r15
+  80604d:	48 b8 16 93 ff ff ff 	movabs $0xffffffffffff9316,%rax
+  806054:	ff ff ff 
+  806057:	48 01 d8             	add    %rbx,%rax
+  80605a:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80605c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806060:	8b 40 04             	mov    0x4(%rax),%eax
+  806063:	48 63 d0             	movslq %eax,%rdx
+  806066:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80606a:	8b 00                	mov    (%rax),%eax
+  80606c:	48 98                	cltq
+  80606e:	48 83 c0 20          	add    $0x20,%rax
+  806072:	48 39 c2             	cmp    %rax,%rdx
+  806075:	73 a7                	jae    80601e <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  806077:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80607b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80607f:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806083:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806087:	8b 50 04             	mov    0x4(%rax),%edx
+  80608a:	89 d0                	mov    %edx,%eax
+  80608c:	c1 f8 1f             	sar    $0x1f,%eax
+  80608f:	c1 e8 1b             	shr    $0x1b,%eax
+  806092:	01 c2                	add    %eax,%edx
+  806094:	83 e2 1f             	and    $0x1f,%edx
+  806097:	29 c2                	sub    %eax,%edx
+  806099:	89 d0                	mov    %edx,%eax
+  80609b:	0f b6 09             	movzbl (%rcx),%ecx
+  80609e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8060a2:	48 98                	cltq
+  8060a4:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  8060a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060ac:	8b 40 04             	mov    0x4(%rax),%eax
+  8060af:	8d 50 01             	lea    0x1(%rax),%edx
+  8060b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060b6:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  8060b9:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8060be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060c2:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8060c6:	72 94                	jb     80605c <devpipe_write+0x9b>
+	}
+
+	return i;
+  8060c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8060cc:	48 83 c4 40          	add    $0x40,%rsp
+  8060d0:	5b                   	pop    %rbx
+  8060d1:	41 5f                	pop    %r15
+  8060d3:	5d                   	pop    %rbp
+  8060d4:	c3                   	ret
+
+00000000008060d5 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8060d5:	55                   	push   %rbp
+  8060d6:	48 89 e5             	mov    %rsp,%rbp
+  8060d9:	41 57                	push   %r15
+  8060db:	53                   	push   %rbx
+  8060dc:	48 83 ec 20          	sub    $0x20,%rsp
+  8060e0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060e0 <devpipe_stat+0xb>
+  8060e7:	49 bb 60 2f 00 00 00 	movabs $0x2f60,%r11
+  8060ee:	00 00 00 
+  8060f1:	4c 01 db             	add    %r11,%rbx
+  8060f4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8060f8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8060fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806100:	48 89 c7             	mov    %rax,%rdi
+  806103:	49 89 df             	mov    %rbx,%r15
+  806106:	48 b8 d7 a6 ff ff ff 	movabs $0xffffffffffffa6d7,%rax
+  80610d:	ff ff ff 
+  806110:	48 01 d8             	add    %rbx,%rax
+  806113:	ff d0                	call   *%rax
+  806115:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  806119:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80611d:	48 ba 49 e8 ff ff ff 	movabs $0xffffffffffffe849,%rdx
+  806124:	ff ff ff 
+  806127:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80612b:	48 89 d6             	mov    %rdx,%rsi
+  80612e:	48 89 c7             	mov    %rax,%rdi
+  806131:	49 89 df             	mov    %rbx,%r15
+  806134:	48 b8 af 86 ff ff ff 	movabs $0xffffffffffff86af,%rax
+  80613b:	ff ff ff 
+  80613e:	48 01 d8             	add    %rbx,%rax
+  806141:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  806143:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806147:	8b 50 04             	mov    0x4(%rax),%edx
+  80614a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80614e:	8b 00                	mov    (%rax),%eax
+  806150:	29 c2                	sub    %eax,%edx
+  806152:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806156:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  80615c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806160:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  806167:	00 00 00 
+	stat->st_dev = &devpipe;
+  80616a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80616e:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806175:	00 00 00 
+  806178:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80617c:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  806183:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806188:	48 83 c4 20          	add    $0x20,%rsp
+  80618c:	5b                   	pop    %rbx
+  80618d:	41 5f                	pop    %r15
+  80618f:	5d                   	pop    %rbp
+  806190:	c3                   	ret
+
+0000000000806191 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  806191:	55                   	push   %rbp
+  806192:	48 89 e5             	mov    %rsp,%rbp
+  806195:	41 57                	push   %r15
+  806197:	53                   	push   %rbx
+  806198:	48 83 ec 10          	sub    $0x10,%rsp
+  80619c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80619c <devpipe_close+0xb>
+  8061a3:	49 bb a4 2e 00 00 00 	movabs $0x2ea4,%r11
+  8061aa:	00 00 00 
+  8061ad:	4c 01 db             	add    %r11,%rbx
+  8061b0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  8061b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061b8:	48 89 c6             	mov    %rax,%rsi
+  8061bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061c0:	49 89 df             	mov    %rbx,%r15
+  8061c3:	48 b8 43 94 ff ff ff 	movabs $0xffffffffffff9443,%rax
+  8061ca:	ff ff ff 
+  8061cd:	48 01 d8             	add    %rbx,%rax
+  8061d0:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8061d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061d6:	48 89 c7             	mov    %rax,%rdi
+  8061d9:	49 89 df             	mov    %rbx,%r15
+  8061dc:	48 b8 d7 a6 ff ff ff 	movabs $0xffffffffffffa6d7,%rax
+  8061e3:	ff ff ff 
+  8061e6:	48 01 d8             	add    %rbx,%rax
+  8061e9:	ff d0                	call   *%rax
+  8061eb:	48 89 c6             	mov    %rax,%rsi
+  8061ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061f3:	49 89 df             	mov    %rbx,%r15
+  8061f6:	48 b8 43 94 ff ff ff 	movabs $0xffffffffffff9443,%rax
+  8061fd:	ff ff ff 
+  806200:	48 01 d8             	add    %rbx,%rax
+  806203:	ff d0                	call   *%rax
+}
+  806205:	48 83 c4 10          	add    $0x10,%rsp
+  806209:	5b                   	pop    %rbx
+  80620a:	41 5f                	pop    %r15
+  80620c:	5d                   	pop    %rbp
+  80620d:	c3                   	ret
+
+000000000080620e <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  80620e:	55                   	push   %rbp
+  80620f:	48 89 e5             	mov    %rsp,%rbp
+  806212:	41 57                	push   %r15
+  806214:	53                   	push   %rbx
+  806215:	48 83 ec 20          	sub    $0x20,%rsp
+  806219:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806219 <wait+0xb>
+  806220:	49 bb 27 2e 00 00 00 	movabs $0x2e27,%r11
+  806227:	00 00 00 
+  80622a:	4c 01 db             	add    %r11,%rbx
+  80622d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  806230:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806234:	75 50                	jne    806286 <wait+0x78>
+  806236:	48 b8 50 e8 ff ff ff 	movabs $0xffffffffffffe850,%rax
+  80623d:	ff ff ff 
+  806240:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806244:	48 89 c1             	mov    %rax,%rcx
+  806247:	48 b8 5b e8 ff ff ff 	movabs $0xffffffffffffe85b,%rax
+  80624e:	ff ff ff 
+  806251:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806255:	48 89 c2             	mov    %rax,%rdx
+  806258:	be 09 00 00 00       	mov    $0x9,%esi
+  80625d:	48 b8 70 e8 ff ff ff 	movabs $0xffffffffffffe870,%rax
+  806264:	ff ff ff 
+  806267:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80626b:	48 89 c7             	mov    %rax,%rdi
+  80626e:	49 89 df             	mov    %rbx,%r15
+  806271:	b8 00 00 00 00       	mov    $0x0,%eax
+  806276:	49 b8 16 76 ff ff ff 	movabs $0xffffffffffff7616,%r8
+  80627d:	ff ff ff 
+  806280:	49 01 d8             	add    %rbx,%r8
+  806283:	41 ff d0             	call   *%r8
+	e = &envs[ENVX(envid)];
+  806286:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806289:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80628e:	48 98                	cltq
+  806290:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806297:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80629e:	ff ff ff 
+  8062a1:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8062a5:	48 01 d0             	add    %rdx,%rax
+  8062a8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8062ac:	eb 12                	jmp    8062c0 <wait+0xb2>
+		sys_yield();
+  8062ae:	49 89 df             	mov    %rbx,%r15
+  8062b1:	48 b8 16 93 ff ff ff 	movabs $0xffffffffffff9316,%rax
+  8062b8:	ff ff ff 
+  8062bb:	48 01 d8             	add    %rbx,%rax
+  8062be:	ff d0                	call   *%rax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8062c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062c4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8062ca:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  8062cd:	75 0e                	jne    8062dd <wait+0xcf>
+  8062cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062d3:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  8062d9:	85 c0                	test   %eax,%eax
+  8062db:	75 d1                	jne    8062ae <wait+0xa0>
+}
+  8062dd:	90                   	nop
+  8062de:	48 83 c4 20          	add    $0x20,%rsp
+  8062e2:	5b                   	pop    %rbx
+  8062e3:	41 5f                	pop    %r15
+  8062e5:	5d                   	pop    %rbp
+  8062e6:	c3                   	ret
+
+00000000008062e7 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8062e7:	55                   	push   %rbp
+  8062e8:	48 89 e5             	mov    %rsp,%rbp
+  8062eb:	41 57                	push   %r15
+  8062ed:	48 83 ec 28          	sub    $0x28,%rsp
+  8062f1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8062f1 <cputchar+0xa>
+  8062f8:	49 bb 4f 2d 00 00 00 	movabs $0x2d4f,%r11
+  8062ff:	00 00 00 
+  806302:	4c 01 d8             	add    %r11,%rax
+  806305:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  806308:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80630b:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  80630e:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  806312:	be 01 00 00 00       	mov    $0x1,%esi
+  806317:	48 89 d7             	mov    %rdx,%rdi
+  80631a:	49 89 c7             	mov    %rax,%r15
+  80631d:	48 ba b3 91 ff ff ff 	movabs $0xffffffffffff91b3,%rdx
+  806324:	ff ff ff 
+  806327:	48 01 c2             	add    %rax,%rdx
+  80632a:	ff d2                	call   *%rdx
+}
+  80632c:	90                   	nop
+  80632d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806331:	c9                   	leave
+  806332:	c3                   	ret
+
+0000000000806333 <getchar>:
+
+int
+getchar(void)
+{
+  806333:	55                   	push   %rbp
+  806334:	48 89 e5             	mov    %rsp,%rbp
+  806337:	41 57                	push   %r15
+  806339:	48 83 ec 18          	sub    $0x18,%rsp
+  80633d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80633d <getchar+0xa>
+  806344:	49 bb 03 2d 00 00 00 	movabs $0x2d03,%r11
+  80634b:	00 00 00 
+  80634e:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806351:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  806355:	ba 01 00 00 00       	mov    $0x1,%edx
+  80635a:	48 89 ce             	mov    %rcx,%rsi
+  80635d:	bf 00 00 00 00       	mov    $0x0,%edi
+  806362:	49 89 c7             	mov    %rax,%r15
+  806365:	48 b9 17 ad ff ff ff 	movabs $0xffffffffffffad17,%rcx
+  80636c:	ff ff ff 
+  80636f:	48 01 c1             	add    %rax,%rcx
+  806372:	ff d1                	call   *%rcx
+  806374:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  806377:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80637b:	79 05                	jns    806382 <getchar+0x4f>
+		return r;
+  80637d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806380:	eb 14                	jmp    806396 <getchar+0x63>
+	if (r < 1)
+  806382:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806386:	7f 07                	jg     80638f <getchar+0x5c>
+		return -E_EOF;
+  806388:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80638d:	eb 07                	jmp    806396 <getchar+0x63>
+	return c;
+  80638f:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  806393:	0f b6 c0             	movzbl %al,%eax
+}
+  806396:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80639a:	c9                   	leave
+  80639b:	c3                   	ret
+
+000000000080639c <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  80639c:	55                   	push   %rbp
+  80639d:	48 89 e5             	mov    %rsp,%rbp
+  8063a0:	41 57                	push   %r15
+  8063a2:	53                   	push   %rbx
+  8063a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8063a7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8063a7 <iscons+0xb>
+  8063ae:	49 bb 99 2c 00 00 00 	movabs $0x2c99,%r11
+  8063b5:	00 00 00 
+  8063b8:	4c 01 db             	add    %r11,%rbx
+  8063bb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8063be:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8063c2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8063c5:	48 89 d6             	mov    %rdx,%rsi
+  8063c8:	89 c7                	mov    %eax,%edi
+  8063ca:	49 89 df             	mov    %rbx,%r15
+  8063cd:	48 b8 d0 a7 ff ff ff 	movabs $0xffffffffffffa7d0,%rax
+  8063d4:	ff ff ff 
+  8063d7:	48 01 d8             	add    %rbx,%rax
+  8063da:	ff d0                	call   *%rax
+  8063dc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8063df:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8063e3:	79 05                	jns    8063ea <iscons+0x4e>
+		return r;
+  8063e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063e8:	eb 1b                	jmp    806405 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8063ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063ee:	8b 10                	mov    (%rax),%edx
+  8063f0:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  8063f7:	00 00 00 
+  8063fa:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8063fd:	39 c2                	cmp    %eax,%edx
+  8063ff:	0f 94 c0             	sete   %al
+  806402:	0f b6 c0             	movzbl %al,%eax
+}
+  806405:	48 83 c4 20          	add    $0x20,%rsp
+  806409:	5b                   	pop    %rbx
+  80640a:	41 5f                	pop    %r15
+  80640c:	5d                   	pop    %rbp
+  80640d:	c3                   	ret
+
+000000000080640e <opencons>:
+
+int
+opencons(void)
+{
+  80640e:	55                   	push   %rbp
+  80640f:	48 89 e5             	mov    %rsp,%rbp
+  806412:	41 57                	push   %r15
+  806414:	53                   	push   %rbx
+  806415:	48 83 ec 10          	sub    $0x10,%rsp
+  806419:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806419 <opencons+0xb>
+  806420:	49 bb 27 2c 00 00 00 	movabs $0x2c27,%r11
+  806427:	00 00 00 
+  80642a:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  80642d:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806431:	48 89 c7             	mov    %rax,%rdi
+  806434:	49 89 df             	mov    %rbx,%r15
+  806437:	48 b8 1a a7 ff ff ff 	movabs $0xffffffffffffa71a,%rax
+  80643e:	ff ff ff 
+  806441:	48 01 d8             	add    %rbx,%rax
+  806444:	ff d0                	call   *%rax
+  806446:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806449:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80644d:	79 05                	jns    806454 <opencons+0x46>
+		return r;
+  80644f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806452:	eb 68                	jmp    8064bc <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806454:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806458:	ba 07 04 00 00       	mov    $0x407,%edx
+  80645d:	48 89 c6             	mov    %rax,%rsi
+  806460:	bf 00 00 00 00       	mov    $0x0,%edi
+  806465:	49 89 df             	mov    %rbx,%r15
+  806468:	48 b8 6b 93 ff ff ff 	movabs $0xffffffffffff936b,%rax
+  80646f:	ff ff ff 
+  806472:	48 01 d8             	add    %rbx,%rax
+  806475:	ff d0                	call   *%rax
+  806477:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80647a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80647e:	79 05                	jns    806485 <opencons+0x77>
+		return r;
+  806480:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806483:	eb 37                	jmp    8064bc <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  806485:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806489:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806490:	00 00 00 
+  806493:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806496:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  806498:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80649c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8064a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8064a7:	48 89 c7             	mov    %rax,%rdi
+  8064aa:	49 89 df             	mov    %rbx,%r15
+  8064ad:	48 b8 a0 a6 ff ff ff 	movabs $0xffffffffffffa6a0,%rax
+  8064b4:	ff ff ff 
+  8064b7:	48 01 d8             	add    %rbx,%rax
+  8064ba:	ff d0                	call   *%rax
+}
+  8064bc:	48 83 c4 10          	add    $0x10,%rsp
+  8064c0:	5b                   	pop    %rbx
+  8064c1:	41 5f                	pop    %r15
+  8064c3:	5d                   	pop    %rbp
+  8064c4:	c3                   	ret
+
+00000000008064c5 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8064c5:	55                   	push   %rbp
+  8064c6:	48 89 e5             	mov    %rsp,%rbp
+  8064c9:	41 57                	push   %r15
+  8064cb:	53                   	push   %rbx
+  8064cc:	48 83 ec 30          	sub    $0x30,%rsp
+  8064d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8064d0 <devcons_read+0xb>
+  8064d7:	49 bb 70 2b 00 00 00 	movabs $0x2b70,%r11
+  8064de:	00 00 00 
+  8064e1:	4c 01 db             	add    %r11,%rbx
+  8064e4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8064e8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8064ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8064f0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8064f5:	75 19                	jne    806510 <devcons_read+0x4b>
+		return 0;
+  8064f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064fc:	eb 55                	jmp    806553 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8064fe:	49 89 df             	mov    %rbx,%r15
+  806501:	48 b8 16 93 ff ff ff 	movabs $0xffffffffffff9316,%rax
+  806508:	ff ff ff 
+  80650b:	48 01 d8             	add    %rbx,%rax
+  80650e:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806510:	49 89 df             	mov    %rbx,%r15
+  806513:	48 b8 12 92 ff ff ff 	movabs $0xffffffffffff9212,%rax
+  80651a:	ff ff ff 
+  80651d:	48 01 d8             	add    %rbx,%rax
+  806520:	ff d0                	call   *%rax
+  806522:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806525:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806529:	74 d3                	je     8064fe <devcons_read+0x39>
+	if (c < 0)
+  80652b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80652f:	79 05                	jns    806536 <devcons_read+0x71>
+		return c;
+  806531:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806534:	eb 1d                	jmp    806553 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806536:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80653a:	75 07                	jne    806543 <devcons_read+0x7e>
+		return 0;
+  80653c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806541:	eb 10                	jmp    806553 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806543:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806546:	89 c2                	mov    %eax,%edx
+  806548:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80654c:	88 10                	mov    %dl,(%rax)
+	return 1;
+  80654e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806553:	48 83 c4 30          	add    $0x30,%rsp
+  806557:	5b                   	pop    %rbx
+  806558:	41 5f                	pop    %r15
+  80655a:	5d                   	pop    %rbp
+  80655b:	c3                   	ret
+
+000000000080655c <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80655c:	55                   	push   %rbp
+  80655d:	48 89 e5             	mov    %rsp,%rbp
+  806560:	41 57                	push   %r15
+  806562:	53                   	push   %rbx
+  806563:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80656a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80656a <devcons_write+0xe>
+  806571:	49 bb d6 2a 00 00 00 	movabs $0x2ad6,%r11
+  806578:	00 00 00 
+  80657b:	4c 01 db             	add    %r11,%rbx
+  80657e:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806585:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  80658c:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  806593:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80659a:	e9 80 00 00 00       	jmp    80661f <devcons_write+0xc3>
+		m = n - tot;
+  80659f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8065a6:	89 c2                	mov    %eax,%edx
+  8065a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8065ab:	29 c2                	sub    %eax,%edx
+  8065ad:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8065b0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8065b3:	83 f8 7f             	cmp    $0x7f,%eax
+  8065b6:	76 07                	jbe    8065bf <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8065b8:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8065bf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8065c2:	48 63 d0             	movslq %eax,%rdx
+  8065c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8065c8:	48 63 c8             	movslq %eax,%rcx
+  8065cb:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8065d2:	48 01 c1             	add    %rax,%rcx
+  8065d5:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8065dc:	48 89 ce             	mov    %rcx,%rsi
+  8065df:	48 89 c7             	mov    %rax,%rdi
+  8065e2:	49 89 df             	mov    %rbx,%r15
+  8065e5:	48 b8 8f 8a ff ff ff 	movabs $0xffffffffffff8a8f,%rax
+  8065ec:	ff ff ff 
+  8065ef:	48 01 d8             	add    %rbx,%rax
+  8065f2:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8065f4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8065f7:	48 63 d0             	movslq %eax,%rdx
+  8065fa:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806601:	48 89 d6             	mov    %rdx,%rsi
+  806604:	48 89 c7             	mov    %rax,%rdi
+  806607:	49 89 df             	mov    %rbx,%r15
+  80660a:	48 b8 b3 91 ff ff ff 	movabs $0xffffffffffff91b3,%rax
+  806611:	ff ff ff 
+  806614:	48 01 d8             	add    %rbx,%rax
+  806617:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806619:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80661c:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80661f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806622:	48 98                	cltq
+  806624:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  80662b:	0f 82 6e ff ff ff    	jb     80659f <devcons_write+0x43>
+	}
+	return tot;
+  806631:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806634:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  80663b:	5b                   	pop    %rbx
+  80663c:	41 5f                	pop    %r15
+  80663e:	5d                   	pop    %rbp
+  80663f:	c3                   	ret
+
+0000000000806640 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806640:	55                   	push   %rbp
+  806641:	48 89 e5             	mov    %rsp,%rbp
+  806644:	48 83 ec 08          	sub    $0x8,%rsp
+  806648:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806648 <devcons_close+0x8>
+  80664f:	49 bb f8 29 00 00 00 	movabs $0x29f8,%r11
+  806656:	00 00 00 
+  806659:	4c 01 d8             	add    %r11,%rax
+  80665c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806660:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806665:	c9                   	leave
+  806666:	c3                   	ret
+
+0000000000806667 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806667:	55                   	push   %rbp
+  806668:	48 89 e5             	mov    %rsp,%rbp
+  80666b:	41 57                	push   %r15
+  80666d:	48 83 ec 18          	sub    $0x18,%rsp
+  806671:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806671 <devcons_stat+0xa>
+  806678:	49 bb cf 29 00 00 00 	movabs $0x29cf,%r11
+  80667f:	00 00 00 
+  806682:	4c 01 d8             	add    %r11,%rax
+  806685:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806689:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  80668d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806691:	48 b9 80 e8 ff ff ff 	movabs $0xffffffffffffe880,%rcx
+  806698:	ff ff ff 
+  80669b:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80669f:	48 89 ce             	mov    %rcx,%rsi
+  8066a2:	48 89 d7             	mov    %rdx,%rdi
+  8066a5:	49 89 c7             	mov    %rax,%r15
+  8066a8:	48 ba af 86 ff ff ff 	movabs $0xffffffffffff86af,%rdx
+  8066af:	ff ff ff 
+  8066b2:	48 01 c2             	add    %rax,%rdx
+  8066b5:	ff d2                	call   *%rdx
+	return 0;
+  8066b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8066bc:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8066c0:	c9                   	leave
+  8066c1:	c3                   	ret
+
+00000000008066c2 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8066c2:	55                   	push   %rbp
+  8066c3:	48 89 e5             	mov    %rsp,%rbp
+  8066c6:	41 57                	push   %r15
+  8066c8:	53                   	push   %rbx
+  8066c9:	48 83 ec 20          	sub    $0x20,%rsp
+  8066cd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8066cd <set_pgfault_handler+0xb>
+  8066d4:	49 bb 73 29 00 00 00 	movabs $0x2973,%r11
+  8066db:	00 00 00 
+  8066de:	4c 01 db             	add    %r11,%rbx
+  8066e1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  8066e5:	49 89 df             	mov    %rbx,%r15
+  8066e8:	48 b8 c2 92 ff ff ff 	movabs $0xffffffffffff92c2,%rax
+  8066ef:	ff ff ff 
+  8066f2:	48 01 d8             	add    %rbx,%rax
+  8066f5:	ff d0                	call   *%rax
+  8066f7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  8066fa:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806701:	00 00 00 
+  806704:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806708:	48 85 c0             	test   %rax,%rax
+  80670b:	75 6b                	jne    806778 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  80670d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806710:	ba 07 00 00 00       	mov    $0x7,%edx
+  806715:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80671a:	48 89 ce             	mov    %rcx,%rsi
+  80671d:	89 c7                	mov    %eax,%edi
+  80671f:	49 89 df             	mov    %rbx,%r15
+  806722:	48 b8 6b 93 ff ff ff 	movabs $0xffffffffffff936b,%rax
+  806729:	ff ff ff 
+  80672c:	48 01 d8             	add    %rbx,%rax
+  80672f:	ff d0                	call   *%rax
+  806731:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806734:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806738:	74 3e                	je     806778 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  80673a:	48 b8 88 e8 ff ff ff 	movabs $0xffffffffffffe888,%rax
+  806741:	ff ff ff 
+  806744:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806748:	48 89 c2             	mov    %rax,%rdx
+  80674b:	be 23 00 00 00       	mov    $0x23,%esi
+  806750:	48 b8 b6 e8 ff ff ff 	movabs $0xffffffffffffe8b6,%rax
+  806757:	ff ff ff 
+  80675a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80675e:	48 89 c7             	mov    %rax,%rdi
+  806761:	49 89 df             	mov    %rbx,%r15
+  806764:	b8 00 00 00 00       	mov    $0x0,%eax
+  806769:	48 b9 16 76 ff ff ff 	movabs $0xffffffffffff7616,%rcx
+  806770:	ff ff ff 
+  806773:	48 01 d9             	add    %rbx,%rcx
+  806776:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806778:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  80677f:	00 00 00 
+  806782:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806786:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  80678a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80678d:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806794:	ff ff ff 
+  806797:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80679b:	48 89 d6             	mov    %rdx,%rsi
+  80679e:	89 c7                	mov    %eax,%edi
+  8067a0:	49 89 df             	mov    %rbx,%r15
+  8067a3:	48 b8 61 95 ff ff ff 	movabs $0xffffffffffff9561,%rax
+  8067aa:	ff ff ff 
+  8067ad:	48 01 d8             	add    %rbx,%rax
+  8067b0:	ff d0                	call   *%rax
+}
+  8067b2:	90                   	nop
+  8067b3:	48 83 c4 20          	add    $0x20,%rsp
+  8067b7:	5b                   	pop    %rbx
+  8067b8:	41 5f                	pop    %r15
+  8067ba:	5d                   	pop    %rbp
+  8067bb:	c3                   	ret
+
+00000000008067bc <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  8067bc:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  8067bf:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  8067c6:	00 00 00 
+call *%rax
+  8067c9:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  8067cb:	58                   	pop    %rax
+	popq %rax;
+  8067cc:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  8067cd:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  8067d4:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  8067d8:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  8067dc:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  8067e0:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  8067e4:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  8067e8:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  8067eb:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  8067ef:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8067f3:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8067f8:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8067fd:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806802:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806807:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80680c:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806811:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806816:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80681b:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806820:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806825:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80682a:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80682f:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806834:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806839:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  80683d:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806841:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806842:	5c                   	pop    %rsp
+	ret;			//return
+  806843:	c3                   	ret
+
+0000000000806844 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806844:	55                   	push   %rbp
+  806845:	48 89 e5             	mov    %rsp,%rbp
+  806848:	41 57                	push   %r15
+  80684a:	53                   	push   %rbx
+  80684b:	48 83 ec 30          	sub    $0x30,%rsp
+  80684f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80684f <ipc_recv+0xb>
+  806856:	49 bb f1 27 00 00 00 	movabs $0x27f1,%r11
+  80685d:	00 00 00 
+  806860:	4c 01 db             	add    %r11,%rbx
+  806863:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806867:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80686b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  80686f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806874:	75 0e                	jne    806884 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  806876:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80687d:	00 00 00 
+  806880:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  806884:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806888:	48 89 c7             	mov    %rax,%rdi
+  80688b:	49 89 df             	mov    %rbx,%r15
+  80688e:	48 b8 94 96 ff ff ff 	movabs $0xffffffffffff9694,%rax
+  806895:	ff ff ff 
+  806898:	48 01 d8             	add    %rbx,%rax
+  80689b:	ff d0                	call   *%rax
+  80689d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8068a0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8068a5:	74 2a                	je     8068d1 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8068a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068ab:	75 19                	jne    8068c6 <ipc_recv+0x82>
+  8068ad:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8068b4:	ff ff ff 
+  8068b7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068bb:	48 8b 00             	mov    (%rax),%rax
+  8068be:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8068c4:	eb 05                	jmp    8068cb <ipc_recv+0x87>
+  8068c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8068cb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8068cf:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8068d1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8068d6:	74 2a                	je     806902 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  8068d8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068dc:	75 19                	jne    8068f7 <ipc_recv+0xb3>
+  8068de:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8068e5:	ff ff ff 
+  8068e8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068ec:	48 8b 00             	mov    (%rax),%rax
+  8068ef:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8068f5:	eb 05                	jmp    8068fc <ipc_recv+0xb8>
+  8068f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8068fc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806900:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806902:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806906:	74 05                	je     80690d <ipc_recv+0xc9>
+		return res;
+  806908:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80690b:	eb 17                	jmp    806924 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  80690d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806914:	ff ff ff 
+  806917:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80691b:	48 8b 00             	mov    (%rax),%rax
+  80691e:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806924:	48 83 c4 30          	add    $0x30,%rsp
+  806928:	5b                   	pop    %rbx
+  806929:	41 5f                	pop    %r15
+  80692b:	5d                   	pop    %rbp
+  80692c:	c3                   	ret
+
+000000000080692d <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80692d:	55                   	push   %rbp
+  80692e:	48 89 e5             	mov    %rsp,%rbp
+  806931:	41 57                	push   %r15
+  806933:	53                   	push   %rbx
+  806934:	48 83 ec 20          	sub    $0x20,%rsp
+  806938:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806938 <ipc_send+0xb>
+  80693f:	49 bb 08 27 00 00 00 	movabs $0x2708,%r11
+  806946:	00 00 00 
+  806949:	4c 01 db             	add    %r11,%rbx
+  80694c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80694f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806952:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806956:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  806959:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80695e:	75 0e                	jne    80696e <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  806960:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806967:	00 00 00 
+  80696a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  80696e:	90                   	nop
+  80696f:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806972:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806975:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806979:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80697c:	89 c7                	mov    %eax,%edi
+  80697e:	49 89 df             	mov    %rbx,%r15
+  806981:	48 b8 2a 96 ff ff ff 	movabs $0xffffffffffff962a,%rax
+  806988:	ff ff ff 
+  80698b:	48 01 d8             	add    %rbx,%rax
+  80698e:	ff d0                	call   *%rax
+  806990:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  806993:	74 da                	je     80696f <ipc_send+0x42>
+		;
+}
+  806995:	90                   	nop
+  806996:	90                   	nop
+  806997:	48 83 c4 20          	add    $0x20,%rsp
+  80699b:	5b                   	pop    %rbx
+  80699c:	41 5f                	pop    %r15
+  80699e:	5d                   	pop    %rbp
+  80699f:	c3                   	ret
+
+00000000008069a0 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8069a0:	55                   	push   %rbp
+  8069a1:	48 89 e5             	mov    %rsp,%rbp
+  8069a4:	41 57                	push   %r15
+  8069a6:	53                   	push   %rbx
+  8069a7:	48 83 ec 40          	sub    $0x40,%rsp
+  8069ab:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8069ab <ipc_call+0xb>
+  8069b2:	49 bb 95 26 00 00 00 	movabs $0x2695,%r11
+  8069b9:	00 00 00 
+  8069bc:	4c 01 db             	add    %r11,%rbx
+  8069bf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8069c2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8069c5:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8069c9:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8069cc:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8069d0:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8069d4:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8069d9:	75 0e                	jne    8069e9 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  8069db:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8069e2:	00 00 00 
+  8069e5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8069e9:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8069ee:	75 0e                	jne    8069fe <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8069f0:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8069f7:	00 00 00 
+  8069fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  8069fe:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806a01:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  806a05:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806a08:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806a0c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806a0f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806a15:	49 89 f8             	mov    %rdi,%r8
+  806a18:	89 c7                	mov    %eax,%edi
+  806a1a:	49 89 df             	mov    %rbx,%r15
+  806a1d:	48 b8 ed 96 ff ff ff 	movabs $0xffffffffffff96ed,%rax
+  806a24:	ff ff ff 
+  806a27:	48 01 d8             	add    %rbx,%rax
+  806a2a:	ff d0                	call   *%rax
+  806a2c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806a2f:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806a34:	74 2a                	je     806a60 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806a36:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a3a:	75 19                	jne    806a55 <ipc_call+0xb5>
+  806a3c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806a43:	ff ff ff 
+  806a46:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a4a:	48 8b 00             	mov    (%rax),%rax
+  806a4d:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806a53:	eb 05                	jmp    806a5a <ipc_call+0xba>
+  806a55:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a5a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806a5e:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806a60:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a64:	74 05                	je     806a6b <ipc_call+0xcb>
+		return r;
+  806a66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a69:	eb 17                	jmp    806a82 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  806a6b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806a72:	ff ff ff 
+  806a75:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a79:	48 8b 00             	mov    (%rax),%rax
+  806a7c:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806a82:	48 83 c4 40          	add    $0x40,%rsp
+  806a86:	5b                   	pop    %rbx
+  806a87:	41 5f                	pop    %r15
+  806a89:	5d                   	pop    %rbp
+  806a8a:	c3                   	ret
+
+0000000000806a8b <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  806a8b:	55                   	push   %rbp
+  806a8c:	48 89 e5             	mov    %rsp,%rbp
+  806a8f:	41 57                	push   %r15
+  806a91:	53                   	push   %rbx
+  806a92:	48 83 ec 70          	sub    $0x70,%rsp
+  806a96:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a96 <ipc_callw+0xb>
+  806a9d:	49 bb aa 25 00 00 00 	movabs $0x25aa,%r11
+  806aa4:	00 00 00 
+  806aa7:	4c 01 db             	add    %r11,%rbx
+  806aaa:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  806aad:	89 75 98             	mov    %esi,-0x68(%rbp)
+  806ab0:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  806ab4:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  806ab8:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  806abd:	76 0a                	jbe    806ac9 <ipc_callw+0x3e>
+		return -E_INVAL;
+  806abf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806ac4:	e9 b7 00 00 00       	jmp    806b80 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  806ac9:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806acd:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806ad1:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  806ad5:	48 89 ce             	mov    %rcx,%rsi
+  806ad8:	48 89 c7             	mov    %rax,%rdi
+  806adb:	49 89 df             	mov    %rbx,%r15
+  806ade:	48 b8 8f 8a ff ff ff 	movabs $0xffffffffffff8a8f,%rax
+  806ae5:	ff ff ff 
+  806ae8:	48 01 d8             	add    %rbx,%rax
+  806aeb:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  806aed:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806af4:	00 
+  806af5:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806af9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806afd:	48 01 d0             	add    %rdx,%rax
+  806b00:	48 83 e8 01          	sub    $0x1,%rax
+  806b04:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806b08:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  806b11:	48 f7 75 e8          	divq   -0x18(%rbp)
+  806b15:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b19:	48 29 d0             	sub    %rdx,%rax
+  806b1c:	48 c1 e8 03          	shr    $0x3,%rax
+  806b20:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806b24:	89 c1                	mov    %eax,%ecx
+  806b26:	8b 75 98             	mov    -0x68(%rbp),%esi
+  806b29:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806b2d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806b30:	49 89 d1             	mov    %rdx,%r9
+  806b33:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  806b3a:	00 00 00 
+  806b3d:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806b44:	00 00 00 
+  806b47:	89 c7                	mov    %eax,%edi
+  806b49:	49 89 df             	mov    %rbx,%r15
+  806b4c:	48 b8 ed 96 ff ff ff 	movabs $0xffffffffffff96ed,%rax
+  806b53:	ff ff ff 
+  806b56:	48 01 d8             	add    %rbx,%rax
+  806b59:	ff d0                	call   *%rax
+  806b5b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  806b5e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806b62:	74 05                	je     806b69 <ipc_callw+0xde>
+		return r;
+  806b64:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b67:	eb 17                	jmp    806b80 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  806b69:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b70:	ff ff ff 
+  806b73:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b77:	48 8b 00             	mov    (%rax),%rax
+  806b7a:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806b80:	48 83 c4 70          	add    $0x70,%rsp
+  806b84:	5b                   	pop    %rbx
+  806b85:	41 5f                	pop    %r15
+  806b87:	5d                   	pop    %rbp
+  806b88:	c3                   	ret
+
+0000000000806b89 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  806b89:	55                   	push   %rbp
+  806b8a:	48 89 e5             	mov    %rsp,%rbp
+  806b8d:	41 57                	push   %r15
+  806b8f:	53                   	push   %rbx
+  806b90:	48 83 ec 40          	sub    $0x40,%rsp
+  806b94:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b94 <ipc_callv+0xb>
+  806b9b:	49 bb ac 24 00 00 00 	movabs $0x24ac,%r11
+  806ba2:	00 00 00 
+  806ba5:	4c 01 db             	add    %r11,%rbx
+  806ba8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  806bab:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  806bae:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  806bb2:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806bb5:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  806bb9:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  806bbd:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806bc4:	00 00 00 
+  806bc7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806bcb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806bcf:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806bd3:	74 11                	je     806be6 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806bd5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806bd9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806bdd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806be0:	c1 e0 14             	shl    $0x14,%eax
+  806be3:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806be6:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806bea:	74 14                	je     806c00 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806bec:	8b 45 20             	mov    0x20(%rbp),%eax
+  806bef:	83 e8 01             	sub    $0x1,%eax
+  806bf2:	48 63 d0             	movslq %eax,%rdx
+  806bf5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806bf9:	48 09 d0             	or     %rdx,%rax
+  806bfc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806c00:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806c03:	c1 e0 10             	shl    $0x10,%eax
+  806c06:	0b 45 10             	or     0x10(%rbp),%eax
+  806c09:	89 c1                	mov    %eax,%ecx
+  806c0b:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806c0e:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806c12:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806c16:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806c1a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806c1d:	4d 89 c1             	mov    %r8,%r9
+  806c20:	49 89 f8             	mov    %rdi,%r8
+  806c23:	89 c7                	mov    %eax,%edi
+  806c25:	49 89 df             	mov    %rbx,%r15
+  806c28:	48 b8 ed 96 ff ff ff 	movabs $0xffffffffffff96ed,%rax
+  806c2f:	ff ff ff 
+  806c32:	48 01 d8             	add    %rbx,%rax
+  806c35:	ff d0                	call   *%rax
+  806c37:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806c3a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806c3e:	74 05                	je     806c45 <ipc_callv+0xbc>
+		return r;
+  806c40:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806c43:	eb 17                	jmp    806c5c <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806c45:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806c4c:	ff ff ff 
+  806c4f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806c53:	48 8b 00             	mov    (%rax),%rax
+  806c56:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806c5c:	48 83 c4 40          	add    $0x40,%rsp
+  806c60:	5b                   	pop    %rbx
+  806c61:	41 5f                	pop    %r15
+  806c63:	5d                   	pop    %rbp
+  806c64:	c3                   	ret
+
+0000000000806c65 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806c65:	55                   	push   %rbp
+  806c66:	48 89 e5             	mov    %rsp,%rbp
+  806c69:	41 57                	push   %r15
+  806c6b:	53                   	push   %rbx
+  806c6c:	48 83 ec 40          	sub    $0x40,%rsp
+  806c70:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806c70 <ipc_reply_recv+0xb>
+  806c77:	49 bb d0 23 00 00 00 	movabs $0x23d0,%r11
+  806c7e:	00 00 00 
+  806c81:	4c 01 db             	add    %r11,%rbx
+  806c84:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806c87:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806c8a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806c8e:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806c91:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806c95:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806c99:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806c9e:	75 0e                	jne    806cae <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806ca0:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806ca7:	00 00 00 
+  806caa:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806cae:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806cb3:	75 0e                	jne    806cc3 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806cb5:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806cbc:	00 00 00 
+  806cbf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806cc3:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806cc6:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806cca:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806cce:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806cd1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806cd5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806cd8:	4d 89 c1             	mov    %r8,%r9
+  806cdb:	49 89 f8             	mov    %rdi,%r8
+  806cde:	89 c7                	mov    %eax,%edi
+  806ce0:	49 89 df             	mov    %rbx,%r15
+  806ce3:	48 b8 61 97 ff ff ff 	movabs $0xffffffffffff9761,%rax
+  806cea:	ff ff ff 
+  806ced:	48 01 d8             	add    %rbx,%rax
+  806cf0:	ff d0                	call   *%rax
+  806cf2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806cf5:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806cfa:	74 2a                	je     806d26 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806cfc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806d00:	75 19                	jne    806d1b <ipc_reply_recv+0xb6>
+  806d02:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806d09:	ff ff ff 
+  806d0c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806d10:	48 8b 00             	mov    (%rax),%rax
+  806d13:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806d19:	eb 05                	jmp    806d20 <ipc_reply_recv+0xbb>
+  806d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806d24:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806d26:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806d2b:	74 2a                	je     806d57 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806d2d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806d31:	75 19                	jne    806d4c <ipc_reply_recv+0xe7>
+  806d33:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806d3a:	ff ff ff 
+  806d3d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806d41:	48 8b 00             	mov    (%rax),%rax
+  806d44:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806d4a:	eb 05                	jmp    806d51 <ipc_reply_recv+0xec>
+  806d4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d51:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806d55:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806d57:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806d5b:	74 05                	je     806d62 <ipc_reply_recv+0xfd>
+		return r;
+  806d5d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d60:	eb 17                	jmp    806d79 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806d62:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806d69:	ff ff ff 
+  806d6c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806d70:	48 8b 00             	mov    (%rax),%rax
+  806d73:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806d79:	48 83 c4 40          	add    $0x40,%rsp
+  806d7d:	5b                   	pop    %rbx
+  806d7e:	41 5f                	pop    %r15
+  806d80:	5d                   	pop    %rbp
+  806d81:	c3                   	ret
+
+0000000000806d82 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806d82:	55                   	push   %rbp
+  806d83:	48 89 e5             	mov    %rsp,%rbp
+  806d86:	41 57                	push   %r15
+  806d88:	53                   	push   %rbx
+  806d89:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806d90:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806d90 <ipc_window_batch+0xe>
+  806d97:	49 bb b0 22 00 00 00 	movabs $0x22b0,%r11
+  806d9e:	00 00 00 
+  806da1:	4c 01 db             	add    %r11,%rbx
+  806da4:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806daa:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806db1:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806db7:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  806dbd:	e9 15 01 00 00       	jmp    806ed7 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806dc2:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806dc8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806dcb:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806dd2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806dd5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806dd8:	39 c2                	cmp    %eax,%edx
+  806dda:	0f 4e c2             	cmovle %edx,%eax
+  806ddd:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806de0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806de7:	eb 6b                	jmp    806e54 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  806de9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806dec:	48 98                	cltq
+  806dee:	48 c1 e0 05          	shl    $0x5,%rax
+  806df2:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806df6:	48 01 e8             	add    %rbp,%rax
+  806df9:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806dff:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806e05:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e08:	c1 e0 0c             	shl    $0xc,%eax
+  806e0b:	48 63 d0             	movslq %eax,%rdx
+  806e0e:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806e15:	48 01 c2             	add    %rax,%rdx
+  806e18:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e1b:	48 98                	cltq
+  806e1d:	48 c1 e0 05          	shl    $0x5,%rax
+  806e21:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806e25:	48 01 e8             	add    %rbp,%rax
+  806e28:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806e2e:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806e31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e34:	48 98                	cltq
+  806e36:	48 c1 e0 05          	shl    $0x5,%rax
+  806e3a:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806e3e:	48 01 e8             	add    %rbp,%rax
+  806e41:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806e48:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806e4e:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806e50:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806e54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e57:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806e5a:	7c 8d                	jl     806de9 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806e5c:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806e63:	74 27                	je     806e8c <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806e65:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806e68:	48 63 d0             	movslq %eax,%rdx
+  806e6b:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806e72:	48 89 d6             	mov    %rdx,%rsi
+  806e75:	48 89 c7             	mov    %rax,%rdi
+  806e78:	49 89 df             	mov    %rbx,%r15
+  806e7b:	48 b8 04 9a ff ff ff 	movabs $0xffffffffffff9a04,%rax
+  806e82:	ff ff ff 
+  806e85:	48 01 d8             	add    %rbx,%rax
+  806e88:	ff d0                	call   *%rax
+  806e8a:	eb 25                	jmp    806eb1 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806e8c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806e8f:	48 63 d0             	movslq %eax,%rdx
+  806e92:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806e99:	48 89 d6             	mov    %rdx,%rsi
+  806e9c:	48 89 c7             	mov    %rax,%rdi
+  806e9f:	49 89 df             	mov    %rbx,%r15
+  806ea2:	48 b8 62 9a ff ff ff 	movabs $0xffffffffffff9a62,%rax
+  806ea9:	ff ff ff 
+  806eac:	48 01 d8             	add    %rbx,%rax
+  806eaf:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806eb1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806eb4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806eb8:	79 05                	jns    806ebf <ipc_window_batch+0x13d>
+			return r;
+  806eba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806ebd:	eb 2a                	jmp    806ee9 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806ebf:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806ec2:	c1 e0 0c             	shl    $0xc,%eax
+  806ec5:	48 98                	cltq
+  806ec7:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806ece:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806ed1:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806ed7:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806ede:	0f 8f de fe ff ff    	jg     806dc2 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806ee4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806ee9:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806ef0:	5b                   	pop    %rbx
+  806ef1:	41 5f                	pop    %r15
+  806ef3:	5d                   	pop    %rbp
+  806ef4:	c3                   	ret
+
+0000000000806ef5 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806ef5:	55                   	push   %rbp
+  806ef6:	48 89 e5             	mov    %rsp,%rbp
+  806ef9:	48 83 ec 10          	sub    $0x10,%rsp
+  806efd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806efd <ipc_map_window+0x8>
+  806f04:	49 bb 43 21 00 00 00 	movabs $0x2143,%r11
+  806f0b:	00 00 00 
+  806f0e:	4c 01 d8             	add    %r11,%rax
+  806f11:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806f15:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806f18:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806f1b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806f1f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806f24:	bf 01 00 00 00       	mov    $0x1,%edi
+  806f29:	49 b8 42 dd ff ff ff 	movabs $0xffffffffffffdd42,%r8
+  806f30:	ff ff ff 
+  806f33:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806f37:	ff d0                	call   *%rax
+}
+  806f39:	c9                   	leave
+  806f3a:	c3                   	ret
+
+0000000000806f3b <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806f3b:	55                   	push   %rbp
+  806f3c:	48 89 e5             	mov    %rsp,%rbp
+  806f3f:	48 83 ec 10          	sub    $0x10,%rsp
+  806f43:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806f43 <ipc_unmap_window+0x8>
+  806f4a:	49 bb fd 20 00 00 00 	movabs $0x20fd,%r11
+  806f51:	00 00 00 
+  806f54:	4c 01 d8             	add    %r11,%rax
+  806f57:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806f5b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806f5e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806f61:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806f65:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806f6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  806f6f:	49 b8 42 dd ff ff ff 	movabs $0xffffffffffffdd42,%r8
+  806f76:	ff ff ff 
+  806f79:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806f7d:	ff d0                	call   *%rax
+}
+  806f7f:	c9                   	leave
+  806f80:	c3                   	ret
+
+0000000000806f81 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806f81:	55                   	push   %rbp
+  806f82:	48 89 e5             	mov    %rsp,%rbp
+  806f85:	48 83 ec 18          	sub    $0x18,%rsp
+  806f89:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806f89 <ipc_find_env+0x8>
+  806f90:	49 bb b7 20 00 00 00 	movabs $0x20b7,%r11
+  806f97:	00 00 00 
+  806f9a:	4c 01 d8             	add    %r11,%rax
+  806f9d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806fa0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806fa7:	eb 57                	jmp    807000 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806fa9:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806fb0:	ff ff ff 
+  806fb3:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806fb7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806fba:	48 63 d2             	movslq %edx,%rdx
+  806fbd:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806fc4:	48 01 ca             	add    %rcx,%rdx
+  806fc7:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806fce:	8b 12                	mov    (%rdx),%edx
+  806fd0:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806fd3:	75 27                	jne    806ffc <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806fd5:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806fdc:	ff ff ff 
+  806fdf:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806fe3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806fe6:	48 98                	cltq
+  806fe8:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806fef:	48 01 d0             	add    %rdx,%rax
+  806ff2:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806ff8:	8b 00                	mov    (%rax),%eax
+  806ffa:	eb 12                	jmp    80700e <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806ffc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  807000:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  807007:	7e a0                	jle    806fa9 <ipc_find_env+0x28>
+	}
+	return 0;
+  807009:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80700e:	c9                   	leave
+  80700f:	c3                   	ret
+
+0000000000807010 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  807010:	55                   	push   %rbp
+  807011:	48 89 e5             	mov    %rsp,%rbp
+  807014:	48 83 ec 18          	sub    $0x18,%rsp
+  807018:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807018 <pageref+0x8>
+  80701f:	49 bb 28 20 00 00 00 	movabs $0x2028,%r11
+  807026:	00 00 00 
+  807029:	4c 01 d8             	add    %r11,%rax
+  80702c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  807030:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807034:	48 89 d1             	mov    %rdx,%rcx
+  807037:	48 c1 e9 15          	shr    $0x15,%rcx
+  80703b:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  807042:	ff ff ff 
+  807045:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  807049:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80704d:	83 e2 01             	and    $0x1,%edx
+  807050:	48 85 d2             	test   %rdx,%rdx
+  807053:	75 07                	jne    80705c <pageref+0x4c>
+		return 0;
+  807055:	b8 00 00 00 00       	mov    $0x0,%eax
+  80705a:	eb 64                	jmp    8070c0 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  80705c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807060:	48 89 d1             	mov    %rdx,%rcx
+  807063:	48 c1 e9 0c          	shr    $0xc,%rcx
+  807067:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  80706e:	ff ff ff 
+  807071:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  807075:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  807079:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  80707d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  807081:	83 e2 01             	and    $0x1,%edx
+  807084:	48 85 d2             	test   %rdx,%rdx
+  807087:	75 07                	jne    807090 <pageref+0x80>
+		return 0;
+  807089:	b8 00 00 00 00       	mov    $0x0,%eax
+  80708e:	eb 30                	jmp    8070c0 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  807090:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  807094:	48 c1 ea 0c          	shr    $0xc,%rdx
+  807098:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  80709f:	ff ff ff 
+  8070a2:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  8070a6:	48 89 d0             	mov    %rdx,%rax
+  8070a9:	48 01 c0             	add    %rax,%rax
+  8070ac:	48 01 d0             	add    %rdx,%rax
+  8070af:	48 c1 e0 03          	shl    $0x3,%rax
+  8070b3:	48 01 c8             	add    %rcx,%rax
+  8070b6:	48 83 c0 08          	add    $0x8,%rax
+  8070ba:	0f b7 00             	movzwl (%rax),%eax
+  8070bd:	0f b7 c0             	movzwl %ax,%eax
+}
+  8070c0:	c9                   	leave
+  8070c1:	c3                   	ret
@@ -0,0 +1,10986 @@
+
+obj/user/testpipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 a5 06 00 00       	call   8006e6 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  800051:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800051 <umain+0xe>
+  800058:	49 bb ef 8f 00 00 00 	movabs $0x8fef,%r11
+  80005f:	00 00 00 
+  800062:	4c 01 db             	add    %r11,%rbx
+  800065:	89 bd 6c ff ff ff    	mov    %edi,-0x94(%rbp)
+  80006b:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+	char buf[100];
+	int i, pid, p[2];
+
+	binaryname = "pipereadeof";
+  800072:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800079:	ff ff ff 
+  80007c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800080:	48 ba 64 e2 ff ff ff 	movabs $0xffffffffffffe264,%rdx
+  800087:	ff ff ff 
+  80008a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80008e:	48 89 10             	mov    %rdx,(%rax)
+
+	if ((i = pipe(p)) < 0)
+  800091:	48 8d 85 78 ff ff ff 	lea    -0x88(%rbp),%rax
+  800098:	48 89 c7             	mov    %rax,%rdi
+  80009b:	49 89 df             	mov    %rbx,%r15
+  80009e:	48 b8 f3 cb ff ff ff 	movabs $0xffffffffffffcbf3,%rax
+  8000a5:	ff ff ff 
+  8000a8:	48 01 d8             	add    %rbx,%rax
+  8000ab:	ff d0                	call   *%rax
+  8000ad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8000b0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000b4:	79 44                	jns    8000fa <umain+0xb7>
+		panic("pipe: %e", i);
+  8000b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000b9:	89 c1                	mov    %eax,%ecx
+  8000bb:	48 b8 70 e2 ff ff ff 	movabs $0xffffffffffffe270,%rax
+  8000c2:	ff ff ff 
+  8000c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000c9:	48 89 c2             	mov    %rax,%rdx
+  8000cc:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000d1:	48 b8 79 e2 ff ff ff 	movabs $0xffffffffffffe279,%rax
+  8000d8:	ff ff ff 
+  8000db:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000df:	48 89 c7             	mov    %rax,%rdi
+  8000e2:	49 89 df             	mov    %rbx,%r15
+  8000e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ea:	49 b8 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r8
+  8000f1:	ff ff ff 
+  8000f4:	49 01 d8             	add    %rbx,%r8
+  8000f7:	41 ff d0             	call   *%r8
+
+	if ((pid = fork()) < 0)
+  8000fa:	49 89 df             	mov    %rbx,%r15
+  8000fd:	48 b8 94 a4 ff ff ff 	movabs $0xffffffffffffa494,%rax
+  800104:	ff ff ff 
+  800107:	48 01 d8             	add    %rbx,%rax
+  80010a:	ff d0                	call   *%rax
+  80010c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80010f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800113:	79 44                	jns    800159 <umain+0x116>
+		panic("fork: %e", i);
+  800115:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800118:	89 c1                	mov    %eax,%ecx
+  80011a:	48 b8 89 e2 ff ff ff 	movabs $0xffffffffffffe289,%rax
+  800121:	ff ff ff 
+  800124:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800128:	48 89 c2             	mov    %rax,%rdx
+  80012b:	be 11 00 00 00       	mov    $0x11,%esi
+  800130:	48 b8 79 e2 ff ff ff 	movabs $0xffffffffffffe279,%rax
+  800137:	ff ff ff 
+  80013a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80013e:	48 89 c7             	mov    %rax,%rdi
+  800141:	49 89 df             	mov    %rbx,%r15
+  800144:	b8 00 00 00 00       	mov    $0x0,%eax
+  800149:	49 b8 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r8
+  800150:	ff ff ff 
+  800153:	49 01 d8             	add    %rbx,%r8
+  800156:	41 ff d0             	call   *%r8
+
+	if (pid == 0) {
+  800159:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80015d:	0f 85 c5 01 00 00    	jne    800328 <umain+0x2e5>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800163:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  800169:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800170:	ff ff ff 
+  800173:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800177:	48 8b 00             	mov    (%rax),%rax
+  80017a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800180:	89 c6                	mov    %eax,%esi
+  800182:	48 b8 92 e2 ff ff ff 	movabs $0xffffffffffffe292,%rax
+  800189:	ff ff ff 
+  80018c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800190:	48 89 c7             	mov    %rax,%rdi
+  800193:	49 89 df             	mov    %rbx,%r15
+  800196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019b:	48 b9 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rcx
+  8001a2:	ff ff ff 
+  8001a5:	48 01 d9             	add    %rbx,%rcx
+  8001a8:	ff d1                	call   *%rcx
+		close(p[1]);
+  8001aa:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  8001b0:	89 c7                	mov    %eax,%edi
+  8001b2:	49 89 df             	mov    %rbx,%r15
+  8001b5:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  8001bc:	ff ff ff 
+  8001bf:	48 01 d8             	add    %rbx,%rax
+  8001c2:	ff d0                	call   *%rax
+		cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  8001c4:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  8001ca:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8001d1:	ff ff ff 
+  8001d4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8001d8:	48 8b 00             	mov    (%rax),%rax
+  8001db:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8001e1:	89 c6                	mov    %eax,%esi
+  8001e3:	48 b8 af e2 ff ff ff 	movabs $0xffffffffffffe2af,%rax
+  8001ea:	ff ff ff 
+  8001ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001f1:	48 89 c7             	mov    %rax,%rdi
+  8001f4:	49 89 df             	mov    %rbx,%r15
+  8001f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fc:	48 b9 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rcx
+  800203:	ff ff ff 
+  800206:	48 01 d9             	add    %rbx,%rcx
+  800209:	ff d1                	call   *%rcx
+		i = readn(p[0], buf, sizeof buf-1);
+  80020b:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  800211:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  800215:	ba 63 00 00 00       	mov    $0x63,%edx
+  80021a:	48 89 ce             	mov    %rcx,%rsi
+  80021d:	89 c7                	mov    %eax,%edi
+  80021f:	49 89 df             	mov    %rbx,%r15
+  800222:	48 b8 c4 af ff ff ff 	movabs $0xffffffffffffafc4,%rax
+  800229:	ff ff ff 
+  80022c:	48 01 d8             	add    %rbx,%rax
+  80022f:	ff d0                	call   *%rax
+  800231:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		if (i < 0)
+  800234:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800238:	79 44                	jns    80027e <umain+0x23b>
+			panic("read: %e", i);
+  80023a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80023d:	89 c1                	mov    %eax,%ecx
+  80023f:	48 b8 cc e2 ff ff ff 	movabs $0xffffffffffffe2cc,%rax
+  800246:	ff ff ff 
+  800249:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80024d:	48 89 c2             	mov    %rax,%rdx
+  800250:	be 19 00 00 00       	mov    $0x19,%esi
+  800255:	48 b8 79 e2 ff ff ff 	movabs $0xffffffffffffe279,%rax
+  80025c:	ff ff ff 
+  80025f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800263:	48 89 c7             	mov    %rax,%rdi
+  800266:	49 89 df             	mov    %rbx,%r15
+  800269:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026e:	49 b8 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r8
+  800275:	ff ff ff 
+  800278:	49 01 d8             	add    %rbx,%r8
+  80027b:	41 ff d0             	call   *%r8
+		buf[i] = 0;
+  80027e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800281:	48 98                	cltq
+  800283:	c6 44 05 80 00       	movb   $0x0,-0x80(%rbp,%rax,1)
+		if (strcmp(buf, msg) == 0)
+  800288:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  80028f:	00 00 00 
+  800292:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  800296:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+  80029a:	48 89 d6             	mov    %rdx,%rsi
+  80029d:	48 89 c7             	mov    %rax,%rdi
+  8002a0:	49 89 df             	mov    %rbx,%r15
+  8002a3:	48 b8 02 8a ff ff ff 	movabs $0xffffffffffff8a02,%rax
+  8002aa:	ff ff ff 
+  8002ad:	48 01 d8             	add    %rbx,%rax
+  8002b0:	ff d0                	call   *%rax
+  8002b2:	85 c0                	test   %eax,%eax
+  8002b4:	75 2a                	jne    8002e0 <umain+0x29d>
+			cprintf("\npipe read closed properly\n");
+  8002b6:	48 b8 d5 e2 ff ff ff 	movabs $0xffffffffffffe2d5,%rax
+  8002bd:	ff ff ff 
+  8002c0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002c4:	48 89 c7             	mov    %rax,%rdi
+  8002c7:	49 89 df             	mov    %rbx,%r15
+  8002ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cf:	48 ba 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rdx
+  8002d6:	ff ff ff 
+  8002d9:	48 01 da             	add    %rbx,%rdx
+  8002dc:	ff d2                	call   *%rdx
+  8002de:	eb 31                	jmp    800311 <umain+0x2ce>
+		else
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+  8002e0:	48 8d 55 80          	lea    -0x80(%rbp),%rdx
+  8002e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002e7:	89 c6                	mov    %eax,%esi
+  8002e9:	48 b8 f1 e2 ff ff ff 	movabs $0xffffffffffffe2f1,%rax
+  8002f0:	ff ff ff 
+  8002f3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002f7:	48 89 c7             	mov    %rax,%rdi
+  8002fa:	49 89 df             	mov    %rbx,%r15
+  8002fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800302:	48 b9 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rcx
+  800309:	ff ff ff 
+  80030c:	48 01 d9             	add    %rbx,%rcx
+  80030f:	ff d1                	call   *%rcx
+		exit();
+  800311:	49 89 df             	mov    %rbx,%r15
+  800314:	48 b8 66 77 ff ff ff 	movabs $0xffffffffffff7766,%rax
+  80031b:	ff ff ff 
+  80031e:	48 01 d8             	add    %rbx,%rax
+  800321:	ff d0                	call   *%rax
+  800323:	e9 82 01 00 00       	jmp    8004aa <umain+0x467>
+	} else {
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  800328:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  80032e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800335:	ff ff ff 
+  800338:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80033c:	48 8b 00             	mov    (%rax),%rax
+  80033f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800345:	89 c6                	mov    %eax,%esi
+  800347:	48 b8 92 e2 ff ff ff 	movabs $0xffffffffffffe292,%rax
+  80034e:	ff ff ff 
+  800351:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800355:	48 89 c7             	mov    %rax,%rdi
+  800358:	49 89 df             	mov    %rbx,%r15
+  80035b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800360:	48 b9 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rcx
+  800367:	ff ff ff 
+  80036a:	48 01 d9             	add    %rbx,%rcx
+  80036d:	ff d1                	call   *%rcx
+		close(p[0]);
+  80036f:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  800375:	89 c7                	mov    %eax,%edi
+  800377:	49 89 df             	mov    %rbx,%r15
+  80037a:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  800381:	ff ff ff 
+  800384:	48 01 d8             	add    %rbx,%rax
+  800387:	ff d0                	call   *%rax
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  800389:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  80038f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800396:	ff ff ff 
+  800399:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80039d:	48 8b 00             	mov    (%rax),%rax
+  8003a0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8003a6:	89 c6                	mov    %eax,%esi
+  8003a8:	48 b8 04 e3 ff ff ff 	movabs $0xffffffffffffe304,%rax
+  8003af:	ff ff ff 
+  8003b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003b6:	48 89 c7             	mov    %rax,%rdi
+  8003b9:	49 89 df             	mov    %rbx,%r15
+  8003bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c1:	48 b9 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rcx
+  8003c8:	ff ff ff 
+  8003cb:	48 01 d9             	add    %rbx,%rcx
+  8003ce:	ff d1                	call   *%rcx
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  8003d0:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  8003d7:	00 00 00 
+  8003da:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8003de:	48 89 c7             	mov    %rax,%rdi
+  8003e1:	49 89 df             	mov    %rbx,%r15
+  8003e4:	48 b8 b5 87 ff ff ff 	movabs $0xffffffffffff87b5,%rax
+  8003eb:	ff ff ff 
+  8003ee:	48 01 d8             	add    %rbx,%rax
+  8003f1:	ff d0                	call   *%rax
+  8003f3:	48 63 d0             	movslq %eax,%rdx
+  8003f6:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  8003fd:	00 00 00 
+  800400:	48 8b 0c 03          	mov    (%rbx,%rax,1),%rcx
+  800404:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  80040a:	48 89 ce             	mov    %rcx,%rsi
+  80040d:	89 c7                	mov    %eax,%edi
+  80040f:	49 89 df             	mov    %rbx,%r15
+  800412:	48 b8 57 b0 ff ff ff 	movabs $0xffffffffffffb057,%rax
+  800419:	ff ff ff 
+  80041c:	48 01 d8             	add    %rbx,%rax
+  80041f:	ff d0                	call   *%rax
+  800421:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800424:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  80042b:	00 00 00 
+  80042e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800432:	48 89 c7             	mov    %rax,%rdi
+  800435:	49 89 df             	mov    %rbx,%r15
+  800438:	48 b8 b5 87 ff ff ff 	movabs $0xffffffffffff87b5,%rax
+  80043f:	ff ff ff 
+  800442:	48 01 d8             	add    %rbx,%rax
+  800445:	ff d0                	call   *%rax
+  800447:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80044a:	74 44                	je     800490 <umain+0x44d>
+			panic("write: %e", i);
+  80044c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80044f:	89 c1                	mov    %eax,%ecx
+  800451:	48 b8 21 e3 ff ff ff 	movabs $0xffffffffffffe321,%rax
+  800458:	ff ff ff 
+  80045b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80045f:	48 89 c2             	mov    %rax,%rdx
+  800462:	be 25 00 00 00       	mov    $0x25,%esi
+  800467:	48 b8 79 e2 ff ff ff 	movabs $0xffffffffffffe279,%rax
+  80046e:	ff ff ff 
+  800471:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800475:	48 89 c7             	mov    %rax,%rdi
+  800478:	49 89 df             	mov    %rbx,%r15
+  80047b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800480:	49 b8 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r8
+  800487:	ff ff ff 
+  80048a:	49 01 d8             	add    %rbx,%r8
+  80048d:	41 ff d0             	call   *%r8
+		close(p[1]);
+  800490:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  800496:	89 c7                	mov    %eax,%edi
+  800498:	49 89 df             	mov    %rbx,%r15
+  80049b:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  8004a2:	ff ff ff 
+  8004a5:	48 01 d8             	add    %rbx,%rax
+  8004a8:	ff d0                	call   *%rax
+	}
+	wait(pid);
+  8004aa:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8004ad:	89 c7                	mov    %eax,%edi
+  8004af:	49 89 df             	mov    %rbx,%r15
+  8004b2:	48 b8 68 d3 ff ff ff 	movabs $0xffffffffffffd368,%rax
+  8004b9:	ff ff ff 
+  8004bc:	48 01 d8             	add    %rbx,%rax
+  8004bf:	ff d0                	call   *%rax
+
+	binaryname = "pipewriteeof";
+  8004c1:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  8004c8:	ff ff ff 
+  8004cb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8004cf:	48 ba 2b e3 ff ff ff 	movabs $0xffffffffffffe32b,%rdx
+  8004d6:	ff ff ff 
+  8004d9:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8004dd:	48 89 10             	mov    %rdx,(%rax)
+	if ((i = pipe(p)) < 0)
+  8004e0:	48 8d 85 78 ff ff ff 	lea    -0x88(%rbp),%rax
+  8004e7:	48 89 c7             	mov    %rax,%rdi
+  8004ea:	49 89 df             	mov    %rbx,%r15
+  8004ed:	48 b8 f3 cb ff ff ff 	movabs $0xffffffffffffcbf3,%rax
+  8004f4:	ff ff ff 
+  8004f7:	48 01 d8             	add    %rbx,%rax
+  8004fa:	ff d0                	call   *%rax
+  8004fc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8004ff:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800503:	79 44                	jns    800549 <umain+0x506>
+		panic("pipe: %e", i);
+  800505:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800508:	89 c1                	mov    %eax,%ecx
+  80050a:	48 b8 70 e2 ff ff ff 	movabs $0xffffffffffffe270,%rax
+  800511:	ff ff ff 
+  800514:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800518:	48 89 c2             	mov    %rax,%rdx
+  80051b:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800520:	48 b8 79 e2 ff ff ff 	movabs $0xffffffffffffe279,%rax
+  800527:	ff ff ff 
+  80052a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80052e:	48 89 c7             	mov    %rax,%rdi
+  800531:	49 89 df             	mov    %rbx,%r15
+  800534:	b8 00 00 00 00       	mov    $0x0,%eax
+  800539:	49 b8 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r8
+  800540:	ff ff ff 
+  800543:	49 01 d8             	add    %rbx,%r8
+  800546:	41 ff d0             	call   *%r8
+
+	if ((pid = fork()) < 0)
+  800549:	49 89 df             	mov    %rbx,%r15
+  80054c:	48 b8 94 a4 ff ff ff 	movabs $0xffffffffffffa494,%rax
+  800553:	ff ff ff 
+  800556:	48 01 d8             	add    %rbx,%rax
+  800559:	ff d0                	call   *%rax
+  80055b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80055e:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800562:	79 44                	jns    8005a8 <umain+0x565>
+		panic("fork: %e", i);
+  800564:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800567:	89 c1                	mov    %eax,%ecx
+  800569:	48 b8 89 e2 ff ff ff 	movabs $0xffffffffffffe289,%rax
+  800570:	ff ff ff 
+  800573:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800577:	48 89 c2             	mov    %rax,%rdx
+  80057a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80057f:	48 b8 79 e2 ff ff ff 	movabs $0xffffffffffffe279,%rax
+  800586:	ff ff ff 
+  800589:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80058d:	48 89 c7             	mov    %rax,%rdi
+  800590:	49 89 df             	mov    %rbx,%r15
+  800593:	b8 00 00 00 00       	mov    $0x0,%eax
+  800598:	49 b8 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r8
+  80059f:	ff ff ff 
+  8005a2:	49 01 d8             	add    %rbx,%r8
+  8005a5:	41 ff d0             	call   *%r8
+
+	if (pid == 0) {
+  8005a8:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8005ac:	0f 85 b4 00 00 00    	jne    800666 <umain+0x623>
+		close(p[0]);
+  8005b2:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8005b8:	89 c7                	mov    %eax,%edi
+  8005ba:	49 89 df             	mov    %rbx,%r15
+  8005bd:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  8005c4:	ff ff ff 
+  8005c7:	48 01 d8             	add    %rbx,%rax
+  8005ca:	ff d0                	call   *%rax
+		while (1) {
+			cprintf(".");
+  8005cc:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  8005d3:	ff ff ff 
+  8005d6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005da:	48 89 c7             	mov    %rax,%rdi
+  8005dd:	49 89 df             	mov    %rbx,%r15
+  8005e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e5:	48 ba 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rdx
+  8005ec:	ff ff ff 
+  8005ef:	48 01 da             	add    %rbx,%rdx
+  8005f2:	ff d2                	call   *%rdx
+			if (write(p[1], "x", 1) != 1)
+  8005f4:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  8005fa:	ba 01 00 00 00       	mov    $0x1,%edx
+  8005ff:	48 b9 3a e3 ff ff ff 	movabs $0xffffffffffffe33a,%rcx
+  800606:	ff ff ff 
+  800609:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  80060d:	48 89 ce             	mov    %rcx,%rsi
+  800610:	89 c7                	mov    %eax,%edi
+  800612:	49 89 df             	mov    %rbx,%r15
+  800615:	48 b8 57 b0 ff ff ff 	movabs $0xffffffffffffb057,%rax
+  80061c:	ff ff ff 
+  80061f:	48 01 d8             	add    %rbx,%rax
+  800622:	ff d0                	call   *%rax
+  800624:	83 f8 01             	cmp    $0x1,%eax
+  800627:	75 02                	jne    80062b <umain+0x5e8>
+			cprintf(".");
+  800629:	eb a1                	jmp    8005cc <umain+0x589>
+				break;
+  80062b:	90                   	nop
+		}
+		cprintf("\npipe write closed properly\n");
+  80062c:	48 b8 3c e3 ff ff ff 	movabs $0xffffffffffffe33c,%rax
+  800633:	ff ff ff 
+  800636:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80063a:	48 89 c7             	mov    %rax,%rdi
+  80063d:	49 89 df             	mov    %rbx,%r15
+  800640:	b8 00 00 00 00       	mov    $0x0,%eax
+  800645:	48 ba 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rdx
+  80064c:	ff ff ff 
+  80064f:	48 01 da             	add    %rbx,%rdx
+  800652:	ff d2                	call   *%rdx
+		exit();
+  800654:	49 89 df             	mov    %rbx,%r15
+  800657:	48 b8 66 77 ff ff ff 	movabs $0xffffffffffff7766,%rax
+  80065e:	ff ff ff 
+  800661:	48 01 d8             	add    %rbx,%rax
+  800664:	ff d0                	call   *%rax
+	}
+	close(p[0]);
+  800666:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80066c:	89 c7                	mov    %eax,%edi
+  80066e:	49 89 df             	mov    %rbx,%r15
+  800671:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  800678:	ff ff ff 
+  80067b:	48 01 d8             	add    %rbx,%rax
+  80067e:	ff d0                	call   *%rax
+	close(p[1]);
+  800680:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  800686:	89 c7                	mov    %eax,%edi
+  800688:	49 89 df             	mov    %rbx,%r15
+  80068b:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  800692:	ff ff ff 
+  800695:	48 01 d8             	add    %rbx,%rax
+  800698:	ff d0                	call   *%rax
+	wait(pid);
+  80069a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80069d:	89 c7                	mov    %eax,%edi
+  80069f:	49 89 df             	mov    %rbx,%r15
+  8006a2:	48 b8 68 d3 ff ff ff 	movabs $0xffffffffffffd368,%rax
+  8006a9:	ff ff ff 
+  8006ac:	48 01 d8             	add    %rbx,%rax
+  8006af:	ff d0                	call   *%rax
+
+	cprintf("pipe tests passed\n");
+  8006b1:	48 b8 59 e3 ff ff ff 	movabs $0xffffffffffffe359,%rax
+  8006b8:	ff ff ff 
+  8006bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006bf:	48 89 c7             	mov    %rax,%rdi
+  8006c2:	49 89 df             	mov    %rbx,%r15
+  8006c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ca:	48 ba 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rdx
+  8006d1:	ff ff ff 
+  8006d4:	48 01 da             	add    %rbx,%rdx
+  8006d7:	ff d2                	call   *%rdx
+}
+  8006d9:	90                   	nop
+  8006da:	48 81 c4 90 00 00 00 	add    $0x90,%rsp
+  8006e1:	5b                   	pop    %rbx
+  8006e2:	41 5f                	pop    %r15
+  8006e4:	5d                   	pop    %rbp
+  8006e5:	c3                   	ret
+
+00000000008006e6 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8006e6:	55                   	push   %rbp
+  8006e7:	48 89 e5             	mov    %rsp,%rbp
+  8006ea:	41 57                	push   %r15
+  8006ec:	53                   	push   %rbx
+  8006ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8006f1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8006f1 <libmain+0xb>
+  8006f8:	49 bb 4f 89 00 00 00 	movabs $0x894f,%r11
+  8006ff:	00 00 00 
+  800702:	4c 01 db             	add    %r11,%rbx
+  800705:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800708:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  80070c:	49 89 df             	mov    %rbx,%r15
+  80070f:	48 b8 5c 94 ff ff ff 	movabs $0xffffffffffff945c,%rax
+  800716:	ff ff ff 
+  800719:	48 01 d8             	add    %rbx,%rax
+  80071c:	ff d0                	call   *%rax
+  80071e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800721:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800724:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800729:	48 98                	cltq
+  80072b:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800732:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800739:	ff ff ff 
+  80073c:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800740:	48 01 c2             	add    %rax,%rdx
+  800743:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  80074a:	00 00 00 
+  80074d:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800751:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800755:	7e 15                	jle    80076c <libmain+0x86>
+		binaryname = argv[0];
+  800757:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80075b:	48 8b 00             	mov    (%rax),%rax
+  80075e:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  800765:	00 00 00 
+  800768:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  80076c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800770:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800773:	48 89 d6             	mov    %rdx,%rsi
+  800776:	89 c7                	mov    %eax,%edi
+  800778:	49 89 df             	mov    %rbx,%r15
+  80077b:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  800782:	ff ff ff 
+  800785:	48 01 d8             	add    %rbx,%rax
+  800788:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80078a:	49 89 df             	mov    %rbx,%r15
+  80078d:	48 b8 66 77 ff ff ff 	movabs $0xffffffffffff7766,%rax
+  800794:	ff ff ff 
+  800797:	48 01 d8             	add    %rbx,%rax
+  80079a:	ff d0                	call   *%rax
+}
+  80079c:	90                   	nop
+  80079d:	48 83 c4 20          	add    $0x20,%rsp
+  8007a1:	5b                   	pop    %rbx
+  8007a2:	41 5f                	pop    %r15
+  8007a4:	5d                   	pop    %rbp
+  8007a5:	c3                   	ret
+
+00000000008007a6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8007a6:	55                   	push   %rbp
+  8007a7:	48 89 e5             	mov    %rsp,%rbp
+  8007aa:	41 57                	push   %r15
+  8007ac:	53                   	push   %rbx
+  8007ad:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8007ad <exit+0x7>
+  8007b4:	49 bb 93 88 00 00 00 	movabs $0x8893,%r11
+  8007bb:	00 00 00 
+  8007be:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  8007c1:	49 89 df             	mov    %rbx,%r15
+  8007c4:	48 b8 65 ac ff ff ff 	movabs $0xffffffffffffac65,%rax
+  8007cb:	ff ff ff 
+  8007ce:	48 01 d8             	add    %rbx,%rax
+  8007d1:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8007d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007d8:	49 89 df             	mov    %rbx,%r15
+  8007db:	48 b8 00 94 ff ff ff 	movabs $0xffffffffffff9400,%rax
+  8007e2:	ff ff ff 
+  8007e5:	48 01 d8             	add    %rbx,%rax
+  8007e8:	ff d0                	call   *%rax
+}
+  8007ea:	90                   	nop
+  8007eb:	5b                   	pop    %rbx
+  8007ec:	41 5f                	pop    %r15
+  8007ee:	5d                   	pop    %rbp
+  8007ef:	c3                   	ret
+
+00000000008007f0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8007f0:	55                   	push   %rbp
+  8007f1:	48 89 e5             	mov    %rsp,%rbp
+  8007f4:	41 57                	push   %r15
+  8007f6:	41 54                	push   %r12
+  8007f8:	53                   	push   %rbx
+  8007f9:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800800:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800800 <_panic+0x10>
+  800807:	49 bb 40 88 00 00 00 	movabs $0x8840,%r11
+  80080e:	00 00 00 
+  800811:	4c 01 db             	add    %r11,%rbx
+  800814:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80081b:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800821:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800828:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80082f:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800836:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80083d:	84 c0                	test   %al,%al
+  80083f:	74 26                	je     800867 <_panic+0x77>
+  800841:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800848:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80084f:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800853:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800857:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80085b:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80085f:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800863:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800867:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80086e:	00 00 00 
+  800871:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800878:	00 00 00 
+  80087b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80087f:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800886:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80088d:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800894:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  80089b:	ff ff ff 
+  80089e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8008a2:	4c 8b 20             	mov    (%rax),%r12
+  8008a5:	49 89 df             	mov    %rbx,%r15
+  8008a8:	48 b8 5c 94 ff ff ff 	movabs $0xffffffffffff945c,%rax
+  8008af:	ff ff ff 
+  8008b2:	48 01 d8             	add    %rbx,%rax
+  8008b5:	ff d0                	call   *%rax
+  8008b7:	89 c6                	mov    %eax,%esi
+  8008b9:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8008bf:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8008c6:	41 89 d0             	mov    %edx,%r8d
+  8008c9:	48 89 c1             	mov    %rax,%rcx
+  8008cc:	4c 89 e2             	mov    %r12,%rdx
+  8008cf:	48 b8 78 e3 ff ff ff 	movabs $0xffffffffffffe378,%rax
+  8008d6:	ff ff ff 
+  8008d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008dd:	48 89 c7             	mov    %rax,%rdi
+  8008e0:	49 89 df             	mov    %rbx,%r15
+  8008e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e8:	49 b9 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%r9
+  8008ef:	ff ff ff 
+  8008f2:	49 01 d9             	add    %rbx,%r9
+  8008f5:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8008f8:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8008ff:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800906:	48 89 d6             	mov    %rdx,%rsi
+  800909:	48 89 c7             	mov    %rax,%rdi
+  80090c:	49 89 df             	mov    %rbx,%r15
+  80090f:	48 b8 a7 79 ff ff ff 	movabs $0xffffffffffff79a7,%rax
+  800916:	ff ff ff 
+  800919:	48 01 d8             	add    %rbx,%rax
+  80091c:	ff d0                	call   *%rax
+	cprintf("\n");
+  80091e:	48 b8 9b e3 ff ff ff 	movabs $0xffffffffffffe39b,%rax
+  800925:	ff ff ff 
+  800928:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80092c:	48 89 c7             	mov    %rax,%rdi
+  80092f:	49 89 df             	mov    %rbx,%r15
+  800932:	b8 00 00 00 00       	mov    $0x0,%eax
+  800937:	48 ba 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rdx
+  80093e:	ff ff ff 
+  800941:	48 01 da             	add    %rbx,%rdx
+  800944:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800946:	cc                   	int3
+  800947:	eb fd                	jmp    800946 <_panic+0x156>
+
+0000000000800949 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800949:	55                   	push   %rbp
+  80094a:	48 89 e5             	mov    %rsp,%rbp
+  80094d:	41 57                	push   %r15
+  80094f:	48 83 ec 18          	sub    $0x18,%rsp
+  800953:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800953 <putch+0xa>
+  80095a:	49 bb ed 86 00 00 00 	movabs $0x86ed,%r11
+  800961:	00 00 00 
+  800964:	4c 01 d8             	add    %r11,%rax
+  800967:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80096a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80096e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800972:	8b 12                	mov    (%rdx),%edx
+  800974:	8d 72 01             	lea    0x1(%rdx),%esi
+  800977:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80097b:	89 31                	mov    %esi,(%rcx)
+  80097d:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800980:	89 ce                	mov    %ecx,%esi
+  800982:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800986:	48 63 d2             	movslq %edx,%rdx
+  800989:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80098e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800992:	8b 12                	mov    (%rdx),%edx
+  800994:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80099a:	75 33                	jne    8009cf <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80099c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8009a0:	8b 12                	mov    (%rdx),%edx
+  8009a2:	48 63 d2             	movslq %edx,%rdx
+  8009a5:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8009a9:	48 83 c1 08          	add    $0x8,%rcx
+  8009ad:	48 89 d6             	mov    %rdx,%rsi
+  8009b0:	48 89 cf             	mov    %rcx,%rdi
+  8009b3:	49 89 c7             	mov    %rax,%r15
+  8009b6:	48 ba 4d 93 ff ff ff 	movabs $0xffffffffffff934d,%rdx
+  8009bd:	ff ff ff 
+  8009c0:	48 01 c2             	add    %rax,%rdx
+  8009c3:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8009c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8009c9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8009cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8009d3:	8b 40 04             	mov    0x4(%rax),%eax
+  8009d6:	8d 50 01             	lea    0x1(%rax),%edx
+  8009d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8009dd:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8009e0:	90                   	nop
+  8009e1:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8009e5:	c9                   	leave
+  8009e6:	c3                   	ret
+
+00000000008009e7 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8009e7:	55                   	push   %rbp
+  8009e8:	48 89 e5             	mov    %rsp,%rbp
+  8009eb:	41 57                	push   %r15
+  8009ed:	53                   	push   %rbx
+  8009ee:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8009f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8009f5 <vcprintf+0xe>
+  8009fc:	49 bb 4b 86 00 00 00 	movabs $0x864b,%r11
+  800a03:	00 00 00 
+  800a06:	4c 01 db             	add    %r11,%rbx
+  800a09:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800a10:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800a17:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800a1e:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800a25:	48 8b 06             	mov    (%rsi),%rax
+  800a28:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800a2c:	48 89 01             	mov    %rax,(%rcx)
+  800a2f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800a33:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800a37:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800a3b:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800a42:	00 00 00 
+    b.cnt = 0;
+  800a45:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800a4c:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800a4f:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800a56:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800a5d:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800a64:	48 89 c6             	mov    %rax,%rsi
+  800a67:	48 b8 09 79 ff ff ff 	movabs $0xffffffffffff7909,%rax
+  800a6e:	ff ff ff 
+  800a71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a75:	48 89 c7             	mov    %rax,%rdi
+  800a78:	49 89 df             	mov    %rbx,%r15
+  800a7b:	48 b8 cb 7e ff ff ff 	movabs $0xffffffffffff7ecb,%rax
+  800a82:	ff ff ff 
+  800a85:	48 01 d8             	add    %rbx,%rax
+  800a88:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800a8a:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800a90:	48 98                	cltq
+  800a92:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800a99:	48 83 c2 08          	add    $0x8,%rdx
+  800a9d:	48 89 c6             	mov    %rax,%rsi
+  800aa0:	48 89 d7             	mov    %rdx,%rdi
+  800aa3:	49 89 df             	mov    %rbx,%r15
+  800aa6:	48 b8 4d 93 ff ff ff 	movabs $0xffffffffffff934d,%rax
+  800aad:	ff ff ff 
+  800ab0:	48 01 d8             	add    %rbx,%rax
+  800ab3:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800ab5:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800abb:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800ac2:	5b                   	pop    %rbx
+  800ac3:	41 5f                	pop    %r15
+  800ac5:	5d                   	pop    %rbp
+  800ac6:	c3                   	ret
+
+0000000000800ac7 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800ac7:	55                   	push   %rbp
+  800ac8:	48 89 e5             	mov    %rsp,%rbp
+  800acb:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800ad2:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800ad2 <cprintf+0xb>
+  800ad9:	49 bb 6e 85 00 00 00 	movabs $0x856e,%r11
+  800ae0:	00 00 00 
+  800ae3:	4d 01 da             	add    %r11,%r10
+  800ae6:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800aed:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800af4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800afb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b02:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800b09:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800b10:	84 c0                	test   %al,%al
+  800b12:	74 20                	je     800b34 <cprintf+0x6d>
+  800b14:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800b18:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800b1c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800b20:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800b24:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800b28:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800b2c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800b30:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800b34:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800b3b:	00 00 00 
+  800b3e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800b45:	00 00 00 
+  800b48:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b4c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800b53:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800b5a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800b61:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800b68:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800b6f:	48 8b 06             	mov    (%rsi),%rax
+  800b72:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800b76:	48 89 01             	mov    %rax,(%rcx)
+  800b79:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800b7d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800b81:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800b85:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800b8c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800b93:	48 89 d6             	mov    %rdx,%rsi
+  800b96:	48 89 c7             	mov    %rax,%rdi
+  800b99:	48 b8 a7 79 ff ff ff 	movabs $0xffffffffffff79a7,%rax
+  800ba0:	ff ff ff 
+  800ba3:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800ba7:	ff d0                	call   *%rax
+  800ba9:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800baf:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800bb5:	c9                   	leave
+  800bb6:	c3                   	ret
+
+0000000000800bb7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800bb7:	55                   	push   %rbp
+  800bb8:	48 89 e5             	mov    %rsp,%rbp
+  800bbb:	53                   	push   %rbx
+  800bbc:	48 83 ec 38          	sub    $0x38,%rsp
+  800bc0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800bc0 <printnum+0x9>
+  800bc7:	49 bb 80 84 00 00 00 	movabs $0x8480,%r11
+  800bce:	00 00 00 
+  800bd1:	4c 01 db             	add    %r11,%rbx
+  800bd4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bd8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800bdc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800be0:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800be3:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800be7:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800beb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800bee:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800bf2:	72 58                	jb     800c4c <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800bf4:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800bf7:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800bfa:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800bfd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c06:	48 f7 f6             	div    %rsi
+  800c09:	49 89 c2             	mov    %rax,%r10
+  800c0c:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800c0f:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800c12:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800c16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c1a:	41 89 c9             	mov    %ecx,%r9d
+  800c1d:	41 89 f8             	mov    %edi,%r8d
+  800c20:	89 d1                	mov    %edx,%ecx
+  800c22:	4c 89 d2             	mov    %r10,%rdx
+  800c25:	48 89 c7             	mov    %rax,%rdi
+  800c28:	48 b8 77 7b ff ff ff 	movabs $0xffffffffffff7b77,%rax
+  800c2f:	ff ff ff 
+  800c32:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c36:	ff d0                	call   *%rax
+  800c38:	eb 1c                	jmp    800c56 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800c3a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800c3e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800c41:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800c45:	48 89 d6             	mov    %rdx,%rsi
+  800c48:	89 c7                	mov    %eax,%edi
+  800c4a:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800c4c:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800c50:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800c54:	7f e4                	jg     800c3a <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800c56:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800c59:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c62:	48 f7 f1             	div    %rcx
+  800c65:	48 b8 d7 e4 ff ff ff 	movabs $0xffffffffffffe4d7,%rax
+  800c6c:	ff ff ff 
+  800c6f:	48 01 d8             	add    %rbx,%rax
+  800c72:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800c76:	0f be c0             	movsbl %al,%eax
+  800c79:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800c7d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800c81:	48 89 d6             	mov    %rdx,%rsi
+  800c84:	89 c7                	mov    %eax,%edi
+  800c86:	ff d1                	call   *%rcx
+}
+  800c88:	90                   	nop
+  800c89:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c8d:	c9                   	leave
+  800c8e:	c3                   	ret
+
+0000000000800c8f <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800c8f:	55                   	push   %rbp
+  800c90:	48 89 e5             	mov    %rsp,%rbp
+  800c93:	48 83 ec 20          	sub    $0x20,%rsp
+  800c97:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c97 <getuint+0x8>
+  800c9e:	49 bb a9 83 00 00 00 	movabs $0x83a9,%r11
+  800ca5:	00 00 00 
+  800ca8:	4c 01 d8             	add    %r11,%rax
+  800cab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800caf:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800cb2:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800cb6:	7e 4f                	jle    800d07 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800cb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cbc:	8b 00                	mov    (%rax),%eax
+  800cbe:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc1:	77 24                	ja     800ce7 <getuint+0x58>
+  800cc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cc7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ccb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ccf:	8b 00                	mov    (%rax),%eax
+  800cd1:	89 c0                	mov    %eax,%eax
+  800cd3:	48 01 d0             	add    %rdx,%rax
+  800cd6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cda:	8b 12                	mov    (%rdx),%edx
+  800cdc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800cdf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ce3:	89 0a                	mov    %ecx,(%rdx)
+  800ce5:	eb 14                	jmp    800cfb <getuint+0x6c>
+  800ce7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ceb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800cef:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800cf3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cf7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800cfb:	48 8b 00             	mov    (%rax),%rax
+  800cfe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800d02:	e9 9d 00 00 00       	jmp    800da4 <getuint+0x115>
+	else if (lflag)
+  800d07:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800d0b:	74 4c                	je     800d59 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800d0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d11:	8b 00                	mov    (%rax),%eax
+  800d13:	83 f8 2f             	cmp    $0x2f,%eax
+  800d16:	77 24                	ja     800d3c <getuint+0xad>
+  800d18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d1c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800d20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d24:	8b 00                	mov    (%rax),%eax
+  800d26:	89 c0                	mov    %eax,%eax
+  800d28:	48 01 d0             	add    %rdx,%rax
+  800d2b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d2f:	8b 12                	mov    (%rdx),%edx
+  800d31:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800d34:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d38:	89 0a                	mov    %ecx,(%rdx)
+  800d3a:	eb 14                	jmp    800d50 <getuint+0xc1>
+  800d3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d40:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d44:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d48:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d4c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d50:	48 8b 00             	mov    (%rax),%rax
+  800d53:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800d57:	eb 4b                	jmp    800da4 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800d59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d5d:	8b 00                	mov    (%rax),%eax
+  800d5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d62:	77 24                	ja     800d88 <getuint+0xf9>
+  800d64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d68:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800d6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d70:	8b 00                	mov    (%rax),%eax
+  800d72:	89 c0                	mov    %eax,%eax
+  800d74:	48 01 d0             	add    %rdx,%rax
+  800d77:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d7b:	8b 12                	mov    (%rdx),%edx
+  800d7d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800d80:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d84:	89 0a                	mov    %ecx,(%rdx)
+  800d86:	eb 14                	jmp    800d9c <getuint+0x10d>
+  800d88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d8c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d90:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d94:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d98:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d9c:	8b 00                	mov    (%rax),%eax
+  800d9e:	89 c0                	mov    %eax,%eax
+  800da0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800da4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800da8:	c9                   	leave
+  800da9:	c3                   	ret
+
+0000000000800daa <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800daa:	55                   	push   %rbp
+  800dab:	48 89 e5             	mov    %rsp,%rbp
+  800dae:	48 83 ec 20          	sub    $0x20,%rsp
+  800db2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800db2 <printfloat+0x8>
+  800db9:	49 bb 8e 82 00 00 00 	movabs $0x828e,%r11
+  800dc0:	00 00 00 
+  800dc3:	4c 01 d8             	add    %r11,%rax
+  800dc6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800dca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800dce:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800dd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dd6:	48 85 c0             	test   %rax,%rax
+  800dd9:	79 12                	jns    800ded <printfloat+0x43>
+		putch('-',putdat);
+  800ddb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ddf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800de3:	48 89 c6             	mov    %rax,%rsi
+  800de6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800deb:	ff d2                	call   *%rdx
+	
+}
+  800ded:	90                   	nop
+  800dee:	c9                   	leave
+  800def:	c3                   	ret
+
+0000000000800df0 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800df0:	55                   	push   %rbp
+  800df1:	48 89 e5             	mov    %rsp,%rbp
+  800df4:	48 83 ec 20          	sub    $0x20,%rsp
+  800df8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800df8 <getint+0x8>
+  800dff:	49 bb 48 82 00 00 00 	movabs $0x8248,%r11
+  800e06:	00 00 00 
+  800e09:	4c 01 d8             	add    %r11,%rax
+  800e0c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e10:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800e13:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800e17:	7e 4f                	jle    800e68 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800e19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e1d:	8b 00                	mov    (%rax),%eax
+  800e1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e22:	77 24                	ja     800e48 <getint+0x58>
+  800e24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e28:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800e2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e30:	8b 00                	mov    (%rax),%eax
+  800e32:	89 c0                	mov    %eax,%eax
+  800e34:	48 01 d0             	add    %rdx,%rax
+  800e37:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e3b:	8b 12                	mov    (%rdx),%edx
+  800e3d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800e40:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e44:	89 0a                	mov    %ecx,(%rdx)
+  800e46:	eb 14                	jmp    800e5c <getint+0x6c>
+  800e48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e4c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e50:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800e54:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e58:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800e5c:	48 8b 00             	mov    (%rax),%rax
+  800e5f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800e63:	e9 9d 00 00 00       	jmp    800f05 <getint+0x115>
+	else if (lflag)
+  800e68:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800e6c:	74 4c                	je     800eba <getint+0xca>
+		x=va_arg(*ap, long);
+  800e6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e72:	8b 00                	mov    (%rax),%eax
+  800e74:	83 f8 2f             	cmp    $0x2f,%eax
+  800e77:	77 24                	ja     800e9d <getint+0xad>
+  800e79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e7d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800e81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e85:	8b 00                	mov    (%rax),%eax
+  800e87:	89 c0                	mov    %eax,%eax
+  800e89:	48 01 d0             	add    %rdx,%rax
+  800e8c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e90:	8b 12                	mov    (%rdx),%edx
+  800e92:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800e95:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e99:	89 0a                	mov    %ecx,(%rdx)
+  800e9b:	eb 14                	jmp    800eb1 <getint+0xc1>
+  800e9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ea1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ea5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ea9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ead:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800eb1:	48 8b 00             	mov    (%rax),%rax
+  800eb4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800eb8:	eb 4b                	jmp    800f05 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800eba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ebe:	8b 00                	mov    (%rax),%eax
+  800ec0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ec3:	77 24                	ja     800ee9 <getint+0xf9>
+  800ec5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ec9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ecd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ed1:	8b 00                	mov    (%rax),%eax
+  800ed3:	89 c0                	mov    %eax,%eax
+  800ed5:	48 01 d0             	add    %rdx,%rax
+  800ed8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800edc:	8b 12                	mov    (%rdx),%edx
+  800ede:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ee1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ee5:	89 0a                	mov    %ecx,(%rdx)
+  800ee7:	eb 14                	jmp    800efd <getint+0x10d>
+  800ee9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800eed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ef1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ef5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ef9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800efd:	8b 00                	mov    (%rax),%eax
+  800eff:	48 98                	cltq
+  800f01:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800f05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800f09:	c9                   	leave
+  800f0a:	c3                   	ret
+
+0000000000800f0b <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800f0b:	55                   	push   %rbp
+  800f0c:	48 89 e5             	mov    %rsp,%rbp
+  800f0f:	41 57                	push   %r15
+  800f11:	41 55                	push   %r13
+  800f13:	41 54                	push   %r12
+  800f15:	53                   	push   %rbx
+  800f16:	48 83 ec 60          	sub    $0x60,%rsp
+  800f1a:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800f1a <vprintfmt+0xf>
+  800f21:	49 bb 26 81 00 00 00 	movabs $0x8126,%r11
+  800f28:	00 00 00 
+  800f2b:	4d 01 dc             	add    %r11,%r12
+  800f2e:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800f32:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800f36:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800f3a:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800f3e:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800f45:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800f49:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800f4d:	48 8b 06             	mov    (%rsi),%rax
+  800f50:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800f54:	48 89 01             	mov    %rax,(%rcx)
+  800f57:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800f5b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800f5f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800f63:	eb 17                	jmp    800f7c <vprintfmt+0x71>
+			if (ch == '\0')
+  800f65:	85 db                	test   %ebx,%ebx
+  800f67:	0f 84 97 05 00 00    	je     801504 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800f6d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f71:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f75:	48 89 c6             	mov    %rax,%rsi
+  800f78:	89 df                	mov    %ebx,%edi
+  800f7a:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800f7c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f80:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f84:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800f88:	0f b6 00             	movzbl (%rax),%eax
+  800f8b:	0f b6 d8             	movzbl %al,%ebx
+  800f8e:	83 fb 25             	cmp    $0x25,%ebx
+  800f91:	75 d2                	jne    800f65 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800f93:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800f97:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800f9e:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800fa5:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800fac:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800fb3:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800fb7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800fbb:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800fbf:	0f b6 00             	movzbl (%rax),%eax
+  800fc2:	0f b6 d8             	movzbl %al,%ebx
+  800fc5:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800fc8:	83 f8 55             	cmp    $0x55,%eax
+  800fcb:	0f 87 00 05 00 00    	ja     8014d1 <vprintfmt+0x5c6>
+  800fd1:	89 c0                	mov    %eax,%eax
+  800fd3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800fda:	00 
+  800fdb:	48 8d 05 5e 65 00 00 	lea    0x655e(%rip),%rax        # 807540 <.LC18+0xc>
+  800fe2:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800fe6:	48 8d 15 53 65 00 00 	lea    0x6553(%rip),%rdx        # 807540 <.LC18+0xc>
+  800fed:	48 01 d0             	add    %rdx,%rax
+  800ff0:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800ff2:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800ff6:	eb bb                	jmp    800fb3 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800ff8:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800ffc:	eb b5                	jmp    800fb3 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800ffe:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  801005:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  801008:	89 d0                	mov    %edx,%eax
+  80100a:	c1 e0 02             	shl    $0x2,%eax
+  80100d:	01 d0                	add    %edx,%eax
+  80100f:	01 c0                	add    %eax,%eax
+  801011:	01 d8                	add    %ebx,%eax
+  801013:	83 e8 30             	sub    $0x30,%eax
+  801016:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  801019:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80101d:	0f b6 00             	movzbl (%rax),%eax
+  801020:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  801023:	83 fb 2f             	cmp    $0x2f,%ebx
+  801026:	7e 60                	jle    801088 <vprintfmt+0x17d>
+  801028:	83 fb 39             	cmp    $0x39,%ebx
+  80102b:	7f 5b                	jg     801088 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  80102d:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  801032:	eb d1                	jmp    801005 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  801034:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801037:	83 f8 2f             	cmp    $0x2f,%eax
+  80103a:	77 17                	ja     801053 <vprintfmt+0x148>
+  80103c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801040:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801043:	89 d2                	mov    %edx,%edx
+  801045:	48 01 d0             	add    %rdx,%rax
+  801048:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80104b:	83 c2 08             	add    $0x8,%edx
+  80104e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801051:	eb 0c                	jmp    80105f <vprintfmt+0x154>
+  801053:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801057:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80105b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80105f:	8b 00                	mov    (%rax),%eax
+  801061:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  801064:	eb 23                	jmp    801089 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  801066:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80106a:	0f 89 43 ff ff ff    	jns    800fb3 <vprintfmt+0xa8>
+				width = 0;
+  801070:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  801077:	e9 37 ff ff ff       	jmp    800fb3 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  80107c:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  801083:	e9 2b ff ff ff       	jmp    800fb3 <vprintfmt+0xa8>
+			goto process_precision;
+  801088:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  801089:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80108d:	0f 89 20 ff ff ff    	jns    800fb3 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  801093:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801096:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  801099:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  8010a0:	e9 0e ff ff ff       	jmp    800fb3 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8010a5:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  8010a9:	e9 05 ff ff ff       	jmp    800fb3 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  8010ae:	83 fb 39             	cmp    $0x39,%ebx
+  8010b1:	7f 0b                	jg     8010be <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  8010b3:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  8010b6:	c1 e0 08             	shl    $0x8,%eax
+  8010b9:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8010bc:	eb 21                	jmp    8010df <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  8010be:	83 fb 60             	cmp    $0x60,%ebx
+  8010c1:	7e 10                	jle    8010d3 <vprintfmt+0x1c8>
+  8010c3:	83 fb 66             	cmp    $0x66,%ebx
+  8010c6:	7f 0b                	jg     8010d3 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  8010c8:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  8010cb:	c1 e0 08             	shl    $0x8,%eax
+  8010ce:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8010d1:	eb 0c                	jmp    8010df <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  8010d3:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  8010da:	e9 04 01 00 00       	jmp    8011e3 <vprintfmt+0x2d8>
+  8010df:	e9 ff 00 00 00       	jmp    8011e3 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8010e4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8010e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8010ea:	77 17                	ja     801103 <vprintfmt+0x1f8>
+  8010ec:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8010f0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8010f3:	89 d2                	mov    %edx,%edx
+  8010f5:	48 01 d0             	add    %rdx,%rax
+  8010f8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8010fb:	83 c2 08             	add    $0x8,%edx
+  8010fe:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801101:	eb 0c                	jmp    80110f <vprintfmt+0x204>
+  801103:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801107:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80110b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80110f:	8b 00                	mov    (%rax),%eax
+  801111:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  801115:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801119:	48 89 d6             	mov    %rdx,%rsi
+  80111c:	89 c7                	mov    %eax,%edi
+  80111e:	ff d1                	call   *%rcx
+			break;
+  801120:	e9 da 03 00 00       	jmp    8014ff <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  801125:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801128:	83 f8 2f             	cmp    $0x2f,%eax
+  80112b:	77 17                	ja     801144 <vprintfmt+0x239>
+  80112d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801131:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801134:	89 d2                	mov    %edx,%edx
+  801136:	48 01 d0             	add    %rdx,%rax
+  801139:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80113c:	83 c2 08             	add    $0x8,%edx
+  80113f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801142:	eb 0c                	jmp    801150 <vprintfmt+0x245>
+  801144:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801148:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80114c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801150:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  801152:	85 db                	test   %ebx,%ebx
+  801154:	79 02                	jns    801158 <vprintfmt+0x24d>
+				err = -err;
+  801156:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801158:	83 fb 15             	cmp    $0x15,%ebx
+  80115b:	7f 19                	jg     801176 <vprintfmt+0x26b>
+  80115d:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  801164:	00 00 00 
+  801167:	48 63 c3             	movslq %ebx,%rax
+  80116a:	4c 01 e2             	add    %r12,%rdx
+  80116d:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  801171:	4d 85 ed             	test   %r13,%r13
+  801174:	75 36                	jne    8011ac <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  801176:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80117a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80117e:	89 d9                	mov    %ebx,%ecx
+  801180:	48 ba e8 e4 ff ff ff 	movabs $0xffffffffffffe4e8,%rdx
+  801187:	ff ff ff 
+  80118a:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  80118e:	48 89 c7             	mov    %rax,%rdi
+  801191:	b8 00 00 00 00       	mov    $0x0,%eax
+  801196:	49 b8 d2 84 ff ff ff 	movabs $0xffffffffffff84d2,%r8
+  80119d:	ff ff ff 
+  8011a0:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  8011a4:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  8011a7:	e9 53 03 00 00       	jmp    8014ff <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  8011ac:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8011b0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8011b4:	4c 89 e9             	mov    %r13,%rcx
+  8011b7:	48 ba f1 e4 ff ff ff 	movabs $0xffffffffffffe4f1,%rdx
+  8011be:	ff ff ff 
+  8011c1:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  8011c5:	48 89 c7             	mov    %rax,%rdi
+  8011c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011cd:	49 b8 d2 84 ff ff ff 	movabs $0xffffffffffff84d2,%r8
+  8011d4:	ff ff ff 
+  8011d7:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  8011db:	41 ff d0             	call   *%r8
+			break;
+  8011de:	e9 1c 03 00 00       	jmp    8014ff <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  8011e3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8011e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8011e9:	77 17                	ja     801202 <vprintfmt+0x2f7>
+  8011eb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011ef:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8011f2:	89 d2                	mov    %edx,%edx
+  8011f4:	48 01 d0             	add    %rdx,%rax
+  8011f7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8011fa:	83 c2 08             	add    $0x8,%edx
+  8011fd:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801200:	eb 0c                	jmp    80120e <vprintfmt+0x303>
+  801202:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801206:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80120a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80120e:	4c 8b 28             	mov    (%rax),%r13
+  801211:	4d 85 ed             	test   %r13,%r13
+  801214:	75 0e                	jne    801224 <vprintfmt+0x319>
+				p = "(null)";
+  801216:	48 b8 f4 e4 ff ff ff 	movabs $0xffffffffffffe4f4,%rax
+  80121d:	ff ff ff 
+  801220:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  801224:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801228:	0f 8e 84 00 00 00    	jle    8012b2 <vprintfmt+0x3a7>
+  80122e:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  801232:	74 7e                	je     8012b2 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801234:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801237:	48 98                	cltq
+  801239:	48 89 c6             	mov    %rax,%rsi
+  80123c:	4c 89 ef             	mov    %r13,%rdi
+  80123f:	4d 89 e7             	mov    %r12,%r15
+  801242:	48 b8 f7 87 ff ff ff 	movabs $0xffffffffffff87f7,%rax
+  801249:	ff ff ff 
+  80124c:	4c 01 e0             	add    %r12,%rax
+  80124f:	ff d0                	call   *%rax
+  801251:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  801254:	eb 17                	jmp    80126d <vprintfmt+0x362>
+					putch(padc, putdat);
+  801256:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  80125a:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80125e:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801262:	48 89 d6             	mov    %rdx,%rsi
+  801265:	89 c7                	mov    %eax,%edi
+  801267:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801269:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80126d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801271:	7f e3                	jg     801256 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801273:	eb 3d                	jmp    8012b2 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801275:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  801279:	74 1e                	je     801299 <vprintfmt+0x38e>
+  80127b:	83 fb 1f             	cmp    $0x1f,%ebx
+  80127e:	7e 05                	jle    801285 <vprintfmt+0x37a>
+  801280:	83 fb 7e             	cmp    $0x7e,%ebx
+  801283:	7e 14                	jle    801299 <vprintfmt+0x38e>
+					putch('?', putdat);
+  801285:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801289:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80128d:	48 89 c6             	mov    %rax,%rsi
+  801290:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801295:	ff d2                	call   *%rdx
+  801297:	eb 15                	jmp    8012ae <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  801299:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80129c:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  80129f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8012a3:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8012a7:	48 89 c6             	mov    %rax,%rsi
+  8012aa:	89 cf                	mov    %ecx,%edi
+  8012ac:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8012ae:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8012b2:	4c 89 e8             	mov    %r13,%rax
+  8012b5:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  8012b9:	0f b6 00             	movzbl (%rax),%eax
+  8012bc:	0f be d8             	movsbl %al,%ebx
+  8012bf:	85 db                	test   %ebx,%ebx
+  8012c1:	74 28                	je     8012eb <vprintfmt+0x3e0>
+  8012c3:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8012c7:	78 ac                	js     801275 <vprintfmt+0x36a>
+  8012c9:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  8012cd:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8012d1:	79 a2                	jns    801275 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  8012d3:	eb 16                	jmp    8012eb <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  8012d5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8012d9:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8012dd:	48 89 c6             	mov    %rax,%rsi
+  8012e0:	bf 20 00 00 00       	mov    $0x20,%edi
+  8012e5:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  8012e7:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8012eb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8012ef:	7f e4                	jg     8012d5 <vprintfmt+0x3ca>
+			break;
+  8012f1:	e9 09 02 00 00       	jmp    8014ff <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  8012f6:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8012fa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8012fe:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801302:	0f b6 00             	movzbl (%rax),%eax
+  801305:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  801308:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  801309:	83 fb 2f             	cmp    $0x2f,%ebx
+  80130c:	0f 8e ac fd ff ff    	jle    8010be <vprintfmt+0x1b3>
+  801312:	e9 97 fd ff ff       	jmp    8010ae <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  801317:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80131b:	be 03 00 00 00       	mov    $0x3,%esi
+  801320:	48 89 c7             	mov    %rax,%rdi
+  801323:	48 b8 b0 7d ff ff ff 	movabs $0xffffffffffff7db0,%rax
+  80132a:	ff ff ff 
+  80132d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801331:	ff d0                	call   *%rax
+  801333:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  801337:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80133b:	48 85 c0             	test   %rax,%rax
+  80133e:	79 1d                	jns    80135d <vprintfmt+0x452>
+				putch('-', putdat);
+  801340:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801344:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801348:	48 89 c6             	mov    %rax,%rsi
+  80134b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801350:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  801352:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801356:	48 f7 d8             	neg    %rax
+  801359:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  80135d:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801364:	e9 de 00 00 00       	jmp    801447 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  801369:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80136d:	be 03 00 00 00       	mov    $0x3,%esi
+  801372:	48 89 c7             	mov    %rax,%rdi
+  801375:	48 b8 4f 7c ff ff ff 	movabs $0xffffffffffff7c4f,%rax
+  80137c:	ff ff ff 
+  80137f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801383:	ff d0                	call   *%rax
+  801385:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801389:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801390:	e9 b2 00 00 00       	jmp    801447 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  801395:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801399:	be 03 00 00 00       	mov    $0x3,%esi
+  80139e:	48 89 c7             	mov    %rax,%rdi
+  8013a1:	48 b8 4f 7c ff ff ff 	movabs $0xffffffffffff7c4f,%rax
+  8013a8:	ff ff ff 
+  8013ab:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013af:	ff d0                	call   *%rax
+  8013b1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  8013b5:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  8013bc:	e9 86 00 00 00       	jmp    801447 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  8013c1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8013c5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8013c9:	48 89 c6             	mov    %rax,%rsi
+  8013cc:	bf 30 00 00 00       	mov    $0x30,%edi
+  8013d1:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  8013d3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8013d7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8013db:	48 89 c6             	mov    %rax,%rsi
+  8013de:	bf 78 00 00 00       	mov    $0x78,%edi
+  8013e3:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  8013e5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8013e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8013eb:	77 17                	ja     801404 <vprintfmt+0x4f9>
+  8013ed:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8013f1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8013f4:	89 d2                	mov    %edx,%edx
+  8013f6:	48 01 d0             	add    %rdx,%rax
+  8013f9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8013fc:	83 c2 08             	add    $0x8,%edx
+  8013ff:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801402:	eb 0c                	jmp    801410 <vprintfmt+0x505>
+  801404:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801408:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80140c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801410:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801413:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801417:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  80141e:	eb 27                	jmp    801447 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801420:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801424:	be 03 00 00 00       	mov    $0x3,%esi
+  801429:	48 89 c7             	mov    %rax,%rdi
+  80142c:	48 b8 4f 7c ff ff ff 	movabs $0xffffffffffff7c4f,%rax
+  801433:	ff ff ff 
+  801436:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80143a:	ff d0                	call   *%rax
+  80143c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801440:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801447:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  80144c:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80144f:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801452:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801456:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80145a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80145e:	45 89 c1             	mov    %r8d,%r9d
+  801461:	41 89 f8             	mov    %edi,%r8d
+  801464:	48 89 c7             	mov    %rax,%rdi
+  801467:	48 b8 77 7b ff ff ff 	movabs $0xffffffffffff7b77,%rax
+  80146e:	ff ff ff 
+  801471:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801475:	ff d0                	call   *%rax
+			break;
+  801477:	e9 83 00 00 00       	jmp    8014ff <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  80147c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801480:	be 03 00 00 00       	mov    $0x3,%esi
+  801485:	48 89 c7             	mov    %rax,%rdi
+  801488:	48 b8 4f 7c ff ff ff 	movabs $0xffffffffffff7c4f,%rax
+  80148f:	ff ff ff 
+  801492:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801496:	ff d0                	call   *%rax
+  801498:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  80149c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8014a0:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8014a4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8014a8:	48 89 ce             	mov    %rcx,%rsi
+  8014ab:	48 89 c7             	mov    %rax,%rdi
+  8014ae:	48 b8 6a 7d ff ff ff 	movabs $0xffffffffffff7d6a,%rax
+  8014b5:	ff ff ff 
+  8014b8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8014bc:	ff d0                	call   *%rax
+	
+			break;
+  8014be:	eb 3f                	jmp    8014ff <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  8014c0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8014c4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8014c8:	48 89 c6             	mov    %rax,%rsi
+  8014cb:	89 df                	mov    %ebx,%edi
+  8014cd:	ff d2                	call   *%rdx
+			break;
+  8014cf:	eb 2e                	jmp    8014ff <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  8014d1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8014d5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8014d9:	48 89 c6             	mov    %rax,%rsi
+  8014dc:	bf 25 00 00 00       	mov    $0x25,%edi
+  8014e1:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8014e3:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8014e8:	eb 05                	jmp    8014ef <vprintfmt+0x5e4>
+  8014ea:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8014ef:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8014f3:	48 83 e8 01          	sub    $0x1,%rax
+  8014f7:	0f b6 00             	movzbl (%rax),%eax
+  8014fa:	3c 25                	cmp    $0x25,%al
+  8014fc:	75 ec                	jne    8014ea <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  8014fe:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8014ff:	e9 78 fa ff ff       	jmp    800f7c <vprintfmt+0x71>
+				return;
+  801504:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801505:	48 83 c4 60          	add    $0x60,%rsp
+  801509:	5b                   	pop    %rbx
+  80150a:	41 5c                	pop    %r12
+  80150c:	41 5d                	pop    %r13
+  80150e:	41 5f                	pop    %r15
+  801510:	5d                   	pop    %rbp
+  801511:	c3                   	ret
+
+0000000000801512 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801512:	55                   	push   %rbp
+  801513:	48 89 e5             	mov    %rsp,%rbp
+  801516:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80151d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80151d <printfmt+0xb>
+  801524:	49 bb 23 7b 00 00 00 	movabs $0x7b23,%r11
+  80152b:	00 00 00 
+  80152e:	4d 01 da             	add    %r11,%r10
+  801531:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801538:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80153f:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801546:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80154d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801554:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80155b:	84 c0                	test   %al,%al
+  80155d:	74 20                	je     80157f <printfmt+0x6d>
+  80155f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801563:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801567:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80156b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80156f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801573:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801577:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80157b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80157f:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801586:	00 00 00 
+  801589:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801590:	00 00 00 
+  801593:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801597:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80159e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8015a5:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8015ac:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8015b3:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8015ba:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8015c1:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8015c8:	48 89 c7             	mov    %rax,%rdi
+  8015cb:	48 b8 cb 7e ff ff ff 	movabs $0xffffffffffff7ecb,%rax
+  8015d2:	ff ff ff 
+  8015d5:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8015d9:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  8015db:	90                   	nop
+  8015dc:	c9                   	leave
+  8015dd:	c3                   	ret
+
+00000000008015de <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8015de:	55                   	push   %rbp
+  8015df:	48 89 e5             	mov    %rsp,%rbp
+  8015e2:	48 83 ec 10          	sub    $0x10,%rsp
+  8015e6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015e6 <sprintputch+0x8>
+  8015ed:	49 bb 5a 7a 00 00 00 	movabs $0x7a5a,%r11
+  8015f4:	00 00 00 
+  8015f7:	4c 01 d8             	add    %r11,%rax
+  8015fa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8015fd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801601:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801605:	8b 40 10             	mov    0x10(%rax),%eax
+  801608:	8d 50 01             	lea    0x1(%rax),%edx
+  80160b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80160f:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801612:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801616:	48 8b 10             	mov    (%rax),%rdx
+  801619:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80161d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801621:	48 39 c2             	cmp    %rax,%rdx
+  801624:	73 17                	jae    80163d <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801626:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80162a:	48 8b 00             	mov    (%rax),%rax
+  80162d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801631:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801635:	48 89 0a             	mov    %rcx,(%rdx)
+  801638:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80163b:	88 10                	mov    %dl,(%rax)
+}
+  80163d:	90                   	nop
+  80163e:	c9                   	leave
+  80163f:	c3                   	ret
+
+0000000000801640 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801640:	55                   	push   %rbp
+  801641:	48 89 e5             	mov    %rsp,%rbp
+  801644:	53                   	push   %rbx
+  801645:	48 83 ec 58          	sub    $0x58,%rsp
+  801649:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801649 <vsnprintf+0x9>
+  801650:	49 bb f7 79 00 00 00 	movabs $0x79f7,%r11
+  801657:	00 00 00 
+  80165a:	4c 01 d8             	add    %r11,%rax
+  80165d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801661:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801664:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801668:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  80166c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801670:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801674:	48 8b 0e             	mov    (%rsi),%rcx
+  801677:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  80167b:	48 89 0a             	mov    %rcx,(%rdx)
+  80167e:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801682:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801686:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80168a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80168e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801692:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801695:	48 63 d2             	movslq %edx,%rdx
+  801698:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80169c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8016a0:	48 01 ca             	add    %rcx,%rdx
+  8016a3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8016a7:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8016ae:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8016b3:	74 06                	je     8016bb <vsnprintf+0x7b>
+  8016b5:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8016b9:	7f 07                	jg     8016c2 <vsnprintf+0x82>
+		return -E_INVAL;
+  8016bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c0:	eb 34                	jmp    8016f6 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8016c2:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8016c6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8016ca:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8016ce:	48 bf 9e 85 ff ff ff 	movabs $0xffffffffffff859e,%rdi
+  8016d5:	ff ff ff 
+  8016d8:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8016dc:	49 b8 cb 7e ff ff ff 	movabs $0xffffffffffff7ecb,%r8
+  8016e3:	ff ff ff 
+  8016e6:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8016ea:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8016ec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8016f0:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8016f3:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8016f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016fa:	c9                   	leave
+  8016fb:	c3                   	ret
+
+00000000008016fc <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8016fc:	55                   	push   %rbp
+  8016fd:	48 89 e5             	mov    %rsp,%rbp
+  801700:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801707:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801707 <snprintf+0xb>
+  80170e:	49 bb 39 79 00 00 00 	movabs $0x7939,%r11
+  801715:	00 00 00 
+  801718:	4d 01 da             	add    %r11,%r10
+  80171b:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801722:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801728:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80172f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801736:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80173d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801744:	84 c0                	test   %al,%al
+  801746:	74 20                	je     801768 <snprintf+0x6c>
+  801748:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80174c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801750:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801754:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801758:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80175c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801760:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801764:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801768:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80176f:	00 00 00 
+  801772:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801779:	00 00 00 
+  80177c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801780:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801787:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80178e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801795:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80179c:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8017a3:	48 8b 06             	mov    (%rsi),%rax
+  8017a6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8017aa:	48 89 01             	mov    %rax,(%rcx)
+  8017ad:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8017b1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8017b5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8017b9:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8017c0:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8017c7:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8017cd:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8017d4:	48 89 c7             	mov    %rax,%rdi
+  8017d7:	48 b8 00 86 ff ff ff 	movabs $0xffffffffffff8600,%rax
+  8017de:	ff ff ff 
+  8017e1:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8017e5:	ff d0                	call   *%rax
+  8017e7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8017ed:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8017f3:	c9                   	leave
+  8017f4:	c3                   	ret
+
+00000000008017f5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8017f5:	55                   	push   %rbp
+  8017f6:	48 89 e5             	mov    %rsp,%rbp
+  8017f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8017fd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017fd <strlen+0x8>
+  801804:	49 bb 43 78 00 00 00 	movabs $0x7843,%r11
+  80180b:	00 00 00 
+  80180e:	4c 01 d8             	add    %r11,%rax
+  801811:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801815:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80181c:	eb 09                	jmp    801827 <strlen+0x32>
+		n++;
+  80181e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801822:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801827:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80182b:	0f b6 00             	movzbl (%rax),%eax
+  80182e:	84 c0                	test   %al,%al
+  801830:	75 ec                	jne    80181e <strlen+0x29>
+	return n;
+  801832:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801835:	c9                   	leave
+  801836:	c3                   	ret
+
+0000000000801837 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801837:	55                   	push   %rbp
+  801838:	48 89 e5             	mov    %rsp,%rbp
+  80183b:	48 83 ec 20          	sub    $0x20,%rsp
+  80183f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80183f <strnlen+0x8>
+  801846:	49 bb 01 78 00 00 00 	movabs $0x7801,%r11
+  80184d:	00 00 00 
+  801850:	4c 01 d8             	add    %r11,%rax
+  801853:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801857:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80185b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801862:	eb 0e                	jmp    801872 <strnlen+0x3b>
+		n++;
+  801864:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801868:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80186d:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801872:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801877:	74 0b                	je     801884 <strnlen+0x4d>
+  801879:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80187d:	0f b6 00             	movzbl (%rax),%eax
+  801880:	84 c0                	test   %al,%al
+  801882:	75 e0                	jne    801864 <strnlen+0x2d>
+	return n;
+  801884:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801887:	c9                   	leave
+  801888:	c3                   	ret
+
+0000000000801889 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801889:	55                   	push   %rbp
+  80188a:	48 89 e5             	mov    %rsp,%rbp
+  80188d:	48 83 ec 20          	sub    $0x20,%rsp
+  801891:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801891 <strcpy+0x8>
+  801898:	49 bb af 77 00 00 00 	movabs $0x77af,%r11
+  80189f:	00 00 00 
+  8018a2:	4c 01 d8             	add    %r11,%rax
+  8018a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8018ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018b1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8018b5:	90                   	nop
+  8018b6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8018ba:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018be:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8018c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018c6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018ca:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018ce:	0f b6 12             	movzbl (%rdx),%edx
+  8018d1:	88 10                	mov    %dl,(%rax)
+  8018d3:	0f b6 00             	movzbl (%rax),%eax
+  8018d6:	84 c0                	test   %al,%al
+  8018d8:	75 dc                	jne    8018b6 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8018da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8018de:	c9                   	leave
+  8018df:	c3                   	ret
+
+00000000008018e0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8018e0:	55                   	push   %rbp
+  8018e1:	48 89 e5             	mov    %rsp,%rbp
+  8018e4:	53                   	push   %rbx
+  8018e5:	48 83 ec 20          	sub    $0x20,%rsp
+  8018e9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8018e9 <strcat+0x9>
+  8018f0:	49 bb 57 77 00 00 00 	movabs $0x7757,%r11
+  8018f7:	00 00 00 
+  8018fa:	4c 01 db             	add    %r11,%rbx
+  8018fd:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801901:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801905:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801909:	48 89 c7             	mov    %rax,%rdi
+  80190c:	48 b8 b5 87 ff ff ff 	movabs $0xffffffffffff87b5,%rax
+  801913:	ff ff ff 
+  801916:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80191a:	ff d0                	call   *%rax
+  80191c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  80191f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801922:	48 63 d0             	movslq %eax,%rdx
+  801925:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801929:	48 01 c2             	add    %rax,%rdx
+  80192c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801930:	48 89 c6             	mov    %rax,%rsi
+  801933:	48 89 d7             	mov    %rdx,%rdi
+  801936:	48 b8 49 88 ff ff ff 	movabs $0xffffffffffff8849,%rax
+  80193d:	ff ff ff 
+  801940:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801944:	ff d0                	call   *%rax
+	return dst;
+  801946:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  80194a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80194e:	c9                   	leave
+  80194f:	c3                   	ret
+
+0000000000801950 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801950:	55                   	push   %rbp
+  801951:	48 89 e5             	mov    %rsp,%rbp
+  801954:	48 83 ec 28          	sub    $0x28,%rsp
+  801958:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801958 <strncpy+0x8>
+  80195f:	49 bb e8 76 00 00 00 	movabs $0x76e8,%r11
+  801966:	00 00 00 
+  801969:	4c 01 d8             	add    %r11,%rax
+  80196c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801970:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801974:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801978:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80197c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801980:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801987:	00 
+  801988:	eb 2a                	jmp    8019b4 <strncpy+0x64>
+		*dst++ = *src;
+  80198a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80198e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801992:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801996:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80199a:	0f b6 12             	movzbl (%rdx),%edx
+  80199d:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80199f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019a3:	0f b6 00             	movzbl (%rax),%eax
+  8019a6:	84 c0                	test   %al,%al
+  8019a8:	74 05                	je     8019af <strncpy+0x5f>
+			src++;
+  8019aa:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8019af:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019b8:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8019bc:	72 cc                	jb     80198a <strncpy+0x3a>
+	}
+	return ret;
+  8019be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8019c2:	c9                   	leave
+  8019c3:	c3                   	ret
+
+00000000008019c4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8019c4:	55                   	push   %rbp
+  8019c5:	48 89 e5             	mov    %rsp,%rbp
+  8019c8:	48 83 ec 28          	sub    $0x28,%rsp
+  8019cc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019cc <strlcpy+0x8>
+  8019d3:	49 bb 74 76 00 00 00 	movabs $0x7674,%r11
+  8019da:	00 00 00 
+  8019dd:	4c 01 d8             	add    %r11,%rax
+  8019e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8019e8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8019ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019f0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8019f4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8019f9:	74 3d                	je     801a38 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8019fb:	eb 1d                	jmp    801a1a <strlcpy+0x56>
+			*dst++ = *src++;
+  8019fd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801a01:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801a05:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801a09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a0d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a11:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a15:	0f b6 12             	movzbl (%rdx),%edx
+  801a18:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801a1a:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801a1f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801a24:	74 0b                	je     801a31 <strlcpy+0x6d>
+  801a26:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a2a:	0f b6 00             	movzbl (%rax),%eax
+  801a2d:	84 c0                	test   %al,%al
+  801a2f:	75 cc                	jne    8019fd <strlcpy+0x39>
+		*dst = '\0';
+  801a31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a35:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801a38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a3c:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801a40:	c9                   	leave
+  801a41:	c3                   	ret
+
+0000000000801a42 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801a42:	55                   	push   %rbp
+  801a43:	48 89 e5             	mov    %rsp,%rbp
+  801a46:	48 83 ec 10          	sub    $0x10,%rsp
+  801a4a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a4a <strcmp+0x8>
+  801a51:	49 bb f6 75 00 00 00 	movabs $0x75f6,%r11
+  801a58:	00 00 00 
+  801a5b:	4c 01 d8             	add    %r11,%rax
+  801a5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a62:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801a66:	eb 0a                	jmp    801a72 <strcmp+0x30>
+		p++, q++;
+  801a68:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a6d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801a72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a76:	0f b6 00             	movzbl (%rax),%eax
+  801a79:	84 c0                	test   %al,%al
+  801a7b:	74 12                	je     801a8f <strcmp+0x4d>
+  801a7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a81:	0f b6 10             	movzbl (%rax),%edx
+  801a84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a88:	0f b6 00             	movzbl (%rax),%eax
+  801a8b:	38 c2                	cmp    %al,%dl
+  801a8d:	74 d9                	je     801a68 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801a8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a93:	0f b6 00             	movzbl (%rax),%eax
+  801a96:	0f b6 d0             	movzbl %al,%edx
+  801a99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a9d:	0f b6 00             	movzbl (%rax),%eax
+  801aa0:	0f b6 c0             	movzbl %al,%eax
+  801aa3:	29 c2                	sub    %eax,%edx
+  801aa5:	89 d0                	mov    %edx,%eax
+}
+  801aa7:	c9                   	leave
+  801aa8:	c3                   	ret
+
+0000000000801aa9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801aa9:	55                   	push   %rbp
+  801aaa:	48 89 e5             	mov    %rsp,%rbp
+  801aad:	48 83 ec 18          	sub    $0x18,%rsp
+  801ab1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ab1 <strncmp+0x8>
+  801ab8:	49 bb 8f 75 00 00 00 	movabs $0x758f,%r11
+  801abf:	00 00 00 
+  801ac2:	4c 01 d8             	add    %r11,%rax
+  801ac5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ac9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801acd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801ad1:	eb 0f                	jmp    801ae2 <strncmp+0x39>
+		n--, p++, q++;
+  801ad3:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801ad8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801add:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801ae2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ae7:	74 1d                	je     801b06 <strncmp+0x5d>
+  801ae9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aed:	0f b6 00             	movzbl (%rax),%eax
+  801af0:	84 c0                	test   %al,%al
+  801af2:	74 12                	je     801b06 <strncmp+0x5d>
+  801af4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801af8:	0f b6 10             	movzbl (%rax),%edx
+  801afb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aff:	0f b6 00             	movzbl (%rax),%eax
+  801b02:	38 c2                	cmp    %al,%dl
+  801b04:	74 cd                	je     801ad3 <strncmp+0x2a>
+	if (n == 0)
+  801b06:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801b0b:	75 07                	jne    801b14 <strncmp+0x6b>
+		return 0;
+  801b0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b12:	eb 16                	jmp    801b2a <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801b14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b18:	0f b6 00             	movzbl (%rax),%eax
+  801b1b:	0f b6 d0             	movzbl %al,%edx
+  801b1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b22:	0f b6 00             	movzbl (%rax),%eax
+  801b25:	0f b6 c0             	movzbl %al,%eax
+  801b28:	29 c2                	sub    %eax,%edx
+}
+  801b2a:	89 d0                	mov    %edx,%eax
+  801b2c:	c9                   	leave
+  801b2d:	c3                   	ret
+
+0000000000801b2e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801b2e:	55                   	push   %rbp
+  801b2f:	48 89 e5             	mov    %rsp,%rbp
+  801b32:	48 83 ec 10          	sub    $0x10,%rsp
+  801b36:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b36 <strchr+0x8>
+  801b3d:	49 bb 0a 75 00 00 00 	movabs $0x750a,%r11
+  801b44:	00 00 00 
+  801b47:	4c 01 d8             	add    %r11,%rax
+  801b4a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b4e:	89 f0                	mov    %esi,%eax
+  801b50:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801b53:	eb 17                	jmp    801b6c <strchr+0x3e>
+		if (*s == c)
+  801b55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b59:	0f b6 00             	movzbl (%rax),%eax
+  801b5c:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801b5f:	75 06                	jne    801b67 <strchr+0x39>
+			return (char *) s;
+  801b61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b65:	eb 15                	jmp    801b7c <strchr+0x4e>
+	for (; *s; s++)
+  801b67:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801b6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b70:	0f b6 00             	movzbl (%rax),%eax
+  801b73:	84 c0                	test   %al,%al
+  801b75:	75 de                	jne    801b55 <strchr+0x27>
+	return 0;
+  801b77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b7c:	c9                   	leave
+  801b7d:	c3                   	ret
+
+0000000000801b7e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801b7e:	55                   	push   %rbp
+  801b7f:	48 89 e5             	mov    %rsp,%rbp
+  801b82:	48 83 ec 10          	sub    $0x10,%rsp
+  801b86:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b86 <strfind+0x8>
+  801b8d:	49 bb ba 74 00 00 00 	movabs $0x74ba,%r11
+  801b94:	00 00 00 
+  801b97:	4c 01 d8             	add    %r11,%rax
+  801b9a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b9e:	89 f0                	mov    %esi,%eax
+  801ba0:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801ba3:	eb 11                	jmp    801bb6 <strfind+0x38>
+		if (*s == c)
+  801ba5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ba9:	0f b6 00             	movzbl (%rax),%eax
+  801bac:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801baf:	74 12                	je     801bc3 <strfind+0x45>
+	for (; *s; s++)
+  801bb1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801bb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bba:	0f b6 00             	movzbl (%rax),%eax
+  801bbd:	84 c0                	test   %al,%al
+  801bbf:	75 e4                	jne    801ba5 <strfind+0x27>
+  801bc1:	eb 01                	jmp    801bc4 <strfind+0x46>
+			break;
+  801bc3:	90                   	nop
+	return (char *) s;
+  801bc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801bc8:	c9                   	leave
+  801bc9:	c3                   	ret
+
+0000000000801bca <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801bca:	55                   	push   %rbp
+  801bcb:	48 89 e5             	mov    %rsp,%rbp
+  801bce:	48 83 ec 18          	sub    $0x18,%rsp
+  801bd2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801bd2 <memset+0x8>
+  801bd9:	49 bb 6e 74 00 00 00 	movabs $0x746e,%r11
+  801be0:	00 00 00 
+  801be3:	4c 01 d8             	add    %r11,%rax
+  801be6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801bea:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801bed:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801bf1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801bf6:	75 06                	jne    801bfe <memset+0x34>
+		return v;
+  801bf8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bfc:	eb 69                	jmp    801c67 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801bfe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c02:	83 e0 03             	and    $0x3,%eax
+  801c05:	48 85 c0             	test   %rax,%rax
+  801c08:	75 48                	jne    801c52 <memset+0x88>
+  801c0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c0e:	83 e0 03             	and    $0x3,%eax
+  801c11:	48 85 c0             	test   %rax,%rax
+  801c14:	75 3c                	jne    801c52 <memset+0x88>
+		c &= 0xFF;
+  801c16:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801c1d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c20:	c1 e0 18             	shl    $0x18,%eax
+  801c23:	89 c2                	mov    %eax,%edx
+  801c25:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c28:	c1 e0 10             	shl    $0x10,%eax
+  801c2b:	09 c2                	or     %eax,%edx
+  801c2d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c30:	c1 e0 08             	shl    $0x8,%eax
+  801c33:	09 d0                	or     %edx,%eax
+  801c35:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801c38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c3c:	48 c1 e8 02          	shr    $0x2,%rax
+  801c40:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801c43:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c47:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c4a:	48 89 d7             	mov    %rdx,%rdi
+  801c4d:	fc                   	cld
+  801c4e:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801c50:	eb 11                	jmp    801c63 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801c52:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c56:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c59:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801c5d:	48 89 d7             	mov    %rdx,%rdi
+  801c60:	fc                   	cld
+  801c61:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801c63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801c67:	c9                   	leave
+  801c68:	c3                   	ret
+
+0000000000801c69 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801c69:	55                   	push   %rbp
+  801c6a:	48 89 e5             	mov    %rsp,%rbp
+  801c6d:	48 83 ec 28          	sub    $0x28,%rsp
+  801c71:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c71 <memmove+0x8>
+  801c78:	49 bb cf 73 00 00 00 	movabs $0x73cf,%r11
+  801c7f:	00 00 00 
+  801c82:	4c 01 d8             	add    %r11,%rax
+  801c85:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c89:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801c8d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801c91:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c95:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801c99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c9d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801ca1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ca5:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801ca9:	0f 83 88 00 00 00    	jae    801d37 <memmove+0xce>
+  801caf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801cb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb7:	48 01 d0             	add    %rdx,%rax
+  801cba:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801cbe:	73 77                	jae    801d37 <memmove+0xce>
+		s += n;
+  801cc0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801cc8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ccc:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801cd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cd4:	83 e0 03             	and    $0x3,%eax
+  801cd7:	48 85 c0             	test   %rax,%rax
+  801cda:	75 3b                	jne    801d17 <memmove+0xae>
+  801cdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ce0:	83 e0 03             	and    $0x3,%eax
+  801ce3:	48 85 c0             	test   %rax,%rax
+  801ce6:	75 2f                	jne    801d17 <memmove+0xae>
+  801ce8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cec:	83 e0 03             	and    $0x3,%eax
+  801cef:	48 85 c0             	test   %rax,%rax
+  801cf2:	75 23                	jne    801d17 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801cf4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cf8:	48 83 e8 04          	sub    $0x4,%rax
+  801cfc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d00:	48 83 ea 04          	sub    $0x4,%rdx
+  801d04:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801d08:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801d0c:	48 89 c7             	mov    %rax,%rdi
+  801d0f:	48 89 d6             	mov    %rdx,%rsi
+  801d12:	fd                   	std
+  801d13:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801d15:	eb 1d                	jmp    801d34 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801d17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d1b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d23:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801d27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d2b:	48 89 d7             	mov    %rdx,%rdi
+  801d2e:	48 89 c1             	mov    %rax,%rcx
+  801d31:	fd                   	std
+  801d32:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801d34:	fc                   	cld
+  801d35:	eb 57                	jmp    801d8e <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801d37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d3b:	83 e0 03             	and    $0x3,%eax
+  801d3e:	48 85 c0             	test   %rax,%rax
+  801d41:	75 36                	jne    801d79 <memmove+0x110>
+  801d43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d47:	83 e0 03             	and    $0x3,%eax
+  801d4a:	48 85 c0             	test   %rax,%rax
+  801d4d:	75 2a                	jne    801d79 <memmove+0x110>
+  801d4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d53:	83 e0 03             	and    $0x3,%eax
+  801d56:	48 85 c0             	test   %rax,%rax
+  801d59:	75 1e                	jne    801d79 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801d5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d5f:	48 c1 e8 02          	shr    $0x2,%rax
+  801d63:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801d66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d6a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d6e:	48 89 c7             	mov    %rax,%rdi
+  801d71:	48 89 d6             	mov    %rdx,%rsi
+  801d74:	fc                   	cld
+  801d75:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801d77:	eb 15                	jmp    801d8e <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801d79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d7d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d81:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801d85:	48 89 c7             	mov    %rax,%rdi
+  801d88:	48 89 d6             	mov    %rdx,%rsi
+  801d8b:	fc                   	cld
+  801d8c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801d8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d92:	c9                   	leave
+  801d93:	c3                   	ret
+
+0000000000801d94 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801d94:	55                   	push   %rbp
+  801d95:	48 89 e5             	mov    %rsp,%rbp
+  801d98:	48 83 ec 18          	sub    $0x18,%rsp
+  801d9c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d9c <memcpy+0x8>
+  801da3:	49 bb a4 72 00 00 00 	movabs $0x72a4,%r11
+  801daa:	00 00 00 
+  801dad:	4c 01 d8             	add    %r11,%rax
+  801db0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801db4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801db8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801dbc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801dc0:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801dc4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801dc8:	48 89 cf             	mov    %rcx,%rdi
+  801dcb:	48 b9 29 8c ff ff ff 	movabs $0xffffffffffff8c29,%rcx
+  801dd2:	ff ff ff 
+  801dd5:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801dd9:	ff d0                	call   *%rax
+}
+  801ddb:	c9                   	leave
+  801ddc:	c3                   	ret
+
+0000000000801ddd <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801ddd:	55                   	push   %rbp
+  801dde:	48 89 e5             	mov    %rsp,%rbp
+  801de1:	48 83 ec 28          	sub    $0x28,%rsp
+  801de5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801de5 <memcmp+0x8>
+  801dec:	49 bb 5b 72 00 00 00 	movabs $0x725b,%r11
+  801df3:	00 00 00 
+  801df6:	4c 01 d8             	add    %r11,%rax
+  801df9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801dfd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801e01:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801e05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e09:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801e0d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e11:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801e15:	eb 34                	jmp    801e4b <memcmp+0x6e>
+		if (*s1 != *s2)
+  801e17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e1b:	0f b6 10             	movzbl (%rax),%edx
+  801e1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e22:	0f b6 00             	movzbl (%rax),%eax
+  801e25:	38 c2                	cmp    %al,%dl
+  801e27:	74 18                	je     801e41 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801e29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e2d:	0f b6 00             	movzbl (%rax),%eax
+  801e30:	0f b6 d0             	movzbl %al,%edx
+  801e33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e37:	0f b6 00             	movzbl (%rax),%eax
+  801e3a:	0f b6 c0             	movzbl %al,%eax
+  801e3d:	29 c2                	sub    %eax,%edx
+  801e3f:	eb 20                	jmp    801e61 <memcmp+0x84>
+		s1++, s2++;
+  801e41:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801e46:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801e4b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e4f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e53:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801e57:	48 85 c0             	test   %rax,%rax
+  801e5a:	75 bb                	jne    801e17 <memcmp+0x3a>
+	}
+
+	return 0;
+  801e5c:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801e61:	89 d0                	mov    %edx,%eax
+  801e63:	c9                   	leave
+  801e64:	c3                   	ret
+
+0000000000801e65 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801e65:	55                   	push   %rbp
+  801e66:	48 89 e5             	mov    %rsp,%rbp
+  801e69:	48 83 ec 28          	sub    $0x28,%rsp
+  801e6d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e6d <memfind+0x8>
+  801e74:	49 bb d3 71 00 00 00 	movabs $0x71d3,%r11
+  801e7b:	00 00 00 
+  801e7e:	4c 01 d8             	add    %r11,%rax
+  801e81:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801e85:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801e88:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801e8c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e94:	48 01 d0             	add    %rdx,%rax
+  801e97:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801e9b:	eb 13                	jmp    801eb0 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801e9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ea1:	0f b6 00             	movzbl (%rax),%eax
+  801ea4:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801ea7:	38 d0                	cmp    %dl,%al
+  801ea9:	74 11                	je     801ebc <memfind+0x57>
+	for (; s < ends; s++)
+  801eab:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801eb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801eb4:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801eb8:	72 e3                	jb     801e9d <memfind+0x38>
+  801eba:	eb 01                	jmp    801ebd <memfind+0x58>
+			break;
+  801ebc:	90                   	nop
+	return (void *) s;
+  801ebd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801ec1:	c9                   	leave
+  801ec2:	c3                   	ret
+
+0000000000801ec3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801ec3:	55                   	push   %rbp
+  801ec4:	48 89 e5             	mov    %rsp,%rbp
+  801ec7:	48 83 ec 38          	sub    $0x38,%rsp
+  801ecb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ecb <strtol+0x8>
+  801ed2:	49 bb 75 71 00 00 00 	movabs $0x7175,%r11
+  801ed9:	00 00 00 
+  801edc:	4c 01 d8             	add    %r11,%rax
+  801edf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ee3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801ee7:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801eea:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801ef1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801ef8:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801ef9:	eb 05                	jmp    801f00 <strtol+0x3d>
+		s++;
+  801efb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801f00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f04:	0f b6 00             	movzbl (%rax),%eax
+  801f07:	3c 20                	cmp    $0x20,%al
+  801f09:	74 f0                	je     801efb <strtol+0x38>
+  801f0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f0f:	0f b6 00             	movzbl (%rax),%eax
+  801f12:	3c 09                	cmp    $0x9,%al
+  801f14:	74 e5                	je     801efb <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801f16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f1a:	0f b6 00             	movzbl (%rax),%eax
+  801f1d:	3c 2b                	cmp    $0x2b,%al
+  801f1f:	75 07                	jne    801f28 <strtol+0x65>
+		s++;
+  801f21:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f26:	eb 17                	jmp    801f3f <strtol+0x7c>
+	else if (*s == '-')
+  801f28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f2c:	0f b6 00             	movzbl (%rax),%eax
+  801f2f:	3c 2d                	cmp    $0x2d,%al
+  801f31:	75 0c                	jne    801f3f <strtol+0x7c>
+		s++, neg = 1;
+  801f33:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f38:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801f3f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f43:	74 06                	je     801f4b <strtol+0x88>
+  801f45:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801f49:	75 28                	jne    801f73 <strtol+0xb0>
+  801f4b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f4f:	0f b6 00             	movzbl (%rax),%eax
+  801f52:	3c 30                	cmp    $0x30,%al
+  801f54:	75 1d                	jne    801f73 <strtol+0xb0>
+  801f56:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f5a:	48 83 c0 01          	add    $0x1,%rax
+  801f5e:	0f b6 00             	movzbl (%rax),%eax
+  801f61:	3c 78                	cmp    $0x78,%al
+  801f63:	75 0e                	jne    801f73 <strtol+0xb0>
+		s += 2, base = 16;
+  801f65:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801f6a:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801f71:	eb 2c                	jmp    801f9f <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801f73:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f77:	75 19                	jne    801f92 <strtol+0xcf>
+  801f79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f7d:	0f b6 00             	movzbl (%rax),%eax
+  801f80:	3c 30                	cmp    $0x30,%al
+  801f82:	75 0e                	jne    801f92 <strtol+0xcf>
+		s++, base = 8;
+  801f84:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f89:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801f90:	eb 0d                	jmp    801f9f <strtol+0xdc>
+	else if (base == 0)
+  801f92:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f96:	75 07                	jne    801f9f <strtol+0xdc>
+		base = 10;
+  801f98:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801f9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fa3:	0f b6 00             	movzbl (%rax),%eax
+  801fa6:	3c 2f                	cmp    $0x2f,%al
+  801fa8:	7e 1d                	jle    801fc7 <strtol+0x104>
+  801faa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fae:	0f b6 00             	movzbl (%rax),%eax
+  801fb1:	3c 39                	cmp    $0x39,%al
+  801fb3:	7f 12                	jg     801fc7 <strtol+0x104>
+			dig = *s - '0';
+  801fb5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fb9:	0f b6 00             	movzbl (%rax),%eax
+  801fbc:	0f be c0             	movsbl %al,%eax
+  801fbf:	83 e8 30             	sub    $0x30,%eax
+  801fc2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801fc5:	eb 4e                	jmp    802015 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801fc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fcb:	0f b6 00             	movzbl (%rax),%eax
+  801fce:	3c 60                	cmp    $0x60,%al
+  801fd0:	7e 1d                	jle    801fef <strtol+0x12c>
+  801fd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fd6:	0f b6 00             	movzbl (%rax),%eax
+  801fd9:	3c 7a                	cmp    $0x7a,%al
+  801fdb:	7f 12                	jg     801fef <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801fdd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fe1:	0f b6 00             	movzbl (%rax),%eax
+  801fe4:	0f be c0             	movsbl %al,%eax
+  801fe7:	83 e8 57             	sub    $0x57,%eax
+  801fea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801fed:	eb 26                	jmp    802015 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801fef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ff3:	0f b6 00             	movzbl (%rax),%eax
+  801ff6:	3c 40                	cmp    $0x40,%al
+  801ff8:	7e 47                	jle    802041 <strtol+0x17e>
+  801ffa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ffe:	0f b6 00             	movzbl (%rax),%eax
+  802001:	3c 5a                	cmp    $0x5a,%al
+  802003:	7f 3c                	jg     802041 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  802005:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802009:	0f b6 00             	movzbl (%rax),%eax
+  80200c:	0f be c0             	movsbl %al,%eax
+  80200f:	83 e8 37             	sub    $0x37,%eax
+  802012:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  802015:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802018:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80201b:	7d 23                	jge    802040 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  80201d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802022:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802025:	48 98                	cltq
+  802027:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80202c:	48 89 c2             	mov    %rax,%rdx
+  80202f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802032:	48 98                	cltq
+  802034:	48 01 d0             	add    %rdx,%rax
+  802037:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  80203b:	e9 5f ff ff ff       	jmp    801f9f <strtol+0xdc>
+			break;
+  802040:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802041:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802046:	74 0b                	je     802053 <strtol+0x190>
+		*endptr = (char *) s;
+  802048:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80204c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802050:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  802053:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802057:	74 09                	je     802062 <strtol+0x19f>
+  802059:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80205d:	48 f7 d8             	neg    %rax
+  802060:	eb 04                	jmp    802066 <strtol+0x1a3>
+  802062:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802066:	c9                   	leave
+  802067:	c3                   	ret
+
+0000000000802068 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  802068:	55                   	push   %rbp
+  802069:	48 89 e5             	mov    %rsp,%rbp
+  80206c:	53                   	push   %rbx
+  80206d:	48 83 ec 30          	sub    $0x30,%rsp
+  802071:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802071 <strstr+0x9>
+  802078:	49 bb cf 6f 00 00 00 	movabs $0x6fcf,%r11
+  80207f:	00 00 00 
+  802082:	4c 01 db             	add    %r11,%rbx
+  802085:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  802089:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  80208d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802091:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802095:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802099:	0f b6 00             	movzbl (%rax),%eax
+  80209c:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  80209f:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  8020a3:	75 06                	jne    8020ab <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  8020a5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020a9:	eb 73                	jmp    80211e <strstr+0xb6>
+
+	len = strlen(str);
+  8020ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020af:	48 89 c7             	mov    %rax,%rdi
+  8020b2:	48 b8 b5 87 ff ff ff 	movabs $0xffffffffffff87b5,%rax
+  8020b9:	ff ff ff 
+  8020bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8020c0:	ff d0                	call   *%rax
+  8020c2:	48 98                	cltq
+  8020c4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  8020c8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020cc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8020d0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8020d4:	0f b6 00             	movzbl (%rax),%eax
+  8020d7:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  8020da:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  8020de:	75 07                	jne    8020e7 <strstr+0x7f>
+				return (char *) 0;
+  8020e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e5:	eb 37                	jmp    80211e <strstr+0xb6>
+		} while (sc != c);
+  8020e7:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  8020eb:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  8020ee:	75 d8                	jne    8020c8 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  8020f0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8020f4:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8020f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020fc:	48 89 ce             	mov    %rcx,%rsi
+  8020ff:	48 89 c7             	mov    %rax,%rdi
+  802102:	48 b8 69 8a ff ff ff 	movabs $0xffffffffffff8a69,%rax
+  802109:	ff ff ff 
+  80210c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802110:	ff d0                	call   *%rax
+  802112:	85 c0                	test   %eax,%eax
+  802114:	75 b2                	jne    8020c8 <strstr+0x60>
+
+	return (char *) (in - 1);
+  802116:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80211a:	48 83 e8 01          	sub    $0x1,%rax
+}
+  80211e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802122:	c9                   	leave
+  802123:	c3                   	ret
+
+0000000000802124 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  802124:	55                   	push   %rbp
+  802125:	48 89 e5             	mov    %rsp,%rbp
+  802128:	41 57                	push   %r15
+  80212a:	53                   	push   %rbx
+  80212b:	48 83 ec 40          	sub    $0x40,%rsp
+  80212f:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80212f <syscall+0xb>
+  802136:	49 bb 11 6f 00 00 00 	movabs $0x6f11,%r11
+  80213d:	00 00 00 
+  802140:	4d 01 da             	add    %r11,%r10
+  802143:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802146:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  802149:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80214d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802151:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  802155:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  802159:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80215c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802160:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802164:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  802168:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80216c:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802170:	4c 89 c3             	mov    %r8,%rbx
+  802173:	cd 30                	int    $0x30
+  802175:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  802179:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80217d:	74 52                	je     8021d1 <syscall+0xad>
+  80217f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802184:	7e 4b                	jle    8021d1 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802186:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80218a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80218d:	49 89 d0             	mov    %rdx,%r8
+  802190:	89 c1                	mov    %eax,%ecx
+  802192:	48 b8 b0 e7 ff ff ff 	movabs $0xffffffffffffe7b0,%rax
+  802199:	ff ff ff 
+  80219c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8021a0:	48 89 c2             	mov    %rax,%rdx
+  8021a3:	be 23 00 00 00       	mov    $0x23,%esi
+  8021a8:	48 b8 cd e7 ff ff ff 	movabs $0xffffffffffffe7cd,%rax
+  8021af:	ff ff ff 
+  8021b2:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8021b6:	48 89 c7             	mov    %rax,%rdi
+  8021b9:	4d 89 d7             	mov    %r10,%r15
+  8021bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021c1:	49 b9 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r9
+  8021c8:	ff ff ff 
+  8021cb:	4d 01 d1             	add    %r10,%r9
+  8021ce:	41 ff d1             	call   *%r9
+
+	return ret;
+  8021d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8021d5:	48 83 c4 40          	add    $0x40,%rsp
+  8021d9:	5b                   	pop    %rbx
+  8021da:	41 5f                	pop    %r15
+  8021dc:	5d                   	pop    %rbp
+  8021dd:	c3                   	ret
+
+00000000008021de <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  8021de:	55                   	push   %rbp
+  8021df:	48 89 e5             	mov    %rsp,%rbp
+  8021e2:	41 57                	push   %r15
+  8021e4:	41 56                	push   %r14
+  8021e6:	41 55                	push   %r13
+  8021e8:	41 54                	push   %r12
+  8021ea:	53                   	push   %rbx
+  8021eb:	48 83 ec 48          	sub    $0x48,%rsp
+  8021ef:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 8021ef <syscall_words+0x11>
+  8021f6:	49 bb 51 6e 00 00 00 	movabs $0x6e51,%r11
+  8021fd:	00 00 00 
+  802200:	4d 01 de             	add    %r11,%r14
+  802203:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802206:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  802209:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  80220d:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802211:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  802215:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  802219:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80221e:	74 09                	je     802229 <syscall_words+0x4b>
+  802220:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802224:	48 8b 00             	mov    (%rax),%rax
+  802227:	eb 05                	jmp    80222e <syscall_words+0x50>
+  802229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222e:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  802231:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802236:	74 0a                	je     802242 <syscall_words+0x64>
+  802238:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80223c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802240:	eb 05                	jmp    802247 <syscall_words+0x69>
+  802242:	b8 00 00 00 00       	mov    $0x0,%eax
+  802247:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  80224a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80224f:	74 0a                	je     80225b <syscall_words+0x7d>
+  802251:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802255:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802259:	eb 05                	jmp    802260 <syscall_words+0x82>
+  80225b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802260:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  802263:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802268:	74 0a                	je     802274 <syscall_words+0x96>
+  80226a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80226e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802272:	eb 05                	jmp    802279 <syscall_words+0x9b>
+  802274:	b8 00 00 00 00       	mov    $0x0,%eax
+  802279:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  80227c:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802281:	74 0a                	je     80228d <syscall_words+0xaf>
+  802283:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802287:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80228b:	eb 05                	jmp    802292 <syscall_words+0xb4>
+  80228d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802292:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  802295:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80229a:	74 0a                	je     8022a6 <syscall_words+0xc8>
+  80229c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8022a0:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8022a4:	eb 05                	jmp    8022ab <syscall_words+0xcd>
+  8022a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ab:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  8022ae:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8022b1:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8022b5:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8022b9:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  8022bd:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  8022c1:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8022c5:	cd 30                	int    $0x30
+  8022c7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  8022cb:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8022d0:	74 50                	je     802322 <syscall_words+0x144>
+		words[0] = r8;
+  8022d2:	4c 89 c2             	mov    %r8,%rdx
+  8022d5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8022d9:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  8022dc:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8022e0:	48 83 c0 08          	add    $0x8,%rax
+  8022e4:	4c 89 ca             	mov    %r9,%rdx
+  8022e7:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  8022ea:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8022ee:	48 83 c0 10          	add    $0x10,%rax
+  8022f2:	4c 89 d2             	mov    %r10,%rdx
+  8022f5:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  8022f8:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8022fc:	48 83 c0 18          	add    $0x18,%rax
+  802300:	4c 89 da             	mov    %r11,%rdx
+  802303:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  802306:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80230a:	48 83 c0 20          	add    $0x20,%rax
+  80230e:	4c 89 e2             	mov    %r12,%rdx
+  802311:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  802314:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802318:	48 83 c0 28          	add    $0x28,%rax
+  80231c:	4c 89 ea             	mov    %r13,%rdx
+  80231f:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  802322:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  802326:	74 52                	je     80237a <syscall_words+0x19c>
+  802328:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80232d:	7e 4b                	jle    80237a <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80232f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802333:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802336:	49 89 d0             	mov    %rdx,%r8
+  802339:	89 c1                	mov    %eax,%ecx
+  80233b:	48 b8 b0 e7 ff ff ff 	movabs $0xffffffffffffe7b0,%rax
+  802342:	ff ff ff 
+  802345:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802349:	48 89 c2             	mov    %rax,%rdx
+  80234c:	be 4e 00 00 00       	mov    $0x4e,%esi
+  802351:	48 b8 cd e7 ff ff ff 	movabs $0xffffffffffffe7cd,%rax
+  802358:	ff ff ff 
+  80235b:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  80235f:	48 89 c7             	mov    %rax,%rdi
+  802362:	4d 89 f7             	mov    %r14,%r15
+  802365:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236a:	49 b9 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r9
+  802371:	ff ff ff 
+  802374:	4d 01 f1             	add    %r14,%r9
+  802377:	41 ff d1             	call   *%r9
+
+	return ret;
+  80237a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80237e:	48 83 c4 48          	add    $0x48,%rsp
+  802382:	5b                   	pop    %rbx
+  802383:	41 5c                	pop    %r12
+  802385:	41 5d                	pop    %r13
+  802387:	41 5e                	pop    %r14
+  802389:	41 5f                	pop    %r15
+  80238b:	5d                   	pop    %rbp
+  80238c:	c3                   	ret
+
+000000000080238d <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80238d:	55                   	push   %rbp
+  80238e:	48 89 e5             	mov    %rsp,%rbp
+  802391:	48 83 ec 10          	sub    $0x10,%rsp
+  802395:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802395 <sys_cputs+0x8>
+  80239c:	49 bb ab 6c 00 00 00 	movabs $0x6cab,%r11
+  8023a3:	00 00 00 
+  8023a6:	4c 01 d8             	add    %r11,%rax
+  8023a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023ad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8023b1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8023b5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8023bd:	6a 00                	push   $0x0
+  8023bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d5:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  8023dc:	ff ff ff 
+  8023df:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023e3:	ff d0                	call   *%rax
+  8023e5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023e9:	90                   	nop
+  8023ea:	c9                   	leave
+  8023eb:	c3                   	ret
+
+00000000008023ec <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8023ec:	55                   	push   %rbp
+  8023ed:	48 89 e5             	mov    %rsp,%rbp
+  8023f0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023f0 <sys_cgetc+0x4>
+  8023f7:	49 bb 50 6c 00 00 00 	movabs $0x6c50,%r11
+  8023fe:	00 00 00 
+  802401:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802404:	48 83 ec 08          	sub    $0x8,%rsp
+  802408:	6a 00                	push   $0x0
+  80240a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802410:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802416:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80241b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802420:	be 00 00 00 00       	mov    $0x0,%esi
+  802425:	bf 01 00 00 00       	mov    $0x1,%edi
+  80242a:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  802431:	ff ff ff 
+  802434:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802438:	ff d0                	call   *%rax
+  80243a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80243e:	c9                   	leave
+  80243f:	c3                   	ret
+
+0000000000802440 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802440:	55                   	push   %rbp
+  802441:	48 89 e5             	mov    %rsp,%rbp
+  802444:	48 83 ec 10          	sub    $0x10,%rsp
+  802448:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802448 <sys_env_destroy+0x8>
+  80244f:	49 bb f8 6b 00 00 00 	movabs $0x6bf8,%r11
+  802456:	00 00 00 
+  802459:	4c 01 d8             	add    %r11,%rax
+  80245c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80245f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802462:	48 63 d2             	movslq %edx,%rdx
+  802465:	48 83 ec 08          	sub    $0x8,%rsp
+  802469:	6a 00                	push   $0x0
+  80246b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802471:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802477:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80247c:	be 01 00 00 00       	mov    $0x1,%esi
+  802481:	bf 03 00 00 00       	mov    $0x3,%edi
+  802486:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  80248d:	ff ff ff 
+  802490:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802494:	ff d0                	call   *%rax
+  802496:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80249a:	c9                   	leave
+  80249b:	c3                   	ret
+
+000000000080249c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80249c:	55                   	push   %rbp
+  80249d:	48 89 e5             	mov    %rsp,%rbp
+  8024a0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024a0 <sys_getenvid+0x4>
+  8024a7:	49 bb a0 6b 00 00 00 	movabs $0x6ba0,%r11
+  8024ae:	00 00 00 
+  8024b1:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8024b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b8:	6a 00                	push   $0x0
+  8024ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8024d5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8024da:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  8024e1:	ff ff ff 
+  8024e4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024e8:	ff d0                	call   *%rax
+  8024ea:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024ee:	c9                   	leave
+  8024ef:	c3                   	ret
+
+00000000008024f0 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8024f0:	55                   	push   %rbp
+  8024f1:	48 89 e5             	mov    %rsp,%rbp
+  8024f4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024f4 <sys_yield+0x4>
+  8024fb:	49 bb 4c 6b 00 00 00 	movabs $0x6b4c,%r11
+  802502:	00 00 00 
+  802505:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802508:	48 83 ec 08          	sub    $0x8,%rsp
+  80250c:	6a 00                	push   $0x0
+  80250e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802514:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80251a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80251f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802524:	be 00 00 00 00       	mov    $0x0,%esi
+  802529:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80252e:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  802535:	ff ff ff 
+  802538:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80253c:	ff d0                	call   *%rax
+  80253e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802542:	90                   	nop
+  802543:	c9                   	leave
+  802544:	c3                   	ret
+
+0000000000802545 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802545:	55                   	push   %rbp
+  802546:	48 89 e5             	mov    %rsp,%rbp
+  802549:	48 83 ec 10          	sub    $0x10,%rsp
+  80254d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80254d <sys_page_alloc+0x8>
+  802554:	49 bb f3 6a 00 00 00 	movabs $0x6af3,%r11
+  80255b:	00 00 00 
+  80255e:	4c 01 d8             	add    %r11,%rax
+  802561:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802564:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802568:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80256b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80256e:	48 63 f2             	movslq %edx,%rsi
+  802571:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802575:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802578:	48 63 d2             	movslq %edx,%rdx
+  80257b:	48 83 ec 08          	sub    $0x8,%rsp
+  80257f:	6a 00                	push   $0x0
+  802581:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802587:	49 89 f0             	mov    %rsi,%r8
+  80258a:	be 01 00 00 00       	mov    $0x1,%esi
+  80258f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802594:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  80259b:	ff ff ff 
+  80259e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025a2:	ff d0                	call   *%rax
+  8025a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025a8:	c9                   	leave
+  8025a9:	c3                   	ret
+
+00000000008025aa <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8025aa:	55                   	push   %rbp
+  8025ab:	48 89 e5             	mov    %rsp,%rbp
+  8025ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8025b2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025b2 <sys_page_map+0x8>
+  8025b9:	49 bb 8e 6a 00 00 00 	movabs $0x6a8e,%r11
+  8025c0:	00 00 00 
+  8025c3:	4c 01 d8             	add    %r11,%rax
+  8025c6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025c9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025cd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8025d0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8025d4:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8025d8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8025db:	48 63 f2             	movslq %edx,%rsi
+  8025de:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8025e2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025e5:	48 63 fa             	movslq %edx,%rdi
+  8025e8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025ec:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025ef:	48 63 d2             	movslq %edx,%rdx
+  8025f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f6:	56                   	push   %rsi
+  8025f7:	4d 89 c1             	mov    %r8,%r9
+  8025fa:	49 89 f8             	mov    %rdi,%r8
+  8025fd:	be 01 00 00 00       	mov    $0x1,%esi
+  802602:	bf 05 00 00 00       	mov    $0x5,%edi
+  802607:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  80260e:	ff ff ff 
+  802611:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802615:	ff d0                	call   *%rax
+  802617:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80261b:	c9                   	leave
+  80261c:	c3                   	ret
+
+000000000080261d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80261d:	55                   	push   %rbp
+  80261e:	48 89 e5             	mov    %rsp,%rbp
+  802621:	48 83 ec 10          	sub    $0x10,%rsp
+  802625:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802625 <sys_page_unmap+0x8>
+  80262c:	49 bb 1b 6a 00 00 00 	movabs $0x6a1b,%r11
+  802633:	00 00 00 
+  802636:	4c 01 d8             	add    %r11,%rax
+  802639:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80263c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802640:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802644:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802647:	48 63 d2             	movslq %edx,%rdx
+  80264a:	48 83 ec 08          	sub    $0x8,%rsp
+  80264e:	6a 00                	push   $0x0
+  802650:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802656:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80265c:	be 01 00 00 00       	mov    $0x1,%esi
+  802661:	bf 06 00 00 00       	mov    $0x6,%edi
+  802666:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  80266d:	ff ff ff 
+  802670:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802674:	ff d0                	call   *%rax
+  802676:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80267a:	c9                   	leave
+  80267b:	c3                   	ret
+
+000000000080267c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80267c:	55                   	push   %rbp
+  80267d:	48 89 e5             	mov    %rsp,%rbp
+  802680:	48 83 ec 10          	sub    $0x10,%rsp
+  802684:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802684 <sys_env_set_status+0x8>
+  80268b:	49 bb bc 69 00 00 00 	movabs $0x69bc,%r11
+  802692:	00 00 00 
+  802695:	4c 01 d8             	add    %r11,%rax
+  802698:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80269b:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80269e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026a1:	48 63 ca             	movslq %edx,%rcx
+  8026a4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026a7:	48 63 d2             	movslq %edx,%rdx
+  8026aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ae:	6a 00                	push   $0x0
+  8026b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026bc:	be 01 00 00 00       	mov    $0x1,%esi
+  8026c1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8026c6:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  8026cd:	ff ff ff 
+  8026d0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026d4:	ff d0                	call   *%rax
+  8026d6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026da:	c9                   	leave
+  8026db:	c3                   	ret
+
+00000000008026dc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8026dc:	55                   	push   %rbp
+  8026dd:	48 89 e5             	mov    %rsp,%rbp
+  8026e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8026e4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026e4 <sys_env_set_trapframe+0x8>
+  8026eb:	49 bb 5c 69 00 00 00 	movabs $0x695c,%r11
+  8026f2:	00 00 00 
+  8026f5:	4c 01 d8             	add    %r11,%rax
+  8026f8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8026ff:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802703:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802706:	48 63 d2             	movslq %edx,%rdx
+  802709:	48 83 ec 08          	sub    $0x8,%rsp
+  80270d:	6a 00                	push   $0x0
+  80270f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802715:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80271b:	be 01 00 00 00       	mov    $0x1,%esi
+  802720:	bf 09 00 00 00       	mov    $0x9,%edi
+  802725:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  80272c:	ff ff ff 
+  80272f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802733:	ff d0                	call   *%rax
+  802735:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802739:	c9                   	leave
+  80273a:	c3                   	ret
+
+000000000080273b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80273b:	55                   	push   %rbp
+  80273c:	48 89 e5             	mov    %rsp,%rbp
+  80273f:	48 83 ec 10          	sub    $0x10,%rsp
+  802743:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802743 <sys_env_set_pgfault_upcall+0x8>
+  80274a:	49 bb fd 68 00 00 00 	movabs $0x68fd,%r11
+  802751:	00 00 00 
+  802754:	4c 01 d8             	add    %r11,%rax
+  802757:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80275a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80275e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802762:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802765:	48 63 d2             	movslq %edx,%rdx
+  802768:	48 83 ec 08          	sub    $0x8,%rsp
+  80276c:	6a 00                	push   $0x0
+  80276e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802774:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80277a:	be 01 00 00 00       	mov    $0x1,%esi
+  80277f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802784:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  80278b:	ff ff ff 
+  80278e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802792:	ff d0                	call   *%rax
+  802794:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802798:	c9                   	leave
+  802799:	c3                   	ret
+
+000000000080279a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80279a:	55                   	push   %rbp
+  80279b:	48 89 e5             	mov    %rsp,%rbp
+  80279e:	48 83 ec 20          	sub    $0x20,%rsp
+  8027a2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027a2 <sys_ipc_try_send+0x8>
+  8027a9:	49 bb 9e 68 00 00 00 	movabs $0x689e,%r11
+  8027b0:	00 00 00 
+  8027b3:	4c 01 d8             	add    %r11,%rax
+  8027b6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027b9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027bd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8027c1:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8027c4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027c7:	48 63 fa             	movslq %edx,%rdi
+  8027ca:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8027ce:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027d1:	48 63 d2             	movslq %edx,%rdx
+  8027d4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8027dc:	6a 00                	push   $0x0
+  8027de:	49 89 f9             	mov    %rdi,%r9
+  8027e1:	49 89 f0             	mov    %rsi,%r8
+  8027e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e9:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8027ee:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  8027f5:	ff ff ff 
+  8027f8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027fc:	ff d0                	call   *%rax
+  8027fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802802:	c9                   	leave
+  802803:	c3                   	ret
+
+0000000000802804 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802804:	55                   	push   %rbp
+  802805:	48 89 e5             	mov    %rsp,%rbp
+  802808:	48 83 ec 20          	sub    $0x20,%rsp
+  80280c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80280c <sys_ipc_send+0x8>
+  802813:	49 bb 34 68 00 00 00 	movabs $0x6834,%r11
+  80281a:	00 00 00 
+  80281d:	4c 01 d8             	add    %r11,%rax
+  802820:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802823:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802827:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80282b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80282e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802831:	48 63 fa             	movslq %edx,%rdi
+  802834:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802838:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80283b:	48 63 d2             	movslq %edx,%rdx
+  80283e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802842:	48 83 ec 08          	sub    $0x8,%rsp
+  802846:	6a 00                	push   $0x0
+  802848:	49 89 f9             	mov    %rdi,%r9
+  80284b:	49 89 f0             	mov    %rsi,%r8
+  80284e:	be 00 00 00 00       	mov    $0x0,%esi
+  802853:	bf 17 00 00 00       	mov    $0x17,%edi
+  802858:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  80285f:	ff ff ff 
+  802862:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802866:	ff d0                	call   *%rax
+  802868:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80286c:	c9                   	leave
+  80286d:	c3                   	ret
+
+000000000080286e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80286e:	55                   	push   %rbp
+  80286f:	48 89 e5             	mov    %rsp,%rbp
+  802872:	48 83 ec 10          	sub    $0x10,%rsp
+  802876:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802876 <sys_ipc_recv+0x8>
+  80287d:	49 bb ca 67 00 00 00 	movabs $0x67ca,%r11
+  802884:	00 00 00 
+  802887:	4c 01 d8             	add    %r11,%rax
+  80288a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80288e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802892:	6a 00                	push   $0x0
+  802894:	6a 00                	push   $0x0
+  802896:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80289c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8028ac:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8028b1:	49 ba 9e 91 ff ff ff 	movabs $0xffffffffffff919e,%r10
+  8028b8:	ff ff ff 
+  8028bb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028bf:	ff d0                	call   *%rax
+  8028c1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028c5:	c9                   	leave
+  8028c6:	c3                   	ret
+
+00000000008028c7 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8028c7:	55                   	push   %rbp
+  8028c8:	48 89 e5             	mov    %rsp,%rbp
+  8028cb:	48 83 ec 30          	sub    $0x30,%rsp
+  8028cf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028cf <sys_ipc_call+0x8>
+  8028d6:	49 bb 71 67 00 00 00 	movabs $0x6771,%r11
+  8028dd:	00 00 00 
+  8028e0:	4c 01 d8             	add    %r11,%rax
+  8028e3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028ea:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8028ee:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8028f1:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8028f5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8028f9:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8028fd:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802900:	4c 63 c2             	movslq %edx,%r8
+  802903:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802907:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80290a:	48 63 d2             	movslq %edx,%rdx
+  80290d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802911:	ff 75 d8             	push   -0x28(%rbp)
+  802914:	56                   	push   %rsi
+  802915:	4d 89 c1             	mov    %r8,%r9
+  802918:	49 89 f8             	mov    %rdi,%r8
+  80291b:	be 00 00 00 00       	mov    $0x0,%esi
+  802920:	bf 18 00 00 00       	mov    $0x18,%edi
+  802925:	49 ba 9e 91 ff ff ff 	movabs $0xffffffffffff919e,%r10
+  80292c:	ff ff ff 
+  80292f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802933:	ff d0                	call   *%rax
+  802935:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802939:	c9                   	leave
+  80293a:	c3                   	ret
+
+000000000080293b <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  80293b:	55                   	push   %rbp
+  80293c:	48 89 e5             	mov    %rsp,%rbp
+  80293f:	48 83 ec 30          	sub    $0x30,%rsp
+  802943:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802943 <sys_ipc_reply_recv+0x8>
+  80294a:	49 bb fd 66 00 00 00 	movabs $0x66fd,%r11
+  802951:	00 00 00 
+  802954:	4c 01 d8             	add    %r11,%rax
+  802957:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80295a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80295e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802962:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802965:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802969:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80296d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802971:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802974:	4c 63 c2             	movslq %edx,%r8
+  802977:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80297b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80297e:	48 63 d2             	movslq %edx,%rdx
+  802981:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802985:	ff 75 d8             	push   -0x28(%rbp)
+  802988:	56                   	push   %rsi
+  802989:	4d 89 c1             	mov    %r8,%r9
+  80298c:	49 89 f8             	mov    %rdi,%r8
+  80298f:	be 00 00 00 00       	mov    $0x0,%esi
+  802994:	bf 19 00 00 00       	mov    $0x19,%edi
+  802999:	49 ba 9e 91 ff ff ff 	movabs $0xffffffffffff919e,%r10
+  8029a0:	ff ff ff 
+  8029a3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029a7:	ff d0                	call   *%rax
+  8029a9:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8029ad:	c9                   	leave
+  8029ae:	c3                   	ret
+
+00000000008029af <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8029af:	55                   	push   %rbp
+  8029b0:	48 89 e5             	mov    %rsp,%rbp
+  8029b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8029b7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029b7 <sys_env_set_priority+0x8>
+  8029be:	49 bb 89 66 00 00 00 	movabs $0x6689,%r11
+  8029c5:	00 00 00 
+  8029c8:	4c 01 d8             	add    %r11,%rax
+  8029cb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8029ce:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8029d1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8029d4:	48 63 ca             	movslq %edx,%rcx
+  8029d7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8029da:	48 63 d2             	movslq %edx,%rdx
+  8029dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8029e1:	6a 00                	push   $0x0
+  8029e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029ef:	be 01 00 00 00       	mov    $0x1,%esi
+  8029f4:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8029f9:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  802a00:	ff ff ff 
+  802a03:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a07:	ff d0                	call   *%rax
+  802a09:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a0d:	c9                   	leave
+  802a0e:	c3                   	ret
+
+0000000000802a0f <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802a0f:	55                   	push   %rbp
+  802a10:	48 89 e5             	mov    %rsp,%rbp
+  802a13:	48 83 ec 10          	sub    $0x10,%rsp
+  802a17:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a17 <sys_env_set_affinity+0x8>
+  802a1e:	49 bb 29 66 00 00 00 	movabs $0x6629,%r11
+  802a25:	00 00 00 
+  802a28:	4c 01 d8             	add    %r11,%rax
+  802a2b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802a2e:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802a31:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802a34:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802a37:	48 63 d2             	movslq %edx,%rdx
+  802a3a:	48 83 ec 08          	sub    $0x8,%rsp
+  802a3e:	6a 00                	push   $0x0
+  802a40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a46:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a4c:	be 01 00 00 00       	mov    $0x1,%esi
+  802a51:	bf 10 00 00 00       	mov    $0x10,%edi
+  802a56:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  802a5d:	ff ff ff 
+  802a60:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a64:	ff d0                	call   *%rax
+  802a66:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a6a:	c9                   	leave
+  802a6b:	c3                   	ret
+
+0000000000802a6c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802a6c:	55                   	push   %rbp
+  802a6d:	48 89 e5             	mov    %rsp,%rbp
+  802a70:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a70 <sys_time_msec+0x4>
+  802a77:	49 bb d0 65 00 00 00 	movabs $0x65d0,%r11
+  802a7e:	00 00 00 
+  802a81:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802a84:	48 83 ec 08          	sub    $0x8,%rsp
+  802a88:	6a 00                	push   $0x0
+  802a8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aa0:	be 00 00 00 00       	mov    $0x0,%esi
+  802aa5:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802aaa:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  802ab1:	ff ff ff 
+  802ab4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802ab8:	ff d0                	call   *%rax
+  802aba:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802abe:	c9                   	leave
+  802abf:	c3                   	ret
+
+0000000000802ac0 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802ac0:	55                   	push   %rbp
+  802ac1:	48 89 e5             	mov    %rsp,%rbp
+  802ac4:	48 83 ec 10          	sub    $0x10,%rsp
+  802ac8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ac8 <sys_sleep_usec+0x8>
+  802acf:	49 bb 78 65 00 00 00 	movabs $0x6578,%r11
+  802ad6:	00 00 00 
+  802ad9:	4c 01 d8             	add    %r11,%rax
+  802adc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802ae0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ae4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ae8:	6a 00                	push   $0x0
+  802aea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802af0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802af6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802afb:	be 00 00 00 00       	mov    $0x0,%esi
+  802b00:	bf 11 00 00 00       	mov    $0x11,%edi
+  802b05:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  802b0c:	ff ff ff 
+  802b0f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b13:	ff d0                	call   *%rax
+  802b15:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b19:	c9                   	leave
+  802b1a:	c3                   	ret
+
+0000000000802b1b <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802b1b:	55                   	push   %rbp
+  802b1c:	48 89 e5             	mov    %rsp,%rbp
+  802b1f:	48 83 ec 10          	sub    $0x10,%rsp
+  802b23:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b23 <sys_page_alloc_huge+0x8>
+  802b2a:	49 bb 1d 65 00 00 00 	movabs $0x651d,%r11
+  802b31:	00 00 00 
+  802b34:	4c 01 d8             	add    %r11,%rax
+  802b37:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b3a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b3e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802b41:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802b44:	48 63 f2             	movslq %edx,%rsi
+  802b47:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802b4b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802b4e:	48 63 d2             	movslq %edx,%rdx
+  802b51:	48 83 ec 08          	sub    $0x8,%rsp
+  802b55:	6a 00                	push   $0x0
+  802b57:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b5d:	49 89 f0             	mov    %rsi,%r8
+  802b60:	be 01 00 00 00       	mov    $0x1,%esi
+  802b65:	bf 12 00 00 00       	mov    $0x12,%edi
+  802b6a:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  802b71:	ff ff ff 
+  802b74:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b78:	ff d0                	call   *%rax
+  802b7a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b7e:	c9                   	leave
+  802b7f:	c3                   	ret
+
+0000000000802b80 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802b80:	55                   	push   %rbp
+  802b81:	48 89 e5             	mov    %rsp,%rbp
+  802b84:	48 83 ec 10          	sub    $0x10,%rsp
+  802b88:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b88 <sys_page_map_batch+0x8>
+  802b8f:	49 bb b8 64 00 00 00 	movabs $0x64b8,%r11
+  802b96:	00 00 00 
+  802b99:	4c 01 d8             	add    %r11,%rax
+  802b9c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802ba0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802ba4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ba8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802bac:	48 83 ec 08          	sub    $0x8,%rsp
+  802bb0:	6a 00                	push   $0x0
+  802bb2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bb8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802bbe:	be 01 00 00 00       	mov    $0x1,%esi
+  802bc3:	bf 13 00 00 00       	mov    $0x13,%edi
+  802bc8:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  802bcf:	ff ff ff 
+  802bd2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802bd6:	ff d0                	call   *%rax
+  802bd8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bdc:	c9                   	leave
+  802bdd:	c3                   	ret
+
+0000000000802bde <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802bde:	55                   	push   %rbp
+  802bdf:	48 89 e5             	mov    %rsp,%rbp
+  802be2:	48 83 ec 10          	sub    $0x10,%rsp
+  802be6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802be6 <sys_page_alloc_batch+0x8>
+  802bed:	49 bb 5a 64 00 00 00 	movabs $0x645a,%r11
+  802bf4:	00 00 00 
+  802bf7:	4c 01 d8             	add    %r11,%rax
+  802bfa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802bfe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802c02:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c06:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802c0a:	48 83 ec 08          	sub    $0x8,%rsp
+  802c0e:	6a 00                	push   $0x0
+  802c10:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c1c:	be 01 00 00 00       	mov    $0x1,%esi
+  802c21:	bf 14 00 00 00       	mov    $0x14,%edi
+  802c26:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  802c2d:	ff ff ff 
+  802c30:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c34:	ff d0                	call   *%rax
+  802c36:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c3a:	c9                   	leave
+  802c3b:	c3                   	ret
+
+0000000000802c3c <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802c3c:	55                   	push   %rbp
+  802c3d:	48 89 e5             	mov    %rsp,%rbp
+  802c40:	48 83 ec 10          	sub    $0x10,%rsp
+  802c44:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c44 <sys_page_unmap_batch+0x8>
+  802c4b:	49 bb fc 63 00 00 00 	movabs $0x63fc,%r11
+  802c52:	00 00 00 
+  802c55:	4c 01 d8             	add    %r11,%rax
+  802c58:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c5c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802c60:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c64:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802c68:	48 83 ec 08          	sub    $0x8,%rsp
+  802c6c:	6a 00                	push   $0x0
+  802c6e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c74:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c7a:	be 01 00 00 00       	mov    $0x1,%esi
+  802c7f:	bf 15 00 00 00       	mov    $0x15,%edi
+  802c84:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  802c8b:	ff ff ff 
+  802c8e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c92:	ff d0                	call   *%rax
+  802c94:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c98:	c9                   	leave
+  802c99:	c3                   	ret
+
+0000000000802c9a <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802c9a:	55                   	push   %rbp
+  802c9b:	48 89 e5             	mov    %rsp,%rbp
+  802c9e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c9e <sys_fork+0x4>
+  802ca5:	49 bb a2 63 00 00 00 	movabs $0x63a2,%r11
+  802cac:	00 00 00 
+  802caf:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802cb2:	48 83 ec 08          	sub    $0x8,%rsp
+  802cb6:	6a 00                	push   $0x0
+  802cb8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802cbe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cc4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cce:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd3:	bf 16 00 00 00       	mov    $0x16,%edi
+  802cd8:	49 ba e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%r10
+  802cdf:	ff ff ff 
+  802ce2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802ce6:	ff d0                	call   *%rax
+  802ce8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802cec:	c9                   	leave
+  802ced:	c3                   	ret
+
+0000000000802cee <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802cee:	55                   	push   %rbp
+  802cef:	48 89 e5             	mov    %rsp,%rbp
+  802cf2:	41 57                	push   %r15
+  802cf4:	53                   	push   %rbx
+  802cf5:	48 83 ec 40          	sub    $0x40,%rsp
+  802cf9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802cf9 <pgfault+0xb>
+  802d00:	49 bb 47 63 00 00 00 	movabs $0x6347,%r11
+  802d07:	00 00 00 
+  802d0a:	4c 01 db             	add    %r11,%rbx
+  802d0d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  802d11:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d15:	48 8b 00             	mov    (%rax),%rax
+  802d18:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802d1c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d20:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802d24:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  802d27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d2b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802d2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d33:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802d39:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802d3d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802d40:	83 e0 02             	and    $0x2,%eax
+  802d43:	85 c0                	test   %eax,%eax
+  802d45:	0f 84 91 03 00 00    	je     8030dc <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802d4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d4f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d53:	48 89 c2             	mov    %rax,%rdx
+  802d56:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802d5d:	ff ff ff 
+  802d60:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d64:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d68:	83 e0 01             	and    $0x1,%eax
+  802d6b:	48 85 c0             	test   %rax,%rax
+  802d6e:	0f 84 a7 01 00 00    	je     802f1b <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802d74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d78:	48 c1 e8 15          	shr    $0x15,%rax
+  802d7c:	48 89 c2             	mov    %rax,%rdx
+  802d7f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802d86:	ff ff ff 
+  802d89:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d8d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d91:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802d96:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802d9c:	0f 85 79 01 00 00    	jne    802f1b <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802da2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802da6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802daa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802dae:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802db4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802db8:	ba 07 00 00 00       	mov    $0x7,%edx
+  802dbd:	be 00 00 60 00       	mov    $0x600000,%esi
+  802dc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc7:	49 89 df             	mov    %rbx,%r15
+  802dca:	48 b8 db 9a ff ff ff 	movabs $0xffffffffffff9adb,%rax
+  802dd1:	ff ff ff 
+  802dd4:	48 01 d8             	add    %rbx,%rax
+  802dd7:	ff d0                	call   *%rax
+  802dd9:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802ddc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802de0:	79 44                	jns    802e26 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802de2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802de5:	89 c1                	mov    %eax,%ecx
+  802de7:	48 b8 e0 e7 ff ff ff 	movabs $0xffffffffffffe7e0,%rax
+  802dee:	ff ff ff 
+  802df1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802df5:	48 89 c2             	mov    %rax,%rdx
+  802df8:	be 20 00 00 00       	mov    $0x20,%esi
+  802dfd:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  802e04:	ff ff ff 
+  802e07:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e0b:	48 89 c7             	mov    %rax,%rdi
+  802e0e:	49 89 df             	mov    %rbx,%r15
+  802e11:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e16:	49 b8 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r8
+  802e1d:	ff ff ff 
+  802e20:	49 01 d8             	add    %rbx,%r8
+  802e23:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802e26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e2a:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802e2f:	48 89 c6             	mov    %rax,%rsi
+  802e32:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802e37:	49 89 df             	mov    %rbx,%r15
+  802e3a:	48 b8 54 8d ff ff ff 	movabs $0xffffffffffff8d54,%rax
+  802e41:	ff ff ff 
+  802e44:	48 01 d8             	add    %rbx,%rax
+  802e47:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802e49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e4d:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802e53:	48 89 c1             	mov    %rax,%rcx
+  802e56:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e5b:	be 00 00 60 00       	mov    $0x600000,%esi
+  802e60:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e65:	49 89 df             	mov    %rbx,%r15
+  802e68:	48 b8 6a 95 ff ff ff 	movabs $0xffffffffffff956a,%rax
+  802e6f:	ff ff ff 
+  802e72:	48 01 d8             	add    %rbx,%rax
+  802e75:	ff d0                	call   *%rax
+  802e77:	85 c0                	test   %eax,%eax
+  802e79:	74 3e                	je     802eb9 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802e7b:	48 b8 0b e8 ff ff ff 	movabs $0xffffffffffffe80b,%rax
+  802e82:	ff ff ff 
+  802e85:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e89:	48 89 c2             	mov    %rax,%rdx
+  802e8c:	be 23 00 00 00       	mov    $0x23,%esi
+  802e91:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  802e98:	ff ff ff 
+  802e9b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e9f:	48 89 c7             	mov    %rax,%rdi
+  802ea2:	49 89 df             	mov    %rbx,%r15
+  802ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eaa:	48 b9 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%rcx
+  802eb1:	ff ff ff 
+  802eb4:	48 01 d9             	add    %rbx,%rcx
+  802eb7:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802eb9:	be 00 00 60 00       	mov    $0x600000,%esi
+  802ebe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ec3:	49 89 df             	mov    %rbx,%r15
+  802ec6:	48 b8 dd 95 ff ff ff 	movabs $0xffffffffffff95dd,%rax
+  802ecd:	ff ff ff 
+  802ed0:	48 01 d8             	add    %rbx,%rax
+  802ed3:	ff d0                	call   *%rax
+  802ed5:	85 c0                	test   %eax,%eax
+  802ed7:	0f 84 3d 02 00 00    	je     80311a <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802edd:	48 b8 20 e8 ff ff ff 	movabs $0xffffffffffffe820,%rax
+  802ee4:	ff ff ff 
+  802ee7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802eeb:	48 89 c2             	mov    %rax,%rdx
+  802eee:	be 25 00 00 00       	mov    $0x25,%esi
+  802ef3:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  802efa:	ff ff ff 
+  802efd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f01:	48 89 c7             	mov    %rax,%rdi
+  802f04:	49 89 df             	mov    %rbx,%r15
+  802f07:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0c:	48 b9 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%rcx
+  802f13:	ff ff ff 
+  802f16:	48 01 d9             	add    %rbx,%rcx
+  802f19:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802f1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f1f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f23:	48 89 c2             	mov    %rax,%rdx
+  802f26:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802f2d:	ff ff ff 
+  802f30:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f34:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f38:	25 00 08 00 00       	and    $0x800,%eax
+  802f3d:	48 85 c0             	test   %rax,%rax
+  802f40:	0f 84 58 01 00 00    	je     80309e <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802f46:	ba 07 00 00 00       	mov    $0x7,%edx
+  802f4b:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802f50:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f55:	49 89 df             	mov    %rbx,%r15
+  802f58:	48 b8 05 95 ff ff ff 	movabs $0xffffffffffff9505,%rax
+  802f5f:	ff ff ff 
+  802f62:	48 01 d8             	add    %rbx,%rax
+  802f65:	ff d0                	call   *%rax
+  802f67:	85 c0                	test   %eax,%eax
+  802f69:	74 3e                	je     802fa9 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802f6b:	48 b8 37 e8 ff ff ff 	movabs $0xffffffffffffe837,%rax
+  802f72:	ff ff ff 
+  802f75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f79:	48 89 c2             	mov    %rax,%rdx
+  802f7c:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802f81:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  802f88:	ff ff ff 
+  802f8b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f8f:	48 89 c7             	mov    %rax,%rdi
+  802f92:	49 89 df             	mov    %rbx,%r15
+  802f95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9a:	48 b9 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%rcx
+  802fa1:	ff ff ff 
+  802fa4:	48 01 d9             	add    %rbx,%rcx
+  802fa7:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802fa9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fb2:	48 89 c6             	mov    %rax,%rsi
+  802fb5:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802fba:	49 89 df             	mov    %rbx,%r15
+  802fbd:	48 b8 54 8d ff ff ff 	movabs $0xffffffffffff8d54,%rax
+  802fc4:	ff ff ff 
+  802fc7:	48 01 d8             	add    %rbx,%rax
+  802fca:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802fcc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fd0:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802fd6:	48 89 c1             	mov    %rax,%rcx
+  802fd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fde:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802fe3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fe8:	49 89 df             	mov    %rbx,%r15
+  802feb:	48 b8 6a 95 ff ff ff 	movabs $0xffffffffffff956a,%rax
+  802ff2:	ff ff ff 
+  802ff5:	48 01 d8             	add    %rbx,%rax
+  802ff8:	ff d0                	call   *%rax
+  802ffa:	85 c0                	test   %eax,%eax
+  802ffc:	74 3e                	je     80303c <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802ffe:	48 b8 0b e8 ff ff ff 	movabs $0xffffffffffffe80b,%rax
+  803005:	ff ff ff 
+  803008:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80300c:	48 89 c2             	mov    %rax,%rdx
+  80300f:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803014:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  80301b:	ff ff ff 
+  80301e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803022:	48 89 c7             	mov    %rax,%rdi
+  803025:	49 89 df             	mov    %rbx,%r15
+  803028:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302d:	48 b9 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%rcx
+  803034:	ff ff ff 
+  803037:	48 01 d9             	add    %rbx,%rcx
+  80303a:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  80303c:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  803041:	bf 00 00 00 00       	mov    $0x0,%edi
+  803046:	49 89 df             	mov    %rbx,%r15
+  803049:	48 b8 dd 95 ff ff ff 	movabs $0xffffffffffff95dd,%rax
+  803050:	ff ff ff 
+  803053:	48 01 d8             	add    %rbx,%rax
+  803056:	ff d0                	call   *%rax
+  803058:	85 c0                	test   %eax,%eax
+  80305a:	0f 84 bb 00 00 00    	je     80311b <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  803060:	48 b8 20 e8 ff ff ff 	movabs $0xffffffffffffe820,%rax
+  803067:	ff ff ff 
+  80306a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80306e:	48 89 c2             	mov    %rax,%rdx
+  803071:	be 32 00 00 00       	mov    $0x32,%esi
+  803076:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  80307d:	ff ff ff 
+  803080:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803084:	48 89 c7             	mov    %rax,%rdi
+  803087:	49 89 df             	mov    %rbx,%r15
+  80308a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308f:	48 b9 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%rcx
+  803096:	ff ff ff 
+  803099:	48 01 d9             	add    %rbx,%rcx
+  80309c:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  80309e:	48 b8 50 e8 ff ff ff 	movabs $0xffffffffffffe850,%rax
+  8030a5:	ff ff ff 
+  8030a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030ac:	48 89 c2             	mov    %rax,%rdx
+  8030af:	be 36 00 00 00       	mov    $0x36,%esi
+  8030b4:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  8030bb:	ff ff ff 
+  8030be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030c2:	48 89 c7             	mov    %rax,%rdi
+  8030c5:	49 89 df             	mov    %rbx,%r15
+  8030c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030cd:	48 b9 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%rcx
+  8030d4:	ff ff ff 
+  8030d7:	48 01 d9             	add    %rbx,%rcx
+  8030da:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  8030dc:	48 b8 6f e8 ff ff ff 	movabs $0xffffffffffffe86f,%rax
+  8030e3:	ff ff ff 
+  8030e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030ea:	48 89 c2             	mov    %rax,%rdx
+  8030ed:	be 3a 00 00 00       	mov    $0x3a,%esi
+  8030f2:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  8030f9:	ff ff ff 
+  8030fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803100:	48 89 c7             	mov    %rax,%rdi
+  803103:	49 89 df             	mov    %rbx,%r15
+  803106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80310b:	48 b9 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%rcx
+  803112:	ff ff ff 
+  803115:	48 01 d9             	add    %rbx,%rcx
+  803118:	ff d1                	call   *%rcx
+			return;
+  80311a:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  80311b:	48 83 c4 40          	add    $0x40,%rsp
+  80311f:	5b                   	pop    %rbx
+  803120:	41 5f                	pop    %r15
+  803122:	5d                   	pop    %rbp
+  803123:	c3                   	ret
+
+0000000000803124 <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  803124:	55                   	push   %rbp
+  803125:	48 89 e5             	mov    %rsp,%rbp
+  803128:	41 57                	push   %r15
+  80312a:	53                   	push   %rbx
+  80312b:	48 83 ec 10          	sub    $0x10,%rsp
+  80312f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80312f <fork_flush+0xb>
+  803136:	49 bb 11 5f 00 00 00 	movabs $0x5f11,%r11
+  80313d:	00 00 00 
+  803140:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  803143:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80314a:	00 00 00 
+  80314d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803151:	48 85 c0             	test   %rax,%rax
+  803154:	0f 84 81 00 00 00    	je     8031db <fork_flush+0xb7>
+  80315a:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803161:	00 00 00 
+  803164:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803168:	48 89 c6             	mov    %rax,%rsi
+  80316b:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  803172:	00 00 00 
+  803175:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803179:	48 89 c7             	mov    %rax,%rdi
+  80317c:	49 89 df             	mov    %rbx,%r15
+  80317f:	48 b8 40 9b ff ff ff 	movabs $0xffffffffffff9b40,%rax
+  803186:	ff ff ff 
+  803189:	48 01 d8             	add    %rbx,%rax
+  80318c:	ff d0                	call   *%rax
+  80318e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803191:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803195:	79 44                	jns    8031db <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  803197:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80319a:	89 c1                	mov    %eax,%ecx
+  80319c:	48 b8 88 e8 ff ff ff 	movabs $0xffffffffffffe888,%rax
+  8031a3:	ff ff ff 
+  8031a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031aa:	48 89 c2             	mov    %rax,%rdx
+  8031ad:	be 56 00 00 00       	mov    $0x56,%esi
+  8031b2:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  8031b9:	ff ff ff 
+  8031bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031c0:	48 89 c7             	mov    %rax,%rdi
+  8031c3:	49 89 df             	mov    %rbx,%r15
+  8031c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031cb:	49 b8 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r8
+  8031d2:	ff ff ff 
+  8031d5:	49 01 d8             	add    %rbx,%r8
+  8031d8:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  8031db:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  8031e2:	00 00 00 
+  8031e5:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  8031ec:	00 
+}
+  8031ed:	90                   	nop
+  8031ee:	48 83 c4 10          	add    $0x10,%rsp
+  8031f2:	5b                   	pop    %rbx
+  8031f3:	41 5f                	pop    %r15
+  8031f5:	5d                   	pop    %rbp
+  8031f6:	c3                   	ret
+
+00000000008031f7 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  8031f7:	55                   	push   %rbp
+  8031f8:	48 89 e5             	mov    %rsp,%rbp
+  8031fb:	53                   	push   %rbx
+  8031fc:	48 83 ec 28          	sub    $0x28,%rsp
+  803200:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803200 <fork_map+0x9>
+  803207:	49 bb 40 5e 00 00 00 	movabs $0x5e40,%r11
+  80320e:	00 00 00 
+  803211:	4c 01 db             	add    %r11,%rbx
+  803214:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803217:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80321b:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  80321e:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803225:	00 00 00 
+  803228:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80322c:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  803232:	75 10                	jne    803244 <fork_map+0x4d>
+		fork_flush();
+  803234:	48 b8 e4 a0 ff ff ff 	movabs $0xffffffffffffa0e4,%rax
+  80323b:	ff ff ff 
+  80323e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803242:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  803244:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80324b:	00 00 00 
+  80324e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803252:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803256:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  80325d:	00 00 00 
+  803260:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  803264:	48 c1 e0 05          	shl    $0x5,%rax
+  803268:	48 89 c2             	mov    %rax,%rdx
+  80326b:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  803272:	00 00 00 
+  803275:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803279:	48 01 d0             	add    %rdx,%rax
+  80327c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  803280:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803284:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  80328a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80328e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803292:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  803296:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80329a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80329d:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  8032a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032a4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8032a8:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  8032ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032b0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8032b3:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  8032b6:	90                   	nop
+  8032b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032bb:	c9                   	leave
+  8032bc:	c3                   	ret
+
+00000000008032bd <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  8032bd:	55                   	push   %rbp
+  8032be:	48 89 e5             	mov    %rsp,%rbp
+  8032c1:	53                   	push   %rbx
+  8032c2:	48 83 ec 28          	sub    $0x28,%rsp
+  8032c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032c6 <duppage+0x9>
+  8032cd:	49 bb 7a 5d 00 00 00 	movabs $0x5d7a,%r11
+  8032d4:	00 00 00 
+  8032d7:	4c 01 db             	add    %r11,%rbx
+  8032da:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8032dd:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  8032e0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8032e3:	48 c1 e0 0c          	shl    $0xc,%rax
+  8032e7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  8032eb:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8032f2:	ff ff ff 
+  8032f5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032f9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8032fc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803300:	25 00 04 00 00       	and    $0x400,%eax
+  803305:	48 85 c0             	test   %rax,%rax
+  803308:	74 42                	je     80334c <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  80330a:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803311:	ff ff ff 
+  803314:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803318:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80331b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80331f:	25 07 0e 00 00       	and    $0xe07,%eax
+  803324:	89 c2                	mov    %eax,%edx
+  803326:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80332a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80332d:	48 89 ce             	mov    %rcx,%rsi
+  803330:	89 c7                	mov    %eax,%edi
+  803332:	48 b8 b7 a1 ff ff ff 	movabs $0xffffffffffffa1b7,%rax
+  803339:	ff ff ff 
+  80333c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803340:	ff d0                	call   *%rax
+		return 0;
+  803342:	b8 00 00 00 00       	mov    $0x0,%eax
+  803347:	e9 ae 00 00 00       	jmp    8033fa <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  80334c:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803353:	ff ff ff 
+  803356:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80335a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80335d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803361:	83 e0 02             	and    $0x2,%eax
+  803364:	48 85 c0             	test   %rax,%rax
+  803367:	75 1f                	jne    803388 <duppage+0xcb>
+  803369:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803370:	ff ff ff 
+  803373:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803377:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80337a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80337e:	25 00 08 00 00       	and    $0x800,%eax
+  803383:	48 85 c0             	test   %rax,%rax
+  803386:	74 4c                	je     8033d4 <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  803388:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  80338f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803392:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803396:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803399:	48 89 ce             	mov    %rcx,%rsi
+  80339c:	89 c7                	mov    %eax,%edi
+  80339e:	48 b8 b7 a1 ff ff ff 	movabs $0xffffffffffffa1b7,%rax
+  8033a5:	ff ff ff 
+  8033a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033ac:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  8033ae:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8033b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033b5:	48 89 c6             	mov    %rax,%rsi
+  8033b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033bd:	48 b8 b7 a1 ff ff ff 	movabs $0xffffffffffffa1b7,%rax
+  8033c4:	ff ff ff 
+  8033c7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033cb:	ff d0                	call   *%rax
+		return 0;
+  8033cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d2:	eb 26                	jmp    8033fa <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  8033d4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8033d8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8033db:	ba 05 00 00 00       	mov    $0x5,%edx
+  8033e0:	48 89 ce             	mov    %rcx,%rsi
+  8033e3:	89 c7                	mov    %eax,%edi
+  8033e5:	48 b8 b7 a1 ff ff ff 	movabs $0xffffffffffffa1b7,%rax
+  8033ec:	ff ff ff 
+  8033ef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033f3:	ff d0                	call   *%rax
+		return 0;
+  8033f5:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  8033fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033fe:	c9                   	leave
+  8033ff:	c3                   	ret
+
+0000000000803400 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  803400:	55                   	push   %rbp
+  803401:	48 89 e5             	mov    %rsp,%rbp
+  803404:	53                   	push   %rbx
+  803405:	48 83 ec 28          	sub    $0x28,%rsp
+  803409:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803409 <duphuge+0x9>
+  803410:	49 bb 37 5c 00 00 00 	movabs $0x5c37,%r11
+  803417:	00 00 00 
+  80341a:	4c 01 db             	add    %r11,%rbx
+  80341d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803420:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  803424:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803428:	48 c1 e8 15          	shr    $0x15,%rax
+  80342c:	48 89 c2             	mov    %rax,%rdx
+  80342f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803436:	ff ff ff 
+  803439:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80343d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803441:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  803445:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803449:	25 00 04 00 00       	and    $0x400,%eax
+  80344e:	48 85 c0             	test   %rax,%rax
+  803451:	74 0e                	je     803461 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  803453:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803457:	25 07 0e 00 00       	and    $0xe07,%eax
+  80345c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80345f:	eb 1e                	jmp    80347f <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  803461:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803465:	25 02 08 00 00       	and    $0x802,%eax
+  80346a:	48 85 c0             	test   %rax,%rax
+  80346d:	74 09                	je     803478 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  80346f:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  803476:	eb 07                	jmp    80347f <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  803478:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  80347f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803482:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803486:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803489:	48 89 ce             	mov    %rcx,%rsi
+  80348c:	89 c7                	mov    %eax,%edi
+  80348e:	48 b8 b7 a1 ff ff ff 	movabs $0xffffffffffffa1b7,%rax
+  803495:	ff ff ff 
+  803498:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80349c:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  80349e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034a1:	25 00 08 00 00       	and    $0x800,%eax
+  8034a6:	85 c0                	test   %eax,%eax
+  8034a8:	74 1f                	je     8034c9 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  8034aa:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8034ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034b1:	48 89 c6             	mov    %rax,%rsi
+  8034b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034b9:	48 b8 b7 a1 ff ff ff 	movabs $0xffffffffffffa1b7,%rax
+  8034c0:	ff ff ff 
+  8034c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034c7:	ff d0                	call   *%rax
+	return 0;
+  8034c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034d2:	c9                   	leave
+  8034d3:	c3                   	ret
+
+00000000008034d4 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8034d4:	55                   	push   %rbp
+  8034d5:	48 89 e5             	mov    %rsp,%rbp
+  8034d8:	41 57                	push   %r15
+  8034da:	53                   	push   %rbx
+  8034db:	48 83 ec 10          	sub    $0x10,%rsp
+  8034df:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034df <fork+0xb>
+  8034e6:	49 bb 61 5b 00 00 00 	movabs $0x5b61,%r11
+  8034ed:	00 00 00 
+  8034f0:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  8034f3:	49 89 df             	mov    %rbx,%r15
+  8034f6:	48 b8 5a 9c ff ff ff 	movabs $0xffffffffffff9c5a,%rax
+  8034fd:	ff ff ff 
+  803500:	48 01 d8             	add    %rbx,%rax
+  803503:	ff d0                	call   *%rax
+  803505:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803508:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80350c:	75 42                	jne    803550 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80350e:	49 89 df             	mov    %rbx,%r15
+  803511:	48 b8 5c 94 ff ff ff 	movabs $0xffffffffffff945c,%rax
+  803518:	ff ff ff 
+  80351b:	48 01 d8             	add    %rbx,%rax
+  80351e:	ff d0                	call   *%rax
+  803520:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803525:	48 98                	cltq
+  803527:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80352e:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803535:	ff ff ff 
+  803538:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80353c:	48 01 c2             	add    %rax,%rdx
+  80353f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803546:	ff ff ff 
+  803549:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80354d:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  803550:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803553:	48 83 c4 10          	add    $0x10,%rsp
+  803557:	5b                   	pop    %rbx
+  803558:	41 5f                	pop    %r15
+  80355a:	5d                   	pop    %rbp
+  80355b:	c3                   	ret
+
+000000000080355c <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  80355c:	55                   	push   %rbp
+  80355d:	48 89 e5             	mov    %rsp,%rbp
+  803560:	41 57                	push   %r15
+  803562:	53                   	push   %rbx
+  803563:	48 83 ec 10          	sub    $0x10,%rsp
+  803567:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803567 <ufork+0xb>
+  80356e:	49 bb d9 5a 00 00 00 	movabs $0x5ad9,%r11
+  803575:	00 00 00 
+  803578:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  80357b:	48 b8 ae 9c ff ff ff 	movabs $0xffffffffffff9cae,%rax
+  803582:	ff ff ff 
+  803585:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803589:	48 89 c7             	mov    %rax,%rdi
+  80358c:	49 89 df             	mov    %rbx,%r15
+  80358f:	48 b8 1c d8 ff ff ff 	movabs $0xffffffffffffd81c,%rax
+  803596:	ff ff ff 
+  803599:	48 01 d8             	add    %rbx,%rax
+  80359c:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80359e:	b8 07 00 00 00       	mov    $0x7,%eax
+  8035a3:	cd 30                	int    $0x30
+  8035a5:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  8035a8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  8035ab:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  8035ae:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8035b2:	0f 84 03 02 00 00    	je     8037bb <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  8035b8:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8035bf:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  8035c0:	e9 28 01 00 00       	jmp    8036ed <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  8035c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035c9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8035cd:	48 89 c2             	mov    %rax,%rdx
+  8035d0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8035d7:	ff ff ff 
+  8035da:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035de:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035e2:	83 e0 01             	and    $0x1,%eax
+  8035e5:	48 85 c0             	test   %rax,%rax
+  8035e8:	0f 84 f7 00 00 00    	je     8036e5 <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  8035ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035f2:	48 c1 e8 15          	shr    $0x15,%rax
+  8035f6:	48 89 c2             	mov    %rax,%rdx
+  8035f9:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803600:	ff ff ff 
+  803603:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803607:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80360b:	25 81 00 00 00       	and    $0x81,%eax
+  803610:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  803616:	75 29                	jne    803641 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  803618:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80361c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80361f:	48 89 d6             	mov    %rdx,%rsi
+  803622:	89 c7                	mov    %eax,%edi
+  803624:	48 b8 c0 a3 ff ff ff 	movabs $0xffffffffffffa3c0,%rax
+  80362b:	ff ff ff 
+  80362e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803632:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  803634:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  80363b:	00 
+  80363c:	e9 ac 00 00 00       	jmp    8036ed <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  803641:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803645:	48 c1 e8 15          	shr    $0x15,%rax
+  803649:	48 89 c2             	mov    %rax,%rdx
+  80364c:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803653:	ff ff ff 
+  803656:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80365a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80365e:	83 e0 01             	and    $0x1,%eax
+  803661:	48 85 c0             	test   %rax,%rax
+  803664:	74 75                	je     8036db <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  803666:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80366a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80366e:	48 89 c2             	mov    %rax,%rdx
+  803671:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803678:	ff ff ff 
+  80367b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80367f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803683:	83 e0 01             	and    $0x1,%eax
+  803686:	48 85 c0             	test   %rax,%rax
+  803689:	74 46                	je     8036d1 <ufork+0x175>
+  80368b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80368f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803693:	48 89 c2             	mov    %rax,%rdx
+  803696:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80369d:	ff ff ff 
+  8036a0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8036a4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036a8:	83 e0 04             	and    $0x4,%eax
+  8036ab:	48 85 c0             	test   %rax,%rax
+  8036ae:	74 21                	je     8036d1 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  8036b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036b4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8036b8:	89 c2                	mov    %eax,%edx
+  8036ba:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8036bd:	89 d6                	mov    %edx,%esi
+  8036bf:	89 c7                	mov    %eax,%edi
+  8036c1:	48 b8 7d a2 ff ff ff 	movabs $0xffffffffffffa27d,%rax
+  8036c8:	ff ff ff 
+  8036cb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036cf:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  8036d1:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  8036d8:	00 
+  8036d9:	eb 12                	jmp    8036ed <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  8036db:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8036e2:	00 
+  8036e3:	eb 08                	jmp    8036ed <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  8036e5:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  8036ec:	40 
+		for (; addr < USTACKTOP;){
+  8036ed:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  8036f2:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8036f6:	0f 83 c9 fe ff ff    	jae    8035c5 <ufork+0x69>
+			}
+		}
+		fork_flush();
+  8036fc:	48 b8 e4 a0 ff ff ff 	movabs $0xffffffffffffa0e4,%rax
+  803703:	ff ff ff 
+  803706:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80370a:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  80370c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80370f:	ba 07 00 00 00       	mov    $0x7,%edx
+  803714:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  803719:	48 89 ce             	mov    %rcx,%rsi
+  80371c:	89 c7                	mov    %eax,%edi
+  80371e:	49 89 df             	mov    %rbx,%r15
+  803721:	48 b8 05 95 ff ff ff 	movabs $0xffffffffffff9505,%rax
+  803728:	ff ff ff 
+  80372b:	48 01 d8             	add    %rbx,%rax
+  80372e:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  803730:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803733:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  80373a:	ff ff ff 
+  80373d:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803741:	48 89 d6             	mov    %rdx,%rsi
+  803744:	89 c7                	mov    %eax,%edi
+  803746:	49 89 df             	mov    %rbx,%r15
+  803749:	48 b8 fb 96 ff ff ff 	movabs $0xffffffffffff96fb,%rax
+  803750:	ff ff ff 
+  803753:	48 01 d8             	add    %rbx,%rax
+  803756:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  803758:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80375b:	be 02 00 00 00       	mov    $0x2,%esi
+  803760:	89 c7                	mov    %eax,%edi
+  803762:	49 89 df             	mov    %rbx,%r15
+  803765:	48 b8 3c 96 ff ff ff 	movabs $0xffffffffffff963c,%rax
+  80376c:	ff ff ff 
+  80376f:	48 01 d8             	add    %rbx,%rax
+  803772:	ff d0                	call   *%rax
+  803774:	85 c0                	test   %eax,%eax
+  803776:	74 3e                	je     8037b6 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803778:	48 b8 af e8 ff ff ff 	movabs $0xffffffffffffe8af,%rax
+  80377f:	ff ff ff 
+  803782:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803786:	48 89 c2             	mov    %rax,%rdx
+  803789:	be 07 01 00 00       	mov    $0x107,%esi
+  80378e:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  803795:	ff ff ff 
+  803798:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80379c:	48 89 c7             	mov    %rax,%rdi
+  80379f:	49 89 df             	mov    %rbx,%r15
+  8037a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a7:	48 b9 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%rcx
+  8037ae:	ff ff ff 
+  8037b1:	48 01 d9             	add    %rbx,%rcx
+  8037b4:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  8037b6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8037b9:	eb 59                	jmp    803814 <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8037bb:	49 89 df             	mov    %rbx,%r15
+  8037be:	48 b8 5c 94 ff ff ff 	movabs $0xffffffffffff945c,%rax
+  8037c5:	ff ff ff 
+  8037c8:	48 01 d8             	add    %rbx,%rax
+  8037cb:	ff d0                	call   *%rax
+  8037cd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8037d2:	48 98                	cltq
+  8037d4:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8037db:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8037e2:	ff ff ff 
+  8037e5:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8037e9:	48 01 c2             	add    %rax,%rdx
+  8037ec:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8037f3:	ff ff ff 
+  8037f6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037fa:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  8037fd:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803804:	00 00 00 
+  803807:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  80380e:	00 
+		return 0;
+  80380f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  803814:	48 83 c4 10          	add    $0x10,%rsp
+  803818:	5b                   	pop    %rbx
+  803819:	41 5f                	pop    %r15
+  80381b:	5d                   	pop    %rbp
+  80381c:	c3                   	ret
+
+000000000080381d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80381d:	55                   	push   %rbp
+  80381e:	48 89 e5             	mov    %rsp,%rbp
+  803821:	41 57                	push   %r15
+  803823:	48 83 ec 08          	sub    $0x8,%rsp
+  803827:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803827 <sfork+0xa>
+  80382e:	49 bb 19 58 00 00 00 	movabs $0x5819,%r11
+  803835:	00 00 00 
+  803838:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  80383b:	48 b8 ca e8 ff ff ff 	movabs $0xffffffffffffe8ca,%rax
+  803842:	ff ff ff 
+  803845:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803849:	48 89 c2             	mov    %rax,%rdx
+  80384c:	be 1a 01 00 00       	mov    $0x11a,%esi
+  803851:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  803858:	ff ff ff 
+  80385b:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80385f:	48 89 c7             	mov    %rax,%rdi
+  803862:	49 89 cf             	mov    %rcx,%r15
+  803865:	b8 00 00 00 00       	mov    $0x0,%eax
+  80386a:	49 b8 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r8
+  803871:	ff ff ff 
+  803874:	49 01 c8             	add    %rcx,%r8
+  803877:	41 ff d0             	call   *%r8
+
+000000000080387a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  80387a:	55                   	push   %rbp
+  80387b:	48 89 e5             	mov    %rsp,%rbp
+  80387e:	48 83 ec 08          	sub    $0x8,%rsp
+  803882:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803882 <fd2num+0x8>
+  803889:	49 bb be 57 00 00 00 	movabs $0x57be,%r11
+  803890:	00 00 00 
+  803893:	4c 01 d8             	add    %r11,%rax
+  803896:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80389a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80389e:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8038a5:	ff ff ff 
+  8038a8:	48 01 d0             	add    %rdx,%rax
+  8038ab:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8038af:	c9                   	leave
+  8038b0:	c3                   	ret
+
+00000000008038b1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8038b1:	55                   	push   %rbp
+  8038b2:	48 89 e5             	mov    %rsp,%rbp
+  8038b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8038b9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8038b9 <fd2data+0x8>
+  8038c0:	49 bb 87 57 00 00 00 	movabs $0x5787,%r11
+  8038c7:	00 00 00 
+  8038ca:	4c 01 d8             	add    %r11,%rax
+  8038cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  8038d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8038d5:	48 89 d7             	mov    %rdx,%rdi
+  8038d8:	48 ba 3a a8 ff ff ff 	movabs $0xffffffffffffa83a,%rdx
+  8038df:	ff ff ff 
+  8038e2:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8038e6:	ff d0                	call   *%rax
+  8038e8:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8038ee:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8038f2:	c9                   	leave
+  8038f3:	c3                   	ret
+
+00000000008038f4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8038f4:	55                   	push   %rbp
+  8038f5:	48 89 e5             	mov    %rsp,%rbp
+  8038f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8038fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8038fc <fd_alloc+0x8>
+  803903:	49 bb 44 57 00 00 00 	movabs $0x5744,%r11
+  80390a:	00 00 00 
+  80390d:	4c 01 d8             	add    %r11,%rax
+  803910:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803914:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80391b:	eb 75                	jmp    803992 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  80391d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803920:	48 63 d2             	movslq %edx,%rdx
+  803923:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  80392a:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80392e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803932:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803936:	48 89 d1             	mov    %rdx,%rcx
+  803939:	48 c1 e9 15          	shr    $0x15,%rcx
+  80393d:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803944:	ff ff ff 
+  803947:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80394b:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80394f:	83 e2 01             	and    $0x1,%edx
+  803952:	48 85 d2             	test   %rdx,%rdx
+  803955:	74 25                	je     80397c <fd_alloc+0x88>
+  803957:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80395b:	48 89 d1             	mov    %rdx,%rcx
+  80395e:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803962:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803969:	ff ff ff 
+  80396c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803970:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803974:	83 e2 01             	and    $0x1,%edx
+  803977:	48 85 d2             	test   %rdx,%rdx
+  80397a:	75 12                	jne    80398e <fd_alloc+0x9a>
+			*fd_store = fd;
+  80397c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803980:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803984:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398c:	eb 1a                	jmp    8039a8 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  80398e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803992:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803996:	7e 85                	jle    80391d <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803998:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80399c:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  8039a3:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  8039a8:	c9                   	leave
+  8039a9:	c3                   	ret
+
+00000000008039aa <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8039aa:	55                   	push   %rbp
+  8039ab:	48 89 e5             	mov    %rsp,%rbp
+  8039ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8039b2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8039b2 <fd_lookup+0x8>
+  8039b9:	49 bb 8e 56 00 00 00 	movabs $0x568e,%r11
+  8039c0:	00 00 00 
+  8039c3:	4c 01 d8             	add    %r11,%rax
+  8039c6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8039c9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8039cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039d1:	78 06                	js     8039d9 <fd_lookup+0x2f>
+  8039d3:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8039d7:	7e 07                	jle    8039e0 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8039d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039de:	eb 73                	jmp    803a53 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  8039e0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8039e3:	48 63 d2             	movslq %edx,%rdx
+  8039e6:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8039ed:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8039f1:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8039f5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8039f9:	48 89 d1             	mov    %rdx,%rcx
+  8039fc:	48 c1 e9 15          	shr    $0x15,%rcx
+  803a00:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803a07:	ff ff ff 
+  803a0a:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803a0e:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803a12:	83 e2 01             	and    $0x1,%edx
+  803a15:	48 85 d2             	test   %rdx,%rdx
+  803a18:	74 22                	je     803a3c <fd_lookup+0x92>
+  803a1a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a1e:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803a22:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  803a29:	ff ff ff 
+  803a2c:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803a30:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a34:	83 e0 01             	and    $0x1,%eax
+  803a37:	48 85 c0             	test   %rax,%rax
+  803a3a:	75 07                	jne    803a43 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803a3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a41:	eb 10                	jmp    803a53 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803a43:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a47:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a4b:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a53:	c9                   	leave
+  803a54:	c3                   	ret
+
+0000000000803a55 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803a55:	55                   	push   %rbp
+  803a56:	48 89 e5             	mov    %rsp,%rbp
+  803a59:	41 57                	push   %r15
+  803a5b:	53                   	push   %rbx
+  803a5c:	48 83 ec 30          	sub    $0x30,%rsp
+  803a60:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a60 <fd_close+0xb>
+  803a67:	49 bb e0 55 00 00 00 	movabs $0x55e0,%r11
+  803a6e:	00 00 00 
+  803a71:	4c 01 db             	add    %r11,%rbx
+  803a74:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803a78:	89 f0                	mov    %esi,%eax
+  803a7a:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803a7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a81:	48 89 c7             	mov    %rax,%rdi
+  803a84:	48 b8 3a a8 ff ff ff 	movabs $0xffffffffffffa83a,%rax
+  803a8b:	ff ff ff 
+  803a8e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a92:	ff d0                	call   *%rax
+  803a94:	89 c2                	mov    %eax,%edx
+  803a96:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803a9a:	48 89 c6             	mov    %rax,%rsi
+  803a9d:	89 d7                	mov    %edx,%edi
+  803a9f:	48 b8 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rax
+  803aa6:	ff ff ff 
+  803aa9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803aad:	ff d0                	call   *%rax
+  803aaf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ab2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ab6:	78 0a                	js     803ac2 <fd_close+0x6d>
+	    || fd != fd2)
+  803ab8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803abc:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803ac0:	74 12                	je     803ad4 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803ac2:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803ac6:	74 05                	je     803acd <fd_close+0x78>
+  803ac8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803acb:	eb 7a                	jmp    803b47 <fd_close+0xf2>
+  803acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad2:	eb 73                	jmp    803b47 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803ad4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ad8:	8b 00                	mov    (%rax),%eax
+  803ada:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803ade:	48 89 d6             	mov    %rdx,%rsi
+  803ae1:	89 c7                	mov    %eax,%edi
+  803ae3:	48 b8 10 ab ff ff ff 	movabs $0xffffffffffffab10,%rax
+  803aea:	ff ff ff 
+  803aed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803af1:	ff d0                	call   *%rax
+  803af3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803af6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803afa:	78 2a                	js     803b26 <fd_close+0xd1>
+		if (dev->dev_close)
+  803afc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b00:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803b04:	48 85 c0             	test   %rax,%rax
+  803b07:	74 16                	je     803b1f <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  803b09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b0d:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803b11:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b15:	48 89 c7             	mov    %rax,%rdi
+  803b18:	ff d2                	call   *%rdx
+  803b1a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b1d:	eb 07                	jmp    803b26 <fd_close+0xd1>
+		else
+			r = 0;
+  803b1f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  803b26:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b2a:	48 89 c6             	mov    %rax,%rsi
+  803b2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b32:	49 89 df             	mov    %rbx,%r15
+  803b35:	48 b8 dd 95 ff ff ff 	movabs $0xffffffffffff95dd,%rax
+  803b3c:	ff ff ff 
+  803b3f:	48 01 d8             	add    %rbx,%rax
+  803b42:	ff d0                	call   *%rax
+	return r;
+  803b44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803b47:	48 83 c4 30          	add    $0x30,%rsp
+  803b4b:	5b                   	pop    %rbx
+  803b4c:	41 5f                	pop    %r15
+  803b4e:	5d                   	pop    %rbp
+  803b4f:	c3                   	ret
+
+0000000000803b50 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  803b50:	55                   	push   %rbp
+  803b51:	48 89 e5             	mov    %rsp,%rbp
+  803b54:	41 57                	push   %r15
+  803b56:	48 83 ec 28          	sub    $0x28,%rsp
+  803b5a:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803b5a <dev_lookup+0xa>
+  803b61:	49 bb e6 54 00 00 00 	movabs $0x54e6,%r11
+  803b68:	00 00 00 
+  803b6b:	4c 01 d9             	add    %r11,%rcx
+  803b6e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803b71:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803b75:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803b7c:	eb 45                	jmp    803bc3 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803b7e:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803b85:	00 00 00 
+  803b88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b8b:	48 98                	cltq
+  803b8d:	48 01 ca             	add    %rcx,%rdx
+  803b90:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b94:	8b 00                	mov    (%rax),%eax
+  803b96:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803b99:	75 24                	jne    803bbf <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803b9b:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803ba2:	00 00 00 
+  803ba5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ba8:	48 98                	cltq
+  803baa:	48 01 ca             	add    %rcx,%rdx
+  803bad:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bb1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bb5:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bbd:	eb 74                	jmp    803c33 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803bbf:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803bc3:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803bca:	00 00 00 
+  803bcd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bd0:	48 98                	cltq
+  803bd2:	48 01 ca             	add    %rcx,%rdx
+  803bd5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803bd9:	48 85 c0             	test   %rax,%rax
+  803bdc:	75 a0                	jne    803b7e <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803bde:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803be5:	ff ff ff 
+  803be8:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803bec:	48 8b 00             	mov    (%rax),%rax
+  803bef:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803bf5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803bf8:	89 c6                	mov    %eax,%esi
+  803bfa:	48 b8 e0 e8 ff ff ff 	movabs $0xffffffffffffe8e0,%rax
+  803c01:	ff ff ff 
+  803c04:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803c08:	48 89 c7             	mov    %rax,%rdi
+  803c0b:	49 89 cf             	mov    %rcx,%r15
+  803c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c13:	49 b8 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%r8
+  803c1a:	ff ff ff 
+  803c1d:	49 01 c8             	add    %rcx,%r8
+  803c20:	41 ff d0             	call   *%r8
+	*dev = 0;
+  803c23:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c27:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  803c2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803c33:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803c37:	c9                   	leave
+  803c38:	c3                   	ret
+
+0000000000803c39 <close>:
+
+int
+close(int fdnum)
+{
+  803c39:	55                   	push   %rbp
+  803c3a:	48 89 e5             	mov    %rsp,%rbp
+  803c3d:	53                   	push   %rbx
+  803c3e:	48 83 ec 28          	sub    $0x28,%rsp
+  803c42:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c42 <close+0x9>
+  803c49:	49 bb fe 53 00 00 00 	movabs $0x53fe,%r11
+  803c50:	00 00 00 
+  803c53:	4c 01 db             	add    %r11,%rbx
+  803c56:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c59:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803c5d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c60:	48 89 d6             	mov    %rdx,%rsi
+  803c63:	89 c7                	mov    %eax,%edi
+  803c65:	48 b8 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rax
+  803c6c:	ff ff ff 
+  803c6f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c73:	ff d0                	call   *%rax
+  803c75:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c78:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c7c:	79 05                	jns    803c83 <close+0x4a>
+		return r;
+  803c7e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c81:	eb 1c                	jmp    803c9f <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803c83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c87:	be 01 00 00 00       	mov    $0x1,%esi
+  803c8c:	48 89 c7             	mov    %rax,%rdi
+  803c8f:	48 b8 15 aa ff ff ff 	movabs $0xffffffffffffaa15,%rax
+  803c96:	ff ff ff 
+  803c99:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c9d:	ff d0                	call   *%rax
+}
+  803c9f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ca3:	c9                   	leave
+  803ca4:	c3                   	ret
+
+0000000000803ca5 <close_all>:
+
+void
+close_all(void)
+{
+  803ca5:	55                   	push   %rbp
+  803ca6:	48 89 e5             	mov    %rsp,%rbp
+  803ca9:	53                   	push   %rbx
+  803caa:	48 83 ec 18          	sub    $0x18,%rsp
+  803cae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cae <close_all+0x9>
+  803cb5:	49 bb 92 53 00 00 00 	movabs $0x5392,%r11
+  803cbc:	00 00 00 
+  803cbf:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803cc2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803cc9:	eb 19                	jmp    803ce4 <close_all+0x3f>
+		close(i);
+  803ccb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cce:	89 c7                	mov    %eax,%edi
+  803cd0:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  803cd7:	ff ff ff 
+  803cda:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cde:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803ce0:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803ce4:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803ce8:	7e e1                	jle    803ccb <close_all+0x26>
+}
+  803cea:	90                   	nop
+  803ceb:	90                   	nop
+  803cec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803cf0:	c9                   	leave
+  803cf1:	c3                   	ret
+
+0000000000803cf2 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  803cf2:	55                   	push   %rbp
+  803cf3:	48 89 e5             	mov    %rsp,%rbp
+  803cf6:	41 57                	push   %r15
+  803cf8:	53                   	push   %rbx
+  803cf9:	48 83 ec 40          	sub    $0x40,%rsp
+  803cfd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cfd <dup+0xb>
+  803d04:	49 bb 43 53 00 00 00 	movabs $0x5343,%r11
+  803d0b:	00 00 00 
+  803d0e:	4c 01 db             	add    %r11,%rbx
+  803d11:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803d14:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803d17:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803d1b:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803d1e:	48 89 d6             	mov    %rdx,%rsi
+  803d21:	89 c7                	mov    %eax,%edi
+  803d23:	48 b8 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rax
+  803d2a:	ff ff ff 
+  803d2d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d31:	ff d0                	call   *%rax
+  803d33:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d36:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d3a:	79 08                	jns    803d44 <dup+0x52>
+		return r;
+  803d3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d3f:	e9 a4 01 00 00       	jmp    803ee8 <dup+0x1f6>
+	close(newfdnum);
+  803d44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803d47:	89 c7                	mov    %eax,%edi
+  803d49:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  803d50:	ff ff ff 
+  803d53:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d57:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803d59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803d5c:	48 98                	cltq
+  803d5e:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803d64:	48 c1 e0 0c          	shl    $0xc,%rax
+  803d68:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803d6c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d70:	48 89 c7             	mov    %rax,%rdi
+  803d73:	48 b8 71 a8 ff ff ff 	movabs $0xffffffffffffa871,%rax
+  803d7a:	ff ff ff 
+  803d7d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d81:	ff d0                	call   *%rax
+  803d83:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803d87:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d8b:	48 89 c7             	mov    %rax,%rdi
+  803d8e:	48 b8 71 a8 ff ff ff 	movabs $0xffffffffffffa871,%rax
+  803d95:	ff ff ff 
+  803d98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d9c:	ff d0                	call   *%rax
+  803d9e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  803da2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803da6:	48 c1 e8 15          	shr    $0x15,%rax
+  803daa:	48 89 c2             	mov    %rax,%rdx
+  803dad:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803db4:	ff ff ff 
+  803db7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803dbb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803dbf:	83 e0 01             	and    $0x1,%eax
+  803dc2:	48 85 c0             	test   %rax,%rax
+  803dc5:	74 7f                	je     803e46 <dup+0x154>
+  803dc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dcb:	48 c1 e8 0c          	shr    $0xc,%rax
+  803dcf:	48 89 c2             	mov    %rax,%rdx
+  803dd2:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803dd9:	ff ff ff 
+  803ddc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803de0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803de4:	83 e0 01             	and    $0x1,%eax
+  803de7:	48 85 c0             	test   %rax,%rax
+  803dea:	74 5a                	je     803e46 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803dec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803df0:	48 c1 e8 0c          	shr    $0xc,%rax
+  803df4:	48 89 c2             	mov    %rax,%rdx
+  803df7:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803dfe:	ff ff ff 
+  803e01:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803e05:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803e09:	25 07 0e 00 00       	and    $0xe07,%eax
+  803e0e:	89 c1                	mov    %eax,%ecx
+  803e10:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803e14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e18:	41 89 c8             	mov    %ecx,%r8d
+  803e1b:	48 89 d1             	mov    %rdx,%rcx
+  803e1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e23:	48 89 c6             	mov    %rax,%rsi
+  803e26:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e2b:	49 89 df             	mov    %rbx,%r15
+  803e2e:	48 b8 6a 95 ff ff ff 	movabs $0xffffffffffff956a,%rax
+  803e35:	ff ff ff 
+  803e38:	48 01 d8             	add    %rbx,%rax
+  803e3b:	ff d0                	call   *%rax
+  803e3d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e40:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e44:	78 5f                	js     803ea5 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803e46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e4a:	48 c1 e8 0c          	shr    $0xc,%rax
+  803e4e:	48 89 c2             	mov    %rax,%rdx
+  803e51:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803e58:	ff ff ff 
+  803e5b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803e5f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803e63:	25 07 0e 00 00       	and    $0xe07,%eax
+  803e68:	89 c1                	mov    %eax,%ecx
+  803e6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e6e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e72:	41 89 c8             	mov    %ecx,%r8d
+  803e75:	48 89 d1             	mov    %rdx,%rcx
+  803e78:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e7d:	48 89 c6             	mov    %rax,%rsi
+  803e80:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e85:	49 89 df             	mov    %rbx,%r15
+  803e88:	48 b8 6a 95 ff ff ff 	movabs $0xffffffffffff956a,%rax
+  803e8f:	ff ff ff 
+  803e92:	48 01 d8             	add    %rbx,%rax
+  803e95:	ff d0                	call   *%rax
+  803e97:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e9a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e9e:	78 08                	js     803ea8 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803ea0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ea3:	eb 43                	jmp    803ee8 <dup+0x1f6>
+			goto err;
+  803ea5:	90                   	nop
+  803ea6:	eb 01                	jmp    803ea9 <dup+0x1b7>
+		goto err;
+  803ea8:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803ea9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ead:	48 89 c6             	mov    %rax,%rsi
+  803eb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eb5:	49 89 df             	mov    %rbx,%r15
+  803eb8:	48 b8 dd 95 ff ff ff 	movabs $0xffffffffffff95dd,%rax
+  803ebf:	ff ff ff 
+  803ec2:	48 01 d8             	add    %rbx,%rax
+  803ec5:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803ec7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ecb:	48 89 c6             	mov    %rax,%rsi
+  803ece:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ed3:	49 89 df             	mov    %rbx,%r15
+  803ed6:	48 b8 dd 95 ff ff ff 	movabs $0xffffffffffff95dd,%rax
+  803edd:	ff ff ff 
+  803ee0:	48 01 d8             	add    %rbx,%rax
+  803ee3:	ff d0                	call   *%rax
+	return r;
+  803ee5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803ee8:	48 83 c4 40          	add    $0x40,%rsp
+  803eec:	5b                   	pop    %rbx
+  803eed:	41 5f                	pop    %r15
+  803eef:	5d                   	pop    %rbp
+  803ef0:	c3                   	ret
+
+0000000000803ef1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803ef1:	55                   	push   %rbp
+  803ef2:	48 89 e5             	mov    %rsp,%rbp
+  803ef5:	41 57                	push   %r15
+  803ef7:	53                   	push   %rbx
+  803ef8:	48 83 ec 40          	sub    $0x40,%rsp
+  803efc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803efc <read+0xb>
+  803f03:	49 bb 44 51 00 00 00 	movabs $0x5144,%r11
+  803f0a:	00 00 00 
+  803f0d:	4c 01 db             	add    %r11,%rbx
+  803f10:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803f13:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803f17:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803f1b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803f1f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803f22:	48 89 d6             	mov    %rdx,%rsi
+  803f25:	89 c7                	mov    %eax,%edi
+  803f27:	48 b8 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rax
+  803f2e:	ff ff ff 
+  803f31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f35:	ff d0                	call   *%rax
+  803f37:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f3a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f3e:	78 28                	js     803f68 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803f40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f44:	8b 00                	mov    (%rax),%eax
+  803f46:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803f4a:	48 89 d6             	mov    %rdx,%rsi
+  803f4d:	89 c7                	mov    %eax,%edi
+  803f4f:	48 b8 10 ab ff ff ff 	movabs $0xffffffffffffab10,%rax
+  803f56:	ff ff ff 
+  803f59:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f5d:	ff d0                	call   *%rax
+  803f5f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f62:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f66:	79 08                	jns    803f70 <read+0x7f>
+		return r;
+  803f68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f6b:	e9 8b 00 00 00       	jmp    803ffb <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803f70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f74:	8b 40 08             	mov    0x8(%rax),%eax
+  803f77:	83 e0 03             	and    $0x3,%eax
+  803f7a:	83 f8 01             	cmp    $0x1,%eax
+  803f7d:	75 4b                	jne    803fca <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803f7f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803f86:	ff ff ff 
+  803f89:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803f8d:	48 8b 00             	mov    (%rax),%rax
+  803f90:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803f96:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803f99:	89 c6                	mov    %eax,%esi
+  803f9b:	48 b8 ff e8 ff ff ff 	movabs $0xffffffffffffe8ff,%rax
+  803fa2:	ff ff ff 
+  803fa5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fa9:	48 89 c7             	mov    %rax,%rdi
+  803fac:	49 89 df             	mov    %rbx,%r15
+  803faf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb4:	48 b9 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rcx
+  803fbb:	ff ff ff 
+  803fbe:	48 01 d9             	add    %rbx,%rcx
+  803fc1:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803fc3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fc8:	eb 31                	jmp    803ffb <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803fca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fce:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803fd2:	48 85 c0             	test   %rax,%rax
+  803fd5:	75 07                	jne    803fde <read+0xed>
+		return -E_NOT_SUPP;
+  803fd7:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803fdc:	eb 1d                	jmp    803ffb <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803fde:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fe2:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803fe6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fea:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803fee:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803ff2:	48 89 ce             	mov    %rcx,%rsi
+  803ff5:	48 89 c7             	mov    %rax,%rdi
+  803ff8:	41 ff d0             	call   *%r8
+}
+  803ffb:	48 83 c4 40          	add    $0x40,%rsp
+  803fff:	5b                   	pop    %rbx
+  804000:	41 5f                	pop    %r15
+  804002:	5d                   	pop    %rbp
+  804003:	c3                   	ret
+
+0000000000804004 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  804004:	55                   	push   %rbp
+  804005:	48 89 e5             	mov    %rsp,%rbp
+  804008:	53                   	push   %rbx
+  804009:	48 83 ec 38          	sub    $0x38,%rsp
+  80400d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80400d <readn+0x9>
+  804014:	49 bb 33 50 00 00 00 	movabs $0x5033,%r11
+  80401b:	00 00 00 
+  80401e:	4c 01 db             	add    %r11,%rbx
+  804021:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804024:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804028:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80402c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804033:	eb 4b                	jmp    804080 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  804035:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804038:	48 98                	cltq
+  80403a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80403e:	48 29 c2             	sub    %rax,%rdx
+  804041:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804044:	48 63 c8             	movslq %eax,%rcx
+  804047:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80404b:	48 01 c1             	add    %rax,%rcx
+  80404e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804051:	48 89 ce             	mov    %rcx,%rsi
+  804054:	89 c7                	mov    %eax,%edi
+  804056:	48 b8 b1 ae ff ff ff 	movabs $0xffffffffffffaeb1,%rax
+  80405d:	ff ff ff 
+  804060:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804064:	ff d0                	call   *%rax
+  804066:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  804069:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80406d:	79 05                	jns    804074 <readn+0x70>
+			return m;
+  80406f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804072:	eb 1d                	jmp    804091 <readn+0x8d>
+		if (m == 0)
+  804074:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804078:	74 13                	je     80408d <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  80407a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80407d:	01 45 ec             	add    %eax,-0x14(%rbp)
+  804080:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804083:	48 98                	cltq
+  804085:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  804089:	72 aa                	jb     804035 <readn+0x31>
+  80408b:	eb 01                	jmp    80408e <readn+0x8a>
+			break;
+  80408d:	90                   	nop
+	}
+	return tot;
+  80408e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804091:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804095:	c9                   	leave
+  804096:	c3                   	ret
+
+0000000000804097 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  804097:	55                   	push   %rbp
+  804098:	48 89 e5             	mov    %rsp,%rbp
+  80409b:	41 57                	push   %r15
+  80409d:	53                   	push   %rbx
+  80409e:	48 83 ec 40          	sub    $0x40,%rsp
+  8040a2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8040a2 <write+0xb>
+  8040a9:	49 bb 9e 4f 00 00 00 	movabs $0x4f9e,%r11
+  8040b0:	00 00 00 
+  8040b3:	4c 01 db             	add    %r11,%rbx
+  8040b6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8040b9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8040bd:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8040c1:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8040c5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8040c8:	48 89 d6             	mov    %rdx,%rsi
+  8040cb:	89 c7                	mov    %eax,%edi
+  8040cd:	48 b8 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rax
+  8040d4:	ff ff ff 
+  8040d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040db:	ff d0                	call   *%rax
+  8040dd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040e0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040e4:	78 28                	js     80410e <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8040e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040ea:	8b 00                	mov    (%rax),%eax
+  8040ec:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8040f0:	48 89 d6             	mov    %rdx,%rsi
+  8040f3:	89 c7                	mov    %eax,%edi
+  8040f5:	48 b8 10 ab ff ff ff 	movabs $0xffffffffffffab10,%rax
+  8040fc:	ff ff ff 
+  8040ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804103:	ff d0                	call   *%rax
+  804105:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804108:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80410c:	79 08                	jns    804116 <write+0x7f>
+		return r;
+  80410e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804111:	e9 8a 00 00 00       	jmp    8041a0 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804116:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80411a:	8b 40 08             	mov    0x8(%rax),%eax
+  80411d:	83 e0 03             	and    $0x3,%eax
+  804120:	85 c0                	test   %eax,%eax
+  804122:	75 4b                	jne    80416f <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  804124:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80412b:	ff ff ff 
+  80412e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804132:	48 8b 00             	mov    (%rax),%rax
+  804135:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80413b:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80413e:	89 c6                	mov    %eax,%esi
+  804140:	48 b8 1b e9 ff ff ff 	movabs $0xffffffffffffe91b,%rax
+  804147:	ff ff ff 
+  80414a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80414e:	48 89 c7             	mov    %rax,%rdi
+  804151:	49 89 df             	mov    %rbx,%r15
+  804154:	b8 00 00 00 00       	mov    $0x0,%eax
+  804159:	48 b9 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rcx
+  804160:	ff ff ff 
+  804163:	48 01 d9             	add    %rbx,%rcx
+  804166:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804168:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80416d:	eb 31                	jmp    8041a0 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80416f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804173:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804177:	48 85 c0             	test   %rax,%rax
+  80417a:	75 07                	jne    804183 <write+0xec>
+		return -E_NOT_SUPP;
+  80417c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804181:	eb 1d                	jmp    8041a0 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  804183:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804187:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80418b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80418f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804193:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804197:	48 89 ce             	mov    %rcx,%rsi
+  80419a:	48 89 c7             	mov    %rax,%rdi
+  80419d:	41 ff d0             	call   *%r8
+}
+  8041a0:	48 83 c4 40          	add    $0x40,%rsp
+  8041a4:	5b                   	pop    %rbx
+  8041a5:	41 5f                	pop    %r15
+  8041a7:	5d                   	pop    %rbp
+  8041a8:	c3                   	ret
+
+00000000008041a9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8041a9:	55                   	push   %rbp
+  8041aa:	48 89 e5             	mov    %rsp,%rbp
+  8041ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8041b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8041b1 <seek+0x8>
+  8041b8:	49 bb 8f 4e 00 00 00 	movabs $0x4e8f,%r11
+  8041bf:	00 00 00 
+  8041c2:	4c 01 d8             	add    %r11,%rax
+  8041c5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8041c8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8041cb:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8041cf:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8041d2:	48 89 ce             	mov    %rcx,%rsi
+  8041d5:	89 d7                	mov    %edx,%edi
+  8041d7:	48 ba 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rdx
+  8041de:	ff ff ff 
+  8041e1:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8041e5:	ff d0                	call   *%rax
+  8041e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8041ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8041ee:	79 05                	jns    8041f5 <seek+0x4c>
+		return r;
+  8041f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041f3:	eb 0f                	jmp    804204 <seek+0x5b>
+	fd->fd_offset = offset;
+  8041f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041f9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8041fc:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8041ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804204:	c9                   	leave
+  804205:	c3                   	ret
+
+0000000000804206 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  804206:	55                   	push   %rbp
+  804207:	48 89 e5             	mov    %rsp,%rbp
+  80420a:	41 57                	push   %r15
+  80420c:	53                   	push   %rbx
+  80420d:	48 83 ec 30          	sub    $0x30,%rsp
+  804211:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804211 <ftruncate+0xb>
+  804218:	49 bb 2f 4e 00 00 00 	movabs $0x4e2f,%r11
+  80421f:	00 00 00 
+  804222:	4c 01 db             	add    %r11,%rbx
+  804225:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804228:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80422b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80422f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804232:	48 89 d6             	mov    %rdx,%rsi
+  804235:	89 c7                	mov    %eax,%edi
+  804237:	48 b8 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rax
+  80423e:	ff ff ff 
+  804241:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804245:	ff d0                	call   *%rax
+  804247:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80424a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80424e:	78 28                	js     804278 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804250:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804254:	8b 00                	mov    (%rax),%eax
+  804256:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80425a:	48 89 d6             	mov    %rdx,%rsi
+  80425d:	89 c7                	mov    %eax,%edi
+  80425f:	48 b8 10 ab ff ff ff 	movabs $0xffffffffffffab10,%rax
+  804266:	ff ff ff 
+  804269:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80426d:	ff d0                	call   *%rax
+  80426f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804272:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804276:	79 08                	jns    804280 <ftruncate+0x7a>
+		return r;
+  804278:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80427b:	e9 83 00 00 00       	jmp    804303 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804280:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804284:	8b 40 08             	mov    0x8(%rax),%eax
+  804287:	83 e0 03             	and    $0x3,%eax
+  80428a:	85 c0                	test   %eax,%eax
+  80428c:	75 4b                	jne    8042d9 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  80428e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804295:	ff ff ff 
+  804298:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80429c:	48 8b 00             	mov    (%rax),%rax
+  80429f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8042a5:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8042a8:	89 c6                	mov    %eax,%esi
+  8042aa:	48 b8 38 e9 ff ff ff 	movabs $0xffffffffffffe938,%rax
+  8042b1:	ff ff ff 
+  8042b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042b8:	48 89 c7             	mov    %rax,%rdi
+  8042bb:	49 89 df             	mov    %rbx,%r15
+  8042be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042c3:	48 b9 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rcx
+  8042ca:	ff ff ff 
+  8042cd:	48 01 d9             	add    %rbx,%rcx
+  8042d0:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8042d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8042d7:	eb 2a                	jmp    804303 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8042d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042dd:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8042e1:	48 85 c0             	test   %rax,%rax
+  8042e4:	75 07                	jne    8042ed <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8042e6:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8042eb:	eb 16                	jmp    804303 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8042ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042f1:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8042f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042f9:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8042fc:	89 d6                	mov    %edx,%esi
+  8042fe:	48 89 c7             	mov    %rax,%rdi
+  804301:	ff d1                	call   *%rcx
+}
+  804303:	48 83 c4 30          	add    $0x30,%rsp
+  804307:	5b                   	pop    %rbx
+  804308:	41 5f                	pop    %r15
+  80430a:	5d                   	pop    %rbp
+  80430b:	c3                   	ret
+
+000000000080430c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80430c:	55                   	push   %rbp
+  80430d:	48 89 e5             	mov    %rsp,%rbp
+  804310:	53                   	push   %rbx
+  804311:	48 83 ec 38          	sub    $0x38,%rsp
+  804315:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804315 <fstat+0x9>
+  80431c:	49 bb 2b 4d 00 00 00 	movabs $0x4d2b,%r11
+  804323:	00 00 00 
+  804326:	4c 01 db             	add    %r11,%rbx
+  804329:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80432c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804330:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804334:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804337:	48 89 d6             	mov    %rdx,%rsi
+  80433a:	89 c7                	mov    %eax,%edi
+  80433c:	48 b8 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rax
+  804343:	ff ff ff 
+  804346:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80434a:	ff d0                	call   *%rax
+  80434c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80434f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804353:	78 28                	js     80437d <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804355:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804359:	8b 00                	mov    (%rax),%eax
+  80435b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80435f:	48 89 d6             	mov    %rdx,%rsi
+  804362:	89 c7                	mov    %eax,%edi
+  804364:	48 b8 10 ab ff ff ff 	movabs $0xffffffffffffab10,%rax
+  80436b:	ff ff ff 
+  80436e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804372:	ff d0                	call   *%rax
+  804374:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804377:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80437b:	79 05                	jns    804382 <fstat+0x76>
+		return r;
+  80437d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804380:	eb 5e                	jmp    8043e0 <fstat+0xd4>
+	if (!dev->dev_stat)
+  804382:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804386:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80438a:	48 85 c0             	test   %rax,%rax
+  80438d:	75 07                	jne    804396 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  80438f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804394:	eb 4a                	jmp    8043e0 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  804396:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80439a:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  80439d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043a1:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8043a8:	00 00 00 
+	stat->st_isdir = 0;
+  8043ab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043af:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8043b6:	00 00 00 
+	stat->st_dev = dev;
+  8043b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8043bd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043c1:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8043c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043cc:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8043d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8043d8:	48 89 d6             	mov    %rdx,%rsi
+  8043db:	48 89 c7             	mov    %rax,%rdi
+  8043de:	ff d1                	call   *%rcx
+}
+  8043e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043e4:	c9                   	leave
+  8043e5:	c3                   	ret
+
+00000000008043e6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8043e6:	55                   	push   %rbp
+  8043e7:	48 89 e5             	mov    %rsp,%rbp
+  8043ea:	41 57                	push   %r15
+  8043ec:	53                   	push   %rbx
+  8043ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8043f1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043f1 <stat+0xb>
+  8043f8:	49 bb 4f 4c 00 00 00 	movabs $0x4c4f,%r11
+  8043ff:	00 00 00 
+  804402:	4c 01 db             	add    %r11,%rbx
+  804405:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804409:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80440d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804411:	be 00 00 00 00       	mov    $0x0,%esi
+  804416:	48 89 c7             	mov    %rax,%rdi
+  804419:	49 89 df             	mov    %rbx,%r15
+  80441c:	48 b8 80 b6 ff ff ff 	movabs $0xffffffffffffb680,%rax
+  804423:	ff ff ff 
+  804426:	48 01 d8             	add    %rbx,%rax
+  804429:	ff d0                	call   *%rax
+  80442b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80442e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804432:	79 05                	jns    804439 <stat+0x53>
+		return fd;
+  804434:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804437:	eb 37                	jmp    804470 <stat+0x8a>
+	r = fstat(fd, stat);
+  804439:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80443d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804440:	48 89 d6             	mov    %rdx,%rsi
+  804443:	89 c7                	mov    %eax,%edi
+  804445:	48 b8 cc b2 ff ff ff 	movabs $0xffffffffffffb2cc,%rax
+  80444c:	ff ff ff 
+  80444f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804453:	ff d0                	call   *%rax
+  804455:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  804458:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80445b:	89 c7                	mov    %eax,%edi
+  80445d:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  804464:	ff ff ff 
+  804467:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80446b:	ff d0                	call   *%rax
+	return r;
+  80446d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  804470:	48 83 c4 20          	add    $0x20,%rsp
+  804474:	5b                   	pop    %rbx
+  804475:	41 5f                	pop    %r15
+  804477:	5d                   	pop    %rbp
+  804478:	c3                   	ret
+
+0000000000804479 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  804479:	55                   	push   %rbp
+  80447a:	48 89 e5             	mov    %rsp,%rbp
+  80447d:	41 57                	push   %r15
+  80447f:	53                   	push   %rbx
+  804480:	48 83 ec 10          	sub    $0x10,%rsp
+  804484:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804484 <fsipc+0xb>
+  80448b:	49 bb bc 4b 00 00 00 	movabs $0x4bbc,%r11
+  804492:	00 00 00 
+  804495:	4c 01 db             	add    %r11,%rbx
+  804498:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80449b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  80449f:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8044a6:	00 00 00 
+  8044a9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8044ac:	85 c0                	test   %eax,%eax
+  8044ae:	75 24                	jne    8044d4 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8044b0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8044b5:	49 89 df             	mov    %rbx,%r15
+  8044b8:	48 b8 db e0 ff ff ff 	movabs $0xffffffffffffe0db,%rax
+  8044bf:	ff ff ff 
+  8044c2:	48 01 d8             	add    %rbx,%rax
+  8044c5:	ff d0                	call   *%rax
+  8044c7:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8044ce:	00 00 00 
+  8044d1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8044d4:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8044db:	00 00 00 
+  8044de:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8044e1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8044e5:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8044e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8044ee:	49 89 d0             	mov    %rdx,%r8
+  8044f1:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8044f6:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8044fd:	00 00 00 
+  804500:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804504:	89 c7                	mov    %eax,%edi
+  804506:	49 89 df             	mov    %rbx,%r15
+  804509:	48 b8 fa da ff ff ff 	movabs $0xffffffffffffdafa,%rax
+  804510:	ff ff ff 
+  804513:	48 01 d8             	add    %rbx,%rax
+  804516:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  804518:	48 83 c4 10          	add    $0x10,%rsp
+  80451c:	5b                   	pop    %rbx
+  80451d:	41 5f                	pop    %r15
+  80451f:	5d                   	pop    %rbp
+  804520:	c3                   	ret
+
+0000000000804521 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  804521:	55                   	push   %rbp
+  804522:	48 89 e5             	mov    %rsp,%rbp
+  804525:	41 57                	push   %r15
+  804527:	53                   	push   %rbx
+  804528:	48 83 ec 20          	sub    $0x20,%rsp
+  80452c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80452c <fsipc_words+0xb>
+  804533:	49 bb 14 4b 00 00 00 	movabs $0x4b14,%r11
+  80453a:	00 00 00 
+  80453d:	4c 01 db             	add    %r11,%rbx
+  804540:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804543:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804547:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  80454b:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804552:	00 00 00 
+  804555:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804558:	85 c0                	test   %eax,%eax
+  80455a:	75 24                	jne    804580 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80455c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804561:	49 89 df             	mov    %rbx,%r15
+  804564:	48 b8 db e0 ff ff ff 	movabs $0xffffffffffffe0db,%rax
+  80456b:	ff ff ff 
+  80456e:	48 01 d8             	add    %rbx,%rax
+  804571:	ff d0                	call   *%rax
+  804573:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  80457a:	00 00 00 
+  80457d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  804580:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804587:	00 00 00 
+  80458a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80458d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804591:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804595:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804598:	89 c7                	mov    %eax,%edi
+  80459a:	49 89 df             	mov    %rbx,%r15
+  80459d:	48 b8 e5 db ff ff ff 	movabs $0xffffffffffffdbe5,%rax
+  8045a4:	ff ff ff 
+  8045a7:	48 01 d8             	add    %rbx,%rax
+  8045aa:	ff d0                	call   *%rax
+}
+  8045ac:	48 83 c4 20          	add    $0x20,%rsp
+  8045b0:	5b                   	pop    %rbx
+  8045b1:	41 5f                	pop    %r15
+  8045b3:	5d                   	pop    %rbp
+  8045b4:	c3                   	ret
+
+00000000008045b5 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8045b5:	55                   	push   %rbp
+  8045b6:	48 89 e5             	mov    %rsp,%rbp
+  8045b9:	41 57                	push   %r15
+  8045bb:	53                   	push   %rbx
+  8045bc:	48 83 ec 40          	sub    $0x40,%rsp
+  8045c0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045c0 <fsipc_pages+0xb>
+  8045c7:	49 bb 80 4a 00 00 00 	movabs $0x4a80,%r11
+  8045ce:	00 00 00 
+  8045d1:	4c 01 db             	add    %r11,%rbx
+  8045d4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8045d7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8045db:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8045df:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8045e2:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8045e9:	00 00 00 
+  8045ec:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8045ef:	85 c0                	test   %eax,%eax
+  8045f1:	75 24                	jne    804617 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8045f3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8045f8:	49 89 df             	mov    %rbx,%r15
+  8045fb:	48 b8 db e0 ff ff ff 	movabs $0xffffffffffffe0db,%rax
+  804602:	ff ff ff 
+  804605:	48 01 d8             	add    %rbx,%rax
+  804608:	ff d0                	call   *%rax
+  80460a:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804611:	00 00 00 
+  804614:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  804617:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80461c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804620:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804623:	48 98                	cltq
+  804625:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  804629:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80462d:	0f 95 c0             	setne  %al
+  804630:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804633:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80463a:	00 
+  80463b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80463f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804643:	48 01 d0             	add    %rdx,%rax
+  804646:	48 83 e8 01          	sub    $0x1,%rax
+  80464a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80464e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804652:	ba 00 00 00 00       	mov    $0x0,%edx
+  804657:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80465b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80465f:	48 29 d0             	sub    %rdx,%rax
+  804662:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804666:	41 89 c2             	mov    %eax,%r10d
+  804669:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804670:	00 00 00 
+  804673:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804676:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80467a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80467e:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804681:	48 83 ec 08          	sub    $0x8,%rsp
+  804685:	6a 40                	push   $0x40
+  804687:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  80468c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804693:	00 
+  804694:	6a 05                	push   $0x5
+  804696:	41 89 f9             	mov    %edi,%r9d
+  804699:	49 89 c8             	mov    %rcx,%r8
+  80469c:	44 89 d1             	mov    %r10d,%ecx
+  80469f:	89 c7                	mov    %eax,%edi
+  8046a1:	49 89 df             	mov    %rbx,%r15
+  8046a4:	48 b8 e3 dc ff ff ff 	movabs $0xffffffffffffdce3,%rax
+  8046ab:	ff ff ff 
+  8046ae:	48 01 d8             	add    %rbx,%rax
+  8046b1:	ff d0                	call   *%rax
+  8046b3:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  8046b7:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8046bb:	5b                   	pop    %rbx
+  8046bc:	41 5f                	pop    %r15
+  8046be:	5d                   	pop    %rbp
+  8046bf:	c3                   	ret
+
+00000000008046c0 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8046c0:	55                   	push   %rbp
+  8046c1:	48 89 e5             	mov    %rsp,%rbp
+  8046c4:	41 57                	push   %r15
+  8046c6:	53                   	push   %rbx
+  8046c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8046cb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046cb <open+0xb>
+  8046d2:	49 bb 75 49 00 00 00 	movabs $0x4975,%r11
+  8046d9:	00 00 00 
+  8046dc:	4c 01 db             	add    %r11,%rbx
+  8046df:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8046e3:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8046e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046ea:	48 89 c7             	mov    %rax,%rdi
+  8046ed:	49 89 df             	mov    %rbx,%r15
+  8046f0:	48 b8 b5 87 ff ff ff 	movabs $0xffffffffffff87b5,%rax
+  8046f7:	ff ff ff 
+  8046fa:	48 01 d8             	add    %rbx,%rax
+  8046fd:	ff d0                	call   *%rax
+  8046ff:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804704:	7e 0a                	jle    804710 <open+0x50>
+		return -E_BAD_PATH;
+  804706:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80470b:	e9 18 01 00 00       	jmp    804828 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804710:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804714:	48 89 c7             	mov    %rax,%rdi
+  804717:	49 89 df             	mov    %rbx,%r15
+  80471a:	48 b8 b4 a8 ff ff ff 	movabs $0xffffffffffffa8b4,%rax
+  804721:	ff ff ff 
+  804724:	48 01 d8             	add    %rbx,%rax
+  804727:	ff d0                	call   *%rax
+  804729:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80472c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804730:	74 08                	je     80473a <open+0x7a>
+		return r;
+  804732:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804735:	e9 ee 00 00 00       	jmp    804828 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80473a:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804741:	00 00 00 
+  804744:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804747:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  80474e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804752:	48 89 c6             	mov    %rax,%rsi
+  804755:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  80475c:	00 00 00 
+  80475f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804763:	48 89 c7             	mov    %rax,%rdi
+  804766:	49 89 df             	mov    %rbx,%r15
+  804769:	48 b8 49 88 ff ff ff 	movabs $0xffffffffffff8849,%rax
+  804770:	ff ff ff 
+  804773:	48 01 d8             	add    %rbx,%rax
+  804776:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804778:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80477c:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804781:	48 89 c6             	mov    %rax,%rsi
+  804784:	bf 00 00 00 00       	mov    $0x0,%edi
+  804789:	49 89 df             	mov    %rbx,%r15
+  80478c:	48 b8 05 95 ff ff ff 	movabs $0xffffffffffff9505,%rax
+  804793:	ff ff ff 
+  804796:	48 01 d8             	add    %rbx,%rax
+  804799:	ff d0                	call   *%rax
+  80479b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80479e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047a2:	74 23                	je     8047c7 <open+0x107>
+		fd_close(fd,0);
+  8047a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8047ad:	48 89 c7             	mov    %rax,%rdi
+  8047b0:	49 89 df             	mov    %rbx,%r15
+  8047b3:	48 b8 15 aa ff ff ff 	movabs $0xffffffffffffaa15,%rax
+  8047ba:	ff ff ff 
+  8047bd:	48 01 d8             	add    %rbx,%rax
+  8047c0:	ff d0                	call   *%rax
+		return r;
+  8047c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047c5:	eb 61                	jmp    804828 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8047c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047cb:	48 89 c6             	mov    %rax,%rsi
+  8047ce:	bf 01 00 00 00       	mov    $0x1,%edi
+  8047d3:	48 b8 39 b4 ff ff ff 	movabs $0xffffffffffffb439,%rax
+  8047da:	ff ff ff 
+  8047dd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047e1:	ff d0                	call   *%rax
+  8047e3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047ea:	74 23                	je     80480f <open+0x14f>
+		fd_close(fd,0);
+  8047ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8047f5:	48 89 c7             	mov    %rax,%rdi
+  8047f8:	49 89 df             	mov    %rbx,%r15
+  8047fb:	48 b8 15 aa ff ff ff 	movabs $0xffffffffffffaa15,%rax
+  804802:	ff ff ff 
+  804805:	48 01 d8             	add    %rbx,%rax
+  804808:	ff d0                	call   *%rax
+		return r;
+  80480a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80480d:	eb 19                	jmp    804828 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  80480f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804813:	48 89 c7             	mov    %rax,%rdi
+  804816:	49 89 df             	mov    %rbx,%r15
+  804819:	48 b8 3a a8 ff ff ff 	movabs $0xffffffffffffa83a,%rax
+  804820:	ff ff ff 
+  804823:	48 01 d8             	add    %rbx,%rax
+  804826:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804828:	48 83 c4 20          	add    $0x20,%rsp
+  80482c:	5b                   	pop    %rbx
+  80482d:	41 5f                	pop    %r15
+  80482f:	5d                   	pop    %rbp
+  804830:	c3                   	ret
+
+0000000000804831 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804831:	55                   	push   %rbp
+  804832:	48 89 e5             	mov    %rsp,%rbp
+  804835:	48 83 ec 20          	sub    $0x20,%rsp
+  804839:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804839 <devfile_flush+0x8>
+  804840:	49 bb 07 48 00 00 00 	movabs $0x4807,%r11
+  804847:	00 00 00 
+  80484a:	4c 01 d8             	add    %r11,%rax
+  80484d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804851:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804855:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804858:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  80485b:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80485f:	ba 04 00 00 00       	mov    $0x4,%edx
+  804864:	48 89 ce             	mov    %rcx,%rsi
+  804867:	bf 06 00 00 00       	mov    $0x6,%edi
+  80486c:	48 b9 e1 b4 ff ff ff 	movabs $0xffffffffffffb4e1,%rcx
+  804873:	ff ff ff 
+  804876:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80487a:	ff d0                	call   *%rax
+}
+  80487c:	c9                   	leave
+  80487d:	c3                   	ret
+
+000000000080487e <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  80487e:	55                   	push   %rbp
+  80487f:	48 89 e5             	mov    %rsp,%rbp
+  804882:	41 57                	push   %r15
+  804884:	53                   	push   %rbx
+  804885:	48 83 ec 60          	sub    $0x60,%rsp
+  804889:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804889 <devfile_read+0xb>
+  804890:	49 bb b7 47 00 00 00 	movabs $0x47b7,%r11
+  804897:	00 00 00 
+  80489a:	4c 01 db             	add    %r11,%rbx
+  80489d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8048a1:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8048a5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  8048a9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8048ad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  8048b1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8048b5:	8b 50 0c             	mov    0xc(%rax),%edx
+  8048b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048bc:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8048be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048c2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8048c6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  8048ca:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8048ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8048d3:	ba 10 00 00 00       	mov    $0x10,%edx
+  8048d8:	48 89 c6             	mov    %rax,%rsi
+  8048db:	bf 03 00 00 00       	mov    $0x3,%edi
+  8048e0:	48 b8 75 b5 ff ff ff 	movabs $0xffffffffffffb575,%rax
+  8048e7:	ff ff ff 
+  8048ea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048ee:	ff d0                	call   *%rax
+  8048f0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8048f3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8048f7:	79 05                	jns    8048fe <devfile_read+0x80>
+		return r;
+  8048f9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8048fc:	eb 64                	jmp    804962 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8048fe:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804901:	48 63 d0             	movslq %eax,%rdx
+  804904:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804908:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  80490d:	48 01 c1             	add    %rax,%rcx
+  804910:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804914:	48 89 ce             	mov    %rcx,%rsi
+  804917:	48 89 c7             	mov    %rax,%rdi
+  80491a:	49 89 df             	mov    %rbx,%r15
+  80491d:	48 b8 29 8c ff ff ff 	movabs $0xffffffffffff8c29,%rax
+  804924:	ff ff ff 
+  804927:	48 01 d8             	add    %rbx,%rax
+  80492a:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  80492c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804933:	ff ff ff 
+  804936:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80493a:	48 8b 00             	mov    (%rax),%rax
+  80493d:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804943:	89 c6                	mov    %eax,%esi
+  804945:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  80494a:	48 89 c7             	mov    %rax,%rdi
+  80494d:	49 89 df             	mov    %rbx,%r15
+  804950:	48 b8 95 e0 ff ff ff 	movabs $0xffffffffffffe095,%rax
+  804957:	ff ff ff 
+  80495a:	48 01 d8             	add    %rbx,%rax
+  80495d:	ff d0                	call   *%rax
+	return r;
+  80495f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804962:	48 83 c4 60          	add    $0x60,%rsp
+  804966:	5b                   	pop    %rbx
+  804967:	41 5f                	pop    %r15
+  804969:	5d                   	pop    %rbp
+  80496a:	c3                   	ret
+
+000000000080496b <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80496b:	55                   	push   %rbp
+  80496c:	48 89 e5             	mov    %rsp,%rbp
+  80496f:	41 57                	push   %r15
+  804971:	53                   	push   %rbx
+  804972:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804976:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804976 <devfile_write+0xb>
+  80497d:	49 bb ca 46 00 00 00 	movabs $0x46ca,%r11
+  804984:	00 00 00 
+  804987:	4c 01 db             	add    %r11,%rbx
+  80498a:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  80498e:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804992:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804999:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80499d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  8049a1:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  8049a8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8049ac:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  8049b3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8049b6:	48 63 d0             	movslq %eax,%rdx
+  8049b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049bd:	48 39 c2             	cmp    %rax,%rdx
+  8049c0:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8049c4:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8049cb:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  8049d2:	00 
+  8049d3:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8049da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049de:	48 01 d0             	add    %rdx,%rax
+  8049e1:	48 83 e8 01          	sub    $0x1,%rax
+  8049e5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8049e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049f2:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8049f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049fa:	48 29 d0             	sub    %rdx,%rax
+  8049fd:	48 c1 e8 0c          	shr    $0xc,%rax
+  804a01:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804a04:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a07:	89 c6                	mov    %eax,%esi
+  804a09:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804a0e:	48 89 c7             	mov    %rax,%rdi
+  804a11:	49 89 df             	mov    %rbx,%r15
+  804a14:	48 b8 4f e0 ff ff ff 	movabs $0xffffffffffffe04f,%rax
+  804a1b:	ff ff ff 
+  804a1e:	48 01 d8             	add    %rbx,%rax
+  804a21:	ff d0                	call   *%rax
+  804a23:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804a26:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804a2a:	79 08                	jns    804a34 <devfile_write+0xc9>
+		return r;
+  804a2c:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804a2f:	e9 8f 00 00 00       	jmp    804ac3 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804a34:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804a3b:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804a3f:	48 89 c6             	mov    %rax,%rsi
+  804a42:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804a47:	48 89 c7             	mov    %rax,%rdi
+  804a4a:	49 89 df             	mov    %rbx,%r15
+  804a4d:	48 b8 29 8c ff ff ff 	movabs $0xffffffffffff8c29,%rax
+  804a54:	ff ff ff 
+  804a57:	48 01 d8             	add    %rbx,%rax
+  804a5a:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804a5c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804a60:	8b 50 0c             	mov    0xc(%rax),%edx
+  804a63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a67:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804a69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a6d:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804a74:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804a78:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804a7b:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804a7f:	89 d1                	mov    %edx,%ecx
+  804a81:	ba 10 00 00 00       	mov    $0x10,%edx
+  804a86:	48 89 c6             	mov    %rax,%rsi
+  804a89:	bf 04 00 00 00       	mov    $0x4,%edi
+  804a8e:	48 b8 75 b5 ff ff ff 	movabs $0xffffffffffffb575,%rax
+  804a95:	ff ff ff 
+  804a98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a9c:	ff d0                	call   *%rax
+  804a9e:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804aa1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804aa4:	89 c6                	mov    %eax,%esi
+  804aa6:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804aab:	48 89 c7             	mov    %rax,%rdi
+  804aae:	49 89 df             	mov    %rbx,%r15
+  804ab1:	48 b8 95 e0 ff ff ff 	movabs $0xffffffffffffe095,%rax
+  804ab8:	ff ff ff 
+  804abb:	48 01 d8             	add    %rbx,%rax
+  804abe:	ff d0                	call   *%rax
+	return r;
+  804ac0:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804ac3:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804ac7:	5b                   	pop    %rbx
+  804ac8:	41 5f                	pop    %r15
+  804aca:	5d                   	pop    %rbp
+  804acb:	c3                   	ret
+
+0000000000804acc <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804acc:	55                   	push   %rbp
+  804acd:	48 89 e5             	mov    %rsp,%rbp
+  804ad0:	41 57                	push   %r15
+  804ad2:	53                   	push   %rbx
+  804ad3:	48 83 ec 20          	sub    $0x20,%rsp
+  804ad7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ad7 <devfile_stat+0xb>
+  804ade:	49 bb 69 45 00 00 00 	movabs $0x4569,%r11
+  804ae5:	00 00 00 
+  804ae8:	4c 01 db             	add    %r11,%rbx
+  804aeb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804aef:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804af3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804af7:	8b 40 0c             	mov    0xc(%rax),%eax
+  804afa:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804b01:	00 00 00 
+  804b04:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804b07:	be 00 00 00 00       	mov    $0x0,%esi
+  804b0c:	bf 05 00 00 00       	mov    $0x5,%edi
+  804b11:	48 b8 39 b4 ff ff ff 	movabs $0xffffffffffffb439,%rax
+  804b18:	ff ff ff 
+  804b1b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b1f:	ff d0                	call   *%rax
+  804b21:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b24:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b28:	79 05                	jns    804b2f <devfile_stat+0x63>
+		return r;
+  804b2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b2d:	eb 65                	jmp    804b94 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804b2f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b33:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804b3a:	00 00 00 
+  804b3d:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804b41:	48 89 d6             	mov    %rdx,%rsi
+  804b44:	48 89 c7             	mov    %rax,%rdi
+  804b47:	49 89 df             	mov    %rbx,%r15
+  804b4a:	48 b8 49 88 ff ff ff 	movabs $0xffffffffffff8849,%rax
+  804b51:	ff ff ff 
+  804b54:	48 01 d8             	add    %rbx,%rax
+  804b57:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804b59:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804b60:	00 00 00 
+  804b63:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804b6a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b6e:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804b74:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804b7b:	00 00 00 
+  804b7e:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804b85:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b89:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  804b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804b94:	48 83 c4 20          	add    $0x20,%rsp
+  804b98:	5b                   	pop    %rbx
+  804b99:	41 5f                	pop    %r15
+  804b9b:	5d                   	pop    %rbp
+  804b9c:	c3                   	ret
+
+0000000000804b9d <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804b9d:	55                   	push   %rbp
+  804b9e:	48 89 e5             	mov    %rsp,%rbp
+  804ba1:	48 83 ec 20          	sub    $0x20,%rsp
+  804ba5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804ba5 <devfile_trunc+0x8>
+  804bac:	49 bb 9b 44 00 00 00 	movabs $0x449b,%r11
+  804bb3:	00 00 00 
+  804bb6:	4c 01 d8             	add    %r11,%rax
+  804bb9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804bbd:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  804bc0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804bc4:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804bc7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804bca:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804bcd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  804bd0:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804bd4:	ba 08 00 00 00       	mov    $0x8,%edx
+  804bd9:	48 89 ce             	mov    %rcx,%rsi
+  804bdc:	bf 02 00 00 00       	mov    $0x2,%edi
+  804be1:	48 b9 e1 b4 ff ff ff 	movabs $0xffffffffffffb4e1,%rcx
+  804be8:	ff ff ff 
+  804beb:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804bef:	ff d0                	call   *%rax
+}
+  804bf1:	c9                   	leave
+  804bf2:	c3                   	ret
+
+0000000000804bf3 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  804bf3:	55                   	push   %rbp
+  804bf4:	48 89 e5             	mov    %rsp,%rbp
+  804bf7:	41 57                	push   %r15
+  804bf9:	53                   	push   %rbx
+  804bfa:	48 83 ec 10          	sub    $0x10,%rsp
+  804bfe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804bfe <remove+0xb>
+  804c05:	49 bb 42 44 00 00 00 	movabs $0x4442,%r11
+  804c0c:	00 00 00 
+  804c0f:	4c 01 db             	add    %r11,%rbx
+  804c12:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  804c16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c1a:	48 89 c7             	mov    %rax,%rdi
+  804c1d:	49 89 df             	mov    %rbx,%r15
+  804c20:	48 b8 b5 87 ff ff ff 	movabs $0xffffffffffff87b5,%rax
+  804c27:	ff ff ff 
+  804c2a:	48 01 d8             	add    %rbx,%rax
+  804c2d:	ff d0                	call   *%rax
+  804c2f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804c34:	7e 07                	jle    804c3d <remove+0x4a>
+		return -E_BAD_PATH;
+  804c36:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804c3b:	eb 44                	jmp    804c81 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  804c3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c41:	48 89 c6             	mov    %rax,%rsi
+  804c44:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804c4b:	00 00 00 
+  804c4e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c52:	48 89 c7             	mov    %rax,%rdi
+  804c55:	49 89 df             	mov    %rbx,%r15
+  804c58:	48 b8 49 88 ff ff ff 	movabs $0xffffffffffff8849,%rax
+  804c5f:	ff ff ff 
+  804c62:	48 01 d8             	add    %rbx,%rax
+  804c65:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804c67:	be 00 00 00 00       	mov    $0x0,%esi
+  804c6c:	bf 07 00 00 00       	mov    $0x7,%edi
+  804c71:	48 b8 39 b4 ff ff ff 	movabs $0xffffffffffffb439,%rax
+  804c78:	ff ff ff 
+  804c7b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c7f:	ff d0                	call   *%rax
+}
+  804c81:	48 83 c4 10          	add    $0x10,%rsp
+  804c85:	5b                   	pop    %rbx
+  804c86:	41 5f                	pop    %r15
+  804c88:	5d                   	pop    %rbp
+  804c89:	c3                   	ret
+
+0000000000804c8a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804c8a:	55                   	push   %rbp
+  804c8b:	48 89 e5             	mov    %rsp,%rbp
+  804c8e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804c8e <sync+0x4>
+  804c95:	49 bb b2 43 00 00 00 	movabs $0x43b2,%r11
+  804c9c:	00 00 00 
+  804c9f:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  804ca2:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ca7:	be 00 00 00 00       	mov    $0x0,%esi
+  804cac:	bf 08 00 00 00       	mov    $0x8,%edi
+  804cb1:	48 b9 e1 b4 ff ff ff 	movabs $0xffffffffffffb4e1,%rcx
+  804cb8:	ff ff ff 
+  804cbb:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804cbf:	ff d0                	call   *%rax
+}
+  804cc1:	5d                   	pop    %rbp
+  804cc2:	c3                   	ret
+
+0000000000804cc3 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  804cc3:	55                   	push   %rbp
+  804cc4:	48 89 e5             	mov    %rsp,%rbp
+  804cc7:	41 57                	push   %r15
+  804cc9:	53                   	push   %rbx
+  804cca:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  804cd1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cd1 <copy+0xe>
+  804cd8:	49 bb 6f 43 00 00 00 	movabs $0x436f,%r11
+  804cdf:	00 00 00 
+  804ce2:	4c 01 db             	add    %r11,%rbx
+  804ce5:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804cec:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  804cf3:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  804cfa:	be 00 00 00 00       	mov    $0x0,%esi
+  804cff:	48 89 c7             	mov    %rax,%rdi
+  804d02:	48 b8 80 b6 ff ff ff 	movabs $0xffffffffffffb680,%rax
+  804d09:	ff ff ff 
+  804d0c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d10:	ff d0                	call   *%rax
+  804d12:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  804d15:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d19:	79 35                	jns    804d50 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  804d1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d1e:	89 c6                	mov    %eax,%esi
+  804d20:	48 b8 5e e9 ff ff ff 	movabs $0xffffffffffffe95e,%rax
+  804d27:	ff ff ff 
+  804d2a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d2e:	48 89 c7             	mov    %rax,%rdi
+  804d31:	49 89 df             	mov    %rbx,%r15
+  804d34:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d39:	48 ba 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rdx
+  804d40:	ff ff ff 
+  804d43:	48 01 da             	add    %rbx,%rdx
+  804d46:	ff d2                	call   *%rdx
+		return fd_src;
+  804d48:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d4b:	e9 d7 01 00 00       	jmp    804f27 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  804d50:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804d57:	be 01 01 00 00       	mov    $0x101,%esi
+  804d5c:	48 89 c7             	mov    %rax,%rdi
+  804d5f:	48 b8 80 b6 ff ff ff 	movabs $0xffffffffffffb680,%rax
+  804d66:	ff ff ff 
+  804d69:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d6d:	ff d0                	call   *%rax
+  804d6f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  804d72:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804d76:	0f 89 df 00 00 00    	jns    804e5b <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804d7c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d7f:	89 c6                	mov    %eax,%esi
+  804d81:	48 b8 74 e9 ff ff ff 	movabs $0xffffffffffffe974,%rax
+  804d88:	ff ff ff 
+  804d8b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d8f:	48 89 c7             	mov    %rax,%rdi
+  804d92:	49 89 df             	mov    %rbx,%r15
+  804d95:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d9a:	48 ba 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rdx
+  804da1:	ff ff ff 
+  804da4:	48 01 da             	add    %rbx,%rdx
+  804da7:	ff d2                	call   *%rdx
+		close(fd_src);
+  804da9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dac:	89 c7                	mov    %eax,%edi
+  804dae:	49 89 df             	mov    %rbx,%r15
+  804db1:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  804db8:	ff ff ff 
+  804dbb:	48 01 d8             	add    %rbx,%rax
+  804dbe:	ff d0                	call   *%rax
+		return fd_dest;
+  804dc0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804dc3:	e9 5f 01 00 00       	jmp    804f27 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804dc8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804dcb:	48 63 d0             	movslq %eax,%rdx
+  804dce:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804dd5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804dd8:	48 89 ce             	mov    %rcx,%rsi
+  804ddb:	89 c7                	mov    %eax,%edi
+  804ddd:	49 89 df             	mov    %rbx,%r15
+  804de0:	48 b8 57 b0 ff ff ff 	movabs $0xffffffffffffb057,%rax
+  804de7:	ff ff ff 
+  804dea:	48 01 d8             	add    %rbx,%rax
+  804ded:	ff d0                	call   *%rax
+  804def:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804df2:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804df6:	79 63                	jns    804e5b <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804df8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804dfb:	89 c6                	mov    %eax,%esi
+  804dfd:	48 b8 8e e9 ff ff ff 	movabs $0xffffffffffffe98e,%rax
+  804e04:	ff ff ff 
+  804e07:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e0b:	48 89 c7             	mov    %rax,%rdi
+  804e0e:	49 89 df             	mov    %rbx,%r15
+  804e11:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e16:	48 ba 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rdx
+  804e1d:	ff ff ff 
+  804e20:	48 01 da             	add    %rbx,%rdx
+  804e23:	ff d2                	call   *%rdx
+			close(fd_src);
+  804e25:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e28:	89 c7                	mov    %eax,%edi
+  804e2a:	49 89 df             	mov    %rbx,%r15
+  804e2d:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  804e34:	ff ff ff 
+  804e37:	48 01 d8             	add    %rbx,%rax
+  804e3a:	ff d0                	call   *%rax
+			close(fd_dest);
+  804e3c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804e3f:	89 c7                	mov    %eax,%edi
+  804e41:	49 89 df             	mov    %rbx,%r15
+  804e44:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  804e4b:	ff ff ff 
+  804e4e:	48 01 d8             	add    %rbx,%rax
+  804e51:	ff d0                	call   *%rax
+			return write_size;
+  804e53:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804e56:	e9 cc 00 00 00       	jmp    804f27 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804e5b:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804e62:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e65:	ba 00 02 00 00       	mov    $0x200,%edx
+  804e6a:	48 89 ce             	mov    %rcx,%rsi
+  804e6d:	89 c7                	mov    %eax,%edi
+  804e6f:	49 89 df             	mov    %rbx,%r15
+  804e72:	48 b8 b1 ae ff ff ff 	movabs $0xffffffffffffaeb1,%rax
+  804e79:	ff ff ff 
+  804e7c:	48 01 d8             	add    %rbx,%rax
+  804e7f:	ff d0                	call   *%rax
+  804e81:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804e84:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804e88:	0f 8f 3a ff ff ff    	jg     804dc8 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804e8e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804e92:	79 60                	jns    804ef4 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804e94:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e97:	89 c6                	mov    %eax,%esi
+  804e99:	48 b8 a1 e9 ff ff ff 	movabs $0xffffffffffffe9a1,%rax
+  804ea0:	ff ff ff 
+  804ea3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ea7:	48 89 c7             	mov    %rax,%rdi
+  804eaa:	49 89 df             	mov    %rbx,%r15
+  804ead:	b8 00 00 00 00       	mov    $0x0,%eax
+  804eb2:	48 ba 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%rdx
+  804eb9:	ff ff ff 
+  804ebc:	48 01 da             	add    %rbx,%rdx
+  804ebf:	ff d2                	call   *%rdx
+		close(fd_src);
+  804ec1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ec4:	89 c7                	mov    %eax,%edi
+  804ec6:	49 89 df             	mov    %rbx,%r15
+  804ec9:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  804ed0:	ff ff ff 
+  804ed3:	48 01 d8             	add    %rbx,%rax
+  804ed6:	ff d0                	call   *%rax
+		close(fd_dest);
+  804ed8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804edb:	89 c7                	mov    %eax,%edi
+  804edd:	49 89 df             	mov    %rbx,%r15
+  804ee0:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  804ee7:	ff ff ff 
+  804eea:	48 01 d8             	add    %rbx,%rax
+  804eed:	ff d0                	call   *%rax
+		return read_size;
+  804eef:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ef2:	eb 33                	jmp    804f27 <copy+0x264>
+	}
+	close(fd_src);
+  804ef4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ef7:	89 c7                	mov    %eax,%edi
+  804ef9:	49 89 df             	mov    %rbx,%r15
+  804efc:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  804f03:	ff ff ff 
+  804f06:	48 01 d8             	add    %rbx,%rax
+  804f09:	ff d0                	call   *%rax
+	close(fd_dest);
+  804f0b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804f0e:	89 c7                	mov    %eax,%edi
+  804f10:	49 89 df             	mov    %rbx,%r15
+  804f13:	48 b8 f9 ab ff ff ff 	movabs $0xffffffffffffabf9,%rax
+  804f1a:	ff ff ff 
+  804f1d:	48 01 d8             	add    %rbx,%rax
+  804f20:	ff d0                	call   *%rax
+	return 0;
+  804f22:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804f27:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804f2e:	5b                   	pop    %rbx
+  804f2f:	41 5f                	pop    %r15
+  804f31:	5d                   	pop    %rbp
+  804f32:	c3                   	ret
+
+0000000000804f33 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804f33:	55                   	push   %rbp
+  804f34:	48 89 e5             	mov    %rsp,%rbp
+  804f37:	41 57                	push   %r15
+  804f39:	53                   	push   %rbx
+  804f3a:	48 83 ec 20          	sub    $0x20,%rsp
+  804f3e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f3e <fd2sockid+0xb>
+  804f45:	49 bb 02 41 00 00 00 	movabs $0x4102,%r11
+  804f4c:	00 00 00 
+  804f4f:	4c 01 db             	add    %r11,%rbx
+  804f52:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804f55:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804f59:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f5c:	48 89 d6             	mov    %rdx,%rsi
+  804f5f:	89 c7                	mov    %eax,%edi
+  804f61:	49 89 df             	mov    %rbx,%r15
+  804f64:	48 b8 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rax
+  804f6b:	ff ff ff 
+  804f6e:	48 01 d8             	add    %rbx,%rax
+  804f71:	ff d0                	call   *%rax
+  804f73:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f76:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f7a:	79 05                	jns    804f81 <fd2sockid+0x4e>
+		return r;
+  804f7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f7f:	eb 25                	jmp    804fa6 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804f81:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f85:	8b 10                	mov    (%rax),%edx
+  804f87:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  804f8e:	00 00 00 
+  804f91:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804f94:	39 c2                	cmp    %eax,%edx
+  804f96:	74 07                	je     804f9f <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804f98:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804f9d:	eb 07                	jmp    804fa6 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804f9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fa3:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804fa6:	48 83 c4 20          	add    $0x20,%rsp
+  804faa:	5b                   	pop    %rbx
+  804fab:	41 5f                	pop    %r15
+  804fad:	5d                   	pop    %rbp
+  804fae:	c3                   	ret
+
+0000000000804faf <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804faf:	55                   	push   %rbp
+  804fb0:	48 89 e5             	mov    %rsp,%rbp
+  804fb3:	41 57                	push   %r15
+  804fb5:	53                   	push   %rbx
+  804fb6:	48 83 ec 20          	sub    $0x20,%rsp
+  804fba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804fba <alloc_sockfd+0xb>
+  804fc1:	49 bb 86 40 00 00 00 	movabs $0x4086,%r11
+  804fc8:	00 00 00 
+  804fcb:	4c 01 db             	add    %r11,%rbx
+  804fce:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804fd1:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804fd5:	48 89 c7             	mov    %rax,%rdi
+  804fd8:	49 89 df             	mov    %rbx,%r15
+  804fdb:	48 b8 b4 a8 ff ff ff 	movabs $0xffffffffffffa8b4,%rax
+  804fe2:	ff ff ff 
+  804fe5:	48 01 d8             	add    %rbx,%rax
+  804fe8:	ff d0                	call   *%rax
+  804fea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804fed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ff1:	78 2c                	js     80501f <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804ff3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ff7:	ba 07 04 00 00       	mov    $0x407,%edx
+  804ffc:	48 89 c6             	mov    %rax,%rsi
+  804fff:	bf 00 00 00 00       	mov    $0x0,%edi
+  805004:	49 89 df             	mov    %rbx,%r15
+  805007:	48 b8 05 95 ff ff ff 	movabs $0xffffffffffff9505,%rax
+  80500e:	ff ff ff 
+  805011:	48 01 d8             	add    %rbx,%rax
+  805014:	ff d0                	call   *%rax
+  805016:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805019:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80501d:	79 1c                	jns    80503b <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  80501f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805022:	89 c7                	mov    %eax,%edi
+  805024:	49 89 df             	mov    %rbx,%r15
+  805027:	48 b8 63 c7 ff ff ff 	movabs $0xffffffffffffc763,%rax
+  80502e:	ff ff ff 
+  805031:	48 01 d8             	add    %rbx,%rax
+  805034:	ff d0                	call   *%rax
+		return r;
+  805036:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805039:	eb 41                	jmp    80507c <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80503b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80503f:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  805046:	00 00 00 
+  805049:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80504c:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  80504e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805052:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  805059:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80505d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805060:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  805063:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805067:	48 89 c7             	mov    %rax,%rdi
+  80506a:	49 89 df             	mov    %rbx,%r15
+  80506d:	48 b8 3a a8 ff ff ff 	movabs $0xffffffffffffa83a,%rax
+  805074:	ff ff ff 
+  805077:	48 01 d8             	add    %rbx,%rax
+  80507a:	ff d0                	call   *%rax
+}
+  80507c:	48 83 c4 20          	add    $0x20,%rsp
+  805080:	5b                   	pop    %rbx
+  805081:	41 5f                	pop    %r15
+  805083:	5d                   	pop    %rbp
+  805084:	c3                   	ret
+
+0000000000805085 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805085:	55                   	push   %rbp
+  805086:	48 89 e5             	mov    %rsp,%rbp
+  805089:	41 57                	push   %r15
+  80508b:	53                   	push   %rbx
+  80508c:	48 83 ec 30          	sub    $0x30,%rsp
+  805090:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805090 <accept+0xb>
+  805097:	49 bb b0 3f 00 00 00 	movabs $0x3fb0,%r11
+  80509e:	00 00 00 
+  8050a1:	4c 01 db             	add    %r11,%rbx
+  8050a4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8050a7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8050ab:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8050af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8050b2:	89 c7                	mov    %eax,%edi
+  8050b4:	48 b8 f3 be ff ff ff 	movabs $0xffffffffffffbef3,%rax
+  8050bb:	ff ff ff 
+  8050be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050c2:	ff d0                	call   *%rax
+  8050c4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050cb:	79 05                	jns    8050d2 <accept+0x4d>
+		return r;
+  8050cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050d0:	eb 45                	jmp    805117 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8050d2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8050d6:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8050da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050dd:	48 89 ce             	mov    %rcx,%rsi
+  8050e0:	89 c7                	mov    %eax,%edi
+  8050e2:	49 89 df             	mov    %rbx,%r15
+  8050e5:	48 b8 d1 c5 ff ff ff 	movabs $0xffffffffffffc5d1,%rax
+  8050ec:	ff ff ff 
+  8050ef:	48 01 d8             	add    %rbx,%rax
+  8050f2:	ff d0                	call   *%rax
+  8050f4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050fb:	79 05                	jns    805102 <accept+0x7d>
+		return r;
+  8050fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805100:	eb 15                	jmp    805117 <accept+0x92>
+	return alloc_sockfd(r);
+  805102:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805105:	89 c7                	mov    %eax,%edi
+  805107:	48 b8 6f bf ff ff ff 	movabs $0xffffffffffffbf6f,%rax
+  80510e:	ff ff ff 
+  805111:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805115:	ff d0                	call   *%rax
+}
+  805117:	48 83 c4 30          	add    $0x30,%rsp
+  80511b:	5b                   	pop    %rbx
+  80511c:	41 5f                	pop    %r15
+  80511e:	5d                   	pop    %rbp
+  80511f:	c3                   	ret
+
+0000000000805120 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805120:	55                   	push   %rbp
+  805121:	48 89 e5             	mov    %rsp,%rbp
+  805124:	41 57                	push   %r15
+  805126:	53                   	push   %rbx
+  805127:	48 83 ec 20          	sub    $0x20,%rsp
+  80512b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80512b <bind+0xb>
+  805132:	49 bb 15 3f 00 00 00 	movabs $0x3f15,%r11
+  805139:	00 00 00 
+  80513c:	4c 01 db             	add    %r11,%rbx
+  80513f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805142:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805146:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805149:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80514c:	89 c7                	mov    %eax,%edi
+  80514e:	48 b8 f3 be ff ff ff 	movabs $0xffffffffffffbef3,%rax
+  805155:	ff ff ff 
+  805158:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80515c:	ff d0                	call   *%rax
+  80515e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805161:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805165:	79 05                	jns    80516c <bind+0x4c>
+		return r;
+  805167:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80516a:	eb 21                	jmp    80518d <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  80516c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80516f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805173:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805176:	48 89 ce             	mov    %rcx,%rsi
+  805179:	89 c7                	mov    %eax,%edi
+  80517b:	49 89 df             	mov    %rbx,%r15
+  80517e:	48 b8 7d c6 ff ff ff 	movabs $0xffffffffffffc67d,%rax
+  805185:	ff ff ff 
+  805188:	48 01 d8             	add    %rbx,%rax
+  80518b:	ff d0                	call   *%rax
+}
+  80518d:	48 83 c4 20          	add    $0x20,%rsp
+  805191:	5b                   	pop    %rbx
+  805192:	41 5f                	pop    %r15
+  805194:	5d                   	pop    %rbp
+  805195:	c3                   	ret
+
+0000000000805196 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  805196:	55                   	push   %rbp
+  805197:	48 89 e5             	mov    %rsp,%rbp
+  80519a:	41 57                	push   %r15
+  80519c:	53                   	push   %rbx
+  80519d:	48 83 ec 20          	sub    $0x20,%rsp
+  8051a1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051a1 <shutdown+0xb>
+  8051a8:	49 bb 9f 3e 00 00 00 	movabs $0x3e9f,%r11
+  8051af:	00 00 00 
+  8051b2:	4c 01 db             	add    %r11,%rbx
+  8051b5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8051b8:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8051bb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8051be:	89 c7                	mov    %eax,%edi
+  8051c0:	48 b8 f3 be ff ff ff 	movabs $0xffffffffffffbef3,%rax
+  8051c7:	ff ff ff 
+  8051ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051ce:	ff d0                	call   *%rax
+  8051d0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051d3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051d7:	79 05                	jns    8051de <shutdown+0x48>
+		return r;
+  8051d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051dc:	eb 1c                	jmp    8051fa <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8051de:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8051e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051e4:	89 d6                	mov    %edx,%esi
+  8051e6:	89 c7                	mov    %eax,%edi
+  8051e8:	49 89 df             	mov    %rbx,%r15
+  8051eb:	48 b8 12 c7 ff ff ff 	movabs $0xffffffffffffc712,%rax
+  8051f2:	ff ff ff 
+  8051f5:	48 01 d8             	add    %rbx,%rax
+  8051f8:	ff d0                	call   *%rax
+}
+  8051fa:	48 83 c4 20          	add    $0x20,%rsp
+  8051fe:	5b                   	pop    %rbx
+  8051ff:	41 5f                	pop    %r15
+  805201:	5d                   	pop    %rbp
+  805202:	c3                   	ret
+
+0000000000805203 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  805203:	55                   	push   %rbp
+  805204:	48 89 e5             	mov    %rsp,%rbp
+  805207:	41 57                	push   %r15
+  805209:	53                   	push   %rbx
+  80520a:	48 83 ec 10          	sub    $0x10,%rsp
+  80520e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80520e <devsock_close+0xb>
+  805215:	49 bb 32 3e 00 00 00 	movabs $0x3e32,%r11
+  80521c:	00 00 00 
+  80521f:	4c 01 db             	add    %r11,%rbx
+  805222:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  805226:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80522a:	48 89 c7             	mov    %rax,%rdi
+  80522d:	49 89 df             	mov    %rbx,%r15
+  805230:	48 b8 6a e1 ff ff ff 	movabs $0xffffffffffffe16a,%rax
+  805237:	ff ff ff 
+  80523a:	48 01 d8             	add    %rbx,%rax
+  80523d:	ff d0                	call   *%rax
+  80523f:	83 f8 01             	cmp    $0x1,%eax
+  805242:	75 1d                	jne    805261 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  805244:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805248:	8b 40 0c             	mov    0xc(%rax),%eax
+  80524b:	89 c7                	mov    %eax,%edi
+  80524d:	49 89 df             	mov    %rbx,%r15
+  805250:	48 b8 63 c7 ff ff ff 	movabs $0xffffffffffffc763,%rax
+  805257:	ff ff ff 
+  80525a:	48 01 d8             	add    %rbx,%rax
+  80525d:	ff d0                	call   *%rax
+  80525f:	eb 05                	jmp    805266 <devsock_close+0x63>
+	else
+		return 0;
+  805261:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805266:	48 83 c4 10          	add    $0x10,%rsp
+  80526a:	5b                   	pop    %rbx
+  80526b:	41 5f                	pop    %r15
+  80526d:	5d                   	pop    %rbp
+  80526e:	c3                   	ret
+
+000000000080526f <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80526f:	55                   	push   %rbp
+  805270:	48 89 e5             	mov    %rsp,%rbp
+  805273:	41 57                	push   %r15
+  805275:	53                   	push   %rbx
+  805276:	48 83 ec 20          	sub    $0x20,%rsp
+  80527a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80527a <connect+0xb>
+  805281:	49 bb c6 3d 00 00 00 	movabs $0x3dc6,%r11
+  805288:	00 00 00 
+  80528b:	4c 01 db             	add    %r11,%rbx
+  80528e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805291:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805295:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805298:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80529b:	89 c7                	mov    %eax,%edi
+  80529d:	48 b8 f3 be ff ff ff 	movabs $0xffffffffffffbef3,%rax
+  8052a4:	ff ff ff 
+  8052a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052ab:	ff d0                	call   *%rax
+  8052ad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052b0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052b4:	79 05                	jns    8052bb <connect+0x4c>
+		return r;
+  8052b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052b9:	eb 21                	jmp    8052dc <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8052bb:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8052be:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8052c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052c5:	48 89 ce             	mov    %rcx,%rsi
+  8052c8:	89 c7                	mov    %eax,%edi
+  8052ca:	49 89 df             	mov    %rbx,%r15
+  8052cd:	48 b8 ab c7 ff ff ff 	movabs $0xffffffffffffc7ab,%rax
+  8052d4:	ff ff ff 
+  8052d7:	48 01 d8             	add    %rbx,%rax
+  8052da:	ff d0                	call   *%rax
+}
+  8052dc:	48 83 c4 20          	add    $0x20,%rsp
+  8052e0:	5b                   	pop    %rbx
+  8052e1:	41 5f                	pop    %r15
+  8052e3:	5d                   	pop    %rbp
+  8052e4:	c3                   	ret
+
+00000000008052e5 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8052e5:	55                   	push   %rbp
+  8052e6:	48 89 e5             	mov    %rsp,%rbp
+  8052e9:	41 57                	push   %r15
+  8052eb:	53                   	push   %rbx
+  8052ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8052f0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052f0 <listen+0xb>
+  8052f7:	49 bb 50 3d 00 00 00 	movabs $0x3d50,%r11
+  8052fe:	00 00 00 
+  805301:	4c 01 db             	add    %r11,%rbx
+  805304:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805307:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80530a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80530d:	89 c7                	mov    %eax,%edi
+  80530f:	48 b8 f3 be ff ff ff 	movabs $0xffffffffffffbef3,%rax
+  805316:	ff ff ff 
+  805319:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80531d:	ff d0                	call   *%rax
+  80531f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805322:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805326:	79 05                	jns    80532d <listen+0x48>
+		return r;
+  805328:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80532b:	eb 1c                	jmp    805349 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80532d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805330:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805333:	89 d6                	mov    %edx,%esi
+  805335:	89 c7                	mov    %eax,%edi
+  805337:	49 89 df             	mov    %rbx,%r15
+  80533a:	48 b8 40 c8 ff ff ff 	movabs $0xffffffffffffc840,%rax
+  805341:	ff ff ff 
+  805344:	48 01 d8             	add    %rbx,%rax
+  805347:	ff d0                	call   *%rax
+}
+  805349:	48 83 c4 20          	add    $0x20,%rsp
+  80534d:	5b                   	pop    %rbx
+  80534e:	41 5f                	pop    %r15
+  805350:	5d                   	pop    %rbp
+  805351:	c3                   	ret
+
+0000000000805352 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805352:	55                   	push   %rbp
+  805353:	48 89 e5             	mov    %rsp,%rbp
+  805356:	41 57                	push   %r15
+  805358:	48 83 ec 28          	sub    $0x28,%rsp
+  80535c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80535c <devsock_read+0xa>
+  805363:	49 bb e4 3c 00 00 00 	movabs $0x3ce4,%r11
+  80536a:	00 00 00 
+  80536d:	4c 01 d8             	add    %r11,%rax
+  805370:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805374:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805378:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80537c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805380:	41 89 d0             	mov    %edx,%r8d
+  805383:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805387:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80538a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80538e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805393:	44 89 c2             	mov    %r8d,%edx
+  805396:	49 89 c7             	mov    %rax,%r15
+  805399:	49 b8 91 c8 ff ff ff 	movabs $0xffffffffffffc891,%r8
+  8053a0:	ff ff ff 
+  8053a3:	49 01 c0             	add    %rax,%r8
+  8053a6:	41 ff d0             	call   *%r8
+}
+  8053a9:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8053ad:	c9                   	leave
+  8053ae:	c3                   	ret
+
+00000000008053af <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8053af:	55                   	push   %rbp
+  8053b0:	48 89 e5             	mov    %rsp,%rbp
+  8053b3:	41 57                	push   %r15
+  8053b5:	48 83 ec 28          	sub    $0x28,%rsp
+  8053b9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8053b9 <devsock_write+0xa>
+  8053c0:	49 bb 87 3c 00 00 00 	movabs $0x3c87,%r11
+  8053c7:	00 00 00 
+  8053ca:	4c 01 d8             	add    %r11,%rax
+  8053cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8053d1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8053d5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8053d9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8053dd:	41 89 d0             	mov    %edx,%r8d
+  8053e0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8053e4:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8053e7:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8053eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8053f0:	44 89 c2             	mov    %r8d,%edx
+  8053f3:	49 89 c7             	mov    %rax,%r15
+  8053f6:	49 b8 ae c9 ff ff ff 	movabs $0xffffffffffffc9ae,%r8
+  8053fd:	ff ff ff 
+  805400:	49 01 c0             	add    %rax,%r8
+  805403:	41 ff d0             	call   *%r8
+}
+  805406:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80540a:	c9                   	leave
+  80540b:	c3                   	ret
+
+000000000080540c <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80540c:	55                   	push   %rbp
+  80540d:	48 89 e5             	mov    %rsp,%rbp
+  805410:	41 57                	push   %r15
+  805412:	48 83 ec 18          	sub    $0x18,%rsp
+  805416:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805416 <devsock_stat+0xa>
+  80541d:	49 bb 2a 3c 00 00 00 	movabs $0x3c2a,%r11
+  805424:	00 00 00 
+  805427:	4c 01 d8             	add    %r11,%rax
+  80542a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80542e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805432:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805436:	48 b9 bc e9 ff ff ff 	movabs $0xffffffffffffe9bc,%rcx
+  80543d:	ff ff ff 
+  805440:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805444:	48 89 ce             	mov    %rcx,%rsi
+  805447:	48 89 d7             	mov    %rdx,%rdi
+  80544a:	49 89 c7             	mov    %rax,%r15
+  80544d:	48 ba 49 88 ff ff ff 	movabs $0xffffffffffff8849,%rdx
+  805454:	ff ff ff 
+  805457:	48 01 c2             	add    %rax,%rdx
+  80545a:	ff d2                	call   *%rdx
+	return 0;
+  80545c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805461:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805465:	c9                   	leave
+  805466:	c3                   	ret
+
+0000000000805467 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  805467:	55                   	push   %rbp
+  805468:	48 89 e5             	mov    %rsp,%rbp
+  80546b:	41 57                	push   %r15
+  80546d:	53                   	push   %rbx
+  80546e:	48 83 ec 20          	sub    $0x20,%rsp
+  805472:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805472 <socket+0xb>
+  805479:	49 bb ce 3b 00 00 00 	movabs $0x3bce,%r11
+  805480:	00 00 00 
+  805483:	4c 01 db             	add    %r11,%rbx
+  805486:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805489:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80548c:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80548f:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805492:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805495:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805498:	89 ce                	mov    %ecx,%esi
+  80549a:	89 c7                	mov    %eax,%edi
+  80549c:	49 89 df             	mov    %rbx,%r15
+  80549f:	48 b8 85 cb ff ff ff 	movabs $0xffffffffffffcb85,%rax
+  8054a6:	ff ff ff 
+  8054a9:	48 01 d8             	add    %rbx,%rax
+  8054ac:	ff d0                	call   *%rax
+  8054ae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054b1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054b5:	79 05                	jns    8054bc <socket+0x55>
+		return r;
+  8054b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054ba:	eb 15                	jmp    8054d1 <socket+0x6a>
+	return alloc_sockfd(r);
+  8054bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054bf:	89 c7                	mov    %eax,%edi
+  8054c1:	48 b8 6f bf ff ff ff 	movabs $0xffffffffffffbf6f,%rax
+  8054c8:	ff ff ff 
+  8054cb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054cf:	ff d0                	call   *%rax
+}
+  8054d1:	48 83 c4 20          	add    $0x20,%rsp
+  8054d5:	5b                   	pop    %rbx
+  8054d6:	41 5f                	pop    %r15
+  8054d8:	5d                   	pop    %rbp
+  8054d9:	c3                   	ret
+
+00000000008054da <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8054da:	55                   	push   %rbp
+  8054db:	48 89 e5             	mov    %rsp,%rbp
+  8054de:	41 57                	push   %r15
+  8054e0:	53                   	push   %rbx
+  8054e1:	48 83 ec 10          	sub    $0x10,%rsp
+  8054e5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054e5 <nsipc+0xb>
+  8054ec:	49 bb 5b 3b 00 00 00 	movabs $0x3b5b,%r11
+  8054f3:	00 00 00 
+  8054f6:	4c 01 db             	add    %r11,%rbx
+  8054f9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8054fc:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805503:	00 00 00 
+  805506:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805509:	85 c0                	test   %eax,%eax
+  80550b:	75 24                	jne    805531 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80550d:	bf 02 00 00 00       	mov    $0x2,%edi
+  805512:	49 89 df             	mov    %rbx,%r15
+  805515:	48 b8 db e0 ff ff ff 	movabs $0xffffffffffffe0db,%rax
+  80551c:	ff ff ff 
+  80551f:	48 01 d8             	add    %rbx,%rax
+  805522:	ff d0                	call   *%rax
+  805524:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  80552b:	00 00 00 
+  80552e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805531:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805538:	00 00 00 
+  80553b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80553e:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805541:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805547:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80554d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805552:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805559:	00 00 00 
+  80555c:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805560:	89 c7                	mov    %eax,%edi
+  805562:	49 89 df             	mov    %rbx,%r15
+  805565:	48 b8 fa da ff ff ff 	movabs $0xffffffffffffdafa,%rax
+  80556c:	ff ff ff 
+  80556f:	48 01 d8             	add    %rbx,%rax
+  805572:	ff d0                	call   *%rax
+}
+  805574:	48 83 c4 10          	add    $0x10,%rsp
+  805578:	5b                   	pop    %rbx
+  805579:	41 5f                	pop    %r15
+  80557b:	5d                   	pop    %rbp
+  80557c:	c3                   	ret
+
+000000000080557d <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  80557d:	55                   	push   %rbp
+  80557e:	48 89 e5             	mov    %rsp,%rbp
+  805581:	41 57                	push   %r15
+  805583:	53                   	push   %rbx
+  805584:	48 83 ec 20          	sub    $0x20,%rsp
+  805588:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805588 <nsipc_words+0xb>
+  80558f:	49 bb b8 3a 00 00 00 	movabs $0x3ab8,%r11
+  805596:	00 00 00 
+  805599:	4c 01 db             	add    %r11,%rbx
+  80559c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80559f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8055a3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8055a7:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8055ae:	00 00 00 
+  8055b1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8055b4:	85 c0                	test   %eax,%eax
+  8055b6:	75 24                	jne    8055dc <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8055b8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8055bd:	49 89 df             	mov    %rbx,%r15
+  8055c0:	48 b8 db e0 ff ff ff 	movabs $0xffffffffffffe0db,%rax
+  8055c7:	ff ff ff 
+  8055ca:	48 01 d8             	add    %rbx,%rax
+  8055cd:	ff d0                	call   *%rax
+  8055cf:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8055d6:	00 00 00 
+  8055d9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8055dc:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8055e3:	00 00 00 
+  8055e6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8055e9:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8055ed:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8055f1:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8055f4:	89 c7                	mov    %eax,%edi
+  8055f6:	49 89 df             	mov    %rbx,%r15
+  8055f9:	48 b8 e5 db ff ff ff 	movabs $0xffffffffffffdbe5,%rax
+  805600:	ff ff ff 
+  805603:	48 01 d8             	add    %rbx,%rax
+  805606:	ff d0                	call   *%rax
+}
+  805608:	48 83 c4 20          	add    $0x20,%rsp
+  80560c:	5b                   	pop    %rbx
+  80560d:	41 5f                	pop    %r15
+  80560f:	5d                   	pop    %rbp
+  805610:	c3                   	ret
+
+0000000000805611 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805611:	55                   	push   %rbp
+  805612:	48 89 e5             	mov    %rsp,%rbp
+  805615:	41 57                	push   %r15
+  805617:	53                   	push   %rbx
+  805618:	48 83 ec 30          	sub    $0x30,%rsp
+  80561c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80561c <nsipc_accept+0xb>
+  805623:	49 bb 24 3a 00 00 00 	movabs $0x3a24,%r11
+  80562a:	00 00 00 
+  80562d:	4c 01 db             	add    %r11,%rbx
+  805630:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805633:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805637:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80563b:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805642:	00 00 00 
+  805645:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805648:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80564b:	bf 01 00 00 00       	mov    $0x1,%edi
+  805650:	48 b8 9a c4 ff ff ff 	movabs $0xffffffffffffc49a,%rax
+  805657:	ff ff ff 
+  80565a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80565e:	ff d0                	call   *%rax
+  805660:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805663:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805667:	78 48                	js     8056b1 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805669:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  805670:	00 00 00 
+  805673:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805677:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80567b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80567f:	8b 40 10             	mov    0x10(%rax),%eax
+  805682:	89 c2                	mov    %eax,%edx
+  805684:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805688:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80568c:	48 89 ce             	mov    %rcx,%rsi
+  80568f:	48 89 c7             	mov    %rax,%rdi
+  805692:	49 89 df             	mov    %rbx,%r15
+  805695:	48 b8 29 8c ff ff ff 	movabs $0xffffffffffff8c29,%rax
+  80569c:	ff ff ff 
+  80569f:	48 01 d8             	add    %rbx,%rax
+  8056a2:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8056a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056a8:	8b 50 10             	mov    0x10(%rax),%edx
+  8056ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8056af:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8056b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8056b4:	48 83 c4 30          	add    $0x30,%rsp
+  8056b8:	5b                   	pop    %rbx
+  8056b9:	41 5f                	pop    %r15
+  8056bb:	5d                   	pop    %rbp
+  8056bc:	c3                   	ret
+
+00000000008056bd <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8056bd:	55                   	push   %rbp
+  8056be:	48 89 e5             	mov    %rsp,%rbp
+  8056c1:	41 57                	push   %r15
+  8056c3:	53                   	push   %rbx
+  8056c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8056c8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056c8 <nsipc_bind+0xb>
+  8056cf:	49 bb 78 39 00 00 00 	movabs $0x3978,%r11
+  8056d6:	00 00 00 
+  8056d9:	4c 01 db             	add    %r11,%rbx
+  8056dc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8056df:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8056e3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8056e6:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8056ed:	00 00 00 
+  8056f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056f3:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8056f6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8056f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056fd:	48 89 c6             	mov    %rax,%rsi
+  805700:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805707:	00 00 00 
+  80570a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80570e:	48 89 c7             	mov    %rax,%rdi
+  805711:	49 89 df             	mov    %rbx,%r15
+  805714:	48 b8 29 8c ff ff ff 	movabs $0xffffffffffff8c29,%rax
+  80571b:	ff ff ff 
+  80571e:	48 01 d8             	add    %rbx,%rax
+  805721:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805723:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80572a:	00 00 00 
+  80572d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805730:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805734:	bf 02 00 00 00       	mov    $0x2,%edi
+  805739:	48 b8 9a c4 ff ff ff 	movabs $0xffffffffffffc49a,%rax
+  805740:	ff ff ff 
+  805743:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805747:	ff d0                	call   *%rax
+}
+  805749:	48 83 c4 10          	add    $0x10,%rsp
+  80574d:	5b                   	pop    %rbx
+  80574e:	41 5f                	pop    %r15
+  805750:	5d                   	pop    %rbp
+  805751:	c3                   	ret
+
+0000000000805752 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805752:	55                   	push   %rbp
+  805753:	48 89 e5             	mov    %rsp,%rbp
+  805756:	48 83 ec 20          	sub    $0x20,%rsp
+  80575a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80575a <nsipc_shutdown+0x8>
+  805761:	49 bb e6 38 00 00 00 	movabs $0x38e6,%r11
+  805768:	00 00 00 
+  80576b:	4c 01 d8             	add    %r11,%rax
+  80576e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805771:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805774:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805777:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  80577a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80577d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805780:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805784:	ba 08 00 00 00       	mov    $0x8,%edx
+  805789:	48 89 ce             	mov    %rcx,%rsi
+  80578c:	bf 03 00 00 00       	mov    $0x3,%edi
+  805791:	48 b9 3d c5 ff ff ff 	movabs $0xffffffffffffc53d,%rcx
+  805798:	ff ff ff 
+  80579b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80579f:	ff d0                	call   *%rax
+}
+  8057a1:	c9                   	leave
+  8057a2:	c3                   	ret
+
+00000000008057a3 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8057a3:	55                   	push   %rbp
+  8057a4:	48 89 e5             	mov    %rsp,%rbp
+  8057a7:	48 83 ec 20          	sub    $0x20,%rsp
+  8057ab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8057ab <nsipc_close+0x8>
+  8057b2:	49 bb 95 38 00 00 00 	movabs $0x3895,%r11
+  8057b9:	00 00 00 
+  8057bc:	4c 01 d8             	add    %r11,%rax
+  8057bf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8057c2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8057c5:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8057c8:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8057cc:	ba 04 00 00 00       	mov    $0x4,%edx
+  8057d1:	48 89 ce             	mov    %rcx,%rsi
+  8057d4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8057d9:	48 b9 3d c5 ff ff ff 	movabs $0xffffffffffffc53d,%rcx
+  8057e0:	ff ff ff 
+  8057e3:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8057e7:	ff d0                	call   *%rax
+}
+  8057e9:	c9                   	leave
+  8057ea:	c3                   	ret
+
+00000000008057eb <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8057eb:	55                   	push   %rbp
+  8057ec:	48 89 e5             	mov    %rsp,%rbp
+  8057ef:	41 57                	push   %r15
+  8057f1:	53                   	push   %rbx
+  8057f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8057f6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057f6 <nsipc_connect+0xb>
+  8057fd:	49 bb 4a 38 00 00 00 	movabs $0x384a,%r11
+  805804:	00 00 00 
+  805807:	4c 01 db             	add    %r11,%rbx
+  80580a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80580d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805811:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805814:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80581b:	00 00 00 
+  80581e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805821:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805824:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805827:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80582b:	48 89 c6             	mov    %rax,%rsi
+  80582e:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805835:	00 00 00 
+  805838:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80583c:	48 89 c7             	mov    %rax,%rdi
+  80583f:	49 89 df             	mov    %rbx,%r15
+  805842:	48 b8 29 8c ff ff ff 	movabs $0xffffffffffff8c29,%rax
+  805849:	ff ff ff 
+  80584c:	48 01 d8             	add    %rbx,%rax
+  80584f:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805851:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805858:	00 00 00 
+  80585b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80585e:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805862:	bf 05 00 00 00       	mov    $0x5,%edi
+  805867:	48 b8 9a c4 ff ff ff 	movabs $0xffffffffffffc49a,%rax
+  80586e:	ff ff ff 
+  805871:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805875:	ff d0                	call   *%rax
+}
+  805877:	48 83 c4 10          	add    $0x10,%rsp
+  80587b:	5b                   	pop    %rbx
+  80587c:	41 5f                	pop    %r15
+  80587e:	5d                   	pop    %rbp
+  80587f:	c3                   	ret
+
+0000000000805880 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805880:	55                   	push   %rbp
+  805881:	48 89 e5             	mov    %rsp,%rbp
+  805884:	48 83 ec 20          	sub    $0x20,%rsp
+  805888:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805888 <nsipc_listen+0x8>
+  80588f:	49 bb b8 37 00 00 00 	movabs $0x37b8,%r11
+  805896:	00 00 00 
+  805899:	4c 01 d8             	add    %r11,%rax
+  80589c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80589f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  8058a2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8058a5:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  8058a8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8058ab:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  8058ae:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8058b2:	ba 08 00 00 00       	mov    $0x8,%edx
+  8058b7:	48 89 ce             	mov    %rcx,%rsi
+  8058ba:	bf 06 00 00 00       	mov    $0x6,%edi
+  8058bf:	48 b9 3d c5 ff ff ff 	movabs $0xffffffffffffc53d,%rcx
+  8058c6:	ff ff ff 
+  8058c9:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8058cd:	ff d0                	call   *%rax
+}
+  8058cf:	c9                   	leave
+  8058d0:	c3                   	ret
+
+00000000008058d1 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8058d1:	55                   	push   %rbp
+  8058d2:	48 89 e5             	mov    %rsp,%rbp
+  8058d5:	41 57                	push   %r15
+  8058d7:	53                   	push   %rbx
+  8058d8:	48 83 ec 30          	sub    $0x30,%rsp
+  8058dc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058dc <nsipc_recv+0xb>
+  8058e3:	49 bb 64 37 00 00 00 	movabs $0x3764,%r11
+  8058ea:	00 00 00 
+  8058ed:	4c 01 db             	add    %r11,%rbx
+  8058f0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8058f3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8058f7:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8058fa:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8058fd:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805904:	00 00 00 
+  805907:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80590a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  80590d:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805914:	00 00 00 
+  805917:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80591a:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  80591e:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805925:	00 00 00 
+  805928:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80592b:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80592f:	bf 07 00 00 00       	mov    $0x7,%edi
+  805934:	48 b8 9a c4 ff ff ff 	movabs $0xffffffffffffc49a,%rax
+  80593b:	ff ff ff 
+  80593e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805942:	ff d0                	call   *%rax
+  805944:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805947:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80594b:	0f 88 91 00 00 00    	js     8059e2 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805951:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805958:	7f 08                	jg     805962 <nsipc_recv+0x91>
+  80595a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80595d:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805960:	7e 50                	jle    8059b2 <nsipc_recv+0xe1>
+  805962:	48 b8 c3 e9 ff ff ff 	movabs $0xffffffffffffe9c3,%rax
+  805969:	ff ff ff 
+  80596c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805970:	48 89 c1             	mov    %rax,%rcx
+  805973:	48 b8 d8 e9 ff ff ff 	movabs $0xffffffffffffe9d8,%rax
+  80597a:	ff ff ff 
+  80597d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805981:	48 89 c2             	mov    %rax,%rdx
+  805984:	be 79 00 00 00       	mov    $0x79,%esi
+  805989:	48 b8 ed e9 ff ff ff 	movabs $0xffffffffffffe9ed,%rax
+  805990:	ff ff ff 
+  805993:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805997:	48 89 c7             	mov    %rax,%rdi
+  80599a:	49 89 df             	mov    %rbx,%r15
+  80599d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059a2:	49 b8 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r8
+  8059a9:	ff ff ff 
+  8059ac:	49 01 d8             	add    %rbx,%r8
+  8059af:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8059b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059b5:	48 63 d0             	movslq %eax,%rdx
+  8059b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8059bc:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8059c3:	00 00 00 
+  8059c6:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  8059ca:	48 89 ce             	mov    %rcx,%rsi
+  8059cd:	48 89 c7             	mov    %rax,%rdi
+  8059d0:	49 89 df             	mov    %rbx,%r15
+  8059d3:	48 b8 29 8c ff ff ff 	movabs $0xffffffffffff8c29,%rax
+  8059da:	ff ff ff 
+  8059dd:	48 01 d8             	add    %rbx,%rax
+  8059e0:	ff d0                	call   *%rax
+	}
+
+	return r;
+  8059e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8059e5:	48 83 c4 30          	add    $0x30,%rsp
+  8059e9:	5b                   	pop    %rbx
+  8059ea:	41 5f                	pop    %r15
+  8059ec:	5d                   	pop    %rbp
+  8059ed:	c3                   	ret
+
+00000000008059ee <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8059ee:	55                   	push   %rbp
+  8059ef:	48 89 e5             	mov    %rsp,%rbp
+  8059f2:	41 57                	push   %r15
+  8059f4:	53                   	push   %rbx
+  8059f5:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8059fc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059fc <nsipc_send+0xe>
+  805a03:	49 bb 44 36 00 00 00 	movabs $0x3644,%r11
+  805a0a:	00 00 00 
+  805a0d:	4c 01 db             	add    %r11,%rbx
+  805a10:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805a16:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805a1d:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805a23:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805a29:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805a2d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805a31:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805a38:	00 00 00 
+  805a3b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805a3e:	85 c0                	test   %eax,%eax
+  805a40:	75 24                	jne    805a66 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805a42:	bf 02 00 00 00       	mov    $0x2,%edi
+  805a47:	49 89 df             	mov    %rbx,%r15
+  805a4a:	48 b8 db e0 ff ff ff 	movabs $0xffffffffffffe0db,%rax
+  805a51:	ff ff ff 
+  805a54:	48 01 d8             	add    %rbx,%rax
+  805a57:	ff d0                	call   *%rax
+  805a59:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805a60:	00 00 00 
+  805a63:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805a66:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805a6c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805a6f:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805a76:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805a79:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805a7c:	39 c2                	cmp    %eax,%edx
+  805a7e:	0f 4e c2             	cmovle %edx,%eax
+  805a81:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805a87:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805a8d:	48 63 d0             	movslq %eax,%rdx
+  805a90:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805a97:	48 89 c6             	mov    %rax,%rsi
+  805a9a:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805aa1:	00 00 00 
+  805aa4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805aa8:	48 89 c7             	mov    %rax,%rdi
+  805aab:	49 89 df             	mov    %rbx,%r15
+  805aae:	48 b8 29 8c ff ff ff 	movabs $0xffffffffffff8c29,%rax
+  805ab5:	ff ff ff 
+  805ab8:	48 01 d8             	add    %rbx,%rax
+  805abb:	ff d0                	call   *%rax
+	req->req_s = s;
+  805abd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ac1:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805ac7:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805ac9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805acd:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805ad3:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805ad6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ada:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805ae0:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805ae3:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805aea:	00 00 00 
+  805aed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805af1:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805af5:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805afc:	00 
+  805afd:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805b03:	48 63 d0             	movslq %eax,%rdx
+  805b06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b0a:	48 01 d0             	add    %rdx,%rax
+  805b0d:	48 83 e8 01          	sub    $0x1,%rax
+  805b11:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805b15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b19:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b1e:	48 f7 75 d8          	divq   -0x28(%rbp)
+  805b22:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b26:	48 29 d0             	sub    %rdx,%rax
+  805b29:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805b2f:	85 c0                	test   %eax,%eax
+  805b31:	0f 48 c2             	cmovs  %edx,%eax
+  805b34:	c1 f8 0c             	sar    $0xc,%eax
+  805b37:	48 98                	cltq
+  805b39:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  805b3d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805b41:	48 85 c0             	test   %rax,%rax
+  805b44:	0f 95 c0             	setne  %al
+  805b47:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  805b4a:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  805b51:	00 
+  805b52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b56:	48 83 c0 0b          	add    $0xb,%rax
+  805b5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805b5e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805b62:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b67:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805b6b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805b6f:	48 29 d0             	sub    %rdx,%rax
+  805b72:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805b76:	89 c7                	mov    %eax,%edi
+  805b78:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805b7f:	00 00 00 
+  805b82:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805b85:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805b89:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805b8d:	48 83 ec 08          	sub    $0x8,%rsp
+  805b91:	6a 00                	push   $0x0
+  805b93:	6a 00                	push   $0x0
+  805b95:	6a 05                	push   $0x5
+  805b97:	41 89 f1             	mov    %esi,%r9d
+  805b9a:	49 89 c8             	mov    %rcx,%r8
+  805b9d:	89 f9                	mov    %edi,%ecx
+  805b9f:	be 08 00 00 00       	mov    $0x8,%esi
+  805ba4:	89 c7                	mov    %eax,%edi
+  805ba6:	49 89 df             	mov    %rbx,%r15
+  805ba9:	48 b8 e3 dc ff ff ff 	movabs $0xffffffffffffdce3,%rax
+  805bb0:	ff ff ff 
+  805bb3:	48 01 d8             	add    %rbx,%rax
+  805bb6:	ff d0                	call   *%rax
+  805bb8:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805bbc:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805bc0:	5b                   	pop    %rbx
+  805bc1:	41 5f                	pop    %r15
+  805bc3:	5d                   	pop    %rbp
+  805bc4:	c3                   	ret
+
+0000000000805bc5 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805bc5:	55                   	push   %rbp
+  805bc6:	48 89 e5             	mov    %rsp,%rbp
+  805bc9:	48 83 ec 10          	sub    $0x10,%rsp
+  805bcd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805bcd <nsipc_socket+0x8>
+  805bd4:	49 bb 73 34 00 00 00 	movabs $0x3473,%r11
+  805bdb:	00 00 00 
+  805bde:	4c 01 d8             	add    %r11,%rax
+  805be1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805be4:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805be7:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805bea:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805bf1:	00 00 00 
+  805bf4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805bf7:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805bfa:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805c01:	00 00 00 
+  805c04:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805c07:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805c0b:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805c12:	00 00 00 
+  805c15:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805c18:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  805c1c:	bf 09 00 00 00       	mov    $0x9,%edi
+  805c21:	48 ba 9a c4 ff ff ff 	movabs $0xffffffffffffc49a,%rdx
+  805c28:	ff ff ff 
+  805c2b:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805c2f:	ff d0                	call   *%rax
+}
+  805c31:	c9                   	leave
+  805c32:	c3                   	ret
+
+0000000000805c33 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805c33:	55                   	push   %rbp
+  805c34:	48 89 e5             	mov    %rsp,%rbp
+  805c37:	41 57                	push   %r15
+  805c39:	53                   	push   %rbx
+  805c3a:	48 83 ec 30          	sub    $0x30,%rsp
+  805c3e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c3e <pipe+0xb>
+  805c45:	49 bb 02 34 00 00 00 	movabs $0x3402,%r11
+  805c4c:	00 00 00 
+  805c4f:	4c 01 db             	add    %r11,%rbx
+  805c52:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805c56:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805c5a:	48 89 c7             	mov    %rax,%rdi
+  805c5d:	49 89 df             	mov    %rbx,%r15
+  805c60:	48 b8 b4 a8 ff ff ff 	movabs $0xffffffffffffa8b4,%rax
+  805c67:	ff ff ff 
+  805c6a:	48 01 d8             	add    %rbx,%rax
+  805c6d:	ff d0                	call   *%rax
+  805c6f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c72:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c76:	0f 88 12 02 00 00    	js     805e8e <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805c7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c80:	ba 07 04 00 00       	mov    $0x407,%edx
+  805c85:	48 89 c6             	mov    %rax,%rsi
+  805c88:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c8d:	49 89 df             	mov    %rbx,%r15
+  805c90:	48 b8 05 95 ff ff ff 	movabs $0xffffffffffff9505,%rax
+  805c97:	ff ff ff 
+  805c9a:	48 01 d8             	add    %rbx,%rax
+  805c9d:	ff d0                	call   *%rax
+  805c9f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ca2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ca6:	0f 88 e2 01 00 00    	js     805e8e <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805cac:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805cb0:	48 89 c7             	mov    %rax,%rdi
+  805cb3:	49 89 df             	mov    %rbx,%r15
+  805cb6:	48 b8 b4 a8 ff ff ff 	movabs $0xffffffffffffa8b4,%rax
+  805cbd:	ff ff ff 
+  805cc0:	48 01 d8             	add    %rbx,%rax
+  805cc3:	ff d0                	call   *%rax
+  805cc5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805cc8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ccc:	0f 88 9b 01 00 00    	js     805e6d <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805cd2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805cd6:	ba 07 04 00 00       	mov    $0x407,%edx
+  805cdb:	48 89 c6             	mov    %rax,%rsi
+  805cde:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ce3:	49 89 df             	mov    %rbx,%r15
+  805ce6:	48 b8 05 95 ff ff ff 	movabs $0xffffffffffff9505,%rax
+  805ced:	ff ff ff 
+  805cf0:	48 01 d8             	add    %rbx,%rax
+  805cf3:	ff d0                	call   *%rax
+  805cf5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805cf8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805cfc:	0f 88 6b 01 00 00    	js     805e6d <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  805d02:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805d06:	48 89 c7             	mov    %rax,%rdi
+  805d09:	49 89 df             	mov    %rbx,%r15
+  805d0c:	48 b8 71 a8 ff ff ff 	movabs $0xffffffffffffa871,%rax
+  805d13:	ff ff ff 
+  805d16:	48 01 d8             	add    %rbx,%rax
+  805d19:	ff d0                	call   *%rax
+  805d1b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805d1f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d23:	ba 07 04 00 00       	mov    $0x407,%edx
+  805d28:	48 89 c6             	mov    %rax,%rsi
+  805d2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d30:	49 89 df             	mov    %rbx,%r15
+  805d33:	48 b8 05 95 ff ff ff 	movabs $0xffffffffffff9505,%rax
+  805d3a:	ff ff ff 
+  805d3d:	48 01 d8             	add    %rbx,%rax
+  805d40:	ff d0                	call   *%rax
+  805d42:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805d45:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d49:	0f 88 fd 00 00 00    	js     805e4c <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805d4f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805d53:	48 89 c7             	mov    %rax,%rdi
+  805d56:	49 89 df             	mov    %rbx,%r15
+  805d59:	48 b8 71 a8 ff ff ff 	movabs $0xffffffffffffa871,%rax
+  805d60:	ff ff ff 
+  805d63:	48 01 d8             	add    %rbx,%rax
+  805d66:	ff d0                	call   *%rax
+  805d68:	48 89 c2             	mov    %rax,%rdx
+  805d6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d6f:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805d75:	48 89 d1             	mov    %rdx,%rcx
+  805d78:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d7d:	48 89 c6             	mov    %rax,%rsi
+  805d80:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d85:	49 89 df             	mov    %rbx,%r15
+  805d88:	48 b8 6a 95 ff ff ff 	movabs $0xffffffffffff956a,%rax
+  805d8f:	ff ff ff 
+  805d92:	48 01 d8             	add    %rbx,%rax
+  805d95:	ff d0                	call   *%rax
+  805d97:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805d9a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d9e:	0f 88 87 00 00 00    	js     805e2b <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805da4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805da8:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805daf:	00 00 00 
+  805db2:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805db5:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805db7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805dbb:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805dc2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805dc6:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805dcd:	00 00 00 
+  805dd0:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805dd3:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805dd5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805dd9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805de0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805de4:	48 89 c7             	mov    %rax,%rdi
+  805de7:	49 89 df             	mov    %rbx,%r15
+  805dea:	48 b8 3a a8 ff ff ff 	movabs $0xffffffffffffa83a,%rax
+  805df1:	ff ff ff 
+  805df4:	48 01 d8             	add    %rbx,%rax
+  805df7:	ff d0                	call   *%rax
+  805df9:	89 c2                	mov    %eax,%edx
+  805dfb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805dff:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805e01:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e05:	48 89 c7             	mov    %rax,%rdi
+  805e08:	49 89 df             	mov    %rbx,%r15
+  805e0b:	48 b8 3a a8 ff ff ff 	movabs $0xffffffffffffa83a,%rax
+  805e12:	ff ff ff 
+  805e15:	48 01 d8             	add    %rbx,%rax
+  805e18:	ff d0                	call   *%rax
+  805e1a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805e1e:	48 83 c2 04          	add    $0x4,%rdx
+  805e22:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805e24:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e29:	eb 67                	jmp    805e92 <pipe+0x25f>
+		goto err3;
+  805e2b:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  805e2c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e30:	48 89 c6             	mov    %rax,%rsi
+  805e33:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e38:	49 89 df             	mov    %rbx,%r15
+  805e3b:	48 b8 dd 95 ff ff ff 	movabs $0xffffffffffff95dd,%rax
+  805e42:	ff ff ff 
+  805e45:	48 01 d8             	add    %rbx,%rax
+  805e48:	ff d0                	call   *%rax
+  805e4a:	eb 01                	jmp    805e4d <pipe+0x21a>
+		goto err2;
+  805e4c:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  805e4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e51:	48 89 c6             	mov    %rax,%rsi
+  805e54:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e59:	49 89 df             	mov    %rbx,%r15
+  805e5c:	48 b8 dd 95 ff ff ff 	movabs $0xffffffffffff95dd,%rax
+  805e63:	ff ff ff 
+  805e66:	48 01 d8             	add    %rbx,%rax
+  805e69:	ff d0                	call   *%rax
+  805e6b:	eb 01                	jmp    805e6e <pipe+0x23b>
+		goto err1;
+  805e6d:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805e6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e72:	48 89 c6             	mov    %rax,%rsi
+  805e75:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e7a:	49 89 df             	mov    %rbx,%r15
+  805e7d:	48 b8 dd 95 ff ff ff 	movabs $0xffffffffffff95dd,%rax
+  805e84:	ff ff ff 
+  805e87:	48 01 d8             	add    %rbx,%rax
+  805e8a:	ff d0                	call   *%rax
+  805e8c:	eb 01                	jmp    805e8f <pipe+0x25c>
+		goto err;
+  805e8e:	90                   	nop
+err:
+	return r;
+  805e8f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805e92:	48 83 c4 30          	add    $0x30,%rsp
+  805e96:	5b                   	pop    %rbx
+  805e97:	41 5f                	pop    %r15
+  805e99:	5d                   	pop    %rbp
+  805e9a:	c3                   	ret
+
+0000000000805e9b <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805e9b:	55                   	push   %rbp
+  805e9c:	48 89 e5             	mov    %rsp,%rbp
+  805e9f:	41 57                	push   %r15
+  805ea1:	41 54                	push   %r12
+  805ea3:	53                   	push   %rbx
+  805ea4:	48 83 ec 28          	sub    $0x28,%rsp
+  805ea8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ea8 <_pipeisclosed+0xd>
+  805eaf:	49 bb 98 31 00 00 00 	movabs $0x3198,%r11
+  805eb6:	00 00 00 
+  805eb9:	4c 01 db             	add    %r11,%rbx
+  805ebc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805ec0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805ec4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805ecb:	ff ff ff 
+  805ece:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ed2:	48 8b 00             	mov    (%rax),%rax
+  805ed5:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805edb:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805ede:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805ee2:	48 89 c7             	mov    %rax,%rdi
+  805ee5:	49 89 df             	mov    %rbx,%r15
+  805ee8:	48 b8 6a e1 ff ff ff 	movabs $0xffffffffffffe16a,%rax
+  805eef:	ff ff ff 
+  805ef2:	48 01 d8             	add    %rbx,%rax
+  805ef5:	ff d0                	call   *%rax
+  805ef7:	41 89 c4             	mov    %eax,%r12d
+  805efa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805efe:	48 89 c7             	mov    %rax,%rdi
+  805f01:	49 89 df             	mov    %rbx,%r15
+  805f04:	48 b8 6a e1 ff ff ff 	movabs $0xffffffffffffe16a,%rax
+  805f0b:	ff ff ff 
+  805f0e:	48 01 d8             	add    %rbx,%rax
+  805f11:	ff d0                	call   *%rax
+  805f13:	41 39 c4             	cmp    %eax,%r12d
+  805f16:	0f 94 c0             	sete   %al
+  805f19:	0f b6 c0             	movzbl %al,%eax
+  805f1c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805f1f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805f26:	ff ff ff 
+  805f29:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805f2d:	48 8b 00             	mov    (%rax),%rax
+  805f30:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805f36:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805f39:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805f3c:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805f3f:	75 05                	jne    805f46 <_pipeisclosed+0xab>
+			return ret;
+  805f41:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805f44:	eb 63                	jmp    805fa9 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805f46:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805f49:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805f4c:	0f 84 72 ff ff ff    	je     805ec4 <_pipeisclosed+0x29>
+  805f52:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805f56:	0f 85 68 ff ff ff    	jne    805ec4 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805f5c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805f63:	ff ff ff 
+  805f66:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805f6a:	48 8b 00             	mov    (%rax),%rax
+  805f6d:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805f73:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805f76:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805f79:	89 c6                	mov    %eax,%esi
+  805f7b:	48 b8 fe e9 ff ff ff 	movabs $0xffffffffffffe9fe,%rax
+  805f82:	ff ff ff 
+  805f85:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f89:	48 89 c7             	mov    %rax,%rdi
+  805f8c:	49 89 df             	mov    %rbx,%r15
+  805f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f94:	49 b8 87 7a ff ff ff 	movabs $0xffffffffffff7a87,%r8
+  805f9b:	ff ff ff 
+  805f9e:	49 01 d8             	add    %rbx,%r8
+  805fa1:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  805fa4:	e9 1b ff ff ff       	jmp    805ec4 <_pipeisclosed+0x29>
+	}
+}
+  805fa9:	48 83 c4 28          	add    $0x28,%rsp
+  805fad:	5b                   	pop    %rbx
+  805fae:	41 5c                	pop    %r12
+  805fb0:	41 5f                	pop    %r15
+  805fb2:	5d                   	pop    %rbp
+  805fb3:	c3                   	ret
+
+0000000000805fb4 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  805fb4:	55                   	push   %rbp
+  805fb5:	48 89 e5             	mov    %rsp,%rbp
+  805fb8:	41 57                	push   %r15
+  805fba:	53                   	push   %rbx
+  805fbb:	48 83 ec 30          	sub    $0x30,%rsp
+  805fbf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fbf <pipeisclosed+0xb>
+  805fc6:	49 bb 81 30 00 00 00 	movabs $0x3081,%r11
+  805fcd:	00 00 00 
+  805fd0:	4c 01 db             	add    %r11,%rbx
+  805fd3:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805fd6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805fda:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805fdd:	48 89 d6             	mov    %rdx,%rsi
+  805fe0:	89 c7                	mov    %eax,%edi
+  805fe2:	49 89 df             	mov    %rbx,%r15
+  805fe5:	48 b8 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rax
+  805fec:	ff ff ff 
+  805fef:	48 01 d8             	add    %rbx,%rax
+  805ff2:	ff d0                	call   *%rax
+  805ff4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ff7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ffb:	79 05                	jns    806002 <pipeisclosed+0x4e>
+		return r;
+  805ffd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806000:	eb 3b                	jmp    80603d <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  806002:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806006:	48 89 c7             	mov    %rax,%rdi
+  806009:	49 89 df             	mov    %rbx,%r15
+  80600c:	48 b8 71 a8 ff ff ff 	movabs $0xffffffffffffa871,%rax
+  806013:	ff ff ff 
+  806016:	48 01 d8             	add    %rbx,%rax
+  806019:	ff d0                	call   *%rax
+  80601b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  80601f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806023:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806027:	48 89 d6             	mov    %rdx,%rsi
+  80602a:	48 89 c7             	mov    %rax,%rdi
+  80602d:	48 b8 5b ce ff ff ff 	movabs $0xffffffffffffce5b,%rax
+  806034:	ff ff ff 
+  806037:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80603b:	ff d0                	call   *%rax
+}
+  80603d:	48 83 c4 30          	add    $0x30,%rsp
+  806041:	5b                   	pop    %rbx
+  806042:	41 5f                	pop    %r15
+  806044:	5d                   	pop    %rbp
+  806045:	c3                   	ret
+
+0000000000806046 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806046:	55                   	push   %rbp
+  806047:	48 89 e5             	mov    %rsp,%rbp
+  80604a:	41 57                	push   %r15
+  80604c:	53                   	push   %rbx
+  80604d:	48 83 ec 40          	sub    $0x40,%rsp
+  806051:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806051 <devpipe_read+0xb>
+  806058:	49 bb ef 2f 00 00 00 	movabs $0x2fef,%r11
+  80605f:	00 00 00 
+  806062:	4c 01 db             	add    %r11,%rbx
+  806065:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806069:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80606d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  806071:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806075:	48 89 c7             	mov    %rax,%rdi
+  806078:	49 89 df             	mov    %rbx,%r15
+  80607b:	48 b8 71 a8 ff ff ff 	movabs $0xffffffffffffa871,%rax
+  806082:	ff ff ff 
+  806085:	48 01 d8             	add    %rbx,%rax
+  806088:	ff d0                	call   *%rax
+  80608a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  80608e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806092:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806096:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80609d:	00 
+  80609e:	e9 a1 00 00 00       	jmp    806144 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8060a3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8060a8:	74 09                	je     8060b3 <devpipe_read+0x6d>
+				return i;
+  8060aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060ae:	e9 9f 00 00 00       	jmp    806152 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8060b3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8060b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8060bb:	48 89 d6             	mov    %rdx,%rsi
+  8060be:	48 89 c7             	mov    %rax,%rdi
+  8060c1:	48 b8 5b ce ff ff ff 	movabs $0xffffffffffffce5b,%rax
+  8060c8:	ff ff ff 
+  8060cb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8060cf:	ff d0                	call   *%rax
+  8060d1:	85 c0                	test   %eax,%eax
+  8060d3:	74 07                	je     8060dc <devpipe_read+0x96>
+				return 0;
+  8060d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060da:	eb 76                	jmp    806152 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8060dc:	49 89 df             	mov    %rbx,%r15
+  8060df:	48 b8 b0 94 ff ff ff 	movabs $0xffffffffffff94b0,%rax
+  8060e6:	ff ff ff 
+  8060e9:	48 01 d8             	add    %rbx,%rax
+  8060ec:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8060ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060f2:	8b 10                	mov    (%rax),%edx
+  8060f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060f8:	8b 40 04             	mov    0x4(%rax),%eax
+  8060fb:	39 c2                	cmp    %eax,%edx
+  8060fd:	74 a4                	je     8060a3 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8060ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806103:	8b 10                	mov    (%rax),%edx
+  806105:	89 d0                	mov    %edx,%eax
+  806107:	c1 f8 1f             	sar    $0x1f,%eax
+  80610a:	c1 e8 1b             	shr    $0x1b,%eax
+  80610d:	01 c2                	add    %eax,%edx
+  80610f:	83 e2 1f             	and    $0x1f,%edx
+  806112:	29 c2                	sub    %eax,%edx
+  806114:	89 d6                	mov    %edx,%esi
+  806116:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80611a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80611e:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806122:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806126:	48 63 c6             	movslq %esi,%rax
+  806129:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  80612e:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806130:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806134:	8b 00                	mov    (%rax),%eax
+  806136:	8d 50 01             	lea    0x1(%rax),%edx
+  806139:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80613d:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  80613f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806144:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806148:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80614c:	72 a0                	jb     8060ee <devpipe_read+0xa8>
+	}
+	return i;
+  80614e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806152:	48 83 c4 40          	add    $0x40,%rsp
+  806156:	5b                   	pop    %rbx
+  806157:	41 5f                	pop    %r15
+  806159:	5d                   	pop    %rbp
+  80615a:	c3                   	ret
+
+000000000080615b <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80615b:	55                   	push   %rbp
+  80615c:	48 89 e5             	mov    %rsp,%rbp
+  80615f:	41 57                	push   %r15
+  806161:	53                   	push   %rbx
+  806162:	48 83 ec 40          	sub    $0x40,%rsp
+  806166:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806166 <devpipe_write+0xb>
+  80616d:	49 bb da 2e 00 00 00 	movabs $0x2eda,%r11
+  806174:	00 00 00 
+  806177:	4c 01 db             	add    %r11,%rbx
+  80617a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80617e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806182:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  806186:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80618a:	48 89 c7             	mov    %rax,%rdi
+  80618d:	49 89 df             	mov    %rbx,%r15
+  806190:	48 b8 71 a8 ff ff ff 	movabs $0xffffffffffffa871,%rax
+  806197:	ff ff ff 
+  80619a:	48 01 d8             	add    %rbx,%rax
+  80619d:	ff d0                	call   *%rax
+  80619f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8061a3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8061a7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8061ab:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8061b2:	00 
+  8061b3:	e9 a0 00 00 00       	jmp    806258 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8061b8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8061bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8061c0:	48 89 d6             	mov    %rdx,%rsi
+  8061c3:	48 89 c7             	mov    %rax,%rdi
+  8061c6:	48 b8 5b ce ff ff ff 	movabs $0xffffffffffffce5b,%rax
+  8061cd:	ff ff ff 
+  8061d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8061d4:	ff d0                	call   *%rax
+  8061d6:	85 c0                	test   %eax,%eax
+  8061d8:	74 0a                	je     8061e4 <devpipe_write+0x89>
+				return 0;
+  8061da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061df:	e9 82 00 00 00       	jmp    806266 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8061e4:	49 89 df             	mov    %rbx,%r15
+  8061e7:	48 b8 b0 94 ff ff ff 	movabs $0xffffffffffff94b0,%rax
+  8061ee:	ff ff ff 
+  8061f1:	48 01 d8             	add    %rbx,%rax
+  8061f4:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8061f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061fa:	8b 40 04             	mov    0x4(%rax),%eax
+  8061fd:	48 63 d0             	movslq %eax,%rdx
+  806200:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806204:	8b 00                	mov    (%rax),%eax
+  806206:	48 98                	cltq
+  806208:	48 83 c0 20          	add    $0x20,%rax
+  80620c:	48 39 c2             	cmp    %rax,%rdx
+  80620f:	73 a7                	jae    8061b8 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  806211:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806215:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806219:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80621d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806221:	8b 50 04             	mov    0x4(%rax),%edx
+  806224:	89 d0                	mov    %edx,%eax
+  806226:	c1 f8 1f             	sar    $0x1f,%eax
+  806229:	c1 e8 1b             	shr    $0x1b,%eax
+  80622c:	01 c2                	add    %eax,%edx
+  80622e:	83 e2 1f             	and    $0x1f,%edx
+  806231:	29 c2                	sub    %eax,%edx
+  806233:	89 d0                	mov    %edx,%eax
+  806235:	0f b6 09             	movzbl (%rcx),%ecx
+  806238:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80623c:	48 98                	cltq
+  80623e:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  806242:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806246:	8b 40 04             	mov    0x4(%rax),%eax
+  806249:	8d 50 01             	lea    0x1(%rax),%edx
+  80624c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806250:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  806253:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806258:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80625c:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806260:	72 94                	jb     8061f6 <devpipe_write+0x9b>
+	}
+
+	return i;
+  806262:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806266:	48 83 c4 40          	add    $0x40,%rsp
+  80626a:	5b                   	pop    %rbx
+  80626b:	41 5f                	pop    %r15
+  80626d:	5d                   	pop    %rbp
+  80626e:	c3                   	ret
+
+000000000080626f <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80626f:	55                   	push   %rbp
+  806270:	48 89 e5             	mov    %rsp,%rbp
+  806273:	41 57                	push   %r15
+  806275:	53                   	push   %rbx
+  806276:	48 83 ec 20          	sub    $0x20,%rsp
+  80627a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80627a <devpipe_stat+0xb>
+  806281:	49 bb c6 2d 00 00 00 	movabs $0x2dc6,%r11
+  806288:	00 00 00 
+  80628b:	4c 01 db             	add    %r11,%rbx
+  80628e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806292:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  806296:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80629a:	48 89 c7             	mov    %rax,%rdi
+  80629d:	49 89 df             	mov    %rbx,%r15
+  8062a0:	48 b8 71 a8 ff ff ff 	movabs $0xffffffffffffa871,%rax
+  8062a7:	ff ff ff 
+  8062aa:	48 01 d8             	add    %rbx,%rax
+  8062ad:	ff d0                	call   *%rax
+  8062af:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8062b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062b7:	48 ba 11 ea ff ff ff 	movabs $0xffffffffffffea11,%rdx
+  8062be:	ff ff ff 
+  8062c1:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8062c5:	48 89 d6             	mov    %rdx,%rsi
+  8062c8:	48 89 c7             	mov    %rax,%rdi
+  8062cb:	49 89 df             	mov    %rbx,%r15
+  8062ce:	48 b8 49 88 ff ff ff 	movabs $0xffffffffffff8849,%rax
+  8062d5:	ff ff ff 
+  8062d8:	48 01 d8             	add    %rbx,%rax
+  8062db:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8062dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062e1:	8b 50 04             	mov    0x4(%rax),%edx
+  8062e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062e8:	8b 00                	mov    (%rax),%eax
+  8062ea:	29 c2                	sub    %eax,%edx
+  8062ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062f0:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8062f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062fa:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  806301:	00 00 00 
+	stat->st_dev = &devpipe;
+  806304:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806308:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  80630f:	00 00 00 
+  806312:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806316:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  80631d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806322:	48 83 c4 20          	add    $0x20,%rsp
+  806326:	5b                   	pop    %rbx
+  806327:	41 5f                	pop    %r15
+  806329:	5d                   	pop    %rbp
+  80632a:	c3                   	ret
+
+000000000080632b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80632b:	55                   	push   %rbp
+  80632c:	48 89 e5             	mov    %rsp,%rbp
+  80632f:	41 57                	push   %r15
+  806331:	53                   	push   %rbx
+  806332:	48 83 ec 10          	sub    $0x10,%rsp
+  806336:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806336 <devpipe_close+0xb>
+  80633d:	49 bb 0a 2d 00 00 00 	movabs $0x2d0a,%r11
+  806344:	00 00 00 
+  806347:	4c 01 db             	add    %r11,%rbx
+  80634a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  80634e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806352:	48 89 c6             	mov    %rax,%rsi
+  806355:	bf 00 00 00 00       	mov    $0x0,%edi
+  80635a:	49 89 df             	mov    %rbx,%r15
+  80635d:	48 b8 dd 95 ff ff ff 	movabs $0xffffffffffff95dd,%rax
+  806364:	ff ff ff 
+  806367:	48 01 d8             	add    %rbx,%rax
+  80636a:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80636c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806370:	48 89 c7             	mov    %rax,%rdi
+  806373:	49 89 df             	mov    %rbx,%r15
+  806376:	48 b8 71 a8 ff ff ff 	movabs $0xffffffffffffa871,%rax
+  80637d:	ff ff ff 
+  806380:	48 01 d8             	add    %rbx,%rax
+  806383:	ff d0                	call   *%rax
+  806385:	48 89 c6             	mov    %rax,%rsi
+  806388:	bf 00 00 00 00       	mov    $0x0,%edi
+  80638d:	49 89 df             	mov    %rbx,%r15
+  806390:	48 b8 dd 95 ff ff ff 	movabs $0xffffffffffff95dd,%rax
+  806397:	ff ff ff 
+  80639a:	48 01 d8             	add    %rbx,%rax
+  80639d:	ff d0                	call   *%rax
+}
+  80639f:	48 83 c4 10          	add    $0x10,%rsp
+  8063a3:	5b                   	pop    %rbx
+  8063a4:	41 5f                	pop    %r15
+  8063a6:	5d                   	pop    %rbp
+  8063a7:	c3                   	ret
+
+00000000008063a8 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8063a8:	55                   	push   %rbp
+  8063a9:	48 89 e5             	mov    %rsp,%rbp
+  8063ac:	41 57                	push   %r15
+  8063ae:	53                   	push   %rbx
+  8063af:	48 83 ec 20          	sub    $0x20,%rsp
+  8063b3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8063b3 <wait+0xb>
+  8063ba:	49 bb 8d 2c 00 00 00 	movabs $0x2c8d,%r11
+  8063c1:	00 00 00 
+  8063c4:	4c 01 db             	add    %r11,%rbx
+  8063c7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8063ca:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8063ce:	75 50                	jne    806420 <wait+0x78>
+  8063d0:	48 b8 18 ea ff ff ff 	movabs $0xffffffffffffea18,%rax
+  8063d7:	ff ff ff 
+  8063da:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8063de:	48 89 c1             	mov    %rax,%rcx
+  8063e1:	48 b8 23 ea ff ff ff 	movabs $0xffffffffffffea23,%rax
+  8063e8:	ff ff ff 
+  8063eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8063ef:	48 89 c2             	mov    %rax,%rdx
+  8063f2:	be 09 00 00 00       	mov    $0x9,%esi
+  8063f7:	48 b8 38 ea ff ff ff 	movabs $0xffffffffffffea38,%rax
+  8063fe:	ff ff ff 
+  806401:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806405:	48 89 c7             	mov    %rax,%rdi
+  806408:	49 89 df             	mov    %rbx,%r15
+  80640b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806410:	49 b8 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%r8
+  806417:	ff ff ff 
+  80641a:	49 01 d8             	add    %rbx,%r8
+  80641d:	41 ff d0             	call   *%r8
+	e = &envs[ENVX(envid)];
+  806420:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806423:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806428:	48 98                	cltq
+  80642a:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806431:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806438:	ff ff ff 
+  80643b:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80643f:	48 01 d0             	add    %rdx,%rax
+  806442:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  806446:	eb 12                	jmp    80645a <wait+0xb2>
+		sys_yield();
+  806448:	49 89 df             	mov    %rbx,%r15
+  80644b:	48 b8 b0 94 ff ff ff 	movabs $0xffffffffffff94b0,%rax
+  806452:	ff ff ff 
+  806455:	48 01 d8             	add    %rbx,%rax
+  806458:	ff d0                	call   *%rax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80645a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80645e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  806464:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  806467:	75 0e                	jne    806477 <wait+0xcf>
+  806469:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80646d:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  806473:	85 c0                	test   %eax,%eax
+  806475:	75 d1                	jne    806448 <wait+0xa0>
+}
+  806477:	90                   	nop
+  806478:	48 83 c4 20          	add    $0x20,%rsp
+  80647c:	5b                   	pop    %rbx
+  80647d:	41 5f                	pop    %r15
+  80647f:	5d                   	pop    %rbp
+  806480:	c3                   	ret
+
+0000000000806481 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  806481:	55                   	push   %rbp
+  806482:	48 89 e5             	mov    %rsp,%rbp
+  806485:	41 57                	push   %r15
+  806487:	48 83 ec 28          	sub    $0x28,%rsp
+  80648b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80648b <cputchar+0xa>
+  806492:	49 bb b5 2b 00 00 00 	movabs $0x2bb5,%r11
+  806499:	00 00 00 
+  80649c:	4c 01 d8             	add    %r11,%rax
+  80649f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8064a2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8064a5:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8064a8:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8064ac:	be 01 00 00 00       	mov    $0x1,%esi
+  8064b1:	48 89 d7             	mov    %rdx,%rdi
+  8064b4:	49 89 c7             	mov    %rax,%r15
+  8064b7:	48 ba 4d 93 ff ff ff 	movabs $0xffffffffffff934d,%rdx
+  8064be:	ff ff ff 
+  8064c1:	48 01 c2             	add    %rax,%rdx
+  8064c4:	ff d2                	call   *%rdx
+}
+  8064c6:	90                   	nop
+  8064c7:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8064cb:	c9                   	leave
+  8064cc:	c3                   	ret
+
+00000000008064cd <getchar>:
+
+int
+getchar(void)
+{
+  8064cd:	55                   	push   %rbp
+  8064ce:	48 89 e5             	mov    %rsp,%rbp
+  8064d1:	41 57                	push   %r15
+  8064d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8064d7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8064d7 <getchar+0xa>
+  8064de:	49 bb 69 2b 00 00 00 	movabs $0x2b69,%r11
+  8064e5:	00 00 00 
+  8064e8:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8064eb:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8064ef:	ba 01 00 00 00       	mov    $0x1,%edx
+  8064f4:	48 89 ce             	mov    %rcx,%rsi
+  8064f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8064fc:	49 89 c7             	mov    %rax,%r15
+  8064ff:	48 b9 b1 ae ff ff ff 	movabs $0xffffffffffffaeb1,%rcx
+  806506:	ff ff ff 
+  806509:	48 01 c1             	add    %rax,%rcx
+  80650c:	ff d1                	call   *%rcx
+  80650e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  806511:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806515:	79 05                	jns    80651c <getchar+0x4f>
+		return r;
+  806517:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80651a:	eb 14                	jmp    806530 <getchar+0x63>
+	if (r < 1)
+  80651c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806520:	7f 07                	jg     806529 <getchar+0x5c>
+		return -E_EOF;
+  806522:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806527:	eb 07                	jmp    806530 <getchar+0x63>
+	return c;
+  806529:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  80652d:	0f b6 c0             	movzbl %al,%eax
+}
+  806530:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806534:	c9                   	leave
+  806535:	c3                   	ret
+
+0000000000806536 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  806536:	55                   	push   %rbp
+  806537:	48 89 e5             	mov    %rsp,%rbp
+  80653a:	41 57                	push   %r15
+  80653c:	53                   	push   %rbx
+  80653d:	48 83 ec 20          	sub    $0x20,%rsp
+  806541:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806541 <iscons+0xb>
+  806548:	49 bb ff 2a 00 00 00 	movabs $0x2aff,%r11
+  80654f:	00 00 00 
+  806552:	4c 01 db             	add    %r11,%rbx
+  806555:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806558:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80655c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80655f:	48 89 d6             	mov    %rdx,%rsi
+  806562:	89 c7                	mov    %eax,%edi
+  806564:	49 89 df             	mov    %rbx,%r15
+  806567:	48 b8 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rax
+  80656e:	ff ff ff 
+  806571:	48 01 d8             	add    %rbx,%rax
+  806574:	ff d0                	call   *%rax
+  806576:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806579:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80657d:	79 05                	jns    806584 <iscons+0x4e>
+		return r;
+  80657f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806582:	eb 1b                	jmp    80659f <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  806584:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806588:	8b 10                	mov    (%rax),%edx
+  80658a:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  806591:	00 00 00 
+  806594:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806597:	39 c2                	cmp    %eax,%edx
+  806599:	0f 94 c0             	sete   %al
+  80659c:	0f b6 c0             	movzbl %al,%eax
+}
+  80659f:	48 83 c4 20          	add    $0x20,%rsp
+  8065a3:	5b                   	pop    %rbx
+  8065a4:	41 5f                	pop    %r15
+  8065a6:	5d                   	pop    %rbp
+  8065a7:	c3                   	ret
+
+00000000008065a8 <opencons>:
+
+int
+opencons(void)
+{
+  8065a8:	55                   	push   %rbp
+  8065a9:	48 89 e5             	mov    %rsp,%rbp
+  8065ac:	41 57                	push   %r15
+  8065ae:	53                   	push   %rbx
+  8065af:	48 83 ec 10          	sub    $0x10,%rsp
+  8065b3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065b3 <opencons+0xb>
+  8065ba:	49 bb 8d 2a 00 00 00 	movabs $0x2a8d,%r11
+  8065c1:	00 00 00 
+  8065c4:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8065c7:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8065cb:	48 89 c7             	mov    %rax,%rdi
+  8065ce:	49 89 df             	mov    %rbx,%r15
+  8065d1:	48 b8 b4 a8 ff ff ff 	movabs $0xffffffffffffa8b4,%rax
+  8065d8:	ff ff ff 
+  8065db:	48 01 d8             	add    %rbx,%rax
+  8065de:	ff d0                	call   *%rax
+  8065e0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8065e3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8065e7:	79 05                	jns    8065ee <opencons+0x46>
+		return r;
+  8065e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8065ec:	eb 68                	jmp    806656 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8065ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8065f2:	ba 07 04 00 00       	mov    $0x407,%edx
+  8065f7:	48 89 c6             	mov    %rax,%rsi
+  8065fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8065ff:	49 89 df             	mov    %rbx,%r15
+  806602:	48 b8 05 95 ff ff ff 	movabs $0xffffffffffff9505,%rax
+  806609:	ff ff ff 
+  80660c:	48 01 d8             	add    %rbx,%rax
+  80660f:	ff d0                	call   *%rax
+  806611:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806614:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806618:	79 05                	jns    80661f <opencons+0x77>
+		return r;
+  80661a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80661d:	eb 37                	jmp    806656 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  80661f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806623:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  80662a:	00 00 00 
+  80662d:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806630:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  806632:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806636:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  80663d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806641:	48 89 c7             	mov    %rax,%rdi
+  806644:	49 89 df             	mov    %rbx,%r15
+  806647:	48 b8 3a a8 ff ff ff 	movabs $0xffffffffffffa83a,%rax
+  80664e:	ff ff ff 
+  806651:	48 01 d8             	add    %rbx,%rax
+  806654:	ff d0                	call   *%rax
+}
+  806656:	48 83 c4 10          	add    $0x10,%rsp
+  80665a:	5b                   	pop    %rbx
+  80665b:	41 5f                	pop    %r15
+  80665d:	5d                   	pop    %rbp
+  80665e:	c3                   	ret
+
+000000000080665f <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80665f:	55                   	push   %rbp
+  806660:	48 89 e5             	mov    %rsp,%rbp
+  806663:	41 57                	push   %r15
+  806665:	53                   	push   %rbx
+  806666:	48 83 ec 30          	sub    $0x30,%rsp
+  80666a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80666a <devcons_read+0xb>
+  806671:	49 bb d6 29 00 00 00 	movabs $0x29d6,%r11
+  806678:	00 00 00 
+  80667b:	4c 01 db             	add    %r11,%rbx
+  80667e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806682:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806686:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  80668a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80668f:	75 19                	jne    8066aa <devcons_read+0x4b>
+		return 0;
+  806691:	b8 00 00 00 00       	mov    $0x0,%eax
+  806696:	eb 55                	jmp    8066ed <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806698:	49 89 df             	mov    %rbx,%r15
+  80669b:	48 b8 b0 94 ff ff ff 	movabs $0xffffffffffff94b0,%rax
+  8066a2:	ff ff ff 
+  8066a5:	48 01 d8             	add    %rbx,%rax
+  8066a8:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8066aa:	49 89 df             	mov    %rbx,%r15
+  8066ad:	48 b8 ac 93 ff ff ff 	movabs $0xffffffffffff93ac,%rax
+  8066b4:	ff ff ff 
+  8066b7:	48 01 d8             	add    %rbx,%rax
+  8066ba:	ff d0                	call   *%rax
+  8066bc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8066bf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066c3:	74 d3                	je     806698 <devcons_read+0x39>
+	if (c < 0)
+  8066c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066c9:	79 05                	jns    8066d0 <devcons_read+0x71>
+		return c;
+  8066cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066ce:	eb 1d                	jmp    8066ed <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8066d0:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8066d4:	75 07                	jne    8066dd <devcons_read+0x7e>
+		return 0;
+  8066d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8066db:	eb 10                	jmp    8066ed <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  8066dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066e0:	89 c2                	mov    %eax,%edx
+  8066e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8066e6:	88 10                	mov    %dl,(%rax)
+	return 1;
+  8066e8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8066ed:	48 83 c4 30          	add    $0x30,%rsp
+  8066f1:	5b                   	pop    %rbx
+  8066f2:	41 5f                	pop    %r15
+  8066f4:	5d                   	pop    %rbp
+  8066f5:	c3                   	ret
+
+00000000008066f6 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8066f6:	55                   	push   %rbp
+  8066f7:	48 89 e5             	mov    %rsp,%rbp
+  8066fa:	41 57                	push   %r15
+  8066fc:	53                   	push   %rbx
+  8066fd:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806704:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806704 <devcons_write+0xe>
+  80670b:	49 bb 3c 29 00 00 00 	movabs $0x293c,%r11
+  806712:	00 00 00 
+  806715:	4c 01 db             	add    %r11,%rbx
+  806718:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  80671f:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806726:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  80672d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806734:	e9 80 00 00 00       	jmp    8067b9 <devcons_write+0xc3>
+		m = n - tot;
+  806739:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  806740:	89 c2                	mov    %eax,%edx
+  806742:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806745:	29 c2                	sub    %eax,%edx
+  806747:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  80674a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80674d:	83 f8 7f             	cmp    $0x7f,%eax
+  806750:	76 07                	jbe    806759 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806752:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806759:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80675c:	48 63 d0             	movslq %eax,%rdx
+  80675f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806762:	48 63 c8             	movslq %eax,%rcx
+  806765:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80676c:	48 01 c1             	add    %rax,%rcx
+  80676f:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806776:	48 89 ce             	mov    %rcx,%rsi
+  806779:	48 89 c7             	mov    %rax,%rdi
+  80677c:	49 89 df             	mov    %rbx,%r15
+  80677f:	48 b8 29 8c ff ff ff 	movabs $0xffffffffffff8c29,%rax
+  806786:	ff ff ff 
+  806789:	48 01 d8             	add    %rbx,%rax
+  80678c:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  80678e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806791:	48 63 d0             	movslq %eax,%rdx
+  806794:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80679b:	48 89 d6             	mov    %rdx,%rsi
+  80679e:	48 89 c7             	mov    %rax,%rdi
+  8067a1:	49 89 df             	mov    %rbx,%r15
+  8067a4:	48 b8 4d 93 ff ff ff 	movabs $0xffffffffffff934d,%rax
+  8067ab:	ff ff ff 
+  8067ae:	48 01 d8             	add    %rbx,%rax
+  8067b1:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8067b3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8067b6:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8067b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067bc:	48 98                	cltq
+  8067be:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8067c5:	0f 82 6e ff ff ff    	jb     806739 <devcons_write+0x43>
+	}
+	return tot;
+  8067cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8067ce:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8067d5:	5b                   	pop    %rbx
+  8067d6:	41 5f                	pop    %r15
+  8067d8:	5d                   	pop    %rbp
+  8067d9:	c3                   	ret
+
+00000000008067da <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  8067da:	55                   	push   %rbp
+  8067db:	48 89 e5             	mov    %rsp,%rbp
+  8067de:	48 83 ec 08          	sub    $0x8,%rsp
+  8067e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8067e2 <devcons_close+0x8>
+  8067e9:	49 bb 5e 28 00 00 00 	movabs $0x285e,%r11
+  8067f0:	00 00 00 
+  8067f3:	4c 01 d8             	add    %r11,%rax
+  8067f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8067fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8067ff:	c9                   	leave
+  806800:	c3                   	ret
+
+0000000000806801 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806801:	55                   	push   %rbp
+  806802:	48 89 e5             	mov    %rsp,%rbp
+  806805:	41 57                	push   %r15
+  806807:	48 83 ec 18          	sub    $0x18,%rsp
+  80680b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80680b <devcons_stat+0xa>
+  806812:	49 bb 35 28 00 00 00 	movabs $0x2835,%r11
+  806819:	00 00 00 
+  80681c:	4c 01 d8             	add    %r11,%rax
+  80681f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806823:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806827:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80682b:	48 b9 48 ea ff ff ff 	movabs $0xffffffffffffea48,%rcx
+  806832:	ff ff ff 
+  806835:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806839:	48 89 ce             	mov    %rcx,%rsi
+  80683c:	48 89 d7             	mov    %rdx,%rdi
+  80683f:	49 89 c7             	mov    %rax,%r15
+  806842:	48 ba 49 88 ff ff ff 	movabs $0xffffffffffff8849,%rdx
+  806849:	ff ff ff 
+  80684c:	48 01 c2             	add    %rax,%rdx
+  80684f:	ff d2                	call   *%rdx
+	return 0;
+  806851:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806856:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80685a:	c9                   	leave
+  80685b:	c3                   	ret
+
+000000000080685c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80685c:	55                   	push   %rbp
+  80685d:	48 89 e5             	mov    %rsp,%rbp
+  806860:	41 57                	push   %r15
+  806862:	53                   	push   %rbx
+  806863:	48 83 ec 20          	sub    $0x20,%rsp
+  806867:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806867 <set_pgfault_handler+0xb>
+  80686e:	49 bb d9 27 00 00 00 	movabs $0x27d9,%r11
+  806875:	00 00 00 
+  806878:	4c 01 db             	add    %r11,%rbx
+  80687b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  80687f:	49 89 df             	mov    %rbx,%r15
+  806882:	48 b8 5c 94 ff ff ff 	movabs $0xffffffffffff945c,%rax
+  806889:	ff ff ff 
+  80688c:	48 01 d8             	add    %rbx,%rax
+  80688f:	ff d0                	call   *%rax
+  806891:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806894:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  80689b:	00 00 00 
+  80689e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068a2:	48 85 c0             	test   %rax,%rax
+  8068a5:	75 6b                	jne    806912 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  8068a7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068aa:	ba 07 00 00 00       	mov    $0x7,%edx
+  8068af:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8068b4:	48 89 ce             	mov    %rcx,%rsi
+  8068b7:	89 c7                	mov    %eax,%edi
+  8068b9:	49 89 df             	mov    %rbx,%r15
+  8068bc:	48 b8 05 95 ff ff ff 	movabs $0xffffffffffff9505,%rax
+  8068c3:	ff ff ff 
+  8068c6:	48 01 d8             	add    %rbx,%rax
+  8068c9:	ff d0                	call   *%rax
+  8068cb:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  8068ce:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8068d2:	74 3e                	je     806912 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  8068d4:	48 b8 50 ea ff ff ff 	movabs $0xffffffffffffea50,%rax
+  8068db:	ff ff ff 
+  8068de:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8068e2:	48 89 c2             	mov    %rax,%rdx
+  8068e5:	be 23 00 00 00       	mov    $0x23,%esi
+  8068ea:	48 b8 7e ea ff ff ff 	movabs $0xffffffffffffea7e,%rax
+  8068f1:	ff ff ff 
+  8068f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8068f8:	48 89 c7             	mov    %rax,%rdi
+  8068fb:	49 89 df             	mov    %rbx,%r15
+  8068fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  806903:	48 b9 b0 77 ff ff ff 	movabs $0xffffffffffff77b0,%rcx
+  80690a:	ff ff ff 
+  80690d:	48 01 d9             	add    %rbx,%rcx
+  806910:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806912:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806919:	00 00 00 
+  80691c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806920:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806924:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806927:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  80692e:	ff ff ff 
+  806931:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806935:	48 89 d6             	mov    %rdx,%rsi
+  806938:	89 c7                	mov    %eax,%edi
+  80693a:	49 89 df             	mov    %rbx,%r15
+  80693d:	48 b8 fb 96 ff ff ff 	movabs $0xffffffffffff96fb,%rax
+  806944:	ff ff ff 
+  806947:	48 01 d8             	add    %rbx,%rax
+  80694a:	ff d0                	call   *%rax
+}
+  80694c:	90                   	nop
+  80694d:	48 83 c4 20          	add    $0x20,%rsp
+  806951:	5b                   	pop    %rbx
+  806952:	41 5f                	pop    %r15
+  806954:	5d                   	pop    %rbp
+  806955:	c3                   	ret
+
+0000000000806956 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806956:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806959:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806960:	00 00 00 
+call *%rax
+  806963:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806965:	58                   	pop    %rax
+	popq %rax;
+  806966:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806967:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  80696e:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806972:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806976:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  80697a:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  80697e:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806982:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806985:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806989:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80698d:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806992:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806997:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80699c:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8069a1:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8069a6:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8069ab:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8069b0:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8069b5:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8069ba:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8069bf:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8069c4:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8069c9:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8069ce:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8069d3:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  8069d7:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  8069db:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  8069dc:	5c                   	pop    %rsp
+	ret;			//return
+  8069dd:	c3                   	ret
+
+00000000008069de <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8069de:	55                   	push   %rbp
+  8069df:	48 89 e5             	mov    %rsp,%rbp
+  8069e2:	41 57                	push   %r15
+  8069e4:	53                   	push   %rbx
+  8069e5:	48 83 ec 30          	sub    $0x30,%rsp
+  8069e9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8069e9 <ipc_recv+0xb>
+  8069f0:	49 bb 57 26 00 00 00 	movabs $0x2657,%r11
+  8069f7:	00 00 00 
+  8069fa:	4c 01 db             	add    %r11,%rbx
+  8069fd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806a01:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806a05:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  806a09:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806a0e:	75 0e                	jne    806a1e <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  806a10:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806a17:	00 00 00 
+  806a1a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  806a1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806a22:	48 89 c7             	mov    %rax,%rdi
+  806a25:	49 89 df             	mov    %rbx,%r15
+  806a28:	48 b8 2e 98 ff ff ff 	movabs $0xffffffffffff982e,%rax
+  806a2f:	ff ff ff 
+  806a32:	48 01 d8             	add    %rbx,%rax
+  806a35:	ff d0                	call   *%rax
+  806a37:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  806a3a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806a3f:	74 2a                	je     806a6b <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  806a41:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a45:	75 19                	jne    806a60 <ipc_recv+0x82>
+  806a47:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806a4e:	ff ff ff 
+  806a51:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a55:	48 8b 00             	mov    (%rax),%rax
+  806a58:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806a5e:	eb 05                	jmp    806a65 <ipc_recv+0x87>
+  806a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a65:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806a69:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  806a6b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806a70:	74 2a                	je     806a9c <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  806a72:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a76:	75 19                	jne    806a91 <ipc_recv+0xb3>
+  806a78:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806a7f:	ff ff ff 
+  806a82:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a86:	48 8b 00             	mov    (%rax),%rax
+  806a89:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806a8f:	eb 05                	jmp    806a96 <ipc_recv+0xb8>
+  806a91:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a96:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806a9a:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806a9c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806aa0:	74 05                	je     806aa7 <ipc_recv+0xc9>
+		return res;
+  806aa2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806aa5:	eb 17                	jmp    806abe <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  806aa7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806aae:	ff ff ff 
+  806ab1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806ab5:	48 8b 00             	mov    (%rax),%rax
+  806ab8:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806abe:	48 83 c4 30          	add    $0x30,%rsp
+  806ac2:	5b                   	pop    %rbx
+  806ac3:	41 5f                	pop    %r15
+  806ac5:	5d                   	pop    %rbp
+  806ac6:	c3                   	ret
+
+0000000000806ac7 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  806ac7:	55                   	push   %rbp
+  806ac8:	48 89 e5             	mov    %rsp,%rbp
+  806acb:	41 57                	push   %r15
+  806acd:	53                   	push   %rbx
+  806ace:	48 83 ec 20          	sub    $0x20,%rsp
+  806ad2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ad2 <ipc_send+0xb>
+  806ad9:	49 bb 6e 25 00 00 00 	movabs $0x256e,%r11
+  806ae0:	00 00 00 
+  806ae3:	4c 01 db             	add    %r11,%rbx
+  806ae6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806ae9:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806aec:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806af0:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  806af3:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806af8:	75 0e                	jne    806b08 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  806afa:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806b01:	00 00 00 
+  806b04:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  806b08:	90                   	nop
+  806b09:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806b0c:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806b0f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806b13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b16:	89 c7                	mov    %eax,%edi
+  806b18:	49 89 df             	mov    %rbx,%r15
+  806b1b:	48 b8 c4 97 ff ff ff 	movabs $0xffffffffffff97c4,%rax
+  806b22:	ff ff ff 
+  806b25:	48 01 d8             	add    %rbx,%rax
+  806b28:	ff d0                	call   *%rax
+  806b2a:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  806b2d:	74 da                	je     806b09 <ipc_send+0x42>
+		;
+}
+  806b2f:	90                   	nop
+  806b30:	90                   	nop
+  806b31:	48 83 c4 20          	add    $0x20,%rsp
+  806b35:	5b                   	pop    %rbx
+  806b36:	41 5f                	pop    %r15
+  806b38:	5d                   	pop    %rbp
+  806b39:	c3                   	ret
+
+0000000000806b3a <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  806b3a:	55                   	push   %rbp
+  806b3b:	48 89 e5             	mov    %rsp,%rbp
+  806b3e:	41 57                	push   %r15
+  806b40:	53                   	push   %rbx
+  806b41:	48 83 ec 40          	sub    $0x40,%rsp
+  806b45:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b45 <ipc_call+0xb>
+  806b4c:	49 bb fb 24 00 00 00 	movabs $0x24fb,%r11
+  806b53:	00 00 00 
+  806b56:	4c 01 db             	add    %r11,%rbx
+  806b59:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806b5c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806b5f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806b63:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806b66:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806b6a:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806b6e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806b73:	75 0e                	jne    806b83 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  806b75:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806b7c:	00 00 00 
+  806b7f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806b83:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806b88:	75 0e                	jne    806b98 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806b8a:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806b91:	00 00 00 
+  806b94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  806b98:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806b9b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  806b9f:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806ba2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806ba6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806ba9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806baf:	49 89 f8             	mov    %rdi,%r8
+  806bb2:	89 c7                	mov    %eax,%edi
+  806bb4:	49 89 df             	mov    %rbx,%r15
+  806bb7:	48 b8 87 98 ff ff ff 	movabs $0xffffffffffff9887,%rax
+  806bbe:	ff ff ff 
+  806bc1:	48 01 d8             	add    %rbx,%rax
+  806bc4:	ff d0                	call   *%rax
+  806bc6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806bc9:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806bce:	74 2a                	je     806bfa <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806bd0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806bd4:	75 19                	jne    806bef <ipc_call+0xb5>
+  806bd6:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806bdd:	ff ff ff 
+  806be0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806be4:	48 8b 00             	mov    (%rax),%rax
+  806be7:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806bed:	eb 05                	jmp    806bf4 <ipc_call+0xba>
+  806bef:	b8 00 00 00 00       	mov    $0x0,%eax
+  806bf4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806bf8:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806bfa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806bfe:	74 05                	je     806c05 <ipc_call+0xcb>
+		return r;
+  806c00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c03:	eb 17                	jmp    806c1c <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  806c05:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806c0c:	ff ff ff 
+  806c0f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806c13:	48 8b 00             	mov    (%rax),%rax
+  806c16:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806c1c:	48 83 c4 40          	add    $0x40,%rsp
+  806c20:	5b                   	pop    %rbx
+  806c21:	41 5f                	pop    %r15
+  806c23:	5d                   	pop    %rbp
+  806c24:	c3                   	ret
+
+0000000000806c25 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  806c25:	55                   	push   %rbp
+  806c26:	48 89 e5             	mov    %rsp,%rbp
+  806c29:	41 57                	push   %r15
+  806c2b:	53                   	push   %rbx
+  806c2c:	48 83 ec 70          	sub    $0x70,%rsp
+  806c30:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806c30 <ipc_callw+0xb>
+  806c37:	49 bb 10 24 00 00 00 	movabs $0x2410,%r11
+  806c3e:	00 00 00 
+  806c41:	4c 01 db             	add    %r11,%rbx
+  806c44:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  806c47:	89 75 98             	mov    %esi,-0x68(%rbp)
+  806c4a:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  806c4e:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  806c52:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  806c57:	76 0a                	jbe    806c63 <ipc_callw+0x3e>
+		return -E_INVAL;
+  806c59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806c5e:	e9 b7 00 00 00       	jmp    806d1a <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  806c63:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806c67:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806c6b:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  806c6f:	48 89 ce             	mov    %rcx,%rsi
+  806c72:	48 89 c7             	mov    %rax,%rdi
+  806c75:	49 89 df             	mov    %rbx,%r15
+  806c78:	48 b8 29 8c ff ff ff 	movabs $0xffffffffffff8c29,%rax
+  806c7f:	ff ff ff 
+  806c82:	48 01 d8             	add    %rbx,%rax
+  806c85:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  806c87:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806c8e:	00 
+  806c8f:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806c93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806c97:	48 01 d0             	add    %rdx,%rax
+  806c9a:	48 83 e8 01          	sub    $0x1,%rax
+  806c9e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806ca2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806ca6:	ba 00 00 00 00       	mov    $0x0,%edx
+  806cab:	48 f7 75 e8          	divq   -0x18(%rbp)
+  806caf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806cb3:	48 29 d0             	sub    %rdx,%rax
+  806cb6:	48 c1 e8 03          	shr    $0x3,%rax
+  806cba:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806cbe:	89 c1                	mov    %eax,%ecx
+  806cc0:	8b 75 98             	mov    -0x68(%rbp),%esi
+  806cc3:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806cc7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806cca:	49 89 d1             	mov    %rdx,%r9
+  806ccd:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  806cd4:	00 00 00 
+  806cd7:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806cde:	00 00 00 
+  806ce1:	89 c7                	mov    %eax,%edi
+  806ce3:	49 89 df             	mov    %rbx,%r15
+  806ce6:	48 b8 87 98 ff ff ff 	movabs $0xffffffffffff9887,%rax
+  806ced:	ff ff ff 
+  806cf0:	48 01 d8             	add    %rbx,%rax
+  806cf3:	ff d0                	call   *%rax
+  806cf5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  806cf8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806cfc:	74 05                	je     806d03 <ipc_callw+0xde>
+		return r;
+  806cfe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806d01:	eb 17                	jmp    806d1a <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  806d03:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806d0a:	ff ff ff 
+  806d0d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806d11:	48 8b 00             	mov    (%rax),%rax
+  806d14:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806d1a:	48 83 c4 70          	add    $0x70,%rsp
+  806d1e:	5b                   	pop    %rbx
+  806d1f:	41 5f                	pop    %r15
+  806d21:	5d                   	pop    %rbp
+  806d22:	c3                   	ret
+
+0000000000806d23 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  806d23:	55                   	push   %rbp
+  806d24:	48 89 e5             	mov    %rsp,%rbp
+  806d27:	41 57                	push   %r15
+  806d29:	53                   	push   %rbx
+  806d2a:	48 83 ec 40          	sub    $0x40,%rsp
+  806d2e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806d2e <ipc_callv+0xb>
+  806d35:	49 bb 12 23 00 00 00 	movabs $0x2312,%r11
+  806d3c:	00 00 00 
+  806d3f:	4c 01 db             	add    %r11,%rbx
+  806d42:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  806d45:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  806d48:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  806d4c:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806d4f:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  806d53:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  806d57:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806d5e:	00 00 00 
+  806d61:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806d65:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806d69:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806d6d:	74 11                	je     806d80 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806d6f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806d73:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806d77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806d7a:	c1 e0 14             	shl    $0x14,%eax
+  806d7d:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806d80:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806d84:	74 14                	je     806d9a <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806d86:	8b 45 20             	mov    0x20(%rbp),%eax
+  806d89:	83 e8 01             	sub    $0x1,%eax
+  806d8c:	48 63 d0             	movslq %eax,%rdx
+  806d8f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806d93:	48 09 d0             	or     %rdx,%rax
+  806d96:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806d9a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806d9d:	c1 e0 10             	shl    $0x10,%eax
+  806da0:	0b 45 10             	or     0x10(%rbp),%eax
+  806da3:	89 c1                	mov    %eax,%ecx
+  806da5:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806da8:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806dac:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806db0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806db4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806db7:	4d 89 c1             	mov    %r8,%r9
+  806dba:	49 89 f8             	mov    %rdi,%r8
+  806dbd:	89 c7                	mov    %eax,%edi
+  806dbf:	49 89 df             	mov    %rbx,%r15
+  806dc2:	48 b8 87 98 ff ff ff 	movabs $0xffffffffffff9887,%rax
+  806dc9:	ff ff ff 
+  806dcc:	48 01 d8             	add    %rbx,%rax
+  806dcf:	ff d0                	call   *%rax
+  806dd1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806dd4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806dd8:	74 05                	je     806ddf <ipc_callv+0xbc>
+		return r;
+  806dda:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806ddd:	eb 17                	jmp    806df6 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806ddf:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806de6:	ff ff ff 
+  806de9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806ded:	48 8b 00             	mov    (%rax),%rax
+  806df0:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806df6:	48 83 c4 40          	add    $0x40,%rsp
+  806dfa:	5b                   	pop    %rbx
+  806dfb:	41 5f                	pop    %r15
+  806dfd:	5d                   	pop    %rbp
+  806dfe:	c3                   	ret
+
+0000000000806dff <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806dff:	55                   	push   %rbp
+  806e00:	48 89 e5             	mov    %rsp,%rbp
+  806e03:	41 57                	push   %r15
+  806e05:	53                   	push   %rbx
+  806e06:	48 83 ec 40          	sub    $0x40,%rsp
+  806e0a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806e0a <ipc_reply_recv+0xb>
+  806e11:	49 bb 36 22 00 00 00 	movabs $0x2236,%r11
+  806e18:	00 00 00 
+  806e1b:	4c 01 db             	add    %r11,%rbx
+  806e1e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806e21:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806e24:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806e28:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806e2b:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806e2f:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806e33:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806e38:	75 0e                	jne    806e48 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806e3a:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806e41:	00 00 00 
+  806e44:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806e48:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806e4d:	75 0e                	jne    806e5d <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806e4f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806e56:	00 00 00 
+  806e59:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806e5d:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806e60:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806e64:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806e68:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806e6b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806e6f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806e72:	4d 89 c1             	mov    %r8,%r9
+  806e75:	49 89 f8             	mov    %rdi,%r8
+  806e78:	89 c7                	mov    %eax,%edi
+  806e7a:	49 89 df             	mov    %rbx,%r15
+  806e7d:	48 b8 fb 98 ff ff ff 	movabs $0xffffffffffff98fb,%rax
+  806e84:	ff ff ff 
+  806e87:	48 01 d8             	add    %rbx,%rax
+  806e8a:	ff d0                	call   *%rax
+  806e8c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806e8f:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806e94:	74 2a                	je     806ec0 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806e96:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806e9a:	75 19                	jne    806eb5 <ipc_reply_recv+0xb6>
+  806e9c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806ea3:	ff ff ff 
+  806ea6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806eaa:	48 8b 00             	mov    (%rax),%rax
+  806ead:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806eb3:	eb 05                	jmp    806eba <ipc_reply_recv+0xbb>
+  806eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  806eba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806ebe:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806ec0:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806ec5:	74 2a                	je     806ef1 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806ec7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806ecb:	75 19                	jne    806ee6 <ipc_reply_recv+0xe7>
+  806ecd:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806ed4:	ff ff ff 
+  806ed7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806edb:	48 8b 00             	mov    (%rax),%rax
+  806ede:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806ee4:	eb 05                	jmp    806eeb <ipc_reply_recv+0xec>
+  806ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+  806eeb:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806eef:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806ef1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806ef5:	74 05                	je     806efc <ipc_reply_recv+0xfd>
+		return r;
+  806ef7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806efa:	eb 17                	jmp    806f13 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806efc:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806f03:	ff ff ff 
+  806f06:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806f0a:	48 8b 00             	mov    (%rax),%rax
+  806f0d:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806f13:	48 83 c4 40          	add    $0x40,%rsp
+  806f17:	5b                   	pop    %rbx
+  806f18:	41 5f                	pop    %r15
+  806f1a:	5d                   	pop    %rbp
+  806f1b:	c3                   	ret
+
+0000000000806f1c <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806f1c:	55                   	push   %rbp
+  806f1d:	48 89 e5             	mov    %rsp,%rbp
+  806f20:	41 57                	push   %r15
+  806f22:	53                   	push   %rbx
+  806f23:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806f2a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806f2a <ipc_window_batch+0xe>
+  806f31:	49 bb 16 21 00 00 00 	movabs $0x2116,%r11
+  806f38:	00 00 00 
+  806f3b:	4c 01 db             	add    %r11,%rbx
+  806f3e:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806f44:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806f4b:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806f51:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  806f57:	e9 15 01 00 00       	jmp    807071 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806f5c:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806f62:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806f65:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806f6c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806f6f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806f72:	39 c2                	cmp    %eax,%edx
+  806f74:	0f 4e c2             	cmovle %edx,%eax
+  806f77:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806f7a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806f81:	eb 6b                	jmp    806fee <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  806f83:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806f86:	48 98                	cltq
+  806f88:	48 c1 e0 05          	shl    $0x5,%rax
+  806f8c:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806f90:	48 01 e8             	add    %rbp,%rax
+  806f93:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806f99:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806f9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806fa2:	c1 e0 0c             	shl    $0xc,%eax
+  806fa5:	48 63 d0             	movslq %eax,%rdx
+  806fa8:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806faf:	48 01 c2             	add    %rax,%rdx
+  806fb2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806fb5:	48 98                	cltq
+  806fb7:	48 c1 e0 05          	shl    $0x5,%rax
+  806fbb:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806fbf:	48 01 e8             	add    %rbp,%rax
+  806fc2:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806fc8:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806fcb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806fce:	48 98                	cltq
+  806fd0:	48 c1 e0 05          	shl    $0x5,%rax
+  806fd4:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806fd8:	48 01 e8             	add    %rbp,%rax
+  806fdb:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806fe2:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806fe8:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806fea:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806fee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ff1:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806ff4:	7c 8d                	jl     806f83 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806ff6:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806ffd:	74 27                	je     807026 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806fff:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807002:	48 63 d0             	movslq %eax,%rdx
+  807005:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  80700c:	48 89 d6             	mov    %rdx,%rsi
+  80700f:	48 89 c7             	mov    %rax,%rdi
+  807012:	49 89 df             	mov    %rbx,%r15
+  807015:	48 b8 9e 9b ff ff ff 	movabs $0xffffffffffff9b9e,%rax
+  80701c:	ff ff ff 
+  80701f:	48 01 d8             	add    %rbx,%rax
+  807022:	ff d0                	call   *%rax
+  807024:	eb 25                	jmp    80704b <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  807026:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807029:	48 63 d0             	movslq %eax,%rdx
+  80702c:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  807033:	48 89 d6             	mov    %rdx,%rsi
+  807036:	48 89 c7             	mov    %rax,%rdi
+  807039:	49 89 df             	mov    %rbx,%r15
+  80703c:	48 b8 fc 9b ff ff ff 	movabs $0xffffffffffff9bfc,%rax
+  807043:	ff ff ff 
+  807046:	48 01 d8             	add    %rbx,%rax
+  807049:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  80704b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  80704e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  807052:	79 05                	jns    807059 <ipc_window_batch+0x13d>
+			return r;
+  807054:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807057:	eb 2a                	jmp    807083 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  807059:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80705c:	c1 e0 0c             	shl    $0xc,%eax
+  80705f:	48 98                	cltq
+  807061:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  807068:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80706b:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  807071:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  807078:	0f 8f de fe ff ff    	jg     806f5c <ipc_window_batch+0x40>
+	}
+	return 0;
+  80707e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807083:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  80708a:	5b                   	pop    %rbx
+  80708b:	41 5f                	pop    %r15
+  80708d:	5d                   	pop    %rbp
+  80708e:	c3                   	ret
+
+000000000080708f <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  80708f:	55                   	push   %rbp
+  807090:	48 89 e5             	mov    %rsp,%rbp
+  807093:	48 83 ec 10          	sub    $0x10,%rsp
+  807097:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807097 <ipc_map_window+0x8>
+  80709e:	49 bb a9 1f 00 00 00 	movabs $0x1fa9,%r11
+  8070a5:	00 00 00 
+  8070a8:	4c 01 d8             	add    %r11,%rax
+  8070ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8070af:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  8070b2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8070b5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8070b9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8070be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8070c3:	49 b8 dc de ff ff ff 	movabs $0xffffffffffffdedc,%r8
+  8070ca:	ff ff ff 
+  8070cd:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8070d1:	ff d0                	call   *%rax
+}
+  8070d3:	c9                   	leave
+  8070d4:	c3                   	ret
+
+00000000008070d5 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  8070d5:	55                   	push   %rbp
+  8070d6:	48 89 e5             	mov    %rsp,%rbp
+  8070d9:	48 83 ec 10          	sub    $0x10,%rsp
+  8070dd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8070dd <ipc_unmap_window+0x8>
+  8070e4:	49 bb 63 1f 00 00 00 	movabs $0x1f63,%r11
+  8070eb:	00 00 00 
+  8070ee:	4c 01 d8             	add    %r11,%rax
+  8070f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8070f5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  8070f8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8070fb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8070ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807104:	bf 00 00 00 00       	mov    $0x0,%edi
+  807109:	49 b8 dc de ff ff ff 	movabs $0xffffffffffffdedc,%r8
+  807110:	ff ff ff 
+  807113:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  807117:	ff d0                	call   *%rax
+}
+  807119:	c9                   	leave
+  80711a:	c3                   	ret
+
+000000000080711b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80711b:	55                   	push   %rbp
+  80711c:	48 89 e5             	mov    %rsp,%rbp
+  80711f:	48 83 ec 18          	sub    $0x18,%rsp
+  807123:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807123 <ipc_find_env+0x8>
+  80712a:	49 bb 1d 1f 00 00 00 	movabs $0x1f1d,%r11
+  807131:	00 00 00 
+  807134:	4c 01 d8             	add    %r11,%rax
+  807137:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  80713a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  807141:	eb 57                	jmp    80719a <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  807143:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80714a:	ff ff ff 
+  80714d:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  807151:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  807154:	48 63 d2             	movslq %edx,%rdx
+  807157:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  80715e:	48 01 ca             	add    %rcx,%rdx
+  807161:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  807168:	8b 12                	mov    (%rdx),%edx
+  80716a:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  80716d:	75 27                	jne    807196 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  80716f:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  807176:	ff ff ff 
+  807179:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80717d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807180:	48 98                	cltq
+  807182:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  807189:	48 01 d0             	add    %rdx,%rax
+  80718c:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  807192:	8b 00                	mov    (%rax),%eax
+  807194:	eb 12                	jmp    8071a8 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  807196:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80719a:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8071a1:	7e a0                	jle    807143 <ipc_find_env+0x28>
+	}
+	return 0;
+  8071a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8071a8:	c9                   	leave
+  8071a9:	c3                   	ret
+
+00000000008071aa <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8071aa:	55                   	push   %rbp
+  8071ab:	48 89 e5             	mov    %rsp,%rbp
+  8071ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8071b2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8071b2 <pageref+0x8>
+  8071b9:	49 bb 8e 1e 00 00 00 	movabs $0x1e8e,%r11
+  8071c0:	00 00 00 
+  8071c3:	4c 01 d8             	add    %r11,%rax
+  8071c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  8071ca:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8071ce:	48 89 d1             	mov    %rdx,%rcx
+  8071d1:	48 c1 e9 15          	shr    $0x15,%rcx
+  8071d5:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8071dc:	ff ff ff 
+  8071df:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8071e3:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8071e7:	83 e2 01             	and    $0x1,%edx
+  8071ea:	48 85 d2             	test   %rdx,%rdx
+  8071ed:	75 07                	jne    8071f6 <pageref+0x4c>
+		return 0;
+  8071ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8071f4:	eb 64                	jmp    80725a <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  8071f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8071fa:	48 89 d1             	mov    %rdx,%rcx
+  8071fd:	48 c1 e9 0c          	shr    $0xc,%rcx
+  807201:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  807208:	ff ff ff 
+  80720b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80720f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  807213:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  807217:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80721b:	83 e2 01             	and    $0x1,%edx
+  80721e:	48 85 d2             	test   %rdx,%rdx
+  807221:	75 07                	jne    80722a <pageref+0x80>
+		return 0;
+  807223:	b8 00 00 00 00       	mov    $0x0,%eax
+  807228:	eb 30                	jmp    80725a <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  80722a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80722e:	48 c1 ea 0c          	shr    $0xc,%rdx
+  807232:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  807239:	ff ff ff 
+  80723c:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  807240:	48 89 d0             	mov    %rdx,%rax
+  807243:	48 01 c0             	add    %rax,%rax
+  807246:	48 01 d0             	add    %rdx,%rax
+  807249:	48 c1 e0 03          	shl    $0x3,%rax
+  80724d:	48 01 c8             	add    %rcx,%rax
+  807250:	48 83 c0 08          	add    $0x8,%rax
+  807254:	0f b7 00             	movzwl (%rax),%eax
+  807257:	0f b7 c0             	movzwl %ax,%eax
+}
+  80725a:	c9                   	leave
+  80725b:	c3                   	ret
@@ -0,0 +1,10766 @@
+
+obj/user/testpiperace:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 64 04 00 00       	call   8004a5 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 40          	sub    $0x40,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  800065:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+	int p[2], r, pid, i, max;
+	void *va;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for dup race...\n");
+  800069:	48 b8 08 df ff ff ff 	movabs $0xffffffffffffdf08,%rax
+  800070:	ff ff ff 
+  800073:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800077:	48 89 c7             	mov    %rax,%rdi
+  80007a:	49 89 df             	mov    %rbx,%r15
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	48 ba 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rdx
+  800089:	ff ff ff 
+  80008c:	48 01 da             	add    %rbx,%rdx
+  80008f:	ff d2                	call   *%rdx
+	if ((r = pipe(p)) < 0)
+  800091:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  800095:	48 89 c7             	mov    %rax,%rdi
+  800098:	49 89 df             	mov    %rbx,%r15
+  80009b:	48 b8 30 d2 ff ff ff 	movabs $0xffffffffffffd230,%rax
+  8000a2:	ff ff ff 
+  8000a5:	48 01 d8             	add    %rbx,%rax
+  8000a8:	ff d0                	call   *%rax
+  8000aa:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8000ad:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8000b1:	79 44                	jns    8000f7 <umain+0xb4>
+		panic("pipe: %e", r);
+  8000b3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8000b6:	89 c1                	mov    %eax,%ecx
+  8000b8:	48 b8 21 df ff ff ff 	movabs $0xffffffffffffdf21,%rax
+  8000bf:	ff ff ff 
+  8000c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000c6:	48 89 c2             	mov    %rax,%rdx
+  8000c9:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000ce:	48 b8 2a df ff ff ff 	movabs $0xffffffffffffdf2a,%rax
+  8000d5:	ff ff ff 
+  8000d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000dc:	48 89 c7             	mov    %rax,%rdi
+  8000df:	49 89 df             	mov    %rbx,%r15
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	49 b8 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%r8
+  8000ee:	ff ff ff 
+  8000f1:	49 01 d8             	add    %rbx,%r8
+  8000f4:	41 ff d0             	call   *%r8
+	max = 200;
+  8000f7:	c7 45 e4 c8 00 00 00 	movl   $0xc8,-0x1c(%rbp)
+	if ((r = fork()) < 0)
+  8000fe:	49 89 df             	mov    %rbx,%r15
+  800101:	48 b8 53 a2 ff ff ff 	movabs $0xffffffffffffa253,%rax
+  800108:	ff ff ff 
+  80010b:	48 01 d8             	add    %rbx,%rax
+  80010e:	ff d0                	call   *%rax
+  800110:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800113:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800117:	79 44                	jns    80015d <umain+0x11a>
+		panic("fork: %e", r);
+  800119:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80011c:	89 c1                	mov    %eax,%ecx
+  80011e:	48 b8 3e df ff ff ff 	movabs $0xffffffffffffdf3e,%rax
+  800125:	ff ff ff 
+  800128:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80012c:	48 89 c2             	mov    %rax,%rdx
+  80012f:	be 10 00 00 00       	mov    $0x10,%esi
+  800134:	48 b8 2a df ff ff ff 	movabs $0xffffffffffffdf2a,%rax
+  80013b:	ff ff ff 
+  80013e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800142:	48 89 c7             	mov    %rax,%rdi
+  800145:	49 89 df             	mov    %rbx,%r15
+  800148:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014d:	49 b8 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%r8
+  800154:	ff ff ff 
+  800157:	49 01 d8             	add    %rbx,%r8
+  80015a:	41 ff d0             	call   *%r8
+	if (r == 0) {
+  80015d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800161:	0f 85 b4 00 00 00    	jne    80021b <umain+0x1d8>
+		close(p[1]);
+  800167:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80016a:	89 c7                	mov    %eax,%edi
+  80016c:	49 89 df             	mov    %rbx,%r15
+  80016f:	48 b8 84 b1 ff ff ff 	movabs $0xffffffffffffb184,%rax
+  800176:	ff ff ff 
+  800179:	48 01 d8             	add    %rbx,%rax
+  80017c:	ff d0                	call   *%rax
+		//
+		// If a clock interrupt catches dup between mapping the
+		// fd and mapping the pipe structure, we'll have the same
+		// ref counts, still a no-no.
+		//
+		for (i=0; i<max; i++) {
+  80017e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800185:	eb 6b                	jmp    8001f2 <umain+0x1af>
+			if(pipeisclosed(p[0])){
+  800187:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80018a:	89 c7                	mov    %eax,%edi
+  80018c:	49 89 df             	mov    %rbx,%r15
+  80018f:	48 b8 b1 d5 ff ff ff 	movabs $0xffffffffffffd5b1,%rax
+  800196:	ff ff ff 
+  800199:	48 01 d8             	add    %rbx,%rax
+  80019c:	ff d0                	call   *%rax
+  80019e:	85 c0                	test   %eax,%eax
+  8001a0:	74 3a                	je     8001dc <umain+0x199>
+				cprintf("RACE: pipe appears closed\n");
+  8001a2:	48 b8 47 df ff ff ff 	movabs $0xffffffffffffdf47,%rax
+  8001a9:	ff ff ff 
+  8001ac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001b0:	48 89 c7             	mov    %rax,%rdi
+  8001b3:	49 89 df             	mov    %rbx,%r15
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	48 ba 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rdx
+  8001c2:	ff ff ff 
+  8001c5:	48 01 da             	add    %rbx,%rdx
+  8001c8:	ff d2                	call   *%rdx
+				exit();
+  8001ca:	49 89 df             	mov    %rbx,%r15
+  8001cd:	48 b8 25 75 ff ff ff 	movabs $0xffffffffffff7525,%rax
+  8001d4:	ff ff ff 
+  8001d7:	48 01 d8             	add    %rbx,%rax
+  8001da:	ff d0                	call   *%rax
+			}
+			sys_yield();
+  8001dc:	49 89 df             	mov    %rbx,%r15
+  8001df:	48 b8 6f 92 ff ff ff 	movabs $0xffffffffffff926f,%rax
+  8001e6:	ff ff ff 
+  8001e9:	48 01 d8             	add    %rbx,%rax
+  8001ec:	ff d0                	call   *%rax
+		for (i=0; i<max; i++) {
+  8001ee:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8001f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001f5:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8001f8:	7c 8d                	jl     800187 <umain+0x144>
+		}
+		// do something to be not runnable besides exiting
+		ipc_recv(0,0,0);
+  8001fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ff:	be 00 00 00 00       	mov    $0x0,%esi
+  800204:	bf 00 00 00 00       	mov    $0x0,%edi
+  800209:	49 89 df             	mov    %rbx,%r15
+  80020c:	48 b8 f9 a5 ff ff ff 	movabs $0xffffffffffffa5f9,%rax
+  800213:	ff ff ff 
+  800216:	48 01 d8             	add    %rbx,%rax
+  800219:	ff d0                	call   *%rax
+	}
+	pid = r;
+  80021b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80021e:	89 45 e0             	mov    %eax,-0x20(%rbp)
+	cprintf("pid is %d\n", pid);
+  800221:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800224:	89 c6                	mov    %eax,%esi
+  800226:	48 b8 62 df ff ff ff 	movabs $0xffffffffffffdf62,%rax
+  80022d:	ff ff ff 
+  800230:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800234:	48 89 c7             	mov    %rax,%rdi
+  800237:	49 89 df             	mov    %rbx,%r15
+  80023a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023f:	48 ba 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rdx
+  800246:	ff ff ff 
+  800249:	48 01 da             	add    %rbx,%rdx
+  80024c:	ff d2                	call   *%rdx
+	va = 0;
+  80024e:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800255:	00 
+	kid = &envs[ENVX(pid)];
+  800256:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800259:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80025e:	48 98                	cltq
+  800260:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800267:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80026e:	ff ff ff 
+  800271:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800275:	48 01 d0             	add    %rdx,%rax
+  800278:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	cprintf("kid is %d\n", kid-envs);
+  80027c:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  800283:	ff ff ff 
+  800286:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80028a:	48 89 c2             	mov    %rax,%rdx
+  80028d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800291:	48 29 d0             	sub    %rdx,%rax
+  800294:	48 c1 f8 03          	sar    $0x3,%rax
+  800298:	48 89 c2             	mov    %rax,%rdx
+  80029b:	48 b8 87 b5 6f 58 fb 	movabs $0x6fb586fb586fb587,%rax
+  8002a2:	86 b5 6f 
+  8002a5:	48 0f af c2          	imul   %rdx,%rax
+  8002a9:	48 89 c6             	mov    %rax,%rsi
+  8002ac:	48 b8 6d df ff ff ff 	movabs $0xffffffffffffdf6d,%rax
+  8002b3:	ff ff ff 
+  8002b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002ba:	48 89 c7             	mov    %rax,%rdi
+  8002bd:	49 89 df             	mov    %rbx,%r15
+  8002c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c5:	48 ba 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rdx
+  8002cc:	ff ff ff 
+  8002cf:	48 01 da             	add    %rbx,%rdx
+  8002d2:	ff d2                	call   *%rdx
+	dup(p[0], 10);
+  8002d4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8002d7:	be 0a 00 00 00       	mov    $0xa,%esi
+  8002dc:	89 c7                	mov    %eax,%edi
+  8002de:	49 89 df             	mov    %rbx,%r15
+  8002e1:	48 b8 3d b2 ff ff ff 	movabs $0xffffffffffffb23d,%rax
+  8002e8:	ff ff ff 
+  8002eb:	48 01 d8             	add    %rbx,%rax
+  8002ee:	ff d0                	call   *%rax
+	while (kid->env_status == ENV_RUNNABLE)
+  8002f0:	eb 1c                	jmp    80030e <umain+0x2cb>
+		dup(p[0], 10);
+  8002f2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8002f5:	be 0a 00 00 00       	mov    $0xa,%esi
+  8002fa:	89 c7                	mov    %eax,%edi
+  8002fc:	49 89 df             	mov    %rbx,%r15
+  8002ff:	48 b8 3d b2 ff ff ff 	movabs $0xffffffffffffb23d,%rax
+  800306:	ff ff ff 
+  800309:	48 01 d8             	add    %rbx,%rax
+  80030c:	ff d0                	call   *%rax
+	while (kid->env_status == ENV_RUNNABLE)
+  80030e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800312:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  800318:	83 f8 02             	cmp    $0x2,%eax
+  80031b:	74 d5                	je     8002f2 <umain+0x2af>
+
+	cprintf("child done with loop\n");
+  80031d:	48 b8 78 df ff ff ff 	movabs $0xffffffffffffdf78,%rax
+  800324:	ff ff ff 
+  800327:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80032b:	48 89 c7             	mov    %rax,%rdi
+  80032e:	49 89 df             	mov    %rbx,%r15
+  800331:	b8 00 00 00 00       	mov    $0x0,%eax
+  800336:	48 ba 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rdx
+  80033d:	ff ff ff 
+  800340:	48 01 da             	add    %rbx,%rdx
+  800343:	ff d2                	call   *%rdx
+	if (pipeisclosed(p[0]))
+  800345:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800348:	89 c7                	mov    %eax,%edi
+  80034a:	49 89 df             	mov    %rbx,%r15
+  80034d:	48 b8 b1 d5 ff ff ff 	movabs $0xffffffffffffd5b1,%rax
+  800354:	ff ff ff 
+  800357:	48 01 d8             	add    %rbx,%rax
+  80035a:	ff d0                	call   *%rax
+  80035c:	85 c0                	test   %eax,%eax
+  80035e:	74 3e                	je     80039e <umain+0x35b>
+		panic("somehow the other end of p[0] got closed!");
+  800360:	48 b8 90 df ff ff ff 	movabs $0xffffffffffffdf90,%rax
+  800367:	ff ff ff 
+  80036a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80036e:	48 89 c2             	mov    %rax,%rdx
+  800371:	be 3a 00 00 00       	mov    $0x3a,%esi
+  800376:	48 b8 2a df ff ff ff 	movabs $0xffffffffffffdf2a,%rax
+  80037d:	ff ff ff 
+  800380:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800384:	48 89 c7             	mov    %rax,%rdi
+  800387:	49 89 df             	mov    %rbx,%r15
+  80038a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038f:	48 b9 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%rcx
+  800396:	ff ff ff 
+  800399:	48 01 d9             	add    %rbx,%rcx
+  80039c:	ff d1                	call   *%rcx
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  80039e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8003a1:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  8003a5:	48 89 d6             	mov    %rdx,%rsi
+  8003a8:	89 c7                	mov    %eax,%edi
+  8003aa:	49 89 df             	mov    %rbx,%r15
+  8003ad:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  8003b4:	ff ff ff 
+  8003b7:	48 01 d8             	add    %rbx,%rax
+  8003ba:	ff d0                	call   *%rax
+  8003bc:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8003bf:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8003c3:	79 44                	jns    800409 <umain+0x3c6>
+		panic("cannot look up p[0]: %e", r);
+  8003c5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003c8:	89 c1                	mov    %eax,%ecx
+  8003ca:	48 b8 ba df ff ff ff 	movabs $0xffffffffffffdfba,%rax
+  8003d1:	ff ff ff 
+  8003d4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003d8:	48 89 c2             	mov    %rax,%rdx
+  8003db:	be 3c 00 00 00       	mov    $0x3c,%esi
+  8003e0:	48 b8 2a df ff ff ff 	movabs $0xffffffffffffdf2a,%rax
+  8003e7:	ff ff ff 
+  8003ea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003ee:	48 89 c7             	mov    %rax,%rdi
+  8003f1:	49 89 df             	mov    %rbx,%r15
+  8003f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f9:	49 b8 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%r8
+  800400:	ff ff ff 
+  800403:	49 01 d8             	add    %rbx,%r8
+  800406:	41 ff d0             	call   *%r8
+	va = fd2data(fd);
+  800409:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80040d:	48 89 c7             	mov    %rax,%rdi
+  800410:	49 89 df             	mov    %rbx,%r15
+  800413:	48 b8 fc ad ff ff ff 	movabs $0xffffffffffffadfc,%rax
+  80041a:	ff ff ff 
+  80041d:	48 01 d8             	add    %rbx,%rax
+  800420:	ff d0                	call   *%rax
+  800422:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	if (pageref(va) != 3+1)
+  800426:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80042a:	48 89 c7             	mov    %rax,%rdi
+  80042d:	49 89 df             	mov    %rbx,%r15
+  800430:	48 b8 7e c4 ff ff ff 	movabs $0xffffffffffffc47e,%rax
+  800437:	ff ff ff 
+  80043a:	48 01 d8             	add    %rbx,%rax
+  80043d:	ff d0                	call   *%rax
+  80043f:	83 f8 04             	cmp    $0x4,%eax
+  800442:	74 2a                	je     80046e <umain+0x42b>
+		cprintf("\nchild detected race\n");
+  800444:	48 b8 d2 df ff ff ff 	movabs $0xffffffffffffdfd2,%rax
+  80044b:	ff ff ff 
+  80044e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800452:	48 89 c7             	mov    %rax,%rdi
+  800455:	49 89 df             	mov    %rbx,%r15
+  800458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045d:	48 ba 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rdx
+  800464:	ff ff ff 
+  800467:	48 01 da             	add    %rbx,%rdx
+  80046a:	ff d2                	call   *%rdx
+	else
+		cprintf("\nrace didn't happen\n", max);
+}
+  80046c:	eb 2d                	jmp    80049b <umain+0x458>
+		cprintf("\nrace didn't happen\n", max);
+  80046e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800471:	89 c6                	mov    %eax,%esi
+  800473:	48 b8 e8 df ff ff ff 	movabs $0xffffffffffffdfe8,%rax
+  80047a:	ff ff ff 
+  80047d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800481:	48 89 c7             	mov    %rax,%rdi
+  800484:	49 89 df             	mov    %rbx,%r15
+  800487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048c:	48 ba 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rdx
+  800493:	ff ff ff 
+  800496:	48 01 da             	add    %rbx,%rdx
+  800499:	ff d2                	call   *%rdx
+}
+  80049b:	90                   	nop
+  80049c:	48 83 c4 40          	add    $0x40,%rsp
+  8004a0:	5b                   	pop    %rbx
+  8004a1:	41 5f                	pop    %r15
+  8004a3:	5d                   	pop    %rbp
+  8004a4:	c3                   	ret
+
+00000000008004a5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004a5:	55                   	push   %rbp
+  8004a6:	48 89 e5             	mov    %rsp,%rbp
+  8004a9:	41 57                	push   %r15
+  8004ab:	53                   	push   %rbx
+  8004ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8004b0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004b0 <libmain+0xb>
+  8004b7:	49 bb 90 8b 00 00 00 	movabs $0x8b90,%r11
+  8004be:	00 00 00 
+  8004c1:	4c 01 db             	add    %r11,%rbx
+  8004c4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8004c7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8004cb:	49 89 df             	mov    %rbx,%r15
+  8004ce:	48 b8 1b 92 ff ff ff 	movabs $0xffffffffffff921b,%rax
+  8004d5:	ff ff ff 
+  8004d8:	48 01 d8             	add    %rbx,%rax
+  8004db:	ff d0                	call   *%rax
+  8004dd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8004e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8004e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004e8:	48 98                	cltq
+  8004ea:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8004f1:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8004f8:	ff ff ff 
+  8004fb:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8004ff:	48 01 c2             	add    %rax,%rdx
+  800502:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  800509:	00 00 00 
+  80050c:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800510:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800514:	7e 15                	jle    80052b <libmain+0x86>
+		binaryname = argv[0];
+  800516:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80051a:	48 8b 00             	mov    (%rax),%rax
+  80051d:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  800524:	00 00 00 
+  800527:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  80052b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80052f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800532:	48 89 d6             	mov    %rdx,%rsi
+  800535:	89 c7                	mov    %eax,%edi
+  800537:	49 89 df             	mov    %rbx,%r15
+  80053a:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  800541:	ff ff ff 
+  800544:	48 01 d8             	add    %rbx,%rax
+  800547:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800549:	49 89 df             	mov    %rbx,%r15
+  80054c:	48 b8 25 75 ff ff ff 	movabs $0xffffffffffff7525,%rax
+  800553:	ff ff ff 
+  800556:	48 01 d8             	add    %rbx,%rax
+  800559:	ff d0                	call   *%rax
+}
+  80055b:	90                   	nop
+  80055c:	48 83 c4 20          	add    $0x20,%rsp
+  800560:	5b                   	pop    %rbx
+  800561:	41 5f                	pop    %r15
+  800563:	5d                   	pop    %rbp
+  800564:	c3                   	ret
+
+0000000000800565 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800565:	55                   	push   %rbp
+  800566:	48 89 e5             	mov    %rsp,%rbp
+  800569:	41 57                	push   %r15
+  80056b:	53                   	push   %rbx
+  80056c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80056c <exit+0x7>
+  800573:	49 bb d4 8a 00 00 00 	movabs $0x8ad4,%r11
+  80057a:	00 00 00 
+  80057d:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800580:	49 89 df             	mov    %rbx,%r15
+  800583:	48 b8 f0 b1 ff ff ff 	movabs $0xffffffffffffb1f0,%rax
+  80058a:	ff ff ff 
+  80058d:	48 01 d8             	add    %rbx,%rax
+  800590:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800592:	bf 00 00 00 00       	mov    $0x0,%edi
+  800597:	49 89 df             	mov    %rbx,%r15
+  80059a:	48 b8 bf 91 ff ff ff 	movabs $0xffffffffffff91bf,%rax
+  8005a1:	ff ff ff 
+  8005a4:	48 01 d8             	add    %rbx,%rax
+  8005a7:	ff d0                	call   *%rax
+}
+  8005a9:	90                   	nop
+  8005aa:	5b                   	pop    %rbx
+  8005ab:	41 5f                	pop    %r15
+  8005ad:	5d                   	pop    %rbp
+  8005ae:	c3                   	ret
+
+00000000008005af <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8005af:	55                   	push   %rbp
+  8005b0:	48 89 e5             	mov    %rsp,%rbp
+  8005b3:	41 57                	push   %r15
+  8005b5:	41 54                	push   %r12
+  8005b7:	53                   	push   %rbx
+  8005b8:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8005bf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8005bf <_panic+0x10>
+  8005c6:	49 bb 81 8a 00 00 00 	movabs $0x8a81,%r11
+  8005cd:	00 00 00 
+  8005d0:	4c 01 db             	add    %r11,%rbx
+  8005d3:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8005da:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8005e0:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8005e7:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8005ee:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8005f5:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8005fc:	84 c0                	test   %al,%al
+  8005fe:	74 26                	je     800626 <_panic+0x77>
+  800600:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800607:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80060e:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800612:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800616:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80061a:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80061e:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800622:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800626:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80062d:	00 00 00 
+  800630:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800637:	00 00 00 
+  80063a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80063e:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800645:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80064c:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800653:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  80065a:	ff ff ff 
+  80065d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800661:	4c 8b 20             	mov    (%rax),%r12
+  800664:	49 89 df             	mov    %rbx,%r15
+  800667:	48 b8 1b 92 ff ff ff 	movabs $0xffffffffffff921b,%rax
+  80066e:	ff ff ff 
+  800671:	48 01 d8             	add    %rbx,%rax
+  800674:	ff d0                	call   *%rax
+  800676:	89 c6                	mov    %eax,%esi
+  800678:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80067e:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800685:	41 89 d0             	mov    %edx,%r8d
+  800688:	48 89 c1             	mov    %rax,%rcx
+  80068b:	4c 89 e2             	mov    %r12,%rdx
+  80068e:	48 b8 08 e0 ff ff ff 	movabs $0xffffffffffffe008,%rax
+  800695:	ff ff ff 
+  800698:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80069c:	48 89 c7             	mov    %rax,%rdi
+  80069f:	49 89 df             	mov    %rbx,%r15
+  8006a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a7:	49 b9 46 78 ff ff ff 	movabs $0xffffffffffff7846,%r9
+  8006ae:	ff ff ff 
+  8006b1:	49 01 d9             	add    %rbx,%r9
+  8006b4:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8006b7:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8006be:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8006c5:	48 89 d6             	mov    %rdx,%rsi
+  8006c8:	48 89 c7             	mov    %rax,%rdi
+  8006cb:	49 89 df             	mov    %rbx,%r15
+  8006ce:	48 b8 66 77 ff ff ff 	movabs $0xffffffffffff7766,%rax
+  8006d5:	ff ff ff 
+  8006d8:	48 01 d8             	add    %rbx,%rax
+  8006db:	ff d0                	call   *%rax
+	cprintf("\n");
+  8006dd:	48 b8 2b e0 ff ff ff 	movabs $0xffffffffffffe02b,%rax
+  8006e4:	ff ff ff 
+  8006e7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006eb:	48 89 c7             	mov    %rax,%rdi
+  8006ee:	49 89 df             	mov    %rbx,%r15
+  8006f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f6:	48 ba 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rdx
+  8006fd:	ff ff ff 
+  800700:	48 01 da             	add    %rbx,%rdx
+  800703:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800705:	cc                   	int3
+  800706:	eb fd                	jmp    800705 <_panic+0x156>
+
+0000000000800708 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800708:	55                   	push   %rbp
+  800709:	48 89 e5             	mov    %rsp,%rbp
+  80070c:	41 57                	push   %r15
+  80070e:	48 83 ec 18          	sub    $0x18,%rsp
+  800712:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800712 <putch+0xa>
+  800719:	49 bb 2e 89 00 00 00 	movabs $0x892e,%r11
+  800720:	00 00 00 
+  800723:	4c 01 d8             	add    %r11,%rax
+  800726:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800729:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80072d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800731:	8b 12                	mov    (%rdx),%edx
+  800733:	8d 72 01             	lea    0x1(%rdx),%esi
+  800736:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80073a:	89 31                	mov    %esi,(%rcx)
+  80073c:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80073f:	89 ce                	mov    %ecx,%esi
+  800741:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800745:	48 63 d2             	movslq %edx,%rdx
+  800748:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80074d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800751:	8b 12                	mov    (%rdx),%edx
+  800753:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800759:	75 33                	jne    80078e <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80075b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80075f:	8b 12                	mov    (%rdx),%edx
+  800761:	48 63 d2             	movslq %edx,%rdx
+  800764:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800768:	48 83 c1 08          	add    $0x8,%rcx
+  80076c:	48 89 d6             	mov    %rdx,%rsi
+  80076f:	48 89 cf             	mov    %rcx,%rdi
+  800772:	49 89 c7             	mov    %rax,%r15
+  800775:	48 ba 0c 91 ff ff ff 	movabs $0xffffffffffff910c,%rdx
+  80077c:	ff ff ff 
+  80077f:	48 01 c2             	add    %rax,%rdx
+  800782:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800784:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800788:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  80078e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800792:	8b 40 04             	mov    0x4(%rax),%eax
+  800795:	8d 50 01             	lea    0x1(%rax),%edx
+  800798:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80079c:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80079f:	90                   	nop
+  8007a0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8007a4:	c9                   	leave
+  8007a5:	c3                   	ret
+
+00000000008007a6 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8007a6:	55                   	push   %rbp
+  8007a7:	48 89 e5             	mov    %rsp,%rbp
+  8007aa:	41 57                	push   %r15
+  8007ac:	53                   	push   %rbx
+  8007ad:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8007b4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8007b4 <vcprintf+0xe>
+  8007bb:	49 bb 8c 88 00 00 00 	movabs $0x888c,%r11
+  8007c2:	00 00 00 
+  8007c5:	4c 01 db             	add    %r11,%rbx
+  8007c8:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  8007cf:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8007d6:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8007dd:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8007e4:	48 8b 06             	mov    (%rsi),%rax
+  8007e7:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007eb:	48 89 01             	mov    %rax,(%rcx)
+  8007ee:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8007f2:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8007f6:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8007fa:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800801:	00 00 00 
+    b.cnt = 0;
+  800804:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80080b:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  80080e:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800815:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  80081c:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800823:	48 89 c6             	mov    %rax,%rsi
+  800826:	48 b8 c8 76 ff ff ff 	movabs $0xffffffffffff76c8,%rax
+  80082d:	ff ff ff 
+  800830:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800834:	48 89 c7             	mov    %rax,%rdi
+  800837:	49 89 df             	mov    %rbx,%r15
+  80083a:	48 b8 8a 7c ff ff ff 	movabs $0xffffffffffff7c8a,%rax
+  800841:	ff ff ff 
+  800844:	48 01 d8             	add    %rbx,%rax
+  800847:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800849:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80084f:	48 98                	cltq
+  800851:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800858:	48 83 c2 08          	add    $0x8,%rdx
+  80085c:	48 89 c6             	mov    %rax,%rsi
+  80085f:	48 89 d7             	mov    %rdx,%rdi
+  800862:	49 89 df             	mov    %rbx,%r15
+  800865:	48 b8 0c 91 ff ff ff 	movabs $0xffffffffffff910c,%rax
+  80086c:	ff ff ff 
+  80086f:	48 01 d8             	add    %rbx,%rax
+  800872:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800874:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  80087a:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800881:	5b                   	pop    %rbx
+  800882:	41 5f                	pop    %r15
+  800884:	5d                   	pop    %rbp
+  800885:	c3                   	ret
+
+0000000000800886 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800886:	55                   	push   %rbp
+  800887:	48 89 e5             	mov    %rsp,%rbp
+  80088a:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800891:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800891 <cprintf+0xb>
+  800898:	49 bb af 87 00 00 00 	movabs $0x87af,%r11
+  80089f:	00 00 00 
+  8008a2:	4d 01 da             	add    %r11,%r10
+  8008a5:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8008ac:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8008b3:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8008ba:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8008c1:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8008c8:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8008cf:	84 c0                	test   %al,%al
+  8008d1:	74 20                	je     8008f3 <cprintf+0x6d>
+  8008d3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8008d7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8008db:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8008df:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8008e3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8008e7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8008eb:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8008ef:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8008f3:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8008fa:	00 00 00 
+  8008fd:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800904:	00 00 00 
+  800907:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80090b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800912:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800919:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800920:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800927:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80092e:	48 8b 06             	mov    (%rsi),%rax
+  800931:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800935:	48 89 01             	mov    %rax,(%rcx)
+  800938:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80093c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800940:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800944:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80094b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800952:	48 89 d6             	mov    %rdx,%rsi
+  800955:	48 89 c7             	mov    %rax,%rdi
+  800958:	48 b8 66 77 ff ff ff 	movabs $0xffffffffffff7766,%rax
+  80095f:	ff ff ff 
+  800962:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800966:	ff d0                	call   *%rax
+  800968:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80096e:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800974:	c9                   	leave
+  800975:	c3                   	ret
+
+0000000000800976 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800976:	55                   	push   %rbp
+  800977:	48 89 e5             	mov    %rsp,%rbp
+  80097a:	53                   	push   %rbx
+  80097b:	48 83 ec 38          	sub    $0x38,%rsp
+  80097f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80097f <printnum+0x9>
+  800986:	49 bb c1 86 00 00 00 	movabs $0x86c1,%r11
+  80098d:	00 00 00 
+  800990:	4c 01 db             	add    %r11,%rbx
+  800993:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800997:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80099b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80099f:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8009a2:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8009a6:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8009aa:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8009ad:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8009b1:	72 58                	jb     800a0b <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8009b3:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8009b6:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8009b9:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8009bc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009c5:	48 f7 f6             	div    %rsi
+  8009c8:	49 89 c2             	mov    %rax,%r10
+  8009cb:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8009ce:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8009d1:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8009d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009d9:	41 89 c9             	mov    %ecx,%r9d
+  8009dc:	41 89 f8             	mov    %edi,%r8d
+  8009df:	89 d1                	mov    %edx,%ecx
+  8009e1:	4c 89 d2             	mov    %r10,%rdx
+  8009e4:	48 89 c7             	mov    %rax,%rdi
+  8009e7:	48 b8 36 79 ff ff ff 	movabs $0xffffffffffff7936,%rax
+  8009ee:	ff ff ff 
+  8009f1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009f5:	ff d0                	call   *%rax
+  8009f7:	eb 1c                	jmp    800a15 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8009f9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8009fd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800a00:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800a04:	48 89 d6             	mov    %rdx,%rsi
+  800a07:	89 c7                	mov    %eax,%edi
+  800a09:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800a0b:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800a0f:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800a13:	7f e4                	jg     8009f9 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800a15:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800a18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a21:	48 f7 f1             	div    %rcx
+  800a24:	48 b8 67 e1 ff ff ff 	movabs $0xffffffffffffe167,%rax
+  800a2b:	ff ff ff 
+  800a2e:	48 01 d8             	add    %rbx,%rax
+  800a31:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800a35:	0f be c0             	movsbl %al,%eax
+  800a38:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a3c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800a40:	48 89 d6             	mov    %rdx,%rsi
+  800a43:	89 c7                	mov    %eax,%edi
+  800a45:	ff d1                	call   *%rcx
+}
+  800a47:	90                   	nop
+  800a48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a4c:	c9                   	leave
+  800a4d:	c3                   	ret
+
+0000000000800a4e <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800a4e:	55                   	push   %rbp
+  800a4f:	48 89 e5             	mov    %rsp,%rbp
+  800a52:	48 83 ec 20          	sub    $0x20,%rsp
+  800a56:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a56 <getuint+0x8>
+  800a5d:	49 bb ea 85 00 00 00 	movabs $0x85ea,%r11
+  800a64:	00 00 00 
+  800a67:	4c 01 d8             	add    %r11,%rax
+  800a6a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a6e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800a71:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800a75:	7e 4f                	jle    800ac6 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800a77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a7b:	8b 00                	mov    (%rax),%eax
+  800a7d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a80:	77 24                	ja     800aa6 <getuint+0x58>
+  800a82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a86:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a8e:	8b 00                	mov    (%rax),%eax
+  800a90:	89 c0                	mov    %eax,%eax
+  800a92:	48 01 d0             	add    %rdx,%rax
+  800a95:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a99:	8b 12                	mov    (%rdx),%edx
+  800a9b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a9e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aa2:	89 0a                	mov    %ecx,(%rdx)
+  800aa4:	eb 14                	jmp    800aba <getuint+0x6c>
+  800aa6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aaa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800aae:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ab2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ab6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800aba:	48 8b 00             	mov    (%rax),%rax
+  800abd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800ac1:	e9 9d 00 00 00       	jmp    800b63 <getuint+0x115>
+	else if (lflag)
+  800ac6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800aca:	74 4c                	je     800b18 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800acc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad0:	8b 00                	mov    (%rax),%eax
+  800ad2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad5:	77 24                	ja     800afb <getuint+0xad>
+  800ad7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800adb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800adf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ae3:	8b 00                	mov    (%rax),%eax
+  800ae5:	89 c0                	mov    %eax,%eax
+  800ae7:	48 01 d0             	add    %rdx,%rax
+  800aea:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aee:	8b 12                	mov    (%rdx),%edx
+  800af0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800af3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800af7:	89 0a                	mov    %ecx,(%rdx)
+  800af9:	eb 14                	jmp    800b0f <getuint+0xc1>
+  800afb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b03:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b0b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b0f:	48 8b 00             	mov    (%rax),%rax
+  800b12:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b16:	eb 4b                	jmp    800b63 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800b18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b1c:	8b 00                	mov    (%rax),%eax
+  800b1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b21:	77 24                	ja     800b47 <getuint+0xf9>
+  800b23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b27:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b2f:	8b 00                	mov    (%rax),%eax
+  800b31:	89 c0                	mov    %eax,%eax
+  800b33:	48 01 d0             	add    %rdx,%rax
+  800b36:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b3a:	8b 12                	mov    (%rdx),%edx
+  800b3c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b3f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b43:	89 0a                	mov    %ecx,(%rdx)
+  800b45:	eb 14                	jmp    800b5b <getuint+0x10d>
+  800b47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b4b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b4f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b53:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b57:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b5b:	8b 00                	mov    (%rax),%eax
+  800b5d:	89 c0                	mov    %eax,%eax
+  800b5f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800b63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800b67:	c9                   	leave
+  800b68:	c3                   	ret
+
+0000000000800b69 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800b69:	55                   	push   %rbp
+  800b6a:	48 89 e5             	mov    %rsp,%rbp
+  800b6d:	48 83 ec 20          	sub    $0x20,%rsp
+  800b71:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b71 <printfloat+0x8>
+  800b78:	49 bb cf 84 00 00 00 	movabs $0x84cf,%r11
+  800b7f:	00 00 00 
+  800b82:	4c 01 d8             	add    %r11,%rax
+  800b85:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800b89:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800b8d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800b91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b95:	48 85 c0             	test   %rax,%rax
+  800b98:	79 12                	jns    800bac <printfloat+0x43>
+		putch('-',putdat);
+  800b9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b9e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ba2:	48 89 c6             	mov    %rax,%rsi
+  800ba5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800baa:	ff d2                	call   *%rdx
+	
+}
+  800bac:	90                   	nop
+  800bad:	c9                   	leave
+  800bae:	c3                   	ret
+
+0000000000800baf <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800baf:	55                   	push   %rbp
+  800bb0:	48 89 e5             	mov    %rsp,%rbp
+  800bb3:	48 83 ec 20          	sub    $0x20,%rsp
+  800bb7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800bb7 <getint+0x8>
+  800bbe:	49 bb 89 84 00 00 00 	movabs $0x8489,%r11
+  800bc5:	00 00 00 
+  800bc8:	4c 01 d8             	add    %r11,%rax
+  800bcb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bcf:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800bd2:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800bd6:	7e 4f                	jle    800c27 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800bd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bdc:	8b 00                	mov    (%rax),%eax
+  800bde:	83 f8 2f             	cmp    $0x2f,%eax
+  800be1:	77 24                	ja     800c07 <getint+0x58>
+  800be3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800be7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800beb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bef:	8b 00                	mov    (%rax),%eax
+  800bf1:	89 c0                	mov    %eax,%eax
+  800bf3:	48 01 d0             	add    %rdx,%rax
+  800bf6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bfa:	8b 12                	mov    (%rdx),%edx
+  800bfc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800bff:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c03:	89 0a                	mov    %ecx,(%rdx)
+  800c05:	eb 14                	jmp    800c1b <getint+0x6c>
+  800c07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c0b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c0f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c13:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c17:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c1b:	48 8b 00             	mov    (%rax),%rax
+  800c1e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800c22:	e9 9d 00 00 00       	jmp    800cc4 <getint+0x115>
+	else if (lflag)
+  800c27:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800c2b:	74 4c                	je     800c79 <getint+0xca>
+		x=va_arg(*ap, long);
+  800c2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c31:	8b 00                	mov    (%rax),%eax
+  800c33:	83 f8 2f             	cmp    $0x2f,%eax
+  800c36:	77 24                	ja     800c5c <getint+0xad>
+  800c38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c3c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c40:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c44:	8b 00                	mov    (%rax),%eax
+  800c46:	89 c0                	mov    %eax,%eax
+  800c48:	48 01 d0             	add    %rdx,%rax
+  800c4b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c4f:	8b 12                	mov    (%rdx),%edx
+  800c51:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c54:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c58:	89 0a                	mov    %ecx,(%rdx)
+  800c5a:	eb 14                	jmp    800c70 <getint+0xc1>
+  800c5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c60:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c64:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c68:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c6c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c70:	48 8b 00             	mov    (%rax),%rax
+  800c73:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800c77:	eb 4b                	jmp    800cc4 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800c79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c7d:	8b 00                	mov    (%rax),%eax
+  800c7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c82:	77 24                	ja     800ca8 <getint+0xf9>
+  800c84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c88:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c90:	8b 00                	mov    (%rax),%eax
+  800c92:	89 c0                	mov    %eax,%eax
+  800c94:	48 01 d0             	add    %rdx,%rax
+  800c97:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c9b:	8b 12                	mov    (%rdx),%edx
+  800c9d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ca0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ca4:	89 0a                	mov    %ecx,(%rdx)
+  800ca6:	eb 14                	jmp    800cbc <getint+0x10d>
+  800ca8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800cb0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800cb4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cb8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800cbc:	8b 00                	mov    (%rax),%eax
+  800cbe:	48 98                	cltq
+  800cc0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800cc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800cc8:	c9                   	leave
+  800cc9:	c3                   	ret
+
+0000000000800cca <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800cca:	55                   	push   %rbp
+  800ccb:	48 89 e5             	mov    %rsp,%rbp
+  800cce:	41 57                	push   %r15
+  800cd0:	41 55                	push   %r13
+  800cd2:	41 54                	push   %r12
+  800cd4:	53                   	push   %rbx
+  800cd5:	48 83 ec 60          	sub    $0x60,%rsp
+  800cd9:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800cd9 <vprintfmt+0xf>
+  800ce0:	49 bb 67 83 00 00 00 	movabs $0x8367,%r11
+  800ce7:	00 00 00 
+  800cea:	4d 01 dc             	add    %r11,%r12
+  800ced:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800cf1:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800cf5:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800cf9:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800cfd:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800d04:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800d08:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800d0c:	48 8b 06             	mov    (%rsi),%rax
+  800d0f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800d13:	48 89 01             	mov    %rax,(%rcx)
+  800d16:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d1a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800d1e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800d22:	eb 17                	jmp    800d3b <vprintfmt+0x71>
+			if (ch == '\0')
+  800d24:	85 db                	test   %ebx,%ebx
+  800d26:	0f 84 97 05 00 00    	je     8012c3 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800d2c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d30:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d34:	48 89 c6             	mov    %rax,%rsi
+  800d37:	89 df                	mov    %ebx,%edi
+  800d39:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800d3b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d3f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d43:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d47:	0f b6 00             	movzbl (%rax),%eax
+  800d4a:	0f b6 d8             	movzbl %al,%ebx
+  800d4d:	83 fb 25             	cmp    $0x25,%ebx
+  800d50:	75 d2                	jne    800d24 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800d52:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800d56:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800d5d:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800d64:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800d6b:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800d72:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d76:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d7a:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d7e:	0f b6 00             	movzbl (%rax),%eax
+  800d81:	0f b6 d8             	movzbl %al,%ebx
+  800d84:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800d87:	83 f8 55             	cmp    $0x55,%eax
+  800d8a:	0f 87 00 05 00 00    	ja     801290 <vprintfmt+0x5c6>
+  800d90:	89 c0                	mov    %eax,%eax
+  800d92:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800d99:	00 
+  800d9a:	48 8d 05 2f 64 00 00 	lea    0x642f(%rip),%rax        # 8071d0 <.LC18+0xc>
+  800da1:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800da5:	48 8d 15 24 64 00 00 	lea    0x6424(%rip),%rdx        # 8071d0 <.LC18+0xc>
+  800dac:	48 01 d0             	add    %rdx,%rax
+  800daf:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800db1:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800db5:	eb bb                	jmp    800d72 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800db7:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800dbb:	eb b5                	jmp    800d72 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800dbd:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800dc4:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800dc7:	89 d0                	mov    %edx,%eax
+  800dc9:	c1 e0 02             	shl    $0x2,%eax
+  800dcc:	01 d0                	add    %edx,%eax
+  800dce:	01 c0                	add    %eax,%eax
+  800dd0:	01 d8                	add    %ebx,%eax
+  800dd2:	83 e8 30             	sub    $0x30,%eax
+  800dd5:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800dd8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ddc:	0f b6 00             	movzbl (%rax),%eax
+  800ddf:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800de2:	83 fb 2f             	cmp    $0x2f,%ebx
+  800de5:	7e 60                	jle    800e47 <vprintfmt+0x17d>
+  800de7:	83 fb 39             	cmp    $0x39,%ebx
+  800dea:	7f 5b                	jg     800e47 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800dec:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800df1:	eb d1                	jmp    800dc4 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800df3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800df6:	83 f8 2f             	cmp    $0x2f,%eax
+  800df9:	77 17                	ja     800e12 <vprintfmt+0x148>
+  800dfb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800dff:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e02:	89 d2                	mov    %edx,%edx
+  800e04:	48 01 d0             	add    %rdx,%rax
+  800e07:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e0a:	83 c2 08             	add    $0x8,%edx
+  800e0d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e10:	eb 0c                	jmp    800e1e <vprintfmt+0x154>
+  800e12:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e16:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e1a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e1e:	8b 00                	mov    (%rax),%eax
+  800e20:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800e23:	eb 23                	jmp    800e48 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800e25:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e29:	0f 89 43 ff ff ff    	jns    800d72 <vprintfmt+0xa8>
+				width = 0;
+  800e2f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800e36:	e9 37 ff ff ff       	jmp    800d72 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800e3b:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800e42:	e9 2b ff ff ff       	jmp    800d72 <vprintfmt+0xa8>
+			goto process_precision;
+  800e47:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800e48:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e4c:	0f 89 20 ff ff ff    	jns    800d72 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800e52:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800e55:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800e58:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800e5f:	e9 0e ff ff ff       	jmp    800d72 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800e64:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800e68:	e9 05 ff ff ff       	jmp    800d72 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800e6d:	83 fb 39             	cmp    $0x39,%ebx
+  800e70:	7f 0b                	jg     800e7d <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800e72:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800e75:	c1 e0 08             	shl    $0x8,%eax
+  800e78:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800e7b:	eb 21                	jmp    800e9e <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800e7d:	83 fb 60             	cmp    $0x60,%ebx
+  800e80:	7e 10                	jle    800e92 <vprintfmt+0x1c8>
+  800e82:	83 fb 66             	cmp    $0x66,%ebx
+  800e85:	7f 0b                	jg     800e92 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800e87:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800e8a:	c1 e0 08             	shl    $0x8,%eax
+  800e8d:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800e90:	eb 0c                	jmp    800e9e <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800e92:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800e99:	e9 04 01 00 00       	jmp    800fa2 <vprintfmt+0x2d8>
+  800e9e:	e9 ff 00 00 00       	jmp    800fa2 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800ea3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ea6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ea9:	77 17                	ja     800ec2 <vprintfmt+0x1f8>
+  800eab:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800eaf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800eb2:	89 d2                	mov    %edx,%edx
+  800eb4:	48 01 d0             	add    %rdx,%rax
+  800eb7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800eba:	83 c2 08             	add    $0x8,%edx
+  800ebd:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ec0:	eb 0c                	jmp    800ece <vprintfmt+0x204>
+  800ec2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ec6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800eca:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ece:	8b 00                	mov    (%rax),%eax
+  800ed0:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800ed4:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800ed8:	48 89 d6             	mov    %rdx,%rsi
+  800edb:	89 c7                	mov    %eax,%edi
+  800edd:	ff d1                	call   *%rcx
+			break;
+  800edf:	e9 da 03 00 00       	jmp    8012be <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800ee4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ee7:	83 f8 2f             	cmp    $0x2f,%eax
+  800eea:	77 17                	ja     800f03 <vprintfmt+0x239>
+  800eec:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ef0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ef3:	89 d2                	mov    %edx,%edx
+  800ef5:	48 01 d0             	add    %rdx,%rax
+  800ef8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800efb:	83 c2 08             	add    $0x8,%edx
+  800efe:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f01:	eb 0c                	jmp    800f0f <vprintfmt+0x245>
+  800f03:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f07:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f0b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f0f:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800f11:	85 db                	test   %ebx,%ebx
+  800f13:	79 02                	jns    800f17 <vprintfmt+0x24d>
+				err = -err;
+  800f15:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800f17:	83 fb 15             	cmp    $0x15,%ebx
+  800f1a:	7f 19                	jg     800f35 <vprintfmt+0x26b>
+  800f1c:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800f23:	00 00 00 
+  800f26:	48 63 c3             	movslq %ebx,%rax
+  800f29:	4c 01 e2             	add    %r12,%rdx
+  800f2c:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800f30:	4d 85 ed             	test   %r13,%r13
+  800f33:	75 36                	jne    800f6b <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800f35:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f39:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f3d:	89 d9                	mov    %ebx,%ecx
+  800f3f:	48 ba 78 e1 ff ff ff 	movabs $0xffffffffffffe178,%rdx
+  800f46:	ff ff ff 
+  800f49:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800f4d:	48 89 c7             	mov    %rax,%rdi
+  800f50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f55:	49 b8 91 82 ff ff ff 	movabs $0xffffffffffff8291,%r8
+  800f5c:	ff ff ff 
+  800f5f:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800f63:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800f66:	e9 53 03 00 00       	jmp    8012be <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800f6b:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f6f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f73:	4c 89 e9             	mov    %r13,%rcx
+  800f76:	48 ba 81 e1 ff ff ff 	movabs $0xffffffffffffe181,%rdx
+  800f7d:	ff ff ff 
+  800f80:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800f84:	48 89 c7             	mov    %rax,%rdi
+  800f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8c:	49 b8 91 82 ff ff ff 	movabs $0xffffffffffff8291,%r8
+  800f93:	ff ff ff 
+  800f96:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800f9a:	41 ff d0             	call   *%r8
+			break;
+  800f9d:	e9 1c 03 00 00       	jmp    8012be <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800fa2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800fa5:	83 f8 2f             	cmp    $0x2f,%eax
+  800fa8:	77 17                	ja     800fc1 <vprintfmt+0x2f7>
+  800faa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800fae:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800fb1:	89 d2                	mov    %edx,%edx
+  800fb3:	48 01 d0             	add    %rdx,%rax
+  800fb6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800fb9:	83 c2 08             	add    $0x8,%edx
+  800fbc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800fbf:	eb 0c                	jmp    800fcd <vprintfmt+0x303>
+  800fc1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800fc5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800fc9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800fcd:	4c 8b 28             	mov    (%rax),%r13
+  800fd0:	4d 85 ed             	test   %r13,%r13
+  800fd3:	75 0e                	jne    800fe3 <vprintfmt+0x319>
+				p = "(null)";
+  800fd5:	48 b8 84 e1 ff ff ff 	movabs $0xffffffffffffe184,%rax
+  800fdc:	ff ff ff 
+  800fdf:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800fe3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800fe7:	0f 8e 84 00 00 00    	jle    801071 <vprintfmt+0x3a7>
+  800fed:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800ff1:	74 7e                	je     801071 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ff3:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ff6:	48 98                	cltq
+  800ff8:	48 89 c6             	mov    %rax,%rsi
+  800ffb:	4c 89 ef             	mov    %r13,%rdi
+  800ffe:	4d 89 e7             	mov    %r12,%r15
+  801001:	48 b8 b6 85 ff ff ff 	movabs $0xffffffffffff85b6,%rax
+  801008:	ff ff ff 
+  80100b:	4c 01 e0             	add    %r12,%rax
+  80100e:	ff d0                	call   *%rax
+  801010:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  801013:	eb 17                	jmp    80102c <vprintfmt+0x362>
+					putch(padc, putdat);
+  801015:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  801019:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80101d:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801021:	48 89 d6             	mov    %rdx,%rsi
+  801024:	89 c7                	mov    %eax,%edi
+  801026:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801028:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80102c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801030:	7f e3                	jg     801015 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801032:	eb 3d                	jmp    801071 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801034:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  801038:	74 1e                	je     801058 <vprintfmt+0x38e>
+  80103a:	83 fb 1f             	cmp    $0x1f,%ebx
+  80103d:	7e 05                	jle    801044 <vprintfmt+0x37a>
+  80103f:	83 fb 7e             	cmp    $0x7e,%ebx
+  801042:	7e 14                	jle    801058 <vprintfmt+0x38e>
+					putch('?', putdat);
+  801044:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801048:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80104c:	48 89 c6             	mov    %rax,%rsi
+  80104f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801054:	ff d2                	call   *%rdx
+  801056:	eb 15                	jmp    80106d <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  801058:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80105b:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  80105e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801062:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801066:	48 89 c6             	mov    %rax,%rsi
+  801069:	89 cf                	mov    %ecx,%edi
+  80106b:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80106d:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801071:	4c 89 e8             	mov    %r13,%rax
+  801074:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  801078:	0f b6 00             	movzbl (%rax),%eax
+  80107b:	0f be d8             	movsbl %al,%ebx
+  80107e:	85 db                	test   %ebx,%ebx
+  801080:	74 28                	je     8010aa <vprintfmt+0x3e0>
+  801082:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801086:	78 ac                	js     801034 <vprintfmt+0x36a>
+  801088:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  80108c:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801090:	79 a2                	jns    801034 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  801092:	eb 16                	jmp    8010aa <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  801094:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801098:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80109c:	48 89 c6             	mov    %rax,%rsi
+  80109f:	bf 20 00 00 00       	mov    $0x20,%edi
+  8010a4:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  8010a6:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8010aa:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8010ae:	7f e4                	jg     801094 <vprintfmt+0x3ca>
+			break;
+  8010b0:	e9 09 02 00 00       	jmp    8012be <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  8010b5:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8010b9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8010bd:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8010c1:	0f b6 00             	movzbl (%rax),%eax
+  8010c4:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  8010c7:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  8010c8:	83 fb 2f             	cmp    $0x2f,%ebx
+  8010cb:	0f 8e ac fd ff ff    	jle    800e7d <vprintfmt+0x1b3>
+  8010d1:	e9 97 fd ff ff       	jmp    800e6d <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  8010d6:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010da:	be 03 00 00 00       	mov    $0x3,%esi
+  8010df:	48 89 c7             	mov    %rax,%rdi
+  8010e2:	48 b8 6f 7b ff ff ff 	movabs $0xffffffffffff7b6f,%rax
+  8010e9:	ff ff ff 
+  8010ec:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010f0:	ff d0                	call   *%rax
+  8010f2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  8010f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010fa:	48 85 c0             	test   %rax,%rax
+  8010fd:	79 1d                	jns    80111c <vprintfmt+0x452>
+				putch('-', putdat);
+  8010ff:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801103:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801107:	48 89 c6             	mov    %rax,%rsi
+  80110a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80110f:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  801111:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801115:	48 f7 d8             	neg    %rax
+  801118:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  80111c:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801123:	e9 de 00 00 00       	jmp    801206 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  801128:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80112c:	be 03 00 00 00       	mov    $0x3,%esi
+  801131:	48 89 c7             	mov    %rax,%rdi
+  801134:	48 b8 0e 7a ff ff ff 	movabs $0xffffffffffff7a0e,%rax
+  80113b:	ff ff ff 
+  80113e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801142:	ff d0                	call   *%rax
+  801144:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801148:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80114f:	e9 b2 00 00 00       	jmp    801206 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  801154:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801158:	be 03 00 00 00       	mov    $0x3,%esi
+  80115d:	48 89 c7             	mov    %rax,%rdi
+  801160:	48 b8 0e 7a ff ff ff 	movabs $0xffffffffffff7a0e,%rax
+  801167:	ff ff ff 
+  80116a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80116e:	ff d0                	call   *%rax
+  801170:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801174:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  80117b:	e9 86 00 00 00       	jmp    801206 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  801180:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801184:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801188:	48 89 c6             	mov    %rax,%rsi
+  80118b:	bf 30 00 00 00       	mov    $0x30,%edi
+  801190:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801192:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801196:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80119a:	48 89 c6             	mov    %rax,%rsi
+  80119d:	bf 78 00 00 00       	mov    $0x78,%edi
+  8011a2:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  8011a4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8011a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8011aa:	77 17                	ja     8011c3 <vprintfmt+0x4f9>
+  8011ac:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011b0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8011b3:	89 d2                	mov    %edx,%edx
+  8011b5:	48 01 d0             	add    %rdx,%rax
+  8011b8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8011bb:	83 c2 08             	add    $0x8,%edx
+  8011be:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8011c1:	eb 0c                	jmp    8011cf <vprintfmt+0x505>
+  8011c3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011c7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8011cb:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8011cf:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  8011d2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8011d6:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8011dd:	eb 27                	jmp    801206 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8011df:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8011e3:	be 03 00 00 00       	mov    $0x3,%esi
+  8011e8:	48 89 c7             	mov    %rax,%rdi
+  8011eb:	48 b8 0e 7a ff ff ff 	movabs $0xffffffffffff7a0e,%rax
+  8011f2:	ff ff ff 
+  8011f5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011f9:	ff d0                	call   *%rax
+  8011fb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8011ff:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801206:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  80120b:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80120e:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801211:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801215:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801219:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80121d:	45 89 c1             	mov    %r8d,%r9d
+  801220:	41 89 f8             	mov    %edi,%r8d
+  801223:	48 89 c7             	mov    %rax,%rdi
+  801226:	48 b8 36 79 ff ff ff 	movabs $0xffffffffffff7936,%rax
+  80122d:	ff ff ff 
+  801230:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801234:	ff d0                	call   *%rax
+			break;
+  801236:	e9 83 00 00 00       	jmp    8012be <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  80123b:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80123f:	be 03 00 00 00       	mov    $0x3,%esi
+  801244:	48 89 c7             	mov    %rax,%rdi
+  801247:	48 b8 0e 7a ff ff ff 	movabs $0xffffffffffff7a0e,%rax
+  80124e:	ff ff ff 
+  801251:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801255:	ff d0                	call   *%rax
+  801257:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  80125b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80125f:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801263:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801267:	48 89 ce             	mov    %rcx,%rsi
+  80126a:	48 89 c7             	mov    %rax,%rdi
+  80126d:	48 b8 29 7b ff ff ff 	movabs $0xffffffffffff7b29,%rax
+  801274:	ff ff ff 
+  801277:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80127b:	ff d0                	call   *%rax
+	
+			break;
+  80127d:	eb 3f                	jmp    8012be <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  80127f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801283:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801287:	48 89 c6             	mov    %rax,%rsi
+  80128a:	89 df                	mov    %ebx,%edi
+  80128c:	ff d2                	call   *%rdx
+			break;
+  80128e:	eb 2e                	jmp    8012be <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801290:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801294:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801298:	48 89 c6             	mov    %rax,%rsi
+  80129b:	bf 25 00 00 00       	mov    $0x25,%edi
+  8012a0:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8012a2:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8012a7:	eb 05                	jmp    8012ae <vprintfmt+0x5e4>
+  8012a9:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8012ae:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8012b2:	48 83 e8 01          	sub    $0x1,%rax
+  8012b6:	0f b6 00             	movzbl (%rax),%eax
+  8012b9:	3c 25                	cmp    $0x25,%al
+  8012bb:	75 ec                	jne    8012a9 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  8012bd:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8012be:	e9 78 fa ff ff       	jmp    800d3b <vprintfmt+0x71>
+				return;
+  8012c3:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  8012c4:	48 83 c4 60          	add    $0x60,%rsp
+  8012c8:	5b                   	pop    %rbx
+  8012c9:	41 5c                	pop    %r12
+  8012cb:	41 5d                	pop    %r13
+  8012cd:	41 5f                	pop    %r15
+  8012cf:	5d                   	pop    %rbp
+  8012d0:	c3                   	ret
+
+00000000008012d1 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  8012d1:	55                   	push   %rbp
+  8012d2:	48 89 e5             	mov    %rsp,%rbp
+  8012d5:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8012dc:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8012dc <printfmt+0xb>
+  8012e3:	49 bb 64 7d 00 00 00 	movabs $0x7d64,%r11
+  8012ea:	00 00 00 
+  8012ed:	4d 01 da             	add    %r11,%r10
+  8012f0:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8012f7:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8012fe:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801305:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80130c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801313:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80131a:	84 c0                	test   %al,%al
+  80131c:	74 20                	je     80133e <printfmt+0x6d>
+  80131e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801322:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801326:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80132a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80132e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801332:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801336:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80133a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80133e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801345:	00 00 00 
+  801348:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80134f:	00 00 00 
+  801352:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801356:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80135d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801364:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80136b:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801372:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801379:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801380:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801387:	48 89 c7             	mov    %rax,%rdi
+  80138a:	48 b8 8a 7c ff ff ff 	movabs $0xffffffffffff7c8a,%rax
+  801391:	ff ff ff 
+  801394:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801398:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  80139a:	90                   	nop
+  80139b:	c9                   	leave
+  80139c:	c3                   	ret
+
+000000000080139d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80139d:	55                   	push   %rbp
+  80139e:	48 89 e5             	mov    %rsp,%rbp
+  8013a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8013a5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013a5 <sprintputch+0x8>
+  8013ac:	49 bb 9b 7c 00 00 00 	movabs $0x7c9b,%r11
+  8013b3:	00 00 00 
+  8013b6:	4c 01 d8             	add    %r11,%rax
+  8013b9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8013bc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  8013c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013c4:	8b 40 10             	mov    0x10(%rax),%eax
+  8013c7:	8d 50 01             	lea    0x1(%rax),%edx
+  8013ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013ce:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  8013d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013d5:	48 8b 10             	mov    (%rax),%rdx
+  8013d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013dc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8013e0:	48 39 c2             	cmp    %rax,%rdx
+  8013e3:	73 17                	jae    8013fc <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8013e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013e9:	48 8b 00             	mov    (%rax),%rax
+  8013ec:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013f0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8013f4:	48 89 0a             	mov    %rcx,(%rdx)
+  8013f7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8013fa:	88 10                	mov    %dl,(%rax)
+}
+  8013fc:	90                   	nop
+  8013fd:	c9                   	leave
+  8013fe:	c3                   	ret
+
+00000000008013ff <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8013ff:	55                   	push   %rbp
+  801400:	48 89 e5             	mov    %rsp,%rbp
+  801403:	53                   	push   %rbx
+  801404:	48 83 ec 58          	sub    $0x58,%rsp
+  801408:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801408 <vsnprintf+0x9>
+  80140f:	49 bb 38 7c 00 00 00 	movabs $0x7c38,%r11
+  801416:	00 00 00 
+  801419:	4c 01 d8             	add    %r11,%rax
+  80141c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801420:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801423:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801427:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  80142b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80142f:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801433:	48 8b 0e             	mov    (%rsi),%rcx
+  801436:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  80143a:	48 89 0a             	mov    %rcx,(%rdx)
+  80143d:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801441:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801445:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801449:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80144d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801451:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801454:	48 63 d2             	movslq %edx,%rdx
+  801457:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80145b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80145f:	48 01 ca             	add    %rcx,%rdx
+  801462:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801466:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  80146d:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801472:	74 06                	je     80147a <vsnprintf+0x7b>
+  801474:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801478:	7f 07                	jg     801481 <vsnprintf+0x82>
+		return -E_INVAL;
+  80147a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80147f:	eb 34                	jmp    8014b5 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801481:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801485:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801489:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80148d:	48 bf 5d 83 ff ff ff 	movabs $0xffffffffffff835d,%rdi
+  801494:	ff ff ff 
+  801497:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  80149b:	49 b8 8a 7c ff ff ff 	movabs $0xffffffffffff7c8a,%r8
+  8014a2:	ff ff ff 
+  8014a5:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8014a9:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8014ab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8014af:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8014b2:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8014b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b9:	c9                   	leave
+  8014ba:	c3                   	ret
+
+00000000008014bb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8014bb:	55                   	push   %rbp
+  8014bc:	48 89 e5             	mov    %rsp,%rbp
+  8014bf:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8014c6:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8014c6 <snprintf+0xb>
+  8014cd:	49 bb 7a 7b 00 00 00 	movabs $0x7b7a,%r11
+  8014d4:	00 00 00 
+  8014d7:	4d 01 da             	add    %r11,%r10
+  8014da:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8014e1:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8014e7:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8014ee:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8014f5:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8014fc:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801503:	84 c0                	test   %al,%al
+  801505:	74 20                	je     801527 <snprintf+0x6c>
+  801507:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80150b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80150f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801513:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801517:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80151b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80151f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801523:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801527:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80152e:	00 00 00 
+  801531:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801538:	00 00 00 
+  80153b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80153f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801546:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80154d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801554:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80155b:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801562:	48 8b 06             	mov    (%rsi),%rax
+  801565:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801569:	48 89 01             	mov    %rax,(%rcx)
+  80156c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801570:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801574:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801578:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80157f:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801586:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  80158c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801593:	48 89 c7             	mov    %rax,%rdi
+  801596:	48 b8 bf 83 ff ff ff 	movabs $0xffffffffffff83bf,%rax
+  80159d:	ff ff ff 
+  8015a0:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8015a4:	ff d0                	call   *%rax
+  8015a6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8015ac:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8015b2:	c9                   	leave
+  8015b3:	c3                   	ret
+
+00000000008015b4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8015b4:	55                   	push   %rbp
+  8015b5:	48 89 e5             	mov    %rsp,%rbp
+  8015b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8015bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015bc <strlen+0x8>
+  8015c3:	49 bb 84 7a 00 00 00 	movabs $0x7a84,%r11
+  8015ca:	00 00 00 
+  8015cd:	4c 01 d8             	add    %r11,%rax
+  8015d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8015d4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8015db:	eb 09                	jmp    8015e6 <strlen+0x32>
+		n++;
+  8015dd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8015e1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8015e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015ea:	0f b6 00             	movzbl (%rax),%eax
+  8015ed:	84 c0                	test   %al,%al
+  8015ef:	75 ec                	jne    8015dd <strlen+0x29>
+	return n;
+  8015f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8015f4:	c9                   	leave
+  8015f5:	c3                   	ret
+
+00000000008015f6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8015f6:	55                   	push   %rbp
+  8015f7:	48 89 e5             	mov    %rsp,%rbp
+  8015fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8015fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015fe <strnlen+0x8>
+  801605:	49 bb 42 7a 00 00 00 	movabs $0x7a42,%r11
+  80160c:	00 00 00 
+  80160f:	4c 01 d8             	add    %r11,%rax
+  801612:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801616:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80161a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801621:	eb 0e                	jmp    801631 <strnlen+0x3b>
+		n++;
+  801623:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801627:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80162c:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801631:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801636:	74 0b                	je     801643 <strnlen+0x4d>
+  801638:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80163c:	0f b6 00             	movzbl (%rax),%eax
+  80163f:	84 c0                	test   %al,%al
+  801641:	75 e0                	jne    801623 <strnlen+0x2d>
+	return n;
+  801643:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801646:	c9                   	leave
+  801647:	c3                   	ret
+
+0000000000801648 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801648:	55                   	push   %rbp
+  801649:	48 89 e5             	mov    %rsp,%rbp
+  80164c:	48 83 ec 20          	sub    $0x20,%rsp
+  801650:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801650 <strcpy+0x8>
+  801657:	49 bb f0 79 00 00 00 	movabs $0x79f0,%r11
+  80165e:	00 00 00 
+  801661:	4c 01 d8             	add    %r11,%rax
+  801664:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801668:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80166c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801670:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801674:	90                   	nop
+  801675:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801679:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80167d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801681:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801685:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801689:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80168d:	0f b6 12             	movzbl (%rdx),%edx
+  801690:	88 10                	mov    %dl,(%rax)
+  801692:	0f b6 00             	movzbl (%rax),%eax
+  801695:	84 c0                	test   %al,%al
+  801697:	75 dc                	jne    801675 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801699:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80169d:	c9                   	leave
+  80169e:	c3                   	ret
+
+000000000080169f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80169f:	55                   	push   %rbp
+  8016a0:	48 89 e5             	mov    %rsp,%rbp
+  8016a3:	53                   	push   %rbx
+  8016a4:	48 83 ec 20          	sub    $0x20,%rsp
+  8016a8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8016a8 <strcat+0x9>
+  8016af:	49 bb 98 79 00 00 00 	movabs $0x7998,%r11
+  8016b6:	00 00 00 
+  8016b9:	4c 01 db             	add    %r11,%rbx
+  8016bc:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8016c0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8016c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016c8:	48 89 c7             	mov    %rax,%rdi
+  8016cb:	48 b8 74 85 ff ff ff 	movabs $0xffffffffffff8574,%rax
+  8016d2:	ff ff ff 
+  8016d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8016d9:	ff d0                	call   *%rax
+  8016db:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8016de:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016e1:	48 63 d0             	movslq %eax,%rdx
+  8016e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016e8:	48 01 c2             	add    %rax,%rdx
+  8016eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016ef:	48 89 c6             	mov    %rax,%rsi
+  8016f2:	48 89 d7             	mov    %rdx,%rdi
+  8016f5:	48 b8 08 86 ff ff ff 	movabs $0xffffffffffff8608,%rax
+  8016fc:	ff ff ff 
+  8016ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801703:	ff d0                	call   *%rax
+	return dst;
+  801705:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801709:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80170d:	c9                   	leave
+  80170e:	c3                   	ret
+
+000000000080170f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+  801713:	48 83 ec 28          	sub    $0x28,%rsp
+  801717:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801717 <strncpy+0x8>
+  80171e:	49 bb 29 79 00 00 00 	movabs $0x7929,%r11
+  801725:	00 00 00 
+  801728:	4c 01 d8             	add    %r11,%rax
+  80172b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80172f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801733:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801737:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80173b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80173f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801746:	00 
+  801747:	eb 2a                	jmp    801773 <strncpy+0x64>
+		*dst++ = *src;
+  801749:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80174d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801751:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801755:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801759:	0f b6 12             	movzbl (%rdx),%edx
+  80175c:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80175e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801762:	0f b6 00             	movzbl (%rax),%eax
+  801765:	84 c0                	test   %al,%al
+  801767:	74 05                	je     80176e <strncpy+0x5f>
+			src++;
+  801769:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80176e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801777:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80177b:	72 cc                	jb     801749 <strncpy+0x3a>
+	}
+	return ret;
+  80177d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801781:	c9                   	leave
+  801782:	c3                   	ret
+
+0000000000801783 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801783:	55                   	push   %rbp
+  801784:	48 89 e5             	mov    %rsp,%rbp
+  801787:	48 83 ec 28          	sub    $0x28,%rsp
+  80178b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80178b <strlcpy+0x8>
+  801792:	49 bb b5 78 00 00 00 	movabs $0x78b5,%r11
+  801799:	00 00 00 
+  80179c:	4c 01 d8             	add    %r11,%rax
+  80179f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017a7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8017ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017af:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8017b3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017b8:	74 3d                	je     8017f7 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8017ba:	eb 1d                	jmp    8017d9 <strlcpy+0x56>
+			*dst++ = *src++;
+  8017bc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8017c0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8017c4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8017c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017cc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8017d0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017d4:	0f b6 12             	movzbl (%rdx),%edx
+  8017d7:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8017d9:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8017de:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017e3:	74 0b                	je     8017f0 <strlcpy+0x6d>
+  8017e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017e9:	0f b6 00             	movzbl (%rax),%eax
+  8017ec:	84 c0                	test   %al,%al
+  8017ee:	75 cc                	jne    8017bc <strlcpy+0x39>
+		*dst = '\0';
+  8017f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f4:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8017f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017fb:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8017ff:	c9                   	leave
+  801800:	c3                   	ret
+
+0000000000801801 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801801:	55                   	push   %rbp
+  801802:	48 89 e5             	mov    %rsp,%rbp
+  801805:	48 83 ec 10          	sub    $0x10,%rsp
+  801809:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801809 <strcmp+0x8>
+  801810:	49 bb 37 78 00 00 00 	movabs $0x7837,%r11
+  801817:	00 00 00 
+  80181a:	4c 01 d8             	add    %r11,%rax
+  80181d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801821:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801825:	eb 0a                	jmp    801831 <strcmp+0x30>
+		p++, q++;
+  801827:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80182c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801831:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801835:	0f b6 00             	movzbl (%rax),%eax
+  801838:	84 c0                	test   %al,%al
+  80183a:	74 12                	je     80184e <strcmp+0x4d>
+  80183c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801840:	0f b6 10             	movzbl (%rax),%edx
+  801843:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801847:	0f b6 00             	movzbl (%rax),%eax
+  80184a:	38 c2                	cmp    %al,%dl
+  80184c:	74 d9                	je     801827 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80184e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801852:	0f b6 00             	movzbl (%rax),%eax
+  801855:	0f b6 d0             	movzbl %al,%edx
+  801858:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80185c:	0f b6 00             	movzbl (%rax),%eax
+  80185f:	0f b6 c0             	movzbl %al,%eax
+  801862:	29 c2                	sub    %eax,%edx
+  801864:	89 d0                	mov    %edx,%eax
+}
+  801866:	c9                   	leave
+  801867:	c3                   	ret
+
+0000000000801868 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801868:	55                   	push   %rbp
+  801869:	48 89 e5             	mov    %rsp,%rbp
+  80186c:	48 83 ec 18          	sub    $0x18,%rsp
+  801870:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801870 <strncmp+0x8>
+  801877:	49 bb d0 77 00 00 00 	movabs $0x77d0,%r11
+  80187e:	00 00 00 
+  801881:	4c 01 d8             	add    %r11,%rax
+  801884:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801888:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80188c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801890:	eb 0f                	jmp    8018a1 <strncmp+0x39>
+		n--, p++, q++;
+  801892:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801897:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80189c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8018a1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018a6:	74 1d                	je     8018c5 <strncmp+0x5d>
+  8018a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018ac:	0f b6 00             	movzbl (%rax),%eax
+  8018af:	84 c0                	test   %al,%al
+  8018b1:	74 12                	je     8018c5 <strncmp+0x5d>
+  8018b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018b7:	0f b6 10             	movzbl (%rax),%edx
+  8018ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018be:	0f b6 00             	movzbl (%rax),%eax
+  8018c1:	38 c2                	cmp    %al,%dl
+  8018c3:	74 cd                	je     801892 <strncmp+0x2a>
+	if (n == 0)
+  8018c5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018ca:	75 07                	jne    8018d3 <strncmp+0x6b>
+		return 0;
+  8018cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d1:	eb 16                	jmp    8018e9 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8018d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018d7:	0f b6 00             	movzbl (%rax),%eax
+  8018da:	0f b6 d0             	movzbl %al,%edx
+  8018dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018e1:	0f b6 00             	movzbl (%rax),%eax
+  8018e4:	0f b6 c0             	movzbl %al,%eax
+  8018e7:	29 c2                	sub    %eax,%edx
+}
+  8018e9:	89 d0                	mov    %edx,%eax
+  8018eb:	c9                   	leave
+  8018ec:	c3                   	ret
+
+00000000008018ed <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8018ed:	55                   	push   %rbp
+  8018ee:	48 89 e5             	mov    %rsp,%rbp
+  8018f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8018f5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018f5 <strchr+0x8>
+  8018fc:	49 bb 4b 77 00 00 00 	movabs $0x774b,%r11
+  801903:	00 00 00 
+  801906:	4c 01 d8             	add    %r11,%rax
+  801909:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80190d:	89 f0                	mov    %esi,%eax
+  80190f:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801912:	eb 17                	jmp    80192b <strchr+0x3e>
+		if (*s == c)
+  801914:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801918:	0f b6 00             	movzbl (%rax),%eax
+  80191b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80191e:	75 06                	jne    801926 <strchr+0x39>
+			return (char *) s;
+  801920:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801924:	eb 15                	jmp    80193b <strchr+0x4e>
+	for (; *s; s++)
+  801926:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80192b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80192f:	0f b6 00             	movzbl (%rax),%eax
+  801932:	84 c0                	test   %al,%al
+  801934:	75 de                	jne    801914 <strchr+0x27>
+	return 0;
+  801936:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80193b:	c9                   	leave
+  80193c:	c3                   	ret
+
+000000000080193d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80193d:	55                   	push   %rbp
+  80193e:	48 89 e5             	mov    %rsp,%rbp
+  801941:	48 83 ec 10          	sub    $0x10,%rsp
+  801945:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801945 <strfind+0x8>
+  80194c:	49 bb fb 76 00 00 00 	movabs $0x76fb,%r11
+  801953:	00 00 00 
+  801956:	4c 01 d8             	add    %r11,%rax
+  801959:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80195d:	89 f0                	mov    %esi,%eax
+  80195f:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801962:	eb 11                	jmp    801975 <strfind+0x38>
+		if (*s == c)
+  801964:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801968:	0f b6 00             	movzbl (%rax),%eax
+  80196b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80196e:	74 12                	je     801982 <strfind+0x45>
+	for (; *s; s++)
+  801970:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801975:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801979:	0f b6 00             	movzbl (%rax),%eax
+  80197c:	84 c0                	test   %al,%al
+  80197e:	75 e4                	jne    801964 <strfind+0x27>
+  801980:	eb 01                	jmp    801983 <strfind+0x46>
+			break;
+  801982:	90                   	nop
+	return (char *) s;
+  801983:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801987:	c9                   	leave
+  801988:	c3                   	ret
+
+0000000000801989 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801989:	55                   	push   %rbp
+  80198a:	48 89 e5             	mov    %rsp,%rbp
+  80198d:	48 83 ec 18          	sub    $0x18,%rsp
+  801991:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801991 <memset+0x8>
+  801998:	49 bb af 76 00 00 00 	movabs $0x76af,%r11
+  80199f:	00 00 00 
+  8019a2:	4c 01 d8             	add    %r11,%rax
+  8019a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019a9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8019ac:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  8019b0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8019b5:	75 06                	jne    8019bd <memset+0x34>
+		return v;
+  8019b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019bb:	eb 69                	jmp    801a26 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8019bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019c1:	83 e0 03             	and    $0x3,%eax
+  8019c4:	48 85 c0             	test   %rax,%rax
+  8019c7:	75 48                	jne    801a11 <memset+0x88>
+  8019c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019cd:	83 e0 03             	and    $0x3,%eax
+  8019d0:	48 85 c0             	test   %rax,%rax
+  8019d3:	75 3c                	jne    801a11 <memset+0x88>
+		c &= 0xFF;
+  8019d5:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8019dc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019df:	c1 e0 18             	shl    $0x18,%eax
+  8019e2:	89 c2                	mov    %eax,%edx
+  8019e4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019e7:	c1 e0 10             	shl    $0x10,%eax
+  8019ea:	09 c2                	or     %eax,%edx
+  8019ec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019ef:	c1 e0 08             	shl    $0x8,%eax
+  8019f2:	09 d0                	or     %edx,%eax
+  8019f4:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8019f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019fb:	48 c1 e8 02          	shr    $0x2,%rax
+  8019ff:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801a02:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a06:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a09:	48 89 d7             	mov    %rdx,%rdi
+  801a0c:	fc                   	cld
+  801a0d:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801a0f:	eb 11                	jmp    801a22 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801a11:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a15:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a18:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801a1c:	48 89 d7             	mov    %rdx,%rdi
+  801a1f:	fc                   	cld
+  801a20:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801a22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a26:	c9                   	leave
+  801a27:	c3                   	ret
+
+0000000000801a28 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801a28:	55                   	push   %rbp
+  801a29:	48 89 e5             	mov    %rsp,%rbp
+  801a2c:	48 83 ec 28          	sub    $0x28,%rsp
+  801a30:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a30 <memmove+0x8>
+  801a37:	49 bb 10 76 00 00 00 	movabs $0x7610,%r11
+  801a3e:	00 00 00 
+  801a41:	4c 01 d8             	add    %r11,%rax
+  801a44:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a48:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a4c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801a50:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a54:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801a58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a5c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801a60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a64:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801a68:	0f 83 88 00 00 00    	jae    801af6 <memmove+0xce>
+  801a6e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a76:	48 01 d0             	add    %rdx,%rax
+  801a79:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801a7d:	73 77                	jae    801af6 <memmove+0xce>
+		s += n;
+  801a7f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a83:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801a87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a8b:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801a8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a93:	83 e0 03             	and    $0x3,%eax
+  801a96:	48 85 c0             	test   %rax,%rax
+  801a99:	75 3b                	jne    801ad6 <memmove+0xae>
+  801a9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a9f:	83 e0 03             	and    $0x3,%eax
+  801aa2:	48 85 c0             	test   %rax,%rax
+  801aa5:	75 2f                	jne    801ad6 <memmove+0xae>
+  801aa7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aab:	83 e0 03             	and    $0x3,%eax
+  801aae:	48 85 c0             	test   %rax,%rax
+  801ab1:	75 23                	jne    801ad6 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801ab3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ab7:	48 83 e8 04          	sub    $0x4,%rax
+  801abb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801abf:	48 83 ea 04          	sub    $0x4,%rdx
+  801ac3:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801ac7:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801acb:	48 89 c7             	mov    %rax,%rdi
+  801ace:	48 89 d6             	mov    %rdx,%rsi
+  801ad1:	fd                   	std
+  801ad2:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801ad4:	eb 1d                	jmp    801af3 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801ad6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ada:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ade:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ae2:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801ae6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aea:	48 89 d7             	mov    %rdx,%rdi
+  801aed:	48 89 c1             	mov    %rax,%rcx
+  801af0:	fd                   	std
+  801af1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801af3:	fc                   	cld
+  801af4:	eb 57                	jmp    801b4d <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801af6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801afa:	83 e0 03             	and    $0x3,%eax
+  801afd:	48 85 c0             	test   %rax,%rax
+  801b00:	75 36                	jne    801b38 <memmove+0x110>
+  801b02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b06:	83 e0 03             	and    $0x3,%eax
+  801b09:	48 85 c0             	test   %rax,%rax
+  801b0c:	75 2a                	jne    801b38 <memmove+0x110>
+  801b0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b12:	83 e0 03             	and    $0x3,%eax
+  801b15:	48 85 c0             	test   %rax,%rax
+  801b18:	75 1e                	jne    801b38 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801b1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b1e:	48 c1 e8 02          	shr    $0x2,%rax
+  801b22:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801b25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b29:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b2d:	48 89 c7             	mov    %rax,%rdi
+  801b30:	48 89 d6             	mov    %rdx,%rsi
+  801b33:	fc                   	cld
+  801b34:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801b36:	eb 15                	jmp    801b4d <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801b38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b3c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b40:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801b44:	48 89 c7             	mov    %rax,%rdi
+  801b47:	48 89 d6             	mov    %rdx,%rsi
+  801b4a:	fc                   	cld
+  801b4b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801b4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b51:	c9                   	leave
+  801b52:	c3                   	ret
+
+0000000000801b53 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801b53:	55                   	push   %rbp
+  801b54:	48 89 e5             	mov    %rsp,%rbp
+  801b57:	48 83 ec 18          	sub    $0x18,%rsp
+  801b5b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b5b <memcpy+0x8>
+  801b62:	49 bb e5 74 00 00 00 	movabs $0x74e5,%r11
+  801b69:	00 00 00 
+  801b6c:	4c 01 d8             	add    %r11,%rax
+  801b6f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b73:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801b77:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801b7b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b7f:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801b83:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b87:	48 89 cf             	mov    %rcx,%rdi
+  801b8a:	48 b9 e8 89 ff ff ff 	movabs $0xffffffffffff89e8,%rcx
+  801b91:	ff ff ff 
+  801b94:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801b98:	ff d0                	call   *%rax
+}
+  801b9a:	c9                   	leave
+  801b9b:	c3                   	ret
+
+0000000000801b9c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801b9c:	55                   	push   %rbp
+  801b9d:	48 89 e5             	mov    %rsp,%rbp
+  801ba0:	48 83 ec 28          	sub    $0x28,%rsp
+  801ba4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ba4 <memcmp+0x8>
+  801bab:	49 bb 9c 74 00 00 00 	movabs $0x749c,%r11
+  801bb2:	00 00 00 
+  801bb5:	4c 01 d8             	add    %r11,%rax
+  801bb8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801bbc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801bc0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801bc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bc8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801bcc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bd0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801bd4:	eb 34                	jmp    801c0a <memcmp+0x6e>
+		if (*s1 != *s2)
+  801bd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bda:	0f b6 10             	movzbl (%rax),%edx
+  801bdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801be1:	0f b6 00             	movzbl (%rax),%eax
+  801be4:	38 c2                	cmp    %al,%dl
+  801be6:	74 18                	je     801c00 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801be8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bec:	0f b6 00             	movzbl (%rax),%eax
+  801bef:	0f b6 d0             	movzbl %al,%edx
+  801bf2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bf6:	0f b6 00             	movzbl (%rax),%eax
+  801bf9:	0f b6 c0             	movzbl %al,%eax
+  801bfc:	29 c2                	sub    %eax,%edx
+  801bfe:	eb 20                	jmp    801c20 <memcmp+0x84>
+		s1++, s2++;
+  801c00:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c05:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801c0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c0e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c12:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801c16:	48 85 c0             	test   %rax,%rax
+  801c19:	75 bb                	jne    801bd6 <memcmp+0x3a>
+	}
+
+	return 0;
+  801c1b:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801c20:	89 d0                	mov    %edx,%eax
+  801c22:	c9                   	leave
+  801c23:	c3                   	ret
+
+0000000000801c24 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801c24:	55                   	push   %rbp
+  801c25:	48 89 e5             	mov    %rsp,%rbp
+  801c28:	48 83 ec 28          	sub    $0x28,%rsp
+  801c2c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c2c <memfind+0x8>
+  801c33:	49 bb 14 74 00 00 00 	movabs $0x7414,%r11
+  801c3a:	00 00 00 
+  801c3d:	4c 01 d8             	add    %r11,%rax
+  801c40:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c44:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801c47:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801c4b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c53:	48 01 d0             	add    %rdx,%rax
+  801c56:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801c5a:	eb 13                	jmp    801c6f <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801c5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c60:	0f b6 00             	movzbl (%rax),%eax
+  801c63:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801c66:	38 d0                	cmp    %dl,%al
+  801c68:	74 11                	je     801c7b <memfind+0x57>
+	for (; s < ends; s++)
+  801c6a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801c6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c73:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801c77:	72 e3                	jb     801c5c <memfind+0x38>
+  801c79:	eb 01                	jmp    801c7c <memfind+0x58>
+			break;
+  801c7b:	90                   	nop
+	return (void *) s;
+  801c7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c80:	c9                   	leave
+  801c81:	c3                   	ret
+
+0000000000801c82 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801c82:	55                   	push   %rbp
+  801c83:	48 89 e5             	mov    %rsp,%rbp
+  801c86:	48 83 ec 38          	sub    $0x38,%rsp
+  801c8a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c8a <strtol+0x8>
+  801c91:	49 bb b6 73 00 00 00 	movabs $0x73b6,%r11
+  801c98:	00 00 00 
+  801c9b:	4c 01 d8             	add    %r11,%rax
+  801c9e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ca2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801ca6:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801ca9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801cb0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801cb7:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801cb8:	eb 05                	jmp    801cbf <strtol+0x3d>
+		s++;
+  801cba:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801cbf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc3:	0f b6 00             	movzbl (%rax),%eax
+  801cc6:	3c 20                	cmp    $0x20,%al
+  801cc8:	74 f0                	je     801cba <strtol+0x38>
+  801cca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cce:	0f b6 00             	movzbl (%rax),%eax
+  801cd1:	3c 09                	cmp    $0x9,%al
+  801cd3:	74 e5                	je     801cba <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801cd5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cd9:	0f b6 00             	movzbl (%rax),%eax
+  801cdc:	3c 2b                	cmp    $0x2b,%al
+  801cde:	75 07                	jne    801ce7 <strtol+0x65>
+		s++;
+  801ce0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ce5:	eb 17                	jmp    801cfe <strtol+0x7c>
+	else if (*s == '-')
+  801ce7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ceb:	0f b6 00             	movzbl (%rax),%eax
+  801cee:	3c 2d                	cmp    $0x2d,%al
+  801cf0:	75 0c                	jne    801cfe <strtol+0x7c>
+		s++, neg = 1;
+  801cf2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cf7:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801cfe:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d02:	74 06                	je     801d0a <strtol+0x88>
+  801d04:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801d08:	75 28                	jne    801d32 <strtol+0xb0>
+  801d0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d0e:	0f b6 00             	movzbl (%rax),%eax
+  801d11:	3c 30                	cmp    $0x30,%al
+  801d13:	75 1d                	jne    801d32 <strtol+0xb0>
+  801d15:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d19:	48 83 c0 01          	add    $0x1,%rax
+  801d1d:	0f b6 00             	movzbl (%rax),%eax
+  801d20:	3c 78                	cmp    $0x78,%al
+  801d22:	75 0e                	jne    801d32 <strtol+0xb0>
+		s += 2, base = 16;
+  801d24:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801d29:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801d30:	eb 2c                	jmp    801d5e <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801d32:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d36:	75 19                	jne    801d51 <strtol+0xcf>
+  801d38:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d3c:	0f b6 00             	movzbl (%rax),%eax
+  801d3f:	3c 30                	cmp    $0x30,%al
+  801d41:	75 0e                	jne    801d51 <strtol+0xcf>
+		s++, base = 8;
+  801d43:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d48:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801d4f:	eb 0d                	jmp    801d5e <strtol+0xdc>
+	else if (base == 0)
+  801d51:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d55:	75 07                	jne    801d5e <strtol+0xdc>
+		base = 10;
+  801d57:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801d5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d62:	0f b6 00             	movzbl (%rax),%eax
+  801d65:	3c 2f                	cmp    $0x2f,%al
+  801d67:	7e 1d                	jle    801d86 <strtol+0x104>
+  801d69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d6d:	0f b6 00             	movzbl (%rax),%eax
+  801d70:	3c 39                	cmp    $0x39,%al
+  801d72:	7f 12                	jg     801d86 <strtol+0x104>
+			dig = *s - '0';
+  801d74:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d78:	0f b6 00             	movzbl (%rax),%eax
+  801d7b:	0f be c0             	movsbl %al,%eax
+  801d7e:	83 e8 30             	sub    $0x30,%eax
+  801d81:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d84:	eb 4e                	jmp    801dd4 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801d86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d8a:	0f b6 00             	movzbl (%rax),%eax
+  801d8d:	3c 60                	cmp    $0x60,%al
+  801d8f:	7e 1d                	jle    801dae <strtol+0x12c>
+  801d91:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d95:	0f b6 00             	movzbl (%rax),%eax
+  801d98:	3c 7a                	cmp    $0x7a,%al
+  801d9a:	7f 12                	jg     801dae <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801d9c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801da0:	0f b6 00             	movzbl (%rax),%eax
+  801da3:	0f be c0             	movsbl %al,%eax
+  801da6:	83 e8 57             	sub    $0x57,%eax
+  801da9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801dac:	eb 26                	jmp    801dd4 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801dae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801db2:	0f b6 00             	movzbl (%rax),%eax
+  801db5:	3c 40                	cmp    $0x40,%al
+  801db7:	7e 47                	jle    801e00 <strtol+0x17e>
+  801db9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dbd:	0f b6 00             	movzbl (%rax),%eax
+  801dc0:	3c 5a                	cmp    $0x5a,%al
+  801dc2:	7f 3c                	jg     801e00 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801dc4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dc8:	0f b6 00             	movzbl (%rax),%eax
+  801dcb:	0f be c0             	movsbl %al,%eax
+  801dce:	83 e8 37             	sub    $0x37,%eax
+  801dd1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801dd4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801dd7:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801dda:	7d 23                	jge    801dff <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801ddc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801de1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801de4:	48 98                	cltq
+  801de6:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801deb:	48 89 c2             	mov    %rax,%rdx
+  801dee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801df1:	48 98                	cltq
+  801df3:	48 01 d0             	add    %rdx,%rax
+  801df6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801dfa:	e9 5f ff ff ff       	jmp    801d5e <strtol+0xdc>
+			break;
+  801dff:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801e00:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801e05:	74 0b                	je     801e12 <strtol+0x190>
+		*endptr = (char *) s;
+  801e07:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e0b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801e0f:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801e12:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801e16:	74 09                	je     801e21 <strtol+0x19f>
+  801e18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e1c:	48 f7 d8             	neg    %rax
+  801e1f:	eb 04                	jmp    801e25 <strtol+0x1a3>
+  801e21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801e25:	c9                   	leave
+  801e26:	c3                   	ret
+
+0000000000801e27 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801e27:	55                   	push   %rbp
+  801e28:	48 89 e5             	mov    %rsp,%rbp
+  801e2b:	53                   	push   %rbx
+  801e2c:	48 83 ec 30          	sub    $0x30,%rsp
+  801e30:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801e30 <strstr+0x9>
+  801e37:	49 bb 10 72 00 00 00 	movabs $0x7210,%r11
+  801e3e:	00 00 00 
+  801e41:	4c 01 db             	add    %r11,%rbx
+  801e44:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801e48:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801e4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e50:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e54:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e58:	0f b6 00             	movzbl (%rax),%eax
+  801e5b:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801e5e:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801e62:	75 06                	jne    801e6a <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801e64:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e68:	eb 73                	jmp    801edd <strstr+0xb6>
+
+	len = strlen(str);
+  801e6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e6e:	48 89 c7             	mov    %rax,%rdi
+  801e71:	48 b8 74 85 ff ff ff 	movabs $0xffffffffffff8574,%rax
+  801e78:	ff ff ff 
+  801e7b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e7f:	ff d0                	call   *%rax
+  801e81:	48 98                	cltq
+  801e83:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801e87:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e8b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e8f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801e93:	0f b6 00             	movzbl (%rax),%eax
+  801e96:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801e99:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801e9d:	75 07                	jne    801ea6 <strstr+0x7f>
+				return (char *) 0;
+  801e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea4:	eb 37                	jmp    801edd <strstr+0xb6>
+		} while (sc != c);
+  801ea6:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801eaa:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801ead:	75 d8                	jne    801e87 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801eaf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801eb3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801eb7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ebb:	48 89 ce             	mov    %rcx,%rsi
+  801ebe:	48 89 c7             	mov    %rax,%rdi
+  801ec1:	48 b8 28 88 ff ff ff 	movabs $0xffffffffffff8828,%rax
+  801ec8:	ff ff ff 
+  801ecb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801ecf:	ff d0                	call   *%rax
+  801ed1:	85 c0                	test   %eax,%eax
+  801ed3:	75 b2                	jne    801e87 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801ed5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ed9:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801edd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ee1:	c9                   	leave
+  801ee2:	c3                   	ret
+
+0000000000801ee3 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801ee3:	55                   	push   %rbp
+  801ee4:	48 89 e5             	mov    %rsp,%rbp
+  801ee7:	41 57                	push   %r15
+  801ee9:	53                   	push   %rbx
+  801eea:	48 83 ec 40          	sub    $0x40,%rsp
+  801eee:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801eee <syscall+0xb>
+  801ef5:	49 bb 52 71 00 00 00 	movabs $0x7152,%r11
+  801efc:	00 00 00 
+  801eff:	4d 01 da             	add    %r11,%r10
+  801f02:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801f05:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801f08:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801f0c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801f10:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801f14:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801f18:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f1b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801f1f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801f23:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801f27:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801f2b:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f2f:	4c 89 c3             	mov    %r8,%rbx
+  801f32:	cd 30                	int    $0x30
+  801f34:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801f38:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801f3c:	74 52                	je     801f90 <syscall+0xad>
+  801f3e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f43:	7e 4b                	jle    801f90 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f45:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f49:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f4c:	49 89 d0             	mov    %rdx,%r8
+  801f4f:	89 c1                	mov    %eax,%ecx
+  801f51:	48 b8 40 e4 ff ff ff 	movabs $0xffffffffffffe440,%rax
+  801f58:	ff ff ff 
+  801f5b:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801f5f:	48 89 c2             	mov    %rax,%rdx
+  801f62:	be 23 00 00 00       	mov    $0x23,%esi
+  801f67:	48 b8 5d e4 ff ff ff 	movabs $0xffffffffffffe45d,%rax
+  801f6e:	ff ff ff 
+  801f71:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801f75:	48 89 c7             	mov    %rax,%rdi
+  801f78:	4d 89 d7             	mov    %r10,%r15
+  801f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f80:	49 b9 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%r9
+  801f87:	ff ff ff 
+  801f8a:	4d 01 d1             	add    %r10,%r9
+  801f8d:	41 ff d1             	call   *%r9
+
+	return ret;
+  801f90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801f94:	48 83 c4 40          	add    $0x40,%rsp
+  801f98:	5b                   	pop    %rbx
+  801f99:	41 5f                	pop    %r15
+  801f9b:	5d                   	pop    %rbp
+  801f9c:	c3                   	ret
+
+0000000000801f9d <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801f9d:	55                   	push   %rbp
+  801f9e:	48 89 e5             	mov    %rsp,%rbp
+  801fa1:	41 57                	push   %r15
+  801fa3:	41 56                	push   %r14
+  801fa5:	41 55                	push   %r13
+  801fa7:	41 54                	push   %r12
+  801fa9:	53                   	push   %rbx
+  801faa:	48 83 ec 48          	sub    $0x48,%rsp
+  801fae:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801fae <syscall_words+0x11>
+  801fb5:	49 bb 92 70 00 00 00 	movabs $0x7092,%r11
+  801fbc:	00 00 00 
+  801fbf:	4d 01 de             	add    %r11,%r14
+  801fc2:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801fc5:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801fc8:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801fcc:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801fd0:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801fd4:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801fd8:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fdd:	74 09                	je     801fe8 <syscall_words+0x4b>
+  801fdf:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fe3:	48 8b 00             	mov    (%rax),%rax
+  801fe6:	eb 05                	jmp    801fed <syscall_words+0x50>
+  801fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fed:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801ff0:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ff5:	74 0a                	je     802001 <syscall_words+0x64>
+  801ff7:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ffb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fff:	eb 05                	jmp    802006 <syscall_words+0x69>
+  802001:	b8 00 00 00 00       	mov    $0x0,%eax
+  802006:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  802009:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80200e:	74 0a                	je     80201a <syscall_words+0x7d>
+  802010:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802014:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802018:	eb 05                	jmp    80201f <syscall_words+0x82>
+  80201a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201f:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  802022:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802027:	74 0a                	je     802033 <syscall_words+0x96>
+  802029:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80202d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802031:	eb 05                	jmp    802038 <syscall_words+0x9b>
+  802033:	b8 00 00 00 00       	mov    $0x0,%eax
+  802038:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  80203b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802040:	74 0a                	je     80204c <syscall_words+0xaf>
+  802042:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802046:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80204a:	eb 05                	jmp    802051 <syscall_words+0xb4>
+  80204c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802051:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  802054:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802059:	74 0a                	je     802065 <syscall_words+0xc8>
+  80205b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80205f:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802063:	eb 05                	jmp    80206a <syscall_words+0xcd>
+  802065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80206a:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  80206d:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802070:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802074:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802078:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  80207c:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  802080:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802084:	cd 30                	int    $0x30
+  802086:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  80208a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80208f:	74 50                	je     8020e1 <syscall_words+0x144>
+		words[0] = r8;
+  802091:	4c 89 c2             	mov    %r8,%rdx
+  802094:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802098:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  80209b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80209f:	48 83 c0 08          	add    $0x8,%rax
+  8020a3:	4c 89 ca             	mov    %r9,%rdx
+  8020a6:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  8020a9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020ad:	48 83 c0 10          	add    $0x10,%rax
+  8020b1:	4c 89 d2             	mov    %r10,%rdx
+  8020b4:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  8020b7:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020bb:	48 83 c0 18          	add    $0x18,%rax
+  8020bf:	4c 89 da             	mov    %r11,%rdx
+  8020c2:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  8020c5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020c9:	48 83 c0 20          	add    $0x20,%rax
+  8020cd:	4c 89 e2             	mov    %r12,%rdx
+  8020d0:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  8020d3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020d7:	48 83 c0 28          	add    $0x28,%rax
+  8020db:	4c 89 ea             	mov    %r13,%rdx
+  8020de:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  8020e1:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8020e5:	74 52                	je     802139 <syscall_words+0x19c>
+  8020e7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8020ec:	7e 4b                	jle    802139 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020ee:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8020f2:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8020f5:	49 89 d0             	mov    %rdx,%r8
+  8020f8:	89 c1                	mov    %eax,%ecx
+  8020fa:	48 b8 40 e4 ff ff ff 	movabs $0xffffffffffffe440,%rax
+  802101:	ff ff ff 
+  802104:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802108:	48 89 c2             	mov    %rax,%rdx
+  80210b:	be 4e 00 00 00       	mov    $0x4e,%esi
+  802110:	48 b8 5d e4 ff ff ff 	movabs $0xffffffffffffe45d,%rax
+  802117:	ff ff ff 
+  80211a:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  80211e:	48 89 c7             	mov    %rax,%rdi
+  802121:	4d 89 f7             	mov    %r14,%r15
+  802124:	b8 00 00 00 00       	mov    $0x0,%eax
+  802129:	49 b9 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%r9
+  802130:	ff ff ff 
+  802133:	4d 01 f1             	add    %r14,%r9
+  802136:	41 ff d1             	call   *%r9
+
+	return ret;
+  802139:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80213d:	48 83 c4 48          	add    $0x48,%rsp
+  802141:	5b                   	pop    %rbx
+  802142:	41 5c                	pop    %r12
+  802144:	41 5d                	pop    %r13
+  802146:	41 5e                	pop    %r14
+  802148:	41 5f                	pop    %r15
+  80214a:	5d                   	pop    %rbp
+  80214b:	c3                   	ret
+
+000000000080214c <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80214c:	55                   	push   %rbp
+  80214d:	48 89 e5             	mov    %rsp,%rbp
+  802150:	48 83 ec 10          	sub    $0x10,%rsp
+  802154:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802154 <sys_cputs+0x8>
+  80215b:	49 bb ec 6e 00 00 00 	movabs $0x6eec,%r11
+  802162:	00 00 00 
+  802165:	4c 01 d8             	add    %r11,%rax
+  802168:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80216c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802170:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802174:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802178:	48 83 ec 08          	sub    $0x8,%rsp
+  80217c:	6a 00                	push   $0x0
+  80217e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802184:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80218a:	be 00 00 00 00       	mov    $0x0,%esi
+  80218f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802194:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  80219b:	ff ff ff 
+  80219e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021a2:	ff d0                	call   *%rax
+  8021a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021a8:	90                   	nop
+  8021a9:	c9                   	leave
+  8021aa:	c3                   	ret
+
+00000000008021ab <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8021ab:	55                   	push   %rbp
+  8021ac:	48 89 e5             	mov    %rsp,%rbp
+  8021af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021af <sys_cgetc+0x4>
+  8021b6:	49 bb 91 6e 00 00 00 	movabs $0x6e91,%r11
+  8021bd:	00 00 00 
+  8021c0:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8021c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c7:	6a 00                	push   $0x0
+  8021c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021df:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021e9:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  8021f0:	ff ff ff 
+  8021f3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021f7:	ff d0                	call   *%rax
+  8021f9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021fd:	c9                   	leave
+  8021fe:	c3                   	ret
+
+00000000008021ff <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8021ff:	55                   	push   %rbp
+  802200:	48 89 e5             	mov    %rsp,%rbp
+  802203:	48 83 ec 10          	sub    $0x10,%rsp
+  802207:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802207 <sys_env_destroy+0x8>
+  80220e:	49 bb 39 6e 00 00 00 	movabs $0x6e39,%r11
+  802215:	00 00 00 
+  802218:	4c 01 d8             	add    %r11,%rax
+  80221b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80221e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802221:	48 63 d2             	movslq %edx,%rdx
+  802224:	48 83 ec 08          	sub    $0x8,%rsp
+  802228:	6a 00                	push   $0x0
+  80222a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802230:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802236:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80223b:	be 01 00 00 00       	mov    $0x1,%esi
+  802240:	bf 03 00 00 00       	mov    $0x3,%edi
+  802245:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  80224c:	ff ff ff 
+  80224f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802253:	ff d0                	call   *%rax
+  802255:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802259:	c9                   	leave
+  80225a:	c3                   	ret
+
+000000000080225b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80225b:	55                   	push   %rbp
+  80225c:	48 89 e5             	mov    %rsp,%rbp
+  80225f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80225f <sys_getenvid+0x4>
+  802266:	49 bb e1 6d 00 00 00 	movabs $0x6de1,%r11
+  80226d:	00 00 00 
+  802270:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802273:	48 83 ec 08          	sub    $0x8,%rsp
+  802277:	6a 00                	push   $0x0
+  802279:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80227f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802285:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80228a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228f:	be 00 00 00 00       	mov    $0x0,%esi
+  802294:	bf 02 00 00 00       	mov    $0x2,%edi
+  802299:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  8022a0:	ff ff ff 
+  8022a3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022a7:	ff d0                	call   *%rax
+  8022a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ad:	c9                   	leave
+  8022ae:	c3                   	ret
+
+00000000008022af <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8022af:	55                   	push   %rbp
+  8022b0:	48 89 e5             	mov    %rsp,%rbp
+  8022b3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022b3 <sys_yield+0x4>
+  8022ba:	49 bb 8d 6d 00 00 00 	movabs $0x6d8d,%r11
+  8022c1:	00 00 00 
+  8022c4:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8022c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8022cb:	6a 00                	push   $0x0
+  8022cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8022ed:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  8022f4:	ff ff ff 
+  8022f7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022fb:	ff d0                	call   *%rax
+  8022fd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802301:	90                   	nop
+  802302:	c9                   	leave
+  802303:	c3                   	ret
+
+0000000000802304 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802304:	55                   	push   %rbp
+  802305:	48 89 e5             	mov    %rsp,%rbp
+  802308:	48 83 ec 10          	sub    $0x10,%rsp
+  80230c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80230c <sys_page_alloc+0x8>
+  802313:	49 bb 34 6d 00 00 00 	movabs $0x6d34,%r11
+  80231a:	00 00 00 
+  80231d:	4c 01 d8             	add    %r11,%rax
+  802320:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802323:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802327:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80232a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80232d:	48 63 f2             	movslq %edx,%rsi
+  802330:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802334:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802337:	48 63 d2             	movslq %edx,%rdx
+  80233a:	48 83 ec 08          	sub    $0x8,%rsp
+  80233e:	6a 00                	push   $0x0
+  802340:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802346:	49 89 f0             	mov    %rsi,%r8
+  802349:	be 01 00 00 00       	mov    $0x1,%esi
+  80234e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802353:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  80235a:	ff ff ff 
+  80235d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802361:	ff d0                	call   *%rax
+  802363:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802367:	c9                   	leave
+  802368:	c3                   	ret
+
+0000000000802369 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802369:	55                   	push   %rbp
+  80236a:	48 89 e5             	mov    %rsp,%rbp
+  80236d:	48 83 ec 20          	sub    $0x20,%rsp
+  802371:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802371 <sys_page_map+0x8>
+  802378:	49 bb cf 6c 00 00 00 	movabs $0x6ccf,%r11
+  80237f:	00 00 00 
+  802382:	4c 01 d8             	add    %r11,%rax
+  802385:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802388:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80238c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80238f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802393:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802397:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80239a:	48 63 f2             	movslq %edx,%rsi
+  80239d:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8023a1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023a4:	48 63 fa             	movslq %edx,%rdi
+  8023a7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023ab:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023ae:	48 63 d2             	movslq %edx,%rdx
+  8023b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b5:	56                   	push   %rsi
+  8023b6:	4d 89 c1             	mov    %r8,%r9
+  8023b9:	49 89 f8             	mov    %rdi,%r8
+  8023bc:	be 01 00 00 00       	mov    $0x1,%esi
+  8023c1:	bf 05 00 00 00       	mov    $0x5,%edi
+  8023c6:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  8023cd:	ff ff ff 
+  8023d0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023d4:	ff d0                	call   *%rax
+  8023d6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023da:	c9                   	leave
+  8023db:	c3                   	ret
+
+00000000008023dc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8023dc:	55                   	push   %rbp
+  8023dd:	48 89 e5             	mov    %rsp,%rbp
+  8023e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8023e4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023e4 <sys_page_unmap+0x8>
+  8023eb:	49 bb 5c 6c 00 00 00 	movabs $0x6c5c,%r11
+  8023f2:	00 00 00 
+  8023f5:	4c 01 d8             	add    %r11,%rax
+  8023f8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8023ff:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802403:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802406:	48 63 d2             	movslq %edx,%rdx
+  802409:	48 83 ec 08          	sub    $0x8,%rsp
+  80240d:	6a 00                	push   $0x0
+  80240f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80241b:	be 01 00 00 00       	mov    $0x1,%esi
+  802420:	bf 06 00 00 00       	mov    $0x6,%edi
+  802425:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  80242c:	ff ff ff 
+  80242f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802433:	ff d0                	call   *%rax
+  802435:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802439:	c9                   	leave
+  80243a:	c3                   	ret
+
+000000000080243b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80243b:	55                   	push   %rbp
+  80243c:	48 89 e5             	mov    %rsp,%rbp
+  80243f:	48 83 ec 10          	sub    $0x10,%rsp
+  802443:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802443 <sys_env_set_status+0x8>
+  80244a:	49 bb fd 6b 00 00 00 	movabs $0x6bfd,%r11
+  802451:	00 00 00 
+  802454:	4c 01 d8             	add    %r11,%rax
+  802457:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80245a:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80245d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802460:	48 63 ca             	movslq %edx,%rcx
+  802463:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802466:	48 63 d2             	movslq %edx,%rdx
+  802469:	48 83 ec 08          	sub    $0x8,%rsp
+  80246d:	6a 00                	push   $0x0
+  80246f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802475:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80247b:	be 01 00 00 00       	mov    $0x1,%esi
+  802480:	bf 08 00 00 00       	mov    $0x8,%edi
+  802485:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  80248c:	ff ff ff 
+  80248f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802493:	ff d0                	call   *%rax
+  802495:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802499:	c9                   	leave
+  80249a:	c3                   	ret
+
+000000000080249b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80249b:	55                   	push   %rbp
+  80249c:	48 89 e5             	mov    %rsp,%rbp
+  80249f:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024a3 <sys_env_set_trapframe+0x8>
+  8024aa:	49 bb 9d 6b 00 00 00 	movabs $0x6b9d,%r11
+  8024b1:	00 00 00 
+  8024b4:	4c 01 d8             	add    %r11,%rax
+  8024b7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8024be:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024c2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024c5:	48 63 d2             	movslq %edx,%rdx
+  8024c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8024cc:	6a 00                	push   $0x0
+  8024ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024da:	be 01 00 00 00       	mov    $0x1,%esi
+  8024df:	bf 09 00 00 00       	mov    $0x9,%edi
+  8024e4:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  8024eb:	ff ff ff 
+  8024ee:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024f2:	ff d0                	call   *%rax
+  8024f4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024f8:	c9                   	leave
+  8024f9:	c3                   	ret
+
+00000000008024fa <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8024fa:	55                   	push   %rbp
+  8024fb:	48 89 e5             	mov    %rsp,%rbp
+  8024fe:	48 83 ec 10          	sub    $0x10,%rsp
+  802502:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802502 <sys_env_set_pgfault_upcall+0x8>
+  802509:	49 bb 3e 6b 00 00 00 	movabs $0x6b3e,%r11
+  802510:	00 00 00 
+  802513:	4c 01 d8             	add    %r11,%rax
+  802516:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802519:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80251d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802521:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802524:	48 63 d2             	movslq %edx,%rdx
+  802527:	48 83 ec 08          	sub    $0x8,%rsp
+  80252b:	6a 00                	push   $0x0
+  80252d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802533:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802539:	be 01 00 00 00       	mov    $0x1,%esi
+  80253e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802543:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  80254a:	ff ff ff 
+  80254d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802551:	ff d0                	call   *%rax
+  802553:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802557:	c9                   	leave
+  802558:	c3                   	ret
+
+0000000000802559 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802559:	55                   	push   %rbp
+  80255a:	48 89 e5             	mov    %rsp,%rbp
+  80255d:	48 83 ec 20          	sub    $0x20,%rsp
+  802561:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802561 <sys_ipc_try_send+0x8>
+  802568:	49 bb df 6a 00 00 00 	movabs $0x6adf,%r11
+  80256f:	00 00 00 
+  802572:	4c 01 d8             	add    %r11,%rax
+  802575:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802578:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80257c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802580:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802583:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802586:	48 63 fa             	movslq %edx,%rdi
+  802589:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80258d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802590:	48 63 d2             	movslq %edx,%rdx
+  802593:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802597:	48 83 ec 08          	sub    $0x8,%rsp
+  80259b:	6a 00                	push   $0x0
+  80259d:	49 89 f9             	mov    %rdi,%r9
+  8025a0:	49 89 f0             	mov    %rsi,%r8
+  8025a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a8:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8025ad:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  8025b4:	ff ff ff 
+  8025b7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025bb:	ff d0                	call   *%rax
+  8025bd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025c1:	c9                   	leave
+  8025c2:	c3                   	ret
+
+00000000008025c3 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8025c3:	55                   	push   %rbp
+  8025c4:	48 89 e5             	mov    %rsp,%rbp
+  8025c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8025cb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025cb <sys_ipc_send+0x8>
+  8025d2:	49 bb 75 6a 00 00 00 	movabs $0x6a75,%r11
+  8025d9:	00 00 00 
+  8025dc:	4c 01 d8             	add    %r11,%rax
+  8025df:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025e6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025ea:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8025ed:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025f0:	48 63 fa             	movslq %edx,%rdi
+  8025f3:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8025f7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025fa:	48 63 d2             	movslq %edx,%rdx
+  8025fd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802601:	48 83 ec 08          	sub    $0x8,%rsp
+  802605:	6a 00                	push   $0x0
+  802607:	49 89 f9             	mov    %rdi,%r9
+  80260a:	49 89 f0             	mov    %rsi,%r8
+  80260d:	be 00 00 00 00       	mov    $0x0,%esi
+  802612:	bf 17 00 00 00       	mov    $0x17,%edi
+  802617:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  80261e:	ff ff ff 
+  802621:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802625:	ff d0                	call   *%rax
+  802627:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80262b:	c9                   	leave
+  80262c:	c3                   	ret
+
+000000000080262d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80262d:	55                   	push   %rbp
+  80262e:	48 89 e5             	mov    %rsp,%rbp
+  802631:	48 83 ec 10          	sub    $0x10,%rsp
+  802635:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802635 <sys_ipc_recv+0x8>
+  80263c:	49 bb 0b 6a 00 00 00 	movabs $0x6a0b,%r11
+  802643:	00 00 00 
+  802646:	4c 01 d8             	add    %r11,%rax
+  802649:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80264d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802651:	6a 00                	push   $0x0
+  802653:	6a 00                	push   $0x0
+  802655:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80265b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802661:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802666:	be 01 00 00 00       	mov    $0x1,%esi
+  80266b:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802670:	49 ba 5d 8f ff ff ff 	movabs $0xffffffffffff8f5d,%r10
+  802677:	ff ff ff 
+  80267a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80267e:	ff d0                	call   *%rax
+  802680:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802684:	c9                   	leave
+  802685:	c3                   	ret
+
+0000000000802686 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802686:	55                   	push   %rbp
+  802687:	48 89 e5             	mov    %rsp,%rbp
+  80268a:	48 83 ec 30          	sub    $0x30,%rsp
+  80268e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80268e <sys_ipc_call+0x8>
+  802695:	49 bb b2 69 00 00 00 	movabs $0x69b2,%r11
+  80269c:	00 00 00 
+  80269f:	4c 01 d8             	add    %r11,%rax
+  8026a2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026a5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026a9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8026ad:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8026b0:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8026b4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8026b8:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8026bc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026bf:	4c 63 c2             	movslq %edx,%r8
+  8026c2:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8026c6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026c9:	48 63 d2             	movslq %edx,%rdx
+  8026cc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026d0:	ff 75 d8             	push   -0x28(%rbp)
+  8026d3:	56                   	push   %rsi
+  8026d4:	4d 89 c1             	mov    %r8,%r9
+  8026d7:	49 89 f8             	mov    %rdi,%r8
+  8026da:	be 00 00 00 00       	mov    $0x0,%esi
+  8026df:	bf 18 00 00 00       	mov    $0x18,%edi
+  8026e4:	49 ba 5d 8f ff ff ff 	movabs $0xffffffffffff8f5d,%r10
+  8026eb:	ff ff ff 
+  8026ee:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026f2:	ff d0                	call   *%rax
+  8026f4:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8026f8:	c9                   	leave
+  8026f9:	c3                   	ret
+
+00000000008026fa <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8026fa:	55                   	push   %rbp
+  8026fb:	48 89 e5             	mov    %rsp,%rbp
+  8026fe:	48 83 ec 30          	sub    $0x30,%rsp
+  802702:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802702 <sys_ipc_reply_recv+0x8>
+  802709:	49 bb 3e 69 00 00 00 	movabs $0x693e,%r11
+  802710:	00 00 00 
+  802713:	4c 01 d8             	add    %r11,%rax
+  802716:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802719:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80271d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802721:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802724:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802728:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80272c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802730:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802733:	4c 63 c2             	movslq %edx,%r8
+  802736:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80273a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80273d:	48 63 d2             	movslq %edx,%rdx
+  802740:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802744:	ff 75 d8             	push   -0x28(%rbp)
+  802747:	56                   	push   %rsi
+  802748:	4d 89 c1             	mov    %r8,%r9
+  80274b:	49 89 f8             	mov    %rdi,%r8
+  80274e:	be 00 00 00 00       	mov    $0x0,%esi
+  802753:	bf 19 00 00 00       	mov    $0x19,%edi
+  802758:	49 ba 5d 8f ff ff ff 	movabs $0xffffffffffff8f5d,%r10
+  80275f:	ff ff ff 
+  802762:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802766:	ff d0                	call   *%rax
+  802768:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  80276c:	c9                   	leave
+  80276d:	c3                   	ret
+
+000000000080276e <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80276e:	55                   	push   %rbp
+  80276f:	48 89 e5             	mov    %rsp,%rbp
+  802772:	48 83 ec 10          	sub    $0x10,%rsp
+  802776:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802776 <sys_env_set_priority+0x8>
+  80277d:	49 bb ca 68 00 00 00 	movabs $0x68ca,%r11
+  802784:	00 00 00 
+  802787:	4c 01 d8             	add    %r11,%rax
+  80278a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80278d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802790:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802793:	48 63 ca             	movslq %edx,%rcx
+  802796:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802799:	48 63 d2             	movslq %edx,%rdx
+  80279c:	48 83 ec 08          	sub    $0x8,%rsp
+  8027a0:	6a 00                	push   $0x0
+  8027a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027ae:	be 01 00 00 00       	mov    $0x1,%esi
+  8027b3:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8027b8:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  8027bf:	ff ff ff 
+  8027c2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027c6:	ff d0                	call   *%rax
+  8027c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027cc:	c9                   	leave
+  8027cd:	c3                   	ret
+
+00000000008027ce <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8027ce:	55                   	push   %rbp
+  8027cf:	48 89 e5             	mov    %rsp,%rbp
+  8027d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8027d6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027d6 <sys_env_set_affinity+0x8>
+  8027dd:	49 bb 6a 68 00 00 00 	movabs $0x686a,%r11
+  8027e4:	00 00 00 
+  8027e7:	4c 01 d8             	add    %r11,%rax
+  8027ea:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027ed:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8027f0:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8027f3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027f6:	48 63 d2             	movslq %edx,%rdx
+  8027f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8027fd:	6a 00                	push   $0x0
+  8027ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802805:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80280b:	be 01 00 00 00       	mov    $0x1,%esi
+  802810:	bf 10 00 00 00       	mov    $0x10,%edi
+  802815:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  80281c:	ff ff ff 
+  80281f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802823:	ff d0                	call   *%rax
+  802825:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802829:	c9                   	leave
+  80282a:	c3                   	ret
+
+000000000080282b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80282b:	55                   	push   %rbp
+  80282c:	48 89 e5             	mov    %rsp,%rbp
+  80282f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80282f <sys_time_msec+0x4>
+  802836:	49 bb 11 68 00 00 00 	movabs $0x6811,%r11
+  80283d:	00 00 00 
+  802840:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802843:	48 83 ec 08          	sub    $0x8,%rsp
+  802847:	6a 00                	push   $0x0
+  802849:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80284f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802855:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80285a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80285f:	be 00 00 00 00       	mov    $0x0,%esi
+  802864:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802869:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  802870:	ff ff ff 
+  802873:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802877:	ff d0                	call   *%rax
+  802879:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80287d:	c9                   	leave
+  80287e:	c3                   	ret
+
+000000000080287f <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80287f:	55                   	push   %rbp
+  802880:	48 89 e5             	mov    %rsp,%rbp
+  802883:	48 83 ec 10          	sub    $0x10,%rsp
+  802887:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802887 <sys_sleep_usec+0x8>
+  80288e:	49 bb b9 67 00 00 00 	movabs $0x67b9,%r11
+  802895:	00 00 00 
+  802898:	4c 01 d8             	add    %r11,%rax
+  80289b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  80289f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a7:	6a 00                	push   $0x0
+  8028a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8028bf:	bf 11 00 00 00       	mov    $0x11,%edi
+  8028c4:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  8028cb:	ff ff ff 
+  8028ce:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028d2:	ff d0                	call   *%rax
+  8028d4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028d8:	c9                   	leave
+  8028d9:	c3                   	ret
+
+00000000008028da <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8028da:	55                   	push   %rbp
+  8028db:	48 89 e5             	mov    %rsp,%rbp
+  8028de:	48 83 ec 10          	sub    $0x10,%rsp
+  8028e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028e2 <sys_page_alloc_huge+0x8>
+  8028e9:	49 bb 5e 67 00 00 00 	movabs $0x675e,%r11
+  8028f0:	00 00 00 
+  8028f3:	4c 01 d8             	add    %r11,%rax
+  8028f6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028fd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802900:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802903:	48 63 f2             	movslq %edx,%rsi
+  802906:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80290a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80290d:	48 63 d2             	movslq %edx,%rdx
+  802910:	48 83 ec 08          	sub    $0x8,%rsp
+  802914:	6a 00                	push   $0x0
+  802916:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80291c:	49 89 f0             	mov    %rsi,%r8
+  80291f:	be 01 00 00 00       	mov    $0x1,%esi
+  802924:	bf 12 00 00 00       	mov    $0x12,%edi
+  802929:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  802930:	ff ff ff 
+  802933:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802937:	ff d0                	call   *%rax
+  802939:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80293d:	c9                   	leave
+  80293e:	c3                   	ret
+
+000000000080293f <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80293f:	55                   	push   %rbp
+  802940:	48 89 e5             	mov    %rsp,%rbp
+  802943:	48 83 ec 10          	sub    $0x10,%rsp
+  802947:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802947 <sys_page_map_batch+0x8>
+  80294e:	49 bb f9 66 00 00 00 	movabs $0x66f9,%r11
+  802955:	00 00 00 
+  802958:	4c 01 d8             	add    %r11,%rax
+  80295b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80295f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802963:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802967:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80296b:	48 83 ec 08          	sub    $0x8,%rsp
+  80296f:	6a 00                	push   $0x0
+  802971:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802977:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80297d:	be 01 00 00 00       	mov    $0x1,%esi
+  802982:	bf 13 00 00 00       	mov    $0x13,%edi
+  802987:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  80298e:	ff ff ff 
+  802991:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802995:	ff d0                	call   *%rax
+  802997:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80299b:	c9                   	leave
+  80299c:	c3                   	ret
+
+000000000080299d <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  80299d:	55                   	push   %rbp
+  80299e:	48 89 e5             	mov    %rsp,%rbp
+  8029a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8029a5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029a5 <sys_page_alloc_batch+0x8>
+  8029ac:	49 bb 9b 66 00 00 00 	movabs $0x669b,%r11
+  8029b3:	00 00 00 
+  8029b6:	4c 01 d8             	add    %r11,%rax
+  8029b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029bd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8029c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029c5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8029c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8029cd:	6a 00                	push   $0x0
+  8029cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029db:	be 01 00 00 00       	mov    $0x1,%esi
+  8029e0:	bf 14 00 00 00       	mov    $0x14,%edi
+  8029e5:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  8029ec:	ff ff ff 
+  8029ef:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029f3:	ff d0                	call   *%rax
+  8029f5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029f9:	c9                   	leave
+  8029fa:	c3                   	ret
+
+00000000008029fb <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8029fb:	55                   	push   %rbp
+  8029fc:	48 89 e5             	mov    %rsp,%rbp
+  8029ff:	48 83 ec 10          	sub    $0x10,%rsp
+  802a03:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a03 <sys_page_unmap_batch+0x8>
+  802a0a:	49 bb 3d 66 00 00 00 	movabs $0x663d,%r11
+  802a11:	00 00 00 
+  802a14:	4c 01 d8             	add    %r11,%rax
+  802a17:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a1b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802a1f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a23:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a27:	48 83 ec 08          	sub    $0x8,%rsp
+  802a2b:	6a 00                	push   $0x0
+  802a2d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a33:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a39:	be 01 00 00 00       	mov    $0x1,%esi
+  802a3e:	bf 15 00 00 00       	mov    $0x15,%edi
+  802a43:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  802a4a:	ff ff ff 
+  802a4d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a51:	ff d0                	call   *%rax
+  802a53:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a57:	c9                   	leave
+  802a58:	c3                   	ret
+
+0000000000802a59 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802a59:	55                   	push   %rbp
+  802a5a:	48 89 e5             	mov    %rsp,%rbp
+  802a5d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a5d <sys_fork+0x4>
+  802a64:	49 bb e3 65 00 00 00 	movabs $0x65e3,%r11
+  802a6b:	00 00 00 
+  802a6e:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802a71:	48 83 ec 08          	sub    $0x8,%rsp
+  802a75:	6a 00                	push   $0x0
+  802a77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a88:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a8d:	be 00 00 00 00       	mov    $0x0,%esi
+  802a92:	bf 16 00 00 00       	mov    $0x16,%edi
+  802a97:	49 ba a3 8e ff ff ff 	movabs $0xffffffffffff8ea3,%r10
+  802a9e:	ff ff ff 
+  802aa1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802aa5:	ff d0                	call   *%rax
+  802aa7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802aab:	c9                   	leave
+  802aac:	c3                   	ret
+
+0000000000802aad <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802aad:	55                   	push   %rbp
+  802aae:	48 89 e5             	mov    %rsp,%rbp
+  802ab1:	41 57                	push   %r15
+  802ab3:	53                   	push   %rbx
+  802ab4:	48 83 ec 40          	sub    $0x40,%rsp
+  802ab8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ab8 <pgfault+0xb>
+  802abf:	49 bb 88 65 00 00 00 	movabs $0x6588,%r11
+  802ac6:	00 00 00 
+  802ac9:	4c 01 db             	add    %r11,%rbx
+  802acc:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  802ad0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ad4:	48 8b 00             	mov    (%rax),%rax
+  802ad7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802adb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802adf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ae3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  802ae6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802aea:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802aee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802af2:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802af8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802afc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802aff:	83 e0 02             	and    $0x2,%eax
+  802b02:	85 c0                	test   %eax,%eax
+  802b04:	0f 84 91 03 00 00    	je     802e9b <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802b0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b0e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b12:	48 89 c2             	mov    %rax,%rdx
+  802b15:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802b1c:	ff ff ff 
+  802b1f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b23:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b27:	83 e0 01             	and    $0x1,%eax
+  802b2a:	48 85 c0             	test   %rax,%rax
+  802b2d:	0f 84 a7 01 00 00    	je     802cda <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802b33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b37:	48 c1 e8 15          	shr    $0x15,%rax
+  802b3b:	48 89 c2             	mov    %rax,%rdx
+  802b3e:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802b45:	ff ff ff 
+  802b48:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b4c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b50:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802b55:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802b5b:	0f 85 79 01 00 00    	jne    802cda <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802b61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b65:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802b69:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b6d:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802b73:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802b77:	ba 07 00 00 00       	mov    $0x7,%edx
+  802b7c:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b81:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b86:	49 89 df             	mov    %rbx,%r15
+  802b89:	48 b8 9a 98 ff ff ff 	movabs $0xffffffffffff989a,%rax
+  802b90:	ff ff ff 
+  802b93:	48 01 d8             	add    %rbx,%rax
+  802b96:	ff d0                	call   *%rax
+  802b98:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802b9b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802b9f:	79 44                	jns    802be5 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802ba1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802ba4:	89 c1                	mov    %eax,%ecx
+  802ba6:	48 b8 70 e4 ff ff ff 	movabs $0xffffffffffffe470,%rax
+  802bad:	ff ff ff 
+  802bb0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bb4:	48 89 c2             	mov    %rax,%rdx
+  802bb7:	be 20 00 00 00       	mov    $0x20,%esi
+  802bbc:	48 b8 90 e4 ff ff ff 	movabs $0xffffffffffffe490,%rax
+  802bc3:	ff ff ff 
+  802bc6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bca:	48 89 c7             	mov    %rax,%rdi
+  802bcd:	49 89 df             	mov    %rbx,%r15
+  802bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd5:	49 b8 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%r8
+  802bdc:	ff ff ff 
+  802bdf:	49 01 d8             	add    %rbx,%r8
+  802be2:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802be5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802be9:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802bee:	48 89 c6             	mov    %rax,%rsi
+  802bf1:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802bf6:	49 89 df             	mov    %rbx,%r15
+  802bf9:	48 b8 13 8b ff ff ff 	movabs $0xffffffffffff8b13,%rax
+  802c00:	ff ff ff 
+  802c03:	48 01 d8             	add    %rbx,%rax
+  802c06:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802c08:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c0c:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802c12:	48 89 c1             	mov    %rax,%rcx
+  802c15:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c1a:	be 00 00 60 00       	mov    $0x600000,%esi
+  802c1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c24:	49 89 df             	mov    %rbx,%r15
+  802c27:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  802c2e:	ff ff ff 
+  802c31:	48 01 d8             	add    %rbx,%rax
+  802c34:	ff d0                	call   *%rax
+  802c36:	85 c0                	test   %eax,%eax
+  802c38:	74 3e                	je     802c78 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802c3a:	48 b8 9b e4 ff ff ff 	movabs $0xffffffffffffe49b,%rax
+  802c41:	ff ff ff 
+  802c44:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c48:	48 89 c2             	mov    %rax,%rdx
+  802c4b:	be 23 00 00 00       	mov    $0x23,%esi
+  802c50:	48 b8 90 e4 ff ff ff 	movabs $0xffffffffffffe490,%rax
+  802c57:	ff ff ff 
+  802c5a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c5e:	48 89 c7             	mov    %rax,%rdi
+  802c61:	49 89 df             	mov    %rbx,%r15
+  802c64:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c69:	48 b9 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%rcx
+  802c70:	ff ff ff 
+  802c73:	48 01 d9             	add    %rbx,%rcx
+  802c76:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802c78:	be 00 00 60 00       	mov    $0x600000,%esi
+  802c7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c82:	49 89 df             	mov    %rbx,%r15
+  802c85:	48 b8 9c 93 ff ff ff 	movabs $0xffffffffffff939c,%rax
+  802c8c:	ff ff ff 
+  802c8f:	48 01 d8             	add    %rbx,%rax
+  802c92:	ff d0                	call   *%rax
+  802c94:	85 c0                	test   %eax,%eax
+  802c96:	0f 84 3d 02 00 00    	je     802ed9 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802c9c:	48 b8 b0 e4 ff ff ff 	movabs $0xffffffffffffe4b0,%rax
+  802ca3:	ff ff ff 
+  802ca6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802caa:	48 89 c2             	mov    %rax,%rdx
+  802cad:	be 25 00 00 00       	mov    $0x25,%esi
+  802cb2:	48 b8 90 e4 ff ff ff 	movabs $0xffffffffffffe490,%rax
+  802cb9:	ff ff ff 
+  802cbc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cc0:	48 89 c7             	mov    %rax,%rdi
+  802cc3:	49 89 df             	mov    %rbx,%r15
+  802cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ccb:	48 b9 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%rcx
+  802cd2:	ff ff ff 
+  802cd5:	48 01 d9             	add    %rbx,%rcx
+  802cd8:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802cda:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cde:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ce2:	48 89 c2             	mov    %rax,%rdx
+  802ce5:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802cec:	ff ff ff 
+  802cef:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cf3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cf7:	25 00 08 00 00       	and    $0x800,%eax
+  802cfc:	48 85 c0             	test   %rax,%rax
+  802cff:	0f 84 58 01 00 00    	je     802e5d <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802d05:	ba 07 00 00 00       	mov    $0x7,%edx
+  802d0a:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802d0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d14:	49 89 df             	mov    %rbx,%r15
+  802d17:	48 b8 c4 92 ff ff ff 	movabs $0xffffffffffff92c4,%rax
+  802d1e:	ff ff ff 
+  802d21:	48 01 d8             	add    %rbx,%rax
+  802d24:	ff d0                	call   *%rax
+  802d26:	85 c0                	test   %eax,%eax
+  802d28:	74 3e                	je     802d68 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802d2a:	48 b8 c7 e4 ff ff ff 	movabs $0xffffffffffffe4c7,%rax
+  802d31:	ff ff ff 
+  802d34:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d38:	48 89 c2             	mov    %rax,%rdx
+  802d3b:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802d40:	48 b8 90 e4 ff ff ff 	movabs $0xffffffffffffe490,%rax
+  802d47:	ff ff ff 
+  802d4a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d4e:	48 89 c7             	mov    %rax,%rdi
+  802d51:	49 89 df             	mov    %rbx,%r15
+  802d54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d59:	48 b9 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%rcx
+  802d60:	ff ff ff 
+  802d63:	48 01 d9             	add    %rbx,%rcx
+  802d66:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802d68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d6c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d71:	48 89 c6             	mov    %rax,%rsi
+  802d74:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802d79:	49 89 df             	mov    %rbx,%r15
+  802d7c:	48 b8 13 8b ff ff ff 	movabs $0xffffffffffff8b13,%rax
+  802d83:	ff ff ff 
+  802d86:	48 01 d8             	add    %rbx,%rax
+  802d89:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802d8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d8f:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802d95:	48 89 c1             	mov    %rax,%rcx
+  802d98:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d9d:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802da2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802da7:	49 89 df             	mov    %rbx,%r15
+  802daa:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  802db1:	ff ff ff 
+  802db4:	48 01 d8             	add    %rbx,%rax
+  802db7:	ff d0                	call   *%rax
+  802db9:	85 c0                	test   %eax,%eax
+  802dbb:	74 3e                	je     802dfb <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802dbd:	48 b8 9b e4 ff ff ff 	movabs $0xffffffffffffe49b,%rax
+  802dc4:	ff ff ff 
+  802dc7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dcb:	48 89 c2             	mov    %rax,%rdx
+  802dce:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802dd3:	48 b8 90 e4 ff ff ff 	movabs $0xffffffffffffe490,%rax
+  802dda:	ff ff ff 
+  802ddd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802de1:	48 89 c7             	mov    %rax,%rdi
+  802de4:	49 89 df             	mov    %rbx,%r15
+  802de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dec:	48 b9 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%rcx
+  802df3:	ff ff ff 
+  802df6:	48 01 d9             	add    %rbx,%rcx
+  802df9:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802dfb:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802e00:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e05:	49 89 df             	mov    %rbx,%r15
+  802e08:	48 b8 9c 93 ff ff ff 	movabs $0xffffffffffff939c,%rax
+  802e0f:	ff ff ff 
+  802e12:	48 01 d8             	add    %rbx,%rax
+  802e15:	ff d0                	call   *%rax
+  802e17:	85 c0                	test   %eax,%eax
+  802e19:	0f 84 bb 00 00 00    	je     802eda <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802e1f:	48 b8 b0 e4 ff ff ff 	movabs $0xffffffffffffe4b0,%rax
+  802e26:	ff ff ff 
+  802e29:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e2d:	48 89 c2             	mov    %rax,%rdx
+  802e30:	be 32 00 00 00       	mov    $0x32,%esi
+  802e35:	48 b8 90 e4 ff ff ff 	movabs $0xffffffffffffe490,%rax
+  802e3c:	ff ff ff 
+  802e3f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e43:	48 89 c7             	mov    %rax,%rdi
+  802e46:	49 89 df             	mov    %rbx,%r15
+  802e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e4e:	48 b9 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%rcx
+  802e55:	ff ff ff 
+  802e58:	48 01 d9             	add    %rbx,%rcx
+  802e5b:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802e5d:	48 b8 e0 e4 ff ff ff 	movabs $0xffffffffffffe4e0,%rax
+  802e64:	ff ff ff 
+  802e67:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e6b:	48 89 c2             	mov    %rax,%rdx
+  802e6e:	be 36 00 00 00       	mov    $0x36,%esi
+  802e73:	48 b8 90 e4 ff ff ff 	movabs $0xffffffffffffe490,%rax
+  802e7a:	ff ff ff 
+  802e7d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e81:	48 89 c7             	mov    %rax,%rdi
+  802e84:	49 89 df             	mov    %rbx,%r15
+  802e87:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e8c:	48 b9 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%rcx
+  802e93:	ff ff ff 
+  802e96:	48 01 d9             	add    %rbx,%rcx
+  802e99:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802e9b:	48 b8 ff e4 ff ff ff 	movabs $0xffffffffffffe4ff,%rax
+  802ea2:	ff ff ff 
+  802ea5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ea9:	48 89 c2             	mov    %rax,%rdx
+  802eac:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802eb1:	48 b8 90 e4 ff ff ff 	movabs $0xffffffffffffe490,%rax
+  802eb8:	ff ff ff 
+  802ebb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ebf:	48 89 c7             	mov    %rax,%rdi
+  802ec2:	49 89 df             	mov    %rbx,%r15
+  802ec5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eca:	48 b9 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%rcx
+  802ed1:	ff ff ff 
+  802ed4:	48 01 d9             	add    %rbx,%rcx
+  802ed7:	ff d1                	call   *%rcx
+			return;
+  802ed9:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802eda:	48 83 c4 40          	add    $0x40,%rsp
+  802ede:	5b                   	pop    %rbx
+  802edf:	41 5f                	pop    %r15
+  802ee1:	5d                   	pop    %rbp
+  802ee2:	c3                   	ret
+
+0000000000802ee3 <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802ee3:	55                   	push   %rbp
+  802ee4:	48 89 e5             	mov    %rsp,%rbp
+  802ee7:	41 57                	push   %r15
+  802ee9:	53                   	push   %rbx
+  802eea:	48 83 ec 10          	sub    $0x10,%rsp
+  802eee:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802eee <fork_flush+0xb>
+  802ef5:	49 bb 52 61 00 00 00 	movabs $0x6152,%r11
+  802efc:	00 00 00 
+  802eff:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802f02:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802f09:	00 00 00 
+  802f0c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f10:	48 85 c0             	test   %rax,%rax
+  802f13:	0f 84 81 00 00 00    	je     802f9a <fork_flush+0xb7>
+  802f19:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802f20:	00 00 00 
+  802f23:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f27:	48 89 c6             	mov    %rax,%rsi
+  802f2a:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802f31:	00 00 00 
+  802f34:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f38:	48 89 c7             	mov    %rax,%rdi
+  802f3b:	49 89 df             	mov    %rbx,%r15
+  802f3e:	48 b8 ff 98 ff ff ff 	movabs $0xffffffffffff98ff,%rax
+  802f45:	ff ff ff 
+  802f48:	48 01 d8             	add    %rbx,%rax
+  802f4b:	ff d0                	call   *%rax
+  802f4d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f50:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f54:	79 44                	jns    802f9a <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802f56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f59:	89 c1                	mov    %eax,%ecx
+  802f5b:	48 b8 18 e5 ff ff ff 	movabs $0xffffffffffffe518,%rax
+  802f62:	ff ff ff 
+  802f65:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f69:	48 89 c2             	mov    %rax,%rdx
+  802f6c:	be 56 00 00 00       	mov    $0x56,%esi
+  802f71:	48 b8 90 e4 ff ff ff 	movabs $0xffffffffffffe490,%rax
+  802f78:	ff ff ff 
+  802f7b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f7f:	48 89 c7             	mov    %rax,%rdi
+  802f82:	49 89 df             	mov    %rbx,%r15
+  802f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8a:	49 b8 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%r8
+  802f91:	ff ff ff 
+  802f94:	49 01 d8             	add    %rbx,%r8
+  802f97:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802f9a:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802fa1:	00 00 00 
+  802fa4:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802fab:	00 
+}
+  802fac:	90                   	nop
+  802fad:	48 83 c4 10          	add    $0x10,%rsp
+  802fb1:	5b                   	pop    %rbx
+  802fb2:	41 5f                	pop    %r15
+  802fb4:	5d                   	pop    %rbp
+  802fb5:	c3                   	ret
+
+0000000000802fb6 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802fb6:	55                   	push   %rbp
+  802fb7:	48 89 e5             	mov    %rsp,%rbp
+  802fba:	53                   	push   %rbx
+  802fbb:	48 83 ec 28          	sub    $0x28,%rsp
+  802fbf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802fbf <fork_map+0x9>
+  802fc6:	49 bb 81 60 00 00 00 	movabs $0x6081,%r11
+  802fcd:	00 00 00 
+  802fd0:	4c 01 db             	add    %r11,%rbx
+  802fd3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802fd6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802fda:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802fdd:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802fe4:	00 00 00 
+  802fe7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802feb:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802ff1:	75 10                	jne    803003 <fork_map+0x4d>
+		fork_flush();
+  802ff3:	48 b8 a3 9e ff ff ff 	movabs $0xffffffffffff9ea3,%rax
+  802ffa:	ff ff ff 
+  802ffd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803001:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  803003:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80300a:	00 00 00 
+  80300d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803011:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803015:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  80301c:	00 00 00 
+  80301f:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  803023:	48 c1 e0 05          	shl    $0x5,%rax
+  803027:	48 89 c2             	mov    %rax,%rdx
+  80302a:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  803031:	00 00 00 
+  803034:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803038:	48 01 d0             	add    %rdx,%rax
+  80303b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  80303f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803043:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  803049:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80304d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803051:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  803055:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803059:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80305c:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  80305f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803063:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803067:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  80306b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80306f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803072:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  803075:	90                   	nop
+  803076:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80307a:	c9                   	leave
+  80307b:	c3                   	ret
+
+000000000080307c <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  80307c:	55                   	push   %rbp
+  80307d:	48 89 e5             	mov    %rsp,%rbp
+  803080:	53                   	push   %rbx
+  803081:	48 83 ec 28          	sub    $0x28,%rsp
+  803085:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803085 <duppage+0x9>
+  80308c:	49 bb bb 5f 00 00 00 	movabs $0x5fbb,%r11
+  803093:	00 00 00 
+  803096:	4c 01 db             	add    %r11,%rbx
+  803099:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80309c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  80309f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8030a2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030a6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  8030aa:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8030b1:	ff ff ff 
+  8030b4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030b8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030bb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030bf:	25 00 04 00 00       	and    $0x400,%eax
+  8030c4:	48 85 c0             	test   %rax,%rax
+  8030c7:	74 42                	je     80310b <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  8030c9:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8030d0:	ff ff ff 
+  8030d3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030d7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030da:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030de:	25 07 0e 00 00       	and    $0xe07,%eax
+  8030e3:	89 c2                	mov    %eax,%edx
+  8030e5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8030e9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030ec:	48 89 ce             	mov    %rcx,%rsi
+  8030ef:	89 c7                	mov    %eax,%edi
+  8030f1:	48 b8 76 9f ff ff ff 	movabs $0xffffffffffff9f76,%rax
+  8030f8:	ff ff ff 
+  8030fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030ff:	ff d0                	call   *%rax
+		return 0;
+  803101:	b8 00 00 00 00       	mov    $0x0,%eax
+  803106:	e9 ae 00 00 00       	jmp    8031b9 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  80310b:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803112:	ff ff ff 
+  803115:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803119:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80311c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803120:	83 e0 02             	and    $0x2,%eax
+  803123:	48 85 c0             	test   %rax,%rax
+  803126:	75 1f                	jne    803147 <duppage+0xcb>
+  803128:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80312f:	ff ff ff 
+  803132:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803136:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803139:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80313d:	25 00 08 00 00       	and    $0x800,%eax
+  803142:	48 85 c0             	test   %rax,%rax
+  803145:	74 4c                	je     803193 <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  803147:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  80314e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803151:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803155:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803158:	48 89 ce             	mov    %rcx,%rsi
+  80315b:	89 c7                	mov    %eax,%edi
+  80315d:	48 b8 76 9f ff ff ff 	movabs $0xffffffffffff9f76,%rax
+  803164:	ff ff ff 
+  803167:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80316b:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  80316d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803170:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803174:	48 89 c6             	mov    %rax,%rsi
+  803177:	bf 00 00 00 00       	mov    $0x0,%edi
+  80317c:	48 b8 76 9f ff ff ff 	movabs $0xffffffffffff9f76,%rax
+  803183:	ff ff ff 
+  803186:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80318a:	ff d0                	call   *%rax
+		return 0;
+  80318c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803191:	eb 26                	jmp    8031b9 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  803193:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803197:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80319a:	ba 05 00 00 00       	mov    $0x5,%edx
+  80319f:	48 89 ce             	mov    %rcx,%rsi
+  8031a2:	89 c7                	mov    %eax,%edi
+  8031a4:	48 b8 76 9f ff ff ff 	movabs $0xffffffffffff9f76,%rax
+  8031ab:	ff ff ff 
+  8031ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031b2:	ff d0                	call   *%rax
+		return 0;
+  8031b4:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  8031b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031bd:	c9                   	leave
+  8031be:	c3                   	ret
+
+00000000008031bf <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  8031bf:	55                   	push   %rbp
+  8031c0:	48 89 e5             	mov    %rsp,%rbp
+  8031c3:	53                   	push   %rbx
+  8031c4:	48 83 ec 28          	sub    $0x28,%rsp
+  8031c8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031c8 <duphuge+0x9>
+  8031cf:	49 bb 78 5e 00 00 00 	movabs $0x5e78,%r11
+  8031d6:	00 00 00 
+  8031d9:	4c 01 db             	add    %r11,%rbx
+  8031dc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8031df:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  8031e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031e7:	48 c1 e8 15          	shr    $0x15,%rax
+  8031eb:	48 89 c2             	mov    %rax,%rdx
+  8031ee:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8031f5:	ff ff ff 
+  8031f8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031fc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803200:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  803204:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803208:	25 00 04 00 00       	and    $0x400,%eax
+  80320d:	48 85 c0             	test   %rax,%rax
+  803210:	74 0e                	je     803220 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  803212:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803216:	25 07 0e 00 00       	and    $0xe07,%eax
+  80321b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80321e:	eb 1e                	jmp    80323e <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  803220:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803224:	25 02 08 00 00       	and    $0x802,%eax
+  803229:	48 85 c0             	test   %rax,%rax
+  80322c:	74 09                	je     803237 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  80322e:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  803235:	eb 07                	jmp    80323e <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  803237:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  80323e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803241:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803245:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803248:	48 89 ce             	mov    %rcx,%rsi
+  80324b:	89 c7                	mov    %eax,%edi
+  80324d:	48 b8 76 9f ff ff ff 	movabs $0xffffffffffff9f76,%rax
+  803254:	ff ff ff 
+  803257:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80325b:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  80325d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803260:	25 00 08 00 00       	and    $0x800,%eax
+  803265:	85 c0                	test   %eax,%eax
+  803267:	74 1f                	je     803288 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  803269:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80326c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803270:	48 89 c6             	mov    %rax,%rsi
+  803273:	bf 00 00 00 00       	mov    $0x0,%edi
+  803278:	48 b8 76 9f ff ff ff 	movabs $0xffffffffffff9f76,%rax
+  80327f:	ff ff ff 
+  803282:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803286:	ff d0                	call   *%rax
+	return 0;
+  803288:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80328d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803291:	c9                   	leave
+  803292:	c3                   	ret
+
+0000000000803293 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  803293:	55                   	push   %rbp
+  803294:	48 89 e5             	mov    %rsp,%rbp
+  803297:	41 57                	push   %r15
+  803299:	53                   	push   %rbx
+  80329a:	48 83 ec 10          	sub    $0x10,%rsp
+  80329e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80329e <fork+0xb>
+  8032a5:	49 bb a2 5d 00 00 00 	movabs $0x5da2,%r11
+  8032ac:	00 00 00 
+  8032af:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  8032b2:	49 89 df             	mov    %rbx,%r15
+  8032b5:	48 b8 19 9a ff ff ff 	movabs $0xffffffffffff9a19,%rax
+  8032bc:	ff ff ff 
+  8032bf:	48 01 d8             	add    %rbx,%rax
+  8032c2:	ff d0                	call   *%rax
+  8032c4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032cb:	75 42                	jne    80330f <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8032cd:	49 89 df             	mov    %rbx,%r15
+  8032d0:	48 b8 1b 92 ff ff ff 	movabs $0xffffffffffff921b,%rax
+  8032d7:	ff ff ff 
+  8032da:	48 01 d8             	add    %rbx,%rax
+  8032dd:	ff d0                	call   *%rax
+  8032df:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032e4:	48 98                	cltq
+  8032e6:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8032ed:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8032f4:	ff ff ff 
+  8032f7:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8032fb:	48 01 c2             	add    %rax,%rdx
+  8032fe:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803305:	ff ff ff 
+  803308:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80330c:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  80330f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803312:	48 83 c4 10          	add    $0x10,%rsp
+  803316:	5b                   	pop    %rbx
+  803317:	41 5f                	pop    %r15
+  803319:	5d                   	pop    %rbp
+  80331a:	c3                   	ret
+
+000000000080331b <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  80331b:	55                   	push   %rbp
+  80331c:	48 89 e5             	mov    %rsp,%rbp
+  80331f:	41 57                	push   %r15
+  803321:	53                   	push   %rbx
+  803322:	48 83 ec 10          	sub    $0x10,%rsp
+  803326:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803326 <ufork+0xb>
+  80332d:	49 bb 1a 5d 00 00 00 	movabs $0x5d1a,%r11
+  803334:	00 00 00 
+  803337:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  80333a:	48 b8 6d 9a ff ff ff 	movabs $0xffffffffffff9a6d,%rax
+  803341:	ff ff ff 
+  803344:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803348:	48 89 c7             	mov    %rax,%rdi
+  80334b:	49 89 df             	mov    %rbx,%r15
+  80334e:	48 b8 80 dd ff ff ff 	movabs $0xffffffffffffdd80,%rax
+  803355:	ff ff ff 
+  803358:	48 01 d8             	add    %rbx,%rax
+  80335b:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80335d:	b8 07 00 00 00       	mov    $0x7,%eax
+  803362:	cd 30                	int    $0x30
+  803364:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  803367:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  80336a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  80336d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803371:	0f 84 03 02 00 00    	je     80357a <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  803377:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80337e:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  80337f:	e9 28 01 00 00       	jmp    8034ac <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  803384:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803388:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80338c:	48 89 c2             	mov    %rax,%rdx
+  80338f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803396:	ff ff ff 
+  803399:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80339d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033a1:	83 e0 01             	and    $0x1,%eax
+  8033a4:	48 85 c0             	test   %rax,%rax
+  8033a7:	0f 84 f7 00 00 00    	je     8034a4 <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  8033ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033b1:	48 c1 e8 15          	shr    $0x15,%rax
+  8033b5:	48 89 c2             	mov    %rax,%rdx
+  8033b8:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8033bf:	ff ff ff 
+  8033c2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033c6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033ca:	25 81 00 00 00       	and    $0x81,%eax
+  8033cf:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  8033d5:	75 29                	jne    803400 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  8033d7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8033db:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033de:	48 89 d6             	mov    %rdx,%rsi
+  8033e1:	89 c7                	mov    %eax,%edi
+  8033e3:	48 b8 7f a1 ff ff ff 	movabs $0xffffffffffffa17f,%rax
+  8033ea:	ff ff ff 
+  8033ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033f1:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  8033f3:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8033fa:	00 
+  8033fb:	e9 ac 00 00 00       	jmp    8034ac <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  803400:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803404:	48 c1 e8 15          	shr    $0x15,%rax
+  803408:	48 89 c2             	mov    %rax,%rdx
+  80340b:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803412:	ff ff ff 
+  803415:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803419:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80341d:	83 e0 01             	and    $0x1,%eax
+  803420:	48 85 c0             	test   %rax,%rax
+  803423:	74 75                	je     80349a <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  803425:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803429:	48 c1 e8 0c          	shr    $0xc,%rax
+  80342d:	48 89 c2             	mov    %rax,%rdx
+  803430:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803437:	ff ff ff 
+  80343a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80343e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803442:	83 e0 01             	and    $0x1,%eax
+  803445:	48 85 c0             	test   %rax,%rax
+  803448:	74 46                	je     803490 <ufork+0x175>
+  80344a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80344e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803452:	48 89 c2             	mov    %rax,%rdx
+  803455:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80345c:	ff ff ff 
+  80345f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803463:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803467:	83 e0 04             	and    $0x4,%eax
+  80346a:	48 85 c0             	test   %rax,%rax
+  80346d:	74 21                	je     803490 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  80346f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803473:	48 c1 e8 0c          	shr    $0xc,%rax
+  803477:	89 c2                	mov    %eax,%edx
+  803479:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80347c:	89 d6                	mov    %edx,%esi
+  80347e:	89 c7                	mov    %eax,%edi
+  803480:	48 b8 3c a0 ff ff ff 	movabs $0xffffffffffffa03c,%rax
+  803487:	ff ff ff 
+  80348a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80348e:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  803490:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  803497:	00 
+  803498:	eb 12                	jmp    8034ac <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  80349a:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8034a1:	00 
+  8034a2:	eb 08                	jmp    8034ac <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  8034a4:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  8034ab:	40 
+		for (; addr < USTACKTOP;){
+  8034ac:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  8034b1:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8034b5:	0f 83 c9 fe ff ff    	jae    803384 <ufork+0x69>
+			}
+		}
+		fork_flush();
+  8034bb:	48 b8 a3 9e ff ff ff 	movabs $0xffffffffffff9ea3,%rax
+  8034c2:	ff ff ff 
+  8034c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034c9:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  8034cb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8034ce:	ba 07 00 00 00       	mov    $0x7,%edx
+  8034d3:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8034d8:	48 89 ce             	mov    %rcx,%rsi
+  8034db:	89 c7                	mov    %eax,%edi
+  8034dd:	49 89 df             	mov    %rbx,%r15
+  8034e0:	48 b8 c4 92 ff ff ff 	movabs $0xffffffffffff92c4,%rax
+  8034e7:	ff ff ff 
+  8034ea:	48 01 d8             	add    %rbx,%rax
+  8034ed:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  8034ef:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8034f2:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8034f9:	ff ff ff 
+  8034fc:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803500:	48 89 d6             	mov    %rdx,%rsi
+  803503:	89 c7                	mov    %eax,%edi
+  803505:	49 89 df             	mov    %rbx,%r15
+  803508:	48 b8 ba 94 ff ff ff 	movabs $0xffffffffffff94ba,%rax
+  80350f:	ff ff ff 
+  803512:	48 01 d8             	add    %rbx,%rax
+  803515:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  803517:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80351a:	be 02 00 00 00       	mov    $0x2,%esi
+  80351f:	89 c7                	mov    %eax,%edi
+  803521:	49 89 df             	mov    %rbx,%r15
+  803524:	48 b8 fb 93 ff ff ff 	movabs $0xffffffffffff93fb,%rax
+  80352b:	ff ff ff 
+  80352e:	48 01 d8             	add    %rbx,%rax
+  803531:	ff d0                	call   *%rax
+  803533:	85 c0                	test   %eax,%eax
+  803535:	74 3e                	je     803575 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803537:	48 b8 3f e5 ff ff ff 	movabs $0xffffffffffffe53f,%rax
+  80353e:	ff ff ff 
+  803541:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803545:	48 89 c2             	mov    %rax,%rdx
+  803548:	be 07 01 00 00       	mov    $0x107,%esi
+  80354d:	48 b8 90 e4 ff ff ff 	movabs $0xffffffffffffe490,%rax
+  803554:	ff ff ff 
+  803557:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80355b:	48 89 c7             	mov    %rax,%rdi
+  80355e:	49 89 df             	mov    %rbx,%r15
+  803561:	b8 00 00 00 00       	mov    $0x0,%eax
+  803566:	48 b9 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%rcx
+  80356d:	ff ff ff 
+  803570:	48 01 d9             	add    %rbx,%rcx
+  803573:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  803575:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803578:	eb 59                	jmp    8035d3 <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80357a:	49 89 df             	mov    %rbx,%r15
+  80357d:	48 b8 1b 92 ff ff ff 	movabs $0xffffffffffff921b,%rax
+  803584:	ff ff ff 
+  803587:	48 01 d8             	add    %rbx,%rax
+  80358a:	ff d0                	call   *%rax
+  80358c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803591:	48 98                	cltq
+  803593:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80359a:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8035a1:	ff ff ff 
+  8035a4:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8035a8:	48 01 c2             	add    %rax,%rdx
+  8035ab:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8035b2:	ff ff ff 
+  8035b5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035b9:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  8035bc:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  8035c3:	00 00 00 
+  8035c6:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  8035cd:	00 
+		return 0;
+  8035ce:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  8035d3:	48 83 c4 10          	add    $0x10,%rsp
+  8035d7:	5b                   	pop    %rbx
+  8035d8:	41 5f                	pop    %r15
+  8035da:	5d                   	pop    %rbp
+  8035db:	c3                   	ret
+
+00000000008035dc <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8035dc:	55                   	push   %rbp
+  8035dd:	48 89 e5             	mov    %rsp,%rbp
+  8035e0:	41 57                	push   %r15
+  8035e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8035e6:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8035e6 <sfork+0xa>
+  8035ed:	49 bb 5a 5a 00 00 00 	movabs $0x5a5a,%r11
+  8035f4:	00 00 00 
+  8035f7:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  8035fa:	48 b8 5a e5 ff ff ff 	movabs $0xffffffffffffe55a,%rax
+  803601:	ff ff ff 
+  803604:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803608:	48 89 c2             	mov    %rax,%rdx
+  80360b:	be 1a 01 00 00       	mov    $0x11a,%esi
+  803610:	48 b8 90 e4 ff ff ff 	movabs $0xffffffffffffe490,%rax
+  803617:	ff ff ff 
+  80361a:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80361e:	48 89 c7             	mov    %rax,%rdi
+  803621:	49 89 cf             	mov    %rcx,%r15
+  803624:	b8 00 00 00 00       	mov    $0x0,%eax
+  803629:	49 b8 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%r8
+  803630:	ff ff ff 
+  803633:	49 01 c8             	add    %rcx,%r8
+  803636:	41 ff d0             	call   *%r8
+
+0000000000803639 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803639:	55                   	push   %rbp
+  80363a:	48 89 e5             	mov    %rsp,%rbp
+  80363d:	41 57                	push   %r15
+  80363f:	53                   	push   %rbx
+  803640:	48 83 ec 30          	sub    $0x30,%rsp
+  803644:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803644 <ipc_recv+0xb>
+  80364b:	49 bb fc 59 00 00 00 	movabs $0x59fc,%r11
+  803652:	00 00 00 
+  803655:	4c 01 db             	add    %r11,%rbx
+  803658:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80365c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803660:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  803664:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803669:	75 0e                	jne    803679 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  80366b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803672:	00 00 00 
+  803675:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  803679:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80367d:	48 89 c7             	mov    %rax,%rdi
+  803680:	49 89 df             	mov    %rbx,%r15
+  803683:	48 b8 ed 95 ff ff ff 	movabs $0xffffffffffff95ed,%rax
+  80368a:	ff ff ff 
+  80368d:	48 01 d8             	add    %rbx,%rax
+  803690:	ff d0                	call   *%rax
+  803692:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  803695:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80369a:	74 2a                	je     8036c6 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  80369c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036a0:	75 19                	jne    8036bb <ipc_recv+0x82>
+  8036a2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8036a9:	ff ff ff 
+  8036ac:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8036b0:	48 8b 00             	mov    (%rax),%rax
+  8036b3:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8036b9:	eb 05                	jmp    8036c0 <ipc_recv+0x87>
+  8036bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8036c4:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8036c6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8036cb:	74 2a                	je     8036f7 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  8036cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036d1:	75 19                	jne    8036ec <ipc_recv+0xb3>
+  8036d3:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8036da:	ff ff ff 
+  8036dd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8036e1:	48 8b 00             	mov    (%rax),%rax
+  8036e4:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8036ea:	eb 05                	jmp    8036f1 <ipc_recv+0xb8>
+  8036ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8036f5:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  8036f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036fb:	74 05                	je     803702 <ipc_recv+0xc9>
+		return res;
+  8036fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803700:	eb 17                	jmp    803719 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  803702:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803709:	ff ff ff 
+  80370c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803710:	48 8b 00             	mov    (%rax),%rax
+  803713:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803719:	48 83 c4 30          	add    $0x30,%rsp
+  80371d:	5b                   	pop    %rbx
+  80371e:	41 5f                	pop    %r15
+  803720:	5d                   	pop    %rbp
+  803721:	c3                   	ret
+
+0000000000803722 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803722:	55                   	push   %rbp
+  803723:	48 89 e5             	mov    %rsp,%rbp
+  803726:	41 57                	push   %r15
+  803728:	53                   	push   %rbx
+  803729:	48 83 ec 20          	sub    $0x20,%rsp
+  80372d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80372d <ipc_send+0xb>
+  803734:	49 bb 13 59 00 00 00 	movabs $0x5913,%r11
+  80373b:	00 00 00 
+  80373e:	4c 01 db             	add    %r11,%rbx
+  803741:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803744:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  803747:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80374b:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  80374e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803753:	75 0e                	jne    803763 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  803755:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80375c:	00 00 00 
+  80375f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  803763:	90                   	nop
+  803764:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  803767:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80376a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80376e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803771:	89 c7                	mov    %eax,%edi
+  803773:	49 89 df             	mov    %rbx,%r15
+  803776:	48 b8 83 95 ff ff ff 	movabs $0xffffffffffff9583,%rax
+  80377d:	ff ff ff 
+  803780:	48 01 d8             	add    %rbx,%rax
+  803783:	ff d0                	call   *%rax
+  803785:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  803788:	74 da                	je     803764 <ipc_send+0x42>
+		;
+}
+  80378a:	90                   	nop
+  80378b:	90                   	nop
+  80378c:	48 83 c4 20          	add    $0x20,%rsp
+  803790:	5b                   	pop    %rbx
+  803791:	41 5f                	pop    %r15
+  803793:	5d                   	pop    %rbp
+  803794:	c3                   	ret
+
+0000000000803795 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  803795:	55                   	push   %rbp
+  803796:	48 89 e5             	mov    %rsp,%rbp
+  803799:	41 57                	push   %r15
+  80379b:	53                   	push   %rbx
+  80379c:	48 83 ec 40          	sub    $0x40,%rsp
+  8037a0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037a0 <ipc_call+0xb>
+  8037a7:	49 bb a0 58 00 00 00 	movabs $0x58a0,%r11
+  8037ae:	00 00 00 
+  8037b1:	4c 01 db             	add    %r11,%rbx
+  8037b4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8037b7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8037ba:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8037be:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8037c1:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8037c5:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8037c9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8037ce:	75 0e                	jne    8037de <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  8037d0:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8037d7:	00 00 00 
+  8037da:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8037de:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8037e3:	75 0e                	jne    8037f3 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8037e5:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8037ec:	00 00 00 
+  8037ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  8037f3:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8037f6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8037fa:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8037fd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803801:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803804:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80380a:	49 89 f8             	mov    %rdi,%r8
+  80380d:	89 c7                	mov    %eax,%edi
+  80380f:	49 89 df             	mov    %rbx,%r15
+  803812:	48 b8 46 96 ff ff ff 	movabs $0xffffffffffff9646,%rax
+  803819:	ff ff ff 
+  80381c:	48 01 d8             	add    %rbx,%rax
+  80381f:	ff d0                	call   *%rax
+  803821:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  803824:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803829:	74 2a                	je     803855 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80382b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80382f:	75 19                	jne    80384a <ipc_call+0xb5>
+  803831:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803838:	ff ff ff 
+  80383b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80383f:	48 8b 00             	mov    (%rax),%rax
+  803842:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803848:	eb 05                	jmp    80384f <ipc_call+0xba>
+  80384a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80384f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803853:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  803855:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803859:	74 05                	je     803860 <ipc_call+0xcb>
+		return r;
+  80385b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80385e:	eb 17                	jmp    803877 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  803860:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803867:	ff ff ff 
+  80386a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80386e:	48 8b 00             	mov    (%rax),%rax
+  803871:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803877:	48 83 c4 40          	add    $0x40,%rsp
+  80387b:	5b                   	pop    %rbx
+  80387c:	41 5f                	pop    %r15
+  80387e:	5d                   	pop    %rbp
+  80387f:	c3                   	ret
+
+0000000000803880 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  803880:	55                   	push   %rbp
+  803881:	48 89 e5             	mov    %rsp,%rbp
+  803884:	41 57                	push   %r15
+  803886:	53                   	push   %rbx
+  803887:	48 83 ec 70          	sub    $0x70,%rsp
+  80388b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80388b <ipc_callw+0xb>
+  803892:	49 bb b5 57 00 00 00 	movabs $0x57b5,%r11
+  803899:	00 00 00 
+  80389c:	4c 01 db             	add    %r11,%rbx
+  80389f:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8038a2:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8038a5:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  8038a9:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  8038ad:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  8038b2:	76 0a                	jbe    8038be <ipc_callw+0x3e>
+		return -E_INVAL;
+  8038b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038b9:	e9 b7 00 00 00       	jmp    803975 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  8038be:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8038c2:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8038c6:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8038ca:	48 89 ce             	mov    %rcx,%rsi
+  8038cd:	48 89 c7             	mov    %rax,%rdi
+  8038d0:	49 89 df             	mov    %rbx,%r15
+  8038d3:	48 b8 e8 89 ff ff ff 	movabs $0xffffffffffff89e8,%rax
+  8038da:	ff ff ff 
+  8038dd:	48 01 d8             	add    %rbx,%rax
+  8038e0:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  8038e2:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8038e9:	00 
+  8038ea:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8038ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038f2:	48 01 d0             	add    %rdx,%rax
+  8038f5:	48 83 e8 01          	sub    $0x1,%rax
+  8038f9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8038fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803901:	ba 00 00 00 00       	mov    $0x0,%edx
+  803906:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80390a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80390e:	48 29 d0             	sub    %rdx,%rax
+  803911:	48 c1 e8 03          	shr    $0x3,%rax
+  803915:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  803919:	89 c1                	mov    %eax,%ecx
+  80391b:	8b 75 98             	mov    -0x68(%rbp),%esi
+  80391e:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  803922:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  803925:	49 89 d1             	mov    %rdx,%r9
+  803928:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  80392f:	00 00 00 
+  803932:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  803939:	00 00 00 
+  80393c:	89 c7                	mov    %eax,%edi
+  80393e:	49 89 df             	mov    %rbx,%r15
+  803941:	48 b8 46 96 ff ff ff 	movabs $0xffffffffffff9646,%rax
+  803948:	ff ff ff 
+  80394b:	48 01 d8             	add    %rbx,%rax
+  80394e:	ff d0                	call   *%rax
+  803950:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  803953:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803957:	74 05                	je     80395e <ipc_callw+0xde>
+		return r;
+  803959:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80395c:	eb 17                	jmp    803975 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  80395e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803965:	ff ff ff 
+  803968:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80396c:	48 8b 00             	mov    (%rax),%rax
+  80396f:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803975:	48 83 c4 70          	add    $0x70,%rsp
+  803979:	5b                   	pop    %rbx
+  80397a:	41 5f                	pop    %r15
+  80397c:	5d                   	pop    %rbp
+  80397d:	c3                   	ret
+
+000000000080397e <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  80397e:	55                   	push   %rbp
+  80397f:	48 89 e5             	mov    %rsp,%rbp
+  803982:	41 57                	push   %r15
+  803984:	53                   	push   %rbx
+  803985:	48 83 ec 40          	sub    $0x40,%rsp
+  803989:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803989 <ipc_callv+0xb>
+  803990:	49 bb b7 56 00 00 00 	movabs $0x56b7,%r11
+  803997:	00 00 00 
+  80399a:	4c 01 db             	add    %r11,%rbx
+  80399d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8039a0:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  8039a3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8039a7:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8039aa:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  8039ae:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  8039b2:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8039b9:	00 00 00 
+  8039bc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  8039c0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  8039c4:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8039c8:	74 11                	je     8039db <ipc_callv+0x5d>
+		pg = (void *) segs;
+  8039ca:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8039ce:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  8039d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039d5:	c1 e0 14             	shl    $0x14,%eax
+  8039d8:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  8039db:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  8039df:	74 14                	je     8039f5 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  8039e1:	8b 45 20             	mov    0x20(%rbp),%eax
+  8039e4:	83 e8 01             	sub    $0x1,%eax
+  8039e7:	48 63 d0             	movslq %eax,%rdx
+  8039ea:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8039ee:	48 09 d0             	or     %rdx,%rax
+  8039f1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  8039f5:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8039f8:	c1 e0 10             	shl    $0x10,%eax
+  8039fb:	0b 45 10             	or     0x10(%rbp),%eax
+  8039fe:	89 c1                	mov    %eax,%ecx
+  803a00:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  803a03:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  803a07:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  803a0b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803a0f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803a12:	4d 89 c1             	mov    %r8,%r9
+  803a15:	49 89 f8             	mov    %rdi,%r8
+  803a18:	89 c7                	mov    %eax,%edi
+  803a1a:	49 89 df             	mov    %rbx,%r15
+  803a1d:	48 b8 46 96 ff ff ff 	movabs $0xffffffffffff9646,%rax
+  803a24:	ff ff ff 
+  803a27:	48 01 d8             	add    %rbx,%rax
+  803a2a:	ff d0                	call   *%rax
+  803a2c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  803a2f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803a33:	74 05                	je     803a3a <ipc_callv+0xbc>
+		return r;
+  803a35:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a38:	eb 17                	jmp    803a51 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  803a3a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803a41:	ff ff ff 
+  803a44:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a48:	48 8b 00             	mov    (%rax),%rax
+  803a4b:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803a51:	48 83 c4 40          	add    $0x40,%rsp
+  803a55:	5b                   	pop    %rbx
+  803a56:	41 5f                	pop    %r15
+  803a58:	5d                   	pop    %rbp
+  803a59:	c3                   	ret
+
+0000000000803a5a <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  803a5a:	55                   	push   %rbp
+  803a5b:	48 89 e5             	mov    %rsp,%rbp
+  803a5e:	41 57                	push   %r15
+  803a60:	53                   	push   %rbx
+  803a61:	48 83 ec 40          	sub    $0x40,%rsp
+  803a65:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a65 <ipc_reply_recv+0xb>
+  803a6c:	49 bb db 55 00 00 00 	movabs $0x55db,%r11
+  803a73:	00 00 00 
+  803a76:	4c 01 db             	add    %r11,%rbx
+  803a79:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803a7c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803a7f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803a83:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803a86:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803a8a:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803a8e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803a93:	75 0e                	jne    803aa3 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  803a95:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803a9c:	00 00 00 
+  803a9f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803aa3:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803aa8:	75 0e                	jne    803ab8 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803aaa:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803ab1:	00 00 00 
+  803ab4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  803ab8:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803abb:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  803abf:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803ac3:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803ac6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803aca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803acd:	4d 89 c1             	mov    %r8,%r9
+  803ad0:	49 89 f8             	mov    %rdi,%r8
+  803ad3:	89 c7                	mov    %eax,%edi
+  803ad5:	49 89 df             	mov    %rbx,%r15
+  803ad8:	48 b8 ba 96 ff ff ff 	movabs $0xffffffffffff96ba,%rax
+  803adf:	ff ff ff 
+  803ae2:	48 01 d8             	add    %rbx,%rax
+  803ae5:	ff d0                	call   *%rax
+  803ae7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  803aea:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803aef:	74 2a                	je     803b1b <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803af1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803af5:	75 19                	jne    803b10 <ipc_reply_recv+0xb6>
+  803af7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803afe:	ff ff ff 
+  803b01:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b05:	48 8b 00             	mov    (%rax),%rax
+  803b08:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803b0e:	eb 05                	jmp    803b15 <ipc_reply_recv+0xbb>
+  803b10:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b19:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  803b1b:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  803b20:	74 2a                	je     803b4c <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803b22:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b26:	75 19                	jne    803b41 <ipc_reply_recv+0xe7>
+  803b28:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803b2f:	ff ff ff 
+  803b32:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b36:	48 8b 00             	mov    (%rax),%rax
+  803b39:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803b3f:	eb 05                	jmp    803b46 <ipc_reply_recv+0xec>
+  803b41:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b46:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  803b4a:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  803b4c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b50:	74 05                	je     803b57 <ipc_reply_recv+0xfd>
+		return r;
+  803b52:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b55:	eb 17                	jmp    803b6e <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  803b57:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803b5e:	ff ff ff 
+  803b61:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b65:	48 8b 00             	mov    (%rax),%rax
+  803b68:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803b6e:	48 83 c4 40          	add    $0x40,%rsp
+  803b72:	5b                   	pop    %rbx
+  803b73:	41 5f                	pop    %r15
+  803b75:	5d                   	pop    %rbp
+  803b76:	c3                   	ret
+
+0000000000803b77 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  803b77:	55                   	push   %rbp
+  803b78:	48 89 e5             	mov    %rsp,%rbp
+  803b7b:	41 57                	push   %r15
+  803b7d:	53                   	push   %rbx
+  803b7e:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  803b85:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b85 <ipc_window_batch+0xe>
+  803b8c:	49 bb bb 54 00 00 00 	movabs $0x54bb,%r11
+  803b93:	00 00 00 
+  803b96:	4c 01 db             	add    %r11,%rbx
+  803b99:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  803b9f:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  803ba6:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  803bac:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  803bb2:	e9 15 01 00 00       	jmp    803ccc <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  803bb7:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  803bbd:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  803bc0:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  803bc7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803bca:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803bcd:	39 c2                	cmp    %eax,%edx
+  803bcf:	0f 4e c2             	cmovle %edx,%eax
+  803bd2:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  803bd5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803bdc:	eb 6b                	jmp    803c49 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  803bde:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803be1:	48 98                	cltq
+  803be3:	48 c1 e0 05          	shl    $0x5,%rax
+  803be7:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803beb:	48 01 e8             	add    %rbp,%rax
+  803bee:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  803bf4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  803bfa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bfd:	c1 e0 0c             	shl    $0xc,%eax
+  803c00:	48 63 d0             	movslq %eax,%rdx
+  803c03:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  803c0a:	48 01 c2             	add    %rax,%rdx
+  803c0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c10:	48 98                	cltq
+  803c12:	48 c1 e0 05          	shl    $0x5,%rax
+  803c16:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803c1a:	48 01 e8             	add    %rbp,%rax
+  803c1d:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  803c23:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  803c26:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c29:	48 98                	cltq
+  803c2b:	48 c1 e0 05          	shl    $0x5,%rax
+  803c2f:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803c33:	48 01 e8             	add    %rbp,%rax
+  803c36:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  803c3d:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  803c43:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  803c45:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803c49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c4c:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  803c4f:	7c 8d                	jl     803bde <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  803c51:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  803c58:	74 27                	je     803c81 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803c5a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803c5d:	48 63 d0             	movslq %eax,%rdx
+  803c60:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803c67:	48 89 d6             	mov    %rdx,%rsi
+  803c6a:	48 89 c7             	mov    %rax,%rdi
+  803c6d:	49 89 df             	mov    %rbx,%r15
+  803c70:	48 b8 5d 99 ff ff ff 	movabs $0xffffffffffff995d,%rax
+  803c77:	ff ff ff 
+  803c7a:	48 01 d8             	add    %rbx,%rax
+  803c7d:	ff d0                	call   *%rax
+  803c7f:	eb 25                	jmp    803ca6 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  803c81:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803c84:	48 63 d0             	movslq %eax,%rdx
+  803c87:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803c8e:	48 89 d6             	mov    %rdx,%rsi
+  803c91:	48 89 c7             	mov    %rax,%rdi
+  803c94:	49 89 df             	mov    %rbx,%r15
+  803c97:	48 b8 bb 99 ff ff ff 	movabs $0xffffffffffff99bb,%rax
+  803c9e:	ff ff ff 
+  803ca1:	48 01 d8             	add    %rbx,%rax
+  803ca4:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803ca6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  803ca9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803cad:	79 05                	jns    803cb4 <ipc_window_batch+0x13d>
+			return r;
+  803caf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cb2:	eb 2a                	jmp    803cde <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  803cb4:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803cb7:	c1 e0 0c             	shl    $0xc,%eax
+  803cba:	48 98                	cltq
+  803cbc:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  803cc3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803cc6:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  803ccc:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  803cd3:	0f 8f de fe ff ff    	jg     803bb7 <ipc_window_batch+0x40>
+	}
+	return 0;
+  803cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cde:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  803ce5:	5b                   	pop    %rbx
+  803ce6:	41 5f                	pop    %r15
+  803ce8:	5d                   	pop    %rbp
+  803ce9:	c3                   	ret
+
+0000000000803cea <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  803cea:	55                   	push   %rbp
+  803ceb:	48 89 e5             	mov    %rsp,%rbp
+  803cee:	48 83 ec 10          	sub    $0x10,%rsp
+  803cf2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803cf2 <ipc_map_window+0x8>
+  803cf9:	49 bb 4e 53 00 00 00 	movabs $0x534e,%r11
+  803d00:	00 00 00 
+  803d03:	4c 01 d8             	add    %r11,%rax
+  803d06:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d0a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  803d0d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803d10:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803d14:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803d19:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d1e:	49 b8 37 ab ff ff ff 	movabs $0xffffffffffffab37,%r8
+  803d25:	ff ff ff 
+  803d28:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803d2c:	ff d0                	call   *%rax
+}
+  803d2e:	c9                   	leave
+  803d2f:	c3                   	ret
+
+0000000000803d30 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  803d30:	55                   	push   %rbp
+  803d31:	48 89 e5             	mov    %rsp,%rbp
+  803d34:	48 83 ec 10          	sub    $0x10,%rsp
+  803d38:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d38 <ipc_unmap_window+0x8>
+  803d3f:	49 bb 08 53 00 00 00 	movabs $0x5308,%r11
+  803d46:	00 00 00 
+  803d49:	4c 01 d8             	add    %r11,%rax
+  803d4c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d50:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  803d53:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803d56:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803d5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d64:	49 b8 37 ab ff ff ff 	movabs $0xffffffffffffab37,%r8
+  803d6b:	ff ff ff 
+  803d6e:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803d72:	ff d0                	call   *%rax
+}
+  803d74:	c9                   	leave
+  803d75:	c3                   	ret
+
+0000000000803d76 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803d76:	55                   	push   %rbp
+  803d77:	48 89 e5             	mov    %rsp,%rbp
+  803d7a:	48 83 ec 18          	sub    $0x18,%rsp
+  803d7e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d7e <ipc_find_env+0x8>
+  803d85:	49 bb c2 52 00 00 00 	movabs $0x52c2,%r11
+  803d8c:	00 00 00 
+  803d8f:	4c 01 d8             	add    %r11,%rax
+  803d92:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  803d95:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803d9c:	eb 57                	jmp    803df5 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  803d9e:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803da5:	ff ff ff 
+  803da8:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  803dac:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803daf:	48 63 d2             	movslq %edx,%rdx
+  803db2:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  803db9:	48 01 ca             	add    %rcx,%rdx
+  803dbc:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  803dc3:	8b 12                	mov    (%rdx),%edx
+  803dc5:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  803dc8:	75 27                	jne    803df1 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  803dca:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803dd1:	ff ff ff 
+  803dd4:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803dd8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ddb:	48 98                	cltq
+  803ddd:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803de4:	48 01 d0             	add    %rdx,%rax
+  803de7:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803ded:	8b 00                	mov    (%rax),%eax
+  803def:	eb 12                	jmp    803e03 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  803df1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803df5:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  803dfc:	7e a0                	jle    803d9e <ipc_find_env+0x28>
+	}
+	return 0;
+  803dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e03:	c9                   	leave
+  803e04:	c3                   	ret
+
+0000000000803e05 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803e05:	55                   	push   %rbp
+  803e06:	48 89 e5             	mov    %rsp,%rbp
+  803e09:	48 83 ec 08          	sub    $0x8,%rsp
+  803e0d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e0d <fd2num+0x8>
+  803e14:	49 bb 33 52 00 00 00 	movabs $0x5233,%r11
+  803e1b:	00 00 00 
+  803e1e:	4c 01 d8             	add    %r11,%rax
+  803e21:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803e25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e29:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803e30:	ff ff ff 
+  803e33:	48 01 d0             	add    %rdx,%rax
+  803e36:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803e3a:	c9                   	leave
+  803e3b:	c3                   	ret
+
+0000000000803e3c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803e3c:	55                   	push   %rbp
+  803e3d:	48 89 e5             	mov    %rsp,%rbp
+  803e40:	48 83 ec 08          	sub    $0x8,%rsp
+  803e44:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e44 <fd2data+0x8>
+  803e4b:	49 bb fc 51 00 00 00 	movabs $0x51fc,%r11
+  803e52:	00 00 00 
+  803e55:	4c 01 d8             	add    %r11,%rax
+  803e58:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803e5c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e60:	48 89 d7             	mov    %rdx,%rdi
+  803e63:	48 ba c5 ad ff ff ff 	movabs $0xffffffffffffadc5,%rdx
+  803e6a:	ff ff ff 
+  803e6d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803e71:	ff d0                	call   *%rax
+  803e73:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803e79:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803e7d:	c9                   	leave
+  803e7e:	c3                   	ret
+
+0000000000803e7f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803e7f:	55                   	push   %rbp
+  803e80:	48 89 e5             	mov    %rsp,%rbp
+  803e83:	48 83 ec 18          	sub    $0x18,%rsp
+  803e87:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e87 <fd_alloc+0x8>
+  803e8e:	49 bb b9 51 00 00 00 	movabs $0x51b9,%r11
+  803e95:	00 00 00 
+  803e98:	4c 01 d8             	add    %r11,%rax
+  803e9b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803e9f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803ea6:	eb 75                	jmp    803f1d <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803ea8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803eab:	48 63 d2             	movslq %edx,%rdx
+  803eae:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803eb5:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803eb9:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803ebd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ec1:	48 89 d1             	mov    %rdx,%rcx
+  803ec4:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ec8:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803ecf:	ff ff ff 
+  803ed2:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803ed6:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803eda:	83 e2 01             	and    $0x1,%edx
+  803edd:	48 85 d2             	test   %rdx,%rdx
+  803ee0:	74 25                	je     803f07 <fd_alloc+0x88>
+  803ee2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ee6:	48 89 d1             	mov    %rdx,%rcx
+  803ee9:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803eed:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803ef4:	ff ff ff 
+  803ef7:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803efb:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803eff:	83 e2 01             	and    $0x1,%edx
+  803f02:	48 85 d2             	test   %rdx,%rdx
+  803f05:	75 12                	jne    803f19 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803f07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f0b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f0f:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f17:	eb 1a                	jmp    803f33 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803f19:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803f1d:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803f21:	7e 85                	jle    803ea8 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803f23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f27:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803f2e:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803f33:	c9                   	leave
+  803f34:	c3                   	ret
+
+0000000000803f35 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803f35:	55                   	push   %rbp
+  803f36:	48 89 e5             	mov    %rsp,%rbp
+  803f39:	48 83 ec 20          	sub    $0x20,%rsp
+  803f3d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803f3d <fd_lookup+0x8>
+  803f44:	49 bb 03 51 00 00 00 	movabs $0x5103,%r11
+  803f4b:	00 00 00 
+  803f4e:	4c 01 d8             	add    %r11,%rax
+  803f51:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803f54:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803f58:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f5c:	78 06                	js     803f64 <fd_lookup+0x2f>
+  803f5e:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803f62:	7e 07                	jle    803f6b <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803f64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f69:	eb 73                	jmp    803fde <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803f6b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803f6e:	48 63 d2             	movslq %edx,%rdx
+  803f71:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803f78:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803f7c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803f80:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f84:	48 89 d1             	mov    %rdx,%rcx
+  803f87:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f8b:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803f92:	ff ff ff 
+  803f95:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803f99:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803f9d:	83 e2 01             	and    $0x1,%edx
+  803fa0:	48 85 d2             	test   %rdx,%rdx
+  803fa3:	74 22                	je     803fc7 <fd_lookup+0x92>
+  803fa5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803fa9:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803fad:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  803fb4:	ff ff ff 
+  803fb7:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803fbb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803fbf:	83 e0 01             	and    $0x1,%eax
+  803fc2:	48 85 c0             	test   %rax,%rax
+  803fc5:	75 07                	jne    803fce <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803fc7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fcc:	eb 10                	jmp    803fde <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803fce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fd2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803fd6:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fde:	c9                   	leave
+  803fdf:	c3                   	ret
+
+0000000000803fe0 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803fe0:	55                   	push   %rbp
+  803fe1:	48 89 e5             	mov    %rsp,%rbp
+  803fe4:	41 57                	push   %r15
+  803fe6:	53                   	push   %rbx
+  803fe7:	48 83 ec 30          	sub    $0x30,%rsp
+  803feb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803feb <fd_close+0xb>
+  803ff2:	49 bb 55 50 00 00 00 	movabs $0x5055,%r11
+  803ff9:	00 00 00 
+  803ffc:	4c 01 db             	add    %r11,%rbx
+  803fff:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804003:	89 f0                	mov    %esi,%eax
+  804005:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  804008:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80400c:	48 89 c7             	mov    %rax,%rdi
+  80400f:	48 b8 c5 ad ff ff ff 	movabs $0xffffffffffffadc5,%rax
+  804016:	ff ff ff 
+  804019:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80401d:	ff d0                	call   *%rax
+  80401f:	89 c2                	mov    %eax,%edx
+  804021:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804025:	48 89 c6             	mov    %rax,%rsi
+  804028:	89 d7                	mov    %edx,%edi
+  80402a:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  804031:	ff ff ff 
+  804034:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804038:	ff d0                	call   *%rax
+  80403a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80403d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804041:	78 0a                	js     80404d <fd_close+0x6d>
+	    || fd != fd2)
+  804043:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804047:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  80404b:	74 12                	je     80405f <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  80404d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  804051:	74 05                	je     804058 <fd_close+0x78>
+  804053:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804056:	eb 7a                	jmp    8040d2 <fd_close+0xf2>
+  804058:	b8 00 00 00 00       	mov    $0x0,%eax
+  80405d:	eb 73                	jmp    8040d2 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80405f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804063:	8b 00                	mov    (%rax),%eax
+  804065:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804069:	48 89 d6             	mov    %rdx,%rsi
+  80406c:	89 c7                	mov    %eax,%edi
+  80406e:	48 b8 9b b0 ff ff ff 	movabs $0xffffffffffffb09b,%rax
+  804075:	ff ff ff 
+  804078:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80407c:	ff d0                	call   *%rax
+  80407e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804081:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804085:	78 2a                	js     8040b1 <fd_close+0xd1>
+		if (dev->dev_close)
+  804087:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80408b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80408f:	48 85 c0             	test   %rax,%rax
+  804092:	74 16                	je     8040aa <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  804094:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804098:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80409c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040a0:	48 89 c7             	mov    %rax,%rdi
+  8040a3:	ff d2                	call   *%rdx
+  8040a5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040a8:	eb 07                	jmp    8040b1 <fd_close+0xd1>
+		else
+			r = 0;
+  8040aa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8040b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040b5:	48 89 c6             	mov    %rax,%rsi
+  8040b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040bd:	49 89 df             	mov    %rbx,%r15
+  8040c0:	48 b8 9c 93 ff ff ff 	movabs $0xffffffffffff939c,%rax
+  8040c7:	ff ff ff 
+  8040ca:	48 01 d8             	add    %rbx,%rax
+  8040cd:	ff d0                	call   *%rax
+	return r;
+  8040cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8040d2:	48 83 c4 30          	add    $0x30,%rsp
+  8040d6:	5b                   	pop    %rbx
+  8040d7:	41 5f                	pop    %r15
+  8040d9:	5d                   	pop    %rbp
+  8040da:	c3                   	ret
+
+00000000008040db <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8040db:	55                   	push   %rbp
+  8040dc:	48 89 e5             	mov    %rsp,%rbp
+  8040df:	41 57                	push   %r15
+  8040e1:	48 83 ec 28          	sub    $0x28,%rsp
+  8040e5:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8040e5 <dev_lookup+0xa>
+  8040ec:	49 bb 5b 4f 00 00 00 	movabs $0x4f5b,%r11
+  8040f3:	00 00 00 
+  8040f6:	4c 01 d9             	add    %r11,%rcx
+  8040f9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8040fc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  804100:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804107:	eb 45                	jmp    80414e <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  804109:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  804110:	00 00 00 
+  804113:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804116:	48 98                	cltq
+  804118:	48 01 ca             	add    %rcx,%rdx
+  80411b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80411f:	8b 00                	mov    (%rax),%eax
+  804121:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  804124:	75 24                	jne    80414a <dev_lookup+0x6f>
+			*dev = devtab[i];
+  804126:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80412d:	00 00 00 
+  804130:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804133:	48 98                	cltq
+  804135:	48 01 ca             	add    %rcx,%rdx
+  804138:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80413c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804140:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  804143:	b8 00 00 00 00       	mov    $0x0,%eax
+  804148:	eb 74                	jmp    8041be <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  80414a:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80414e:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  804155:	00 00 00 
+  804158:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80415b:	48 98                	cltq
+  80415d:	48 01 ca             	add    %rcx,%rdx
+  804160:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804164:	48 85 c0             	test   %rax,%rax
+  804167:	75 a0                	jne    804109 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  804169:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804170:	ff ff ff 
+  804173:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  804177:	48 8b 00             	mov    (%rax),%rax
+  80417a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804180:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804183:	89 c6                	mov    %eax,%esi
+  804185:	48 b8 70 e5 ff ff ff 	movabs $0xffffffffffffe570,%rax
+  80418c:	ff ff ff 
+  80418f:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  804193:	48 89 c7             	mov    %rax,%rdi
+  804196:	49 89 cf             	mov    %rcx,%r15
+  804199:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419e:	49 b8 46 78 ff ff ff 	movabs $0xffffffffffff7846,%r8
+  8041a5:	ff ff ff 
+  8041a8:	49 01 c8             	add    %rcx,%r8
+  8041ab:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8041ae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8041b2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8041b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8041be:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8041c2:	c9                   	leave
+  8041c3:	c3                   	ret
+
+00000000008041c4 <close>:
+
+int
+close(int fdnum)
+{
+  8041c4:	55                   	push   %rbp
+  8041c5:	48 89 e5             	mov    %rsp,%rbp
+  8041c8:	53                   	push   %rbx
+  8041c9:	48 83 ec 28          	sub    $0x28,%rsp
+  8041cd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041cd <close+0x9>
+  8041d4:	49 bb 73 4e 00 00 00 	movabs $0x4e73,%r11
+  8041db:	00 00 00 
+  8041de:	4c 01 db             	add    %r11,%rbx
+  8041e1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8041e4:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8041e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041eb:	48 89 d6             	mov    %rdx,%rsi
+  8041ee:	89 c7                	mov    %eax,%edi
+  8041f0:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  8041f7:	ff ff ff 
+  8041fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041fe:	ff d0                	call   *%rax
+  804200:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804203:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804207:	79 05                	jns    80420e <close+0x4a>
+		return r;
+  804209:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80420c:	eb 1c                	jmp    80422a <close+0x66>
+	else
+		return fd_close(fd, 1);
+  80420e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804212:	be 01 00 00 00       	mov    $0x1,%esi
+  804217:	48 89 c7             	mov    %rax,%rdi
+  80421a:	48 b8 a0 af ff ff ff 	movabs $0xffffffffffffafa0,%rax
+  804221:	ff ff ff 
+  804224:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804228:	ff d0                	call   *%rax
+}
+  80422a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80422e:	c9                   	leave
+  80422f:	c3                   	ret
+
+0000000000804230 <close_all>:
+
+void
+close_all(void)
+{
+  804230:	55                   	push   %rbp
+  804231:	48 89 e5             	mov    %rsp,%rbp
+  804234:	53                   	push   %rbx
+  804235:	48 83 ec 18          	sub    $0x18,%rsp
+  804239:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804239 <close_all+0x9>
+  804240:	49 bb 07 4e 00 00 00 	movabs $0x4e07,%r11
+  804247:	00 00 00 
+  80424a:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80424d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804254:	eb 19                	jmp    80426f <close_all+0x3f>
+		close(i);
+  804256:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804259:	89 c7                	mov    %eax,%edi
+  80425b:	48 b8 84 b1 ff ff ff 	movabs $0xffffffffffffb184,%rax
+  804262:	ff ff ff 
+  804265:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804269:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  80426b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80426f:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  804273:	7e e1                	jle    804256 <close_all+0x26>
+}
+  804275:	90                   	nop
+  804276:	90                   	nop
+  804277:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80427b:	c9                   	leave
+  80427c:	c3                   	ret
+
+000000000080427d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80427d:	55                   	push   %rbp
+  80427e:	48 89 e5             	mov    %rsp,%rbp
+  804281:	41 57                	push   %r15
+  804283:	53                   	push   %rbx
+  804284:	48 83 ec 40          	sub    $0x40,%rsp
+  804288:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804288 <dup+0xb>
+  80428f:	49 bb b8 4d 00 00 00 	movabs $0x4db8,%r11
+  804296:	00 00 00 
+  804299:	4c 01 db             	add    %r11,%rbx
+  80429c:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80429f:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8042a2:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8042a6:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8042a9:	48 89 d6             	mov    %rdx,%rsi
+  8042ac:	89 c7                	mov    %eax,%edi
+  8042ae:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  8042b5:	ff ff ff 
+  8042b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042bc:	ff d0                	call   *%rax
+  8042be:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042c5:	79 08                	jns    8042cf <dup+0x52>
+		return r;
+  8042c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042ca:	e9 a4 01 00 00       	jmp    804473 <dup+0x1f6>
+	close(newfdnum);
+  8042cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8042d2:	89 c7                	mov    %eax,%edi
+  8042d4:	48 b8 84 b1 ff ff ff 	movabs $0xffffffffffffb184,%rax
+  8042db:	ff ff ff 
+  8042de:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042e2:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  8042e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8042e7:	48 98                	cltq
+  8042e9:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8042ef:	48 c1 e0 0c          	shl    $0xc,%rax
+  8042f3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  8042f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042fb:	48 89 c7             	mov    %rax,%rdi
+  8042fe:	48 b8 fc ad ff ff ff 	movabs $0xffffffffffffadfc,%rax
+  804305:	ff ff ff 
+  804308:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80430c:	ff d0                	call   *%rax
+  80430e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  804312:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804316:	48 89 c7             	mov    %rax,%rdi
+  804319:	48 b8 fc ad ff ff ff 	movabs $0xffffffffffffadfc,%rax
+  804320:	ff ff ff 
+  804323:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804327:	ff d0                	call   *%rax
+  804329:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80432d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804331:	48 c1 e8 15          	shr    $0x15,%rax
+  804335:	48 89 c2             	mov    %rax,%rdx
+  804338:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80433f:	ff ff ff 
+  804342:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804346:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80434a:	83 e0 01             	and    $0x1,%eax
+  80434d:	48 85 c0             	test   %rax,%rax
+  804350:	74 7f                	je     8043d1 <dup+0x154>
+  804352:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804356:	48 c1 e8 0c          	shr    $0xc,%rax
+  80435a:	48 89 c2             	mov    %rax,%rdx
+  80435d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804364:	ff ff ff 
+  804367:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80436b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80436f:	83 e0 01             	and    $0x1,%eax
+  804372:	48 85 c0             	test   %rax,%rax
+  804375:	74 5a                	je     8043d1 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  804377:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80437b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80437f:	48 89 c2             	mov    %rax,%rdx
+  804382:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804389:	ff ff ff 
+  80438c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804390:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804394:	25 07 0e 00 00       	and    $0xe07,%eax
+  804399:	89 c1                	mov    %eax,%ecx
+  80439b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80439f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043a3:	41 89 c8             	mov    %ecx,%r8d
+  8043a6:	48 89 d1             	mov    %rdx,%rcx
+  8043a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043ae:	48 89 c6             	mov    %rax,%rsi
+  8043b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043b6:	49 89 df             	mov    %rbx,%r15
+  8043b9:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  8043c0:	ff ff ff 
+  8043c3:	48 01 d8             	add    %rbx,%rax
+  8043c6:	ff d0                	call   *%rax
+  8043c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043cf:	78 5f                	js     804430 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8043d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043d5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8043d9:	48 89 c2             	mov    %rax,%rdx
+  8043dc:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8043e3:	ff ff ff 
+  8043e6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8043ea:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8043ee:	25 07 0e 00 00       	and    $0xe07,%eax
+  8043f3:	89 c1                	mov    %eax,%ecx
+  8043f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043f9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8043fd:	41 89 c8             	mov    %ecx,%r8d
+  804400:	48 89 d1             	mov    %rdx,%rcx
+  804403:	ba 00 00 00 00       	mov    $0x0,%edx
+  804408:	48 89 c6             	mov    %rax,%rsi
+  80440b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804410:	49 89 df             	mov    %rbx,%r15
+  804413:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  80441a:	ff ff ff 
+  80441d:	48 01 d8             	add    %rbx,%rax
+  804420:	ff d0                	call   *%rax
+  804422:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804425:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804429:	78 08                	js     804433 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  80442b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80442e:	eb 43                	jmp    804473 <dup+0x1f6>
+			goto err;
+  804430:	90                   	nop
+  804431:	eb 01                	jmp    804434 <dup+0x1b7>
+		goto err;
+  804433:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  804434:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804438:	48 89 c6             	mov    %rax,%rsi
+  80443b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804440:	49 89 df             	mov    %rbx,%r15
+  804443:	48 b8 9c 93 ff ff ff 	movabs $0xffffffffffff939c,%rax
+  80444a:	ff ff ff 
+  80444d:	48 01 d8             	add    %rbx,%rax
+  804450:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  804452:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804456:	48 89 c6             	mov    %rax,%rsi
+  804459:	bf 00 00 00 00       	mov    $0x0,%edi
+  80445e:	49 89 df             	mov    %rbx,%r15
+  804461:	48 b8 9c 93 ff ff ff 	movabs $0xffffffffffff939c,%rax
+  804468:	ff ff ff 
+  80446b:	48 01 d8             	add    %rbx,%rax
+  80446e:	ff d0                	call   *%rax
+	return r;
+  804470:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804473:	48 83 c4 40          	add    $0x40,%rsp
+  804477:	5b                   	pop    %rbx
+  804478:	41 5f                	pop    %r15
+  80447a:	5d                   	pop    %rbp
+  80447b:	c3                   	ret
+
+000000000080447c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80447c:	55                   	push   %rbp
+  80447d:	48 89 e5             	mov    %rsp,%rbp
+  804480:	41 57                	push   %r15
+  804482:	53                   	push   %rbx
+  804483:	48 83 ec 40          	sub    $0x40,%rsp
+  804487:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804487 <read+0xb>
+  80448e:	49 bb b9 4b 00 00 00 	movabs $0x4bb9,%r11
+  804495:	00 00 00 
+  804498:	4c 01 db             	add    %r11,%rbx
+  80449b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80449e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8044a2:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8044a6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8044aa:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8044ad:	48 89 d6             	mov    %rdx,%rsi
+  8044b0:	89 c7                	mov    %eax,%edi
+  8044b2:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  8044b9:	ff ff ff 
+  8044bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044c0:	ff d0                	call   *%rax
+  8044c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044c9:	78 28                	js     8044f3 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8044cb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044cf:	8b 00                	mov    (%rax),%eax
+  8044d1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8044d5:	48 89 d6             	mov    %rdx,%rsi
+  8044d8:	89 c7                	mov    %eax,%edi
+  8044da:	48 b8 9b b0 ff ff ff 	movabs $0xffffffffffffb09b,%rax
+  8044e1:	ff ff ff 
+  8044e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044e8:	ff d0                	call   *%rax
+  8044ea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044f1:	79 08                	jns    8044fb <read+0x7f>
+		return r;
+  8044f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044f6:	e9 8b 00 00 00       	jmp    804586 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8044fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044ff:	8b 40 08             	mov    0x8(%rax),%eax
+  804502:	83 e0 03             	and    $0x3,%eax
+  804505:	83 f8 01             	cmp    $0x1,%eax
+  804508:	75 4b                	jne    804555 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80450a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804511:	ff ff ff 
+  804514:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804518:	48 8b 00             	mov    (%rax),%rax
+  80451b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804521:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804524:	89 c6                	mov    %eax,%esi
+  804526:	48 b8 8f e5 ff ff ff 	movabs $0xffffffffffffe58f,%rax
+  80452d:	ff ff ff 
+  804530:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804534:	48 89 c7             	mov    %rax,%rdi
+  804537:	49 89 df             	mov    %rbx,%r15
+  80453a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80453f:	48 b9 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rcx
+  804546:	ff ff ff 
+  804549:	48 01 d9             	add    %rbx,%rcx
+  80454c:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80454e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804553:	eb 31                	jmp    804586 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  804555:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804559:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80455d:	48 85 c0             	test   %rax,%rax
+  804560:	75 07                	jne    804569 <read+0xed>
+		return -E_NOT_SUPP;
+  804562:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804567:	eb 1d                	jmp    804586 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  804569:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80456d:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  804571:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804575:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804579:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80457d:	48 89 ce             	mov    %rcx,%rsi
+  804580:	48 89 c7             	mov    %rax,%rdi
+  804583:	41 ff d0             	call   *%r8
+}
+  804586:	48 83 c4 40          	add    $0x40,%rsp
+  80458a:	5b                   	pop    %rbx
+  80458b:	41 5f                	pop    %r15
+  80458d:	5d                   	pop    %rbp
+  80458e:	c3                   	ret
+
+000000000080458f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80458f:	55                   	push   %rbp
+  804590:	48 89 e5             	mov    %rsp,%rbp
+  804593:	53                   	push   %rbx
+  804594:	48 83 ec 38          	sub    $0x38,%rsp
+  804598:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804598 <readn+0x9>
+  80459f:	49 bb a8 4a 00 00 00 	movabs $0x4aa8,%r11
+  8045a6:	00 00 00 
+  8045a9:	4c 01 db             	add    %r11,%rbx
+  8045ac:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8045af:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8045b3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8045b7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8045be:	eb 4b                	jmp    80460b <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8045c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045c3:	48 98                	cltq
+  8045c5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8045c9:	48 29 c2             	sub    %rax,%rdx
+  8045cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045cf:	48 63 c8             	movslq %eax,%rcx
+  8045d2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8045d6:	48 01 c1             	add    %rax,%rcx
+  8045d9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045dc:	48 89 ce             	mov    %rcx,%rsi
+  8045df:	89 c7                	mov    %eax,%edi
+  8045e1:	48 b8 3c b4 ff ff ff 	movabs $0xffffffffffffb43c,%rax
+  8045e8:	ff ff ff 
+  8045eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045ef:	ff d0                	call   *%rax
+  8045f1:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  8045f4:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8045f8:	79 05                	jns    8045ff <readn+0x70>
+			return m;
+  8045fa:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8045fd:	eb 1d                	jmp    80461c <readn+0x8d>
+		if (m == 0)
+  8045ff:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804603:	74 13                	je     804618 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  804605:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804608:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80460b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80460e:	48 98                	cltq
+  804610:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  804614:	72 aa                	jb     8045c0 <readn+0x31>
+  804616:	eb 01                	jmp    804619 <readn+0x8a>
+			break;
+  804618:	90                   	nop
+	}
+	return tot;
+  804619:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80461c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804620:	c9                   	leave
+  804621:	c3                   	ret
+
+0000000000804622 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  804622:	55                   	push   %rbp
+  804623:	48 89 e5             	mov    %rsp,%rbp
+  804626:	41 57                	push   %r15
+  804628:	53                   	push   %rbx
+  804629:	48 83 ec 40          	sub    $0x40,%rsp
+  80462d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80462d <write+0xb>
+  804634:	49 bb 13 4a 00 00 00 	movabs $0x4a13,%r11
+  80463b:	00 00 00 
+  80463e:	4c 01 db             	add    %r11,%rbx
+  804641:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804644:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804648:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80464c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804650:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804653:	48 89 d6             	mov    %rdx,%rsi
+  804656:	89 c7                	mov    %eax,%edi
+  804658:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  80465f:	ff ff ff 
+  804662:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804666:	ff d0                	call   *%rax
+  804668:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80466b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80466f:	78 28                	js     804699 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804671:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804675:	8b 00                	mov    (%rax),%eax
+  804677:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80467b:	48 89 d6             	mov    %rdx,%rsi
+  80467e:	89 c7                	mov    %eax,%edi
+  804680:	48 b8 9b b0 ff ff ff 	movabs $0xffffffffffffb09b,%rax
+  804687:	ff ff ff 
+  80468a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80468e:	ff d0                	call   *%rax
+  804690:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804693:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804697:	79 08                	jns    8046a1 <write+0x7f>
+		return r;
+  804699:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80469c:	e9 8a 00 00 00       	jmp    80472b <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8046a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046a5:	8b 40 08             	mov    0x8(%rax),%eax
+  8046a8:	83 e0 03             	and    $0x3,%eax
+  8046ab:	85 c0                	test   %eax,%eax
+  8046ad:	75 4b                	jne    8046fa <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8046af:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8046b6:	ff ff ff 
+  8046b9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8046bd:	48 8b 00             	mov    (%rax),%rax
+  8046c0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046c6:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8046c9:	89 c6                	mov    %eax,%esi
+  8046cb:	48 b8 ab e5 ff ff ff 	movabs $0xffffffffffffe5ab,%rax
+  8046d2:	ff ff ff 
+  8046d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046d9:	48 89 c7             	mov    %rax,%rdi
+  8046dc:	49 89 df             	mov    %rbx,%r15
+  8046df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046e4:	48 b9 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rcx
+  8046eb:	ff ff ff 
+  8046ee:	48 01 d9             	add    %rbx,%rcx
+  8046f1:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8046f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8046f8:	eb 31                	jmp    80472b <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8046fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046fe:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804702:	48 85 c0             	test   %rax,%rax
+  804705:	75 07                	jne    80470e <write+0xec>
+		return -E_NOT_SUPP;
+  804707:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80470c:	eb 1d                	jmp    80472b <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  80470e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804712:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  804716:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80471a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80471e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804722:	48 89 ce             	mov    %rcx,%rsi
+  804725:	48 89 c7             	mov    %rax,%rdi
+  804728:	41 ff d0             	call   *%r8
+}
+  80472b:	48 83 c4 40          	add    $0x40,%rsp
+  80472f:	5b                   	pop    %rbx
+  804730:	41 5f                	pop    %r15
+  804732:	5d                   	pop    %rbp
+  804733:	c3                   	ret
+
+0000000000804734 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  804734:	55                   	push   %rbp
+  804735:	48 89 e5             	mov    %rsp,%rbp
+  804738:	48 83 ec 18          	sub    $0x18,%rsp
+  80473c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80473c <seek+0x8>
+  804743:	49 bb 04 49 00 00 00 	movabs $0x4904,%r11
+  80474a:	00 00 00 
+  80474d:	4c 01 d8             	add    %r11,%rax
+  804750:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804753:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804756:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  80475a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80475d:	48 89 ce             	mov    %rcx,%rsi
+  804760:	89 d7                	mov    %edx,%edi
+  804762:	48 ba f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rdx
+  804769:	ff ff ff 
+  80476c:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804770:	ff d0                	call   *%rax
+  804772:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804775:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804779:	79 05                	jns    804780 <seek+0x4c>
+		return r;
+  80477b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80477e:	eb 0f                	jmp    80478f <seek+0x5b>
+	fd->fd_offset = offset;
+  804780:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804784:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804787:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  80478a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80478f:	c9                   	leave
+  804790:	c3                   	ret
+
+0000000000804791 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  804791:	55                   	push   %rbp
+  804792:	48 89 e5             	mov    %rsp,%rbp
+  804795:	41 57                	push   %r15
+  804797:	53                   	push   %rbx
+  804798:	48 83 ec 30          	sub    $0x30,%rsp
+  80479c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80479c <ftruncate+0xb>
+  8047a3:	49 bb a4 48 00 00 00 	movabs $0x48a4,%r11
+  8047aa:	00 00 00 
+  8047ad:	4c 01 db             	add    %r11,%rbx
+  8047b0:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8047b3:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8047b6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8047ba:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8047bd:	48 89 d6             	mov    %rdx,%rsi
+  8047c0:	89 c7                	mov    %eax,%edi
+  8047c2:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  8047c9:	ff ff ff 
+  8047cc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047d0:	ff d0                	call   *%rax
+  8047d2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047d5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047d9:	78 28                	js     804803 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8047db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047df:	8b 00                	mov    (%rax),%eax
+  8047e1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8047e5:	48 89 d6             	mov    %rdx,%rsi
+  8047e8:	89 c7                	mov    %eax,%edi
+  8047ea:	48 b8 9b b0 ff ff ff 	movabs $0xffffffffffffb09b,%rax
+  8047f1:	ff ff ff 
+  8047f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047f8:	ff d0                	call   *%rax
+  8047fa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804801:	79 08                	jns    80480b <ftruncate+0x7a>
+		return r;
+  804803:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804806:	e9 83 00 00 00       	jmp    80488e <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80480b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80480f:	8b 40 08             	mov    0x8(%rax),%eax
+  804812:	83 e0 03             	and    $0x3,%eax
+  804815:	85 c0                	test   %eax,%eax
+  804817:	75 4b                	jne    804864 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  804819:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804820:	ff ff ff 
+  804823:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804827:	48 8b 00             	mov    (%rax),%rax
+  80482a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  804830:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804833:	89 c6                	mov    %eax,%esi
+  804835:	48 b8 c8 e5 ff ff ff 	movabs $0xffffffffffffe5c8,%rax
+  80483c:	ff ff ff 
+  80483f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804843:	48 89 c7             	mov    %rax,%rdi
+  804846:	49 89 df             	mov    %rbx,%r15
+  804849:	b8 00 00 00 00       	mov    $0x0,%eax
+  80484e:	48 b9 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rcx
+  804855:	ff ff ff 
+  804858:	48 01 d9             	add    %rbx,%rcx
+  80485b:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80485d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804862:	eb 2a                	jmp    80488e <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  804864:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804868:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80486c:	48 85 c0             	test   %rax,%rax
+  80486f:	75 07                	jne    804878 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  804871:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804876:	eb 16                	jmp    80488e <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  804878:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80487c:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  804880:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804884:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  804887:	89 d6                	mov    %edx,%esi
+  804889:	48 89 c7             	mov    %rax,%rdi
+  80488c:	ff d1                	call   *%rcx
+}
+  80488e:	48 83 c4 30          	add    $0x30,%rsp
+  804892:	5b                   	pop    %rbx
+  804893:	41 5f                	pop    %r15
+  804895:	5d                   	pop    %rbp
+  804896:	c3                   	ret
+
+0000000000804897 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  804897:	55                   	push   %rbp
+  804898:	48 89 e5             	mov    %rsp,%rbp
+  80489b:	53                   	push   %rbx
+  80489c:	48 83 ec 38          	sub    $0x38,%rsp
+  8048a0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048a0 <fstat+0x9>
+  8048a7:	49 bb a0 47 00 00 00 	movabs $0x47a0,%r11
+  8048ae:	00 00 00 
+  8048b1:	4c 01 db             	add    %r11,%rbx
+  8048b4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8048b7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8048bb:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8048bf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8048c2:	48 89 d6             	mov    %rdx,%rsi
+  8048c5:	89 c7                	mov    %eax,%edi
+  8048c7:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  8048ce:	ff ff ff 
+  8048d1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048d5:	ff d0                	call   *%rax
+  8048d7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8048da:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8048de:	78 28                	js     804908 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8048e0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048e4:	8b 00                	mov    (%rax),%eax
+  8048e6:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8048ea:	48 89 d6             	mov    %rdx,%rsi
+  8048ed:	89 c7                	mov    %eax,%edi
+  8048ef:	48 b8 9b b0 ff ff ff 	movabs $0xffffffffffffb09b,%rax
+  8048f6:	ff ff ff 
+  8048f9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048fd:	ff d0                	call   *%rax
+  8048ff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804902:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804906:	79 05                	jns    80490d <fstat+0x76>
+		return r;
+  804908:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80490b:	eb 5e                	jmp    80496b <fstat+0xd4>
+	if (!dev->dev_stat)
+  80490d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804911:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804915:	48 85 c0             	test   %rax,%rax
+  804918:	75 07                	jne    804921 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  80491a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80491f:	eb 4a                	jmp    80496b <fstat+0xd4>
+	stat->st_name[0] = 0;
+  804921:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804925:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  804928:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80492c:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804933:	00 00 00 
+	stat->st_isdir = 0;
+  804936:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80493a:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804941:	00 00 00 
+	stat->st_dev = dev;
+  804944:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804948:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80494c:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  804953:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804957:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80495b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80495f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804963:	48 89 d6             	mov    %rdx,%rsi
+  804966:	48 89 c7             	mov    %rax,%rdi
+  804969:	ff d1                	call   *%rcx
+}
+  80496b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80496f:	c9                   	leave
+  804970:	c3                   	ret
+
+0000000000804971 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804971:	55                   	push   %rbp
+  804972:	48 89 e5             	mov    %rsp,%rbp
+  804975:	41 57                	push   %r15
+  804977:	53                   	push   %rbx
+  804978:	48 83 ec 20          	sub    $0x20,%rsp
+  80497c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80497c <stat+0xb>
+  804983:	49 bb c4 46 00 00 00 	movabs $0x46c4,%r11
+  80498a:	00 00 00 
+  80498d:	4c 01 db             	add    %r11,%rbx
+  804990:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804994:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804998:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80499c:	be 00 00 00 00       	mov    $0x0,%esi
+  8049a1:	48 89 c7             	mov    %rax,%rdi
+  8049a4:	49 89 df             	mov    %rbx,%r15
+  8049a7:	48 b8 0b bc ff ff ff 	movabs $0xffffffffffffbc0b,%rax
+  8049ae:	ff ff ff 
+  8049b1:	48 01 d8             	add    %rbx,%rax
+  8049b4:	ff d0                	call   *%rax
+  8049b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049b9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049bd:	79 05                	jns    8049c4 <stat+0x53>
+		return fd;
+  8049bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049c2:	eb 37                	jmp    8049fb <stat+0x8a>
+	r = fstat(fd, stat);
+  8049c4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8049c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049cb:	48 89 d6             	mov    %rdx,%rsi
+  8049ce:	89 c7                	mov    %eax,%edi
+  8049d0:	48 b8 57 b8 ff ff ff 	movabs $0xffffffffffffb857,%rax
+  8049d7:	ff ff ff 
+  8049da:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049de:	ff d0                	call   *%rax
+  8049e0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8049e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049e6:	89 c7                	mov    %eax,%edi
+  8049e8:	48 b8 84 b1 ff ff ff 	movabs $0xffffffffffffb184,%rax
+  8049ef:	ff ff ff 
+  8049f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049f6:	ff d0                	call   *%rax
+	return r;
+  8049f8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8049fb:	48 83 c4 20          	add    $0x20,%rsp
+  8049ff:	5b                   	pop    %rbx
+  804a00:	41 5f                	pop    %r15
+  804a02:	5d                   	pop    %rbp
+  804a03:	c3                   	ret
+
+0000000000804a04 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  804a04:	55                   	push   %rbp
+  804a05:	48 89 e5             	mov    %rsp,%rbp
+  804a08:	41 57                	push   %r15
+  804a0a:	53                   	push   %rbx
+  804a0b:	48 83 ec 10          	sub    $0x10,%rsp
+  804a0f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a0f <fsipc+0xb>
+  804a16:	49 bb 31 46 00 00 00 	movabs $0x4631,%r11
+  804a1d:	00 00 00 
+  804a20:	4c 01 db             	add    %r11,%rbx
+  804a23:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804a26:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  804a2a:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804a31:	00 00 00 
+  804a34:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a37:	85 c0                	test   %eax,%eax
+  804a39:	75 24                	jne    804a5f <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804a3b:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a40:	49 89 df             	mov    %rbx,%r15
+  804a43:	48 b8 36 ad ff ff ff 	movabs $0xffffffffffffad36,%rax
+  804a4a:	ff ff ff 
+  804a4d:	48 01 d8             	add    %rbx,%rax
+  804a50:	ff d0                	call   *%rax
+  804a52:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804a59:	00 00 00 
+  804a5c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  804a5f:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804a66:	00 00 00 
+  804a69:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a6c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804a70:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804a73:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804a79:	49 89 d0             	mov    %rdx,%r8
+  804a7c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804a81:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804a88:	00 00 00 
+  804a8b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804a8f:	89 c7                	mov    %eax,%edi
+  804a91:	49 89 df             	mov    %rbx,%r15
+  804a94:	48 b8 55 a7 ff ff ff 	movabs $0xffffffffffffa755,%rax
+  804a9b:	ff ff ff 
+  804a9e:	48 01 d8             	add    %rbx,%rax
+  804aa1:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  804aa3:	48 83 c4 10          	add    $0x10,%rsp
+  804aa7:	5b                   	pop    %rbx
+  804aa8:	41 5f                	pop    %r15
+  804aaa:	5d                   	pop    %rbp
+  804aab:	c3                   	ret
+
+0000000000804aac <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  804aac:	55                   	push   %rbp
+  804aad:	48 89 e5             	mov    %rsp,%rbp
+  804ab0:	41 57                	push   %r15
+  804ab2:	53                   	push   %rbx
+  804ab3:	48 83 ec 20          	sub    $0x20,%rsp
+  804ab7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ab7 <fsipc_words+0xb>
+  804abe:	49 bb 89 45 00 00 00 	movabs $0x4589,%r11
+  804ac5:	00 00 00 
+  804ac8:	4c 01 db             	add    %r11,%rbx
+  804acb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804ace:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804ad2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  804ad6:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804add:	00 00 00 
+  804ae0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ae3:	85 c0                	test   %eax,%eax
+  804ae5:	75 24                	jne    804b0b <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804ae7:	bf 01 00 00 00       	mov    $0x1,%edi
+  804aec:	49 89 df             	mov    %rbx,%r15
+  804aef:	48 b8 36 ad ff ff ff 	movabs $0xffffffffffffad36,%rax
+  804af6:	ff ff ff 
+  804af9:	48 01 d8             	add    %rbx,%rax
+  804afc:	ff d0                	call   *%rax
+  804afe:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804b05:	00 00 00 
+  804b08:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  804b0b:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804b12:	00 00 00 
+  804b15:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b18:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804b1c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804b20:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804b23:	89 c7                	mov    %eax,%edi
+  804b25:	49 89 df             	mov    %rbx,%r15
+  804b28:	48 b8 40 a8 ff ff ff 	movabs $0xffffffffffffa840,%rax
+  804b2f:	ff ff ff 
+  804b32:	48 01 d8             	add    %rbx,%rax
+  804b35:	ff d0                	call   *%rax
+}
+  804b37:	48 83 c4 20          	add    $0x20,%rsp
+  804b3b:	5b                   	pop    %rbx
+  804b3c:	41 5f                	pop    %r15
+  804b3e:	5d                   	pop    %rbp
+  804b3f:	c3                   	ret
+
+0000000000804b40 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804b40:	55                   	push   %rbp
+  804b41:	48 89 e5             	mov    %rsp,%rbp
+  804b44:	41 57                	push   %r15
+  804b46:	53                   	push   %rbx
+  804b47:	48 83 ec 40          	sub    $0x40,%rsp
+  804b4b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b4b <fsipc_pages+0xb>
+  804b52:	49 bb f5 44 00 00 00 	movabs $0x44f5,%r11
+  804b59:	00 00 00 
+  804b5c:	4c 01 db             	add    %r11,%rbx
+  804b5f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804b62:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804b66:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804b6a:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  804b6d:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804b74:	00 00 00 
+  804b77:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b7a:	85 c0                	test   %eax,%eax
+  804b7c:	75 24                	jne    804ba2 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804b7e:	bf 01 00 00 00       	mov    $0x1,%edi
+  804b83:	49 89 df             	mov    %rbx,%r15
+  804b86:	48 b8 36 ad ff ff ff 	movabs $0xffffffffffffad36,%rax
+  804b8d:	ff ff ff 
+  804b90:	48 01 d8             	add    %rbx,%rax
+  804b93:	ff d0                	call   *%rax
+  804b95:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804b9c:	00 00 00 
+  804b9f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  804ba2:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804ba7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804bab:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804bae:	48 98                	cltq
+  804bb0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  804bb4:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804bb8:	0f 95 c0             	setne  %al
+  804bbb:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804bbe:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804bc5:	00 
+  804bc6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804bca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bce:	48 01 d0             	add    %rdx,%rax
+  804bd1:	48 83 e8 01          	sub    $0x1,%rax
+  804bd5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804bd9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  804be2:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804be6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bea:	48 29 d0             	sub    %rdx,%rax
+  804bed:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804bf1:	41 89 c2             	mov    %eax,%r10d
+  804bf4:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804bfb:	00 00 00 
+  804bfe:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c01:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804c05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804c09:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804c0c:	48 83 ec 08          	sub    $0x8,%rsp
+  804c10:	6a 40                	push   $0x40
+  804c12:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804c17:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804c1e:	00 
+  804c1f:	6a 05                	push   $0x5
+  804c21:	41 89 f9             	mov    %edi,%r9d
+  804c24:	49 89 c8             	mov    %rcx,%r8
+  804c27:	44 89 d1             	mov    %r10d,%ecx
+  804c2a:	89 c7                	mov    %eax,%edi
+  804c2c:	49 89 df             	mov    %rbx,%r15
+  804c2f:	48 b8 3e a9 ff ff ff 	movabs $0xffffffffffffa93e,%rax
+  804c36:	ff ff ff 
+  804c39:	48 01 d8             	add    %rbx,%rax
+  804c3c:	ff d0                	call   *%rax
+  804c3e:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804c42:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804c46:	5b                   	pop    %rbx
+  804c47:	41 5f                	pop    %r15
+  804c49:	5d                   	pop    %rbp
+  804c4a:	c3                   	ret
+
+0000000000804c4b <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804c4b:	55                   	push   %rbp
+  804c4c:	48 89 e5             	mov    %rsp,%rbp
+  804c4f:	41 57                	push   %r15
+  804c51:	53                   	push   %rbx
+  804c52:	48 83 ec 20          	sub    $0x20,%rsp
+  804c56:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c56 <open+0xb>
+  804c5d:	49 bb ea 43 00 00 00 	movabs $0x43ea,%r11
+  804c64:	00 00 00 
+  804c67:	4c 01 db             	add    %r11,%rbx
+  804c6a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804c6e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804c71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c75:	48 89 c7             	mov    %rax,%rdi
+  804c78:	49 89 df             	mov    %rbx,%r15
+  804c7b:	48 b8 74 85 ff ff ff 	movabs $0xffffffffffff8574,%rax
+  804c82:	ff ff ff 
+  804c85:	48 01 d8             	add    %rbx,%rax
+  804c88:	ff d0                	call   *%rax
+  804c8a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804c8f:	7e 0a                	jle    804c9b <open+0x50>
+		return -E_BAD_PATH;
+  804c91:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804c96:	e9 18 01 00 00       	jmp    804db3 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804c9b:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804c9f:	48 89 c7             	mov    %rax,%rdi
+  804ca2:	49 89 df             	mov    %rbx,%r15
+  804ca5:	48 b8 3f ae ff ff ff 	movabs $0xffffffffffffae3f,%rax
+  804cac:	ff ff ff 
+  804caf:	48 01 d8             	add    %rbx,%rax
+  804cb2:	ff d0                	call   *%rax
+  804cb4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cb7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cbb:	74 08                	je     804cc5 <open+0x7a>
+		return r;
+  804cbd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cc0:	e9 ee 00 00 00       	jmp    804db3 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804cc5:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804ccc:	00 00 00 
+  804ccf:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804cd2:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804cd9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cdd:	48 89 c6             	mov    %rax,%rsi
+  804ce0:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804ce7:	00 00 00 
+  804cea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cee:	48 89 c7             	mov    %rax,%rdi
+  804cf1:	49 89 df             	mov    %rbx,%r15
+  804cf4:	48 b8 08 86 ff ff ff 	movabs $0xffffffffffff8608,%rax
+  804cfb:	ff ff ff 
+  804cfe:	48 01 d8             	add    %rbx,%rax
+  804d01:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804d03:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d07:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804d0c:	48 89 c6             	mov    %rax,%rsi
+  804d0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d14:	49 89 df             	mov    %rbx,%r15
+  804d17:	48 b8 c4 92 ff ff ff 	movabs $0xffffffffffff92c4,%rax
+  804d1e:	ff ff ff 
+  804d21:	48 01 d8             	add    %rbx,%rax
+  804d24:	ff d0                	call   *%rax
+  804d26:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d29:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d2d:	74 23                	je     804d52 <open+0x107>
+		fd_close(fd,0);
+  804d2f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d33:	be 00 00 00 00       	mov    $0x0,%esi
+  804d38:	48 89 c7             	mov    %rax,%rdi
+  804d3b:	49 89 df             	mov    %rbx,%r15
+  804d3e:	48 b8 a0 af ff ff ff 	movabs $0xffffffffffffafa0,%rax
+  804d45:	ff ff ff 
+  804d48:	48 01 d8             	add    %rbx,%rax
+  804d4b:	ff d0                	call   *%rax
+		return r;
+  804d4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d50:	eb 61                	jmp    804db3 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804d52:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d56:	48 89 c6             	mov    %rax,%rsi
+  804d59:	bf 01 00 00 00       	mov    $0x1,%edi
+  804d5e:	48 b8 c4 b9 ff ff ff 	movabs $0xffffffffffffb9c4,%rax
+  804d65:	ff ff ff 
+  804d68:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d6c:	ff d0                	call   *%rax
+  804d6e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d71:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d75:	74 23                	je     804d9a <open+0x14f>
+		fd_close(fd,0);
+  804d77:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d7b:	be 00 00 00 00       	mov    $0x0,%esi
+  804d80:	48 89 c7             	mov    %rax,%rdi
+  804d83:	49 89 df             	mov    %rbx,%r15
+  804d86:	48 b8 a0 af ff ff ff 	movabs $0xffffffffffffafa0,%rax
+  804d8d:	ff ff ff 
+  804d90:	48 01 d8             	add    %rbx,%rax
+  804d93:	ff d0                	call   *%rax
+		return r;
+  804d95:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d98:	eb 19                	jmp    804db3 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804d9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d9e:	48 89 c7             	mov    %rax,%rdi
+  804da1:	49 89 df             	mov    %rbx,%r15
+  804da4:	48 b8 c5 ad ff ff ff 	movabs $0xffffffffffffadc5,%rax
+  804dab:	ff ff ff 
+  804dae:	48 01 d8             	add    %rbx,%rax
+  804db1:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804db3:	48 83 c4 20          	add    $0x20,%rsp
+  804db7:	5b                   	pop    %rbx
+  804db8:	41 5f                	pop    %r15
+  804dba:	5d                   	pop    %rbp
+  804dbb:	c3                   	ret
+
+0000000000804dbc <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804dbc:	55                   	push   %rbp
+  804dbd:	48 89 e5             	mov    %rsp,%rbp
+  804dc0:	48 83 ec 20          	sub    $0x20,%rsp
+  804dc4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804dc4 <devfile_flush+0x8>
+  804dcb:	49 bb 7c 42 00 00 00 	movabs $0x427c,%r11
+  804dd2:	00 00 00 
+  804dd5:	4c 01 d8             	add    %r11,%rax
+  804dd8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804ddc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804de0:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804de3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804de6:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804dea:	ba 04 00 00 00       	mov    $0x4,%edx
+  804def:	48 89 ce             	mov    %rcx,%rsi
+  804df2:	bf 06 00 00 00       	mov    $0x6,%edi
+  804df7:	48 b9 6c ba ff ff ff 	movabs $0xffffffffffffba6c,%rcx
+  804dfe:	ff ff ff 
+  804e01:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804e05:	ff d0                	call   *%rax
+}
+  804e07:	c9                   	leave
+  804e08:	c3                   	ret
+
+0000000000804e09 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804e09:	55                   	push   %rbp
+  804e0a:	48 89 e5             	mov    %rsp,%rbp
+  804e0d:	41 57                	push   %r15
+  804e0f:	53                   	push   %rbx
+  804e10:	48 83 ec 60          	sub    $0x60,%rsp
+  804e14:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e14 <devfile_read+0xb>
+  804e1b:	49 bb 2c 42 00 00 00 	movabs $0x422c,%r11
+  804e22:	00 00 00 
+  804e25:	4c 01 db             	add    %r11,%rbx
+  804e28:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804e2c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804e30:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804e34:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804e38:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804e3c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e40:	8b 50 0c             	mov    0xc(%rax),%edx
+  804e43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e47:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804e49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e4d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804e51:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804e55:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804e59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804e5e:	ba 10 00 00 00       	mov    $0x10,%edx
+  804e63:	48 89 c6             	mov    %rax,%rsi
+  804e66:	bf 03 00 00 00       	mov    $0x3,%edi
+  804e6b:	48 b8 00 bb ff ff ff 	movabs $0xffffffffffffbb00,%rax
+  804e72:	ff ff ff 
+  804e75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e79:	ff d0                	call   *%rax
+  804e7b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804e7e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804e82:	79 05                	jns    804e89 <devfile_read+0x80>
+		return r;
+  804e84:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e87:	eb 64                	jmp    804eed <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804e89:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e8c:	48 63 d0             	movslq %eax,%rdx
+  804e8f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804e93:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804e98:	48 01 c1             	add    %rax,%rcx
+  804e9b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804e9f:	48 89 ce             	mov    %rcx,%rsi
+  804ea2:	48 89 c7             	mov    %rax,%rdi
+  804ea5:	49 89 df             	mov    %rbx,%r15
+  804ea8:	48 b8 e8 89 ff ff ff 	movabs $0xffffffffffff89e8,%rax
+  804eaf:	ff ff ff 
+  804eb2:	48 01 d8             	add    %rbx,%rax
+  804eb5:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804eb7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804ebe:	ff ff ff 
+  804ec1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804ec5:	48 8b 00             	mov    (%rax),%rax
+  804ec8:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804ece:	89 c6                	mov    %eax,%esi
+  804ed0:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804ed5:	48 89 c7             	mov    %rax,%rdi
+  804ed8:	49 89 df             	mov    %rbx,%r15
+  804edb:	48 b8 f0 ac ff ff ff 	movabs $0xffffffffffffacf0,%rax
+  804ee2:	ff ff ff 
+  804ee5:	48 01 d8             	add    %rbx,%rax
+  804ee8:	ff d0                	call   *%rax
+	return r;
+  804eea:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804eed:	48 83 c4 60          	add    $0x60,%rsp
+  804ef1:	5b                   	pop    %rbx
+  804ef2:	41 5f                	pop    %r15
+  804ef4:	5d                   	pop    %rbp
+  804ef5:	c3                   	ret
+
+0000000000804ef6 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804ef6:	55                   	push   %rbp
+  804ef7:	48 89 e5             	mov    %rsp,%rbp
+  804efa:	41 57                	push   %r15
+  804efc:	53                   	push   %rbx
+  804efd:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804f01:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f01 <devfile_write+0xb>
+  804f08:	49 bb 3f 41 00 00 00 	movabs $0x413f,%r11
+  804f0f:	00 00 00 
+  804f12:	4c 01 db             	add    %r11,%rbx
+  804f15:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804f19:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804f1d:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804f24:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804f28:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804f2c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804f33:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804f37:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804f3e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f41:	48 63 d0             	movslq %eax,%rdx
+  804f44:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f48:	48 39 c2             	cmp    %rax,%rdx
+  804f4b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f4f:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804f56:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804f5d:	00 
+  804f5e:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804f65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f69:	48 01 d0             	add    %rdx,%rax
+  804f6c:	48 83 e8 01          	sub    $0x1,%rax
+  804f70:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804f74:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f7d:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804f81:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f85:	48 29 d0             	sub    %rdx,%rax
+  804f88:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f8c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804f8f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804f92:	89 c6                	mov    %eax,%esi
+  804f94:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804f99:	48 89 c7             	mov    %rax,%rdi
+  804f9c:	49 89 df             	mov    %rbx,%r15
+  804f9f:	48 b8 aa ac ff ff ff 	movabs $0xffffffffffffacaa,%rax
+  804fa6:	ff ff ff 
+  804fa9:	48 01 d8             	add    %rbx,%rax
+  804fac:	ff d0                	call   *%rax
+  804fae:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804fb1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804fb5:	79 08                	jns    804fbf <devfile_write+0xc9>
+		return r;
+  804fb7:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804fba:	e9 8f 00 00 00       	jmp    80504e <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804fbf:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804fc6:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804fca:	48 89 c6             	mov    %rax,%rsi
+  804fcd:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804fd2:	48 89 c7             	mov    %rax,%rdi
+  804fd5:	49 89 df             	mov    %rbx,%r15
+  804fd8:	48 b8 e8 89 ff ff ff 	movabs $0xffffffffffff89e8,%rax
+  804fdf:	ff ff ff 
+  804fe2:	48 01 d8             	add    %rbx,%rax
+  804fe5:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804fe7:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804feb:	8b 50 0c             	mov    0xc(%rax),%edx
+  804fee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ff2:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804ff4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ff8:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804fff:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  805003:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  805006:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80500a:	89 d1                	mov    %edx,%ecx
+  80500c:	ba 10 00 00 00       	mov    $0x10,%edx
+  805011:	48 89 c6             	mov    %rax,%rsi
+  805014:	bf 04 00 00 00       	mov    $0x4,%edi
+  805019:	48 b8 00 bb ff ff ff 	movabs $0xffffffffffffbb00,%rax
+  805020:	ff ff ff 
+  805023:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805027:	ff d0                	call   *%rax
+  805029:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  80502c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80502f:	89 c6                	mov    %eax,%esi
+  805031:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  805036:	48 89 c7             	mov    %rax,%rdi
+  805039:	49 89 df             	mov    %rbx,%r15
+  80503c:	48 b8 f0 ac ff ff ff 	movabs $0xffffffffffffacf0,%rax
+  805043:	ff ff ff 
+  805046:	48 01 d8             	add    %rbx,%rax
+  805049:	ff d0                	call   *%rax
+	return r;
+  80504b:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  80504e:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  805052:	5b                   	pop    %rbx
+  805053:	41 5f                	pop    %r15
+  805055:	5d                   	pop    %rbp
+  805056:	c3                   	ret
+
+0000000000805057 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  805057:	55                   	push   %rbp
+  805058:	48 89 e5             	mov    %rsp,%rbp
+  80505b:	41 57                	push   %r15
+  80505d:	53                   	push   %rbx
+  80505e:	48 83 ec 20          	sub    $0x20,%rsp
+  805062:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805062 <devfile_stat+0xb>
+  805069:	49 bb de 3f 00 00 00 	movabs $0x3fde,%r11
+  805070:	00 00 00 
+  805073:	4c 01 db             	add    %r11,%rbx
+  805076:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80507a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80507e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805082:	8b 40 0c             	mov    0xc(%rax),%eax
+  805085:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80508c:	00 00 00 
+  80508f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  805092:	be 00 00 00 00       	mov    $0x0,%esi
+  805097:	bf 05 00 00 00       	mov    $0x5,%edi
+  80509c:	48 b8 c4 b9 ff ff ff 	movabs $0xffffffffffffb9c4,%rax
+  8050a3:	ff ff ff 
+  8050a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050aa:	ff d0                	call   *%rax
+  8050ac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050af:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050b3:	79 05                	jns    8050ba <devfile_stat+0x63>
+		return r;
+  8050b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050b8:	eb 65                	jmp    80511f <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8050ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8050be:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8050c5:	00 00 00 
+  8050c8:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8050cc:	48 89 d6             	mov    %rdx,%rsi
+  8050cf:	48 89 c7             	mov    %rax,%rdi
+  8050d2:	49 89 df             	mov    %rbx,%r15
+  8050d5:	48 b8 08 86 ff ff ff 	movabs $0xffffffffffff8608,%rax
+  8050dc:	ff ff ff 
+  8050df:	48 01 d8             	add    %rbx,%rax
+  8050e2:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8050e4:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8050eb:	00 00 00 
+  8050ee:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  8050f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8050f9:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8050ff:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  805106:	00 00 00 
+  805109:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  805110:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805114:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  80511a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80511f:	48 83 c4 20          	add    $0x20,%rsp
+  805123:	5b                   	pop    %rbx
+  805124:	41 5f                	pop    %r15
+  805126:	5d                   	pop    %rbp
+  805127:	c3                   	ret
+
+0000000000805128 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  805128:	55                   	push   %rbp
+  805129:	48 89 e5             	mov    %rsp,%rbp
+  80512c:	48 83 ec 20          	sub    $0x20,%rsp
+  805130:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805130 <devfile_trunc+0x8>
+  805137:	49 bb 10 3f 00 00 00 	movabs $0x3f10,%r11
+  80513e:	00 00 00 
+  805141:	4c 01 d8             	add    %r11,%rax
+  805144:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805148:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  80514b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80514f:	8b 52 0c             	mov    0xc(%rdx),%edx
+  805152:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  805155:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805158:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  80515b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80515f:	ba 08 00 00 00       	mov    $0x8,%edx
+  805164:	48 89 ce             	mov    %rcx,%rsi
+  805167:	bf 02 00 00 00       	mov    $0x2,%edi
+  80516c:	48 b9 6c ba ff ff ff 	movabs $0xffffffffffffba6c,%rcx
+  805173:	ff ff ff 
+  805176:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80517a:	ff d0                	call   *%rax
+}
+  80517c:	c9                   	leave
+  80517d:	c3                   	ret
+
+000000000080517e <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80517e:	55                   	push   %rbp
+  80517f:	48 89 e5             	mov    %rsp,%rbp
+  805182:	41 57                	push   %r15
+  805184:	53                   	push   %rbx
+  805185:	48 83 ec 10          	sub    $0x10,%rsp
+  805189:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805189 <remove+0xb>
+  805190:	49 bb b7 3e 00 00 00 	movabs $0x3eb7,%r11
+  805197:	00 00 00 
+  80519a:	4c 01 db             	add    %r11,%rbx
+  80519d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8051a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051a5:	48 89 c7             	mov    %rax,%rdi
+  8051a8:	49 89 df             	mov    %rbx,%r15
+  8051ab:	48 b8 74 85 ff ff ff 	movabs $0xffffffffffff8574,%rax
+  8051b2:	ff ff ff 
+  8051b5:	48 01 d8             	add    %rbx,%rax
+  8051b8:	ff d0                	call   *%rax
+  8051ba:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8051bf:	7e 07                	jle    8051c8 <remove+0x4a>
+		return -E_BAD_PATH;
+  8051c1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8051c6:	eb 44                	jmp    80520c <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8051c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051cc:	48 89 c6             	mov    %rax,%rsi
+  8051cf:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8051d6:	00 00 00 
+  8051d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051dd:	48 89 c7             	mov    %rax,%rdi
+  8051e0:	49 89 df             	mov    %rbx,%r15
+  8051e3:	48 b8 08 86 ff ff ff 	movabs $0xffffffffffff8608,%rax
+  8051ea:	ff ff ff 
+  8051ed:	48 01 d8             	add    %rbx,%rax
+  8051f0:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  8051f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8051f7:	bf 07 00 00 00       	mov    $0x7,%edi
+  8051fc:	48 b8 c4 b9 ff ff ff 	movabs $0xffffffffffffb9c4,%rax
+  805203:	ff ff ff 
+  805206:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80520a:	ff d0                	call   *%rax
+}
+  80520c:	48 83 c4 10          	add    $0x10,%rsp
+  805210:	5b                   	pop    %rbx
+  805211:	41 5f                	pop    %r15
+  805213:	5d                   	pop    %rbp
+  805214:	c3                   	ret
+
+0000000000805215 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  805215:	55                   	push   %rbp
+  805216:	48 89 e5             	mov    %rsp,%rbp
+  805219:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805219 <sync+0x4>
+  805220:	49 bb 27 3e 00 00 00 	movabs $0x3e27,%r11
+  805227:	00 00 00 
+  80522a:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  80522d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805232:	be 00 00 00 00       	mov    $0x0,%esi
+  805237:	bf 08 00 00 00       	mov    $0x8,%edi
+  80523c:	48 b9 6c ba ff ff ff 	movabs $0xffffffffffffba6c,%rcx
+  805243:	ff ff ff 
+  805246:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80524a:	ff d0                	call   *%rax
+}
+  80524c:	5d                   	pop    %rbp
+  80524d:	c3                   	ret
+
+000000000080524e <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  80524e:	55                   	push   %rbp
+  80524f:	48 89 e5             	mov    %rsp,%rbp
+  805252:	41 57                	push   %r15
+  805254:	53                   	push   %rbx
+  805255:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  80525c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80525c <copy+0xe>
+  805263:	49 bb e4 3d 00 00 00 	movabs $0x3de4,%r11
+  80526a:	00 00 00 
+  80526d:	4c 01 db             	add    %r11,%rbx
+  805270:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  805277:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  80527e:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  805285:	be 00 00 00 00       	mov    $0x0,%esi
+  80528a:	48 89 c7             	mov    %rax,%rdi
+  80528d:	48 b8 0b bc ff ff ff 	movabs $0xffffffffffffbc0b,%rax
+  805294:	ff ff ff 
+  805297:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80529b:	ff d0                	call   *%rax
+  80529d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8052a0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052a4:	79 35                	jns    8052db <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8052a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052a9:	89 c6                	mov    %eax,%esi
+  8052ab:	48 b8 ee e5 ff ff ff 	movabs $0xffffffffffffe5ee,%rax
+  8052b2:	ff ff ff 
+  8052b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052b9:	48 89 c7             	mov    %rax,%rdi
+  8052bc:	49 89 df             	mov    %rbx,%r15
+  8052bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052c4:	48 ba 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rdx
+  8052cb:	ff ff ff 
+  8052ce:	48 01 da             	add    %rbx,%rdx
+  8052d1:	ff d2                	call   *%rdx
+		return fd_src;
+  8052d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052d6:	e9 d7 01 00 00       	jmp    8054b2 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  8052db:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  8052e2:	be 01 01 00 00       	mov    $0x101,%esi
+  8052e7:	48 89 c7             	mov    %rax,%rdi
+  8052ea:	48 b8 0b bc ff ff ff 	movabs $0xffffffffffffbc0b,%rax
+  8052f1:	ff ff ff 
+  8052f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052f8:	ff d0                	call   *%rax
+  8052fa:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  8052fd:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  805301:	0f 89 df 00 00 00    	jns    8053e6 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  805307:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80530a:	89 c6                	mov    %eax,%esi
+  80530c:	48 b8 04 e6 ff ff ff 	movabs $0xffffffffffffe604,%rax
+  805313:	ff ff ff 
+  805316:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80531a:	48 89 c7             	mov    %rax,%rdi
+  80531d:	49 89 df             	mov    %rbx,%r15
+  805320:	b8 00 00 00 00       	mov    $0x0,%eax
+  805325:	48 ba 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rdx
+  80532c:	ff ff ff 
+  80532f:	48 01 da             	add    %rbx,%rdx
+  805332:	ff d2                	call   *%rdx
+		close(fd_src);
+  805334:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805337:	89 c7                	mov    %eax,%edi
+  805339:	49 89 df             	mov    %rbx,%r15
+  80533c:	48 b8 84 b1 ff ff ff 	movabs $0xffffffffffffb184,%rax
+  805343:	ff ff ff 
+  805346:	48 01 d8             	add    %rbx,%rax
+  805349:	ff d0                	call   *%rax
+		return fd_dest;
+  80534b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80534e:	e9 5f 01 00 00       	jmp    8054b2 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  805353:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805356:	48 63 d0             	movslq %eax,%rdx
+  805359:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  805360:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805363:	48 89 ce             	mov    %rcx,%rsi
+  805366:	89 c7                	mov    %eax,%edi
+  805368:	49 89 df             	mov    %rbx,%r15
+  80536b:	48 b8 e2 b5 ff ff ff 	movabs $0xffffffffffffb5e2,%rax
+  805372:	ff ff ff 
+  805375:	48 01 d8             	add    %rbx,%rax
+  805378:	ff d0                	call   *%rax
+  80537a:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  80537d:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  805381:	79 63                	jns    8053e6 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  805383:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805386:	89 c6                	mov    %eax,%esi
+  805388:	48 b8 1e e6 ff ff ff 	movabs $0xffffffffffffe61e,%rax
+  80538f:	ff ff ff 
+  805392:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805396:	48 89 c7             	mov    %rax,%rdi
+  805399:	49 89 df             	mov    %rbx,%r15
+  80539c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053a1:	48 ba 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rdx
+  8053a8:	ff ff ff 
+  8053ab:	48 01 da             	add    %rbx,%rdx
+  8053ae:	ff d2                	call   *%rdx
+			close(fd_src);
+  8053b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053b3:	89 c7                	mov    %eax,%edi
+  8053b5:	49 89 df             	mov    %rbx,%r15
+  8053b8:	48 b8 84 b1 ff ff ff 	movabs $0xffffffffffffb184,%rax
+  8053bf:	ff ff ff 
+  8053c2:	48 01 d8             	add    %rbx,%rax
+  8053c5:	ff d0                	call   *%rax
+			close(fd_dest);
+  8053c7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053ca:	89 c7                	mov    %eax,%edi
+  8053cc:	49 89 df             	mov    %rbx,%r15
+  8053cf:	48 b8 84 b1 ff ff ff 	movabs $0xffffffffffffb184,%rax
+  8053d6:	ff ff ff 
+  8053d9:	48 01 d8             	add    %rbx,%rax
+  8053dc:	ff d0                	call   *%rax
+			return write_size;
+  8053de:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8053e1:	e9 cc 00 00 00       	jmp    8054b2 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  8053e6:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8053ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053f0:	ba 00 02 00 00       	mov    $0x200,%edx
+  8053f5:	48 89 ce             	mov    %rcx,%rsi
+  8053f8:	89 c7                	mov    %eax,%edi
+  8053fa:	49 89 df             	mov    %rbx,%r15
+  8053fd:	48 b8 3c b4 ff ff ff 	movabs $0xffffffffffffb43c,%rax
+  805404:	ff ff ff 
+  805407:	48 01 d8             	add    %rbx,%rax
+  80540a:	ff d0                	call   *%rax
+  80540c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80540f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805413:	0f 8f 3a ff ff ff    	jg     805353 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  805419:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80541d:	79 60                	jns    80547f <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  80541f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805422:	89 c6                	mov    %eax,%esi
+  805424:	48 b8 31 e6 ff ff ff 	movabs $0xffffffffffffe631,%rax
+  80542b:	ff ff ff 
+  80542e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805432:	48 89 c7             	mov    %rax,%rdi
+  805435:	49 89 df             	mov    %rbx,%r15
+  805438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80543d:	48 ba 46 78 ff ff ff 	movabs $0xffffffffffff7846,%rdx
+  805444:	ff ff ff 
+  805447:	48 01 da             	add    %rbx,%rdx
+  80544a:	ff d2                	call   *%rdx
+		close(fd_src);
+  80544c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80544f:	89 c7                	mov    %eax,%edi
+  805451:	49 89 df             	mov    %rbx,%r15
+  805454:	48 b8 84 b1 ff ff ff 	movabs $0xffffffffffffb184,%rax
+  80545b:	ff ff ff 
+  80545e:	48 01 d8             	add    %rbx,%rax
+  805461:	ff d0                	call   *%rax
+		close(fd_dest);
+  805463:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805466:	89 c7                	mov    %eax,%edi
+  805468:	49 89 df             	mov    %rbx,%r15
+  80546b:	48 b8 84 b1 ff ff ff 	movabs $0xffffffffffffb184,%rax
+  805472:	ff ff ff 
+  805475:	48 01 d8             	add    %rbx,%rax
+  805478:	ff d0                	call   *%rax
+		return read_size;
+  80547a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80547d:	eb 33                	jmp    8054b2 <copy+0x264>
+	}
+	close(fd_src);
+  80547f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805482:	89 c7                	mov    %eax,%edi
+  805484:	49 89 df             	mov    %rbx,%r15
+  805487:	48 b8 84 b1 ff ff ff 	movabs $0xffffffffffffb184,%rax
+  80548e:	ff ff ff 
+  805491:	48 01 d8             	add    %rbx,%rax
+  805494:	ff d0                	call   *%rax
+	close(fd_dest);
+  805496:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805499:	89 c7                	mov    %eax,%edi
+  80549b:	49 89 df             	mov    %rbx,%r15
+  80549e:	48 b8 84 b1 ff ff ff 	movabs $0xffffffffffffb184,%rax
+  8054a5:	ff ff ff 
+  8054a8:	48 01 d8             	add    %rbx,%rax
+  8054ab:	ff d0                	call   *%rax
+	return 0;
+  8054ad:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  8054b2:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  8054b9:	5b                   	pop    %rbx
+  8054ba:	41 5f                	pop    %r15
+  8054bc:	5d                   	pop    %rbp
+  8054bd:	c3                   	ret
+
+00000000008054be <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8054be:	55                   	push   %rbp
+  8054bf:	48 89 e5             	mov    %rsp,%rbp
+  8054c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8054c6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8054c6 <pageref+0x8>
+  8054cd:	49 bb 7a 3b 00 00 00 	movabs $0x3b7a,%r11
+  8054d4:	00 00 00 
+  8054d7:	4c 01 d8             	add    %r11,%rax
+  8054da:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  8054de:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8054e2:	48 89 d1             	mov    %rdx,%rcx
+  8054e5:	48 c1 e9 15          	shr    $0x15,%rcx
+  8054e9:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8054f0:	ff ff ff 
+  8054f3:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8054f7:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8054fb:	83 e2 01             	and    $0x1,%edx
+  8054fe:	48 85 d2             	test   %rdx,%rdx
+  805501:	75 07                	jne    80550a <pageref+0x4c>
+		return 0;
+  805503:	b8 00 00 00 00       	mov    $0x0,%eax
+  805508:	eb 64                	jmp    80556e <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  80550a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80550e:	48 89 d1             	mov    %rdx,%rcx
+  805511:	48 c1 e9 0c          	shr    $0xc,%rcx
+  805515:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  80551c:	ff ff ff 
+  80551f:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805523:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805527:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  80552b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80552f:	83 e2 01             	and    $0x1,%edx
+  805532:	48 85 d2             	test   %rdx,%rdx
+  805535:	75 07                	jne    80553e <pageref+0x80>
+		return 0;
+  805537:	b8 00 00 00 00       	mov    $0x0,%eax
+  80553c:	eb 30                	jmp    80556e <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  80553e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805542:	48 c1 ea 0c          	shr    $0xc,%rdx
+  805546:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  80554d:	ff ff ff 
+  805550:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  805554:	48 89 d0             	mov    %rdx,%rax
+  805557:	48 01 c0             	add    %rax,%rax
+  80555a:	48 01 d0             	add    %rdx,%rax
+  80555d:	48 c1 e0 03          	shl    $0x3,%rax
+  805561:	48 01 c8             	add    %rcx,%rax
+  805564:	48 83 c0 08          	add    $0x8,%rax
+  805568:	0f b7 00             	movzwl (%rax),%eax
+  80556b:	0f b7 c0             	movzwl %ax,%eax
+}
+  80556e:	c9                   	leave
+  80556f:	c3                   	ret
+
+0000000000805570 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  805570:	55                   	push   %rbp
+  805571:	48 89 e5             	mov    %rsp,%rbp
+  805574:	41 57                	push   %r15
+  805576:	53                   	push   %rbx
+  805577:	48 83 ec 20          	sub    $0x20,%rsp
+  80557b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80557b <fd2sockid+0xb>
+  805582:	49 bb c5 3a 00 00 00 	movabs $0x3ac5,%r11
+  805589:	00 00 00 
+  80558c:	4c 01 db             	add    %r11,%rbx
+  80558f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  805592:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805596:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805599:	48 89 d6             	mov    %rdx,%rsi
+  80559c:	89 c7                	mov    %eax,%edi
+  80559e:	49 89 df             	mov    %rbx,%r15
+  8055a1:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  8055a8:	ff ff ff 
+  8055ab:	48 01 d8             	add    %rbx,%rax
+  8055ae:	ff d0                	call   *%rax
+  8055b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055b7:	79 05                	jns    8055be <fd2sockid+0x4e>
+		return r;
+  8055b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055bc:	eb 25                	jmp    8055e3 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8055be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055c2:	8b 10                	mov    (%rax),%edx
+  8055c4:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  8055cb:	00 00 00 
+  8055ce:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8055d1:	39 c2                	cmp    %eax,%edx
+  8055d3:	74 07                	je     8055dc <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  8055d5:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8055da:	eb 07                	jmp    8055e3 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8055dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055e0:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8055e3:	48 83 c4 20          	add    $0x20,%rsp
+  8055e7:	5b                   	pop    %rbx
+  8055e8:	41 5f                	pop    %r15
+  8055ea:	5d                   	pop    %rbp
+  8055eb:	c3                   	ret
+
+00000000008055ec <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8055ec:	55                   	push   %rbp
+  8055ed:	48 89 e5             	mov    %rsp,%rbp
+  8055f0:	41 57                	push   %r15
+  8055f2:	53                   	push   %rbx
+  8055f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8055f7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055f7 <alloc_sockfd+0xb>
+  8055fe:	49 bb 49 3a 00 00 00 	movabs $0x3a49,%r11
+  805605:	00 00 00 
+  805608:	4c 01 db             	add    %r11,%rbx
+  80560b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  80560e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805612:	48 89 c7             	mov    %rax,%rdi
+  805615:	49 89 df             	mov    %rbx,%r15
+  805618:	48 b8 3f ae ff ff ff 	movabs $0xffffffffffffae3f,%rax
+  80561f:	ff ff ff 
+  805622:	48 01 d8             	add    %rbx,%rax
+  805625:	ff d0                	call   *%rax
+  805627:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80562a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80562e:	78 2c                	js     80565c <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  805630:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805634:	ba 07 04 00 00       	mov    $0x407,%edx
+  805639:	48 89 c6             	mov    %rax,%rsi
+  80563c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805641:	49 89 df             	mov    %rbx,%r15
+  805644:	48 b8 c4 92 ff ff ff 	movabs $0xffffffffffff92c4,%rax
+  80564b:	ff ff ff 
+  80564e:	48 01 d8             	add    %rbx,%rax
+  805651:	ff d0                	call   *%rax
+  805653:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805656:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80565a:	79 1c                	jns    805678 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  80565c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80565f:	89 c7                	mov    %eax,%edi
+  805661:	49 89 df             	mov    %rbx,%r15
+  805664:	48 b8 a0 cd ff ff ff 	movabs $0xffffffffffffcda0,%rax
+  80566b:	ff ff ff 
+  80566e:	48 01 d8             	add    %rbx,%rax
+  805671:	ff d0                	call   *%rax
+		return r;
+  805673:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805676:	eb 41                	jmp    8056b9 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  805678:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80567c:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  805683:	00 00 00 
+  805686:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805689:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  80568b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80568f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  805696:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80569a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80569d:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  8056a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056a4:	48 89 c7             	mov    %rax,%rdi
+  8056a7:	49 89 df             	mov    %rbx,%r15
+  8056aa:	48 b8 c5 ad ff ff ff 	movabs $0xffffffffffffadc5,%rax
+  8056b1:	ff ff ff 
+  8056b4:	48 01 d8             	add    %rbx,%rax
+  8056b7:	ff d0                	call   *%rax
+}
+  8056b9:	48 83 c4 20          	add    $0x20,%rsp
+  8056bd:	5b                   	pop    %rbx
+  8056be:	41 5f                	pop    %r15
+  8056c0:	5d                   	pop    %rbp
+  8056c1:	c3                   	ret
+
+00000000008056c2 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8056c2:	55                   	push   %rbp
+  8056c3:	48 89 e5             	mov    %rsp,%rbp
+  8056c6:	41 57                	push   %r15
+  8056c8:	53                   	push   %rbx
+  8056c9:	48 83 ec 30          	sub    $0x30,%rsp
+  8056cd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056cd <accept+0xb>
+  8056d4:	49 bb 73 39 00 00 00 	movabs $0x3973,%r11
+  8056db:	00 00 00 
+  8056de:	4c 01 db             	add    %r11,%rbx
+  8056e1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8056e4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8056e8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8056ec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8056ef:	89 c7                	mov    %eax,%edi
+  8056f1:	48 b8 30 c5 ff ff ff 	movabs $0xffffffffffffc530,%rax
+  8056f8:	ff ff ff 
+  8056fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056ff:	ff d0                	call   *%rax
+  805701:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805704:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805708:	79 05                	jns    80570f <accept+0x4d>
+		return r;
+  80570a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80570d:	eb 45                	jmp    805754 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80570f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805713:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805717:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80571a:	48 89 ce             	mov    %rcx,%rsi
+  80571d:	89 c7                	mov    %eax,%edi
+  80571f:	49 89 df             	mov    %rbx,%r15
+  805722:	48 b8 0e cc ff ff ff 	movabs $0xffffffffffffcc0e,%rax
+  805729:	ff ff ff 
+  80572c:	48 01 d8             	add    %rbx,%rax
+  80572f:	ff d0                	call   *%rax
+  805731:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805734:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805738:	79 05                	jns    80573f <accept+0x7d>
+		return r;
+  80573a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80573d:	eb 15                	jmp    805754 <accept+0x92>
+	return alloc_sockfd(r);
+  80573f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805742:	89 c7                	mov    %eax,%edi
+  805744:	48 b8 ac c5 ff ff ff 	movabs $0xffffffffffffc5ac,%rax
+  80574b:	ff ff ff 
+  80574e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805752:	ff d0                	call   *%rax
+}
+  805754:	48 83 c4 30          	add    $0x30,%rsp
+  805758:	5b                   	pop    %rbx
+  805759:	41 5f                	pop    %r15
+  80575b:	5d                   	pop    %rbp
+  80575c:	c3                   	ret
+
+000000000080575d <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80575d:	55                   	push   %rbp
+  80575e:	48 89 e5             	mov    %rsp,%rbp
+  805761:	41 57                	push   %r15
+  805763:	53                   	push   %rbx
+  805764:	48 83 ec 20          	sub    $0x20,%rsp
+  805768:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805768 <bind+0xb>
+  80576f:	49 bb d8 38 00 00 00 	movabs $0x38d8,%r11
+  805776:	00 00 00 
+  805779:	4c 01 db             	add    %r11,%rbx
+  80577c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80577f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805783:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805786:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805789:	89 c7                	mov    %eax,%edi
+  80578b:	48 b8 30 c5 ff ff ff 	movabs $0xffffffffffffc530,%rax
+  805792:	ff ff ff 
+  805795:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805799:	ff d0                	call   *%rax
+  80579b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80579e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057a2:	79 05                	jns    8057a9 <bind+0x4c>
+		return r;
+  8057a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057a7:	eb 21                	jmp    8057ca <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  8057a9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8057ac:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8057b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057b3:	48 89 ce             	mov    %rcx,%rsi
+  8057b6:	89 c7                	mov    %eax,%edi
+  8057b8:	49 89 df             	mov    %rbx,%r15
+  8057bb:	48 b8 ba cc ff ff ff 	movabs $0xffffffffffffccba,%rax
+  8057c2:	ff ff ff 
+  8057c5:	48 01 d8             	add    %rbx,%rax
+  8057c8:	ff d0                	call   *%rax
+}
+  8057ca:	48 83 c4 20          	add    $0x20,%rsp
+  8057ce:	5b                   	pop    %rbx
+  8057cf:	41 5f                	pop    %r15
+  8057d1:	5d                   	pop    %rbp
+  8057d2:	c3                   	ret
+
+00000000008057d3 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  8057d3:	55                   	push   %rbp
+  8057d4:	48 89 e5             	mov    %rsp,%rbp
+  8057d7:	41 57                	push   %r15
+  8057d9:	53                   	push   %rbx
+  8057da:	48 83 ec 20          	sub    $0x20,%rsp
+  8057de:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057de <shutdown+0xb>
+  8057e5:	49 bb 62 38 00 00 00 	movabs $0x3862,%r11
+  8057ec:	00 00 00 
+  8057ef:	4c 01 db             	add    %r11,%rbx
+  8057f2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8057f5:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8057f8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8057fb:	89 c7                	mov    %eax,%edi
+  8057fd:	48 b8 30 c5 ff ff ff 	movabs $0xffffffffffffc530,%rax
+  805804:	ff ff ff 
+  805807:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80580b:	ff d0                	call   *%rax
+  80580d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805810:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805814:	79 05                	jns    80581b <shutdown+0x48>
+		return r;
+  805816:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805819:	eb 1c                	jmp    805837 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  80581b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80581e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805821:	89 d6                	mov    %edx,%esi
+  805823:	89 c7                	mov    %eax,%edi
+  805825:	49 89 df             	mov    %rbx,%r15
+  805828:	48 b8 4f cd ff ff ff 	movabs $0xffffffffffffcd4f,%rax
+  80582f:	ff ff ff 
+  805832:	48 01 d8             	add    %rbx,%rax
+  805835:	ff d0                	call   *%rax
+}
+  805837:	48 83 c4 20          	add    $0x20,%rsp
+  80583b:	5b                   	pop    %rbx
+  80583c:	41 5f                	pop    %r15
+  80583e:	5d                   	pop    %rbp
+  80583f:	c3                   	ret
+
+0000000000805840 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  805840:	55                   	push   %rbp
+  805841:	48 89 e5             	mov    %rsp,%rbp
+  805844:	41 57                	push   %r15
+  805846:	53                   	push   %rbx
+  805847:	48 83 ec 10          	sub    $0x10,%rsp
+  80584b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80584b <devsock_close+0xb>
+  805852:	49 bb f5 37 00 00 00 	movabs $0x37f5,%r11
+  805859:	00 00 00 
+  80585c:	4c 01 db             	add    %r11,%rbx
+  80585f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  805863:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805867:	48 89 c7             	mov    %rax,%rdi
+  80586a:	49 89 df             	mov    %rbx,%r15
+  80586d:	48 b8 7e c4 ff ff ff 	movabs $0xffffffffffffc47e,%rax
+  805874:	ff ff ff 
+  805877:	48 01 d8             	add    %rbx,%rax
+  80587a:	ff d0                	call   *%rax
+  80587c:	83 f8 01             	cmp    $0x1,%eax
+  80587f:	75 1d                	jne    80589e <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  805881:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805885:	8b 40 0c             	mov    0xc(%rax),%eax
+  805888:	89 c7                	mov    %eax,%edi
+  80588a:	49 89 df             	mov    %rbx,%r15
+  80588d:	48 b8 a0 cd ff ff ff 	movabs $0xffffffffffffcda0,%rax
+  805894:	ff ff ff 
+  805897:	48 01 d8             	add    %rbx,%rax
+  80589a:	ff d0                	call   *%rax
+  80589c:	eb 05                	jmp    8058a3 <devsock_close+0x63>
+	else
+		return 0;
+  80589e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8058a3:	48 83 c4 10          	add    $0x10,%rsp
+  8058a7:	5b                   	pop    %rbx
+  8058a8:	41 5f                	pop    %r15
+  8058aa:	5d                   	pop    %rbp
+  8058ab:	c3                   	ret
+
+00000000008058ac <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8058ac:	55                   	push   %rbp
+  8058ad:	48 89 e5             	mov    %rsp,%rbp
+  8058b0:	41 57                	push   %r15
+  8058b2:	53                   	push   %rbx
+  8058b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8058b7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058b7 <connect+0xb>
+  8058be:	49 bb 89 37 00 00 00 	movabs $0x3789,%r11
+  8058c5:	00 00 00 
+  8058c8:	4c 01 db             	add    %r11,%rbx
+  8058cb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8058ce:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8058d2:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8058d5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058d8:	89 c7                	mov    %eax,%edi
+  8058da:	48 b8 30 c5 ff ff ff 	movabs $0xffffffffffffc530,%rax
+  8058e1:	ff ff ff 
+  8058e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8058e8:	ff d0                	call   *%rax
+  8058ea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8058ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058f1:	79 05                	jns    8058f8 <connect+0x4c>
+		return r;
+  8058f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058f6:	eb 21                	jmp    805919 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8058f8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8058fb:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8058ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805902:	48 89 ce             	mov    %rcx,%rsi
+  805905:	89 c7                	mov    %eax,%edi
+  805907:	49 89 df             	mov    %rbx,%r15
+  80590a:	48 b8 e8 cd ff ff ff 	movabs $0xffffffffffffcde8,%rax
+  805911:	ff ff ff 
+  805914:	48 01 d8             	add    %rbx,%rax
+  805917:	ff d0                	call   *%rax
+}
+  805919:	48 83 c4 20          	add    $0x20,%rsp
+  80591d:	5b                   	pop    %rbx
+  80591e:	41 5f                	pop    %r15
+  805920:	5d                   	pop    %rbp
+  805921:	c3                   	ret
+
+0000000000805922 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  805922:	55                   	push   %rbp
+  805923:	48 89 e5             	mov    %rsp,%rbp
+  805926:	41 57                	push   %r15
+  805928:	53                   	push   %rbx
+  805929:	48 83 ec 20          	sub    $0x20,%rsp
+  80592d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80592d <listen+0xb>
+  805934:	49 bb 13 37 00 00 00 	movabs $0x3713,%r11
+  80593b:	00 00 00 
+  80593e:	4c 01 db             	add    %r11,%rbx
+  805941:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805944:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805947:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80594a:	89 c7                	mov    %eax,%edi
+  80594c:	48 b8 30 c5 ff ff ff 	movabs $0xffffffffffffc530,%rax
+  805953:	ff ff ff 
+  805956:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80595a:	ff d0                	call   *%rax
+  80595c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80595f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805963:	79 05                	jns    80596a <listen+0x48>
+		return r;
+  805965:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805968:	eb 1c                	jmp    805986 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80596a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80596d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805970:	89 d6                	mov    %edx,%esi
+  805972:	89 c7                	mov    %eax,%edi
+  805974:	49 89 df             	mov    %rbx,%r15
+  805977:	48 b8 7d ce ff ff ff 	movabs $0xffffffffffffce7d,%rax
+  80597e:	ff ff ff 
+  805981:	48 01 d8             	add    %rbx,%rax
+  805984:	ff d0                	call   *%rax
+}
+  805986:	48 83 c4 20          	add    $0x20,%rsp
+  80598a:	5b                   	pop    %rbx
+  80598b:	41 5f                	pop    %r15
+  80598d:	5d                   	pop    %rbp
+  80598e:	c3                   	ret
+
+000000000080598f <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  80598f:	55                   	push   %rbp
+  805990:	48 89 e5             	mov    %rsp,%rbp
+  805993:	41 57                	push   %r15
+  805995:	48 83 ec 28          	sub    $0x28,%rsp
+  805999:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805999 <devsock_read+0xa>
+  8059a0:	49 bb a7 36 00 00 00 	movabs $0x36a7,%r11
+  8059a7:	00 00 00 
+  8059aa:	4c 01 d8             	add    %r11,%rax
+  8059ad:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8059b1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8059b5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8059b9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8059bd:	41 89 d0             	mov    %edx,%r8d
+  8059c0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8059c4:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8059c7:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8059cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8059d0:	44 89 c2             	mov    %r8d,%edx
+  8059d3:	49 89 c7             	mov    %rax,%r15
+  8059d6:	49 b8 ce ce ff ff ff 	movabs $0xffffffffffffcece,%r8
+  8059dd:	ff ff ff 
+  8059e0:	49 01 c0             	add    %rax,%r8
+  8059e3:	41 ff d0             	call   *%r8
+}
+  8059e6:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8059ea:	c9                   	leave
+  8059eb:	c3                   	ret
+
+00000000008059ec <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8059ec:	55                   	push   %rbp
+  8059ed:	48 89 e5             	mov    %rsp,%rbp
+  8059f0:	41 57                	push   %r15
+  8059f2:	48 83 ec 28          	sub    $0x28,%rsp
+  8059f6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8059f6 <devsock_write+0xa>
+  8059fd:	49 bb 4a 36 00 00 00 	movabs $0x364a,%r11
+  805a04:	00 00 00 
+  805a07:	4c 01 d8             	add    %r11,%rax
+  805a0a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805a0e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805a12:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  805a16:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805a1a:	41 89 d0             	mov    %edx,%r8d
+  805a1d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805a21:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805a24:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805a28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805a2d:	44 89 c2             	mov    %r8d,%edx
+  805a30:	49 89 c7             	mov    %rax,%r15
+  805a33:	49 b8 eb cf ff ff ff 	movabs $0xffffffffffffcfeb,%r8
+  805a3a:	ff ff ff 
+  805a3d:	49 01 c0             	add    %rax,%r8
+  805a40:	41 ff d0             	call   *%r8
+}
+  805a43:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805a47:	c9                   	leave
+  805a48:	c3                   	ret
+
+0000000000805a49 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805a49:	55                   	push   %rbp
+  805a4a:	48 89 e5             	mov    %rsp,%rbp
+  805a4d:	41 57                	push   %r15
+  805a4f:	48 83 ec 18          	sub    $0x18,%rsp
+  805a53:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805a53 <devsock_stat+0xa>
+  805a5a:	49 bb ed 35 00 00 00 	movabs $0x35ed,%r11
+  805a61:	00 00 00 
+  805a64:	4c 01 d8             	add    %r11,%rax
+  805a67:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805a6b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805a6f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805a73:	48 b9 4c e6 ff ff ff 	movabs $0xffffffffffffe64c,%rcx
+  805a7a:	ff ff ff 
+  805a7d:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805a81:	48 89 ce             	mov    %rcx,%rsi
+  805a84:	48 89 d7             	mov    %rdx,%rdi
+  805a87:	49 89 c7             	mov    %rax,%r15
+  805a8a:	48 ba 08 86 ff ff ff 	movabs $0xffffffffffff8608,%rdx
+  805a91:	ff ff ff 
+  805a94:	48 01 c2             	add    %rax,%rdx
+  805a97:	ff d2                	call   *%rdx
+	return 0;
+  805a99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a9e:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805aa2:	c9                   	leave
+  805aa3:	c3                   	ret
+
+0000000000805aa4 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  805aa4:	55                   	push   %rbp
+  805aa5:	48 89 e5             	mov    %rsp,%rbp
+  805aa8:	41 57                	push   %r15
+  805aaa:	53                   	push   %rbx
+  805aab:	48 83 ec 20          	sub    $0x20,%rsp
+  805aaf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805aaf <socket+0xb>
+  805ab6:	49 bb 91 35 00 00 00 	movabs $0x3591,%r11
+  805abd:	00 00 00 
+  805ac0:	4c 01 db             	add    %r11,%rbx
+  805ac3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805ac6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805ac9:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  805acc:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805acf:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805ad2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ad5:	89 ce                	mov    %ecx,%esi
+  805ad7:	89 c7                	mov    %eax,%edi
+  805ad9:	49 89 df             	mov    %rbx,%r15
+  805adc:	48 b8 c2 d1 ff ff ff 	movabs $0xffffffffffffd1c2,%rax
+  805ae3:	ff ff ff 
+  805ae6:	48 01 d8             	add    %rbx,%rax
+  805ae9:	ff d0                	call   *%rax
+  805aeb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805aee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805af2:	79 05                	jns    805af9 <socket+0x55>
+		return r;
+  805af4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805af7:	eb 15                	jmp    805b0e <socket+0x6a>
+	return alloc_sockfd(r);
+  805af9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805afc:	89 c7                	mov    %eax,%edi
+  805afe:	48 b8 ac c5 ff ff ff 	movabs $0xffffffffffffc5ac,%rax
+  805b05:	ff ff ff 
+  805b08:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b0c:	ff d0                	call   *%rax
+}
+  805b0e:	48 83 c4 20          	add    $0x20,%rsp
+  805b12:	5b                   	pop    %rbx
+  805b13:	41 5f                	pop    %r15
+  805b15:	5d                   	pop    %rbp
+  805b16:	c3                   	ret
+
+0000000000805b17 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805b17:	55                   	push   %rbp
+  805b18:	48 89 e5             	mov    %rsp,%rbp
+  805b1b:	41 57                	push   %r15
+  805b1d:	53                   	push   %rbx
+  805b1e:	48 83 ec 10          	sub    $0x10,%rsp
+  805b22:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b22 <nsipc+0xb>
+  805b29:	49 bb 1e 35 00 00 00 	movabs $0x351e,%r11
+  805b30:	00 00 00 
+  805b33:	4c 01 db             	add    %r11,%rbx
+  805b36:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805b39:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805b40:	00 00 00 
+  805b43:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805b46:	85 c0                	test   %eax,%eax
+  805b48:	75 24                	jne    805b6e <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805b4a:	bf 02 00 00 00       	mov    $0x2,%edi
+  805b4f:	49 89 df             	mov    %rbx,%r15
+  805b52:	48 b8 36 ad ff ff ff 	movabs $0xffffffffffffad36,%rax
+  805b59:	ff ff ff 
+  805b5c:	48 01 d8             	add    %rbx,%rax
+  805b5f:	ff d0                	call   *%rax
+  805b61:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805b68:	00 00 00 
+  805b6b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805b6e:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805b75:	00 00 00 
+  805b78:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805b7b:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805b7e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805b84:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805b8a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805b8f:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805b96:	00 00 00 
+  805b99:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805b9d:	89 c7                	mov    %eax,%edi
+  805b9f:	49 89 df             	mov    %rbx,%r15
+  805ba2:	48 b8 55 a7 ff ff ff 	movabs $0xffffffffffffa755,%rax
+  805ba9:	ff ff ff 
+  805bac:	48 01 d8             	add    %rbx,%rax
+  805baf:	ff d0                	call   *%rax
+}
+  805bb1:	48 83 c4 10          	add    $0x10,%rsp
+  805bb5:	5b                   	pop    %rbx
+  805bb6:	41 5f                	pop    %r15
+  805bb8:	5d                   	pop    %rbp
+  805bb9:	c3                   	ret
+
+0000000000805bba <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805bba:	55                   	push   %rbp
+  805bbb:	48 89 e5             	mov    %rsp,%rbp
+  805bbe:	41 57                	push   %r15
+  805bc0:	53                   	push   %rbx
+  805bc1:	48 83 ec 20          	sub    $0x20,%rsp
+  805bc5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bc5 <nsipc_words+0xb>
+  805bcc:	49 bb 7b 34 00 00 00 	movabs $0x347b,%r11
+  805bd3:	00 00 00 
+  805bd6:	4c 01 db             	add    %r11,%rbx
+  805bd9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805bdc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805be0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  805be4:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805beb:	00 00 00 
+  805bee:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805bf1:	85 c0                	test   %eax,%eax
+  805bf3:	75 24                	jne    805c19 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805bf5:	bf 02 00 00 00       	mov    $0x2,%edi
+  805bfa:	49 89 df             	mov    %rbx,%r15
+  805bfd:	48 b8 36 ad ff ff ff 	movabs $0xffffffffffffad36,%rax
+  805c04:	ff ff ff 
+  805c07:	48 01 d8             	add    %rbx,%rax
+  805c0a:	ff d0                	call   *%rax
+  805c0c:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805c13:	00 00 00 
+  805c16:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805c19:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805c20:	00 00 00 
+  805c23:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805c26:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805c2a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805c2e:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805c31:	89 c7                	mov    %eax,%edi
+  805c33:	49 89 df             	mov    %rbx,%r15
+  805c36:	48 b8 40 a8 ff ff ff 	movabs $0xffffffffffffa840,%rax
+  805c3d:	ff ff ff 
+  805c40:	48 01 d8             	add    %rbx,%rax
+  805c43:	ff d0                	call   *%rax
+}
+  805c45:	48 83 c4 20          	add    $0x20,%rsp
+  805c49:	5b                   	pop    %rbx
+  805c4a:	41 5f                	pop    %r15
+  805c4c:	5d                   	pop    %rbp
+  805c4d:	c3                   	ret
+
+0000000000805c4e <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805c4e:	55                   	push   %rbp
+  805c4f:	48 89 e5             	mov    %rsp,%rbp
+  805c52:	41 57                	push   %r15
+  805c54:	53                   	push   %rbx
+  805c55:	48 83 ec 30          	sub    $0x30,%rsp
+  805c59:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c59 <nsipc_accept+0xb>
+  805c60:	49 bb e7 33 00 00 00 	movabs $0x33e7,%r11
+  805c67:	00 00 00 
+  805c6a:	4c 01 db             	add    %r11,%rbx
+  805c6d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805c70:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805c74:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805c78:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805c7f:	00 00 00 
+  805c82:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c85:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805c88:	bf 01 00 00 00       	mov    $0x1,%edi
+  805c8d:	48 b8 d7 ca ff ff ff 	movabs $0xffffffffffffcad7,%rax
+  805c94:	ff ff ff 
+  805c97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c9b:	ff d0                	call   *%rax
+  805c9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ca0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ca4:	78 48                	js     805cee <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805ca6:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  805cad:	00 00 00 
+  805cb0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cb4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805cb8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805cbc:	8b 40 10             	mov    0x10(%rax),%eax
+  805cbf:	89 c2                	mov    %eax,%edx
+  805cc1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805cc5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805cc9:	48 89 ce             	mov    %rcx,%rsi
+  805ccc:	48 89 c7             	mov    %rax,%rdi
+  805ccf:	49 89 df             	mov    %rbx,%r15
+  805cd2:	48 b8 e8 89 ff ff ff 	movabs $0xffffffffffff89e8,%rax
+  805cd9:	ff ff ff 
+  805cdc:	48 01 d8             	add    %rbx,%rax
+  805cdf:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  805ce1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ce5:	8b 50 10             	mov    0x10(%rax),%edx
+  805ce8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805cec:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805cee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805cf1:	48 83 c4 30          	add    $0x30,%rsp
+  805cf5:	5b                   	pop    %rbx
+  805cf6:	41 5f                	pop    %r15
+  805cf8:	5d                   	pop    %rbp
+  805cf9:	c3                   	ret
+
+0000000000805cfa <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805cfa:	55                   	push   %rbp
+  805cfb:	48 89 e5             	mov    %rsp,%rbp
+  805cfe:	41 57                	push   %r15
+  805d00:	53                   	push   %rbx
+  805d01:	48 83 ec 10          	sub    $0x10,%rsp
+  805d05:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d05 <nsipc_bind+0xb>
+  805d0c:	49 bb 3b 33 00 00 00 	movabs $0x333b,%r11
+  805d13:	00 00 00 
+  805d16:	4c 01 db             	add    %r11,%rbx
+  805d19:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805d1c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805d20:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805d23:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805d2a:	00 00 00 
+  805d2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d30:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805d33:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805d36:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d3a:	48 89 c6             	mov    %rax,%rsi
+  805d3d:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805d44:	00 00 00 
+  805d47:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d4b:	48 89 c7             	mov    %rax,%rdi
+  805d4e:	49 89 df             	mov    %rbx,%r15
+  805d51:	48 b8 e8 89 ff ff ff 	movabs $0xffffffffffff89e8,%rax
+  805d58:	ff ff ff 
+  805d5b:	48 01 d8             	add    %rbx,%rax
+  805d5e:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805d60:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805d67:	00 00 00 
+  805d6a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805d6d:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805d71:	bf 02 00 00 00       	mov    $0x2,%edi
+  805d76:	48 b8 d7 ca ff ff ff 	movabs $0xffffffffffffcad7,%rax
+  805d7d:	ff ff ff 
+  805d80:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d84:	ff d0                	call   *%rax
+}
+  805d86:	48 83 c4 10          	add    $0x10,%rsp
+  805d8a:	5b                   	pop    %rbx
+  805d8b:	41 5f                	pop    %r15
+  805d8d:	5d                   	pop    %rbp
+  805d8e:	c3                   	ret
+
+0000000000805d8f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805d8f:	55                   	push   %rbp
+  805d90:	48 89 e5             	mov    %rsp,%rbp
+  805d93:	48 83 ec 20          	sub    $0x20,%rsp
+  805d97:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d97 <nsipc_shutdown+0x8>
+  805d9e:	49 bb a9 32 00 00 00 	movabs $0x32a9,%r11
+  805da5:	00 00 00 
+  805da8:	4c 01 d8             	add    %r11,%rax
+  805dab:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805dae:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805db1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805db4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805db7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805dba:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805dbd:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805dc1:	ba 08 00 00 00       	mov    $0x8,%edx
+  805dc6:	48 89 ce             	mov    %rcx,%rsi
+  805dc9:	bf 03 00 00 00       	mov    $0x3,%edi
+  805dce:	48 b9 7a cb ff ff ff 	movabs $0xffffffffffffcb7a,%rcx
+  805dd5:	ff ff ff 
+  805dd8:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805ddc:	ff d0                	call   *%rax
+}
+  805dde:	c9                   	leave
+  805ddf:	c3                   	ret
+
+0000000000805de0 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805de0:	55                   	push   %rbp
+  805de1:	48 89 e5             	mov    %rsp,%rbp
+  805de4:	48 83 ec 20          	sub    $0x20,%rsp
+  805de8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805de8 <nsipc_close+0x8>
+  805def:	49 bb 58 32 00 00 00 	movabs $0x3258,%r11
+  805df6:	00 00 00 
+  805df9:	4c 01 d8             	add    %r11,%rax
+  805dfc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805dff:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805e02:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805e05:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805e09:	ba 04 00 00 00       	mov    $0x4,%edx
+  805e0e:	48 89 ce             	mov    %rcx,%rsi
+  805e11:	bf 04 00 00 00       	mov    $0x4,%edi
+  805e16:	48 b9 7a cb ff ff ff 	movabs $0xffffffffffffcb7a,%rcx
+  805e1d:	ff ff ff 
+  805e20:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805e24:	ff d0                	call   *%rax
+}
+  805e26:	c9                   	leave
+  805e27:	c3                   	ret
+
+0000000000805e28 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805e28:	55                   	push   %rbp
+  805e29:	48 89 e5             	mov    %rsp,%rbp
+  805e2c:	41 57                	push   %r15
+  805e2e:	53                   	push   %rbx
+  805e2f:	48 83 ec 10          	sub    $0x10,%rsp
+  805e33:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e33 <nsipc_connect+0xb>
+  805e3a:	49 bb 0d 32 00 00 00 	movabs $0x320d,%r11
+  805e41:	00 00 00 
+  805e44:	4c 01 db             	add    %r11,%rbx
+  805e47:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805e4a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805e4e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805e51:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805e58:	00 00 00 
+  805e5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e5e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805e61:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805e64:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e68:	48 89 c6             	mov    %rax,%rsi
+  805e6b:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805e72:	00 00 00 
+  805e75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e79:	48 89 c7             	mov    %rax,%rdi
+  805e7c:	49 89 df             	mov    %rbx,%r15
+  805e7f:	48 b8 e8 89 ff ff ff 	movabs $0xffffffffffff89e8,%rax
+  805e86:	ff ff ff 
+  805e89:	48 01 d8             	add    %rbx,%rax
+  805e8c:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805e8e:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805e95:	00 00 00 
+  805e98:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805e9b:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805e9f:	bf 05 00 00 00       	mov    $0x5,%edi
+  805ea4:	48 b8 d7 ca ff ff ff 	movabs $0xffffffffffffcad7,%rax
+  805eab:	ff ff ff 
+  805eae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805eb2:	ff d0                	call   *%rax
+}
+  805eb4:	48 83 c4 10          	add    $0x10,%rsp
+  805eb8:	5b                   	pop    %rbx
+  805eb9:	41 5f                	pop    %r15
+  805ebb:	5d                   	pop    %rbp
+  805ebc:	c3                   	ret
+
+0000000000805ebd <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805ebd:	55                   	push   %rbp
+  805ebe:	48 89 e5             	mov    %rsp,%rbp
+  805ec1:	48 83 ec 20          	sub    $0x20,%rsp
+  805ec5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ec5 <nsipc_listen+0x8>
+  805ecc:	49 bb 7b 31 00 00 00 	movabs $0x317b,%r11
+  805ed3:	00 00 00 
+  805ed6:	4c 01 d8             	add    %r11,%rax
+  805ed9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805edc:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805edf:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805ee2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805ee5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805ee8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805eeb:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805eef:	ba 08 00 00 00       	mov    $0x8,%edx
+  805ef4:	48 89 ce             	mov    %rcx,%rsi
+  805ef7:	bf 06 00 00 00       	mov    $0x6,%edi
+  805efc:	48 b9 7a cb ff ff ff 	movabs $0xffffffffffffcb7a,%rcx
+  805f03:	ff ff ff 
+  805f06:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805f0a:	ff d0                	call   *%rax
+}
+  805f0c:	c9                   	leave
+  805f0d:	c3                   	ret
+
+0000000000805f0e <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805f0e:	55                   	push   %rbp
+  805f0f:	48 89 e5             	mov    %rsp,%rbp
+  805f12:	41 57                	push   %r15
+  805f14:	53                   	push   %rbx
+  805f15:	48 83 ec 30          	sub    $0x30,%rsp
+  805f19:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f19 <nsipc_recv+0xb>
+  805f20:	49 bb 27 31 00 00 00 	movabs $0x3127,%r11
+  805f27:	00 00 00 
+  805f2a:	4c 01 db             	add    %r11,%rbx
+  805f2d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805f30:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805f34:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805f37:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805f3a:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805f41:	00 00 00 
+  805f44:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805f47:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805f4a:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805f51:	00 00 00 
+  805f54:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805f57:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805f5b:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805f62:	00 00 00 
+  805f65:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805f68:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805f6c:	bf 07 00 00 00       	mov    $0x7,%edi
+  805f71:	48 b8 d7 ca ff ff ff 	movabs $0xffffffffffffcad7,%rax
+  805f78:	ff ff ff 
+  805f7b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f7f:	ff d0                	call   *%rax
+  805f81:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f84:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f88:	0f 88 91 00 00 00    	js     80601f <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805f8e:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805f95:	7f 08                	jg     805f9f <nsipc_recv+0x91>
+  805f97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f9a:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805f9d:	7e 50                	jle    805fef <nsipc_recv+0xe1>
+  805f9f:	48 b8 53 e6 ff ff ff 	movabs $0xffffffffffffe653,%rax
+  805fa6:	ff ff ff 
+  805fa9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805fad:	48 89 c1             	mov    %rax,%rcx
+  805fb0:	48 b8 68 e6 ff ff ff 	movabs $0xffffffffffffe668,%rax
+  805fb7:	ff ff ff 
+  805fba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805fbe:	48 89 c2             	mov    %rax,%rdx
+  805fc1:	be 79 00 00 00       	mov    $0x79,%esi
+  805fc6:	48 b8 7d e6 ff ff ff 	movabs $0xffffffffffffe67d,%rax
+  805fcd:	ff ff ff 
+  805fd0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805fd4:	48 89 c7             	mov    %rax,%rdi
+  805fd7:	49 89 df             	mov    %rbx,%r15
+  805fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fdf:	49 b8 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%r8
+  805fe6:	ff ff ff 
+  805fe9:	49 01 d8             	add    %rbx,%r8
+  805fec:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805fef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ff2:	48 63 d0             	movslq %eax,%rdx
+  805ff5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805ff9:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  806000:	00 00 00 
+  806003:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  806007:	48 89 ce             	mov    %rcx,%rsi
+  80600a:	48 89 c7             	mov    %rax,%rdi
+  80600d:	49 89 df             	mov    %rbx,%r15
+  806010:	48 b8 e8 89 ff ff ff 	movabs $0xffffffffffff89e8,%rax
+  806017:	ff ff ff 
+  80601a:	48 01 d8             	add    %rbx,%rax
+  80601d:	ff d0                	call   *%rax
+	}
+
+	return r;
+  80601f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806022:	48 83 c4 30          	add    $0x30,%rsp
+  806026:	5b                   	pop    %rbx
+  806027:	41 5f                	pop    %r15
+  806029:	5d                   	pop    %rbp
+  80602a:	c3                   	ret
+
+000000000080602b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80602b:	55                   	push   %rbp
+  80602c:	48 89 e5             	mov    %rsp,%rbp
+  80602f:	41 57                	push   %r15
+  806031:	53                   	push   %rbx
+  806032:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  806039:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806039 <nsipc_send+0xe>
+  806040:	49 bb 07 30 00 00 00 	movabs $0x3007,%r11
+  806047:	00 00 00 
+  80604a:	4c 01 db             	add    %r11,%rbx
+  80604d:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  806053:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  80605a:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  806060:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  806066:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80606a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  80606e:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  806075:	00 00 00 
+  806078:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80607b:	85 c0                	test   %eax,%eax
+  80607d:	75 24                	jne    8060a3 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80607f:	bf 02 00 00 00       	mov    $0x2,%edi
+  806084:	49 89 df             	mov    %rbx,%r15
+  806087:	48 b8 36 ad ff ff ff 	movabs $0xffffffffffffad36,%rax
+  80608e:	ff ff ff 
+  806091:	48 01 d8             	add    %rbx,%rax
+  806094:	ff d0                	call   *%rax
+  806096:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  80609d:	00 00 00 
+  8060a0:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8060a3:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8060a9:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8060ac:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  8060b3:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8060b6:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8060b9:	39 c2                	cmp    %eax,%edx
+  8060bb:	0f 4e c2             	cmovle %edx,%eax
+  8060be:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  8060c4:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8060ca:	48 63 d0             	movslq %eax,%rdx
+  8060cd:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8060d4:	48 89 c6             	mov    %rax,%rsi
+  8060d7:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  8060de:	00 00 00 
+  8060e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8060e5:	48 89 c7             	mov    %rax,%rdi
+  8060e8:	49 89 df             	mov    %rbx,%r15
+  8060eb:	48 b8 e8 89 ff ff ff 	movabs $0xffffffffffff89e8,%rax
+  8060f2:	ff ff ff 
+  8060f5:	48 01 d8             	add    %rbx,%rax
+  8060f8:	ff d0                	call   *%rax
+	req->req_s = s;
+  8060fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060fe:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  806104:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  806106:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80610a:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  806110:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  806113:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806117:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  80611d:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  806120:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  806127:	00 00 00 
+  80612a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80612e:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  806132:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  806139:	00 
+  80613a:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  806140:	48 63 d0             	movslq %eax,%rdx
+  806143:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806147:	48 01 d0             	add    %rdx,%rax
+  80614a:	48 83 e8 01          	sub    $0x1,%rax
+  80614e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  806152:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806156:	ba 00 00 00 00       	mov    $0x0,%edx
+  80615b:	48 f7 75 d8          	divq   -0x28(%rbp)
+  80615f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806163:	48 29 d0             	sub    %rdx,%rax
+  806166:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  80616c:	85 c0                	test   %eax,%eax
+  80616e:	0f 48 c2             	cmovs  %edx,%eax
+  806171:	c1 f8 0c             	sar    $0xc,%eax
+  806174:	48 98                	cltq
+  806176:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  80617a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80617e:	48 85 c0             	test   %rax,%rax
+  806181:	0f 95 c0             	setne  %al
+  806184:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  806187:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  80618e:	00 
+  80618f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806193:	48 83 c0 0b          	add    $0xb,%rax
+  806197:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80619b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80619f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8061a4:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8061a8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8061ac:	48 29 d0             	sub    %rdx,%rax
+  8061af:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8061b3:	89 c7                	mov    %eax,%edi
+  8061b5:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8061bc:	00 00 00 
+  8061bf:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8061c2:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  8061c6:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  8061ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8061ce:	6a 00                	push   $0x0
+  8061d0:	6a 00                	push   $0x0
+  8061d2:	6a 05                	push   $0x5
+  8061d4:	41 89 f1             	mov    %esi,%r9d
+  8061d7:	49 89 c8             	mov    %rcx,%r8
+  8061da:	89 f9                	mov    %edi,%ecx
+  8061dc:	be 08 00 00 00       	mov    $0x8,%esi
+  8061e1:	89 c7                	mov    %eax,%edi
+  8061e3:	49 89 df             	mov    %rbx,%r15
+  8061e6:	48 b8 3e a9 ff ff ff 	movabs $0xffffffffffffa93e,%rax
+  8061ed:	ff ff ff 
+  8061f0:	48 01 d8             	add    %rbx,%rax
+  8061f3:	ff d0                	call   *%rax
+  8061f5:	48 83 c4 20          	add    $0x20,%rsp
+}
+  8061f9:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8061fd:	5b                   	pop    %rbx
+  8061fe:	41 5f                	pop    %r15
+  806200:	5d                   	pop    %rbp
+  806201:	c3                   	ret
+
+0000000000806202 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  806202:	55                   	push   %rbp
+  806203:	48 89 e5             	mov    %rsp,%rbp
+  806206:	48 83 ec 10          	sub    $0x10,%rsp
+  80620a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80620a <nsipc_socket+0x8>
+  806211:	49 bb 36 2e 00 00 00 	movabs $0x2e36,%r11
+  806218:	00 00 00 
+  80621b:	4c 01 d8             	add    %r11,%rax
+  80621e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806221:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  806224:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  806227:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80622e:	00 00 00 
+  806231:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806234:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  806237:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80623e:	00 00 00 
+  806241:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  806244:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  806248:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80624f:	00 00 00 
+  806252:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806255:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  806259:	bf 09 00 00 00       	mov    $0x9,%edi
+  80625e:	48 ba d7 ca ff ff ff 	movabs $0xffffffffffffcad7,%rdx
+  806265:	ff ff ff 
+  806268:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80626c:	ff d0                	call   *%rax
+}
+  80626e:	c9                   	leave
+  80626f:	c3                   	ret
+
+0000000000806270 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  806270:	55                   	push   %rbp
+  806271:	48 89 e5             	mov    %rsp,%rbp
+  806274:	41 57                	push   %r15
+  806276:	53                   	push   %rbx
+  806277:	48 83 ec 30          	sub    $0x30,%rsp
+  80627b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80627b <pipe+0xb>
+  806282:	49 bb c5 2d 00 00 00 	movabs $0x2dc5,%r11
+  806289:	00 00 00 
+  80628c:	4c 01 db             	add    %r11,%rbx
+  80628f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  806293:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  806297:	48 89 c7             	mov    %rax,%rdi
+  80629a:	49 89 df             	mov    %rbx,%r15
+  80629d:	48 b8 3f ae ff ff ff 	movabs $0xffffffffffffae3f,%rax
+  8062a4:	ff ff ff 
+  8062a7:	48 01 d8             	add    %rbx,%rax
+  8062aa:	ff d0                	call   *%rax
+  8062ac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8062af:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062b3:	0f 88 12 02 00 00    	js     8064cb <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8062b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8062bd:	ba 07 04 00 00       	mov    $0x407,%edx
+  8062c2:	48 89 c6             	mov    %rax,%rsi
+  8062c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8062ca:	49 89 df             	mov    %rbx,%r15
+  8062cd:	48 b8 c4 92 ff ff ff 	movabs $0xffffffffffff92c4,%rax
+  8062d4:	ff ff ff 
+  8062d7:	48 01 d8             	add    %rbx,%rax
+  8062da:	ff d0                	call   *%rax
+  8062dc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8062df:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062e3:	0f 88 e2 01 00 00    	js     8064cb <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  8062e9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8062ed:	48 89 c7             	mov    %rax,%rdi
+  8062f0:	49 89 df             	mov    %rbx,%r15
+  8062f3:	48 b8 3f ae ff ff ff 	movabs $0xffffffffffffae3f,%rax
+  8062fa:	ff ff ff 
+  8062fd:	48 01 d8             	add    %rbx,%rax
+  806300:	ff d0                	call   *%rax
+  806302:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806305:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806309:	0f 88 9b 01 00 00    	js     8064aa <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80630f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806313:	ba 07 04 00 00       	mov    $0x407,%edx
+  806318:	48 89 c6             	mov    %rax,%rsi
+  80631b:	bf 00 00 00 00       	mov    $0x0,%edi
+  806320:	49 89 df             	mov    %rbx,%r15
+  806323:	48 b8 c4 92 ff ff ff 	movabs $0xffffffffffff92c4,%rax
+  80632a:	ff ff ff 
+  80632d:	48 01 d8             	add    %rbx,%rax
+  806330:	ff d0                	call   *%rax
+  806332:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806335:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806339:	0f 88 6b 01 00 00    	js     8064aa <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  80633f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806343:	48 89 c7             	mov    %rax,%rdi
+  806346:	49 89 df             	mov    %rbx,%r15
+  806349:	48 b8 fc ad ff ff ff 	movabs $0xffffffffffffadfc,%rax
+  806350:	ff ff ff 
+  806353:	48 01 d8             	add    %rbx,%rax
+  806356:	ff d0                	call   *%rax
+  806358:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80635c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806360:	ba 07 04 00 00       	mov    $0x407,%edx
+  806365:	48 89 c6             	mov    %rax,%rsi
+  806368:	bf 00 00 00 00       	mov    $0x0,%edi
+  80636d:	49 89 df             	mov    %rbx,%r15
+  806370:	48 b8 c4 92 ff ff ff 	movabs $0xffffffffffff92c4,%rax
+  806377:	ff ff ff 
+  80637a:	48 01 d8             	add    %rbx,%rax
+  80637d:	ff d0                	call   *%rax
+  80637f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806382:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806386:	0f 88 fd 00 00 00    	js     806489 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80638c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806390:	48 89 c7             	mov    %rax,%rdi
+  806393:	49 89 df             	mov    %rbx,%r15
+  806396:	48 b8 fc ad ff ff ff 	movabs $0xffffffffffffadfc,%rax
+  80639d:	ff ff ff 
+  8063a0:	48 01 d8             	add    %rbx,%rax
+  8063a3:	ff d0                	call   *%rax
+  8063a5:	48 89 c2             	mov    %rax,%rdx
+  8063a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063ac:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8063b2:	48 89 d1             	mov    %rdx,%rcx
+  8063b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8063ba:	48 89 c6             	mov    %rax,%rsi
+  8063bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8063c2:	49 89 df             	mov    %rbx,%r15
+  8063c5:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  8063cc:	ff ff ff 
+  8063cf:	48 01 d8             	add    %rbx,%rax
+  8063d2:	ff d0                	call   *%rax
+  8063d4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8063d7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8063db:	0f 88 87 00 00 00    	js     806468 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  8063e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063e5:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  8063ec:	00 00 00 
+  8063ef:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8063f2:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  8063f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063f8:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  8063ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806403:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  80640a:	00 00 00 
+  80640d:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806410:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  806412:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806416:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  80641d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806421:	48 89 c7             	mov    %rax,%rdi
+  806424:	49 89 df             	mov    %rbx,%r15
+  806427:	48 b8 c5 ad ff ff ff 	movabs $0xffffffffffffadc5,%rax
+  80642e:	ff ff ff 
+  806431:	48 01 d8             	add    %rbx,%rax
+  806434:	ff d0                	call   *%rax
+  806436:	89 c2                	mov    %eax,%edx
+  806438:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80643c:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  80643e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806442:	48 89 c7             	mov    %rax,%rdi
+  806445:	49 89 df             	mov    %rbx,%r15
+  806448:	48 b8 c5 ad ff ff ff 	movabs $0xffffffffffffadc5,%rax
+  80644f:	ff ff ff 
+  806452:	48 01 d8             	add    %rbx,%rax
+  806455:	ff d0                	call   *%rax
+  806457:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80645b:	48 83 c2 04          	add    $0x4,%rdx
+  80645f:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  806461:	b8 00 00 00 00       	mov    $0x0,%eax
+  806466:	eb 67                	jmp    8064cf <pipe+0x25f>
+		goto err3;
+  806468:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  806469:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80646d:	48 89 c6             	mov    %rax,%rsi
+  806470:	bf 00 00 00 00       	mov    $0x0,%edi
+  806475:	49 89 df             	mov    %rbx,%r15
+  806478:	48 b8 9c 93 ff ff ff 	movabs $0xffffffffffff939c,%rax
+  80647f:	ff ff ff 
+  806482:	48 01 d8             	add    %rbx,%rax
+  806485:	ff d0                	call   *%rax
+  806487:	eb 01                	jmp    80648a <pipe+0x21a>
+		goto err2;
+  806489:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  80648a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80648e:	48 89 c6             	mov    %rax,%rsi
+  806491:	bf 00 00 00 00       	mov    $0x0,%edi
+  806496:	49 89 df             	mov    %rbx,%r15
+  806499:	48 b8 9c 93 ff ff ff 	movabs $0xffffffffffff939c,%rax
+  8064a0:	ff ff ff 
+  8064a3:	48 01 d8             	add    %rbx,%rax
+  8064a6:	ff d0                	call   *%rax
+  8064a8:	eb 01                	jmp    8064ab <pipe+0x23b>
+		goto err1;
+  8064aa:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  8064ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8064af:	48 89 c6             	mov    %rax,%rsi
+  8064b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8064b7:	49 89 df             	mov    %rbx,%r15
+  8064ba:	48 b8 9c 93 ff ff ff 	movabs $0xffffffffffff939c,%rax
+  8064c1:	ff ff ff 
+  8064c4:	48 01 d8             	add    %rbx,%rax
+  8064c7:	ff d0                	call   *%rax
+  8064c9:	eb 01                	jmp    8064cc <pipe+0x25c>
+		goto err;
+  8064cb:	90                   	nop
+err:
+	return r;
+  8064cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8064cf:	48 83 c4 30          	add    $0x30,%rsp
+  8064d3:	5b                   	pop    %rbx
+  8064d4:	41 5f                	pop    %r15
+  8064d6:	5d                   	pop    %rbp
+  8064d7:	c3                   	ret
+
+00000000008064d8 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8064d8:	55                   	push   %rbp
+  8064d9:	48 89 e5             	mov    %rsp,%rbp
+  8064dc:	41 57                	push   %r15
+  8064de:	41 54                	push   %r12
+  8064e0:	53                   	push   %rbx
+  8064e1:	48 83 ec 28          	sub    $0x28,%rsp
+  8064e5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8064e5 <_pipeisclosed+0xd>
+  8064ec:	49 bb 5b 2b 00 00 00 	movabs $0x2b5b,%r11
+  8064f3:	00 00 00 
+  8064f6:	4c 01 db             	add    %r11,%rbx
+  8064f9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8064fd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  806501:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806508:	ff ff ff 
+  80650b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80650f:	48 8b 00             	mov    (%rax),%rax
+  806512:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806518:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  80651b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80651f:	48 89 c7             	mov    %rax,%rdi
+  806522:	49 89 df             	mov    %rbx,%r15
+  806525:	48 b8 7e c4 ff ff ff 	movabs $0xffffffffffffc47e,%rax
+  80652c:	ff ff ff 
+  80652f:	48 01 d8             	add    %rbx,%rax
+  806532:	ff d0                	call   *%rax
+  806534:	41 89 c4             	mov    %eax,%r12d
+  806537:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80653b:	48 89 c7             	mov    %rax,%rdi
+  80653e:	49 89 df             	mov    %rbx,%r15
+  806541:	48 b8 7e c4 ff ff ff 	movabs $0xffffffffffffc47e,%rax
+  806548:	ff ff ff 
+  80654b:	48 01 d8             	add    %rbx,%rax
+  80654e:	ff d0                	call   *%rax
+  806550:	41 39 c4             	cmp    %eax,%r12d
+  806553:	0f 94 c0             	sete   %al
+  806556:	0f b6 c0             	movzbl %al,%eax
+  806559:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  80655c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806563:	ff ff ff 
+  806566:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80656a:	48 8b 00             	mov    (%rax),%rax
+  80656d:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806573:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  806576:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806579:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80657c:	75 05                	jne    806583 <_pipeisclosed+0xab>
+			return ret;
+  80657e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806581:	eb 63                	jmp    8065e6 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  806583:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806586:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806589:	0f 84 72 ff ff ff    	je     806501 <_pipeisclosed+0x29>
+  80658f:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  806593:	0f 85 68 ff ff ff    	jne    806501 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  806599:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8065a0:	ff ff ff 
+  8065a3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8065a7:	48 8b 00             	mov    (%rax),%rax
+  8065aa:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  8065b0:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8065b3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8065b6:	89 c6                	mov    %eax,%esi
+  8065b8:	48 b8 8e e6 ff ff ff 	movabs $0xffffffffffffe68e,%rax
+  8065bf:	ff ff ff 
+  8065c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8065c6:	48 89 c7             	mov    %rax,%rdi
+  8065c9:	49 89 df             	mov    %rbx,%r15
+  8065cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065d1:	49 b8 46 78 ff ff ff 	movabs $0xffffffffffff7846,%r8
+  8065d8:	ff ff ff 
+  8065db:	49 01 d8             	add    %rbx,%r8
+  8065de:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8065e1:	e9 1b ff ff ff       	jmp    806501 <_pipeisclosed+0x29>
+	}
+}
+  8065e6:	48 83 c4 28          	add    $0x28,%rsp
+  8065ea:	5b                   	pop    %rbx
+  8065eb:	41 5c                	pop    %r12
+  8065ed:	41 5f                	pop    %r15
+  8065ef:	5d                   	pop    %rbp
+  8065f0:	c3                   	ret
+
+00000000008065f1 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8065f1:	55                   	push   %rbp
+  8065f2:	48 89 e5             	mov    %rsp,%rbp
+  8065f5:	41 57                	push   %r15
+  8065f7:	53                   	push   %rbx
+  8065f8:	48 83 ec 30          	sub    $0x30,%rsp
+  8065fc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065fc <pipeisclosed+0xb>
+  806603:	49 bb 44 2a 00 00 00 	movabs $0x2a44,%r11
+  80660a:	00 00 00 
+  80660d:	4c 01 db             	add    %r11,%rbx
+  806610:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806613:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  806617:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80661a:	48 89 d6             	mov    %rdx,%rsi
+  80661d:	89 c7                	mov    %eax,%edi
+  80661f:	49 89 df             	mov    %rbx,%r15
+  806622:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  806629:	ff ff ff 
+  80662c:	48 01 d8             	add    %rbx,%rax
+  80662f:	ff d0                	call   *%rax
+  806631:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806634:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806638:	79 05                	jns    80663f <pipeisclosed+0x4e>
+		return r;
+  80663a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80663d:	eb 3b                	jmp    80667a <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  80663f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806643:	48 89 c7             	mov    %rax,%rdi
+  806646:	49 89 df             	mov    %rbx,%r15
+  806649:	48 b8 fc ad ff ff ff 	movabs $0xffffffffffffadfc,%rax
+  806650:	ff ff ff 
+  806653:	48 01 d8             	add    %rbx,%rax
+  806656:	ff d0                	call   *%rax
+  806658:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  80665c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806660:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806664:	48 89 d6             	mov    %rdx,%rsi
+  806667:	48 89 c7             	mov    %rax,%rdi
+  80666a:	48 b8 98 d4 ff ff ff 	movabs $0xffffffffffffd498,%rax
+  806671:	ff ff ff 
+  806674:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806678:	ff d0                	call   *%rax
+}
+  80667a:	48 83 c4 30          	add    $0x30,%rsp
+  80667e:	5b                   	pop    %rbx
+  80667f:	41 5f                	pop    %r15
+  806681:	5d                   	pop    %rbp
+  806682:	c3                   	ret
+
+0000000000806683 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806683:	55                   	push   %rbp
+  806684:	48 89 e5             	mov    %rsp,%rbp
+  806687:	41 57                	push   %r15
+  806689:	53                   	push   %rbx
+  80668a:	48 83 ec 40          	sub    $0x40,%rsp
+  80668e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80668e <devpipe_read+0xb>
+  806695:	49 bb b2 29 00 00 00 	movabs $0x29b2,%r11
+  80669c:	00 00 00 
+  80669f:	4c 01 db             	add    %r11,%rbx
+  8066a2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8066a6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8066aa:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  8066ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8066b2:	48 89 c7             	mov    %rax,%rdi
+  8066b5:	49 89 df             	mov    %rbx,%r15
+  8066b8:	48 b8 fc ad ff ff ff 	movabs $0xffffffffffffadfc,%rax
+  8066bf:	ff ff ff 
+  8066c2:	48 01 d8             	add    %rbx,%rax
+  8066c5:	ff d0                	call   *%rax
+  8066c7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8066cb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8066cf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8066d3:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8066da:	00 
+  8066db:	e9 a1 00 00 00       	jmp    806781 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8066e0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8066e5:	74 09                	je     8066f0 <devpipe_read+0x6d>
+				return i;
+  8066e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066eb:	e9 9f 00 00 00       	jmp    80678f <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8066f0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8066f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8066f8:	48 89 d6             	mov    %rdx,%rsi
+  8066fb:	48 89 c7             	mov    %rax,%rdi
+  8066fe:	48 b8 98 d4 ff ff ff 	movabs $0xffffffffffffd498,%rax
+  806705:	ff ff ff 
+  806708:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80670c:	ff d0                	call   *%rax
+  80670e:	85 c0                	test   %eax,%eax
+  806710:	74 07                	je     806719 <devpipe_read+0x96>
+				return 0;
+  806712:	b8 00 00 00 00       	mov    $0x0,%eax
+  806717:	eb 76                	jmp    80678f <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  806719:	49 89 df             	mov    %rbx,%r15
+  80671c:	48 b8 6f 92 ff ff ff 	movabs $0xffffffffffff926f,%rax
+  806723:	ff ff ff 
+  806726:	48 01 d8             	add    %rbx,%rax
+  806729:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  80672b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80672f:	8b 10                	mov    (%rax),%edx
+  806731:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806735:	8b 40 04             	mov    0x4(%rax),%eax
+  806738:	39 c2                	cmp    %eax,%edx
+  80673a:	74 a4                	je     8066e0 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80673c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806740:	8b 10                	mov    (%rax),%edx
+  806742:	89 d0                	mov    %edx,%eax
+  806744:	c1 f8 1f             	sar    $0x1f,%eax
+  806747:	c1 e8 1b             	shr    $0x1b,%eax
+  80674a:	01 c2                	add    %eax,%edx
+  80674c:	83 e2 1f             	and    $0x1f,%edx
+  80674f:	29 c2                	sub    %eax,%edx
+  806751:	89 d6                	mov    %edx,%esi
+  806753:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806757:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80675b:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80675f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806763:	48 63 c6             	movslq %esi,%rax
+  806766:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  80676b:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  80676d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806771:	8b 00                	mov    (%rax),%eax
+  806773:	8d 50 01             	lea    0x1(%rax),%edx
+  806776:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80677a:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  80677c:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806781:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806785:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806789:	72 a0                	jb     80672b <devpipe_read+0xa8>
+	}
+	return i;
+  80678b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80678f:	48 83 c4 40          	add    $0x40,%rsp
+  806793:	5b                   	pop    %rbx
+  806794:	41 5f                	pop    %r15
+  806796:	5d                   	pop    %rbp
+  806797:	c3                   	ret
+
+0000000000806798 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806798:	55                   	push   %rbp
+  806799:	48 89 e5             	mov    %rsp,%rbp
+  80679c:	41 57                	push   %r15
+  80679e:	53                   	push   %rbx
+  80679f:	48 83 ec 40          	sub    $0x40,%rsp
+  8067a3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067a3 <devpipe_write+0xb>
+  8067aa:	49 bb 9d 28 00 00 00 	movabs $0x289d,%r11
+  8067b1:	00 00 00 
+  8067b4:	4c 01 db             	add    %r11,%rbx
+  8067b7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8067bb:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8067bf:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  8067c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8067c7:	48 89 c7             	mov    %rax,%rdi
+  8067ca:	49 89 df             	mov    %rbx,%r15
+  8067cd:	48 b8 fc ad ff ff ff 	movabs $0xffffffffffffadfc,%rax
+  8067d4:	ff ff ff 
+  8067d7:	48 01 d8             	add    %rbx,%rax
+  8067da:	ff d0                	call   *%rax
+  8067dc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8067e0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8067e4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8067e8:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8067ef:	00 
+  8067f0:	e9 a0 00 00 00       	jmp    806895 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8067f5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8067f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8067fd:	48 89 d6             	mov    %rdx,%rsi
+  806800:	48 89 c7             	mov    %rax,%rdi
+  806803:	48 b8 98 d4 ff ff ff 	movabs $0xffffffffffffd498,%rax
+  80680a:	ff ff ff 
+  80680d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806811:	ff d0                	call   *%rax
+  806813:	85 c0                	test   %eax,%eax
+  806815:	74 0a                	je     806821 <devpipe_write+0x89>
+				return 0;
+  806817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80681c:	e9 82 00 00 00       	jmp    8068a3 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  806821:	49 89 df             	mov    %rbx,%r15
+  806824:	48 b8 6f 92 ff ff ff 	movabs $0xffffffffffff926f,%rax
+  80682b:	ff ff ff 
+  80682e:	48 01 d8             	add    %rbx,%rax
+  806831:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  806833:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806837:	8b 40 04             	mov    0x4(%rax),%eax
+  80683a:	48 63 d0             	movslq %eax,%rdx
+  80683d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806841:	8b 00                	mov    (%rax),%eax
+  806843:	48 98                	cltq
+  806845:	48 83 c0 20          	add    $0x20,%rax
+  806849:	48 39 c2             	cmp    %rax,%rdx
+  80684c:	73 a7                	jae    8067f5 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80684e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806852:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806856:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80685a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80685e:	8b 50 04             	mov    0x4(%rax),%edx
+  806861:	89 d0                	mov    %edx,%eax
+  806863:	c1 f8 1f             	sar    $0x1f,%eax
+  806866:	c1 e8 1b             	shr    $0x1b,%eax
+  806869:	01 c2                	add    %eax,%edx
+  80686b:	83 e2 1f             	and    $0x1f,%edx
+  80686e:	29 c2                	sub    %eax,%edx
+  806870:	89 d0                	mov    %edx,%eax
+  806872:	0f b6 09             	movzbl (%rcx),%ecx
+  806875:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806879:	48 98                	cltq
+  80687b:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  80687f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806883:	8b 40 04             	mov    0x4(%rax),%eax
+  806886:	8d 50 01             	lea    0x1(%rax),%edx
+  806889:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80688d:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  806890:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806895:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806899:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80689d:	72 94                	jb     806833 <devpipe_write+0x9b>
+	}
+
+	return i;
+  80689f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8068a3:	48 83 c4 40          	add    $0x40,%rsp
+  8068a7:	5b                   	pop    %rbx
+  8068a8:	41 5f                	pop    %r15
+  8068aa:	5d                   	pop    %rbp
+  8068ab:	c3                   	ret
+
+00000000008068ac <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8068ac:	55                   	push   %rbp
+  8068ad:	48 89 e5             	mov    %rsp,%rbp
+  8068b0:	41 57                	push   %r15
+  8068b2:	53                   	push   %rbx
+  8068b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8068b7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068b7 <devpipe_stat+0xb>
+  8068be:	49 bb 89 27 00 00 00 	movabs $0x2789,%r11
+  8068c5:	00 00 00 
+  8068c8:	4c 01 db             	add    %r11,%rbx
+  8068cb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8068cf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8068d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8068d7:	48 89 c7             	mov    %rax,%rdi
+  8068da:	49 89 df             	mov    %rbx,%r15
+  8068dd:	48 b8 fc ad ff ff ff 	movabs $0xffffffffffffadfc,%rax
+  8068e4:	ff ff ff 
+  8068e7:	48 01 d8             	add    %rbx,%rax
+  8068ea:	ff d0                	call   *%rax
+  8068ec:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8068f0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8068f4:	48 ba a1 e6 ff ff ff 	movabs $0xffffffffffffe6a1,%rdx
+  8068fb:	ff ff ff 
+  8068fe:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806902:	48 89 d6             	mov    %rdx,%rsi
+  806905:	48 89 c7             	mov    %rax,%rdi
+  806908:	49 89 df             	mov    %rbx,%r15
+  80690b:	48 b8 08 86 ff ff ff 	movabs $0xffffffffffff8608,%rax
+  806912:	ff ff ff 
+  806915:	48 01 d8             	add    %rbx,%rax
+  806918:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80691a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80691e:	8b 50 04             	mov    0x4(%rax),%edx
+  806921:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806925:	8b 00                	mov    (%rax),%eax
+  806927:	29 c2                	sub    %eax,%edx
+  806929:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80692d:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  806933:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806937:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80693e:	00 00 00 
+	stat->st_dev = &devpipe;
+  806941:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806945:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  80694c:	00 00 00 
+  80694f:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806953:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  80695a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80695f:	48 83 c4 20          	add    $0x20,%rsp
+  806963:	5b                   	pop    %rbx
+  806964:	41 5f                	pop    %r15
+  806966:	5d                   	pop    %rbp
+  806967:	c3                   	ret
+
+0000000000806968 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  806968:	55                   	push   %rbp
+  806969:	48 89 e5             	mov    %rsp,%rbp
+  80696c:	41 57                	push   %r15
+  80696e:	53                   	push   %rbx
+  80696f:	48 83 ec 10          	sub    $0x10,%rsp
+  806973:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806973 <devpipe_close+0xb>
+  80697a:	49 bb cd 26 00 00 00 	movabs $0x26cd,%r11
+  806981:	00 00 00 
+  806984:	4c 01 db             	add    %r11,%rbx
+  806987:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  80698b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80698f:	48 89 c6             	mov    %rax,%rsi
+  806992:	bf 00 00 00 00       	mov    $0x0,%edi
+  806997:	49 89 df             	mov    %rbx,%r15
+  80699a:	48 b8 9c 93 ff ff ff 	movabs $0xffffffffffff939c,%rax
+  8069a1:	ff ff ff 
+  8069a4:	48 01 d8             	add    %rbx,%rax
+  8069a7:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8069a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8069ad:	48 89 c7             	mov    %rax,%rdi
+  8069b0:	49 89 df             	mov    %rbx,%r15
+  8069b3:	48 b8 fc ad ff ff ff 	movabs $0xffffffffffffadfc,%rax
+  8069ba:	ff ff ff 
+  8069bd:	48 01 d8             	add    %rbx,%rax
+  8069c0:	ff d0                	call   *%rax
+  8069c2:	48 89 c6             	mov    %rax,%rsi
+  8069c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8069ca:	49 89 df             	mov    %rbx,%r15
+  8069cd:	48 b8 9c 93 ff ff ff 	movabs $0xffffffffffff939c,%rax
+  8069d4:	ff ff ff 
+  8069d7:	48 01 d8             	add    %rbx,%rax
+  8069da:	ff d0                	call   *%rax
+}
+  8069dc:	48 83 c4 10          	add    $0x10,%rsp
+  8069e0:	5b                   	pop    %rbx
+  8069e1:	41 5f                	pop    %r15
+  8069e3:	5d                   	pop    %rbp
+  8069e4:	c3                   	ret
+
+00000000008069e5 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8069e5:	55                   	push   %rbp
+  8069e6:	48 89 e5             	mov    %rsp,%rbp
+  8069e9:	41 57                	push   %r15
+  8069eb:	48 83 ec 28          	sub    $0x28,%rsp
+  8069ef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8069ef <cputchar+0xa>
+  8069f6:	49 bb 51 26 00 00 00 	movabs $0x2651,%r11
+  8069fd:	00 00 00 
+  806a00:	4c 01 d8             	add    %r11,%rax
+  806a03:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  806a06:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806a09:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  806a0c:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  806a10:	be 01 00 00 00       	mov    $0x1,%esi
+  806a15:	48 89 d7             	mov    %rdx,%rdi
+  806a18:	49 89 c7             	mov    %rax,%r15
+  806a1b:	48 ba 0c 91 ff ff ff 	movabs $0xffffffffffff910c,%rdx
+  806a22:	ff ff ff 
+  806a25:	48 01 c2             	add    %rax,%rdx
+  806a28:	ff d2                	call   *%rdx
+}
+  806a2a:	90                   	nop
+  806a2b:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806a2f:	c9                   	leave
+  806a30:	c3                   	ret
+
+0000000000806a31 <getchar>:
+
+int
+getchar(void)
+{
+  806a31:	55                   	push   %rbp
+  806a32:	48 89 e5             	mov    %rsp,%rbp
+  806a35:	41 57                	push   %r15
+  806a37:	48 83 ec 18          	sub    $0x18,%rsp
+  806a3b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a3b <getchar+0xa>
+  806a42:	49 bb 05 26 00 00 00 	movabs $0x2605,%r11
+  806a49:	00 00 00 
+  806a4c:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806a4f:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  806a53:	ba 01 00 00 00       	mov    $0x1,%edx
+  806a58:	48 89 ce             	mov    %rcx,%rsi
+  806a5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a60:	49 89 c7             	mov    %rax,%r15
+  806a63:	48 b9 3c b4 ff ff ff 	movabs $0xffffffffffffb43c,%rcx
+  806a6a:	ff ff ff 
+  806a6d:	48 01 c1             	add    %rax,%rcx
+  806a70:	ff d1                	call   *%rcx
+  806a72:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  806a75:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a79:	79 05                	jns    806a80 <getchar+0x4f>
+		return r;
+  806a7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a7e:	eb 14                	jmp    806a94 <getchar+0x63>
+	if (r < 1)
+  806a80:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a84:	7f 07                	jg     806a8d <getchar+0x5c>
+		return -E_EOF;
+  806a86:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806a8b:	eb 07                	jmp    806a94 <getchar+0x63>
+	return c;
+  806a8d:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  806a91:	0f b6 c0             	movzbl %al,%eax
+}
+  806a94:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806a98:	c9                   	leave
+  806a99:	c3                   	ret
+
+0000000000806a9a <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  806a9a:	55                   	push   %rbp
+  806a9b:	48 89 e5             	mov    %rsp,%rbp
+  806a9e:	41 57                	push   %r15
+  806aa0:	53                   	push   %rbx
+  806aa1:	48 83 ec 20          	sub    $0x20,%rsp
+  806aa5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806aa5 <iscons+0xb>
+  806aac:	49 bb 9b 25 00 00 00 	movabs $0x259b,%r11
+  806ab3:	00 00 00 
+  806ab6:	4c 01 db             	add    %r11,%rbx
+  806ab9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806abc:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806ac0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806ac3:	48 89 d6             	mov    %rdx,%rsi
+  806ac6:	89 c7                	mov    %eax,%edi
+  806ac8:	49 89 df             	mov    %rbx,%r15
+  806acb:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  806ad2:	ff ff ff 
+  806ad5:	48 01 d8             	add    %rbx,%rax
+  806ad8:	ff d0                	call   *%rax
+  806ada:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806add:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806ae1:	79 05                	jns    806ae8 <iscons+0x4e>
+		return r;
+  806ae3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ae6:	eb 1b                	jmp    806b03 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  806ae8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806aec:	8b 10                	mov    (%rax),%edx
+  806aee:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  806af5:	00 00 00 
+  806af8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806afb:	39 c2                	cmp    %eax,%edx
+  806afd:	0f 94 c0             	sete   %al
+  806b00:	0f b6 c0             	movzbl %al,%eax
+}
+  806b03:	48 83 c4 20          	add    $0x20,%rsp
+  806b07:	5b                   	pop    %rbx
+  806b08:	41 5f                	pop    %r15
+  806b0a:	5d                   	pop    %rbp
+  806b0b:	c3                   	ret
+
+0000000000806b0c <opencons>:
+
+int
+opencons(void)
+{
+  806b0c:	55                   	push   %rbp
+  806b0d:	48 89 e5             	mov    %rsp,%rbp
+  806b10:	41 57                	push   %r15
+  806b12:	53                   	push   %rbx
+  806b13:	48 83 ec 10          	sub    $0x10,%rsp
+  806b17:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b17 <opencons+0xb>
+  806b1e:	49 bb 29 25 00 00 00 	movabs $0x2529,%r11
+  806b25:	00 00 00 
+  806b28:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806b2b:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806b2f:	48 89 c7             	mov    %rax,%rdi
+  806b32:	49 89 df             	mov    %rbx,%r15
+  806b35:	48 b8 3f ae ff ff ff 	movabs $0xffffffffffffae3f,%rax
+  806b3c:	ff ff ff 
+  806b3f:	48 01 d8             	add    %rbx,%rax
+  806b42:	ff d0                	call   *%rax
+  806b44:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806b47:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b4b:	79 05                	jns    806b52 <opencons+0x46>
+		return r;
+  806b4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b50:	eb 68                	jmp    806bba <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806b52:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b56:	ba 07 04 00 00       	mov    $0x407,%edx
+  806b5b:	48 89 c6             	mov    %rax,%rsi
+  806b5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  806b63:	49 89 df             	mov    %rbx,%r15
+  806b66:	48 b8 c4 92 ff ff ff 	movabs $0xffffffffffff92c4,%rax
+  806b6d:	ff ff ff 
+  806b70:	48 01 d8             	add    %rbx,%rax
+  806b73:	ff d0                	call   *%rax
+  806b75:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806b78:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b7c:	79 05                	jns    806b83 <opencons+0x77>
+		return r;
+  806b7e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b81:	eb 37                	jmp    806bba <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  806b83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b87:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806b8e:	00 00 00 
+  806b91:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806b94:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  806b96:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b9a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  806ba1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806ba5:	48 89 c7             	mov    %rax,%rdi
+  806ba8:	49 89 df             	mov    %rbx,%r15
+  806bab:	48 b8 c5 ad ff ff ff 	movabs $0xffffffffffffadc5,%rax
+  806bb2:	ff ff ff 
+  806bb5:	48 01 d8             	add    %rbx,%rax
+  806bb8:	ff d0                	call   *%rax
+}
+  806bba:	48 83 c4 10          	add    $0x10,%rsp
+  806bbe:	5b                   	pop    %rbx
+  806bbf:	41 5f                	pop    %r15
+  806bc1:	5d                   	pop    %rbp
+  806bc2:	c3                   	ret
+
+0000000000806bc3 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806bc3:	55                   	push   %rbp
+  806bc4:	48 89 e5             	mov    %rsp,%rbp
+  806bc7:	41 57                	push   %r15
+  806bc9:	53                   	push   %rbx
+  806bca:	48 83 ec 30          	sub    $0x30,%rsp
+  806bce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806bce <devcons_read+0xb>
+  806bd5:	49 bb 72 24 00 00 00 	movabs $0x2472,%r11
+  806bdc:	00 00 00 
+  806bdf:	4c 01 db             	add    %r11,%rbx
+  806be2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806be6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806bea:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806bee:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806bf3:	75 19                	jne    806c0e <devcons_read+0x4b>
+		return 0;
+  806bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  806bfa:	eb 55                	jmp    806c51 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806bfc:	49 89 df             	mov    %rbx,%r15
+  806bff:	48 b8 6f 92 ff ff ff 	movabs $0xffffffffffff926f,%rax
+  806c06:	ff ff ff 
+  806c09:	48 01 d8             	add    %rbx,%rax
+  806c0c:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806c0e:	49 89 df             	mov    %rbx,%r15
+  806c11:	48 b8 6b 91 ff ff ff 	movabs $0xffffffffffff916b,%rax
+  806c18:	ff ff ff 
+  806c1b:	48 01 d8             	add    %rbx,%rax
+  806c1e:	ff d0                	call   *%rax
+  806c20:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806c23:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806c27:	74 d3                	je     806bfc <devcons_read+0x39>
+	if (c < 0)
+  806c29:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806c2d:	79 05                	jns    806c34 <devcons_read+0x71>
+		return c;
+  806c2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c32:	eb 1d                	jmp    806c51 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806c34:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806c38:	75 07                	jne    806c41 <devcons_read+0x7e>
+		return 0;
+  806c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c3f:	eb 10                	jmp    806c51 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806c41:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c44:	89 c2                	mov    %eax,%edx
+  806c46:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806c4a:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806c4c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806c51:	48 83 c4 30          	add    $0x30,%rsp
+  806c55:	5b                   	pop    %rbx
+  806c56:	41 5f                	pop    %r15
+  806c58:	5d                   	pop    %rbp
+  806c59:	c3                   	ret
+
+0000000000806c5a <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806c5a:	55                   	push   %rbp
+  806c5b:	48 89 e5             	mov    %rsp,%rbp
+  806c5e:	41 57                	push   %r15
+  806c60:	53                   	push   %rbx
+  806c61:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806c68:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806c68 <devcons_write+0xe>
+  806c6f:	49 bb d8 23 00 00 00 	movabs $0x23d8,%r11
+  806c76:	00 00 00 
+  806c79:	4c 01 db             	add    %r11,%rbx
+  806c7c:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806c83:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806c8a:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  806c91:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806c98:	e9 80 00 00 00       	jmp    806d1d <devcons_write+0xc3>
+		m = n - tot;
+  806c9d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  806ca4:	89 c2                	mov    %eax,%edx
+  806ca6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ca9:	29 c2                	sub    %eax,%edx
+  806cab:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806cae:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806cb1:	83 f8 7f             	cmp    $0x7f,%eax
+  806cb4:	76 07                	jbe    806cbd <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806cb6:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806cbd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806cc0:	48 63 d0             	movslq %eax,%rdx
+  806cc3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806cc6:	48 63 c8             	movslq %eax,%rcx
+  806cc9:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806cd0:	48 01 c1             	add    %rax,%rcx
+  806cd3:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806cda:	48 89 ce             	mov    %rcx,%rsi
+  806cdd:	48 89 c7             	mov    %rax,%rdi
+  806ce0:	49 89 df             	mov    %rbx,%r15
+  806ce3:	48 b8 e8 89 ff ff ff 	movabs $0xffffffffffff89e8,%rax
+  806cea:	ff ff ff 
+  806ced:	48 01 d8             	add    %rbx,%rax
+  806cf0:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806cf2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806cf5:	48 63 d0             	movslq %eax,%rdx
+  806cf8:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806cff:	48 89 d6             	mov    %rdx,%rsi
+  806d02:	48 89 c7             	mov    %rax,%rdi
+  806d05:	49 89 df             	mov    %rbx,%r15
+  806d08:	48 b8 0c 91 ff ff ff 	movabs $0xffffffffffff910c,%rax
+  806d0f:	ff ff ff 
+  806d12:	48 01 d8             	add    %rbx,%rax
+  806d15:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806d17:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806d1a:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806d1d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d20:	48 98                	cltq
+  806d22:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806d29:	0f 82 6e ff ff ff    	jb     806c9d <devcons_write+0x43>
+	}
+	return tot;
+  806d2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806d32:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806d39:	5b                   	pop    %rbx
+  806d3a:	41 5f                	pop    %r15
+  806d3c:	5d                   	pop    %rbp
+  806d3d:	c3                   	ret
+
+0000000000806d3e <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806d3e:	55                   	push   %rbp
+  806d3f:	48 89 e5             	mov    %rsp,%rbp
+  806d42:	48 83 ec 08          	sub    $0x8,%rsp
+  806d46:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d46 <devcons_close+0x8>
+  806d4d:	49 bb fa 22 00 00 00 	movabs $0x22fa,%r11
+  806d54:	00 00 00 
+  806d57:	4c 01 d8             	add    %r11,%rax
+  806d5a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806d63:	c9                   	leave
+  806d64:	c3                   	ret
+
+0000000000806d65 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806d65:	55                   	push   %rbp
+  806d66:	48 89 e5             	mov    %rsp,%rbp
+  806d69:	41 57                	push   %r15
+  806d6b:	48 83 ec 18          	sub    $0x18,%rsp
+  806d6f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d6f <devcons_stat+0xa>
+  806d76:	49 bb d1 22 00 00 00 	movabs $0x22d1,%r11
+  806d7d:	00 00 00 
+  806d80:	4c 01 d8             	add    %r11,%rax
+  806d83:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806d87:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806d8b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806d8f:	48 b9 ad e6 ff ff ff 	movabs $0xffffffffffffe6ad,%rcx
+  806d96:	ff ff ff 
+  806d99:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806d9d:	48 89 ce             	mov    %rcx,%rsi
+  806da0:	48 89 d7             	mov    %rdx,%rdi
+  806da3:	49 89 c7             	mov    %rax,%r15
+  806da6:	48 ba 08 86 ff ff ff 	movabs $0xffffffffffff8608,%rdx
+  806dad:	ff ff ff 
+  806db0:	48 01 c2             	add    %rax,%rdx
+  806db3:	ff d2                	call   *%rdx
+	return 0;
+  806db5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806dba:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806dbe:	c9                   	leave
+  806dbf:	c3                   	ret
+
+0000000000806dc0 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806dc0:	55                   	push   %rbp
+  806dc1:	48 89 e5             	mov    %rsp,%rbp
+  806dc4:	41 57                	push   %r15
+  806dc6:	53                   	push   %rbx
+  806dc7:	48 83 ec 20          	sub    $0x20,%rsp
+  806dcb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806dcb <set_pgfault_handler+0xb>
+  806dd2:	49 bb 75 22 00 00 00 	movabs $0x2275,%r11
+  806dd9:	00 00 00 
+  806ddc:	4c 01 db             	add    %r11,%rbx
+  806ddf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806de3:	49 89 df             	mov    %rbx,%r15
+  806de6:	48 b8 1b 92 ff ff ff 	movabs $0xffffffffffff921b,%rax
+  806ded:	ff ff ff 
+  806df0:	48 01 d8             	add    %rbx,%rax
+  806df3:	ff d0                	call   *%rax
+  806df5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806df8:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806dff:	00 00 00 
+  806e02:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806e06:	48 85 c0             	test   %rax,%rax
+  806e09:	75 6b                	jne    806e76 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806e0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e0e:	ba 07 00 00 00       	mov    $0x7,%edx
+  806e13:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806e18:	48 89 ce             	mov    %rcx,%rsi
+  806e1b:	89 c7                	mov    %eax,%edi
+  806e1d:	49 89 df             	mov    %rbx,%r15
+  806e20:	48 b8 c4 92 ff ff ff 	movabs $0xffffffffffff92c4,%rax
+  806e27:	ff ff ff 
+  806e2a:	48 01 d8             	add    %rbx,%rax
+  806e2d:	ff d0                	call   *%rax
+  806e2f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806e32:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806e36:	74 3e                	je     806e76 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806e38:	48 b8 b8 e6 ff ff ff 	movabs $0xffffffffffffe6b8,%rax
+  806e3f:	ff ff ff 
+  806e42:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806e46:	48 89 c2             	mov    %rax,%rdx
+  806e49:	be 23 00 00 00       	mov    $0x23,%esi
+  806e4e:	48 b8 e6 e6 ff ff ff 	movabs $0xffffffffffffe6e6,%rax
+  806e55:	ff ff ff 
+  806e58:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806e5c:	48 89 c7             	mov    %rax,%rdi
+  806e5f:	49 89 df             	mov    %rbx,%r15
+  806e62:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e67:	48 b9 6f 75 ff ff ff 	movabs $0xffffffffffff756f,%rcx
+  806e6e:	ff ff ff 
+  806e71:	48 01 d9             	add    %rbx,%rcx
+  806e74:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806e76:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806e7d:	00 00 00 
+  806e80:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806e84:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806e88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e8b:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806e92:	ff ff ff 
+  806e95:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806e99:	48 89 d6             	mov    %rdx,%rsi
+  806e9c:	89 c7                	mov    %eax,%edi
+  806e9e:	49 89 df             	mov    %rbx,%r15
+  806ea1:	48 b8 ba 94 ff ff ff 	movabs $0xffffffffffff94ba,%rax
+  806ea8:	ff ff ff 
+  806eab:	48 01 d8             	add    %rbx,%rax
+  806eae:	ff d0                	call   *%rax
+}
+  806eb0:	90                   	nop
+  806eb1:	48 83 c4 20          	add    $0x20,%rsp
+  806eb5:	5b                   	pop    %rbx
+  806eb6:	41 5f                	pop    %r15
+  806eb8:	5d                   	pop    %rbp
+  806eb9:	c3                   	ret
+
+0000000000806eba <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806eba:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806ebd:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806ec4:	00 00 00 
+call *%rax
+  806ec7:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806ec9:	58                   	pop    %rax
+	popq %rax;
+  806eca:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806ecb:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806ed2:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806ed6:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806eda:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806ede:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806ee2:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806ee6:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806ee9:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806eed:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806ef1:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806ef6:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806efb:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806f00:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806f05:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806f0a:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806f0f:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806f14:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806f19:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806f1e:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806f23:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806f28:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806f2d:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806f32:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806f37:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806f3b:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806f3f:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806f40:	5c                   	pop    %rsp
+	ret;			//return
+  806f41:	c3                   	ret
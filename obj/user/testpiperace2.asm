@@ -0,0 +1,10735 @@
+
+obj/user/testpiperace2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 f1 03 00 00       	call   800432 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 30          	sub    $0x30,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800065:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int p[2], r, i;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for pipeisclosed race...\n");
+  800069:	48 b8 90 de ff ff ff 	movabs $0xffffffffffffde90,%rax
+  800070:	ff ff ff 
+  800073:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800077:	48 89 c7             	mov    %rax,%rdi
+  80007a:	49 89 df             	mov    %rbx,%r15
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	48 ba d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rdx
+  800089:	ff ff ff 
+  80008c:	48 01 da             	add    %rbx,%rdx
+  80008f:	ff d2                	call   *%rdx
+	if ((r = pipe(p)) < 0)
+  800091:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  800095:	48 89 c7             	mov    %rax,%rdi
+  800098:	49 89 df             	mov    %rbx,%r15
+  80009b:	48 b8 3f c9 ff ff ff 	movabs $0xffffffffffffc93f,%rax
+  8000a2:	ff ff ff 
+  8000a5:	48 01 d8             	add    %rbx,%rax
+  8000a8:	ff d0                	call   *%rax
+  8000aa:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8000ad:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8000b1:	79 44                	jns    8000f7 <umain+0xb4>
+		panic("pipe: %e", r);
+  8000b3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8000b6:	89 c1                	mov    %eax,%ecx
+  8000b8:	48 b8 b2 de ff ff ff 	movabs $0xffffffffffffdeb2,%rax
+  8000bf:	ff ff ff 
+  8000c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000c6:	48 89 c2             	mov    %rax,%rdx
+  8000c9:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000ce:	48 b8 bb de ff ff ff 	movabs $0xffffffffffffdebb,%rax
+  8000d5:	ff ff ff 
+  8000d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000dc:	48 89 c7             	mov    %rax,%rdi
+  8000df:	49 89 df             	mov    %rbx,%r15
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	49 b8 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%r8
+  8000ee:	ff ff ff 
+  8000f1:	49 01 d8             	add    %rbx,%r8
+  8000f4:	41 ff d0             	call   *%r8
+	if ((r = fork()) < 0)
+  8000f7:	49 89 df             	mov    %rbx,%r15
+  8000fa:	48 b8 e0 a1 ff ff ff 	movabs $0xffffffffffffa1e0,%rax
+  800101:	ff ff ff 
+  800104:	48 01 d8             	add    %rbx,%rax
+  800107:	ff d0                	call   *%rax
+  800109:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80010c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800110:	79 44                	jns    800156 <umain+0x113>
+		panic("fork: %e", r);
+  800112:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800115:	89 c1                	mov    %eax,%ecx
+  800117:	48 b8 d0 de ff ff ff 	movabs $0xffffffffffffded0,%rax
+  80011e:	ff ff ff 
+  800121:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800125:	48 89 c2             	mov    %rax,%rdx
+  800128:	be 0f 00 00 00       	mov    $0xf,%esi
+  80012d:	48 b8 bb de ff ff ff 	movabs $0xffffffffffffdebb,%rax
+  800134:	ff ff ff 
+  800137:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80013b:	48 89 c7             	mov    %rax,%rdi
+  80013e:	49 89 df             	mov    %rbx,%r15
+  800141:	b8 00 00 00 00       	mov    $0x0,%eax
+  800146:	49 b8 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%r8
+  80014d:	ff ff ff 
+  800150:	49 01 d8             	add    %rbx,%r8
+  800153:	41 ff d0             	call   *%r8
+	if (r == 0) {
+  800156:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80015a:	0f 85 f8 00 00 00    	jne    800258 <umain+0x215>
+		// child just dups and closes repeatedly,
+		// yielding so the parent can see
+		// the fd state between the two.
+		close(p[1]);
+  800160:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800163:	89 c7                	mov    %eax,%edi
+  800165:	49 89 df             	mov    %rbx,%r15
+  800168:	48 b8 45 a9 ff ff ff 	movabs $0xffffffffffffa945,%rax
+  80016f:	ff ff ff 
+  800172:	48 01 d8             	add    %rbx,%rax
+  800175:	ff d0                	call   *%rax
+		for (i = 0; i < 200; i++) {
+  800177:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80017e:	e9 b6 00 00 00       	jmp    800239 <umain+0x1f6>
+			if (i % 10 == 0)
+  800183:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800186:	48 63 c1             	movslq %ecx,%rax
+  800189:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+  800190:	48 c1 e8 20          	shr    $0x20,%rax
+  800194:	89 c2                	mov    %eax,%edx
+  800196:	c1 fa 02             	sar    $0x2,%edx
+  800199:	89 c8                	mov    %ecx,%eax
+  80019b:	c1 f8 1f             	sar    $0x1f,%eax
+  80019e:	29 c2                	sub    %eax,%edx
+  8001a0:	89 d0                	mov    %edx,%eax
+  8001a2:	c1 e0 02             	shl    $0x2,%eax
+  8001a5:	01 d0                	add    %edx,%eax
+  8001a7:	01 c0                	add    %eax,%eax
+  8001a9:	29 c1                	sub    %eax,%ecx
+  8001ab:	89 ca                	mov    %ecx,%edx
+  8001ad:	85 d2                	test   %edx,%edx
+  8001af:	75 2d                	jne    8001de <umain+0x19b>
+				cprintf("%d.", i);
+  8001b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001b4:	89 c6                	mov    %eax,%esi
+  8001b6:	48 b8 d9 de ff ff ff 	movabs $0xffffffffffffded9,%rax
+  8001bd:	ff ff ff 
+  8001c0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001c4:	48 89 c7             	mov    %rax,%rdi
+  8001c7:	49 89 df             	mov    %rbx,%r15
+  8001ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001cf:	48 ba d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rdx
+  8001d6:	ff ff ff 
+  8001d9:	48 01 da             	add    %rbx,%rdx
+  8001dc:	ff d2                	call   *%rdx
+			// dup, then close.  yield so that other guy will
+			// see us while we're between them.
+			dup(p[0], 10);
+  8001de:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8001e1:	be 0a 00 00 00       	mov    $0xa,%esi
+  8001e6:	89 c7                	mov    %eax,%edi
+  8001e8:	49 89 df             	mov    %rbx,%r15
+  8001eb:	48 b8 fe a9 ff ff ff 	movabs $0xffffffffffffa9fe,%rax
+  8001f2:	ff ff ff 
+  8001f5:	48 01 d8             	add    %rbx,%rax
+  8001f8:	ff d0                	call   *%rax
+			sys_yield();
+  8001fa:	49 89 df             	mov    %rbx,%r15
+  8001fd:	48 b8 fc 91 ff ff ff 	movabs $0xffffffffffff91fc,%rax
+  800204:	ff ff ff 
+  800207:	48 01 d8             	add    %rbx,%rax
+  80020a:	ff d0                	call   *%rax
+			close(10);
+  80020c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800211:	49 89 df             	mov    %rbx,%r15
+  800214:	48 b8 45 a9 ff ff ff 	movabs $0xffffffffffffa945,%rax
+  80021b:	ff ff ff 
+  80021e:	48 01 d8             	add    %rbx,%rax
+  800221:	ff d0                	call   *%rax
+			sys_yield();
+  800223:	49 89 df             	mov    %rbx,%r15
+  800226:	48 b8 fc 91 ff ff ff 	movabs $0xffffffffffff91fc,%rax
+  80022d:	ff ff ff 
+  800230:	48 01 d8             	add    %rbx,%rax
+  800233:	ff d0                	call   *%rax
+		for (i = 0; i < 200; i++) {
+  800235:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  800239:	81 7d ec c7 00 00 00 	cmpl   $0xc7,-0x14(%rbp)
+  800240:	0f 8e 3d ff ff ff    	jle    800183 <umain+0x140>
+		}
+		exit();
+  800246:	49 89 df             	mov    %rbx,%r15
+  800249:	48 b8 b2 74 ff ff ff 	movabs $0xffffffffffff74b2,%rax
+  800250:	ff ff ff 
+  800253:	48 01 d8             	add    %rbx,%rax
+  800256:	ff d0                	call   *%rax
+	// pageref(p[0]) and gets 3, then it will return true when
+	// it shouldn't.
+	//
+	// So either way, pipeisclosed is going give a wrong answer.
+	//
+	kid = &envs[ENVX(r)];
+  800258:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80025b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800260:	48 98                	cltq
+  800262:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800269:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800270:	ff ff ff 
+  800273:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800277:	48 01 d0             	add    %rdx,%rax
+  80027a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (kid->env_status == ENV_RUNNABLE)
+  80027e:	eb 6c                	jmp    8002ec <umain+0x2a9>
+		if (pipeisclosed(p[0]) != 0) {
+  800280:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800283:	89 c7                	mov    %eax,%edi
+  800285:	49 89 df             	mov    %rbx,%r15
+  800288:	48 b8 c0 cc ff ff ff 	movabs $0xffffffffffffccc0,%rax
+  80028f:	ff ff ff 
+  800292:	48 01 d8             	add    %rbx,%rax
+  800295:	ff d0                	call   *%rax
+  800297:	85 c0                	test   %eax,%eax
+  800299:	74 51                	je     8002ec <umain+0x2a9>
+			cprintf("\nRACE: pipe appears closed\n");
+  80029b:	48 b8 dd de ff ff ff 	movabs $0xffffffffffffdedd,%rax
+  8002a2:	ff ff ff 
+  8002a5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002a9:	48 89 c7             	mov    %rax,%rdi
+  8002ac:	49 89 df             	mov    %rbx,%r15
+  8002af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b4:	48 ba d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rdx
+  8002bb:	ff ff ff 
+  8002be:	48 01 da             	add    %rbx,%rdx
+  8002c1:	ff d2                	call   *%rdx
+			sys_env_destroy(r);
+  8002c3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8002c6:	89 c7                	mov    %eax,%edi
+  8002c8:	49 89 df             	mov    %rbx,%r15
+  8002cb:	48 b8 4c 91 ff ff ff 	movabs $0xffffffffffff914c,%rax
+  8002d2:	ff ff ff 
+  8002d5:	48 01 d8             	add    %rbx,%rax
+  8002d8:	ff d0                	call   *%rax
+			exit();
+  8002da:	49 89 df             	mov    %rbx,%r15
+  8002dd:	48 b8 b2 74 ff ff ff 	movabs $0xffffffffffff74b2,%rax
+  8002e4:	ff ff ff 
+  8002e7:	48 01 d8             	add    %rbx,%rax
+  8002ea:	ff d0                	call   *%rax
+	while (kid->env_status == ENV_RUNNABLE)
+  8002ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002f0:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  8002f6:	83 f8 02             	cmp    $0x2,%eax
+  8002f9:	74 85                	je     800280 <umain+0x23d>
+		}
+	cprintf("child done with loop\n");
+  8002fb:	48 b8 f9 de ff ff ff 	movabs $0xffffffffffffdef9,%rax
+  800302:	ff ff ff 
+  800305:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800309:	48 89 c7             	mov    %rax,%rdi
+  80030c:	49 89 df             	mov    %rbx,%r15
+  80030f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800314:	48 ba d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rdx
+  80031b:	ff ff ff 
+  80031e:	48 01 da             	add    %rbx,%rdx
+  800321:	ff d2                	call   *%rdx
+	if (pipeisclosed(p[0]))
+  800323:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800326:	89 c7                	mov    %eax,%edi
+  800328:	49 89 df             	mov    %rbx,%r15
+  80032b:	48 b8 c0 cc ff ff ff 	movabs $0xffffffffffffccc0,%rax
+  800332:	ff ff ff 
+  800335:	48 01 d8             	add    %rbx,%rax
+  800338:	ff d0                	call   *%rax
+  80033a:	85 c0                	test   %eax,%eax
+  80033c:	74 3e                	je     80037c <umain+0x339>
+		panic("somehow the other end of p[0] got closed!");
+  80033e:	48 b8 10 df ff ff ff 	movabs $0xffffffffffffdf10,%rax
+  800345:	ff ff ff 
+  800348:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80034c:	48 89 c2             	mov    %rax,%rdx
+  80034f:	be 40 00 00 00       	mov    $0x40,%esi
+  800354:	48 b8 bb de ff ff ff 	movabs $0xffffffffffffdebb,%rax
+  80035b:	ff ff ff 
+  80035e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800362:	48 89 c7             	mov    %rax,%rdi
+  800365:	49 89 df             	mov    %rbx,%r15
+  800368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036d:	48 b9 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%rcx
+  800374:	ff ff ff 
+  800377:	48 01 d9             	add    %rbx,%rcx
+  80037a:	ff d1                	call   *%rcx
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  80037c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80037f:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  800383:	48 89 d6             	mov    %rdx,%rsi
+  800386:	89 c7                	mov    %eax,%edi
+  800388:	49 89 df             	mov    %rbx,%r15
+  80038b:	48 b8 b6 a6 ff ff ff 	movabs $0xffffffffffffa6b6,%rax
+  800392:	ff ff ff 
+  800395:	48 01 d8             	add    %rbx,%rax
+  800398:	ff d0                	call   *%rax
+  80039a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80039d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8003a1:	79 44                	jns    8003e7 <umain+0x3a4>
+		panic("cannot look up p[0]: %e", r);
+  8003a3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003a6:	89 c1                	mov    %eax,%ecx
+  8003a8:	48 b8 3a df ff ff ff 	movabs $0xffffffffffffdf3a,%rax
+  8003af:	ff ff ff 
+  8003b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003b6:	48 89 c2             	mov    %rax,%rdx
+  8003b9:	be 42 00 00 00       	mov    $0x42,%esi
+  8003be:	48 b8 bb de ff ff ff 	movabs $0xffffffffffffdebb,%rax
+  8003c5:	ff ff ff 
+  8003c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003cc:	48 89 c7             	mov    %rax,%rdi
+  8003cf:	49 89 df             	mov    %rbx,%r15
+  8003d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d7:	49 b8 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%r8
+  8003de:	ff ff ff 
+  8003e1:	49 01 d8             	add    %rbx,%r8
+  8003e4:	41 ff d0             	call   *%r8
+	(void) fd2data(fd);
+  8003e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8003eb:	48 89 c7             	mov    %rax,%rdi
+  8003ee:	49 89 df             	mov    %rbx,%r15
+  8003f1:	48 b8 bd a5 ff ff ff 	movabs $0xffffffffffffa5bd,%rax
+  8003f8:	ff ff ff 
+  8003fb:	48 01 d8             	add    %rbx,%rax
+  8003fe:	ff d0                	call   *%rax
+	cprintf("race didn't happen\n");
+  800400:	48 b8 52 df ff ff ff 	movabs $0xffffffffffffdf52,%rax
+  800407:	ff ff ff 
+  80040a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80040e:	48 89 c7             	mov    %rax,%rdi
+  800411:	49 89 df             	mov    %rbx,%r15
+  800414:	b8 00 00 00 00       	mov    $0x0,%eax
+  800419:	48 ba d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rdx
+  800420:	ff ff ff 
+  800423:	48 01 da             	add    %rbx,%rdx
+  800426:	ff d2                	call   *%rdx
+}
+  800428:	90                   	nop
+  800429:	48 83 c4 30          	add    $0x30,%rsp
+  80042d:	5b                   	pop    %rbx
+  80042e:	41 5f                	pop    %r15
+  800430:	5d                   	pop    %rbp
+  800431:	c3                   	ret
+
+0000000000800432 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800432:	55                   	push   %rbp
+  800433:	48 89 e5             	mov    %rsp,%rbp
+  800436:	41 57                	push   %r15
+  800438:	53                   	push   %rbx
+  800439:	48 83 ec 20          	sub    $0x20,%rsp
+  80043d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80043d <libmain+0xb>
+  800444:	49 bb 03 8c 00 00 00 	movabs $0x8c03,%r11
+  80044b:	00 00 00 
+  80044e:	4c 01 db             	add    %r11,%rbx
+  800451:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800454:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800458:	49 89 df             	mov    %rbx,%r15
+  80045b:	48 b8 a8 91 ff ff ff 	movabs $0xffffffffffff91a8,%rax
+  800462:	ff ff ff 
+  800465:	48 01 d8             	add    %rbx,%rax
+  800468:	ff d0                	call   *%rax
+  80046a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  80046d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800470:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800475:	48 98                	cltq
+  800477:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80047e:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800485:	ff ff ff 
+  800488:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80048c:	48 01 c2             	add    %rax,%rdx
+  80048f:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  800496:	00 00 00 
+  800499:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80049d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8004a1:	7e 15                	jle    8004b8 <libmain+0x86>
+		binaryname = argv[0];
+  8004a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8004a7:	48 8b 00             	mov    (%rax),%rax
+  8004aa:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  8004b1:	00 00 00 
+  8004b4:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8004b8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8004bc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8004bf:	48 89 d6             	mov    %rdx,%rsi
+  8004c2:	89 c7                	mov    %eax,%edi
+  8004c4:	49 89 df             	mov    %rbx,%r15
+  8004c7:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  8004ce:	ff ff ff 
+  8004d1:	48 01 d8             	add    %rbx,%rax
+  8004d4:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8004d6:	49 89 df             	mov    %rbx,%r15
+  8004d9:	48 b8 b2 74 ff ff ff 	movabs $0xffffffffffff74b2,%rax
+  8004e0:	ff ff ff 
+  8004e3:	48 01 d8             	add    %rbx,%rax
+  8004e6:	ff d0                	call   *%rax
+}
+  8004e8:	90                   	nop
+  8004e9:	48 83 c4 20          	add    $0x20,%rsp
+  8004ed:	5b                   	pop    %rbx
+  8004ee:	41 5f                	pop    %r15
+  8004f0:	5d                   	pop    %rbp
+  8004f1:	c3                   	ret
+
+00000000008004f2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8004f2:	55                   	push   %rbp
+  8004f3:	48 89 e5             	mov    %rsp,%rbp
+  8004f6:	41 57                	push   %r15
+  8004f8:	53                   	push   %rbx
+  8004f9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004f9 <exit+0x7>
+  800500:	49 bb 47 8b 00 00 00 	movabs $0x8b47,%r11
+  800507:	00 00 00 
+  80050a:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80050d:	49 89 df             	mov    %rbx,%r15
+  800510:	48 b8 b1 a9 ff ff ff 	movabs $0xffffffffffffa9b1,%rax
+  800517:	ff ff ff 
+  80051a:	48 01 d8             	add    %rbx,%rax
+  80051d:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80051f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800524:	49 89 df             	mov    %rbx,%r15
+  800527:	48 b8 4c 91 ff ff ff 	movabs $0xffffffffffff914c,%rax
+  80052e:	ff ff ff 
+  800531:	48 01 d8             	add    %rbx,%rax
+  800534:	ff d0                	call   *%rax
+}
+  800536:	90                   	nop
+  800537:	5b                   	pop    %rbx
+  800538:	41 5f                	pop    %r15
+  80053a:	5d                   	pop    %rbp
+  80053b:	c3                   	ret
+
+000000000080053c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80053c:	55                   	push   %rbp
+  80053d:	48 89 e5             	mov    %rsp,%rbp
+  800540:	41 57                	push   %r15
+  800542:	41 54                	push   %r12
+  800544:	53                   	push   %rbx
+  800545:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80054c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80054c <_panic+0x10>
+  800553:	49 bb f4 8a 00 00 00 	movabs $0x8af4,%r11
+  80055a:	00 00 00 
+  80055d:	4c 01 db             	add    %r11,%rbx
+  800560:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800567:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80056d:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800574:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80057b:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800582:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800589:	84 c0                	test   %al,%al
+  80058b:	74 26                	je     8005b3 <_panic+0x77>
+  80058d:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800594:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80059b:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80059f:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8005a3:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8005a7:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8005ab:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8005af:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005b3:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8005ba:	00 00 00 
+  8005bd:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8005c4:	00 00 00 
+  8005c7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005cb:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8005d2:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8005d9:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005e0:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  8005e7:	ff ff ff 
+  8005ea:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8005ee:	4c 8b 20             	mov    (%rax),%r12
+  8005f1:	49 89 df             	mov    %rbx,%r15
+  8005f4:	48 b8 a8 91 ff ff ff 	movabs $0xffffffffffff91a8,%rax
+  8005fb:	ff ff ff 
+  8005fe:	48 01 d8             	add    %rbx,%rax
+  800601:	ff d0                	call   *%rax
+  800603:	89 c6                	mov    %eax,%esi
+  800605:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80060b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800612:	41 89 d0             	mov    %edx,%r8d
+  800615:	48 89 c1             	mov    %rax,%rcx
+  800618:	4c 89 e2             	mov    %r12,%rdx
+  80061b:	48 b8 70 df ff ff ff 	movabs $0xffffffffffffdf70,%rax
+  800622:	ff ff ff 
+  800625:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800629:	48 89 c7             	mov    %rax,%rdi
+  80062c:	49 89 df             	mov    %rbx,%r15
+  80062f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800634:	49 b9 d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%r9
+  80063b:	ff ff ff 
+  80063e:	49 01 d9             	add    %rbx,%r9
+  800641:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800644:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80064b:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800652:	48 89 d6             	mov    %rdx,%rsi
+  800655:	48 89 c7             	mov    %rax,%rdi
+  800658:	49 89 df             	mov    %rbx,%r15
+  80065b:	48 b8 f3 76 ff ff ff 	movabs $0xffffffffffff76f3,%rax
+  800662:	ff ff ff 
+  800665:	48 01 d8             	add    %rbx,%rax
+  800668:	ff d0                	call   *%rax
+	cprintf("\n");
+  80066a:	48 b8 93 df ff ff ff 	movabs $0xffffffffffffdf93,%rax
+  800671:	ff ff ff 
+  800674:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800678:	48 89 c7             	mov    %rax,%rdi
+  80067b:	49 89 df             	mov    %rbx,%r15
+  80067e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800683:	48 ba d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rdx
+  80068a:	ff ff ff 
+  80068d:	48 01 da             	add    %rbx,%rdx
+  800690:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800692:	cc                   	int3
+  800693:	eb fd                	jmp    800692 <_panic+0x156>
+
+0000000000800695 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800695:	55                   	push   %rbp
+  800696:	48 89 e5             	mov    %rsp,%rbp
+  800699:	41 57                	push   %r15
+  80069b:	48 83 ec 18          	sub    $0x18,%rsp
+  80069f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80069f <putch+0xa>
+  8006a6:	49 bb a1 89 00 00 00 	movabs $0x89a1,%r11
+  8006ad:	00 00 00 
+  8006b0:	4c 01 d8             	add    %r11,%rax
+  8006b3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8006b6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8006ba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8006be:	8b 12                	mov    (%rdx),%edx
+  8006c0:	8d 72 01             	lea    0x1(%rdx),%esi
+  8006c3:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8006c7:	89 31                	mov    %esi,(%rcx)
+  8006c9:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8006cc:	89 ce                	mov    %ecx,%esi
+  8006ce:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8006d2:	48 63 d2             	movslq %edx,%rdx
+  8006d5:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8006da:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8006de:	8b 12                	mov    (%rdx),%edx
+  8006e0:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8006e6:	75 33                	jne    80071b <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8006e8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8006ec:	8b 12                	mov    (%rdx),%edx
+  8006ee:	48 63 d2             	movslq %edx,%rdx
+  8006f1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8006f5:	48 83 c1 08          	add    $0x8,%rcx
+  8006f9:	48 89 d6             	mov    %rdx,%rsi
+  8006fc:	48 89 cf             	mov    %rcx,%rdi
+  8006ff:	49 89 c7             	mov    %rax,%r15
+  800702:	48 ba 99 90 ff ff ff 	movabs $0xffffffffffff9099,%rdx
+  800709:	ff ff ff 
+  80070c:	48 01 c2             	add    %rax,%rdx
+  80070f:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800711:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800715:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  80071b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80071f:	8b 40 04             	mov    0x4(%rax),%eax
+  800722:	8d 50 01             	lea    0x1(%rax),%edx
+  800725:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800729:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80072c:	90                   	nop
+  80072d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800731:	c9                   	leave
+  800732:	c3                   	ret
+
+0000000000800733 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800733:	55                   	push   %rbp
+  800734:	48 89 e5             	mov    %rsp,%rbp
+  800737:	41 57                	push   %r15
+  800739:	53                   	push   %rbx
+  80073a:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800741:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800741 <vcprintf+0xe>
+  800748:	49 bb ff 88 00 00 00 	movabs $0x88ff,%r11
+  80074f:	00 00 00 
+  800752:	4c 01 db             	add    %r11,%rbx
+  800755:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  80075c:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800763:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80076a:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800771:	48 8b 06             	mov    (%rsi),%rax
+  800774:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800778:	48 89 01             	mov    %rax,(%rcx)
+  80077b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80077f:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800783:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800787:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  80078e:	00 00 00 
+    b.cnt = 0;
+  800791:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800798:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  80079b:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8007a2:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8007a9:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8007b0:	48 89 c6             	mov    %rax,%rsi
+  8007b3:	48 b8 55 76 ff ff ff 	movabs $0xffffffffffff7655,%rax
+  8007ba:	ff ff ff 
+  8007bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007c1:	48 89 c7             	mov    %rax,%rdi
+  8007c4:	49 89 df             	mov    %rbx,%r15
+  8007c7:	48 b8 17 7c ff ff ff 	movabs $0xffffffffffff7c17,%rax
+  8007ce:	ff ff ff 
+  8007d1:	48 01 d8             	add    %rbx,%rax
+  8007d4:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8007d6:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8007dc:	48 98                	cltq
+  8007de:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8007e5:	48 83 c2 08          	add    $0x8,%rdx
+  8007e9:	48 89 c6             	mov    %rax,%rsi
+  8007ec:	48 89 d7             	mov    %rdx,%rdi
+  8007ef:	49 89 df             	mov    %rbx,%r15
+  8007f2:	48 b8 99 90 ff ff ff 	movabs $0xffffffffffff9099,%rax
+  8007f9:	ff ff ff 
+  8007fc:	48 01 d8             	add    %rbx,%rax
+  8007ff:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800801:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800807:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  80080e:	5b                   	pop    %rbx
+  80080f:	41 5f                	pop    %r15
+  800811:	5d                   	pop    %rbp
+  800812:	c3                   	ret
+
+0000000000800813 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800813:	55                   	push   %rbp
+  800814:	48 89 e5             	mov    %rsp,%rbp
+  800817:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80081e:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80081e <cprintf+0xb>
+  800825:	49 bb 22 88 00 00 00 	movabs $0x8822,%r11
+  80082c:	00 00 00 
+  80082f:	4d 01 da             	add    %r11,%r10
+  800832:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800839:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800840:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800847:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80084e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800855:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80085c:	84 c0                	test   %al,%al
+  80085e:	74 20                	je     800880 <cprintf+0x6d>
+  800860:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800864:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800868:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80086c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800870:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800874:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800878:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80087c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800880:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800887:	00 00 00 
+  80088a:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800891:	00 00 00 
+  800894:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800898:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80089f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8008a6:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8008ad:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8008b4:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8008bb:	48 8b 06             	mov    (%rsi),%rax
+  8008be:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8008c2:	48 89 01             	mov    %rax,(%rcx)
+  8008c5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8008c9:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8008cd:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8008d1:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8008d8:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8008df:	48 89 d6             	mov    %rdx,%rsi
+  8008e2:	48 89 c7             	mov    %rax,%rdi
+  8008e5:	48 b8 f3 76 ff ff ff 	movabs $0xffffffffffff76f3,%rax
+  8008ec:	ff ff ff 
+  8008ef:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8008f3:	ff d0                	call   *%rax
+  8008f5:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8008fb:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800901:	c9                   	leave
+  800902:	c3                   	ret
+
+0000000000800903 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800903:	55                   	push   %rbp
+  800904:	48 89 e5             	mov    %rsp,%rbp
+  800907:	53                   	push   %rbx
+  800908:	48 83 ec 38          	sub    $0x38,%rsp
+  80090c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80090c <printnum+0x9>
+  800913:	49 bb 34 87 00 00 00 	movabs $0x8734,%r11
+  80091a:	00 00 00 
+  80091d:	4c 01 db             	add    %r11,%rbx
+  800920:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800924:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800928:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80092c:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80092f:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800933:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800937:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80093a:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80093e:	72 58                	jb     800998 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800940:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800943:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800946:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800949:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80094d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800952:	48 f7 f6             	div    %rsi
+  800955:	49 89 c2             	mov    %rax,%r10
+  800958:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80095b:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80095e:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800962:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800966:	41 89 c9             	mov    %ecx,%r9d
+  800969:	41 89 f8             	mov    %edi,%r8d
+  80096c:	89 d1                	mov    %edx,%ecx
+  80096e:	4c 89 d2             	mov    %r10,%rdx
+  800971:	48 89 c7             	mov    %rax,%rdi
+  800974:	48 b8 c3 78 ff ff ff 	movabs $0xffffffffffff78c3,%rax
+  80097b:	ff ff ff 
+  80097e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800982:	ff d0                	call   *%rax
+  800984:	eb 1c                	jmp    8009a2 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800986:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80098a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80098d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800991:	48 89 d6             	mov    %rdx,%rsi
+  800994:	89 c7                	mov    %eax,%edi
+  800996:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800998:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  80099c:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8009a0:	7f e4                	jg     800986 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8009a2:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8009a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ae:	48 f7 f1             	div    %rcx
+  8009b1:	48 b8 cf e0 ff ff ff 	movabs $0xffffffffffffe0cf,%rax
+  8009b8:	ff ff ff 
+  8009bb:	48 01 d8             	add    %rbx,%rax
+  8009be:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8009c2:	0f be c0             	movsbl %al,%eax
+  8009c5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8009c9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009cd:	48 89 d6             	mov    %rdx,%rsi
+  8009d0:	89 c7                	mov    %eax,%edi
+  8009d2:	ff d1                	call   *%rcx
+}
+  8009d4:	90                   	nop
+  8009d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009d9:	c9                   	leave
+  8009da:	c3                   	ret
+
+00000000008009db <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8009db:	55                   	push   %rbp
+  8009dc:	48 89 e5             	mov    %rsp,%rbp
+  8009df:	48 83 ec 20          	sub    $0x20,%rsp
+  8009e3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8009e3 <getuint+0x8>
+  8009ea:	49 bb 5d 86 00 00 00 	movabs $0x865d,%r11
+  8009f1:	00 00 00 
+  8009f4:	4c 01 d8             	add    %r11,%rax
+  8009f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8009fb:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8009fe:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800a02:	7e 4f                	jle    800a53 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800a04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a08:	8b 00                	mov    (%rax),%eax
+  800a0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0d:	77 24                	ja     800a33 <getuint+0x58>
+  800a0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a13:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a17:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a1b:	8b 00                	mov    (%rax),%eax
+  800a1d:	89 c0                	mov    %eax,%eax
+  800a1f:	48 01 d0             	add    %rdx,%rax
+  800a22:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a26:	8b 12                	mov    (%rdx),%edx
+  800a28:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a2b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a2f:	89 0a                	mov    %ecx,(%rdx)
+  800a31:	eb 14                	jmp    800a47 <getuint+0x6c>
+  800a33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a37:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a3b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a3f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a43:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a47:	48 8b 00             	mov    (%rax),%rax
+  800a4a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a4e:	e9 9d 00 00 00       	jmp    800af0 <getuint+0x115>
+	else if (lflag)
+  800a53:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800a57:	74 4c                	je     800aa5 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800a59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a5d:	8b 00                	mov    (%rax),%eax
+  800a5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a62:	77 24                	ja     800a88 <getuint+0xad>
+  800a64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a68:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a70:	8b 00                	mov    (%rax),%eax
+  800a72:	89 c0                	mov    %eax,%eax
+  800a74:	48 01 d0             	add    %rdx,%rax
+  800a77:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a7b:	8b 12                	mov    (%rdx),%edx
+  800a7d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a80:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a84:	89 0a                	mov    %ecx,(%rdx)
+  800a86:	eb 14                	jmp    800a9c <getuint+0xc1>
+  800a88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a8c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a90:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a94:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a98:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a9c:	48 8b 00             	mov    (%rax),%rax
+  800a9f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800aa3:	eb 4b                	jmp    800af0 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800aa5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa9:	8b 00                	mov    (%rax),%eax
+  800aab:	83 f8 2f             	cmp    $0x2f,%eax
+  800aae:	77 24                	ja     800ad4 <getuint+0xf9>
+  800ab0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ab8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800abc:	8b 00                	mov    (%rax),%eax
+  800abe:	89 c0                	mov    %eax,%eax
+  800ac0:	48 01 d0             	add    %rdx,%rax
+  800ac3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ac7:	8b 12                	mov    (%rdx),%edx
+  800ac9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800acc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ad0:	89 0a                	mov    %ecx,(%rdx)
+  800ad2:	eb 14                	jmp    800ae8 <getuint+0x10d>
+  800ad4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800adc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ae0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ae4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ae8:	8b 00                	mov    (%rax),%eax
+  800aea:	89 c0                	mov    %eax,%eax
+  800aec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800af0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800af4:	c9                   	leave
+  800af5:	c3                   	ret
+
+0000000000800af6 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800af6:	55                   	push   %rbp
+  800af7:	48 89 e5             	mov    %rsp,%rbp
+  800afa:	48 83 ec 20          	sub    $0x20,%rsp
+  800afe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800afe <printfloat+0x8>
+  800b05:	49 bb 42 85 00 00 00 	movabs $0x8542,%r11
+  800b0c:	00 00 00 
+  800b0f:	4c 01 d8             	add    %r11,%rax
+  800b12:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800b16:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800b1a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800b1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b22:	48 85 c0             	test   %rax,%rax
+  800b25:	79 12                	jns    800b39 <printfloat+0x43>
+		putch('-',putdat);
+  800b27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b2b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b2f:	48 89 c6             	mov    %rax,%rsi
+  800b32:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b37:	ff d2                	call   *%rdx
+	
+}
+  800b39:	90                   	nop
+  800b3a:	c9                   	leave
+  800b3b:	c3                   	ret
+
+0000000000800b3c <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800b3c:	55                   	push   %rbp
+  800b3d:	48 89 e5             	mov    %rsp,%rbp
+  800b40:	48 83 ec 20          	sub    $0x20,%rsp
+  800b44:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b44 <getint+0x8>
+  800b4b:	49 bb fc 84 00 00 00 	movabs $0x84fc,%r11
+  800b52:	00 00 00 
+  800b55:	4c 01 d8             	add    %r11,%rax
+  800b58:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b5c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800b5f:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800b63:	7e 4f                	jle    800bb4 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800b65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b69:	8b 00                	mov    (%rax),%eax
+  800b6b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6e:	77 24                	ja     800b94 <getint+0x58>
+  800b70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b74:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b7c:	8b 00                	mov    (%rax),%eax
+  800b7e:	89 c0                	mov    %eax,%eax
+  800b80:	48 01 d0             	add    %rdx,%rax
+  800b83:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b87:	8b 12                	mov    (%rdx),%edx
+  800b89:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b8c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b90:	89 0a                	mov    %ecx,(%rdx)
+  800b92:	eb 14                	jmp    800ba8 <getint+0x6c>
+  800b94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b98:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b9c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ba0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ba4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ba8:	48 8b 00             	mov    (%rax),%rax
+  800bab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800baf:	e9 9d 00 00 00       	jmp    800c51 <getint+0x115>
+	else if (lflag)
+  800bb4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800bb8:	74 4c                	je     800c06 <getint+0xca>
+		x=va_arg(*ap, long);
+  800bba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bbe:	8b 00                	mov    (%rax),%eax
+  800bc0:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc3:	77 24                	ja     800be9 <getint+0xad>
+  800bc5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bc9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800bcd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bd1:	8b 00                	mov    (%rax),%eax
+  800bd3:	89 c0                	mov    %eax,%eax
+  800bd5:	48 01 d0             	add    %rdx,%rax
+  800bd8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bdc:	8b 12                	mov    (%rdx),%edx
+  800bde:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800be1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800be5:	89 0a                	mov    %ecx,(%rdx)
+  800be7:	eb 14                	jmp    800bfd <getint+0xc1>
+  800be9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800bf1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800bf5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bf9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800bfd:	48 8b 00             	mov    (%rax),%rax
+  800c00:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800c04:	eb 4b                	jmp    800c51 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800c06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c0a:	8b 00                	mov    (%rax),%eax
+  800c0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0f:	77 24                	ja     800c35 <getint+0xf9>
+  800c11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c15:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c1d:	8b 00                	mov    (%rax),%eax
+  800c1f:	89 c0                	mov    %eax,%eax
+  800c21:	48 01 d0             	add    %rdx,%rax
+  800c24:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c28:	8b 12                	mov    (%rdx),%edx
+  800c2a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c2d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c31:	89 0a                	mov    %ecx,(%rdx)
+  800c33:	eb 14                	jmp    800c49 <getint+0x10d>
+  800c35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c39:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c3d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c41:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c45:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c49:	8b 00                	mov    (%rax),%eax
+  800c4b:	48 98                	cltq
+  800c4d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800c51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800c55:	c9                   	leave
+  800c56:	c3                   	ret
+
+0000000000800c57 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800c57:	55                   	push   %rbp
+  800c58:	48 89 e5             	mov    %rsp,%rbp
+  800c5b:	41 57                	push   %r15
+  800c5d:	41 55                	push   %r13
+  800c5f:	41 54                	push   %r12
+  800c61:	53                   	push   %rbx
+  800c62:	48 83 ec 60          	sub    $0x60,%rsp
+  800c66:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800c66 <vprintfmt+0xf>
+  800c6d:	49 bb da 83 00 00 00 	movabs $0x83da,%r11
+  800c74:	00 00 00 
+  800c77:	4d 01 dc             	add    %r11,%r12
+  800c7a:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800c7e:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800c82:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c86:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800c8a:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800c91:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800c95:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800c99:	48 8b 06             	mov    (%rsi),%rax
+  800c9c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800ca0:	48 89 01             	mov    %rax,(%rcx)
+  800ca3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ca7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800cab:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800caf:	eb 17                	jmp    800cc8 <vprintfmt+0x71>
+			if (ch == '\0')
+  800cb1:	85 db                	test   %ebx,%ebx
+  800cb3:	0f 84 97 05 00 00    	je     801250 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800cb9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cbd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800cc1:	48 89 c6             	mov    %rax,%rsi
+  800cc4:	89 df                	mov    %ebx,%edi
+  800cc6:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800cc8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ccc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800cd0:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800cd4:	0f b6 00             	movzbl (%rax),%eax
+  800cd7:	0f b6 d8             	movzbl %al,%ebx
+  800cda:	83 fb 25             	cmp    $0x25,%ebx
+  800cdd:	75 d2                	jne    800cb1 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800cdf:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800ce3:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800cea:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800cf1:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800cf8:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800cff:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d03:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d07:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d0b:	0f b6 00             	movzbl (%rax),%eax
+  800d0e:	0f b6 d8             	movzbl %al,%ebx
+  800d11:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800d14:	83 f8 55             	cmp    $0x55,%eax
+  800d17:	0f 87 00 05 00 00    	ja     80121d <vprintfmt+0x5c6>
+  800d1d:	89 c0                	mov    %eax,%eax
+  800d1f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800d26:	00 
+  800d27:	48 8d 05 0a 64 00 00 	lea    0x640a(%rip),%rax        # 807138 <.LC18+0xc>
+  800d2e:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800d32:	48 8d 15 ff 63 00 00 	lea    0x63ff(%rip),%rdx        # 807138 <.LC18+0xc>
+  800d39:	48 01 d0             	add    %rdx,%rax
+  800d3c:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800d3e:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800d42:	eb bb                	jmp    800cff <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800d44:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800d48:	eb b5                	jmp    800cff <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800d4a:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800d51:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800d54:	89 d0                	mov    %edx,%eax
+  800d56:	c1 e0 02             	shl    $0x2,%eax
+  800d59:	01 d0                	add    %edx,%eax
+  800d5b:	01 c0                	add    %eax,%eax
+  800d5d:	01 d8                	add    %ebx,%eax
+  800d5f:	83 e8 30             	sub    $0x30,%eax
+  800d62:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800d65:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d69:	0f b6 00             	movzbl (%rax),%eax
+  800d6c:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800d6f:	83 fb 2f             	cmp    $0x2f,%ebx
+  800d72:	7e 60                	jle    800dd4 <vprintfmt+0x17d>
+  800d74:	83 fb 39             	cmp    $0x39,%ebx
+  800d77:	7f 5b                	jg     800dd4 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800d79:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800d7e:	eb d1                	jmp    800d51 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800d80:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d83:	83 f8 2f             	cmp    $0x2f,%eax
+  800d86:	77 17                	ja     800d9f <vprintfmt+0x148>
+  800d88:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d8c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d8f:	89 d2                	mov    %edx,%edx
+  800d91:	48 01 d0             	add    %rdx,%rax
+  800d94:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d97:	83 c2 08             	add    $0x8,%edx
+  800d9a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d9d:	eb 0c                	jmp    800dab <vprintfmt+0x154>
+  800d9f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800da3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800da7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800dab:	8b 00                	mov    (%rax),%eax
+  800dad:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800db0:	eb 23                	jmp    800dd5 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800db2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800db6:	0f 89 43 ff ff ff    	jns    800cff <vprintfmt+0xa8>
+				width = 0;
+  800dbc:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800dc3:	e9 37 ff ff ff       	jmp    800cff <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800dc8:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800dcf:	e9 2b ff ff ff       	jmp    800cff <vprintfmt+0xa8>
+			goto process_precision;
+  800dd4:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800dd5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800dd9:	0f 89 20 ff ff ff    	jns    800cff <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800ddf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800de2:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800de5:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800dec:	e9 0e ff ff ff       	jmp    800cff <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800df1:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800df5:	e9 05 ff ff ff       	jmp    800cff <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800dfa:	83 fb 39             	cmp    $0x39,%ebx
+  800dfd:	7f 0b                	jg     800e0a <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800dff:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800e02:	c1 e0 08             	shl    $0x8,%eax
+  800e05:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800e08:	eb 21                	jmp    800e2b <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800e0a:	83 fb 60             	cmp    $0x60,%ebx
+  800e0d:	7e 10                	jle    800e1f <vprintfmt+0x1c8>
+  800e0f:	83 fb 66             	cmp    $0x66,%ebx
+  800e12:	7f 0b                	jg     800e1f <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800e14:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800e17:	c1 e0 08             	shl    $0x8,%eax
+  800e1a:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800e1d:	eb 0c                	jmp    800e2b <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800e1f:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800e26:	e9 04 01 00 00       	jmp    800f2f <vprintfmt+0x2d8>
+  800e2b:	e9 ff 00 00 00       	jmp    800f2f <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800e30:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e33:	83 f8 2f             	cmp    $0x2f,%eax
+  800e36:	77 17                	ja     800e4f <vprintfmt+0x1f8>
+  800e38:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e3c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e3f:	89 d2                	mov    %edx,%edx
+  800e41:	48 01 d0             	add    %rdx,%rax
+  800e44:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e47:	83 c2 08             	add    $0x8,%edx
+  800e4a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e4d:	eb 0c                	jmp    800e5b <vprintfmt+0x204>
+  800e4f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e53:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e57:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e5b:	8b 00                	mov    (%rax),%eax
+  800e5d:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800e61:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800e65:	48 89 d6             	mov    %rdx,%rsi
+  800e68:	89 c7                	mov    %eax,%edi
+  800e6a:	ff d1                	call   *%rcx
+			break;
+  800e6c:	e9 da 03 00 00       	jmp    80124b <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800e71:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e74:	83 f8 2f             	cmp    $0x2f,%eax
+  800e77:	77 17                	ja     800e90 <vprintfmt+0x239>
+  800e79:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e7d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e80:	89 d2                	mov    %edx,%edx
+  800e82:	48 01 d0             	add    %rdx,%rax
+  800e85:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e88:	83 c2 08             	add    $0x8,%edx
+  800e8b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e8e:	eb 0c                	jmp    800e9c <vprintfmt+0x245>
+  800e90:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e94:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e98:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e9c:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800e9e:	85 db                	test   %ebx,%ebx
+  800ea0:	79 02                	jns    800ea4 <vprintfmt+0x24d>
+				err = -err;
+  800ea2:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800ea4:	83 fb 15             	cmp    $0x15,%ebx
+  800ea7:	7f 19                	jg     800ec2 <vprintfmt+0x26b>
+  800ea9:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800eb0:	00 00 00 
+  800eb3:	48 63 c3             	movslq %ebx,%rax
+  800eb6:	4c 01 e2             	add    %r12,%rdx
+  800eb9:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800ebd:	4d 85 ed             	test   %r13,%r13
+  800ec0:	75 36                	jne    800ef8 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800ec2:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800ec6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800eca:	89 d9                	mov    %ebx,%ecx
+  800ecc:	48 ba e0 e0 ff ff ff 	movabs $0xffffffffffffe0e0,%rdx
+  800ed3:	ff ff ff 
+  800ed6:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800eda:	48 89 c7             	mov    %rax,%rdi
+  800edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee2:	49 b8 1e 82 ff ff ff 	movabs $0xffffffffffff821e,%r8
+  800ee9:	ff ff ff 
+  800eec:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800ef0:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800ef3:	e9 53 03 00 00       	jmp    80124b <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800ef8:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800efc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f00:	4c 89 e9             	mov    %r13,%rcx
+  800f03:	48 ba e9 e0 ff ff ff 	movabs $0xffffffffffffe0e9,%rdx
+  800f0a:	ff ff ff 
+  800f0d:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800f11:	48 89 c7             	mov    %rax,%rdi
+  800f14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f19:	49 b8 1e 82 ff ff ff 	movabs $0xffffffffffff821e,%r8
+  800f20:	ff ff ff 
+  800f23:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800f27:	41 ff d0             	call   *%r8
+			break;
+  800f2a:	e9 1c 03 00 00       	jmp    80124b <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800f2f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f32:	83 f8 2f             	cmp    $0x2f,%eax
+  800f35:	77 17                	ja     800f4e <vprintfmt+0x2f7>
+  800f37:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f3b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f3e:	89 d2                	mov    %edx,%edx
+  800f40:	48 01 d0             	add    %rdx,%rax
+  800f43:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f46:	83 c2 08             	add    $0x8,%edx
+  800f49:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f4c:	eb 0c                	jmp    800f5a <vprintfmt+0x303>
+  800f4e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f52:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f56:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f5a:	4c 8b 28             	mov    (%rax),%r13
+  800f5d:	4d 85 ed             	test   %r13,%r13
+  800f60:	75 0e                	jne    800f70 <vprintfmt+0x319>
+				p = "(null)";
+  800f62:	48 b8 ec e0 ff ff ff 	movabs $0xffffffffffffe0ec,%rax
+  800f69:	ff ff ff 
+  800f6c:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800f70:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f74:	0f 8e 84 00 00 00    	jle    800ffe <vprintfmt+0x3a7>
+  800f7a:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800f7e:	74 7e                	je     800ffe <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f80:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f83:	48 98                	cltq
+  800f85:	48 89 c6             	mov    %rax,%rsi
+  800f88:	4c 89 ef             	mov    %r13,%rdi
+  800f8b:	4d 89 e7             	mov    %r12,%r15
+  800f8e:	48 b8 43 85 ff ff ff 	movabs $0xffffffffffff8543,%rax
+  800f95:	ff ff ff 
+  800f98:	4c 01 e0             	add    %r12,%rax
+  800f9b:	ff d0                	call   *%rax
+  800f9d:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800fa0:	eb 17                	jmp    800fb9 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800fa2:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800fa6:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800faa:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800fae:	48 89 d6             	mov    %rdx,%rsi
+  800fb1:	89 c7                	mov    %eax,%edi
+  800fb3:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800fb5:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800fb9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800fbd:	7f e3                	jg     800fa2 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800fbf:	eb 3d                	jmp    800ffe <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800fc1:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800fc5:	74 1e                	je     800fe5 <vprintfmt+0x38e>
+  800fc7:	83 fb 1f             	cmp    $0x1f,%ebx
+  800fca:	7e 05                	jle    800fd1 <vprintfmt+0x37a>
+  800fcc:	83 fb 7e             	cmp    $0x7e,%ebx
+  800fcf:	7e 14                	jle    800fe5 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800fd1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fd5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fd9:	48 89 c6             	mov    %rax,%rsi
+  800fdc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800fe1:	ff d2                	call   *%rdx
+  800fe3:	eb 15                	jmp    800ffa <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800fe5:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800fe8:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800feb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fef:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ff3:	48 89 c6             	mov    %rax,%rsi
+  800ff6:	89 cf                	mov    %ecx,%edi
+  800ff8:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ffa:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ffe:	4c 89 e8             	mov    %r13,%rax
+  801001:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  801005:	0f b6 00             	movzbl (%rax),%eax
+  801008:	0f be d8             	movsbl %al,%ebx
+  80100b:	85 db                	test   %ebx,%ebx
+  80100d:	74 28                	je     801037 <vprintfmt+0x3e0>
+  80100f:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801013:	78 ac                	js     800fc1 <vprintfmt+0x36a>
+  801015:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  801019:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80101d:	79 a2                	jns    800fc1 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  80101f:	eb 16                	jmp    801037 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  801021:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801025:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801029:	48 89 c6             	mov    %rax,%rsi
+  80102c:	bf 20 00 00 00       	mov    $0x20,%edi
+  801031:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  801033:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801037:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80103b:	7f e4                	jg     801021 <vprintfmt+0x3ca>
+			break;
+  80103d:	e9 09 02 00 00       	jmp    80124b <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  801042:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801046:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80104a:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80104e:	0f b6 00             	movzbl (%rax),%eax
+  801051:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  801054:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  801055:	83 fb 2f             	cmp    $0x2f,%ebx
+  801058:	0f 8e ac fd ff ff    	jle    800e0a <vprintfmt+0x1b3>
+  80105e:	e9 97 fd ff ff       	jmp    800dfa <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  801063:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801067:	be 03 00 00 00       	mov    $0x3,%esi
+  80106c:	48 89 c7             	mov    %rax,%rdi
+  80106f:	48 b8 fc 7a ff ff ff 	movabs $0xffffffffffff7afc,%rax
+  801076:	ff ff ff 
+  801079:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80107d:	ff d0                	call   *%rax
+  80107f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  801083:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801087:	48 85 c0             	test   %rax,%rax
+  80108a:	79 1d                	jns    8010a9 <vprintfmt+0x452>
+				putch('-', putdat);
+  80108c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801090:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801094:	48 89 c6             	mov    %rax,%rsi
+  801097:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80109c:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  80109e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010a2:	48 f7 d8             	neg    %rax
+  8010a5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  8010a9:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8010b0:	e9 de 00 00 00       	jmp    801193 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  8010b5:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010b9:	be 03 00 00 00       	mov    $0x3,%esi
+  8010be:	48 89 c7             	mov    %rax,%rdi
+  8010c1:	48 b8 9b 79 ff ff ff 	movabs $0xffffffffffff799b,%rax
+  8010c8:	ff ff ff 
+  8010cb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010cf:	ff d0                	call   *%rax
+  8010d1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  8010d5:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8010dc:	e9 b2 00 00 00       	jmp    801193 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  8010e1:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010e5:	be 03 00 00 00       	mov    $0x3,%esi
+  8010ea:	48 89 c7             	mov    %rax,%rdi
+  8010ed:	48 b8 9b 79 ff ff ff 	movabs $0xffffffffffff799b,%rax
+  8010f4:	ff ff ff 
+  8010f7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010fb:	ff d0                	call   *%rax
+  8010fd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801101:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801108:	e9 86 00 00 00       	jmp    801193 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80110d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801111:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801115:	48 89 c6             	mov    %rax,%rsi
+  801118:	bf 30 00 00 00       	mov    $0x30,%edi
+  80111d:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  80111f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801123:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801127:	48 89 c6             	mov    %rax,%rsi
+  80112a:	bf 78 00 00 00       	mov    $0x78,%edi
+  80112f:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  801131:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801134:	83 f8 2f             	cmp    $0x2f,%eax
+  801137:	77 17                	ja     801150 <vprintfmt+0x4f9>
+  801139:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80113d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801140:	89 d2                	mov    %edx,%edx
+  801142:	48 01 d0             	add    %rdx,%rax
+  801145:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801148:	83 c2 08             	add    $0x8,%edx
+  80114b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80114e:	eb 0c                	jmp    80115c <vprintfmt+0x505>
+  801150:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801154:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801158:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80115c:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  80115f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801163:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  80116a:	eb 27                	jmp    801193 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  80116c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801170:	be 03 00 00 00       	mov    $0x3,%esi
+  801175:	48 89 c7             	mov    %rax,%rdi
+  801178:	48 b8 9b 79 ff ff ff 	movabs $0xffffffffffff799b,%rax
+  80117f:	ff ff ff 
+  801182:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801186:	ff d0                	call   *%rax
+  801188:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  80118c:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801193:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  801198:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80119b:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80119e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8011a2:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8011a6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8011aa:	45 89 c1             	mov    %r8d,%r9d
+  8011ad:	41 89 f8             	mov    %edi,%r8d
+  8011b0:	48 89 c7             	mov    %rax,%rdi
+  8011b3:	48 b8 c3 78 ff ff ff 	movabs $0xffffffffffff78c3,%rax
+  8011ba:	ff ff ff 
+  8011bd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011c1:	ff d0                	call   *%rax
+			break;
+  8011c3:	e9 83 00 00 00       	jmp    80124b <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  8011c8:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8011cc:	be 03 00 00 00       	mov    $0x3,%esi
+  8011d1:	48 89 c7             	mov    %rax,%rdi
+  8011d4:	48 b8 9b 79 ff ff ff 	movabs $0xffffffffffff799b,%rax
+  8011db:	ff ff ff 
+  8011de:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011e2:	ff d0                	call   *%rax
+  8011e4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  8011e8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8011ec:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8011f0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8011f4:	48 89 ce             	mov    %rcx,%rsi
+  8011f7:	48 89 c7             	mov    %rax,%rdi
+  8011fa:	48 b8 b6 7a ff ff ff 	movabs $0xffffffffffff7ab6,%rax
+  801201:	ff ff ff 
+  801204:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801208:	ff d0                	call   *%rax
+	
+			break;
+  80120a:	eb 3f                	jmp    80124b <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  80120c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801210:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801214:	48 89 c6             	mov    %rax,%rsi
+  801217:	89 df                	mov    %ebx,%edi
+  801219:	ff d2                	call   *%rdx
+			break;
+  80121b:	eb 2e                	jmp    80124b <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80121d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801221:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801225:	48 89 c6             	mov    %rax,%rsi
+  801228:	bf 25 00 00 00       	mov    $0x25,%edi
+  80122d:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80122f:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801234:	eb 05                	jmp    80123b <vprintfmt+0x5e4>
+  801236:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80123b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80123f:	48 83 e8 01          	sub    $0x1,%rax
+  801243:	0f b6 00             	movzbl (%rax),%eax
+  801246:	3c 25                	cmp    $0x25,%al
+  801248:	75 ec                	jne    801236 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  80124a:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80124b:	e9 78 fa ff ff       	jmp    800cc8 <vprintfmt+0x71>
+				return;
+  801250:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801251:	48 83 c4 60          	add    $0x60,%rsp
+  801255:	5b                   	pop    %rbx
+  801256:	41 5c                	pop    %r12
+  801258:	41 5d                	pop    %r13
+  80125a:	41 5f                	pop    %r15
+  80125c:	5d                   	pop    %rbp
+  80125d:	c3                   	ret
+
+000000000080125e <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  80125e:	55                   	push   %rbp
+  80125f:	48 89 e5             	mov    %rsp,%rbp
+  801262:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801269:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801269 <printfmt+0xb>
+  801270:	49 bb d7 7d 00 00 00 	movabs $0x7dd7,%r11
+  801277:	00 00 00 
+  80127a:	4d 01 da             	add    %r11,%r10
+  80127d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801284:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80128b:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801292:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801299:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8012a0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8012a7:	84 c0                	test   %al,%al
+  8012a9:	74 20                	je     8012cb <printfmt+0x6d>
+  8012ab:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8012af:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8012b3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8012b7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8012bb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8012bf:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8012c3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8012c7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8012cb:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8012d2:	00 00 00 
+  8012d5:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8012dc:	00 00 00 
+  8012df:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8012e3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8012ea:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8012f1:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8012f8:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8012ff:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801306:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80130d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801314:	48 89 c7             	mov    %rax,%rdi
+  801317:	48 b8 17 7c ff ff ff 	movabs $0xffffffffffff7c17,%rax
+  80131e:	ff ff ff 
+  801321:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801325:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801327:	90                   	nop
+  801328:	c9                   	leave
+  801329:	c3                   	ret
+
+000000000080132a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80132a:	55                   	push   %rbp
+  80132b:	48 89 e5             	mov    %rsp,%rbp
+  80132e:	48 83 ec 10          	sub    $0x10,%rsp
+  801332:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801332 <sprintputch+0x8>
+  801339:	49 bb 0e 7d 00 00 00 	movabs $0x7d0e,%r11
+  801340:	00 00 00 
+  801343:	4c 01 d8             	add    %r11,%rax
+  801346:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801349:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  80134d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801351:	8b 40 10             	mov    0x10(%rax),%eax
+  801354:	8d 50 01             	lea    0x1(%rax),%edx
+  801357:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80135b:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  80135e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801362:	48 8b 10             	mov    (%rax),%rdx
+  801365:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801369:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80136d:	48 39 c2             	cmp    %rax,%rdx
+  801370:	73 17                	jae    801389 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801372:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801376:	48 8b 00             	mov    (%rax),%rax
+  801379:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80137d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801381:	48 89 0a             	mov    %rcx,(%rdx)
+  801384:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801387:	88 10                	mov    %dl,(%rax)
+}
+  801389:	90                   	nop
+  80138a:	c9                   	leave
+  80138b:	c3                   	ret
+
+000000000080138c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80138c:	55                   	push   %rbp
+  80138d:	48 89 e5             	mov    %rsp,%rbp
+  801390:	53                   	push   %rbx
+  801391:	48 83 ec 58          	sub    $0x58,%rsp
+  801395:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801395 <vsnprintf+0x9>
+  80139c:	49 bb ab 7c 00 00 00 	movabs $0x7cab,%r11
+  8013a3:	00 00 00 
+  8013a6:	4c 01 d8             	add    %r11,%rax
+  8013a9:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8013ad:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8013b0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8013b4:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8013b8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8013bc:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8013c0:	48 8b 0e             	mov    (%rsi),%rcx
+  8013c3:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8013c7:	48 89 0a             	mov    %rcx,(%rdx)
+  8013ca:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8013ce:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8013d2:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8013d6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8013da:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8013de:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8013e1:	48 63 d2             	movslq %edx,%rdx
+  8013e4:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8013e8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8013ec:	48 01 ca             	add    %rcx,%rdx
+  8013ef:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8013f3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8013fa:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8013ff:	74 06                	je     801407 <vsnprintf+0x7b>
+  801401:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801405:	7f 07                	jg     80140e <vsnprintf+0x82>
+		return -E_INVAL;
+  801407:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80140c:	eb 34                	jmp    801442 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  80140e:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801412:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801416:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80141a:	48 bf ea 82 ff ff ff 	movabs $0xffffffffffff82ea,%rdi
+  801421:	ff ff ff 
+  801424:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801428:	49 b8 17 7c ff ff ff 	movabs $0xffffffffffff7c17,%r8
+  80142f:	ff ff ff 
+  801432:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801436:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801438:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80143c:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80143f:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801442:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801446:	c9                   	leave
+  801447:	c3                   	ret
+
+0000000000801448 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801448:	55                   	push   %rbp
+  801449:	48 89 e5             	mov    %rsp,%rbp
+  80144c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801453:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801453 <snprintf+0xb>
+  80145a:	49 bb ed 7b 00 00 00 	movabs $0x7bed,%r11
+  801461:	00 00 00 
+  801464:	4d 01 da             	add    %r11,%r10
+  801467:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80146e:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801474:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80147b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801482:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801489:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801490:	84 c0                	test   %al,%al
+  801492:	74 20                	je     8014b4 <snprintf+0x6c>
+  801494:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801498:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80149c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8014a0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8014a4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8014a8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8014ac:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8014b0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8014b4:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8014bb:	00 00 00 
+  8014be:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8014c5:	00 00 00 
+  8014c8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014cc:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8014d3:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8014da:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8014e1:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8014e8:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8014ef:	48 8b 06             	mov    (%rsi),%rax
+  8014f2:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8014f6:	48 89 01             	mov    %rax,(%rcx)
+  8014f9:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8014fd:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801501:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801505:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80150c:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801513:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801519:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801520:	48 89 c7             	mov    %rax,%rdi
+  801523:	48 b8 4c 83 ff ff ff 	movabs $0xffffffffffff834c,%rax
+  80152a:	ff ff ff 
+  80152d:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801531:	ff d0                	call   *%rax
+  801533:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801539:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80153f:	c9                   	leave
+  801540:	c3                   	ret
+
+0000000000801541 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801541:	55                   	push   %rbp
+  801542:	48 89 e5             	mov    %rsp,%rbp
+  801545:	48 83 ec 18          	sub    $0x18,%rsp
+  801549:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801549 <strlen+0x8>
+  801550:	49 bb f7 7a 00 00 00 	movabs $0x7af7,%r11
+  801557:	00 00 00 
+  80155a:	4c 01 d8             	add    %r11,%rax
+  80155d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801561:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801568:	eb 09                	jmp    801573 <strlen+0x32>
+		n++;
+  80156a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  80156e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801573:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801577:	0f b6 00             	movzbl (%rax),%eax
+  80157a:	84 c0                	test   %al,%al
+  80157c:	75 ec                	jne    80156a <strlen+0x29>
+	return n;
+  80157e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801581:	c9                   	leave
+  801582:	c3                   	ret
+
+0000000000801583 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801583:	55                   	push   %rbp
+  801584:	48 89 e5             	mov    %rsp,%rbp
+  801587:	48 83 ec 20          	sub    $0x20,%rsp
+  80158b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80158b <strnlen+0x8>
+  801592:	49 bb b5 7a 00 00 00 	movabs $0x7ab5,%r11
+  801599:	00 00 00 
+  80159c:	4c 01 d8             	add    %r11,%rax
+  80159f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8015a7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8015ae:	eb 0e                	jmp    8015be <strnlen+0x3b>
+		n++;
+  8015b0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8015b4:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8015b9:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8015be:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8015c3:	74 0b                	je     8015d0 <strnlen+0x4d>
+  8015c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015c9:	0f b6 00             	movzbl (%rax),%eax
+  8015cc:	84 c0                	test   %al,%al
+  8015ce:	75 e0                	jne    8015b0 <strnlen+0x2d>
+	return n;
+  8015d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8015d3:	c9                   	leave
+  8015d4:	c3                   	ret
+
+00000000008015d5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8015d5:	55                   	push   %rbp
+  8015d6:	48 89 e5             	mov    %rsp,%rbp
+  8015d9:	48 83 ec 20          	sub    $0x20,%rsp
+  8015dd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015dd <strcpy+0x8>
+  8015e4:	49 bb 63 7a 00 00 00 	movabs $0x7a63,%r11
+  8015eb:	00 00 00 
+  8015ee:	4c 01 d8             	add    %r11,%rax
+  8015f1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015f5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8015f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015fd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801601:	90                   	nop
+  801602:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801606:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80160a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80160e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801612:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801616:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80161a:	0f b6 12             	movzbl (%rdx),%edx
+  80161d:	88 10                	mov    %dl,(%rax)
+  80161f:	0f b6 00             	movzbl (%rax),%eax
+  801622:	84 c0                	test   %al,%al
+  801624:	75 dc                	jne    801602 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801626:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80162a:	c9                   	leave
+  80162b:	c3                   	ret
+
+000000000080162c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80162c:	55                   	push   %rbp
+  80162d:	48 89 e5             	mov    %rsp,%rbp
+  801630:	53                   	push   %rbx
+  801631:	48 83 ec 20          	sub    $0x20,%rsp
+  801635:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801635 <strcat+0x9>
+  80163c:	49 bb 0b 7a 00 00 00 	movabs $0x7a0b,%r11
+  801643:	00 00 00 
+  801646:	4c 01 db             	add    %r11,%rbx
+  801649:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  80164d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801651:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801655:	48 89 c7             	mov    %rax,%rdi
+  801658:	48 b8 01 85 ff ff ff 	movabs $0xffffffffffff8501,%rax
+  80165f:	ff ff ff 
+  801662:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801666:	ff d0                	call   *%rax
+  801668:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  80166b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80166e:	48 63 d0             	movslq %eax,%rdx
+  801671:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801675:	48 01 c2             	add    %rax,%rdx
+  801678:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80167c:	48 89 c6             	mov    %rax,%rsi
+  80167f:	48 89 d7             	mov    %rdx,%rdi
+  801682:	48 b8 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rax
+  801689:	ff ff ff 
+  80168c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801690:	ff d0                	call   *%rax
+	return dst;
+  801692:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801696:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169a:	c9                   	leave
+  80169b:	c3                   	ret
+
+000000000080169c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80169c:	55                   	push   %rbp
+  80169d:	48 89 e5             	mov    %rsp,%rbp
+  8016a0:	48 83 ec 28          	sub    $0x28,%rsp
+  8016a4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016a4 <strncpy+0x8>
+  8016ab:	49 bb 9c 79 00 00 00 	movabs $0x799c,%r11
+  8016b2:	00 00 00 
+  8016b5:	4c 01 d8             	add    %r11,%rax
+  8016b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016bc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016c0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8016c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016c8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8016cc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8016d3:	00 
+  8016d4:	eb 2a                	jmp    801700 <strncpy+0x64>
+		*dst++ = *src;
+  8016d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016da:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016de:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8016e2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016e6:	0f b6 12             	movzbl (%rdx),%edx
+  8016e9:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8016eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016ef:	0f b6 00             	movzbl (%rax),%eax
+  8016f2:	84 c0                	test   %al,%al
+  8016f4:	74 05                	je     8016fb <strncpy+0x5f>
+			src++;
+  8016f6:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8016fb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801700:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801704:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801708:	72 cc                	jb     8016d6 <strncpy+0x3a>
+	}
+	return ret;
+  80170a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80170e:	c9                   	leave
+  80170f:	c3                   	ret
+
+0000000000801710 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801710:	55                   	push   %rbp
+  801711:	48 89 e5             	mov    %rsp,%rbp
+  801714:	48 83 ec 28          	sub    $0x28,%rsp
+  801718:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801718 <strlcpy+0x8>
+  80171f:	49 bb 28 79 00 00 00 	movabs $0x7928,%r11
+  801726:	00 00 00 
+  801729:	4c 01 d8             	add    %r11,%rax
+  80172c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801730:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801734:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801738:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80173c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801740:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801745:	74 3d                	je     801784 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801747:	eb 1d                	jmp    801766 <strlcpy+0x56>
+			*dst++ = *src++;
+  801749:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80174d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801751:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801755:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801759:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80175d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801761:	0f b6 12             	movzbl (%rdx),%edx
+  801764:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801766:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80176b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801770:	74 0b                	je     80177d <strlcpy+0x6d>
+  801772:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801776:	0f b6 00             	movzbl (%rax),%eax
+  801779:	84 c0                	test   %al,%al
+  80177b:	75 cc                	jne    801749 <strlcpy+0x39>
+		*dst = '\0';
+  80177d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801781:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801784:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801788:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80178c:	c9                   	leave
+  80178d:	c3                   	ret
+
+000000000080178e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80178e:	55                   	push   %rbp
+  80178f:	48 89 e5             	mov    %rsp,%rbp
+  801792:	48 83 ec 10          	sub    $0x10,%rsp
+  801796:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801796 <strcmp+0x8>
+  80179d:	49 bb aa 78 00 00 00 	movabs $0x78aa,%r11
+  8017a4:	00 00 00 
+  8017a7:	4c 01 d8             	add    %r11,%rax
+  8017aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017ae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8017b2:	eb 0a                	jmp    8017be <strcmp+0x30>
+		p++, q++;
+  8017b4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017b9:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8017be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c2:	0f b6 00             	movzbl (%rax),%eax
+  8017c5:	84 c0                	test   %al,%al
+  8017c7:	74 12                	je     8017db <strcmp+0x4d>
+  8017c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017cd:	0f b6 10             	movzbl (%rax),%edx
+  8017d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017d4:	0f b6 00             	movzbl (%rax),%eax
+  8017d7:	38 c2                	cmp    %al,%dl
+  8017d9:	74 d9                	je     8017b4 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8017db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017df:	0f b6 00             	movzbl (%rax),%eax
+  8017e2:	0f b6 d0             	movzbl %al,%edx
+  8017e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017e9:	0f b6 00             	movzbl (%rax),%eax
+  8017ec:	0f b6 c0             	movzbl %al,%eax
+  8017ef:	29 c2                	sub    %eax,%edx
+  8017f1:	89 d0                	mov    %edx,%eax
+}
+  8017f3:	c9                   	leave
+  8017f4:	c3                   	ret
+
+00000000008017f5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8017f5:	55                   	push   %rbp
+  8017f6:	48 89 e5             	mov    %rsp,%rbp
+  8017f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8017fd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017fd <strncmp+0x8>
+  801804:	49 bb 43 78 00 00 00 	movabs $0x7843,%r11
+  80180b:	00 00 00 
+  80180e:	4c 01 d8             	add    %r11,%rax
+  801811:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801815:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801819:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80181d:	eb 0f                	jmp    80182e <strncmp+0x39>
+		n--, p++, q++;
+  80181f:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801824:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801829:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80182e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801833:	74 1d                	je     801852 <strncmp+0x5d>
+  801835:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801839:	0f b6 00             	movzbl (%rax),%eax
+  80183c:	84 c0                	test   %al,%al
+  80183e:	74 12                	je     801852 <strncmp+0x5d>
+  801840:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801844:	0f b6 10             	movzbl (%rax),%edx
+  801847:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80184b:	0f b6 00             	movzbl (%rax),%eax
+  80184e:	38 c2                	cmp    %al,%dl
+  801850:	74 cd                	je     80181f <strncmp+0x2a>
+	if (n == 0)
+  801852:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801857:	75 07                	jne    801860 <strncmp+0x6b>
+		return 0;
+  801859:	ba 00 00 00 00       	mov    $0x0,%edx
+  80185e:	eb 16                	jmp    801876 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801860:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801864:	0f b6 00             	movzbl (%rax),%eax
+  801867:	0f b6 d0             	movzbl %al,%edx
+  80186a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80186e:	0f b6 00             	movzbl (%rax),%eax
+  801871:	0f b6 c0             	movzbl %al,%eax
+  801874:	29 c2                	sub    %eax,%edx
+}
+  801876:	89 d0                	mov    %edx,%eax
+  801878:	c9                   	leave
+  801879:	c3                   	ret
+
+000000000080187a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80187a:	55                   	push   %rbp
+  80187b:	48 89 e5             	mov    %rsp,%rbp
+  80187e:	48 83 ec 10          	sub    $0x10,%rsp
+  801882:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801882 <strchr+0x8>
+  801889:	49 bb be 77 00 00 00 	movabs $0x77be,%r11
+  801890:	00 00 00 
+  801893:	4c 01 d8             	add    %r11,%rax
+  801896:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80189a:	89 f0                	mov    %esi,%eax
+  80189c:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80189f:	eb 17                	jmp    8018b8 <strchr+0x3e>
+		if (*s == c)
+  8018a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018a5:	0f b6 00             	movzbl (%rax),%eax
+  8018a8:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8018ab:	75 06                	jne    8018b3 <strchr+0x39>
+			return (char *) s;
+  8018ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018b1:	eb 15                	jmp    8018c8 <strchr+0x4e>
+	for (; *s; s++)
+  8018b3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018bc:	0f b6 00             	movzbl (%rax),%eax
+  8018bf:	84 c0                	test   %al,%al
+  8018c1:	75 de                	jne    8018a1 <strchr+0x27>
+	return 0;
+  8018c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018c8:	c9                   	leave
+  8018c9:	c3                   	ret
+
+00000000008018ca <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8018ca:	55                   	push   %rbp
+  8018cb:	48 89 e5             	mov    %rsp,%rbp
+  8018ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8018d2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018d2 <strfind+0x8>
+  8018d9:	49 bb 6e 77 00 00 00 	movabs $0x776e,%r11
+  8018e0:	00 00 00 
+  8018e3:	4c 01 d8             	add    %r11,%rax
+  8018e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018ea:	89 f0                	mov    %esi,%eax
+  8018ec:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8018ef:	eb 11                	jmp    801902 <strfind+0x38>
+		if (*s == c)
+  8018f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018f5:	0f b6 00             	movzbl (%rax),%eax
+  8018f8:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8018fb:	74 12                	je     80190f <strfind+0x45>
+	for (; *s; s++)
+  8018fd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801902:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801906:	0f b6 00             	movzbl (%rax),%eax
+  801909:	84 c0                	test   %al,%al
+  80190b:	75 e4                	jne    8018f1 <strfind+0x27>
+  80190d:	eb 01                	jmp    801910 <strfind+0x46>
+			break;
+  80190f:	90                   	nop
+	return (char *) s;
+  801910:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801914:	c9                   	leave
+  801915:	c3                   	ret
+
+0000000000801916 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801916:	55                   	push   %rbp
+  801917:	48 89 e5             	mov    %rsp,%rbp
+  80191a:	48 83 ec 18          	sub    $0x18,%rsp
+  80191e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80191e <memset+0x8>
+  801925:	49 bb 22 77 00 00 00 	movabs $0x7722,%r11
+  80192c:	00 00 00 
+  80192f:	4c 01 d8             	add    %r11,%rax
+  801932:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801936:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801939:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80193d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801942:	75 06                	jne    80194a <memset+0x34>
+		return v;
+  801944:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801948:	eb 69                	jmp    8019b3 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  80194a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80194e:	83 e0 03             	and    $0x3,%eax
+  801951:	48 85 c0             	test   %rax,%rax
+  801954:	75 48                	jne    80199e <memset+0x88>
+  801956:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80195a:	83 e0 03             	and    $0x3,%eax
+  80195d:	48 85 c0             	test   %rax,%rax
+  801960:	75 3c                	jne    80199e <memset+0x88>
+		c &= 0xFF;
+  801962:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801969:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80196c:	c1 e0 18             	shl    $0x18,%eax
+  80196f:	89 c2                	mov    %eax,%edx
+  801971:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801974:	c1 e0 10             	shl    $0x10,%eax
+  801977:	09 c2                	or     %eax,%edx
+  801979:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80197c:	c1 e0 08             	shl    $0x8,%eax
+  80197f:	09 d0                	or     %edx,%eax
+  801981:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801984:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801988:	48 c1 e8 02          	shr    $0x2,%rax
+  80198c:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  80198f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801993:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801996:	48 89 d7             	mov    %rdx,%rdi
+  801999:	fc                   	cld
+  80199a:	f3 ab                	rep stos %eax,%es:(%rdi)
+  80199c:	eb 11                	jmp    8019af <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80199e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019a2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019a5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8019a9:	48 89 d7             	mov    %rdx,%rdi
+  8019ac:	fc                   	cld
+  8019ad:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8019af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8019b3:	c9                   	leave
+  8019b4:	c3                   	ret
+
+00000000008019b5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8019b5:	55                   	push   %rbp
+  8019b6:	48 89 e5             	mov    %rsp,%rbp
+  8019b9:	48 83 ec 28          	sub    $0x28,%rsp
+  8019bd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019bd <memmove+0x8>
+  8019c4:	49 bb 83 76 00 00 00 	movabs $0x7683,%r11
+  8019cb:	00 00 00 
+  8019ce:	4c 01 d8             	add    %r11,%rax
+  8019d1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019d5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8019d9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8019dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019e1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8019e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019e9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8019ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019f1:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8019f5:	0f 83 88 00 00 00    	jae    801a83 <memmove+0xce>
+  8019fb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a03:	48 01 d0             	add    %rdx,%rax
+  801a06:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801a0a:	73 77                	jae    801a83 <memmove+0xce>
+		s += n;
+  801a0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a10:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801a14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a18:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801a1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a20:	83 e0 03             	and    $0x3,%eax
+  801a23:	48 85 c0             	test   %rax,%rax
+  801a26:	75 3b                	jne    801a63 <memmove+0xae>
+  801a28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a2c:	83 e0 03             	and    $0x3,%eax
+  801a2f:	48 85 c0             	test   %rax,%rax
+  801a32:	75 2f                	jne    801a63 <memmove+0xae>
+  801a34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a38:	83 e0 03             	and    $0x3,%eax
+  801a3b:	48 85 c0             	test   %rax,%rax
+  801a3e:	75 23                	jne    801a63 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801a40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a44:	48 83 e8 04          	sub    $0x4,%rax
+  801a48:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a4c:	48 83 ea 04          	sub    $0x4,%rdx
+  801a50:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a54:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801a58:	48 89 c7             	mov    %rax,%rdi
+  801a5b:	48 89 d6             	mov    %rdx,%rsi
+  801a5e:	fd                   	std
+  801a5f:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801a61:	eb 1d                	jmp    801a80 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801a63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a67:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a6f:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801a73:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a77:	48 89 d7             	mov    %rdx,%rdi
+  801a7a:	48 89 c1             	mov    %rax,%rcx
+  801a7d:	fd                   	std
+  801a7e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801a80:	fc                   	cld
+  801a81:	eb 57                	jmp    801ada <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801a83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a87:	83 e0 03             	and    $0x3,%eax
+  801a8a:	48 85 c0             	test   %rax,%rax
+  801a8d:	75 36                	jne    801ac5 <memmove+0x110>
+  801a8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a93:	83 e0 03             	and    $0x3,%eax
+  801a96:	48 85 c0             	test   %rax,%rax
+  801a99:	75 2a                	jne    801ac5 <memmove+0x110>
+  801a9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a9f:	83 e0 03             	and    $0x3,%eax
+  801aa2:	48 85 c0             	test   %rax,%rax
+  801aa5:	75 1e                	jne    801ac5 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801aa7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aab:	48 c1 e8 02          	shr    $0x2,%rax
+  801aaf:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801ab2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ab6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aba:	48 89 c7             	mov    %rax,%rdi
+  801abd:	48 89 d6             	mov    %rdx,%rsi
+  801ac0:	fc                   	cld
+  801ac1:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801ac3:	eb 15                	jmp    801ada <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801ac5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ac9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801acd:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801ad1:	48 89 c7             	mov    %rax,%rdi
+  801ad4:	48 89 d6             	mov    %rdx,%rsi
+  801ad7:	fc                   	cld
+  801ad8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801ada:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801ade:	c9                   	leave
+  801adf:	c3                   	ret
+
+0000000000801ae0 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801ae0:	55                   	push   %rbp
+  801ae1:	48 89 e5             	mov    %rsp,%rbp
+  801ae4:	48 83 ec 18          	sub    $0x18,%rsp
+  801ae8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ae8 <memcpy+0x8>
+  801aef:	49 bb 58 75 00 00 00 	movabs $0x7558,%r11
+  801af6:	00 00 00 
+  801af9:	4c 01 d8             	add    %r11,%rax
+  801afc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b00:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801b04:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801b08:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b0c:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801b10:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b14:	48 89 cf             	mov    %rcx,%rdi
+  801b17:	48 b9 75 89 ff ff ff 	movabs $0xffffffffffff8975,%rcx
+  801b1e:	ff ff ff 
+  801b21:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801b25:	ff d0                	call   *%rax
+}
+  801b27:	c9                   	leave
+  801b28:	c3                   	ret
+
+0000000000801b29 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801b29:	55                   	push   %rbp
+  801b2a:	48 89 e5             	mov    %rsp,%rbp
+  801b2d:	48 83 ec 28          	sub    $0x28,%rsp
+  801b31:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b31 <memcmp+0x8>
+  801b38:	49 bb 0f 75 00 00 00 	movabs $0x750f,%r11
+  801b3f:	00 00 00 
+  801b42:	4c 01 d8             	add    %r11,%rax
+  801b45:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b49:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801b4d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801b51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b55:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801b59:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b5d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801b61:	eb 34                	jmp    801b97 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801b63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b67:	0f b6 10             	movzbl (%rax),%edx
+  801b6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b6e:	0f b6 00             	movzbl (%rax),%eax
+  801b71:	38 c2                	cmp    %al,%dl
+  801b73:	74 18                	je     801b8d <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801b75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b79:	0f b6 00             	movzbl (%rax),%eax
+  801b7c:	0f b6 d0             	movzbl %al,%edx
+  801b7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b83:	0f b6 00             	movzbl (%rax),%eax
+  801b86:	0f b6 c0             	movzbl %al,%eax
+  801b89:	29 c2                	sub    %eax,%edx
+  801b8b:	eb 20                	jmp    801bad <memcmp+0x84>
+		s1++, s2++;
+  801b8d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801b92:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801b97:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b9b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b9f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801ba3:	48 85 c0             	test   %rax,%rax
+  801ba6:	75 bb                	jne    801b63 <memcmp+0x3a>
+	}
+
+	return 0;
+  801ba8:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801bad:	89 d0                	mov    %edx,%eax
+  801baf:	c9                   	leave
+  801bb0:	c3                   	ret
+
+0000000000801bb1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801bb1:	55                   	push   %rbp
+  801bb2:	48 89 e5             	mov    %rsp,%rbp
+  801bb5:	48 83 ec 28          	sub    $0x28,%rsp
+  801bb9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801bb9 <memfind+0x8>
+  801bc0:	49 bb 87 74 00 00 00 	movabs $0x7487,%r11
+  801bc7:	00 00 00 
+  801bca:	4c 01 d8             	add    %r11,%rax
+  801bcd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801bd1:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801bd4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801bd8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801bdc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be0:	48 01 d0             	add    %rdx,%rax
+  801be3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801be7:	eb 13                	jmp    801bfc <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801be9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bed:	0f b6 00             	movzbl (%rax),%eax
+  801bf0:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801bf3:	38 d0                	cmp    %dl,%al
+  801bf5:	74 11                	je     801c08 <memfind+0x57>
+	for (; s < ends; s++)
+  801bf7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801bfc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c00:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801c04:	72 e3                	jb     801be9 <memfind+0x38>
+  801c06:	eb 01                	jmp    801c09 <memfind+0x58>
+			break;
+  801c08:	90                   	nop
+	return (void *) s;
+  801c09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c0d:	c9                   	leave
+  801c0e:	c3                   	ret
+
+0000000000801c0f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801c0f:	55                   	push   %rbp
+  801c10:	48 89 e5             	mov    %rsp,%rbp
+  801c13:	48 83 ec 38          	sub    $0x38,%rsp
+  801c17:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c17 <strtol+0x8>
+  801c1e:	49 bb 29 74 00 00 00 	movabs $0x7429,%r11
+  801c25:	00 00 00 
+  801c28:	4c 01 d8             	add    %r11,%rax
+  801c2b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c2f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c33:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801c36:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801c3d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801c44:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801c45:	eb 05                	jmp    801c4c <strtol+0x3d>
+		s++;
+  801c47:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801c4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c50:	0f b6 00             	movzbl (%rax),%eax
+  801c53:	3c 20                	cmp    $0x20,%al
+  801c55:	74 f0                	je     801c47 <strtol+0x38>
+  801c57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c5b:	0f b6 00             	movzbl (%rax),%eax
+  801c5e:	3c 09                	cmp    $0x9,%al
+  801c60:	74 e5                	je     801c47 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801c62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c66:	0f b6 00             	movzbl (%rax),%eax
+  801c69:	3c 2b                	cmp    $0x2b,%al
+  801c6b:	75 07                	jne    801c74 <strtol+0x65>
+		s++;
+  801c6d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c72:	eb 17                	jmp    801c8b <strtol+0x7c>
+	else if (*s == '-')
+  801c74:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c78:	0f b6 00             	movzbl (%rax),%eax
+  801c7b:	3c 2d                	cmp    $0x2d,%al
+  801c7d:	75 0c                	jne    801c8b <strtol+0x7c>
+		s++, neg = 1;
+  801c7f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c84:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801c8b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c8f:	74 06                	je     801c97 <strtol+0x88>
+  801c91:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801c95:	75 28                	jne    801cbf <strtol+0xb0>
+  801c97:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c9b:	0f b6 00             	movzbl (%rax),%eax
+  801c9e:	3c 30                	cmp    $0x30,%al
+  801ca0:	75 1d                	jne    801cbf <strtol+0xb0>
+  801ca2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca6:	48 83 c0 01          	add    $0x1,%rax
+  801caa:	0f b6 00             	movzbl (%rax),%eax
+  801cad:	3c 78                	cmp    $0x78,%al
+  801caf:	75 0e                	jne    801cbf <strtol+0xb0>
+		s += 2, base = 16;
+  801cb1:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801cb6:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801cbd:	eb 2c                	jmp    801ceb <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801cbf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cc3:	75 19                	jne    801cde <strtol+0xcf>
+  801cc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc9:	0f b6 00             	movzbl (%rax),%eax
+  801ccc:	3c 30                	cmp    $0x30,%al
+  801cce:	75 0e                	jne    801cde <strtol+0xcf>
+		s++, base = 8;
+  801cd0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cd5:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801cdc:	eb 0d                	jmp    801ceb <strtol+0xdc>
+	else if (base == 0)
+  801cde:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ce2:	75 07                	jne    801ceb <strtol+0xdc>
+		base = 10;
+  801ce4:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801ceb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cef:	0f b6 00             	movzbl (%rax),%eax
+  801cf2:	3c 2f                	cmp    $0x2f,%al
+  801cf4:	7e 1d                	jle    801d13 <strtol+0x104>
+  801cf6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cfa:	0f b6 00             	movzbl (%rax),%eax
+  801cfd:	3c 39                	cmp    $0x39,%al
+  801cff:	7f 12                	jg     801d13 <strtol+0x104>
+			dig = *s - '0';
+  801d01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d05:	0f b6 00             	movzbl (%rax),%eax
+  801d08:	0f be c0             	movsbl %al,%eax
+  801d0b:	83 e8 30             	sub    $0x30,%eax
+  801d0e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d11:	eb 4e                	jmp    801d61 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801d13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d17:	0f b6 00             	movzbl (%rax),%eax
+  801d1a:	3c 60                	cmp    $0x60,%al
+  801d1c:	7e 1d                	jle    801d3b <strtol+0x12c>
+  801d1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d22:	0f b6 00             	movzbl (%rax),%eax
+  801d25:	3c 7a                	cmp    $0x7a,%al
+  801d27:	7f 12                	jg     801d3b <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801d29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d2d:	0f b6 00             	movzbl (%rax),%eax
+  801d30:	0f be c0             	movsbl %al,%eax
+  801d33:	83 e8 57             	sub    $0x57,%eax
+  801d36:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d39:	eb 26                	jmp    801d61 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801d3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d3f:	0f b6 00             	movzbl (%rax),%eax
+  801d42:	3c 40                	cmp    $0x40,%al
+  801d44:	7e 47                	jle    801d8d <strtol+0x17e>
+  801d46:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d4a:	0f b6 00             	movzbl (%rax),%eax
+  801d4d:	3c 5a                	cmp    $0x5a,%al
+  801d4f:	7f 3c                	jg     801d8d <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801d51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d55:	0f b6 00             	movzbl (%rax),%eax
+  801d58:	0f be c0             	movsbl %al,%eax
+  801d5b:	83 e8 37             	sub    $0x37,%eax
+  801d5e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801d61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d64:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801d67:	7d 23                	jge    801d8c <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801d69:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d6e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801d71:	48 98                	cltq
+  801d73:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801d78:	48 89 c2             	mov    %rax,%rdx
+  801d7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d7e:	48 98                	cltq
+  801d80:	48 01 d0             	add    %rdx,%rax
+  801d83:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801d87:	e9 5f ff ff ff       	jmp    801ceb <strtol+0xdc>
+			break;
+  801d8c:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801d8d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d92:	74 0b                	je     801d9f <strtol+0x190>
+		*endptr = (char *) s;
+  801d94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d98:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801d9c:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801d9f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801da3:	74 09                	je     801dae <strtol+0x19f>
+  801da5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801da9:	48 f7 d8             	neg    %rax
+  801dac:	eb 04                	jmp    801db2 <strtol+0x1a3>
+  801dae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801db2:	c9                   	leave
+  801db3:	c3                   	ret
+
+0000000000801db4 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801db4:	55                   	push   %rbp
+  801db5:	48 89 e5             	mov    %rsp,%rbp
+  801db8:	53                   	push   %rbx
+  801db9:	48 83 ec 30          	sub    $0x30,%rsp
+  801dbd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801dbd <strstr+0x9>
+  801dc4:	49 bb 83 72 00 00 00 	movabs $0x7283,%r11
+  801dcb:	00 00 00 
+  801dce:	4c 01 db             	add    %r11,%rbx
+  801dd1:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801dd5:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801dd9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ddd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801de1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801de5:	0f b6 00             	movzbl (%rax),%eax
+  801de8:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801deb:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801def:	75 06                	jne    801df7 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801df1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801df5:	eb 73                	jmp    801e6a <strstr+0xb6>
+
+	len = strlen(str);
+  801df7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dfb:	48 89 c7             	mov    %rax,%rdi
+  801dfe:	48 b8 01 85 ff ff ff 	movabs $0xffffffffffff8501,%rax
+  801e05:	ff ff ff 
+  801e08:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e0c:	ff d0                	call   *%rax
+  801e0e:	48 98                	cltq
+  801e10:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801e14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e18:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e1c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801e20:	0f b6 00             	movzbl (%rax),%eax
+  801e23:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801e26:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801e2a:	75 07                	jne    801e33 <strstr+0x7f>
+				return (char *) 0;
+  801e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e31:	eb 37                	jmp    801e6a <strstr+0xb6>
+		} while (sc != c);
+  801e33:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801e37:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801e3a:	75 d8                	jne    801e14 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801e3c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e40:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801e44:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e48:	48 89 ce             	mov    %rcx,%rsi
+  801e4b:	48 89 c7             	mov    %rax,%rdi
+  801e4e:	48 b8 b5 87 ff ff ff 	movabs $0xffffffffffff87b5,%rax
+  801e55:	ff ff ff 
+  801e58:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e5c:	ff d0                	call   *%rax
+  801e5e:	85 c0                	test   %eax,%eax
+  801e60:	75 b2                	jne    801e14 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801e62:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e66:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801e6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e6e:	c9                   	leave
+  801e6f:	c3                   	ret
+
+0000000000801e70 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801e70:	55                   	push   %rbp
+  801e71:	48 89 e5             	mov    %rsp,%rbp
+  801e74:	41 57                	push   %r15
+  801e76:	53                   	push   %rbx
+  801e77:	48 83 ec 40          	sub    $0x40,%rsp
+  801e7b:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801e7b <syscall+0xb>
+  801e82:	49 bb c5 71 00 00 00 	movabs $0x71c5,%r11
+  801e89:	00 00 00 
+  801e8c:	4d 01 da             	add    %r11,%r10
+  801e8f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801e92:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801e95:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801e99:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801e9d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801ea1:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801ea5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ea8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801eac:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801eb0:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801eb4:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801eb8:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ebc:	4c 89 c3             	mov    %r8,%rbx
+  801ebf:	cd 30                	int    $0x30
+  801ec1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801ec5:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801ec9:	74 52                	je     801f1d <syscall+0xad>
+  801ecb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ed0:	7e 4b                	jle    801f1d <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ed2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ed6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ed9:	49 89 d0             	mov    %rdx,%r8
+  801edc:	89 c1                	mov    %eax,%ecx
+  801ede:	48 b8 a8 e3 ff ff ff 	movabs $0xffffffffffffe3a8,%rax
+  801ee5:	ff ff ff 
+  801ee8:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801eec:	48 89 c2             	mov    %rax,%rdx
+  801eef:	be 23 00 00 00       	mov    $0x23,%esi
+  801ef4:	48 b8 c5 e3 ff ff ff 	movabs $0xffffffffffffe3c5,%rax
+  801efb:	ff ff ff 
+  801efe:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801f02:	48 89 c7             	mov    %rax,%rdi
+  801f05:	4d 89 d7             	mov    %r10,%r15
+  801f08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0d:	49 b9 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%r9
+  801f14:	ff ff ff 
+  801f17:	4d 01 d1             	add    %r10,%r9
+  801f1a:	41 ff d1             	call   *%r9
+
+	return ret;
+  801f1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801f21:	48 83 c4 40          	add    $0x40,%rsp
+  801f25:	5b                   	pop    %rbx
+  801f26:	41 5f                	pop    %r15
+  801f28:	5d                   	pop    %rbp
+  801f29:	c3                   	ret
+
+0000000000801f2a <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801f2a:	55                   	push   %rbp
+  801f2b:	48 89 e5             	mov    %rsp,%rbp
+  801f2e:	41 57                	push   %r15
+  801f30:	41 56                	push   %r14
+  801f32:	41 55                	push   %r13
+  801f34:	41 54                	push   %r12
+  801f36:	53                   	push   %rbx
+  801f37:	48 83 ec 48          	sub    $0x48,%rsp
+  801f3b:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801f3b <syscall_words+0x11>
+  801f42:	49 bb 05 71 00 00 00 	movabs $0x7105,%r11
+  801f49:	00 00 00 
+  801f4c:	4d 01 de             	add    %r11,%r14
+  801f4f:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801f52:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801f55:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801f59:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801f5d:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801f61:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801f65:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f6a:	74 09                	je     801f75 <syscall_words+0x4b>
+  801f6c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f70:	48 8b 00             	mov    (%rax),%rax
+  801f73:	eb 05                	jmp    801f7a <syscall_words+0x50>
+  801f75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7a:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801f7d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f82:	74 0a                	je     801f8e <syscall_words+0x64>
+  801f84:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f88:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f8c:	eb 05                	jmp    801f93 <syscall_words+0x69>
+  801f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f93:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801f96:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f9b:	74 0a                	je     801fa7 <syscall_words+0x7d>
+  801f9d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fa1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801fa5:	eb 05                	jmp    801fac <syscall_words+0x82>
+  801fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fac:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801faf:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fb4:	74 0a                	je     801fc0 <syscall_words+0x96>
+  801fb6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fba:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801fbe:	eb 05                	jmp    801fc5 <syscall_words+0x9b>
+  801fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc5:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801fc8:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fcd:	74 0a                	je     801fd9 <syscall_words+0xaf>
+  801fcf:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fd3:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801fd7:	eb 05                	jmp    801fde <syscall_words+0xb4>
+  801fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fde:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801fe1:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fe6:	74 0a                	je     801ff2 <syscall_words+0xc8>
+  801fe8:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fec:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801ff0:	eb 05                	jmp    801ff7 <syscall_words+0xcd>
+  801ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff7:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801ffa:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801ffd:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802001:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802005:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  802009:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80200d:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802011:	cd 30                	int    $0x30
+  802013:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  802017:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80201c:	74 50                	je     80206e <syscall_words+0x144>
+		words[0] = r8;
+  80201e:	4c 89 c2             	mov    %r8,%rdx
+  802021:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802025:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802028:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80202c:	48 83 c0 08          	add    $0x8,%rax
+  802030:	4c 89 ca             	mov    %r9,%rdx
+  802033:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802036:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80203a:	48 83 c0 10          	add    $0x10,%rax
+  80203e:	4c 89 d2             	mov    %r10,%rdx
+  802041:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  802044:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802048:	48 83 c0 18          	add    $0x18,%rax
+  80204c:	4c 89 da             	mov    %r11,%rdx
+  80204f:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  802052:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802056:	48 83 c0 20          	add    $0x20,%rax
+  80205a:	4c 89 e2             	mov    %r12,%rdx
+  80205d:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  802060:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802064:	48 83 c0 28          	add    $0x28,%rax
+  802068:	4c 89 ea             	mov    %r13,%rdx
+  80206b:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  80206e:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  802072:	74 52                	je     8020c6 <syscall_words+0x19c>
+  802074:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802079:	7e 4b                	jle    8020c6 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80207b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80207f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802082:	49 89 d0             	mov    %rdx,%r8
+  802085:	89 c1                	mov    %eax,%ecx
+  802087:	48 b8 a8 e3 ff ff ff 	movabs $0xffffffffffffe3a8,%rax
+  80208e:	ff ff ff 
+  802091:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802095:	48 89 c2             	mov    %rax,%rdx
+  802098:	be 4e 00 00 00       	mov    $0x4e,%esi
+  80209d:	48 b8 c5 e3 ff ff ff 	movabs $0xffffffffffffe3c5,%rax
+  8020a4:	ff ff ff 
+  8020a7:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8020ab:	48 89 c7             	mov    %rax,%rdi
+  8020ae:	4d 89 f7             	mov    %r14,%r15
+  8020b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b6:	49 b9 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%r9
+  8020bd:	ff ff ff 
+  8020c0:	4d 01 f1             	add    %r14,%r9
+  8020c3:	41 ff d1             	call   *%r9
+
+	return ret;
+  8020c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8020ca:	48 83 c4 48          	add    $0x48,%rsp
+  8020ce:	5b                   	pop    %rbx
+  8020cf:	41 5c                	pop    %r12
+  8020d1:	41 5d                	pop    %r13
+  8020d3:	41 5e                	pop    %r14
+  8020d5:	41 5f                	pop    %r15
+  8020d7:	5d                   	pop    %rbp
+  8020d8:	c3                   	ret
+
+00000000008020d9 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8020d9:	55                   	push   %rbp
+  8020da:	48 89 e5             	mov    %rsp,%rbp
+  8020dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8020e1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020e1 <sys_cputs+0x8>
+  8020e8:	49 bb 5f 6f 00 00 00 	movabs $0x6f5f,%r11
+  8020ef:	00 00 00 
+  8020f2:	4c 01 d8             	add    %r11,%rax
+  8020f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8020f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8020fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802101:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802105:	48 83 ec 08          	sub    $0x8,%rsp
+  802109:	6a 00                	push   $0x0
+  80210b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802111:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802117:	be 00 00 00 00       	mov    $0x0,%esi
+  80211c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802121:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  802128:	ff ff ff 
+  80212b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80212f:	ff d0                	call   *%rax
+  802131:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802135:	90                   	nop
+  802136:	c9                   	leave
+  802137:	c3                   	ret
+
+0000000000802138 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802138:	55                   	push   %rbp
+  802139:	48 89 e5             	mov    %rsp,%rbp
+  80213c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80213c <sys_cgetc+0x4>
+  802143:	49 bb 04 6f 00 00 00 	movabs $0x6f04,%r11
+  80214a:	00 00 00 
+  80214d:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802150:	48 83 ec 08          	sub    $0x8,%rsp
+  802154:	6a 00                	push   $0x0
+  802156:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80215c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802162:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802167:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216c:	be 00 00 00 00       	mov    $0x0,%esi
+  802171:	bf 01 00 00 00       	mov    $0x1,%edi
+  802176:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  80217d:	ff ff ff 
+  802180:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802184:	ff d0                	call   *%rax
+  802186:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80218a:	c9                   	leave
+  80218b:	c3                   	ret
+
+000000000080218c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80218c:	55                   	push   %rbp
+  80218d:	48 89 e5             	mov    %rsp,%rbp
+  802190:	48 83 ec 10          	sub    $0x10,%rsp
+  802194:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802194 <sys_env_destroy+0x8>
+  80219b:	49 bb ac 6e 00 00 00 	movabs $0x6eac,%r11
+  8021a2:	00 00 00 
+  8021a5:	4c 01 d8             	add    %r11,%rax
+  8021a8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8021ab:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021ae:	48 63 d2             	movslq %edx,%rdx
+  8021b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b5:	6a 00                	push   $0x0
+  8021b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8021cd:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021d2:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  8021d9:	ff ff ff 
+  8021dc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021e0:	ff d0                	call   *%rax
+  8021e2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021e6:	c9                   	leave
+  8021e7:	c3                   	ret
+
+00000000008021e8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8021e8:	55                   	push   %rbp
+  8021e9:	48 89 e5             	mov    %rsp,%rbp
+  8021ec:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021ec <sys_getenvid+0x4>
+  8021f3:	49 bb 54 6e 00 00 00 	movabs $0x6e54,%r11
+  8021fa:	00 00 00 
+  8021fd:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802200:	48 83 ec 08          	sub    $0x8,%rsp
+  802204:	6a 00                	push   $0x0
+  802206:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80220c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802212:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802217:	ba 00 00 00 00       	mov    $0x0,%edx
+  80221c:	be 00 00 00 00       	mov    $0x0,%esi
+  802221:	bf 02 00 00 00       	mov    $0x2,%edi
+  802226:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  80222d:	ff ff ff 
+  802230:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802234:	ff d0                	call   *%rax
+  802236:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80223a:	c9                   	leave
+  80223b:	c3                   	ret
+
+000000000080223c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80223c:	55                   	push   %rbp
+  80223d:	48 89 e5             	mov    %rsp,%rbp
+  802240:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802240 <sys_yield+0x4>
+  802247:	49 bb 00 6e 00 00 00 	movabs $0x6e00,%r11
+  80224e:	00 00 00 
+  802251:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802254:	48 83 ec 08          	sub    $0x8,%rsp
+  802258:	6a 00                	push   $0x0
+  80225a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802260:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802266:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80226b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802270:	be 00 00 00 00       	mov    $0x0,%esi
+  802275:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80227a:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  802281:	ff ff ff 
+  802284:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802288:	ff d0                	call   *%rax
+  80228a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80228e:	90                   	nop
+  80228f:	c9                   	leave
+  802290:	c3                   	ret
+
+0000000000802291 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802291:	55                   	push   %rbp
+  802292:	48 89 e5             	mov    %rsp,%rbp
+  802295:	48 83 ec 10          	sub    $0x10,%rsp
+  802299:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802299 <sys_page_alloc+0x8>
+  8022a0:	49 bb a7 6d 00 00 00 	movabs $0x6da7,%r11
+  8022a7:	00 00 00 
+  8022aa:	4c 01 d8             	add    %r11,%rax
+  8022ad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022b4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8022b7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022ba:	48 63 f2             	movslq %edx,%rsi
+  8022bd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022c1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022c4:	48 63 d2             	movslq %edx,%rdx
+  8022c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8022cb:	6a 00                	push   $0x0
+  8022cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022d3:	49 89 f0             	mov    %rsi,%r8
+  8022d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8022db:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022e0:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  8022e7:	ff ff ff 
+  8022ea:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022ee:	ff d0                	call   *%rax
+  8022f0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022f4:	c9                   	leave
+  8022f5:	c3                   	ret
+
+00000000008022f6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8022f6:	55                   	push   %rbp
+  8022f7:	48 89 e5             	mov    %rsp,%rbp
+  8022fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8022fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022fe <sys_page_map+0x8>
+  802305:	49 bb 42 6d 00 00 00 	movabs $0x6d42,%r11
+  80230c:	00 00 00 
+  80230f:	4c 01 d8             	add    %r11,%rax
+  802312:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802315:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802319:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80231c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802320:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802324:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802327:	48 63 f2             	movslq %edx,%rsi
+  80232a:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  80232e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802331:	48 63 fa             	movslq %edx,%rdi
+  802334:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802338:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80233b:	48 63 d2             	movslq %edx,%rdx
+  80233e:	48 83 ec 08          	sub    $0x8,%rsp
+  802342:	56                   	push   %rsi
+  802343:	4d 89 c1             	mov    %r8,%r9
+  802346:	49 89 f8             	mov    %rdi,%r8
+  802349:	be 01 00 00 00       	mov    $0x1,%esi
+  80234e:	bf 05 00 00 00       	mov    $0x5,%edi
+  802353:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  80235a:	ff ff ff 
+  80235d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802361:	ff d0                	call   *%rax
+  802363:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802367:	c9                   	leave
+  802368:	c3                   	ret
+
+0000000000802369 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802369:	55                   	push   %rbp
+  80236a:	48 89 e5             	mov    %rsp,%rbp
+  80236d:	48 83 ec 10          	sub    $0x10,%rsp
+  802371:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802371 <sys_page_unmap+0x8>
+  802378:	49 bb cf 6c 00 00 00 	movabs $0x6ccf,%r11
+  80237f:	00 00 00 
+  802382:	4c 01 d8             	add    %r11,%rax
+  802385:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802388:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  80238c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802390:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802393:	48 63 d2             	movslq %edx,%rdx
+  802396:	48 83 ec 08          	sub    $0x8,%rsp
+  80239a:	6a 00                	push   $0x0
+  80239c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ad:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023b2:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  8023b9:	ff ff ff 
+  8023bc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023c0:	ff d0                	call   *%rax
+  8023c2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023c6:	c9                   	leave
+  8023c7:	c3                   	ret
+
+00000000008023c8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8023c8:	55                   	push   %rbp
+  8023c9:	48 89 e5             	mov    %rsp,%rbp
+  8023cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8023d0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023d0 <sys_env_set_status+0x8>
+  8023d7:	49 bb 70 6c 00 00 00 	movabs $0x6c70,%r11
+  8023de:	00 00 00 
+  8023e1:	4c 01 d8             	add    %r11,%rax
+  8023e4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023e7:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8023ea:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023ed:	48 63 ca             	movslq %edx,%rcx
+  8023f0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023f3:	48 63 d2             	movslq %edx,%rdx
+  8023f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8023fa:	6a 00                	push   $0x0
+  8023fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802402:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802408:	be 01 00 00 00       	mov    $0x1,%esi
+  80240d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802412:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  802419:	ff ff ff 
+  80241c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802420:	ff d0                	call   *%rax
+  802422:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802426:	c9                   	leave
+  802427:	c3                   	ret
+
+0000000000802428 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802428:	55                   	push   %rbp
+  802429:	48 89 e5             	mov    %rsp,%rbp
+  80242c:	48 83 ec 10          	sub    $0x10,%rsp
+  802430:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802430 <sys_env_set_trapframe+0x8>
+  802437:	49 bb 10 6c 00 00 00 	movabs $0x6c10,%r11
+  80243e:	00 00 00 
+  802441:	4c 01 d8             	add    %r11,%rax
+  802444:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802447:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  80244b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80244f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802452:	48 63 d2             	movslq %edx,%rdx
+  802455:	48 83 ec 08          	sub    $0x8,%rsp
+  802459:	6a 00                	push   $0x0
+  80245b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802461:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802467:	be 01 00 00 00       	mov    $0x1,%esi
+  80246c:	bf 09 00 00 00       	mov    $0x9,%edi
+  802471:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  802478:	ff ff ff 
+  80247b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80247f:	ff d0                	call   *%rax
+  802481:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802485:	c9                   	leave
+  802486:	c3                   	ret
+
+0000000000802487 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802487:	55                   	push   %rbp
+  802488:	48 89 e5             	mov    %rsp,%rbp
+  80248b:	48 83 ec 10          	sub    $0x10,%rsp
+  80248f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80248f <sys_env_set_pgfault_upcall+0x8>
+  802496:	49 bb b1 6b 00 00 00 	movabs $0x6bb1,%r11
+  80249d:	00 00 00 
+  8024a0:	4c 01 d8             	add    %r11,%rax
+  8024a3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024a6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8024aa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024ae:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024b1:	48 63 d2             	movslq %edx,%rdx
+  8024b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b8:	6a 00                	push   $0x0
+  8024ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8024cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8024d0:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  8024d7:	ff ff ff 
+  8024da:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024de:	ff d0                	call   *%rax
+  8024e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024e4:	c9                   	leave
+  8024e5:	c3                   	ret
+
+00000000008024e6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8024e6:	55                   	push   %rbp
+  8024e7:	48 89 e5             	mov    %rsp,%rbp
+  8024ea:	48 83 ec 20          	sub    $0x20,%rsp
+  8024ee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024ee <sys_ipc_try_send+0x8>
+  8024f5:	49 bb 52 6b 00 00 00 	movabs $0x6b52,%r11
+  8024fc:	00 00 00 
+  8024ff:	4c 01 d8             	add    %r11,%rax
+  802502:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802505:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802509:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80250d:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802510:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802513:	48 63 fa             	movslq %edx,%rdi
+  802516:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80251a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80251d:	48 63 d2             	movslq %edx,%rdx
+  802520:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802524:	48 83 ec 08          	sub    $0x8,%rsp
+  802528:	6a 00                	push   $0x0
+  80252a:	49 89 f9             	mov    %rdi,%r9
+  80252d:	49 89 f0             	mov    %rsi,%r8
+  802530:	be 00 00 00 00       	mov    $0x0,%esi
+  802535:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80253a:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  802541:	ff ff ff 
+  802544:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802548:	ff d0                	call   *%rax
+  80254a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80254e:	c9                   	leave
+  80254f:	c3                   	ret
+
+0000000000802550 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802550:	55                   	push   %rbp
+  802551:	48 89 e5             	mov    %rsp,%rbp
+  802554:	48 83 ec 20          	sub    $0x20,%rsp
+  802558:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802558 <sys_ipc_send+0x8>
+  80255f:	49 bb e8 6a 00 00 00 	movabs $0x6ae8,%r11
+  802566:	00 00 00 
+  802569:	4c 01 d8             	add    %r11,%rax
+  80256c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80256f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802573:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802577:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80257a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80257d:	48 63 fa             	movslq %edx,%rdi
+  802580:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802584:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802587:	48 63 d2             	movslq %edx,%rdx
+  80258a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80258e:	48 83 ec 08          	sub    $0x8,%rsp
+  802592:	6a 00                	push   $0x0
+  802594:	49 89 f9             	mov    %rdi,%r9
+  802597:	49 89 f0             	mov    %rsi,%r8
+  80259a:	be 00 00 00 00       	mov    $0x0,%esi
+  80259f:	bf 17 00 00 00       	mov    $0x17,%edi
+  8025a4:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  8025ab:	ff ff ff 
+  8025ae:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025b2:	ff d0                	call   *%rax
+  8025b4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025b8:	c9                   	leave
+  8025b9:	c3                   	ret
+
+00000000008025ba <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8025ba:	55                   	push   %rbp
+  8025bb:	48 89 e5             	mov    %rsp,%rbp
+  8025be:	48 83 ec 10          	sub    $0x10,%rsp
+  8025c2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025c2 <sys_ipc_recv+0x8>
+  8025c9:	49 bb 7e 6a 00 00 00 	movabs $0x6a7e,%r11
+  8025d0:	00 00 00 
+  8025d3:	4c 01 d8             	add    %r11,%rax
+  8025d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8025da:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025de:	6a 00                	push   $0x0
+  8025e0:	6a 00                	push   $0x0
+  8025e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025f3:	be 01 00 00 00       	mov    $0x1,%esi
+  8025f8:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8025fd:	49 ba ea 8e ff ff ff 	movabs $0xffffffffffff8eea,%r10
+  802604:	ff ff ff 
+  802607:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80260b:	ff d0                	call   *%rax
+  80260d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802611:	c9                   	leave
+  802612:	c3                   	ret
+
+0000000000802613 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802613:	55                   	push   %rbp
+  802614:	48 89 e5             	mov    %rsp,%rbp
+  802617:	48 83 ec 30          	sub    $0x30,%rsp
+  80261b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80261b <sys_ipc_call+0x8>
+  802622:	49 bb 25 6a 00 00 00 	movabs $0x6a25,%r11
+  802629:	00 00 00 
+  80262c:	4c 01 d8             	add    %r11,%rax
+  80262f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802632:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802636:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80263a:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80263d:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802641:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802645:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802649:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80264c:	4c 63 c2             	movslq %edx,%r8
+  80264f:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802653:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802656:	48 63 d2             	movslq %edx,%rdx
+  802659:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80265d:	ff 75 d8             	push   -0x28(%rbp)
+  802660:	56                   	push   %rsi
+  802661:	4d 89 c1             	mov    %r8,%r9
+  802664:	49 89 f8             	mov    %rdi,%r8
+  802667:	be 00 00 00 00       	mov    $0x0,%esi
+  80266c:	bf 18 00 00 00       	mov    $0x18,%edi
+  802671:	49 ba ea 8e ff ff ff 	movabs $0xffffffffffff8eea,%r10
+  802678:	ff ff ff 
+  80267b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80267f:	ff d0                	call   *%rax
+  802681:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802685:	c9                   	leave
+  802686:	c3                   	ret
+
+0000000000802687 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802687:	55                   	push   %rbp
+  802688:	48 89 e5             	mov    %rsp,%rbp
+  80268b:	48 83 ec 30          	sub    $0x30,%rsp
+  80268f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80268f <sys_ipc_reply_recv+0x8>
+  802696:	49 bb b1 69 00 00 00 	movabs $0x69b1,%r11
+  80269d:	00 00 00 
+  8026a0:	4c 01 d8             	add    %r11,%rax
+  8026a3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026a6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026aa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8026ae:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8026b1:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8026b5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8026b9:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8026bd:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026c0:	4c 63 c2             	movslq %edx,%r8
+  8026c3:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8026c7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026ca:	48 63 d2             	movslq %edx,%rdx
+  8026cd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026d1:	ff 75 d8             	push   -0x28(%rbp)
+  8026d4:	56                   	push   %rsi
+  8026d5:	4d 89 c1             	mov    %r8,%r9
+  8026d8:	49 89 f8             	mov    %rdi,%r8
+  8026db:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e0:	bf 19 00 00 00       	mov    $0x19,%edi
+  8026e5:	49 ba ea 8e ff ff ff 	movabs $0xffffffffffff8eea,%r10
+  8026ec:	ff ff ff 
+  8026ef:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026f3:	ff d0                	call   *%rax
+  8026f5:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8026f9:	c9                   	leave
+  8026fa:	c3                   	ret
+
+00000000008026fb <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8026fb:	55                   	push   %rbp
+  8026fc:	48 89 e5             	mov    %rsp,%rbp
+  8026ff:	48 83 ec 10          	sub    $0x10,%rsp
+  802703:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802703 <sys_env_set_priority+0x8>
+  80270a:	49 bb 3d 69 00 00 00 	movabs $0x693d,%r11
+  802711:	00 00 00 
+  802714:	4c 01 d8             	add    %r11,%rax
+  802717:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80271a:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80271d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802720:	48 63 ca             	movslq %edx,%rcx
+  802723:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802726:	48 63 d2             	movslq %edx,%rdx
+  802729:	48 83 ec 08          	sub    $0x8,%rsp
+  80272d:	6a 00                	push   $0x0
+  80272f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802735:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80273b:	be 01 00 00 00       	mov    $0x1,%esi
+  802740:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802745:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  80274c:	ff ff ff 
+  80274f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802753:	ff d0                	call   *%rax
+  802755:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802759:	c9                   	leave
+  80275a:	c3                   	ret
+
+000000000080275b <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80275b:	55                   	push   %rbp
+  80275c:	48 89 e5             	mov    %rsp,%rbp
+  80275f:	48 83 ec 10          	sub    $0x10,%rsp
+  802763:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802763 <sys_env_set_affinity+0x8>
+  80276a:	49 bb dd 68 00 00 00 	movabs $0x68dd,%r11
+  802771:	00 00 00 
+  802774:	4c 01 d8             	add    %r11,%rax
+  802777:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80277a:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  80277d:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802780:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802783:	48 63 d2             	movslq %edx,%rdx
+  802786:	48 83 ec 08          	sub    $0x8,%rsp
+  80278a:	6a 00                	push   $0x0
+  80278c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802792:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802798:	be 01 00 00 00       	mov    $0x1,%esi
+  80279d:	bf 10 00 00 00       	mov    $0x10,%edi
+  8027a2:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  8027a9:	ff ff ff 
+  8027ac:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027b0:	ff d0                	call   *%rax
+  8027b2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027b6:	c9                   	leave
+  8027b7:	c3                   	ret
+
+00000000008027b8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8027b8:	55                   	push   %rbp
+  8027b9:	48 89 e5             	mov    %rsp,%rbp
+  8027bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027bc <sys_time_msec+0x4>
+  8027c3:	49 bb 84 68 00 00 00 	movabs $0x6884,%r11
+  8027ca:	00 00 00 
+  8027cd:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8027d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d4:	6a 00                	push   $0x0
+  8027d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f1:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8027f6:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  8027fd:	ff ff ff 
+  802800:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802804:	ff d0                	call   *%rax
+  802806:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80280a:	c9                   	leave
+  80280b:	c3                   	ret
+
+000000000080280c <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80280c:	55                   	push   %rbp
+  80280d:	48 89 e5             	mov    %rsp,%rbp
+  802810:	48 83 ec 10          	sub    $0x10,%rsp
+  802814:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802814 <sys_sleep_usec+0x8>
+  80281b:	49 bb 2c 68 00 00 00 	movabs $0x682c,%r11
+  802822:	00 00 00 
+  802825:	4c 01 d8             	add    %r11,%rax
+  802828:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  80282c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802830:	48 83 ec 08          	sub    $0x8,%rsp
+  802834:	6a 00                	push   $0x0
+  802836:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80283c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802842:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802847:	be 00 00 00 00       	mov    $0x0,%esi
+  80284c:	bf 11 00 00 00       	mov    $0x11,%edi
+  802851:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  802858:	ff ff ff 
+  80285b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80285f:	ff d0                	call   *%rax
+  802861:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802865:	c9                   	leave
+  802866:	c3                   	ret
+
+0000000000802867 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802867:	55                   	push   %rbp
+  802868:	48 89 e5             	mov    %rsp,%rbp
+  80286b:	48 83 ec 10          	sub    $0x10,%rsp
+  80286f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80286f <sys_page_alloc_huge+0x8>
+  802876:	49 bb d1 67 00 00 00 	movabs $0x67d1,%r11
+  80287d:	00 00 00 
+  802880:	4c 01 d8             	add    %r11,%rax
+  802883:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802886:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80288a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  80288d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802890:	48 63 f2             	movslq %edx,%rsi
+  802893:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802897:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80289a:	48 63 d2             	movslq %edx,%rdx
+  80289d:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a1:	6a 00                	push   $0x0
+  8028a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028a9:	49 89 f0             	mov    %rsi,%r8
+  8028ac:	be 01 00 00 00       	mov    $0x1,%esi
+  8028b1:	bf 12 00 00 00       	mov    $0x12,%edi
+  8028b6:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  8028bd:	ff ff ff 
+  8028c0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028c4:	ff d0                	call   *%rax
+  8028c6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028ca:	c9                   	leave
+  8028cb:	c3                   	ret
+
+00000000008028cc <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8028cc:	55                   	push   %rbp
+  8028cd:	48 89 e5             	mov    %rsp,%rbp
+  8028d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8028d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028d4 <sys_page_map_batch+0x8>
+  8028db:	49 bb 6c 67 00 00 00 	movabs $0x676c,%r11
+  8028e2:	00 00 00 
+  8028e5:	4c 01 d8             	add    %r11,%rax
+  8028e8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028ec:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8028f0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028f4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8028fc:	6a 00                	push   $0x0
+  8028fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802904:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80290a:	be 01 00 00 00       	mov    $0x1,%esi
+  80290f:	bf 13 00 00 00       	mov    $0x13,%edi
+  802914:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  80291b:	ff ff ff 
+  80291e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802922:	ff d0                	call   *%rax
+  802924:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802928:	c9                   	leave
+  802929:	c3                   	ret
+
+000000000080292a <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  80292a:	55                   	push   %rbp
+  80292b:	48 89 e5             	mov    %rsp,%rbp
+  80292e:	48 83 ec 10          	sub    $0x10,%rsp
+  802932:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802932 <sys_page_alloc_batch+0x8>
+  802939:	49 bb 0e 67 00 00 00 	movabs $0x670e,%r11
+  802940:	00 00 00 
+  802943:	4c 01 d8             	add    %r11,%rax
+  802946:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80294a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80294e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802952:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802956:	48 83 ec 08          	sub    $0x8,%rsp
+  80295a:	6a 00                	push   $0x0
+  80295c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802962:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802968:	be 01 00 00 00       	mov    $0x1,%esi
+  80296d:	bf 14 00 00 00       	mov    $0x14,%edi
+  802972:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  802979:	ff ff ff 
+  80297c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802980:	ff d0                	call   *%rax
+  802982:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802986:	c9                   	leave
+  802987:	c3                   	ret
+
+0000000000802988 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802988:	55                   	push   %rbp
+  802989:	48 89 e5             	mov    %rsp,%rbp
+  80298c:	48 83 ec 10          	sub    $0x10,%rsp
+  802990:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802990 <sys_page_unmap_batch+0x8>
+  802997:	49 bb b0 66 00 00 00 	movabs $0x66b0,%r11
+  80299e:	00 00 00 
+  8029a1:	4c 01 d8             	add    %r11,%rax
+  8029a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8029ac:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029b0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8029b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8029b8:	6a 00                	push   $0x0
+  8029ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8029cb:	bf 15 00 00 00       	mov    $0x15,%edi
+  8029d0:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  8029d7:	ff ff ff 
+  8029da:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029de:	ff d0                	call   *%rax
+  8029e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029e4:	c9                   	leave
+  8029e5:	c3                   	ret
+
+00000000008029e6 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8029e6:	55                   	push   %rbp
+  8029e7:	48 89 e5             	mov    %rsp,%rbp
+  8029ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029ea <sys_fork+0x4>
+  8029f1:	49 bb 56 66 00 00 00 	movabs $0x6656,%r11
+  8029f8:	00 00 00 
+  8029fb:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8029fe:	48 83 ec 08          	sub    $0x8,%rsp
+  802a02:	6a 00                	push   $0x0
+  802a04:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a0a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a15:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a1a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a1f:	bf 16 00 00 00       	mov    $0x16,%edi
+  802a24:	49 ba 30 8e ff ff ff 	movabs $0xffffffffffff8e30,%r10
+  802a2b:	ff ff ff 
+  802a2e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a32:	ff d0                	call   *%rax
+  802a34:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a38:	c9                   	leave
+  802a39:	c3                   	ret
+
+0000000000802a3a <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802a3a:	55                   	push   %rbp
+  802a3b:	48 89 e5             	mov    %rsp,%rbp
+  802a3e:	41 57                	push   %r15
+  802a40:	53                   	push   %rbx
+  802a41:	48 83 ec 40          	sub    $0x40,%rsp
+  802a45:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a45 <pgfault+0xb>
+  802a4c:	49 bb fb 65 00 00 00 	movabs $0x65fb,%r11
+  802a53:	00 00 00 
+  802a56:	4c 01 db             	add    %r11,%rbx
+  802a59:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  802a5d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a61:	48 8b 00             	mov    (%rax),%rax
+  802a64:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802a68:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a6c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a70:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  802a73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a77:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802a7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a7f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802a85:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802a89:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802a8c:	83 e0 02             	and    $0x2,%eax
+  802a8f:	85 c0                	test   %eax,%eax
+  802a91:	0f 84 91 03 00 00    	je     802e28 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802a97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a9b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a9f:	48 89 c2             	mov    %rax,%rdx
+  802aa2:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802aa9:	ff ff ff 
+  802aac:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ab0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ab4:	83 e0 01             	and    $0x1,%eax
+  802ab7:	48 85 c0             	test   %rax,%rax
+  802aba:	0f 84 a7 01 00 00    	je     802c67 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802ac0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ac4:	48 c1 e8 15          	shr    $0x15,%rax
+  802ac8:	48 89 c2             	mov    %rax,%rdx
+  802acb:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802ad2:	ff ff ff 
+  802ad5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ad9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802add:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802ae2:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802ae8:	0f 85 79 01 00 00    	jne    802c67 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802aee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802af2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802af6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802afa:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802b00:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802b04:	ba 07 00 00 00       	mov    $0x7,%edx
+  802b09:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b13:	49 89 df             	mov    %rbx,%r15
+  802b16:	48 b8 27 98 ff ff ff 	movabs $0xffffffffffff9827,%rax
+  802b1d:	ff ff ff 
+  802b20:	48 01 d8             	add    %rbx,%rax
+  802b23:	ff d0                	call   *%rax
+  802b25:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802b28:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802b2c:	79 44                	jns    802b72 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802b2e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802b31:	89 c1                	mov    %eax,%ecx
+  802b33:	48 b8 d8 e3 ff ff ff 	movabs $0xffffffffffffe3d8,%rax
+  802b3a:	ff ff ff 
+  802b3d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b41:	48 89 c2             	mov    %rax,%rdx
+  802b44:	be 20 00 00 00       	mov    $0x20,%esi
+  802b49:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802b50:	ff ff ff 
+  802b53:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b57:	48 89 c7             	mov    %rax,%rdi
+  802b5a:	49 89 df             	mov    %rbx,%r15
+  802b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b62:	49 b8 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%r8
+  802b69:	ff ff ff 
+  802b6c:	49 01 d8             	add    %rbx,%r8
+  802b6f:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802b72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b76:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802b7b:	48 89 c6             	mov    %rax,%rsi
+  802b7e:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802b83:	49 89 df             	mov    %rbx,%r15
+  802b86:	48 b8 a0 8a ff ff ff 	movabs $0xffffffffffff8aa0,%rax
+  802b8d:	ff ff ff 
+  802b90:	48 01 d8             	add    %rbx,%rax
+  802b93:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802b95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b99:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802b9f:	48 89 c1             	mov    %rax,%rcx
+  802ba2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ba7:	be 00 00 60 00       	mov    $0x600000,%esi
+  802bac:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bb1:	49 89 df             	mov    %rbx,%r15
+  802bb4:	48 b8 b6 92 ff ff ff 	movabs $0xffffffffffff92b6,%rax
+  802bbb:	ff ff ff 
+  802bbe:	48 01 d8             	add    %rbx,%rax
+  802bc1:	ff d0                	call   *%rax
+  802bc3:	85 c0                	test   %eax,%eax
+  802bc5:	74 3e                	je     802c05 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802bc7:	48 b8 03 e4 ff ff ff 	movabs $0xffffffffffffe403,%rax
+  802bce:	ff ff ff 
+  802bd1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bd5:	48 89 c2             	mov    %rax,%rdx
+  802bd8:	be 23 00 00 00       	mov    $0x23,%esi
+  802bdd:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802be4:	ff ff ff 
+  802be7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802beb:	48 89 c7             	mov    %rax,%rdi
+  802bee:	49 89 df             	mov    %rbx,%r15
+  802bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf6:	48 b9 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%rcx
+  802bfd:	ff ff ff 
+  802c00:	48 01 d9             	add    %rbx,%rcx
+  802c03:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802c05:	be 00 00 60 00       	mov    $0x600000,%esi
+  802c0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c0f:	49 89 df             	mov    %rbx,%r15
+  802c12:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  802c19:	ff ff ff 
+  802c1c:	48 01 d8             	add    %rbx,%rax
+  802c1f:	ff d0                	call   *%rax
+  802c21:	85 c0                	test   %eax,%eax
+  802c23:	0f 84 3d 02 00 00    	je     802e66 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802c29:	48 b8 18 e4 ff ff ff 	movabs $0xffffffffffffe418,%rax
+  802c30:	ff ff ff 
+  802c33:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c37:	48 89 c2             	mov    %rax,%rdx
+  802c3a:	be 25 00 00 00       	mov    $0x25,%esi
+  802c3f:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802c46:	ff ff ff 
+  802c49:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c4d:	48 89 c7             	mov    %rax,%rdi
+  802c50:	49 89 df             	mov    %rbx,%r15
+  802c53:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c58:	48 b9 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%rcx
+  802c5f:	ff ff ff 
+  802c62:	48 01 d9             	add    %rbx,%rcx
+  802c65:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802c67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c6b:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c6f:	48 89 c2             	mov    %rax,%rdx
+  802c72:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802c79:	ff ff ff 
+  802c7c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c80:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c84:	25 00 08 00 00       	and    $0x800,%eax
+  802c89:	48 85 c0             	test   %rax,%rax
+  802c8c:	0f 84 58 01 00 00    	je     802dea <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802c92:	ba 07 00 00 00       	mov    $0x7,%edx
+  802c97:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802c9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ca1:	49 89 df             	mov    %rbx,%r15
+  802ca4:	48 b8 51 92 ff ff ff 	movabs $0xffffffffffff9251,%rax
+  802cab:	ff ff ff 
+  802cae:	48 01 d8             	add    %rbx,%rax
+  802cb1:	ff d0                	call   *%rax
+  802cb3:	85 c0                	test   %eax,%eax
+  802cb5:	74 3e                	je     802cf5 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802cb7:	48 b8 2f e4 ff ff ff 	movabs $0xffffffffffffe42f,%rax
+  802cbe:	ff ff ff 
+  802cc1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cc5:	48 89 c2             	mov    %rax,%rdx
+  802cc8:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802ccd:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802cd4:	ff ff ff 
+  802cd7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cdb:	48 89 c7             	mov    %rax,%rdi
+  802cde:	49 89 df             	mov    %rbx,%r15
+  802ce1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce6:	48 b9 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%rcx
+  802ced:	ff ff ff 
+  802cf0:	48 01 d9             	add    %rbx,%rcx
+  802cf3:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802cf5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cf9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cfe:	48 89 c6             	mov    %rax,%rsi
+  802d01:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802d06:	49 89 df             	mov    %rbx,%r15
+  802d09:	48 b8 a0 8a ff ff ff 	movabs $0xffffffffffff8aa0,%rax
+  802d10:	ff ff ff 
+  802d13:	48 01 d8             	add    %rbx,%rax
+  802d16:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802d18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d1c:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802d22:	48 89 c1             	mov    %rax,%rcx
+  802d25:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d2a:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802d2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d34:	49 89 df             	mov    %rbx,%r15
+  802d37:	48 b8 b6 92 ff ff ff 	movabs $0xffffffffffff92b6,%rax
+  802d3e:	ff ff ff 
+  802d41:	48 01 d8             	add    %rbx,%rax
+  802d44:	ff d0                	call   *%rax
+  802d46:	85 c0                	test   %eax,%eax
+  802d48:	74 3e                	je     802d88 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802d4a:	48 b8 03 e4 ff ff ff 	movabs $0xffffffffffffe403,%rax
+  802d51:	ff ff ff 
+  802d54:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d58:	48 89 c2             	mov    %rax,%rdx
+  802d5b:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802d60:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802d67:	ff ff ff 
+  802d6a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d6e:	48 89 c7             	mov    %rax,%rdi
+  802d71:	49 89 df             	mov    %rbx,%r15
+  802d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d79:	48 b9 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%rcx
+  802d80:	ff ff ff 
+  802d83:	48 01 d9             	add    %rbx,%rcx
+  802d86:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802d88:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802d8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d92:	49 89 df             	mov    %rbx,%r15
+  802d95:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  802d9c:	ff ff ff 
+  802d9f:	48 01 d8             	add    %rbx,%rax
+  802da2:	ff d0                	call   *%rax
+  802da4:	85 c0                	test   %eax,%eax
+  802da6:	0f 84 bb 00 00 00    	je     802e67 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802dac:	48 b8 18 e4 ff ff ff 	movabs $0xffffffffffffe418,%rax
+  802db3:	ff ff ff 
+  802db6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dba:	48 89 c2             	mov    %rax,%rdx
+  802dbd:	be 32 00 00 00       	mov    $0x32,%esi
+  802dc2:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802dc9:	ff ff ff 
+  802dcc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dd0:	48 89 c7             	mov    %rax,%rdi
+  802dd3:	49 89 df             	mov    %rbx,%r15
+  802dd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ddb:	48 b9 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%rcx
+  802de2:	ff ff ff 
+  802de5:	48 01 d9             	add    %rbx,%rcx
+  802de8:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802dea:	48 b8 48 e4 ff ff ff 	movabs $0xffffffffffffe448,%rax
+  802df1:	ff ff ff 
+  802df4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802df8:	48 89 c2             	mov    %rax,%rdx
+  802dfb:	be 36 00 00 00       	mov    $0x36,%esi
+  802e00:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802e07:	ff ff ff 
+  802e0a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e0e:	48 89 c7             	mov    %rax,%rdi
+  802e11:	49 89 df             	mov    %rbx,%r15
+  802e14:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e19:	48 b9 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%rcx
+  802e20:	ff ff ff 
+  802e23:	48 01 d9             	add    %rbx,%rcx
+  802e26:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802e28:	48 b8 67 e4 ff ff ff 	movabs $0xffffffffffffe467,%rax
+  802e2f:	ff ff ff 
+  802e32:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e36:	48 89 c2             	mov    %rax,%rdx
+  802e39:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802e3e:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802e45:	ff ff ff 
+  802e48:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e4c:	48 89 c7             	mov    %rax,%rdi
+  802e4f:	49 89 df             	mov    %rbx,%r15
+  802e52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e57:	48 b9 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%rcx
+  802e5e:	ff ff ff 
+  802e61:	48 01 d9             	add    %rbx,%rcx
+  802e64:	ff d1                	call   *%rcx
+			return;
+  802e66:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802e67:	48 83 c4 40          	add    $0x40,%rsp
+  802e6b:	5b                   	pop    %rbx
+  802e6c:	41 5f                	pop    %r15
+  802e6e:	5d                   	pop    %rbp
+  802e6f:	c3                   	ret
+
+0000000000802e70 <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802e70:	55                   	push   %rbp
+  802e71:	48 89 e5             	mov    %rsp,%rbp
+  802e74:	41 57                	push   %r15
+  802e76:	53                   	push   %rbx
+  802e77:	48 83 ec 10          	sub    $0x10,%rsp
+  802e7b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e7b <fork_flush+0xb>
+  802e82:	49 bb c5 61 00 00 00 	movabs $0x61c5,%r11
+  802e89:	00 00 00 
+  802e8c:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802e8f:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802e96:	00 00 00 
+  802e99:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e9d:	48 85 c0             	test   %rax,%rax
+  802ea0:	0f 84 81 00 00 00    	je     802f27 <fork_flush+0xb7>
+  802ea6:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802ead:	00 00 00 
+  802eb0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802eb4:	48 89 c6             	mov    %rax,%rsi
+  802eb7:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802ebe:	00 00 00 
+  802ec1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ec5:	48 89 c7             	mov    %rax,%rdi
+  802ec8:	49 89 df             	mov    %rbx,%r15
+  802ecb:	48 b8 8c 98 ff ff ff 	movabs $0xffffffffffff988c,%rax
+  802ed2:	ff ff ff 
+  802ed5:	48 01 d8             	add    %rbx,%rax
+  802ed8:	ff d0                	call   *%rax
+  802eda:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802edd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ee1:	79 44                	jns    802f27 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802ee3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ee6:	89 c1                	mov    %eax,%ecx
+  802ee8:	48 b8 80 e4 ff ff ff 	movabs $0xffffffffffffe480,%rax
+  802eef:	ff ff ff 
+  802ef2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ef6:	48 89 c2             	mov    %rax,%rdx
+  802ef9:	be 56 00 00 00       	mov    $0x56,%esi
+  802efe:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802f05:	ff ff ff 
+  802f08:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f0c:	48 89 c7             	mov    %rax,%rdi
+  802f0f:	49 89 df             	mov    %rbx,%r15
+  802f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f17:	49 b8 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%r8
+  802f1e:	ff ff ff 
+  802f21:	49 01 d8             	add    %rbx,%r8
+  802f24:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802f27:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802f2e:	00 00 00 
+  802f31:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802f38:	00 
+}
+  802f39:	90                   	nop
+  802f3a:	48 83 c4 10          	add    $0x10,%rsp
+  802f3e:	5b                   	pop    %rbx
+  802f3f:	41 5f                	pop    %r15
+  802f41:	5d                   	pop    %rbp
+  802f42:	c3                   	ret
+
+0000000000802f43 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802f43:	55                   	push   %rbp
+  802f44:	48 89 e5             	mov    %rsp,%rbp
+  802f47:	53                   	push   %rbx
+  802f48:	48 83 ec 28          	sub    $0x28,%rsp
+  802f4c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f4c <fork_map+0x9>
+  802f53:	49 bb f4 60 00 00 00 	movabs $0x60f4,%r11
+  802f5a:	00 00 00 
+  802f5d:	4c 01 db             	add    %r11,%rbx
+  802f60:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f63:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802f67:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802f6a:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802f71:	00 00 00 
+  802f74:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f78:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802f7e:	75 10                	jne    802f90 <fork_map+0x4d>
+		fork_flush();
+  802f80:	48 b8 30 9e ff ff ff 	movabs $0xffffffffffff9e30,%rax
+  802f87:	ff ff ff 
+  802f8a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f8e:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802f90:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802f97:	00 00 00 
+  802f9a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f9e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802fa2:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802fa9:	00 00 00 
+  802fac:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802fb0:	48 c1 e0 05          	shl    $0x5,%rax
+  802fb4:	48 89 c2             	mov    %rax,%rdx
+  802fb7:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802fbe:	00 00 00 
+  802fc1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fc5:	48 01 d0             	add    %rdx,%rax
+  802fc8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802fcc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fd0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802fd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fda:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802fde:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802fe2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fe6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802fe9:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802fec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ff0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ff4:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802ff8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ffc:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802fff:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  803002:	90                   	nop
+  803003:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803007:	c9                   	leave
+  803008:	c3                   	ret
+
+0000000000803009 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  803009:	55                   	push   %rbp
+  80300a:	48 89 e5             	mov    %rsp,%rbp
+  80300d:	53                   	push   %rbx
+  80300e:	48 83 ec 28          	sub    $0x28,%rsp
+  803012:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803012 <duppage+0x9>
+  803019:	49 bb 2e 60 00 00 00 	movabs $0x602e,%r11
+  803020:	00 00 00 
+  803023:	4c 01 db             	add    %r11,%rbx
+  803026:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803029:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  80302c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80302f:	48 c1 e0 0c          	shl    $0xc,%rax
+  803033:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  803037:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80303e:	ff ff ff 
+  803041:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803045:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803048:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80304c:	25 00 04 00 00       	and    $0x400,%eax
+  803051:	48 85 c0             	test   %rax,%rax
+  803054:	74 42                	je     803098 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  803056:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80305d:	ff ff ff 
+  803060:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803064:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803067:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80306b:	25 07 0e 00 00       	and    $0xe07,%eax
+  803070:	89 c2                	mov    %eax,%edx
+  803072:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803076:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803079:	48 89 ce             	mov    %rcx,%rsi
+  80307c:	89 c7                	mov    %eax,%edi
+  80307e:	48 b8 03 9f ff ff ff 	movabs $0xffffffffffff9f03,%rax
+  803085:	ff ff ff 
+  803088:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80308c:	ff d0                	call   *%rax
+		return 0;
+  80308e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803093:	e9 ae 00 00 00       	jmp    803146 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  803098:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80309f:	ff ff ff 
+  8030a2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030a6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030a9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030ad:	83 e0 02             	and    $0x2,%eax
+  8030b0:	48 85 c0             	test   %rax,%rax
+  8030b3:	75 1f                	jne    8030d4 <duppage+0xcb>
+  8030b5:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8030bc:	ff ff ff 
+  8030bf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030c3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030c6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030ca:	25 00 08 00 00       	and    $0x800,%eax
+  8030cf:	48 85 c0             	test   %rax,%rax
+  8030d2:	74 4c                	je     803120 <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  8030d4:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  8030db:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8030de:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8030e2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030e5:	48 89 ce             	mov    %rcx,%rsi
+  8030e8:	89 c7                	mov    %eax,%edi
+  8030ea:	48 b8 03 9f ff ff ff 	movabs $0xffffffffffff9f03,%rax
+  8030f1:	ff ff ff 
+  8030f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030f8:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  8030fa:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8030fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803101:	48 89 c6             	mov    %rax,%rsi
+  803104:	bf 00 00 00 00       	mov    $0x0,%edi
+  803109:	48 b8 03 9f ff ff ff 	movabs $0xffffffffffff9f03,%rax
+  803110:	ff ff ff 
+  803113:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803117:	ff d0                	call   *%rax
+		return 0;
+  803119:	b8 00 00 00 00       	mov    $0x0,%eax
+  80311e:	eb 26                	jmp    803146 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  803120:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803124:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803127:	ba 05 00 00 00       	mov    $0x5,%edx
+  80312c:	48 89 ce             	mov    %rcx,%rsi
+  80312f:	89 c7                	mov    %eax,%edi
+  803131:	48 b8 03 9f ff ff ff 	movabs $0xffffffffffff9f03,%rax
+  803138:	ff ff ff 
+  80313b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80313f:	ff d0                	call   *%rax
+		return 0;
+  803141:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  803146:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80314a:	c9                   	leave
+  80314b:	c3                   	ret
+
+000000000080314c <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  80314c:	55                   	push   %rbp
+  80314d:	48 89 e5             	mov    %rsp,%rbp
+  803150:	53                   	push   %rbx
+  803151:	48 83 ec 28          	sub    $0x28,%rsp
+  803155:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803155 <duphuge+0x9>
+  80315c:	49 bb eb 5e 00 00 00 	movabs $0x5eeb,%r11
+  803163:	00 00 00 
+  803166:	4c 01 db             	add    %r11,%rbx
+  803169:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80316c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  803170:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803174:	48 c1 e8 15          	shr    $0x15,%rax
+  803178:	48 89 c2             	mov    %rax,%rdx
+  80317b:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803182:	ff ff ff 
+  803185:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803189:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80318d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  803191:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803195:	25 00 04 00 00       	and    $0x400,%eax
+  80319a:	48 85 c0             	test   %rax,%rax
+  80319d:	74 0e                	je     8031ad <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  80319f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031a3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8031a8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031ab:	eb 1e                	jmp    8031cb <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  8031ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031b1:	25 02 08 00 00       	and    $0x802,%eax
+  8031b6:	48 85 c0             	test   %rax,%rax
+  8031b9:	74 09                	je     8031c4 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  8031bb:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  8031c2:	eb 07                	jmp    8031cb <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  8031c4:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  8031cb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8031ce:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8031d2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031d5:	48 89 ce             	mov    %rcx,%rsi
+  8031d8:	89 c7                	mov    %eax,%edi
+  8031da:	48 b8 03 9f ff ff ff 	movabs $0xffffffffffff9f03,%rax
+  8031e1:	ff ff ff 
+  8031e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031e8:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  8031ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031ed:	25 00 08 00 00       	and    $0x800,%eax
+  8031f2:	85 c0                	test   %eax,%eax
+  8031f4:	74 1f                	je     803215 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  8031f6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8031f9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031fd:	48 89 c6             	mov    %rax,%rsi
+  803200:	bf 00 00 00 00       	mov    $0x0,%edi
+  803205:	48 b8 03 9f ff ff ff 	movabs $0xffffffffffff9f03,%rax
+  80320c:	ff ff ff 
+  80320f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803213:	ff d0                	call   *%rax
+	return 0;
+  803215:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80321a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80321e:	c9                   	leave
+  80321f:	c3                   	ret
+
+0000000000803220 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  803220:	55                   	push   %rbp
+  803221:	48 89 e5             	mov    %rsp,%rbp
+  803224:	41 57                	push   %r15
+  803226:	53                   	push   %rbx
+  803227:	48 83 ec 10          	sub    $0x10,%rsp
+  80322b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80322b <fork+0xb>
+  803232:	49 bb 15 5e 00 00 00 	movabs $0x5e15,%r11
+  803239:	00 00 00 
+  80323c:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  80323f:	49 89 df             	mov    %rbx,%r15
+  803242:	48 b8 a6 99 ff ff ff 	movabs $0xffffffffffff99a6,%rax
+  803249:	ff ff ff 
+  80324c:	48 01 d8             	add    %rbx,%rax
+  80324f:	ff d0                	call   *%rax
+  803251:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803254:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803258:	75 42                	jne    80329c <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80325a:	49 89 df             	mov    %rbx,%r15
+  80325d:	48 b8 a8 91 ff ff ff 	movabs $0xffffffffffff91a8,%rax
+  803264:	ff ff ff 
+  803267:	48 01 d8             	add    %rbx,%rax
+  80326a:	ff d0                	call   *%rax
+  80326c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803271:	48 98                	cltq
+  803273:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80327a:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803281:	ff ff ff 
+  803284:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803288:	48 01 c2             	add    %rax,%rdx
+  80328b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803292:	ff ff ff 
+  803295:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803299:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  80329c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80329f:	48 83 c4 10          	add    $0x10,%rsp
+  8032a3:	5b                   	pop    %rbx
+  8032a4:	41 5f                	pop    %r15
+  8032a6:	5d                   	pop    %rbp
+  8032a7:	c3                   	ret
+
+00000000008032a8 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  8032a8:	55                   	push   %rbp
+  8032a9:	48 89 e5             	mov    %rsp,%rbp
+  8032ac:	41 57                	push   %r15
+  8032ae:	53                   	push   %rbx
+  8032af:	48 83 ec 10          	sub    $0x10,%rsp
+  8032b3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032b3 <ufork+0xb>
+  8032ba:	49 bb 8d 5d 00 00 00 	movabs $0x5d8d,%r11
+  8032c1:	00 00 00 
+  8032c4:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  8032c7:	48 b8 fa 99 ff ff ff 	movabs $0xffffffffffff99fa,%rax
+  8032ce:	ff ff ff 
+  8032d1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032d5:	48 89 c7             	mov    %rax,%rdi
+  8032d8:	49 89 df             	mov    %rbx,%r15
+  8032db:	48 b8 8f d4 ff ff ff 	movabs $0xffffffffffffd48f,%rax
+  8032e2:	ff ff ff 
+  8032e5:	48 01 d8             	add    %rbx,%rax
+  8032e8:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8032ea:	b8 07 00 00 00       	mov    $0x7,%eax
+  8032ef:	cd 30                	int    $0x30
+  8032f1:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  8032f4:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  8032f7:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  8032fa:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8032fe:	0f 84 03 02 00 00    	je     803507 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  803304:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80330b:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  80330c:	e9 28 01 00 00       	jmp    803439 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  803311:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803315:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803319:	48 89 c2             	mov    %rax,%rdx
+  80331c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803323:	ff ff ff 
+  803326:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80332a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80332e:	83 e0 01             	and    $0x1,%eax
+  803331:	48 85 c0             	test   %rax,%rax
+  803334:	0f 84 f7 00 00 00    	je     803431 <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  80333a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80333e:	48 c1 e8 15          	shr    $0x15,%rax
+  803342:	48 89 c2             	mov    %rax,%rdx
+  803345:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80334c:	ff ff ff 
+  80334f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803353:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803357:	25 81 00 00 00       	and    $0x81,%eax
+  80335c:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  803362:	75 29                	jne    80338d <ufork+0xe5>
+					duphuge(child_envid, addr);
+  803364:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803368:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80336b:	48 89 d6             	mov    %rdx,%rsi
+  80336e:	89 c7                	mov    %eax,%edi
+  803370:	48 b8 0c a1 ff ff ff 	movabs $0xffffffffffffa10c,%rax
+  803377:	ff ff ff 
+  80337a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80337e:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  803380:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803387:	00 
+  803388:	e9 ac 00 00 00       	jmp    803439 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  80338d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803391:	48 c1 e8 15          	shr    $0x15,%rax
+  803395:	48 89 c2             	mov    %rax,%rdx
+  803398:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80339f:	ff ff ff 
+  8033a2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033a6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033aa:	83 e0 01             	and    $0x1,%eax
+  8033ad:	48 85 c0             	test   %rax,%rax
+  8033b0:	74 75                	je     803427 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  8033b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033b6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8033ba:	48 89 c2             	mov    %rax,%rdx
+  8033bd:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8033c4:	ff ff ff 
+  8033c7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033cb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033cf:	83 e0 01             	and    $0x1,%eax
+  8033d2:	48 85 c0             	test   %rax,%rax
+  8033d5:	74 46                	je     80341d <ufork+0x175>
+  8033d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033db:	48 c1 e8 0c          	shr    $0xc,%rax
+  8033df:	48 89 c2             	mov    %rax,%rdx
+  8033e2:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8033e9:	ff ff ff 
+  8033ec:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033f0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033f4:	83 e0 04             	and    $0x4,%eax
+  8033f7:	48 85 c0             	test   %rax,%rax
+  8033fa:	74 21                	je     80341d <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  8033fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803400:	48 c1 e8 0c          	shr    $0xc,%rax
+  803404:	89 c2                	mov    %eax,%edx
+  803406:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803409:	89 d6                	mov    %edx,%esi
+  80340b:	89 c7                	mov    %eax,%edi
+  80340d:	48 b8 c9 9f ff ff ff 	movabs $0xffffffffffff9fc9,%rax
+  803414:	ff ff ff 
+  803417:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80341b:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  80341d:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  803424:	00 
+  803425:	eb 12                	jmp    803439 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803427:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  80342e:	00 
+  80342f:	eb 08                	jmp    803439 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  803431:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803438:	40 
+		for (; addr < USTACKTOP;){
+  803439:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  80343e:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  803442:	0f 83 c9 fe ff ff    	jae    803311 <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803448:	48 b8 30 9e ff ff ff 	movabs $0xffffffffffff9e30,%rax
+  80344f:	ff ff ff 
+  803452:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803456:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803458:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80345b:	ba 07 00 00 00       	mov    $0x7,%edx
+  803460:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  803465:	48 89 ce             	mov    %rcx,%rsi
+  803468:	89 c7                	mov    %eax,%edi
+  80346a:	49 89 df             	mov    %rbx,%r15
+  80346d:	48 b8 51 92 ff ff ff 	movabs $0xffffffffffff9251,%rax
+  803474:	ff ff ff 
+  803477:	48 01 d8             	add    %rbx,%rax
+  80347a:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  80347c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80347f:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  803486:	ff ff ff 
+  803489:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80348d:	48 89 d6             	mov    %rdx,%rsi
+  803490:	89 c7                	mov    %eax,%edi
+  803492:	49 89 df             	mov    %rbx,%r15
+  803495:	48 b8 47 94 ff ff ff 	movabs $0xffffffffffff9447,%rax
+  80349c:	ff ff ff 
+  80349f:	48 01 d8             	add    %rbx,%rax
+  8034a2:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  8034a4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8034a7:	be 02 00 00 00       	mov    $0x2,%esi
+  8034ac:	89 c7                	mov    %eax,%edi
+  8034ae:	49 89 df             	mov    %rbx,%r15
+  8034b1:	48 b8 88 93 ff ff ff 	movabs $0xffffffffffff9388,%rax
+  8034b8:	ff ff ff 
+  8034bb:	48 01 d8             	add    %rbx,%rax
+  8034be:	ff d0                	call   *%rax
+  8034c0:	85 c0                	test   %eax,%eax
+  8034c2:	74 3e                	je     803502 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  8034c4:	48 b8 a7 e4 ff ff ff 	movabs $0xffffffffffffe4a7,%rax
+  8034cb:	ff ff ff 
+  8034ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034d2:	48 89 c2             	mov    %rax,%rdx
+  8034d5:	be 07 01 00 00       	mov    $0x107,%esi
+  8034da:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  8034e1:	ff ff ff 
+  8034e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034e8:	48 89 c7             	mov    %rax,%rdi
+  8034eb:	49 89 df             	mov    %rbx,%r15
+  8034ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f3:	48 b9 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%rcx
+  8034fa:	ff ff ff 
+  8034fd:	48 01 d9             	add    %rbx,%rcx
+  803500:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  803502:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803505:	eb 59                	jmp    803560 <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803507:	49 89 df             	mov    %rbx,%r15
+  80350a:	48 b8 a8 91 ff ff ff 	movabs $0xffffffffffff91a8,%rax
+  803511:	ff ff ff 
+  803514:	48 01 d8             	add    %rbx,%rax
+  803517:	ff d0                	call   *%rax
+  803519:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80351e:	48 98                	cltq
+  803520:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803527:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80352e:	ff ff ff 
+  803531:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803535:	48 01 c2             	add    %rax,%rdx
+  803538:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80353f:	ff ff ff 
+  803542:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803546:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803549:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803550:	00 00 00 
+  803553:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  80355a:	00 
+		return 0;
+  80355b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  803560:	48 83 c4 10          	add    $0x10,%rsp
+  803564:	5b                   	pop    %rbx
+  803565:	41 5f                	pop    %r15
+  803567:	5d                   	pop    %rbp
+  803568:	c3                   	ret
+
+0000000000803569 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803569:	55                   	push   %rbp
+  80356a:	48 89 e5             	mov    %rsp,%rbp
+  80356d:	41 57                	push   %r15
+  80356f:	48 83 ec 08          	sub    $0x8,%rsp
+  803573:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803573 <sfork+0xa>
+  80357a:	49 bb cd 5a 00 00 00 	movabs $0x5acd,%r11
+  803581:	00 00 00 
+  803584:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  803587:	48 b8 c2 e4 ff ff ff 	movabs $0xffffffffffffe4c2,%rax
+  80358e:	ff ff ff 
+  803591:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803595:	48 89 c2             	mov    %rax,%rdx
+  803598:	be 1a 01 00 00       	mov    $0x11a,%esi
+  80359d:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  8035a4:	ff ff ff 
+  8035a7:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8035ab:	48 89 c7             	mov    %rax,%rdi
+  8035ae:	49 89 cf             	mov    %rcx,%r15
+  8035b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b6:	49 b8 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%r8
+  8035bd:	ff ff ff 
+  8035c0:	49 01 c8             	add    %rcx,%r8
+  8035c3:	41 ff d0             	call   *%r8
+
+00000000008035c6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  8035c6:	55                   	push   %rbp
+  8035c7:	48 89 e5             	mov    %rsp,%rbp
+  8035ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8035ce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8035ce <fd2num+0x8>
+  8035d5:	49 bb 72 5a 00 00 00 	movabs $0x5a72,%r11
+  8035dc:	00 00 00 
+  8035df:	4c 01 d8             	add    %r11,%rax
+  8035e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8035e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035ea:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8035f1:	ff ff ff 
+  8035f4:	48 01 d0             	add    %rdx,%rax
+  8035f7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8035fb:	c9                   	leave
+  8035fc:	c3                   	ret
+
+00000000008035fd <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8035fd:	55                   	push   %rbp
+  8035fe:	48 89 e5             	mov    %rsp,%rbp
+  803601:	48 83 ec 08          	sub    $0x8,%rsp
+  803605:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803605 <fd2data+0x8>
+  80360c:	49 bb 3b 5a 00 00 00 	movabs $0x5a3b,%r11
+  803613:	00 00 00 
+  803616:	4c 01 d8             	add    %r11,%rax
+  803619:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  80361d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803621:	48 89 d7             	mov    %rdx,%rdi
+  803624:	48 ba 86 a5 ff ff ff 	movabs $0xffffffffffffa586,%rdx
+  80362b:	ff ff ff 
+  80362e:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803632:	ff d0                	call   *%rax
+  803634:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80363a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80363e:	c9                   	leave
+  80363f:	c3                   	ret
+
+0000000000803640 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803640:	55                   	push   %rbp
+  803641:	48 89 e5             	mov    %rsp,%rbp
+  803644:	48 83 ec 18          	sub    $0x18,%rsp
+  803648:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803648 <fd_alloc+0x8>
+  80364f:	49 bb f8 59 00 00 00 	movabs $0x59f8,%r11
+  803656:	00 00 00 
+  803659:	4c 01 d8             	add    %r11,%rax
+  80365c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803660:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803667:	eb 75                	jmp    8036de <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803669:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80366c:	48 63 d2             	movslq %edx,%rdx
+  80366f:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803676:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80367a:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80367e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803682:	48 89 d1             	mov    %rdx,%rcx
+  803685:	48 c1 e9 15          	shr    $0x15,%rcx
+  803689:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803690:	ff ff ff 
+  803693:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803697:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80369b:	83 e2 01             	and    $0x1,%edx
+  80369e:	48 85 d2             	test   %rdx,%rdx
+  8036a1:	74 25                	je     8036c8 <fd_alloc+0x88>
+  8036a3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8036a7:	48 89 d1             	mov    %rdx,%rcx
+  8036aa:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8036ae:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8036b5:	ff ff ff 
+  8036b8:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8036bc:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8036c0:	83 e2 01             	and    $0x1,%edx
+  8036c3:	48 85 d2             	test   %rdx,%rdx
+  8036c6:	75 12                	jne    8036da <fd_alloc+0x9a>
+			*fd_store = fd;
+  8036c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036cc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8036d0:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8036d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d8:	eb 1a                	jmp    8036f4 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  8036da:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8036de:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8036e2:	7e 85                	jle    803669 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  8036e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036e8:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  8036ef:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  8036f4:	c9                   	leave
+  8036f5:	c3                   	ret
+
+00000000008036f6 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8036f6:	55                   	push   %rbp
+  8036f7:	48 89 e5             	mov    %rsp,%rbp
+  8036fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8036fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8036fe <fd_lookup+0x8>
+  803705:	49 bb 42 59 00 00 00 	movabs $0x5942,%r11
+  80370c:	00 00 00 
+  80370f:	4c 01 d8             	add    %r11,%rax
+  803712:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803715:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803719:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80371d:	78 06                	js     803725 <fd_lookup+0x2f>
+  80371f:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803723:	7e 07                	jle    80372c <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803725:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80372a:	eb 73                	jmp    80379f <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  80372c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80372f:	48 63 d2             	movslq %edx,%rdx
+  803732:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803739:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80373d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803741:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803745:	48 89 d1             	mov    %rdx,%rcx
+  803748:	48 c1 e9 15          	shr    $0x15,%rcx
+  80374c:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803753:	ff ff ff 
+  803756:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80375a:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80375e:	83 e2 01             	and    $0x1,%edx
+  803761:	48 85 d2             	test   %rdx,%rdx
+  803764:	74 22                	je     803788 <fd_lookup+0x92>
+  803766:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80376a:	48 c1 ea 0c          	shr    $0xc,%rdx
+  80376e:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  803775:	ff ff ff 
+  803778:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  80377c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803780:	83 e0 01             	and    $0x1,%eax
+  803783:	48 85 c0             	test   %rax,%rax
+  803786:	75 07                	jne    80378f <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803788:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80378d:	eb 10                	jmp    80379f <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  80378f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803793:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803797:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  80379a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80379f:	c9                   	leave
+  8037a0:	c3                   	ret
+
+00000000008037a1 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  8037a1:	55                   	push   %rbp
+  8037a2:	48 89 e5             	mov    %rsp,%rbp
+  8037a5:	41 57                	push   %r15
+  8037a7:	53                   	push   %rbx
+  8037a8:	48 83 ec 30          	sub    $0x30,%rsp
+  8037ac:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037ac <fd_close+0xb>
+  8037b3:	49 bb 94 58 00 00 00 	movabs $0x5894,%r11
+  8037ba:	00 00 00 
+  8037bd:	4c 01 db             	add    %r11,%rbx
+  8037c0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8037c4:	89 f0                	mov    %esi,%eax
+  8037c6:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8037c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037cd:	48 89 c7             	mov    %rax,%rdi
+  8037d0:	48 b8 86 a5 ff ff ff 	movabs $0xffffffffffffa586,%rax
+  8037d7:	ff ff ff 
+  8037da:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037de:	ff d0                	call   *%rax
+  8037e0:	89 c2                	mov    %eax,%edx
+  8037e2:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8037e6:	48 89 c6             	mov    %rax,%rsi
+  8037e9:	89 d7                	mov    %edx,%edi
+  8037eb:	48 b8 b6 a6 ff ff ff 	movabs $0xffffffffffffa6b6,%rax
+  8037f2:	ff ff ff 
+  8037f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037f9:	ff d0                	call   *%rax
+  8037fb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803802:	78 0a                	js     80380e <fd_close+0x6d>
+	    || fd != fd2)
+  803804:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803808:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  80380c:	74 12                	je     803820 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  80380e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803812:	74 05                	je     803819 <fd_close+0x78>
+  803814:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803817:	eb 7a                	jmp    803893 <fd_close+0xf2>
+  803819:	b8 00 00 00 00       	mov    $0x0,%eax
+  80381e:	eb 73                	jmp    803893 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803820:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803824:	8b 00                	mov    (%rax),%eax
+  803826:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80382a:	48 89 d6             	mov    %rdx,%rsi
+  80382d:	89 c7                	mov    %eax,%edi
+  80382f:	48 b8 5c a8 ff ff ff 	movabs $0xffffffffffffa85c,%rax
+  803836:	ff ff ff 
+  803839:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80383d:	ff d0                	call   *%rax
+  80383f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803842:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803846:	78 2a                	js     803872 <fd_close+0xd1>
+		if (dev->dev_close)
+  803848:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80384c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803850:	48 85 c0             	test   %rax,%rax
+  803853:	74 16                	je     80386b <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  803855:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803859:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80385d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803861:	48 89 c7             	mov    %rax,%rdi
+  803864:	ff d2                	call   *%rdx
+  803866:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803869:	eb 07                	jmp    803872 <fd_close+0xd1>
+		else
+			r = 0;
+  80386b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  803872:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803876:	48 89 c6             	mov    %rax,%rsi
+  803879:	bf 00 00 00 00       	mov    $0x0,%edi
+  80387e:	49 89 df             	mov    %rbx,%r15
+  803881:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  803888:	ff ff ff 
+  80388b:	48 01 d8             	add    %rbx,%rax
+  80388e:	ff d0                	call   *%rax
+	return r;
+  803890:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803893:	48 83 c4 30          	add    $0x30,%rsp
+  803897:	5b                   	pop    %rbx
+  803898:	41 5f                	pop    %r15
+  80389a:	5d                   	pop    %rbp
+  80389b:	c3                   	ret
+
+000000000080389c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80389c:	55                   	push   %rbp
+  80389d:	48 89 e5             	mov    %rsp,%rbp
+  8038a0:	41 57                	push   %r15
+  8038a2:	48 83 ec 28          	sub    $0x28,%rsp
+  8038a6:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8038a6 <dev_lookup+0xa>
+  8038ad:	49 bb 9a 57 00 00 00 	movabs $0x579a,%r11
+  8038b4:	00 00 00 
+  8038b7:	4c 01 d9             	add    %r11,%rcx
+  8038ba:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8038bd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8038c1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8038c8:	eb 45                	jmp    80390f <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  8038ca:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  8038d1:	00 00 00 
+  8038d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038d7:	48 98                	cltq
+  8038d9:	48 01 ca             	add    %rcx,%rdx
+  8038dc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8038e0:	8b 00                	mov    (%rax),%eax
+  8038e2:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  8038e5:	75 24                	jne    80390b <dev_lookup+0x6f>
+			*dev = devtab[i];
+  8038e7:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  8038ee:	00 00 00 
+  8038f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038f4:	48 98                	cltq
+  8038f6:	48 01 ca             	add    %rcx,%rdx
+  8038f9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8038fd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803901:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803904:	b8 00 00 00 00       	mov    $0x0,%eax
+  803909:	eb 74                	jmp    80397f <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  80390b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80390f:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803916:	00 00 00 
+  803919:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80391c:	48 98                	cltq
+  80391e:	48 01 ca             	add    %rcx,%rdx
+  803921:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803925:	48 85 c0             	test   %rax,%rax
+  803928:	75 a0                	jne    8038ca <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80392a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803931:	ff ff ff 
+  803934:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803938:	48 8b 00             	mov    (%rax),%rax
+  80393b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803941:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803944:	89 c6                	mov    %eax,%esi
+  803946:	48 b8 d8 e4 ff ff ff 	movabs $0xffffffffffffe4d8,%rax
+  80394d:	ff ff ff 
+  803950:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803954:	48 89 c7             	mov    %rax,%rdi
+  803957:	49 89 cf             	mov    %rcx,%r15
+  80395a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80395f:	49 b8 d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%r8
+  803966:	ff ff ff 
+  803969:	49 01 c8             	add    %rcx,%r8
+  80396c:	41 ff d0             	call   *%r8
+	*dev = 0;
+  80396f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803973:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  80397a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80397f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803983:	c9                   	leave
+  803984:	c3                   	ret
+
+0000000000803985 <close>:
+
+int
+close(int fdnum)
+{
+  803985:	55                   	push   %rbp
+  803986:	48 89 e5             	mov    %rsp,%rbp
+  803989:	53                   	push   %rbx
+  80398a:	48 83 ec 28          	sub    $0x28,%rsp
+  80398e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80398e <close+0x9>
+  803995:	49 bb b2 56 00 00 00 	movabs $0x56b2,%r11
+  80399c:	00 00 00 
+  80399f:	4c 01 db             	add    %r11,%rbx
+  8039a2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8039a5:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8039a9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039ac:	48 89 d6             	mov    %rdx,%rsi
+  8039af:	89 c7                	mov    %eax,%edi
+  8039b1:	48 b8 b6 a6 ff ff ff 	movabs $0xffffffffffffa6b6,%rax
+  8039b8:	ff ff ff 
+  8039bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039bf:	ff d0                	call   *%rax
+  8039c1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8039c4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039c8:	79 05                	jns    8039cf <close+0x4a>
+		return r;
+  8039ca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039cd:	eb 1c                	jmp    8039eb <close+0x66>
+	else
+		return fd_close(fd, 1);
+  8039cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8039d8:	48 89 c7             	mov    %rax,%rdi
+  8039db:	48 b8 61 a7 ff ff ff 	movabs $0xffffffffffffa761,%rax
+  8039e2:	ff ff ff 
+  8039e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039e9:	ff d0                	call   *%rax
+}
+  8039eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039ef:	c9                   	leave
+  8039f0:	c3                   	ret
+
+00000000008039f1 <close_all>:
+
+void
+close_all(void)
+{
+  8039f1:	55                   	push   %rbp
+  8039f2:	48 89 e5             	mov    %rsp,%rbp
+  8039f5:	53                   	push   %rbx
+  8039f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8039fa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039fa <close_all+0x9>
+  803a01:	49 bb 46 56 00 00 00 	movabs $0x5646,%r11
+  803a08:	00 00 00 
+  803a0b:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803a0e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803a15:	eb 19                	jmp    803a30 <close_all+0x3f>
+		close(i);
+  803a17:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a1a:	89 c7                	mov    %eax,%edi
+  803a1c:	48 b8 45 a9 ff ff ff 	movabs $0xffffffffffffa945,%rax
+  803a23:	ff ff ff 
+  803a26:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a2a:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803a2c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803a30:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803a34:	7e e1                	jle    803a17 <close_all+0x26>
+}
+  803a36:	90                   	nop
+  803a37:	90                   	nop
+  803a38:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a3c:	c9                   	leave
+  803a3d:	c3                   	ret
+
+0000000000803a3e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  803a3e:	55                   	push   %rbp
+  803a3f:	48 89 e5             	mov    %rsp,%rbp
+  803a42:	41 57                	push   %r15
+  803a44:	53                   	push   %rbx
+  803a45:	48 83 ec 40          	sub    $0x40,%rsp
+  803a49:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a49 <dup+0xb>
+  803a50:	49 bb f7 55 00 00 00 	movabs $0x55f7,%r11
+  803a57:	00 00 00 
+  803a5a:	4c 01 db             	add    %r11,%rbx
+  803a5d:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803a60:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803a63:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803a67:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803a6a:	48 89 d6             	mov    %rdx,%rsi
+  803a6d:	89 c7                	mov    %eax,%edi
+  803a6f:	48 b8 b6 a6 ff ff ff 	movabs $0xffffffffffffa6b6,%rax
+  803a76:	ff ff ff 
+  803a79:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a7d:	ff d0                	call   *%rax
+  803a7f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a82:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a86:	79 08                	jns    803a90 <dup+0x52>
+		return r;
+  803a88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a8b:	e9 a4 01 00 00       	jmp    803c34 <dup+0x1f6>
+	close(newfdnum);
+  803a90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a93:	89 c7                	mov    %eax,%edi
+  803a95:	48 b8 45 a9 ff ff ff 	movabs $0xffffffffffffa945,%rax
+  803a9c:	ff ff ff 
+  803a9f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803aa3:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803aa5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803aa8:	48 98                	cltq
+  803aaa:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803ab0:	48 c1 e0 0c          	shl    $0xc,%rax
+  803ab4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803ab8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803abc:	48 89 c7             	mov    %rax,%rdi
+  803abf:	48 b8 bd a5 ff ff ff 	movabs $0xffffffffffffa5bd,%rax
+  803ac6:	ff ff ff 
+  803ac9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803acd:	ff d0                	call   *%rax
+  803acf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803ad3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ad7:	48 89 c7             	mov    %rax,%rdi
+  803ada:	48 b8 bd a5 ff ff ff 	movabs $0xffffffffffffa5bd,%rax
+  803ae1:	ff ff ff 
+  803ae4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ae8:	ff d0                	call   *%rax
+  803aea:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  803aee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803af2:	48 c1 e8 15          	shr    $0x15,%rax
+  803af6:	48 89 c2             	mov    %rax,%rdx
+  803af9:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803b00:	ff ff ff 
+  803b03:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b07:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b0b:	83 e0 01             	and    $0x1,%eax
+  803b0e:	48 85 c0             	test   %rax,%rax
+  803b11:	74 7f                	je     803b92 <dup+0x154>
+  803b13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b17:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b1b:	48 89 c2             	mov    %rax,%rdx
+  803b1e:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803b25:	ff ff ff 
+  803b28:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b2c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b30:	83 e0 01             	and    $0x1,%eax
+  803b33:	48 85 c0             	test   %rax,%rax
+  803b36:	74 5a                	je     803b92 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803b38:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b3c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b40:	48 89 c2             	mov    %rax,%rdx
+  803b43:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803b4a:	ff ff ff 
+  803b4d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b51:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b55:	25 07 0e 00 00       	and    $0xe07,%eax
+  803b5a:	89 c1                	mov    %eax,%ecx
+  803b5c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803b60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b64:	41 89 c8             	mov    %ecx,%r8d
+  803b67:	48 89 d1             	mov    %rdx,%rcx
+  803b6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b6f:	48 89 c6             	mov    %rax,%rsi
+  803b72:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b77:	49 89 df             	mov    %rbx,%r15
+  803b7a:	48 b8 b6 92 ff ff ff 	movabs $0xffffffffffff92b6,%rax
+  803b81:	ff ff ff 
+  803b84:	48 01 d8             	add    %rbx,%rax
+  803b87:	ff d0                	call   *%rax
+  803b89:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b8c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b90:	78 5f                	js     803bf1 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803b92:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b96:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b9a:	48 89 c2             	mov    %rax,%rdx
+  803b9d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803ba4:	ff ff ff 
+  803ba7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803bab:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803baf:	25 07 0e 00 00       	and    $0xe07,%eax
+  803bb4:	89 c1                	mov    %eax,%ecx
+  803bb6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803bbe:	41 89 c8             	mov    %ecx,%r8d
+  803bc1:	48 89 d1             	mov    %rdx,%rcx
+  803bc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bc9:	48 89 c6             	mov    %rax,%rsi
+  803bcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bd1:	49 89 df             	mov    %rbx,%r15
+  803bd4:	48 b8 b6 92 ff ff ff 	movabs $0xffffffffffff92b6,%rax
+  803bdb:	ff ff ff 
+  803bde:	48 01 d8             	add    %rbx,%rax
+  803be1:	ff d0                	call   *%rax
+  803be3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803be6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803bea:	78 08                	js     803bf4 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803bec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bef:	eb 43                	jmp    803c34 <dup+0x1f6>
+			goto err;
+  803bf1:	90                   	nop
+  803bf2:	eb 01                	jmp    803bf5 <dup+0x1b7>
+		goto err;
+  803bf4:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803bf5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803bf9:	48 89 c6             	mov    %rax,%rsi
+  803bfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c01:	49 89 df             	mov    %rbx,%r15
+  803c04:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  803c0b:	ff ff ff 
+  803c0e:	48 01 d8             	add    %rbx,%rax
+  803c11:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803c13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c17:	48 89 c6             	mov    %rax,%rsi
+  803c1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c1f:	49 89 df             	mov    %rbx,%r15
+  803c22:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  803c29:	ff ff ff 
+  803c2c:	48 01 d8             	add    %rbx,%rax
+  803c2f:	ff d0                	call   *%rax
+	return r;
+  803c31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803c34:	48 83 c4 40          	add    $0x40,%rsp
+  803c38:	5b                   	pop    %rbx
+  803c39:	41 5f                	pop    %r15
+  803c3b:	5d                   	pop    %rbp
+  803c3c:	c3                   	ret
+
+0000000000803c3d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803c3d:	55                   	push   %rbp
+  803c3e:	48 89 e5             	mov    %rsp,%rbp
+  803c41:	41 57                	push   %r15
+  803c43:	53                   	push   %rbx
+  803c44:	48 83 ec 40          	sub    $0x40,%rsp
+  803c48:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c48 <read+0xb>
+  803c4f:	49 bb f8 53 00 00 00 	movabs $0x53f8,%r11
+  803c56:	00 00 00 
+  803c59:	4c 01 db             	add    %r11,%rbx
+  803c5c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803c5f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803c63:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803c67:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803c6b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803c6e:	48 89 d6             	mov    %rdx,%rsi
+  803c71:	89 c7                	mov    %eax,%edi
+  803c73:	48 b8 b6 a6 ff ff ff 	movabs $0xffffffffffffa6b6,%rax
+  803c7a:	ff ff ff 
+  803c7d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c81:	ff d0                	call   *%rax
+  803c83:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c86:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c8a:	78 28                	js     803cb4 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c90:	8b 00                	mov    (%rax),%eax
+  803c92:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803c96:	48 89 d6             	mov    %rdx,%rsi
+  803c99:	89 c7                	mov    %eax,%edi
+  803c9b:	48 b8 5c a8 ff ff ff 	movabs $0xffffffffffffa85c,%rax
+  803ca2:	ff ff ff 
+  803ca5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ca9:	ff d0                	call   *%rax
+  803cab:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803cae:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803cb2:	79 08                	jns    803cbc <read+0x7f>
+		return r;
+  803cb4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cb7:	e9 8b 00 00 00       	jmp    803d47 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803cbc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803cc0:	8b 40 08             	mov    0x8(%rax),%eax
+  803cc3:	83 e0 03             	and    $0x3,%eax
+  803cc6:	83 f8 01             	cmp    $0x1,%eax
+  803cc9:	75 4b                	jne    803d16 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803ccb:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803cd2:	ff ff ff 
+  803cd5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803cd9:	48 8b 00             	mov    (%rax),%rax
+  803cdc:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803ce2:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803ce5:	89 c6                	mov    %eax,%esi
+  803ce7:	48 b8 f7 e4 ff ff ff 	movabs $0xffffffffffffe4f7,%rax
+  803cee:	ff ff ff 
+  803cf1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cf5:	48 89 c7             	mov    %rax,%rdi
+  803cf8:	49 89 df             	mov    %rbx,%r15
+  803cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d00:	48 b9 d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rcx
+  803d07:	ff ff ff 
+  803d0a:	48 01 d9             	add    %rbx,%rcx
+  803d0d:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803d0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d14:	eb 31                	jmp    803d47 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803d16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d1a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803d1e:	48 85 c0             	test   %rax,%rax
+  803d21:	75 07                	jne    803d2a <read+0xed>
+		return -E_NOT_SUPP;
+  803d23:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803d28:	eb 1d                	jmp    803d47 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803d2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d2e:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803d32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d36:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803d3a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803d3e:	48 89 ce             	mov    %rcx,%rsi
+  803d41:	48 89 c7             	mov    %rax,%rdi
+  803d44:	41 ff d0             	call   *%r8
+}
+  803d47:	48 83 c4 40          	add    $0x40,%rsp
+  803d4b:	5b                   	pop    %rbx
+  803d4c:	41 5f                	pop    %r15
+  803d4e:	5d                   	pop    %rbp
+  803d4f:	c3                   	ret
+
+0000000000803d50 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803d50:	55                   	push   %rbp
+  803d51:	48 89 e5             	mov    %rsp,%rbp
+  803d54:	53                   	push   %rbx
+  803d55:	48 83 ec 38          	sub    $0x38,%rsp
+  803d59:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d59 <readn+0x9>
+  803d60:	49 bb e7 52 00 00 00 	movabs $0x52e7,%r11
+  803d67:	00 00 00 
+  803d6a:	4c 01 db             	add    %r11,%rbx
+  803d6d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803d70:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803d74:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803d78:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803d7f:	eb 4b                	jmp    803dcc <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803d81:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d84:	48 98                	cltq
+  803d86:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803d8a:	48 29 c2             	sub    %rax,%rdx
+  803d8d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d90:	48 63 c8             	movslq %eax,%rcx
+  803d93:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d97:	48 01 c1             	add    %rax,%rcx
+  803d9a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d9d:	48 89 ce             	mov    %rcx,%rsi
+  803da0:	89 c7                	mov    %eax,%edi
+  803da2:	48 b8 fd ab ff ff ff 	movabs $0xffffffffffffabfd,%rax
+  803da9:	ff ff ff 
+  803dac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803db0:	ff d0                	call   *%rax
+  803db2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803db5:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803db9:	79 05                	jns    803dc0 <readn+0x70>
+			return m;
+  803dbb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803dbe:	eb 1d                	jmp    803ddd <readn+0x8d>
+		if (m == 0)
+  803dc0:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803dc4:	74 13                	je     803dd9 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803dc6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803dc9:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803dcc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dcf:	48 98                	cltq
+  803dd1:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803dd5:	72 aa                	jb     803d81 <readn+0x31>
+  803dd7:	eb 01                	jmp    803dda <readn+0x8a>
+			break;
+  803dd9:	90                   	nop
+	}
+	return tot;
+  803dda:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803ddd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803de1:	c9                   	leave
+  803de2:	c3                   	ret
+
+0000000000803de3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803de3:	55                   	push   %rbp
+  803de4:	48 89 e5             	mov    %rsp,%rbp
+  803de7:	41 57                	push   %r15
+  803de9:	53                   	push   %rbx
+  803dea:	48 83 ec 40          	sub    $0x40,%rsp
+  803dee:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803dee <write+0xb>
+  803df5:	49 bb 52 52 00 00 00 	movabs $0x5252,%r11
+  803dfc:	00 00 00 
+  803dff:	4c 01 db             	add    %r11,%rbx
+  803e02:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803e05:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803e09:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803e0d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803e11:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803e14:	48 89 d6             	mov    %rdx,%rsi
+  803e17:	89 c7                	mov    %eax,%edi
+  803e19:	48 b8 b6 a6 ff ff ff 	movabs $0xffffffffffffa6b6,%rax
+  803e20:	ff ff ff 
+  803e23:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e27:	ff d0                	call   *%rax
+  803e29:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e2c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e30:	78 28                	js     803e5a <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803e32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e36:	8b 00                	mov    (%rax),%eax
+  803e38:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803e3c:	48 89 d6             	mov    %rdx,%rsi
+  803e3f:	89 c7                	mov    %eax,%edi
+  803e41:	48 b8 5c a8 ff ff ff 	movabs $0xffffffffffffa85c,%rax
+  803e48:	ff ff ff 
+  803e4b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e4f:	ff d0                	call   *%rax
+  803e51:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e54:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e58:	79 08                	jns    803e62 <write+0x7f>
+		return r;
+  803e5a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e5d:	e9 8a 00 00 00       	jmp    803eec <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803e62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e66:	8b 40 08             	mov    0x8(%rax),%eax
+  803e69:	83 e0 03             	and    $0x3,%eax
+  803e6c:	85 c0                	test   %eax,%eax
+  803e6e:	75 4b                	jne    803ebb <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803e70:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803e77:	ff ff ff 
+  803e7a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803e7e:	48 8b 00             	mov    (%rax),%rax
+  803e81:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803e87:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803e8a:	89 c6                	mov    %eax,%esi
+  803e8c:	48 b8 13 e5 ff ff ff 	movabs $0xffffffffffffe513,%rax
+  803e93:	ff ff ff 
+  803e96:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e9a:	48 89 c7             	mov    %rax,%rdi
+  803e9d:	49 89 df             	mov    %rbx,%r15
+  803ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea5:	48 b9 d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rcx
+  803eac:	ff ff ff 
+  803eaf:	48 01 d9             	add    %rbx,%rcx
+  803eb2:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803eb4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803eb9:	eb 31                	jmp    803eec <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803ebb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ebf:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803ec3:	48 85 c0             	test   %rax,%rax
+  803ec6:	75 07                	jne    803ecf <write+0xec>
+		return -E_NOT_SUPP;
+  803ec8:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803ecd:	eb 1d                	jmp    803eec <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803ecf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ed3:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803ed7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803edb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803edf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803ee3:	48 89 ce             	mov    %rcx,%rsi
+  803ee6:	48 89 c7             	mov    %rax,%rdi
+  803ee9:	41 ff d0             	call   *%r8
+}
+  803eec:	48 83 c4 40          	add    $0x40,%rsp
+  803ef0:	5b                   	pop    %rbx
+  803ef1:	41 5f                	pop    %r15
+  803ef3:	5d                   	pop    %rbp
+  803ef4:	c3                   	ret
+
+0000000000803ef5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803ef5:	55                   	push   %rbp
+  803ef6:	48 89 e5             	mov    %rsp,%rbp
+  803ef9:	48 83 ec 18          	sub    $0x18,%rsp
+  803efd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803efd <seek+0x8>
+  803f04:	49 bb 43 51 00 00 00 	movabs $0x5143,%r11
+  803f0b:	00 00 00 
+  803f0e:	4c 01 d8             	add    %r11,%rax
+  803f11:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803f14:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803f17:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803f1b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803f1e:	48 89 ce             	mov    %rcx,%rsi
+  803f21:	89 d7                	mov    %edx,%edi
+  803f23:	48 ba b6 a6 ff ff ff 	movabs $0xffffffffffffa6b6,%rdx
+  803f2a:	ff ff ff 
+  803f2d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803f31:	ff d0                	call   *%rax
+  803f33:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f36:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f3a:	79 05                	jns    803f41 <seek+0x4c>
+		return r;
+  803f3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f3f:	eb 0f                	jmp    803f50 <seek+0x5b>
+	fd->fd_offset = offset;
+  803f41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f45:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803f48:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803f4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f50:	c9                   	leave
+  803f51:	c3                   	ret
+
+0000000000803f52 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803f52:	55                   	push   %rbp
+  803f53:	48 89 e5             	mov    %rsp,%rbp
+  803f56:	41 57                	push   %r15
+  803f58:	53                   	push   %rbx
+  803f59:	48 83 ec 30          	sub    $0x30,%rsp
+  803f5d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f5d <ftruncate+0xb>
+  803f64:	49 bb e3 50 00 00 00 	movabs $0x50e3,%r11
+  803f6b:	00 00 00 
+  803f6e:	4c 01 db             	add    %r11,%rbx
+  803f71:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803f74:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803f77:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803f7b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803f7e:	48 89 d6             	mov    %rdx,%rsi
+  803f81:	89 c7                	mov    %eax,%edi
+  803f83:	48 b8 b6 a6 ff ff ff 	movabs $0xffffffffffffa6b6,%rax
+  803f8a:	ff ff ff 
+  803f8d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f91:	ff d0                	call   *%rax
+  803f93:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f96:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f9a:	78 28                	js     803fc4 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803f9c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fa0:	8b 00                	mov    (%rax),%eax
+  803fa2:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803fa6:	48 89 d6             	mov    %rdx,%rsi
+  803fa9:	89 c7                	mov    %eax,%edi
+  803fab:	48 b8 5c a8 ff ff ff 	movabs $0xffffffffffffa85c,%rax
+  803fb2:	ff ff ff 
+  803fb5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fb9:	ff d0                	call   *%rax
+  803fbb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803fbe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fc2:	79 08                	jns    803fcc <ftruncate+0x7a>
+		return r;
+  803fc4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fc7:	e9 83 00 00 00       	jmp    80404f <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803fcc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fd0:	8b 40 08             	mov    0x8(%rax),%eax
+  803fd3:	83 e0 03             	and    $0x3,%eax
+  803fd6:	85 c0                	test   %eax,%eax
+  803fd8:	75 4b                	jne    804025 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803fda:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803fe1:	ff ff ff 
+  803fe4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803fe8:	48 8b 00             	mov    (%rax),%rax
+  803feb:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803ff1:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803ff4:	89 c6                	mov    %eax,%esi
+  803ff6:	48 b8 30 e5 ff ff ff 	movabs $0xffffffffffffe530,%rax
+  803ffd:	ff ff ff 
+  804000:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804004:	48 89 c7             	mov    %rax,%rdi
+  804007:	49 89 df             	mov    %rbx,%r15
+  80400a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80400f:	48 b9 d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rcx
+  804016:	ff ff ff 
+  804019:	48 01 d9             	add    %rbx,%rcx
+  80401c:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80401e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804023:	eb 2a                	jmp    80404f <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  804025:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804029:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80402d:	48 85 c0             	test   %rax,%rax
+  804030:	75 07                	jne    804039 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  804032:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804037:	eb 16                	jmp    80404f <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  804039:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80403d:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  804041:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804045:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  804048:	89 d6                	mov    %edx,%esi
+  80404a:	48 89 c7             	mov    %rax,%rdi
+  80404d:	ff d1                	call   *%rcx
+}
+  80404f:	48 83 c4 30          	add    $0x30,%rsp
+  804053:	5b                   	pop    %rbx
+  804054:	41 5f                	pop    %r15
+  804056:	5d                   	pop    %rbp
+  804057:	c3                   	ret
+
+0000000000804058 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  804058:	55                   	push   %rbp
+  804059:	48 89 e5             	mov    %rsp,%rbp
+  80405c:	53                   	push   %rbx
+  80405d:	48 83 ec 38          	sub    $0x38,%rsp
+  804061:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804061 <fstat+0x9>
+  804068:	49 bb df 4f 00 00 00 	movabs $0x4fdf,%r11
+  80406f:	00 00 00 
+  804072:	4c 01 db             	add    %r11,%rbx
+  804075:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804078:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80407c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804080:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804083:	48 89 d6             	mov    %rdx,%rsi
+  804086:	89 c7                	mov    %eax,%edi
+  804088:	48 b8 b6 a6 ff ff ff 	movabs $0xffffffffffffa6b6,%rax
+  80408f:	ff ff ff 
+  804092:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804096:	ff d0                	call   *%rax
+  804098:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80409b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80409f:	78 28                	js     8040c9 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8040a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040a5:	8b 00                	mov    (%rax),%eax
+  8040a7:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8040ab:	48 89 d6             	mov    %rdx,%rsi
+  8040ae:	89 c7                	mov    %eax,%edi
+  8040b0:	48 b8 5c a8 ff ff ff 	movabs $0xffffffffffffa85c,%rax
+  8040b7:	ff ff ff 
+  8040ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040be:	ff d0                	call   *%rax
+  8040c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040c3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040c7:	79 05                	jns    8040ce <fstat+0x76>
+		return r;
+  8040c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040cc:	eb 5e                	jmp    80412c <fstat+0xd4>
+	if (!dev->dev_stat)
+  8040ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040d2:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8040d6:	48 85 c0             	test   %rax,%rax
+  8040d9:	75 07                	jne    8040e2 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8040db:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8040e0:	eb 4a                	jmp    80412c <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8040e2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040e6:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  8040e9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040ed:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8040f4:	00 00 00 
+	stat->st_isdir = 0;
+  8040f7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040fb:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804102:	00 00 00 
+	stat->st_dev = dev;
+  804105:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804109:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80410d:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  804114:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804118:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80411c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804120:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804124:	48 89 d6             	mov    %rdx,%rsi
+  804127:	48 89 c7             	mov    %rax,%rdi
+  80412a:	ff d1                	call   *%rcx
+}
+  80412c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804130:	c9                   	leave
+  804131:	c3                   	ret
+
+0000000000804132 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804132:	55                   	push   %rbp
+  804133:	48 89 e5             	mov    %rsp,%rbp
+  804136:	41 57                	push   %r15
+  804138:	53                   	push   %rbx
+  804139:	48 83 ec 20          	sub    $0x20,%rsp
+  80413d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80413d <stat+0xb>
+  804144:	49 bb 03 4f 00 00 00 	movabs $0x4f03,%r11
+  80414b:	00 00 00 
+  80414e:	4c 01 db             	add    %r11,%rbx
+  804151:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804155:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804159:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80415d:	be 00 00 00 00       	mov    $0x0,%esi
+  804162:	48 89 c7             	mov    %rax,%rdi
+  804165:	49 89 df             	mov    %rbx,%r15
+  804168:	48 b8 cc b3 ff ff ff 	movabs $0xffffffffffffb3cc,%rax
+  80416f:	ff ff ff 
+  804172:	48 01 d8             	add    %rbx,%rax
+  804175:	ff d0                	call   *%rax
+  804177:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80417a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80417e:	79 05                	jns    804185 <stat+0x53>
+		return fd;
+  804180:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804183:	eb 37                	jmp    8041bc <stat+0x8a>
+	r = fstat(fd, stat);
+  804185:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804189:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80418c:	48 89 d6             	mov    %rdx,%rsi
+  80418f:	89 c7                	mov    %eax,%edi
+  804191:	48 b8 18 b0 ff ff ff 	movabs $0xffffffffffffb018,%rax
+  804198:	ff ff ff 
+  80419b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80419f:	ff d0                	call   *%rax
+  8041a1:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8041a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041a7:	89 c7                	mov    %eax,%edi
+  8041a9:	48 b8 45 a9 ff ff ff 	movabs $0xffffffffffffa945,%rax
+  8041b0:	ff ff ff 
+  8041b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041b7:	ff d0                	call   *%rax
+	return r;
+  8041b9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8041bc:	48 83 c4 20          	add    $0x20,%rsp
+  8041c0:	5b                   	pop    %rbx
+  8041c1:	41 5f                	pop    %r15
+  8041c3:	5d                   	pop    %rbp
+  8041c4:	c3                   	ret
+
+00000000008041c5 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8041c5:	55                   	push   %rbp
+  8041c6:	48 89 e5             	mov    %rsp,%rbp
+  8041c9:	41 57                	push   %r15
+  8041cb:	53                   	push   %rbx
+  8041cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8041d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041d0 <fsipc+0xb>
+  8041d7:	49 bb 70 4e 00 00 00 	movabs $0x4e70,%r11
+  8041de:	00 00 00 
+  8041e1:	4c 01 db             	add    %r11,%rbx
+  8041e4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8041e7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  8041eb:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8041f2:	00 00 00 
+  8041f5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8041f8:	85 c0                	test   %eax,%eax
+  8041fa:	75 24                	jne    804220 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8041fc:	bf 01 00 00 00       	mov    $0x1,%edi
+  804201:	49 89 df             	mov    %rbx,%r15
+  804204:	48 b8 4e dd ff ff ff 	movabs $0xffffffffffffdd4e,%rax
+  80420b:	ff ff ff 
+  80420e:	48 01 d8             	add    %rbx,%rax
+  804211:	ff d0                	call   *%rax
+  804213:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  80421a:	00 00 00 
+  80421d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  804220:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804227:	00 00 00 
+  80422a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80422d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804231:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804234:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80423a:	49 89 d0             	mov    %rdx,%r8
+  80423d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804242:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804249:	00 00 00 
+  80424c:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804250:	89 c7                	mov    %eax,%edi
+  804252:	49 89 df             	mov    %rbx,%r15
+  804255:	48 b8 6d d7 ff ff ff 	movabs $0xffffffffffffd76d,%rax
+  80425c:	ff ff ff 
+  80425f:	48 01 d8             	add    %rbx,%rax
+  804262:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  804264:	48 83 c4 10          	add    $0x10,%rsp
+  804268:	5b                   	pop    %rbx
+  804269:	41 5f                	pop    %r15
+  80426b:	5d                   	pop    %rbp
+  80426c:	c3                   	ret
+
+000000000080426d <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  80426d:	55                   	push   %rbp
+  80426e:	48 89 e5             	mov    %rsp,%rbp
+  804271:	41 57                	push   %r15
+  804273:	53                   	push   %rbx
+  804274:	48 83 ec 20          	sub    $0x20,%rsp
+  804278:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804278 <fsipc_words+0xb>
+  80427f:	49 bb c8 4d 00 00 00 	movabs $0x4dc8,%r11
+  804286:	00 00 00 
+  804289:	4c 01 db             	add    %r11,%rbx
+  80428c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80428f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804293:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  804297:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80429e:	00 00 00 
+  8042a1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8042a4:	85 c0                	test   %eax,%eax
+  8042a6:	75 24                	jne    8042cc <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8042a8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8042ad:	49 89 df             	mov    %rbx,%r15
+  8042b0:	48 b8 4e dd ff ff ff 	movabs $0xffffffffffffdd4e,%rax
+  8042b7:	ff ff ff 
+  8042ba:	48 01 d8             	add    %rbx,%rax
+  8042bd:	ff d0                	call   *%rax
+  8042bf:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8042c6:	00 00 00 
+  8042c9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  8042cc:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8042d3:	00 00 00 
+  8042d6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8042d9:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8042dd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8042e1:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8042e4:	89 c7                	mov    %eax,%edi
+  8042e6:	49 89 df             	mov    %rbx,%r15
+  8042e9:	48 b8 58 d8 ff ff ff 	movabs $0xffffffffffffd858,%rax
+  8042f0:	ff ff ff 
+  8042f3:	48 01 d8             	add    %rbx,%rax
+  8042f6:	ff d0                	call   *%rax
+}
+  8042f8:	48 83 c4 20          	add    $0x20,%rsp
+  8042fc:	5b                   	pop    %rbx
+  8042fd:	41 5f                	pop    %r15
+  8042ff:	5d                   	pop    %rbp
+  804300:	c3                   	ret
+
+0000000000804301 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804301:	55                   	push   %rbp
+  804302:	48 89 e5             	mov    %rsp,%rbp
+  804305:	41 57                	push   %r15
+  804307:	53                   	push   %rbx
+  804308:	48 83 ec 40          	sub    $0x40,%rsp
+  80430c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80430c <fsipc_pages+0xb>
+  804313:	49 bb 34 4d 00 00 00 	movabs $0x4d34,%r11
+  80431a:	00 00 00 
+  80431d:	4c 01 db             	add    %r11,%rbx
+  804320:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804323:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804327:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  80432b:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  80432e:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804335:	00 00 00 
+  804338:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80433b:	85 c0                	test   %eax,%eax
+  80433d:	75 24                	jne    804363 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80433f:	bf 01 00 00 00       	mov    $0x1,%edi
+  804344:	49 89 df             	mov    %rbx,%r15
+  804347:	48 b8 4e dd ff ff ff 	movabs $0xffffffffffffdd4e,%rax
+  80434e:	ff ff ff 
+  804351:	48 01 d8             	add    %rbx,%rax
+  804354:	ff d0                	call   *%rax
+  804356:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  80435d:	00 00 00 
+  804360:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  804363:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804368:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  80436c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80436f:	48 98                	cltq
+  804371:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  804375:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804379:	0f 95 c0             	setne  %al
+  80437c:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  80437f:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804386:	00 
+  804387:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80438b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80438f:	48 01 d0             	add    %rdx,%rax
+  804392:	48 83 e8 01          	sub    $0x1,%rax
+  804396:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80439a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80439e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043a3:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8043a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043ab:	48 29 d0             	sub    %rdx,%rax
+  8043ae:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  8043b2:	41 89 c2             	mov    %eax,%r10d
+  8043b5:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8043bc:	00 00 00 
+  8043bf:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8043c2:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  8043c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8043ca:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8043cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8043d1:	6a 40                	push   $0x40
+  8043d3:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  8043d8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  8043df:	00 
+  8043e0:	6a 05                	push   $0x5
+  8043e2:	41 89 f9             	mov    %edi,%r9d
+  8043e5:	49 89 c8             	mov    %rcx,%r8
+  8043e8:	44 89 d1             	mov    %r10d,%ecx
+  8043eb:	89 c7                	mov    %eax,%edi
+  8043ed:	49 89 df             	mov    %rbx,%r15
+  8043f0:	48 b8 56 d9 ff ff ff 	movabs $0xffffffffffffd956,%rax
+  8043f7:	ff ff ff 
+  8043fa:	48 01 d8             	add    %rbx,%rax
+  8043fd:	ff d0                	call   *%rax
+  8043ff:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804403:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804407:	5b                   	pop    %rbx
+  804408:	41 5f                	pop    %r15
+  80440a:	5d                   	pop    %rbp
+  80440b:	c3                   	ret
+
+000000000080440c <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  80440c:	55                   	push   %rbp
+  80440d:	48 89 e5             	mov    %rsp,%rbp
+  804410:	41 57                	push   %r15
+  804412:	53                   	push   %rbx
+  804413:	48 83 ec 20          	sub    $0x20,%rsp
+  804417:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804417 <open+0xb>
+  80441e:	49 bb 29 4c 00 00 00 	movabs $0x4c29,%r11
+  804425:	00 00 00 
+  804428:	4c 01 db             	add    %r11,%rbx
+  80442b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80442f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804432:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804436:	48 89 c7             	mov    %rax,%rdi
+  804439:	49 89 df             	mov    %rbx,%r15
+  80443c:	48 b8 01 85 ff ff ff 	movabs $0xffffffffffff8501,%rax
+  804443:	ff ff ff 
+  804446:	48 01 d8             	add    %rbx,%rax
+  804449:	ff d0                	call   *%rax
+  80444b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804450:	7e 0a                	jle    80445c <open+0x50>
+		return -E_BAD_PATH;
+  804452:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804457:	e9 18 01 00 00       	jmp    804574 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  80445c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804460:	48 89 c7             	mov    %rax,%rdi
+  804463:	49 89 df             	mov    %rbx,%r15
+  804466:	48 b8 00 a6 ff ff ff 	movabs $0xffffffffffffa600,%rax
+  80446d:	ff ff ff 
+  804470:	48 01 d8             	add    %rbx,%rax
+  804473:	ff d0                	call   *%rax
+  804475:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804478:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80447c:	74 08                	je     804486 <open+0x7a>
+		return r;
+  80447e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804481:	e9 ee 00 00 00       	jmp    804574 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804486:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80448d:	00 00 00 
+  804490:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804493:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  80449a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80449e:	48 89 c6             	mov    %rax,%rsi
+  8044a1:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8044a8:	00 00 00 
+  8044ab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044af:	48 89 c7             	mov    %rax,%rdi
+  8044b2:	49 89 df             	mov    %rbx,%r15
+  8044b5:	48 b8 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rax
+  8044bc:	ff ff ff 
+  8044bf:	48 01 d8             	add    %rbx,%rax
+  8044c2:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  8044c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044c8:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  8044cd:	48 89 c6             	mov    %rax,%rsi
+  8044d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044d5:	49 89 df             	mov    %rbx,%r15
+  8044d8:	48 b8 51 92 ff ff ff 	movabs $0xffffffffffff9251,%rax
+  8044df:	ff ff ff 
+  8044e2:	48 01 d8             	add    %rbx,%rax
+  8044e5:	ff d0                	call   *%rax
+  8044e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044ee:	74 23                	je     804513 <open+0x107>
+		fd_close(fd,0);
+  8044f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8044f9:	48 89 c7             	mov    %rax,%rdi
+  8044fc:	49 89 df             	mov    %rbx,%r15
+  8044ff:	48 b8 61 a7 ff ff ff 	movabs $0xffffffffffffa761,%rax
+  804506:	ff ff ff 
+  804509:	48 01 d8             	add    %rbx,%rax
+  80450c:	ff d0                	call   *%rax
+		return r;
+  80450e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804511:	eb 61                	jmp    804574 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804513:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804517:	48 89 c6             	mov    %rax,%rsi
+  80451a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80451f:	48 b8 85 b1 ff ff ff 	movabs $0xffffffffffffb185,%rax
+  804526:	ff ff ff 
+  804529:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80452d:	ff d0                	call   *%rax
+  80452f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804532:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804536:	74 23                	je     80455b <open+0x14f>
+		fd_close(fd,0);
+  804538:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80453c:	be 00 00 00 00       	mov    $0x0,%esi
+  804541:	48 89 c7             	mov    %rax,%rdi
+  804544:	49 89 df             	mov    %rbx,%r15
+  804547:	48 b8 61 a7 ff ff ff 	movabs $0xffffffffffffa761,%rax
+  80454e:	ff ff ff 
+  804551:	48 01 d8             	add    %rbx,%rax
+  804554:	ff d0                	call   *%rax
+		return r;
+  804556:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804559:	eb 19                	jmp    804574 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  80455b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80455f:	48 89 c7             	mov    %rax,%rdi
+  804562:	49 89 df             	mov    %rbx,%r15
+  804565:	48 b8 86 a5 ff ff ff 	movabs $0xffffffffffffa586,%rax
+  80456c:	ff ff ff 
+  80456f:	48 01 d8             	add    %rbx,%rax
+  804572:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804574:	48 83 c4 20          	add    $0x20,%rsp
+  804578:	5b                   	pop    %rbx
+  804579:	41 5f                	pop    %r15
+  80457b:	5d                   	pop    %rbp
+  80457c:	c3                   	ret
+
+000000000080457d <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  80457d:	55                   	push   %rbp
+  80457e:	48 89 e5             	mov    %rsp,%rbp
+  804581:	48 83 ec 20          	sub    $0x20,%rsp
+  804585:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804585 <devfile_flush+0x8>
+  80458c:	49 bb bb 4a 00 00 00 	movabs $0x4abb,%r11
+  804593:	00 00 00 
+  804596:	4c 01 d8             	add    %r11,%rax
+  804599:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  80459d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8045a1:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8045a4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  8045a7:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8045ab:	ba 04 00 00 00       	mov    $0x4,%edx
+  8045b0:	48 89 ce             	mov    %rcx,%rsi
+  8045b3:	bf 06 00 00 00       	mov    $0x6,%edi
+  8045b8:	48 b9 2d b2 ff ff ff 	movabs $0xffffffffffffb22d,%rcx
+  8045bf:	ff ff ff 
+  8045c2:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8045c6:	ff d0                	call   *%rax
+}
+  8045c8:	c9                   	leave
+  8045c9:	c3                   	ret
+
+00000000008045ca <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  8045ca:	55                   	push   %rbp
+  8045cb:	48 89 e5             	mov    %rsp,%rbp
+  8045ce:	41 57                	push   %r15
+  8045d0:	53                   	push   %rbx
+  8045d1:	48 83 ec 60          	sub    $0x60,%rsp
+  8045d5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045d5 <devfile_read+0xb>
+  8045dc:	49 bb 6b 4a 00 00 00 	movabs $0x4a6b,%r11
+  8045e3:	00 00 00 
+  8045e6:	4c 01 db             	add    %r11,%rbx
+  8045e9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8045ed:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8045f1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  8045f5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8045f9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  8045fd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804601:	8b 50 0c             	mov    0xc(%rax),%edx
+  804604:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804608:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80460a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80460e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804612:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804616:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80461a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80461f:	ba 10 00 00 00       	mov    $0x10,%edx
+  804624:	48 89 c6             	mov    %rax,%rsi
+  804627:	bf 03 00 00 00       	mov    $0x3,%edi
+  80462c:	48 b8 c1 b2 ff ff ff 	movabs $0xffffffffffffb2c1,%rax
+  804633:	ff ff ff 
+  804636:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80463a:	ff d0                	call   *%rax
+  80463c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80463f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804643:	79 05                	jns    80464a <devfile_read+0x80>
+		return r;
+  804645:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804648:	eb 64                	jmp    8046ae <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  80464a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80464d:	48 63 d0             	movslq %eax,%rdx
+  804650:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804654:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804659:	48 01 c1             	add    %rax,%rcx
+  80465c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804660:	48 89 ce             	mov    %rcx,%rsi
+  804663:	48 89 c7             	mov    %rax,%rdi
+  804666:	49 89 df             	mov    %rbx,%r15
+  804669:	48 b8 75 89 ff ff ff 	movabs $0xffffffffffff8975,%rax
+  804670:	ff ff ff 
+  804673:	48 01 d8             	add    %rbx,%rax
+  804676:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804678:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80467f:	ff ff ff 
+  804682:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804686:	48 8b 00             	mov    (%rax),%rax
+  804689:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  80468f:	89 c6                	mov    %eax,%esi
+  804691:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804696:	48 89 c7             	mov    %rax,%rdi
+  804699:	49 89 df             	mov    %rbx,%r15
+  80469c:	48 b8 08 dd ff ff ff 	movabs $0xffffffffffffdd08,%rax
+  8046a3:	ff ff ff 
+  8046a6:	48 01 d8             	add    %rbx,%rax
+  8046a9:	ff d0                	call   *%rax
+	return r;
+  8046ab:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  8046ae:	48 83 c4 60          	add    $0x60,%rsp
+  8046b2:	5b                   	pop    %rbx
+  8046b3:	41 5f                	pop    %r15
+  8046b5:	5d                   	pop    %rbp
+  8046b6:	c3                   	ret
+
+00000000008046b7 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8046b7:	55                   	push   %rbp
+  8046b8:	48 89 e5             	mov    %rsp,%rbp
+  8046bb:	41 57                	push   %r15
+  8046bd:	53                   	push   %rbx
+  8046be:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  8046c2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046c2 <devfile_write+0xb>
+  8046c9:	49 bb 7e 49 00 00 00 	movabs $0x497e,%r11
+  8046d0:	00 00 00 
+  8046d3:	4c 01 db             	add    %r11,%rbx
+  8046d6:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  8046da:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  8046de:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  8046e5:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8046e9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  8046ed:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  8046f4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8046f8:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  8046ff:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804702:	48 63 d0             	movslq %eax,%rdx
+  804705:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804709:	48 39 c2             	cmp    %rax,%rdx
+  80470c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804710:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804717:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  80471e:	00 
+  80471f:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804726:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80472a:	48 01 d0             	add    %rdx,%rax
+  80472d:	48 83 e8 01          	sub    $0x1,%rax
+  804731:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804735:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804739:	ba 00 00 00 00       	mov    $0x0,%edx
+  80473e:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804742:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804746:	48 29 d0             	sub    %rdx,%rax
+  804749:	48 c1 e8 0c          	shr    $0xc,%rax
+  80474d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804750:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804753:	89 c6                	mov    %eax,%esi
+  804755:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80475a:	48 89 c7             	mov    %rax,%rdi
+  80475d:	49 89 df             	mov    %rbx,%r15
+  804760:	48 b8 c2 dc ff ff ff 	movabs $0xffffffffffffdcc2,%rax
+  804767:	ff ff ff 
+  80476a:	48 01 d8             	add    %rbx,%rax
+  80476d:	ff d0                	call   *%rax
+  80476f:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804772:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804776:	79 08                	jns    804780 <devfile_write+0xc9>
+		return r;
+  804778:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80477b:	e9 8f 00 00 00       	jmp    80480f <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804780:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804787:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  80478b:	48 89 c6             	mov    %rax,%rsi
+  80478e:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804793:	48 89 c7             	mov    %rax,%rdi
+  804796:	49 89 df             	mov    %rbx,%r15
+  804799:	48 b8 75 89 ff ff ff 	movabs $0xffffffffffff8975,%rax
+  8047a0:	ff ff ff 
+  8047a3:	48 01 d8             	add    %rbx,%rax
+  8047a6:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  8047a8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8047ac:	8b 50 0c             	mov    0xc(%rax),%edx
+  8047af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047b3:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8047b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047b9:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8047c0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  8047c4:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  8047c7:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8047cb:	89 d1                	mov    %edx,%ecx
+  8047cd:	ba 10 00 00 00       	mov    $0x10,%edx
+  8047d2:	48 89 c6             	mov    %rax,%rsi
+  8047d5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8047da:	48 b8 c1 b2 ff ff ff 	movabs $0xffffffffffffb2c1,%rax
+  8047e1:	ff ff ff 
+  8047e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047e8:	ff d0                	call   *%rax
+  8047ea:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  8047ed:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8047f0:	89 c6                	mov    %eax,%esi
+  8047f2:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8047f7:	48 89 c7             	mov    %rax,%rdi
+  8047fa:	49 89 df             	mov    %rbx,%r15
+  8047fd:	48 b8 08 dd ff ff ff 	movabs $0xffffffffffffdd08,%rax
+  804804:	ff ff ff 
+  804807:	48 01 d8             	add    %rbx,%rax
+  80480a:	ff d0                	call   *%rax
+	return r;
+  80480c:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  80480f:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804813:	5b                   	pop    %rbx
+  804814:	41 5f                	pop    %r15
+  804816:	5d                   	pop    %rbp
+  804817:	c3                   	ret
+
+0000000000804818 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804818:	55                   	push   %rbp
+  804819:	48 89 e5             	mov    %rsp,%rbp
+  80481c:	41 57                	push   %r15
+  80481e:	53                   	push   %rbx
+  80481f:	48 83 ec 20          	sub    $0x20,%rsp
+  804823:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804823 <devfile_stat+0xb>
+  80482a:	49 bb 1d 48 00 00 00 	movabs $0x481d,%r11
+  804831:	00 00 00 
+  804834:	4c 01 db             	add    %r11,%rbx
+  804837:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80483b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80483f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804843:	8b 40 0c             	mov    0xc(%rax),%eax
+  804846:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80484d:	00 00 00 
+  804850:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804853:	be 00 00 00 00       	mov    $0x0,%esi
+  804858:	bf 05 00 00 00       	mov    $0x5,%edi
+  80485d:	48 b8 85 b1 ff ff ff 	movabs $0xffffffffffffb185,%rax
+  804864:	ff ff ff 
+  804867:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80486b:	ff d0                	call   *%rax
+  80486d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804870:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804874:	79 05                	jns    80487b <devfile_stat+0x63>
+		return r;
+  804876:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804879:	eb 65                	jmp    8048e0 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80487b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80487f:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804886:	00 00 00 
+  804889:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80488d:	48 89 d6             	mov    %rdx,%rsi
+  804890:	48 89 c7             	mov    %rax,%rdi
+  804893:	49 89 df             	mov    %rbx,%r15
+  804896:	48 b8 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rax
+  80489d:	ff ff ff 
+  8048a0:	48 01 d8             	add    %rbx,%rax
+  8048a3:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8048a5:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8048ac:	00 00 00 
+  8048af:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  8048b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048ba:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8048c0:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8048c7:	00 00 00 
+  8048ca:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  8048d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048d5:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  8048db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048e0:	48 83 c4 20          	add    $0x20,%rsp
+  8048e4:	5b                   	pop    %rbx
+  8048e5:	41 5f                	pop    %r15
+  8048e7:	5d                   	pop    %rbp
+  8048e8:	c3                   	ret
+
+00000000008048e9 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8048e9:	55                   	push   %rbp
+  8048ea:	48 89 e5             	mov    %rsp,%rbp
+  8048ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8048f1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8048f1 <devfile_trunc+0x8>
+  8048f8:	49 bb 4f 47 00 00 00 	movabs $0x474f,%r11
+  8048ff:	00 00 00 
+  804902:	4c 01 d8             	add    %r11,%rax
+  804905:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804909:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  80490c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804910:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804913:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804916:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804919:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  80491c:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804920:	ba 08 00 00 00       	mov    $0x8,%edx
+  804925:	48 89 ce             	mov    %rcx,%rsi
+  804928:	bf 02 00 00 00       	mov    $0x2,%edi
+  80492d:	48 b9 2d b2 ff ff ff 	movabs $0xffffffffffffb22d,%rcx
+  804934:	ff ff ff 
+  804937:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80493b:	ff d0                	call   *%rax
+}
+  80493d:	c9                   	leave
+  80493e:	c3                   	ret
+
+000000000080493f <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80493f:	55                   	push   %rbp
+  804940:	48 89 e5             	mov    %rsp,%rbp
+  804943:	41 57                	push   %r15
+  804945:	53                   	push   %rbx
+  804946:	48 83 ec 10          	sub    $0x10,%rsp
+  80494a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80494a <remove+0xb>
+  804951:	49 bb f6 46 00 00 00 	movabs $0x46f6,%r11
+  804958:	00 00 00 
+  80495b:	4c 01 db             	add    %r11,%rbx
+  80495e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  804962:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804966:	48 89 c7             	mov    %rax,%rdi
+  804969:	49 89 df             	mov    %rbx,%r15
+  80496c:	48 b8 01 85 ff ff ff 	movabs $0xffffffffffff8501,%rax
+  804973:	ff ff ff 
+  804976:	48 01 d8             	add    %rbx,%rax
+  804979:	ff d0                	call   *%rax
+  80497b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804980:	7e 07                	jle    804989 <remove+0x4a>
+		return -E_BAD_PATH;
+  804982:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804987:	eb 44                	jmp    8049cd <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  804989:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80498d:	48 89 c6             	mov    %rax,%rsi
+  804990:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804997:	00 00 00 
+  80499a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80499e:	48 89 c7             	mov    %rax,%rdi
+  8049a1:	49 89 df             	mov    %rbx,%r15
+  8049a4:	48 b8 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rax
+  8049ab:	ff ff ff 
+  8049ae:	48 01 d8             	add    %rbx,%rax
+  8049b1:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  8049b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8049b8:	bf 07 00 00 00       	mov    $0x7,%edi
+  8049bd:	48 b8 85 b1 ff ff ff 	movabs $0xffffffffffffb185,%rax
+  8049c4:	ff ff ff 
+  8049c7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049cb:	ff d0                	call   *%rax
+}
+  8049cd:	48 83 c4 10          	add    $0x10,%rsp
+  8049d1:	5b                   	pop    %rbx
+  8049d2:	41 5f                	pop    %r15
+  8049d4:	5d                   	pop    %rbp
+  8049d5:	c3                   	ret
+
+00000000008049d6 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8049d6:	55                   	push   %rbp
+  8049d7:	48 89 e5             	mov    %rsp,%rbp
+  8049da:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8049da <sync+0x4>
+  8049e1:	49 bb 66 46 00 00 00 	movabs $0x4666,%r11
+  8049e8:	00 00 00 
+  8049eb:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  8049ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8049f8:	bf 08 00 00 00       	mov    $0x8,%edi
+  8049fd:	48 b9 2d b2 ff ff ff 	movabs $0xffffffffffffb22d,%rcx
+  804a04:	ff ff ff 
+  804a07:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804a0b:	ff d0                	call   *%rax
+}
+  804a0d:	5d                   	pop    %rbp
+  804a0e:	c3                   	ret
+
+0000000000804a0f <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  804a0f:	55                   	push   %rbp
+  804a10:	48 89 e5             	mov    %rsp,%rbp
+  804a13:	41 57                	push   %r15
+  804a15:	53                   	push   %rbx
+  804a16:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  804a1d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a1d <copy+0xe>
+  804a24:	49 bb 23 46 00 00 00 	movabs $0x4623,%r11
+  804a2b:	00 00 00 
+  804a2e:	4c 01 db             	add    %r11,%rbx
+  804a31:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804a38:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  804a3f:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  804a46:	be 00 00 00 00       	mov    $0x0,%esi
+  804a4b:	48 89 c7             	mov    %rax,%rdi
+  804a4e:	48 b8 cc b3 ff ff ff 	movabs $0xffffffffffffb3cc,%rax
+  804a55:	ff ff ff 
+  804a58:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a5c:	ff d0                	call   *%rax
+  804a5e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  804a61:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a65:	79 35                	jns    804a9c <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  804a67:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a6a:	89 c6                	mov    %eax,%esi
+  804a6c:	48 b8 56 e5 ff ff ff 	movabs $0xffffffffffffe556,%rax
+  804a73:	ff ff ff 
+  804a76:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a7a:	48 89 c7             	mov    %rax,%rdi
+  804a7d:	49 89 df             	mov    %rbx,%r15
+  804a80:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a85:	48 ba d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rdx
+  804a8c:	ff ff ff 
+  804a8f:	48 01 da             	add    %rbx,%rdx
+  804a92:	ff d2                	call   *%rdx
+		return fd_src;
+  804a94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a97:	e9 d7 01 00 00       	jmp    804c73 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  804a9c:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804aa3:	be 01 01 00 00       	mov    $0x101,%esi
+  804aa8:	48 89 c7             	mov    %rax,%rdi
+  804aab:	48 b8 cc b3 ff ff ff 	movabs $0xffffffffffffb3cc,%rax
+  804ab2:	ff ff ff 
+  804ab5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ab9:	ff d0                	call   *%rax
+  804abb:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  804abe:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804ac2:	0f 89 df 00 00 00    	jns    804ba7 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804ac8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804acb:	89 c6                	mov    %eax,%esi
+  804acd:	48 b8 6c e5 ff ff ff 	movabs $0xffffffffffffe56c,%rax
+  804ad4:	ff ff ff 
+  804ad7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804adb:	48 89 c7             	mov    %rax,%rdi
+  804ade:	49 89 df             	mov    %rbx,%r15
+  804ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae6:	48 ba d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rdx
+  804aed:	ff ff ff 
+  804af0:	48 01 da             	add    %rbx,%rdx
+  804af3:	ff d2                	call   *%rdx
+		close(fd_src);
+  804af5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804af8:	89 c7                	mov    %eax,%edi
+  804afa:	49 89 df             	mov    %rbx,%r15
+  804afd:	48 b8 45 a9 ff ff ff 	movabs $0xffffffffffffa945,%rax
+  804b04:	ff ff ff 
+  804b07:	48 01 d8             	add    %rbx,%rax
+  804b0a:	ff d0                	call   *%rax
+		return fd_dest;
+  804b0c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b0f:	e9 5f 01 00 00       	jmp    804c73 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804b14:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b17:	48 63 d0             	movslq %eax,%rdx
+  804b1a:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804b21:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b24:	48 89 ce             	mov    %rcx,%rsi
+  804b27:	89 c7                	mov    %eax,%edi
+  804b29:	49 89 df             	mov    %rbx,%r15
+  804b2c:	48 b8 a3 ad ff ff ff 	movabs $0xffffffffffffada3,%rax
+  804b33:	ff ff ff 
+  804b36:	48 01 d8             	add    %rbx,%rax
+  804b39:	ff d0                	call   *%rax
+  804b3b:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804b3e:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804b42:	79 63                	jns    804ba7 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804b44:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804b47:	89 c6                	mov    %eax,%esi
+  804b49:	48 b8 86 e5 ff ff ff 	movabs $0xffffffffffffe586,%rax
+  804b50:	ff ff ff 
+  804b53:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b57:	48 89 c7             	mov    %rax,%rdi
+  804b5a:	49 89 df             	mov    %rbx,%r15
+  804b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b62:	48 ba d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rdx
+  804b69:	ff ff ff 
+  804b6c:	48 01 da             	add    %rbx,%rdx
+  804b6f:	ff d2                	call   *%rdx
+			close(fd_src);
+  804b71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b74:	89 c7                	mov    %eax,%edi
+  804b76:	49 89 df             	mov    %rbx,%r15
+  804b79:	48 b8 45 a9 ff ff ff 	movabs $0xffffffffffffa945,%rax
+  804b80:	ff ff ff 
+  804b83:	48 01 d8             	add    %rbx,%rax
+  804b86:	ff d0                	call   *%rax
+			close(fd_dest);
+  804b88:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b8b:	89 c7                	mov    %eax,%edi
+  804b8d:	49 89 df             	mov    %rbx,%r15
+  804b90:	48 b8 45 a9 ff ff ff 	movabs $0xffffffffffffa945,%rax
+  804b97:	ff ff ff 
+  804b9a:	48 01 d8             	add    %rbx,%rax
+  804b9d:	ff d0                	call   *%rax
+			return write_size;
+  804b9f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804ba2:	e9 cc 00 00 00       	jmp    804c73 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804ba7:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804bae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bb1:	ba 00 02 00 00       	mov    $0x200,%edx
+  804bb6:	48 89 ce             	mov    %rcx,%rsi
+  804bb9:	89 c7                	mov    %eax,%edi
+  804bbb:	49 89 df             	mov    %rbx,%r15
+  804bbe:	48 b8 fd ab ff ff ff 	movabs $0xffffffffffffabfd,%rax
+  804bc5:	ff ff ff 
+  804bc8:	48 01 d8             	add    %rbx,%rax
+  804bcb:	ff d0                	call   *%rax
+  804bcd:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804bd0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804bd4:	0f 8f 3a ff ff ff    	jg     804b14 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804bda:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804bde:	79 60                	jns    804c40 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804be0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804be3:	89 c6                	mov    %eax,%esi
+  804be5:	48 b8 99 e5 ff ff ff 	movabs $0xffffffffffffe599,%rax
+  804bec:	ff ff ff 
+  804bef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bf3:	48 89 c7             	mov    %rax,%rdi
+  804bf6:	49 89 df             	mov    %rbx,%r15
+  804bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bfe:	48 ba d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%rdx
+  804c05:	ff ff ff 
+  804c08:	48 01 da             	add    %rbx,%rdx
+  804c0b:	ff d2                	call   *%rdx
+		close(fd_src);
+  804c0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c10:	89 c7                	mov    %eax,%edi
+  804c12:	49 89 df             	mov    %rbx,%r15
+  804c15:	48 b8 45 a9 ff ff ff 	movabs $0xffffffffffffa945,%rax
+  804c1c:	ff ff ff 
+  804c1f:	48 01 d8             	add    %rbx,%rax
+  804c22:	ff d0                	call   *%rax
+		close(fd_dest);
+  804c24:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c27:	89 c7                	mov    %eax,%edi
+  804c29:	49 89 df             	mov    %rbx,%r15
+  804c2c:	48 b8 45 a9 ff ff ff 	movabs $0xffffffffffffa945,%rax
+  804c33:	ff ff ff 
+  804c36:	48 01 d8             	add    %rbx,%rax
+  804c39:	ff d0                	call   *%rax
+		return read_size;
+  804c3b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804c3e:	eb 33                	jmp    804c73 <copy+0x264>
+	}
+	close(fd_src);
+  804c40:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c43:	89 c7                	mov    %eax,%edi
+  804c45:	49 89 df             	mov    %rbx,%r15
+  804c48:	48 b8 45 a9 ff ff ff 	movabs $0xffffffffffffa945,%rax
+  804c4f:	ff ff ff 
+  804c52:	48 01 d8             	add    %rbx,%rax
+  804c55:	ff d0                	call   *%rax
+	close(fd_dest);
+  804c57:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c5a:	89 c7                	mov    %eax,%edi
+  804c5c:	49 89 df             	mov    %rbx,%r15
+  804c5f:	48 b8 45 a9 ff ff ff 	movabs $0xffffffffffffa945,%rax
+  804c66:	ff ff ff 
+  804c69:	48 01 d8             	add    %rbx,%rax
+  804c6c:	ff d0                	call   *%rax
+	return 0;
+  804c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804c73:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804c7a:	5b                   	pop    %rbx
+  804c7b:	41 5f                	pop    %r15
+  804c7d:	5d                   	pop    %rbp
+  804c7e:	c3                   	ret
+
+0000000000804c7f <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804c7f:	55                   	push   %rbp
+  804c80:	48 89 e5             	mov    %rsp,%rbp
+  804c83:	41 57                	push   %r15
+  804c85:	53                   	push   %rbx
+  804c86:	48 83 ec 20          	sub    $0x20,%rsp
+  804c8a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c8a <fd2sockid+0xb>
+  804c91:	49 bb b6 43 00 00 00 	movabs $0x43b6,%r11
+  804c98:	00 00 00 
+  804c9b:	4c 01 db             	add    %r11,%rbx
+  804c9e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804ca1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804ca5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ca8:	48 89 d6             	mov    %rdx,%rsi
+  804cab:	89 c7                	mov    %eax,%edi
+  804cad:	49 89 df             	mov    %rbx,%r15
+  804cb0:	48 b8 b6 a6 ff ff ff 	movabs $0xffffffffffffa6b6,%rax
+  804cb7:	ff ff ff 
+  804cba:	48 01 d8             	add    %rbx,%rax
+  804cbd:	ff d0                	call   *%rax
+  804cbf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cc2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cc6:	79 05                	jns    804ccd <fd2sockid+0x4e>
+		return r;
+  804cc8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ccb:	eb 25                	jmp    804cf2 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804ccd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cd1:	8b 10                	mov    (%rax),%edx
+  804cd3:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  804cda:	00 00 00 
+  804cdd:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ce0:	39 c2                	cmp    %eax,%edx
+  804ce2:	74 07                	je     804ceb <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804ce4:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804ce9:	eb 07                	jmp    804cf2 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804ceb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cef:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804cf2:	48 83 c4 20          	add    $0x20,%rsp
+  804cf6:	5b                   	pop    %rbx
+  804cf7:	41 5f                	pop    %r15
+  804cf9:	5d                   	pop    %rbp
+  804cfa:	c3                   	ret
+
+0000000000804cfb <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804cfb:	55                   	push   %rbp
+  804cfc:	48 89 e5             	mov    %rsp,%rbp
+  804cff:	41 57                	push   %r15
+  804d01:	53                   	push   %rbx
+  804d02:	48 83 ec 20          	sub    $0x20,%rsp
+  804d06:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d06 <alloc_sockfd+0xb>
+  804d0d:	49 bb 3a 43 00 00 00 	movabs $0x433a,%r11
+  804d14:	00 00 00 
+  804d17:	4c 01 db             	add    %r11,%rbx
+  804d1a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804d1d:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804d21:	48 89 c7             	mov    %rax,%rdi
+  804d24:	49 89 df             	mov    %rbx,%r15
+  804d27:	48 b8 00 a6 ff ff ff 	movabs $0xffffffffffffa600,%rax
+  804d2e:	ff ff ff 
+  804d31:	48 01 d8             	add    %rbx,%rax
+  804d34:	ff d0                	call   *%rax
+  804d36:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d39:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d3d:	78 2c                	js     804d6b <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804d3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d43:	ba 07 04 00 00       	mov    $0x407,%edx
+  804d48:	48 89 c6             	mov    %rax,%rsi
+  804d4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d50:	49 89 df             	mov    %rbx,%r15
+  804d53:	48 b8 51 92 ff ff ff 	movabs $0xffffffffffff9251,%rax
+  804d5a:	ff ff ff 
+  804d5d:	48 01 d8             	add    %rbx,%rax
+  804d60:	ff d0                	call   *%rax
+  804d62:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d65:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d69:	79 1c                	jns    804d87 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804d6b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804d6e:	89 c7                	mov    %eax,%edi
+  804d70:	49 89 df             	mov    %rbx,%r15
+  804d73:	48 b8 af c4 ff ff ff 	movabs $0xffffffffffffc4af,%rax
+  804d7a:	ff ff ff 
+  804d7d:	48 01 d8             	add    %rbx,%rax
+  804d80:	ff d0                	call   *%rax
+		return r;
+  804d82:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d85:	eb 41                	jmp    804dc8 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804d87:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d8b:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  804d92:	00 00 00 
+  804d95:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804d98:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804d9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d9e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804da5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804da9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804dac:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804daf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804db3:	48 89 c7             	mov    %rax,%rdi
+  804db6:	49 89 df             	mov    %rbx,%r15
+  804db9:	48 b8 86 a5 ff ff ff 	movabs $0xffffffffffffa586,%rax
+  804dc0:	ff ff ff 
+  804dc3:	48 01 d8             	add    %rbx,%rax
+  804dc6:	ff d0                	call   *%rax
+}
+  804dc8:	48 83 c4 20          	add    $0x20,%rsp
+  804dcc:	5b                   	pop    %rbx
+  804dcd:	41 5f                	pop    %r15
+  804dcf:	5d                   	pop    %rbp
+  804dd0:	c3                   	ret
+
+0000000000804dd1 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804dd1:	55                   	push   %rbp
+  804dd2:	48 89 e5             	mov    %rsp,%rbp
+  804dd5:	41 57                	push   %r15
+  804dd7:	53                   	push   %rbx
+  804dd8:	48 83 ec 30          	sub    $0x30,%rsp
+  804ddc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ddc <accept+0xb>
+  804de3:	49 bb 64 42 00 00 00 	movabs $0x4264,%r11
+  804dea:	00 00 00 
+  804ded:	4c 01 db             	add    %r11,%rbx
+  804df0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804df3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804df7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804dfb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804dfe:	89 c7                	mov    %eax,%edi
+  804e00:	48 b8 3f bc ff ff ff 	movabs $0xffffffffffffbc3f,%rax
+  804e07:	ff ff ff 
+  804e0a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e0e:	ff d0                	call   *%rax
+  804e10:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e13:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e17:	79 05                	jns    804e1e <accept+0x4d>
+		return r;
+  804e19:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e1c:	eb 45                	jmp    804e63 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804e1e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804e22:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804e26:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e29:	48 89 ce             	mov    %rcx,%rsi
+  804e2c:	89 c7                	mov    %eax,%edi
+  804e2e:	49 89 df             	mov    %rbx,%r15
+  804e31:	48 b8 1d c3 ff ff ff 	movabs $0xffffffffffffc31d,%rax
+  804e38:	ff ff ff 
+  804e3b:	48 01 d8             	add    %rbx,%rax
+  804e3e:	ff d0                	call   *%rax
+  804e40:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e43:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e47:	79 05                	jns    804e4e <accept+0x7d>
+		return r;
+  804e49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e4c:	eb 15                	jmp    804e63 <accept+0x92>
+	return alloc_sockfd(r);
+  804e4e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e51:	89 c7                	mov    %eax,%edi
+  804e53:	48 b8 bb bc ff ff ff 	movabs $0xffffffffffffbcbb,%rax
+  804e5a:	ff ff ff 
+  804e5d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e61:	ff d0                	call   *%rax
+}
+  804e63:	48 83 c4 30          	add    $0x30,%rsp
+  804e67:	5b                   	pop    %rbx
+  804e68:	41 5f                	pop    %r15
+  804e6a:	5d                   	pop    %rbp
+  804e6b:	c3                   	ret
+
+0000000000804e6c <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804e6c:	55                   	push   %rbp
+  804e6d:	48 89 e5             	mov    %rsp,%rbp
+  804e70:	41 57                	push   %r15
+  804e72:	53                   	push   %rbx
+  804e73:	48 83 ec 20          	sub    $0x20,%rsp
+  804e77:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e77 <bind+0xb>
+  804e7e:	49 bb c9 41 00 00 00 	movabs $0x41c9,%r11
+  804e85:	00 00 00 
+  804e88:	4c 01 db             	add    %r11,%rbx
+  804e8b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804e8e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804e92:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804e95:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e98:	89 c7                	mov    %eax,%edi
+  804e9a:	48 b8 3f bc ff ff ff 	movabs $0xffffffffffffbc3f,%rax
+  804ea1:	ff ff ff 
+  804ea4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ea8:	ff d0                	call   *%rax
+  804eaa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ead:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804eb1:	79 05                	jns    804eb8 <bind+0x4c>
+		return r;
+  804eb3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804eb6:	eb 21                	jmp    804ed9 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804eb8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804ebb:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804ebf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ec2:	48 89 ce             	mov    %rcx,%rsi
+  804ec5:	89 c7                	mov    %eax,%edi
+  804ec7:	49 89 df             	mov    %rbx,%r15
+  804eca:	48 b8 c9 c3 ff ff ff 	movabs $0xffffffffffffc3c9,%rax
+  804ed1:	ff ff ff 
+  804ed4:	48 01 d8             	add    %rbx,%rax
+  804ed7:	ff d0                	call   *%rax
+}
+  804ed9:	48 83 c4 20          	add    $0x20,%rsp
+  804edd:	5b                   	pop    %rbx
+  804ede:	41 5f                	pop    %r15
+  804ee0:	5d                   	pop    %rbp
+  804ee1:	c3                   	ret
+
+0000000000804ee2 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804ee2:	55                   	push   %rbp
+  804ee3:	48 89 e5             	mov    %rsp,%rbp
+  804ee6:	41 57                	push   %r15
+  804ee8:	53                   	push   %rbx
+  804ee9:	48 83 ec 20          	sub    $0x20,%rsp
+  804eed:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804eed <shutdown+0xb>
+  804ef4:	49 bb 53 41 00 00 00 	movabs $0x4153,%r11
+  804efb:	00 00 00 
+  804efe:	4c 01 db             	add    %r11,%rbx
+  804f01:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804f04:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804f07:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f0a:	89 c7                	mov    %eax,%edi
+  804f0c:	48 b8 3f bc ff ff ff 	movabs $0xffffffffffffbc3f,%rax
+  804f13:	ff ff ff 
+  804f16:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f1a:	ff d0                	call   *%rax
+  804f1c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f1f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f23:	79 05                	jns    804f2a <shutdown+0x48>
+		return r;
+  804f25:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f28:	eb 1c                	jmp    804f46 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804f2a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804f2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f30:	89 d6                	mov    %edx,%esi
+  804f32:	89 c7                	mov    %eax,%edi
+  804f34:	49 89 df             	mov    %rbx,%r15
+  804f37:	48 b8 5e c4 ff ff ff 	movabs $0xffffffffffffc45e,%rax
+  804f3e:	ff ff ff 
+  804f41:	48 01 d8             	add    %rbx,%rax
+  804f44:	ff d0                	call   *%rax
+}
+  804f46:	48 83 c4 20          	add    $0x20,%rsp
+  804f4a:	5b                   	pop    %rbx
+  804f4b:	41 5f                	pop    %r15
+  804f4d:	5d                   	pop    %rbp
+  804f4e:	c3                   	ret
+
+0000000000804f4f <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804f4f:	55                   	push   %rbp
+  804f50:	48 89 e5             	mov    %rsp,%rbp
+  804f53:	41 57                	push   %r15
+  804f55:	53                   	push   %rbx
+  804f56:	48 83 ec 10          	sub    $0x10,%rsp
+  804f5a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f5a <devsock_close+0xb>
+  804f61:	49 bb e6 40 00 00 00 	movabs $0x40e6,%r11
+  804f68:	00 00 00 
+  804f6b:	4c 01 db             	add    %r11,%rbx
+  804f6e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804f72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f76:	48 89 c7             	mov    %rax,%rdi
+  804f79:	49 89 df             	mov    %rbx,%r15
+  804f7c:	48 b8 dd dd ff ff ff 	movabs $0xffffffffffffdddd,%rax
+  804f83:	ff ff ff 
+  804f86:	48 01 d8             	add    %rbx,%rax
+  804f89:	ff d0                	call   *%rax
+  804f8b:	83 f8 01             	cmp    $0x1,%eax
+  804f8e:	75 1d                	jne    804fad <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804f90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f94:	8b 40 0c             	mov    0xc(%rax),%eax
+  804f97:	89 c7                	mov    %eax,%edi
+  804f99:	49 89 df             	mov    %rbx,%r15
+  804f9c:	48 b8 af c4 ff ff ff 	movabs $0xffffffffffffc4af,%rax
+  804fa3:	ff ff ff 
+  804fa6:	48 01 d8             	add    %rbx,%rax
+  804fa9:	ff d0                	call   *%rax
+  804fab:	eb 05                	jmp    804fb2 <devsock_close+0x63>
+	else
+		return 0;
+  804fad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804fb2:	48 83 c4 10          	add    $0x10,%rsp
+  804fb6:	5b                   	pop    %rbx
+  804fb7:	41 5f                	pop    %r15
+  804fb9:	5d                   	pop    %rbp
+  804fba:	c3                   	ret
+
+0000000000804fbb <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804fbb:	55                   	push   %rbp
+  804fbc:	48 89 e5             	mov    %rsp,%rbp
+  804fbf:	41 57                	push   %r15
+  804fc1:	53                   	push   %rbx
+  804fc2:	48 83 ec 20          	sub    $0x20,%rsp
+  804fc6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804fc6 <connect+0xb>
+  804fcd:	49 bb 7a 40 00 00 00 	movabs $0x407a,%r11
+  804fd4:	00 00 00 
+  804fd7:	4c 01 db             	add    %r11,%rbx
+  804fda:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804fdd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804fe1:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804fe4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fe7:	89 c7                	mov    %eax,%edi
+  804fe9:	48 b8 3f bc ff ff ff 	movabs $0xffffffffffffbc3f,%rax
+  804ff0:	ff ff ff 
+  804ff3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ff7:	ff d0                	call   *%rax
+  804ff9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ffc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805000:	79 05                	jns    805007 <connect+0x4c>
+		return r;
+  805002:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805005:	eb 21                	jmp    805028 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  805007:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80500a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80500e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805011:	48 89 ce             	mov    %rcx,%rsi
+  805014:	89 c7                	mov    %eax,%edi
+  805016:	49 89 df             	mov    %rbx,%r15
+  805019:	48 b8 f7 c4 ff ff ff 	movabs $0xffffffffffffc4f7,%rax
+  805020:	ff ff ff 
+  805023:	48 01 d8             	add    %rbx,%rax
+  805026:	ff d0                	call   *%rax
+}
+  805028:	48 83 c4 20          	add    $0x20,%rsp
+  80502c:	5b                   	pop    %rbx
+  80502d:	41 5f                	pop    %r15
+  80502f:	5d                   	pop    %rbp
+  805030:	c3                   	ret
+
+0000000000805031 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  805031:	55                   	push   %rbp
+  805032:	48 89 e5             	mov    %rsp,%rbp
+  805035:	41 57                	push   %r15
+  805037:	53                   	push   %rbx
+  805038:	48 83 ec 20          	sub    $0x20,%rsp
+  80503c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80503c <listen+0xb>
+  805043:	49 bb 04 40 00 00 00 	movabs $0x4004,%r11
+  80504a:	00 00 00 
+  80504d:	4c 01 db             	add    %r11,%rbx
+  805050:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805053:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805056:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805059:	89 c7                	mov    %eax,%edi
+  80505b:	48 b8 3f bc ff ff ff 	movabs $0xffffffffffffbc3f,%rax
+  805062:	ff ff ff 
+  805065:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805069:	ff d0                	call   *%rax
+  80506b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80506e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805072:	79 05                	jns    805079 <listen+0x48>
+		return r;
+  805074:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805077:	eb 1c                	jmp    805095 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  805079:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80507c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80507f:	89 d6                	mov    %edx,%esi
+  805081:	89 c7                	mov    %eax,%edi
+  805083:	49 89 df             	mov    %rbx,%r15
+  805086:	48 b8 8c c5 ff ff ff 	movabs $0xffffffffffffc58c,%rax
+  80508d:	ff ff ff 
+  805090:	48 01 d8             	add    %rbx,%rax
+  805093:	ff d0                	call   *%rax
+}
+  805095:	48 83 c4 20          	add    $0x20,%rsp
+  805099:	5b                   	pop    %rbx
+  80509a:	41 5f                	pop    %r15
+  80509c:	5d                   	pop    %rbp
+  80509d:	c3                   	ret
+
+000000000080509e <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  80509e:	55                   	push   %rbp
+  80509f:	48 89 e5             	mov    %rsp,%rbp
+  8050a2:	41 57                	push   %r15
+  8050a4:	48 83 ec 28          	sub    $0x28,%rsp
+  8050a8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050a8 <devsock_read+0xa>
+  8050af:	49 bb 98 3f 00 00 00 	movabs $0x3f98,%r11
+  8050b6:	00 00 00 
+  8050b9:	4c 01 d8             	add    %r11,%rax
+  8050bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8050c0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8050c4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8050c8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8050cc:	41 89 d0             	mov    %edx,%r8d
+  8050cf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8050d3:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8050d6:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8050da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8050df:	44 89 c2             	mov    %r8d,%edx
+  8050e2:	49 89 c7             	mov    %rax,%r15
+  8050e5:	49 b8 dd c5 ff ff ff 	movabs $0xffffffffffffc5dd,%r8
+  8050ec:	ff ff ff 
+  8050ef:	49 01 c0             	add    %rax,%r8
+  8050f2:	41 ff d0             	call   *%r8
+}
+  8050f5:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8050f9:	c9                   	leave
+  8050fa:	c3                   	ret
+
+00000000008050fb <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8050fb:	55                   	push   %rbp
+  8050fc:	48 89 e5             	mov    %rsp,%rbp
+  8050ff:	41 57                	push   %r15
+  805101:	48 83 ec 28          	sub    $0x28,%rsp
+  805105:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805105 <devsock_write+0xa>
+  80510c:	49 bb 3b 3f 00 00 00 	movabs $0x3f3b,%r11
+  805113:	00 00 00 
+  805116:	4c 01 d8             	add    %r11,%rax
+  805119:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80511d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805121:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  805125:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805129:	41 89 d0             	mov    %edx,%r8d
+  80512c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805130:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805133:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805137:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80513c:	44 89 c2             	mov    %r8d,%edx
+  80513f:	49 89 c7             	mov    %rax,%r15
+  805142:	49 b8 fa c6 ff ff ff 	movabs $0xffffffffffffc6fa,%r8
+  805149:	ff ff ff 
+  80514c:	49 01 c0             	add    %rax,%r8
+  80514f:	41 ff d0             	call   *%r8
+}
+  805152:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805156:	c9                   	leave
+  805157:	c3                   	ret
+
+0000000000805158 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805158:	55                   	push   %rbp
+  805159:	48 89 e5             	mov    %rsp,%rbp
+  80515c:	41 57                	push   %r15
+  80515e:	48 83 ec 18          	sub    $0x18,%rsp
+  805162:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805162 <devsock_stat+0xa>
+  805169:	49 bb de 3e 00 00 00 	movabs $0x3ede,%r11
+  805170:	00 00 00 
+  805173:	4c 01 d8             	add    %r11,%rax
+  805176:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80517a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  80517e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805182:	48 b9 b4 e5 ff ff ff 	movabs $0xffffffffffffe5b4,%rcx
+  805189:	ff ff ff 
+  80518c:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805190:	48 89 ce             	mov    %rcx,%rsi
+  805193:	48 89 d7             	mov    %rdx,%rdi
+  805196:	49 89 c7             	mov    %rax,%r15
+  805199:	48 ba 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rdx
+  8051a0:	ff ff ff 
+  8051a3:	48 01 c2             	add    %rax,%rdx
+  8051a6:	ff d2                	call   *%rdx
+	return 0;
+  8051a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051ad:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8051b1:	c9                   	leave
+  8051b2:	c3                   	ret
+
+00000000008051b3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8051b3:	55                   	push   %rbp
+  8051b4:	48 89 e5             	mov    %rsp,%rbp
+  8051b7:	41 57                	push   %r15
+  8051b9:	53                   	push   %rbx
+  8051ba:	48 83 ec 20          	sub    $0x20,%rsp
+  8051be:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051be <socket+0xb>
+  8051c5:	49 bb 82 3e 00 00 00 	movabs $0x3e82,%r11
+  8051cc:	00 00 00 
+  8051cf:	4c 01 db             	add    %r11,%rbx
+  8051d2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8051d5:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8051d8:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8051db:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8051de:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8051e1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8051e4:	89 ce                	mov    %ecx,%esi
+  8051e6:	89 c7                	mov    %eax,%edi
+  8051e8:	49 89 df             	mov    %rbx,%r15
+  8051eb:	48 b8 d1 c8 ff ff ff 	movabs $0xffffffffffffc8d1,%rax
+  8051f2:	ff ff ff 
+  8051f5:	48 01 d8             	add    %rbx,%rax
+  8051f8:	ff d0                	call   *%rax
+  8051fa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805201:	79 05                	jns    805208 <socket+0x55>
+		return r;
+  805203:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805206:	eb 15                	jmp    80521d <socket+0x6a>
+	return alloc_sockfd(r);
+  805208:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80520b:	89 c7                	mov    %eax,%edi
+  80520d:	48 b8 bb bc ff ff ff 	movabs $0xffffffffffffbcbb,%rax
+  805214:	ff ff ff 
+  805217:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80521b:	ff d0                	call   *%rax
+}
+  80521d:	48 83 c4 20          	add    $0x20,%rsp
+  805221:	5b                   	pop    %rbx
+  805222:	41 5f                	pop    %r15
+  805224:	5d                   	pop    %rbp
+  805225:	c3                   	ret
+
+0000000000805226 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805226:	55                   	push   %rbp
+  805227:	48 89 e5             	mov    %rsp,%rbp
+  80522a:	41 57                	push   %r15
+  80522c:	53                   	push   %rbx
+  80522d:	48 83 ec 10          	sub    $0x10,%rsp
+  805231:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805231 <nsipc+0xb>
+  805238:	49 bb 0f 3e 00 00 00 	movabs $0x3e0f,%r11
+  80523f:	00 00 00 
+  805242:	4c 01 db             	add    %r11,%rbx
+  805245:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805248:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80524f:	00 00 00 
+  805252:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805255:	85 c0                	test   %eax,%eax
+  805257:	75 24                	jne    80527d <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805259:	bf 02 00 00 00       	mov    $0x2,%edi
+  80525e:	49 89 df             	mov    %rbx,%r15
+  805261:	48 b8 4e dd ff ff ff 	movabs $0xffffffffffffdd4e,%rax
+  805268:	ff ff ff 
+  80526b:	48 01 d8             	add    %rbx,%rax
+  80526e:	ff d0                	call   *%rax
+  805270:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805277:	00 00 00 
+  80527a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  80527d:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805284:	00 00 00 
+  805287:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80528a:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80528d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805293:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805299:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80529e:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8052a5:	00 00 00 
+  8052a8:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8052ac:	89 c7                	mov    %eax,%edi
+  8052ae:	49 89 df             	mov    %rbx,%r15
+  8052b1:	48 b8 6d d7 ff ff ff 	movabs $0xffffffffffffd76d,%rax
+  8052b8:	ff ff ff 
+  8052bb:	48 01 d8             	add    %rbx,%rax
+  8052be:	ff d0                	call   *%rax
+}
+  8052c0:	48 83 c4 10          	add    $0x10,%rsp
+  8052c4:	5b                   	pop    %rbx
+  8052c5:	41 5f                	pop    %r15
+  8052c7:	5d                   	pop    %rbp
+  8052c8:	c3                   	ret
+
+00000000008052c9 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  8052c9:	55                   	push   %rbp
+  8052ca:	48 89 e5             	mov    %rsp,%rbp
+  8052cd:	41 57                	push   %r15
+  8052cf:	53                   	push   %rbx
+  8052d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8052d4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052d4 <nsipc_words+0xb>
+  8052db:	49 bb 6c 3d 00 00 00 	movabs $0x3d6c,%r11
+  8052e2:	00 00 00 
+  8052e5:	4c 01 db             	add    %r11,%rbx
+  8052e8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8052eb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8052ef:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8052f3:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8052fa:	00 00 00 
+  8052fd:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805300:	85 c0                	test   %eax,%eax
+  805302:	75 24                	jne    805328 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805304:	bf 02 00 00 00       	mov    $0x2,%edi
+  805309:	49 89 df             	mov    %rbx,%r15
+  80530c:	48 b8 4e dd ff ff ff 	movabs $0xffffffffffffdd4e,%rax
+  805313:	ff ff ff 
+  805316:	48 01 d8             	add    %rbx,%rax
+  805319:	ff d0                	call   *%rax
+  80531b:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805322:	00 00 00 
+  805325:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805328:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80532f:	00 00 00 
+  805332:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805335:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805339:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80533d:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805340:	89 c7                	mov    %eax,%edi
+  805342:	49 89 df             	mov    %rbx,%r15
+  805345:	48 b8 58 d8 ff ff ff 	movabs $0xffffffffffffd858,%rax
+  80534c:	ff ff ff 
+  80534f:	48 01 d8             	add    %rbx,%rax
+  805352:	ff d0                	call   *%rax
+}
+  805354:	48 83 c4 20          	add    $0x20,%rsp
+  805358:	5b                   	pop    %rbx
+  805359:	41 5f                	pop    %r15
+  80535b:	5d                   	pop    %rbp
+  80535c:	c3                   	ret
+
+000000000080535d <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80535d:	55                   	push   %rbp
+  80535e:	48 89 e5             	mov    %rsp,%rbp
+  805361:	41 57                	push   %r15
+  805363:	53                   	push   %rbx
+  805364:	48 83 ec 30          	sub    $0x30,%rsp
+  805368:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805368 <nsipc_accept+0xb>
+  80536f:	49 bb d8 3c 00 00 00 	movabs $0x3cd8,%r11
+  805376:	00 00 00 
+  805379:	4c 01 db             	add    %r11,%rbx
+  80537c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80537f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805383:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805387:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80538e:	00 00 00 
+  805391:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805394:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805397:	bf 01 00 00 00       	mov    $0x1,%edi
+  80539c:	48 b8 e6 c1 ff ff ff 	movabs $0xffffffffffffc1e6,%rax
+  8053a3:	ff ff ff 
+  8053a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053aa:	ff d0                	call   *%rax
+  8053ac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053af:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053b3:	78 48                	js     8053fd <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  8053b5:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  8053bc:	00 00 00 
+  8053bf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053c3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8053c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053cb:	8b 40 10             	mov    0x10(%rax),%eax
+  8053ce:	89 c2                	mov    %eax,%edx
+  8053d0:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8053d4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053d8:	48 89 ce             	mov    %rcx,%rsi
+  8053db:	48 89 c7             	mov    %rax,%rdi
+  8053de:	49 89 df             	mov    %rbx,%r15
+  8053e1:	48 b8 75 89 ff ff ff 	movabs $0xffffffffffff8975,%rax
+  8053e8:	ff ff ff 
+  8053eb:	48 01 d8             	add    %rbx,%rax
+  8053ee:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8053f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053f4:	8b 50 10             	mov    0x10(%rax),%edx
+  8053f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8053fb:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8053fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805400:	48 83 c4 30          	add    $0x30,%rsp
+  805404:	5b                   	pop    %rbx
+  805405:	41 5f                	pop    %r15
+  805407:	5d                   	pop    %rbp
+  805408:	c3                   	ret
+
+0000000000805409 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805409:	55                   	push   %rbp
+  80540a:	48 89 e5             	mov    %rsp,%rbp
+  80540d:	41 57                	push   %r15
+  80540f:	53                   	push   %rbx
+  805410:	48 83 ec 10          	sub    $0x10,%rsp
+  805414:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805414 <nsipc_bind+0xb>
+  80541b:	49 bb 2c 3c 00 00 00 	movabs $0x3c2c,%r11
+  805422:	00 00 00 
+  805425:	4c 01 db             	add    %r11,%rbx
+  805428:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80542b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80542f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805432:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805439:	00 00 00 
+  80543c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80543f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805442:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805445:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805449:	48 89 c6             	mov    %rax,%rsi
+  80544c:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805453:	00 00 00 
+  805456:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80545a:	48 89 c7             	mov    %rax,%rdi
+  80545d:	49 89 df             	mov    %rbx,%r15
+  805460:	48 b8 75 89 ff ff ff 	movabs $0xffffffffffff8975,%rax
+  805467:	ff ff ff 
+  80546a:	48 01 d8             	add    %rbx,%rax
+  80546d:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  80546f:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805476:	00 00 00 
+  805479:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80547c:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805480:	bf 02 00 00 00       	mov    $0x2,%edi
+  805485:	48 b8 e6 c1 ff ff ff 	movabs $0xffffffffffffc1e6,%rax
+  80548c:	ff ff ff 
+  80548f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805493:	ff d0                	call   *%rax
+}
+  805495:	48 83 c4 10          	add    $0x10,%rsp
+  805499:	5b                   	pop    %rbx
+  80549a:	41 5f                	pop    %r15
+  80549c:	5d                   	pop    %rbp
+  80549d:	c3                   	ret
+
+000000000080549e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80549e:	55                   	push   %rbp
+  80549f:	48 89 e5             	mov    %rsp,%rbp
+  8054a2:	48 83 ec 20          	sub    $0x20,%rsp
+  8054a6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8054a6 <nsipc_shutdown+0x8>
+  8054ad:	49 bb 9a 3b 00 00 00 	movabs $0x3b9a,%r11
+  8054b4:	00 00 00 
+  8054b7:	4c 01 d8             	add    %r11,%rax
+  8054ba:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8054bd:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8054c0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8054c3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  8054c6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8054c9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  8054cc:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8054d0:	ba 08 00 00 00       	mov    $0x8,%edx
+  8054d5:	48 89 ce             	mov    %rcx,%rsi
+  8054d8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8054dd:	48 b9 89 c2 ff ff ff 	movabs $0xffffffffffffc289,%rcx
+  8054e4:	ff ff ff 
+  8054e7:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8054eb:	ff d0                	call   *%rax
+}
+  8054ed:	c9                   	leave
+  8054ee:	c3                   	ret
+
+00000000008054ef <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8054ef:	55                   	push   %rbp
+  8054f0:	48 89 e5             	mov    %rsp,%rbp
+  8054f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8054f7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8054f7 <nsipc_close+0x8>
+  8054fe:	49 bb 49 3b 00 00 00 	movabs $0x3b49,%r11
+  805505:	00 00 00 
+  805508:	4c 01 d8             	add    %r11,%rax
+  80550b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  80550e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805511:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805514:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805518:	ba 04 00 00 00       	mov    $0x4,%edx
+  80551d:	48 89 ce             	mov    %rcx,%rsi
+  805520:	bf 04 00 00 00       	mov    $0x4,%edi
+  805525:	48 b9 89 c2 ff ff ff 	movabs $0xffffffffffffc289,%rcx
+  80552c:	ff ff ff 
+  80552f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805533:	ff d0                	call   *%rax
+}
+  805535:	c9                   	leave
+  805536:	c3                   	ret
+
+0000000000805537 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805537:	55                   	push   %rbp
+  805538:	48 89 e5             	mov    %rsp,%rbp
+  80553b:	41 57                	push   %r15
+  80553d:	53                   	push   %rbx
+  80553e:	48 83 ec 10          	sub    $0x10,%rsp
+  805542:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805542 <nsipc_connect+0xb>
+  805549:	49 bb fe 3a 00 00 00 	movabs $0x3afe,%r11
+  805550:	00 00 00 
+  805553:	4c 01 db             	add    %r11,%rbx
+  805556:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805559:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80555d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805560:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805567:	00 00 00 
+  80556a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80556d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805570:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805573:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805577:	48 89 c6             	mov    %rax,%rsi
+  80557a:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805581:	00 00 00 
+  805584:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805588:	48 89 c7             	mov    %rax,%rdi
+  80558b:	49 89 df             	mov    %rbx,%r15
+  80558e:	48 b8 75 89 ff ff ff 	movabs $0xffffffffffff8975,%rax
+  805595:	ff ff ff 
+  805598:	48 01 d8             	add    %rbx,%rax
+  80559b:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  80559d:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8055a4:	00 00 00 
+  8055a7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8055aa:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8055ae:	bf 05 00 00 00       	mov    $0x5,%edi
+  8055b3:	48 b8 e6 c1 ff ff ff 	movabs $0xffffffffffffc1e6,%rax
+  8055ba:	ff ff ff 
+  8055bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055c1:	ff d0                	call   *%rax
+}
+  8055c3:	48 83 c4 10          	add    $0x10,%rsp
+  8055c7:	5b                   	pop    %rbx
+  8055c8:	41 5f                	pop    %r15
+  8055ca:	5d                   	pop    %rbp
+  8055cb:	c3                   	ret
+
+00000000008055cc <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8055cc:	55                   	push   %rbp
+  8055cd:	48 89 e5             	mov    %rsp,%rbp
+  8055d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8055d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8055d4 <nsipc_listen+0x8>
+  8055db:	49 bb 6c 3a 00 00 00 	movabs $0x3a6c,%r11
+  8055e2:	00 00 00 
+  8055e5:	4c 01 d8             	add    %r11,%rax
+  8055e8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8055eb:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  8055ee:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8055f1:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  8055f4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8055f7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  8055fa:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8055fe:	ba 08 00 00 00       	mov    $0x8,%edx
+  805603:	48 89 ce             	mov    %rcx,%rsi
+  805606:	bf 06 00 00 00       	mov    $0x6,%edi
+  80560b:	48 b9 89 c2 ff ff ff 	movabs $0xffffffffffffc289,%rcx
+  805612:	ff ff ff 
+  805615:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805619:	ff d0                	call   *%rax
+}
+  80561b:	c9                   	leave
+  80561c:	c3                   	ret
+
+000000000080561d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80561d:	55                   	push   %rbp
+  80561e:	48 89 e5             	mov    %rsp,%rbp
+  805621:	41 57                	push   %r15
+  805623:	53                   	push   %rbx
+  805624:	48 83 ec 30          	sub    $0x30,%rsp
+  805628:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805628 <nsipc_recv+0xb>
+  80562f:	49 bb 18 3a 00 00 00 	movabs $0x3a18,%r11
+  805636:	00 00 00 
+  805639:	4c 01 db             	add    %r11,%rbx
+  80563c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80563f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805643:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805646:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805649:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805650:	00 00 00 
+  805653:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805656:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805659:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805660:	00 00 00 
+  805663:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805666:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  80566a:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805671:	00 00 00 
+  805674:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805677:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80567b:	bf 07 00 00 00       	mov    $0x7,%edi
+  805680:	48 b8 e6 c1 ff ff ff 	movabs $0xffffffffffffc1e6,%rax
+  805687:	ff ff ff 
+  80568a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80568e:	ff d0                	call   *%rax
+  805690:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805693:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805697:	0f 88 91 00 00 00    	js     80572e <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  80569d:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8056a4:	7f 08                	jg     8056ae <nsipc_recv+0x91>
+  8056a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056a9:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8056ac:	7e 50                	jle    8056fe <nsipc_recv+0xe1>
+  8056ae:	48 b8 bb e5 ff ff ff 	movabs $0xffffffffffffe5bb,%rax
+  8056b5:	ff ff ff 
+  8056b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056bc:	48 89 c1             	mov    %rax,%rcx
+  8056bf:	48 b8 d0 e5 ff ff ff 	movabs $0xffffffffffffe5d0,%rax
+  8056c6:	ff ff ff 
+  8056c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056cd:	48 89 c2             	mov    %rax,%rdx
+  8056d0:	be 79 00 00 00       	mov    $0x79,%esi
+  8056d5:	48 b8 e5 e5 ff ff ff 	movabs $0xffffffffffffe5e5,%rax
+  8056dc:	ff ff ff 
+  8056df:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056e3:	48 89 c7             	mov    %rax,%rdi
+  8056e6:	49 89 df             	mov    %rbx,%r15
+  8056e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056ee:	49 b8 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%r8
+  8056f5:	ff ff ff 
+  8056f8:	49 01 d8             	add    %rbx,%r8
+  8056fb:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8056fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805701:	48 63 d0             	movslq %eax,%rdx
+  805704:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805708:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80570f:	00 00 00 
+  805712:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805716:	48 89 ce             	mov    %rcx,%rsi
+  805719:	48 89 c7             	mov    %rax,%rdi
+  80571c:	49 89 df             	mov    %rbx,%r15
+  80571f:	48 b8 75 89 ff ff ff 	movabs $0xffffffffffff8975,%rax
+  805726:	ff ff ff 
+  805729:	48 01 d8             	add    %rbx,%rax
+  80572c:	ff d0                	call   *%rax
+	}
+
+	return r;
+  80572e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805731:	48 83 c4 30          	add    $0x30,%rsp
+  805735:	5b                   	pop    %rbx
+  805736:	41 5f                	pop    %r15
+  805738:	5d                   	pop    %rbp
+  805739:	c3                   	ret
+
+000000000080573a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80573a:	55                   	push   %rbp
+  80573b:	48 89 e5             	mov    %rsp,%rbp
+  80573e:	41 57                	push   %r15
+  805740:	53                   	push   %rbx
+  805741:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805748:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805748 <nsipc_send+0xe>
+  80574f:	49 bb f8 38 00 00 00 	movabs $0x38f8,%r11
+  805756:	00 00 00 
+  805759:	4c 01 db             	add    %r11,%rbx
+  80575c:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805762:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805769:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  80576f:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805775:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805779:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  80577d:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805784:	00 00 00 
+  805787:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80578a:	85 c0                	test   %eax,%eax
+  80578c:	75 24                	jne    8057b2 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80578e:	bf 02 00 00 00       	mov    $0x2,%edi
+  805793:	49 89 df             	mov    %rbx,%r15
+  805796:	48 b8 4e dd ff ff ff 	movabs $0xffffffffffffdd4e,%rax
+  80579d:	ff ff ff 
+  8057a0:	48 01 d8             	add    %rbx,%rax
+  8057a3:	ff d0                	call   *%rax
+  8057a5:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8057ac:	00 00 00 
+  8057af:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8057b2:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8057b8:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8057bb:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  8057c2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8057c5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8057c8:	39 c2                	cmp    %eax,%edx
+  8057ca:	0f 4e c2             	cmovle %edx,%eax
+  8057cd:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  8057d3:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8057d9:	48 63 d0             	movslq %eax,%rdx
+  8057dc:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8057e3:	48 89 c6             	mov    %rax,%rsi
+  8057e6:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  8057ed:	00 00 00 
+  8057f0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057f4:	48 89 c7             	mov    %rax,%rdi
+  8057f7:	49 89 df             	mov    %rbx,%r15
+  8057fa:	48 b8 75 89 ff ff ff 	movabs $0xffffffffffff8975,%rax
+  805801:	ff ff ff 
+  805804:	48 01 d8             	add    %rbx,%rax
+  805807:	ff d0                	call   *%rax
+	req->req_s = s;
+  805809:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80580d:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805813:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805815:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805819:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  80581f:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805822:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805826:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  80582c:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  80582f:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805836:	00 00 00 
+  805839:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80583d:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805841:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805848:	00 
+  805849:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80584f:	48 63 d0             	movslq %eax,%rdx
+  805852:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805856:	48 01 d0             	add    %rdx,%rax
+  805859:	48 83 e8 01          	sub    $0x1,%rax
+  80585d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805861:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805865:	ba 00 00 00 00       	mov    $0x0,%edx
+  80586a:	48 f7 75 d8          	divq   -0x28(%rbp)
+  80586e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805872:	48 29 d0             	sub    %rdx,%rax
+  805875:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  80587b:	85 c0                	test   %eax,%eax
+  80587d:	0f 48 c2             	cmovs  %edx,%eax
+  805880:	c1 f8 0c             	sar    $0xc,%eax
+  805883:	48 98                	cltq
+  805885:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  805889:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80588d:	48 85 c0             	test   %rax,%rax
+  805890:	0f 95 c0             	setne  %al
+  805893:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  805896:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  80589d:	00 
+  80589e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8058a2:	48 83 c0 0b          	add    $0xb,%rax
+  8058a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8058aa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8058ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058b3:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8058b7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8058bb:	48 29 d0             	sub    %rdx,%rax
+  8058be:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8058c2:	89 c7                	mov    %eax,%edi
+  8058c4:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8058cb:	00 00 00 
+  8058ce:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8058d1:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  8058d5:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  8058d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8058dd:	6a 00                	push   $0x0
+  8058df:	6a 00                	push   $0x0
+  8058e1:	6a 05                	push   $0x5
+  8058e3:	41 89 f1             	mov    %esi,%r9d
+  8058e6:	49 89 c8             	mov    %rcx,%r8
+  8058e9:	89 f9                	mov    %edi,%ecx
+  8058eb:	be 08 00 00 00       	mov    $0x8,%esi
+  8058f0:	89 c7                	mov    %eax,%edi
+  8058f2:	49 89 df             	mov    %rbx,%r15
+  8058f5:	48 b8 56 d9 ff ff ff 	movabs $0xffffffffffffd956,%rax
+  8058fc:	ff ff ff 
+  8058ff:	48 01 d8             	add    %rbx,%rax
+  805902:	ff d0                	call   *%rax
+  805904:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805908:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80590c:	5b                   	pop    %rbx
+  80590d:	41 5f                	pop    %r15
+  80590f:	5d                   	pop    %rbp
+  805910:	c3                   	ret
+
+0000000000805911 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805911:	55                   	push   %rbp
+  805912:	48 89 e5             	mov    %rsp,%rbp
+  805915:	48 83 ec 10          	sub    $0x10,%rsp
+  805919:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805919 <nsipc_socket+0x8>
+  805920:	49 bb 27 37 00 00 00 	movabs $0x3727,%r11
+  805927:	00 00 00 
+  80592a:	4c 01 d8             	add    %r11,%rax
+  80592d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805930:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805933:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805936:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80593d:	00 00 00 
+  805940:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805943:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805946:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80594d:	00 00 00 
+  805950:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805953:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805957:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80595e:	00 00 00 
+  805961:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805964:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  805968:	bf 09 00 00 00       	mov    $0x9,%edi
+  80596d:	48 ba e6 c1 ff ff ff 	movabs $0xffffffffffffc1e6,%rdx
+  805974:	ff ff ff 
+  805977:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80597b:	ff d0                	call   *%rax
+}
+  80597d:	c9                   	leave
+  80597e:	c3                   	ret
+
+000000000080597f <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  80597f:	55                   	push   %rbp
+  805980:	48 89 e5             	mov    %rsp,%rbp
+  805983:	41 57                	push   %r15
+  805985:	53                   	push   %rbx
+  805986:	48 83 ec 30          	sub    $0x30,%rsp
+  80598a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80598a <pipe+0xb>
+  805991:	49 bb b6 36 00 00 00 	movabs $0x36b6,%r11
+  805998:	00 00 00 
+  80599b:	4c 01 db             	add    %r11,%rbx
+  80599e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8059a2:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8059a6:	48 89 c7             	mov    %rax,%rdi
+  8059a9:	49 89 df             	mov    %rbx,%r15
+  8059ac:	48 b8 00 a6 ff ff ff 	movabs $0xffffffffffffa600,%rax
+  8059b3:	ff ff ff 
+  8059b6:	48 01 d8             	add    %rbx,%rax
+  8059b9:	ff d0                	call   *%rax
+  8059bb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059be:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059c2:	0f 88 12 02 00 00    	js     805bda <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8059c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059cc:	ba 07 04 00 00       	mov    $0x407,%edx
+  8059d1:	48 89 c6             	mov    %rax,%rsi
+  8059d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059d9:	49 89 df             	mov    %rbx,%r15
+  8059dc:	48 b8 51 92 ff ff ff 	movabs $0xffffffffffff9251,%rax
+  8059e3:	ff ff ff 
+  8059e6:	48 01 d8             	add    %rbx,%rax
+  8059e9:	ff d0                	call   *%rax
+  8059eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059f2:	0f 88 e2 01 00 00    	js     805bda <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  8059f8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8059fc:	48 89 c7             	mov    %rax,%rdi
+  8059ff:	49 89 df             	mov    %rbx,%r15
+  805a02:	48 b8 00 a6 ff ff ff 	movabs $0xffffffffffffa600,%rax
+  805a09:	ff ff ff 
+  805a0c:	48 01 d8             	add    %rbx,%rax
+  805a0f:	ff d0                	call   *%rax
+  805a11:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a14:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a18:	0f 88 9b 01 00 00    	js     805bb9 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805a1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a22:	ba 07 04 00 00       	mov    $0x407,%edx
+  805a27:	48 89 c6             	mov    %rax,%rsi
+  805a2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a2f:	49 89 df             	mov    %rbx,%r15
+  805a32:	48 b8 51 92 ff ff ff 	movabs $0xffffffffffff9251,%rax
+  805a39:	ff ff ff 
+  805a3c:	48 01 d8             	add    %rbx,%rax
+  805a3f:	ff d0                	call   *%rax
+  805a41:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a44:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a48:	0f 88 6b 01 00 00    	js     805bb9 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  805a4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a52:	48 89 c7             	mov    %rax,%rdi
+  805a55:	49 89 df             	mov    %rbx,%r15
+  805a58:	48 b8 bd a5 ff ff ff 	movabs $0xffffffffffffa5bd,%rax
+  805a5f:	ff ff ff 
+  805a62:	48 01 d8             	add    %rbx,%rax
+  805a65:	ff d0                	call   *%rax
+  805a67:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805a6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a6f:	ba 07 04 00 00       	mov    $0x407,%edx
+  805a74:	48 89 c6             	mov    %rax,%rsi
+  805a77:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a7c:	49 89 df             	mov    %rbx,%r15
+  805a7f:	48 b8 51 92 ff ff ff 	movabs $0xffffffffffff9251,%rax
+  805a86:	ff ff ff 
+  805a89:	48 01 d8             	add    %rbx,%rax
+  805a8c:	ff d0                	call   *%rax
+  805a8e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a91:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a95:	0f 88 fd 00 00 00    	js     805b98 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805a9b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a9f:	48 89 c7             	mov    %rax,%rdi
+  805aa2:	49 89 df             	mov    %rbx,%r15
+  805aa5:	48 b8 bd a5 ff ff ff 	movabs $0xffffffffffffa5bd,%rax
+  805aac:	ff ff ff 
+  805aaf:	48 01 d8             	add    %rbx,%rax
+  805ab2:	ff d0                	call   *%rax
+  805ab4:	48 89 c2             	mov    %rax,%rdx
+  805ab7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805abb:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805ac1:	48 89 d1             	mov    %rdx,%rcx
+  805ac4:	ba 00 00 00 00       	mov    $0x0,%edx
+  805ac9:	48 89 c6             	mov    %rax,%rsi
+  805acc:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ad1:	49 89 df             	mov    %rbx,%r15
+  805ad4:	48 b8 b6 92 ff ff ff 	movabs $0xffffffffffff92b6,%rax
+  805adb:	ff ff ff 
+  805ade:	48 01 d8             	add    %rbx,%rax
+  805ae1:	ff d0                	call   *%rax
+  805ae3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ae6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805aea:	0f 88 87 00 00 00    	js     805b77 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805af0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805af4:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805afb:	00 00 00 
+  805afe:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805b01:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805b03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b07:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805b0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b12:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805b19:	00 00 00 
+  805b1c:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805b1f:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805b21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b25:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805b2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b30:	48 89 c7             	mov    %rax,%rdi
+  805b33:	49 89 df             	mov    %rbx,%r15
+  805b36:	48 b8 86 a5 ff ff ff 	movabs $0xffffffffffffa586,%rax
+  805b3d:	ff ff ff 
+  805b40:	48 01 d8             	add    %rbx,%rax
+  805b43:	ff d0                	call   *%rax
+  805b45:	89 c2                	mov    %eax,%edx
+  805b47:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b4b:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805b4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b51:	48 89 c7             	mov    %rax,%rdi
+  805b54:	49 89 df             	mov    %rbx,%r15
+  805b57:	48 b8 86 a5 ff ff ff 	movabs $0xffffffffffffa586,%rax
+  805b5e:	ff ff ff 
+  805b61:	48 01 d8             	add    %rbx,%rax
+  805b64:	ff d0                	call   *%rax
+  805b66:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805b6a:	48 83 c2 04          	add    $0x4,%rdx
+  805b6e:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805b70:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b75:	eb 67                	jmp    805bde <pipe+0x25f>
+		goto err3;
+  805b77:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  805b78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b7c:	48 89 c6             	mov    %rax,%rsi
+  805b7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b84:	49 89 df             	mov    %rbx,%r15
+  805b87:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  805b8e:	ff ff ff 
+  805b91:	48 01 d8             	add    %rbx,%rax
+  805b94:	ff d0                	call   *%rax
+  805b96:	eb 01                	jmp    805b99 <pipe+0x21a>
+		goto err2;
+  805b98:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  805b99:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b9d:	48 89 c6             	mov    %rax,%rsi
+  805ba0:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ba5:	49 89 df             	mov    %rbx,%r15
+  805ba8:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  805baf:	ff ff ff 
+  805bb2:	48 01 d8             	add    %rbx,%rax
+  805bb5:	ff d0                	call   *%rax
+  805bb7:	eb 01                	jmp    805bba <pipe+0x23b>
+		goto err1;
+  805bb9:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805bba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805bbe:	48 89 c6             	mov    %rax,%rsi
+  805bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  805bc6:	49 89 df             	mov    %rbx,%r15
+  805bc9:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  805bd0:	ff ff ff 
+  805bd3:	48 01 d8             	add    %rbx,%rax
+  805bd6:	ff d0                	call   *%rax
+  805bd8:	eb 01                	jmp    805bdb <pipe+0x25c>
+		goto err;
+  805bda:	90                   	nop
+err:
+	return r;
+  805bdb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805bde:	48 83 c4 30          	add    $0x30,%rsp
+  805be2:	5b                   	pop    %rbx
+  805be3:	41 5f                	pop    %r15
+  805be5:	5d                   	pop    %rbp
+  805be6:	c3                   	ret
+
+0000000000805be7 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805be7:	55                   	push   %rbp
+  805be8:	48 89 e5             	mov    %rsp,%rbp
+  805beb:	41 57                	push   %r15
+  805bed:	41 54                	push   %r12
+  805bef:	53                   	push   %rbx
+  805bf0:	48 83 ec 28          	sub    $0x28,%rsp
+  805bf4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bf4 <_pipeisclosed+0xd>
+  805bfb:	49 bb 4c 34 00 00 00 	movabs $0x344c,%r11
+  805c02:	00 00 00 
+  805c05:	4c 01 db             	add    %r11,%rbx
+  805c08:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805c0c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805c10:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805c17:	ff ff ff 
+  805c1a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c1e:	48 8b 00             	mov    (%rax),%rax
+  805c21:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805c27:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805c2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805c2e:	48 89 c7             	mov    %rax,%rdi
+  805c31:	49 89 df             	mov    %rbx,%r15
+  805c34:	48 b8 dd dd ff ff ff 	movabs $0xffffffffffffdddd,%rax
+  805c3b:	ff ff ff 
+  805c3e:	48 01 d8             	add    %rbx,%rax
+  805c41:	ff d0                	call   *%rax
+  805c43:	41 89 c4             	mov    %eax,%r12d
+  805c46:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805c4a:	48 89 c7             	mov    %rax,%rdi
+  805c4d:	49 89 df             	mov    %rbx,%r15
+  805c50:	48 b8 dd dd ff ff ff 	movabs $0xffffffffffffdddd,%rax
+  805c57:	ff ff ff 
+  805c5a:	48 01 d8             	add    %rbx,%rax
+  805c5d:	ff d0                	call   *%rax
+  805c5f:	41 39 c4             	cmp    %eax,%r12d
+  805c62:	0f 94 c0             	sete   %al
+  805c65:	0f b6 c0             	movzbl %al,%eax
+  805c68:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805c6b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805c72:	ff ff ff 
+  805c75:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c79:	48 8b 00             	mov    (%rax),%rax
+  805c7c:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805c82:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805c85:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c88:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805c8b:	75 05                	jne    805c92 <_pipeisclosed+0xab>
+			return ret;
+  805c8d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805c90:	eb 63                	jmp    805cf5 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805c92:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c95:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805c98:	0f 84 72 ff ff ff    	je     805c10 <_pipeisclosed+0x29>
+  805c9e:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805ca2:	0f 85 68 ff ff ff    	jne    805c10 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805ca8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805caf:	ff ff ff 
+  805cb2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805cb6:	48 8b 00             	mov    (%rax),%rax
+  805cb9:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805cbf:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805cc2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805cc5:	89 c6                	mov    %eax,%esi
+  805cc7:	48 b8 f6 e5 ff ff ff 	movabs $0xffffffffffffe5f6,%rax
+  805cce:	ff ff ff 
+  805cd1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cd5:	48 89 c7             	mov    %rax,%rdi
+  805cd8:	49 89 df             	mov    %rbx,%r15
+  805cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ce0:	49 b8 d3 77 ff ff ff 	movabs $0xffffffffffff77d3,%r8
+  805ce7:	ff ff ff 
+  805cea:	49 01 d8             	add    %rbx,%r8
+  805ced:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  805cf0:	e9 1b ff ff ff       	jmp    805c10 <_pipeisclosed+0x29>
+	}
+}
+  805cf5:	48 83 c4 28          	add    $0x28,%rsp
+  805cf9:	5b                   	pop    %rbx
+  805cfa:	41 5c                	pop    %r12
+  805cfc:	41 5f                	pop    %r15
+  805cfe:	5d                   	pop    %rbp
+  805cff:	c3                   	ret
+
+0000000000805d00 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  805d00:	55                   	push   %rbp
+  805d01:	48 89 e5             	mov    %rsp,%rbp
+  805d04:	41 57                	push   %r15
+  805d06:	53                   	push   %rbx
+  805d07:	48 83 ec 30          	sub    $0x30,%rsp
+  805d0b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d0b <pipeisclosed+0xb>
+  805d12:	49 bb 35 33 00 00 00 	movabs $0x3335,%r11
+  805d19:	00 00 00 
+  805d1c:	4c 01 db             	add    %r11,%rbx
+  805d1f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805d22:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805d26:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805d29:	48 89 d6             	mov    %rdx,%rsi
+  805d2c:	89 c7                	mov    %eax,%edi
+  805d2e:	49 89 df             	mov    %rbx,%r15
+  805d31:	48 b8 b6 a6 ff ff ff 	movabs $0xffffffffffffa6b6,%rax
+  805d38:	ff ff ff 
+  805d3b:	48 01 d8             	add    %rbx,%rax
+  805d3e:	ff d0                	call   *%rax
+  805d40:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805d43:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d47:	79 05                	jns    805d4e <pipeisclosed+0x4e>
+		return r;
+  805d49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d4c:	eb 3b                	jmp    805d89 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805d4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805d52:	48 89 c7             	mov    %rax,%rdi
+  805d55:	49 89 df             	mov    %rbx,%r15
+  805d58:	48 b8 bd a5 ff ff ff 	movabs $0xffffffffffffa5bd,%rax
+  805d5f:	ff ff ff 
+  805d62:	48 01 d8             	add    %rbx,%rax
+  805d65:	ff d0                	call   *%rax
+  805d67:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805d6b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805d6f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805d73:	48 89 d6             	mov    %rdx,%rsi
+  805d76:	48 89 c7             	mov    %rax,%rdi
+  805d79:	48 b8 a7 cb ff ff ff 	movabs $0xffffffffffffcba7,%rax
+  805d80:	ff ff ff 
+  805d83:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d87:	ff d0                	call   *%rax
+}
+  805d89:	48 83 c4 30          	add    $0x30,%rsp
+  805d8d:	5b                   	pop    %rbx
+  805d8e:	41 5f                	pop    %r15
+  805d90:	5d                   	pop    %rbp
+  805d91:	c3                   	ret
+
+0000000000805d92 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805d92:	55                   	push   %rbp
+  805d93:	48 89 e5             	mov    %rsp,%rbp
+  805d96:	41 57                	push   %r15
+  805d98:	53                   	push   %rbx
+  805d99:	48 83 ec 40          	sub    $0x40,%rsp
+  805d9d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d9d <devpipe_read+0xb>
+  805da4:	49 bb a3 32 00 00 00 	movabs $0x32a3,%r11
+  805dab:	00 00 00 
+  805dae:	4c 01 db             	add    %r11,%rbx
+  805db1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805db5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805db9:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805dbd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805dc1:	48 89 c7             	mov    %rax,%rdi
+  805dc4:	49 89 df             	mov    %rbx,%r15
+  805dc7:	48 b8 bd a5 ff ff ff 	movabs $0xffffffffffffa5bd,%rax
+  805dce:	ff ff ff 
+  805dd1:	48 01 d8             	add    %rbx,%rax
+  805dd4:	ff d0                	call   *%rax
+  805dd6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805dda:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805dde:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805de2:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805de9:	00 
+  805dea:	e9 a1 00 00 00       	jmp    805e90 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805def:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805df4:	74 09                	je     805dff <devpipe_read+0x6d>
+				return i;
+  805df6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dfa:	e9 9f 00 00 00       	jmp    805e9e <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805dff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805e03:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e07:	48 89 d6             	mov    %rdx,%rsi
+  805e0a:	48 89 c7             	mov    %rax,%rdi
+  805e0d:	48 b8 a7 cb ff ff ff 	movabs $0xffffffffffffcba7,%rax
+  805e14:	ff ff ff 
+  805e17:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e1b:	ff d0                	call   *%rax
+  805e1d:	85 c0                	test   %eax,%eax
+  805e1f:	74 07                	je     805e28 <devpipe_read+0x96>
+				return 0;
+  805e21:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e26:	eb 76                	jmp    805e9e <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805e28:	49 89 df             	mov    %rbx,%r15
+  805e2b:	48 b8 fc 91 ff ff ff 	movabs $0xffffffffffff91fc,%rax
+  805e32:	ff ff ff 
+  805e35:	48 01 d8             	add    %rbx,%rax
+  805e38:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805e3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e3e:	8b 10                	mov    (%rax),%edx
+  805e40:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e44:	8b 40 04             	mov    0x4(%rax),%eax
+  805e47:	39 c2                	cmp    %eax,%edx
+  805e49:	74 a4                	je     805def <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805e4b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e4f:	8b 10                	mov    (%rax),%edx
+  805e51:	89 d0                	mov    %edx,%eax
+  805e53:	c1 f8 1f             	sar    $0x1f,%eax
+  805e56:	c1 e8 1b             	shr    $0x1b,%eax
+  805e59:	01 c2                	add    %eax,%edx
+  805e5b:	83 e2 1f             	and    $0x1f,%edx
+  805e5e:	29 c2                	sub    %eax,%edx
+  805e60:	89 d6                	mov    %edx,%esi
+  805e62:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805e66:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e6a:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805e6e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805e72:	48 63 c6             	movslq %esi,%rax
+  805e75:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805e7a:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805e7c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e80:	8b 00                	mov    (%rax),%eax
+  805e82:	8d 50 01             	lea    0x1(%rax),%edx
+  805e85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e89:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805e8b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805e90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e94:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805e98:	72 a0                	jb     805e3a <devpipe_read+0xa8>
+	}
+	return i;
+  805e9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805e9e:	48 83 c4 40          	add    $0x40,%rsp
+  805ea2:	5b                   	pop    %rbx
+  805ea3:	41 5f                	pop    %r15
+  805ea5:	5d                   	pop    %rbp
+  805ea6:	c3                   	ret
+
+0000000000805ea7 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805ea7:	55                   	push   %rbp
+  805ea8:	48 89 e5             	mov    %rsp,%rbp
+  805eab:	41 57                	push   %r15
+  805ead:	53                   	push   %rbx
+  805eae:	48 83 ec 40          	sub    $0x40,%rsp
+  805eb2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805eb2 <devpipe_write+0xb>
+  805eb9:	49 bb 8e 31 00 00 00 	movabs $0x318e,%r11
+  805ec0:	00 00 00 
+  805ec3:	4c 01 db             	add    %r11,%rbx
+  805ec6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805eca:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805ece:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805ed2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805ed6:	48 89 c7             	mov    %rax,%rdi
+  805ed9:	49 89 df             	mov    %rbx,%r15
+  805edc:	48 b8 bd a5 ff ff ff 	movabs $0xffffffffffffa5bd,%rax
+  805ee3:	ff ff ff 
+  805ee6:	48 01 d8             	add    %rbx,%rax
+  805ee9:	ff d0                	call   *%rax
+  805eeb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805eef:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805ef3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805ef7:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805efe:	00 
+  805eff:	e9 a0 00 00 00       	jmp    805fa4 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805f04:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805f08:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805f0c:	48 89 d6             	mov    %rdx,%rsi
+  805f0f:	48 89 c7             	mov    %rax,%rdi
+  805f12:	48 b8 a7 cb ff ff ff 	movabs $0xffffffffffffcba7,%rax
+  805f19:	ff ff ff 
+  805f1c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f20:	ff d0                	call   *%rax
+  805f22:	85 c0                	test   %eax,%eax
+  805f24:	74 0a                	je     805f30 <devpipe_write+0x89>
+				return 0;
+  805f26:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f2b:	e9 82 00 00 00       	jmp    805fb2 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805f30:	49 89 df             	mov    %rbx,%r15
+  805f33:	48 b8 fc 91 ff ff ff 	movabs $0xffffffffffff91fc,%rax
+  805f3a:	ff ff ff 
+  805f3d:	48 01 d8             	add    %rbx,%rax
+  805f40:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805f42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f46:	8b 40 04             	mov    0x4(%rax),%eax
+  805f49:	48 63 d0             	movslq %eax,%rdx
+  805f4c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f50:	8b 00                	mov    (%rax),%eax
+  805f52:	48 98                	cltq
+  805f54:	48 83 c0 20          	add    $0x20,%rax
+  805f58:	48 39 c2             	cmp    %rax,%rdx
+  805f5b:	73 a7                	jae    805f04 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805f5d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805f61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f65:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805f69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f6d:	8b 50 04             	mov    0x4(%rax),%edx
+  805f70:	89 d0                	mov    %edx,%eax
+  805f72:	c1 f8 1f             	sar    $0x1f,%eax
+  805f75:	c1 e8 1b             	shr    $0x1b,%eax
+  805f78:	01 c2                	add    %eax,%edx
+  805f7a:	83 e2 1f             	and    $0x1f,%edx
+  805f7d:	29 c2                	sub    %eax,%edx
+  805f7f:	89 d0                	mov    %edx,%eax
+  805f81:	0f b6 09             	movzbl (%rcx),%ecx
+  805f84:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805f88:	48 98                	cltq
+  805f8a:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805f8e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f92:	8b 40 04             	mov    0x4(%rax),%eax
+  805f95:	8d 50 01             	lea    0x1(%rax),%edx
+  805f98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f9c:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805f9f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805fa4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fa8:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805fac:	72 94                	jb     805f42 <devpipe_write+0x9b>
+	}
+
+	return i;
+  805fae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805fb2:	48 83 c4 40          	add    $0x40,%rsp
+  805fb6:	5b                   	pop    %rbx
+  805fb7:	41 5f                	pop    %r15
+  805fb9:	5d                   	pop    %rbp
+  805fba:	c3                   	ret
+
+0000000000805fbb <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805fbb:	55                   	push   %rbp
+  805fbc:	48 89 e5             	mov    %rsp,%rbp
+  805fbf:	41 57                	push   %r15
+  805fc1:	53                   	push   %rbx
+  805fc2:	48 83 ec 20          	sub    $0x20,%rsp
+  805fc6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fc6 <devpipe_stat+0xb>
+  805fcd:	49 bb 7a 30 00 00 00 	movabs $0x307a,%r11
+  805fd4:	00 00 00 
+  805fd7:	4c 01 db             	add    %r11,%rbx
+  805fda:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805fde:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805fe2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805fe6:	48 89 c7             	mov    %rax,%rdi
+  805fe9:	49 89 df             	mov    %rbx,%r15
+  805fec:	48 b8 bd a5 ff ff ff 	movabs $0xffffffffffffa5bd,%rax
+  805ff3:	ff ff ff 
+  805ff6:	48 01 d8             	add    %rbx,%rax
+  805ff9:	ff d0                	call   *%rax
+  805ffb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805fff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806003:	48 ba 09 e6 ff ff ff 	movabs $0xffffffffffffe609,%rdx
+  80600a:	ff ff ff 
+  80600d:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806011:	48 89 d6             	mov    %rdx,%rsi
+  806014:	48 89 c7             	mov    %rax,%rdi
+  806017:	49 89 df             	mov    %rbx,%r15
+  80601a:	48 b8 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rax
+  806021:	ff ff ff 
+  806024:	48 01 d8             	add    %rbx,%rax
+  806027:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  806029:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80602d:	8b 50 04             	mov    0x4(%rax),%edx
+  806030:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806034:	8b 00                	mov    (%rax),%eax
+  806036:	29 c2                	sub    %eax,%edx
+  806038:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80603c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  806042:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806046:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80604d:	00 00 00 
+	stat->st_dev = &devpipe;
+  806050:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806054:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  80605b:	00 00 00 
+  80605e:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806062:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  806069:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80606e:	48 83 c4 20          	add    $0x20,%rsp
+  806072:	5b                   	pop    %rbx
+  806073:	41 5f                	pop    %r15
+  806075:	5d                   	pop    %rbp
+  806076:	c3                   	ret
+
+0000000000806077 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  806077:	55                   	push   %rbp
+  806078:	48 89 e5             	mov    %rsp,%rbp
+  80607b:	41 57                	push   %r15
+  80607d:	53                   	push   %rbx
+  80607e:	48 83 ec 10          	sub    $0x10,%rsp
+  806082:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806082 <devpipe_close+0xb>
+  806089:	49 bb be 2f 00 00 00 	movabs $0x2fbe,%r11
+  806090:	00 00 00 
+  806093:	4c 01 db             	add    %r11,%rbx
+  806096:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  80609a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80609e:	48 89 c6             	mov    %rax,%rsi
+  8060a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060a6:	49 89 df             	mov    %rbx,%r15
+  8060a9:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  8060b0:	ff ff ff 
+  8060b3:	48 01 d8             	add    %rbx,%rax
+  8060b6:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8060b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060bc:	48 89 c7             	mov    %rax,%rdi
+  8060bf:	49 89 df             	mov    %rbx,%r15
+  8060c2:	48 b8 bd a5 ff ff ff 	movabs $0xffffffffffffa5bd,%rax
+  8060c9:	ff ff ff 
+  8060cc:	48 01 d8             	add    %rbx,%rax
+  8060cf:	ff d0                	call   *%rax
+  8060d1:	48 89 c6             	mov    %rax,%rsi
+  8060d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060d9:	49 89 df             	mov    %rbx,%r15
+  8060dc:	48 b8 29 93 ff ff ff 	movabs $0xffffffffffff9329,%rax
+  8060e3:	ff ff ff 
+  8060e6:	48 01 d8             	add    %rbx,%rax
+  8060e9:	ff d0                	call   *%rax
+}
+  8060eb:	48 83 c4 10          	add    $0x10,%rsp
+  8060ef:	5b                   	pop    %rbx
+  8060f0:	41 5f                	pop    %r15
+  8060f2:	5d                   	pop    %rbp
+  8060f3:	c3                   	ret
+
+00000000008060f4 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8060f4:	55                   	push   %rbp
+  8060f5:	48 89 e5             	mov    %rsp,%rbp
+  8060f8:	41 57                	push   %r15
+  8060fa:	48 83 ec 28          	sub    $0x28,%rsp
+  8060fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8060fe <cputchar+0xa>
+  806105:	49 bb 42 2f 00 00 00 	movabs $0x2f42,%r11
+  80610c:	00 00 00 
+  80610f:	4c 01 d8             	add    %r11,%rax
+  806112:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  806115:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806118:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  80611b:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  80611f:	be 01 00 00 00       	mov    $0x1,%esi
+  806124:	48 89 d7             	mov    %rdx,%rdi
+  806127:	49 89 c7             	mov    %rax,%r15
+  80612a:	48 ba 99 90 ff ff ff 	movabs $0xffffffffffff9099,%rdx
+  806131:	ff ff ff 
+  806134:	48 01 c2             	add    %rax,%rdx
+  806137:	ff d2                	call   *%rdx
+}
+  806139:	90                   	nop
+  80613a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80613e:	c9                   	leave
+  80613f:	c3                   	ret
+
+0000000000806140 <getchar>:
+
+int
+getchar(void)
+{
+  806140:	55                   	push   %rbp
+  806141:	48 89 e5             	mov    %rsp,%rbp
+  806144:	41 57                	push   %r15
+  806146:	48 83 ec 18          	sub    $0x18,%rsp
+  80614a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80614a <getchar+0xa>
+  806151:	49 bb f6 2e 00 00 00 	movabs $0x2ef6,%r11
+  806158:	00 00 00 
+  80615b:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  80615e:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  806162:	ba 01 00 00 00       	mov    $0x1,%edx
+  806167:	48 89 ce             	mov    %rcx,%rsi
+  80616a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80616f:	49 89 c7             	mov    %rax,%r15
+  806172:	48 b9 fd ab ff ff ff 	movabs $0xffffffffffffabfd,%rcx
+  806179:	ff ff ff 
+  80617c:	48 01 c1             	add    %rax,%rcx
+  80617f:	ff d1                	call   *%rcx
+  806181:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  806184:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806188:	79 05                	jns    80618f <getchar+0x4f>
+		return r;
+  80618a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80618d:	eb 14                	jmp    8061a3 <getchar+0x63>
+	if (r < 1)
+  80618f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806193:	7f 07                	jg     80619c <getchar+0x5c>
+		return -E_EOF;
+  806195:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80619a:	eb 07                	jmp    8061a3 <getchar+0x63>
+	return c;
+  80619c:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8061a0:	0f b6 c0             	movzbl %al,%eax
+}
+  8061a3:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8061a7:	c9                   	leave
+  8061a8:	c3                   	ret
+
+00000000008061a9 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8061a9:	55                   	push   %rbp
+  8061aa:	48 89 e5             	mov    %rsp,%rbp
+  8061ad:	41 57                	push   %r15
+  8061af:	53                   	push   %rbx
+  8061b0:	48 83 ec 20          	sub    $0x20,%rsp
+  8061b4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061b4 <iscons+0xb>
+  8061bb:	49 bb 8c 2e 00 00 00 	movabs $0x2e8c,%r11
+  8061c2:	00 00 00 
+  8061c5:	4c 01 db             	add    %r11,%rbx
+  8061c8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8061cb:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8061cf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8061d2:	48 89 d6             	mov    %rdx,%rsi
+  8061d5:	89 c7                	mov    %eax,%edi
+  8061d7:	49 89 df             	mov    %rbx,%r15
+  8061da:	48 b8 b6 a6 ff ff ff 	movabs $0xffffffffffffa6b6,%rax
+  8061e1:	ff ff ff 
+  8061e4:	48 01 d8             	add    %rbx,%rax
+  8061e7:	ff d0                	call   *%rax
+  8061e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8061ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061f0:	79 05                	jns    8061f7 <iscons+0x4e>
+		return r;
+  8061f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061f5:	eb 1b                	jmp    806212 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8061f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061fb:	8b 10                	mov    (%rax),%edx
+  8061fd:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  806204:	00 00 00 
+  806207:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80620a:	39 c2                	cmp    %eax,%edx
+  80620c:	0f 94 c0             	sete   %al
+  80620f:	0f b6 c0             	movzbl %al,%eax
+}
+  806212:	48 83 c4 20          	add    $0x20,%rsp
+  806216:	5b                   	pop    %rbx
+  806217:	41 5f                	pop    %r15
+  806219:	5d                   	pop    %rbp
+  80621a:	c3                   	ret
+
+000000000080621b <opencons>:
+
+int
+opencons(void)
+{
+  80621b:	55                   	push   %rbp
+  80621c:	48 89 e5             	mov    %rsp,%rbp
+  80621f:	41 57                	push   %r15
+  806221:	53                   	push   %rbx
+  806222:	48 83 ec 10          	sub    $0x10,%rsp
+  806226:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806226 <opencons+0xb>
+  80622d:	49 bb 1a 2e 00 00 00 	movabs $0x2e1a,%r11
+  806234:	00 00 00 
+  806237:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  80623a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80623e:	48 89 c7             	mov    %rax,%rdi
+  806241:	49 89 df             	mov    %rbx,%r15
+  806244:	48 b8 00 a6 ff ff ff 	movabs $0xffffffffffffa600,%rax
+  80624b:	ff ff ff 
+  80624e:	48 01 d8             	add    %rbx,%rax
+  806251:	ff d0                	call   *%rax
+  806253:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806256:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80625a:	79 05                	jns    806261 <opencons+0x46>
+		return r;
+  80625c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80625f:	eb 68                	jmp    8062c9 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806261:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806265:	ba 07 04 00 00       	mov    $0x407,%edx
+  80626a:	48 89 c6             	mov    %rax,%rsi
+  80626d:	bf 00 00 00 00       	mov    $0x0,%edi
+  806272:	49 89 df             	mov    %rbx,%r15
+  806275:	48 b8 51 92 ff ff ff 	movabs $0xffffffffffff9251,%rax
+  80627c:	ff ff ff 
+  80627f:	48 01 d8             	add    %rbx,%rax
+  806282:	ff d0                	call   *%rax
+  806284:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806287:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80628b:	79 05                	jns    806292 <opencons+0x77>
+		return r;
+  80628d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806290:	eb 37                	jmp    8062c9 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  806292:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806296:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  80629d:	00 00 00 
+  8062a0:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8062a3:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8062a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062a9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8062b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062b4:	48 89 c7             	mov    %rax,%rdi
+  8062b7:	49 89 df             	mov    %rbx,%r15
+  8062ba:	48 b8 86 a5 ff ff ff 	movabs $0xffffffffffffa586,%rax
+  8062c1:	ff ff ff 
+  8062c4:	48 01 d8             	add    %rbx,%rax
+  8062c7:	ff d0                	call   *%rax
+}
+  8062c9:	48 83 c4 10          	add    $0x10,%rsp
+  8062cd:	5b                   	pop    %rbx
+  8062ce:	41 5f                	pop    %r15
+  8062d0:	5d                   	pop    %rbp
+  8062d1:	c3                   	ret
+
+00000000008062d2 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8062d2:	55                   	push   %rbp
+  8062d3:	48 89 e5             	mov    %rsp,%rbp
+  8062d6:	41 57                	push   %r15
+  8062d8:	53                   	push   %rbx
+  8062d9:	48 83 ec 30          	sub    $0x30,%rsp
+  8062dd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8062dd <devcons_read+0xb>
+  8062e4:	49 bb 63 2d 00 00 00 	movabs $0x2d63,%r11
+  8062eb:	00 00 00 
+  8062ee:	4c 01 db             	add    %r11,%rbx
+  8062f1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8062f5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8062f9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8062fd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806302:	75 19                	jne    80631d <devcons_read+0x4b>
+		return 0;
+  806304:	b8 00 00 00 00       	mov    $0x0,%eax
+  806309:	eb 55                	jmp    806360 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  80630b:	49 89 df             	mov    %rbx,%r15
+  80630e:	48 b8 fc 91 ff ff ff 	movabs $0xffffffffffff91fc,%rax
+  806315:	ff ff ff 
+  806318:	48 01 d8             	add    %rbx,%rax
+  80631b:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  80631d:	49 89 df             	mov    %rbx,%r15
+  806320:	48 b8 f8 90 ff ff ff 	movabs $0xffffffffffff90f8,%rax
+  806327:	ff ff ff 
+  80632a:	48 01 d8             	add    %rbx,%rax
+  80632d:	ff d0                	call   *%rax
+  80632f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806332:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806336:	74 d3                	je     80630b <devcons_read+0x39>
+	if (c < 0)
+  806338:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80633c:	79 05                	jns    806343 <devcons_read+0x71>
+		return c;
+  80633e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806341:	eb 1d                	jmp    806360 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806343:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806347:	75 07                	jne    806350 <devcons_read+0x7e>
+		return 0;
+  806349:	b8 00 00 00 00       	mov    $0x0,%eax
+  80634e:	eb 10                	jmp    806360 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806350:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806353:	89 c2                	mov    %eax,%edx
+  806355:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806359:	88 10                	mov    %dl,(%rax)
+	return 1;
+  80635b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806360:	48 83 c4 30          	add    $0x30,%rsp
+  806364:	5b                   	pop    %rbx
+  806365:	41 5f                	pop    %r15
+  806367:	5d                   	pop    %rbp
+  806368:	c3                   	ret
+
+0000000000806369 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806369:	55                   	push   %rbp
+  80636a:	48 89 e5             	mov    %rsp,%rbp
+  80636d:	41 57                	push   %r15
+  80636f:	53                   	push   %rbx
+  806370:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806377:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806377 <devcons_write+0xe>
+  80637e:	49 bb c9 2c 00 00 00 	movabs $0x2cc9,%r11
+  806385:	00 00 00 
+  806388:	4c 01 db             	add    %r11,%rbx
+  80638b:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806392:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806399:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  8063a0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8063a7:	e9 80 00 00 00       	jmp    80642c <devcons_write+0xc3>
+		m = n - tot;
+  8063ac:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8063b3:	89 c2                	mov    %eax,%edx
+  8063b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063b8:	29 c2                	sub    %eax,%edx
+  8063ba:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8063bd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8063c0:	83 f8 7f             	cmp    $0x7f,%eax
+  8063c3:	76 07                	jbe    8063cc <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8063c5:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8063cc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8063cf:	48 63 d0             	movslq %eax,%rdx
+  8063d2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063d5:	48 63 c8             	movslq %eax,%rcx
+  8063d8:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8063df:	48 01 c1             	add    %rax,%rcx
+  8063e2:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8063e9:	48 89 ce             	mov    %rcx,%rsi
+  8063ec:	48 89 c7             	mov    %rax,%rdi
+  8063ef:	49 89 df             	mov    %rbx,%r15
+  8063f2:	48 b8 75 89 ff ff ff 	movabs $0xffffffffffff8975,%rax
+  8063f9:	ff ff ff 
+  8063fc:	48 01 d8             	add    %rbx,%rax
+  8063ff:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806401:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806404:	48 63 d0             	movslq %eax,%rdx
+  806407:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80640e:	48 89 d6             	mov    %rdx,%rsi
+  806411:	48 89 c7             	mov    %rax,%rdi
+  806414:	49 89 df             	mov    %rbx,%r15
+  806417:	48 b8 99 90 ff ff ff 	movabs $0xffffffffffff9099,%rax
+  80641e:	ff ff ff 
+  806421:	48 01 d8             	add    %rbx,%rax
+  806424:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806426:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806429:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80642c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80642f:	48 98                	cltq
+  806431:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806438:	0f 82 6e ff ff ff    	jb     8063ac <devcons_write+0x43>
+	}
+	return tot;
+  80643e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806441:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806448:	5b                   	pop    %rbx
+  806449:	41 5f                	pop    %r15
+  80644b:	5d                   	pop    %rbp
+  80644c:	c3                   	ret
+
+000000000080644d <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  80644d:	55                   	push   %rbp
+  80644e:	48 89 e5             	mov    %rsp,%rbp
+  806451:	48 83 ec 08          	sub    $0x8,%rsp
+  806455:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806455 <devcons_close+0x8>
+  80645c:	49 bb eb 2b 00 00 00 	movabs $0x2beb,%r11
+  806463:	00 00 00 
+  806466:	4c 01 d8             	add    %r11,%rax
+  806469:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  80646d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806472:	c9                   	leave
+  806473:	c3                   	ret
+
+0000000000806474 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806474:	55                   	push   %rbp
+  806475:	48 89 e5             	mov    %rsp,%rbp
+  806478:	41 57                	push   %r15
+  80647a:	48 83 ec 18          	sub    $0x18,%rsp
+  80647e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80647e <devcons_stat+0xa>
+  806485:	49 bb c2 2b 00 00 00 	movabs $0x2bc2,%r11
+  80648c:	00 00 00 
+  80648f:	4c 01 d8             	add    %r11,%rax
+  806492:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806496:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  80649a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80649e:	48 b9 15 e6 ff ff ff 	movabs $0xffffffffffffe615,%rcx
+  8064a5:	ff ff ff 
+  8064a8:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8064ac:	48 89 ce             	mov    %rcx,%rsi
+  8064af:	48 89 d7             	mov    %rdx,%rdi
+  8064b2:	49 89 c7             	mov    %rax,%r15
+  8064b5:	48 ba 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rdx
+  8064bc:	ff ff ff 
+  8064bf:	48 01 c2             	add    %rax,%rdx
+  8064c2:	ff d2                	call   *%rdx
+	return 0;
+  8064c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8064c9:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8064cd:	c9                   	leave
+  8064ce:	c3                   	ret
+
+00000000008064cf <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8064cf:	55                   	push   %rbp
+  8064d0:	48 89 e5             	mov    %rsp,%rbp
+  8064d3:	41 57                	push   %r15
+  8064d5:	53                   	push   %rbx
+  8064d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8064da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8064da <set_pgfault_handler+0xb>
+  8064e1:	49 bb 66 2b 00 00 00 	movabs $0x2b66,%r11
+  8064e8:	00 00 00 
+  8064eb:	4c 01 db             	add    %r11,%rbx
+  8064ee:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  8064f2:	49 89 df             	mov    %rbx,%r15
+  8064f5:	48 b8 a8 91 ff ff ff 	movabs $0xffffffffffff91a8,%rax
+  8064fc:	ff ff ff 
+  8064ff:	48 01 d8             	add    %rbx,%rax
+  806502:	ff d0                	call   *%rax
+  806504:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806507:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  80650e:	00 00 00 
+  806511:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806515:	48 85 c0             	test   %rax,%rax
+  806518:	75 6b                	jne    806585 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  80651a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80651d:	ba 07 00 00 00       	mov    $0x7,%edx
+  806522:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806527:	48 89 ce             	mov    %rcx,%rsi
+  80652a:	89 c7                	mov    %eax,%edi
+  80652c:	49 89 df             	mov    %rbx,%r15
+  80652f:	48 b8 51 92 ff ff ff 	movabs $0xffffffffffff9251,%rax
+  806536:	ff ff ff 
+  806539:	48 01 d8             	add    %rbx,%rax
+  80653c:	ff d0                	call   *%rax
+  80653e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806541:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806545:	74 3e                	je     806585 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806547:	48 b8 20 e6 ff ff ff 	movabs $0xffffffffffffe620,%rax
+  80654e:	ff ff ff 
+  806551:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806555:	48 89 c2             	mov    %rax,%rdx
+  806558:	be 23 00 00 00       	mov    $0x23,%esi
+  80655d:	48 b8 4e e6 ff ff ff 	movabs $0xffffffffffffe64e,%rax
+  806564:	ff ff ff 
+  806567:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80656b:	48 89 c7             	mov    %rax,%rdi
+  80656e:	49 89 df             	mov    %rbx,%r15
+  806571:	b8 00 00 00 00       	mov    $0x0,%eax
+  806576:	48 b9 fc 74 ff ff ff 	movabs $0xffffffffffff74fc,%rcx
+  80657d:	ff ff ff 
+  806580:	48 01 d9             	add    %rbx,%rcx
+  806583:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806585:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  80658c:	00 00 00 
+  80658f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806593:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806597:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80659a:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8065a1:	ff ff ff 
+  8065a4:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8065a8:	48 89 d6             	mov    %rdx,%rsi
+  8065ab:	89 c7                	mov    %eax,%edi
+  8065ad:	49 89 df             	mov    %rbx,%r15
+  8065b0:	48 b8 47 94 ff ff ff 	movabs $0xffffffffffff9447,%rax
+  8065b7:	ff ff ff 
+  8065ba:	48 01 d8             	add    %rbx,%rax
+  8065bd:	ff d0                	call   *%rax
+}
+  8065bf:	90                   	nop
+  8065c0:	48 83 c4 20          	add    $0x20,%rsp
+  8065c4:	5b                   	pop    %rbx
+  8065c5:	41 5f                	pop    %r15
+  8065c7:	5d                   	pop    %rbp
+  8065c8:	c3                   	ret
+
+00000000008065c9 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  8065c9:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  8065cc:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  8065d3:	00 00 00 
+call *%rax
+  8065d6:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  8065d8:	58                   	pop    %rax
+	popq %rax;
+  8065d9:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  8065da:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  8065e1:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  8065e5:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  8065e9:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  8065ed:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  8065f1:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  8065f5:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  8065f8:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  8065fc:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806600:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806605:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80660a:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80660f:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806614:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806619:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80661e:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806623:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806628:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80662d:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806632:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806637:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80663c:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806641:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806646:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  80664a:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  80664e:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  80664f:	5c                   	pop    %rsp
+	ret;			//return
+  806650:	c3                   	ret
+
+0000000000806651 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806651:	55                   	push   %rbp
+  806652:	48 89 e5             	mov    %rsp,%rbp
+  806655:	41 57                	push   %r15
+  806657:	53                   	push   %rbx
+  806658:	48 83 ec 30          	sub    $0x30,%rsp
+  80665c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80665c <ipc_recv+0xb>
+  806663:	49 bb e4 29 00 00 00 	movabs $0x29e4,%r11
+  80666a:	00 00 00 
+  80666d:	4c 01 db             	add    %r11,%rbx
+  806670:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806674:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806678:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  80667c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806681:	75 0e                	jne    806691 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  806683:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80668a:	00 00 00 
+  80668d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  806691:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806695:	48 89 c7             	mov    %rax,%rdi
+  806698:	49 89 df             	mov    %rbx,%r15
+  80669b:	48 b8 7a 95 ff ff ff 	movabs $0xffffffffffff957a,%rax
+  8066a2:	ff ff ff 
+  8066a5:	48 01 d8             	add    %rbx,%rax
+  8066a8:	ff d0                	call   *%rax
+  8066aa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8066ad:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8066b2:	74 2a                	je     8066de <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8066b4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066b8:	75 19                	jne    8066d3 <ipc_recv+0x82>
+  8066ba:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8066c1:	ff ff ff 
+  8066c4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8066c8:	48 8b 00             	mov    (%rax),%rax
+  8066cb:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8066d1:	eb 05                	jmp    8066d8 <ipc_recv+0x87>
+  8066d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8066d8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8066dc:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8066de:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8066e3:	74 2a                	je     80670f <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  8066e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066e9:	75 19                	jne    806704 <ipc_recv+0xb3>
+  8066eb:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8066f2:	ff ff ff 
+  8066f5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8066f9:	48 8b 00             	mov    (%rax),%rax
+  8066fc:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806702:	eb 05                	jmp    806709 <ipc_recv+0xb8>
+  806704:	b8 00 00 00 00       	mov    $0x0,%eax
+  806709:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80670d:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80670f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806713:	74 05                	je     80671a <ipc_recv+0xc9>
+		return res;
+  806715:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806718:	eb 17                	jmp    806731 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  80671a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806721:	ff ff ff 
+  806724:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806728:	48 8b 00             	mov    (%rax),%rax
+  80672b:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806731:	48 83 c4 30          	add    $0x30,%rsp
+  806735:	5b                   	pop    %rbx
+  806736:	41 5f                	pop    %r15
+  806738:	5d                   	pop    %rbp
+  806739:	c3                   	ret
+
+000000000080673a <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80673a:	55                   	push   %rbp
+  80673b:	48 89 e5             	mov    %rsp,%rbp
+  80673e:	41 57                	push   %r15
+  806740:	53                   	push   %rbx
+  806741:	48 83 ec 20          	sub    $0x20,%rsp
+  806745:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806745 <ipc_send+0xb>
+  80674c:	49 bb fb 28 00 00 00 	movabs $0x28fb,%r11
+  806753:	00 00 00 
+  806756:	4c 01 db             	add    %r11,%rbx
+  806759:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80675c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80675f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806763:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  806766:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80676b:	75 0e                	jne    80677b <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  80676d:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806774:	00 00 00 
+  806777:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  80677b:	90                   	nop
+  80677c:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80677f:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806782:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806786:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806789:	89 c7                	mov    %eax,%edi
+  80678b:	49 89 df             	mov    %rbx,%r15
+  80678e:	48 b8 10 95 ff ff ff 	movabs $0xffffffffffff9510,%rax
+  806795:	ff ff ff 
+  806798:	48 01 d8             	add    %rbx,%rax
+  80679b:	ff d0                	call   *%rax
+  80679d:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8067a0:	74 da                	je     80677c <ipc_send+0x42>
+		;
+}
+  8067a2:	90                   	nop
+  8067a3:	90                   	nop
+  8067a4:	48 83 c4 20          	add    $0x20,%rsp
+  8067a8:	5b                   	pop    %rbx
+  8067a9:	41 5f                	pop    %r15
+  8067ab:	5d                   	pop    %rbp
+  8067ac:	c3                   	ret
+
+00000000008067ad <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8067ad:	55                   	push   %rbp
+  8067ae:	48 89 e5             	mov    %rsp,%rbp
+  8067b1:	41 57                	push   %r15
+  8067b3:	53                   	push   %rbx
+  8067b4:	48 83 ec 40          	sub    $0x40,%rsp
+  8067b8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067b8 <ipc_call+0xb>
+  8067bf:	49 bb 88 28 00 00 00 	movabs $0x2888,%r11
+  8067c6:	00 00 00 
+  8067c9:	4c 01 db             	add    %r11,%rbx
+  8067cc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8067cf:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8067d2:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8067d6:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8067d9:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8067dd:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8067e1:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8067e6:	75 0e                	jne    8067f6 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  8067e8:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8067ef:	00 00 00 
+  8067f2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8067f6:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8067fb:	75 0e                	jne    80680b <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8067fd:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806804:	00 00 00 
+  806807:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  80680b:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80680e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  806812:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806815:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806819:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80681c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806822:	49 89 f8             	mov    %rdi,%r8
+  806825:	89 c7                	mov    %eax,%edi
+  806827:	49 89 df             	mov    %rbx,%r15
+  80682a:	48 b8 d3 95 ff ff ff 	movabs $0xffffffffffff95d3,%rax
+  806831:	ff ff ff 
+  806834:	48 01 d8             	add    %rbx,%rax
+  806837:	ff d0                	call   *%rax
+  806839:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  80683c:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806841:	74 2a                	je     80686d <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806843:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806847:	75 19                	jne    806862 <ipc_call+0xb5>
+  806849:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806850:	ff ff ff 
+  806853:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806857:	48 8b 00             	mov    (%rax),%rax
+  80685a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806860:	eb 05                	jmp    806867 <ipc_call+0xba>
+  806862:	b8 00 00 00 00       	mov    $0x0,%eax
+  806867:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80686b:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  80686d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806871:	74 05                	je     806878 <ipc_call+0xcb>
+		return r;
+  806873:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806876:	eb 17                	jmp    80688f <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  806878:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80687f:	ff ff ff 
+  806882:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806886:	48 8b 00             	mov    (%rax),%rax
+  806889:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80688f:	48 83 c4 40          	add    $0x40,%rsp
+  806893:	5b                   	pop    %rbx
+  806894:	41 5f                	pop    %r15
+  806896:	5d                   	pop    %rbp
+  806897:	c3                   	ret
+
+0000000000806898 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  806898:	55                   	push   %rbp
+  806899:	48 89 e5             	mov    %rsp,%rbp
+  80689c:	41 57                	push   %r15
+  80689e:	53                   	push   %rbx
+  80689f:	48 83 ec 70          	sub    $0x70,%rsp
+  8068a3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068a3 <ipc_callw+0xb>
+  8068aa:	49 bb 9d 27 00 00 00 	movabs $0x279d,%r11
+  8068b1:	00 00 00 
+  8068b4:	4c 01 db             	add    %r11,%rbx
+  8068b7:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8068ba:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8068bd:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  8068c1:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  8068c5:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  8068ca:	76 0a                	jbe    8068d6 <ipc_callw+0x3e>
+		return -E_INVAL;
+  8068cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8068d1:	e9 b7 00 00 00       	jmp    80698d <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  8068d6:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8068da:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8068de:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8068e2:	48 89 ce             	mov    %rcx,%rsi
+  8068e5:	48 89 c7             	mov    %rax,%rdi
+  8068e8:	49 89 df             	mov    %rbx,%r15
+  8068eb:	48 b8 75 89 ff ff ff 	movabs $0xffffffffffff8975,%rax
+  8068f2:	ff ff ff 
+  8068f5:	48 01 d8             	add    %rbx,%rax
+  8068f8:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  8068fa:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806901:	00 
+  806902:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806906:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80690a:	48 01 d0             	add    %rdx,%rax
+  80690d:	48 83 e8 01          	sub    $0x1,%rax
+  806911:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806915:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806919:	ba 00 00 00 00       	mov    $0x0,%edx
+  80691e:	48 f7 75 e8          	divq   -0x18(%rbp)
+  806922:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806926:	48 29 d0             	sub    %rdx,%rax
+  806929:	48 c1 e8 03          	shr    $0x3,%rax
+  80692d:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806931:	89 c1                	mov    %eax,%ecx
+  806933:	8b 75 98             	mov    -0x68(%rbp),%esi
+  806936:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  80693a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80693d:	49 89 d1             	mov    %rdx,%r9
+  806940:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  806947:	00 00 00 
+  80694a:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806951:	00 00 00 
+  806954:	89 c7                	mov    %eax,%edi
+  806956:	49 89 df             	mov    %rbx,%r15
+  806959:	48 b8 d3 95 ff ff ff 	movabs $0xffffffffffff95d3,%rax
+  806960:	ff ff ff 
+  806963:	48 01 d8             	add    %rbx,%rax
+  806966:	ff d0                	call   *%rax
+  806968:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  80696b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80696f:	74 05                	je     806976 <ipc_callw+0xde>
+		return r;
+  806971:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806974:	eb 17                	jmp    80698d <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  806976:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80697d:	ff ff ff 
+  806980:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806984:	48 8b 00             	mov    (%rax),%rax
+  806987:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80698d:	48 83 c4 70          	add    $0x70,%rsp
+  806991:	5b                   	pop    %rbx
+  806992:	41 5f                	pop    %r15
+  806994:	5d                   	pop    %rbp
+  806995:	c3                   	ret
+
+0000000000806996 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  806996:	55                   	push   %rbp
+  806997:	48 89 e5             	mov    %rsp,%rbp
+  80699a:	41 57                	push   %r15
+  80699c:	53                   	push   %rbx
+  80699d:	48 83 ec 40          	sub    $0x40,%rsp
+  8069a1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8069a1 <ipc_callv+0xb>
+  8069a8:	49 bb 9f 26 00 00 00 	movabs $0x269f,%r11
+  8069af:	00 00 00 
+  8069b2:	4c 01 db             	add    %r11,%rbx
+  8069b5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8069b8:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  8069bb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8069bf:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8069c2:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  8069c6:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  8069ca:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8069d1:	00 00 00 
+  8069d4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  8069d8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  8069dc:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8069e0:	74 11                	je     8069f3 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  8069e2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8069e6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  8069ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8069ed:	c1 e0 14             	shl    $0x14,%eax
+  8069f0:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  8069f3:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  8069f7:	74 14                	je     806a0d <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  8069f9:	8b 45 20             	mov    0x20(%rbp),%eax
+  8069fc:	83 e8 01             	sub    $0x1,%eax
+  8069ff:	48 63 d0             	movslq %eax,%rdx
+  806a02:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806a06:	48 09 d0             	or     %rdx,%rax
+  806a09:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806a0d:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806a10:	c1 e0 10             	shl    $0x10,%eax
+  806a13:	0b 45 10             	or     0x10(%rbp),%eax
+  806a16:	89 c1                	mov    %eax,%ecx
+  806a18:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806a1b:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806a1f:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806a23:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806a27:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806a2a:	4d 89 c1             	mov    %r8,%r9
+  806a2d:	49 89 f8             	mov    %rdi,%r8
+  806a30:	89 c7                	mov    %eax,%edi
+  806a32:	49 89 df             	mov    %rbx,%r15
+  806a35:	48 b8 d3 95 ff ff ff 	movabs $0xffffffffffff95d3,%rax
+  806a3c:	ff ff ff 
+  806a3f:	48 01 d8             	add    %rbx,%rax
+  806a42:	ff d0                	call   *%rax
+  806a44:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806a47:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806a4b:	74 05                	je     806a52 <ipc_callv+0xbc>
+		return r;
+  806a4d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806a50:	eb 17                	jmp    806a69 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806a52:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806a59:	ff ff ff 
+  806a5c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a60:	48 8b 00             	mov    (%rax),%rax
+  806a63:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806a69:	48 83 c4 40          	add    $0x40,%rsp
+  806a6d:	5b                   	pop    %rbx
+  806a6e:	41 5f                	pop    %r15
+  806a70:	5d                   	pop    %rbp
+  806a71:	c3                   	ret
+
+0000000000806a72 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806a72:	55                   	push   %rbp
+  806a73:	48 89 e5             	mov    %rsp,%rbp
+  806a76:	41 57                	push   %r15
+  806a78:	53                   	push   %rbx
+  806a79:	48 83 ec 40          	sub    $0x40,%rsp
+  806a7d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a7d <ipc_reply_recv+0xb>
+  806a84:	49 bb c3 25 00 00 00 	movabs $0x25c3,%r11
+  806a8b:	00 00 00 
+  806a8e:	4c 01 db             	add    %r11,%rbx
+  806a91:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806a94:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806a97:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806a9b:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806a9e:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806aa2:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806aa6:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806aab:	75 0e                	jne    806abb <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806aad:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806ab4:	00 00 00 
+  806ab7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806abb:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806ac0:	75 0e                	jne    806ad0 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806ac2:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806ac9:	00 00 00 
+  806acc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806ad0:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806ad3:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806ad7:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806adb:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806ade:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806ae2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806ae5:	4d 89 c1             	mov    %r8,%r9
+  806ae8:	49 89 f8             	mov    %rdi,%r8
+  806aeb:	89 c7                	mov    %eax,%edi
+  806aed:	49 89 df             	mov    %rbx,%r15
+  806af0:	48 b8 47 96 ff ff ff 	movabs $0xffffffffffff9647,%rax
+  806af7:	ff ff ff 
+  806afa:	48 01 d8             	add    %rbx,%rax
+  806afd:	ff d0                	call   *%rax
+  806aff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806b02:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806b07:	74 2a                	je     806b33 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806b09:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b0d:	75 19                	jne    806b28 <ipc_reply_recv+0xb6>
+  806b0f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b16:	ff ff ff 
+  806b19:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b1d:	48 8b 00             	mov    (%rax),%rax
+  806b20:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806b26:	eb 05                	jmp    806b2d <ipc_reply_recv+0xbb>
+  806b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806b31:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806b33:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806b38:	74 2a                	je     806b64 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806b3a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b3e:	75 19                	jne    806b59 <ipc_reply_recv+0xe7>
+  806b40:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b47:	ff ff ff 
+  806b4a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b4e:	48 8b 00             	mov    (%rax),%rax
+  806b51:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806b57:	eb 05                	jmp    806b5e <ipc_reply_recv+0xec>
+  806b59:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b5e:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806b62:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806b64:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b68:	74 05                	je     806b6f <ipc_reply_recv+0xfd>
+		return r;
+  806b6a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b6d:	eb 17                	jmp    806b86 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806b6f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b76:	ff ff ff 
+  806b79:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b7d:	48 8b 00             	mov    (%rax),%rax
+  806b80:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806b86:	48 83 c4 40          	add    $0x40,%rsp
+  806b8a:	5b                   	pop    %rbx
+  806b8b:	41 5f                	pop    %r15
+  806b8d:	5d                   	pop    %rbp
+  806b8e:	c3                   	ret
+
+0000000000806b8f <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806b8f:	55                   	push   %rbp
+  806b90:	48 89 e5             	mov    %rsp,%rbp
+  806b93:	41 57                	push   %r15
+  806b95:	53                   	push   %rbx
+  806b96:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806b9d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b9d <ipc_window_batch+0xe>
+  806ba4:	49 bb a3 24 00 00 00 	movabs $0x24a3,%r11
+  806bab:	00 00 00 
+  806bae:	4c 01 db             	add    %r11,%rbx
+  806bb1:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806bb7:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806bbe:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806bc4:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  806bca:	e9 15 01 00 00       	jmp    806ce4 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806bcf:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806bd5:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806bd8:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806bdf:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806be2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806be5:	39 c2                	cmp    %eax,%edx
+  806be7:	0f 4e c2             	cmovle %edx,%eax
+  806bea:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806bed:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806bf4:	eb 6b                	jmp    806c61 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  806bf6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806bf9:	48 98                	cltq
+  806bfb:	48 c1 e0 05          	shl    $0x5,%rax
+  806bff:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806c03:	48 01 e8             	add    %rbp,%rax
+  806c06:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806c0c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806c12:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c15:	c1 e0 0c             	shl    $0xc,%eax
+  806c18:	48 63 d0             	movslq %eax,%rdx
+  806c1b:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806c22:	48 01 c2             	add    %rax,%rdx
+  806c25:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c28:	48 98                	cltq
+  806c2a:	48 c1 e0 05          	shl    $0x5,%rax
+  806c2e:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806c32:	48 01 e8             	add    %rbp,%rax
+  806c35:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806c3b:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806c3e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c41:	48 98                	cltq
+  806c43:	48 c1 e0 05          	shl    $0x5,%rax
+  806c47:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806c4b:	48 01 e8             	add    %rbp,%rax
+  806c4e:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806c55:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806c5b:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806c5d:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806c61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c64:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806c67:	7c 8d                	jl     806bf6 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806c69:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806c70:	74 27                	je     806c99 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806c72:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806c75:	48 63 d0             	movslq %eax,%rdx
+  806c78:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806c7f:	48 89 d6             	mov    %rdx,%rsi
+  806c82:	48 89 c7             	mov    %rax,%rdi
+  806c85:	49 89 df             	mov    %rbx,%r15
+  806c88:	48 b8 ea 98 ff ff ff 	movabs $0xffffffffffff98ea,%rax
+  806c8f:	ff ff ff 
+  806c92:	48 01 d8             	add    %rbx,%rax
+  806c95:	ff d0                	call   *%rax
+  806c97:	eb 25                	jmp    806cbe <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806c99:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806c9c:	48 63 d0             	movslq %eax,%rdx
+  806c9f:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806ca6:	48 89 d6             	mov    %rdx,%rsi
+  806ca9:	48 89 c7             	mov    %rax,%rdi
+  806cac:	49 89 df             	mov    %rbx,%r15
+  806caf:	48 b8 48 99 ff ff ff 	movabs $0xffffffffffff9948,%rax
+  806cb6:	ff ff ff 
+  806cb9:	48 01 d8             	add    %rbx,%rax
+  806cbc:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806cbe:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806cc1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806cc5:	79 05                	jns    806ccc <ipc_window_batch+0x13d>
+			return r;
+  806cc7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806cca:	eb 2a                	jmp    806cf6 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806ccc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806ccf:	c1 e0 0c             	shl    $0xc,%eax
+  806cd2:	48 98                	cltq
+  806cd4:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806cdb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806cde:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806ce4:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806ceb:	0f 8f de fe ff ff    	jg     806bcf <ipc_window_batch+0x40>
+	}
+	return 0;
+  806cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806cf6:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806cfd:	5b                   	pop    %rbx
+  806cfe:	41 5f                	pop    %r15
+  806d00:	5d                   	pop    %rbp
+  806d01:	c3                   	ret
+
+0000000000806d02 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806d02:	55                   	push   %rbp
+  806d03:	48 89 e5             	mov    %rsp,%rbp
+  806d06:	48 83 ec 10          	sub    $0x10,%rsp
+  806d0a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d0a <ipc_map_window+0x8>
+  806d11:	49 bb 36 23 00 00 00 	movabs $0x2336,%r11
+  806d18:	00 00 00 
+  806d1b:	4c 01 d8             	add    %r11,%rax
+  806d1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806d22:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806d25:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806d28:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806d2c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806d31:	bf 01 00 00 00       	mov    $0x1,%edi
+  806d36:	49 b8 4f db ff ff ff 	movabs $0xffffffffffffdb4f,%r8
+  806d3d:	ff ff ff 
+  806d40:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806d44:	ff d0                	call   *%rax
+}
+  806d46:	c9                   	leave
+  806d47:	c3                   	ret
+
+0000000000806d48 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806d48:	55                   	push   %rbp
+  806d49:	48 89 e5             	mov    %rsp,%rbp
+  806d4c:	48 83 ec 10          	sub    $0x10,%rsp
+  806d50:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d50 <ipc_unmap_window+0x8>
+  806d57:	49 bb f0 22 00 00 00 	movabs $0x22f0,%r11
+  806d5e:	00 00 00 
+  806d61:	4c 01 d8             	add    %r11,%rax
+  806d64:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806d68:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806d6b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806d6e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806d72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806d77:	bf 00 00 00 00       	mov    $0x0,%edi
+  806d7c:	49 b8 4f db ff ff ff 	movabs $0xffffffffffffdb4f,%r8
+  806d83:	ff ff ff 
+  806d86:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806d8a:	ff d0                	call   *%rax
+}
+  806d8c:	c9                   	leave
+  806d8d:	c3                   	ret
+
+0000000000806d8e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806d8e:	55                   	push   %rbp
+  806d8f:	48 89 e5             	mov    %rsp,%rbp
+  806d92:	48 83 ec 18          	sub    $0x18,%rsp
+  806d96:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d96 <ipc_find_env+0x8>
+  806d9d:	49 bb aa 22 00 00 00 	movabs $0x22aa,%r11
+  806da4:	00 00 00 
+  806da7:	4c 01 d8             	add    %r11,%rax
+  806daa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806dad:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806db4:	eb 57                	jmp    806e0d <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806db6:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806dbd:	ff ff ff 
+  806dc0:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806dc4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806dc7:	48 63 d2             	movslq %edx,%rdx
+  806dca:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806dd1:	48 01 ca             	add    %rcx,%rdx
+  806dd4:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806ddb:	8b 12                	mov    (%rdx),%edx
+  806ddd:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806de0:	75 27                	jne    806e09 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806de2:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806de9:	ff ff ff 
+  806dec:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806df0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806df3:	48 98                	cltq
+  806df5:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806dfc:	48 01 d0             	add    %rdx,%rax
+  806dff:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806e05:	8b 00                	mov    (%rax),%eax
+  806e07:	eb 12                	jmp    806e1b <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806e09:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806e0d:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806e14:	7e a0                	jle    806db6 <ipc_find_env+0x28>
+	}
+	return 0;
+  806e16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806e1b:	c9                   	leave
+  806e1c:	c3                   	ret
+
+0000000000806e1d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806e1d:	55                   	push   %rbp
+  806e1e:	48 89 e5             	mov    %rsp,%rbp
+  806e21:	48 83 ec 18          	sub    $0x18,%rsp
+  806e25:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806e25 <pageref+0x8>
+  806e2c:	49 bb 1b 22 00 00 00 	movabs $0x221b,%r11
+  806e33:	00 00 00 
+  806e36:	4c 01 d8             	add    %r11,%rax
+  806e39:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806e3d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806e41:	48 89 d1             	mov    %rdx,%rcx
+  806e44:	48 c1 e9 15          	shr    $0x15,%rcx
+  806e48:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806e4f:	ff ff ff 
+  806e52:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806e56:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806e5a:	83 e2 01             	and    $0x1,%edx
+  806e5d:	48 85 d2             	test   %rdx,%rdx
+  806e60:	75 07                	jne    806e69 <pageref+0x4c>
+		return 0;
+  806e62:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e67:	eb 64                	jmp    806ecd <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806e69:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806e6d:	48 89 d1             	mov    %rdx,%rcx
+  806e70:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806e74:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806e7b:	ff ff ff 
+  806e7e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806e82:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806e86:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806e8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806e8e:	83 e2 01             	and    $0x1,%edx
+  806e91:	48 85 d2             	test   %rdx,%rdx
+  806e94:	75 07                	jne    806e9d <pageref+0x80>
+		return 0;
+  806e96:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e9b:	eb 30                	jmp    806ecd <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806e9d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806ea1:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806ea5:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806eac:	ff ff ff 
+  806eaf:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806eb3:	48 89 d0             	mov    %rdx,%rax
+  806eb6:	48 01 c0             	add    %rax,%rax
+  806eb9:	48 01 d0             	add    %rdx,%rax
+  806ebc:	48 c1 e0 03          	shl    $0x3,%rax
+  806ec0:	48 01 c8             	add    %rcx,%rax
+  806ec3:	48 83 c0 08          	add    $0x8,%rax
+  806ec7:	0f b7 00             	movzwl (%rax),%eax
+  806eca:	0f b7 c0             	movzwl %ax,%eax
+}
+  806ecd:	c9                   	leave
+  806ece:	c3                   	ret
@@ -0,0 +1,12255 @@
+
+obj/user/testpteshare:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 76 03 00 00       	call   8003b7 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+void childofspawn(void);
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb f2 af 00 00 00 	movabs $0xaff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	if (argc != 0)
+  800069:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80006d:	74 10                	je     80007f <umain+0x3c>
+		childofspawn();
+  80006f:	48 b8 19 53 ff ff ff 	movabs $0xffffffffffff5319,%rax
+  800076:	ff ff ff 
+  800079:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80007d:	ff d0                	call   *%rax
+
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80007f:	ba 07 04 00 00       	mov    $0x407,%edx
+  800084:	b8 00 00 00 a0       	mov    $0xa0000000,%eax
+  800089:	48 89 c6             	mov    %rax,%rsi
+  80008c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800091:	49 89 df             	mov    %rbx,%r15
+  800094:	48 b8 d6 71 ff ff ff 	movabs $0xffffffffffff71d6,%rax
+  80009b:	ff ff ff 
+  80009e:	48 01 d8             	add    %rbx,%rax
+  8000a1:	ff d0                	call   *%rax
+  8000a3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8000a6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000aa:	79 44                	jns    8000f0 <umain+0xad>
+		panic("sys_page_alloc: %e", r);
+  8000ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000af:	89 c1                	mov    %eax,%ecx
+  8000b1:	48 b8 3e d1 ff ff ff 	movabs $0xffffffffffffd13e,%rax
+  8000b8:	ff ff ff 
+  8000bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000bf:	48 89 c2             	mov    %rax,%rdx
+  8000c2:	be 13 00 00 00       	mov    $0x13,%esi
+  8000c7:	48 b8 51 d1 ff ff ff 	movabs $0xffffffffffffd151,%rax
+  8000ce:	ff ff ff 
+  8000d1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000d5:	48 89 c7             	mov    %rax,%rdi
+  8000d8:	49 89 df             	mov    %rbx,%r15
+  8000db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e0:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  8000e7:	ff ff ff 
+  8000ea:	49 01 d8             	add    %rbx,%r8
+  8000ed:	41 ff d0             	call   *%r8
+
+	// check fork
+	if ((r = fork()) < 0)
+  8000f0:	49 89 df             	mov    %rbx,%r15
+  8000f3:	48 b8 65 81 ff ff ff 	movabs $0xffffffffffff8165,%rax
+  8000fa:	ff ff ff 
+  8000fd:	48 01 d8             	add    %rbx,%rax
+  800100:	ff d0                	call   *%rax
+  800102:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800105:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800109:	79 44                	jns    80014f <umain+0x10c>
+		panic("fork: %e", r);
+  80010b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80010e:	89 c1                	mov    %eax,%ecx
+  800110:	48 b8 65 d1 ff ff ff 	movabs $0xffffffffffffd165,%rax
+  800117:	ff ff ff 
+  80011a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80011e:	48 89 c2             	mov    %rax,%rdx
+  800121:	be 17 00 00 00       	mov    $0x17,%esi
+  800126:	48 b8 51 d1 ff ff ff 	movabs $0xffffffffffffd151,%rax
+  80012d:	ff ff ff 
+  800130:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800134:	48 89 c7             	mov    %rax,%rdi
+  800137:	49 89 df             	mov    %rbx,%r15
+  80013a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013f:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  800146:	ff ff ff 
+  800149:	49 01 d8             	add    %rbx,%r8
+  80014c:	41 ff d0             	call   *%r8
+	if (r == 0) {
+  80014f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800153:	75 3d                	jne    800192 <umain+0x14f>
+		strcpy(VA, msg);
+  800155:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  80015c:	00 00 00 
+  80015f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800163:	48 89 c6             	mov    %rax,%rsi
+  800166:	b8 00 00 00 a0       	mov    $0xa0000000,%eax
+  80016b:	48 89 c7             	mov    %rax,%rdi
+  80016e:	49 89 df             	mov    %rbx,%r15
+  800171:	48 b8 1a 65 ff ff ff 	movabs $0xffffffffffff651a,%rax
+  800178:	ff ff ff 
+  80017b:	48 01 d8             	add    %rbx,%rax
+  80017e:	ff d0                	call   *%rax
+		exit();
+  800180:	49 89 df             	mov    %rbx,%r15
+  800183:	48 b8 37 54 ff ff ff 	movabs $0xffffffffffff5437,%rax
+  80018a:	ff ff ff 
+  80018d:	48 01 d8             	add    %rbx,%rax
+  800190:	ff d0                	call   *%rax
+	}
+	wait(r);
+  800192:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800195:	89 c7                	mov    %eax,%edi
+  800197:	49 89 df             	mov    %rbx,%r15
+  80019a:	48 b8 6b c2 ff ff ff 	movabs $0xffffffffffffc26b,%rax
+  8001a1:	ff ff ff 
+  8001a4:	48 01 d8             	add    %rbx,%rax
+  8001a7:	ff d0                	call   *%rax
+	cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8001a9:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  8001b0:	00 00 00 
+  8001b3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8001b7:	48 89 c6             	mov    %rax,%rsi
+  8001ba:	b8 00 00 00 a0       	mov    $0xa0000000,%eax
+  8001bf:	48 89 c7             	mov    %rax,%rdi
+  8001c2:	49 89 df             	mov    %rbx,%r15
+  8001c5:	48 b8 d3 66 ff ff ff 	movabs $0xffffffffffff66d3,%rax
+  8001cc:	ff ff ff 
+  8001cf:	48 01 d8             	add    %rbx,%rax
+  8001d2:	ff d0                	call   *%rax
+  8001d4:	85 c0                	test   %eax,%eax
+  8001d6:	75 10                	jne    8001e8 <umain+0x1a5>
+  8001d8:	48 b8 6e d1 ff ff ff 	movabs $0xffffffffffffd16e,%rax
+  8001df:	ff ff ff 
+  8001e2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001e6:	eb 0e                	jmp    8001f6 <umain+0x1b3>
+  8001e8:	48 b8 74 d1 ff ff ff 	movabs $0xffffffffffffd174,%rax
+  8001ef:	ff ff ff 
+  8001f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001f6:	48 89 c6             	mov    %rax,%rsi
+  8001f9:	48 b8 7a d1 ff ff ff 	movabs $0xffffffffffffd17a,%rax
+  800200:	ff ff ff 
+  800203:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800207:	48 89 c7             	mov    %rax,%rdi
+  80020a:	49 89 df             	mov    %rbx,%r15
+  80020d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800212:	48 ba 58 57 ff ff ff 	movabs $0xffffffffffff5758,%rdx
+  800219:	ff ff ff 
+  80021c:	48 01 da             	add    %rbx,%rdx
+  80021f:	ff d2                	call   *%rdx
+
+	// check spawn
+	if ((r = spawnl("/bin/testpteshare", "testpteshare", "arg", 0)) < 0)
+  800221:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800226:	48 b8 95 d1 ff ff ff 	movabs $0xffffffffffffd195,%rax
+  80022d:	ff ff ff 
+  800230:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800234:	48 89 c2             	mov    %rax,%rdx
+  800237:	48 b8 99 d1 ff ff ff 	movabs $0xffffffffffffd199,%rax
+  80023e:	ff ff ff 
+  800241:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800245:	48 89 c6             	mov    %rax,%rsi
+  800248:	48 b8 a6 d1 ff ff ff 	movabs $0xffffffffffffd1a6,%rax
+  80024f:	ff ff ff 
+  800252:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800256:	48 89 c7             	mov    %rax,%rdi
+  800259:	49 89 df             	mov    %rbx,%r15
+  80025c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800261:	49 b8 cd a0 ff ff ff 	movabs $0xffffffffffffa0cd,%r8
+  800268:	ff ff ff 
+  80026b:	49 01 d8             	add    %rbx,%r8
+  80026e:	41 ff d0             	call   *%r8
+  800271:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800274:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800278:	79 44                	jns    8002be <umain+0x27b>
+		panic("spawn: %e", r);
+  80027a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80027d:	89 c1                	mov    %eax,%ecx
+  80027f:	48 b8 b8 d1 ff ff ff 	movabs $0xffffffffffffd1b8,%rax
+  800286:	ff ff ff 
+  800289:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80028d:	48 89 c2             	mov    %rax,%rdx
+  800290:	be 21 00 00 00       	mov    $0x21,%esi
+  800295:	48 b8 51 d1 ff ff ff 	movabs $0xffffffffffffd151,%rax
+  80029c:	ff ff ff 
+  80029f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002a3:	48 89 c7             	mov    %rax,%rdi
+  8002a6:	49 89 df             	mov    %rbx,%r15
+  8002a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ae:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  8002b5:	ff ff ff 
+  8002b8:	49 01 d8             	add    %rbx,%r8
+  8002bb:	41 ff d0             	call   *%r8
+	wait(r);
+  8002be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002c1:	89 c7                	mov    %eax,%edi
+  8002c3:	49 89 df             	mov    %rbx,%r15
+  8002c6:	48 b8 6b c2 ff ff ff 	movabs $0xffffffffffffc26b,%rax
+  8002cd:	ff ff ff 
+  8002d0:	48 01 d8             	add    %rbx,%rax
+  8002d3:	ff d0                	call   *%rax
+	
+	cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  8002d5:	48 b8 28 00 00 00 00 	movabs $0x28,%rax
+  8002dc:	00 00 00 
+  8002df:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8002e3:	48 89 c6             	mov    %rax,%rsi
+  8002e6:	b8 00 00 00 a0       	mov    $0xa0000000,%eax
+  8002eb:	48 89 c7             	mov    %rax,%rdi
+  8002ee:	49 89 df             	mov    %rbx,%r15
+  8002f1:	48 b8 d3 66 ff ff ff 	movabs $0xffffffffffff66d3,%rax
+  8002f8:	ff ff ff 
+  8002fb:	48 01 d8             	add    %rbx,%rax
+  8002fe:	ff d0                	call   *%rax
+  800300:	85 c0                	test   %eax,%eax
+  800302:	75 10                	jne    800314 <umain+0x2d1>
+  800304:	48 b8 6e d1 ff ff ff 	movabs $0xffffffffffffd16e,%rax
+  80030b:	ff ff ff 
+  80030e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800312:	eb 0e                	jmp    800322 <umain+0x2df>
+  800314:	48 b8 74 d1 ff ff ff 	movabs $0xffffffffffffd174,%rax
+  80031b:	ff ff ff 
+  80031e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800322:	48 89 c6             	mov    %rax,%rsi
+  800325:	48 b8 c2 d1 ff ff ff 	movabs $0xffffffffffffd1c2,%rax
+  80032c:	ff ff ff 
+  80032f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	49 89 df             	mov    %rbx,%r15
+  800339:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033e:	48 ba 58 57 ff ff ff 	movabs $0xffffffffffff5758,%rdx
+  800345:	ff ff ff 
+  800348:	48 01 da             	add    %rbx,%rdx
+  80034b:	ff d2                	call   *%rdx
+static __inline void read_gdtr (uint64_t *gdtbase, uint16_t *gdtlimit) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  80034d:	cc                   	int3
+}
+  80034e:	90                   	nop
+
+	breakpoint();
+}
+  80034f:	90                   	nop
+  800350:	48 83 c4 20          	add    $0x20,%rsp
+  800354:	5b                   	pop    %rbx
+  800355:	41 5f                	pop    %r15
+  800357:	5d                   	pop    %rbp
+  800358:	c3                   	ret
+
+0000000000800359 <childofspawn>:
+
+void
+childofspawn(void)
+{
+  800359:	55                   	push   %rbp
+  80035a:	48 89 e5             	mov    %rsp,%rbp
+  80035d:	41 57                	push   %r15
+  80035f:	53                   	push   %rbx
+  800360:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800360 <childofspawn+0x7>
+  800367:	49 bb e0 ac 00 00 00 	movabs $0xace0,%r11
+  80036e:	00 00 00 
+  800371:	4c 01 db             	add    %r11,%rbx
+	strcpy(VA, msg2);
+  800374:	48 b8 28 00 00 00 00 	movabs $0x28,%rax
+  80037b:	00 00 00 
+  80037e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800382:	48 89 c6             	mov    %rax,%rsi
+  800385:	b8 00 00 00 a0       	mov    $0xa0000000,%eax
+  80038a:	48 89 c7             	mov    %rax,%rdi
+  80038d:	49 89 df             	mov    %rbx,%r15
+  800390:	48 b8 1a 65 ff ff ff 	movabs $0xffffffffffff651a,%rax
+  800397:	ff ff ff 
+  80039a:	48 01 d8             	add    %rbx,%rax
+  80039d:	ff d0                	call   *%rax
+	exit();
+  80039f:	49 89 df             	mov    %rbx,%r15
+  8003a2:	48 b8 37 54 ff ff ff 	movabs $0xffffffffffff5437,%rax
+  8003a9:	ff ff ff 
+  8003ac:	48 01 d8             	add    %rbx,%rax
+  8003af:	ff d0                	call   *%rax
+}
+  8003b1:	90                   	nop
+  8003b2:	5b                   	pop    %rbx
+  8003b3:	41 5f                	pop    %r15
+  8003b5:	5d                   	pop    %rbp
+  8003b6:	c3                   	ret
+
+00000000008003b7 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8003b7:	55                   	push   %rbp
+  8003b8:	48 89 e5             	mov    %rsp,%rbp
+  8003bb:	41 57                	push   %r15
+  8003bd:	53                   	push   %rbx
+  8003be:	48 83 ec 20          	sub    $0x20,%rsp
+  8003c2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8003c2 <libmain+0xb>
+  8003c9:	49 bb 7e ac 00 00 00 	movabs $0xac7e,%r11
+  8003d0:	00 00 00 
+  8003d3:	4c 01 db             	add    %r11,%rbx
+  8003d6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8003d9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8003dd:	49 89 df             	mov    %rbx,%r15
+  8003e0:	48 b8 2d 71 ff ff ff 	movabs $0xffffffffffff712d,%rax
+  8003e7:	ff ff ff 
+  8003ea:	48 01 d8             	add    %rbx,%rax
+  8003ed:	ff d0                	call   *%rax
+  8003ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8003f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003f5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003fa:	48 98                	cltq
+  8003fc:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800403:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80040a:	ff ff ff 
+  80040d:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800411:	48 01 c2             	add    %rax,%rdx
+  800414:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  80041b:	00 00 00 
+  80041e:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800422:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800426:	7e 15                	jle    80043d <libmain+0x86>
+		binaryname = argv[0];
+  800428:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80042c:	48 8b 00             	mov    (%rax),%rax
+  80042f:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  800436:	00 00 00 
+  800439:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  80043d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800441:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800444:	48 89 d6             	mov    %rdx,%rsi
+  800447:	89 c7                	mov    %eax,%edi
+  800449:	49 89 df             	mov    %rbx,%r15
+  80044c:	48 b8 03 50 ff ff ff 	movabs $0xffffffffffff5003,%rax
+  800453:	ff ff ff 
+  800456:	48 01 d8             	add    %rbx,%rax
+  800459:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80045b:	49 89 df             	mov    %rbx,%r15
+  80045e:	48 b8 37 54 ff ff ff 	movabs $0xffffffffffff5437,%rax
+  800465:	ff ff ff 
+  800468:	48 01 d8             	add    %rbx,%rax
+  80046b:	ff d0                	call   *%rax
+}
+  80046d:	90                   	nop
+  80046e:	48 83 c4 20          	add    $0x20,%rsp
+  800472:	5b                   	pop    %rbx
+  800473:	41 5f                	pop    %r15
+  800475:	5d                   	pop    %rbp
+  800476:	c3                   	ret
+
+0000000000800477 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800477:	55                   	push   %rbp
+  800478:	48 89 e5             	mov    %rsp,%rbp
+  80047b:	41 57                	push   %r15
+  80047d:	53                   	push   %rbx
+  80047e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80047e <exit+0x7>
+  800485:	49 bb c2 ab 00 00 00 	movabs $0xabc2,%r11
+  80048c:	00 00 00 
+  80048f:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800492:	49 89 df             	mov    %rbx,%r15
+  800495:	48 b8 36 89 ff ff ff 	movabs $0xffffffffffff8936,%rax
+  80049c:	ff ff ff 
+  80049f:	48 01 d8             	add    %rbx,%rax
+  8004a2:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8004a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004a9:	49 89 df             	mov    %rbx,%r15
+  8004ac:	48 b8 d1 70 ff ff ff 	movabs $0xffffffffffff70d1,%rax
+  8004b3:	ff ff ff 
+  8004b6:	48 01 d8             	add    %rbx,%rax
+  8004b9:	ff d0                	call   *%rax
+}
+  8004bb:	90                   	nop
+  8004bc:	5b                   	pop    %rbx
+  8004bd:	41 5f                	pop    %r15
+  8004bf:	5d                   	pop    %rbp
+  8004c0:	c3                   	ret
+
+00000000008004c1 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8004c1:	55                   	push   %rbp
+  8004c2:	48 89 e5             	mov    %rsp,%rbp
+  8004c5:	41 57                	push   %r15
+  8004c7:	41 54                	push   %r12
+  8004c9:	53                   	push   %rbx
+  8004ca:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8004d1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004d1 <_panic+0x10>
+  8004d8:	49 bb 6f ab 00 00 00 	movabs $0xab6f,%r11
+  8004df:	00 00 00 
+  8004e2:	4c 01 db             	add    %r11,%rbx
+  8004e5:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8004ec:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8004f2:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8004f9:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800500:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800507:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80050e:	84 c0                	test   %al,%al
+  800510:	74 26                	je     800538 <_panic+0x77>
+  800512:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800519:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800520:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800524:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800528:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80052c:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800530:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800534:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800538:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80053f:	00 00 00 
+  800542:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800549:	00 00 00 
+  80054c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800550:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800557:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80055e:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800565:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  80056c:	ff ff ff 
+  80056f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800573:	4c 8b 20             	mov    (%rax),%r12
+  800576:	49 89 df             	mov    %rbx,%r15
+  800579:	48 b8 2d 71 ff ff ff 	movabs $0xffffffffffff712d,%rax
+  800580:	ff ff ff 
+  800583:	48 01 d8             	add    %rbx,%rax
+  800586:	ff d0                	call   *%rax
+  800588:	89 c6                	mov    %eax,%esi
+  80058a:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800590:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800597:	41 89 d0             	mov    %edx,%r8d
+  80059a:	48 89 c1             	mov    %rax,%rcx
+  80059d:	4c 89 e2             	mov    %r12,%rdx
+  8005a0:	48 b8 e8 d1 ff ff ff 	movabs $0xffffffffffffd1e8,%rax
+  8005a7:	ff ff ff 
+  8005aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005ae:	48 89 c7             	mov    %rax,%rdi
+  8005b1:	49 89 df             	mov    %rbx,%r15
+  8005b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b9:	49 b9 58 57 ff ff ff 	movabs $0xffffffffffff5758,%r9
+  8005c0:	ff ff ff 
+  8005c3:	49 01 d9             	add    %rbx,%r9
+  8005c6:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8005c9:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8005d0:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8005d7:	48 89 d6             	mov    %rdx,%rsi
+  8005da:	48 89 c7             	mov    %rax,%rdi
+  8005dd:	49 89 df             	mov    %rbx,%r15
+  8005e0:	48 b8 78 56 ff ff ff 	movabs $0xffffffffffff5678,%rax
+  8005e7:	ff ff ff 
+  8005ea:	48 01 d8             	add    %rbx,%rax
+  8005ed:	ff d0                	call   *%rax
+	cprintf("\n");
+  8005ef:	48 b8 0b d2 ff ff ff 	movabs $0xffffffffffffd20b,%rax
+  8005f6:	ff ff ff 
+  8005f9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005fd:	48 89 c7             	mov    %rax,%rdi
+  800600:	49 89 df             	mov    %rbx,%r15
+  800603:	b8 00 00 00 00       	mov    $0x0,%eax
+  800608:	48 ba 58 57 ff ff ff 	movabs $0xffffffffffff5758,%rdx
+  80060f:	ff ff ff 
+  800612:	48 01 da             	add    %rbx,%rdx
+  800615:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800617:	cc                   	int3
+  800618:	eb fd                	jmp    800617 <_panic+0x156>
+
+000000000080061a <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  80061a:	55                   	push   %rbp
+  80061b:	48 89 e5             	mov    %rsp,%rbp
+  80061e:	41 57                	push   %r15
+  800620:	48 83 ec 18          	sub    $0x18,%rsp
+  800624:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800624 <putch+0xa>
+  80062b:	49 bb 1c aa 00 00 00 	movabs $0xaa1c,%r11
+  800632:	00 00 00 
+  800635:	4c 01 d8             	add    %r11,%rax
+  800638:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80063b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80063f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800643:	8b 12                	mov    (%rdx),%edx
+  800645:	8d 72 01             	lea    0x1(%rdx),%esi
+  800648:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80064c:	89 31                	mov    %esi,(%rcx)
+  80064e:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800651:	89 ce                	mov    %ecx,%esi
+  800653:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800657:	48 63 d2             	movslq %edx,%rdx
+  80065a:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80065f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800663:	8b 12                	mov    (%rdx),%edx
+  800665:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80066b:	75 33                	jne    8006a0 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80066d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800671:	8b 12                	mov    (%rdx),%edx
+  800673:	48 63 d2             	movslq %edx,%rdx
+  800676:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80067a:	48 83 c1 08          	add    $0x8,%rcx
+  80067e:	48 89 d6             	mov    %rdx,%rsi
+  800681:	48 89 cf             	mov    %rcx,%rdi
+  800684:	49 89 c7             	mov    %rax,%r15
+  800687:	48 ba 1e 70 ff ff ff 	movabs $0xffffffffffff701e,%rdx
+  80068e:	ff ff ff 
+  800691:	48 01 c2             	add    %rax,%rdx
+  800694:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800696:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80069a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8006a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8006a4:	8b 40 04             	mov    0x4(%rax),%eax
+  8006a7:	8d 50 01             	lea    0x1(%rax),%edx
+  8006aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8006ae:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8006b1:	90                   	nop
+  8006b2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8006b6:	c9                   	leave
+  8006b7:	c3                   	ret
+
+00000000008006b8 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8006b8:	55                   	push   %rbp
+  8006b9:	48 89 e5             	mov    %rsp,%rbp
+  8006bc:	41 57                	push   %r15
+  8006be:	53                   	push   %rbx
+  8006bf:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8006c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8006c6 <vcprintf+0xe>
+  8006cd:	49 bb 7a a9 00 00 00 	movabs $0xa97a,%r11
+  8006d4:	00 00 00 
+  8006d7:	4c 01 db             	add    %r11,%rbx
+  8006da:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  8006e1:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8006e8:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8006ef:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8006f6:	48 8b 06             	mov    (%rsi),%rax
+  8006f9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006fd:	48 89 01             	mov    %rax,(%rcx)
+  800700:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800704:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800708:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  80070c:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800713:	00 00 00 
+    b.cnt = 0;
+  800716:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80071d:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800720:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800727:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  80072e:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800735:	48 89 c6             	mov    %rax,%rsi
+  800738:	48 b8 da 55 ff ff ff 	movabs $0xffffffffffff55da,%rax
+  80073f:	ff ff ff 
+  800742:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800746:	48 89 c7             	mov    %rax,%rdi
+  800749:	49 89 df             	mov    %rbx,%r15
+  80074c:	48 b8 9c 5b ff ff ff 	movabs $0xffffffffffff5b9c,%rax
+  800753:	ff ff ff 
+  800756:	48 01 d8             	add    %rbx,%rax
+  800759:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  80075b:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800761:	48 98                	cltq
+  800763:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  80076a:	48 83 c2 08          	add    $0x8,%rdx
+  80076e:	48 89 c6             	mov    %rax,%rsi
+  800771:	48 89 d7             	mov    %rdx,%rdi
+  800774:	49 89 df             	mov    %rbx,%r15
+  800777:	48 b8 1e 70 ff ff ff 	movabs $0xffffffffffff701e,%rax
+  80077e:	ff ff ff 
+  800781:	48 01 d8             	add    %rbx,%rax
+  800784:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800786:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  80078c:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800793:	5b                   	pop    %rbx
+  800794:	41 5f                	pop    %r15
+  800796:	5d                   	pop    %rbp
+  800797:	c3                   	ret
+
+0000000000800798 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800798:	55                   	push   %rbp
+  800799:	48 89 e5             	mov    %rsp,%rbp
+  80079c:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8007a3:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8007a3 <cprintf+0xb>
+  8007aa:	49 bb 9d a8 00 00 00 	movabs $0xa89d,%r11
+  8007b1:	00 00 00 
+  8007b4:	4d 01 da             	add    %r11,%r10
+  8007b7:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8007be:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8007c5:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8007cc:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8007d3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8007da:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8007e1:	84 c0                	test   %al,%al
+  8007e3:	74 20                	je     800805 <cprintf+0x6d>
+  8007e5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8007e9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8007ed:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8007f1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8007f5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8007f9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8007fd:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800801:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800805:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80080c:	00 00 00 
+  80080f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800816:	00 00 00 
+  800819:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80081d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800824:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80082b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800832:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800839:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800840:	48 8b 06             	mov    (%rsi),%rax
+  800843:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800847:	48 89 01             	mov    %rax,(%rcx)
+  80084a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80084e:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800852:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800856:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80085d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800864:	48 89 d6             	mov    %rdx,%rsi
+  800867:	48 89 c7             	mov    %rax,%rdi
+  80086a:	48 b8 78 56 ff ff ff 	movabs $0xffffffffffff5678,%rax
+  800871:	ff ff ff 
+  800874:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800878:	ff d0                	call   *%rax
+  80087a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800880:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800886:	c9                   	leave
+  800887:	c3                   	ret
+
+0000000000800888 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800888:	55                   	push   %rbp
+  800889:	48 89 e5             	mov    %rsp,%rbp
+  80088c:	53                   	push   %rbx
+  80088d:	48 83 ec 38          	sub    $0x38,%rsp
+  800891:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800891 <printnum+0x9>
+  800898:	49 bb af a7 00 00 00 	movabs $0xa7af,%r11
+  80089f:	00 00 00 
+  8008a2:	4c 01 db             	add    %r11,%rbx
+  8008a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8008a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8008ad:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8008b1:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8008b4:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8008b8:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8008bc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8008bf:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8008c3:	72 58                	jb     80091d <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8008c5:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8008c8:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8008cb:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8008ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008d7:	48 f7 f6             	div    %rsi
+  8008da:	49 89 c2             	mov    %rax,%r10
+  8008dd:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8008e0:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8008e3:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8008e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008eb:	41 89 c9             	mov    %ecx,%r9d
+  8008ee:	41 89 f8             	mov    %edi,%r8d
+  8008f1:	89 d1                	mov    %edx,%ecx
+  8008f3:	4c 89 d2             	mov    %r10,%rdx
+  8008f6:	48 89 c7             	mov    %rax,%rdi
+  8008f9:	48 b8 48 58 ff ff ff 	movabs $0xffffffffffff5848,%rax
+  800900:	ff ff ff 
+  800903:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800907:	ff d0                	call   *%rax
+  800909:	eb 1c                	jmp    800927 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80090b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80090f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800912:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800916:	48 89 d6             	mov    %rdx,%rsi
+  800919:	89 c7                	mov    %eax,%edi
+  80091b:	ff d1                	call   *%rcx
+		while (--width > 0)
+  80091d:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800921:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800925:	7f e4                	jg     80090b <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800927:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80092a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80092e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800933:	48 f7 f1             	div    %rcx
+  800936:	48 b8 47 d3 ff ff ff 	movabs $0xffffffffffffd347,%rax
+  80093d:	ff ff ff 
+  800940:	48 01 d8             	add    %rbx,%rax
+  800943:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800947:	0f be c0             	movsbl %al,%eax
+  80094a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80094e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800952:	48 89 d6             	mov    %rdx,%rsi
+  800955:	89 c7                	mov    %eax,%edi
+  800957:	ff d1                	call   *%rcx
+}
+  800959:	90                   	nop
+  80095a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80095e:	c9                   	leave
+  80095f:	c3                   	ret
+
+0000000000800960 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800960:	55                   	push   %rbp
+  800961:	48 89 e5             	mov    %rsp,%rbp
+  800964:	48 83 ec 20          	sub    $0x20,%rsp
+  800968:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800968 <getuint+0x8>
+  80096f:	49 bb d8 a6 00 00 00 	movabs $0xa6d8,%r11
+  800976:	00 00 00 
+  800979:	4c 01 d8             	add    %r11,%rax
+  80097c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800980:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800983:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800987:	7e 4f                	jle    8009d8 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800989:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80098d:	8b 00                	mov    (%rax),%eax
+  80098f:	83 f8 2f             	cmp    $0x2f,%eax
+  800992:	77 24                	ja     8009b8 <getuint+0x58>
+  800994:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800998:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80099c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009a0:	8b 00                	mov    (%rax),%eax
+  8009a2:	89 c0                	mov    %eax,%eax
+  8009a4:	48 01 d0             	add    %rdx,%rax
+  8009a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009ab:	8b 12                	mov    (%rdx),%edx
+  8009ad:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009b0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009b4:	89 0a                	mov    %ecx,(%rdx)
+  8009b6:	eb 14                	jmp    8009cc <getuint+0x6c>
+  8009b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009bc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009c0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009c4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009c8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009cc:	48 8b 00             	mov    (%rax),%rax
+  8009cf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009d3:	e9 9d 00 00 00       	jmp    800a75 <getuint+0x115>
+	else if (lflag)
+  8009d8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8009dc:	74 4c                	je     800a2a <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  8009de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009e2:	8b 00                	mov    (%rax),%eax
+  8009e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e7:	77 24                	ja     800a0d <getuint+0xad>
+  8009e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ed:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009f5:	8b 00                	mov    (%rax),%eax
+  8009f7:	89 c0                	mov    %eax,%eax
+  8009f9:	48 01 d0             	add    %rdx,%rax
+  8009fc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a00:	8b 12                	mov    (%rdx),%edx
+  800a02:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a05:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a09:	89 0a                	mov    %ecx,(%rdx)
+  800a0b:	eb 14                	jmp    800a21 <getuint+0xc1>
+  800a0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a11:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a15:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a19:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a1d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a21:	48 8b 00             	mov    (%rax),%rax
+  800a24:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a28:	eb 4b                	jmp    800a75 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800a2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a2e:	8b 00                	mov    (%rax),%eax
+  800a30:	83 f8 2f             	cmp    $0x2f,%eax
+  800a33:	77 24                	ja     800a59 <getuint+0xf9>
+  800a35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a39:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a41:	8b 00                	mov    (%rax),%eax
+  800a43:	89 c0                	mov    %eax,%eax
+  800a45:	48 01 d0             	add    %rdx,%rax
+  800a48:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a4c:	8b 12                	mov    (%rdx),%edx
+  800a4e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a51:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a55:	89 0a                	mov    %ecx,(%rdx)
+  800a57:	eb 14                	jmp    800a6d <getuint+0x10d>
+  800a59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a5d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a61:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a65:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a69:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a6d:	8b 00                	mov    (%rax),%eax
+  800a6f:	89 c0                	mov    %eax,%eax
+  800a71:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800a75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a79:	c9                   	leave
+  800a7a:	c3                   	ret
+
+0000000000800a7b <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800a7b:	55                   	push   %rbp
+  800a7c:	48 89 e5             	mov    %rsp,%rbp
+  800a7f:	48 83 ec 20          	sub    $0x20,%rsp
+  800a83:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a83 <printfloat+0x8>
+  800a8a:	49 bb bd a5 00 00 00 	movabs $0xa5bd,%r11
+  800a91:	00 00 00 
+  800a94:	4c 01 d8             	add    %r11,%rax
+  800a97:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a9b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800a9f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800aa3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa7:	48 85 c0             	test   %rax,%rax
+  800aaa:	79 12                	jns    800abe <printfloat+0x43>
+		putch('-',putdat);
+  800aac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ab0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ab4:	48 89 c6             	mov    %rax,%rsi
+  800ab7:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800abc:	ff d2                	call   *%rdx
+	
+}
+  800abe:	90                   	nop
+  800abf:	c9                   	leave
+  800ac0:	c3                   	ret
+
+0000000000800ac1 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800ac1:	55                   	push   %rbp
+  800ac2:	48 89 e5             	mov    %rsp,%rbp
+  800ac5:	48 83 ec 20          	sub    $0x20,%rsp
+  800ac9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ac9 <getint+0x8>
+  800ad0:	49 bb 77 a5 00 00 00 	movabs $0xa577,%r11
+  800ad7:	00 00 00 
+  800ada:	4c 01 d8             	add    %r11,%rax
+  800add:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ae1:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800ae4:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800ae8:	7e 4f                	jle    800b39 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800aea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aee:	8b 00                	mov    (%rax),%eax
+  800af0:	83 f8 2f             	cmp    $0x2f,%eax
+  800af3:	77 24                	ja     800b19 <getint+0x58>
+  800af5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800af9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800afd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b01:	8b 00                	mov    (%rax),%eax
+  800b03:	89 c0                	mov    %eax,%eax
+  800b05:	48 01 d0             	add    %rdx,%rax
+  800b08:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b0c:	8b 12                	mov    (%rdx),%edx
+  800b0e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b11:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b15:	89 0a                	mov    %ecx,(%rdx)
+  800b17:	eb 14                	jmp    800b2d <getint+0x6c>
+  800b19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b1d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b21:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b25:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b29:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b2d:	48 8b 00             	mov    (%rax),%rax
+  800b30:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b34:	e9 9d 00 00 00       	jmp    800bd6 <getint+0x115>
+	else if (lflag)
+  800b39:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800b3d:	74 4c                	je     800b8b <getint+0xca>
+		x=va_arg(*ap, long);
+  800b3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b43:	8b 00                	mov    (%rax),%eax
+  800b45:	83 f8 2f             	cmp    $0x2f,%eax
+  800b48:	77 24                	ja     800b6e <getint+0xad>
+  800b4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b4e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b56:	8b 00                	mov    (%rax),%eax
+  800b58:	89 c0                	mov    %eax,%eax
+  800b5a:	48 01 d0             	add    %rdx,%rax
+  800b5d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b61:	8b 12                	mov    (%rdx),%edx
+  800b63:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b66:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b6a:	89 0a                	mov    %ecx,(%rdx)
+  800b6c:	eb 14                	jmp    800b82 <getint+0xc1>
+  800b6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b72:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b76:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b7a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b7e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b82:	48 8b 00             	mov    (%rax),%rax
+  800b85:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b89:	eb 4b                	jmp    800bd6 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800b8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b8f:	8b 00                	mov    (%rax),%eax
+  800b91:	83 f8 2f             	cmp    $0x2f,%eax
+  800b94:	77 24                	ja     800bba <getint+0xf9>
+  800b96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b9a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba2:	8b 00                	mov    (%rax),%eax
+  800ba4:	89 c0                	mov    %eax,%eax
+  800ba6:	48 01 d0             	add    %rdx,%rax
+  800ba9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bad:	8b 12                	mov    (%rdx),%edx
+  800baf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800bb2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bb6:	89 0a                	mov    %ecx,(%rdx)
+  800bb8:	eb 14                	jmp    800bce <getint+0x10d>
+  800bba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bbe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800bc2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800bc6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bca:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800bce:	8b 00                	mov    (%rax),%eax
+  800bd0:	48 98                	cltq
+  800bd2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800bd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800bda:	c9                   	leave
+  800bdb:	c3                   	ret
+
+0000000000800bdc <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800bdc:	55                   	push   %rbp
+  800bdd:	48 89 e5             	mov    %rsp,%rbp
+  800be0:	41 57                	push   %r15
+  800be2:	41 55                	push   %r13
+  800be4:	41 54                	push   %r12
+  800be6:	53                   	push   %rbx
+  800be7:	48 83 ec 60          	sub    $0x60,%rsp
+  800beb:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800beb <vprintfmt+0xf>
+  800bf2:	49 bb 55 a4 00 00 00 	movabs $0xa455,%r11
+  800bf9:	00 00 00 
+  800bfc:	4d 01 dc             	add    %r11,%r12
+  800bff:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800c03:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800c07:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c0b:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800c0f:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800c16:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800c1a:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800c1e:	48 8b 06             	mov    (%rsi),%rax
+  800c21:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800c25:	48 89 01             	mov    %rax,(%rcx)
+  800c28:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800c2c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800c30:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c34:	eb 17                	jmp    800c4d <vprintfmt+0x71>
+			if (ch == '\0')
+  800c36:	85 db                	test   %ebx,%ebx
+  800c38:	0f 84 97 05 00 00    	je     8011d5 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800c3e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c42:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c46:	48 89 c6             	mov    %rax,%rsi
+  800c49:	89 df                	mov    %ebx,%edi
+  800c4b:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c4d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c51:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c55:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c59:	0f b6 00             	movzbl (%rax),%eax
+  800c5c:	0f b6 d8             	movzbl %al,%ebx
+  800c5f:	83 fb 25             	cmp    $0x25,%ebx
+  800c62:	75 d2                	jne    800c36 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800c64:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800c68:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800c6f:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800c76:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800c7d:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800c84:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c88:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c8c:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c90:	0f b6 00             	movzbl (%rax),%eax
+  800c93:	0f b6 d8             	movzbl %al,%ebx
+  800c96:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800c99:	83 f8 55             	cmp    $0x55,%eax
+  800c9c:	0f 87 00 05 00 00    	ja     8011a2 <vprintfmt+0x5c6>
+  800ca2:	89 c0                	mov    %eax,%eax
+  800ca4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800cab:	00 
+  800cac:	48 8d 05 fd 76 00 00 	lea    0x76fd(%rip),%rax        # 8083b0 <.LC18+0xc>
+  800cb3:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800cb7:	48 8d 15 f2 76 00 00 	lea    0x76f2(%rip),%rdx        # 8083b0 <.LC18+0xc>
+  800cbe:	48 01 d0             	add    %rdx,%rax
+  800cc1:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800cc3:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800cc7:	eb bb                	jmp    800c84 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800cc9:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800ccd:	eb b5                	jmp    800c84 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800ccf:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800cd6:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800cd9:	89 d0                	mov    %edx,%eax
+  800cdb:	c1 e0 02             	shl    $0x2,%eax
+  800cde:	01 d0                	add    %edx,%eax
+  800ce0:	01 c0                	add    %eax,%eax
+  800ce2:	01 d8                	add    %ebx,%eax
+  800ce4:	83 e8 30             	sub    $0x30,%eax
+  800ce7:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800cea:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800cee:	0f b6 00             	movzbl (%rax),%eax
+  800cf1:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800cf4:	83 fb 2f             	cmp    $0x2f,%ebx
+  800cf7:	7e 60                	jle    800d59 <vprintfmt+0x17d>
+  800cf9:	83 fb 39             	cmp    $0x39,%ebx
+  800cfc:	7f 5b                	jg     800d59 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800cfe:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800d03:	eb d1                	jmp    800cd6 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800d05:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d08:	83 f8 2f             	cmp    $0x2f,%eax
+  800d0b:	77 17                	ja     800d24 <vprintfmt+0x148>
+  800d0d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d11:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d14:	89 d2                	mov    %edx,%edx
+  800d16:	48 01 d0             	add    %rdx,%rax
+  800d19:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d1c:	83 c2 08             	add    $0x8,%edx
+  800d1f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d22:	eb 0c                	jmp    800d30 <vprintfmt+0x154>
+  800d24:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d28:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d2c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d30:	8b 00                	mov    (%rax),%eax
+  800d32:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800d35:	eb 23                	jmp    800d5a <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800d37:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d3b:	0f 89 43 ff ff ff    	jns    800c84 <vprintfmt+0xa8>
+				width = 0;
+  800d41:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800d48:	e9 37 ff ff ff       	jmp    800c84 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800d4d:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800d54:	e9 2b ff ff ff       	jmp    800c84 <vprintfmt+0xa8>
+			goto process_precision;
+  800d59:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800d5a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d5e:	0f 89 20 ff ff ff    	jns    800c84 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800d64:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800d67:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800d6a:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800d71:	e9 0e ff ff ff       	jmp    800c84 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800d76:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800d7a:	e9 05 ff ff ff       	jmp    800c84 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800d7f:	83 fb 39             	cmp    $0x39,%ebx
+  800d82:	7f 0b                	jg     800d8f <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800d84:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800d87:	c1 e0 08             	shl    $0x8,%eax
+  800d8a:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d8d:	eb 21                	jmp    800db0 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800d8f:	83 fb 60             	cmp    $0x60,%ebx
+  800d92:	7e 10                	jle    800da4 <vprintfmt+0x1c8>
+  800d94:	83 fb 66             	cmp    $0x66,%ebx
+  800d97:	7f 0b                	jg     800da4 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800d99:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800d9c:	c1 e0 08             	shl    $0x8,%eax
+  800d9f:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800da2:	eb 0c                	jmp    800db0 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800da4:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800dab:	e9 04 01 00 00       	jmp    800eb4 <vprintfmt+0x2d8>
+  800db0:	e9 ff 00 00 00       	jmp    800eb4 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800db5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800db8:	83 f8 2f             	cmp    $0x2f,%eax
+  800dbb:	77 17                	ja     800dd4 <vprintfmt+0x1f8>
+  800dbd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800dc1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dc4:	89 d2                	mov    %edx,%edx
+  800dc6:	48 01 d0             	add    %rdx,%rax
+  800dc9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dcc:	83 c2 08             	add    $0x8,%edx
+  800dcf:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800dd2:	eb 0c                	jmp    800de0 <vprintfmt+0x204>
+  800dd4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dd8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ddc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800de0:	8b 00                	mov    (%rax),%eax
+  800de2:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800de6:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800dea:	48 89 d6             	mov    %rdx,%rsi
+  800ded:	89 c7                	mov    %eax,%edi
+  800def:	ff d1                	call   *%rcx
+			break;
+  800df1:	e9 da 03 00 00       	jmp    8011d0 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800df6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800df9:	83 f8 2f             	cmp    $0x2f,%eax
+  800dfc:	77 17                	ja     800e15 <vprintfmt+0x239>
+  800dfe:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e02:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e05:	89 d2                	mov    %edx,%edx
+  800e07:	48 01 d0             	add    %rdx,%rax
+  800e0a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e0d:	83 c2 08             	add    $0x8,%edx
+  800e10:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e13:	eb 0c                	jmp    800e21 <vprintfmt+0x245>
+  800e15:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e19:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e1d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e21:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800e23:	85 db                	test   %ebx,%ebx
+  800e25:	79 02                	jns    800e29 <vprintfmt+0x24d>
+				err = -err;
+  800e27:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800e29:	83 fb 15             	cmp    $0x15,%ebx
+  800e2c:	7f 19                	jg     800e47 <vprintfmt+0x26b>
+  800e2e:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800e35:	00 00 00 
+  800e38:	48 63 c3             	movslq %ebx,%rax
+  800e3b:	4c 01 e2             	add    %r12,%rdx
+  800e3e:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800e42:	4d 85 ed             	test   %r13,%r13
+  800e45:	75 36                	jne    800e7d <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800e47:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e4b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e4f:	89 d9                	mov    %ebx,%ecx
+  800e51:	48 ba 58 d3 ff ff ff 	movabs $0xffffffffffffd358,%rdx
+  800e58:	ff ff ff 
+  800e5b:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e5f:	48 89 c7             	mov    %rax,%rdi
+  800e62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e67:	49 b8 a3 61 ff ff ff 	movabs $0xffffffffffff61a3,%r8
+  800e6e:	ff ff ff 
+  800e71:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e75:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800e78:	e9 53 03 00 00       	jmp    8011d0 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800e7d:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e81:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e85:	4c 89 e9             	mov    %r13,%rcx
+  800e88:	48 ba 61 d3 ff ff ff 	movabs $0xffffffffffffd361,%rdx
+  800e8f:	ff ff ff 
+  800e92:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e96:	48 89 c7             	mov    %rax,%rdi
+  800e99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e9e:	49 b8 a3 61 ff ff ff 	movabs $0xffffffffffff61a3,%r8
+  800ea5:	ff ff ff 
+  800ea8:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800eac:	41 ff d0             	call   *%r8
+			break;
+  800eaf:	e9 1c 03 00 00       	jmp    8011d0 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800eb4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800eb7:	83 f8 2f             	cmp    $0x2f,%eax
+  800eba:	77 17                	ja     800ed3 <vprintfmt+0x2f7>
+  800ebc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ec0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ec3:	89 d2                	mov    %edx,%edx
+  800ec5:	48 01 d0             	add    %rdx,%rax
+  800ec8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ecb:	83 c2 08             	add    $0x8,%edx
+  800ece:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ed1:	eb 0c                	jmp    800edf <vprintfmt+0x303>
+  800ed3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ed7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800edb:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800edf:	4c 8b 28             	mov    (%rax),%r13
+  800ee2:	4d 85 ed             	test   %r13,%r13
+  800ee5:	75 0e                	jne    800ef5 <vprintfmt+0x319>
+				p = "(null)";
+  800ee7:	48 b8 64 d3 ff ff ff 	movabs $0xffffffffffffd364,%rax
+  800eee:	ff ff ff 
+  800ef1:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800ef5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ef9:	0f 8e 84 00 00 00    	jle    800f83 <vprintfmt+0x3a7>
+  800eff:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800f03:	74 7e                	je     800f83 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f05:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f08:	48 98                	cltq
+  800f0a:	48 89 c6             	mov    %rax,%rsi
+  800f0d:	4c 89 ef             	mov    %r13,%rdi
+  800f10:	4d 89 e7             	mov    %r12,%r15
+  800f13:	48 b8 c8 64 ff ff ff 	movabs $0xffffffffffff64c8,%rax
+  800f1a:	ff ff ff 
+  800f1d:	4c 01 e0             	add    %r12,%rax
+  800f20:	ff d0                	call   *%rax
+  800f22:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800f25:	eb 17                	jmp    800f3e <vprintfmt+0x362>
+					putch(padc, putdat);
+  800f27:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800f2b:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800f2f:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800f33:	48 89 d6             	mov    %rdx,%rsi
+  800f36:	89 c7                	mov    %eax,%edi
+  800f38:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f3a:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f3e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f42:	7f e3                	jg     800f27 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f44:	eb 3d                	jmp    800f83 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800f46:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800f4a:	74 1e                	je     800f6a <vprintfmt+0x38e>
+  800f4c:	83 fb 1f             	cmp    $0x1f,%ebx
+  800f4f:	7e 05                	jle    800f56 <vprintfmt+0x37a>
+  800f51:	83 fb 7e             	cmp    $0x7e,%ebx
+  800f54:	7e 14                	jle    800f6a <vprintfmt+0x38e>
+					putch('?', putdat);
+  800f56:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f5a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f5e:	48 89 c6             	mov    %rax,%rsi
+  800f61:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800f66:	ff d2                	call   *%rdx
+  800f68:	eb 15                	jmp    800f7f <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800f6a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800f6d:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800f70:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f74:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f78:	48 89 c6             	mov    %rax,%rsi
+  800f7b:	89 cf                	mov    %ecx,%edi
+  800f7d:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f7f:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f83:	4c 89 e8             	mov    %r13,%rax
+  800f86:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800f8a:	0f b6 00             	movzbl (%rax),%eax
+  800f8d:	0f be d8             	movsbl %al,%ebx
+  800f90:	85 db                	test   %ebx,%ebx
+  800f92:	74 28                	je     800fbc <vprintfmt+0x3e0>
+  800f94:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f98:	78 ac                	js     800f46 <vprintfmt+0x36a>
+  800f9a:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800f9e:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800fa2:	79 a2                	jns    800f46 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800fa4:	eb 16                	jmp    800fbc <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800fa6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800faa:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fae:	48 89 c6             	mov    %rax,%rsi
+  800fb1:	bf 20 00 00 00       	mov    $0x20,%edi
+  800fb6:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800fb8:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800fbc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800fc0:	7f e4                	jg     800fa6 <vprintfmt+0x3ca>
+			break;
+  800fc2:	e9 09 02 00 00       	jmp    8011d0 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800fc7:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800fcb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800fcf:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800fd3:	0f b6 00             	movzbl (%rax),%eax
+  800fd6:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800fd9:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800fda:	83 fb 2f             	cmp    $0x2f,%ebx
+  800fdd:	0f 8e ac fd ff ff    	jle    800d8f <vprintfmt+0x1b3>
+  800fe3:	e9 97 fd ff ff       	jmp    800d7f <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800fe8:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fec:	be 03 00 00 00       	mov    $0x3,%esi
+  800ff1:	48 89 c7             	mov    %rax,%rdi
+  800ff4:	48 b8 81 5a ff ff ff 	movabs $0xffffffffffff5a81,%rax
+  800ffb:	ff ff ff 
+  800ffe:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801002:	ff d0                	call   *%rax
+  801004:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  801008:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80100c:	48 85 c0             	test   %rax,%rax
+  80100f:	79 1d                	jns    80102e <vprintfmt+0x452>
+				putch('-', putdat);
+  801011:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801015:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801019:	48 89 c6             	mov    %rax,%rsi
+  80101c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801021:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  801023:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801027:	48 f7 d8             	neg    %rax
+  80102a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  80102e:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801035:	e9 de 00 00 00       	jmp    801118 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  80103a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80103e:	be 03 00 00 00       	mov    $0x3,%esi
+  801043:	48 89 c7             	mov    %rax,%rdi
+  801046:	48 b8 20 59 ff ff ff 	movabs $0xffffffffffff5920,%rax
+  80104d:	ff ff ff 
+  801050:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801054:	ff d0                	call   *%rax
+  801056:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  80105a:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801061:	e9 b2 00 00 00       	jmp    801118 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  801066:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80106a:	be 03 00 00 00       	mov    $0x3,%esi
+  80106f:	48 89 c7             	mov    %rax,%rdi
+  801072:	48 b8 20 59 ff ff ff 	movabs $0xffffffffffff5920,%rax
+  801079:	ff ff ff 
+  80107c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801080:	ff d0                	call   *%rax
+  801082:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801086:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  80108d:	e9 86 00 00 00       	jmp    801118 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  801092:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801096:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80109a:	48 89 c6             	mov    %rax,%rsi
+  80109d:	bf 30 00 00 00       	mov    $0x30,%edi
+  8010a2:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  8010a4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010a8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010ac:	48 89 c6             	mov    %rax,%rsi
+  8010af:	bf 78 00 00 00       	mov    $0x78,%edi
+  8010b4:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  8010b6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8010b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8010bc:	77 17                	ja     8010d5 <vprintfmt+0x4f9>
+  8010be:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8010c2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8010c5:	89 d2                	mov    %edx,%edx
+  8010c7:	48 01 d0             	add    %rdx,%rax
+  8010ca:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8010cd:	83 c2 08             	add    $0x8,%edx
+  8010d0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8010d3:	eb 0c                	jmp    8010e1 <vprintfmt+0x505>
+  8010d5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8010d9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8010dd:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8010e1:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  8010e4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8010e8:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8010ef:	eb 27                	jmp    801118 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8010f1:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010f5:	be 03 00 00 00       	mov    $0x3,%esi
+  8010fa:	48 89 c7             	mov    %rax,%rdi
+  8010fd:	48 b8 20 59 ff ff ff 	movabs $0xffffffffffff5920,%rax
+  801104:	ff ff ff 
+  801107:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80110b:	ff d0                	call   *%rax
+  80110d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801111:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801118:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  80111d:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  801120:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801123:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801127:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80112b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80112f:	45 89 c1             	mov    %r8d,%r9d
+  801132:	41 89 f8             	mov    %edi,%r8d
+  801135:	48 89 c7             	mov    %rax,%rdi
+  801138:	48 b8 48 58 ff ff ff 	movabs $0xffffffffffff5848,%rax
+  80113f:	ff ff ff 
+  801142:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801146:	ff d0                	call   *%rax
+			break;
+  801148:	e9 83 00 00 00       	jmp    8011d0 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  80114d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801151:	be 03 00 00 00       	mov    $0x3,%esi
+  801156:	48 89 c7             	mov    %rax,%rdi
+  801159:	48 b8 20 59 ff ff ff 	movabs $0xffffffffffff5920,%rax
+  801160:	ff ff ff 
+  801163:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801167:	ff d0                	call   *%rax
+  801169:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  80116d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801171:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801175:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801179:	48 89 ce             	mov    %rcx,%rsi
+  80117c:	48 89 c7             	mov    %rax,%rdi
+  80117f:	48 b8 3b 5a ff ff ff 	movabs $0xffffffffffff5a3b,%rax
+  801186:	ff ff ff 
+  801189:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80118d:	ff d0                	call   *%rax
+	
+			break;
+  80118f:	eb 3f                	jmp    8011d0 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801191:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801195:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801199:	48 89 c6             	mov    %rax,%rsi
+  80119c:	89 df                	mov    %ebx,%edi
+  80119e:	ff d2                	call   *%rdx
+			break;
+  8011a0:	eb 2e                	jmp    8011d0 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  8011a2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8011a6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8011aa:	48 89 c6             	mov    %rax,%rsi
+  8011ad:	bf 25 00 00 00       	mov    $0x25,%edi
+  8011b2:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8011b4:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8011b9:	eb 05                	jmp    8011c0 <vprintfmt+0x5e4>
+  8011bb:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8011c0:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8011c4:	48 83 e8 01          	sub    $0x1,%rax
+  8011c8:	0f b6 00             	movzbl (%rax),%eax
+  8011cb:	3c 25                	cmp    $0x25,%al
+  8011cd:	75 ec                	jne    8011bb <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  8011cf:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8011d0:	e9 78 fa ff ff       	jmp    800c4d <vprintfmt+0x71>
+				return;
+  8011d5:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  8011d6:	48 83 c4 60          	add    $0x60,%rsp
+  8011da:	5b                   	pop    %rbx
+  8011db:	41 5c                	pop    %r12
+  8011dd:	41 5d                	pop    %r13
+  8011df:	41 5f                	pop    %r15
+  8011e1:	5d                   	pop    %rbp
+  8011e2:	c3                   	ret
+
+00000000008011e3 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  8011e3:	55                   	push   %rbp
+  8011e4:	48 89 e5             	mov    %rsp,%rbp
+  8011e7:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8011ee:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8011ee <printfmt+0xb>
+  8011f5:	49 bb 52 9e 00 00 00 	movabs $0x9e52,%r11
+  8011fc:	00 00 00 
+  8011ff:	4d 01 da             	add    %r11,%r10
+  801202:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801209:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801210:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801217:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80121e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801225:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80122c:	84 c0                	test   %al,%al
+  80122e:	74 20                	je     801250 <printfmt+0x6d>
+  801230:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801234:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801238:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80123c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801240:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801244:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801248:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80124c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801250:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801257:	00 00 00 
+  80125a:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801261:	00 00 00 
+  801264:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801268:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80126f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801276:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80127d:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801284:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80128b:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801292:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801299:	48 89 c7             	mov    %rax,%rdi
+  80129c:	48 b8 9c 5b ff ff ff 	movabs $0xffffffffffff5b9c,%rax
+  8012a3:	ff ff ff 
+  8012a6:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8012aa:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  8012ac:	90                   	nop
+  8012ad:	c9                   	leave
+  8012ae:	c3                   	ret
+
+00000000008012af <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8012af:	55                   	push   %rbp
+  8012b0:	48 89 e5             	mov    %rsp,%rbp
+  8012b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8012b7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012b7 <sprintputch+0x8>
+  8012be:	49 bb 89 9d 00 00 00 	movabs $0x9d89,%r11
+  8012c5:	00 00 00 
+  8012c8:	4c 01 d8             	add    %r11,%rax
+  8012cb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8012ce:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  8012d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012d6:	8b 40 10             	mov    0x10(%rax),%eax
+  8012d9:	8d 50 01             	lea    0x1(%rax),%edx
+  8012dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012e0:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  8012e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012e7:	48 8b 10             	mov    (%rax),%rdx
+  8012ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012ee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012f2:	48 39 c2             	cmp    %rax,%rdx
+  8012f5:	73 17                	jae    80130e <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8012f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012fb:	48 8b 00             	mov    (%rax),%rax
+  8012fe:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801302:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801306:	48 89 0a             	mov    %rcx,(%rdx)
+  801309:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80130c:	88 10                	mov    %dl,(%rax)
+}
+  80130e:	90                   	nop
+  80130f:	c9                   	leave
+  801310:	c3                   	ret
+
+0000000000801311 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801311:	55                   	push   %rbp
+  801312:	48 89 e5             	mov    %rsp,%rbp
+  801315:	53                   	push   %rbx
+  801316:	48 83 ec 58          	sub    $0x58,%rsp
+  80131a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80131a <vsnprintf+0x9>
+  801321:	49 bb 26 9d 00 00 00 	movabs $0x9d26,%r11
+  801328:	00 00 00 
+  80132b:	4c 01 d8             	add    %r11,%rax
+  80132e:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801332:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801335:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801339:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  80133d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801341:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801345:	48 8b 0e             	mov    (%rsi),%rcx
+  801348:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  80134c:	48 89 0a             	mov    %rcx,(%rdx)
+  80134f:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801353:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801357:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80135b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80135f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801363:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801366:	48 63 d2             	movslq %edx,%rdx
+  801369:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80136d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801371:	48 01 ca             	add    %rcx,%rdx
+  801374:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801378:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  80137f:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801384:	74 06                	je     80138c <vsnprintf+0x7b>
+  801386:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  80138a:	7f 07                	jg     801393 <vsnprintf+0x82>
+		return -E_INVAL;
+  80138c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801391:	eb 34                	jmp    8013c7 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801393:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801397:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80139b:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80139f:	48 bf 6f 62 ff ff ff 	movabs $0xffffffffffff626f,%rdi
+  8013a6:	ff ff ff 
+  8013a9:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8013ad:	49 b8 9c 5b ff ff ff 	movabs $0xffffffffffff5b9c,%r8
+  8013b4:	ff ff ff 
+  8013b7:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8013bb:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8013bd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013c1:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8013c4:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8013c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013cb:	c9                   	leave
+  8013cc:	c3                   	ret
+
+00000000008013cd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8013cd:	55                   	push   %rbp
+  8013ce:	48 89 e5             	mov    %rsp,%rbp
+  8013d1:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8013d8:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8013d8 <snprintf+0xb>
+  8013df:	49 bb 68 9c 00 00 00 	movabs $0x9c68,%r11
+  8013e6:	00 00 00 
+  8013e9:	4d 01 da             	add    %r11,%r10
+  8013ec:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8013f3:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8013f9:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801400:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801407:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80140e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801415:	84 c0                	test   %al,%al
+  801417:	74 20                	je     801439 <snprintf+0x6c>
+  801419:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80141d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801421:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801425:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801429:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80142d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801431:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801435:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801439:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801440:	00 00 00 
+  801443:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80144a:	00 00 00 
+  80144d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801451:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801458:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80145f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801466:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80146d:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801474:	48 8b 06             	mov    (%rsi),%rax
+  801477:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80147b:	48 89 01             	mov    %rax,(%rcx)
+  80147e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801482:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801486:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  80148a:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801491:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801498:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  80149e:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8014a5:	48 89 c7             	mov    %rax,%rdi
+  8014a8:	48 b8 d1 62 ff ff ff 	movabs $0xffffffffffff62d1,%rax
+  8014af:	ff ff ff 
+  8014b2:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8014b6:	ff d0                	call   *%rax
+  8014b8:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8014be:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8014c4:	c9                   	leave
+  8014c5:	c3                   	ret
+
+00000000008014c6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8014c6:	55                   	push   %rbp
+  8014c7:	48 89 e5             	mov    %rsp,%rbp
+  8014ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8014ce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014ce <strlen+0x8>
+  8014d5:	49 bb 72 9b 00 00 00 	movabs $0x9b72,%r11
+  8014dc:	00 00 00 
+  8014df:	4c 01 d8             	add    %r11,%rax
+  8014e2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8014e6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8014ed:	eb 09                	jmp    8014f8 <strlen+0x32>
+		n++;
+  8014ef:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8014f3:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8014f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014fc:	0f b6 00             	movzbl (%rax),%eax
+  8014ff:	84 c0                	test   %al,%al
+  801501:	75 ec                	jne    8014ef <strlen+0x29>
+	return n;
+  801503:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801506:	c9                   	leave
+  801507:	c3                   	ret
+
+0000000000801508 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801508:	55                   	push   %rbp
+  801509:	48 89 e5             	mov    %rsp,%rbp
+  80150c:	48 83 ec 20          	sub    $0x20,%rsp
+  801510:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801510 <strnlen+0x8>
+  801517:	49 bb 30 9b 00 00 00 	movabs $0x9b30,%r11
+  80151e:	00 00 00 
+  801521:	4c 01 d8             	add    %r11,%rax
+  801524:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801528:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80152c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801533:	eb 0e                	jmp    801543 <strnlen+0x3b>
+		n++;
+  801535:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801539:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80153e:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801543:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801548:	74 0b                	je     801555 <strnlen+0x4d>
+  80154a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80154e:	0f b6 00             	movzbl (%rax),%eax
+  801551:	84 c0                	test   %al,%al
+  801553:	75 e0                	jne    801535 <strnlen+0x2d>
+	return n;
+  801555:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801558:	c9                   	leave
+  801559:	c3                   	ret
+
+000000000080155a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80155a:	55                   	push   %rbp
+  80155b:	48 89 e5             	mov    %rsp,%rbp
+  80155e:	48 83 ec 20          	sub    $0x20,%rsp
+  801562:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801562 <strcpy+0x8>
+  801569:	49 bb de 9a 00 00 00 	movabs $0x9ade,%r11
+  801570:	00 00 00 
+  801573:	4c 01 d8             	add    %r11,%rax
+  801576:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80157a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80157e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801582:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801586:	90                   	nop
+  801587:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80158b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80158f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801593:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801597:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80159b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80159f:	0f b6 12             	movzbl (%rdx),%edx
+  8015a2:	88 10                	mov    %dl,(%rax)
+  8015a4:	0f b6 00             	movzbl (%rax),%eax
+  8015a7:	84 c0                	test   %al,%al
+  8015a9:	75 dc                	jne    801587 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8015ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8015af:	c9                   	leave
+  8015b0:	c3                   	ret
+
+00000000008015b1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8015b1:	55                   	push   %rbp
+  8015b2:	48 89 e5             	mov    %rsp,%rbp
+  8015b5:	53                   	push   %rbx
+  8015b6:	48 83 ec 20          	sub    $0x20,%rsp
+  8015ba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8015ba <strcat+0x9>
+  8015c1:	49 bb 86 9a 00 00 00 	movabs $0x9a86,%r11
+  8015c8:	00 00 00 
+  8015cb:	4c 01 db             	add    %r11,%rbx
+  8015ce:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8015d2:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8015d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015da:	48 89 c7             	mov    %rax,%rdi
+  8015dd:	48 b8 86 64 ff ff ff 	movabs $0xffffffffffff6486,%rax
+  8015e4:	ff ff ff 
+  8015e7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015eb:	ff d0                	call   *%rax
+  8015ed:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8015f0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015f3:	48 63 d0             	movslq %eax,%rdx
+  8015f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015fa:	48 01 c2             	add    %rax,%rdx
+  8015fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801601:	48 89 c6             	mov    %rax,%rsi
+  801604:	48 89 d7             	mov    %rdx,%rdi
+  801607:	48 b8 1a 65 ff ff ff 	movabs $0xffffffffffff651a,%rax
+  80160e:	ff ff ff 
+  801611:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801615:	ff d0                	call   *%rax
+	return dst;
+  801617:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  80161b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161f:	c9                   	leave
+  801620:	c3                   	ret
+
+0000000000801621 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801621:	55                   	push   %rbp
+  801622:	48 89 e5             	mov    %rsp,%rbp
+  801625:	48 83 ec 28          	sub    $0x28,%rsp
+  801629:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801629 <strncpy+0x8>
+  801630:	49 bb 17 9a 00 00 00 	movabs $0x9a17,%r11
+  801637:	00 00 00 
+  80163a:	4c 01 d8             	add    %r11,%rax
+  80163d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801641:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801645:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801649:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80164d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801651:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801658:	00 
+  801659:	eb 2a                	jmp    801685 <strncpy+0x64>
+		*dst++ = *src;
+  80165b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80165f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801663:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801667:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80166b:	0f b6 12             	movzbl (%rdx),%edx
+  80166e:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801670:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801674:	0f b6 00             	movzbl (%rax),%eax
+  801677:	84 c0                	test   %al,%al
+  801679:	74 05                	je     801680 <strncpy+0x5f>
+			src++;
+  80167b:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801680:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801689:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80168d:	72 cc                	jb     80165b <strncpy+0x3a>
+	}
+	return ret;
+  80168f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801693:	c9                   	leave
+  801694:	c3                   	ret
+
+0000000000801695 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801695:	55                   	push   %rbp
+  801696:	48 89 e5             	mov    %rsp,%rbp
+  801699:	48 83 ec 28          	sub    $0x28,%rsp
+  80169d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80169d <strlcpy+0x8>
+  8016a4:	49 bb a3 99 00 00 00 	movabs $0x99a3,%r11
+  8016ab:	00 00 00 
+  8016ae:	4c 01 d8             	add    %r11,%rax
+  8016b1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016b5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016b9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8016bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016c1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8016c5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016ca:	74 3d                	je     801709 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8016cc:	eb 1d                	jmp    8016eb <strlcpy+0x56>
+			*dst++ = *src++;
+  8016ce:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016d2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016d6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8016da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016de:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8016e2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016e6:	0f b6 12             	movzbl (%rdx),%edx
+  8016e9:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8016eb:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8016f0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016f5:	74 0b                	je     801702 <strlcpy+0x6d>
+  8016f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016fb:	0f b6 00             	movzbl (%rax),%eax
+  8016fe:	84 c0                	test   %al,%al
+  801700:	75 cc                	jne    8016ce <strlcpy+0x39>
+		*dst = '\0';
+  801702:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801706:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801709:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80170d:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801711:	c9                   	leave
+  801712:	c3                   	ret
+
+0000000000801713 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801713:	55                   	push   %rbp
+  801714:	48 89 e5             	mov    %rsp,%rbp
+  801717:	48 83 ec 10          	sub    $0x10,%rsp
+  80171b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80171b <strcmp+0x8>
+  801722:	49 bb 25 99 00 00 00 	movabs $0x9925,%r11
+  801729:	00 00 00 
+  80172c:	4c 01 d8             	add    %r11,%rax
+  80172f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801733:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801737:	eb 0a                	jmp    801743 <strcmp+0x30>
+		p++, q++;
+  801739:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80173e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801743:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801747:	0f b6 00             	movzbl (%rax),%eax
+  80174a:	84 c0                	test   %al,%al
+  80174c:	74 12                	je     801760 <strcmp+0x4d>
+  80174e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801752:	0f b6 10             	movzbl (%rax),%edx
+  801755:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801759:	0f b6 00             	movzbl (%rax),%eax
+  80175c:	38 c2                	cmp    %al,%dl
+  80175e:	74 d9                	je     801739 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801760:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801764:	0f b6 00             	movzbl (%rax),%eax
+  801767:	0f b6 d0             	movzbl %al,%edx
+  80176a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80176e:	0f b6 00             	movzbl (%rax),%eax
+  801771:	0f b6 c0             	movzbl %al,%eax
+  801774:	29 c2                	sub    %eax,%edx
+  801776:	89 d0                	mov    %edx,%eax
+}
+  801778:	c9                   	leave
+  801779:	c3                   	ret
+
+000000000080177a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80177a:	55                   	push   %rbp
+  80177b:	48 89 e5             	mov    %rsp,%rbp
+  80177e:	48 83 ec 18          	sub    $0x18,%rsp
+  801782:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801782 <strncmp+0x8>
+  801789:	49 bb be 98 00 00 00 	movabs $0x98be,%r11
+  801790:	00 00 00 
+  801793:	4c 01 d8             	add    %r11,%rax
+  801796:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80179a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80179e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8017a2:	eb 0f                	jmp    8017b3 <strncmp+0x39>
+		n--, p++, q++;
+  8017a4:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8017a9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017ae:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8017b3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8017b8:	74 1d                	je     8017d7 <strncmp+0x5d>
+  8017ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017be:	0f b6 00             	movzbl (%rax),%eax
+  8017c1:	84 c0                	test   %al,%al
+  8017c3:	74 12                	je     8017d7 <strncmp+0x5d>
+  8017c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c9:	0f b6 10             	movzbl (%rax),%edx
+  8017cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017d0:	0f b6 00             	movzbl (%rax),%eax
+  8017d3:	38 c2                	cmp    %al,%dl
+  8017d5:	74 cd                	je     8017a4 <strncmp+0x2a>
+	if (n == 0)
+  8017d7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8017dc:	75 07                	jne    8017e5 <strncmp+0x6b>
+		return 0;
+  8017de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e3:	eb 16                	jmp    8017fb <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8017e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017e9:	0f b6 00             	movzbl (%rax),%eax
+  8017ec:	0f b6 d0             	movzbl %al,%edx
+  8017ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017f3:	0f b6 00             	movzbl (%rax),%eax
+  8017f6:	0f b6 c0             	movzbl %al,%eax
+  8017f9:	29 c2                	sub    %eax,%edx
+}
+  8017fb:	89 d0                	mov    %edx,%eax
+  8017fd:	c9                   	leave
+  8017fe:	c3                   	ret
+
+00000000008017ff <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8017ff:	55                   	push   %rbp
+  801800:	48 89 e5             	mov    %rsp,%rbp
+  801803:	48 83 ec 10          	sub    $0x10,%rsp
+  801807:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801807 <strchr+0x8>
+  80180e:	49 bb 39 98 00 00 00 	movabs $0x9839,%r11
+  801815:	00 00 00 
+  801818:	4c 01 d8             	add    %r11,%rax
+  80181b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80181f:	89 f0                	mov    %esi,%eax
+  801821:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801824:	eb 17                	jmp    80183d <strchr+0x3e>
+		if (*s == c)
+  801826:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80182a:	0f b6 00             	movzbl (%rax),%eax
+  80182d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801830:	75 06                	jne    801838 <strchr+0x39>
+			return (char *) s;
+  801832:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801836:	eb 15                	jmp    80184d <strchr+0x4e>
+	for (; *s; s++)
+  801838:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80183d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801841:	0f b6 00             	movzbl (%rax),%eax
+  801844:	84 c0                	test   %al,%al
+  801846:	75 de                	jne    801826 <strchr+0x27>
+	return 0;
+  801848:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80184d:	c9                   	leave
+  80184e:	c3                   	ret
+
+000000000080184f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80184f:	55                   	push   %rbp
+  801850:	48 89 e5             	mov    %rsp,%rbp
+  801853:	48 83 ec 10          	sub    $0x10,%rsp
+  801857:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801857 <strfind+0x8>
+  80185e:	49 bb e9 97 00 00 00 	movabs $0x97e9,%r11
+  801865:	00 00 00 
+  801868:	4c 01 d8             	add    %r11,%rax
+  80186b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80186f:	89 f0                	mov    %esi,%eax
+  801871:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801874:	eb 11                	jmp    801887 <strfind+0x38>
+		if (*s == c)
+  801876:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80187a:	0f b6 00             	movzbl (%rax),%eax
+  80187d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801880:	74 12                	je     801894 <strfind+0x45>
+	for (; *s; s++)
+  801882:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801887:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80188b:	0f b6 00             	movzbl (%rax),%eax
+  80188e:	84 c0                	test   %al,%al
+  801890:	75 e4                	jne    801876 <strfind+0x27>
+  801892:	eb 01                	jmp    801895 <strfind+0x46>
+			break;
+  801894:	90                   	nop
+	return (char *) s;
+  801895:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801899:	c9                   	leave
+  80189a:	c3                   	ret
+
+000000000080189b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80189b:	55                   	push   %rbp
+  80189c:	48 89 e5             	mov    %rsp,%rbp
+  80189f:	48 83 ec 18          	sub    $0x18,%rsp
+  8018a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018a3 <memset+0x8>
+  8018aa:	49 bb 9d 97 00 00 00 	movabs $0x979d,%r11
+  8018b1:	00 00 00 
+  8018b4:	4c 01 d8             	add    %r11,%rax
+  8018b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018bb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8018be:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  8018c2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018c7:	75 06                	jne    8018cf <memset+0x34>
+		return v;
+  8018c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018cd:	eb 69                	jmp    801938 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8018cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018d3:	83 e0 03             	and    $0x3,%eax
+  8018d6:	48 85 c0             	test   %rax,%rax
+  8018d9:	75 48                	jne    801923 <memset+0x88>
+  8018db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018df:	83 e0 03             	and    $0x3,%eax
+  8018e2:	48 85 c0             	test   %rax,%rax
+  8018e5:	75 3c                	jne    801923 <memset+0x88>
+		c &= 0xFF;
+  8018e7:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8018ee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018f1:	c1 e0 18             	shl    $0x18,%eax
+  8018f4:	89 c2                	mov    %eax,%edx
+  8018f6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018f9:	c1 e0 10             	shl    $0x10,%eax
+  8018fc:	09 c2                	or     %eax,%edx
+  8018fe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801901:	c1 e0 08             	shl    $0x8,%eax
+  801904:	09 d0                	or     %edx,%eax
+  801906:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801909:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80190d:	48 c1 e8 02          	shr    $0x2,%rax
+  801911:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801914:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801918:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80191b:	48 89 d7             	mov    %rdx,%rdi
+  80191e:	fc                   	cld
+  80191f:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801921:	eb 11                	jmp    801934 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801923:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801927:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80192a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80192e:	48 89 d7             	mov    %rdx,%rdi
+  801931:	fc                   	cld
+  801932:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801934:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801938:	c9                   	leave
+  801939:	c3                   	ret
+
+000000000080193a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80193a:	55                   	push   %rbp
+  80193b:	48 89 e5             	mov    %rsp,%rbp
+  80193e:	48 83 ec 28          	sub    $0x28,%rsp
+  801942:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801942 <memmove+0x8>
+  801949:	49 bb fe 96 00 00 00 	movabs $0x96fe,%r11
+  801950:	00 00 00 
+  801953:	4c 01 d8             	add    %r11,%rax
+  801956:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80195a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80195e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801962:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801966:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  80196a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80196e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801972:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801976:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80197a:	0f 83 88 00 00 00    	jae    801a08 <memmove+0xce>
+  801980:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801984:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801988:	48 01 d0             	add    %rdx,%rax
+  80198b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80198f:	73 77                	jae    801a08 <memmove+0xce>
+		s += n;
+  801991:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801995:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801999:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80199d:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8019a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019a5:	83 e0 03             	and    $0x3,%eax
+  8019a8:	48 85 c0             	test   %rax,%rax
+  8019ab:	75 3b                	jne    8019e8 <memmove+0xae>
+  8019ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019b1:	83 e0 03             	and    $0x3,%eax
+  8019b4:	48 85 c0             	test   %rax,%rax
+  8019b7:	75 2f                	jne    8019e8 <memmove+0xae>
+  8019b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019bd:	83 e0 03             	and    $0x3,%eax
+  8019c0:	48 85 c0             	test   %rax,%rax
+  8019c3:	75 23                	jne    8019e8 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8019c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c9:	48 83 e8 04          	sub    $0x4,%rax
+  8019cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019d1:	48 83 ea 04          	sub    $0x4,%rdx
+  8019d5:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8019d9:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  8019dd:	48 89 c7             	mov    %rax,%rdi
+  8019e0:	48 89 d6             	mov    %rdx,%rsi
+  8019e3:	fd                   	std
+  8019e4:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8019e6:	eb 1d                	jmp    801a05 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8019e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ec:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019f4:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8019f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019fc:	48 89 d7             	mov    %rdx,%rdi
+  8019ff:	48 89 c1             	mov    %rax,%rcx
+  801a02:	fd                   	std
+  801a03:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801a05:	fc                   	cld
+  801a06:	eb 57                	jmp    801a5f <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801a08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a0c:	83 e0 03             	and    $0x3,%eax
+  801a0f:	48 85 c0             	test   %rax,%rax
+  801a12:	75 36                	jne    801a4a <memmove+0x110>
+  801a14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a18:	83 e0 03             	and    $0x3,%eax
+  801a1b:	48 85 c0             	test   %rax,%rax
+  801a1e:	75 2a                	jne    801a4a <memmove+0x110>
+  801a20:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a24:	83 e0 03             	and    $0x3,%eax
+  801a27:	48 85 c0             	test   %rax,%rax
+  801a2a:	75 1e                	jne    801a4a <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801a2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a30:	48 c1 e8 02          	shr    $0x2,%rax
+  801a34:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801a37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a3b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a3f:	48 89 c7             	mov    %rax,%rdi
+  801a42:	48 89 d6             	mov    %rdx,%rsi
+  801a45:	fc                   	cld
+  801a46:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801a48:	eb 15                	jmp    801a5f <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801a4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a4e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a52:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a56:	48 89 c7             	mov    %rax,%rdi
+  801a59:	48 89 d6             	mov    %rdx,%rsi
+  801a5c:	fc                   	cld
+  801a5d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801a5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a63:	c9                   	leave
+  801a64:	c3                   	ret
+
+0000000000801a65 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801a65:	55                   	push   %rbp
+  801a66:	48 89 e5             	mov    %rsp,%rbp
+  801a69:	48 83 ec 18          	sub    $0x18,%rsp
+  801a6d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a6d <memcpy+0x8>
+  801a74:	49 bb d3 95 00 00 00 	movabs $0x95d3,%r11
+  801a7b:	00 00 00 
+  801a7e:	4c 01 d8             	add    %r11,%rax
+  801a81:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a85:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a89:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801a8d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a91:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801a95:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a99:	48 89 cf             	mov    %rcx,%rdi
+  801a9c:	48 b9 fa 68 ff ff ff 	movabs $0xffffffffffff68fa,%rcx
+  801aa3:	ff ff ff 
+  801aa6:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801aaa:	ff d0                	call   *%rax
+}
+  801aac:	c9                   	leave
+  801aad:	c3                   	ret
+
+0000000000801aae <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801aae:	55                   	push   %rbp
+  801aaf:	48 89 e5             	mov    %rsp,%rbp
+  801ab2:	48 83 ec 28          	sub    $0x28,%rsp
+  801ab6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ab6 <memcmp+0x8>
+  801abd:	49 bb 8a 95 00 00 00 	movabs $0x958a,%r11
+  801ac4:	00 00 00 
+  801ac7:	4c 01 d8             	add    %r11,%rax
+  801aca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ace:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801ad2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801ad6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ada:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801ade:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ae2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801ae6:	eb 34                	jmp    801b1c <memcmp+0x6e>
+		if (*s1 != *s2)
+  801ae8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aec:	0f b6 10             	movzbl (%rax),%edx
+  801aef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af3:	0f b6 00             	movzbl (%rax),%eax
+  801af6:	38 c2                	cmp    %al,%dl
+  801af8:	74 18                	je     801b12 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801afa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801afe:	0f b6 00             	movzbl (%rax),%eax
+  801b01:	0f b6 d0             	movzbl %al,%edx
+  801b04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b08:	0f b6 00             	movzbl (%rax),%eax
+  801b0b:	0f b6 c0             	movzbl %al,%eax
+  801b0e:	29 c2                	sub    %eax,%edx
+  801b10:	eb 20                	jmp    801b32 <memcmp+0x84>
+		s1++, s2++;
+  801b12:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801b17:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801b1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b20:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b24:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801b28:	48 85 c0             	test   %rax,%rax
+  801b2b:	75 bb                	jne    801ae8 <memcmp+0x3a>
+	}
+
+	return 0;
+  801b2d:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801b32:	89 d0                	mov    %edx,%eax
+  801b34:	c9                   	leave
+  801b35:	c3                   	ret
+
+0000000000801b36 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801b36:	55                   	push   %rbp
+  801b37:	48 89 e5             	mov    %rsp,%rbp
+  801b3a:	48 83 ec 28          	sub    $0x28,%rsp
+  801b3e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b3e <memfind+0x8>
+  801b45:	49 bb 02 95 00 00 00 	movabs $0x9502,%r11
+  801b4c:	00 00 00 
+  801b4f:	4c 01 d8             	add    %r11,%rax
+  801b52:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b56:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801b59:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801b5d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b65:	48 01 d0             	add    %rdx,%rax
+  801b68:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801b6c:	eb 13                	jmp    801b81 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801b6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b72:	0f b6 00             	movzbl (%rax),%eax
+  801b75:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801b78:	38 d0                	cmp    %dl,%al
+  801b7a:	74 11                	je     801b8d <memfind+0x57>
+	for (; s < ends; s++)
+  801b7c:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801b81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b85:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b89:	72 e3                	jb     801b6e <memfind+0x38>
+  801b8b:	eb 01                	jmp    801b8e <memfind+0x58>
+			break;
+  801b8d:	90                   	nop
+	return (void *) s;
+  801b8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b92:	c9                   	leave
+  801b93:	c3                   	ret
+
+0000000000801b94 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801b94:	55                   	push   %rbp
+  801b95:	48 89 e5             	mov    %rsp,%rbp
+  801b98:	48 83 ec 38          	sub    $0x38,%rsp
+  801b9c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b9c <strtol+0x8>
+  801ba3:	49 bb a4 94 00 00 00 	movabs $0x94a4,%r11
+  801baa:	00 00 00 
+  801bad:	4c 01 d8             	add    %r11,%rax
+  801bb0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801bb4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801bb8:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801bbb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801bc2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801bc9:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801bca:	eb 05                	jmp    801bd1 <strtol+0x3d>
+		s++;
+  801bcc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801bd1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd5:	0f b6 00             	movzbl (%rax),%eax
+  801bd8:	3c 20                	cmp    $0x20,%al
+  801bda:	74 f0                	je     801bcc <strtol+0x38>
+  801bdc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be0:	0f b6 00             	movzbl (%rax),%eax
+  801be3:	3c 09                	cmp    $0x9,%al
+  801be5:	74 e5                	je     801bcc <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801be7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801beb:	0f b6 00             	movzbl (%rax),%eax
+  801bee:	3c 2b                	cmp    $0x2b,%al
+  801bf0:	75 07                	jne    801bf9 <strtol+0x65>
+		s++;
+  801bf2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bf7:	eb 17                	jmp    801c10 <strtol+0x7c>
+	else if (*s == '-')
+  801bf9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bfd:	0f b6 00             	movzbl (%rax),%eax
+  801c00:	3c 2d                	cmp    $0x2d,%al
+  801c02:	75 0c                	jne    801c10 <strtol+0x7c>
+		s++, neg = 1;
+  801c04:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c09:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801c10:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c14:	74 06                	je     801c1c <strtol+0x88>
+  801c16:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801c1a:	75 28                	jne    801c44 <strtol+0xb0>
+  801c1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c20:	0f b6 00             	movzbl (%rax),%eax
+  801c23:	3c 30                	cmp    $0x30,%al
+  801c25:	75 1d                	jne    801c44 <strtol+0xb0>
+  801c27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2b:	48 83 c0 01          	add    $0x1,%rax
+  801c2f:	0f b6 00             	movzbl (%rax),%eax
+  801c32:	3c 78                	cmp    $0x78,%al
+  801c34:	75 0e                	jne    801c44 <strtol+0xb0>
+		s += 2, base = 16;
+  801c36:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801c3b:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801c42:	eb 2c                	jmp    801c70 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801c44:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c48:	75 19                	jne    801c63 <strtol+0xcf>
+  801c4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c4e:	0f b6 00             	movzbl (%rax),%eax
+  801c51:	3c 30                	cmp    $0x30,%al
+  801c53:	75 0e                	jne    801c63 <strtol+0xcf>
+		s++, base = 8;
+  801c55:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c5a:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c61:	eb 0d                	jmp    801c70 <strtol+0xdc>
+	else if (base == 0)
+  801c63:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c67:	75 07                	jne    801c70 <strtol+0xdc>
+		base = 10;
+  801c69:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801c70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c74:	0f b6 00             	movzbl (%rax),%eax
+  801c77:	3c 2f                	cmp    $0x2f,%al
+  801c79:	7e 1d                	jle    801c98 <strtol+0x104>
+  801c7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c7f:	0f b6 00             	movzbl (%rax),%eax
+  801c82:	3c 39                	cmp    $0x39,%al
+  801c84:	7f 12                	jg     801c98 <strtol+0x104>
+			dig = *s - '0';
+  801c86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c8a:	0f b6 00             	movzbl (%rax),%eax
+  801c8d:	0f be c0             	movsbl %al,%eax
+  801c90:	83 e8 30             	sub    $0x30,%eax
+  801c93:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c96:	eb 4e                	jmp    801ce6 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801c98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c9c:	0f b6 00             	movzbl (%rax),%eax
+  801c9f:	3c 60                	cmp    $0x60,%al
+  801ca1:	7e 1d                	jle    801cc0 <strtol+0x12c>
+  801ca3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca7:	0f b6 00             	movzbl (%rax),%eax
+  801caa:	3c 7a                	cmp    $0x7a,%al
+  801cac:	7f 12                	jg     801cc0 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801cae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb2:	0f b6 00             	movzbl (%rax),%eax
+  801cb5:	0f be c0             	movsbl %al,%eax
+  801cb8:	83 e8 57             	sub    $0x57,%eax
+  801cbb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801cbe:	eb 26                	jmp    801ce6 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801cc0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc4:	0f b6 00             	movzbl (%rax),%eax
+  801cc7:	3c 40                	cmp    $0x40,%al
+  801cc9:	7e 47                	jle    801d12 <strtol+0x17e>
+  801ccb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ccf:	0f b6 00             	movzbl (%rax),%eax
+  801cd2:	3c 5a                	cmp    $0x5a,%al
+  801cd4:	7f 3c                	jg     801d12 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801cd6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cda:	0f b6 00             	movzbl (%rax),%eax
+  801cdd:	0f be c0             	movsbl %al,%eax
+  801ce0:	83 e8 37             	sub    $0x37,%eax
+  801ce3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801ce6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ce9:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801cec:	7d 23                	jge    801d11 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801cee:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cf3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801cf6:	48 98                	cltq
+  801cf8:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801cfd:	48 89 c2             	mov    %rax,%rdx
+  801d00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d03:	48 98                	cltq
+  801d05:	48 01 d0             	add    %rdx,%rax
+  801d08:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801d0c:	e9 5f ff ff ff       	jmp    801c70 <strtol+0xdc>
+			break;
+  801d11:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801d12:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d17:	74 0b                	je     801d24 <strtol+0x190>
+		*endptr = (char *) s;
+  801d19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d1d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801d21:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801d24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801d28:	74 09                	je     801d33 <strtol+0x19f>
+  801d2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d2e:	48 f7 d8             	neg    %rax
+  801d31:	eb 04                	jmp    801d37 <strtol+0x1a3>
+  801d33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801d37:	c9                   	leave
+  801d38:	c3                   	ret
+
+0000000000801d39 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801d39:	55                   	push   %rbp
+  801d3a:	48 89 e5             	mov    %rsp,%rbp
+  801d3d:	53                   	push   %rbx
+  801d3e:	48 83 ec 30          	sub    $0x30,%rsp
+  801d42:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801d42 <strstr+0x9>
+  801d49:	49 bb fe 92 00 00 00 	movabs $0x92fe,%r11
+  801d50:	00 00 00 
+  801d53:	4c 01 db             	add    %r11,%rbx
+  801d56:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801d5a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801d5e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d62:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d66:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d6a:	0f b6 00             	movzbl (%rax),%eax
+  801d6d:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801d70:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801d74:	75 06                	jne    801d7c <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801d76:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d7a:	eb 73                	jmp    801def <strstr+0xb6>
+
+	len = strlen(str);
+  801d7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d80:	48 89 c7             	mov    %rax,%rdi
+  801d83:	48 b8 86 64 ff ff ff 	movabs $0xffffffffffff6486,%rax
+  801d8a:	ff ff ff 
+  801d8d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d91:	ff d0                	call   *%rax
+  801d93:	48 98                	cltq
+  801d95:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801d99:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d9d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801da1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801da5:	0f b6 00             	movzbl (%rax),%eax
+  801da8:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801dab:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801daf:	75 07                	jne    801db8 <strstr+0x7f>
+				return (char *) 0;
+  801db1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db6:	eb 37                	jmp    801def <strstr+0xb6>
+		} while (sc != c);
+  801db8:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801dbc:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801dbf:	75 d8                	jne    801d99 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801dc1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801dc5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801dc9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dcd:	48 89 ce             	mov    %rcx,%rsi
+  801dd0:	48 89 c7             	mov    %rax,%rdi
+  801dd3:	48 b8 3a 67 ff ff ff 	movabs $0xffffffffffff673a,%rax
+  801dda:	ff ff ff 
+  801ddd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801de1:	ff d0                	call   *%rax
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	75 b2                	jne    801d99 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801de7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801deb:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801def:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801df3:	c9                   	leave
+  801df4:	c3                   	ret
+
+0000000000801df5 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801df5:	55                   	push   %rbp
+  801df6:	48 89 e5             	mov    %rsp,%rbp
+  801df9:	41 57                	push   %r15
+  801dfb:	53                   	push   %rbx
+  801dfc:	48 83 ec 40          	sub    $0x40,%rsp
+  801e00:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801e00 <syscall+0xb>
+  801e07:	49 bb 40 92 00 00 00 	movabs $0x9240,%r11
+  801e0e:	00 00 00 
+  801e11:	4d 01 da             	add    %r11,%r10
+  801e14:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801e17:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801e1a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801e1e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801e22:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801e26:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801e2a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801e2d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801e31:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801e35:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801e39:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801e3d:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801e41:	4c 89 c3             	mov    %r8,%rbx
+  801e44:	cd 30                	int    $0x30
+  801e46:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801e4a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801e4e:	74 52                	je     801ea2 <syscall+0xad>
+  801e50:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e55:	7e 4b                	jle    801ea2 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e57:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e5b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801e5e:	49 89 d0             	mov    %rdx,%r8
+  801e61:	89 c1                	mov    %eax,%ecx
+  801e63:	48 b8 20 d6 ff ff ff 	movabs $0xffffffffffffd620,%rax
+  801e6a:	ff ff ff 
+  801e6d:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e71:	48 89 c2             	mov    %rax,%rdx
+  801e74:	be 23 00 00 00       	mov    $0x23,%esi
+  801e79:	48 b8 3d d6 ff ff ff 	movabs $0xffffffffffffd63d,%rax
+  801e80:	ff ff ff 
+  801e83:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e87:	48 89 c7             	mov    %rax,%rdi
+  801e8a:	4d 89 d7             	mov    %r10,%r15
+  801e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e92:	49 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r9
+  801e99:	ff ff ff 
+  801e9c:	4d 01 d1             	add    %r10,%r9
+  801e9f:	41 ff d1             	call   *%r9
+
+	return ret;
+  801ea2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801ea6:	48 83 c4 40          	add    $0x40,%rsp
+  801eaa:	5b                   	pop    %rbx
+  801eab:	41 5f                	pop    %r15
+  801ead:	5d                   	pop    %rbp
+  801eae:	c3                   	ret
+
+0000000000801eaf <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801eaf:	55                   	push   %rbp
+  801eb0:	48 89 e5             	mov    %rsp,%rbp
+  801eb3:	41 57                	push   %r15
+  801eb5:	41 56                	push   %r14
+  801eb7:	41 55                	push   %r13
+  801eb9:	41 54                	push   %r12
+  801ebb:	53                   	push   %rbx
+  801ebc:	48 83 ec 48          	sub    $0x48,%rsp
+  801ec0:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801ec0 <syscall_words+0x11>
+  801ec7:	49 bb 80 91 00 00 00 	movabs $0x9180,%r11
+  801ece:	00 00 00 
+  801ed1:	4d 01 de             	add    %r11,%r14
+  801ed4:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801ed7:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801eda:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801ede:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801ee2:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801ee6:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801eea:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801eef:	74 09                	je     801efa <syscall_words+0x4b>
+  801ef1:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ef5:	48 8b 00             	mov    (%rax),%rax
+  801ef8:	eb 05                	jmp    801eff <syscall_words+0x50>
+  801efa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eff:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801f02:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f07:	74 0a                	je     801f13 <syscall_words+0x64>
+  801f09:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f0d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f11:	eb 05                	jmp    801f18 <syscall_words+0x69>
+  801f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f18:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801f1b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f20:	74 0a                	je     801f2c <syscall_words+0x7d>
+  801f22:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f26:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f2a:	eb 05                	jmp    801f31 <syscall_words+0x82>
+  801f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f31:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801f34:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f39:	74 0a                	je     801f45 <syscall_words+0x96>
+  801f3b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f3f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f43:	eb 05                	jmp    801f4a <syscall_words+0x9b>
+  801f45:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4a:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801f4d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f52:	74 0a                	je     801f5e <syscall_words+0xaf>
+  801f54:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f58:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f5c:	eb 05                	jmp    801f63 <syscall_words+0xb4>
+  801f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f63:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801f66:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f6b:	74 0a                	je     801f77 <syscall_words+0xc8>
+  801f6d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f71:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801f75:	eb 05                	jmp    801f7c <syscall_words+0xcd>
+  801f77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7c:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801f7f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801f82:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801f86:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f8a:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801f8e:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801f92:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f96:	cd 30                	int    $0x30
+  801f98:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801f9c:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fa1:	74 50                	je     801ff3 <syscall_words+0x144>
+		words[0] = r8;
+  801fa3:	4c 89 c2             	mov    %r8,%rdx
+  801fa6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801faa:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801fad:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fb1:	48 83 c0 08          	add    $0x8,%rax
+  801fb5:	4c 89 ca             	mov    %r9,%rdx
+  801fb8:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801fbb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fbf:	48 83 c0 10          	add    $0x10,%rax
+  801fc3:	4c 89 d2             	mov    %r10,%rdx
+  801fc6:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801fc9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fcd:	48 83 c0 18          	add    $0x18,%rax
+  801fd1:	4c 89 da             	mov    %r11,%rdx
+  801fd4:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801fd7:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fdb:	48 83 c0 20          	add    $0x20,%rax
+  801fdf:	4c 89 e2             	mov    %r12,%rdx
+  801fe2:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801fe5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fe9:	48 83 c0 28          	add    $0x28,%rax
+  801fed:	4c 89 ea             	mov    %r13,%rdx
+  801ff0:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801ff3:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801ff7:	74 52                	je     80204b <syscall_words+0x19c>
+  801ff9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ffe:	7e 4b                	jle    80204b <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802000:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802004:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802007:	49 89 d0             	mov    %rdx,%r8
+  80200a:	89 c1                	mov    %eax,%ecx
+  80200c:	48 b8 20 d6 ff ff ff 	movabs $0xffffffffffffd620,%rax
+  802013:	ff ff ff 
+  802016:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  80201a:	48 89 c2             	mov    %rax,%rdx
+  80201d:	be 4e 00 00 00       	mov    $0x4e,%esi
+  802022:	48 b8 3d d6 ff ff ff 	movabs $0xffffffffffffd63d,%rax
+  802029:	ff ff ff 
+  80202c:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802030:	48 89 c7             	mov    %rax,%rdi
+  802033:	4d 89 f7             	mov    %r14,%r15
+  802036:	b8 00 00 00 00       	mov    $0x0,%eax
+  80203b:	49 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r9
+  802042:	ff ff ff 
+  802045:	4d 01 f1             	add    %r14,%r9
+  802048:	41 ff d1             	call   *%r9
+
+	return ret;
+  80204b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80204f:	48 83 c4 48          	add    $0x48,%rsp
+  802053:	5b                   	pop    %rbx
+  802054:	41 5c                	pop    %r12
+  802056:	41 5d                	pop    %r13
+  802058:	41 5e                	pop    %r14
+  80205a:	41 5f                	pop    %r15
+  80205c:	5d                   	pop    %rbp
+  80205d:	c3                   	ret
+
+000000000080205e <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80205e:	55                   	push   %rbp
+  80205f:	48 89 e5             	mov    %rsp,%rbp
+  802062:	48 83 ec 10          	sub    $0x10,%rsp
+  802066:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802066 <sys_cputs+0x8>
+  80206d:	49 bb da 8f 00 00 00 	movabs $0x8fda,%r11
+  802074:	00 00 00 
+  802077:	4c 01 d8             	add    %r11,%rax
+  80207a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80207e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802082:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802086:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80208a:	48 83 ec 08          	sub    $0x8,%rsp
+  80208e:	6a 00                	push   $0x0
+  802090:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802096:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80209c:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020a6:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  8020ad:	ff ff ff 
+  8020b0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020b4:	ff d0                	call   *%rax
+  8020b6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020ba:	90                   	nop
+  8020bb:	c9                   	leave
+  8020bc:	c3                   	ret
+
+00000000008020bd <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8020bd:	55                   	push   %rbp
+  8020be:	48 89 e5             	mov    %rsp,%rbp
+  8020c1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020c1 <sys_cgetc+0x4>
+  8020c8:	49 bb 7f 8f 00 00 00 	movabs $0x8f7f,%r11
+  8020cf:	00 00 00 
+  8020d2:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8020d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8020d9:	6a 00                	push   $0x0
+  8020db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020fb:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  802102:	ff ff ff 
+  802105:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802109:	ff d0                	call   *%rax
+  80210b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80210f:	c9                   	leave
+  802110:	c3                   	ret
+
+0000000000802111 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802111:	55                   	push   %rbp
+  802112:	48 89 e5             	mov    %rsp,%rbp
+  802115:	48 83 ec 10          	sub    $0x10,%rsp
+  802119:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802119 <sys_env_destroy+0x8>
+  802120:	49 bb 27 8f 00 00 00 	movabs $0x8f27,%r11
+  802127:	00 00 00 
+  80212a:	4c 01 d8             	add    %r11,%rax
+  80212d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802130:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802133:	48 63 d2             	movslq %edx,%rdx
+  802136:	48 83 ec 08          	sub    $0x8,%rsp
+  80213a:	6a 00                	push   $0x0
+  80213c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802142:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802148:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80214d:	be 01 00 00 00       	mov    $0x1,%esi
+  802152:	bf 03 00 00 00       	mov    $0x3,%edi
+  802157:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  80215e:	ff ff ff 
+  802161:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802165:	ff d0                	call   *%rax
+  802167:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80216b:	c9                   	leave
+  80216c:	c3                   	ret
+
+000000000080216d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80216d:	55                   	push   %rbp
+  80216e:	48 89 e5             	mov    %rsp,%rbp
+  802171:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802171 <sys_getenvid+0x4>
+  802178:	49 bb cf 8e 00 00 00 	movabs $0x8ecf,%r11
+  80217f:	00 00 00 
+  802182:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802185:	48 83 ec 08          	sub    $0x8,%rsp
+  802189:	6a 00                	push   $0x0
+  80218b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802191:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802197:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80219c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8021ab:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  8021b2:	ff ff ff 
+  8021b5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021b9:	ff d0                	call   *%rax
+  8021bb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021bf:	c9                   	leave
+  8021c0:	c3                   	ret
+
+00000000008021c1 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8021c1:	55                   	push   %rbp
+  8021c2:	48 89 e5             	mov    %rsp,%rbp
+  8021c5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021c5 <sys_yield+0x4>
+  8021cc:	49 bb 7b 8e 00 00 00 	movabs $0x8e7b,%r11
+  8021d3:	00 00 00 
+  8021d6:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8021d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8021dd:	6a 00                	push   $0x0
+  8021df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8021fa:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021ff:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  802206:	ff ff ff 
+  802209:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80220d:	ff d0                	call   *%rax
+  80220f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802213:	90                   	nop
+  802214:	c9                   	leave
+  802215:	c3                   	ret
+
+0000000000802216 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802216:	55                   	push   %rbp
+  802217:	48 89 e5             	mov    %rsp,%rbp
+  80221a:	48 83 ec 10          	sub    $0x10,%rsp
+  80221e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80221e <sys_page_alloc+0x8>
+  802225:	49 bb 22 8e 00 00 00 	movabs $0x8e22,%r11
+  80222c:	00 00 00 
+  80222f:	4c 01 d8             	add    %r11,%rax
+  802232:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802235:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802239:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80223c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80223f:	48 63 f2             	movslq %edx,%rsi
+  802242:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802246:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802249:	48 63 d2             	movslq %edx,%rdx
+  80224c:	48 83 ec 08          	sub    $0x8,%rsp
+  802250:	6a 00                	push   $0x0
+  802252:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802258:	49 89 f0             	mov    %rsi,%r8
+  80225b:	be 01 00 00 00       	mov    $0x1,%esi
+  802260:	bf 04 00 00 00       	mov    $0x4,%edi
+  802265:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  80226c:	ff ff ff 
+  80226f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802273:	ff d0                	call   *%rax
+  802275:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802279:	c9                   	leave
+  80227a:	c3                   	ret
+
+000000000080227b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80227b:	55                   	push   %rbp
+  80227c:	48 89 e5             	mov    %rsp,%rbp
+  80227f:	48 83 ec 20          	sub    $0x20,%rsp
+  802283:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802283 <sys_page_map+0x8>
+  80228a:	49 bb bd 8d 00 00 00 	movabs $0x8dbd,%r11
+  802291:	00 00 00 
+  802294:	4c 01 d8             	add    %r11,%rax
+  802297:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80229a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80229e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8022a1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8022a5:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8022a9:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8022ac:	48 63 f2             	movslq %edx,%rsi
+  8022af:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8022b3:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022b6:	48 63 fa             	movslq %edx,%rdi
+  8022b9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022bd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022c0:	48 63 d2             	movslq %edx,%rdx
+  8022c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8022c7:	56                   	push   %rsi
+  8022c8:	4d 89 c1             	mov    %r8,%r9
+  8022cb:	49 89 f8             	mov    %rdi,%r8
+  8022ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8022d3:	bf 05 00 00 00       	mov    $0x5,%edi
+  8022d8:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  8022df:	ff ff ff 
+  8022e2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022e6:	ff d0                	call   *%rax
+  8022e8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ec:	c9                   	leave
+  8022ed:	c3                   	ret
+
+00000000008022ee <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8022ee:	55                   	push   %rbp
+  8022ef:	48 89 e5             	mov    %rsp,%rbp
+  8022f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8022f6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022f6 <sys_page_unmap+0x8>
+  8022fd:	49 bb 4a 8d 00 00 00 	movabs $0x8d4a,%r11
+  802304:	00 00 00 
+  802307:	4c 01 d8             	add    %r11,%rax
+  80230a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80230d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802311:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802315:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802318:	48 63 d2             	movslq %edx,%rdx
+  80231b:	48 83 ec 08          	sub    $0x8,%rsp
+  80231f:	6a 00                	push   $0x0
+  802321:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802327:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80232d:	be 01 00 00 00       	mov    $0x1,%esi
+  802332:	bf 06 00 00 00       	mov    $0x6,%edi
+  802337:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  80233e:	ff ff ff 
+  802341:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802345:	ff d0                	call   *%rax
+  802347:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80234b:	c9                   	leave
+  80234c:	c3                   	ret
+
+000000000080234d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80234d:	55                   	push   %rbp
+  80234e:	48 89 e5             	mov    %rsp,%rbp
+  802351:	48 83 ec 10          	sub    $0x10,%rsp
+  802355:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802355 <sys_env_set_status+0x8>
+  80235c:	49 bb eb 8c 00 00 00 	movabs $0x8ceb,%r11
+  802363:	00 00 00 
+  802366:	4c 01 d8             	add    %r11,%rax
+  802369:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80236c:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80236f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802372:	48 63 ca             	movslq %edx,%rcx
+  802375:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802378:	48 63 d2             	movslq %edx,%rdx
+  80237b:	48 83 ec 08          	sub    $0x8,%rsp
+  80237f:	6a 00                	push   $0x0
+  802381:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802387:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80238d:	be 01 00 00 00       	mov    $0x1,%esi
+  802392:	bf 08 00 00 00       	mov    $0x8,%edi
+  802397:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  80239e:	ff ff ff 
+  8023a1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023a5:	ff d0                	call   *%rax
+  8023a7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023ab:	c9                   	leave
+  8023ac:	c3                   	ret
+
+00000000008023ad <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8023ad:	55                   	push   %rbp
+  8023ae:	48 89 e5             	mov    %rsp,%rbp
+  8023b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8023b5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023b5 <sys_env_set_trapframe+0x8>
+  8023bc:	49 bb 8b 8c 00 00 00 	movabs $0x8c8b,%r11
+  8023c3:	00 00 00 
+  8023c6:	4c 01 d8             	add    %r11,%rax
+  8023c9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8023d0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023d4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023d7:	48 63 d2             	movslq %edx,%rdx
+  8023da:	48 83 ec 08          	sub    $0x8,%rsp
+  8023de:	6a 00                	push   $0x0
+  8023e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8023f1:	bf 09 00 00 00       	mov    $0x9,%edi
+  8023f6:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  8023fd:	ff ff ff 
+  802400:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802404:	ff d0                	call   *%rax
+  802406:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80240a:	c9                   	leave
+  80240b:	c3                   	ret
+
+000000000080240c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80240c:	55                   	push   %rbp
+  80240d:	48 89 e5             	mov    %rsp,%rbp
+  802410:	48 83 ec 10          	sub    $0x10,%rsp
+  802414:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802414 <sys_env_set_pgfault_upcall+0x8>
+  80241b:	49 bb 2c 8c 00 00 00 	movabs $0x8c2c,%r11
+  802422:	00 00 00 
+  802425:	4c 01 d8             	add    %r11,%rax
+  802428:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80242b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80242f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802433:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802436:	48 63 d2             	movslq %edx,%rdx
+  802439:	48 83 ec 08          	sub    $0x8,%rsp
+  80243d:	6a 00                	push   $0x0
+  80243f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802445:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80244b:	be 01 00 00 00       	mov    $0x1,%esi
+  802450:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802455:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  80245c:	ff ff ff 
+  80245f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802463:	ff d0                	call   *%rax
+  802465:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802469:	c9                   	leave
+  80246a:	c3                   	ret
+
+000000000080246b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80246b:	55                   	push   %rbp
+  80246c:	48 89 e5             	mov    %rsp,%rbp
+  80246f:	48 83 ec 20          	sub    $0x20,%rsp
+  802473:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802473 <sys_ipc_try_send+0x8>
+  80247a:	49 bb cd 8b 00 00 00 	movabs $0x8bcd,%r11
+  802481:	00 00 00 
+  802484:	4c 01 d8             	add    %r11,%rax
+  802487:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80248a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80248e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802492:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802495:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802498:	48 63 fa             	movslq %edx,%rdi
+  80249b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80249f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024a2:	48 63 d2             	movslq %edx,%rdx
+  8024a5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ad:	6a 00                	push   $0x0
+  8024af:	49 89 f9             	mov    %rdi,%r9
+  8024b2:	49 89 f0             	mov    %rsi,%r8
+  8024b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ba:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8024bf:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  8024c6:	ff ff ff 
+  8024c9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024cd:	ff d0                	call   *%rax
+  8024cf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024d3:	c9                   	leave
+  8024d4:	c3                   	ret
+
+00000000008024d5 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8024d5:	55                   	push   %rbp
+  8024d6:	48 89 e5             	mov    %rsp,%rbp
+  8024d9:	48 83 ec 20          	sub    $0x20,%rsp
+  8024dd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024dd <sys_ipc_send+0x8>
+  8024e4:	49 bb 63 8b 00 00 00 	movabs $0x8b63,%r11
+  8024eb:	00 00 00 
+  8024ee:	4c 01 d8             	add    %r11,%rax
+  8024f1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024f8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024fc:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8024ff:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802502:	48 63 fa             	movslq %edx,%rdi
+  802505:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802509:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80250c:	48 63 d2             	movslq %edx,%rdx
+  80250f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802513:	48 83 ec 08          	sub    $0x8,%rsp
+  802517:	6a 00                	push   $0x0
+  802519:	49 89 f9             	mov    %rdi,%r9
+  80251c:	49 89 f0             	mov    %rsi,%r8
+  80251f:	be 00 00 00 00       	mov    $0x0,%esi
+  802524:	bf 17 00 00 00       	mov    $0x17,%edi
+  802529:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  802530:	ff ff ff 
+  802533:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802537:	ff d0                	call   *%rax
+  802539:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80253d:	c9                   	leave
+  80253e:	c3                   	ret
+
+000000000080253f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80253f:	55                   	push   %rbp
+  802540:	48 89 e5             	mov    %rsp,%rbp
+  802543:	48 83 ec 10          	sub    $0x10,%rsp
+  802547:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802547 <sys_ipc_recv+0x8>
+  80254e:	49 bb f9 8a 00 00 00 	movabs $0x8af9,%r11
+  802555:	00 00 00 
+  802558:	4c 01 d8             	add    %r11,%rax
+  80255b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80255f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802563:	6a 00                	push   $0x0
+  802565:	6a 00                	push   $0x0
+  802567:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80256d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802573:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802578:	be 01 00 00 00       	mov    $0x1,%esi
+  80257d:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802582:	49 ba 6f 6e ff ff ff 	movabs $0xffffffffffff6e6f,%r10
+  802589:	ff ff ff 
+  80258c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802590:	ff d0                	call   *%rax
+  802592:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802596:	c9                   	leave
+  802597:	c3                   	ret
+
+0000000000802598 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802598:	55                   	push   %rbp
+  802599:	48 89 e5             	mov    %rsp,%rbp
+  80259c:	48 83 ec 30          	sub    $0x30,%rsp
+  8025a0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025a0 <sys_ipc_call+0x8>
+  8025a7:	49 bb a0 8a 00 00 00 	movabs $0x8aa0,%r11
+  8025ae:	00 00 00 
+  8025b1:	4c 01 d8             	add    %r11,%rax
+  8025b4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025b7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025bb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025bf:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8025c2:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8025c6:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8025ca:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8025ce:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025d1:	4c 63 c2             	movslq %edx,%r8
+  8025d4:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8025d8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025db:	48 63 d2             	movslq %edx,%rdx
+  8025de:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025e2:	ff 75 d8             	push   -0x28(%rbp)
+  8025e5:	56                   	push   %rsi
+  8025e6:	4d 89 c1             	mov    %r8,%r9
+  8025e9:	49 89 f8             	mov    %rdi,%r8
+  8025ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f1:	bf 18 00 00 00       	mov    $0x18,%edi
+  8025f6:	49 ba 6f 6e ff ff ff 	movabs $0xffffffffffff6e6f,%r10
+  8025fd:	ff ff ff 
+  802600:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802604:	ff d0                	call   *%rax
+  802606:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  80260a:	c9                   	leave
+  80260b:	c3                   	ret
+
+000000000080260c <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  80260c:	55                   	push   %rbp
+  80260d:	48 89 e5             	mov    %rsp,%rbp
+  802610:	48 83 ec 30          	sub    $0x30,%rsp
+  802614:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802614 <sys_ipc_reply_recv+0x8>
+  80261b:	49 bb 2c 8a 00 00 00 	movabs $0x8a2c,%r11
+  802622:	00 00 00 
+  802625:	4c 01 d8             	add    %r11,%rax
+  802628:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80262b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80262f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802633:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802636:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80263a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80263e:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802642:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802645:	4c 63 c2             	movslq %edx,%r8
+  802648:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80264c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80264f:	48 63 d2             	movslq %edx,%rdx
+  802652:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802656:	ff 75 d8             	push   -0x28(%rbp)
+  802659:	56                   	push   %rsi
+  80265a:	4d 89 c1             	mov    %r8,%r9
+  80265d:	49 89 f8             	mov    %rdi,%r8
+  802660:	be 00 00 00 00       	mov    $0x0,%esi
+  802665:	bf 19 00 00 00       	mov    $0x19,%edi
+  80266a:	49 ba 6f 6e ff ff ff 	movabs $0xffffffffffff6e6f,%r10
+  802671:	ff ff ff 
+  802674:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802678:	ff d0                	call   *%rax
+  80267a:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  80267e:	c9                   	leave
+  80267f:	c3                   	ret
+
+0000000000802680 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802680:	55                   	push   %rbp
+  802681:	48 89 e5             	mov    %rsp,%rbp
+  802684:	48 83 ec 10          	sub    $0x10,%rsp
+  802688:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802688 <sys_env_set_priority+0x8>
+  80268f:	49 bb b8 89 00 00 00 	movabs $0x89b8,%r11
+  802696:	00 00 00 
+  802699:	4c 01 d8             	add    %r11,%rax
+  80269c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80269f:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8026a2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026a5:	48 63 ca             	movslq %edx,%rcx
+  8026a8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026ab:	48 63 d2             	movslq %edx,%rdx
+  8026ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b2:	6a 00                	push   $0x0
+  8026b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026c0:	be 01 00 00 00       	mov    $0x1,%esi
+  8026c5:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8026ca:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  8026d1:	ff ff ff 
+  8026d4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026d8:	ff d0                	call   *%rax
+  8026da:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026de:	c9                   	leave
+  8026df:	c3                   	ret
+
+00000000008026e0 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8026e0:	55                   	push   %rbp
+  8026e1:	48 89 e5             	mov    %rsp,%rbp
+  8026e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8026e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026e8 <sys_env_set_affinity+0x8>
+  8026ef:	49 bb 58 89 00 00 00 	movabs $0x8958,%r11
+  8026f6:	00 00 00 
+  8026f9:	4c 01 d8             	add    %r11,%rax
+  8026fc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026ff:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802702:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802705:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802708:	48 63 d2             	movslq %edx,%rdx
+  80270b:	48 83 ec 08          	sub    $0x8,%rsp
+  80270f:	6a 00                	push   $0x0
+  802711:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802717:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80271d:	be 01 00 00 00       	mov    $0x1,%esi
+  802722:	bf 10 00 00 00       	mov    $0x10,%edi
+  802727:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  80272e:	ff ff ff 
+  802731:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802735:	ff d0                	call   *%rax
+  802737:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80273b:	c9                   	leave
+  80273c:	c3                   	ret
+
+000000000080273d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80273d:	55                   	push   %rbp
+  80273e:	48 89 e5             	mov    %rsp,%rbp
+  802741:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802741 <sys_time_msec+0x4>
+  802748:	49 bb ff 88 00 00 00 	movabs $0x88ff,%r11
+  80274f:	00 00 00 
+  802752:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802755:	48 83 ec 08          	sub    $0x8,%rsp
+  802759:	6a 00                	push   $0x0
+  80275b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802761:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802767:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80276c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802771:	be 00 00 00 00       	mov    $0x0,%esi
+  802776:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80277b:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  802782:	ff ff ff 
+  802785:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802789:	ff d0                	call   *%rax
+  80278b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80278f:	c9                   	leave
+  802790:	c3                   	ret
+
+0000000000802791 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802791:	55                   	push   %rbp
+  802792:	48 89 e5             	mov    %rsp,%rbp
+  802795:	48 83 ec 10          	sub    $0x10,%rsp
+  802799:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802799 <sys_sleep_usec+0x8>
+  8027a0:	49 bb a7 88 00 00 00 	movabs $0x88a7,%r11
+  8027a7:	00 00 00 
+  8027aa:	4c 01 d8             	add    %r11,%rax
+  8027ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8027b1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b9:	6a 00                	push   $0x0
+  8027bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d1:	bf 11 00 00 00       	mov    $0x11,%edi
+  8027d6:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  8027dd:	ff ff ff 
+  8027e0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027e4:	ff d0                	call   *%rax
+  8027e6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027ea:	c9                   	leave
+  8027eb:	c3                   	ret
+
+00000000008027ec <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8027ec:	55                   	push   %rbp
+  8027ed:	48 89 e5             	mov    %rsp,%rbp
+  8027f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8027f4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027f4 <sys_page_alloc_huge+0x8>
+  8027fb:	49 bb 4c 88 00 00 00 	movabs $0x884c,%r11
+  802802:	00 00 00 
+  802805:	4c 01 d8             	add    %r11,%rax
+  802808:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80280b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80280f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802812:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802815:	48 63 f2             	movslq %edx,%rsi
+  802818:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80281c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80281f:	48 63 d2             	movslq %edx,%rdx
+  802822:	48 83 ec 08          	sub    $0x8,%rsp
+  802826:	6a 00                	push   $0x0
+  802828:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80282e:	49 89 f0             	mov    %rsi,%r8
+  802831:	be 01 00 00 00       	mov    $0x1,%esi
+  802836:	bf 12 00 00 00       	mov    $0x12,%edi
+  80283b:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  802842:	ff ff ff 
+  802845:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802849:	ff d0                	call   *%rax
+  80284b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80284f:	c9                   	leave
+  802850:	c3                   	ret
+
+0000000000802851 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802851:	55                   	push   %rbp
+  802852:	48 89 e5             	mov    %rsp,%rbp
+  802855:	48 83 ec 10          	sub    $0x10,%rsp
+  802859:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802859 <sys_page_map_batch+0x8>
+  802860:	49 bb e7 87 00 00 00 	movabs $0x87e7,%r11
+  802867:	00 00 00 
+  80286a:	4c 01 d8             	add    %r11,%rax
+  80286d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802871:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802875:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802879:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80287d:	48 83 ec 08          	sub    $0x8,%rsp
+  802881:	6a 00                	push   $0x0
+  802883:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802889:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80288f:	be 01 00 00 00       	mov    $0x1,%esi
+  802894:	bf 13 00 00 00       	mov    $0x13,%edi
+  802899:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  8028a0:	ff ff ff 
+  8028a3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028a7:	ff d0                	call   *%rax
+  8028a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028ad:	c9                   	leave
+  8028ae:	c3                   	ret
+
+00000000008028af <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8028af:	55                   	push   %rbp
+  8028b0:	48 89 e5             	mov    %rsp,%rbp
+  8028b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8028b7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028b7 <sys_page_alloc_batch+0x8>
+  8028be:	49 bb 89 87 00 00 00 	movabs $0x8789,%r11
+  8028c5:	00 00 00 
+  8028c8:	4c 01 d8             	add    %r11,%rax
+  8028cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028cf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8028d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028d7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028db:	48 83 ec 08          	sub    $0x8,%rsp
+  8028df:	6a 00                	push   $0x0
+  8028e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8028f2:	bf 14 00 00 00       	mov    $0x14,%edi
+  8028f7:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  8028fe:	ff ff ff 
+  802901:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802905:	ff d0                	call   *%rax
+  802907:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80290b:	c9                   	leave
+  80290c:	c3                   	ret
+
+000000000080290d <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  80290d:	55                   	push   %rbp
+  80290e:	48 89 e5             	mov    %rsp,%rbp
+  802911:	48 83 ec 10          	sub    $0x10,%rsp
+  802915:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802915 <sys_page_unmap_batch+0x8>
+  80291c:	49 bb 2b 87 00 00 00 	movabs $0x872b,%r11
+  802923:	00 00 00 
+  802926:	4c 01 d8             	add    %r11,%rax
+  802929:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80292d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802931:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802935:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802939:	48 83 ec 08          	sub    $0x8,%rsp
+  80293d:	6a 00                	push   $0x0
+  80293f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802945:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80294b:	be 01 00 00 00       	mov    $0x1,%esi
+  802950:	bf 15 00 00 00       	mov    $0x15,%edi
+  802955:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  80295c:	ff ff ff 
+  80295f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802963:	ff d0                	call   *%rax
+  802965:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802969:	c9                   	leave
+  80296a:	c3                   	ret
+
+000000000080296b <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80296b:	55                   	push   %rbp
+  80296c:	48 89 e5             	mov    %rsp,%rbp
+  80296f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80296f <sys_fork+0x4>
+  802976:	49 bb d1 86 00 00 00 	movabs $0x86d1,%r11
+  80297d:	00 00 00 
+  802980:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802983:	48 83 ec 08          	sub    $0x8,%rsp
+  802987:	6a 00                	push   $0x0
+  802989:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80298f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802995:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80299a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80299f:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a4:	bf 16 00 00 00       	mov    $0x16,%edi
+  8029a9:	49 ba b5 6d ff ff ff 	movabs $0xffffffffffff6db5,%r10
+  8029b0:	ff ff ff 
+  8029b3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029b7:	ff d0                	call   *%rax
+  8029b9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029bd:	c9                   	leave
+  8029be:	c3                   	ret
+
+00000000008029bf <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8029bf:	55                   	push   %rbp
+  8029c0:	48 89 e5             	mov    %rsp,%rbp
+  8029c3:	41 57                	push   %r15
+  8029c5:	53                   	push   %rbx
+  8029c6:	48 83 ec 40          	sub    $0x40,%rsp
+  8029ca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8029ca <pgfault+0xb>
+  8029d1:	49 bb 76 86 00 00 00 	movabs $0x8676,%r11
+  8029d8:	00 00 00 
+  8029db:	4c 01 db             	add    %r11,%rbx
+  8029de:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  8029e2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029e6:	48 8b 00             	mov    (%rax),%rax
+  8029e9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  8029ed:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029f1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029f5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  8029f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029fc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802a00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a04:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802a0a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802a0e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802a11:	83 e0 02             	and    $0x2,%eax
+  802a14:	85 c0                	test   %eax,%eax
+  802a16:	0f 84 91 03 00 00    	je     802dad <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802a1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a20:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a24:	48 89 c2             	mov    %rax,%rdx
+  802a27:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802a2e:	ff ff ff 
+  802a31:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802a35:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a39:	83 e0 01             	and    $0x1,%eax
+  802a3c:	48 85 c0             	test   %rax,%rax
+  802a3f:	0f 84 a7 01 00 00    	je     802bec <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802a45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a49:	48 c1 e8 15          	shr    $0x15,%rax
+  802a4d:	48 89 c2             	mov    %rax,%rdx
+  802a50:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802a57:	ff ff ff 
+  802a5a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802a5e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a62:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802a67:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802a6d:	0f 85 79 01 00 00    	jne    802bec <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802a73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a77:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802a7b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a7f:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802a85:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802a89:	ba 07 00 00 00       	mov    $0x7,%edx
+  802a8e:	be 00 00 60 00       	mov    $0x600000,%esi
+  802a93:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a98:	49 89 df             	mov    %rbx,%r15
+  802a9b:	48 b8 ac 77 ff ff ff 	movabs $0xffffffffffff77ac,%rax
+  802aa2:	ff ff ff 
+  802aa5:	48 01 d8             	add    %rbx,%rax
+  802aa8:	ff d0                	call   *%rax
+  802aaa:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802aad:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802ab1:	79 44                	jns    802af7 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802ab3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802ab6:	89 c1                	mov    %eax,%ecx
+  802ab8:	48 b8 50 d6 ff ff ff 	movabs $0xffffffffffffd650,%rax
+  802abf:	ff ff ff 
+  802ac2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ac6:	48 89 c2             	mov    %rax,%rdx
+  802ac9:	be 20 00 00 00       	mov    $0x20,%esi
+  802ace:	48 b8 70 d6 ff ff ff 	movabs $0xffffffffffffd670,%rax
+  802ad5:	ff ff ff 
+  802ad8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802adc:	48 89 c7             	mov    %rax,%rdi
+  802adf:	49 89 df             	mov    %rbx,%r15
+  802ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae7:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  802aee:	ff ff ff 
+  802af1:	49 01 d8             	add    %rbx,%r8
+  802af4:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802af7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802afb:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802b00:	48 89 c6             	mov    %rax,%rsi
+  802b03:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802b08:	49 89 df             	mov    %rbx,%r15
+  802b0b:	48 b8 25 6a ff ff ff 	movabs $0xffffffffffff6a25,%rax
+  802b12:	ff ff ff 
+  802b15:	48 01 d8             	add    %rbx,%rax
+  802b18:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802b1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b1e:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802b24:	48 89 c1             	mov    %rax,%rcx
+  802b27:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b2c:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b31:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b36:	49 89 df             	mov    %rbx,%r15
+  802b39:	48 b8 3b 72 ff ff ff 	movabs $0xffffffffffff723b,%rax
+  802b40:	ff ff ff 
+  802b43:	48 01 d8             	add    %rbx,%rax
+  802b46:	ff d0                	call   *%rax
+  802b48:	85 c0                	test   %eax,%eax
+  802b4a:	74 3e                	je     802b8a <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802b4c:	48 b8 7b d6 ff ff ff 	movabs $0xffffffffffffd67b,%rax
+  802b53:	ff ff ff 
+  802b56:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b5a:	48 89 c2             	mov    %rax,%rdx
+  802b5d:	be 23 00 00 00       	mov    $0x23,%esi
+  802b62:	48 b8 70 d6 ff ff ff 	movabs $0xffffffffffffd670,%rax
+  802b69:	ff ff ff 
+  802b6c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b70:	48 89 c7             	mov    %rax,%rdi
+  802b73:	49 89 df             	mov    %rbx,%r15
+  802b76:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b7b:	48 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%rcx
+  802b82:	ff ff ff 
+  802b85:	48 01 d9             	add    %rbx,%rcx
+  802b88:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802b8a:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b94:	49 89 df             	mov    %rbx,%r15
+  802b97:	48 b8 ae 72 ff ff ff 	movabs $0xffffffffffff72ae,%rax
+  802b9e:	ff ff ff 
+  802ba1:	48 01 d8             	add    %rbx,%rax
+  802ba4:	ff d0                	call   *%rax
+  802ba6:	85 c0                	test   %eax,%eax
+  802ba8:	0f 84 3d 02 00 00    	je     802deb <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802bae:	48 b8 90 d6 ff ff ff 	movabs $0xffffffffffffd690,%rax
+  802bb5:	ff ff ff 
+  802bb8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bbc:	48 89 c2             	mov    %rax,%rdx
+  802bbf:	be 25 00 00 00       	mov    $0x25,%esi
+  802bc4:	48 b8 70 d6 ff ff ff 	movabs $0xffffffffffffd670,%rax
+  802bcb:	ff ff ff 
+  802bce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bd2:	48 89 c7             	mov    %rax,%rdi
+  802bd5:	49 89 df             	mov    %rbx,%r15
+  802bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bdd:	48 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%rcx
+  802be4:	ff ff ff 
+  802be7:	48 01 d9             	add    %rbx,%rcx
+  802bea:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802bec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bf0:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bf4:	48 89 c2             	mov    %rax,%rdx
+  802bf7:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802bfe:	ff ff ff 
+  802c01:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c05:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c09:	25 00 08 00 00       	and    $0x800,%eax
+  802c0e:	48 85 c0             	test   %rax,%rax
+  802c11:	0f 84 58 01 00 00    	je     802d6f <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802c17:	ba 07 00 00 00       	mov    $0x7,%edx
+  802c1c:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802c21:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c26:	49 89 df             	mov    %rbx,%r15
+  802c29:	48 b8 d6 71 ff ff ff 	movabs $0xffffffffffff71d6,%rax
+  802c30:	ff ff ff 
+  802c33:	48 01 d8             	add    %rbx,%rax
+  802c36:	ff d0                	call   *%rax
+  802c38:	85 c0                	test   %eax,%eax
+  802c3a:	74 3e                	je     802c7a <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802c3c:	48 b8 a7 d6 ff ff ff 	movabs $0xffffffffffffd6a7,%rax
+  802c43:	ff ff ff 
+  802c46:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c4a:	48 89 c2             	mov    %rax,%rdx
+  802c4d:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802c52:	48 b8 70 d6 ff ff ff 	movabs $0xffffffffffffd670,%rax
+  802c59:	ff ff ff 
+  802c5c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c60:	48 89 c7             	mov    %rax,%rdi
+  802c63:	49 89 df             	mov    %rbx,%r15
+  802c66:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6b:	48 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%rcx
+  802c72:	ff ff ff 
+  802c75:	48 01 d9             	add    %rbx,%rcx
+  802c78:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802c7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c7e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c83:	48 89 c6             	mov    %rax,%rsi
+  802c86:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802c8b:	49 89 df             	mov    %rbx,%r15
+  802c8e:	48 b8 25 6a ff ff ff 	movabs $0xffffffffffff6a25,%rax
+  802c95:	ff ff ff 
+  802c98:	48 01 d8             	add    %rbx,%rax
+  802c9b:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802c9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ca1:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802ca7:	48 89 c1             	mov    %rax,%rcx
+  802caa:	ba 00 00 00 00       	mov    $0x0,%edx
+  802caf:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802cb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb9:	49 89 df             	mov    %rbx,%r15
+  802cbc:	48 b8 3b 72 ff ff ff 	movabs $0xffffffffffff723b,%rax
+  802cc3:	ff ff ff 
+  802cc6:	48 01 d8             	add    %rbx,%rax
+  802cc9:	ff d0                	call   *%rax
+  802ccb:	85 c0                	test   %eax,%eax
+  802ccd:	74 3e                	je     802d0d <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802ccf:	48 b8 7b d6 ff ff ff 	movabs $0xffffffffffffd67b,%rax
+  802cd6:	ff ff ff 
+  802cd9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cdd:	48 89 c2             	mov    %rax,%rdx
+  802ce0:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802ce5:	48 b8 70 d6 ff ff ff 	movabs $0xffffffffffffd670,%rax
+  802cec:	ff ff ff 
+  802cef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cf3:	48 89 c7             	mov    %rax,%rdi
+  802cf6:	49 89 df             	mov    %rbx,%r15
+  802cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfe:	48 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%rcx
+  802d05:	ff ff ff 
+  802d08:	48 01 d9             	add    %rbx,%rcx
+  802d0b:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802d0d:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802d12:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d17:	49 89 df             	mov    %rbx,%r15
+  802d1a:	48 b8 ae 72 ff ff ff 	movabs $0xffffffffffff72ae,%rax
+  802d21:	ff ff ff 
+  802d24:	48 01 d8             	add    %rbx,%rax
+  802d27:	ff d0                	call   *%rax
+  802d29:	85 c0                	test   %eax,%eax
+  802d2b:	0f 84 bb 00 00 00    	je     802dec <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802d31:	48 b8 90 d6 ff ff ff 	movabs $0xffffffffffffd690,%rax
+  802d38:	ff ff ff 
+  802d3b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d3f:	48 89 c2             	mov    %rax,%rdx
+  802d42:	be 32 00 00 00       	mov    $0x32,%esi
+  802d47:	48 b8 70 d6 ff ff ff 	movabs $0xffffffffffffd670,%rax
+  802d4e:	ff ff ff 
+  802d51:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d55:	48 89 c7             	mov    %rax,%rdi
+  802d58:	49 89 df             	mov    %rbx,%r15
+  802d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d60:	48 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%rcx
+  802d67:	ff ff ff 
+  802d6a:	48 01 d9             	add    %rbx,%rcx
+  802d6d:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802d6f:	48 b8 c0 d6 ff ff ff 	movabs $0xffffffffffffd6c0,%rax
+  802d76:	ff ff ff 
+  802d79:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d7d:	48 89 c2             	mov    %rax,%rdx
+  802d80:	be 36 00 00 00       	mov    $0x36,%esi
+  802d85:	48 b8 70 d6 ff ff ff 	movabs $0xffffffffffffd670,%rax
+  802d8c:	ff ff ff 
+  802d8f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d93:	48 89 c7             	mov    %rax,%rdi
+  802d96:	49 89 df             	mov    %rbx,%r15
+  802d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9e:	48 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%rcx
+  802da5:	ff ff ff 
+  802da8:	48 01 d9             	add    %rbx,%rcx
+  802dab:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802dad:	48 b8 df d6 ff ff ff 	movabs $0xffffffffffffd6df,%rax
+  802db4:	ff ff ff 
+  802db7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dbb:	48 89 c2             	mov    %rax,%rdx
+  802dbe:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802dc3:	48 b8 70 d6 ff ff ff 	movabs $0xffffffffffffd670,%rax
+  802dca:	ff ff ff 
+  802dcd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dd1:	48 89 c7             	mov    %rax,%rdi
+  802dd4:	49 89 df             	mov    %rbx,%r15
+  802dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ddc:	48 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%rcx
+  802de3:	ff ff ff 
+  802de6:	48 01 d9             	add    %rbx,%rcx
+  802de9:	ff d1                	call   *%rcx
+			return;
+  802deb:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802dec:	48 83 c4 40          	add    $0x40,%rsp
+  802df0:	5b                   	pop    %rbx
+  802df1:	41 5f                	pop    %r15
+  802df3:	5d                   	pop    %rbp
+  802df4:	c3                   	ret
+
+0000000000802df5 <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802df5:	55                   	push   %rbp
+  802df6:	48 89 e5             	mov    %rsp,%rbp
+  802df9:	41 57                	push   %r15
+  802dfb:	53                   	push   %rbx
+  802dfc:	48 83 ec 10          	sub    $0x10,%rsp
+  802e00:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e00 <fork_flush+0xb>
+  802e07:	49 bb 40 82 00 00 00 	movabs $0x8240,%r11
+  802e0e:	00 00 00 
+  802e11:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802e14:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802e1b:	00 00 00 
+  802e1e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e22:	48 85 c0             	test   %rax,%rax
+  802e25:	0f 84 81 00 00 00    	je     802eac <fork_flush+0xb7>
+  802e2b:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802e32:	00 00 00 
+  802e35:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e39:	48 89 c6             	mov    %rax,%rsi
+  802e3c:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802e43:	00 00 00 
+  802e46:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e4a:	48 89 c7             	mov    %rax,%rdi
+  802e4d:	49 89 df             	mov    %rbx,%r15
+  802e50:	48 b8 11 78 ff ff ff 	movabs $0xffffffffffff7811,%rax
+  802e57:	ff ff ff 
+  802e5a:	48 01 d8             	add    %rbx,%rax
+  802e5d:	ff d0                	call   *%rax
+  802e5f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e62:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e66:	79 44                	jns    802eac <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802e68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e6b:	89 c1                	mov    %eax,%ecx
+  802e6d:	48 b8 f8 d6 ff ff ff 	movabs $0xffffffffffffd6f8,%rax
+  802e74:	ff ff ff 
+  802e77:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e7b:	48 89 c2             	mov    %rax,%rdx
+  802e7e:	be 56 00 00 00       	mov    $0x56,%esi
+  802e83:	48 b8 70 d6 ff ff ff 	movabs $0xffffffffffffd670,%rax
+  802e8a:	ff ff ff 
+  802e8d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e91:	48 89 c7             	mov    %rax,%rdi
+  802e94:	49 89 df             	mov    %rbx,%r15
+  802e97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e9c:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  802ea3:	ff ff ff 
+  802ea6:	49 01 d8             	add    %rbx,%r8
+  802ea9:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802eac:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802eb3:	00 00 00 
+  802eb6:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802ebd:	00 
+}
+  802ebe:	90                   	nop
+  802ebf:	48 83 c4 10          	add    $0x10,%rsp
+  802ec3:	5b                   	pop    %rbx
+  802ec4:	41 5f                	pop    %r15
+  802ec6:	5d                   	pop    %rbp
+  802ec7:	c3                   	ret
+
+0000000000802ec8 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802ec8:	55                   	push   %rbp
+  802ec9:	48 89 e5             	mov    %rsp,%rbp
+  802ecc:	53                   	push   %rbx
+  802ecd:	48 83 ec 28          	sub    $0x28,%rsp
+  802ed1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ed1 <fork_map+0x9>
+  802ed8:	49 bb 6f 81 00 00 00 	movabs $0x816f,%r11
+  802edf:	00 00 00 
+  802ee2:	4c 01 db             	add    %r11,%rbx
+  802ee5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ee8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802eec:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802eef:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802ef6:	00 00 00 
+  802ef9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802efd:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802f03:	75 10                	jne    802f15 <fork_map+0x4d>
+		fork_flush();
+  802f05:	48 b8 b5 7d ff ff ff 	movabs $0xffffffffffff7db5,%rax
+  802f0c:	ff ff ff 
+  802f0f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f13:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802f15:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802f1c:	00 00 00 
+  802f1f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f23:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802f27:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802f2e:	00 00 00 
+  802f31:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802f35:	48 c1 e0 05          	shl    $0x5,%rax
+  802f39:	48 89 c2             	mov    %rax,%rdx
+  802f3c:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802f43:	00 00 00 
+  802f46:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f4a:	48 01 d0             	add    %rdx,%rax
+  802f4d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802f51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f55:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802f5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f5f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f63:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802f67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f6b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f6e:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802f71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f75:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f79:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802f7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f81:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802f84:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  802f87:	90                   	nop
+  802f88:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f8c:	c9                   	leave
+  802f8d:	c3                   	ret
+
+0000000000802f8e <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802f8e:	55                   	push   %rbp
+  802f8f:	48 89 e5             	mov    %rsp,%rbp
+  802f92:	53                   	push   %rbx
+  802f93:	48 83 ec 28          	sub    $0x28,%rsp
+  802f97:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f97 <duppage+0x9>
+  802f9e:	49 bb a9 80 00 00 00 	movabs $0x80a9,%r11
+  802fa5:	00 00 00 
+  802fa8:	4c 01 db             	add    %r11,%rbx
+  802fab:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802fae:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  802fb1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802fb4:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fb8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  802fbc:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802fc3:	ff ff ff 
+  802fc6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fca:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802fcd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fd1:	25 00 04 00 00       	and    $0x400,%eax
+  802fd6:	48 85 c0             	test   %rax,%rax
+  802fd9:	74 42                	je     80301d <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  802fdb:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802fe2:	ff ff ff 
+  802fe5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fe9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802fec:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ff0:	25 07 0e 00 00       	and    $0xe07,%eax
+  802ff5:	89 c2                	mov    %eax,%edx
+  802ff7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802ffb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ffe:	48 89 ce             	mov    %rcx,%rsi
+  803001:	89 c7                	mov    %eax,%edi
+  803003:	48 b8 88 7e ff ff ff 	movabs $0xffffffffffff7e88,%rax
+  80300a:	ff ff ff 
+  80300d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803011:	ff d0                	call   *%rax
+		return 0;
+  803013:	b8 00 00 00 00       	mov    $0x0,%eax
+  803018:	e9 ae 00 00 00       	jmp    8030cb <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  80301d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803024:	ff ff ff 
+  803027:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80302b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80302e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803032:	83 e0 02             	and    $0x2,%eax
+  803035:	48 85 c0             	test   %rax,%rax
+  803038:	75 1f                	jne    803059 <duppage+0xcb>
+  80303a:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803041:	ff ff ff 
+  803044:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803048:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80304b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80304f:	25 00 08 00 00       	and    $0x800,%eax
+  803054:	48 85 c0             	test   %rax,%rax
+  803057:	74 4c                	je     8030a5 <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  803059:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  803060:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803063:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803067:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80306a:	48 89 ce             	mov    %rcx,%rsi
+  80306d:	89 c7                	mov    %eax,%edi
+  80306f:	48 b8 88 7e ff ff ff 	movabs $0xffffffffffff7e88,%rax
+  803076:	ff ff ff 
+  803079:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80307d:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  80307f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803082:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803086:	48 89 c6             	mov    %rax,%rsi
+  803089:	bf 00 00 00 00       	mov    $0x0,%edi
+  80308e:	48 b8 88 7e ff ff ff 	movabs $0xffffffffffff7e88,%rax
+  803095:	ff ff ff 
+  803098:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80309c:	ff d0                	call   *%rax
+		return 0;
+  80309e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a3:	eb 26                	jmp    8030cb <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  8030a5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8030a9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030ac:	ba 05 00 00 00       	mov    $0x5,%edx
+  8030b1:	48 89 ce             	mov    %rcx,%rsi
+  8030b4:	89 c7                	mov    %eax,%edi
+  8030b6:	48 b8 88 7e ff ff ff 	movabs $0xffffffffffff7e88,%rax
+  8030bd:	ff ff ff 
+  8030c0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030c4:	ff d0                	call   *%rax
+		return 0;
+  8030c6:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  8030cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030cf:	c9                   	leave
+  8030d0:	c3                   	ret
+
+00000000008030d1 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  8030d1:	55                   	push   %rbp
+  8030d2:	48 89 e5             	mov    %rsp,%rbp
+  8030d5:	53                   	push   %rbx
+  8030d6:	48 83 ec 28          	sub    $0x28,%rsp
+  8030da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030da <duphuge+0x9>
+  8030e1:	49 bb 66 7f 00 00 00 	movabs $0x7f66,%r11
+  8030e8:	00 00 00 
+  8030eb:	4c 01 db             	add    %r11,%rbx
+  8030ee:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030f1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  8030f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030f9:	48 c1 e8 15          	shr    $0x15,%rax
+  8030fd:	48 89 c2             	mov    %rax,%rdx
+  803100:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803107:	ff ff ff 
+  80310a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80310e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803112:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  803116:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80311a:	25 00 04 00 00       	and    $0x400,%eax
+  80311f:	48 85 c0             	test   %rax,%rax
+  803122:	74 0e                	je     803132 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  803124:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803128:	25 07 0e 00 00       	and    $0xe07,%eax
+  80312d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803130:	eb 1e                	jmp    803150 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  803132:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803136:	25 02 08 00 00       	and    $0x802,%eax
+  80313b:	48 85 c0             	test   %rax,%rax
+  80313e:	74 09                	je     803149 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  803140:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  803147:	eb 07                	jmp    803150 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  803149:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  803150:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803153:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803157:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80315a:	48 89 ce             	mov    %rcx,%rsi
+  80315d:	89 c7                	mov    %eax,%edi
+  80315f:	48 b8 88 7e ff ff ff 	movabs $0xffffffffffff7e88,%rax
+  803166:	ff ff ff 
+  803169:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80316d:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  80316f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803172:	25 00 08 00 00       	and    $0x800,%eax
+  803177:	85 c0                	test   %eax,%eax
+  803179:	74 1f                	je     80319a <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  80317b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80317e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803182:	48 89 c6             	mov    %rax,%rsi
+  803185:	bf 00 00 00 00       	mov    $0x0,%edi
+  80318a:	48 b8 88 7e ff ff ff 	movabs $0xffffffffffff7e88,%rax
+  803191:	ff ff ff 
+  803194:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803198:	ff d0                	call   *%rax
+	return 0;
+  80319a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80319f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031a3:	c9                   	leave
+  8031a4:	c3                   	ret
+
+00000000008031a5 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8031a5:	55                   	push   %rbp
+  8031a6:	48 89 e5             	mov    %rsp,%rbp
+  8031a9:	41 57                	push   %r15
+  8031ab:	53                   	push   %rbx
+  8031ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8031b0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031b0 <fork+0xb>
+  8031b7:	49 bb 90 7e 00 00 00 	movabs $0x7e90,%r11
+  8031be:	00 00 00 
+  8031c1:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  8031c4:	49 89 df             	mov    %rbx,%r15
+  8031c7:	48 b8 2b 79 ff ff ff 	movabs $0xffffffffffff792b,%rax
+  8031ce:	ff ff ff 
+  8031d1:	48 01 d8             	add    %rbx,%rax
+  8031d4:	ff d0                	call   *%rax
+  8031d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031d9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031dd:	75 42                	jne    803221 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8031df:	49 89 df             	mov    %rbx,%r15
+  8031e2:	48 b8 2d 71 ff ff ff 	movabs $0xffffffffffff712d,%rax
+  8031e9:	ff ff ff 
+  8031ec:	48 01 d8             	add    %rbx,%rax
+  8031ef:	ff d0                	call   *%rax
+  8031f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031f6:	48 98                	cltq
+  8031f8:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8031ff:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803206:	ff ff ff 
+  803209:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80320d:	48 01 c2             	add    %rax,%rdx
+  803210:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803217:	ff ff ff 
+  80321a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80321e:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  803221:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803224:	48 83 c4 10          	add    $0x10,%rsp
+  803228:	5b                   	pop    %rbx
+  803229:	41 5f                	pop    %r15
+  80322b:	5d                   	pop    %rbp
+  80322c:	c3                   	ret
+
+000000000080322d <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  80322d:	55                   	push   %rbp
+  80322e:	48 89 e5             	mov    %rsp,%rbp
+  803231:	41 57                	push   %r15
+  803233:	53                   	push   %rbx
+  803234:	48 83 ec 10          	sub    $0x10,%rsp
+  803238:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803238 <ufork+0xb>
+  80323f:	49 bb 08 7e 00 00 00 	movabs $0x7e08,%r11
+  803246:	00 00 00 
+  803249:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  80324c:	48 b8 7f 79 ff ff ff 	movabs $0xffffffffffff797f,%rax
+  803253:	ff ff ff 
+  803256:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80325a:	48 89 c7             	mov    %rax,%rdi
+  80325d:	49 89 df             	mov    %rbx,%r15
+  803260:	48 b8 1f c7 ff ff ff 	movabs $0xffffffffffffc71f,%rax
+  803267:	ff ff ff 
+  80326a:	48 01 d8             	add    %rbx,%rax
+  80326d:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80326f:	b8 07 00 00 00       	mov    $0x7,%eax
+  803274:	cd 30                	int    $0x30
+  803276:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  803279:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  80327c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  80327f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803283:	0f 84 03 02 00 00    	je     80348c <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  803289:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803290:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  803291:	e9 28 01 00 00       	jmp    8033be <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  803296:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80329a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80329e:	48 89 c2             	mov    %rax,%rdx
+  8032a1:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8032a8:	ff ff ff 
+  8032ab:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032af:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032b3:	83 e0 01             	and    $0x1,%eax
+  8032b6:	48 85 c0             	test   %rax,%rax
+  8032b9:	0f 84 f7 00 00 00    	je     8033b6 <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  8032bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032c3:	48 c1 e8 15          	shr    $0x15,%rax
+  8032c7:	48 89 c2             	mov    %rax,%rdx
+  8032ca:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8032d1:	ff ff ff 
+  8032d4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032d8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032dc:	25 81 00 00 00       	and    $0x81,%eax
+  8032e1:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  8032e7:	75 29                	jne    803312 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  8032e9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8032ed:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8032f0:	48 89 d6             	mov    %rdx,%rsi
+  8032f3:	89 c7                	mov    %eax,%edi
+  8032f5:	48 b8 91 80 ff ff ff 	movabs $0xffffffffffff8091,%rax
+  8032fc:	ff ff ff 
+  8032ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803303:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  803305:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  80330c:	00 
+  80330d:	e9 ac 00 00 00       	jmp    8033be <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  803312:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803316:	48 c1 e8 15          	shr    $0x15,%rax
+  80331a:	48 89 c2             	mov    %rax,%rdx
+  80331d:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803324:	ff ff ff 
+  803327:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80332b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80332f:	83 e0 01             	and    $0x1,%eax
+  803332:	48 85 c0             	test   %rax,%rax
+  803335:	74 75                	je     8033ac <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  803337:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80333b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80333f:	48 89 c2             	mov    %rax,%rdx
+  803342:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803349:	ff ff ff 
+  80334c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803350:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803354:	83 e0 01             	and    $0x1,%eax
+  803357:	48 85 c0             	test   %rax,%rax
+  80335a:	74 46                	je     8033a2 <ufork+0x175>
+  80335c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803360:	48 c1 e8 0c          	shr    $0xc,%rax
+  803364:	48 89 c2             	mov    %rax,%rdx
+  803367:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80336e:	ff ff ff 
+  803371:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803375:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803379:	83 e0 04             	and    $0x4,%eax
+  80337c:	48 85 c0             	test   %rax,%rax
+  80337f:	74 21                	je     8033a2 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  803381:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803385:	48 c1 e8 0c          	shr    $0xc,%rax
+  803389:	89 c2                	mov    %eax,%edx
+  80338b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80338e:	89 d6                	mov    %edx,%esi
+  803390:	89 c7                	mov    %eax,%edi
+  803392:	48 b8 4e 7f ff ff ff 	movabs $0xffffffffffff7f4e,%rax
+  803399:	ff ff ff 
+  80339c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033a0:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  8033a2:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  8033a9:	00 
+  8033aa:	eb 12                	jmp    8033be <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  8033ac:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8033b3:	00 
+  8033b4:	eb 08                	jmp    8033be <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  8033b6:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  8033bd:	40 
+		for (; addr < USTACKTOP;){
+  8033be:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  8033c3:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8033c7:	0f 83 c9 fe ff ff    	jae    803296 <ufork+0x69>
+			}
+		}
+		fork_flush();
+  8033cd:	48 b8 b5 7d ff ff ff 	movabs $0xffffffffffff7db5,%rax
+  8033d4:	ff ff ff 
+  8033d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033db:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  8033dd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033e0:	ba 07 00 00 00       	mov    $0x7,%edx
+  8033e5:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8033ea:	48 89 ce             	mov    %rcx,%rsi
+  8033ed:	89 c7                	mov    %eax,%edi
+  8033ef:	49 89 df             	mov    %rbx,%r15
+  8033f2:	48 b8 d6 71 ff ff ff 	movabs $0xffffffffffff71d6,%rax
+  8033f9:	ff ff ff 
+  8033fc:	48 01 d8             	add    %rbx,%rax
+  8033ff:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  803401:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803404:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  80340b:	ff ff ff 
+  80340e:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803412:	48 89 d6             	mov    %rdx,%rsi
+  803415:	89 c7                	mov    %eax,%edi
+  803417:	49 89 df             	mov    %rbx,%r15
+  80341a:	48 b8 cc 73 ff ff ff 	movabs $0xffffffffffff73cc,%rax
+  803421:	ff ff ff 
+  803424:	48 01 d8             	add    %rbx,%rax
+  803427:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  803429:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80342c:	be 02 00 00 00       	mov    $0x2,%esi
+  803431:	89 c7                	mov    %eax,%edi
+  803433:	49 89 df             	mov    %rbx,%r15
+  803436:	48 b8 0d 73 ff ff ff 	movabs $0xffffffffffff730d,%rax
+  80343d:	ff ff ff 
+  803440:	48 01 d8             	add    %rbx,%rax
+  803443:	ff d0                	call   *%rax
+  803445:	85 c0                	test   %eax,%eax
+  803447:	74 3e                	je     803487 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803449:	48 b8 1f d7 ff ff ff 	movabs $0xffffffffffffd71f,%rax
+  803450:	ff ff ff 
+  803453:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803457:	48 89 c2             	mov    %rax,%rdx
+  80345a:	be 07 01 00 00       	mov    $0x107,%esi
+  80345f:	48 b8 70 d6 ff ff ff 	movabs $0xffffffffffffd670,%rax
+  803466:	ff ff ff 
+  803469:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80346d:	48 89 c7             	mov    %rax,%rdi
+  803470:	49 89 df             	mov    %rbx,%r15
+  803473:	b8 00 00 00 00       	mov    $0x0,%eax
+  803478:	48 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%rcx
+  80347f:	ff ff ff 
+  803482:	48 01 d9             	add    %rbx,%rcx
+  803485:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  803487:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80348a:	eb 59                	jmp    8034e5 <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80348c:	49 89 df             	mov    %rbx,%r15
+  80348f:	48 b8 2d 71 ff ff ff 	movabs $0xffffffffffff712d,%rax
+  803496:	ff ff ff 
+  803499:	48 01 d8             	add    %rbx,%rax
+  80349c:	ff d0                	call   *%rax
+  80349e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8034a3:	48 98                	cltq
+  8034a5:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8034ac:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8034b3:	ff ff ff 
+  8034b6:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8034ba:	48 01 c2             	add    %rax,%rdx
+  8034bd:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8034c4:	ff ff ff 
+  8034c7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034cb:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  8034ce:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  8034d5:	00 00 00 
+  8034d8:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  8034df:	00 
+		return 0;
+  8034e0:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  8034e5:	48 83 c4 10          	add    $0x10,%rsp
+  8034e9:	5b                   	pop    %rbx
+  8034ea:	41 5f                	pop    %r15
+  8034ec:	5d                   	pop    %rbp
+  8034ed:	c3                   	ret
+
+00000000008034ee <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8034ee:	55                   	push   %rbp
+  8034ef:	48 89 e5             	mov    %rsp,%rbp
+  8034f2:	41 57                	push   %r15
+  8034f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8034f8:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8034f8 <sfork+0xa>
+  8034ff:	49 bb 48 7b 00 00 00 	movabs $0x7b48,%r11
+  803506:	00 00 00 
+  803509:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  80350c:	48 b8 3a d7 ff ff ff 	movabs $0xffffffffffffd73a,%rax
+  803513:	ff ff ff 
+  803516:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80351a:	48 89 c2             	mov    %rax,%rdx
+  80351d:	be 1a 01 00 00       	mov    $0x11a,%esi
+  803522:	48 b8 70 d6 ff ff ff 	movabs $0xffffffffffffd670,%rax
+  803529:	ff ff ff 
+  80352c:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803530:	48 89 c7             	mov    %rax,%rdi
+  803533:	49 89 cf             	mov    %rcx,%r15
+  803536:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353b:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  803542:	ff ff ff 
+  803545:	49 01 c8             	add    %rcx,%r8
+  803548:	41 ff d0             	call   *%r8
+
+000000000080354b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  80354b:	55                   	push   %rbp
+  80354c:	48 89 e5             	mov    %rsp,%rbp
+  80354f:	48 83 ec 08          	sub    $0x8,%rsp
+  803553:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803553 <fd2num+0x8>
+  80355a:	49 bb ed 7a 00 00 00 	movabs $0x7aed,%r11
+  803561:	00 00 00 
+  803564:	4c 01 d8             	add    %r11,%rax
+  803567:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80356b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80356f:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803576:	ff ff ff 
+  803579:	48 01 d0             	add    %rdx,%rax
+  80357c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803580:	c9                   	leave
+  803581:	c3                   	ret
+
+0000000000803582 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803582:	55                   	push   %rbp
+  803583:	48 89 e5             	mov    %rsp,%rbp
+  803586:	48 83 ec 08          	sub    $0x8,%rsp
+  80358a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80358a <fd2data+0x8>
+  803591:	49 bb b6 7a 00 00 00 	movabs $0x7ab6,%r11
+  803598:	00 00 00 
+  80359b:	4c 01 d8             	add    %r11,%rax
+  80359e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  8035a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8035a6:	48 89 d7             	mov    %rdx,%rdi
+  8035a9:	48 ba 0b 85 ff ff ff 	movabs $0xffffffffffff850b,%rdx
+  8035b0:	ff ff ff 
+  8035b3:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8035b7:	ff d0                	call   *%rax
+  8035b9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8035bf:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8035c3:	c9                   	leave
+  8035c4:	c3                   	ret
+
+00000000008035c5 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8035c5:	55                   	push   %rbp
+  8035c6:	48 89 e5             	mov    %rsp,%rbp
+  8035c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8035cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8035cd <fd_alloc+0x8>
+  8035d4:	49 bb 73 7a 00 00 00 	movabs $0x7a73,%r11
+  8035db:	00 00 00 
+  8035de:	4c 01 d8             	add    %r11,%rax
+  8035e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8035e5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8035ec:	eb 75                	jmp    803663 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8035ee:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8035f1:	48 63 d2             	movslq %edx,%rdx
+  8035f4:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8035fb:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8035ff:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803603:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803607:	48 89 d1             	mov    %rdx,%rcx
+  80360a:	48 c1 e9 15          	shr    $0x15,%rcx
+  80360e:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803615:	ff ff ff 
+  803618:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80361c:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803620:	83 e2 01             	and    $0x1,%edx
+  803623:	48 85 d2             	test   %rdx,%rdx
+  803626:	74 25                	je     80364d <fd_alloc+0x88>
+  803628:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80362c:	48 89 d1             	mov    %rdx,%rcx
+  80362f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803633:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  80363a:	ff ff ff 
+  80363d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803641:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803645:	83 e2 01             	and    $0x1,%edx
+  803648:	48 85 d2             	test   %rdx,%rdx
+  80364b:	75 12                	jne    80365f <fd_alloc+0x9a>
+			*fd_store = fd;
+  80364d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803651:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803655:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803658:	b8 00 00 00 00       	mov    $0x0,%eax
+  80365d:	eb 1a                	jmp    803679 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  80365f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803663:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803667:	7e 85                	jle    8035ee <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803669:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80366d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803674:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803679:	c9                   	leave
+  80367a:	c3                   	ret
+
+000000000080367b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80367b:	55                   	push   %rbp
+  80367c:	48 89 e5             	mov    %rsp,%rbp
+  80367f:	48 83 ec 20          	sub    $0x20,%rsp
+  803683:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803683 <fd_lookup+0x8>
+  80368a:	49 bb bd 79 00 00 00 	movabs $0x79bd,%r11
+  803691:	00 00 00 
+  803694:	4c 01 d8             	add    %r11,%rax
+  803697:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80369a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80369e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036a2:	78 06                	js     8036aa <fd_lookup+0x2f>
+  8036a4:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8036a8:	7e 07                	jle    8036b1 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8036aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036af:	eb 73                	jmp    803724 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  8036b1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8036b4:	48 63 d2             	movslq %edx,%rdx
+  8036b7:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8036be:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8036c2:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8036c6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036ca:	48 89 d1             	mov    %rdx,%rcx
+  8036cd:	48 c1 e9 15          	shr    $0x15,%rcx
+  8036d1:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8036d8:	ff ff ff 
+  8036db:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8036df:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8036e3:	83 e2 01             	and    $0x1,%edx
+  8036e6:	48 85 d2             	test   %rdx,%rdx
+  8036e9:	74 22                	je     80370d <fd_lookup+0x92>
+  8036eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036ef:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8036f3:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  8036fa:	ff ff ff 
+  8036fd:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803701:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803705:	83 e0 01             	and    $0x1,%eax
+  803708:	48 85 c0             	test   %rax,%rax
+  80370b:	75 07                	jne    803714 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  80370d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803712:	eb 10                	jmp    803724 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803714:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803718:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80371c:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  80371f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803724:	c9                   	leave
+  803725:	c3                   	ret
+
+0000000000803726 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803726:	55                   	push   %rbp
+  803727:	48 89 e5             	mov    %rsp,%rbp
+  80372a:	41 57                	push   %r15
+  80372c:	53                   	push   %rbx
+  80372d:	48 83 ec 30          	sub    $0x30,%rsp
+  803731:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803731 <fd_close+0xb>
+  803738:	49 bb 0f 79 00 00 00 	movabs $0x790f,%r11
+  80373f:	00 00 00 
+  803742:	4c 01 db             	add    %r11,%rbx
+  803745:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803749:	89 f0                	mov    %esi,%eax
+  80374b:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80374e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803752:	48 89 c7             	mov    %rax,%rdi
+  803755:	48 b8 0b 85 ff ff ff 	movabs $0xffffffffffff850b,%rax
+  80375c:	ff ff ff 
+  80375f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803763:	ff d0                	call   *%rax
+  803765:	89 c2                	mov    %eax,%edx
+  803767:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80376b:	48 89 c6             	mov    %rax,%rsi
+  80376e:	89 d7                	mov    %edx,%edi
+  803770:	48 b8 3b 86 ff ff ff 	movabs $0xffffffffffff863b,%rax
+  803777:	ff ff ff 
+  80377a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80377e:	ff d0                	call   *%rax
+  803780:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803783:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803787:	78 0a                	js     803793 <fd_close+0x6d>
+	    || fd != fd2)
+  803789:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80378d:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803791:	74 12                	je     8037a5 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803793:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803797:	74 05                	je     80379e <fd_close+0x78>
+  803799:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80379c:	eb 7a                	jmp    803818 <fd_close+0xf2>
+  80379e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a3:	eb 73                	jmp    803818 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8037a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037a9:	8b 00                	mov    (%rax),%eax
+  8037ab:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8037af:	48 89 d6             	mov    %rdx,%rsi
+  8037b2:	89 c7                	mov    %eax,%edi
+  8037b4:	48 b8 e1 87 ff ff ff 	movabs $0xffffffffffff87e1,%rax
+  8037bb:	ff ff ff 
+  8037be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037c2:	ff d0                	call   *%rax
+  8037c4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037cb:	78 2a                	js     8037f7 <fd_close+0xd1>
+		if (dev->dev_close)
+  8037cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037d1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8037d5:	48 85 c0             	test   %rax,%rax
+  8037d8:	74 16                	je     8037f0 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8037da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037de:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8037e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037e6:	48 89 c7             	mov    %rax,%rdi
+  8037e9:	ff d2                	call   *%rdx
+  8037eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037ee:	eb 07                	jmp    8037f7 <fd_close+0xd1>
+		else
+			r = 0;
+  8037f0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8037f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037fb:	48 89 c6             	mov    %rax,%rsi
+  8037fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803803:	49 89 df             	mov    %rbx,%r15
+  803806:	48 b8 ae 72 ff ff ff 	movabs $0xffffffffffff72ae,%rax
+  80380d:	ff ff ff 
+  803810:	48 01 d8             	add    %rbx,%rax
+  803813:	ff d0                	call   *%rax
+	return r;
+  803815:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803818:	48 83 c4 30          	add    $0x30,%rsp
+  80381c:	5b                   	pop    %rbx
+  80381d:	41 5f                	pop    %r15
+  80381f:	5d                   	pop    %rbp
+  803820:	c3                   	ret
+
+0000000000803821 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  803821:	55                   	push   %rbp
+  803822:	48 89 e5             	mov    %rsp,%rbp
+  803825:	41 57                	push   %r15
+  803827:	48 83 ec 28          	sub    $0x28,%rsp
+  80382b:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80382b <dev_lookup+0xa>
+  803832:	49 bb 15 78 00 00 00 	movabs $0x7815,%r11
+  803839:	00 00 00 
+  80383c:	4c 01 d9             	add    %r11,%rcx
+  80383f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803842:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803846:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80384d:	eb 45                	jmp    803894 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  80384f:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803856:	00 00 00 
+  803859:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80385c:	48 98                	cltq
+  80385e:	48 01 ca             	add    %rcx,%rdx
+  803861:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803865:	8b 00                	mov    (%rax),%eax
+  803867:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80386a:	75 24                	jne    803890 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  80386c:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803873:	00 00 00 
+  803876:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803879:	48 98                	cltq
+  80387b:	48 01 ca             	add    %rcx,%rdx
+  80387e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803882:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803886:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803889:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388e:	eb 74                	jmp    803904 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803890:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803894:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80389b:	00 00 00 
+  80389e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038a1:	48 98                	cltq
+  8038a3:	48 01 ca             	add    %rcx,%rdx
+  8038a6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8038aa:	48 85 c0             	test   %rax,%rax
+  8038ad:	75 a0                	jne    80384f <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8038af:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8038b6:	ff ff ff 
+  8038b9:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8038bd:	48 8b 00             	mov    (%rax),%rax
+  8038c0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8038c6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8038c9:	89 c6                	mov    %eax,%esi
+  8038cb:	48 b8 50 d7 ff ff ff 	movabs $0xffffffffffffd750,%rax
+  8038d2:	ff ff ff 
+  8038d5:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8038d9:	48 89 c7             	mov    %rax,%rdi
+  8038dc:	49 89 cf             	mov    %rcx,%r15
+  8038df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e4:	49 b8 58 57 ff ff ff 	movabs $0xffffffffffff5758,%r8
+  8038eb:	ff ff ff 
+  8038ee:	49 01 c8             	add    %rcx,%r8
+  8038f1:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8038f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038f8:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8038ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803904:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803908:	c9                   	leave
+  803909:	c3                   	ret
+
+000000000080390a <close>:
+
+int
+close(int fdnum)
+{
+  80390a:	55                   	push   %rbp
+  80390b:	48 89 e5             	mov    %rsp,%rbp
+  80390e:	53                   	push   %rbx
+  80390f:	48 83 ec 28          	sub    $0x28,%rsp
+  803913:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803913 <close+0x9>
+  80391a:	49 bb 2d 77 00 00 00 	movabs $0x772d,%r11
+  803921:	00 00 00 
+  803924:	4c 01 db             	add    %r11,%rbx
+  803927:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80392a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80392e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803931:	48 89 d6             	mov    %rdx,%rsi
+  803934:	89 c7                	mov    %eax,%edi
+  803936:	48 b8 3b 86 ff ff ff 	movabs $0xffffffffffff863b,%rax
+  80393d:	ff ff ff 
+  803940:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803944:	ff d0                	call   *%rax
+  803946:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803949:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80394d:	79 05                	jns    803954 <close+0x4a>
+		return r;
+  80394f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803952:	eb 1c                	jmp    803970 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803954:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803958:	be 01 00 00 00       	mov    $0x1,%esi
+  80395d:	48 89 c7             	mov    %rax,%rdi
+  803960:	48 b8 e6 86 ff ff ff 	movabs $0xffffffffffff86e6,%rax
+  803967:	ff ff ff 
+  80396a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80396e:	ff d0                	call   *%rax
+}
+  803970:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803974:	c9                   	leave
+  803975:	c3                   	ret
+
+0000000000803976 <close_all>:
+
+void
+close_all(void)
+{
+  803976:	55                   	push   %rbp
+  803977:	48 89 e5             	mov    %rsp,%rbp
+  80397a:	53                   	push   %rbx
+  80397b:	48 83 ec 18          	sub    $0x18,%rsp
+  80397f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80397f <close_all+0x9>
+  803986:	49 bb c1 76 00 00 00 	movabs $0x76c1,%r11
+  80398d:	00 00 00 
+  803990:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803993:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80399a:	eb 19                	jmp    8039b5 <close_all+0x3f>
+		close(i);
+  80399c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80399f:	89 c7                	mov    %eax,%edi
+  8039a1:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  8039a8:	ff ff ff 
+  8039ab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039af:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  8039b1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8039b5:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8039b9:	7e e1                	jle    80399c <close_all+0x26>
+}
+  8039bb:	90                   	nop
+  8039bc:	90                   	nop
+  8039bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039c1:	c9                   	leave
+  8039c2:	c3                   	ret
+
+00000000008039c3 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8039c3:	55                   	push   %rbp
+  8039c4:	48 89 e5             	mov    %rsp,%rbp
+  8039c7:	41 57                	push   %r15
+  8039c9:	53                   	push   %rbx
+  8039ca:	48 83 ec 40          	sub    $0x40,%rsp
+  8039ce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039ce <dup+0xb>
+  8039d5:	49 bb 72 76 00 00 00 	movabs $0x7672,%r11
+  8039dc:	00 00 00 
+  8039df:	4c 01 db             	add    %r11,%rbx
+  8039e2:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8039e5:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8039e8:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8039ec:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8039ef:	48 89 d6             	mov    %rdx,%rsi
+  8039f2:	89 c7                	mov    %eax,%edi
+  8039f4:	48 b8 3b 86 ff ff ff 	movabs $0xffffffffffff863b,%rax
+  8039fb:	ff ff ff 
+  8039fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a02:	ff d0                	call   *%rax
+  803a04:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a07:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a0b:	79 08                	jns    803a15 <dup+0x52>
+		return r;
+  803a0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a10:	e9 a4 01 00 00       	jmp    803bb9 <dup+0x1f6>
+	close(newfdnum);
+  803a15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a18:	89 c7                	mov    %eax,%edi
+  803a1a:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  803a21:	ff ff ff 
+  803a24:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a28:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803a2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a2d:	48 98                	cltq
+  803a2f:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803a35:	48 c1 e0 0c          	shl    $0xc,%rax
+  803a39:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803a3d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a41:	48 89 c7             	mov    %rax,%rdi
+  803a44:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  803a4b:	ff ff ff 
+  803a4e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a52:	ff d0                	call   *%rax
+  803a54:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803a58:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a5c:	48 89 c7             	mov    %rax,%rdi
+  803a5f:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  803a66:	ff ff ff 
+  803a69:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a6d:	ff d0                	call   *%rax
+  803a6f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  803a73:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a77:	48 c1 e8 15          	shr    $0x15,%rax
+  803a7b:	48 89 c2             	mov    %rax,%rdx
+  803a7e:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803a85:	ff ff ff 
+  803a88:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a8c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a90:	83 e0 01             	and    $0x1,%eax
+  803a93:	48 85 c0             	test   %rax,%rax
+  803a96:	74 7f                	je     803b17 <dup+0x154>
+  803a98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a9c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803aa0:	48 89 c2             	mov    %rax,%rdx
+  803aa3:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803aaa:	ff ff ff 
+  803aad:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803ab1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803ab5:	83 e0 01             	and    $0x1,%eax
+  803ab8:	48 85 c0             	test   %rax,%rax
+  803abb:	74 5a                	je     803b17 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803abd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ac1:	48 c1 e8 0c          	shr    $0xc,%rax
+  803ac5:	48 89 c2             	mov    %rax,%rdx
+  803ac8:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803acf:	ff ff ff 
+  803ad2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803ad6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803ada:	25 07 0e 00 00       	and    $0xe07,%eax
+  803adf:	89 c1                	mov    %eax,%ecx
+  803ae1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ae5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ae9:	41 89 c8             	mov    %ecx,%r8d
+  803aec:	48 89 d1             	mov    %rdx,%rcx
+  803aef:	ba 00 00 00 00       	mov    $0x0,%edx
+  803af4:	48 89 c6             	mov    %rax,%rsi
+  803af7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803afc:	49 89 df             	mov    %rbx,%r15
+  803aff:	48 b8 3b 72 ff ff ff 	movabs $0xffffffffffff723b,%rax
+  803b06:	ff ff ff 
+  803b09:	48 01 d8             	add    %rbx,%rax
+  803b0c:	ff d0                	call   *%rax
+  803b0e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b11:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b15:	78 5f                	js     803b76 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803b17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b1b:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b1f:	48 89 c2             	mov    %rax,%rdx
+  803b22:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803b29:	ff ff ff 
+  803b2c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b30:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b34:	25 07 0e 00 00       	and    $0xe07,%eax
+  803b39:	89 c1                	mov    %eax,%ecx
+  803b3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b3f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803b43:	41 89 c8             	mov    %ecx,%r8d
+  803b46:	48 89 d1             	mov    %rdx,%rcx
+  803b49:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b4e:	48 89 c6             	mov    %rax,%rsi
+  803b51:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b56:	49 89 df             	mov    %rbx,%r15
+  803b59:	48 b8 3b 72 ff ff ff 	movabs $0xffffffffffff723b,%rax
+  803b60:	ff ff ff 
+  803b63:	48 01 d8             	add    %rbx,%rax
+  803b66:	ff d0                	call   *%rax
+  803b68:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b6b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b6f:	78 08                	js     803b79 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803b71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b74:	eb 43                	jmp    803bb9 <dup+0x1f6>
+			goto err;
+  803b76:	90                   	nop
+  803b77:	eb 01                	jmp    803b7a <dup+0x1b7>
+		goto err;
+  803b79:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803b7a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b7e:	48 89 c6             	mov    %rax,%rsi
+  803b81:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b86:	49 89 df             	mov    %rbx,%r15
+  803b89:	48 b8 ae 72 ff ff ff 	movabs $0xffffffffffff72ae,%rax
+  803b90:	ff ff ff 
+  803b93:	48 01 d8             	add    %rbx,%rax
+  803b96:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803b98:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b9c:	48 89 c6             	mov    %rax,%rsi
+  803b9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ba4:	49 89 df             	mov    %rbx,%r15
+  803ba7:	48 b8 ae 72 ff ff ff 	movabs $0xffffffffffff72ae,%rax
+  803bae:	ff ff ff 
+  803bb1:	48 01 d8             	add    %rbx,%rax
+  803bb4:	ff d0                	call   *%rax
+	return r;
+  803bb6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803bb9:	48 83 c4 40          	add    $0x40,%rsp
+  803bbd:	5b                   	pop    %rbx
+  803bbe:	41 5f                	pop    %r15
+  803bc0:	5d                   	pop    %rbp
+  803bc1:	c3                   	ret
+
+0000000000803bc2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803bc2:	55                   	push   %rbp
+  803bc3:	48 89 e5             	mov    %rsp,%rbp
+  803bc6:	41 57                	push   %r15
+  803bc8:	53                   	push   %rbx
+  803bc9:	48 83 ec 40          	sub    $0x40,%rsp
+  803bcd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803bcd <read+0xb>
+  803bd4:	49 bb 73 74 00 00 00 	movabs $0x7473,%r11
+  803bdb:	00 00 00 
+  803bde:	4c 01 db             	add    %r11,%rbx
+  803be1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803be4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803be8:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803bec:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803bf0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803bf3:	48 89 d6             	mov    %rdx,%rsi
+  803bf6:	89 c7                	mov    %eax,%edi
+  803bf8:	48 b8 3b 86 ff ff ff 	movabs $0xffffffffffff863b,%rax
+  803bff:	ff ff ff 
+  803c02:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c06:	ff d0                	call   *%rax
+  803c08:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c0b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c0f:	78 28                	js     803c39 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c11:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c15:	8b 00                	mov    (%rax),%eax
+  803c17:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803c1b:	48 89 d6             	mov    %rdx,%rsi
+  803c1e:	89 c7                	mov    %eax,%edi
+  803c20:	48 b8 e1 87 ff ff ff 	movabs $0xffffffffffff87e1,%rax
+  803c27:	ff ff ff 
+  803c2a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c2e:	ff d0                	call   *%rax
+  803c30:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c33:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c37:	79 08                	jns    803c41 <read+0x7f>
+		return r;
+  803c39:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c3c:	e9 8b 00 00 00       	jmp    803ccc <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803c41:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c45:	8b 40 08             	mov    0x8(%rax),%eax
+  803c48:	83 e0 03             	and    $0x3,%eax
+  803c4b:	83 f8 01             	cmp    $0x1,%eax
+  803c4e:	75 4b                	jne    803c9b <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803c50:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803c57:	ff ff ff 
+  803c5a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c5e:	48 8b 00             	mov    (%rax),%rax
+  803c61:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803c67:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803c6a:	89 c6                	mov    %eax,%esi
+  803c6c:	48 b8 6f d7 ff ff ff 	movabs $0xffffffffffffd76f,%rax
+  803c73:	ff ff ff 
+  803c76:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c7a:	48 89 c7             	mov    %rax,%rdi
+  803c7d:	49 89 df             	mov    %rbx,%r15
+  803c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c85:	48 b9 58 57 ff ff ff 	movabs $0xffffffffffff5758,%rcx
+  803c8c:	ff ff ff 
+  803c8f:	48 01 d9             	add    %rbx,%rcx
+  803c92:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803c94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c99:	eb 31                	jmp    803ccc <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803c9b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c9f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803ca3:	48 85 c0             	test   %rax,%rax
+  803ca6:	75 07                	jne    803caf <read+0xed>
+		return -E_NOT_SUPP;
+  803ca8:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803cad:	eb 1d                	jmp    803ccc <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803caf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cb3:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803cb7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803cbb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803cbf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803cc3:	48 89 ce             	mov    %rcx,%rsi
+  803cc6:	48 89 c7             	mov    %rax,%rdi
+  803cc9:	41 ff d0             	call   *%r8
+}
+  803ccc:	48 83 c4 40          	add    $0x40,%rsp
+  803cd0:	5b                   	pop    %rbx
+  803cd1:	41 5f                	pop    %r15
+  803cd3:	5d                   	pop    %rbp
+  803cd4:	c3                   	ret
+
+0000000000803cd5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803cd5:	55                   	push   %rbp
+  803cd6:	48 89 e5             	mov    %rsp,%rbp
+  803cd9:	53                   	push   %rbx
+  803cda:	48 83 ec 38          	sub    $0x38,%rsp
+  803cde:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cde <readn+0x9>
+  803ce5:	49 bb 62 73 00 00 00 	movabs $0x7362,%r11
+  803cec:	00 00 00 
+  803cef:	4c 01 db             	add    %r11,%rbx
+  803cf2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803cf5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803cf9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803cfd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803d04:	eb 4b                	jmp    803d51 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803d06:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d09:	48 98                	cltq
+  803d0b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803d0f:	48 29 c2             	sub    %rax,%rdx
+  803d12:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d15:	48 63 c8             	movslq %eax,%rcx
+  803d18:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d1c:	48 01 c1             	add    %rax,%rcx
+  803d1f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d22:	48 89 ce             	mov    %rcx,%rsi
+  803d25:	89 c7                	mov    %eax,%edi
+  803d27:	48 b8 82 8b ff ff ff 	movabs $0xffffffffffff8b82,%rax
+  803d2e:	ff ff ff 
+  803d31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d35:	ff d0                	call   *%rax
+  803d37:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803d3a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803d3e:	79 05                	jns    803d45 <readn+0x70>
+			return m;
+  803d40:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d43:	eb 1d                	jmp    803d62 <readn+0x8d>
+		if (m == 0)
+  803d45:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803d49:	74 13                	je     803d5e <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803d4b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d4e:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803d51:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d54:	48 98                	cltq
+  803d56:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803d5a:	72 aa                	jb     803d06 <readn+0x31>
+  803d5c:	eb 01                	jmp    803d5f <readn+0x8a>
+			break;
+  803d5e:	90                   	nop
+	}
+	return tot;
+  803d5f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803d62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803d66:	c9                   	leave
+  803d67:	c3                   	ret
+
+0000000000803d68 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803d68:	55                   	push   %rbp
+  803d69:	48 89 e5             	mov    %rsp,%rbp
+  803d6c:	41 57                	push   %r15
+  803d6e:	53                   	push   %rbx
+  803d6f:	48 83 ec 40          	sub    $0x40,%rsp
+  803d73:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d73 <write+0xb>
+  803d7a:	49 bb cd 72 00 00 00 	movabs $0x72cd,%r11
+  803d81:	00 00 00 
+  803d84:	4c 01 db             	add    %r11,%rbx
+  803d87:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803d8a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803d8e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803d92:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803d96:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803d99:	48 89 d6             	mov    %rdx,%rsi
+  803d9c:	89 c7                	mov    %eax,%edi
+  803d9e:	48 b8 3b 86 ff ff ff 	movabs $0xffffffffffff863b,%rax
+  803da5:	ff ff ff 
+  803da8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dac:	ff d0                	call   *%rax
+  803dae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803db1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803db5:	78 28                	js     803ddf <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803db7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dbb:	8b 00                	mov    (%rax),%eax
+  803dbd:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803dc1:	48 89 d6             	mov    %rdx,%rsi
+  803dc4:	89 c7                	mov    %eax,%edi
+  803dc6:	48 b8 e1 87 ff ff ff 	movabs $0xffffffffffff87e1,%rax
+  803dcd:	ff ff ff 
+  803dd0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dd4:	ff d0                	call   *%rax
+  803dd6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803dd9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ddd:	79 08                	jns    803de7 <write+0x7f>
+		return r;
+  803ddf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803de2:	e9 8a 00 00 00       	jmp    803e71 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803de7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803deb:	8b 40 08             	mov    0x8(%rax),%eax
+  803dee:	83 e0 03             	and    $0x3,%eax
+  803df1:	85 c0                	test   %eax,%eax
+  803df3:	75 4b                	jne    803e40 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803df5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803dfc:	ff ff ff 
+  803dff:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803e03:	48 8b 00             	mov    (%rax),%rax
+  803e06:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803e0c:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803e0f:	89 c6                	mov    %eax,%esi
+  803e11:	48 b8 8b d7 ff ff ff 	movabs $0xffffffffffffd78b,%rax
+  803e18:	ff ff ff 
+  803e1b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e1f:	48 89 c7             	mov    %rax,%rdi
+  803e22:	49 89 df             	mov    %rbx,%r15
+  803e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e2a:	48 b9 58 57 ff ff ff 	movabs $0xffffffffffff5758,%rcx
+  803e31:	ff ff ff 
+  803e34:	48 01 d9             	add    %rbx,%rcx
+  803e37:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803e39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e3e:	eb 31                	jmp    803e71 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803e40:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e44:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803e48:	48 85 c0             	test   %rax,%rax
+  803e4b:	75 07                	jne    803e54 <write+0xec>
+		return -E_NOT_SUPP;
+  803e4d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803e52:	eb 1d                	jmp    803e71 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803e54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e58:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803e5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e60:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e64:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e68:	48 89 ce             	mov    %rcx,%rsi
+  803e6b:	48 89 c7             	mov    %rax,%rdi
+  803e6e:	41 ff d0             	call   *%r8
+}
+  803e71:	48 83 c4 40          	add    $0x40,%rsp
+  803e75:	5b                   	pop    %rbx
+  803e76:	41 5f                	pop    %r15
+  803e78:	5d                   	pop    %rbp
+  803e79:	c3                   	ret
+
+0000000000803e7a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803e7a:	55                   	push   %rbp
+  803e7b:	48 89 e5             	mov    %rsp,%rbp
+  803e7e:	48 83 ec 18          	sub    $0x18,%rsp
+  803e82:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e82 <seek+0x8>
+  803e89:	49 bb be 71 00 00 00 	movabs $0x71be,%r11
+  803e90:	00 00 00 
+  803e93:	4c 01 d8             	add    %r11,%rax
+  803e96:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e99:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e9c:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803ea0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803ea3:	48 89 ce             	mov    %rcx,%rsi
+  803ea6:	89 d7                	mov    %edx,%edi
+  803ea8:	48 ba 3b 86 ff ff ff 	movabs $0xffffffffffff863b,%rdx
+  803eaf:	ff ff ff 
+  803eb2:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803eb6:	ff d0                	call   *%rax
+  803eb8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ebb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ebf:	79 05                	jns    803ec6 <seek+0x4c>
+		return r;
+  803ec1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ec4:	eb 0f                	jmp    803ed5 <seek+0x5b>
+	fd->fd_offset = offset;
+  803ec6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803eca:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803ecd:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed5:	c9                   	leave
+  803ed6:	c3                   	ret
+
+0000000000803ed7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803ed7:	55                   	push   %rbp
+  803ed8:	48 89 e5             	mov    %rsp,%rbp
+  803edb:	41 57                	push   %r15
+  803edd:	53                   	push   %rbx
+  803ede:	48 83 ec 30          	sub    $0x30,%rsp
+  803ee2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ee2 <ftruncate+0xb>
+  803ee9:	49 bb 5e 71 00 00 00 	movabs $0x715e,%r11
+  803ef0:	00 00 00 
+  803ef3:	4c 01 db             	add    %r11,%rbx
+  803ef6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803ef9:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803efc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803f00:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803f03:	48 89 d6             	mov    %rdx,%rsi
+  803f06:	89 c7                	mov    %eax,%edi
+  803f08:	48 b8 3b 86 ff ff ff 	movabs $0xffffffffffff863b,%rax
+  803f0f:	ff ff ff 
+  803f12:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f16:	ff d0                	call   *%rax
+  803f18:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f1b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f1f:	78 28                	js     803f49 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803f21:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f25:	8b 00                	mov    (%rax),%eax
+  803f27:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803f2b:	48 89 d6             	mov    %rdx,%rsi
+  803f2e:	89 c7                	mov    %eax,%edi
+  803f30:	48 b8 e1 87 ff ff ff 	movabs $0xffffffffffff87e1,%rax
+  803f37:	ff ff ff 
+  803f3a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f3e:	ff d0                	call   *%rax
+  803f40:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f43:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f47:	79 08                	jns    803f51 <ftruncate+0x7a>
+		return r;
+  803f49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f4c:	e9 83 00 00 00       	jmp    803fd4 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803f51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f55:	8b 40 08             	mov    0x8(%rax),%eax
+  803f58:	83 e0 03             	and    $0x3,%eax
+  803f5b:	85 c0                	test   %eax,%eax
+  803f5d:	75 4b                	jne    803faa <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803f5f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803f66:	ff ff ff 
+  803f69:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803f6d:	48 8b 00             	mov    (%rax),%rax
+  803f70:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803f76:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803f79:	89 c6                	mov    %eax,%esi
+  803f7b:	48 b8 a8 d7 ff ff ff 	movabs $0xffffffffffffd7a8,%rax
+  803f82:	ff ff ff 
+  803f85:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f89:	48 89 c7             	mov    %rax,%rdi
+  803f8c:	49 89 df             	mov    %rbx,%r15
+  803f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f94:	48 b9 58 57 ff ff ff 	movabs $0xffffffffffff5758,%rcx
+  803f9b:	ff ff ff 
+  803f9e:	48 01 d9             	add    %rbx,%rcx
+  803fa1:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803fa3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fa8:	eb 2a                	jmp    803fd4 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803faa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fae:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803fb2:	48 85 c0             	test   %rax,%rax
+  803fb5:	75 07                	jne    803fbe <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803fb7:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803fbc:	eb 16                	jmp    803fd4 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803fbe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fc2:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803fc6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fca:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803fcd:	89 d6                	mov    %edx,%esi
+  803fcf:	48 89 c7             	mov    %rax,%rdi
+  803fd2:	ff d1                	call   *%rcx
+}
+  803fd4:	48 83 c4 30          	add    $0x30,%rsp
+  803fd8:	5b                   	pop    %rbx
+  803fd9:	41 5f                	pop    %r15
+  803fdb:	5d                   	pop    %rbp
+  803fdc:	c3                   	ret
+
+0000000000803fdd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803fdd:	55                   	push   %rbp
+  803fde:	48 89 e5             	mov    %rsp,%rbp
+  803fe1:	53                   	push   %rbx
+  803fe2:	48 83 ec 38          	sub    $0x38,%rsp
+  803fe6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803fe6 <fstat+0x9>
+  803fed:	49 bb 5a 70 00 00 00 	movabs $0x705a,%r11
+  803ff4:	00 00 00 
+  803ff7:	4c 01 db             	add    %r11,%rbx
+  803ffa:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803ffd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804001:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804005:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804008:	48 89 d6             	mov    %rdx,%rsi
+  80400b:	89 c7                	mov    %eax,%edi
+  80400d:	48 b8 3b 86 ff ff ff 	movabs $0xffffffffffff863b,%rax
+  804014:	ff ff ff 
+  804017:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80401b:	ff d0                	call   *%rax
+  80401d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804020:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804024:	78 28                	js     80404e <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804026:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80402a:	8b 00                	mov    (%rax),%eax
+  80402c:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804030:	48 89 d6             	mov    %rdx,%rsi
+  804033:	89 c7                	mov    %eax,%edi
+  804035:	48 b8 e1 87 ff ff ff 	movabs $0xffffffffffff87e1,%rax
+  80403c:	ff ff ff 
+  80403f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804043:	ff d0                	call   *%rax
+  804045:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804048:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80404c:	79 05                	jns    804053 <fstat+0x76>
+		return r;
+  80404e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804051:	eb 5e                	jmp    8040b1 <fstat+0xd4>
+	if (!dev->dev_stat)
+  804053:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804057:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80405b:	48 85 c0             	test   %rax,%rax
+  80405e:	75 07                	jne    804067 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  804060:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804065:	eb 4a                	jmp    8040b1 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  804067:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80406b:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  80406e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804072:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804079:	00 00 00 
+	stat->st_isdir = 0;
+  80407c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804080:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804087:	00 00 00 
+	stat->st_dev = dev;
+  80408a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80408e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804092:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  804099:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80409d:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8040a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8040a9:	48 89 d6             	mov    %rdx,%rsi
+  8040ac:	48 89 c7             	mov    %rax,%rdi
+  8040af:	ff d1                	call   *%rcx
+}
+  8040b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040b5:	c9                   	leave
+  8040b6:	c3                   	ret
+
+00000000008040b7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8040b7:	55                   	push   %rbp
+  8040b8:	48 89 e5             	mov    %rsp,%rbp
+  8040bb:	41 57                	push   %r15
+  8040bd:	53                   	push   %rbx
+  8040be:	48 83 ec 20          	sub    $0x20,%rsp
+  8040c2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8040c2 <stat+0xb>
+  8040c9:	49 bb 7e 6f 00 00 00 	movabs $0x6f7e,%r11
+  8040d0:	00 00 00 
+  8040d3:	4c 01 db             	add    %r11,%rbx
+  8040d6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8040da:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8040de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8040e7:	48 89 c7             	mov    %rax,%rdi
+  8040ea:	49 89 df             	mov    %rbx,%r15
+  8040ed:	48 b8 51 93 ff ff ff 	movabs $0xffffffffffff9351,%rax
+  8040f4:	ff ff ff 
+  8040f7:	48 01 d8             	add    %rbx,%rax
+  8040fa:	ff d0                	call   *%rax
+  8040fc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040ff:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804103:	79 05                	jns    80410a <stat+0x53>
+		return fd;
+  804105:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804108:	eb 37                	jmp    804141 <stat+0x8a>
+	r = fstat(fd, stat);
+  80410a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80410e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804111:	48 89 d6             	mov    %rdx,%rsi
+  804114:	89 c7                	mov    %eax,%edi
+  804116:	48 b8 9d 8f ff ff ff 	movabs $0xffffffffffff8f9d,%rax
+  80411d:	ff ff ff 
+  804120:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804124:	ff d0                	call   *%rax
+  804126:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  804129:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80412c:	89 c7                	mov    %eax,%edi
+  80412e:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  804135:	ff ff ff 
+  804138:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80413c:	ff d0                	call   *%rax
+	return r;
+  80413e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  804141:	48 83 c4 20          	add    $0x20,%rsp
+  804145:	5b                   	pop    %rbx
+  804146:	41 5f                	pop    %r15
+  804148:	5d                   	pop    %rbp
+  804149:	c3                   	ret
+
+000000000080414a <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80414a:	55                   	push   %rbp
+  80414b:	48 89 e5             	mov    %rsp,%rbp
+  80414e:	41 57                	push   %r15
+  804150:	53                   	push   %rbx
+  804151:	48 83 ec 10          	sub    $0x10,%rsp
+  804155:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804155 <fsipc+0xb>
+  80415c:	49 bb eb 6e 00 00 00 	movabs $0x6eeb,%r11
+  804163:	00 00 00 
+  804166:	4c 01 db             	add    %r11,%rbx
+  804169:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80416c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  804170:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804177:	00 00 00 
+  80417a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80417d:	85 c0                	test   %eax,%eax
+  80417f:	75 24                	jne    8041a5 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804181:	bf 01 00 00 00       	mov    $0x1,%edi
+  804186:	49 89 df             	mov    %rbx,%r15
+  804189:	48 b8 de cf ff ff ff 	movabs $0xffffffffffffcfde,%rax
+  804190:	ff ff ff 
+  804193:	48 01 d8             	add    %rbx,%rax
+  804196:	ff d0                	call   *%rax
+  804198:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  80419f:	00 00 00 
+  8041a2:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8041a5:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8041ac:	00 00 00 
+  8041af:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8041b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041b6:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8041b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8041bf:	49 89 d0             	mov    %rdx,%r8
+  8041c2:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8041c7:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8041ce:	00 00 00 
+  8041d1:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8041d5:	89 c7                	mov    %eax,%edi
+  8041d7:	49 89 df             	mov    %rbx,%r15
+  8041da:	48 b8 fd c9 ff ff ff 	movabs $0xffffffffffffc9fd,%rax
+  8041e1:	ff ff ff 
+  8041e4:	48 01 d8             	add    %rbx,%rax
+  8041e7:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8041e9:	48 83 c4 10          	add    $0x10,%rsp
+  8041ed:	5b                   	pop    %rbx
+  8041ee:	41 5f                	pop    %r15
+  8041f0:	5d                   	pop    %rbp
+  8041f1:	c3                   	ret
+
+00000000008041f2 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8041f2:	55                   	push   %rbp
+  8041f3:	48 89 e5             	mov    %rsp,%rbp
+  8041f6:	41 57                	push   %r15
+  8041f8:	53                   	push   %rbx
+  8041f9:	48 83 ec 20          	sub    $0x20,%rsp
+  8041fd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041fd <fsipc_words+0xb>
+  804204:	49 bb 43 6e 00 00 00 	movabs $0x6e43,%r11
+  80420b:	00 00 00 
+  80420e:	4c 01 db             	add    %r11,%rbx
+  804211:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804214:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804218:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  80421c:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804223:	00 00 00 
+  804226:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804229:	85 c0                	test   %eax,%eax
+  80422b:	75 24                	jne    804251 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80422d:	bf 01 00 00 00       	mov    $0x1,%edi
+  804232:	49 89 df             	mov    %rbx,%r15
+  804235:	48 b8 de cf ff ff ff 	movabs $0xffffffffffffcfde,%rax
+  80423c:	ff ff ff 
+  80423f:	48 01 d8             	add    %rbx,%rax
+  804242:	ff d0                	call   *%rax
+  804244:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  80424b:	00 00 00 
+  80424e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  804251:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804258:	00 00 00 
+  80425b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80425e:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804262:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804266:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804269:	89 c7                	mov    %eax,%edi
+  80426b:	49 89 df             	mov    %rbx,%r15
+  80426e:	48 b8 e8 ca ff ff ff 	movabs $0xffffffffffffcae8,%rax
+  804275:	ff ff ff 
+  804278:	48 01 d8             	add    %rbx,%rax
+  80427b:	ff d0                	call   *%rax
+}
+  80427d:	48 83 c4 20          	add    $0x20,%rsp
+  804281:	5b                   	pop    %rbx
+  804282:	41 5f                	pop    %r15
+  804284:	5d                   	pop    %rbp
+  804285:	c3                   	ret
+
+0000000000804286 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804286:	55                   	push   %rbp
+  804287:	48 89 e5             	mov    %rsp,%rbp
+  80428a:	41 57                	push   %r15
+  80428c:	53                   	push   %rbx
+  80428d:	48 83 ec 40          	sub    $0x40,%rsp
+  804291:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804291 <fsipc_pages+0xb>
+  804298:	49 bb af 6d 00 00 00 	movabs $0x6daf,%r11
+  80429f:	00 00 00 
+  8042a2:	4c 01 db             	add    %r11,%rbx
+  8042a5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8042a8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8042ac:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8042b0:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8042b3:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8042ba:	00 00 00 
+  8042bd:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8042c0:	85 c0                	test   %eax,%eax
+  8042c2:	75 24                	jne    8042e8 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8042c4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8042c9:	49 89 df             	mov    %rbx,%r15
+  8042cc:	48 b8 de cf ff ff ff 	movabs $0xffffffffffffcfde,%rax
+  8042d3:	ff ff ff 
+  8042d6:	48 01 d8             	add    %rbx,%rax
+  8042d9:	ff d0                	call   *%rax
+  8042db:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8042e2:	00 00 00 
+  8042e5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8042e8:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8042ed:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8042f1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8042f4:	48 98                	cltq
+  8042f6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8042fa:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8042fe:	0f 95 c0             	setne  %al
+  804301:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804304:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80430b:	00 
+  80430c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804310:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804314:	48 01 d0             	add    %rdx,%rax
+  804317:	48 83 e8 01          	sub    $0x1,%rax
+  80431b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80431f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804323:	ba 00 00 00 00       	mov    $0x0,%edx
+  804328:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80432c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804330:	48 29 d0             	sub    %rdx,%rax
+  804333:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804337:	41 89 c2             	mov    %eax,%r10d
+  80433a:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804341:	00 00 00 
+  804344:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804347:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80434b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80434f:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804352:	48 83 ec 08          	sub    $0x8,%rsp
+  804356:	6a 40                	push   $0x40
+  804358:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  80435d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804364:	00 
+  804365:	6a 05                	push   $0x5
+  804367:	41 89 f9             	mov    %edi,%r9d
+  80436a:	49 89 c8             	mov    %rcx,%r8
+  80436d:	44 89 d1             	mov    %r10d,%ecx
+  804370:	89 c7                	mov    %eax,%edi
+  804372:	49 89 df             	mov    %rbx,%r15
+  804375:	48 b8 e6 cb ff ff ff 	movabs $0xffffffffffffcbe6,%rax
+  80437c:	ff ff ff 
+  80437f:	48 01 d8             	add    %rbx,%rax
+  804382:	ff d0                	call   *%rax
+  804384:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804388:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80438c:	5b                   	pop    %rbx
+  80438d:	41 5f                	pop    %r15
+  80438f:	5d                   	pop    %rbp
+  804390:	c3                   	ret
+
+0000000000804391 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804391:	55                   	push   %rbp
+  804392:	48 89 e5             	mov    %rsp,%rbp
+  804395:	41 57                	push   %r15
+  804397:	53                   	push   %rbx
+  804398:	48 83 ec 20          	sub    $0x20,%rsp
+  80439c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80439c <open+0xb>
+  8043a3:	49 bb a4 6c 00 00 00 	movabs $0x6ca4,%r11
+  8043aa:	00 00 00 
+  8043ad:	4c 01 db             	add    %r11,%rbx
+  8043b0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8043b4:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8043b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043bb:	48 89 c7             	mov    %rax,%rdi
+  8043be:	49 89 df             	mov    %rbx,%r15
+  8043c1:	48 b8 86 64 ff ff ff 	movabs $0xffffffffffff6486,%rax
+  8043c8:	ff ff ff 
+  8043cb:	48 01 d8             	add    %rbx,%rax
+  8043ce:	ff d0                	call   *%rax
+  8043d0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8043d5:	7e 0a                	jle    8043e1 <open+0x50>
+		return -E_BAD_PATH;
+  8043d7:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8043dc:	e9 18 01 00 00       	jmp    8044f9 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8043e1:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8043e5:	48 89 c7             	mov    %rax,%rdi
+  8043e8:	49 89 df             	mov    %rbx,%r15
+  8043eb:	48 b8 85 85 ff ff ff 	movabs $0xffffffffffff8585,%rax
+  8043f2:	ff ff ff 
+  8043f5:	48 01 d8             	add    %rbx,%rax
+  8043f8:	ff d0                	call   *%rax
+  8043fa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804401:	74 08                	je     80440b <open+0x7a>
+		return r;
+  804403:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804406:	e9 ee 00 00 00       	jmp    8044f9 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80440b:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804412:	00 00 00 
+  804415:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804418:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  80441f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804423:	48 89 c6             	mov    %rax,%rsi
+  804426:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  80442d:	00 00 00 
+  804430:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804434:	48 89 c7             	mov    %rax,%rdi
+  804437:	49 89 df             	mov    %rbx,%r15
+  80443a:	48 b8 1a 65 ff ff ff 	movabs $0xffffffffffff651a,%rax
+  804441:	ff ff ff 
+  804444:	48 01 d8             	add    %rbx,%rax
+  804447:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804449:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80444d:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804452:	48 89 c6             	mov    %rax,%rsi
+  804455:	bf 00 00 00 00       	mov    $0x0,%edi
+  80445a:	49 89 df             	mov    %rbx,%r15
+  80445d:	48 b8 d6 71 ff ff ff 	movabs $0xffffffffffff71d6,%rax
+  804464:	ff ff ff 
+  804467:	48 01 d8             	add    %rbx,%rax
+  80446a:	ff d0                	call   *%rax
+  80446c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80446f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804473:	74 23                	je     804498 <open+0x107>
+		fd_close(fd,0);
+  804475:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804479:	be 00 00 00 00       	mov    $0x0,%esi
+  80447e:	48 89 c7             	mov    %rax,%rdi
+  804481:	49 89 df             	mov    %rbx,%r15
+  804484:	48 b8 e6 86 ff ff ff 	movabs $0xffffffffffff86e6,%rax
+  80448b:	ff ff ff 
+  80448e:	48 01 d8             	add    %rbx,%rax
+  804491:	ff d0                	call   *%rax
+		return r;
+  804493:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804496:	eb 61                	jmp    8044f9 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804498:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80449c:	48 89 c6             	mov    %rax,%rsi
+  80449f:	bf 01 00 00 00       	mov    $0x1,%edi
+  8044a4:	48 b8 0a 91 ff ff ff 	movabs $0xffffffffffff910a,%rax
+  8044ab:	ff ff ff 
+  8044ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044b2:	ff d0                	call   *%rax
+  8044b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044bb:	74 23                	je     8044e0 <open+0x14f>
+		fd_close(fd,0);
+  8044bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8044c6:	48 89 c7             	mov    %rax,%rdi
+  8044c9:	49 89 df             	mov    %rbx,%r15
+  8044cc:	48 b8 e6 86 ff ff ff 	movabs $0xffffffffffff86e6,%rax
+  8044d3:	ff ff ff 
+  8044d6:	48 01 d8             	add    %rbx,%rax
+  8044d9:	ff d0                	call   *%rax
+		return r;
+  8044db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044de:	eb 19                	jmp    8044f9 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8044e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044e4:	48 89 c7             	mov    %rax,%rdi
+  8044e7:	49 89 df             	mov    %rbx,%r15
+  8044ea:	48 b8 0b 85 ff ff ff 	movabs $0xffffffffffff850b,%rax
+  8044f1:	ff ff ff 
+  8044f4:	48 01 d8             	add    %rbx,%rax
+  8044f7:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8044f9:	48 83 c4 20          	add    $0x20,%rsp
+  8044fd:	5b                   	pop    %rbx
+  8044fe:	41 5f                	pop    %r15
+  804500:	5d                   	pop    %rbp
+  804501:	c3                   	ret
+
+0000000000804502 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804502:	55                   	push   %rbp
+  804503:	48 89 e5             	mov    %rsp,%rbp
+  804506:	48 83 ec 20          	sub    $0x20,%rsp
+  80450a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80450a <devfile_flush+0x8>
+  804511:	49 bb 36 6b 00 00 00 	movabs $0x6b36,%r11
+  804518:	00 00 00 
+  80451b:	4c 01 d8             	add    %r11,%rax
+  80451e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804522:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804526:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804529:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  80452c:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804530:	ba 04 00 00 00       	mov    $0x4,%edx
+  804535:	48 89 ce             	mov    %rcx,%rsi
+  804538:	bf 06 00 00 00       	mov    $0x6,%edi
+  80453d:	48 b9 b2 91 ff ff ff 	movabs $0xffffffffffff91b2,%rcx
+  804544:	ff ff ff 
+  804547:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80454b:	ff d0                	call   *%rax
+}
+  80454d:	c9                   	leave
+  80454e:	c3                   	ret
+
+000000000080454f <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  80454f:	55                   	push   %rbp
+  804550:	48 89 e5             	mov    %rsp,%rbp
+  804553:	41 57                	push   %r15
+  804555:	53                   	push   %rbx
+  804556:	48 83 ec 60          	sub    $0x60,%rsp
+  80455a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80455a <devfile_read+0xb>
+  804561:	49 bb e6 6a 00 00 00 	movabs $0x6ae6,%r11
+  804568:	00 00 00 
+  80456b:	4c 01 db             	add    %r11,%rbx
+  80456e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804572:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804576:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80457a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80457e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804582:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804586:	8b 50 0c             	mov    0xc(%rax),%edx
+  804589:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80458d:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80458f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804593:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804597:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  80459b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80459f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8045a4:	ba 10 00 00 00       	mov    $0x10,%edx
+  8045a9:	48 89 c6             	mov    %rax,%rsi
+  8045ac:	bf 03 00 00 00       	mov    $0x3,%edi
+  8045b1:	48 b8 46 92 ff ff ff 	movabs $0xffffffffffff9246,%rax
+  8045b8:	ff ff ff 
+  8045bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045bf:	ff d0                	call   *%rax
+  8045c1:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8045c4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8045c8:	79 05                	jns    8045cf <devfile_read+0x80>
+		return r;
+  8045ca:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8045cd:	eb 64                	jmp    804633 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8045cf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8045d2:	48 63 d0             	movslq %eax,%rdx
+  8045d5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8045d9:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8045de:	48 01 c1             	add    %rax,%rcx
+  8045e1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8045e5:	48 89 ce             	mov    %rcx,%rsi
+  8045e8:	48 89 c7             	mov    %rax,%rdi
+  8045eb:	49 89 df             	mov    %rbx,%r15
+  8045ee:	48 b8 fa 68 ff ff ff 	movabs $0xffffffffffff68fa,%rax
+  8045f5:	ff ff ff 
+  8045f8:	48 01 d8             	add    %rbx,%rax
+  8045fb:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8045fd:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804604:	ff ff ff 
+  804607:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80460b:	48 8b 00             	mov    (%rax),%rax
+  80460e:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804614:	89 c6                	mov    %eax,%esi
+  804616:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  80461b:	48 89 c7             	mov    %rax,%rdi
+  80461e:	49 89 df             	mov    %rbx,%r15
+  804621:	48 b8 98 cf ff ff ff 	movabs $0xffffffffffffcf98,%rax
+  804628:	ff ff ff 
+  80462b:	48 01 d8             	add    %rbx,%rax
+  80462e:	ff d0                	call   *%rax
+	return r;
+  804630:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804633:	48 83 c4 60          	add    $0x60,%rsp
+  804637:	5b                   	pop    %rbx
+  804638:	41 5f                	pop    %r15
+  80463a:	5d                   	pop    %rbp
+  80463b:	c3                   	ret
+
+000000000080463c <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80463c:	55                   	push   %rbp
+  80463d:	48 89 e5             	mov    %rsp,%rbp
+  804640:	41 57                	push   %r15
+  804642:	53                   	push   %rbx
+  804643:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804647:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804647 <devfile_write+0xb>
+  80464e:	49 bb f9 69 00 00 00 	movabs $0x69f9,%r11
+  804655:	00 00 00 
+  804658:	4c 01 db             	add    %r11,%rbx
+  80465b:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  80465f:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804663:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  80466a:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80466e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804672:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804679:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80467d:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804684:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804687:	48 63 d0             	movslq %eax,%rdx
+  80468a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80468e:	48 39 c2             	cmp    %rax,%rdx
+  804691:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804695:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80469c:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  8046a3:	00 
+  8046a4:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8046ab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8046af:	48 01 d0             	add    %rdx,%rax
+  8046b2:	48 83 e8 01          	sub    $0x1,%rax
+  8046b6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8046ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046c3:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8046c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046cb:	48 29 d0             	sub    %rdx,%rax
+  8046ce:	48 c1 e8 0c          	shr    $0xc,%rax
+  8046d2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8046d5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8046d8:	89 c6                	mov    %eax,%esi
+  8046da:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8046df:	48 89 c7             	mov    %rax,%rdi
+  8046e2:	49 89 df             	mov    %rbx,%r15
+  8046e5:	48 b8 52 cf ff ff ff 	movabs $0xffffffffffffcf52,%rax
+  8046ec:	ff ff ff 
+  8046ef:	48 01 d8             	add    %rbx,%rax
+  8046f2:	ff d0                	call   *%rax
+  8046f4:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8046f7:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8046fb:	79 08                	jns    804705 <devfile_write+0xc9>
+		return r;
+  8046fd:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804700:	e9 8f 00 00 00       	jmp    804794 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804705:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80470c:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804710:	48 89 c6             	mov    %rax,%rsi
+  804713:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804718:	48 89 c7             	mov    %rax,%rdi
+  80471b:	49 89 df             	mov    %rbx,%r15
+  80471e:	48 b8 fa 68 ff ff ff 	movabs $0xffffffffffff68fa,%rax
+  804725:	ff ff ff 
+  804728:	48 01 d8             	add    %rbx,%rax
+  80472b:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  80472d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804731:	8b 50 0c             	mov    0xc(%rax),%edx
+  804734:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804738:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80473a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80473e:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804745:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804749:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80474c:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804750:	89 d1                	mov    %edx,%ecx
+  804752:	ba 10 00 00 00       	mov    $0x10,%edx
+  804757:	48 89 c6             	mov    %rax,%rsi
+  80475a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80475f:	48 b8 46 92 ff ff ff 	movabs $0xffffffffffff9246,%rax
+  804766:	ff ff ff 
+  804769:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80476d:	ff d0                	call   *%rax
+  80476f:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804772:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804775:	89 c6                	mov    %eax,%esi
+  804777:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80477c:	48 89 c7             	mov    %rax,%rdi
+  80477f:	49 89 df             	mov    %rbx,%r15
+  804782:	48 b8 98 cf ff ff ff 	movabs $0xffffffffffffcf98,%rax
+  804789:	ff ff ff 
+  80478c:	48 01 d8             	add    %rbx,%rax
+  80478f:	ff d0                	call   *%rax
+	return r;
+  804791:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804794:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804798:	5b                   	pop    %rbx
+  804799:	41 5f                	pop    %r15
+  80479b:	5d                   	pop    %rbp
+  80479c:	c3                   	ret
+
+000000000080479d <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  80479d:	55                   	push   %rbp
+  80479e:	48 89 e5             	mov    %rsp,%rbp
+  8047a1:	41 57                	push   %r15
+  8047a3:	53                   	push   %rbx
+  8047a4:	48 83 ec 20          	sub    $0x20,%rsp
+  8047a8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047a8 <devfile_stat+0xb>
+  8047af:	49 bb 98 68 00 00 00 	movabs $0x6898,%r11
+  8047b6:	00 00 00 
+  8047b9:	4c 01 db             	add    %r11,%rbx
+  8047bc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8047c0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8047c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047c8:	8b 40 0c             	mov    0xc(%rax),%eax
+  8047cb:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8047d2:	00 00 00 
+  8047d5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8047d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8047dd:	bf 05 00 00 00       	mov    $0x5,%edi
+  8047e2:	48 b8 0a 91 ff ff ff 	movabs $0xffffffffffff910a,%rax
+  8047e9:	ff ff ff 
+  8047ec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047f0:	ff d0                	call   *%rax
+  8047f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047f9:	79 05                	jns    804800 <devfile_stat+0x63>
+		return r;
+  8047fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047fe:	eb 65                	jmp    804865 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804800:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804804:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80480b:	00 00 00 
+  80480e:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804812:	48 89 d6             	mov    %rdx,%rsi
+  804815:	48 89 c7             	mov    %rax,%rdi
+  804818:	49 89 df             	mov    %rbx,%r15
+  80481b:	48 b8 1a 65 ff ff ff 	movabs $0xffffffffffff651a,%rax
+  804822:	ff ff ff 
+  804825:	48 01 d8             	add    %rbx,%rax
+  804828:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80482a:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804831:	00 00 00 
+  804834:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  80483b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80483f:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804845:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  80484c:	00 00 00 
+  80484f:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804856:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80485a:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  804860:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804865:	48 83 c4 20          	add    $0x20,%rsp
+  804869:	5b                   	pop    %rbx
+  80486a:	41 5f                	pop    %r15
+  80486c:	5d                   	pop    %rbp
+  80486d:	c3                   	ret
+
+000000000080486e <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80486e:	55                   	push   %rbp
+  80486f:	48 89 e5             	mov    %rsp,%rbp
+  804872:	48 83 ec 20          	sub    $0x20,%rsp
+  804876:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804876 <devfile_trunc+0x8>
+  80487d:	49 bb ca 67 00 00 00 	movabs $0x67ca,%r11
+  804884:	00 00 00 
+  804887:	4c 01 d8             	add    %r11,%rax
+  80488a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80488e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  804891:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804895:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804898:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  80489b:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80489e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  8048a1:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8048a5:	ba 08 00 00 00       	mov    $0x8,%edx
+  8048aa:	48 89 ce             	mov    %rcx,%rsi
+  8048ad:	bf 02 00 00 00       	mov    $0x2,%edi
+  8048b2:	48 b9 b2 91 ff ff ff 	movabs $0xffffffffffff91b2,%rcx
+  8048b9:	ff ff ff 
+  8048bc:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8048c0:	ff d0                	call   *%rax
+}
+  8048c2:	c9                   	leave
+  8048c3:	c3                   	ret
+
+00000000008048c4 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8048c4:	55                   	push   %rbp
+  8048c5:	48 89 e5             	mov    %rsp,%rbp
+  8048c8:	41 57                	push   %r15
+  8048ca:	53                   	push   %rbx
+  8048cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8048cf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048cf <remove+0xb>
+  8048d6:	49 bb 71 67 00 00 00 	movabs $0x6771,%r11
+  8048dd:	00 00 00 
+  8048e0:	4c 01 db             	add    %r11,%rbx
+  8048e3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8048e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048eb:	48 89 c7             	mov    %rax,%rdi
+  8048ee:	49 89 df             	mov    %rbx,%r15
+  8048f1:	48 b8 86 64 ff ff ff 	movabs $0xffffffffffff6486,%rax
+  8048f8:	ff ff ff 
+  8048fb:	48 01 d8             	add    %rbx,%rax
+  8048fe:	ff d0                	call   *%rax
+  804900:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804905:	7e 07                	jle    80490e <remove+0x4a>
+		return -E_BAD_PATH;
+  804907:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80490c:	eb 44                	jmp    804952 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80490e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804912:	48 89 c6             	mov    %rax,%rsi
+  804915:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  80491c:	00 00 00 
+  80491f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804923:	48 89 c7             	mov    %rax,%rdi
+  804926:	49 89 df             	mov    %rbx,%r15
+  804929:	48 b8 1a 65 ff ff ff 	movabs $0xffffffffffff651a,%rax
+  804930:	ff ff ff 
+  804933:	48 01 d8             	add    %rbx,%rax
+  804936:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804938:	be 00 00 00 00       	mov    $0x0,%esi
+  80493d:	bf 07 00 00 00       	mov    $0x7,%edi
+  804942:	48 b8 0a 91 ff ff ff 	movabs $0xffffffffffff910a,%rax
+  804949:	ff ff ff 
+  80494c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804950:	ff d0                	call   *%rax
+}
+  804952:	48 83 c4 10          	add    $0x10,%rsp
+  804956:	5b                   	pop    %rbx
+  804957:	41 5f                	pop    %r15
+  804959:	5d                   	pop    %rbp
+  80495a:	c3                   	ret
+
+000000000080495b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80495b:	55                   	push   %rbp
+  80495c:	48 89 e5             	mov    %rsp,%rbp
+  80495f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80495f <sync+0x4>
+  804966:	49 bb e1 66 00 00 00 	movabs $0x66e1,%r11
+  80496d:	00 00 00 
+  804970:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  804973:	ba 00 00 00 00       	mov    $0x0,%edx
+  804978:	be 00 00 00 00       	mov    $0x0,%esi
+  80497d:	bf 08 00 00 00       	mov    $0x8,%edi
+  804982:	48 b9 b2 91 ff ff ff 	movabs $0xffffffffffff91b2,%rcx
+  804989:	ff ff ff 
+  80498c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804990:	ff d0                	call   *%rax
+}
+  804992:	5d                   	pop    %rbp
+  804993:	c3                   	ret
+
+0000000000804994 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  804994:	55                   	push   %rbp
+  804995:	48 89 e5             	mov    %rsp,%rbp
+  804998:	41 57                	push   %r15
+  80499a:	53                   	push   %rbx
+  80499b:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  8049a2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049a2 <copy+0xe>
+  8049a9:	49 bb 9e 66 00 00 00 	movabs $0x669e,%r11
+  8049b0:	00 00 00 
+  8049b3:	4c 01 db             	add    %r11,%rbx
+  8049b6:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8049bd:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8049c4:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8049cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8049d0:	48 89 c7             	mov    %rax,%rdi
+  8049d3:	48 b8 51 93 ff ff ff 	movabs $0xffffffffffff9351,%rax
+  8049da:	ff ff ff 
+  8049dd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049e1:	ff d0                	call   *%rax
+  8049e3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8049e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049ea:	79 35                	jns    804a21 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8049ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049ef:	89 c6                	mov    %eax,%esi
+  8049f1:	48 b8 ce d7 ff ff ff 	movabs $0xffffffffffffd7ce,%rax
+  8049f8:	ff ff ff 
+  8049fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049ff:	48 89 c7             	mov    %rax,%rdi
+  804a02:	49 89 df             	mov    %rbx,%r15
+  804a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a0a:	48 ba 58 57 ff ff ff 	movabs $0xffffffffffff5758,%rdx
+  804a11:	ff ff ff 
+  804a14:	48 01 da             	add    %rbx,%rdx
+  804a17:	ff d2                	call   *%rdx
+		return fd_src;
+  804a19:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a1c:	e9 d7 01 00 00       	jmp    804bf8 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  804a21:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804a28:	be 01 01 00 00       	mov    $0x101,%esi
+  804a2d:	48 89 c7             	mov    %rax,%rdi
+  804a30:	48 b8 51 93 ff ff ff 	movabs $0xffffffffffff9351,%rax
+  804a37:	ff ff ff 
+  804a3a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a3e:	ff d0                	call   *%rax
+  804a40:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  804a43:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804a47:	0f 89 df 00 00 00    	jns    804b2c <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804a4d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a50:	89 c6                	mov    %eax,%esi
+  804a52:	48 b8 e4 d7 ff ff ff 	movabs $0xffffffffffffd7e4,%rax
+  804a59:	ff ff ff 
+  804a5c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a60:	48 89 c7             	mov    %rax,%rdi
+  804a63:	49 89 df             	mov    %rbx,%r15
+  804a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a6b:	48 ba 58 57 ff ff ff 	movabs $0xffffffffffff5758,%rdx
+  804a72:	ff ff ff 
+  804a75:	48 01 da             	add    %rbx,%rdx
+  804a78:	ff d2                	call   *%rdx
+		close(fd_src);
+  804a7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a7d:	89 c7                	mov    %eax,%edi
+  804a7f:	49 89 df             	mov    %rbx,%r15
+  804a82:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  804a89:	ff ff ff 
+  804a8c:	48 01 d8             	add    %rbx,%rax
+  804a8f:	ff d0                	call   *%rax
+		return fd_dest;
+  804a91:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a94:	e9 5f 01 00 00       	jmp    804bf8 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804a99:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804a9c:	48 63 d0             	movslq %eax,%rdx
+  804a9f:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804aa6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804aa9:	48 89 ce             	mov    %rcx,%rsi
+  804aac:	89 c7                	mov    %eax,%edi
+  804aae:	49 89 df             	mov    %rbx,%r15
+  804ab1:	48 b8 28 8d ff ff ff 	movabs $0xffffffffffff8d28,%rax
+  804ab8:	ff ff ff 
+  804abb:	48 01 d8             	add    %rbx,%rax
+  804abe:	ff d0                	call   *%rax
+  804ac0:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804ac3:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804ac7:	79 63                	jns    804b2c <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804ac9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804acc:	89 c6                	mov    %eax,%esi
+  804ace:	48 b8 fe d7 ff ff ff 	movabs $0xffffffffffffd7fe,%rax
+  804ad5:	ff ff ff 
+  804ad8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804adc:	48 89 c7             	mov    %rax,%rdi
+  804adf:	49 89 df             	mov    %rbx,%r15
+  804ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae7:	48 ba 58 57 ff ff ff 	movabs $0xffffffffffff5758,%rdx
+  804aee:	ff ff ff 
+  804af1:	48 01 da             	add    %rbx,%rdx
+  804af4:	ff d2                	call   *%rdx
+			close(fd_src);
+  804af6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804af9:	89 c7                	mov    %eax,%edi
+  804afb:	49 89 df             	mov    %rbx,%r15
+  804afe:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  804b05:	ff ff ff 
+  804b08:	48 01 d8             	add    %rbx,%rax
+  804b0b:	ff d0                	call   *%rax
+			close(fd_dest);
+  804b0d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b10:	89 c7                	mov    %eax,%edi
+  804b12:	49 89 df             	mov    %rbx,%r15
+  804b15:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  804b1c:	ff ff ff 
+  804b1f:	48 01 d8             	add    %rbx,%rax
+  804b22:	ff d0                	call   *%rax
+			return write_size;
+  804b24:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804b27:	e9 cc 00 00 00       	jmp    804bf8 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804b2c:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804b33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b36:	ba 00 02 00 00       	mov    $0x200,%edx
+  804b3b:	48 89 ce             	mov    %rcx,%rsi
+  804b3e:	89 c7                	mov    %eax,%edi
+  804b40:	49 89 df             	mov    %rbx,%r15
+  804b43:	48 b8 82 8b ff ff ff 	movabs $0xffffffffffff8b82,%rax
+  804b4a:	ff ff ff 
+  804b4d:	48 01 d8             	add    %rbx,%rax
+  804b50:	ff d0                	call   *%rax
+  804b52:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804b55:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804b59:	0f 8f 3a ff ff ff    	jg     804a99 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804b5f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804b63:	79 60                	jns    804bc5 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804b65:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b68:	89 c6                	mov    %eax,%esi
+  804b6a:	48 b8 11 d8 ff ff ff 	movabs $0xffffffffffffd811,%rax
+  804b71:	ff ff ff 
+  804b74:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b78:	48 89 c7             	mov    %rax,%rdi
+  804b7b:	49 89 df             	mov    %rbx,%r15
+  804b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b83:	48 ba 58 57 ff ff ff 	movabs $0xffffffffffff5758,%rdx
+  804b8a:	ff ff ff 
+  804b8d:	48 01 da             	add    %rbx,%rdx
+  804b90:	ff d2                	call   *%rdx
+		close(fd_src);
+  804b92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b95:	89 c7                	mov    %eax,%edi
+  804b97:	49 89 df             	mov    %rbx,%r15
+  804b9a:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  804ba1:	ff ff ff 
+  804ba4:	48 01 d8             	add    %rbx,%rax
+  804ba7:	ff d0                	call   *%rax
+		close(fd_dest);
+  804ba9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804bac:	89 c7                	mov    %eax,%edi
+  804bae:	49 89 df             	mov    %rbx,%r15
+  804bb1:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  804bb8:	ff ff ff 
+  804bbb:	48 01 d8             	add    %rbx,%rax
+  804bbe:	ff d0                	call   *%rax
+		return read_size;
+  804bc0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804bc3:	eb 33                	jmp    804bf8 <copy+0x264>
+	}
+	close(fd_src);
+  804bc5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bc8:	89 c7                	mov    %eax,%edi
+  804bca:	49 89 df             	mov    %rbx,%r15
+  804bcd:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  804bd4:	ff ff ff 
+  804bd7:	48 01 d8             	add    %rbx,%rax
+  804bda:	ff d0                	call   *%rax
+	close(fd_dest);
+  804bdc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804bdf:	89 c7                	mov    %eax,%edi
+  804be1:	49 89 df             	mov    %rbx,%r15
+  804be4:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  804beb:	ff ff ff 
+  804bee:	48 01 d8             	add    %rbx,%rax
+  804bf1:	ff d0                	call   *%rax
+	return 0;
+  804bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804bf8:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804bff:	5b                   	pop    %rbx
+  804c00:	41 5f                	pop    %r15
+  804c02:	5d                   	pop    %rbp
+  804c03:	c3                   	ret
+
+0000000000804c04 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  804c04:	55                   	push   %rbp
+  804c05:	48 89 e5             	mov    %rsp,%rbp
+  804c08:	41 57                	push   %r15
+  804c0a:	53                   	push   %rbx
+  804c0b:	48 81 ec 00 03 00 00 	sub    $0x300,%rsp
+  804c12:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c12 <spawn+0xe>
+  804c19:	49 bb 2e 64 00 00 00 	movabs $0x642e,%r11
+  804c20:	00 00 00 
+  804c23:	4c 01 db             	add    %r11,%rbx
+  804c26:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  804c2d:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  804c34:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  804c3b:	be 00 00 00 00       	mov    $0x0,%esi
+  804c40:	48 89 c7             	mov    %rax,%rdi
+  804c43:	49 89 df             	mov    %rbx,%r15
+  804c46:	48 b8 51 93 ff ff ff 	movabs $0xffffffffffff9351,%rax
+  804c4d:	ff ff ff 
+  804c50:	48 01 d8             	add    %rbx,%rax
+  804c53:	ff d0                	call   *%rax
+  804c55:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804c58:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804c5c:	79 08                	jns    804c66 <spawn+0x62>
+		return r;
+  804c5e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804c61:	e9 9e 04 00 00       	jmp    805104 <spawn+0x500>
+	fd = r;
+  804c66:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804c69:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+  804c6c:	48 8d 85 c0 fd ff ff 	lea    -0x240(%rbp),%rax
+  804c73:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  804c77:	48 8d 8d c0 fd ff ff 	lea    -0x240(%rbp),%rcx
+  804c7e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804c81:	ba 00 02 00 00       	mov    $0x200,%edx
+  804c86:	48 89 ce             	mov    %rcx,%rsi
+  804c89:	89 c7                	mov    %eax,%edi
+  804c8b:	49 89 df             	mov    %rbx,%r15
+  804c8e:	48 b8 95 8c ff ff ff 	movabs $0xffffffffffff8c95,%rax
+  804c95:	ff ff ff 
+  804c98:	48 01 d8             	add    %rbx,%rax
+  804c9b:	ff d0                	call   *%rax
+  804c9d:	3d 00 02 00 00       	cmp    $0x200,%eax
+  804ca2:	75 0d                	jne    804cb1 <spawn+0xad>
+            || elf->e_magic != ELF_MAGIC) {
+  804ca4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ca8:	8b 00                	mov    (%rax),%eax
+  804caa:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  804caf:	74 56                	je     804d07 <spawn+0x103>
+		close(fd);
+  804cb1:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804cb4:	89 c7                	mov    %eax,%edi
+  804cb6:	49 89 df             	mov    %rbx,%r15
+  804cb9:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  804cc0:	ff ff ff 
+  804cc3:	48 01 d8             	add    %rbx,%rax
+  804cc6:	ff d0                	call   *%rax
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  804cc8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ccc:	8b 00                	mov    (%rax),%eax
+  804cce:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  804cd3:	89 c6                	mov    %eax,%esi
+  804cd5:	48 b8 28 d8 ff ff ff 	movabs $0xffffffffffffd828,%rax
+  804cdc:	ff ff ff 
+  804cdf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ce3:	48 89 c7             	mov    %rax,%rdi
+  804ce6:	49 89 df             	mov    %rbx,%r15
+  804ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cee:	48 b9 58 57 ff ff ff 	movabs $0xffffffffffff5758,%rcx
+  804cf5:	ff ff ff 
+  804cf8:	48 01 d9             	add    %rbx,%rcx
+  804cfb:	ff d1                	call   *%rcx
+		return -E_NOT_EXEC;
+  804cfd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804d02:	e9 fd 03 00 00       	jmp    805104 <spawn+0x500>
+	__asm __volatile("int %2"
+  804d07:	b8 07 00 00 00       	mov    $0x7,%eax
+  804d0c:	cd 30                	int    $0x30
+  804d0e:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	return ret;
+  804d11:	8b 45 c0             	mov    -0x40(%rbp),%eax
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  804d14:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804d17:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804d1b:	79 08                	jns    804d25 <spawn+0x121>
+		return r;
+  804d1d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804d20:	e9 df 03 00 00       	jmp    805104 <spawn+0x500>
+	child = r;
+  804d25:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804d28:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  804d2b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804d2e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d33:	89 c1                	mov    %eax,%ecx
+  804d35:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  804d3c:	ff ff ff 
+  804d3f:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  804d43:	48 63 c1             	movslq %ecx,%rax
+  804d46:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  804d4d:	48 01 d0             	add    %rdx,%rax
+  804d50:	48 8b 30             	mov    (%rax),%rsi
+  804d53:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  804d57:	48 89 b5 00 fd ff ff 	mov    %rsi,-0x300(%rbp)
+  804d5e:	48 89 bd 08 fd ff ff 	mov    %rdi,-0x2f8(%rbp)
+  804d65:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  804d69:	48 8b 78 18          	mov    0x18(%rax),%rdi
+  804d6d:	48 89 b5 10 fd ff ff 	mov    %rsi,-0x2f0(%rbp)
+  804d74:	48 89 bd 18 fd ff ff 	mov    %rdi,-0x2e8(%rbp)
+  804d7b:	48 8b 70 20          	mov    0x20(%rax),%rsi
+  804d7f:	48 8b 78 28          	mov    0x28(%rax),%rdi
+  804d83:	48 89 b5 20 fd ff ff 	mov    %rsi,-0x2e0(%rbp)
+  804d8a:	48 89 bd 28 fd ff ff 	mov    %rdi,-0x2d8(%rbp)
+  804d91:	48 8b 70 30          	mov    0x30(%rax),%rsi
+  804d95:	48 8b 78 38          	mov    0x38(%rax),%rdi
+  804d99:	48 89 b5 30 fd ff ff 	mov    %rsi,-0x2d0(%rbp)
+  804da0:	48 89 bd 38 fd ff ff 	mov    %rdi,-0x2c8(%rbp)
+  804da7:	48 8b 70 40          	mov    0x40(%rax),%rsi
+  804dab:	48 8b 78 48          	mov    0x48(%rax),%rdi
+  804daf:	48 89 b5 40 fd ff ff 	mov    %rsi,-0x2c0(%rbp)
+  804db6:	48 89 bd 48 fd ff ff 	mov    %rdi,-0x2b8(%rbp)
+  804dbd:	48 8b 70 50          	mov    0x50(%rax),%rsi
+  804dc1:	48 8b 78 58          	mov    0x58(%rax),%rdi
+  804dc5:	48 89 b5 50 fd ff ff 	mov    %rsi,-0x2b0(%rbp)
+  804dcc:	48 89 bd 58 fd ff ff 	mov    %rdi,-0x2a8(%rbp)
+  804dd3:	48 8b 70 60          	mov    0x60(%rax),%rsi
+  804dd7:	48 8b 78 68          	mov    0x68(%rax),%rdi
+  804ddb:	48 89 b5 60 fd ff ff 	mov    %rsi,-0x2a0(%rbp)
+  804de2:	48 89 bd 68 fd ff ff 	mov    %rdi,-0x298(%rbp)
+  804de9:	48 8b 70 70          	mov    0x70(%rax),%rsi
+  804ded:	48 8b 78 78          	mov    0x78(%rax),%rdi
+  804df1:	48 89 b5 70 fd ff ff 	mov    %rsi,-0x290(%rbp)
+  804df8:	48 89 bd 78 fd ff ff 	mov    %rdi,-0x288(%rbp)
+  804dff:	48 8b b0 80 00 00 00 	mov    0x80(%rax),%rsi
+  804e06:	48 8b b8 88 00 00 00 	mov    0x88(%rax),%rdi
+  804e0d:	48 89 b5 80 fd ff ff 	mov    %rsi,-0x280(%rbp)
+  804e14:	48 89 bd 88 fd ff ff 	mov    %rdi,-0x278(%rbp)
+  804e1b:	48 8b b0 90 00 00 00 	mov    0x90(%rax),%rsi
+  804e22:	48 8b b8 98 00 00 00 	mov    0x98(%rax),%rdi
+  804e29:	48 89 b5 90 fd ff ff 	mov    %rsi,-0x270(%rbp)
+  804e30:	48 89 bd 98 fd ff ff 	mov    %rdi,-0x268(%rbp)
+  804e37:	48 8b b0 a0 00 00 00 	mov    0xa0(%rax),%rsi
+  804e3e:	48 8b b8 a8 00 00 00 	mov    0xa8(%rax),%rdi
+  804e45:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  804e4c:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  804e53:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  804e5a:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  804e61:	48 89 85 b0 fd ff ff 	mov    %rax,-0x250(%rbp)
+  804e68:	48 89 95 b8 fd ff ff 	mov    %rdx,-0x248(%rbp)
+	child_tf.tf_rip = elf->e_entry;
+  804e6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e73:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804e77:	48 89 85 98 fd ff ff 	mov    %rax,-0x268(%rbp)
+
+	if ((r = init_stack(child, argv, &child_tf.tf_rsp)) < 0)
+  804e7e:	48 8d 85 00 fd ff ff 	lea    -0x300(%rbp),%rax
+  804e85:	48 8d 90 b0 00 00 00 	lea    0xb0(%rax),%rdx
+  804e8c:	48 8b 8d f0 fc ff ff 	mov    -0x310(%rbp),%rcx
+  804e93:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804e96:	48 89 ce             	mov    %rcx,%rsi
+  804e99:	89 c7                	mov    %eax,%edi
+  804e9b:	48 b8 52 a3 ff ff ff 	movabs $0xffffffffffffa352,%rax
+  804ea2:	ff ff ff 
+  804ea5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ea9:	ff d0                	call   *%rax
+  804eab:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804eae:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804eb2:	79 08                	jns    804ebc <spawn+0x2b8>
+		return r;
+  804eb4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804eb7:	e9 48 02 00 00       	jmp    805104 <spawn+0x500>
+
+	// Set up program segments as defined in ELF header.
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  804ebc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ec0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  804ec4:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  804ecb:	48 01 d0             	add    %rdx,%rax
+  804ece:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  804ed2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804ed9:	e9 84 00 00 00       	jmp    804f62 <spawn+0x35e>
+		if (ph->p_type != ELF_PROG_LOAD)
+  804ede:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ee2:	8b 00                	mov    (%rax),%eax
+  804ee4:	83 f8 01             	cmp    $0x1,%eax
+  804ee7:	75 6f                	jne    804f58 <spawn+0x354>
+			continue;
+		perm = PTE_P | PTE_U;
+  804ee9:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%rbp)
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  804ef0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ef4:	8b 40 04             	mov    0x4(%rax),%eax
+  804ef7:	83 e0 02             	and    $0x2,%eax
+  804efa:	85 c0                	test   %eax,%eax
+  804efc:	74 04                	je     804f02 <spawn+0x2fe>
+			perm |= PTE_W;
+  804efe:	83 4d dc 02          	orl    $0x2,-0x24(%rbp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+				     fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  804f02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f06:	48 8b 40 08          	mov    0x8(%rax),%rax
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  804f0a:	41 89 c1             	mov    %eax,%r9d
+  804f0d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f11:	4c 8b 40 20          	mov    0x20(%rax),%r8
+  804f15:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f19:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  804f1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f21:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  804f25:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  804f28:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804f2b:	48 83 ec 08          	sub    $0x8,%rsp
+  804f2f:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  804f32:	57                   	push   %rdi
+  804f33:	89 c7                	mov    %eax,%edi
+  804f35:	48 b8 64 a6 ff ff ff 	movabs $0xffffffffffffa664,%rax
+  804f3c:	ff ff ff 
+  804f3f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f43:	ff d0                	call   *%rax
+  804f45:	48 83 c4 10          	add    $0x10,%rsp
+  804f49:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804f4c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804f50:	0f 88 7c 01 00 00    	js     8050d2 <spawn+0x4ce>
+  804f56:	eb 01                	jmp    804f59 <spawn+0x355>
+			continue;
+  804f58:	90                   	nop
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  804f59:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804f5d:	48 83 45 e0 38       	addq   $0x38,-0x20(%rbp)
+  804f62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f66:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  804f6a:	0f b7 c0             	movzwl %ax,%eax
+  804f6d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804f70:	0f 8c 68 ff ff ff    	jl     804ede <spawn+0x2da>
+			goto error;
+	}
+	close(fd);
+  804f76:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804f79:	89 c7                	mov    %eax,%edi
+  804f7b:	49 89 df             	mov    %rbx,%r15
+  804f7e:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  804f85:	ff ff ff 
+  804f88:	48 01 d8             	add    %rbx,%rax
+  804f8b:	ff d0                	call   *%rax
+	fd = -1;
+  804f8d:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+	// Copy shared library state.
+	if ((r = copy_shared_pages(child)) < 0)
+  804f94:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804f97:	89 c7                	mov    %eax,%edi
+  804f99:	48 b8 2b ab ff ff ff 	movabs $0xffffffffffffab2b,%rax
+  804fa0:	ff ff ff 
+  804fa3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fa7:	ff d0                	call   *%rax
+  804fa9:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804fac:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804fb0:	79 44                	jns    804ff6 <spawn+0x3f2>
+		panic("copy_shared_pages: %e", r);
+  804fb2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804fb5:	89 c1                	mov    %eax,%ecx
+  804fb7:	48 b8 42 d8 ff ff ff 	movabs $0xffffffffffffd842,%rax
+  804fbe:	ff ff ff 
+  804fc1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fc5:	48 89 c2             	mov    %rax,%rdx
+  804fc8:	be 82 00 00 00       	mov    $0x82,%esi
+  804fcd:	48 b8 58 d8 ff ff ff 	movabs $0xffffffffffffd858,%rax
+  804fd4:	ff ff ff 
+  804fd7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fdb:	48 89 c7             	mov    %rax,%rdi
+  804fde:	49 89 df             	mov    %rbx,%r15
+  804fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fe6:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  804fed:	ff ff ff 
+  804ff0:	49 01 d8             	add    %rbx,%r8
+  804ff3:	41 ff d0             	call   *%r8
+
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  804ff6:	48 8d 95 00 fd ff ff 	lea    -0x300(%rbp),%rdx
+  804ffd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805000:	48 89 d6             	mov    %rdx,%rsi
+  805003:	89 c7                	mov    %eax,%edi
+  805005:	49 89 df             	mov    %rbx,%r15
+  805008:	48 b8 6d 73 ff ff ff 	movabs $0xffffffffffff736d,%rax
+  80500f:	ff ff ff 
+  805012:	48 01 d8             	add    %rbx,%rax
+  805015:	ff d0                	call   *%rax
+  805017:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80501a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80501e:	79 44                	jns    805064 <spawn+0x460>
+		panic("sys_env_set_trapframe: %e", r);
+  805020:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805023:	89 c1                	mov    %eax,%ecx
+  805025:	48 b8 64 d8 ff ff ff 	movabs $0xffffffffffffd864,%rax
+  80502c:	ff ff ff 
+  80502f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805033:	48 89 c2             	mov    %rax,%rdx
+  805036:	be 85 00 00 00       	mov    $0x85,%esi
+  80503b:	48 b8 58 d8 ff ff ff 	movabs $0xffffffffffffd858,%rax
+  805042:	ff ff ff 
+  805045:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805049:	48 89 c7             	mov    %rax,%rdi
+  80504c:	49 89 df             	mov    %rbx,%r15
+  80504f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805054:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  80505b:	ff ff ff 
+  80505e:	49 01 d8             	add    %rbx,%r8
+  805061:	41 ff d0             	call   *%r8
+
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  805064:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805067:	be 02 00 00 00       	mov    $0x2,%esi
+  80506c:	89 c7                	mov    %eax,%edi
+  80506e:	49 89 df             	mov    %rbx,%r15
+  805071:	48 b8 0d 73 ff ff ff 	movabs $0xffffffffffff730d,%rax
+  805078:	ff ff ff 
+  80507b:	48 01 d8             	add    %rbx,%rax
+  80507e:	ff d0                	call   *%rax
+  805080:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805083:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805087:	79 44                	jns    8050cd <spawn+0x4c9>
+		panic("sys_env_set_status: %e", r);
+  805089:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80508c:	89 c1                	mov    %eax,%ecx
+  80508e:	48 b8 7e d8 ff ff ff 	movabs $0xffffffffffffd87e,%rax
+  805095:	ff ff ff 
+  805098:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80509c:	48 89 c2             	mov    %rax,%rdx
+  80509f:	be 88 00 00 00       	mov    $0x88,%esi
+  8050a4:	48 b8 58 d8 ff ff ff 	movabs $0xffffffffffffd858,%rax
+  8050ab:	ff ff ff 
+  8050ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050b2:	48 89 c7             	mov    %rax,%rdi
+  8050b5:	49 89 df             	mov    %rbx,%r15
+  8050b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050bd:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  8050c4:	ff ff ff 
+  8050c7:	49 01 d8             	add    %rbx,%r8
+  8050ca:	41 ff d0             	call   *%r8
+
+	return child;
+  8050cd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8050d0:	eb 32                	jmp    805104 <spawn+0x500>
+			goto error;
+  8050d2:	90                   	nop
+
+error:
+	sys_env_destroy(child);
+  8050d3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8050d6:	89 c7                	mov    %eax,%edi
+  8050d8:	49 89 df             	mov    %rbx,%r15
+  8050db:	48 b8 d1 70 ff ff ff 	movabs $0xffffffffffff70d1,%rax
+  8050e2:	ff ff ff 
+  8050e5:	48 01 d8             	add    %rbx,%rax
+  8050e8:	ff d0                	call   *%rax
+	close(fd);
+  8050ea:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8050ed:	89 c7                	mov    %eax,%edi
+  8050ef:	49 89 df             	mov    %rbx,%r15
+  8050f2:	48 b8 ca 88 ff ff ff 	movabs $0xffffffffffff88ca,%rax
+  8050f9:	ff ff ff 
+  8050fc:	48 01 d8             	add    %rbx,%rax
+  8050ff:	ff d0                	call   *%rax
+	return r;
+  805101:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+  805104:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805108:	5b                   	pop    %rbx
+  805109:	41 5f                	pop    %r15
+  80510b:	5d                   	pop    %rbp
+  80510c:	c3                   	ret
+
+000000000080510d <spawnl>:
+// Spawn, taking command-line arguments array directly on the stack.
+// NOTE: Must have a sentinal of NULL at the end of the args
+// (none of the args may be NULL).
+int
+spawnl(const char *prog, const char *arg0, ...)
+{
+  80510d:	55                   	push   %rbp
+  80510e:	48 89 e5             	mov    %rsp,%rbp
+  805111:	41 57                	push   %r15
+  805113:	41 56                	push   %r14
+  805115:	41 55                	push   %r13
+  805117:	41 54                	push   %r12
+  805119:	53                   	push   %rbx
+  80511a:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  805121:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 805121 <spawnl+0x14>
+  805128:	49 bb 1f 5f 00 00 00 	movabs $0x5f1f,%r11
+  80512f:	00 00 00 
+  805132:	4d 01 da             	add    %r11,%r10
+  805135:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  80513c:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  805143:	48 89 95 30 ff ff ff 	mov    %rdx,-0xd0(%rbp)
+  80514a:	48 89 8d 38 ff ff ff 	mov    %rcx,-0xc8(%rbp)
+  805151:	4c 89 85 40 ff ff ff 	mov    %r8,-0xc0(%rbp)
+  805158:	4c 89 8d 48 ff ff ff 	mov    %r9,-0xb8(%rbp)
+  80515f:	84 c0                	test   %al,%al
+  805161:	74 29                	je     80518c <spawnl+0x7f>
+  805163:	0f 29 85 50 ff ff ff 	movaps %xmm0,-0xb0(%rbp)
+  80516a:	0f 29 8d 60 ff ff ff 	movaps %xmm1,-0xa0(%rbp)
+  805171:	0f 29 95 70 ff ff ff 	movaps %xmm2,-0x90(%rbp)
+  805178:	0f 29 5d 80          	movaps %xmm3,-0x80(%rbp)
+  80517c:	0f 29 65 90          	movaps %xmm4,-0x70(%rbp)
+  805180:	0f 29 6d a0          	movaps %xmm5,-0x60(%rbp)
+  805184:	0f 29 75 b0          	movaps %xmm6,-0x50(%rbp)
+  805188:	0f 29 7d c0          	movaps %xmm7,-0x40(%rbp)
+  80518c:	48 89 e0             	mov    %rsp,%rax
+  80518f:	48 89 c3             	mov    %rax,%rbx
+	// We calculate argc by advancing the args until we hit NULL.
+	// The contract of the function guarantees that the last
+	// argument will always be NULL, and that none of the other
+	// arguments will be NULL.
+	int argc=0;
+  805192:	c7 85 1c ff ff ff 00 	movl   $0x0,-0xe4(%rbp)
+  805199:	00 00 00 
+	va_list vl;
+	va_start(vl, arg0);
+  80519c:	c7 85 f0 fe ff ff 10 	movl   $0x10,-0x110(%rbp)
+  8051a3:	00 00 00 
+  8051a6:	c7 85 f4 fe ff ff 30 	movl   $0x30,-0x10c(%rbp)
+  8051ad:	00 00 00 
+  8051b0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8051b4:	48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+  8051bb:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  8051c2:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+	while(va_arg(vl, void *) != NULL)
+  8051c9:	eb 07                	jmp    8051d2 <spawnl+0xc5>
+		argc++;
+  8051cb:	83 85 1c ff ff ff 01 	addl   $0x1,-0xe4(%rbp)
+	while(va_arg(vl, void *) != NULL)
+  8051d2:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8051d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8051db:	77 23                	ja     805200 <spawnl+0xf3>
+  8051dd:	48 8b 85 00 ff ff ff 	mov    -0x100(%rbp),%rax
+  8051e4:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  8051ea:	89 d2                	mov    %edx,%edx
+  8051ec:	48 01 d0             	add    %rdx,%rax
+  8051ef:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  8051f5:	83 c2 08             	add    $0x8,%edx
+  8051f8:	89 95 f0 fe ff ff    	mov    %edx,-0x110(%rbp)
+  8051fe:	eb 12                	jmp    805212 <spawnl+0x105>
+  805200:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  805207:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80520b:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  805212:	48 8b 00             	mov    (%rax),%rax
+  805215:	48 85 c0             	test   %rax,%rax
+  805218:	75 b1                	jne    8051cb <spawnl+0xbe>
+	va_end(vl);
+
+	// Now that we have the size of the args, do a second pass
+	// and store the values in a VLA, which has the format of argv
+	const char *argv[argc+2];
+  80521a:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  805220:	83 c0 02             	add    $0x2,%eax
+  805223:	48 63 d0             	movslq %eax,%rdx
+  805226:	48 83 ea 01          	sub    $0x1,%rdx
+  80522a:	48 89 95 10 ff ff ff 	mov    %rdx,-0xf0(%rbp)
+  805231:	48 63 d0             	movslq %eax,%rdx
+  805234:	49 89 d6             	mov    %rdx,%r14
+  805237:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80523d:	48 63 d0             	movslq %eax,%rdx
+  805240:	49 89 d4             	mov    %rdx,%r12
+  805243:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  805249:	48 98                	cltq
+  80524b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  805252:	00 
+  805253:	b8 10 00 00 00       	mov    $0x10,%eax
+  805258:	48 83 e8 01          	sub    $0x1,%rax
+  80525c:	48 01 d0             	add    %rdx,%rax
+  80525f:	be 10 00 00 00       	mov    $0x10,%esi
+  805264:	ba 00 00 00 00       	mov    $0x0,%edx
+  805269:	48 f7 f6             	div    %rsi
+  80526c:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  805270:	48 29 c4             	sub    %rax,%rsp
+  805273:	48 89 e0             	mov    %rsp,%rax
+  805276:	48 83 c0 07          	add    $0x7,%rax
+  80527a:	48 c1 e8 03          	shr    $0x3,%rax
+  80527e:	48 c1 e0 03          	shl    $0x3,%rax
+  805282:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+	argv[0] = arg0;
+  805289:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805290:	48 8b 95 e0 fe ff ff 	mov    -0x120(%rbp),%rdx
+  805297:	48 89 10             	mov    %rdx,(%rax)
+	argv[argc+1] = NULL;
+  80529a:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  8052a0:	8d 50 01             	lea    0x1(%rax),%edx
+  8052a3:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8052aa:	48 63 d2             	movslq %edx,%rdx
+  8052ad:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  8052b4:	00 
+
+	va_start(vl, arg0);
+  8052b5:	c7 85 f0 fe ff ff 10 	movl   $0x10,-0x110(%rbp)
+  8052bc:	00 00 00 
+  8052bf:	c7 85 f4 fe ff ff 30 	movl   $0x30,-0x10c(%rbp)
+  8052c6:	00 00 00 
+  8052c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8052cd:	48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+  8052d4:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  8052db:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+	unsigned i;
+	for(i=0;i<argc;i++)
+  8052e2:	c7 85 18 ff ff ff 00 	movl   $0x0,-0xe8(%rbp)
+  8052e9:	00 00 00 
+  8052ec:	eb 60                	jmp    80534e <spawnl+0x241>
+		argv[i+1] = va_arg(vl, const char *);
+  8052ee:	8b 85 18 ff ff ff    	mov    -0xe8(%rbp),%eax
+  8052f4:	8d 48 01             	lea    0x1(%rax),%ecx
+  8052f7:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8052fd:	83 f8 2f             	cmp    $0x2f,%eax
+  805300:	77 23                	ja     805325 <spawnl+0x218>
+  805302:	48 8b 85 00 ff ff ff 	mov    -0x100(%rbp),%rax
+  805309:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  80530f:	89 d2                	mov    %edx,%edx
+  805311:	48 01 d0             	add    %rdx,%rax
+  805314:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  80531a:	83 c2 08             	add    $0x8,%edx
+  80531d:	89 95 f0 fe ff ff    	mov    %edx,-0x110(%rbp)
+  805323:	eb 12                	jmp    805337 <spawnl+0x22a>
+  805325:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80532c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  805330:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  805337:	48 8b 10             	mov    (%rax),%rdx
+  80533a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805341:	89 c9                	mov    %ecx,%ecx
+  805343:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+	for(i=0;i<argc;i++)
+  805347:	83 85 18 ff ff ff 01 	addl   $0x1,-0xe8(%rbp)
+  80534e:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  805354:	39 85 18 ff ff ff    	cmp    %eax,-0xe8(%rbp)
+  80535a:	72 92                	jb     8052ee <spawnl+0x1e1>
+	va_end(vl);
+	return spawn(prog, argv);
+  80535c:	48 8b 95 08 ff ff ff 	mov    -0xf8(%rbp),%rdx
+  805363:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  80536a:	48 89 d6             	mov    %rdx,%rsi
+  80536d:	48 89 c7             	mov    %rax,%rdi
+  805370:	48 b8 c4 9b ff ff ff 	movabs $0xffffffffffff9bc4,%rax
+  805377:	ff ff ff 
+  80537a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80537e:	ff d0                	call   *%rax
+  805380:	48 89 dc             	mov    %rbx,%rsp
+}
+  805383:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  805387:	5b                   	pop    %rbx
+  805388:	41 5c                	pop    %r12
+  80538a:	41 5d                	pop    %r13
+  80538c:	41 5e                	pop    %r14
+  80538e:	41 5f                	pop    %r15
+  805390:	5d                   	pop    %rbp
+  805391:	c3                   	ret
+
+0000000000805392 <init_stack>:
+// On success, returns 0 and sets *init_esp
+// to the initial stack pointer with which the child should start.
+// Returns < 0 on failure.
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_esp)
+{
+  805392:	55                   	push   %rbp
+  805393:	48 89 e5             	mov    %rsp,%rbp
+  805396:	41 57                	push   %r15
+  805398:	53                   	push   %rbx
+  805399:	48 83 ec 50          	sub    $0x50,%rsp
+  80539d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80539d <init_stack+0xb>
+  8053a4:	49 bb a3 5c 00 00 00 	movabs $0x5ca3,%r11
+  8053ab:	00 00 00 
+  8053ae:	4c 01 db             	add    %r11,%rbx
+  8053b1:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8053b4:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8053b8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	char *string_store;
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+  8053bc:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8053c3:	00 
+	for (argc = 0; argv[argc] != 0; argc++)
+  8053c4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  8053cb:	eb 39                	jmp    805406 <init_stack+0x74>
+		string_size += strlen(argv[argc]) + 1;
+  8053cd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8053d0:	48 98                	cltq
+  8053d2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8053d9:	00 
+  8053da:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8053de:	48 01 d0             	add    %rdx,%rax
+  8053e1:	48 8b 00             	mov    (%rax),%rax
+  8053e4:	48 89 c7             	mov    %rax,%rdi
+  8053e7:	49 89 df             	mov    %rbx,%r15
+  8053ea:	48 b8 86 64 ff ff ff 	movabs $0xffffffffffff6486,%rax
+  8053f1:	ff ff ff 
+  8053f4:	48 01 d8             	add    %rbx,%rax
+  8053f7:	ff d0                	call   *%rax
+  8053f9:	83 c0 01             	add    $0x1,%eax
+  8053fc:	48 98                	cltq
+  8053fe:	48 01 45 e8          	add    %rax,-0x18(%rbp)
+	for (argc = 0; argv[argc] != 0; argc++)
+  805402:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  805406:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805409:	48 98                	cltq
+  80540b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  805412:	00 
+  805413:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805417:	48 01 d0             	add    %rdx,%rax
+  80541a:	48 8b 00             	mov    (%rax),%rax
+  80541d:	48 85 c0             	test   %rax,%rax
+  805420:	75 ab                	jne    8053cd <init_stack+0x3b>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  805422:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805426:	48 f7 d8             	neg    %rax
+  805429:	48 05 00 10 40 00    	add    $0x401000,%rax
+  80542f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 8) - 8 * (argc + 1));
+  805433:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805437:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80543b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80543f:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  805443:	48 89 c2             	mov    %rax,%rdx
+  805446:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805449:	83 c0 01             	add    $0x1,%eax
+  80544c:	c1 e0 03             	shl    $0x3,%eax
+  80544f:	48 98                	cltq
+  805451:	48 f7 d8             	neg    %rax
+  805454:	48 01 d0             	add    %rdx,%rax
+  805457:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  80545b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80545f:	48 83 e8 10          	sub    $0x10,%rax
+  805463:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  805469:	77 0a                	ja     805475 <init_stack+0xe3>
+		return -E_NO_MEM;
+  80546b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  805470:	e9 26 02 00 00       	jmp    80569b <init_stack+0x309>
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  805475:	ba 07 00 00 00       	mov    $0x7,%edx
+  80547a:	be 00 00 40 00       	mov    $0x400000,%esi
+  80547f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805484:	49 89 df             	mov    %rbx,%r15
+  805487:	48 b8 d6 71 ff ff ff 	movabs $0xffffffffffff71d6,%rax
+  80548e:	ff ff ff 
+  805491:	48 01 d8             	add    %rbx,%rax
+  805494:	ff d0                	call   *%rax
+  805496:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  805499:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80549d:	79 08                	jns    8054a7 <init_stack+0x115>
+		return r;
+  80549f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054a2:	e9 f4 01 00 00       	jmp    80569b <init_stack+0x309>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8054a7:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+  8054ae:	e9 96 00 00 00       	jmp    805549 <init_stack+0x1b7>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8054b3:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  8054b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054bc:	48 01 d0             	add    %rdx,%rax
+  8054bf:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  8054c6:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8054c9:	48 98                	cltq
+  8054cb:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  8054d2:	00 
+  8054d3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8054d7:	48 01 c8             	add    %rcx,%rax
+  8054da:	48 89 10             	mov    %rdx,(%rax)
+		strcpy(string_store, argv[i]);
+  8054dd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8054e0:	48 98                	cltq
+  8054e2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8054e9:	00 
+  8054ea:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8054ee:	48 01 d0             	add    %rdx,%rax
+  8054f1:	48 8b 10             	mov    (%rax),%rdx
+  8054f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054f8:	48 89 d6             	mov    %rdx,%rsi
+  8054fb:	48 89 c7             	mov    %rax,%rdi
+  8054fe:	49 89 df             	mov    %rbx,%r15
+  805501:	48 b8 1a 65 ff ff ff 	movabs $0xffffffffffff651a,%rax
+  805508:	ff ff ff 
+  80550b:	48 01 d8             	add    %rbx,%rax
+  80550e:	ff d0                	call   *%rax
+		string_store += strlen(argv[i]) + 1;
+  805510:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805513:	48 98                	cltq
+  805515:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80551c:	00 
+  80551d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805521:	48 01 d0             	add    %rdx,%rax
+  805524:	48 8b 00             	mov    (%rax),%rax
+  805527:	48 89 c7             	mov    %rax,%rdi
+  80552a:	49 89 df             	mov    %rbx,%r15
+  80552d:	48 b8 86 64 ff ff ff 	movabs $0xffffffffffff6486,%rax
+  805534:	ff ff ff 
+  805537:	48 01 d8             	add    %rbx,%rax
+  80553a:	ff d0                	call   *%rax
+  80553c:	83 c0 01             	add    $0x1,%eax
+  80553f:	48 98                	cltq
+  805541:	48 01 45 d0          	add    %rax,-0x30(%rbp)
+	for (i = 0; i < argc; i++) {
+  805545:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+  805549:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80554c:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80554f:	0f 8c 5e ff ff ff    	jl     8054b3 <init_stack+0x121>
+	}
+	argv_store[argc] = 0;
+  805555:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805558:	48 98                	cltq
+  80555a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  805561:	00 
+  805562:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805566:	48 01 d0             	add    %rdx,%rax
+  805569:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  805570:	48 81 7d d0 00 10 40 	cmpq   $0x401000,-0x30(%rbp)
+  805577:	00 
+  805578:	74 50                	je     8055ca <init_stack+0x238>
+  80557a:	48 b8 98 d8 ff ff ff 	movabs $0xffffffffffffd898,%rax
+  805581:	ff ff ff 
+  805584:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805588:	48 89 c1             	mov    %rax,%rcx
+  80558b:	48 b8 be d8 ff ff ff 	movabs $0xffffffffffffd8be,%rax
+  805592:	ff ff ff 
+  805595:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805599:	48 89 c2             	mov    %rax,%rdx
+  80559c:	be f1 00 00 00       	mov    $0xf1,%esi
+  8055a1:	48 b8 58 d8 ff ff ff 	movabs $0xffffffffffffd858,%rax
+  8055a8:	ff ff ff 
+  8055ab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055af:	48 89 c7             	mov    %rax,%rdi
+  8055b2:	49 89 df             	mov    %rbx,%r15
+  8055b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055ba:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  8055c1:	ff ff ff 
+  8055c4:	49 01 d8             	add    %rbx,%r8
+  8055c7:	41 ff d0             	call   *%r8
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  8055ca:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  8055cf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8055d3:	48 01 d0             	add    %rdx,%rax
+  8055d6:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  8055dd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8055e1:	48 83 e8 08          	sub    $0x8,%rax
+  8055e5:	48 89 10             	mov    %rdx,(%rax)
+	argv_store[-2] = argc;
+  8055e8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8055ec:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  8055f0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8055f3:	48 98                	cltq
+  8055f5:	48 89 02             	mov    %rax,(%rdx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8055f8:	ba f0 cf 7f ef       	mov    $0xef7fcff0,%edx
+  8055fd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805601:	48 01 d0             	add    %rdx,%rax
+  805604:	48 2d 00 00 40 00    	sub    $0x400000,%rax
+  80560a:	48 89 c2             	mov    %rax,%rdx
+  80560d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805611:	48 89 10             	mov    %rdx,(%rax)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  805614:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805617:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80561d:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  805622:	48 89 d1             	mov    %rdx,%rcx
+  805625:	89 c2                	mov    %eax,%edx
+  805627:	be 00 00 40 00       	mov    $0x400000,%esi
+  80562c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805631:	49 89 df             	mov    %rbx,%r15
+  805634:	48 b8 3b 72 ff ff ff 	movabs $0xffffffffffff723b,%rax
+  80563b:	ff ff ff 
+  80563e:	48 01 d8             	add    %rbx,%rax
+  805641:	ff d0                	call   *%rax
+  805643:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  805646:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80564a:	78 2c                	js     805678 <init_stack+0x2e6>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80564c:	be 00 00 40 00       	mov    $0x400000,%esi
+  805651:	bf 00 00 00 00       	mov    $0x0,%edi
+  805656:	49 89 df             	mov    %rbx,%r15
+  805659:	48 b8 ae 72 ff ff ff 	movabs $0xffffffffffff72ae,%rax
+  805660:	ff ff ff 
+  805663:	48 01 d8             	add    %rbx,%rax
+  805666:	ff d0                	call   *%rax
+  805668:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80566b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80566f:	78 0a                	js     80567b <init_stack+0x2e9>
+		goto error;
+
+	return 0;
+  805671:	b8 00 00 00 00       	mov    $0x0,%eax
+  805676:	eb 23                	jmp    80569b <init_stack+0x309>
+		goto error;
+  805678:	90                   	nop
+  805679:	eb 01                	jmp    80567c <init_stack+0x2ea>
+		goto error;
+  80567b:	90                   	nop
+
+error:
+	sys_page_unmap(0, UTEMP);
+  80567c:	be 00 00 40 00       	mov    $0x400000,%esi
+  805681:	bf 00 00 00 00       	mov    $0x0,%edi
+  805686:	49 89 df             	mov    %rbx,%r15
+  805689:	48 b8 ae 72 ff ff ff 	movabs $0xffffffffffff72ae,%rax
+  805690:	ff ff ff 
+  805693:	48 01 d8             	add    %rbx,%rax
+  805696:	ff d0                	call   *%rax
+	return r;
+  805698:	8b 45 dc             	mov    -0x24(%rbp),%eax
+}
+  80569b:	48 83 c4 50          	add    $0x50,%rsp
+  80569f:	5b                   	pop    %rbx
+  8056a0:	41 5f                	pop    %r15
+  8056a2:	5d                   	pop    %rbp
+  8056a3:	c3                   	ret
+
+00000000008056a4 <map_segment>:
+#define SEG_BATCH	PAGE_BATCH_CHUNK
+
+static int
+map_segment(envid_t child, uintptr_t va, size_t memsz,
+	    int fd, size_t filesz, off_t fileoffset, int perm)
+{
+  8056a4:	55                   	push   %rbp
+  8056a5:	48 89 e5             	mov    %rsp,%rbp
+  8056a8:	41 57                	push   %r15
+  8056aa:	53                   	push   %rbx
+  8056ab:	48 81 ec 70 0c 00 00 	sub    $0xc70,%rsp
+  8056b2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056b2 <map_segment+0xe>
+  8056b9:	49 bb 8e 59 00 00 00 	movabs $0x598e,%r11
+  8056c0:	00 00 00 
+  8056c3:	4c 01 db             	add    %r11,%rbx
+  8056c6:	89 bd ac f3 ff ff    	mov    %edi,-0xc54(%rbp)
+  8056cc:	48 89 b5 a0 f3 ff ff 	mov    %rsi,-0xc60(%rbp)
+  8056d3:	48 89 95 98 f3 ff ff 	mov    %rdx,-0xc68(%rbp)
+  8056da:	89 8d a8 f3 ff ff    	mov    %ecx,-0xc58(%rbp)
+  8056e0:	4c 89 85 90 f3 ff ff 	mov    %r8,-0xc70(%rbp)
+  8056e7:	44 89 8d 8c f3 ff ff 	mov    %r9d,-0xc74(%rbp)
+	int i, j, n, nfile, r;
+	void *tmp;
+
+	//cprintf("map_segment %x+%x\n", va, memsz);
+
+	if ((i = PGOFF(va))) {
+  8056ee:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  8056f5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8056fa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805701:	74 2d                	je     805730 <map_segment+0x8c>
+		va -= i;
+  805703:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805706:	48 98                	cltq
+  805708:	48 29 85 a0 f3 ff ff 	sub    %rax,-0xc60(%rbp)
+		memsz += i;
+  80570f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805712:	48 98                	cltq
+  805714:	48 01 85 98 f3 ff ff 	add    %rax,-0xc68(%rbp)
+		filesz += i;
+  80571b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80571e:	48 98                	cltq
+  805720:	48 01 85 90 f3 ff ff 	add    %rax,-0xc70(%rbp)
+		fileoffset -= i;
+  805727:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80572a:	29 85 8c f3 ff ff    	sub    %eax,-0xc74(%rbp)
+	}
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  805730:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805737:	e9 db 03 00 00       	jmp    805b17 <map_segment+0x473>
+		n = MIN((memsz - i + PGSIZE - 1) / PGSIZE, SEG_BATCH);
+  80573c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80573f:	48 98                	cltq
+  805741:	48 8b 95 98 f3 ff ff 	mov    -0xc68(%rbp),%rdx
+  805748:	48 29 c2             	sub    %rax,%rdx
+  80574b:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  805752:	48 c1 e8 0c          	shr    $0xc,%rax
+  805756:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80575a:	c7 45 d4 20 00 00 00 	movl   $0x20,-0x2c(%rbp)
+  805761:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805764:	48 63 d0             	movslq %eax,%rdx
+  805767:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80576b:	48 39 c2             	cmp    %rax,%rdx
+  80576e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805772:	89 45 d0             	mov    %eax,-0x30(%rbp)
+
+		// Allocate blank pages straight into the child, and pages
+		// for the file's contents at UTEMP in our address space.
+		nfile = 0;
+  805775:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+		for (j = 0; j < n; j++) {
+  80577c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  805783:	e9 ea 01 00 00       	jmp    805972 <map_segment+0x2ce>
+			if (i + j * PGSIZE < filesz) {
+  805788:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80578b:	c1 e0 0c             	shl    $0xc,%eax
+  80578e:	89 c2                	mov    %eax,%edx
+  805790:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805793:	01 d0                	add    %edx,%eax
+  805795:	48 98                	cltq
+  805797:	48 3b 85 90 f3 ff ff 	cmp    -0xc70(%rbp),%rax
+  80579e:	0f 83 57 01 00 00    	jae    8058fb <map_segment+0x257>
+				tmp = UTEMP + nfile * PGSIZE;
+  8057a4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8057a7:	c1 e0 0c             	shl    $0xc,%eax
+  8057aa:	48 98                	cltq
+  8057ac:	48 05 00 00 40 00    	add    $0x400000,%rax
+  8057b2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+				alloc[j].dstenvid = 0;
+  8057b6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8057b9:	48 98                	cltq
+  8057bb:	48 c1 e0 05          	shl    $0x5,%rax
+  8057bf:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8057c3:	48 01 e8             	add    %rbp,%rax
+  8057c6:	48 2d 3c 04 00 00    	sub    $0x43c,%rax
+  8057cc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				alloc[j].dstva = (uintptr_t) tmp;
+  8057d2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8057d6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8057d9:	48 63 d2             	movslq %edx,%rdx
+  8057dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8057e0:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  8057e4:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  8057e8:	48 81 ea 30 04 00 00 	sub    $0x430,%rdx
+  8057ef:	48 89 02             	mov    %rax,(%rdx)
+				alloc[j].perm = PTE_P|PTE_U|PTE_W;
+  8057f2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8057f5:	48 98                	cltq
+  8057f7:	48 c1 e0 05          	shl    $0x5,%rax
+  8057fb:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8057ff:	48 01 e8             	add    %rbp,%rax
+  805802:	48 2d 28 04 00 00    	sub    $0x428,%rax
+  805808:	c7 00 07 00 00 00    	movl   $0x7,(%rax)
+				map[nfile].srcenvid = 0;
+  80580e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805811:	48 98                	cltq
+  805813:	48 c1 e0 05          	shl    $0x5,%rax
+  805817:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80581b:	48 01 e8             	add    %rbp,%rax
+  80581e:	48 2d 40 08 00 00    	sub    $0x840,%rax
+  805824:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				map[nfile].srcva = (uintptr_t) tmp;
+  80582a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80582e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805831:	48 63 d2             	movslq %edx,%rdx
+  805834:	48 c1 e2 05          	shl    $0x5,%rdx
+  805838:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  80583c:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  805840:	48 81 ea 38 08 00 00 	sub    $0x838,%rdx
+  805847:	48 89 02             	mov    %rax,(%rdx)
+				map[nfile].dstenvid = child;
+  80584a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80584d:	48 98                	cltq
+  80584f:	48 c1 e0 05          	shl    $0x5,%rax
+  805853:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805857:	48 01 e8             	add    %rbp,%rax
+  80585a:	48 8d 90 c4 f7 ff ff 	lea    -0x83c(%rax),%rdx
+  805861:	8b 85 ac f3 ff ff    	mov    -0xc54(%rbp),%eax
+  805867:	89 02                	mov    %eax,(%rdx)
+				map[nfile].dstva = va + i + j * PGSIZE;
+  805869:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80586c:	48 63 d0             	movslq %eax,%rdx
+  80586f:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  805876:	48 01 c2             	add    %rax,%rdx
+  805879:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80587c:	c1 e0 0c             	shl    $0xc,%eax
+  80587f:	48 98                	cltq
+  805881:	48 01 c2             	add    %rax,%rdx
+  805884:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805887:	48 98                	cltq
+  805889:	48 c1 e0 05          	shl    $0x5,%rax
+  80588d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805891:	48 01 e8             	add    %rbp,%rax
+  805894:	48 2d 30 08 00 00    	sub    $0x830,%rax
+  80589a:	48 89 10             	mov    %rdx,(%rax)
+				map[nfile].perm = perm;
+  80589d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8058a0:	48 98                	cltq
+  8058a2:	48 c1 e0 05          	shl    $0x5,%rax
+  8058a6:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8058aa:	48 01 e8             	add    %rbp,%rax
+  8058ad:	48 8d 90 d8 f7 ff ff 	lea    -0x828(%rax),%rdx
+  8058b4:	8b 45 10             	mov    0x10(%rbp),%eax
+  8058b7:	89 02                	mov    %eax,(%rdx)
+				unmap[nfile].dstenvid = 0;
+  8058b9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8058bc:	48 98                	cltq
+  8058be:	48 c1 e0 05          	shl    $0x5,%rax
+  8058c2:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8058c6:	48 01 e8             	add    %rbp,%rax
+  8058c9:	48 2d 3c 0c 00 00    	sub    $0xc3c,%rax
+  8058cf:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				unmap[nfile].dstva = (uintptr_t) tmp;
+  8058d5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8058d9:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8058dc:	48 63 d2             	movslq %edx,%rdx
+  8058df:	48 c1 e2 05          	shl    $0x5,%rdx
+  8058e3:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  8058e7:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  8058eb:	48 81 ea 30 0c 00 00 	sub    $0xc30,%rdx
+  8058f2:	48 89 02             	mov    %rax,(%rdx)
+				nfile++;
+  8058f5:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  8058f9:	eb 73                	jmp    80596e <map_segment+0x2ca>
+			} else {
+				// Blank (BSS) pages are only allocated
+				// once the child writes to them.
+				alloc[j].dstenvid = child;
+  8058fb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8058fe:	48 98                	cltq
+  805900:	48 c1 e0 05          	shl    $0x5,%rax
+  805904:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805908:	48 01 e8             	add    %rbp,%rax
+  80590b:	48 8d 90 c4 fb ff ff 	lea    -0x43c(%rax),%rdx
+  805912:	8b 85 ac f3 ff ff    	mov    -0xc54(%rbp),%eax
+  805918:	89 02                	mov    %eax,(%rdx)
+				alloc[j].dstva = va + i + j * PGSIZE;
+  80591a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80591d:	48 63 d0             	movslq %eax,%rdx
+  805920:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  805927:	48 01 c2             	add    %rax,%rdx
+  80592a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80592d:	c1 e0 0c             	shl    $0xc,%eax
+  805930:	48 98                	cltq
+  805932:	48 01 c2             	add    %rax,%rdx
+  805935:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805938:	48 98                	cltq
+  80593a:	48 c1 e0 05          	shl    $0x5,%rax
+  80593e:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805942:	48 01 e8             	add    %rbp,%rax
+  805945:	48 2d 30 04 00 00    	sub    $0x430,%rax
+  80594b:	48 89 10             	mov    %rdx,(%rax)
+				alloc[j].perm = perm | PTE_LAZY;
+  80594e:	8b 45 10             	mov    0x10(%rbp),%eax
+  805951:	80 cc 10             	or     $0x10,%ah
+  805954:	89 c2                	mov    %eax,%edx
+  805956:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805959:	48 98                	cltq
+  80595b:	48 c1 e0 05          	shl    $0x5,%rax
+  80595f:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805963:	48 01 e8             	add    %rbp,%rax
+  805966:	48 2d 28 04 00 00    	sub    $0x428,%rax
+  80596c:	89 10                	mov    %edx,(%rax)
+		for (j = 0; j < n; j++) {
+  80596e:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  805972:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805975:	3b 45 d0             	cmp    -0x30(%rbp),%eax
+  805978:	0f 8c 0a fe ff ff    	jl     805788 <map_segment+0xe4>
+			}
+		}
+		if ((r = sys_page_alloc_batch(alloc, n)) < 0)
+  80597e:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  805981:	48 63 d0             	movslq %eax,%rdx
+  805984:	48 8d 85 b0 fb ff ff 	lea    -0x450(%rbp),%rax
+  80598b:	48 89 d6             	mov    %rdx,%rsi
+  80598e:	48 89 c7             	mov    %rax,%rdi
+  805991:	49 89 df             	mov    %rbx,%r15
+  805994:	48 b8 6f 78 ff ff ff 	movabs $0xffffffffffff786f,%rax
+  80599b:	ff ff ff 
+  80599e:	48 01 d8             	add    %rbx,%rax
+  8059a1:	ff d0                	call   *%rax
+  8059a3:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  8059a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8059aa:	0f 88 80 01 00 00    	js     805b30 <map_segment+0x48c>
+			goto out;
+
+		// from file
+		for (j = 0; j < nfile; j++) {
+  8059b0:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  8059b7:	e9 af 00 00 00       	jmp    805a6b <map_segment+0x3c7>
+			if ((r = seek(fd, fileoffset + i + j * PGSIZE)) < 0)
+  8059bc:	8b 95 8c f3 ff ff    	mov    -0xc74(%rbp),%edx
+  8059c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059c5:	01 c2                	add    %eax,%edx
+  8059c7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8059ca:	c1 e0 0c             	shl    $0xc,%eax
+  8059cd:	01 c2                	add    %eax,%edx
+  8059cf:	8b 85 a8 f3 ff ff    	mov    -0xc58(%rbp),%eax
+  8059d5:	89 d6                	mov    %edx,%esi
+  8059d7:	89 c7                	mov    %eax,%edi
+  8059d9:	49 89 df             	mov    %rbx,%r15
+  8059dc:	48 b8 3a 8e ff ff ff 	movabs $0xffffffffffff8e3a,%rax
+  8059e3:	ff ff ff 
+  8059e6:	48 01 d8             	add    %rbx,%rax
+  8059e9:	ff d0                	call   *%rax
+  8059eb:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  8059ee:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8059f2:	0f 88 3b 01 00 00    	js     805b33 <map_segment+0x48f>
+				goto out;
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+				       MIN(PGSIZE, filesz - i - j * PGSIZE))) < 0)
+  8059f8:	c7 45 cc 00 10 00 00 	movl   $0x1000,-0x34(%rbp)
+  8059ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a02:	48 98                	cltq
+  805a04:	48 8b 95 90 f3 ff ff 	mov    -0xc70(%rbp),%rdx
+  805a0b:	48 29 c2             	sub    %rax,%rdx
+  805a0e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805a11:	c1 e0 0c             	shl    $0xc,%eax
+  805a14:	48 98                	cltq
+  805a16:	48 29 c2             	sub    %rax,%rdx
+  805a19:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805a1d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805a20:	48 63 d0             	movslq %eax,%rdx
+  805a23:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805a27:	48 39 c2             	cmp    %rax,%rdx
+  805a2a:	48 0f 47 d0          	cmova  %rax,%rdx
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+  805a2e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805a31:	c1 e0 0c             	shl    $0xc,%eax
+  805a34:	48 98                	cltq
+  805a36:	48 8d 88 00 00 40 00 	lea    0x400000(%rax),%rcx
+  805a3d:	8b 85 a8 f3 ff ff    	mov    -0xc58(%rbp),%eax
+  805a43:	48 89 ce             	mov    %rcx,%rsi
+  805a46:	89 c7                	mov    %eax,%edi
+  805a48:	49 89 df             	mov    %rbx,%r15
+  805a4b:	48 b8 95 8c ff ff ff 	movabs $0xffffffffffff8c95,%rax
+  805a52:	ff ff ff 
+  805a55:	48 01 d8             	add    %rbx,%rax
+  805a58:	ff d0                	call   *%rax
+  805a5a:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  805a5d:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  805a61:	0f 88 cf 00 00 00    	js     805b36 <map_segment+0x492>
+		for (j = 0; j < nfile; j++) {
+  805a67:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  805a6b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805a6e:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  805a71:	0f 8c 45 ff ff ff    	jl     8059bc <map_segment+0x318>
+				goto out;
+		}
+		if ((r = sys_page_map_batch(map, nfile)) < 0)
+  805a77:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805a7a:	48 63 d0             	movslq %eax,%rdx
+  805a7d:	48 8d 85 b0 f7 ff ff 	lea    -0x850(%rbp),%rax
+  805a84:	48 89 d6             	mov    %rdx,%rsi
+  805a87:	48 89 c7             	mov    %rax,%rdi
+  805a8a:	49 89 df             	mov    %rbx,%r15
+  805a8d:	48 b8 11 78 ff ff ff 	movabs $0xffffffffffff7811,%rax
+  805a94:	ff ff ff 
+  805a97:	48 01 d8             	add    %rbx,%rax
+  805a9a:	ff d0                	call   *%rax
+  805a9c:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  805a9f:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  805aa3:	79 44                	jns    805ae9 <map_segment+0x445>
+			panic("spawn: sys_page_map_batch data: %e", r);
+  805aa5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805aa8:	89 c1                	mov    %eax,%ecx
+  805aaa:	48 b8 d8 d8 ff ff ff 	movabs $0xffffffffffffd8d8,%rax
+  805ab1:	ff ff ff 
+  805ab4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ab8:	48 89 c2             	mov    %rax,%rdx
+  805abb:	be 43 01 00 00       	mov    $0x143,%esi
+  805ac0:	48 b8 58 d8 ff ff ff 	movabs $0xffffffffffffd858,%rax
+  805ac7:	ff ff ff 
+  805aca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ace:	48 89 c7             	mov    %rax,%rdi
+  805ad1:	49 89 df             	mov    %rbx,%r15
+  805ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ad9:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  805ae0:	ff ff ff 
+  805ae3:	49 01 d8             	add    %rbx,%r8
+  805ae6:	41 ff d0             	call   *%r8
+		sys_page_unmap_batch(unmap, nfile);
+  805ae9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805aec:	48 63 d0             	movslq %eax,%rdx
+  805aef:	48 8d 85 b0 f3 ff ff 	lea    -0xc50(%rbp),%rax
+  805af6:	48 89 d6             	mov    %rdx,%rsi
+  805af9:	48 89 c7             	mov    %rax,%rdi
+  805afc:	49 89 df             	mov    %rbx,%r15
+  805aff:	48 b8 cd 78 ff ff ff 	movabs $0xffffffffffff78cd,%rax
+  805b06:	ff ff ff 
+  805b09:	48 01 d8             	add    %rbx,%rax
+  805b0c:	ff d0                	call   *%rax
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  805b0e:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  805b11:	c1 e0 0c             	shl    $0xc,%eax
+  805b14:	01 45 ec             	add    %eax,-0x14(%rbp)
+  805b17:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b1a:	48 98                	cltq
+  805b1c:	48 3b 85 98 f3 ff ff 	cmp    -0xc68(%rbp),%rax
+  805b23:	0f 82 13 fc ff ff    	jb     80573c <map_segment+0x98>
+	}
+	return 0;
+  805b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b2e:	eb 2f                	jmp    805b5f <map_segment+0x4bb>
+			goto out;
+  805b30:	90                   	nop
+  805b31:	eb 04                	jmp    805b37 <map_segment+0x493>
+				goto out;
+  805b33:	90                   	nop
+  805b34:	eb 01                	jmp    805b37 <map_segment+0x493>
+				goto out;
+  805b36:	90                   	nop
+
+out:
+	sys_page_unmap_batch(unmap, nfile);
+  805b37:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805b3a:	48 63 d0             	movslq %eax,%rdx
+  805b3d:	48 8d 85 b0 f3 ff ff 	lea    -0xc50(%rbp),%rax
+  805b44:	48 89 d6             	mov    %rdx,%rsi
+  805b47:	48 89 c7             	mov    %rax,%rdi
+  805b4a:	49 89 df             	mov    %rbx,%r15
+  805b4d:	48 b8 cd 78 ff ff ff 	movabs $0xffffffffffff78cd,%rax
+  805b54:	ff ff ff 
+  805b57:	48 01 d8             	add    %rbx,%rax
+  805b5a:	ff d0                	call   *%rax
+	return r;
+  805b5c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  805b5f:	48 81 c4 70 0c 00 00 	add    $0xc70,%rsp
+  805b66:	5b                   	pop    %rbx
+  805b67:	41 5f                	pop    %r15
+  805b69:	5d                   	pop    %rbp
+  805b6a:	c3                   	ret
+
+0000000000805b6b <copy_shared_pages>:
+
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  805b6b:	55                   	push   %rbp
+  805b6c:	48 89 e5             	mov    %rsp,%rbp
+  805b6f:	41 57                	push   %r15
+  805b71:	53                   	push   %rbx
+  805b72:	48 83 ec 30          	sub    $0x30,%rsp
+  805b76:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b76 <copy_shared_pages+0xb>
+  805b7d:	49 bb ca 54 00 00 00 	movabs $0x54ca,%r11
+  805b84:	00 00 00 
+  805b87:	4c 01 db             	add    %r11,%rbx
+  805b8a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	int r;
+	uint64_t addr = 0;
+  805b8d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805b94:	00 
+	for (; addr < USTACKTOP;){
+  805b95:	e9 7f 02 00 00       	jmp    805e19 <copy_shared_pages+0x2ae>
+		if (uvpde[VPDPE(addr)] & PTE_P){
+  805b9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b9e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805ba2:	48 89 c2             	mov    %rax,%rdx
+  805ba5:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805bac:	ff ff ff 
+  805baf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bb3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805bb7:	83 e0 01             	and    $0x1,%eax
+  805bba:	48 85 c0             	test   %rax,%rax
+  805bbd:	0f 84 4e 02 00 00    	je     805e11 <copy_shared_pages+0x2a6>
+			//a 2MB page is described by its PDE, not by uvpt
+			if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  805bc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bc7:	48 c1 e8 15          	shr    $0x15,%rax
+  805bcb:	48 89 c2             	mov    %rax,%rdx
+  805bce:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  805bd5:	ff ff ff 
+  805bd8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bdc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805be0:	25 81 00 00 00       	and    $0x81,%eax
+  805be5:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  805beb:	0f 85 cf 00 00 00    	jne    805cc0 <copy_shared_pages+0x155>
+				if (uvpd[VPD(addr)] & PTE_SHARE){
+  805bf1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bf5:	48 c1 e8 15          	shr    $0x15,%rax
+  805bf9:	48 89 c2             	mov    %rax,%rdx
+  805bfc:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  805c03:	ff ff ff 
+  805c06:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c0a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805c0e:	25 00 04 00 00       	and    $0x400,%eax
+  805c13:	48 85 c0             	test   %rax,%rax
+  805c16:	0f 84 97 00 00 00    	je     805cb3 <copy_shared_pages+0x148>
+					unsigned int perm = uvpd[VPD(addr)] & (PTE_SYSCALL);
+  805c1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c20:	48 c1 e8 15          	shr    $0x15,%rax
+  805c24:	48 89 c2             	mov    %rax,%rdx
+  805c27:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  805c2e:	ff ff ff 
+  805c31:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c35:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805c39:	25 07 0e 00 00       	and    $0xe07,%eax
+  805c3e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+  805c41:	8b 75 dc             	mov    -0x24(%rbp),%esi
+  805c44:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805c48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c4c:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  805c4f:	41 89 f0             	mov    %esi,%r8d
+  805c52:	48 89 c6             	mov    %rax,%rsi
+  805c55:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c5a:	49 89 df             	mov    %rbx,%r15
+  805c5d:	48 b8 3b 72 ff ff ff 	movabs $0xffffffffffff723b,%rax
+  805c64:	ff ff ff 
+  805c67:	48 01 d8             	add    %rbx,%rax
+  805c6a:	ff d0                	call   *%rax
+  805c6c:	89 45 e0             	mov    %eax,-0x20(%rbp)
+					if (r < 0)
+  805c6f:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  805c73:	79 3e                	jns    805cb3 <copy_shared_pages+0x148>
+						panic("sys_page_map in copy_shared_pages failed\n");
+  805c75:	48 b8 00 d9 ff ff ff 	movabs $0xffffffffffffd900,%rax
+  805c7c:	ff ff ff 
+  805c7f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c83:	48 89 c2             	mov    %rax,%rdx
+  805c86:	be 5b 01 00 00       	mov    $0x15b,%esi
+  805c8b:	48 b8 58 d8 ff ff ff 	movabs $0xffffffffffffd858,%rax
+  805c92:	ff ff ff 
+  805c95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c99:	48 89 c7             	mov    %rax,%rdi
+  805c9c:	49 89 df             	mov    %rbx,%r15
+  805c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ca4:	48 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%rcx
+  805cab:	ff ff ff 
+  805cae:	48 01 d9             	add    %rbx,%rcx
+  805cb1:	ff d1                	call   *%rcx
+				}
+				addr += PTSIZE;
+  805cb3:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  805cba:	00 
+  805cbb:	e9 59 01 00 00       	jmp    805e19 <copy_shared_pages+0x2ae>
+			}
+			else if (uvpd[VPD(addr)] & PTE_P){
+  805cc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cc4:	48 c1 e8 15          	shr    $0x15,%rax
+  805cc8:	48 89 c2             	mov    %rax,%rdx
+  805ccb:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  805cd2:	ff ff ff 
+  805cd5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805cd9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805cdd:	83 e0 01             	and    $0x1,%eax
+  805ce0:	48 85 c0             	test   %rax,%rax
+  805ce3:	0f 84 1e 01 00 00    	je     805e07 <copy_shared_pages+0x29c>
+				if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_SHARE && uvpt[VPN(addr)] & PTE_U){
+  805ce9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ced:	48 c1 e8 0c          	shr    $0xc,%rax
+  805cf1:	48 89 c2             	mov    %rax,%rdx
+  805cf4:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805cfb:	ff ff ff 
+  805cfe:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d02:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d06:	83 e0 01             	and    $0x1,%eax
+  805d09:	48 85 c0             	test   %rax,%rax
+  805d0c:	0f 84 eb 00 00 00    	je     805dfd <copy_shared_pages+0x292>
+  805d12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d16:	48 c1 e8 0c          	shr    $0xc,%rax
+  805d1a:	48 89 c2             	mov    %rax,%rdx
+  805d1d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805d24:	ff ff ff 
+  805d27:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d2b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d2f:	25 00 04 00 00       	and    $0x400,%eax
+  805d34:	48 85 c0             	test   %rax,%rax
+  805d37:	0f 84 c0 00 00 00    	je     805dfd <copy_shared_pages+0x292>
+  805d3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d41:	48 c1 e8 0c          	shr    $0xc,%rax
+  805d45:	48 89 c2             	mov    %rax,%rdx
+  805d48:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805d4f:	ff ff ff 
+  805d52:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d56:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d5a:	83 e0 04             	and    $0x4,%eax
+  805d5d:	48 85 c0             	test   %rax,%rax
+  805d60:	0f 84 97 00 00 00    	je     805dfd <copy_shared_pages+0x292>
+					unsigned int perm = uvpt[VPN(addr)] & (PTE_SYSCALL);
+  805d66:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d6a:	48 c1 e8 0c          	shr    $0xc,%rax
+  805d6e:	48 89 c2             	mov    %rax,%rdx
+  805d71:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805d78:	ff ff ff 
+  805d7b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d7f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d83:	25 07 0e 00 00       	and    $0xe07,%eax
+  805d88:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+  805d8b:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  805d8e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805d92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d96:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  805d99:	41 89 f0             	mov    %esi,%r8d
+  805d9c:	48 89 c6             	mov    %rax,%rsi
+  805d9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805da4:	49 89 df             	mov    %rbx,%r15
+  805da7:	48 b8 3b 72 ff ff ff 	movabs $0xffffffffffff723b,%rax
+  805dae:	ff ff ff 
+  805db1:	48 01 d8             	add    %rbx,%rax
+  805db4:	ff d0                	call   *%rax
+  805db6:	89 45 e0             	mov    %eax,-0x20(%rbp)
+					if (r < 0)
+  805db9:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  805dbd:	79 3e                	jns    805dfd <copy_shared_pages+0x292>
+						panic("sys_page_map in copy_shared_pages failed\n");
+  805dbf:	48 b8 00 d9 ff ff ff 	movabs $0xffffffffffffd900,%rax
+  805dc6:	ff ff ff 
+  805dc9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805dcd:	48 89 c2             	mov    %rax,%rdx
+  805dd0:	be 64 01 00 00       	mov    $0x164,%esi
+  805dd5:	48 b8 58 d8 ff ff ff 	movabs $0xffffffffffffd858,%rax
+  805ddc:	ff ff ff 
+  805ddf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805de3:	48 89 c7             	mov    %rax,%rdi
+  805de6:	49 89 df             	mov    %rbx,%r15
+  805de9:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dee:	48 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%rcx
+  805df5:	ff ff ff 
+  805df8:	48 01 d9             	add    %rbx,%rcx
+  805dfb:	ff d1                	call   *%rcx
+				}
+				addr += PGSIZE;
+  805dfd:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  805e04:	00 
+  805e05:	eb 12                	jmp    805e19 <copy_shared_pages+0x2ae>
+			}
+			//we will discover a PDE not present is at 
+			//a multiple of PTSIZE;
+			else {
+				addr += PTSIZE;
+  805e07:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  805e0e:	00 
+  805e0f:	eb 08                	jmp    805e19 <copy_shared_pages+0x2ae>
+			}
+		}
+		//we will discover a PDPE not present is at
+		//a multiple of PTSIZE * NPDENTRIES;    
+		else {
+			addr += PTSIZE * NPDENTRIES;
+  805e11:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  805e18:	40 
+	for (; addr < USTACKTOP;){
+  805e19:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  805e1e:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  805e22:	0f 83 72 fd ff ff    	jae    805b9a <copy_shared_pages+0x2f>
+        	}
+        }
+
+	return 0;
+  805e28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e2d:	48 83 c4 30          	add    $0x30,%rsp
+  805e31:	5b                   	pop    %rbx
+  805e32:	41 5f                	pop    %r15
+  805e34:	5d                   	pop    %rbp
+  805e35:	c3                   	ret
+
+0000000000805e36 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  805e36:	55                   	push   %rbp
+  805e37:	48 89 e5             	mov    %rsp,%rbp
+  805e3a:	41 57                	push   %r15
+  805e3c:	53                   	push   %rbx
+  805e3d:	48 83 ec 20          	sub    $0x20,%rsp
+  805e41:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e41 <fd2sockid+0xb>
+  805e48:	49 bb ff 51 00 00 00 	movabs $0x51ff,%r11
+  805e4f:	00 00 00 
+  805e52:	4c 01 db             	add    %r11,%rbx
+  805e55:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  805e58:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805e5c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805e5f:	48 89 d6             	mov    %rdx,%rsi
+  805e62:	89 c7                	mov    %eax,%edi
+  805e64:	49 89 df             	mov    %rbx,%r15
+  805e67:	48 b8 3b 86 ff ff ff 	movabs $0xffffffffffff863b,%rax
+  805e6e:	ff ff ff 
+  805e71:	48 01 d8             	add    %rbx,%rax
+  805e74:	ff d0                	call   *%rax
+  805e76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e79:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e7d:	79 05                	jns    805e84 <fd2sockid+0x4e>
+		return r;
+  805e7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e82:	eb 25                	jmp    805ea9 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  805e84:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e88:	8b 10                	mov    (%rax),%edx
+  805e8a:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  805e91:	00 00 00 
+  805e94:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805e97:	39 c2                	cmp    %eax,%edx
+  805e99:	74 07                	je     805ea2 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  805e9b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  805ea0:	eb 07                	jmp    805ea9 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  805ea2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ea6:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  805ea9:	48 83 c4 20          	add    $0x20,%rsp
+  805ead:	5b                   	pop    %rbx
+  805eae:	41 5f                	pop    %r15
+  805eb0:	5d                   	pop    %rbp
+  805eb1:	c3                   	ret
+
+0000000000805eb2 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  805eb2:	55                   	push   %rbp
+  805eb3:	48 89 e5             	mov    %rsp,%rbp
+  805eb6:	41 57                	push   %r15
+  805eb8:	53                   	push   %rbx
+  805eb9:	48 83 ec 20          	sub    $0x20,%rsp
+  805ebd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ebd <alloc_sockfd+0xb>
+  805ec4:	49 bb 83 51 00 00 00 	movabs $0x5183,%r11
+  805ecb:	00 00 00 
+  805ece:	4c 01 db             	add    %r11,%rbx
+  805ed1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  805ed4:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805ed8:	48 89 c7             	mov    %rax,%rdi
+  805edb:	49 89 df             	mov    %rbx,%r15
+  805ede:	48 b8 85 85 ff ff ff 	movabs $0xffffffffffff8585,%rax
+  805ee5:	ff ff ff 
+  805ee8:	48 01 d8             	add    %rbx,%rax
+  805eeb:	ff d0                	call   *%rax
+  805eed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ef0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ef4:	78 2c                	js     805f22 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  805ef6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805efa:	ba 07 04 00 00       	mov    $0x407,%edx
+  805eff:	48 89 c6             	mov    %rax,%rsi
+  805f02:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f07:	49 89 df             	mov    %rbx,%r15
+  805f0a:	48 b8 d6 71 ff ff ff 	movabs $0xffffffffffff71d6,%rax
+  805f11:	ff ff ff 
+  805f14:	48 01 d8             	add    %rbx,%rax
+  805f17:	ff d0                	call   *%rax
+  805f19:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f1c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f20:	79 1c                	jns    805f3e <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  805f22:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805f25:	89 c7                	mov    %eax,%edi
+  805f27:	49 89 df             	mov    %rbx,%r15
+  805f2a:	48 b8 66 b6 ff ff ff 	movabs $0xffffffffffffb666,%rax
+  805f31:	ff ff ff 
+  805f34:	48 01 d8             	add    %rbx,%rax
+  805f37:	ff d0                	call   *%rax
+		return r;
+  805f39:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f3c:	eb 41                	jmp    805f7f <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  805f3e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f42:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  805f49:	00 00 00 
+  805f4c:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805f4f:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  805f51:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f55:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  805f5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f60:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805f63:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  805f66:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f6a:	48 89 c7             	mov    %rax,%rdi
+  805f6d:	49 89 df             	mov    %rbx,%r15
+  805f70:	48 b8 0b 85 ff ff ff 	movabs $0xffffffffffff850b,%rax
+  805f77:	ff ff ff 
+  805f7a:	48 01 d8             	add    %rbx,%rax
+  805f7d:	ff d0                	call   *%rax
+}
+  805f7f:	48 83 c4 20          	add    $0x20,%rsp
+  805f83:	5b                   	pop    %rbx
+  805f84:	41 5f                	pop    %r15
+  805f86:	5d                   	pop    %rbp
+  805f87:	c3                   	ret
+
+0000000000805f88 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805f88:	55                   	push   %rbp
+  805f89:	48 89 e5             	mov    %rsp,%rbp
+  805f8c:	41 57                	push   %r15
+  805f8e:	53                   	push   %rbx
+  805f8f:	48 83 ec 30          	sub    $0x30,%rsp
+  805f93:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f93 <accept+0xb>
+  805f9a:	49 bb ad 50 00 00 00 	movabs $0x50ad,%r11
+  805fa1:	00 00 00 
+  805fa4:	4c 01 db             	add    %r11,%rbx
+  805fa7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805faa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805fae:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805fb2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805fb5:	89 c7                	mov    %eax,%edi
+  805fb7:	48 b8 f6 ad ff ff ff 	movabs $0xffffffffffffadf6,%rax
+  805fbe:	ff ff ff 
+  805fc1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805fc5:	ff d0                	call   *%rax
+  805fc7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805fca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805fce:	79 05                	jns    805fd5 <accept+0x4d>
+		return r;
+  805fd0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805fd3:	eb 45                	jmp    80601a <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  805fd5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805fd9:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805fdd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805fe0:	48 89 ce             	mov    %rcx,%rsi
+  805fe3:	89 c7                	mov    %eax,%edi
+  805fe5:	49 89 df             	mov    %rbx,%r15
+  805fe8:	48 b8 d4 b4 ff ff ff 	movabs $0xffffffffffffb4d4,%rax
+  805fef:	ff ff ff 
+  805ff2:	48 01 d8             	add    %rbx,%rax
+  805ff5:	ff d0                	call   *%rax
+  805ff7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ffa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ffe:	79 05                	jns    806005 <accept+0x7d>
+		return r;
+  806000:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806003:	eb 15                	jmp    80601a <accept+0x92>
+	return alloc_sockfd(r);
+  806005:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806008:	89 c7                	mov    %eax,%edi
+  80600a:	48 b8 72 ae ff ff ff 	movabs $0xffffffffffffae72,%rax
+  806011:	ff ff ff 
+  806014:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806018:	ff d0                	call   *%rax
+}
+  80601a:	48 83 c4 30          	add    $0x30,%rsp
+  80601e:	5b                   	pop    %rbx
+  80601f:	41 5f                	pop    %r15
+  806021:	5d                   	pop    %rbp
+  806022:	c3                   	ret
+
+0000000000806023 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  806023:	55                   	push   %rbp
+  806024:	48 89 e5             	mov    %rsp,%rbp
+  806027:	41 57                	push   %r15
+  806029:	53                   	push   %rbx
+  80602a:	48 83 ec 20          	sub    $0x20,%rsp
+  80602e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80602e <bind+0xb>
+  806035:	49 bb 12 50 00 00 00 	movabs $0x5012,%r11
+  80603c:	00 00 00 
+  80603f:	4c 01 db             	add    %r11,%rbx
+  806042:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806045:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806049:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80604c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80604f:	89 c7                	mov    %eax,%edi
+  806051:	48 b8 f6 ad ff ff ff 	movabs $0xffffffffffffadf6,%rax
+  806058:	ff ff ff 
+  80605b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80605f:	ff d0                	call   *%rax
+  806061:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806064:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806068:	79 05                	jns    80606f <bind+0x4c>
+		return r;
+  80606a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80606d:	eb 21                	jmp    806090 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  80606f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  806072:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  806076:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806079:	48 89 ce             	mov    %rcx,%rsi
+  80607c:	89 c7                	mov    %eax,%edi
+  80607e:	49 89 df             	mov    %rbx,%r15
+  806081:	48 b8 80 b5 ff ff ff 	movabs $0xffffffffffffb580,%rax
+  806088:	ff ff ff 
+  80608b:	48 01 d8             	add    %rbx,%rax
+  80608e:	ff d0                	call   *%rax
+}
+  806090:	48 83 c4 20          	add    $0x20,%rsp
+  806094:	5b                   	pop    %rbx
+  806095:	41 5f                	pop    %r15
+  806097:	5d                   	pop    %rbp
+  806098:	c3                   	ret
+
+0000000000806099 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  806099:	55                   	push   %rbp
+  80609a:	48 89 e5             	mov    %rsp,%rbp
+  80609d:	41 57                	push   %r15
+  80609f:	53                   	push   %rbx
+  8060a0:	48 83 ec 20          	sub    $0x20,%rsp
+  8060a4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060a4 <shutdown+0xb>
+  8060ab:	49 bb 9c 4f 00 00 00 	movabs $0x4f9c,%r11
+  8060b2:	00 00 00 
+  8060b5:	4c 01 db             	add    %r11,%rbx
+  8060b8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8060bb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8060be:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8060c1:	89 c7                	mov    %eax,%edi
+  8060c3:	48 b8 f6 ad ff ff ff 	movabs $0xffffffffffffadf6,%rax
+  8060ca:	ff ff ff 
+  8060cd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8060d1:	ff d0                	call   *%rax
+  8060d3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8060d6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8060da:	79 05                	jns    8060e1 <shutdown+0x48>
+		return r;
+  8060dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8060df:	eb 1c                	jmp    8060fd <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8060e1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8060e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8060e7:	89 d6                	mov    %edx,%esi
+  8060e9:	89 c7                	mov    %eax,%edi
+  8060eb:	49 89 df             	mov    %rbx,%r15
+  8060ee:	48 b8 15 b6 ff ff ff 	movabs $0xffffffffffffb615,%rax
+  8060f5:	ff ff ff 
+  8060f8:	48 01 d8             	add    %rbx,%rax
+  8060fb:	ff d0                	call   *%rax
+}
+  8060fd:	48 83 c4 20          	add    $0x20,%rsp
+  806101:	5b                   	pop    %rbx
+  806102:	41 5f                	pop    %r15
+  806104:	5d                   	pop    %rbp
+  806105:	c3                   	ret
+
+0000000000806106 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  806106:	55                   	push   %rbp
+  806107:	48 89 e5             	mov    %rsp,%rbp
+  80610a:	41 57                	push   %r15
+  80610c:	53                   	push   %rbx
+  80610d:	48 83 ec 10          	sub    $0x10,%rsp
+  806111:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806111 <devsock_close+0xb>
+  806118:	49 bb 2f 4f 00 00 00 	movabs $0x4f2f,%r11
+  80611f:	00 00 00 
+  806122:	4c 01 db             	add    %r11,%rbx
+  806125:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  806129:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80612d:	48 89 c7             	mov    %rax,%rdi
+  806130:	49 89 df             	mov    %rbx,%r15
+  806133:	48 b8 6d d0 ff ff ff 	movabs $0xffffffffffffd06d,%rax
+  80613a:	ff ff ff 
+  80613d:	48 01 d8             	add    %rbx,%rax
+  806140:	ff d0                	call   *%rax
+  806142:	83 f8 01             	cmp    $0x1,%eax
+  806145:	75 1d                	jne    806164 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  806147:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80614b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80614e:	89 c7                	mov    %eax,%edi
+  806150:	49 89 df             	mov    %rbx,%r15
+  806153:	48 b8 66 b6 ff ff ff 	movabs $0xffffffffffffb666,%rax
+  80615a:	ff ff ff 
+  80615d:	48 01 d8             	add    %rbx,%rax
+  806160:	ff d0                	call   *%rax
+  806162:	eb 05                	jmp    806169 <devsock_close+0x63>
+	else
+		return 0;
+  806164:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806169:	48 83 c4 10          	add    $0x10,%rsp
+  80616d:	5b                   	pop    %rbx
+  80616e:	41 5f                	pop    %r15
+  806170:	5d                   	pop    %rbp
+  806171:	c3                   	ret
+
+0000000000806172 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  806172:	55                   	push   %rbp
+  806173:	48 89 e5             	mov    %rsp,%rbp
+  806176:	41 57                	push   %r15
+  806178:	53                   	push   %rbx
+  806179:	48 83 ec 20          	sub    $0x20,%rsp
+  80617d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80617d <connect+0xb>
+  806184:	49 bb c3 4e 00 00 00 	movabs $0x4ec3,%r11
+  80618b:	00 00 00 
+  80618e:	4c 01 db             	add    %r11,%rbx
+  806191:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806194:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806198:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80619b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80619e:	89 c7                	mov    %eax,%edi
+  8061a0:	48 b8 f6 ad ff ff ff 	movabs $0xffffffffffffadf6,%rax
+  8061a7:	ff ff ff 
+  8061aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8061ae:	ff d0                	call   *%rax
+  8061b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8061b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061b7:	79 05                	jns    8061be <connect+0x4c>
+		return r;
+  8061b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061bc:	eb 21                	jmp    8061df <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8061be:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8061c1:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8061c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061c8:	48 89 ce             	mov    %rcx,%rsi
+  8061cb:	89 c7                	mov    %eax,%edi
+  8061cd:	49 89 df             	mov    %rbx,%r15
+  8061d0:	48 b8 ae b6 ff ff ff 	movabs $0xffffffffffffb6ae,%rax
+  8061d7:	ff ff ff 
+  8061da:	48 01 d8             	add    %rbx,%rax
+  8061dd:	ff d0                	call   *%rax
+}
+  8061df:	48 83 c4 20          	add    $0x20,%rsp
+  8061e3:	5b                   	pop    %rbx
+  8061e4:	41 5f                	pop    %r15
+  8061e6:	5d                   	pop    %rbp
+  8061e7:	c3                   	ret
+
+00000000008061e8 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8061e8:	55                   	push   %rbp
+  8061e9:	48 89 e5             	mov    %rsp,%rbp
+  8061ec:	41 57                	push   %r15
+  8061ee:	53                   	push   %rbx
+  8061ef:	48 83 ec 20          	sub    $0x20,%rsp
+  8061f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061f3 <listen+0xb>
+  8061fa:	49 bb 4d 4e 00 00 00 	movabs $0x4e4d,%r11
+  806201:	00 00 00 
+  806204:	4c 01 db             	add    %r11,%rbx
+  806207:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80620a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80620d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806210:	89 c7                	mov    %eax,%edi
+  806212:	48 b8 f6 ad ff ff ff 	movabs $0xffffffffffffadf6,%rax
+  806219:	ff ff ff 
+  80621c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806220:	ff d0                	call   *%rax
+  806222:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806225:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806229:	79 05                	jns    806230 <listen+0x48>
+		return r;
+  80622b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80622e:	eb 1c                	jmp    80624c <listen+0x64>
+	return nsipc_listen(r, backlog);
+  806230:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  806233:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806236:	89 d6                	mov    %edx,%esi
+  806238:	89 c7                	mov    %eax,%edi
+  80623a:	49 89 df             	mov    %rbx,%r15
+  80623d:	48 b8 43 b7 ff ff ff 	movabs $0xffffffffffffb743,%rax
+  806244:	ff ff ff 
+  806247:	48 01 d8             	add    %rbx,%rax
+  80624a:	ff d0                	call   *%rax
+}
+  80624c:	48 83 c4 20          	add    $0x20,%rsp
+  806250:	5b                   	pop    %rbx
+  806251:	41 5f                	pop    %r15
+  806253:	5d                   	pop    %rbp
+  806254:	c3                   	ret
+
+0000000000806255 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  806255:	55                   	push   %rbp
+  806256:	48 89 e5             	mov    %rsp,%rbp
+  806259:	41 57                	push   %r15
+  80625b:	48 83 ec 28          	sub    $0x28,%rsp
+  80625f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80625f <devsock_read+0xa>
+  806266:	49 bb e1 4d 00 00 00 	movabs $0x4de1,%r11
+  80626d:	00 00 00 
+  806270:	4c 01 d8             	add    %r11,%rax
+  806273:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806277:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80627b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80627f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806283:	41 89 d0             	mov    %edx,%r8d
+  806286:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80628a:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80628d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  806291:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806296:	44 89 c2             	mov    %r8d,%edx
+  806299:	49 89 c7             	mov    %rax,%r15
+  80629c:	49 b8 94 b7 ff ff ff 	movabs $0xffffffffffffb794,%r8
+  8062a3:	ff ff ff 
+  8062a6:	49 01 c0             	add    %rax,%r8
+  8062a9:	41 ff d0             	call   *%r8
+}
+  8062ac:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8062b0:	c9                   	leave
+  8062b1:	c3                   	ret
+
+00000000008062b2 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8062b2:	55                   	push   %rbp
+  8062b3:	48 89 e5             	mov    %rsp,%rbp
+  8062b6:	41 57                	push   %r15
+  8062b8:	48 83 ec 28          	sub    $0x28,%rsp
+  8062bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8062bc <devsock_write+0xa>
+  8062c3:	49 bb 84 4d 00 00 00 	movabs $0x4d84,%r11
+  8062ca:	00 00 00 
+  8062cd:	4c 01 d8             	add    %r11,%rax
+  8062d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8062d4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8062d8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8062dc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8062e0:	41 89 d0             	mov    %edx,%r8d
+  8062e3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8062e7:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8062ea:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8062ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8062f3:	44 89 c2             	mov    %r8d,%edx
+  8062f6:	49 89 c7             	mov    %rax,%r15
+  8062f9:	49 b8 b1 b8 ff ff ff 	movabs $0xffffffffffffb8b1,%r8
+  806300:	ff ff ff 
+  806303:	49 01 c0             	add    %rax,%r8
+  806306:	41 ff d0             	call   *%r8
+}
+  806309:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80630d:	c9                   	leave
+  80630e:	c3                   	ret
+
+000000000080630f <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80630f:	55                   	push   %rbp
+  806310:	48 89 e5             	mov    %rsp,%rbp
+  806313:	41 57                	push   %r15
+  806315:	48 83 ec 18          	sub    $0x18,%rsp
+  806319:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806319 <devsock_stat+0xa>
+  806320:	49 bb 27 4d 00 00 00 	movabs $0x4d27,%r11
+  806327:	00 00 00 
+  80632a:	4c 01 d8             	add    %r11,%rax
+  80632d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806331:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  806335:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806339:	48 b9 2f d9 ff ff ff 	movabs $0xffffffffffffd92f,%rcx
+  806340:	ff ff ff 
+  806343:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806347:	48 89 ce             	mov    %rcx,%rsi
+  80634a:	48 89 d7             	mov    %rdx,%rdi
+  80634d:	49 89 c7             	mov    %rax,%r15
+  806350:	48 ba 1a 65 ff ff ff 	movabs $0xffffffffffff651a,%rdx
+  806357:	ff ff ff 
+  80635a:	48 01 c2             	add    %rax,%rdx
+  80635d:	ff d2                	call   *%rdx
+	return 0;
+  80635f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806364:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806368:	c9                   	leave
+  806369:	c3                   	ret
+
+000000000080636a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80636a:	55                   	push   %rbp
+  80636b:	48 89 e5             	mov    %rsp,%rbp
+  80636e:	41 57                	push   %r15
+  806370:	53                   	push   %rbx
+  806371:	48 83 ec 20          	sub    $0x20,%rsp
+  806375:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806375 <socket+0xb>
+  80637c:	49 bb cb 4c 00 00 00 	movabs $0x4ccb,%r11
+  806383:	00 00 00 
+  806386:	4c 01 db             	add    %r11,%rbx
+  806389:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80638c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80638f:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  806392:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  806395:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  806398:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80639b:	89 ce                	mov    %ecx,%esi
+  80639d:	89 c7                	mov    %eax,%edi
+  80639f:	49 89 df             	mov    %rbx,%r15
+  8063a2:	48 b8 88 ba ff ff ff 	movabs $0xffffffffffffba88,%rax
+  8063a9:	ff ff ff 
+  8063ac:	48 01 d8             	add    %rbx,%rax
+  8063af:	ff d0                	call   *%rax
+  8063b1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8063b4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8063b8:	79 05                	jns    8063bf <socket+0x55>
+		return r;
+  8063ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063bd:	eb 15                	jmp    8063d4 <socket+0x6a>
+	return alloc_sockfd(r);
+  8063bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063c2:	89 c7                	mov    %eax,%edi
+  8063c4:	48 b8 72 ae ff ff ff 	movabs $0xffffffffffffae72,%rax
+  8063cb:	ff ff ff 
+  8063ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8063d2:	ff d0                	call   *%rax
+}
+  8063d4:	48 83 c4 20          	add    $0x20,%rsp
+  8063d8:	5b                   	pop    %rbx
+  8063d9:	41 5f                	pop    %r15
+  8063db:	5d                   	pop    %rbp
+  8063dc:	c3                   	ret
+
+00000000008063dd <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8063dd:	55                   	push   %rbp
+  8063de:	48 89 e5             	mov    %rsp,%rbp
+  8063e1:	41 57                	push   %r15
+  8063e3:	53                   	push   %rbx
+  8063e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8063e8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8063e8 <nsipc+0xb>
+  8063ef:	49 bb 58 4c 00 00 00 	movabs $0x4c58,%r11
+  8063f6:	00 00 00 
+  8063f9:	4c 01 db             	add    %r11,%rbx
+  8063fc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8063ff:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  806406:	00 00 00 
+  806409:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80640c:	85 c0                	test   %eax,%eax
+  80640e:	75 24                	jne    806434 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  806410:	bf 02 00 00 00       	mov    $0x2,%edi
+  806415:	49 89 df             	mov    %rbx,%r15
+  806418:	48 b8 de cf ff ff ff 	movabs $0xffffffffffffcfde,%rax
+  80641f:	ff ff ff 
+  806422:	48 01 d8             	add    %rbx,%rax
+  806425:	ff d0                	call   *%rax
+  806427:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  80642e:	00 00 00 
+  806431:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  806434:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80643b:	00 00 00 
+  80643e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806441:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  806444:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80644a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  806450:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806455:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80645c:	00 00 00 
+  80645f:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806463:	89 c7                	mov    %eax,%edi
+  806465:	49 89 df             	mov    %rbx,%r15
+  806468:	48 b8 fd c9 ff ff ff 	movabs $0xffffffffffffc9fd,%rax
+  80646f:	ff ff ff 
+  806472:	48 01 d8             	add    %rbx,%rax
+  806475:	ff d0                	call   *%rax
+}
+  806477:	48 83 c4 10          	add    $0x10,%rsp
+  80647b:	5b                   	pop    %rbx
+  80647c:	41 5f                	pop    %r15
+  80647e:	5d                   	pop    %rbp
+  80647f:	c3                   	ret
+
+0000000000806480 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  806480:	55                   	push   %rbp
+  806481:	48 89 e5             	mov    %rsp,%rbp
+  806484:	41 57                	push   %r15
+  806486:	53                   	push   %rbx
+  806487:	48 83 ec 20          	sub    $0x20,%rsp
+  80648b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80648b <nsipc_words+0xb>
+  806492:	49 bb b5 4b 00 00 00 	movabs $0x4bb5,%r11
+  806499:	00 00 00 
+  80649c:	4c 01 db             	add    %r11,%rbx
+  80649f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8064a2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8064a6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8064aa:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8064b1:	00 00 00 
+  8064b4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8064b7:	85 c0                	test   %eax,%eax
+  8064b9:	75 24                	jne    8064df <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8064bb:	bf 02 00 00 00       	mov    $0x2,%edi
+  8064c0:	49 89 df             	mov    %rbx,%r15
+  8064c3:	48 b8 de cf ff ff ff 	movabs $0xffffffffffffcfde,%rax
+  8064ca:	ff ff ff 
+  8064cd:	48 01 d8             	add    %rbx,%rax
+  8064d0:	ff d0                	call   *%rax
+  8064d2:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8064d9:	00 00 00 
+  8064dc:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8064df:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8064e6:	00 00 00 
+  8064e9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8064ec:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8064f0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8064f4:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8064f7:	89 c7                	mov    %eax,%edi
+  8064f9:	49 89 df             	mov    %rbx,%r15
+  8064fc:	48 b8 e8 ca ff ff ff 	movabs $0xffffffffffffcae8,%rax
+  806503:	ff ff ff 
+  806506:	48 01 d8             	add    %rbx,%rax
+  806509:	ff d0                	call   *%rax
+}
+  80650b:	48 83 c4 20          	add    $0x20,%rsp
+  80650f:	5b                   	pop    %rbx
+  806510:	41 5f                	pop    %r15
+  806512:	5d                   	pop    %rbp
+  806513:	c3                   	ret
+
+0000000000806514 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  806514:	55                   	push   %rbp
+  806515:	48 89 e5             	mov    %rsp,%rbp
+  806518:	41 57                	push   %r15
+  80651a:	53                   	push   %rbx
+  80651b:	48 83 ec 30          	sub    $0x30,%rsp
+  80651f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80651f <nsipc_accept+0xb>
+  806526:	49 bb 21 4b 00 00 00 	movabs $0x4b21,%r11
+  80652d:	00 00 00 
+  806530:	4c 01 db             	add    %r11,%rbx
+  806533:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806536:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80653a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80653e:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806545:	00 00 00 
+  806548:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80654b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80654e:	bf 01 00 00 00       	mov    $0x1,%edi
+  806553:	48 b8 9d b3 ff ff ff 	movabs $0xffffffffffffb39d,%rax
+  80655a:	ff ff ff 
+  80655d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806561:	ff d0                	call   *%rax
+  806563:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806566:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80656a:	78 48                	js     8065b4 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  80656c:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  806573:	00 00 00 
+  806576:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80657a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80657e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806582:	8b 40 10             	mov    0x10(%rax),%eax
+  806585:	89 c2                	mov    %eax,%edx
+  806587:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80658b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80658f:	48 89 ce             	mov    %rcx,%rsi
+  806592:	48 89 c7             	mov    %rax,%rdi
+  806595:	49 89 df             	mov    %rbx,%r15
+  806598:	48 b8 fa 68 ff ff ff 	movabs $0xffffffffffff68fa,%rax
+  80659f:	ff ff ff 
+  8065a2:	48 01 d8             	add    %rbx,%rax
+  8065a5:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8065a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8065ab:	8b 50 10             	mov    0x10(%rax),%edx
+  8065ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8065b2:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8065b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8065b7:	48 83 c4 30          	add    $0x30,%rsp
+  8065bb:	5b                   	pop    %rbx
+  8065bc:	41 5f                	pop    %r15
+  8065be:	5d                   	pop    %rbp
+  8065bf:	c3                   	ret
+
+00000000008065c0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8065c0:	55                   	push   %rbp
+  8065c1:	48 89 e5             	mov    %rsp,%rbp
+  8065c4:	41 57                	push   %r15
+  8065c6:	53                   	push   %rbx
+  8065c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8065cb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065cb <nsipc_bind+0xb>
+  8065d2:	49 bb 75 4a 00 00 00 	movabs $0x4a75,%r11
+  8065d9:	00 00 00 
+  8065dc:	4c 01 db             	add    %r11,%rbx
+  8065df:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8065e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8065e6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8065e9:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8065f0:	00 00 00 
+  8065f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8065f6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8065f9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8065fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806600:	48 89 c6             	mov    %rax,%rsi
+  806603:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  80660a:	00 00 00 
+  80660d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806611:	48 89 c7             	mov    %rax,%rdi
+  806614:	49 89 df             	mov    %rbx,%r15
+  806617:	48 b8 fa 68 ff ff ff 	movabs $0xffffffffffff68fa,%rax
+  80661e:	ff ff ff 
+  806621:	48 01 d8             	add    %rbx,%rax
+  806624:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  806626:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80662d:	00 00 00 
+  806630:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806633:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  806637:	bf 02 00 00 00       	mov    $0x2,%edi
+  80663c:	48 b8 9d b3 ff ff ff 	movabs $0xffffffffffffb39d,%rax
+  806643:	ff ff ff 
+  806646:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80664a:	ff d0                	call   *%rax
+}
+  80664c:	48 83 c4 10          	add    $0x10,%rsp
+  806650:	5b                   	pop    %rbx
+  806651:	41 5f                	pop    %r15
+  806653:	5d                   	pop    %rbp
+  806654:	c3                   	ret
+
+0000000000806655 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  806655:	55                   	push   %rbp
+  806656:	48 89 e5             	mov    %rsp,%rbp
+  806659:	48 83 ec 20          	sub    $0x20,%rsp
+  80665d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80665d <nsipc_shutdown+0x8>
+  806664:	49 bb e3 49 00 00 00 	movabs $0x49e3,%r11
+  80666b:	00 00 00 
+  80666e:	4c 01 d8             	add    %r11,%rax
+  806671:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806674:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  806677:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80667a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  80667d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806680:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  806683:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  806687:	ba 08 00 00 00       	mov    $0x8,%edx
+  80668c:	48 89 ce             	mov    %rcx,%rsi
+  80668f:	bf 03 00 00 00       	mov    $0x3,%edi
+  806694:	48 b9 40 b4 ff ff ff 	movabs $0xffffffffffffb440,%rcx
+  80669b:	ff ff ff 
+  80669e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8066a2:	ff d0                	call   *%rax
+}
+  8066a4:	c9                   	leave
+  8066a5:	c3                   	ret
+
+00000000008066a6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8066a6:	55                   	push   %rbp
+  8066a7:	48 89 e5             	mov    %rsp,%rbp
+  8066aa:	48 83 ec 20          	sub    $0x20,%rsp
+  8066ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8066ae <nsipc_close+0x8>
+  8066b5:	49 bb 92 49 00 00 00 	movabs $0x4992,%r11
+  8066bc:	00 00 00 
+  8066bf:	4c 01 d8             	add    %r11,%rax
+  8066c2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8066c5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8066c8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8066cb:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8066cf:	ba 04 00 00 00       	mov    $0x4,%edx
+  8066d4:	48 89 ce             	mov    %rcx,%rsi
+  8066d7:	bf 04 00 00 00       	mov    $0x4,%edi
+  8066dc:	48 b9 40 b4 ff ff ff 	movabs $0xffffffffffffb440,%rcx
+  8066e3:	ff ff ff 
+  8066e6:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8066ea:	ff d0                	call   *%rax
+}
+  8066ec:	c9                   	leave
+  8066ed:	c3                   	ret
+
+00000000008066ee <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8066ee:	55                   	push   %rbp
+  8066ef:	48 89 e5             	mov    %rsp,%rbp
+  8066f2:	41 57                	push   %r15
+  8066f4:	53                   	push   %rbx
+  8066f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8066f9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8066f9 <nsipc_connect+0xb>
+  806700:	49 bb 47 49 00 00 00 	movabs $0x4947,%r11
+  806707:	00 00 00 
+  80670a:	4c 01 db             	add    %r11,%rbx
+  80670d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806710:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806714:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  806717:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80671e:	00 00 00 
+  806721:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806724:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  806727:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80672a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80672e:	48 89 c6             	mov    %rax,%rsi
+  806731:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  806738:	00 00 00 
+  80673b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80673f:	48 89 c7             	mov    %rax,%rdi
+  806742:	49 89 df             	mov    %rbx,%r15
+  806745:	48 b8 fa 68 ff ff ff 	movabs $0xffffffffffff68fa,%rax
+  80674c:	ff ff ff 
+  80674f:	48 01 d8             	add    %rbx,%rax
+  806752:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  806754:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80675b:	00 00 00 
+  80675e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806761:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  806765:	bf 05 00 00 00       	mov    $0x5,%edi
+  80676a:	48 b8 9d b3 ff ff ff 	movabs $0xffffffffffffb39d,%rax
+  806771:	ff ff ff 
+  806774:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806778:	ff d0                	call   *%rax
+}
+  80677a:	48 83 c4 10          	add    $0x10,%rsp
+  80677e:	5b                   	pop    %rbx
+  80677f:	41 5f                	pop    %r15
+  806781:	5d                   	pop    %rbp
+  806782:	c3                   	ret
+
+0000000000806783 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  806783:	55                   	push   %rbp
+  806784:	48 89 e5             	mov    %rsp,%rbp
+  806787:	48 83 ec 20          	sub    $0x20,%rsp
+  80678b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80678b <nsipc_listen+0x8>
+  806792:	49 bb b5 48 00 00 00 	movabs $0x48b5,%r11
+  806799:	00 00 00 
+  80679c:	4c 01 d8             	add    %r11,%rax
+  80679f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8067a2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  8067a5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8067a8:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  8067ab:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8067ae:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  8067b1:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8067b5:	ba 08 00 00 00       	mov    $0x8,%edx
+  8067ba:	48 89 ce             	mov    %rcx,%rsi
+  8067bd:	bf 06 00 00 00       	mov    $0x6,%edi
+  8067c2:	48 b9 40 b4 ff ff ff 	movabs $0xffffffffffffb440,%rcx
+  8067c9:	ff ff ff 
+  8067cc:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8067d0:	ff d0                	call   *%rax
+}
+  8067d2:	c9                   	leave
+  8067d3:	c3                   	ret
+
+00000000008067d4 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8067d4:	55                   	push   %rbp
+  8067d5:	48 89 e5             	mov    %rsp,%rbp
+  8067d8:	41 57                	push   %r15
+  8067da:	53                   	push   %rbx
+  8067db:	48 83 ec 30          	sub    $0x30,%rsp
+  8067df:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067df <nsipc_recv+0xb>
+  8067e6:	49 bb 61 48 00 00 00 	movabs $0x4861,%r11
+  8067ed:	00 00 00 
+  8067f0:	4c 01 db             	add    %r11,%rbx
+  8067f3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8067f6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8067fa:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8067fd:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  806800:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806807:	00 00 00 
+  80680a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80680d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  806810:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806817:	00 00 00 
+  80681a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80681d:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  806821:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806828:	00 00 00 
+  80682b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80682e:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  806832:	bf 07 00 00 00       	mov    $0x7,%edi
+  806837:	48 b8 9d b3 ff ff ff 	movabs $0xffffffffffffb39d,%rax
+  80683e:	ff ff ff 
+  806841:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806845:	ff d0                	call   *%rax
+  806847:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80684a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80684e:	0f 88 91 00 00 00    	js     8068e5 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  806854:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  80685b:	7f 08                	jg     806865 <nsipc_recv+0x91>
+  80685d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806860:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  806863:	7e 50                	jle    8068b5 <nsipc_recv+0xe1>
+  806865:	48 b8 36 d9 ff ff ff 	movabs $0xffffffffffffd936,%rax
+  80686c:	ff ff ff 
+  80686f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806873:	48 89 c1             	mov    %rax,%rcx
+  806876:	48 b8 4b d9 ff ff ff 	movabs $0xffffffffffffd94b,%rax
+  80687d:	ff ff ff 
+  806880:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806884:	48 89 c2             	mov    %rax,%rdx
+  806887:	be 79 00 00 00       	mov    $0x79,%esi
+  80688c:	48 b8 60 d9 ff ff ff 	movabs $0xffffffffffffd960,%rax
+  806893:	ff ff ff 
+  806896:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80689a:	48 89 c7             	mov    %rax,%rdi
+  80689d:	49 89 df             	mov    %rbx,%r15
+  8068a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8068a5:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  8068ac:	ff ff ff 
+  8068af:	49 01 d8             	add    %rbx,%r8
+  8068b2:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8068b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068b8:	48 63 d0             	movslq %eax,%rdx
+  8068bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8068bf:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8068c6:	00 00 00 
+  8068c9:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  8068cd:	48 89 ce             	mov    %rcx,%rsi
+  8068d0:	48 89 c7             	mov    %rax,%rdi
+  8068d3:	49 89 df             	mov    %rbx,%r15
+  8068d6:	48 b8 fa 68 ff ff ff 	movabs $0xffffffffffff68fa,%rax
+  8068dd:	ff ff ff 
+  8068e0:	48 01 d8             	add    %rbx,%rax
+  8068e3:	ff d0                	call   *%rax
+	}
+
+	return r;
+  8068e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8068e8:	48 83 c4 30          	add    $0x30,%rsp
+  8068ec:	5b                   	pop    %rbx
+  8068ed:	41 5f                	pop    %r15
+  8068ef:	5d                   	pop    %rbp
+  8068f0:	c3                   	ret
+
+00000000008068f1 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8068f1:	55                   	push   %rbp
+  8068f2:	48 89 e5             	mov    %rsp,%rbp
+  8068f5:	41 57                	push   %r15
+  8068f7:	53                   	push   %rbx
+  8068f8:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8068ff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068ff <nsipc_send+0xe>
+  806906:	49 bb 41 47 00 00 00 	movabs $0x4741,%r11
+  80690d:	00 00 00 
+  806910:	4c 01 db             	add    %r11,%rbx
+  806913:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  806919:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  806920:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  806926:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  80692c:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  806930:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  806934:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80693b:	00 00 00 
+  80693e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806941:	85 c0                	test   %eax,%eax
+  806943:	75 24                	jne    806969 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  806945:	bf 02 00 00 00       	mov    $0x2,%edi
+  80694a:	49 89 df             	mov    %rbx,%r15
+  80694d:	48 b8 de cf ff ff ff 	movabs $0xffffffffffffcfde,%rax
+  806954:	ff ff ff 
+  806957:	48 01 d8             	add    %rbx,%rax
+  80695a:	ff d0                	call   *%rax
+  80695c:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  806963:	00 00 00 
+  806966:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  806969:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80696f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  806972:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  806979:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80697c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80697f:	39 c2                	cmp    %eax,%edx
+  806981:	0f 4e c2             	cmovle %edx,%eax
+  806984:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  80698a:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  806990:	48 63 d0             	movslq %eax,%rdx
+  806993:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  80699a:	48 89 c6             	mov    %rax,%rsi
+  80699d:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  8069a4:	00 00 00 
+  8069a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8069ab:	48 89 c7             	mov    %rax,%rdi
+  8069ae:	49 89 df             	mov    %rbx,%r15
+  8069b1:	48 b8 fa 68 ff ff ff 	movabs $0xffffffffffff68fa,%rax
+  8069b8:	ff ff ff 
+  8069bb:	48 01 d8             	add    %rbx,%rax
+  8069be:	ff d0                	call   *%rax
+	req->req_s = s;
+  8069c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8069c4:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  8069ca:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  8069cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8069d0:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  8069d6:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  8069d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8069dd:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  8069e3:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  8069e6:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  8069ed:	00 00 00 
+  8069f0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8069f4:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  8069f8:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8069ff:	00 
+  806a00:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  806a06:	48 63 d0             	movslq %eax,%rdx
+  806a09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806a0d:	48 01 d0             	add    %rdx,%rax
+  806a10:	48 83 e8 01          	sub    $0x1,%rax
+  806a14:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  806a18:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806a1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  806a21:	48 f7 75 d8          	divq   -0x28(%rbp)
+  806a25:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806a29:	48 29 d0             	sub    %rdx,%rax
+  806a2c:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  806a32:	85 c0                	test   %eax,%eax
+  806a34:	0f 48 c2             	cmovs  %edx,%eax
+  806a37:	c1 f8 0c             	sar    $0xc,%eax
+  806a3a:	48 98                	cltq
+  806a3c:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  806a40:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  806a44:	48 85 c0             	test   %rax,%rax
+  806a47:	0f 95 c0             	setne  %al
+  806a4a:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  806a4d:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  806a54:	00 
+  806a55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806a59:	48 83 c0 0b          	add    $0xb,%rax
+  806a5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806a61:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806a65:	ba 00 00 00 00       	mov    $0x0,%edx
+  806a6a:	48 f7 75 c8          	divq   -0x38(%rbp)
+  806a6e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806a72:	48 29 d0             	sub    %rdx,%rax
+  806a75:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  806a79:	89 c7                	mov    %eax,%edi
+  806a7b:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  806a82:	00 00 00 
+  806a85:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806a88:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  806a8c:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  806a90:	48 83 ec 08          	sub    $0x8,%rsp
+  806a94:	6a 00                	push   $0x0
+  806a96:	6a 00                	push   $0x0
+  806a98:	6a 05                	push   $0x5
+  806a9a:	41 89 f1             	mov    %esi,%r9d
+  806a9d:	49 89 c8             	mov    %rcx,%r8
+  806aa0:	89 f9                	mov    %edi,%ecx
+  806aa2:	be 08 00 00 00       	mov    $0x8,%esi
+  806aa7:	89 c7                	mov    %eax,%edi
+  806aa9:	49 89 df             	mov    %rbx,%r15
+  806aac:	48 b8 e6 cb ff ff ff 	movabs $0xffffffffffffcbe6,%rax
+  806ab3:	ff ff ff 
+  806ab6:	48 01 d8             	add    %rbx,%rax
+  806ab9:	ff d0                	call   *%rax
+  806abb:	48 83 c4 20          	add    $0x20,%rsp
+}
+  806abf:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  806ac3:	5b                   	pop    %rbx
+  806ac4:	41 5f                	pop    %r15
+  806ac6:	5d                   	pop    %rbp
+  806ac7:	c3                   	ret
+
+0000000000806ac8 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  806ac8:	55                   	push   %rbp
+  806ac9:	48 89 e5             	mov    %rsp,%rbp
+  806acc:	48 83 ec 10          	sub    $0x10,%rsp
+  806ad0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806ad0 <nsipc_socket+0x8>
+  806ad7:	49 bb 70 45 00 00 00 	movabs $0x4570,%r11
+  806ade:	00 00 00 
+  806ae1:	4c 01 d8             	add    %r11,%rax
+  806ae4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806ae7:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  806aea:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  806aed:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  806af4:	00 00 00 
+  806af7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806afa:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  806afd:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  806b04:	00 00 00 
+  806b07:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  806b0a:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  806b0e:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  806b15:	00 00 00 
+  806b18:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806b1b:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  806b1f:	bf 09 00 00 00       	mov    $0x9,%edi
+  806b24:	48 ba 9d b3 ff ff ff 	movabs $0xffffffffffffb39d,%rdx
+  806b2b:	ff ff ff 
+  806b2e:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  806b32:	ff d0                	call   *%rax
+}
+  806b34:	c9                   	leave
+  806b35:	c3                   	ret
+
+0000000000806b36 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  806b36:	55                   	push   %rbp
+  806b37:	48 89 e5             	mov    %rsp,%rbp
+  806b3a:	41 57                	push   %r15
+  806b3c:	53                   	push   %rbx
+  806b3d:	48 83 ec 30          	sub    $0x30,%rsp
+  806b41:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b41 <pipe+0xb>
+  806b48:	49 bb ff 44 00 00 00 	movabs $0x44ff,%r11
+  806b4f:	00 00 00 
+  806b52:	4c 01 db             	add    %r11,%rbx
+  806b55:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  806b59:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  806b5d:	48 89 c7             	mov    %rax,%rdi
+  806b60:	49 89 df             	mov    %rbx,%r15
+  806b63:	48 b8 85 85 ff ff ff 	movabs $0xffffffffffff8585,%rax
+  806b6a:	ff ff ff 
+  806b6d:	48 01 d8             	add    %rbx,%rax
+  806b70:	ff d0                	call   *%rax
+  806b72:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806b75:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b79:	0f 88 12 02 00 00    	js     806d91 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806b7f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806b83:	ba 07 04 00 00       	mov    $0x407,%edx
+  806b88:	48 89 c6             	mov    %rax,%rsi
+  806b8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  806b90:	49 89 df             	mov    %rbx,%r15
+  806b93:	48 b8 d6 71 ff ff ff 	movabs $0xffffffffffff71d6,%rax
+  806b9a:	ff ff ff 
+  806b9d:	48 01 d8             	add    %rbx,%rax
+  806ba0:	ff d0                	call   *%rax
+  806ba2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806ba5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806ba9:	0f 88 e2 01 00 00    	js     806d91 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  806baf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  806bb3:	48 89 c7             	mov    %rax,%rdi
+  806bb6:	49 89 df             	mov    %rbx,%r15
+  806bb9:	48 b8 85 85 ff ff ff 	movabs $0xffffffffffff8585,%rax
+  806bc0:	ff ff ff 
+  806bc3:	48 01 d8             	add    %rbx,%rax
+  806bc6:	ff d0                	call   *%rax
+  806bc8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806bcb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806bcf:	0f 88 9b 01 00 00    	js     806d70 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806bd5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806bd9:	ba 07 04 00 00       	mov    $0x407,%edx
+  806bde:	48 89 c6             	mov    %rax,%rsi
+  806be1:	bf 00 00 00 00       	mov    $0x0,%edi
+  806be6:	49 89 df             	mov    %rbx,%r15
+  806be9:	48 b8 d6 71 ff ff ff 	movabs $0xffffffffffff71d6,%rax
+  806bf0:	ff ff ff 
+  806bf3:	48 01 d8             	add    %rbx,%rax
+  806bf6:	ff d0                	call   *%rax
+  806bf8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806bfb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806bff:	0f 88 6b 01 00 00    	js     806d70 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  806c05:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806c09:	48 89 c7             	mov    %rax,%rdi
+  806c0c:	49 89 df             	mov    %rbx,%r15
+  806c0f:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  806c16:	ff ff ff 
+  806c19:	48 01 d8             	add    %rbx,%rax
+  806c1c:	ff d0                	call   *%rax
+  806c1e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806c22:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806c26:	ba 07 04 00 00       	mov    $0x407,%edx
+  806c2b:	48 89 c6             	mov    %rax,%rsi
+  806c2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  806c33:	49 89 df             	mov    %rbx,%r15
+  806c36:	48 b8 d6 71 ff ff ff 	movabs $0xffffffffffff71d6,%rax
+  806c3d:	ff ff ff 
+  806c40:	48 01 d8             	add    %rbx,%rax
+  806c43:	ff d0                	call   *%rax
+  806c45:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806c48:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806c4c:	0f 88 fd 00 00 00    	js     806d4f <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806c52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806c56:	48 89 c7             	mov    %rax,%rdi
+  806c59:	49 89 df             	mov    %rbx,%r15
+  806c5c:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  806c63:	ff ff ff 
+  806c66:	48 01 d8             	add    %rbx,%rax
+  806c69:	ff d0                	call   *%rax
+  806c6b:	48 89 c2             	mov    %rax,%rdx
+  806c6e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806c72:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  806c78:	48 89 d1             	mov    %rdx,%rcx
+  806c7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  806c80:	48 89 c6             	mov    %rax,%rsi
+  806c83:	bf 00 00 00 00       	mov    $0x0,%edi
+  806c88:	49 89 df             	mov    %rbx,%r15
+  806c8b:	48 b8 3b 72 ff ff ff 	movabs $0xffffffffffff723b,%rax
+  806c92:	ff ff ff 
+  806c95:	48 01 d8             	add    %rbx,%rax
+  806c98:	ff d0                	call   *%rax
+  806c9a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806c9d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806ca1:	0f 88 87 00 00 00    	js     806d2e <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  806ca7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806cab:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806cb2:	00 00 00 
+  806cb5:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806cb8:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  806cba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806cbe:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  806cc5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806cc9:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806cd0:	00 00 00 
+  806cd3:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806cd6:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  806cd8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806cdc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  806ce3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806ce7:	48 89 c7             	mov    %rax,%rdi
+  806cea:	49 89 df             	mov    %rbx,%r15
+  806ced:	48 b8 0b 85 ff ff ff 	movabs $0xffffffffffff850b,%rax
+  806cf4:	ff ff ff 
+  806cf7:	48 01 d8             	add    %rbx,%rax
+  806cfa:	ff d0                	call   *%rax
+  806cfc:	89 c2                	mov    %eax,%edx
+  806cfe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806d02:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  806d04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806d08:	48 89 c7             	mov    %rax,%rdi
+  806d0b:	49 89 df             	mov    %rbx,%r15
+  806d0e:	48 b8 0b 85 ff ff ff 	movabs $0xffffffffffff850b,%rax
+  806d15:	ff ff ff 
+  806d18:	48 01 d8             	add    %rbx,%rax
+  806d1b:	ff d0                	call   *%rax
+  806d1d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806d21:	48 83 c2 04          	add    $0x4,%rdx
+  806d25:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  806d27:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d2c:	eb 67                	jmp    806d95 <pipe+0x25f>
+		goto err3;
+  806d2e:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  806d2f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806d33:	48 89 c6             	mov    %rax,%rsi
+  806d36:	bf 00 00 00 00       	mov    $0x0,%edi
+  806d3b:	49 89 df             	mov    %rbx,%r15
+  806d3e:	48 b8 ae 72 ff ff ff 	movabs $0xffffffffffff72ae,%rax
+  806d45:	ff ff ff 
+  806d48:	48 01 d8             	add    %rbx,%rax
+  806d4b:	ff d0                	call   *%rax
+  806d4d:	eb 01                	jmp    806d50 <pipe+0x21a>
+		goto err2;
+  806d4f:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  806d50:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806d54:	48 89 c6             	mov    %rax,%rsi
+  806d57:	bf 00 00 00 00       	mov    $0x0,%edi
+  806d5c:	49 89 df             	mov    %rbx,%r15
+  806d5f:	48 b8 ae 72 ff ff ff 	movabs $0xffffffffffff72ae,%rax
+  806d66:	ff ff ff 
+  806d69:	48 01 d8             	add    %rbx,%rax
+  806d6c:	ff d0                	call   *%rax
+  806d6e:	eb 01                	jmp    806d71 <pipe+0x23b>
+		goto err1;
+  806d70:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  806d71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806d75:	48 89 c6             	mov    %rax,%rsi
+  806d78:	bf 00 00 00 00       	mov    $0x0,%edi
+  806d7d:	49 89 df             	mov    %rbx,%r15
+  806d80:	48 b8 ae 72 ff ff ff 	movabs $0xffffffffffff72ae,%rax
+  806d87:	ff ff ff 
+  806d8a:	48 01 d8             	add    %rbx,%rax
+  806d8d:	ff d0                	call   *%rax
+  806d8f:	eb 01                	jmp    806d92 <pipe+0x25c>
+		goto err;
+  806d91:	90                   	nop
+err:
+	return r;
+  806d92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806d95:	48 83 c4 30          	add    $0x30,%rsp
+  806d99:	5b                   	pop    %rbx
+  806d9a:	41 5f                	pop    %r15
+  806d9c:	5d                   	pop    %rbp
+  806d9d:	c3                   	ret
+
+0000000000806d9e <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  806d9e:	55                   	push   %rbp
+  806d9f:	48 89 e5             	mov    %rsp,%rbp
+  806da2:	41 57                	push   %r15
+  806da4:	41 54                	push   %r12
+  806da6:	53                   	push   %rbx
+  806da7:	48 83 ec 28          	sub    $0x28,%rsp
+  806dab:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806dab <_pipeisclosed+0xd>
+  806db2:	49 bb 95 42 00 00 00 	movabs $0x4295,%r11
+  806db9:	00 00 00 
+  806dbc:	4c 01 db             	add    %r11,%rbx
+  806dbf:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806dc3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  806dc7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806dce:	ff ff ff 
+  806dd1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806dd5:	48 8b 00             	mov    (%rax),%rax
+  806dd8:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806dde:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  806de1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806de5:	48 89 c7             	mov    %rax,%rdi
+  806de8:	49 89 df             	mov    %rbx,%r15
+  806deb:	48 b8 6d d0 ff ff ff 	movabs $0xffffffffffffd06d,%rax
+  806df2:	ff ff ff 
+  806df5:	48 01 d8             	add    %rbx,%rax
+  806df8:	ff d0                	call   *%rax
+  806dfa:	41 89 c4             	mov    %eax,%r12d
+  806dfd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806e01:	48 89 c7             	mov    %rax,%rdi
+  806e04:	49 89 df             	mov    %rbx,%r15
+  806e07:	48 b8 6d d0 ff ff ff 	movabs $0xffffffffffffd06d,%rax
+  806e0e:	ff ff ff 
+  806e11:	48 01 d8             	add    %rbx,%rax
+  806e14:	ff d0                	call   *%rax
+  806e16:	41 39 c4             	cmp    %eax,%r12d
+  806e19:	0f 94 c0             	sete   %al
+  806e1c:	0f b6 c0             	movzbl %al,%eax
+  806e1f:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  806e22:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806e29:	ff ff ff 
+  806e2c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806e30:	48 8b 00             	mov    (%rax),%rax
+  806e33:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806e39:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  806e3c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806e3f:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806e42:	75 05                	jne    806e49 <_pipeisclosed+0xab>
+			return ret;
+  806e44:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806e47:	eb 63                	jmp    806eac <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  806e49:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806e4c:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806e4f:	0f 84 72 ff ff ff    	je     806dc7 <_pipeisclosed+0x29>
+  806e55:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  806e59:	0f 85 68 ff ff ff    	jne    806dc7 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  806e5f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806e66:	ff ff ff 
+  806e69:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806e6d:	48 8b 00             	mov    (%rax),%rax
+  806e70:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  806e76:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  806e79:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806e7c:	89 c6                	mov    %eax,%esi
+  806e7e:	48 b8 71 d9 ff ff ff 	movabs $0xffffffffffffd971,%rax
+  806e85:	ff ff ff 
+  806e88:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806e8c:	48 89 c7             	mov    %rax,%rdi
+  806e8f:	49 89 df             	mov    %rbx,%r15
+  806e92:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e97:	49 b8 58 57 ff ff ff 	movabs $0xffffffffffff5758,%r8
+  806e9e:	ff ff ff 
+  806ea1:	49 01 d8             	add    %rbx,%r8
+  806ea4:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  806ea7:	e9 1b ff ff ff       	jmp    806dc7 <_pipeisclosed+0x29>
+	}
+}
+  806eac:	48 83 c4 28          	add    $0x28,%rsp
+  806eb0:	5b                   	pop    %rbx
+  806eb1:	41 5c                	pop    %r12
+  806eb3:	41 5f                	pop    %r15
+  806eb5:	5d                   	pop    %rbp
+  806eb6:	c3                   	ret
+
+0000000000806eb7 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  806eb7:	55                   	push   %rbp
+  806eb8:	48 89 e5             	mov    %rsp,%rbp
+  806ebb:	41 57                	push   %r15
+  806ebd:	53                   	push   %rbx
+  806ebe:	48 83 ec 30          	sub    $0x30,%rsp
+  806ec2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ec2 <pipeisclosed+0xb>
+  806ec9:	49 bb 7e 41 00 00 00 	movabs $0x417e,%r11
+  806ed0:	00 00 00 
+  806ed3:	4c 01 db             	add    %r11,%rbx
+  806ed6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806ed9:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  806edd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806ee0:	48 89 d6             	mov    %rdx,%rsi
+  806ee3:	89 c7                	mov    %eax,%edi
+  806ee5:	49 89 df             	mov    %rbx,%r15
+  806ee8:	48 b8 3b 86 ff ff ff 	movabs $0xffffffffffff863b,%rax
+  806eef:	ff ff ff 
+  806ef2:	48 01 d8             	add    %rbx,%rax
+  806ef5:	ff d0                	call   *%rax
+  806ef7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806efa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806efe:	79 05                	jns    806f05 <pipeisclosed+0x4e>
+		return r;
+  806f00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806f03:	eb 3b                	jmp    806f40 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  806f05:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806f09:	48 89 c7             	mov    %rax,%rdi
+  806f0c:	49 89 df             	mov    %rbx,%r15
+  806f0f:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  806f16:	ff ff ff 
+  806f19:	48 01 d8             	add    %rbx,%rax
+  806f1c:	ff d0                	call   *%rax
+  806f1e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  806f22:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806f26:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806f2a:	48 89 d6             	mov    %rdx,%rsi
+  806f2d:	48 89 c7             	mov    %rax,%rdi
+  806f30:	48 b8 5e bd ff ff ff 	movabs $0xffffffffffffbd5e,%rax
+  806f37:	ff ff ff 
+  806f3a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806f3e:	ff d0                	call   *%rax
+}
+  806f40:	48 83 c4 30          	add    $0x30,%rsp
+  806f44:	5b                   	pop    %rbx
+  806f45:	41 5f                	pop    %r15
+  806f47:	5d                   	pop    %rbp
+  806f48:	c3                   	ret
+
+0000000000806f49 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806f49:	55                   	push   %rbp
+  806f4a:	48 89 e5             	mov    %rsp,%rbp
+  806f4d:	41 57                	push   %r15
+  806f4f:	53                   	push   %rbx
+  806f50:	48 83 ec 40          	sub    $0x40,%rsp
+  806f54:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806f54 <devpipe_read+0xb>
+  806f5b:	49 bb ec 40 00 00 00 	movabs $0x40ec,%r11
+  806f62:	00 00 00 
+  806f65:	4c 01 db             	add    %r11,%rbx
+  806f68:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806f6c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806f70:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  806f74:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806f78:	48 89 c7             	mov    %rax,%rdi
+  806f7b:	49 89 df             	mov    %rbx,%r15
+  806f7e:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  806f85:	ff ff ff 
+  806f88:	48 01 d8             	add    %rbx,%rax
+  806f8b:	ff d0                	call   *%rax
+  806f8d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806f91:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806f95:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806f99:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806fa0:	00 
+  806fa1:	e9 a1 00 00 00       	jmp    807047 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  806fa6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  806fab:	74 09                	je     806fb6 <devpipe_read+0x6d>
+				return i;
+  806fad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806fb1:	e9 9f 00 00 00       	jmp    807055 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  806fb6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806fba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806fbe:	48 89 d6             	mov    %rdx,%rsi
+  806fc1:	48 89 c7             	mov    %rax,%rdi
+  806fc4:	48 b8 5e bd ff ff ff 	movabs $0xffffffffffffbd5e,%rax
+  806fcb:	ff ff ff 
+  806fce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806fd2:	ff d0                	call   *%rax
+  806fd4:	85 c0                	test   %eax,%eax
+  806fd6:	74 07                	je     806fdf <devpipe_read+0x96>
+				return 0;
+  806fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  806fdd:	eb 76                	jmp    807055 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  806fdf:	49 89 df             	mov    %rbx,%r15
+  806fe2:	48 b8 81 71 ff ff ff 	movabs $0xffffffffffff7181,%rax
+  806fe9:	ff ff ff 
+  806fec:	48 01 d8             	add    %rbx,%rax
+  806fef:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  806ff1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806ff5:	8b 10                	mov    (%rax),%edx
+  806ff7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806ffb:	8b 40 04             	mov    0x4(%rax),%eax
+  806ffe:	39 c2                	cmp    %eax,%edx
+  807000:	74 a4                	je     806fa6 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  807002:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807006:	8b 10                	mov    (%rax),%edx
+  807008:	89 d0                	mov    %edx,%eax
+  80700a:	c1 f8 1f             	sar    $0x1f,%eax
+  80700d:	c1 e8 1b             	shr    $0x1b,%eax
+  807010:	01 c2                	add    %eax,%edx
+  807012:	83 e2 1f             	and    $0x1f,%edx
+  807015:	29 c2                	sub    %eax,%edx
+  807017:	89 d6                	mov    %edx,%esi
+  807019:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80701d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807021:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  807025:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807029:	48 63 c6             	movslq %esi,%rax
+  80702c:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  807031:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  807033:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807037:	8b 00                	mov    (%rax),%eax
+  807039:	8d 50 01             	lea    0x1(%rax),%edx
+  80703c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807040:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  807042:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  807047:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80704b:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80704f:	72 a0                	jb     806ff1 <devpipe_read+0xa8>
+	}
+	return i;
+  807051:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  807055:	48 83 c4 40          	add    $0x40,%rsp
+  807059:	5b                   	pop    %rbx
+  80705a:	41 5f                	pop    %r15
+  80705c:	5d                   	pop    %rbp
+  80705d:	c3                   	ret
+
+000000000080705e <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80705e:	55                   	push   %rbp
+  80705f:	48 89 e5             	mov    %rsp,%rbp
+  807062:	41 57                	push   %r15
+  807064:	53                   	push   %rbx
+  807065:	48 83 ec 40          	sub    $0x40,%rsp
+  807069:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807069 <devpipe_write+0xb>
+  807070:	49 bb d7 3f 00 00 00 	movabs $0x3fd7,%r11
+  807077:	00 00 00 
+  80707a:	4c 01 db             	add    %r11,%rbx
+  80707d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  807081:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  807085:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  807089:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80708d:	48 89 c7             	mov    %rax,%rdi
+  807090:	49 89 df             	mov    %rbx,%r15
+  807093:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  80709a:	ff ff ff 
+  80709d:	48 01 d8             	add    %rbx,%rax
+  8070a0:	ff d0                	call   *%rax
+  8070a2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8070a6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8070aa:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8070ae:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8070b5:	00 
+  8070b6:	e9 a0 00 00 00       	jmp    80715b <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8070bb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8070bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8070c3:	48 89 d6             	mov    %rdx,%rsi
+  8070c6:	48 89 c7             	mov    %rax,%rdi
+  8070c9:	48 b8 5e bd ff ff ff 	movabs $0xffffffffffffbd5e,%rax
+  8070d0:	ff ff ff 
+  8070d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8070d7:	ff d0                	call   *%rax
+  8070d9:	85 c0                	test   %eax,%eax
+  8070db:	74 0a                	je     8070e7 <devpipe_write+0x89>
+				return 0;
+  8070dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8070e2:	e9 82 00 00 00       	jmp    807169 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8070e7:	49 89 df             	mov    %rbx,%r15
+  8070ea:	48 b8 81 71 ff ff ff 	movabs $0xffffffffffff7181,%rax
+  8070f1:	ff ff ff 
+  8070f4:	48 01 d8             	add    %rbx,%rax
+  8070f7:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8070f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8070fd:	8b 40 04             	mov    0x4(%rax),%eax
+  807100:	48 63 d0             	movslq %eax,%rdx
+  807103:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807107:	8b 00                	mov    (%rax),%eax
+  807109:	48 98                	cltq
+  80710b:	48 83 c0 20          	add    $0x20,%rax
+  80710f:	48 39 c2             	cmp    %rax,%rdx
+  807112:	73 a7                	jae    8070bb <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  807114:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  807118:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80711c:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  807120:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807124:	8b 50 04             	mov    0x4(%rax),%edx
+  807127:	89 d0                	mov    %edx,%eax
+  807129:	c1 f8 1f             	sar    $0x1f,%eax
+  80712c:	c1 e8 1b             	shr    $0x1b,%eax
+  80712f:	01 c2                	add    %eax,%edx
+  807131:	83 e2 1f             	and    $0x1f,%edx
+  807134:	29 c2                	sub    %eax,%edx
+  807136:	89 d0                	mov    %edx,%eax
+  807138:	0f b6 09             	movzbl (%rcx),%ecx
+  80713b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80713f:	48 98                	cltq
+  807141:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  807145:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807149:	8b 40 04             	mov    0x4(%rax),%eax
+  80714c:	8d 50 01             	lea    0x1(%rax),%edx
+  80714f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807153:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  807156:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80715b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80715f:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  807163:	72 94                	jb     8070f9 <devpipe_write+0x9b>
+	}
+
+	return i;
+  807165:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  807169:	48 83 c4 40          	add    $0x40,%rsp
+  80716d:	5b                   	pop    %rbx
+  80716e:	41 5f                	pop    %r15
+  807170:	5d                   	pop    %rbp
+  807171:	c3                   	ret
+
+0000000000807172 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  807172:	55                   	push   %rbp
+  807173:	48 89 e5             	mov    %rsp,%rbp
+  807176:	41 57                	push   %r15
+  807178:	53                   	push   %rbx
+  807179:	48 83 ec 20          	sub    $0x20,%rsp
+  80717d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80717d <devpipe_stat+0xb>
+  807184:	49 bb c3 3e 00 00 00 	movabs $0x3ec3,%r11
+  80718b:	00 00 00 
+  80718e:	4c 01 db             	add    %r11,%rbx
+  807191:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  807195:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  807199:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80719d:	48 89 c7             	mov    %rax,%rdi
+  8071a0:	49 89 df             	mov    %rbx,%r15
+  8071a3:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  8071aa:	ff ff ff 
+  8071ad:	48 01 d8             	add    %rbx,%rax
+  8071b0:	ff d0                	call   *%rax
+  8071b2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8071b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8071ba:	48 ba 84 d9 ff ff ff 	movabs $0xffffffffffffd984,%rdx
+  8071c1:	ff ff ff 
+  8071c4:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8071c8:	48 89 d6             	mov    %rdx,%rsi
+  8071cb:	48 89 c7             	mov    %rax,%rdi
+  8071ce:	49 89 df             	mov    %rbx,%r15
+  8071d1:	48 b8 1a 65 ff ff ff 	movabs $0xffffffffffff651a,%rax
+  8071d8:	ff ff ff 
+  8071db:	48 01 d8             	add    %rbx,%rax
+  8071de:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8071e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8071e4:	8b 50 04             	mov    0x4(%rax),%edx
+  8071e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8071eb:	8b 00                	mov    (%rax),%eax
+  8071ed:	29 c2                	sub    %eax,%edx
+  8071ef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8071f3:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8071f9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8071fd:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  807204:	00 00 00 
+	stat->st_dev = &devpipe;
+  807207:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80720b:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  807212:	00 00 00 
+  807215:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  807219:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  807220:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807225:	48 83 c4 20          	add    $0x20,%rsp
+  807229:	5b                   	pop    %rbx
+  80722a:	41 5f                	pop    %r15
+  80722c:	5d                   	pop    %rbp
+  80722d:	c3                   	ret
+
+000000000080722e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80722e:	55                   	push   %rbp
+  80722f:	48 89 e5             	mov    %rsp,%rbp
+  807232:	41 57                	push   %r15
+  807234:	53                   	push   %rbx
+  807235:	48 83 ec 10          	sub    $0x10,%rsp
+  807239:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807239 <devpipe_close+0xb>
+  807240:	49 bb 07 3e 00 00 00 	movabs $0x3e07,%r11
+  807247:	00 00 00 
+  80724a:	4c 01 db             	add    %r11,%rbx
+  80724d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  807251:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807255:	48 89 c6             	mov    %rax,%rsi
+  807258:	bf 00 00 00 00       	mov    $0x0,%edi
+  80725d:	49 89 df             	mov    %rbx,%r15
+  807260:	48 b8 ae 72 ff ff ff 	movabs $0xffffffffffff72ae,%rax
+  807267:	ff ff ff 
+  80726a:	48 01 d8             	add    %rbx,%rax
+  80726d:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80726f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807273:	48 89 c7             	mov    %rax,%rdi
+  807276:	49 89 df             	mov    %rbx,%r15
+  807279:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  807280:	ff ff ff 
+  807283:	48 01 d8             	add    %rbx,%rax
+  807286:	ff d0                	call   *%rax
+  807288:	48 89 c6             	mov    %rax,%rsi
+  80728b:	bf 00 00 00 00       	mov    $0x0,%edi
+  807290:	49 89 df             	mov    %rbx,%r15
+  807293:	48 b8 ae 72 ff ff ff 	movabs $0xffffffffffff72ae,%rax
+  80729a:	ff ff ff 
+  80729d:	48 01 d8             	add    %rbx,%rax
+  8072a0:	ff d0                	call   *%rax
+}
+  8072a2:	48 83 c4 10          	add    $0x10,%rsp
+  8072a6:	5b                   	pop    %rbx
+  8072a7:	41 5f                	pop    %r15
+  8072a9:	5d                   	pop    %rbp
+  8072aa:	c3                   	ret
+
+00000000008072ab <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8072ab:	55                   	push   %rbp
+  8072ac:	48 89 e5             	mov    %rsp,%rbp
+  8072af:	41 57                	push   %r15
+  8072b1:	53                   	push   %rbx
+  8072b2:	48 83 ec 20          	sub    $0x20,%rsp
+  8072b6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8072b6 <wait+0xb>
+  8072bd:	49 bb 8a 3d 00 00 00 	movabs $0x3d8a,%r11
+  8072c4:	00 00 00 
+  8072c7:	4c 01 db             	add    %r11,%rbx
+  8072ca:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8072cd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8072d1:	75 50                	jne    807323 <wait+0x78>
+  8072d3:	48 b8 8b d9 ff ff ff 	movabs $0xffffffffffffd98b,%rax
+  8072da:	ff ff ff 
+  8072dd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8072e1:	48 89 c1             	mov    %rax,%rcx
+  8072e4:	48 b8 96 d9 ff ff ff 	movabs $0xffffffffffffd996,%rax
+  8072eb:	ff ff ff 
+  8072ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8072f2:	48 89 c2             	mov    %rax,%rdx
+  8072f5:	be 09 00 00 00       	mov    $0x9,%esi
+  8072fa:	48 b8 ab d9 ff ff ff 	movabs $0xffffffffffffd9ab,%rax
+  807301:	ff ff ff 
+  807304:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807308:	48 89 c7             	mov    %rax,%rdi
+  80730b:	49 89 df             	mov    %rbx,%r15
+  80730e:	b8 00 00 00 00       	mov    $0x0,%eax
+  807313:	49 b8 81 54 ff ff ff 	movabs $0xffffffffffff5481,%r8
+  80731a:	ff ff ff 
+  80731d:	49 01 d8             	add    %rbx,%r8
+  807320:	41 ff d0             	call   *%r8
+	e = &envs[ENVX(envid)];
+  807323:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807326:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80732b:	48 98                	cltq
+  80732d:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  807334:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80733b:	ff ff ff 
+  80733e:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  807342:	48 01 d0             	add    %rdx,%rax
+  807345:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  807349:	eb 12                	jmp    80735d <wait+0xb2>
+		sys_yield();
+  80734b:	49 89 df             	mov    %rbx,%r15
+  80734e:	48 b8 81 71 ff ff ff 	movabs $0xffffffffffff7181,%rax
+  807355:	ff ff ff 
+  807358:	48 01 d8             	add    %rbx,%rax
+  80735b:	ff d0                	call   *%rax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80735d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807361:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  807367:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80736a:	75 0e                	jne    80737a <wait+0xcf>
+  80736c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807370:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  807376:	85 c0                	test   %eax,%eax
+  807378:	75 d1                	jne    80734b <wait+0xa0>
+}
+  80737a:	90                   	nop
+  80737b:	48 83 c4 20          	add    $0x20,%rsp
+  80737f:	5b                   	pop    %rbx
+  807380:	41 5f                	pop    %r15
+  807382:	5d                   	pop    %rbp
+  807383:	c3                   	ret
+
+0000000000807384 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  807384:	55                   	push   %rbp
+  807385:	48 89 e5             	mov    %rsp,%rbp
+  807388:	41 57                	push   %r15
+  80738a:	48 83 ec 28          	sub    $0x28,%rsp
+  80738e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80738e <cputchar+0xa>
+  807395:	49 bb b2 3c 00 00 00 	movabs $0x3cb2,%r11
+  80739c:	00 00 00 
+  80739f:	4c 01 d8             	add    %r11,%rax
+  8073a2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8073a5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8073a8:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8073ab:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8073af:	be 01 00 00 00       	mov    $0x1,%esi
+  8073b4:	48 89 d7             	mov    %rdx,%rdi
+  8073b7:	49 89 c7             	mov    %rax,%r15
+  8073ba:	48 ba 1e 70 ff ff ff 	movabs $0xffffffffffff701e,%rdx
+  8073c1:	ff ff ff 
+  8073c4:	48 01 c2             	add    %rax,%rdx
+  8073c7:	ff d2                	call   *%rdx
+}
+  8073c9:	90                   	nop
+  8073ca:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8073ce:	c9                   	leave
+  8073cf:	c3                   	ret
+
+00000000008073d0 <getchar>:
+
+int
+getchar(void)
+{
+  8073d0:	55                   	push   %rbp
+  8073d1:	48 89 e5             	mov    %rsp,%rbp
+  8073d4:	41 57                	push   %r15
+  8073d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8073da:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8073da <getchar+0xa>
+  8073e1:	49 bb 66 3c 00 00 00 	movabs $0x3c66,%r11
+  8073e8:	00 00 00 
+  8073eb:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8073ee:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8073f2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8073f7:	48 89 ce             	mov    %rcx,%rsi
+  8073fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8073ff:	49 89 c7             	mov    %rax,%r15
+  807402:	48 b9 82 8b ff ff ff 	movabs $0xffffffffffff8b82,%rcx
+  807409:	ff ff ff 
+  80740c:	48 01 c1             	add    %rax,%rcx
+  80740f:	ff d1                	call   *%rcx
+  807411:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  807414:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807418:	79 05                	jns    80741f <getchar+0x4f>
+		return r;
+  80741a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80741d:	eb 14                	jmp    807433 <getchar+0x63>
+	if (r < 1)
+  80741f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807423:	7f 07                	jg     80742c <getchar+0x5c>
+		return -E_EOF;
+  807425:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80742a:	eb 07                	jmp    807433 <getchar+0x63>
+	return c;
+  80742c:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  807430:	0f b6 c0             	movzbl %al,%eax
+}
+  807433:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  807437:	c9                   	leave
+  807438:	c3                   	ret
+
+0000000000807439 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  807439:	55                   	push   %rbp
+  80743a:	48 89 e5             	mov    %rsp,%rbp
+  80743d:	41 57                	push   %r15
+  80743f:	53                   	push   %rbx
+  807440:	48 83 ec 20          	sub    $0x20,%rsp
+  807444:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807444 <iscons+0xb>
+  80744b:	49 bb fc 3b 00 00 00 	movabs $0x3bfc,%r11
+  807452:	00 00 00 
+  807455:	4c 01 db             	add    %r11,%rbx
+  807458:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80745b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80745f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807462:	48 89 d6             	mov    %rdx,%rsi
+  807465:	89 c7                	mov    %eax,%edi
+  807467:	49 89 df             	mov    %rbx,%r15
+  80746a:	48 b8 3b 86 ff ff ff 	movabs $0xffffffffffff863b,%rax
+  807471:	ff ff ff 
+  807474:	48 01 d8             	add    %rbx,%rax
+  807477:	ff d0                	call   *%rax
+  807479:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80747c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807480:	79 05                	jns    807487 <iscons+0x4e>
+		return r;
+  807482:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807485:	eb 1b                	jmp    8074a2 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  807487:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80748b:	8b 10                	mov    (%rax),%edx
+  80748d:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  807494:	00 00 00 
+  807497:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80749a:	39 c2                	cmp    %eax,%edx
+  80749c:	0f 94 c0             	sete   %al
+  80749f:	0f b6 c0             	movzbl %al,%eax
+}
+  8074a2:	48 83 c4 20          	add    $0x20,%rsp
+  8074a6:	5b                   	pop    %rbx
+  8074a7:	41 5f                	pop    %r15
+  8074a9:	5d                   	pop    %rbp
+  8074aa:	c3                   	ret
+
+00000000008074ab <opencons>:
+
+int
+opencons(void)
+{
+  8074ab:	55                   	push   %rbp
+  8074ac:	48 89 e5             	mov    %rsp,%rbp
+  8074af:	41 57                	push   %r15
+  8074b1:	53                   	push   %rbx
+  8074b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8074b6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8074b6 <opencons+0xb>
+  8074bd:	49 bb 8a 3b 00 00 00 	movabs $0x3b8a,%r11
+  8074c4:	00 00 00 
+  8074c7:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8074ca:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8074ce:	48 89 c7             	mov    %rax,%rdi
+  8074d1:	49 89 df             	mov    %rbx,%r15
+  8074d4:	48 b8 85 85 ff ff ff 	movabs $0xffffffffffff8585,%rax
+  8074db:	ff ff ff 
+  8074de:	48 01 d8             	add    %rbx,%rax
+  8074e1:	ff d0                	call   *%rax
+  8074e3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8074e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8074ea:	79 05                	jns    8074f1 <opencons+0x46>
+		return r;
+  8074ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8074ef:	eb 68                	jmp    807559 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8074f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8074f5:	ba 07 04 00 00       	mov    $0x407,%edx
+  8074fa:	48 89 c6             	mov    %rax,%rsi
+  8074fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  807502:	49 89 df             	mov    %rbx,%r15
+  807505:	48 b8 d6 71 ff ff ff 	movabs $0xffffffffffff71d6,%rax
+  80750c:	ff ff ff 
+  80750f:	48 01 d8             	add    %rbx,%rax
+  807512:	ff d0                	call   *%rax
+  807514:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807517:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80751b:	79 05                	jns    807522 <opencons+0x77>
+		return r;
+  80751d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807520:	eb 37                	jmp    807559 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  807522:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807526:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  80752d:	00 00 00 
+  807530:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  807533:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  807535:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807539:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  807540:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807544:	48 89 c7             	mov    %rax,%rdi
+  807547:	49 89 df             	mov    %rbx,%r15
+  80754a:	48 b8 0b 85 ff ff ff 	movabs $0xffffffffffff850b,%rax
+  807551:	ff ff ff 
+  807554:	48 01 d8             	add    %rbx,%rax
+  807557:	ff d0                	call   *%rax
+}
+  807559:	48 83 c4 10          	add    $0x10,%rsp
+  80755d:	5b                   	pop    %rbx
+  80755e:	41 5f                	pop    %r15
+  807560:	5d                   	pop    %rbp
+  807561:	c3                   	ret
+
+0000000000807562 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  807562:	55                   	push   %rbp
+  807563:	48 89 e5             	mov    %rsp,%rbp
+  807566:	41 57                	push   %r15
+  807568:	53                   	push   %rbx
+  807569:	48 83 ec 30          	sub    $0x30,%rsp
+  80756d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80756d <devcons_read+0xb>
+  807574:	49 bb d3 3a 00 00 00 	movabs $0x3ad3,%r11
+  80757b:	00 00 00 
+  80757e:	4c 01 db             	add    %r11,%rbx
+  807581:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  807585:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  807589:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  80758d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  807592:	75 19                	jne    8075ad <devcons_read+0x4b>
+		return 0;
+  807594:	b8 00 00 00 00       	mov    $0x0,%eax
+  807599:	eb 55                	jmp    8075f0 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  80759b:	49 89 df             	mov    %rbx,%r15
+  80759e:	48 b8 81 71 ff ff ff 	movabs $0xffffffffffff7181,%rax
+  8075a5:	ff ff ff 
+  8075a8:	48 01 d8             	add    %rbx,%rax
+  8075ab:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8075ad:	49 89 df             	mov    %rbx,%r15
+  8075b0:	48 b8 7d 70 ff ff ff 	movabs $0xffffffffffff707d,%rax
+  8075b7:	ff ff ff 
+  8075ba:	48 01 d8             	add    %rbx,%rax
+  8075bd:	ff d0                	call   *%rax
+  8075bf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8075c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8075c6:	74 d3                	je     80759b <devcons_read+0x39>
+	if (c < 0)
+  8075c8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8075cc:	79 05                	jns    8075d3 <devcons_read+0x71>
+		return c;
+  8075ce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8075d1:	eb 1d                	jmp    8075f0 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8075d3:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8075d7:	75 07                	jne    8075e0 <devcons_read+0x7e>
+		return 0;
+  8075d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8075de:	eb 10                	jmp    8075f0 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  8075e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8075e3:	89 c2                	mov    %eax,%edx
+  8075e5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8075e9:	88 10                	mov    %dl,(%rax)
+	return 1;
+  8075eb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8075f0:	48 83 c4 30          	add    $0x30,%rsp
+  8075f4:	5b                   	pop    %rbx
+  8075f5:	41 5f                	pop    %r15
+  8075f7:	5d                   	pop    %rbp
+  8075f8:	c3                   	ret
+
+00000000008075f9 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8075f9:	55                   	push   %rbp
+  8075fa:	48 89 e5             	mov    %rsp,%rbp
+  8075fd:	41 57                	push   %r15
+  8075ff:	53                   	push   %rbx
+  807600:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  807607:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807607 <devcons_write+0xe>
+  80760e:	49 bb 39 3a 00 00 00 	movabs $0x3a39,%r11
+  807615:	00 00 00 
+  807618:	4c 01 db             	add    %r11,%rbx
+  80761b:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  807622:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  807629:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  807630:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  807637:	e9 80 00 00 00       	jmp    8076bc <devcons_write+0xc3>
+		m = n - tot;
+  80763c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  807643:	89 c2                	mov    %eax,%edx
+  807645:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807648:	29 c2                	sub    %eax,%edx
+  80764a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  80764d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  807650:	83 f8 7f             	cmp    $0x7f,%eax
+  807653:	76 07                	jbe    80765c <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  807655:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  80765c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80765f:	48 63 d0             	movslq %eax,%rdx
+  807662:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807665:	48 63 c8             	movslq %eax,%rcx
+  807668:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80766f:	48 01 c1             	add    %rax,%rcx
+  807672:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  807679:	48 89 ce             	mov    %rcx,%rsi
+  80767c:	48 89 c7             	mov    %rax,%rdi
+  80767f:	49 89 df             	mov    %rbx,%r15
+  807682:	48 b8 fa 68 ff ff ff 	movabs $0xffffffffffff68fa,%rax
+  807689:	ff ff ff 
+  80768c:	48 01 d8             	add    %rbx,%rax
+  80768f:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  807691:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  807694:	48 63 d0             	movslq %eax,%rdx
+  807697:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80769e:	48 89 d6             	mov    %rdx,%rsi
+  8076a1:	48 89 c7             	mov    %rax,%rdi
+  8076a4:	49 89 df             	mov    %rbx,%r15
+  8076a7:	48 b8 1e 70 ff ff ff 	movabs $0xffffffffffff701e,%rax
+  8076ae:	ff ff ff 
+  8076b1:	48 01 d8             	add    %rbx,%rax
+  8076b4:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8076b6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8076b9:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8076bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8076bf:	48 98                	cltq
+  8076c1:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8076c8:	0f 82 6e ff ff ff    	jb     80763c <devcons_write+0x43>
+	}
+	return tot;
+  8076ce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8076d1:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8076d8:	5b                   	pop    %rbx
+  8076d9:	41 5f                	pop    %r15
+  8076db:	5d                   	pop    %rbp
+  8076dc:	c3                   	ret
+
+00000000008076dd <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  8076dd:	55                   	push   %rbp
+  8076de:	48 89 e5             	mov    %rsp,%rbp
+  8076e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8076e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8076e5 <devcons_close+0x8>
+  8076ec:	49 bb 5b 39 00 00 00 	movabs $0x395b,%r11
+  8076f3:	00 00 00 
+  8076f6:	4c 01 d8             	add    %r11,%rax
+  8076f9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8076fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807702:	c9                   	leave
+  807703:	c3                   	ret
+
+0000000000807704 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  807704:	55                   	push   %rbp
+  807705:	48 89 e5             	mov    %rsp,%rbp
+  807708:	41 57                	push   %r15
+  80770a:	48 83 ec 18          	sub    $0x18,%rsp
+  80770e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80770e <devcons_stat+0xa>
+  807715:	49 bb 32 39 00 00 00 	movabs $0x3932,%r11
+  80771c:	00 00 00 
+  80771f:	4c 01 d8             	add    %r11,%rax
+  807722:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  807726:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  80772a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80772e:	48 b9 bb d9 ff ff ff 	movabs $0xffffffffffffd9bb,%rcx
+  807735:	ff ff ff 
+  807738:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80773c:	48 89 ce             	mov    %rcx,%rsi
+  80773f:	48 89 d7             	mov    %rdx,%rdi
+  807742:	49 89 c7             	mov    %rax,%r15
+  807745:	48 ba 1a 65 ff ff ff 	movabs $0xffffffffffff651a,%rdx
+  80774c:	ff ff ff 
+  80774f:	48 01 c2             	add    %rax,%rdx
+  807752:	ff d2                	call   *%rdx
+	return 0;
+  807754:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807759:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80775d:	c9                   	leave
+  80775e:	c3                   	ret
+
+000000000080775f <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80775f:	55                   	push   %rbp
+  807760:	48 89 e5             	mov    %rsp,%rbp
+  807763:	41 57                	push   %r15
+  807765:	53                   	push   %rbx
+  807766:	48 83 ec 20          	sub    $0x20,%rsp
+  80776a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80776a <set_pgfault_handler+0xb>
+  807771:	49 bb d6 38 00 00 00 	movabs $0x38d6,%r11
+  807778:	00 00 00 
+  80777b:	4c 01 db             	add    %r11,%rbx
+  80777e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  807782:	49 89 df             	mov    %rbx,%r15
+  807785:	48 b8 2d 71 ff ff ff 	movabs $0xffffffffffff712d,%rax
+  80778c:	ff ff ff 
+  80778f:	48 01 d8             	add    %rbx,%rax
+  807792:	ff d0                	call   *%rax
+  807794:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  807797:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  80779e:	00 00 00 
+  8077a1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8077a5:	48 85 c0             	test   %rax,%rax
+  8077a8:	75 6b                	jne    807815 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  8077aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8077ad:	ba 07 00 00 00       	mov    $0x7,%edx
+  8077b2:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8077b7:	48 89 ce             	mov    %rcx,%rsi
+  8077ba:	89 c7                	mov    %eax,%edi
+  8077bc:	49 89 df             	mov    %rbx,%r15
+  8077bf:	48 b8 d6 71 ff ff ff 	movabs $0xffffffffffff71d6,%rax
+  8077c6:	ff ff ff 
+  8077c9:	48 01 d8             	add    %rbx,%rax
+  8077cc:	ff d0                	call   *%rax
+  8077ce:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  8077d1:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8077d5:	74 3e                	je     807815 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  8077d7:	48 b8 c8 d9 ff ff ff 	movabs $0xffffffffffffd9c8,%rax
+  8077de:	ff ff ff 
+  8077e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8077e5:	48 89 c2             	mov    %rax,%rdx
+  8077e8:	be 23 00 00 00       	mov    $0x23,%esi
+  8077ed:	48 b8 f6 d9 ff ff ff 	movabs $0xffffffffffffd9f6,%rax
+  8077f4:	ff ff ff 
+  8077f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8077fb:	48 89 c7             	mov    %rax,%rdi
+  8077fe:	49 89 df             	mov    %rbx,%r15
+  807801:	b8 00 00 00 00       	mov    $0x0,%eax
+  807806:	48 b9 81 54 ff ff ff 	movabs $0xffffffffffff5481,%rcx
+  80780d:	ff ff ff 
+  807810:	48 01 d9             	add    %rbx,%rcx
+  807813:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  807815:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  80781c:	00 00 00 
+  80781f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807823:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  807827:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80782a:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  807831:	ff ff ff 
+  807834:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  807838:	48 89 d6             	mov    %rdx,%rsi
+  80783b:	89 c7                	mov    %eax,%edi
+  80783d:	49 89 df             	mov    %rbx,%r15
+  807840:	48 b8 cc 73 ff ff ff 	movabs $0xffffffffffff73cc,%rax
+  807847:	ff ff ff 
+  80784a:	48 01 d8             	add    %rbx,%rax
+  80784d:	ff d0                	call   *%rax
+}
+  80784f:	90                   	nop
+  807850:	48 83 c4 20          	add    $0x20,%rsp
+  807854:	5b                   	pop    %rbx
+  807855:	41 5f                	pop    %r15
+  807857:	5d                   	pop    %rbp
+  807858:	c3                   	ret
+
+0000000000807859 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  807859:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  80785c:	48 a1 00 10 82 00 00 	movabs 0x821000,%rax
+  807863:	00 00 00 
+call *%rax
+  807866:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  807868:	58                   	pop    %rax
+	popq %rax;
+  807869:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  80786a:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  807871:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  807875:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  807879:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  80787d:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  807881:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  807885:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  807888:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  80788c:	4c 8b 3c 24          	mov    (%rsp),%r15
+  807890:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  807895:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80789a:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80789f:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8078a4:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8078a9:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8078ae:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8078b3:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8078b8:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8078bd:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8078c2:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8078c7:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8078cc:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8078d1:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8078d6:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  8078da:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  8078de:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  8078df:	5c                   	pop    %rsp
+	ret;			//return
+  8078e0:	c3                   	ret
+
+00000000008078e1 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8078e1:	55                   	push   %rbp
+  8078e2:	48 89 e5             	mov    %rsp,%rbp
+  8078e5:	41 57                	push   %r15
+  8078e7:	53                   	push   %rbx
+  8078e8:	48 83 ec 30          	sub    $0x30,%rsp
+  8078ec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8078ec <ipc_recv+0xb>
+  8078f3:	49 bb 54 37 00 00 00 	movabs $0x3754,%r11
+  8078fa:	00 00 00 
+  8078fd:	4c 01 db             	add    %r11,%rbx
+  807900:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  807904:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  807908:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  80790c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  807911:	75 0e                	jne    807921 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  807913:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80791a:	00 00 00 
+  80791d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  807921:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  807925:	48 89 c7             	mov    %rax,%rdi
+  807928:	49 89 df             	mov    %rbx,%r15
+  80792b:	48 b8 ff 74 ff ff ff 	movabs $0xffffffffffff74ff,%rax
+  807932:	ff ff ff 
+  807935:	48 01 d8             	add    %rbx,%rax
+  807938:	ff d0                	call   *%rax
+  80793a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  80793d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  807942:	74 2a                	je     80796e <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  807944:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807948:	75 19                	jne    807963 <ipc_recv+0x82>
+  80794a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807951:	ff ff ff 
+  807954:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807958:	48 8b 00             	mov    (%rax),%rax
+  80795b:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  807961:	eb 05                	jmp    807968 <ipc_recv+0x87>
+  807963:	b8 00 00 00 00       	mov    $0x0,%eax
+  807968:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80796c:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80796e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  807973:	74 2a                	je     80799f <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  807975:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807979:	75 19                	jne    807994 <ipc_recv+0xb3>
+  80797b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807982:	ff ff ff 
+  807985:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807989:	48 8b 00             	mov    (%rax),%rax
+  80798c:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  807992:	eb 05                	jmp    807999 <ipc_recv+0xb8>
+  807994:	b8 00 00 00 00       	mov    $0x0,%eax
+  807999:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80799d:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80799f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8079a3:	74 05                	je     8079aa <ipc_recv+0xc9>
+		return res;
+  8079a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8079a8:	eb 17                	jmp    8079c1 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  8079aa:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8079b1:	ff ff ff 
+  8079b4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8079b8:	48 8b 00             	mov    (%rax),%rax
+  8079bb:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8079c1:	48 83 c4 30          	add    $0x30,%rsp
+  8079c5:	5b                   	pop    %rbx
+  8079c6:	41 5f                	pop    %r15
+  8079c8:	5d                   	pop    %rbp
+  8079c9:	c3                   	ret
+
+00000000008079ca <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8079ca:	55                   	push   %rbp
+  8079cb:	48 89 e5             	mov    %rsp,%rbp
+  8079ce:	41 57                	push   %r15
+  8079d0:	53                   	push   %rbx
+  8079d1:	48 83 ec 20          	sub    $0x20,%rsp
+  8079d5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8079d5 <ipc_send+0xb>
+  8079dc:	49 bb 6b 36 00 00 00 	movabs $0x366b,%r11
+  8079e3:	00 00 00 
+  8079e6:	4c 01 db             	add    %r11,%rbx
+  8079e9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8079ec:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8079ef:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8079f3:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8079f6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8079fb:	75 0e                	jne    807a0b <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8079fd:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  807a04:	00 00 00 
+  807a07:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  807a0b:	90                   	nop
+  807a0c:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  807a0f:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  807a12:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807a16:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807a19:	89 c7                	mov    %eax,%edi
+  807a1b:	49 89 df             	mov    %rbx,%r15
+  807a1e:	48 b8 95 74 ff ff ff 	movabs $0xffffffffffff7495,%rax
+  807a25:	ff ff ff 
+  807a28:	48 01 d8             	add    %rbx,%rax
+  807a2b:	ff d0                	call   *%rax
+  807a2d:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  807a30:	74 da                	je     807a0c <ipc_send+0x42>
+		;
+}
+  807a32:	90                   	nop
+  807a33:	90                   	nop
+  807a34:	48 83 c4 20          	add    $0x20,%rsp
+  807a38:	5b                   	pop    %rbx
+  807a39:	41 5f                	pop    %r15
+  807a3b:	5d                   	pop    %rbp
+  807a3c:	c3                   	ret
+
+0000000000807a3d <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  807a3d:	55                   	push   %rbp
+  807a3e:	48 89 e5             	mov    %rsp,%rbp
+  807a41:	41 57                	push   %r15
+  807a43:	53                   	push   %rbx
+  807a44:	48 83 ec 40          	sub    $0x40,%rsp
+  807a48:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807a48 <ipc_call+0xb>
+  807a4f:	49 bb f8 35 00 00 00 	movabs $0x35f8,%r11
+  807a56:	00 00 00 
+  807a59:	4c 01 db             	add    %r11,%rbx
+  807a5c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  807a5f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  807a62:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  807a66:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  807a69:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  807a6d:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  807a71:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  807a76:	75 0e                	jne    807a86 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  807a78:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  807a7f:	00 00 00 
+  807a82:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  807a86:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  807a8b:	75 0e                	jne    807a9b <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  807a8d:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  807a94:	00 00 00 
+  807a97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  807a9b:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  807a9e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  807aa2:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  807aa5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  807aa9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807aac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  807ab2:	49 89 f8             	mov    %rdi,%r8
+  807ab5:	89 c7                	mov    %eax,%edi
+  807ab7:	49 89 df             	mov    %rbx,%r15
+  807aba:	48 b8 58 75 ff ff ff 	movabs $0xffffffffffff7558,%rax
+  807ac1:	ff ff ff 
+  807ac4:	48 01 d8             	add    %rbx,%rax
+  807ac7:	ff d0                	call   *%rax
+  807ac9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  807acc:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  807ad1:	74 2a                	je     807afd <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  807ad3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807ad7:	75 19                	jne    807af2 <ipc_call+0xb5>
+  807ad9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807ae0:	ff ff ff 
+  807ae3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807ae7:	48 8b 00             	mov    (%rax),%rax
+  807aea:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  807af0:	eb 05                	jmp    807af7 <ipc_call+0xba>
+  807af2:	b8 00 00 00 00       	mov    $0x0,%eax
+  807af7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  807afb:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  807afd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807b01:	74 05                	je     807b08 <ipc_call+0xcb>
+		return r;
+  807b03:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807b06:	eb 17                	jmp    807b1f <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  807b08:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807b0f:	ff ff ff 
+  807b12:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807b16:	48 8b 00             	mov    (%rax),%rax
+  807b19:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  807b1f:	48 83 c4 40          	add    $0x40,%rsp
+  807b23:	5b                   	pop    %rbx
+  807b24:	41 5f                	pop    %r15
+  807b26:	5d                   	pop    %rbp
+  807b27:	c3                   	ret
+
+0000000000807b28 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  807b28:	55                   	push   %rbp
+  807b29:	48 89 e5             	mov    %rsp,%rbp
+  807b2c:	41 57                	push   %r15
+  807b2e:	53                   	push   %rbx
+  807b2f:	48 83 ec 70          	sub    $0x70,%rsp
+  807b33:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807b33 <ipc_callw+0xb>
+  807b3a:	49 bb 0d 35 00 00 00 	movabs $0x350d,%r11
+  807b41:	00 00 00 
+  807b44:	4c 01 db             	add    %r11,%rbx
+  807b47:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  807b4a:	89 75 98             	mov    %esi,-0x68(%rbp)
+  807b4d:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  807b51:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  807b55:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  807b5a:	76 0a                	jbe    807b66 <ipc_callw+0x3e>
+		return -E_INVAL;
+  807b5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807b61:	e9 b7 00 00 00       	jmp    807c1d <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  807b66:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  807b6a:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  807b6e:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  807b72:	48 89 ce             	mov    %rcx,%rsi
+  807b75:	48 89 c7             	mov    %rax,%rdi
+  807b78:	49 89 df             	mov    %rbx,%r15
+  807b7b:	48 b8 fa 68 ff ff ff 	movabs $0xffffffffffff68fa,%rax
+  807b82:	ff ff ff 
+  807b85:	48 01 d8             	add    %rbx,%rax
+  807b88:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  807b8a:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  807b91:	00 
+  807b92:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  807b96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807b9a:	48 01 d0             	add    %rdx,%rax
+  807b9d:	48 83 e8 01          	sub    $0x1,%rax
+  807ba1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  807ba5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807ba9:	ba 00 00 00 00       	mov    $0x0,%edx
+  807bae:	48 f7 75 e8          	divq   -0x18(%rbp)
+  807bb2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807bb6:	48 29 d0             	sub    %rdx,%rax
+  807bb9:	48 c1 e8 03          	shr    $0x3,%rax
+  807bbd:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  807bc1:	89 c1                	mov    %eax,%ecx
+  807bc3:	8b 75 98             	mov    -0x68(%rbp),%esi
+  807bc6:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  807bca:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  807bcd:	49 89 d1             	mov    %rdx,%r9
+  807bd0:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  807bd7:	00 00 00 
+  807bda:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  807be1:	00 00 00 
+  807be4:	89 c7                	mov    %eax,%edi
+  807be6:	49 89 df             	mov    %rbx,%r15
+  807be9:	48 b8 58 75 ff ff ff 	movabs $0xffffffffffff7558,%rax
+  807bf0:	ff ff ff 
+  807bf3:	48 01 d8             	add    %rbx,%rax
+  807bf6:	ff d0                	call   *%rax
+  807bf8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  807bfb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  807bff:	74 05                	je     807c06 <ipc_callw+0xde>
+		return r;
+  807c01:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807c04:	eb 17                	jmp    807c1d <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  807c06:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807c0d:	ff ff ff 
+  807c10:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807c14:	48 8b 00             	mov    (%rax),%rax
+  807c17:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  807c1d:	48 83 c4 70          	add    $0x70,%rsp
+  807c21:	5b                   	pop    %rbx
+  807c22:	41 5f                	pop    %r15
+  807c24:	5d                   	pop    %rbp
+  807c25:	c3                   	ret
+
+0000000000807c26 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  807c26:	55                   	push   %rbp
+  807c27:	48 89 e5             	mov    %rsp,%rbp
+  807c2a:	41 57                	push   %r15
+  807c2c:	53                   	push   %rbx
+  807c2d:	48 83 ec 40          	sub    $0x40,%rsp
+  807c31:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807c31 <ipc_callv+0xb>
+  807c38:	49 bb 0f 34 00 00 00 	movabs $0x340f,%r11
+  807c3f:	00 00 00 
+  807c42:	4c 01 db             	add    %r11,%rbx
+  807c45:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  807c48:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  807c4b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  807c4f:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  807c52:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  807c56:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  807c5a:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  807c61:	00 00 00 
+  807c64:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  807c68:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  807c6c:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  807c70:	74 11                	je     807c83 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  807c72:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  807c76:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  807c7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807c7d:	c1 e0 14             	shl    $0x14,%eax
+  807c80:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  807c83:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  807c87:	74 14                	je     807c9d <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  807c89:	8b 45 20             	mov    0x20(%rbp),%eax
+  807c8c:	83 e8 01             	sub    $0x1,%eax
+  807c8f:	48 63 d0             	movslq %eax,%rdx
+  807c92:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  807c96:	48 09 d0             	or     %rdx,%rax
+  807c99:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  807c9d:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  807ca0:	c1 e0 10             	shl    $0x10,%eax
+  807ca3:	0b 45 10             	or     0x10(%rbp),%eax
+  807ca6:	89 c1                	mov    %eax,%ecx
+  807ca8:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  807cab:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  807caf:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  807cb3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807cb7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  807cba:	4d 89 c1             	mov    %r8,%r9
+  807cbd:	49 89 f8             	mov    %rdi,%r8
+  807cc0:	89 c7                	mov    %eax,%edi
+  807cc2:	49 89 df             	mov    %rbx,%r15
+  807cc5:	48 b8 58 75 ff ff ff 	movabs $0xffffffffffff7558,%rax
+  807ccc:	ff ff ff 
+  807ccf:	48 01 d8             	add    %rbx,%rax
+  807cd2:	ff d0                	call   *%rax
+  807cd4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  807cd7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  807cdb:	74 05                	je     807ce2 <ipc_callv+0xbc>
+		return r;
+  807cdd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807ce0:	eb 17                	jmp    807cf9 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  807ce2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807ce9:	ff ff ff 
+  807cec:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807cf0:	48 8b 00             	mov    (%rax),%rax
+  807cf3:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  807cf9:	48 83 c4 40          	add    $0x40,%rsp
+  807cfd:	5b                   	pop    %rbx
+  807cfe:	41 5f                	pop    %r15
+  807d00:	5d                   	pop    %rbp
+  807d01:	c3                   	ret
+
+0000000000807d02 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  807d02:	55                   	push   %rbp
+  807d03:	48 89 e5             	mov    %rsp,%rbp
+  807d06:	41 57                	push   %r15
+  807d08:	53                   	push   %rbx
+  807d09:	48 83 ec 40          	sub    $0x40,%rsp
+  807d0d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807d0d <ipc_reply_recv+0xb>
+  807d14:	49 bb 33 33 00 00 00 	movabs $0x3333,%r11
+  807d1b:	00 00 00 
+  807d1e:	4c 01 db             	add    %r11,%rbx
+  807d21:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  807d24:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  807d27:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  807d2b:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  807d2e:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  807d32:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  807d36:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  807d3b:	75 0e                	jne    807d4b <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  807d3d:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  807d44:	00 00 00 
+  807d47:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  807d4b:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  807d50:	75 0e                	jne    807d60 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  807d52:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  807d59:	00 00 00 
+  807d5c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  807d60:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  807d63:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  807d67:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  807d6b:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  807d6e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  807d72:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807d75:	4d 89 c1             	mov    %r8,%r9
+  807d78:	49 89 f8             	mov    %rdi,%r8
+  807d7b:	89 c7                	mov    %eax,%edi
+  807d7d:	49 89 df             	mov    %rbx,%r15
+  807d80:	48 b8 cc 75 ff ff ff 	movabs $0xffffffffffff75cc,%rax
+  807d87:	ff ff ff 
+  807d8a:	48 01 d8             	add    %rbx,%rax
+  807d8d:	ff d0                	call   *%rax
+  807d8f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  807d92:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  807d97:	74 2a                	je     807dc3 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  807d99:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807d9d:	75 19                	jne    807db8 <ipc_reply_recv+0xb6>
+  807d9f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807da6:	ff ff ff 
+  807da9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807dad:	48 8b 00             	mov    (%rax),%rax
+  807db0:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  807db6:	eb 05                	jmp    807dbd <ipc_reply_recv+0xbb>
+  807db8:	b8 00 00 00 00       	mov    $0x0,%eax
+  807dbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807dc1:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  807dc3:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  807dc8:	74 2a                	je     807df4 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  807dca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807dce:	75 19                	jne    807de9 <ipc_reply_recv+0xe7>
+  807dd0:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807dd7:	ff ff ff 
+  807dda:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807dde:	48 8b 00             	mov    (%rax),%rax
+  807de1:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  807de7:	eb 05                	jmp    807dee <ipc_reply_recv+0xec>
+  807de9:	b8 00 00 00 00       	mov    $0x0,%eax
+  807dee:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  807df2:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  807df4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807df8:	74 05                	je     807dff <ipc_reply_recv+0xfd>
+		return r;
+  807dfa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807dfd:	eb 17                	jmp    807e16 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  807dff:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807e06:	ff ff ff 
+  807e09:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807e0d:	48 8b 00             	mov    (%rax),%rax
+  807e10:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  807e16:	48 83 c4 40          	add    $0x40,%rsp
+  807e1a:	5b                   	pop    %rbx
+  807e1b:	41 5f                	pop    %r15
+  807e1d:	5d                   	pop    %rbp
+  807e1e:	c3                   	ret
+
+0000000000807e1f <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  807e1f:	55                   	push   %rbp
+  807e20:	48 89 e5             	mov    %rsp,%rbp
+  807e23:	41 57                	push   %r15
+  807e25:	53                   	push   %rbx
+  807e26:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  807e2d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807e2d <ipc_window_batch+0xe>
+  807e34:	49 bb 13 32 00 00 00 	movabs $0x3213,%r11
+  807e3b:	00 00 00 
+  807e3e:	4c 01 db             	add    %r11,%rbx
+  807e41:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  807e47:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  807e4e:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  807e54:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  807e5a:	e9 15 01 00 00       	jmp    807f74 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  807e5f:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  807e65:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  807e68:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  807e6f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  807e72:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  807e75:	39 c2                	cmp    %eax,%edx
+  807e77:	0f 4e c2             	cmovle %edx,%eax
+  807e7a:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  807e7d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  807e84:	eb 6b                	jmp    807ef1 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  807e86:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807e89:	48 98                	cltq
+  807e8b:	48 c1 e0 05          	shl    $0x5,%rax
+  807e8f:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  807e93:	48 01 e8             	add    %rbp,%rax
+  807e96:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  807e9c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  807ea2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807ea5:	c1 e0 0c             	shl    $0xc,%eax
+  807ea8:	48 63 d0             	movslq %eax,%rdx
+  807eab:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  807eb2:	48 01 c2             	add    %rax,%rdx
+  807eb5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807eb8:	48 98                	cltq
+  807eba:	48 c1 e0 05          	shl    $0x5,%rax
+  807ebe:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  807ec2:	48 01 e8             	add    %rbp,%rax
+  807ec5:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  807ecb:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  807ece:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807ed1:	48 98                	cltq
+  807ed3:	48 c1 e0 05          	shl    $0x5,%rax
+  807ed7:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  807edb:	48 01 e8             	add    %rbp,%rax
+  807ede:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  807ee5:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  807eeb:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  807eed:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  807ef1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807ef4:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  807ef7:	7c 8d                	jl     807e86 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  807ef9:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  807f00:	74 27                	je     807f29 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  807f02:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807f05:	48 63 d0             	movslq %eax,%rdx
+  807f08:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  807f0f:	48 89 d6             	mov    %rdx,%rsi
+  807f12:	48 89 c7             	mov    %rax,%rdi
+  807f15:	49 89 df             	mov    %rbx,%r15
+  807f18:	48 b8 6f 78 ff ff ff 	movabs $0xffffffffffff786f,%rax
+  807f1f:	ff ff ff 
+  807f22:	48 01 d8             	add    %rbx,%rax
+  807f25:	ff d0                	call   *%rax
+  807f27:	eb 25                	jmp    807f4e <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  807f29:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807f2c:	48 63 d0             	movslq %eax,%rdx
+  807f2f:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  807f36:	48 89 d6             	mov    %rdx,%rsi
+  807f39:	48 89 c7             	mov    %rax,%rdi
+  807f3c:	49 89 df             	mov    %rbx,%r15
+  807f3f:	48 b8 cd 78 ff ff ff 	movabs $0xffffffffffff78cd,%rax
+  807f46:	ff ff ff 
+  807f49:	48 01 d8             	add    %rbx,%rax
+  807f4c:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  807f4e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  807f51:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  807f55:	79 05                	jns    807f5c <ipc_window_batch+0x13d>
+			return r;
+  807f57:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807f5a:	eb 2a                	jmp    807f86 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  807f5c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807f5f:	c1 e0 0c             	shl    $0xc,%eax
+  807f62:	48 98                	cltq
+  807f64:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  807f6b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807f6e:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  807f74:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  807f7b:	0f 8f de fe ff ff    	jg     807e5f <ipc_window_batch+0x40>
+	}
+	return 0;
+  807f81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807f86:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  807f8d:	5b                   	pop    %rbx
+  807f8e:	41 5f                	pop    %r15
+  807f90:	5d                   	pop    %rbp
+  807f91:	c3                   	ret
+
+0000000000807f92 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  807f92:	55                   	push   %rbp
+  807f93:	48 89 e5             	mov    %rsp,%rbp
+  807f96:	48 83 ec 10          	sub    $0x10,%rsp
+  807f9a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807f9a <ipc_map_window+0x8>
+  807fa1:	49 bb a6 30 00 00 00 	movabs $0x30a6,%r11
+  807fa8:	00 00 00 
+  807fab:	4c 01 d8             	add    %r11,%rax
+  807fae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  807fb2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  807fb5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807fb8:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  807fbc:	b9 07 00 00 00       	mov    $0x7,%ecx
+  807fc1:	bf 01 00 00 00       	mov    $0x1,%edi
+  807fc6:	49 b8 df cd ff ff ff 	movabs $0xffffffffffffcddf,%r8
+  807fcd:	ff ff ff 
+  807fd0:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  807fd4:	ff d0                	call   *%rax
+}
+  807fd6:	c9                   	leave
+  807fd7:	c3                   	ret
+
+0000000000807fd8 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  807fd8:	55                   	push   %rbp
+  807fd9:	48 89 e5             	mov    %rsp,%rbp
+  807fdc:	48 83 ec 10          	sub    $0x10,%rsp
+  807fe0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807fe0 <ipc_unmap_window+0x8>
+  807fe7:	49 bb 60 30 00 00 00 	movabs $0x3060,%r11
+  807fee:	00 00 00 
+  807ff1:	4c 01 d8             	add    %r11,%rax
+  807ff4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  807ff8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  807ffb:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807ffe:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  808002:	b9 00 00 00 00       	mov    $0x0,%ecx
+  808007:	bf 00 00 00 00       	mov    $0x0,%edi
+  80800c:	49 b8 df cd ff ff ff 	movabs $0xffffffffffffcddf,%r8
+  808013:	ff ff ff 
+  808016:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80801a:	ff d0                	call   *%rax
+}
+  80801c:	c9                   	leave
+  80801d:	c3                   	ret
+
+000000000080801e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80801e:	55                   	push   %rbp
+  80801f:	48 89 e5             	mov    %rsp,%rbp
+  808022:	48 83 ec 18          	sub    $0x18,%rsp
+  808026:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 808026 <ipc_find_env+0x8>
+  80802d:	49 bb 1a 30 00 00 00 	movabs $0x301a,%r11
+  808034:	00 00 00 
+  808037:	4c 01 d8             	add    %r11,%rax
+  80803a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  80803d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  808044:	eb 57                	jmp    80809d <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  808046:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80804d:	ff ff ff 
+  808050:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  808054:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  808057:	48 63 d2             	movslq %edx,%rdx
+  80805a:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  808061:	48 01 ca             	add    %rcx,%rdx
+  808064:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  80806b:	8b 12                	mov    (%rdx),%edx
+  80806d:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  808070:	75 27                	jne    808099 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  808072:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  808079:	ff ff ff 
+  80807c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  808080:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  808083:	48 98                	cltq
+  808085:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80808c:	48 01 d0             	add    %rdx,%rax
+  80808f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  808095:	8b 00                	mov    (%rax),%eax
+  808097:	eb 12                	jmp    8080ab <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  808099:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80809d:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8080a4:	7e a0                	jle    808046 <ipc_find_env+0x28>
+	}
+	return 0;
+  8080a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8080ab:	c9                   	leave
+  8080ac:	c3                   	ret
+
+00000000008080ad <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8080ad:	55                   	push   %rbp
+  8080ae:	48 89 e5             	mov    %rsp,%rbp
+  8080b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8080b5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8080b5 <pageref+0x8>
+  8080bc:	49 bb 8b 2f 00 00 00 	movabs $0x2f8b,%r11
+  8080c3:	00 00 00 
+  8080c6:	4c 01 d8             	add    %r11,%rax
+  8080c9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  8080cd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8080d1:	48 89 d1             	mov    %rdx,%rcx
+  8080d4:	48 c1 e9 15          	shr    $0x15,%rcx
+  8080d8:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8080df:	ff ff ff 
+  8080e2:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8080e6:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8080ea:	83 e2 01             	and    $0x1,%edx
+  8080ed:	48 85 d2             	test   %rdx,%rdx
+  8080f0:	75 07                	jne    8080f9 <pageref+0x4c>
+		return 0;
+  8080f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8080f7:	eb 64                	jmp    80815d <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  8080f9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8080fd:	48 89 d1             	mov    %rdx,%rcx
+  808100:	48 c1 e9 0c          	shr    $0xc,%rcx
+  808104:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  80810b:	ff ff ff 
+  80810e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  808112:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  808116:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  80811a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80811e:	83 e2 01             	and    $0x1,%edx
+  808121:	48 85 d2             	test   %rdx,%rdx
+  808124:	75 07                	jne    80812d <pageref+0x80>
+		return 0;
+  808126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80812b:	eb 30                	jmp    80815d <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  80812d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  808131:	48 c1 ea 0c          	shr    $0xc,%rdx
+  808135:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  80813c:	ff ff ff 
+  80813f:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  808143:	48 89 d0             	mov    %rdx,%rax
+  808146:	48 01 c0             	add    %rax,%rax
+  808149:	48 01 d0             	add    %rdx,%rax
+  80814c:	48 c1 e0 03          	shl    $0x3,%rax
+  808150:	48 01 c8             	add    %rcx,%rax
+  808153:	48 83 c0 08          	add    $0x8,%rax
+  808157:	0f b7 00             	movzwl (%rax),%eax
+  80815a:	0f b7 c0             	movzwl %ax,%eax
+}
+  80815d:	c9                   	leave
+  80815e:	c3                   	ret
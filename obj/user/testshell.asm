@@ -0,0 +1,12568 @@
+
+obj/user/testshell:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 1f 0b 00 00       	call   800b60 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+void wrong(int, int, int);
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 40          	sub    $0x40,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb f2 af 00 00 00 	movabs $0xaff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  800065:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+	char c1, c2;
+	int r, rfd, wfd, kfd, n1, n2, off, nloff;
+	int pfds[2];
+
+	close(0);
+  800069:	bf 00 00 00 00       	mov    $0x0,%edi
+  80006e:	49 89 df             	mov    %rbx,%r15
+  800071:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  800078:	ff ff ff 
+  80007b:	48 01 d8             	add    %rbx,%rax
+  80007e:	ff d0                	call   *%rax
+	close(1);
+  800080:	bf 01 00 00 00       	mov    $0x1,%edi
+  800085:	49 89 df             	mov    %rbx,%r15
+  800088:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  80008f:	ff ff ff 
+  800092:	48 01 d8             	add    %rbx,%rax
+  800095:	ff d0                	call   *%rax
+	opencons();
+  800097:	49 89 df             	mov    %rbx,%r15
+  80009a:	48 b8 6c 58 ff ff ff 	movabs $0xffffffffffff586c,%rax
+  8000a1:	ff ff ff 
+  8000a4:	48 01 d8             	add    %rbx,%rax
+  8000a7:	ff d0                	call   *%rax
+	opencons();
+  8000a9:	49 89 df             	mov    %rbx,%r15
+  8000ac:	48 b8 6c 58 ff ff ff 	movabs $0xffffffffffff586c,%rax
+  8000b3:	ff ff ff 
+  8000b6:	48 01 d8             	add    %rbx,%rax
+  8000b9:	ff d0                	call   *%rax
+
+	if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  8000bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8000c0:	48 b8 f0 d4 ff ff ff 	movabs $0xffffffffffffd4f0,%rax
+  8000c7:	ff ff ff 
+  8000ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000ce:	48 89 c7             	mov    %rax,%rdi
+  8000d1:	49 89 df             	mov    %rbx,%r15
+  8000d4:	48 b8 fa 9a ff ff ff 	movabs $0xffffffffffff9afa,%rax
+  8000db:	ff ff ff 
+  8000de:	48 01 d8             	add    %rbx,%rax
+  8000e1:	ff d0                	call   *%rax
+  8000e3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8000e6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8000ea:	79 44                	jns    800130 <umain+0xed>
+		panic("open testshell.sh: %e", rfd);
+  8000ec:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8000ef:	89 c1                	mov    %eax,%ecx
+  8000f1:	48 b8 fd d4 ff ff ff 	movabs $0xffffffffffffd4fd,%rax
+  8000f8:	ff ff ff 
+  8000fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000ff:	48 89 c2             	mov    %rax,%rdx
+  800102:	be 13 00 00 00       	mov    $0x13,%esi
+  800107:	48 b8 13 d5 ff ff ff 	movabs $0xffffffffffffd513,%rax
+  80010e:	ff ff ff 
+  800111:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800115:	48 89 c7             	mov    %rax,%rdi
+  800118:	49 89 df             	mov    %rbx,%r15
+  80011b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800120:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  800127:	ff ff ff 
+  80012a:	49 01 d8             	add    %rbx,%r8
+  80012d:	41 ff d0             	call   *%r8
+	if ((wfd = pipe(pfds)) < 0)
+  800130:	48 8d 45 c4          	lea    -0x3c(%rbp),%rax
+  800134:	48 89 c7             	mov    %rax,%rdi
+  800137:	49 89 df             	mov    %rbx,%r15
+  80013a:	48 b8 9f c2 ff ff ff 	movabs $0xffffffffffffc29f,%rax
+  800141:	ff ff ff 
+  800144:	48 01 d8             	add    %rbx,%rax
+  800147:	ff d0                	call   *%rax
+  800149:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  80014c:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800150:	79 44                	jns    800196 <umain+0x153>
+		panic("pipe: %e", wfd);
+  800152:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800155:	89 c1                	mov    %eax,%ecx
+  800157:	48 b8 24 d5 ff ff ff 	movabs $0xffffffffffffd524,%rax
+  80015e:	ff ff ff 
+  800161:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800165:	48 89 c2             	mov    %rax,%rdx
+  800168:	be 15 00 00 00       	mov    $0x15,%esi
+  80016d:	48 b8 13 d5 ff ff ff 	movabs $0xffffffffffffd513,%rax
+  800174:	ff ff ff 
+  800177:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80017b:	48 89 c7             	mov    %rax,%rdi
+  80017e:	49 89 df             	mov    %rbx,%r15
+  800181:	b8 00 00 00 00       	mov    $0x0,%eax
+  800186:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  80018d:	ff ff ff 
+  800190:	49 01 d8             	add    %rbx,%r8
+  800193:	41 ff d0             	call   *%r8
+	wfd = pfds[1];
+  800196:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800199:	89 45 e0             	mov    %eax,-0x20(%rbp)
+
+	cprintf("running sh -x < testshell.sh | cat\n");
+  80019c:	48 b8 30 d5 ff ff ff 	movabs $0xffffffffffffd530,%rax
+  8001a3:	ff ff ff 
+  8001a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001aa:	48 89 c7             	mov    %rax,%rdi
+  8001ad:	49 89 df             	mov    %rbx,%r15
+  8001b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b5:	48 ba 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rdx
+  8001bc:	ff ff ff 
+  8001bf:	48 01 da             	add    %rbx,%rdx
+  8001c2:	ff d2                	call   *%rdx
+	if ((r = fork()) < 0)
+  8001c4:	49 89 df             	mov    %rbx,%r15
+  8001c7:	48 b8 0e 89 ff ff ff 	movabs $0xffffffffffff890e,%rax
+  8001ce:	ff ff ff 
+  8001d1:	48 01 d8             	add    %rbx,%rax
+  8001d4:	ff d0                	call   *%rax
+  8001d6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8001d9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8001dd:	79 44                	jns    800223 <umain+0x1e0>
+		panic("fork: %e", r);
+  8001df:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8001e2:	89 c1                	mov    %eax,%ecx
+  8001e4:	48 b8 54 d5 ff ff ff 	movabs $0xffffffffffffd554,%rax
+  8001eb:	ff ff ff 
+  8001ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001f2:	48 89 c2             	mov    %rax,%rdx
+  8001f5:	be 1a 00 00 00       	mov    $0x1a,%esi
+  8001fa:	48 b8 13 d5 ff ff ff 	movabs $0xffffffffffffd513,%rax
+  800201:	ff ff ff 
+  800204:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800208:	48 89 c7             	mov    %rax,%rdi
+  80020b:	49 89 df             	mov    %rbx,%r15
+  80020e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800213:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  80021a:	ff ff ff 
+  80021d:	49 01 d8             	add    %rbx,%r8
+  800220:	41 ff d0             	call   *%r8
+	if (r == 0) {
+  800223:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800227:	0f 85 5a 01 00 00    	jne    800387 <umain+0x344>
+		dup(rfd, 0);
+  80022d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800230:	be 00 00 00 00       	mov    $0x0,%esi
+  800235:	89 c7                	mov    %eax,%edi
+  800237:	49 89 df             	mov    %rbx,%r15
+  80023a:	48 b8 2c 91 ff ff ff 	movabs $0xffffffffffff912c,%rax
+  800241:	ff ff ff 
+  800244:	48 01 d8             	add    %rbx,%rax
+  800247:	ff d0                	call   *%rax
+		dup(wfd, 1);
+  800249:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80024c:	be 01 00 00 00       	mov    $0x1,%esi
+  800251:	89 c7                	mov    %eax,%edi
+  800253:	49 89 df             	mov    %rbx,%r15
+  800256:	48 b8 2c 91 ff ff ff 	movabs $0xffffffffffff912c,%rax
+  80025d:	ff ff ff 
+  800260:	48 01 d8             	add    %rbx,%rax
+  800263:	ff d0                	call   *%rax
+		close(rfd);
+  800265:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800268:	89 c7                	mov    %eax,%edi
+  80026a:	49 89 df             	mov    %rbx,%r15
+  80026d:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  800274:	ff ff ff 
+  800277:	48 01 d8             	add    %rbx,%rax
+  80027a:	ff d0                	call   *%rax
+		close(wfd);
+  80027c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80027f:	89 c7                	mov    %eax,%edi
+  800281:	49 89 df             	mov    %rbx,%r15
+  800284:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  80028b:	ff ff ff 
+  80028e:	48 01 d8             	add    %rbx,%rax
+  800291:	ff d0                	call   *%rax
+		if ((r = spawnl("/bin/sh", "sh", "-x", 0)) < 0)
+  800293:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800298:	48 b8 5d d5 ff ff ff 	movabs $0xffffffffffffd55d,%rax
+  80029f:	ff ff ff 
+  8002a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002a6:	48 89 c2             	mov    %rax,%rdx
+  8002a9:	48 b8 60 d5 ff ff ff 	movabs $0xffffffffffffd560,%rax
+  8002b0:	ff ff ff 
+  8002b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002b7:	48 89 c6             	mov    %rax,%rsi
+  8002ba:	48 b8 63 d5 ff ff ff 	movabs $0xffffffffffffd563,%rax
+  8002c1:	ff ff ff 
+  8002c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002c8:	48 89 c7             	mov    %rax,%rdi
+  8002cb:	49 89 df             	mov    %rbx,%r15
+  8002ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d3:	49 b8 76 a8 ff ff ff 	movabs $0xffffffffffffa876,%r8
+  8002da:	ff ff ff 
+  8002dd:	49 01 d8             	add    %rbx,%r8
+  8002e0:	41 ff d0             	call   *%r8
+  8002e3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8002e6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8002ea:	79 44                	jns    800330 <umain+0x2ed>
+			panic("spawn: %e", r);
+  8002ec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8002ef:	89 c1                	mov    %eax,%ecx
+  8002f1:	48 b8 6b d5 ff ff ff 	movabs $0xffffffffffffd56b,%rax
+  8002f8:	ff ff ff 
+  8002fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002ff:	48 89 c2             	mov    %rax,%rdx
+  800302:	be 21 00 00 00       	mov    $0x21,%esi
+  800307:	48 b8 13 d5 ff ff ff 	movabs $0xffffffffffffd513,%rax
+  80030e:	ff ff ff 
+  800311:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800315:	48 89 c7             	mov    %rax,%rdi
+  800318:	49 89 df             	mov    %rbx,%r15
+  80031b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800320:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  800327:	ff ff ff 
+  80032a:	49 01 d8             	add    %rbx,%r8
+  80032d:	41 ff d0             	call   *%r8
+		close(0);
+  800330:	bf 00 00 00 00       	mov    $0x0,%edi
+  800335:	49 89 df             	mov    %rbx,%r15
+  800338:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  80033f:	ff ff ff 
+  800342:	48 01 d8             	add    %rbx,%rax
+  800345:	ff d0                	call   *%rax
+		close(1);
+  800347:	bf 01 00 00 00       	mov    $0x1,%edi
+  80034c:	49 89 df             	mov    %rbx,%r15
+  80034f:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  800356:	ff ff ff 
+  800359:	48 01 d8             	add    %rbx,%rax
+  80035c:	ff d0                	call   *%rax
+		wait(r);
+  80035e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800361:	89 c7                	mov    %eax,%edi
+  800363:	49 89 df             	mov    %rbx,%r15
+  800366:	48 b8 14 ca ff ff ff 	movabs $0xffffffffffffca14,%rax
+  80036d:	ff ff ff 
+  800370:	48 01 d8             	add    %rbx,%rax
+  800373:	ff d0                	call   *%rax
+		exit();
+  800375:	49 89 df             	mov    %rbx,%r15
+  800378:	48 b8 e0 5b ff ff ff 	movabs $0xffffffffffff5be0,%rax
+  80037f:	ff ff ff 
+  800382:	48 01 d8             	add    %rbx,%rax
+  800385:	ff d0                	call   *%rax
+	}
+	close(rfd);
+  800387:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80038a:	89 c7                	mov    %eax,%edi
+  80038c:	49 89 df             	mov    %rbx,%r15
+  80038f:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  800396:	ff ff ff 
+  800399:	48 01 d8             	add    %rbx,%rax
+  80039c:	ff d0                	call   *%rax
+	close(wfd);
+  80039e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003a1:	89 c7                	mov    %eax,%edi
+  8003a3:	49 89 df             	mov    %rbx,%r15
+  8003a6:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  8003ad:	ff ff ff 
+  8003b0:	48 01 d8             	add    %rbx,%rax
+  8003b3:	ff d0                	call   *%rax
+
+	rfd = pfds[0];
+  8003b5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8003b8:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8003bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8003c0:	48 b8 75 d5 ff ff ff 	movabs $0xffffffffffffd575,%rax
+  8003c7:	ff ff ff 
+  8003ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003ce:	48 89 c7             	mov    %rax,%rdi
+  8003d1:	49 89 df             	mov    %rbx,%r15
+  8003d4:	48 b8 fa 9a ff ff ff 	movabs $0xffffffffffff9afa,%rax
+  8003db:	ff ff ff 
+  8003de:	48 01 d8             	add    %rbx,%rax
+  8003e1:	ff d0                	call   *%rax
+  8003e3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8003e6:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8003ea:	79 44                	jns    800430 <umain+0x3ed>
+		panic("open testshell.key for reading: %e", kfd);
+  8003ec:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8003ef:	89 c1                	mov    %eax,%ecx
+  8003f1:	48 b8 88 d5 ff ff ff 	movabs $0xffffffffffffd588,%rax
+  8003f8:	ff ff ff 
+  8003fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003ff:	48 89 c2             	mov    %rax,%rdx
+  800402:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800407:	48 b8 13 d5 ff ff ff 	movabs $0xffffffffffffd513,%rax
+  80040e:	ff ff ff 
+  800411:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800415:	48 89 c7             	mov    %rax,%rdi
+  800418:	49 89 df             	mov    %rbx,%r15
+  80041b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800420:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  800427:	ff ff ff 
+  80042a:	49 01 d8             	add    %rbx,%r8
+  80042d:	41 ff d0             	call   *%r8
+
+	nloff = 0;
+  800430:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+	for (off=0;; off++) {
+  800437:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+		n1 = read(rfd, &c1, 1);
+  80043e:	48 8d 4d cf          	lea    -0x31(%rbp),%rcx
+  800442:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800445:	ba 01 00 00 00       	mov    $0x1,%edx
+  80044a:	48 89 ce             	mov    %rcx,%rsi
+  80044d:	89 c7                	mov    %eax,%edi
+  80044f:	49 89 df             	mov    %rbx,%r15
+  800452:	48 b8 2b 93 ff ff ff 	movabs $0xffffffffffff932b,%rax
+  800459:	ff ff ff 
+  80045c:	48 01 d8             	add    %rbx,%rax
+  80045f:	ff d0                	call   *%rax
+  800461:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		n2 = read(kfd, &c2, 1);
+  800464:	48 8d 4d ce          	lea    -0x32(%rbp),%rcx
+  800468:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80046b:	ba 01 00 00 00       	mov    $0x1,%edx
+  800470:	48 89 ce             	mov    %rcx,%rsi
+  800473:	89 c7                	mov    %eax,%edi
+  800475:	49 89 df             	mov    %rbx,%r15
+  800478:	48 b8 2b 93 ff ff ff 	movabs $0xffffffffffff932b,%rax
+  80047f:	ff ff ff 
+  800482:	48 01 d8             	add    %rbx,%rax
+  800485:	ff d0                	call   *%rax
+  800487:	89 45 d0             	mov    %eax,-0x30(%rbp)
+		if (n1 < 0)
+  80048a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80048e:	79 44                	jns    8004d4 <umain+0x491>
+			panic("reading testshell.out: %e", n1);
+  800490:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800493:	89 c1                	mov    %eax,%ecx
+  800495:	48 b8 ab d5 ff ff ff 	movabs $0xffffffffffffd5ab,%rax
+  80049c:	ff ff ff 
+  80049f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004a3:	48 89 c2             	mov    %rax,%rdx
+  8004a6:	be 33 00 00 00       	mov    $0x33,%esi
+  8004ab:	48 b8 13 d5 ff ff ff 	movabs $0xffffffffffffd513,%rax
+  8004b2:	ff ff ff 
+  8004b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004b9:	48 89 c7             	mov    %rax,%rdi
+  8004bc:	49 89 df             	mov    %rbx,%r15
+  8004bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c4:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  8004cb:	ff ff ff 
+  8004ce:	49 01 d8             	add    %rbx,%r8
+  8004d1:	41 ff d0             	call   *%r8
+		if (n2 < 0)
+  8004d4:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8004d8:	79 44                	jns    80051e <umain+0x4db>
+			panic("reading testshell.key: %e", n2);
+  8004da:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8004dd:	89 c1                	mov    %eax,%ecx
+  8004df:	48 b8 c5 d5 ff ff ff 	movabs $0xffffffffffffd5c5,%rax
+  8004e6:	ff ff ff 
+  8004e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004ed:	48 89 c2             	mov    %rax,%rdx
+  8004f0:	be 35 00 00 00       	mov    $0x35,%esi
+  8004f5:	48 b8 13 d5 ff ff ff 	movabs $0xffffffffffffd513,%rax
+  8004fc:	ff ff ff 
+  8004ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800503:	48 89 c7             	mov    %rax,%rdi
+  800506:	49 89 df             	mov    %rbx,%r15
+  800509:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050e:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  800515:	ff ff ff 
+  800518:	49 01 d8             	add    %rbx,%r8
+  80051b:	41 ff d0             	call   *%r8
+		if (n1 == 0 && n2 == 0)
+  80051e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800522:	75 06                	jne    80052a <umain+0x4e7>
+  800524:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800528:	74 4f                	je     800579 <umain+0x536>
+			break;
+		if (n1 != 1 || n2 != 1 || c1 != c2)
+  80052a:	83 7d d4 01          	cmpl   $0x1,-0x2c(%rbp)
+  80052e:	75 12                	jne    800542 <umain+0x4ff>
+  800530:	83 7d d0 01          	cmpl   $0x1,-0x30(%rbp)
+  800534:	75 0c                	jne    800542 <umain+0x4ff>
+  800536:	0f b6 55 cf          	movzbl -0x31(%rbp),%edx
+  80053a:	0f b6 45 ce          	movzbl -0x32(%rbp),%eax
+  80053e:	38 c2                	cmp    %al,%dl
+  800540:	74 1d                	je     80055f <umain+0x51c>
+			wrong(rfd, kfd, nloff);
+  800542:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800545:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  800548:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80054b:	89 ce                	mov    %ecx,%esi
+  80054d:	89 c7                	mov    %eax,%edi
+  80054f:	48 b8 6e 55 ff ff ff 	movabs $0xffffffffffff556e,%rax
+  800556:	ff ff ff 
+  800559:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80055d:	ff d0                	call   *%rax
+		if (c1 == '\n')
+  80055f:	0f b6 45 cf          	movzbl -0x31(%rbp),%eax
+  800563:	3c 0a                	cmp    $0xa,%al
+  800565:	75 09                	jne    800570 <umain+0x52d>
+			nloff = off+1;
+  800567:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80056a:	83 c0 01             	add    $0x1,%eax
+  80056d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	for (off=0;; off++) {
+  800570:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+		n1 = read(rfd, &c1, 1);
+  800574:	e9 c5 fe ff ff       	jmp    80043e <umain+0x3fb>
+			break;
+  800579:	90                   	nop
+	}
+	cprintf("shell ran correctly\n");
+  80057a:	48 b8 df d5 ff ff ff 	movabs $0xffffffffffffd5df,%rax
+  800581:	ff ff ff 
+  800584:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800588:	48 89 c7             	mov    %rax,%rdi
+  80058b:	49 89 df             	mov    %rbx,%r15
+  80058e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800593:	48 ba 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rdx
+  80059a:	ff ff ff 
+  80059d:	48 01 da             	add    %rbx,%rdx
+  8005a0:	ff d2                	call   *%rdx
+static __inline void read_gdtr (uint64_t *gdtbase, uint16_t *gdtlimit) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  8005a2:	cc                   	int3
+}
+  8005a3:	90                   	nop
+
+	breakpoint();
+}
+  8005a4:	90                   	nop
+  8005a5:	48 83 c4 40          	add    $0x40,%rsp
+  8005a9:	5b                   	pop    %rbx
+  8005aa:	41 5f                	pop    %r15
+  8005ac:	5d                   	pop    %rbp
+  8005ad:	c3                   	ret
+
+00000000008005ae <wrong>:
+
+void
+wrong(int rfd, int kfd, int off)
+{
+  8005ae:	55                   	push   %rbp
+  8005af:	48 89 e5             	mov    %rsp,%rbp
+  8005b2:	41 57                	push   %r15
+  8005b4:	53                   	push   %rbx
+  8005b5:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  8005b9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8005b9 <wrong+0xb>
+  8005c0:	49 bb 87 aa 00 00 00 	movabs $0xaa87,%r11
+  8005c7:	00 00 00 
+  8005ca:	4c 01 db             	add    %r11,%rbx
+  8005cd:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8005d3:	89 b5 78 ff ff ff    	mov    %esi,-0x88(%rbp)
+  8005d9:	89 95 74 ff ff ff    	mov    %edx,-0x8c(%rbp)
+	char buf[100];
+	int n;
+
+	seek(rfd, off);
+  8005df:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  8005e5:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  8005eb:	89 d6                	mov    %edx,%esi
+  8005ed:	89 c7                	mov    %eax,%edi
+  8005ef:	49 89 df             	mov    %rbx,%r15
+  8005f2:	48 b8 e3 95 ff ff ff 	movabs $0xffffffffffff95e3,%rax
+  8005f9:	ff ff ff 
+  8005fc:	48 01 d8             	add    %rbx,%rax
+  8005ff:	ff d0                	call   *%rax
+	seek(kfd, off);
+  800601:	8b 95 74 ff ff ff    	mov    -0x8c(%rbp),%edx
+  800607:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80060d:	89 d6                	mov    %edx,%esi
+  80060f:	89 c7                	mov    %eax,%edi
+  800611:	49 89 df             	mov    %rbx,%r15
+  800614:	48 b8 e3 95 ff ff ff 	movabs $0xffffffffffff95e3,%rax
+  80061b:	ff ff ff 
+  80061e:	48 01 d8             	add    %rbx,%rax
+  800621:	ff d0                	call   *%rax
+
+	cprintf("shell produced incorrect output.\n");
+  800623:	48 b8 f8 d5 ff ff ff 	movabs $0xffffffffffffd5f8,%rax
+  80062a:	ff ff ff 
+  80062d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800631:	48 89 c7             	mov    %rax,%rdi
+  800634:	49 89 df             	mov    %rbx,%r15
+  800637:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063c:	48 ba 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rdx
+  800643:	ff ff ff 
+  800646:	48 01 da             	add    %rbx,%rdx
+  800649:	ff d2                	call   *%rdx
+	cprintf("expected:\n===\n");
+  80064b:	48 b8 1a d6 ff ff ff 	movabs $0xffffffffffffd61a,%rax
+  800652:	ff ff ff 
+  800655:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800659:	48 89 c7             	mov    %rax,%rdi
+  80065c:	49 89 df             	mov    %rbx,%r15
+  80065f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800664:	48 ba 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rdx
+  80066b:	ff ff ff 
+  80066e:	48 01 da             	add    %rbx,%rdx
+  800671:	ff d2                	call   *%rdx
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800673:	eb 22                	jmp    800697 <wrong+0xe9>
+		sys_cputs(buf, n);
+  800675:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800678:	48 63 d0             	movslq %eax,%rdx
+  80067b:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+  80067f:	48 89 d6             	mov    %rdx,%rsi
+  800682:	48 89 c7             	mov    %rax,%rdi
+  800685:	49 89 df             	mov    %rbx,%r15
+  800688:	48 b8 c7 77 ff ff ff 	movabs $0xffffffffffff77c7,%rax
+  80068f:	ff ff ff 
+  800692:	48 01 d8             	add    %rbx,%rax
+  800695:	ff d0                	call   *%rax
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800697:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  80069b:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8006a1:	ba 63 00 00 00       	mov    $0x63,%edx
+  8006a6:	48 89 ce             	mov    %rcx,%rsi
+  8006a9:	89 c7                	mov    %eax,%edi
+  8006ab:	49 89 df             	mov    %rbx,%r15
+  8006ae:	48 b8 2b 93 ff ff ff 	movabs $0xffffffffffff932b,%rax
+  8006b5:	ff ff ff 
+  8006b8:	48 01 d8             	add    %rbx,%rax
+  8006bb:	ff d0                	call   *%rax
+  8006bd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8006c0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8006c4:	7f af                	jg     800675 <wrong+0xc7>
+	cprintf("===\ngot:\n===\n");
+  8006c6:	48 b8 29 d6 ff ff ff 	movabs $0xffffffffffffd629,%rax
+  8006cd:	ff ff ff 
+  8006d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006d4:	48 89 c7             	mov    %rax,%rdi
+  8006d7:	49 89 df             	mov    %rbx,%r15
+  8006da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006df:	48 ba 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rdx
+  8006e6:	ff ff ff 
+  8006e9:	48 01 da             	add    %rbx,%rdx
+  8006ec:	ff d2                	call   *%rdx
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8006ee:	eb 22                	jmp    800712 <wrong+0x164>
+		sys_cputs(buf, n);
+  8006f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8006f3:	48 63 d0             	movslq %eax,%rdx
+  8006f6:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+  8006fa:	48 89 d6             	mov    %rdx,%rsi
+  8006fd:	48 89 c7             	mov    %rax,%rdi
+  800700:	49 89 df             	mov    %rbx,%r15
+  800703:	48 b8 c7 77 ff ff ff 	movabs $0xffffffffffff77c7,%rax
+  80070a:	ff ff ff 
+  80070d:	48 01 d8             	add    %rbx,%rax
+  800710:	ff d0                	call   *%rax
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  800712:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  800716:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  80071c:	ba 63 00 00 00       	mov    $0x63,%edx
+  800721:	48 89 ce             	mov    %rcx,%rsi
+  800724:	89 c7                	mov    %eax,%edi
+  800726:	49 89 df             	mov    %rbx,%r15
+  800729:	48 b8 2b 93 ff ff ff 	movabs $0xffffffffffff932b,%rax
+  800730:	ff ff ff 
+  800733:	48 01 d8             	add    %rbx,%rax
+  800736:	ff d0                	call   *%rax
+  800738:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80073b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80073f:	7f af                	jg     8006f0 <wrong+0x142>
+	cprintf("===\n");
+  800741:	48 b8 37 d6 ff ff ff 	movabs $0xffffffffffffd637,%rax
+  800748:	ff ff ff 
+  80074b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80074f:	48 89 c7             	mov    %rax,%rdi
+  800752:	49 89 df             	mov    %rbx,%r15
+  800755:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075a:	48 ba 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rdx
+  800761:	ff ff ff 
+  800764:	48 01 da             	add    %rbx,%rdx
+  800767:	ff d2                	call   *%rdx
+	exit();
+  800769:	49 89 df             	mov    %rbx,%r15
+  80076c:	48 b8 e0 5b ff ff ff 	movabs $0xffffffffffff5be0,%rax
+  800773:	ff ff ff 
+  800776:	48 01 d8             	add    %rbx,%rax
+  800779:	ff d0                	call   *%rax
+}
+  80077b:	90                   	nop
+  80077c:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  800780:	5b                   	pop    %rbx
+  800781:	41 5f                	pop    %r15
+  800783:	5d                   	pop    %rbp
+  800784:	c3                   	ret
+
+0000000000800785 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  800785:	55                   	push   %rbp
+  800786:	48 89 e5             	mov    %rsp,%rbp
+  800789:	41 57                	push   %r15
+  80078b:	48 83 ec 28          	sub    $0x28,%rsp
+  80078f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80078f <cputchar+0xa>
+  800796:	49 bb b1 a8 00 00 00 	movabs $0xa8b1,%r11
+  80079d:	00 00 00 
+  8007a0:	4c 01 d8             	add    %r11,%rax
+  8007a3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8007a6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8007a9:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8007ac:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8007b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8007b5:	48 89 d7             	mov    %rdx,%rdi
+  8007b8:	49 89 c7             	mov    %rax,%r15
+  8007bb:	48 ba c7 77 ff ff ff 	movabs $0xffffffffffff77c7,%rdx
+  8007c2:	ff ff ff 
+  8007c5:	48 01 c2             	add    %rax,%rdx
+  8007c8:	ff d2                	call   *%rdx
+}
+  8007ca:	90                   	nop
+  8007cb:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8007cf:	c9                   	leave
+  8007d0:	c3                   	ret
+
+00000000008007d1 <getchar>:
+
+int
+getchar(void)
+{
+  8007d1:	55                   	push   %rbp
+  8007d2:	48 89 e5             	mov    %rsp,%rbp
+  8007d5:	41 57                	push   %r15
+  8007d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8007db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007db <getchar+0xa>
+  8007e2:	49 bb 65 a8 00 00 00 	movabs $0xa865,%r11
+  8007e9:	00 00 00 
+  8007ec:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8007ef:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8007f3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8007f8:	48 89 ce             	mov    %rcx,%rsi
+  8007fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800800:	49 89 c7             	mov    %rax,%r15
+  800803:	48 b9 2b 93 ff ff ff 	movabs $0xffffffffffff932b,%rcx
+  80080a:	ff ff ff 
+  80080d:	48 01 c1             	add    %rax,%rcx
+  800810:	ff d1                	call   *%rcx
+  800812:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  800815:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800819:	79 05                	jns    800820 <getchar+0x4f>
+		return r;
+  80081b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80081e:	eb 14                	jmp    800834 <getchar+0x63>
+	if (r < 1)
+  800820:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800824:	7f 07                	jg     80082d <getchar+0x5c>
+		return -E_EOF;
+  800826:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80082b:	eb 07                	jmp    800834 <getchar+0x63>
+	return c;
+  80082d:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  800831:	0f b6 c0             	movzbl %al,%eax
+}
+  800834:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800838:	c9                   	leave
+  800839:	c3                   	ret
+
+000000000080083a <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  80083a:	55                   	push   %rbp
+  80083b:	48 89 e5             	mov    %rsp,%rbp
+  80083e:	41 57                	push   %r15
+  800840:	53                   	push   %rbx
+  800841:	48 83 ec 20          	sub    $0x20,%rsp
+  800845:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800845 <iscons+0xb>
+  80084c:	49 bb fb a7 00 00 00 	movabs $0xa7fb,%r11
+  800853:	00 00 00 
+  800856:	4c 01 db             	add    %r11,%rbx
+  800859:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80085c:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  800860:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800863:	48 89 d6             	mov    %rdx,%rsi
+  800866:	89 c7                	mov    %eax,%edi
+  800868:	49 89 df             	mov    %rbx,%r15
+  80086b:	48 b8 e4 8d ff ff ff 	movabs $0xffffffffffff8de4,%rax
+  800872:	ff ff ff 
+  800875:	48 01 d8             	add    %rbx,%rax
+  800878:	ff d0                	call   *%rax
+  80087a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80087d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800881:	79 05                	jns    800888 <iscons+0x4e>
+		return r;
+  800883:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800886:	eb 1b                	jmp    8008a3 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  800888:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80088c:	8b 10                	mov    (%rax),%edx
+  80088e:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  800895:	00 00 00 
+  800898:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80089b:	39 c2                	cmp    %eax,%edx
+  80089d:	0f 94 c0             	sete   %al
+  8008a0:	0f b6 c0             	movzbl %al,%eax
+}
+  8008a3:	48 83 c4 20          	add    $0x20,%rsp
+  8008a7:	5b                   	pop    %rbx
+  8008a8:	41 5f                	pop    %r15
+  8008aa:	5d                   	pop    %rbp
+  8008ab:	c3                   	ret
+
+00000000008008ac <opencons>:
+
+int
+opencons(void)
+{
+  8008ac:	55                   	push   %rbp
+  8008ad:	48 89 e5             	mov    %rsp,%rbp
+  8008b0:	41 57                	push   %r15
+  8008b2:	53                   	push   %rbx
+  8008b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8008b7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8008b7 <opencons+0xb>
+  8008be:	49 bb 89 a7 00 00 00 	movabs $0xa789,%r11
+  8008c5:	00 00 00 
+  8008c8:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8008cb:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8008cf:	48 89 c7             	mov    %rax,%rdi
+  8008d2:	49 89 df             	mov    %rbx,%r15
+  8008d5:	48 b8 2e 8d ff ff ff 	movabs $0xffffffffffff8d2e,%rax
+  8008dc:	ff ff ff 
+  8008df:	48 01 d8             	add    %rbx,%rax
+  8008e2:	ff d0                	call   *%rax
+  8008e4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8008e7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8008eb:	79 05                	jns    8008f2 <opencons+0x46>
+		return r;
+  8008ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8008f0:	eb 68                	jmp    80095a <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8008f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8008f6:	ba 07 04 00 00       	mov    $0x407,%edx
+  8008fb:	48 89 c6             	mov    %rax,%rsi
+  8008fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800903:	49 89 df             	mov    %rbx,%r15
+  800906:	48 b8 7f 79 ff ff ff 	movabs $0xffffffffffff797f,%rax
+  80090d:	ff ff ff 
+  800910:	48 01 d8             	add    %rbx,%rax
+  800913:	ff d0                	call   *%rax
+  800915:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800918:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80091c:	79 05                	jns    800923 <opencons+0x77>
+		return r;
+  80091e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800921:	eb 37                	jmp    80095a <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  800923:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800927:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  80092e:	00 00 00 
+  800931:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  800934:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  800936:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80093a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  800941:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800945:	48 89 c7             	mov    %rax,%rdi
+  800948:	49 89 df             	mov    %rbx,%r15
+  80094b:	48 b8 b4 8c ff ff ff 	movabs $0xffffffffffff8cb4,%rax
+  800952:	ff ff ff 
+  800955:	48 01 d8             	add    %rbx,%rax
+  800958:	ff d0                	call   *%rax
+}
+  80095a:	48 83 c4 10          	add    $0x10,%rsp
+  80095e:	5b                   	pop    %rbx
+  80095f:	41 5f                	pop    %r15
+  800961:	5d                   	pop    %rbp
+  800962:	c3                   	ret
+
+0000000000800963 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  800963:	55                   	push   %rbp
+  800964:	48 89 e5             	mov    %rsp,%rbp
+  800967:	41 57                	push   %r15
+  800969:	53                   	push   %rbx
+  80096a:	48 83 ec 30          	sub    $0x30,%rsp
+  80096e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80096e <devcons_read+0xb>
+  800975:	49 bb d2 a6 00 00 00 	movabs $0xa6d2,%r11
+  80097c:	00 00 00 
+  80097f:	4c 01 db             	add    %r11,%rbx
+  800982:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800986:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80098a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  80098e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800993:	75 19                	jne    8009ae <devcons_read+0x4b>
+		return 0;
+  800995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099a:	eb 55                	jmp    8009f1 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  80099c:	49 89 df             	mov    %rbx,%r15
+  80099f:	48 b8 2a 79 ff ff ff 	movabs $0xffffffffffff792a,%rax
+  8009a6:	ff ff ff 
+  8009a9:	48 01 d8             	add    %rbx,%rax
+  8009ac:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8009ae:	49 89 df             	mov    %rbx,%r15
+  8009b1:	48 b8 26 78 ff ff ff 	movabs $0xffffffffffff7826,%rax
+  8009b8:	ff ff ff 
+  8009bb:	48 01 d8             	add    %rbx,%rax
+  8009be:	ff d0                	call   *%rax
+  8009c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8009c3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8009c7:	74 d3                	je     80099c <devcons_read+0x39>
+	if (c < 0)
+  8009c9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8009cd:	79 05                	jns    8009d4 <devcons_read+0x71>
+		return c;
+  8009cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8009d2:	eb 1d                	jmp    8009f1 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8009d4:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8009d8:	75 07                	jne    8009e1 <devcons_read+0x7e>
+		return 0;
+  8009da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009df:	eb 10                	jmp    8009f1 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  8009e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8009e4:	89 c2                	mov    %eax,%edx
+  8009e6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8009ea:	88 10                	mov    %dl,(%rax)
+	return 1;
+  8009ec:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8009f1:	48 83 c4 30          	add    $0x30,%rsp
+  8009f5:	5b                   	pop    %rbx
+  8009f6:	41 5f                	pop    %r15
+  8009f8:	5d                   	pop    %rbp
+  8009f9:	c3                   	ret
+
+00000000008009fa <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8009fa:	55                   	push   %rbp
+  8009fb:	48 89 e5             	mov    %rsp,%rbp
+  8009fe:	41 57                	push   %r15
+  800a00:	53                   	push   %rbx
+  800a01:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  800a08:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800a08 <devcons_write+0xe>
+  800a0f:	49 bb 38 a6 00 00 00 	movabs $0xa638,%r11
+  800a16:	00 00 00 
+  800a19:	4c 01 db             	add    %r11,%rbx
+  800a1c:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  800a23:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  800a2a:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  800a31:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800a38:	e9 80 00 00 00       	jmp    800abd <devcons_write+0xc3>
+		m = n - tot;
+  800a3d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800a44:	89 c2                	mov    %eax,%edx
+  800a46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800a49:	29 c2                	sub    %eax,%edx
+  800a4b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  800a4e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800a51:	83 f8 7f             	cmp    $0x7f,%eax
+  800a54:	76 07                	jbe    800a5d <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  800a56:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  800a5d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800a60:	48 63 d0             	movslq %eax,%rdx
+  800a63:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800a66:	48 63 c8             	movslq %eax,%rcx
+  800a69:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  800a70:	48 01 c1             	add    %rax,%rcx
+  800a73:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  800a7a:	48 89 ce             	mov    %rcx,%rsi
+  800a7d:	48 89 c7             	mov    %rax,%rdi
+  800a80:	49 89 df             	mov    %rbx,%r15
+  800a83:	48 b8 a3 70 ff ff ff 	movabs $0xffffffffffff70a3,%rax
+  800a8a:	ff ff ff 
+  800a8d:	48 01 d8             	add    %rbx,%rax
+  800a90:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  800a92:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800a95:	48 63 d0             	movslq %eax,%rdx
+  800a98:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  800a9f:	48 89 d6             	mov    %rdx,%rsi
+  800aa2:	48 89 c7             	mov    %rax,%rdi
+  800aa5:	49 89 df             	mov    %rbx,%r15
+  800aa8:	48 b8 c7 77 ff ff ff 	movabs $0xffffffffffff77c7,%rax
+  800aaf:	ff ff ff 
+  800ab2:	48 01 d8             	add    %rbx,%rax
+  800ab5:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  800ab7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800aba:	01 45 ec             	add    %eax,-0x14(%rbp)
+  800abd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800ac0:	48 98                	cltq
+  800ac2:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  800ac9:	0f 82 6e ff ff ff    	jb     800a3d <devcons_write+0x43>
+	}
+	return tot;
+  800acf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  800ad2:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  800ad9:	5b                   	pop    %rbx
+  800ada:	41 5f                	pop    %r15
+  800adc:	5d                   	pop    %rbp
+  800add:	c3                   	ret
+
+0000000000800ade <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  800ade:	55                   	push   %rbp
+  800adf:	48 89 e5             	mov    %rsp,%rbp
+  800ae2:	48 83 ec 08          	sub    $0x8,%rsp
+  800ae6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ae6 <devcons_close+0x8>
+  800aed:	49 bb 5a a5 00 00 00 	movabs $0xa55a,%r11
+  800af4:	00 00 00 
+  800af7:	4c 01 d8             	add    %r11,%rax
+  800afa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  800afe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b03:	c9                   	leave
+  800b04:	c3                   	ret
+
+0000000000800b05 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800b05:	55                   	push   %rbp
+  800b06:	48 89 e5             	mov    %rsp,%rbp
+  800b09:	41 57                	push   %r15
+  800b0b:	48 83 ec 18          	sub    $0x18,%rsp
+  800b0f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b0f <devcons_stat+0xa>
+  800b16:	49 bb 31 a5 00 00 00 	movabs $0xa531,%r11
+  800b1d:	00 00 00 
+  800b20:	4c 01 d8             	add    %r11,%rax
+  800b23:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b27:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  800b2b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800b2f:	48 b9 41 d6 ff ff ff 	movabs $0xffffffffffffd641,%rcx
+  800b36:	ff ff ff 
+  800b39:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  800b3d:	48 89 ce             	mov    %rcx,%rsi
+  800b40:	48 89 d7             	mov    %rdx,%rdi
+  800b43:	49 89 c7             	mov    %rax,%r15
+  800b46:	48 ba c3 6c ff ff ff 	movabs $0xffffffffffff6cc3,%rdx
+  800b4d:	ff ff ff 
+  800b50:	48 01 c2             	add    %rax,%rdx
+  800b53:	ff d2                	call   *%rdx
+	return 0;
+  800b55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b5a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800b5e:	c9                   	leave
+  800b5f:	c3                   	ret
+
+0000000000800b60 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800b60:	55                   	push   %rbp
+  800b61:	48 89 e5             	mov    %rsp,%rbp
+  800b64:	41 57                	push   %r15
+  800b66:	53                   	push   %rbx
+  800b67:	48 83 ec 20          	sub    $0x20,%rsp
+  800b6b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800b6b <libmain+0xb>
+  800b72:	49 bb d5 a4 00 00 00 	movabs $0xa4d5,%r11
+  800b79:	00 00 00 
+  800b7c:	4c 01 db             	add    %r11,%rbx
+  800b7f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800b82:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800b86:	49 89 df             	mov    %rbx,%r15
+  800b89:	48 b8 d6 78 ff ff ff 	movabs $0xffffffffffff78d6,%rax
+  800b90:	ff ff ff 
+  800b93:	48 01 d8             	add    %rbx,%rax
+  800b96:	ff d0                	call   *%rax
+  800b98:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800b9b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800b9e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800ba3:	48 98                	cltq
+  800ba5:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800bac:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800bb3:	ff ff ff 
+  800bb6:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800bba:	48 01 c2             	add    %rax,%rdx
+  800bbd:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  800bc4:	00 00 00 
+  800bc7:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800bcb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800bcf:	7e 15                	jle    800be6 <libmain+0x86>
+		binaryname = argv[0];
+  800bd1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bd5:	48 8b 00             	mov    (%rax),%rax
+  800bd8:	48 ba 58 00 00 00 00 	movabs $0x58,%rdx
+  800bdf:	00 00 00 
+  800be2:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800be6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800bea:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800bed:	48 89 d6             	mov    %rdx,%rsi
+  800bf0:	89 c7                	mov    %eax,%edi
+  800bf2:	49 89 df             	mov    %rbx,%r15
+  800bf5:	48 b8 03 50 ff ff ff 	movabs $0xffffffffffff5003,%rax
+  800bfc:	ff ff ff 
+  800bff:	48 01 d8             	add    %rbx,%rax
+  800c02:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800c04:	49 89 df             	mov    %rbx,%r15
+  800c07:	48 b8 e0 5b ff ff ff 	movabs $0xffffffffffff5be0,%rax
+  800c0e:	ff ff ff 
+  800c11:	48 01 d8             	add    %rbx,%rax
+  800c14:	ff d0                	call   *%rax
+}
+  800c16:	90                   	nop
+  800c17:	48 83 c4 20          	add    $0x20,%rsp
+  800c1b:	5b                   	pop    %rbx
+  800c1c:	41 5f                	pop    %r15
+  800c1e:	5d                   	pop    %rbp
+  800c1f:	c3                   	ret
+
+0000000000800c20 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800c20:	55                   	push   %rbp
+  800c21:	48 89 e5             	mov    %rsp,%rbp
+  800c24:	41 57                	push   %r15
+  800c26:	53                   	push   %rbx
+  800c27:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800c27 <exit+0x7>
+  800c2e:	49 bb 19 a4 00 00 00 	movabs $0xa419,%r11
+  800c35:	00 00 00 
+  800c38:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800c3b:	49 89 df             	mov    %rbx,%r15
+  800c3e:	48 b8 df 90 ff ff ff 	movabs $0xffffffffffff90df,%rax
+  800c45:	ff ff ff 
+  800c48:	48 01 d8             	add    %rbx,%rax
+  800c4b:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800c4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c52:	49 89 df             	mov    %rbx,%r15
+  800c55:	48 b8 7a 78 ff ff ff 	movabs $0xffffffffffff787a,%rax
+  800c5c:	ff ff ff 
+  800c5f:	48 01 d8             	add    %rbx,%rax
+  800c62:	ff d0                	call   *%rax
+}
+  800c64:	90                   	nop
+  800c65:	5b                   	pop    %rbx
+  800c66:	41 5f                	pop    %r15
+  800c68:	5d                   	pop    %rbp
+  800c69:	c3                   	ret
+
+0000000000800c6a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800c6a:	55                   	push   %rbp
+  800c6b:	48 89 e5             	mov    %rsp,%rbp
+  800c6e:	41 57                	push   %r15
+  800c70:	41 54                	push   %r12
+  800c72:	53                   	push   %rbx
+  800c73:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800c7a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800c7a <_panic+0x10>
+  800c81:	49 bb c6 a3 00 00 00 	movabs $0xa3c6,%r11
+  800c88:	00 00 00 
+  800c8b:	4c 01 db             	add    %r11,%rbx
+  800c8e:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800c95:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800c9b:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800ca2:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800ca9:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800cb0:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800cb7:	84 c0                	test   %al,%al
+  800cb9:	74 26                	je     800ce1 <_panic+0x77>
+  800cbb:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800cc2:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800cc9:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800ccd:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800cd1:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800cd5:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800cd9:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800cdd:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800ce1:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800ce8:	00 00 00 
+  800ceb:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800cf2:	00 00 00 
+  800cf5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cf9:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800d00:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800d07:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800d0e:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800d15:	ff ff ff 
+  800d18:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800d1c:	4c 8b 20             	mov    (%rax),%r12
+  800d1f:	49 89 df             	mov    %rbx,%r15
+  800d22:	48 b8 d6 78 ff ff ff 	movabs $0xffffffffffff78d6,%rax
+  800d29:	ff ff ff 
+  800d2c:	48 01 d8             	add    %rbx,%rax
+  800d2f:	ff d0                	call   *%rax
+  800d31:	89 c6                	mov    %eax,%esi
+  800d33:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800d39:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800d40:	41 89 d0             	mov    %edx,%r8d
+  800d43:	48 89 c1             	mov    %rax,%rcx
+  800d46:	4c 89 e2             	mov    %r12,%rdx
+  800d49:	48 b8 58 d6 ff ff ff 	movabs $0xffffffffffffd658,%rax
+  800d50:	ff ff ff 
+  800d53:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d57:	48 89 c7             	mov    %rax,%rdi
+  800d5a:	49 89 df             	mov    %rbx,%r15
+  800d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d62:	49 b9 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%r9
+  800d69:	ff ff ff 
+  800d6c:	49 01 d9             	add    %rbx,%r9
+  800d6f:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800d72:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800d79:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800d80:	48 89 d6             	mov    %rdx,%rsi
+  800d83:	48 89 c7             	mov    %rax,%rdi
+  800d86:	49 89 df             	mov    %rbx,%r15
+  800d89:	48 b8 21 5e ff ff ff 	movabs $0xffffffffffff5e21,%rax
+  800d90:	ff ff ff 
+  800d93:	48 01 d8             	add    %rbx,%rax
+  800d96:	ff d0                	call   *%rax
+	cprintf("\n");
+  800d98:	48 b8 7b d6 ff ff ff 	movabs $0xffffffffffffd67b,%rax
+  800d9f:	ff ff ff 
+  800da2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800da6:	48 89 c7             	mov    %rax,%rdi
+  800da9:	49 89 df             	mov    %rbx,%r15
+  800dac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db1:	48 ba 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rdx
+  800db8:	ff ff ff 
+  800dbb:	48 01 da             	add    %rbx,%rdx
+  800dbe:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800dc0:	cc                   	int3
+  800dc1:	eb fd                	jmp    800dc0 <_panic+0x156>
+
+0000000000800dc3 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800dc3:	55                   	push   %rbp
+  800dc4:	48 89 e5             	mov    %rsp,%rbp
+  800dc7:	41 57                	push   %r15
+  800dc9:	48 83 ec 18          	sub    $0x18,%rsp
+  800dcd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800dcd <putch+0xa>
+  800dd4:	49 bb 73 a2 00 00 00 	movabs $0xa273,%r11
+  800ddb:	00 00 00 
+  800dde:	4c 01 d8             	add    %r11,%rax
+  800de1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800de4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800de8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800dec:	8b 12                	mov    (%rdx),%edx
+  800dee:	8d 72 01             	lea    0x1(%rdx),%esi
+  800df1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800df5:	89 31                	mov    %esi,(%rcx)
+  800df7:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800dfa:	89 ce                	mov    %ecx,%esi
+  800dfc:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800e00:	48 63 d2             	movslq %edx,%rdx
+  800e03:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800e08:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800e0c:	8b 12                	mov    (%rdx),%edx
+  800e0e:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800e14:	75 33                	jne    800e49 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800e16:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800e1a:	8b 12                	mov    (%rdx),%edx
+  800e1c:	48 63 d2             	movslq %edx,%rdx
+  800e1f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800e23:	48 83 c1 08          	add    $0x8,%rcx
+  800e27:	48 89 d6             	mov    %rdx,%rsi
+  800e2a:	48 89 cf             	mov    %rcx,%rdi
+  800e2d:	49 89 c7             	mov    %rax,%r15
+  800e30:	48 ba c7 77 ff ff ff 	movabs $0xffffffffffff77c7,%rdx
+  800e37:	ff ff ff 
+  800e3a:	48 01 c2             	add    %rax,%rdx
+  800e3d:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800e3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e43:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800e49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e4d:	8b 40 04             	mov    0x4(%rax),%eax
+  800e50:	8d 50 01             	lea    0x1(%rax),%edx
+  800e53:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e57:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800e5a:	90                   	nop
+  800e5b:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800e5f:	c9                   	leave
+  800e60:	c3                   	ret
+
+0000000000800e61 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800e61:	55                   	push   %rbp
+  800e62:	48 89 e5             	mov    %rsp,%rbp
+  800e65:	41 57                	push   %r15
+  800e67:	53                   	push   %rbx
+  800e68:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800e6f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800e6f <vcprintf+0xe>
+  800e76:	49 bb d1 a1 00 00 00 	movabs $0xa1d1,%r11
+  800e7d:	00 00 00 
+  800e80:	4c 01 db             	add    %r11,%rbx
+  800e83:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800e8a:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800e91:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800e98:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800e9f:	48 8b 06             	mov    (%rsi),%rax
+  800ea2:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800ea6:	48 89 01             	mov    %rax,(%rcx)
+  800ea9:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ead:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800eb1:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800eb5:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800ebc:	00 00 00 
+    b.cnt = 0;
+  800ebf:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800ec6:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800ec9:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800ed0:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800ed7:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800ede:	48 89 c6             	mov    %rax,%rsi
+  800ee1:	48 b8 83 5d ff ff ff 	movabs $0xffffffffffff5d83,%rax
+  800ee8:	ff ff ff 
+  800eeb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800eef:	48 89 c7             	mov    %rax,%rdi
+  800ef2:	49 89 df             	mov    %rbx,%r15
+  800ef5:	48 b8 45 63 ff ff ff 	movabs $0xffffffffffff6345,%rax
+  800efc:	ff ff ff 
+  800eff:	48 01 d8             	add    %rbx,%rax
+  800f02:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800f04:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800f0a:	48 98                	cltq
+  800f0c:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800f13:	48 83 c2 08          	add    $0x8,%rdx
+  800f17:	48 89 c6             	mov    %rax,%rsi
+  800f1a:	48 89 d7             	mov    %rdx,%rdi
+  800f1d:	49 89 df             	mov    %rbx,%r15
+  800f20:	48 b8 c7 77 ff ff ff 	movabs $0xffffffffffff77c7,%rax
+  800f27:	ff ff ff 
+  800f2a:	48 01 d8             	add    %rbx,%rax
+  800f2d:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800f2f:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800f35:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800f3c:	5b                   	pop    %rbx
+  800f3d:	41 5f                	pop    %r15
+  800f3f:	5d                   	pop    %rbp
+  800f40:	c3                   	ret
+
+0000000000800f41 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800f41:	55                   	push   %rbp
+  800f42:	48 89 e5             	mov    %rsp,%rbp
+  800f45:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800f4c:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800f4c <cprintf+0xb>
+  800f53:	49 bb f4 a0 00 00 00 	movabs $0xa0f4,%r11
+  800f5a:	00 00 00 
+  800f5d:	4d 01 da             	add    %r11,%r10
+  800f60:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800f67:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800f6e:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800f75:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f7c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f83:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f8a:	84 c0                	test   %al,%al
+  800f8c:	74 20                	je     800fae <cprintf+0x6d>
+  800f8e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f92:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f96:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f9a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f9e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800fa2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800fa6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800faa:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800fae:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800fb5:	00 00 00 
+  800fb8:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800fbf:	00 00 00 
+  800fc2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800fc6:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800fcd:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800fd4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800fdb:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800fe2:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800fe9:	48 8b 06             	mov    (%rsi),%rax
+  800fec:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800ff0:	48 89 01             	mov    %rax,(%rcx)
+  800ff3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ff7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800ffb:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800fff:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  801006:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80100d:	48 89 d6             	mov    %rdx,%rsi
+  801010:	48 89 c7             	mov    %rax,%rdi
+  801013:	48 b8 21 5e ff ff ff 	movabs $0xffffffffffff5e21,%rax
+  80101a:	ff ff ff 
+  80101d:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801021:	ff d0                	call   *%rax
+  801023:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  801029:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80102f:	c9                   	leave
+  801030:	c3                   	ret
+
+0000000000801031 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801031:	55                   	push   %rbp
+  801032:	48 89 e5             	mov    %rsp,%rbp
+  801035:	53                   	push   %rbx
+  801036:	48 83 ec 38          	sub    $0x38,%rsp
+  80103a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80103a <printnum+0x9>
+  801041:	49 bb 06 a0 00 00 00 	movabs $0xa006,%r11
+  801048:	00 00 00 
+  80104b:	4c 01 db             	add    %r11,%rbx
+  80104e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801052:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801056:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80105a:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80105d:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  801061:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801065:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801068:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80106c:	72 58                	jb     8010c6 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80106e:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  801071:	8d 78 ff             	lea    -0x1(%rax),%edi
+  801074:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  801077:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80107b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801080:	48 f7 f6             	div    %rsi
+  801083:	49 89 c2             	mov    %rax,%r10
+  801086:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  801089:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80108c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  801090:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801094:	41 89 c9             	mov    %ecx,%r9d
+  801097:	41 89 f8             	mov    %edi,%r8d
+  80109a:	89 d1                	mov    %edx,%ecx
+  80109c:	4c 89 d2             	mov    %r10,%rdx
+  80109f:	48 89 c7             	mov    %rax,%rdi
+  8010a2:	48 b8 f1 5f ff ff ff 	movabs $0xffffffffffff5ff1,%rax
+  8010a9:	ff ff ff 
+  8010ac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8010b0:	ff d0                	call   *%rax
+  8010b2:	eb 1c                	jmp    8010d0 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8010b4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8010b8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8010bb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8010bf:	48 89 d6             	mov    %rdx,%rsi
+  8010c2:	89 c7                	mov    %eax,%edi
+  8010c4:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8010c6:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8010ca:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8010ce:	7f e4                	jg     8010b4 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8010d0:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8010d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010dc:	48 f7 f1             	div    %rcx
+  8010df:	48 b8 b7 d7 ff ff ff 	movabs $0xffffffffffffd7b7,%rax
+  8010e6:	ff ff ff 
+  8010e9:	48 01 d8             	add    %rbx,%rax
+  8010ec:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8010f0:	0f be c0             	movsbl %al,%eax
+  8010f3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8010f7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8010fb:	48 89 d6             	mov    %rdx,%rsi
+  8010fe:	89 c7                	mov    %eax,%edi
+  801100:	ff d1                	call   *%rcx
+}
+  801102:	90                   	nop
+  801103:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801107:	c9                   	leave
+  801108:	c3                   	ret
+
+0000000000801109 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  801109:	55                   	push   %rbp
+  80110a:	48 89 e5             	mov    %rsp,%rbp
+  80110d:	48 83 ec 20          	sub    $0x20,%rsp
+  801111:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801111 <getuint+0x8>
+  801118:	49 bb 2f 9f 00 00 00 	movabs $0x9f2f,%r11
+  80111f:	00 00 00 
+  801122:	4c 01 d8             	add    %r11,%rax
+  801125:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801129:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  80112c:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801130:	7e 4f                	jle    801181 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  801132:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801136:	8b 00                	mov    (%rax),%eax
+  801138:	83 f8 2f             	cmp    $0x2f,%eax
+  80113b:	77 24                	ja     801161 <getuint+0x58>
+  80113d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801141:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801145:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801149:	8b 00                	mov    (%rax),%eax
+  80114b:	89 c0                	mov    %eax,%eax
+  80114d:	48 01 d0             	add    %rdx,%rax
+  801150:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801154:	8b 12                	mov    (%rdx),%edx
+  801156:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801159:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80115d:	89 0a                	mov    %ecx,(%rdx)
+  80115f:	eb 14                	jmp    801175 <getuint+0x6c>
+  801161:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801165:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801169:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80116d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801171:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801175:	48 8b 00             	mov    (%rax),%rax
+  801178:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80117c:	e9 9d 00 00 00       	jmp    80121e <getuint+0x115>
+	else if (lflag)
+  801181:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801185:	74 4c                	je     8011d3 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  801187:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80118b:	8b 00                	mov    (%rax),%eax
+  80118d:	83 f8 2f             	cmp    $0x2f,%eax
+  801190:	77 24                	ja     8011b6 <getuint+0xad>
+  801192:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801196:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80119a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80119e:	8b 00                	mov    (%rax),%eax
+  8011a0:	89 c0                	mov    %eax,%eax
+  8011a2:	48 01 d0             	add    %rdx,%rax
+  8011a5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8011a9:	8b 12                	mov    (%rdx),%edx
+  8011ab:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8011ae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8011b2:	89 0a                	mov    %ecx,(%rdx)
+  8011b4:	eb 14                	jmp    8011ca <getuint+0xc1>
+  8011b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011ba:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8011be:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8011c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8011c6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8011ca:	48 8b 00             	mov    (%rax),%rax
+  8011cd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8011d1:	eb 4b                	jmp    80121e <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8011d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011d7:	8b 00                	mov    (%rax),%eax
+  8011d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8011dc:	77 24                	ja     801202 <getuint+0xf9>
+  8011de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011e2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8011e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011ea:	8b 00                	mov    (%rax),%eax
+  8011ec:	89 c0                	mov    %eax,%eax
+  8011ee:	48 01 d0             	add    %rdx,%rax
+  8011f1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8011f5:	8b 12                	mov    (%rdx),%edx
+  8011f7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8011fa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8011fe:	89 0a                	mov    %ecx,(%rdx)
+  801200:	eb 14                	jmp    801216 <getuint+0x10d>
+  801202:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801206:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80120a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80120e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801212:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801216:	8b 00                	mov    (%rax),%eax
+  801218:	89 c0                	mov    %eax,%eax
+  80121a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80121e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801222:	c9                   	leave
+  801223:	c3                   	ret
+
+0000000000801224 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  801224:	55                   	push   %rbp
+  801225:	48 89 e5             	mov    %rsp,%rbp
+  801228:	48 83 ec 20          	sub    $0x20,%rsp
+  80122c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80122c <printfloat+0x8>
+  801233:	49 bb 14 9e 00 00 00 	movabs $0x9e14,%r11
+  80123a:	00 00 00 
+  80123d:	4c 01 d8             	add    %r11,%rax
+  801240:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801244:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801248:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  80124c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801250:	48 85 c0             	test   %rax,%rax
+  801253:	79 12                	jns    801267 <printfloat+0x43>
+		putch('-',putdat);
+  801255:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801259:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80125d:	48 89 c6             	mov    %rax,%rsi
+  801260:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801265:	ff d2                	call   *%rdx
+	
+}
+  801267:	90                   	nop
+  801268:	c9                   	leave
+  801269:	c3                   	ret
+
+000000000080126a <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  80126a:	55                   	push   %rbp
+  80126b:	48 89 e5             	mov    %rsp,%rbp
+  80126e:	48 83 ec 20          	sub    $0x20,%rsp
+  801272:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801272 <getint+0x8>
+  801279:	49 bb ce 9d 00 00 00 	movabs $0x9dce,%r11
+  801280:	00 00 00 
+  801283:	4c 01 d8             	add    %r11,%rax
+  801286:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80128a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  80128d:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801291:	7e 4f                	jle    8012e2 <getint+0x78>
+		x=va_arg(*ap, long long);
+  801293:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801297:	8b 00                	mov    (%rax),%eax
+  801299:	83 f8 2f             	cmp    $0x2f,%eax
+  80129c:	77 24                	ja     8012c2 <getint+0x58>
+  80129e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012a2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8012a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012aa:	8b 00                	mov    (%rax),%eax
+  8012ac:	89 c0                	mov    %eax,%eax
+  8012ae:	48 01 d0             	add    %rdx,%rax
+  8012b1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8012b5:	8b 12                	mov    (%rdx),%edx
+  8012b7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8012ba:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8012be:	89 0a                	mov    %ecx,(%rdx)
+  8012c0:	eb 14                	jmp    8012d6 <getint+0x6c>
+  8012c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012c6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012ca:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8012ce:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8012d2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8012d6:	48 8b 00             	mov    (%rax),%rax
+  8012d9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8012dd:	e9 9d 00 00 00       	jmp    80137f <getint+0x115>
+	else if (lflag)
+  8012e2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8012e6:	74 4c                	je     801334 <getint+0xca>
+		x=va_arg(*ap, long);
+  8012e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ec:	8b 00                	mov    (%rax),%eax
+  8012ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8012f1:	77 24                	ja     801317 <getint+0xad>
+  8012f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012f7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8012fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ff:	8b 00                	mov    (%rax),%eax
+  801301:	89 c0                	mov    %eax,%eax
+  801303:	48 01 d0             	add    %rdx,%rax
+  801306:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80130a:	8b 12                	mov    (%rdx),%edx
+  80130c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80130f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801313:	89 0a                	mov    %ecx,(%rdx)
+  801315:	eb 14                	jmp    80132b <getint+0xc1>
+  801317:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80131b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80131f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801323:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801327:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80132b:	48 8b 00             	mov    (%rax),%rax
+  80132e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801332:	eb 4b                	jmp    80137f <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  801334:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801338:	8b 00                	mov    (%rax),%eax
+  80133a:	83 f8 2f             	cmp    $0x2f,%eax
+  80133d:	77 24                	ja     801363 <getint+0xf9>
+  80133f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801343:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801347:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80134b:	8b 00                	mov    (%rax),%eax
+  80134d:	89 c0                	mov    %eax,%eax
+  80134f:	48 01 d0             	add    %rdx,%rax
+  801352:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801356:	8b 12                	mov    (%rdx),%edx
+  801358:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80135b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80135f:	89 0a                	mov    %ecx,(%rdx)
+  801361:	eb 14                	jmp    801377 <getint+0x10d>
+  801363:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801367:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80136b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80136f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801373:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801377:	8b 00                	mov    (%rax),%eax
+  801379:	48 98                	cltq
+  80137b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80137f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801383:	c9                   	leave
+  801384:	c3                   	ret
+
+0000000000801385 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  801385:	55                   	push   %rbp
+  801386:	48 89 e5             	mov    %rsp,%rbp
+  801389:	41 57                	push   %r15
+  80138b:	41 55                	push   %r13
+  80138d:	41 54                	push   %r12
+  80138f:	53                   	push   %rbx
+  801390:	48 83 ec 60          	sub    $0x60,%rsp
+  801394:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 801394 <vprintfmt+0xf>
+  80139b:	49 bb ac 9c 00 00 00 	movabs $0x9cac,%r11
+  8013a2:	00 00 00 
+  8013a5:	4d 01 dc             	add    %r11,%r12
+  8013a8:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  8013ac:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  8013b0:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8013b4:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  8013b8:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  8013bf:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  8013c3:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  8013c7:	48 8b 06             	mov    (%rsi),%rax
+  8013ca:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013ce:	48 89 01             	mov    %rax,(%rcx)
+  8013d1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8013d5:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8013d9:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8013dd:	eb 17                	jmp    8013f6 <vprintfmt+0x71>
+			if (ch == '\0')
+  8013df:	85 db                	test   %ebx,%ebx
+  8013e1:	0f 84 97 05 00 00    	je     80197e <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  8013e7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8013eb:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8013ef:	48 89 c6             	mov    %rax,%rsi
+  8013f2:	89 df                	mov    %ebx,%edi
+  8013f4:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8013f6:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8013fa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8013fe:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801402:	0f b6 00             	movzbl (%rax),%eax
+  801405:	0f b6 d8             	movzbl %al,%ebx
+  801408:	83 fb 25             	cmp    $0x25,%ebx
+  80140b:	75 d2                	jne    8013df <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  80140d:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  801411:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  801418:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  80141f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  801426:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  80142d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801431:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801435:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801439:	0f b6 00             	movzbl (%rax),%eax
+  80143c:	0f b6 d8             	movzbl %al,%ebx
+  80143f:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  801442:	83 f8 55             	cmp    $0x55,%eax
+  801445:	0f 87 00 05 00 00    	ja     80194b <vprintfmt+0x5c6>
+  80144b:	89 c0                	mov    %eax,%eax
+  80144d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801454:	00 
+  801455:	48 8d 05 c4 73 00 00 	lea    0x73c4(%rip),%rax        # 808820 <.LC18+0xc>
+  80145c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  801460:	48 8d 15 b9 73 00 00 	lea    0x73b9(%rip),%rdx        # 808820 <.LC18+0xc>
+  801467:	48 01 d0             	add    %rdx,%rax
+  80146a:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  80146c:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  801470:	eb bb                	jmp    80142d <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  801472:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  801476:	eb b5                	jmp    80142d <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  801478:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  80147f:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  801482:	89 d0                	mov    %edx,%eax
+  801484:	c1 e0 02             	shl    $0x2,%eax
+  801487:	01 d0                	add    %edx,%eax
+  801489:	01 c0                	add    %eax,%eax
+  80148b:	01 d8                	add    %ebx,%eax
+  80148d:	83 e8 30             	sub    $0x30,%eax
+  801490:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  801493:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801497:	0f b6 00             	movzbl (%rax),%eax
+  80149a:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  80149d:	83 fb 2f             	cmp    $0x2f,%ebx
+  8014a0:	7e 60                	jle    801502 <vprintfmt+0x17d>
+  8014a2:	83 fb 39             	cmp    $0x39,%ebx
+  8014a5:	7f 5b                	jg     801502 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  8014a7:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  8014ac:	eb d1                	jmp    80147f <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  8014ae:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8014b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8014b4:	77 17                	ja     8014cd <vprintfmt+0x148>
+  8014b6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8014ba:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8014bd:	89 d2                	mov    %edx,%edx
+  8014bf:	48 01 d0             	add    %rdx,%rax
+  8014c2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8014c5:	83 c2 08             	add    $0x8,%edx
+  8014c8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8014cb:	eb 0c                	jmp    8014d9 <vprintfmt+0x154>
+  8014cd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8014d1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8014d5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8014d9:	8b 00                	mov    (%rax),%eax
+  8014db:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  8014de:	eb 23                	jmp    801503 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  8014e0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8014e4:	0f 89 43 ff ff ff    	jns    80142d <vprintfmt+0xa8>
+				width = 0;
+  8014ea:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  8014f1:	e9 37 ff ff ff       	jmp    80142d <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  8014f6:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  8014fd:	e9 2b ff ff ff       	jmp    80142d <vprintfmt+0xa8>
+			goto process_precision;
+  801502:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  801503:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801507:	0f 89 20 ff ff ff    	jns    80142d <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  80150d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801510:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  801513:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  80151a:	e9 0e ff ff ff       	jmp    80142d <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  80151f:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  801523:	e9 05 ff ff ff       	jmp    80142d <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  801528:	83 fb 39             	cmp    $0x39,%ebx
+  80152b:	7f 0b                	jg     801538 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  80152d:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  801530:	c1 e0 08             	shl    $0x8,%eax
+  801533:	01 45 bc             	add    %eax,-0x44(%rbp)
+  801536:	eb 21                	jmp    801559 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  801538:	83 fb 60             	cmp    $0x60,%ebx
+  80153b:	7e 10                	jle    80154d <vprintfmt+0x1c8>
+  80153d:	83 fb 66             	cmp    $0x66,%ebx
+  801540:	7f 0b                	jg     80154d <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  801542:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  801545:	c1 e0 08             	shl    $0x8,%eax
+  801548:	01 45 bc             	add    %eax,-0x44(%rbp)
+  80154b:	eb 0c                	jmp    801559 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  80154d:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  801554:	e9 04 01 00 00       	jmp    80165d <vprintfmt+0x2d8>
+  801559:	e9 ff 00 00 00       	jmp    80165d <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  80155e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801561:	83 f8 2f             	cmp    $0x2f,%eax
+  801564:	77 17                	ja     80157d <vprintfmt+0x1f8>
+  801566:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80156a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80156d:	89 d2                	mov    %edx,%edx
+  80156f:	48 01 d0             	add    %rdx,%rax
+  801572:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801575:	83 c2 08             	add    $0x8,%edx
+  801578:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80157b:	eb 0c                	jmp    801589 <vprintfmt+0x204>
+  80157d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801581:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801585:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801589:	8b 00                	mov    (%rax),%eax
+  80158b:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80158f:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801593:	48 89 d6             	mov    %rdx,%rsi
+  801596:	89 c7                	mov    %eax,%edi
+  801598:	ff d1                	call   *%rcx
+			break;
+  80159a:	e9 da 03 00 00       	jmp    801979 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  80159f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8015a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8015a5:	77 17                	ja     8015be <vprintfmt+0x239>
+  8015a7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8015ab:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8015ae:	89 d2                	mov    %edx,%edx
+  8015b0:	48 01 d0             	add    %rdx,%rax
+  8015b3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8015b6:	83 c2 08             	add    $0x8,%edx
+  8015b9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8015bc:	eb 0c                	jmp    8015ca <vprintfmt+0x245>
+  8015be:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015c2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8015c6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8015ca:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  8015cc:	85 db                	test   %ebx,%ebx
+  8015ce:	79 02                	jns    8015d2 <vprintfmt+0x24d>
+				err = -err;
+  8015d0:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8015d2:	83 fb 15             	cmp    $0x15,%ebx
+  8015d5:	7f 19                	jg     8015f0 <vprintfmt+0x26b>
+  8015d7:	48 ba 20 01 00 00 00 	movabs $0x120,%rdx
+  8015de:	00 00 00 
+  8015e1:	48 63 c3             	movslq %ebx,%rax
+  8015e4:	4c 01 e2             	add    %r12,%rdx
+  8015e7:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  8015eb:	4d 85 ed             	test   %r13,%r13
+  8015ee:	75 36                	jne    801626 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  8015f0:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8015f4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8015f8:	89 d9                	mov    %ebx,%ecx
+  8015fa:	48 ba c8 d7 ff ff ff 	movabs $0xffffffffffffd7c8,%rdx
+  801601:	ff ff ff 
+  801604:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  801608:	48 89 c7             	mov    %rax,%rdi
+  80160b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801610:	49 b8 4c 69 ff ff ff 	movabs $0xffffffffffff694c,%r8
+  801617:	ff ff ff 
+  80161a:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  80161e:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  801621:	e9 53 03 00 00       	jmp    801979 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  801626:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80162a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80162e:	4c 89 e9             	mov    %r13,%rcx
+  801631:	48 ba d1 d7 ff ff ff 	movabs $0xffffffffffffd7d1,%rdx
+  801638:	ff ff ff 
+  80163b:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  80163f:	48 89 c7             	mov    %rax,%rdi
+  801642:	b8 00 00 00 00       	mov    $0x0,%eax
+  801647:	49 b8 4c 69 ff ff ff 	movabs $0xffffffffffff694c,%r8
+  80164e:	ff ff ff 
+  801651:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  801655:	41 ff d0             	call   *%r8
+			break;
+  801658:	e9 1c 03 00 00       	jmp    801979 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  80165d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801660:	83 f8 2f             	cmp    $0x2f,%eax
+  801663:	77 17                	ja     80167c <vprintfmt+0x2f7>
+  801665:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801669:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80166c:	89 d2                	mov    %edx,%edx
+  80166e:	48 01 d0             	add    %rdx,%rax
+  801671:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801674:	83 c2 08             	add    $0x8,%edx
+  801677:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80167a:	eb 0c                	jmp    801688 <vprintfmt+0x303>
+  80167c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801680:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801684:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801688:	4c 8b 28             	mov    (%rax),%r13
+  80168b:	4d 85 ed             	test   %r13,%r13
+  80168e:	75 0e                	jne    80169e <vprintfmt+0x319>
+				p = "(null)";
+  801690:	48 b8 d4 d7 ff ff ff 	movabs $0xffffffffffffd7d4,%rax
+  801697:	ff ff ff 
+  80169a:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  80169e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8016a2:	0f 8e 84 00 00 00    	jle    80172c <vprintfmt+0x3a7>
+  8016a8:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  8016ac:	74 7e                	je     80172c <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8016ae:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8016b1:	48 98                	cltq
+  8016b3:	48 89 c6             	mov    %rax,%rsi
+  8016b6:	4c 89 ef             	mov    %r13,%rdi
+  8016b9:	4d 89 e7             	mov    %r12,%r15
+  8016bc:	48 b8 71 6c ff ff ff 	movabs $0xffffffffffff6c71,%rax
+  8016c3:	ff ff ff 
+  8016c6:	4c 01 e0             	add    %r12,%rax
+  8016c9:	ff d0                	call   *%rax
+  8016cb:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  8016ce:	eb 17                	jmp    8016e7 <vprintfmt+0x362>
+					putch(padc, putdat);
+  8016d0:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  8016d4:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  8016d8:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8016dc:	48 89 d6             	mov    %rdx,%rsi
+  8016df:	89 c7                	mov    %eax,%edi
+  8016e1:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8016e3:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8016e7:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8016eb:	7f e3                	jg     8016d0 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8016ed:	eb 3d                	jmp    80172c <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8016ef:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8016f3:	74 1e                	je     801713 <vprintfmt+0x38e>
+  8016f5:	83 fb 1f             	cmp    $0x1f,%ebx
+  8016f8:	7e 05                	jle    8016ff <vprintfmt+0x37a>
+  8016fa:	83 fb 7e             	cmp    $0x7e,%ebx
+  8016fd:	7e 14                	jle    801713 <vprintfmt+0x38e>
+					putch('?', putdat);
+  8016ff:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801703:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801707:	48 89 c6             	mov    %rax,%rsi
+  80170a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80170f:	ff d2                	call   *%rdx
+  801711:	eb 15                	jmp    801728 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  801713:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801716:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  801719:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80171d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801721:	48 89 c6             	mov    %rax,%rsi
+  801724:	89 cf                	mov    %ecx,%edi
+  801726:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801728:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80172c:	4c 89 e8             	mov    %r13,%rax
+  80172f:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  801733:	0f b6 00             	movzbl (%rax),%eax
+  801736:	0f be d8             	movsbl %al,%ebx
+  801739:	85 db                	test   %ebx,%ebx
+  80173b:	74 28                	je     801765 <vprintfmt+0x3e0>
+  80173d:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801741:	78 ac                	js     8016ef <vprintfmt+0x36a>
+  801743:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  801747:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80174b:	79 a2                	jns    8016ef <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  80174d:	eb 16                	jmp    801765 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  80174f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801753:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801757:	48 89 c6             	mov    %rax,%rsi
+  80175a:	bf 20 00 00 00       	mov    $0x20,%edi
+  80175f:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  801761:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801765:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801769:	7f e4                	jg     80174f <vprintfmt+0x3ca>
+			break;
+  80176b:	e9 09 02 00 00       	jmp    801979 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  801770:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801774:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801778:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80177c:	0f b6 00             	movzbl (%rax),%eax
+  80177f:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  801782:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  801783:	83 fb 2f             	cmp    $0x2f,%ebx
+  801786:	0f 8e ac fd ff ff    	jle    801538 <vprintfmt+0x1b3>
+  80178c:	e9 97 fd ff ff       	jmp    801528 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  801791:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801795:	be 03 00 00 00       	mov    $0x3,%esi
+  80179a:	48 89 c7             	mov    %rax,%rdi
+  80179d:	48 b8 2a 62 ff ff ff 	movabs $0xffffffffffff622a,%rax
+  8017a4:	ff ff ff 
+  8017a7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8017ab:	ff d0                	call   *%rax
+  8017ad:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  8017b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017b5:	48 85 c0             	test   %rax,%rax
+  8017b8:	79 1d                	jns    8017d7 <vprintfmt+0x452>
+				putch('-', putdat);
+  8017ba:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8017be:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8017c2:	48 89 c6             	mov    %rax,%rsi
+  8017c5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8017ca:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  8017cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017d0:	48 f7 d8             	neg    %rax
+  8017d3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  8017d7:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8017de:	e9 de 00 00 00       	jmp    8018c1 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  8017e3:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8017e7:	be 03 00 00 00       	mov    $0x3,%esi
+  8017ec:	48 89 c7             	mov    %rax,%rdi
+  8017ef:	48 b8 c9 60 ff ff ff 	movabs $0xffffffffffff60c9,%rax
+  8017f6:	ff ff ff 
+  8017f9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8017fd:	ff d0                	call   *%rax
+  8017ff:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801803:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80180a:	e9 b2 00 00 00       	jmp    8018c1 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  80180f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801813:	be 03 00 00 00       	mov    $0x3,%esi
+  801818:	48 89 c7             	mov    %rax,%rdi
+  80181b:	48 b8 c9 60 ff ff ff 	movabs $0xffffffffffff60c9,%rax
+  801822:	ff ff ff 
+  801825:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801829:	ff d0                	call   *%rax
+  80182b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  80182f:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801836:	e9 86 00 00 00       	jmp    8018c1 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80183b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80183f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801843:	48 89 c6             	mov    %rax,%rsi
+  801846:	bf 30 00 00 00       	mov    $0x30,%edi
+  80184b:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  80184d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801851:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801855:	48 89 c6             	mov    %rax,%rsi
+  801858:	bf 78 00 00 00       	mov    $0x78,%edi
+  80185d:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  80185f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801862:	83 f8 2f             	cmp    $0x2f,%eax
+  801865:	77 17                	ja     80187e <vprintfmt+0x4f9>
+  801867:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80186b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80186e:	89 d2                	mov    %edx,%edx
+  801870:	48 01 d0             	add    %rdx,%rax
+  801873:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801876:	83 c2 08             	add    $0x8,%edx
+  801879:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80187c:	eb 0c                	jmp    80188a <vprintfmt+0x505>
+  80187e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801882:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801886:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80188a:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  80188d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801891:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801898:	eb 27                	jmp    8018c1 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  80189a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80189e:	be 03 00 00 00       	mov    $0x3,%esi
+  8018a3:	48 89 c7             	mov    %rax,%rdi
+  8018a6:	48 b8 c9 60 ff ff ff 	movabs $0xffffffffffff60c9,%rax
+  8018ad:	ff ff ff 
+  8018b0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8018b4:	ff d0                	call   *%rax
+  8018b6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8018ba:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8018c1:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8018c6:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8018c9:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8018cc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8018d0:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8018d4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8018d8:	45 89 c1             	mov    %r8d,%r9d
+  8018db:	41 89 f8             	mov    %edi,%r8d
+  8018de:	48 89 c7             	mov    %rax,%rdi
+  8018e1:	48 b8 f1 5f ff ff ff 	movabs $0xffffffffffff5ff1,%rax
+  8018e8:	ff ff ff 
+  8018eb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8018ef:	ff d0                	call   *%rax
+			break;
+  8018f1:	e9 83 00 00 00       	jmp    801979 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  8018f6:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8018fa:	be 03 00 00 00       	mov    $0x3,%esi
+  8018ff:	48 89 c7             	mov    %rax,%rdi
+  801902:	48 b8 c9 60 ff ff ff 	movabs $0xffffffffffff60c9,%rax
+  801909:	ff ff ff 
+  80190c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801910:	ff d0                	call   *%rax
+  801912:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801916:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80191a:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80191e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801922:	48 89 ce             	mov    %rcx,%rsi
+  801925:	48 89 c7             	mov    %rax,%rdi
+  801928:	48 b8 e4 61 ff ff ff 	movabs $0xffffffffffff61e4,%rax
+  80192f:	ff ff ff 
+  801932:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801936:	ff d0                	call   *%rax
+	
+			break;
+  801938:	eb 3f                	jmp    801979 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  80193a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80193e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801942:	48 89 c6             	mov    %rax,%rsi
+  801945:	89 df                	mov    %ebx,%edi
+  801947:	ff d2                	call   *%rdx
+			break;
+  801949:	eb 2e                	jmp    801979 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80194b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80194f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801953:	48 89 c6             	mov    %rax,%rsi
+  801956:	bf 25 00 00 00       	mov    $0x25,%edi
+  80195b:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80195d:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801962:	eb 05                	jmp    801969 <vprintfmt+0x5e4>
+  801964:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801969:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80196d:	48 83 e8 01          	sub    $0x1,%rax
+  801971:	0f b6 00             	movzbl (%rax),%eax
+  801974:	3c 25                	cmp    $0x25,%al
+  801976:	75 ec                	jne    801964 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801978:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801979:	e9 78 fa ff ff       	jmp    8013f6 <vprintfmt+0x71>
+				return;
+  80197e:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80197f:	48 83 c4 60          	add    $0x60,%rsp
+  801983:	5b                   	pop    %rbx
+  801984:	41 5c                	pop    %r12
+  801986:	41 5d                	pop    %r13
+  801988:	41 5f                	pop    %r15
+  80198a:	5d                   	pop    %rbp
+  80198b:	c3                   	ret
+
+000000000080198c <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  80198c:	55                   	push   %rbp
+  80198d:	48 89 e5             	mov    %rsp,%rbp
+  801990:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801997:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801997 <printfmt+0xb>
+  80199e:	49 bb a9 96 00 00 00 	movabs $0x96a9,%r11
+  8019a5:	00 00 00 
+  8019a8:	4d 01 da             	add    %r11,%r10
+  8019ab:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8019b2:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8019b9:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8019c0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8019c7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8019ce:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8019d5:	84 c0                	test   %al,%al
+  8019d7:	74 20                	je     8019f9 <printfmt+0x6d>
+  8019d9:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8019dd:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8019e1:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8019e5:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8019e9:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8019ed:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8019f1:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8019f5:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8019f9:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801a00:	00 00 00 
+  801a03:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801a0a:	00 00 00 
+  801a0d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a11:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801a18:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801a1f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801a26:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801a2d:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801a34:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801a3b:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801a42:	48 89 c7             	mov    %rax,%rdi
+  801a45:	48 b8 45 63 ff ff ff 	movabs $0xffffffffffff6345,%rax
+  801a4c:	ff ff ff 
+  801a4f:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801a53:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801a55:	90                   	nop
+  801a56:	c9                   	leave
+  801a57:	c3                   	ret
+
+0000000000801a58 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801a58:	55                   	push   %rbp
+  801a59:	48 89 e5             	mov    %rsp,%rbp
+  801a5c:	48 83 ec 10          	sub    $0x10,%rsp
+  801a60:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a60 <sprintputch+0x8>
+  801a67:	49 bb e0 95 00 00 00 	movabs $0x95e0,%r11
+  801a6e:	00 00 00 
+  801a71:	4c 01 d8             	add    %r11,%rax
+  801a74:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a77:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801a7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a7f:	8b 40 10             	mov    0x10(%rax),%eax
+  801a82:	8d 50 01             	lea    0x1(%rax),%edx
+  801a85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a89:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801a8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a90:	48 8b 10             	mov    (%rax),%rdx
+  801a93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a97:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801a9b:	48 39 c2             	cmp    %rax,%rdx
+  801a9e:	73 17                	jae    801ab7 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801aa0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aa4:	48 8b 00             	mov    (%rax),%rax
+  801aa7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801aab:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801aaf:	48 89 0a             	mov    %rcx,(%rdx)
+  801ab2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801ab5:	88 10                	mov    %dl,(%rax)
+}
+  801ab7:	90                   	nop
+  801ab8:	c9                   	leave
+  801ab9:	c3                   	ret
+
+0000000000801aba <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801aba:	55                   	push   %rbp
+  801abb:	48 89 e5             	mov    %rsp,%rbp
+  801abe:	53                   	push   %rbx
+  801abf:	48 83 ec 58          	sub    $0x58,%rsp
+  801ac3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ac3 <vsnprintf+0x9>
+  801aca:	49 bb 7d 95 00 00 00 	movabs $0x957d,%r11
+  801ad1:	00 00 00 
+  801ad4:	4c 01 d8             	add    %r11,%rax
+  801ad7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801adb:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801ade:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801ae2:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801ae6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801aea:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801aee:	48 8b 0e             	mov    (%rsi),%rcx
+  801af1:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801af5:	48 89 0a             	mov    %rcx,(%rdx)
+  801af8:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801afc:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801b00:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801b04:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801b08:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801b0c:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801b0f:	48 63 d2             	movslq %edx,%rdx
+  801b12:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801b16:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801b1a:	48 01 ca             	add    %rcx,%rdx
+  801b1d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b21:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801b28:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801b2d:	74 06                	je     801b35 <vsnprintf+0x7b>
+  801b2f:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801b33:	7f 07                	jg     801b3c <vsnprintf+0x82>
+		return -E_INVAL;
+  801b35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b3a:	eb 34                	jmp    801b70 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801b3c:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801b40:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801b44:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801b48:	48 bf 18 6a ff ff ff 	movabs $0xffffffffffff6a18,%rdi
+  801b4f:	ff ff ff 
+  801b52:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801b56:	49 b8 45 63 ff ff ff 	movabs $0xffffffffffff6345,%r8
+  801b5d:	ff ff ff 
+  801b60:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801b64:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801b66:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801b6a:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801b6d:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801b70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b74:	c9                   	leave
+  801b75:	c3                   	ret
+
+0000000000801b76 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801b76:	55                   	push   %rbp
+  801b77:	48 89 e5             	mov    %rsp,%rbp
+  801b7a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801b81:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801b81 <snprintf+0xb>
+  801b88:	49 bb bf 94 00 00 00 	movabs $0x94bf,%r11
+  801b8f:	00 00 00 
+  801b92:	4d 01 da             	add    %r11,%r10
+  801b95:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801b9c:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801ba2:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801ba9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801bb0:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801bb7:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801bbe:	84 c0                	test   %al,%al
+  801bc0:	74 20                	je     801be2 <snprintf+0x6c>
+  801bc2:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801bc6:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801bca:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801bce:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801bd2:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801bd6:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801bda:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801bde:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801be2:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801be9:	00 00 00 
+  801bec:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801bf3:	00 00 00 
+  801bf6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801bfa:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801c01:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801c08:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801c0f:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801c16:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801c1d:	48 8b 06             	mov    (%rsi),%rax
+  801c20:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801c24:	48 89 01             	mov    %rax,(%rcx)
+  801c27:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801c2b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801c2f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801c33:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801c3a:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801c41:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801c47:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801c4e:	48 89 c7             	mov    %rax,%rdi
+  801c51:	48 b8 7a 6a ff ff ff 	movabs $0xffffffffffff6a7a,%rax
+  801c58:	ff ff ff 
+  801c5b:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801c5f:	ff d0                	call   *%rax
+  801c61:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801c67:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801c6d:	c9                   	leave
+  801c6e:	c3                   	ret
+
+0000000000801c6f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801c6f:	55                   	push   %rbp
+  801c70:	48 89 e5             	mov    %rsp,%rbp
+  801c73:	48 83 ec 18          	sub    $0x18,%rsp
+  801c77:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c77 <strlen+0x8>
+  801c7e:	49 bb c9 93 00 00 00 	movabs $0x93c9,%r11
+  801c85:	00 00 00 
+  801c88:	4c 01 d8             	add    %r11,%rax
+  801c8b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801c8f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801c96:	eb 09                	jmp    801ca1 <strlen+0x32>
+		n++;
+  801c98:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801c9c:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801ca1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ca5:	0f b6 00             	movzbl (%rax),%eax
+  801ca8:	84 c0                	test   %al,%al
+  801caa:	75 ec                	jne    801c98 <strlen+0x29>
+	return n;
+  801cac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801caf:	c9                   	leave
+  801cb0:	c3                   	ret
+
+0000000000801cb1 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801cb1:	55                   	push   %rbp
+  801cb2:	48 89 e5             	mov    %rsp,%rbp
+  801cb5:	48 83 ec 20          	sub    $0x20,%rsp
+  801cb9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801cb9 <strnlen+0x8>
+  801cc0:	49 bb 87 93 00 00 00 	movabs $0x9387,%r11
+  801cc7:	00 00 00 
+  801cca:	4c 01 d8             	add    %r11,%rax
+  801ccd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801cd1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801cd5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801cdc:	eb 0e                	jmp    801cec <strnlen+0x3b>
+		n++;
+  801cde:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801ce2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801ce7:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801cec:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801cf1:	74 0b                	je     801cfe <strnlen+0x4d>
+  801cf3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cf7:	0f b6 00             	movzbl (%rax),%eax
+  801cfa:	84 c0                	test   %al,%al
+  801cfc:	75 e0                	jne    801cde <strnlen+0x2d>
+	return n;
+  801cfe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801d01:	c9                   	leave
+  801d02:	c3                   	ret
+
+0000000000801d03 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801d03:	55                   	push   %rbp
+  801d04:	48 89 e5             	mov    %rsp,%rbp
+  801d07:	48 83 ec 20          	sub    $0x20,%rsp
+  801d0b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d0b <strcpy+0x8>
+  801d12:	49 bb 35 93 00 00 00 	movabs $0x9335,%r11
+  801d19:	00 00 00 
+  801d1c:	4c 01 d8             	add    %r11,%rax
+  801d1f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d23:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801d27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d2b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801d2f:	90                   	nop
+  801d30:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801d34:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801d38:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801d3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d40:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801d44:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d48:	0f b6 12             	movzbl (%rdx),%edx
+  801d4b:	88 10                	mov    %dl,(%rax)
+  801d4d:	0f b6 00             	movzbl (%rax),%eax
+  801d50:	84 c0                	test   %al,%al
+  801d52:	75 dc                	jne    801d30 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801d54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801d58:	c9                   	leave
+  801d59:	c3                   	ret
+
+0000000000801d5a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801d5a:	55                   	push   %rbp
+  801d5b:	48 89 e5             	mov    %rsp,%rbp
+  801d5e:	53                   	push   %rbx
+  801d5f:	48 83 ec 20          	sub    $0x20,%rsp
+  801d63:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801d63 <strcat+0x9>
+  801d6a:	49 bb dd 92 00 00 00 	movabs $0x92dd,%r11
+  801d71:	00 00 00 
+  801d74:	4c 01 db             	add    %r11,%rbx
+  801d77:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801d7b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801d7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d83:	48 89 c7             	mov    %rax,%rdi
+  801d86:	48 b8 2f 6c ff ff ff 	movabs $0xffffffffffff6c2f,%rax
+  801d8d:	ff ff ff 
+  801d90:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d94:	ff d0                	call   *%rax
+  801d96:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801d99:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801d9c:	48 63 d0             	movslq %eax,%rdx
+  801d9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801da3:	48 01 c2             	add    %rax,%rdx
+  801da6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801daa:	48 89 c6             	mov    %rax,%rsi
+  801dad:	48 89 d7             	mov    %rdx,%rdi
+  801db0:	48 b8 c3 6c ff ff ff 	movabs $0xffffffffffff6cc3,%rax
+  801db7:	ff ff ff 
+  801dba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801dbe:	ff d0                	call   *%rax
+	return dst;
+  801dc0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801dc4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dc8:	c9                   	leave
+  801dc9:	c3                   	ret
+
+0000000000801dca <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801dca:	55                   	push   %rbp
+  801dcb:	48 89 e5             	mov    %rsp,%rbp
+  801dce:	48 83 ec 28          	sub    $0x28,%rsp
+  801dd2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801dd2 <strncpy+0x8>
+  801dd9:	49 bb 6e 92 00 00 00 	movabs $0x926e,%r11
+  801de0:	00 00 00 
+  801de3:	4c 01 d8             	add    %r11,%rax
+  801de6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801dea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801dee:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801df2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801df6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801dfa:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801e01:	00 
+  801e02:	eb 2a                	jmp    801e2e <strncpy+0x64>
+		*dst++ = *src;
+  801e04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e08:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e0c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801e10:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801e14:	0f b6 12             	movzbl (%rdx),%edx
+  801e17:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801e19:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e1d:	0f b6 00             	movzbl (%rax),%eax
+  801e20:	84 c0                	test   %al,%al
+  801e22:	74 05                	je     801e29 <strncpy+0x5f>
+			src++;
+  801e24:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801e29:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801e2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e32:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801e36:	72 cc                	jb     801e04 <strncpy+0x3a>
+	}
+	return ret;
+  801e38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801e3c:	c9                   	leave
+  801e3d:	c3                   	ret
+
+0000000000801e3e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801e3e:	55                   	push   %rbp
+  801e3f:	48 89 e5             	mov    %rsp,%rbp
+  801e42:	48 83 ec 28          	sub    $0x28,%rsp
+  801e46:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e46 <strlcpy+0x8>
+  801e4d:	49 bb fa 91 00 00 00 	movabs $0x91fa,%r11
+  801e54:	00 00 00 
+  801e57:	4c 01 d8             	add    %r11,%rax
+  801e5a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801e5e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801e62:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801e66:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e6a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801e6e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801e73:	74 3d                	je     801eb2 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801e75:	eb 1d                	jmp    801e94 <strlcpy+0x56>
+			*dst++ = *src++;
+  801e77:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801e7b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801e7f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801e83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e87:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801e8b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e8f:	0f b6 12             	movzbl (%rdx),%edx
+  801e92:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801e94:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801e99:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801e9e:	74 0b                	je     801eab <strlcpy+0x6d>
+  801ea0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ea4:	0f b6 00             	movzbl (%rax),%eax
+  801ea7:	84 c0                	test   %al,%al
+  801ea9:	75 cc                	jne    801e77 <strlcpy+0x39>
+		*dst = '\0';
+  801eab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801eaf:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801eb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801eb6:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801eba:	c9                   	leave
+  801ebb:	c3                   	ret
+
+0000000000801ebc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801ebc:	55                   	push   %rbp
+  801ebd:	48 89 e5             	mov    %rsp,%rbp
+  801ec0:	48 83 ec 10          	sub    $0x10,%rsp
+  801ec4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ec4 <strcmp+0x8>
+  801ecb:	49 bb 7c 91 00 00 00 	movabs $0x917c,%r11
+  801ed2:	00 00 00 
+  801ed5:	4c 01 d8             	add    %r11,%rax
+  801ed8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801edc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801ee0:	eb 0a                	jmp    801eec <strcmp+0x30>
+		p++, q++;
+  801ee2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ee7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801eec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ef0:	0f b6 00             	movzbl (%rax),%eax
+  801ef3:	84 c0                	test   %al,%al
+  801ef5:	74 12                	je     801f09 <strcmp+0x4d>
+  801ef7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801efb:	0f b6 10             	movzbl (%rax),%edx
+  801efe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f02:	0f b6 00             	movzbl (%rax),%eax
+  801f05:	38 c2                	cmp    %al,%dl
+  801f07:	74 d9                	je     801ee2 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801f09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f0d:	0f b6 00             	movzbl (%rax),%eax
+  801f10:	0f b6 d0             	movzbl %al,%edx
+  801f13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f17:	0f b6 00             	movzbl (%rax),%eax
+  801f1a:	0f b6 c0             	movzbl %al,%eax
+  801f1d:	29 c2                	sub    %eax,%edx
+  801f1f:	89 d0                	mov    %edx,%eax
+}
+  801f21:	c9                   	leave
+  801f22:	c3                   	ret
+
+0000000000801f23 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801f23:	55                   	push   %rbp
+  801f24:	48 89 e5             	mov    %rsp,%rbp
+  801f27:	48 83 ec 18          	sub    $0x18,%rsp
+  801f2b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f2b <strncmp+0x8>
+  801f32:	49 bb 15 91 00 00 00 	movabs $0x9115,%r11
+  801f39:	00 00 00 
+  801f3c:	4c 01 d8             	add    %r11,%rax
+  801f3f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f43:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f47:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801f4b:	eb 0f                	jmp    801f5c <strncmp+0x39>
+		n--, p++, q++;
+  801f4d:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801f52:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801f57:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801f5c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f61:	74 1d                	je     801f80 <strncmp+0x5d>
+  801f63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f67:	0f b6 00             	movzbl (%rax),%eax
+  801f6a:	84 c0                	test   %al,%al
+  801f6c:	74 12                	je     801f80 <strncmp+0x5d>
+  801f6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f72:	0f b6 10             	movzbl (%rax),%edx
+  801f75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f79:	0f b6 00             	movzbl (%rax),%eax
+  801f7c:	38 c2                	cmp    %al,%dl
+  801f7e:	74 cd                	je     801f4d <strncmp+0x2a>
+	if (n == 0)
+  801f80:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f85:	75 07                	jne    801f8e <strncmp+0x6b>
+		return 0;
+  801f87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8c:	eb 16                	jmp    801fa4 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801f8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f92:	0f b6 00             	movzbl (%rax),%eax
+  801f95:	0f b6 d0             	movzbl %al,%edx
+  801f98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f9c:	0f b6 00             	movzbl (%rax),%eax
+  801f9f:	0f b6 c0             	movzbl %al,%eax
+  801fa2:	29 c2                	sub    %eax,%edx
+}
+  801fa4:	89 d0                	mov    %edx,%eax
+  801fa6:	c9                   	leave
+  801fa7:	c3                   	ret
+
+0000000000801fa8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801fa8:	55                   	push   %rbp
+  801fa9:	48 89 e5             	mov    %rsp,%rbp
+  801fac:	48 83 ec 10          	sub    $0x10,%rsp
+  801fb0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fb0 <strchr+0x8>
+  801fb7:	49 bb 90 90 00 00 00 	movabs $0x9090,%r11
+  801fbe:	00 00 00 
+  801fc1:	4c 01 d8             	add    %r11,%rax
+  801fc4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801fc8:	89 f0                	mov    %esi,%eax
+  801fca:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801fcd:	eb 17                	jmp    801fe6 <strchr+0x3e>
+		if (*s == c)
+  801fcf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fd3:	0f b6 00             	movzbl (%rax),%eax
+  801fd6:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801fd9:	75 06                	jne    801fe1 <strchr+0x39>
+			return (char *) s;
+  801fdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fdf:	eb 15                	jmp    801ff6 <strchr+0x4e>
+	for (; *s; s++)
+  801fe1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801fe6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fea:	0f b6 00             	movzbl (%rax),%eax
+  801fed:	84 c0                	test   %al,%al
+  801fef:	75 de                	jne    801fcf <strchr+0x27>
+	return 0;
+  801ff1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ff6:	c9                   	leave
+  801ff7:	c3                   	ret
+
+0000000000801ff8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801ff8:	55                   	push   %rbp
+  801ff9:	48 89 e5             	mov    %rsp,%rbp
+  801ffc:	48 83 ec 10          	sub    $0x10,%rsp
+  802000:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802000 <strfind+0x8>
+  802007:	49 bb 40 90 00 00 00 	movabs $0x9040,%r11
+  80200e:	00 00 00 
+  802011:	4c 01 d8             	add    %r11,%rax
+  802014:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802018:	89 f0                	mov    %esi,%eax
+  80201a:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80201d:	eb 11                	jmp    802030 <strfind+0x38>
+		if (*s == c)
+  80201f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802023:	0f b6 00             	movzbl (%rax),%eax
+  802026:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  802029:	74 12                	je     80203d <strfind+0x45>
+	for (; *s; s++)
+  80202b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802030:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802034:	0f b6 00             	movzbl (%rax),%eax
+  802037:	84 c0                	test   %al,%al
+  802039:	75 e4                	jne    80201f <strfind+0x27>
+  80203b:	eb 01                	jmp    80203e <strfind+0x46>
+			break;
+  80203d:	90                   	nop
+	return (char *) s;
+  80203e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802042:	c9                   	leave
+  802043:	c3                   	ret
+
+0000000000802044 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802044:	55                   	push   %rbp
+  802045:	48 89 e5             	mov    %rsp,%rbp
+  802048:	48 83 ec 18          	sub    $0x18,%rsp
+  80204c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80204c <memset+0x8>
+  802053:	49 bb f4 8f 00 00 00 	movabs $0x8ff4,%r11
+  80205a:	00 00 00 
+  80205d:	4c 01 d8             	add    %r11,%rax
+  802060:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802064:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802067:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80206b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802070:	75 06                	jne    802078 <memset+0x34>
+		return v;
+  802072:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802076:	eb 69                	jmp    8020e1 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  802078:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80207c:	83 e0 03             	and    $0x3,%eax
+  80207f:	48 85 c0             	test   %rax,%rax
+  802082:	75 48                	jne    8020cc <memset+0x88>
+  802084:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802088:	83 e0 03             	and    $0x3,%eax
+  80208b:	48 85 c0             	test   %rax,%rax
+  80208e:	75 3c                	jne    8020cc <memset+0x88>
+		c &= 0xFF;
+  802090:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  802097:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80209a:	c1 e0 18             	shl    $0x18,%eax
+  80209d:	89 c2                	mov    %eax,%edx
+  80209f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8020a2:	c1 e0 10             	shl    $0x10,%eax
+  8020a5:	09 c2                	or     %eax,%edx
+  8020a7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8020aa:	c1 e0 08             	shl    $0x8,%eax
+  8020ad:	09 d0                	or     %edx,%eax
+  8020af:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8020b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020b6:	48 c1 e8 02          	shr    $0x2,%rax
+  8020ba:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8020bd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8020c1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8020c4:	48 89 d7             	mov    %rdx,%rdi
+  8020c7:	fc                   	cld
+  8020c8:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8020ca:	eb 11                	jmp    8020dd <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8020cc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8020d0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8020d3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8020d7:	48 89 d7             	mov    %rdx,%rdi
+  8020da:	fc                   	cld
+  8020db:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8020dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8020e1:	c9                   	leave
+  8020e2:	c3                   	ret
+
+00000000008020e3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8020e3:	55                   	push   %rbp
+  8020e4:	48 89 e5             	mov    %rsp,%rbp
+  8020e7:	48 83 ec 28          	sub    $0x28,%rsp
+  8020eb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020eb <memmove+0x8>
+  8020f2:	49 bb 55 8f 00 00 00 	movabs $0x8f55,%r11
+  8020f9:	00 00 00 
+  8020fc:	4c 01 d8             	add    %r11,%rax
+  8020ff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802103:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802107:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80210b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80210f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  802113:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802117:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80211b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80211f:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802123:	0f 83 88 00 00 00    	jae    8021b1 <memmove+0xce>
+  802129:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80212d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802131:	48 01 d0             	add    %rdx,%rax
+  802134:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802138:	73 77                	jae    8021b1 <memmove+0xce>
+		s += n;
+  80213a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80213e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  802142:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802146:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80214a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80214e:	83 e0 03             	and    $0x3,%eax
+  802151:	48 85 c0             	test   %rax,%rax
+  802154:	75 3b                	jne    802191 <memmove+0xae>
+  802156:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80215a:	83 e0 03             	and    $0x3,%eax
+  80215d:	48 85 c0             	test   %rax,%rax
+  802160:	75 2f                	jne    802191 <memmove+0xae>
+  802162:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802166:	83 e0 03             	and    $0x3,%eax
+  802169:	48 85 c0             	test   %rax,%rax
+  80216c:	75 23                	jne    802191 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80216e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802172:	48 83 e8 04          	sub    $0x4,%rax
+  802176:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80217a:	48 83 ea 04          	sub    $0x4,%rdx
+  80217e:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802182:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  802186:	48 89 c7             	mov    %rax,%rdi
+  802189:	48 89 d6             	mov    %rdx,%rsi
+  80218c:	fd                   	std
+  80218d:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80218f:	eb 1d                	jmp    8021ae <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802191:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802195:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802199:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80219d:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8021a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021a5:	48 89 d7             	mov    %rdx,%rdi
+  8021a8:	48 89 c1             	mov    %rax,%rcx
+  8021ab:	fd                   	std
+  8021ac:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8021ae:	fc                   	cld
+  8021af:	eb 57                	jmp    802208 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8021b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021b5:	83 e0 03             	and    $0x3,%eax
+  8021b8:	48 85 c0             	test   %rax,%rax
+  8021bb:	75 36                	jne    8021f3 <memmove+0x110>
+  8021bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021c1:	83 e0 03             	and    $0x3,%eax
+  8021c4:	48 85 c0             	test   %rax,%rax
+  8021c7:	75 2a                	jne    8021f3 <memmove+0x110>
+  8021c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021cd:	83 e0 03             	and    $0x3,%eax
+  8021d0:	48 85 c0             	test   %rax,%rax
+  8021d3:	75 1e                	jne    8021f3 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8021d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021d9:	48 c1 e8 02          	shr    $0x2,%rax
+  8021dd:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8021e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021e4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8021e8:	48 89 c7             	mov    %rax,%rdi
+  8021eb:	48 89 d6             	mov    %rdx,%rsi
+  8021ee:	fc                   	cld
+  8021ef:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8021f1:	eb 15                	jmp    802208 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  8021f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021f7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8021fb:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8021ff:	48 89 c7             	mov    %rax,%rdi
+  802202:	48 89 d6             	mov    %rdx,%rsi
+  802205:	fc                   	cld
+  802206:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  802208:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80220c:	c9                   	leave
+  80220d:	c3                   	ret
+
+000000000080220e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80220e:	55                   	push   %rbp
+  80220f:	48 89 e5             	mov    %rsp,%rbp
+  802212:	48 83 ec 18          	sub    $0x18,%rsp
+  802216:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802216 <memcpy+0x8>
+  80221d:	49 bb 2a 8e 00 00 00 	movabs $0x8e2a,%r11
+  802224:	00 00 00 
+  802227:	4c 01 d8             	add    %r11,%rax
+  80222a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80222e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802232:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  802236:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80223a:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80223e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802242:	48 89 cf             	mov    %rcx,%rdi
+  802245:	48 b9 a3 70 ff ff ff 	movabs $0xffffffffffff70a3,%rcx
+  80224c:	ff ff ff 
+  80224f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802253:	ff d0                	call   *%rax
+}
+  802255:	c9                   	leave
+  802256:	c3                   	ret
+
+0000000000802257 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802257:	55                   	push   %rbp
+  802258:	48 89 e5             	mov    %rsp,%rbp
+  80225b:	48 83 ec 28          	sub    $0x28,%rsp
+  80225f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80225f <memcmp+0x8>
+  802266:	49 bb e1 8d 00 00 00 	movabs $0x8de1,%r11
+  80226d:	00 00 00 
+  802270:	4c 01 d8             	add    %r11,%rax
+  802273:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802277:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80227b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80227f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802283:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  802287:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80228b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80228f:	eb 34                	jmp    8022c5 <memcmp+0x6e>
+		if (*s1 != *s2)
+  802291:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802295:	0f b6 10             	movzbl (%rax),%edx
+  802298:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80229c:	0f b6 00             	movzbl (%rax),%eax
+  80229f:	38 c2                	cmp    %al,%dl
+  8022a1:	74 18                	je     8022bb <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  8022a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022a7:	0f b6 00             	movzbl (%rax),%eax
+  8022aa:	0f b6 d0             	movzbl %al,%edx
+  8022ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022b1:	0f b6 00             	movzbl (%rax),%eax
+  8022b4:	0f b6 c0             	movzbl %al,%eax
+  8022b7:	29 c2                	sub    %eax,%edx
+  8022b9:	eb 20                	jmp    8022db <memcmp+0x84>
+		s1++, s2++;
+  8022bb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8022c0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  8022c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022c9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8022cd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8022d1:	48 85 c0             	test   %rax,%rax
+  8022d4:	75 bb                	jne    802291 <memcmp+0x3a>
+	}
+
+	return 0;
+  8022d6:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8022db:	89 d0                	mov    %edx,%eax
+  8022dd:	c9                   	leave
+  8022de:	c3                   	ret
+
+00000000008022df <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8022df:	55                   	push   %rbp
+  8022e0:	48 89 e5             	mov    %rsp,%rbp
+  8022e3:	48 83 ec 28          	sub    $0x28,%rsp
+  8022e7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022e7 <memfind+0x8>
+  8022ee:	49 bb 59 8d 00 00 00 	movabs $0x8d59,%r11
+  8022f5:	00 00 00 
+  8022f8:	4c 01 d8             	add    %r11,%rax
+  8022fb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8022ff:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802302:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  802306:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80230a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80230e:	48 01 d0             	add    %rdx,%rax
+  802311:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  802315:	eb 13                	jmp    80232a <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802317:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80231b:	0f b6 00             	movzbl (%rax),%eax
+  80231e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802321:	38 d0                	cmp    %dl,%al
+  802323:	74 11                	je     802336 <memfind+0x57>
+	for (; s < ends; s++)
+  802325:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80232a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80232e:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  802332:	72 e3                	jb     802317 <memfind+0x38>
+  802334:	eb 01                	jmp    802337 <memfind+0x58>
+			break;
+  802336:	90                   	nop
+	return (void *) s;
+  802337:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80233b:	c9                   	leave
+  80233c:	c3                   	ret
+
+000000000080233d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80233d:	55                   	push   %rbp
+  80233e:	48 89 e5             	mov    %rsp,%rbp
+  802341:	48 83 ec 38          	sub    $0x38,%rsp
+  802345:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802345 <strtol+0x8>
+  80234c:	49 bb fb 8c 00 00 00 	movabs $0x8cfb,%r11
+  802353:	00 00 00 
+  802356:	4c 01 d8             	add    %r11,%rax
+  802359:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80235d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802361:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  802364:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80236b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802372:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802373:	eb 05                	jmp    80237a <strtol+0x3d>
+		s++;
+  802375:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  80237a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80237e:	0f b6 00             	movzbl (%rax),%eax
+  802381:	3c 20                	cmp    $0x20,%al
+  802383:	74 f0                	je     802375 <strtol+0x38>
+  802385:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802389:	0f b6 00             	movzbl (%rax),%eax
+  80238c:	3c 09                	cmp    $0x9,%al
+  80238e:	74 e5                	je     802375 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  802390:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802394:	0f b6 00             	movzbl (%rax),%eax
+  802397:	3c 2b                	cmp    $0x2b,%al
+  802399:	75 07                	jne    8023a2 <strtol+0x65>
+		s++;
+  80239b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8023a0:	eb 17                	jmp    8023b9 <strtol+0x7c>
+	else if (*s == '-')
+  8023a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023a6:	0f b6 00             	movzbl (%rax),%eax
+  8023a9:	3c 2d                	cmp    $0x2d,%al
+  8023ab:	75 0c                	jne    8023b9 <strtol+0x7c>
+		s++, neg = 1;
+  8023ad:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8023b2:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8023b9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8023bd:	74 06                	je     8023c5 <strtol+0x88>
+  8023bf:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8023c3:	75 28                	jne    8023ed <strtol+0xb0>
+  8023c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023c9:	0f b6 00             	movzbl (%rax),%eax
+  8023cc:	3c 30                	cmp    $0x30,%al
+  8023ce:	75 1d                	jne    8023ed <strtol+0xb0>
+  8023d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023d4:	48 83 c0 01          	add    $0x1,%rax
+  8023d8:	0f b6 00             	movzbl (%rax),%eax
+  8023db:	3c 78                	cmp    $0x78,%al
+  8023dd:	75 0e                	jne    8023ed <strtol+0xb0>
+		s += 2, base = 16;
+  8023df:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8023e4:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8023eb:	eb 2c                	jmp    802419 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  8023ed:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8023f1:	75 19                	jne    80240c <strtol+0xcf>
+  8023f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023f7:	0f b6 00             	movzbl (%rax),%eax
+  8023fa:	3c 30                	cmp    $0x30,%al
+  8023fc:	75 0e                	jne    80240c <strtol+0xcf>
+		s++, base = 8;
+  8023fe:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802403:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80240a:	eb 0d                	jmp    802419 <strtol+0xdc>
+	else if (base == 0)
+  80240c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802410:	75 07                	jne    802419 <strtol+0xdc>
+		base = 10;
+  802412:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  802419:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80241d:	0f b6 00             	movzbl (%rax),%eax
+  802420:	3c 2f                	cmp    $0x2f,%al
+  802422:	7e 1d                	jle    802441 <strtol+0x104>
+  802424:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802428:	0f b6 00             	movzbl (%rax),%eax
+  80242b:	3c 39                	cmp    $0x39,%al
+  80242d:	7f 12                	jg     802441 <strtol+0x104>
+			dig = *s - '0';
+  80242f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802433:	0f b6 00             	movzbl (%rax),%eax
+  802436:	0f be c0             	movsbl %al,%eax
+  802439:	83 e8 30             	sub    $0x30,%eax
+  80243c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80243f:	eb 4e                	jmp    80248f <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  802441:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802445:	0f b6 00             	movzbl (%rax),%eax
+  802448:	3c 60                	cmp    $0x60,%al
+  80244a:	7e 1d                	jle    802469 <strtol+0x12c>
+  80244c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802450:	0f b6 00             	movzbl (%rax),%eax
+  802453:	3c 7a                	cmp    $0x7a,%al
+  802455:	7f 12                	jg     802469 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  802457:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80245b:	0f b6 00             	movzbl (%rax),%eax
+  80245e:	0f be c0             	movsbl %al,%eax
+  802461:	83 e8 57             	sub    $0x57,%eax
+  802464:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802467:	eb 26                	jmp    80248f <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  802469:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80246d:	0f b6 00             	movzbl (%rax),%eax
+  802470:	3c 40                	cmp    $0x40,%al
+  802472:	7e 47                	jle    8024bb <strtol+0x17e>
+  802474:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802478:	0f b6 00             	movzbl (%rax),%eax
+  80247b:	3c 5a                	cmp    $0x5a,%al
+  80247d:	7f 3c                	jg     8024bb <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  80247f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802483:	0f b6 00             	movzbl (%rax),%eax
+  802486:	0f be c0             	movsbl %al,%eax
+  802489:	83 e8 37             	sub    $0x37,%eax
+  80248c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  80248f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802492:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802495:	7d 23                	jge    8024ba <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  802497:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80249c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80249f:	48 98                	cltq
+  8024a1:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8024a6:	48 89 c2             	mov    %rax,%rdx
+  8024a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024ac:	48 98                	cltq
+  8024ae:	48 01 d0             	add    %rdx,%rax
+  8024b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  8024b5:	e9 5f ff ff ff       	jmp    802419 <strtol+0xdc>
+			break;
+  8024ba:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8024bb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8024c0:	74 0b                	je     8024cd <strtol+0x190>
+		*endptr = (char *) s;
+  8024c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024c6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8024ca:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  8024cd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8024d1:	74 09                	je     8024dc <strtol+0x19f>
+  8024d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8024d7:	48 f7 d8             	neg    %rax
+  8024da:	eb 04                	jmp    8024e0 <strtol+0x1a3>
+  8024dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8024e0:	c9                   	leave
+  8024e1:	c3                   	ret
+
+00000000008024e2 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  8024e2:	55                   	push   %rbp
+  8024e3:	48 89 e5             	mov    %rsp,%rbp
+  8024e6:	53                   	push   %rbx
+  8024e7:	48 83 ec 30          	sub    $0x30,%rsp
+  8024eb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8024eb <strstr+0x9>
+  8024f2:	49 bb 55 8b 00 00 00 	movabs $0x8b55,%r11
+  8024f9:	00 00 00 
+  8024fc:	4c 01 db             	add    %r11,%rbx
+  8024ff:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  802503:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  802507:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80250b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80250f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802513:	0f b6 00             	movzbl (%rax),%eax
+  802516:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  802519:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  80251d:	75 06                	jne    802525 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  80251f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802523:	eb 73                	jmp    802598 <strstr+0xb6>
+
+	len = strlen(str);
+  802525:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802529:	48 89 c7             	mov    %rax,%rdi
+  80252c:	48 b8 2f 6c ff ff ff 	movabs $0xffffffffffff6c2f,%rax
+  802533:	ff ff ff 
+  802536:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80253a:	ff d0                	call   *%rax
+  80253c:	48 98                	cltq
+  80253e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  802542:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802546:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80254a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80254e:	0f b6 00             	movzbl (%rax),%eax
+  802551:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  802554:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  802558:	75 07                	jne    802561 <strstr+0x7f>
+				return (char *) 0;
+  80255a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255f:	eb 37                	jmp    802598 <strstr+0xb6>
+		} while (sc != c);
+  802561:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  802565:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  802568:	75 d8                	jne    802542 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  80256a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80256e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802572:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802576:	48 89 ce             	mov    %rcx,%rsi
+  802579:	48 89 c7             	mov    %rax,%rdi
+  80257c:	48 b8 e3 6e ff ff ff 	movabs $0xffffffffffff6ee3,%rax
+  802583:	ff ff ff 
+  802586:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80258a:	ff d0                	call   *%rax
+  80258c:	85 c0                	test   %eax,%eax
+  80258e:	75 b2                	jne    802542 <strstr+0x60>
+
+	return (char *) (in - 1);
+  802590:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802594:	48 83 e8 01          	sub    $0x1,%rax
+}
+  802598:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80259c:	c9                   	leave
+  80259d:	c3                   	ret
+
+000000000080259e <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  80259e:	55                   	push   %rbp
+  80259f:	48 89 e5             	mov    %rsp,%rbp
+  8025a2:	41 57                	push   %r15
+  8025a4:	53                   	push   %rbx
+  8025a5:	48 83 ec 40          	sub    $0x40,%rsp
+  8025a9:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8025a9 <syscall+0xb>
+  8025b0:	49 bb 97 8a 00 00 00 	movabs $0x8a97,%r11
+  8025b7:	00 00 00 
+  8025ba:	4d 01 da             	add    %r11,%r10
+  8025bd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8025c0:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8025c3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8025c7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8025cb:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8025cf:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  8025d3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8025d6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8025da:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8025de:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8025e2:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8025e6:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8025ea:	4c 89 c3             	mov    %r8,%rbx
+  8025ed:	cd 30                	int    $0x30
+  8025ef:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  8025f3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8025f7:	74 52                	je     80264b <syscall+0xad>
+  8025f9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8025fe:	7e 4b                	jle    80264b <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802600:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802604:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802607:	49 89 d0             	mov    %rdx,%r8
+  80260a:	89 c1                	mov    %eax,%ecx
+  80260c:	48 b8 90 da ff ff ff 	movabs $0xffffffffffffda90,%rax
+  802613:	ff ff ff 
+  802616:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80261a:	48 89 c2             	mov    %rax,%rdx
+  80261d:	be 23 00 00 00       	mov    $0x23,%esi
+  802622:	48 b8 ad da ff ff ff 	movabs $0xffffffffffffdaad,%rax
+  802629:	ff ff ff 
+  80262c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  802630:	48 89 c7             	mov    %rax,%rdi
+  802633:	4d 89 d7             	mov    %r10,%r15
+  802636:	b8 00 00 00 00       	mov    $0x0,%eax
+  80263b:	49 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r9
+  802642:	ff ff ff 
+  802645:	4d 01 d1             	add    %r10,%r9
+  802648:	41 ff d1             	call   *%r9
+
+	return ret;
+  80264b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80264f:	48 83 c4 40          	add    $0x40,%rsp
+  802653:	5b                   	pop    %rbx
+  802654:	41 5f                	pop    %r15
+  802656:	5d                   	pop    %rbp
+  802657:	c3                   	ret
+
+0000000000802658 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  802658:	55                   	push   %rbp
+  802659:	48 89 e5             	mov    %rsp,%rbp
+  80265c:	41 57                	push   %r15
+  80265e:	41 56                	push   %r14
+  802660:	41 55                	push   %r13
+  802662:	41 54                	push   %r12
+  802664:	53                   	push   %rbx
+  802665:	48 83 ec 48          	sub    $0x48,%rsp
+  802669:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 802669 <syscall_words+0x11>
+  802670:	49 bb d7 89 00 00 00 	movabs $0x89d7,%r11
+  802677:	00 00 00 
+  80267a:	4d 01 de             	add    %r11,%r14
+  80267d:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802680:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  802683:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  802687:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  80268b:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  80268f:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  802693:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802698:	74 09                	je     8026a3 <syscall_words+0x4b>
+  80269a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80269e:	48 8b 00             	mov    (%rax),%rax
+  8026a1:	eb 05                	jmp    8026a8 <syscall_words+0x50>
+  8026a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a8:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  8026ab:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8026b0:	74 0a                	je     8026bc <syscall_words+0x64>
+  8026b2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8026b6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8026ba:	eb 05                	jmp    8026c1 <syscall_words+0x69>
+  8026bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c1:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  8026c4:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8026c9:	74 0a                	je     8026d5 <syscall_words+0x7d>
+  8026cb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8026cf:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8026d3:	eb 05                	jmp    8026da <syscall_words+0x82>
+  8026d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026da:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  8026dd:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8026e2:	74 0a                	je     8026ee <syscall_words+0x96>
+  8026e4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8026e8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8026ec:	eb 05                	jmp    8026f3 <syscall_words+0x9b>
+  8026ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f3:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  8026f6:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8026fb:	74 0a                	je     802707 <syscall_words+0xaf>
+  8026fd:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802701:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802705:	eb 05                	jmp    80270c <syscall_words+0xb4>
+  802707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270c:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  80270f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802714:	74 0a                	je     802720 <syscall_words+0xc8>
+  802716:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80271a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80271e:	eb 05                	jmp    802725 <syscall_words+0xcd>
+  802720:	b8 00 00 00 00       	mov    $0x0,%eax
+  802725:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  802728:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80272b:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80272f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802733:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  802737:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80273b:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80273f:	cd 30                	int    $0x30
+  802741:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  802745:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80274a:	74 50                	je     80279c <syscall_words+0x144>
+		words[0] = r8;
+  80274c:	4c 89 c2             	mov    %r8,%rdx
+  80274f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802753:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802756:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80275a:	48 83 c0 08          	add    $0x8,%rax
+  80275e:	4c 89 ca             	mov    %r9,%rdx
+  802761:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802764:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802768:	48 83 c0 10          	add    $0x10,%rax
+  80276c:	4c 89 d2             	mov    %r10,%rdx
+  80276f:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  802772:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802776:	48 83 c0 18          	add    $0x18,%rax
+  80277a:	4c 89 da             	mov    %r11,%rdx
+  80277d:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  802780:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802784:	48 83 c0 20          	add    $0x20,%rax
+  802788:	4c 89 e2             	mov    %r12,%rdx
+  80278b:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  80278e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802792:	48 83 c0 28          	add    $0x28,%rax
+  802796:	4c 89 ea             	mov    %r13,%rdx
+  802799:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  80279c:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8027a0:	74 52                	je     8027f4 <syscall_words+0x19c>
+  8027a2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8027a7:	7e 4b                	jle    8027f4 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8027a9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8027ad:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8027b0:	49 89 d0             	mov    %rdx,%r8
+  8027b3:	89 c1                	mov    %eax,%ecx
+  8027b5:	48 b8 90 da ff ff ff 	movabs $0xffffffffffffda90,%rax
+  8027bc:	ff ff ff 
+  8027bf:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8027c3:	48 89 c2             	mov    %rax,%rdx
+  8027c6:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8027cb:	48 b8 ad da ff ff ff 	movabs $0xffffffffffffdaad,%rax
+  8027d2:	ff ff ff 
+  8027d5:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8027d9:	48 89 c7             	mov    %rax,%rdi
+  8027dc:	4d 89 f7             	mov    %r14,%r15
+  8027df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e4:	49 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r9
+  8027eb:	ff ff ff 
+  8027ee:	4d 01 f1             	add    %r14,%r9
+  8027f1:	41 ff d1             	call   *%r9
+
+	return ret;
+  8027f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8027f8:	48 83 c4 48          	add    $0x48,%rsp
+  8027fc:	5b                   	pop    %rbx
+  8027fd:	41 5c                	pop    %r12
+  8027ff:	41 5d                	pop    %r13
+  802801:	41 5e                	pop    %r14
+  802803:	41 5f                	pop    %r15
+  802805:	5d                   	pop    %rbp
+  802806:	c3                   	ret
+
+0000000000802807 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802807:	55                   	push   %rbp
+  802808:	48 89 e5             	mov    %rsp,%rbp
+  80280b:	48 83 ec 10          	sub    $0x10,%rsp
+  80280f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80280f <sys_cputs+0x8>
+  802816:	49 bb 31 88 00 00 00 	movabs $0x8831,%r11
+  80281d:	00 00 00 
+  802820:	4c 01 d8             	add    %r11,%rax
+  802823:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802827:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80282b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80282f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802833:	48 83 ec 08          	sub    $0x8,%rsp
+  802837:	6a 00                	push   $0x0
+  802839:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80283f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802845:	be 00 00 00 00       	mov    $0x0,%esi
+  80284a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80284f:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802856:	ff ff ff 
+  802859:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80285d:	ff d0                	call   *%rax
+  80285f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802863:	90                   	nop
+  802864:	c9                   	leave
+  802865:	c3                   	ret
+
+0000000000802866 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802866:	55                   	push   %rbp
+  802867:	48 89 e5             	mov    %rsp,%rbp
+  80286a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80286a <sys_cgetc+0x4>
+  802871:	49 bb d6 87 00 00 00 	movabs $0x87d6,%r11
+  802878:	00 00 00 
+  80287b:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80287e:	48 83 ec 08          	sub    $0x8,%rsp
+  802882:	6a 00                	push   $0x0
+  802884:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80288a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802890:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802895:	ba 00 00 00 00       	mov    $0x0,%edx
+  80289a:	be 00 00 00 00       	mov    $0x0,%esi
+  80289f:	bf 01 00 00 00       	mov    $0x1,%edi
+  8028a4:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  8028ab:	ff ff ff 
+  8028ae:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028b2:	ff d0                	call   *%rax
+  8028b4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028b8:	c9                   	leave
+  8028b9:	c3                   	ret
+
+00000000008028ba <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8028ba:	55                   	push   %rbp
+  8028bb:	48 89 e5             	mov    %rsp,%rbp
+  8028be:	48 83 ec 10          	sub    $0x10,%rsp
+  8028c2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028c2 <sys_env_destroy+0x8>
+  8028c9:	49 bb 7e 87 00 00 00 	movabs $0x877e,%r11
+  8028d0:	00 00 00 
+  8028d3:	4c 01 d8             	add    %r11,%rax
+  8028d6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8028d9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8028dc:	48 63 d2             	movslq %edx,%rdx
+  8028df:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e3:	6a 00                	push   $0x0
+  8028e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028f6:	be 01 00 00 00       	mov    $0x1,%esi
+  8028fb:	bf 03 00 00 00       	mov    $0x3,%edi
+  802900:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802907:	ff ff ff 
+  80290a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80290e:	ff d0                	call   *%rax
+  802910:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802914:	c9                   	leave
+  802915:	c3                   	ret
+
+0000000000802916 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802916:	55                   	push   %rbp
+  802917:	48 89 e5             	mov    %rsp,%rbp
+  80291a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80291a <sys_getenvid+0x4>
+  802921:	49 bb 26 87 00 00 00 	movabs $0x8726,%r11
+  802928:	00 00 00 
+  80292b:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80292e:	48 83 ec 08          	sub    $0x8,%rsp
+  802932:	6a 00                	push   $0x0
+  802934:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80293a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802940:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802945:	ba 00 00 00 00       	mov    $0x0,%edx
+  80294a:	be 00 00 00 00       	mov    $0x0,%esi
+  80294f:	bf 02 00 00 00       	mov    $0x2,%edi
+  802954:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  80295b:	ff ff ff 
+  80295e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802962:	ff d0                	call   *%rax
+  802964:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802968:	c9                   	leave
+  802969:	c3                   	ret
+
+000000000080296a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80296a:	55                   	push   %rbp
+  80296b:	48 89 e5             	mov    %rsp,%rbp
+  80296e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80296e <sys_yield+0x4>
+  802975:	49 bb d2 86 00 00 00 	movabs $0x86d2,%r11
+  80297c:	00 00 00 
+  80297f:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802982:	48 83 ec 08          	sub    $0x8,%rsp
+  802986:	6a 00                	push   $0x0
+  802988:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80298e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802994:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802999:	ba 00 00 00 00       	mov    $0x0,%edx
+  80299e:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a3:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8029a8:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  8029af:	ff ff ff 
+  8029b2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029b6:	ff d0                	call   *%rax
+  8029b8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029bc:	90                   	nop
+  8029bd:	c9                   	leave
+  8029be:	c3                   	ret
+
+00000000008029bf <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8029bf:	55                   	push   %rbp
+  8029c0:	48 89 e5             	mov    %rsp,%rbp
+  8029c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8029c7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029c7 <sys_page_alloc+0x8>
+  8029ce:	49 bb 79 86 00 00 00 	movabs $0x8679,%r11
+  8029d5:	00 00 00 
+  8029d8:	4c 01 d8             	add    %r11,%rax
+  8029db:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8029de:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8029e2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8029e5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8029e8:	48 63 f2             	movslq %edx,%rsi
+  8029eb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8029ef:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8029f2:	48 63 d2             	movslq %edx,%rdx
+  8029f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8029f9:	6a 00                	push   $0x0
+  8029fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a01:	49 89 f0             	mov    %rsi,%r8
+  802a04:	be 01 00 00 00       	mov    $0x1,%esi
+  802a09:	bf 04 00 00 00       	mov    $0x4,%edi
+  802a0e:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802a15:	ff ff ff 
+  802a18:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a1c:	ff d0                	call   *%rax
+  802a1e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a22:	c9                   	leave
+  802a23:	c3                   	ret
+
+0000000000802a24 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802a24:	55                   	push   %rbp
+  802a25:	48 89 e5             	mov    %rsp,%rbp
+  802a28:	48 83 ec 20          	sub    $0x20,%rsp
+  802a2c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a2c <sys_page_map+0x8>
+  802a33:	49 bb 14 86 00 00 00 	movabs $0x8614,%r11
+  802a3a:	00 00 00 
+  802a3d:	4c 01 d8             	add    %r11,%rax
+  802a40:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802a43:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a47:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802a4a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802a4e:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802a52:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802a55:	48 63 f2             	movslq %edx,%rsi
+  802a58:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802a5c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802a5f:	48 63 fa             	movslq %edx,%rdi
+  802a62:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a66:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802a69:	48 63 d2             	movslq %edx,%rdx
+  802a6c:	48 83 ec 08          	sub    $0x8,%rsp
+  802a70:	56                   	push   %rsi
+  802a71:	4d 89 c1             	mov    %r8,%r9
+  802a74:	49 89 f8             	mov    %rdi,%r8
+  802a77:	be 01 00 00 00       	mov    $0x1,%esi
+  802a7c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802a81:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802a88:	ff ff ff 
+  802a8b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a8f:	ff d0                	call   *%rax
+  802a91:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a95:	c9                   	leave
+  802a96:	c3                   	ret
+
+0000000000802a97 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802a97:	55                   	push   %rbp
+  802a98:	48 89 e5             	mov    %rsp,%rbp
+  802a9b:	48 83 ec 10          	sub    $0x10,%rsp
+  802a9f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a9f <sys_page_unmap+0x8>
+  802aa6:	49 bb a1 85 00 00 00 	movabs $0x85a1,%r11
+  802aad:	00 00 00 
+  802ab0:	4c 01 d8             	add    %r11,%rax
+  802ab3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802ab6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802aba:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802abe:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802ac1:	48 63 d2             	movslq %edx,%rdx
+  802ac4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ac8:	6a 00                	push   $0x0
+  802aca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ad0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ad6:	be 01 00 00 00       	mov    $0x1,%esi
+  802adb:	bf 06 00 00 00       	mov    $0x6,%edi
+  802ae0:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802ae7:	ff ff ff 
+  802aea:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802aee:	ff d0                	call   *%rax
+  802af0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802af4:	c9                   	leave
+  802af5:	c3                   	ret
+
+0000000000802af6 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802af6:	55                   	push   %rbp
+  802af7:	48 89 e5             	mov    %rsp,%rbp
+  802afa:	48 83 ec 10          	sub    $0x10,%rsp
+  802afe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802afe <sys_env_set_status+0x8>
+  802b05:	49 bb 42 85 00 00 00 	movabs $0x8542,%r11
+  802b0c:	00 00 00 
+  802b0f:	4c 01 d8             	add    %r11,%rax
+  802b12:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b15:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802b18:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802b1b:	48 63 ca             	movslq %edx,%rcx
+  802b1e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802b21:	48 63 d2             	movslq %edx,%rdx
+  802b24:	48 83 ec 08          	sub    $0x8,%rsp
+  802b28:	6a 00                	push   $0x0
+  802b2a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b30:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b36:	be 01 00 00 00       	mov    $0x1,%esi
+  802b3b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802b40:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802b47:	ff ff ff 
+  802b4a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b4e:	ff d0                	call   *%rax
+  802b50:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b54:	c9                   	leave
+  802b55:	c3                   	ret
+
+0000000000802b56 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802b56:	55                   	push   %rbp
+  802b57:	48 89 e5             	mov    %rsp,%rbp
+  802b5a:	48 83 ec 10          	sub    $0x10,%rsp
+  802b5e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b5e <sys_env_set_trapframe+0x8>
+  802b65:	49 bb e2 84 00 00 00 	movabs $0x84e2,%r11
+  802b6c:	00 00 00 
+  802b6f:	4c 01 d8             	add    %r11,%rax
+  802b72:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b75:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802b79:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802b7d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802b80:	48 63 d2             	movslq %edx,%rdx
+  802b83:	48 83 ec 08          	sub    $0x8,%rsp
+  802b87:	6a 00                	push   $0x0
+  802b89:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b8f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b95:	be 01 00 00 00       	mov    $0x1,%esi
+  802b9a:	bf 09 00 00 00       	mov    $0x9,%edi
+  802b9f:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802ba6:	ff ff ff 
+  802ba9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802bad:	ff d0                	call   *%rax
+  802baf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bb3:	c9                   	leave
+  802bb4:	c3                   	ret
+
+0000000000802bb5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802bb5:	55                   	push   %rbp
+  802bb6:	48 89 e5             	mov    %rsp,%rbp
+  802bb9:	48 83 ec 10          	sub    $0x10,%rsp
+  802bbd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802bbd <sys_env_set_pgfault_upcall+0x8>
+  802bc4:	49 bb 83 84 00 00 00 	movabs $0x8483,%r11
+  802bcb:	00 00 00 
+  802bce:	4c 01 d8             	add    %r11,%rax
+  802bd1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802bd4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802bd8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802bdc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802bdf:	48 63 d2             	movslq %edx,%rdx
+  802be2:	48 83 ec 08          	sub    $0x8,%rsp
+  802be6:	6a 00                	push   $0x0
+  802be8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802bf4:	be 01 00 00 00       	mov    $0x1,%esi
+  802bf9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802bfe:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802c05:	ff ff ff 
+  802c08:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c0c:	ff d0                	call   *%rax
+  802c0e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c12:	c9                   	leave
+  802c13:	c3                   	ret
+
+0000000000802c14 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802c14:	55                   	push   %rbp
+  802c15:	48 89 e5             	mov    %rsp,%rbp
+  802c18:	48 83 ec 20          	sub    $0x20,%rsp
+  802c1c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c1c <sys_ipc_try_send+0x8>
+  802c23:	49 bb 24 84 00 00 00 	movabs $0x8424,%r11
+  802c2a:	00 00 00 
+  802c2d:	4c 01 d8             	add    %r11,%rax
+  802c30:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802c33:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802c37:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802c3b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802c3e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802c41:	48 63 fa             	movslq %edx,%rdi
+  802c44:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802c48:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802c4b:	48 63 d2             	movslq %edx,%rdx
+  802c4e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802c52:	48 83 ec 08          	sub    $0x8,%rsp
+  802c56:	6a 00                	push   $0x0
+  802c58:	49 89 f9             	mov    %rdi,%r9
+  802c5b:	49 89 f0             	mov    %rsi,%r8
+  802c5e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c63:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802c68:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802c6f:	ff ff ff 
+  802c72:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c76:	ff d0                	call   *%rax
+  802c78:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c7c:	c9                   	leave
+  802c7d:	c3                   	ret
+
+0000000000802c7e <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802c7e:	55                   	push   %rbp
+  802c7f:	48 89 e5             	mov    %rsp,%rbp
+  802c82:	48 83 ec 20          	sub    $0x20,%rsp
+  802c86:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c86 <sys_ipc_send+0x8>
+  802c8d:	49 bb ba 83 00 00 00 	movabs $0x83ba,%r11
+  802c94:	00 00 00 
+  802c97:	4c 01 d8             	add    %r11,%rax
+  802c9a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802c9d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802ca1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802ca5:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802ca8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802cab:	48 63 fa             	movslq %edx,%rdi
+  802cae:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802cb2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802cb5:	48 63 d2             	movslq %edx,%rdx
+  802cb8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802cbc:	48 83 ec 08          	sub    $0x8,%rsp
+  802cc0:	6a 00                	push   $0x0
+  802cc2:	49 89 f9             	mov    %rdi,%r9
+  802cc5:	49 89 f0             	mov    %rsi,%r8
+  802cc8:	be 00 00 00 00       	mov    $0x0,%esi
+  802ccd:	bf 17 00 00 00       	mov    $0x17,%edi
+  802cd2:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802cd9:	ff ff ff 
+  802cdc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802ce0:	ff d0                	call   *%rax
+  802ce2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ce6:	c9                   	leave
+  802ce7:	c3                   	ret
+
+0000000000802ce8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802ce8:	55                   	push   %rbp
+  802ce9:	48 89 e5             	mov    %rsp,%rbp
+  802cec:	48 83 ec 10          	sub    $0x10,%rsp
+  802cf0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802cf0 <sys_ipc_recv+0x8>
+  802cf7:	49 bb 50 83 00 00 00 	movabs $0x8350,%r11
+  802cfe:	00 00 00 
+  802d01:	4c 01 d8             	add    %r11,%rax
+  802d04:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802d08:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d0c:	6a 00                	push   $0x0
+  802d0e:	6a 00                	push   $0x0
+  802d10:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d21:	be 01 00 00 00       	mov    $0x1,%esi
+  802d26:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802d2b:	49 ba 18 76 ff ff ff 	movabs $0xffffffffffff7618,%r10
+  802d32:	ff ff ff 
+  802d35:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802d39:	ff d0                	call   *%rax
+  802d3b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d3f:	c9                   	leave
+  802d40:	c3                   	ret
+
+0000000000802d41 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802d41:	55                   	push   %rbp
+  802d42:	48 89 e5             	mov    %rsp,%rbp
+  802d45:	48 83 ec 30          	sub    $0x30,%rsp
+  802d49:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d49 <sys_ipc_call+0x8>
+  802d50:	49 bb f7 82 00 00 00 	movabs $0x82f7,%r11
+  802d57:	00 00 00 
+  802d5a:	4c 01 d8             	add    %r11,%rax
+  802d5d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802d60:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d64:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802d68:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802d6b:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802d6f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802d73:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802d77:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802d7a:	4c 63 c2             	movslq %edx,%r8
+  802d7d:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802d81:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802d84:	48 63 d2             	movslq %edx,%rdx
+  802d87:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802d8b:	ff 75 d8             	push   -0x28(%rbp)
+  802d8e:	56                   	push   %rsi
+  802d8f:	4d 89 c1             	mov    %r8,%r9
+  802d92:	49 89 f8             	mov    %rdi,%r8
+  802d95:	be 00 00 00 00       	mov    $0x0,%esi
+  802d9a:	bf 18 00 00 00       	mov    $0x18,%edi
+  802d9f:	49 ba 18 76 ff ff ff 	movabs $0xffffffffffff7618,%r10
+  802da6:	ff ff ff 
+  802da9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802dad:	ff d0                	call   *%rax
+  802daf:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802db3:	c9                   	leave
+  802db4:	c3                   	ret
+
+0000000000802db5 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802db5:	55                   	push   %rbp
+  802db6:	48 89 e5             	mov    %rsp,%rbp
+  802db9:	48 83 ec 30          	sub    $0x30,%rsp
+  802dbd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802dbd <sys_ipc_reply_recv+0x8>
+  802dc4:	49 bb 83 82 00 00 00 	movabs $0x8283,%r11
+  802dcb:	00 00 00 
+  802dce:	4c 01 d8             	add    %r11,%rax
+  802dd1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802dd4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802dd8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802ddc:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802ddf:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802de3:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802de7:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802deb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802dee:	4c 63 c2             	movslq %edx,%r8
+  802df1:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802df5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802df8:	48 63 d2             	movslq %edx,%rdx
+  802dfb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802dff:	ff 75 d8             	push   -0x28(%rbp)
+  802e02:	56                   	push   %rsi
+  802e03:	4d 89 c1             	mov    %r8,%r9
+  802e06:	49 89 f8             	mov    %rdi,%r8
+  802e09:	be 00 00 00 00       	mov    $0x0,%esi
+  802e0e:	bf 19 00 00 00       	mov    $0x19,%edi
+  802e13:	49 ba 18 76 ff ff ff 	movabs $0xffffffffffff7618,%r10
+  802e1a:	ff ff ff 
+  802e1d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802e21:	ff d0                	call   *%rax
+  802e23:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802e27:	c9                   	leave
+  802e28:	c3                   	ret
+
+0000000000802e29 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802e29:	55                   	push   %rbp
+  802e2a:	48 89 e5             	mov    %rsp,%rbp
+  802e2d:	48 83 ec 10          	sub    $0x10,%rsp
+  802e31:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e31 <sys_env_set_priority+0x8>
+  802e38:	49 bb 0f 82 00 00 00 	movabs $0x820f,%r11
+  802e3f:	00 00 00 
+  802e42:	4c 01 d8             	add    %r11,%rax
+  802e45:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802e48:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802e4b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802e4e:	48 63 ca             	movslq %edx,%rcx
+  802e51:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802e54:	48 63 d2             	movslq %edx,%rdx
+  802e57:	48 83 ec 08          	sub    $0x8,%rsp
+  802e5b:	6a 00                	push   $0x0
+  802e5d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e69:	be 01 00 00 00       	mov    $0x1,%esi
+  802e6e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802e73:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802e7a:	ff ff ff 
+  802e7d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802e81:	ff d0                	call   *%rax
+  802e83:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e87:	c9                   	leave
+  802e88:	c3                   	ret
+
+0000000000802e89 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802e89:	55                   	push   %rbp
+  802e8a:	48 89 e5             	mov    %rsp,%rbp
+  802e8d:	48 83 ec 10          	sub    $0x10,%rsp
+  802e91:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e91 <sys_env_set_affinity+0x8>
+  802e98:	49 bb af 81 00 00 00 	movabs $0x81af,%r11
+  802e9f:	00 00 00 
+  802ea2:	4c 01 d8             	add    %r11,%rax
+  802ea5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802ea8:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802eab:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802eae:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802eb1:	48 63 d2             	movslq %edx,%rdx
+  802eb4:	48 83 ec 08          	sub    $0x8,%rsp
+  802eb8:	6a 00                	push   $0x0
+  802eba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ec0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ec6:	be 01 00 00 00       	mov    $0x1,%esi
+  802ecb:	bf 10 00 00 00       	mov    $0x10,%edi
+  802ed0:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802ed7:	ff ff ff 
+  802eda:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802ede:	ff d0                	call   *%rax
+  802ee0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ee4:	c9                   	leave
+  802ee5:	c3                   	ret
+
+0000000000802ee6 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802ee6:	55                   	push   %rbp
+  802ee7:	48 89 e5             	mov    %rsp,%rbp
+  802eea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802eea <sys_time_msec+0x4>
+  802ef1:	49 bb 56 81 00 00 00 	movabs $0x8156,%r11
+  802ef8:	00 00 00 
+  802efb:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802efe:	48 83 ec 08          	sub    $0x8,%rsp
+  802f02:	6a 00                	push   $0x0
+  802f04:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f0a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f15:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f1a:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1f:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802f24:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802f2b:	ff ff ff 
+  802f2e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802f32:	ff d0                	call   *%rax
+  802f34:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f38:	c9                   	leave
+  802f39:	c3                   	ret
+
+0000000000802f3a <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802f3a:	55                   	push   %rbp
+  802f3b:	48 89 e5             	mov    %rsp,%rbp
+  802f3e:	48 83 ec 10          	sub    $0x10,%rsp
+  802f42:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f42 <sys_sleep_usec+0x8>
+  802f49:	49 bb fe 80 00 00 00 	movabs $0x80fe,%r11
+  802f50:	00 00 00 
+  802f53:	4c 01 d8             	add    %r11,%rax
+  802f56:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802f5a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f5e:	48 83 ec 08          	sub    $0x8,%rsp
+  802f62:	6a 00                	push   $0x0
+  802f64:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f6a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f75:	be 00 00 00 00       	mov    $0x0,%esi
+  802f7a:	bf 11 00 00 00       	mov    $0x11,%edi
+  802f7f:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802f86:	ff ff ff 
+  802f89:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802f8d:	ff d0                	call   *%rax
+  802f8f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f93:	c9                   	leave
+  802f94:	c3                   	ret
+
+0000000000802f95 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802f95:	55                   	push   %rbp
+  802f96:	48 89 e5             	mov    %rsp,%rbp
+  802f99:	48 83 ec 10          	sub    $0x10,%rsp
+  802f9d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f9d <sys_page_alloc_huge+0x8>
+  802fa4:	49 bb a3 80 00 00 00 	movabs $0x80a3,%r11
+  802fab:	00 00 00 
+  802fae:	4c 01 d8             	add    %r11,%rax
+  802fb1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802fb4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802fb8:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802fbb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802fbe:	48 63 f2             	movslq %edx,%rsi
+  802fc1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802fc5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802fc8:	48 63 d2             	movslq %edx,%rdx
+  802fcb:	48 83 ec 08          	sub    $0x8,%rsp
+  802fcf:	6a 00                	push   $0x0
+  802fd1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802fd7:	49 89 f0             	mov    %rsi,%r8
+  802fda:	be 01 00 00 00       	mov    $0x1,%esi
+  802fdf:	bf 12 00 00 00       	mov    $0x12,%edi
+  802fe4:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  802feb:	ff ff ff 
+  802fee:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802ff2:	ff d0                	call   *%rax
+  802ff4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ff8:	c9                   	leave
+  802ff9:	c3                   	ret
+
+0000000000802ffa <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802ffa:	55                   	push   %rbp
+  802ffb:	48 89 e5             	mov    %rsp,%rbp
+  802ffe:	48 83 ec 10          	sub    $0x10,%rsp
+  803002:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803002 <sys_page_map_batch+0x8>
+  803009:	49 bb 3e 80 00 00 00 	movabs $0x803e,%r11
+  803010:	00 00 00 
+  803013:	4c 01 d8             	add    %r11,%rax
+  803016:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80301a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80301e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803022:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803026:	48 83 ec 08          	sub    $0x8,%rsp
+  80302a:	6a 00                	push   $0x0
+  80302c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803032:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803038:	be 01 00 00 00       	mov    $0x1,%esi
+  80303d:	bf 13 00 00 00       	mov    $0x13,%edi
+  803042:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  803049:	ff ff ff 
+  80304c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803050:	ff d0                	call   *%rax
+  803052:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803056:	c9                   	leave
+  803057:	c3                   	ret
+
+0000000000803058 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  803058:	55                   	push   %rbp
+  803059:	48 89 e5             	mov    %rsp,%rbp
+  80305c:	48 83 ec 10          	sub    $0x10,%rsp
+  803060:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803060 <sys_page_alloc_batch+0x8>
+  803067:	49 bb e0 7f 00 00 00 	movabs $0x7fe0,%r11
+  80306e:	00 00 00 
+  803071:	4c 01 d8             	add    %r11,%rax
+  803074:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803078:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80307c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803080:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803084:	48 83 ec 08          	sub    $0x8,%rsp
+  803088:	6a 00                	push   $0x0
+  80308a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803090:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803096:	be 01 00 00 00       	mov    $0x1,%esi
+  80309b:	bf 14 00 00 00       	mov    $0x14,%edi
+  8030a0:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  8030a7:	ff ff ff 
+  8030aa:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8030ae:	ff d0                	call   *%rax
+  8030b0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8030b4:	c9                   	leave
+  8030b5:	c3                   	ret
+
+00000000008030b6 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8030b6:	55                   	push   %rbp
+  8030b7:	48 89 e5             	mov    %rsp,%rbp
+  8030ba:	48 83 ec 10          	sub    $0x10,%rsp
+  8030be:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8030be <sys_page_unmap_batch+0x8>
+  8030c5:	49 bb 82 7f 00 00 00 	movabs $0x7f82,%r11
+  8030cc:	00 00 00 
+  8030cf:	4c 01 d8             	add    %r11,%rax
+  8030d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8030d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8030da:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8030de:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8030e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8030e6:	6a 00                	push   $0x0
+  8030e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8030ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030f4:	be 01 00 00 00       	mov    $0x1,%esi
+  8030f9:	bf 15 00 00 00       	mov    $0x15,%edi
+  8030fe:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  803105:	ff ff ff 
+  803108:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80310c:	ff d0                	call   *%rax
+  80310e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803112:	c9                   	leave
+  803113:	c3                   	ret
+
+0000000000803114 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  803114:	55                   	push   %rbp
+  803115:	48 89 e5             	mov    %rsp,%rbp
+  803118:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803118 <sys_fork+0x4>
+  80311f:	49 bb 28 7f 00 00 00 	movabs $0x7f28,%r11
+  803126:	00 00 00 
+  803129:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80312c:	48 83 ec 08          	sub    $0x8,%rsp
+  803130:	6a 00                	push   $0x0
+  803132:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803138:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80313e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803143:	ba 00 00 00 00       	mov    $0x0,%edx
+  803148:	be 00 00 00 00       	mov    $0x0,%esi
+  80314d:	bf 16 00 00 00       	mov    $0x16,%edi
+  803152:	49 ba 5e 75 ff ff ff 	movabs $0xffffffffffff755e,%r10
+  803159:	ff ff ff 
+  80315c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803160:	ff d0                	call   *%rax
+  803162:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803166:	c9                   	leave
+  803167:	c3                   	ret
+
+0000000000803168 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803168:	55                   	push   %rbp
+  803169:	48 89 e5             	mov    %rsp,%rbp
+  80316c:	41 57                	push   %r15
+  80316e:	53                   	push   %rbx
+  80316f:	48 83 ec 40          	sub    $0x40,%rsp
+  803173:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803173 <pgfault+0xb>
+  80317a:	49 bb cd 7e 00 00 00 	movabs $0x7ecd,%r11
+  803181:	00 00 00 
+  803184:	4c 01 db             	add    %r11,%rbx
+  803187:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  80318b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80318f:	48 8b 00             	mov    (%rax),%rax
+  803192:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  803196:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80319a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80319e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  8031a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031a5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8031a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031ad:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8031b3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  8031b7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8031ba:	83 e0 02             	and    $0x2,%eax
+  8031bd:	85 c0                	test   %eax,%eax
+  8031bf:	0f 84 91 03 00 00    	je     803556 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  8031c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031c9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8031cd:	48 89 c2             	mov    %rax,%rdx
+  8031d0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8031d7:	ff ff ff 
+  8031da:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031de:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031e2:	83 e0 01             	and    $0x1,%eax
+  8031e5:	48 85 c0             	test   %rax,%rax
+  8031e8:	0f 84 a7 01 00 00    	je     803395 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  8031ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031f2:	48 c1 e8 15          	shr    $0x15,%rax
+  8031f6:	48 89 c2             	mov    %rax,%rdx
+  8031f9:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803200:	ff ff ff 
+  803203:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803207:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80320b:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  803210:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  803216:	0f 85 79 01 00 00    	jne    803395 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  80321c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803220:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  803224:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803228:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  80322e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  803232:	ba 07 00 00 00       	mov    $0x7,%edx
+  803237:	be 00 00 60 00       	mov    $0x600000,%esi
+  80323c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803241:	49 89 df             	mov    %rbx,%r15
+  803244:	48 b8 55 7f ff ff ff 	movabs $0xffffffffffff7f55,%rax
+  80324b:	ff ff ff 
+  80324e:	48 01 d8             	add    %rbx,%rax
+  803251:	ff d0                	call   *%rax
+  803253:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  803256:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80325a:	79 44                	jns    8032a0 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  80325c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80325f:	89 c1                	mov    %eax,%ecx
+  803261:	48 b8 c0 da ff ff ff 	movabs $0xffffffffffffdac0,%rax
+  803268:	ff ff ff 
+  80326b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80326f:	48 89 c2             	mov    %rax,%rdx
+  803272:	be 20 00 00 00       	mov    $0x20,%esi
+  803277:	48 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%rax
+  80327e:	ff ff ff 
+  803281:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803285:	48 89 c7             	mov    %rax,%rdi
+  803288:	49 89 df             	mov    %rbx,%r15
+  80328b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803290:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  803297:	ff ff ff 
+  80329a:	49 01 d8             	add    %rbx,%r8
+  80329d:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  8032a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032a4:	ba 00 00 20 00       	mov    $0x200000,%edx
+  8032a9:	48 89 c6             	mov    %rax,%rsi
+  8032ac:	bf 00 00 60 00       	mov    $0x600000,%edi
+  8032b1:	49 89 df             	mov    %rbx,%r15
+  8032b4:	48 b8 ce 71 ff ff ff 	movabs $0xffffffffffff71ce,%rax
+  8032bb:	ff ff ff 
+  8032be:	48 01 d8             	add    %rbx,%rax
+  8032c1:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  8032c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032c7:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8032cd:	48 89 c1             	mov    %rax,%rcx
+  8032d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d5:	be 00 00 60 00       	mov    $0x600000,%esi
+  8032da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032df:	49 89 df             	mov    %rbx,%r15
+  8032e2:	48 b8 e4 79 ff ff ff 	movabs $0xffffffffffff79e4,%rax
+  8032e9:	ff ff ff 
+  8032ec:	48 01 d8             	add    %rbx,%rax
+  8032ef:	ff d0                	call   *%rax
+  8032f1:	85 c0                	test   %eax,%eax
+  8032f3:	74 3e                	je     803333 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  8032f5:	48 b8 eb da ff ff ff 	movabs $0xffffffffffffdaeb,%rax
+  8032fc:	ff ff ff 
+  8032ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803303:	48 89 c2             	mov    %rax,%rdx
+  803306:	be 23 00 00 00       	mov    $0x23,%esi
+  80330b:	48 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%rax
+  803312:	ff ff ff 
+  803315:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803319:	48 89 c7             	mov    %rax,%rdi
+  80331c:	49 89 df             	mov    %rbx,%r15
+  80331f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803324:	48 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%rcx
+  80332b:	ff ff ff 
+  80332e:	48 01 d9             	add    %rbx,%rcx
+  803331:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  803333:	be 00 00 60 00       	mov    $0x600000,%esi
+  803338:	bf 00 00 00 00       	mov    $0x0,%edi
+  80333d:	49 89 df             	mov    %rbx,%r15
+  803340:	48 b8 57 7a ff ff ff 	movabs $0xffffffffffff7a57,%rax
+  803347:	ff ff ff 
+  80334a:	48 01 d8             	add    %rbx,%rax
+  80334d:	ff d0                	call   *%rax
+  80334f:	85 c0                	test   %eax,%eax
+  803351:	0f 84 3d 02 00 00    	je     803594 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  803357:	48 b8 00 db ff ff ff 	movabs $0xffffffffffffdb00,%rax
+  80335e:	ff ff ff 
+  803361:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803365:	48 89 c2             	mov    %rax,%rdx
+  803368:	be 25 00 00 00       	mov    $0x25,%esi
+  80336d:	48 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%rax
+  803374:	ff ff ff 
+  803377:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80337b:	48 89 c7             	mov    %rax,%rdi
+  80337e:	49 89 df             	mov    %rbx,%r15
+  803381:	b8 00 00 00 00       	mov    $0x0,%eax
+  803386:	48 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%rcx
+  80338d:	ff ff ff 
+  803390:	48 01 d9             	add    %rbx,%rcx
+  803393:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  803395:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803399:	48 c1 e8 0c          	shr    $0xc,%rax
+  80339d:	48 89 c2             	mov    %rax,%rdx
+  8033a0:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8033a7:	ff ff ff 
+  8033aa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033ae:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033b2:	25 00 08 00 00       	and    $0x800,%eax
+  8033b7:	48 85 c0             	test   %rax,%rax
+  8033ba:	0f 84 58 01 00 00    	je     803518 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  8033c0:	ba 07 00 00 00       	mov    $0x7,%edx
+  8033c5:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8033ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033cf:	49 89 df             	mov    %rbx,%r15
+  8033d2:	48 b8 7f 79 ff ff ff 	movabs $0xffffffffffff797f,%rax
+  8033d9:	ff ff ff 
+  8033dc:	48 01 d8             	add    %rbx,%rax
+  8033df:	ff d0                	call   *%rax
+  8033e1:	85 c0                	test   %eax,%eax
+  8033e3:	74 3e                	je     803423 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  8033e5:	48 b8 17 db ff ff ff 	movabs $0xffffffffffffdb17,%rax
+  8033ec:	ff ff ff 
+  8033ef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033f3:	48 89 c2             	mov    %rax,%rdx
+  8033f6:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8033fb:	48 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%rax
+  803402:	ff ff ff 
+  803405:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803409:	48 89 c7             	mov    %rax,%rdi
+  80340c:	49 89 df             	mov    %rbx,%r15
+  80340f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803414:	48 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%rcx
+  80341b:	ff ff ff 
+  80341e:	48 01 d9             	add    %rbx,%rcx
+  803421:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  803423:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803427:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80342c:	48 89 c6             	mov    %rax,%rsi
+  80342f:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  803434:	49 89 df             	mov    %rbx,%r15
+  803437:	48 b8 ce 71 ff ff ff 	movabs $0xffffffffffff71ce,%rax
+  80343e:	ff ff ff 
+  803441:	48 01 d8             	add    %rbx,%rax
+  803444:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  803446:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80344a:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  803450:	48 89 c1             	mov    %rax,%rcx
+  803453:	ba 00 00 00 00       	mov    $0x0,%edx
+  803458:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80345d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803462:	49 89 df             	mov    %rbx,%r15
+  803465:	48 b8 e4 79 ff ff ff 	movabs $0xffffffffffff79e4,%rax
+  80346c:	ff ff ff 
+  80346f:	48 01 d8             	add    %rbx,%rax
+  803472:	ff d0                	call   *%rax
+  803474:	85 c0                	test   %eax,%eax
+  803476:	74 3e                	je     8034b6 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  803478:	48 b8 eb da ff ff ff 	movabs $0xffffffffffffdaeb,%rax
+  80347f:	ff ff ff 
+  803482:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803486:	48 89 c2             	mov    %rax,%rdx
+  803489:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80348e:	48 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%rax
+  803495:	ff ff ff 
+  803498:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80349c:	48 89 c7             	mov    %rax,%rdi
+  80349f:	49 89 df             	mov    %rbx,%r15
+  8034a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a7:	48 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%rcx
+  8034ae:	ff ff ff 
+  8034b1:	48 01 d9             	add    %rbx,%rcx
+  8034b4:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  8034b6:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8034bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c0:	49 89 df             	mov    %rbx,%r15
+  8034c3:	48 b8 57 7a ff ff ff 	movabs $0xffffffffffff7a57,%rax
+  8034ca:	ff ff ff 
+  8034cd:	48 01 d8             	add    %rbx,%rax
+  8034d0:	ff d0                	call   *%rax
+  8034d2:	85 c0                	test   %eax,%eax
+  8034d4:	0f 84 bb 00 00 00    	je     803595 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  8034da:	48 b8 00 db ff ff ff 	movabs $0xffffffffffffdb00,%rax
+  8034e1:	ff ff ff 
+  8034e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034e8:	48 89 c2             	mov    %rax,%rdx
+  8034eb:	be 32 00 00 00       	mov    $0x32,%esi
+  8034f0:	48 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%rax
+  8034f7:	ff ff ff 
+  8034fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034fe:	48 89 c7             	mov    %rax,%rdi
+  803501:	49 89 df             	mov    %rbx,%r15
+  803504:	b8 00 00 00 00       	mov    $0x0,%eax
+  803509:	48 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%rcx
+  803510:	ff ff ff 
+  803513:	48 01 d9             	add    %rbx,%rcx
+  803516:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  803518:	48 b8 30 db ff ff ff 	movabs $0xffffffffffffdb30,%rax
+  80351f:	ff ff ff 
+  803522:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803526:	48 89 c2             	mov    %rax,%rdx
+  803529:	be 36 00 00 00       	mov    $0x36,%esi
+  80352e:	48 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%rax
+  803535:	ff ff ff 
+  803538:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80353c:	48 89 c7             	mov    %rax,%rdi
+  80353f:	49 89 df             	mov    %rbx,%r15
+  803542:	b8 00 00 00 00       	mov    $0x0,%eax
+  803547:	48 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%rcx
+  80354e:	ff ff ff 
+  803551:	48 01 d9             	add    %rbx,%rcx
+  803554:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  803556:	48 b8 4f db ff ff ff 	movabs $0xffffffffffffdb4f,%rax
+  80355d:	ff ff ff 
+  803560:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803564:	48 89 c2             	mov    %rax,%rdx
+  803567:	be 3a 00 00 00       	mov    $0x3a,%esi
+  80356c:	48 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%rax
+  803573:	ff ff ff 
+  803576:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80357a:	48 89 c7             	mov    %rax,%rdi
+  80357d:	49 89 df             	mov    %rbx,%r15
+  803580:	b8 00 00 00 00       	mov    $0x0,%eax
+  803585:	48 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%rcx
+  80358c:	ff ff ff 
+  80358f:	48 01 d9             	add    %rbx,%rcx
+  803592:	ff d1                	call   *%rcx
+			return;
+  803594:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  803595:	48 83 c4 40          	add    $0x40,%rsp
+  803599:	5b                   	pop    %rbx
+  80359a:	41 5f                	pop    %r15
+  80359c:	5d                   	pop    %rbp
+  80359d:	c3                   	ret
+
+000000000080359e <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  80359e:	55                   	push   %rbp
+  80359f:	48 89 e5             	mov    %rsp,%rbp
+  8035a2:	41 57                	push   %r15
+  8035a4:	53                   	push   %rbx
+  8035a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8035a9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035a9 <fork_flush+0xb>
+  8035b0:	49 bb 97 7a 00 00 00 	movabs $0x7a97,%r11
+  8035b7:	00 00 00 
+  8035ba:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  8035bd:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  8035c4:	00 00 00 
+  8035c7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035cb:	48 85 c0             	test   %rax,%rax
+  8035ce:	0f 84 81 00 00 00    	je     803655 <fork_flush+0xb7>
+  8035d4:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  8035db:	00 00 00 
+  8035de:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035e2:	48 89 c6             	mov    %rax,%rsi
+  8035e5:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  8035ec:	00 00 00 
+  8035ef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035f3:	48 89 c7             	mov    %rax,%rdi
+  8035f6:	49 89 df             	mov    %rbx,%r15
+  8035f9:	48 b8 ba 7f ff ff ff 	movabs $0xffffffffffff7fba,%rax
+  803600:	ff ff ff 
+  803603:	48 01 d8             	add    %rbx,%rax
+  803606:	ff d0                	call   *%rax
+  803608:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80360b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80360f:	79 44                	jns    803655 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  803611:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803614:	89 c1                	mov    %eax,%ecx
+  803616:	48 b8 68 db ff ff ff 	movabs $0xffffffffffffdb68,%rax
+  80361d:	ff ff ff 
+  803620:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803624:	48 89 c2             	mov    %rax,%rdx
+  803627:	be 56 00 00 00       	mov    $0x56,%esi
+  80362c:	48 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%rax
+  803633:	ff ff ff 
+  803636:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80363a:	48 89 c7             	mov    %rax,%rdi
+  80363d:	49 89 df             	mov    %rbx,%r15
+  803640:	b8 00 00 00 00       	mov    $0x0,%eax
+  803645:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  80364c:	ff ff ff 
+  80364f:	49 01 d8             	add    %rbx,%r8
+  803652:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  803655:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80365c:	00 00 00 
+  80365f:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803666:	00 
+}
+  803667:	90                   	nop
+  803668:	48 83 c4 10          	add    $0x10,%rsp
+  80366c:	5b                   	pop    %rbx
+  80366d:	41 5f                	pop    %r15
+  80366f:	5d                   	pop    %rbp
+  803670:	c3                   	ret
+
+0000000000803671 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  803671:	55                   	push   %rbp
+  803672:	48 89 e5             	mov    %rsp,%rbp
+  803675:	53                   	push   %rbx
+  803676:	48 83 ec 28          	sub    $0x28,%rsp
+  80367a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80367a <fork_map+0x9>
+  803681:	49 bb c6 79 00 00 00 	movabs $0x79c6,%r11
+  803688:	00 00 00 
+  80368b:	4c 01 db             	add    %r11,%rbx
+  80368e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803691:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803695:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  803698:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80369f:	00 00 00 
+  8036a2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8036a6:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  8036ac:	75 10                	jne    8036be <fork_map+0x4d>
+		fork_flush();
+  8036ae:	48 b8 5e 85 ff ff ff 	movabs $0xffffffffffff855e,%rax
+  8036b5:	ff ff ff 
+  8036b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036bc:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  8036be:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  8036c5:	00 00 00 
+  8036c8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8036cc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8036d0:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  8036d7:	00 00 00 
+  8036da:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  8036de:	48 c1 e0 05          	shl    $0x5,%rax
+  8036e2:	48 89 c2             	mov    %rax,%rdx
+  8036e5:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  8036ec:	00 00 00 
+  8036ef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036f3:	48 01 d0             	add    %rdx,%rax
+  8036f6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  8036fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036fe:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  803704:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803708:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80370c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  803710:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803714:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803717:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  80371a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80371e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803722:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  803726:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80372a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80372d:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  803730:	90                   	nop
+  803731:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803735:	c9                   	leave
+  803736:	c3                   	ret
+
+0000000000803737 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  803737:	55                   	push   %rbp
+  803738:	48 89 e5             	mov    %rsp,%rbp
+  80373b:	53                   	push   %rbx
+  80373c:	48 83 ec 28          	sub    $0x28,%rsp
+  803740:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803740 <duppage+0x9>
+  803747:	49 bb 00 79 00 00 00 	movabs $0x7900,%r11
+  80374e:	00 00 00 
+  803751:	4c 01 db             	add    %r11,%rbx
+  803754:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803757:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  80375a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80375d:	48 c1 e0 0c          	shl    $0xc,%rax
+  803761:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  803765:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80376c:	ff ff ff 
+  80376f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803773:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803776:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80377a:	25 00 04 00 00       	and    $0x400,%eax
+  80377f:	48 85 c0             	test   %rax,%rax
+  803782:	74 42                	je     8037c6 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  803784:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80378b:	ff ff ff 
+  80378e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803792:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803795:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803799:	25 07 0e 00 00       	and    $0xe07,%eax
+  80379e:	89 c2                	mov    %eax,%edx
+  8037a0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8037a4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037a7:	48 89 ce             	mov    %rcx,%rsi
+  8037aa:	89 c7                	mov    %eax,%edi
+  8037ac:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  8037b3:	ff ff ff 
+  8037b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037ba:	ff d0                	call   *%rax
+		return 0;
+  8037bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c1:	e9 ae 00 00 00       	jmp    803874 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  8037c6:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8037cd:	ff ff ff 
+  8037d0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037d4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8037d7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037db:	83 e0 02             	and    $0x2,%eax
+  8037de:	48 85 c0             	test   %rax,%rax
+  8037e1:	75 1f                	jne    803802 <duppage+0xcb>
+  8037e3:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8037ea:	ff ff ff 
+  8037ed:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037f1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8037f4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037f8:	25 00 08 00 00       	and    $0x800,%eax
+  8037fd:	48 85 c0             	test   %rax,%rax
+  803800:	74 4c                	je     80384e <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  803802:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  803809:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80380c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803810:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803813:	48 89 ce             	mov    %rcx,%rsi
+  803816:	89 c7                	mov    %eax,%edi
+  803818:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  80381f:	ff ff ff 
+  803822:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803826:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  803828:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80382b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80382f:	48 89 c6             	mov    %rax,%rsi
+  803832:	bf 00 00 00 00       	mov    $0x0,%edi
+  803837:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  80383e:	ff ff ff 
+  803841:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803845:	ff d0                	call   *%rax
+		return 0;
+  803847:	b8 00 00 00 00       	mov    $0x0,%eax
+  80384c:	eb 26                	jmp    803874 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  80384e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803852:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803855:	ba 05 00 00 00       	mov    $0x5,%edx
+  80385a:	48 89 ce             	mov    %rcx,%rsi
+  80385d:	89 c7                	mov    %eax,%edi
+  80385f:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  803866:	ff ff ff 
+  803869:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80386d:	ff d0                	call   *%rax
+		return 0;
+  80386f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  803874:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803878:	c9                   	leave
+  803879:	c3                   	ret
+
+000000000080387a <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  80387a:	55                   	push   %rbp
+  80387b:	48 89 e5             	mov    %rsp,%rbp
+  80387e:	53                   	push   %rbx
+  80387f:	48 83 ec 28          	sub    $0x28,%rsp
+  803883:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803883 <duphuge+0x9>
+  80388a:	49 bb bd 77 00 00 00 	movabs $0x77bd,%r11
+  803891:	00 00 00 
+  803894:	4c 01 db             	add    %r11,%rbx
+  803897:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80389a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  80389e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038a2:	48 c1 e8 15          	shr    $0x15,%rax
+  8038a6:	48 89 c2             	mov    %rax,%rdx
+  8038a9:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8038b0:	ff ff ff 
+  8038b3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8038b7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038bb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  8038bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038c3:	25 00 04 00 00       	and    $0x400,%eax
+  8038c8:	48 85 c0             	test   %rax,%rax
+  8038cb:	74 0e                	je     8038db <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  8038cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038d1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8038d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8038d9:	eb 1e                	jmp    8038f9 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  8038db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038df:	25 02 08 00 00       	and    $0x802,%eax
+  8038e4:	48 85 c0             	test   %rax,%rax
+  8038e7:	74 09                	je     8038f2 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  8038e9:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  8038f0:	eb 07                	jmp    8038f9 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  8038f2:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  8038f9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8038fc:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803900:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803903:	48 89 ce             	mov    %rcx,%rsi
+  803906:	89 c7                	mov    %eax,%edi
+  803908:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  80390f:	ff ff ff 
+  803912:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803916:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  803918:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80391b:	25 00 08 00 00       	and    $0x800,%eax
+  803920:	85 c0                	test   %eax,%eax
+  803922:	74 1f                	je     803943 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  803924:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803927:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80392b:	48 89 c6             	mov    %rax,%rsi
+  80392e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803933:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  80393a:	ff ff ff 
+  80393d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803941:	ff d0                	call   *%rax
+	return 0;
+  803943:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803948:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80394c:	c9                   	leave
+  80394d:	c3                   	ret
+
+000000000080394e <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  80394e:	55                   	push   %rbp
+  80394f:	48 89 e5             	mov    %rsp,%rbp
+  803952:	41 57                	push   %r15
+  803954:	53                   	push   %rbx
+  803955:	48 83 ec 10          	sub    $0x10,%rsp
+  803959:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803959 <fork+0xb>
+  803960:	49 bb e7 76 00 00 00 	movabs $0x76e7,%r11
+  803967:	00 00 00 
+  80396a:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  80396d:	49 89 df             	mov    %rbx,%r15
+  803970:	48 b8 d4 80 ff ff ff 	movabs $0xffffffffffff80d4,%rax
+  803977:	ff ff ff 
+  80397a:	48 01 d8             	add    %rbx,%rax
+  80397d:	ff d0                	call   *%rax
+  80397f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803982:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803986:	75 42                	jne    8039ca <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803988:	49 89 df             	mov    %rbx,%r15
+  80398b:	48 b8 d6 78 ff ff ff 	movabs $0xffffffffffff78d6,%rax
+  803992:	ff ff ff 
+  803995:	48 01 d8             	add    %rbx,%rax
+  803998:	ff d0                	call   *%rax
+  80399a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80399f:	48 98                	cltq
+  8039a1:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8039a8:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8039af:	ff ff ff 
+  8039b2:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8039b6:	48 01 c2             	add    %rax,%rdx
+  8039b9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8039c0:	ff ff ff 
+  8039c3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8039c7:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  8039ca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8039cd:	48 83 c4 10          	add    $0x10,%rsp
+  8039d1:	5b                   	pop    %rbx
+  8039d2:	41 5f                	pop    %r15
+  8039d4:	5d                   	pop    %rbp
+  8039d5:	c3                   	ret
+
+00000000008039d6 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  8039d6:	55                   	push   %rbp
+  8039d7:	48 89 e5             	mov    %rsp,%rbp
+  8039da:	41 57                	push   %r15
+  8039dc:	53                   	push   %rbx
+  8039dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8039e1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039e1 <ufork+0xb>
+  8039e8:	49 bb 5f 76 00 00 00 	movabs $0x765f,%r11
+  8039ef:	00 00 00 
+  8039f2:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  8039f5:	48 b8 28 81 ff ff ff 	movabs $0xffffffffffff8128,%rax
+  8039fc:	ff ff ff 
+  8039ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a03:	48 89 c7             	mov    %rax,%rdi
+  803a06:	49 89 df             	mov    %rbx,%r15
+  803a09:	48 b8 ed ca ff ff ff 	movabs $0xffffffffffffcaed,%rax
+  803a10:	ff ff ff 
+  803a13:	48 01 d8             	add    %rbx,%rax
+  803a16:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  803a18:	b8 07 00 00 00       	mov    $0x7,%eax
+  803a1d:	cd 30                	int    $0x30
+  803a1f:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  803a22:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  803a25:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  803a28:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803a2c:	0f 84 03 02 00 00    	je     803c35 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  803a32:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803a39:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  803a3a:	e9 28 01 00 00       	jmp    803b67 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  803a3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a43:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803a47:	48 89 c2             	mov    %rax,%rdx
+  803a4a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803a51:	ff ff ff 
+  803a54:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a58:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a5c:	83 e0 01             	and    $0x1,%eax
+  803a5f:	48 85 c0             	test   %rax,%rax
+  803a62:	0f 84 f7 00 00 00    	je     803b5f <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  803a68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a6c:	48 c1 e8 15          	shr    $0x15,%rax
+  803a70:	48 89 c2             	mov    %rax,%rdx
+  803a73:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803a7a:	ff ff ff 
+  803a7d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a81:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a85:	25 81 00 00 00       	and    $0x81,%eax
+  803a8a:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  803a90:	75 29                	jne    803abb <ufork+0xe5>
+					duphuge(child_envid, addr);
+  803a92:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803a96:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803a99:	48 89 d6             	mov    %rdx,%rsi
+  803a9c:	89 c7                	mov    %eax,%edi
+  803a9e:	48 b8 3a 88 ff ff ff 	movabs $0xffffffffffff883a,%rax
+  803aa5:	ff ff ff 
+  803aa8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803aac:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  803aae:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803ab5:	00 
+  803ab6:	e9 ac 00 00 00       	jmp    803b67 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  803abb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803abf:	48 c1 e8 15          	shr    $0x15,%rax
+  803ac3:	48 89 c2             	mov    %rax,%rdx
+  803ac6:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803acd:	ff ff ff 
+  803ad0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803ad4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803ad8:	83 e0 01             	and    $0x1,%eax
+  803adb:	48 85 c0             	test   %rax,%rax
+  803ade:	74 75                	je     803b55 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  803ae0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ae4:	48 c1 e8 0c          	shr    $0xc,%rax
+  803ae8:	48 89 c2             	mov    %rax,%rdx
+  803aeb:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803af2:	ff ff ff 
+  803af5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803af9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803afd:	83 e0 01             	and    $0x1,%eax
+  803b00:	48 85 c0             	test   %rax,%rax
+  803b03:	74 46                	je     803b4b <ufork+0x175>
+  803b05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b09:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b0d:	48 89 c2             	mov    %rax,%rdx
+  803b10:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803b17:	ff ff ff 
+  803b1a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b1e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b22:	83 e0 04             	and    $0x4,%eax
+  803b25:	48 85 c0             	test   %rax,%rax
+  803b28:	74 21                	je     803b4b <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  803b2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b2e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b32:	89 c2                	mov    %eax,%edx
+  803b34:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b37:	89 d6                	mov    %edx,%esi
+  803b39:	89 c7                	mov    %eax,%edi
+  803b3b:	48 b8 f7 86 ff ff ff 	movabs $0xffffffffffff86f7,%rax
+  803b42:	ff ff ff 
+  803b45:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b49:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  803b4b:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  803b52:	00 
+  803b53:	eb 12                	jmp    803b67 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803b55:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803b5c:	00 
+  803b5d:	eb 08                	jmp    803b67 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  803b5f:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803b66:	40 
+		for (; addr < USTACKTOP;){
+  803b67:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  803b6c:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  803b70:	0f 83 c9 fe ff ff    	jae    803a3f <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803b76:	48 b8 5e 85 ff ff ff 	movabs $0xffffffffffff855e,%rax
+  803b7d:	ff ff ff 
+  803b80:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b84:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803b86:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b89:	ba 07 00 00 00       	mov    $0x7,%edx
+  803b8e:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  803b93:	48 89 ce             	mov    %rcx,%rsi
+  803b96:	89 c7                	mov    %eax,%edi
+  803b98:	49 89 df             	mov    %rbx,%r15
+  803b9b:	48 b8 7f 79 ff ff ff 	movabs $0xffffffffffff797f,%rax
+  803ba2:	ff ff ff 
+  803ba5:	48 01 d8             	add    %rbx,%rax
+  803ba8:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  803baa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803bad:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  803bb4:	ff ff ff 
+  803bb7:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803bbb:	48 89 d6             	mov    %rdx,%rsi
+  803bbe:	89 c7                	mov    %eax,%edi
+  803bc0:	49 89 df             	mov    %rbx,%r15
+  803bc3:	48 b8 75 7b ff ff ff 	movabs $0xffffffffffff7b75,%rax
+  803bca:	ff ff ff 
+  803bcd:	48 01 d8             	add    %rbx,%rax
+  803bd0:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  803bd2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803bd5:	be 02 00 00 00       	mov    $0x2,%esi
+  803bda:	89 c7                	mov    %eax,%edi
+  803bdc:	49 89 df             	mov    %rbx,%r15
+  803bdf:	48 b8 b6 7a ff ff ff 	movabs $0xffffffffffff7ab6,%rax
+  803be6:	ff ff ff 
+  803be9:	48 01 d8             	add    %rbx,%rax
+  803bec:	ff d0                	call   *%rax
+  803bee:	85 c0                	test   %eax,%eax
+  803bf0:	74 3e                	je     803c30 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803bf2:	48 b8 8f db ff ff ff 	movabs $0xffffffffffffdb8f,%rax
+  803bf9:	ff ff ff 
+  803bfc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c00:	48 89 c2             	mov    %rax,%rdx
+  803c03:	be 07 01 00 00       	mov    $0x107,%esi
+  803c08:	48 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%rax
+  803c0f:	ff ff ff 
+  803c12:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c16:	48 89 c7             	mov    %rax,%rdi
+  803c19:	49 89 df             	mov    %rbx,%r15
+  803c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c21:	48 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%rcx
+  803c28:	ff ff ff 
+  803c2b:	48 01 d9             	add    %rbx,%rcx
+  803c2e:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  803c30:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c33:	eb 59                	jmp    803c8e <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803c35:	49 89 df             	mov    %rbx,%r15
+  803c38:	48 b8 d6 78 ff ff ff 	movabs $0xffffffffffff78d6,%rax
+  803c3f:	ff ff ff 
+  803c42:	48 01 d8             	add    %rbx,%rax
+  803c45:	ff d0                	call   *%rax
+  803c47:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803c4c:	48 98                	cltq
+  803c4e:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803c55:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803c5c:	ff ff ff 
+  803c5f:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803c63:	48 01 c2             	add    %rax,%rdx
+  803c66:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803c6d:	ff ff ff 
+  803c70:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c74:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803c77:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803c7e:	00 00 00 
+  803c81:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803c88:	00 
+		return 0;
+  803c89:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  803c8e:	48 83 c4 10          	add    $0x10,%rsp
+  803c92:	5b                   	pop    %rbx
+  803c93:	41 5f                	pop    %r15
+  803c95:	5d                   	pop    %rbp
+  803c96:	c3                   	ret
+
+0000000000803c97 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803c97:	55                   	push   %rbp
+  803c98:	48 89 e5             	mov    %rsp,%rbp
+  803c9b:	41 57                	push   %r15
+  803c9d:	48 83 ec 08          	sub    $0x8,%rsp
+  803ca1:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803ca1 <sfork+0xa>
+  803ca8:	49 bb 9f 73 00 00 00 	movabs $0x739f,%r11
+  803caf:	00 00 00 
+  803cb2:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  803cb5:	48 b8 aa db ff ff ff 	movabs $0xffffffffffffdbaa,%rax
+  803cbc:	ff ff ff 
+  803cbf:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803cc3:	48 89 c2             	mov    %rax,%rdx
+  803cc6:	be 1a 01 00 00       	mov    $0x11a,%esi
+  803ccb:	48 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%rax
+  803cd2:	ff ff ff 
+  803cd5:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803cd9:	48 89 c7             	mov    %rax,%rdi
+  803cdc:	49 89 cf             	mov    %rcx,%r15
+  803cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ce4:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  803ceb:	ff ff ff 
+  803cee:	49 01 c8             	add    %rcx,%r8
+  803cf1:	41 ff d0             	call   *%r8
+
+0000000000803cf4 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803cf4:	55                   	push   %rbp
+  803cf5:	48 89 e5             	mov    %rsp,%rbp
+  803cf8:	48 83 ec 08          	sub    $0x8,%rsp
+  803cfc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803cfc <fd2num+0x8>
+  803d03:	49 bb 44 73 00 00 00 	movabs $0x7344,%r11
+  803d0a:	00 00 00 
+  803d0d:	4c 01 d8             	add    %r11,%rax
+  803d10:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803d14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d18:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803d1f:	ff ff ff 
+  803d22:	48 01 d0             	add    %rdx,%rax
+  803d25:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803d29:	c9                   	leave
+  803d2a:	c3                   	ret
+
+0000000000803d2b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803d2b:	55                   	push   %rbp
+  803d2c:	48 89 e5             	mov    %rsp,%rbp
+  803d2f:	48 83 ec 08          	sub    $0x8,%rsp
+  803d33:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d33 <fd2data+0x8>
+  803d3a:	49 bb 0d 73 00 00 00 	movabs $0x730d,%r11
+  803d41:	00 00 00 
+  803d44:	4c 01 d8             	add    %r11,%rax
+  803d47:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803d4b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d4f:	48 89 d7             	mov    %rdx,%rdi
+  803d52:	48 ba b4 8c ff ff ff 	movabs $0xffffffffffff8cb4,%rdx
+  803d59:	ff ff ff 
+  803d5c:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803d60:	ff d0                	call   *%rax
+  803d62:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803d68:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803d6c:	c9                   	leave
+  803d6d:	c3                   	ret
+
+0000000000803d6e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803d6e:	55                   	push   %rbp
+  803d6f:	48 89 e5             	mov    %rsp,%rbp
+  803d72:	48 83 ec 18          	sub    $0x18,%rsp
+  803d76:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d76 <fd_alloc+0x8>
+  803d7d:	49 bb ca 72 00 00 00 	movabs $0x72ca,%r11
+  803d84:	00 00 00 
+  803d87:	4c 01 d8             	add    %r11,%rax
+  803d8a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803d8e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803d95:	eb 75                	jmp    803e0c <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803d97:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803d9a:	48 63 d2             	movslq %edx,%rdx
+  803d9d:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803da4:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803da8:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803dac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803db0:	48 89 d1             	mov    %rdx,%rcx
+  803db3:	48 c1 e9 15          	shr    $0x15,%rcx
+  803db7:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803dbe:	ff ff ff 
+  803dc1:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803dc5:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803dc9:	83 e2 01             	and    $0x1,%edx
+  803dcc:	48 85 d2             	test   %rdx,%rdx
+  803dcf:	74 25                	je     803df6 <fd_alloc+0x88>
+  803dd1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803dd5:	48 89 d1             	mov    %rdx,%rcx
+  803dd8:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803ddc:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803de3:	ff ff ff 
+  803de6:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803dea:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803dee:	83 e2 01             	and    $0x1,%edx
+  803df1:	48 85 d2             	test   %rdx,%rdx
+  803df4:	75 12                	jne    803e08 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803df6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803dfa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803dfe:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e06:	eb 1a                	jmp    803e22 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803e08:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803e0c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803e10:	7e 85                	jle    803d97 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803e12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e16:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803e1d:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803e22:	c9                   	leave
+  803e23:	c3                   	ret
+
+0000000000803e24 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803e24:	55                   	push   %rbp
+  803e25:	48 89 e5             	mov    %rsp,%rbp
+  803e28:	48 83 ec 20          	sub    $0x20,%rsp
+  803e2c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e2c <fd_lookup+0x8>
+  803e33:	49 bb 14 72 00 00 00 	movabs $0x7214,%r11
+  803e3a:	00 00 00 
+  803e3d:	4c 01 d8             	add    %r11,%rax
+  803e40:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e43:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803e47:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e4b:	78 06                	js     803e53 <fd_lookup+0x2f>
+  803e4d:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803e51:	7e 07                	jle    803e5a <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803e53:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e58:	eb 73                	jmp    803ecd <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803e5a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803e5d:	48 63 d2             	movslq %edx,%rdx
+  803e60:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803e67:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803e6b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803e6f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e73:	48 89 d1             	mov    %rdx,%rcx
+  803e76:	48 c1 e9 15          	shr    $0x15,%rcx
+  803e7a:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803e81:	ff ff ff 
+  803e84:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803e88:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803e8c:	83 e2 01             	and    $0x1,%edx
+  803e8f:	48 85 d2             	test   %rdx,%rdx
+  803e92:	74 22                	je     803eb6 <fd_lookup+0x92>
+  803e94:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e98:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803e9c:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  803ea3:	ff ff ff 
+  803ea6:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803eaa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803eae:	83 e0 01             	and    $0x1,%eax
+  803eb1:	48 85 c0             	test   %rax,%rax
+  803eb4:	75 07                	jne    803ebd <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803eb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ebb:	eb 10                	jmp    803ecd <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803ebd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ec1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ec5:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ecd:	c9                   	leave
+  803ece:	c3                   	ret
+
+0000000000803ecf <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803ecf:	55                   	push   %rbp
+  803ed0:	48 89 e5             	mov    %rsp,%rbp
+  803ed3:	41 57                	push   %r15
+  803ed5:	53                   	push   %rbx
+  803ed6:	48 83 ec 30          	sub    $0x30,%rsp
+  803eda:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803eda <fd_close+0xb>
+  803ee1:	49 bb 66 71 00 00 00 	movabs $0x7166,%r11
+  803ee8:	00 00 00 
+  803eeb:	4c 01 db             	add    %r11,%rbx
+  803eee:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803ef2:	89 f0                	mov    %esi,%eax
+  803ef4:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803ef7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803efb:	48 89 c7             	mov    %rax,%rdi
+  803efe:	48 b8 b4 8c ff ff ff 	movabs $0xffffffffffff8cb4,%rax
+  803f05:	ff ff ff 
+  803f08:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f0c:	ff d0                	call   *%rax
+  803f0e:	89 c2                	mov    %eax,%edx
+  803f10:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803f14:	48 89 c6             	mov    %rax,%rsi
+  803f17:	89 d7                	mov    %edx,%edi
+  803f19:	48 b8 e4 8d ff ff ff 	movabs $0xffffffffffff8de4,%rax
+  803f20:	ff ff ff 
+  803f23:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f27:	ff d0                	call   *%rax
+  803f29:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f2c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f30:	78 0a                	js     803f3c <fd_close+0x6d>
+	    || fd != fd2)
+  803f32:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f36:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803f3a:	74 12                	je     803f4e <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803f3c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803f40:	74 05                	je     803f47 <fd_close+0x78>
+  803f42:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f45:	eb 7a                	jmp    803fc1 <fd_close+0xf2>
+  803f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f4c:	eb 73                	jmp    803fc1 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803f4e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f52:	8b 00                	mov    (%rax),%eax
+  803f54:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803f58:	48 89 d6             	mov    %rdx,%rsi
+  803f5b:	89 c7                	mov    %eax,%edi
+  803f5d:	48 b8 8a 8f ff ff ff 	movabs $0xffffffffffff8f8a,%rax
+  803f64:	ff ff ff 
+  803f67:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f6b:	ff d0                	call   *%rax
+  803f6d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f70:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f74:	78 2a                	js     803fa0 <fd_close+0xd1>
+		if (dev->dev_close)
+  803f76:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f7a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803f7e:	48 85 c0             	test   %rax,%rax
+  803f81:	74 16                	je     803f99 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  803f83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f87:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803f8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f8f:	48 89 c7             	mov    %rax,%rdi
+  803f92:	ff d2                	call   *%rdx
+  803f94:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f97:	eb 07                	jmp    803fa0 <fd_close+0xd1>
+		else
+			r = 0;
+  803f99:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  803fa0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fa4:	48 89 c6             	mov    %rax,%rsi
+  803fa7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fac:	49 89 df             	mov    %rbx,%r15
+  803faf:	48 b8 57 7a ff ff ff 	movabs $0xffffffffffff7a57,%rax
+  803fb6:	ff ff ff 
+  803fb9:	48 01 d8             	add    %rbx,%rax
+  803fbc:	ff d0                	call   *%rax
+	return r;
+  803fbe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803fc1:	48 83 c4 30          	add    $0x30,%rsp
+  803fc5:	5b                   	pop    %rbx
+  803fc6:	41 5f                	pop    %r15
+  803fc8:	5d                   	pop    %rbp
+  803fc9:	c3                   	ret
+
+0000000000803fca <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  803fca:	55                   	push   %rbp
+  803fcb:	48 89 e5             	mov    %rsp,%rbp
+  803fce:	41 57                	push   %r15
+  803fd0:	48 83 ec 28          	sub    $0x28,%rsp
+  803fd4:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803fd4 <dev_lookup+0xa>
+  803fdb:	49 bb 6c 70 00 00 00 	movabs $0x706c,%r11
+  803fe2:	00 00 00 
+  803fe5:	4c 01 d9             	add    %r11,%rcx
+  803fe8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803feb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803fef:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803ff6:	eb 45                	jmp    80403d <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803ff8:	48 ba e0 01 00 00 00 	movabs $0x1e0,%rdx
+  803fff:	00 00 00 
+  804002:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804005:	48 98                	cltq
+  804007:	48 01 ca             	add    %rcx,%rdx
+  80400a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80400e:	8b 00                	mov    (%rax),%eax
+  804010:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  804013:	75 24                	jne    804039 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  804015:	48 ba e0 01 00 00 00 	movabs $0x1e0,%rdx
+  80401c:	00 00 00 
+  80401f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804022:	48 98                	cltq
+  804024:	48 01 ca             	add    %rcx,%rdx
+  804027:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80402b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80402f:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  804032:	b8 00 00 00 00       	mov    $0x0,%eax
+  804037:	eb 74                	jmp    8040ad <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  804039:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80403d:	48 ba e0 01 00 00 00 	movabs $0x1e0,%rdx
+  804044:	00 00 00 
+  804047:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80404a:	48 98                	cltq
+  80404c:	48 01 ca             	add    %rcx,%rdx
+  80404f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804053:	48 85 c0             	test   %rax,%rax
+  804056:	75 a0                	jne    803ff8 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  804058:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80405f:	ff ff ff 
+  804062:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  804066:	48 8b 00             	mov    (%rax),%rax
+  804069:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80406f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804072:	89 c6                	mov    %eax,%esi
+  804074:	48 b8 c0 db ff ff ff 	movabs $0xffffffffffffdbc0,%rax
+  80407b:	ff ff ff 
+  80407e:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  804082:	48 89 c7             	mov    %rax,%rdi
+  804085:	49 89 cf             	mov    %rcx,%r15
+  804088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80408d:	49 b8 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%r8
+  804094:	ff ff ff 
+  804097:	49 01 c8             	add    %rcx,%r8
+  80409a:	41 ff d0             	call   *%r8
+	*dev = 0;
+  80409d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040a1:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8040a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8040ad:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8040b1:	c9                   	leave
+  8040b2:	c3                   	ret
+
+00000000008040b3 <close>:
+
+int
+close(int fdnum)
+{
+  8040b3:	55                   	push   %rbp
+  8040b4:	48 89 e5             	mov    %rsp,%rbp
+  8040b7:	53                   	push   %rbx
+  8040b8:	48 83 ec 28          	sub    $0x28,%rsp
+  8040bc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8040bc <close+0x9>
+  8040c3:	49 bb 84 6f 00 00 00 	movabs $0x6f84,%r11
+  8040ca:	00 00 00 
+  8040cd:	4c 01 db             	add    %r11,%rbx
+  8040d0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8040d3:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8040d7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040da:	48 89 d6             	mov    %rdx,%rsi
+  8040dd:	89 c7                	mov    %eax,%edi
+  8040df:	48 b8 e4 8d ff ff ff 	movabs $0xffffffffffff8de4,%rax
+  8040e6:	ff ff ff 
+  8040e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040ed:	ff d0                	call   *%rax
+  8040ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040f6:	79 05                	jns    8040fd <close+0x4a>
+		return r;
+  8040f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040fb:	eb 1c                	jmp    804119 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  8040fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804101:	be 01 00 00 00       	mov    $0x1,%esi
+  804106:	48 89 c7             	mov    %rax,%rdi
+  804109:	48 b8 8f 8e ff ff ff 	movabs $0xffffffffffff8e8f,%rax
+  804110:	ff ff ff 
+  804113:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804117:	ff d0                	call   *%rax
+}
+  804119:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80411d:	c9                   	leave
+  80411e:	c3                   	ret
+
+000000000080411f <close_all>:
+
+void
+close_all(void)
+{
+  80411f:	55                   	push   %rbp
+  804120:	48 89 e5             	mov    %rsp,%rbp
+  804123:	53                   	push   %rbx
+  804124:	48 83 ec 18          	sub    $0x18,%rsp
+  804128:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804128 <close_all+0x9>
+  80412f:	49 bb 18 6f 00 00 00 	movabs $0x6f18,%r11
+  804136:	00 00 00 
+  804139:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80413c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804143:	eb 19                	jmp    80415e <close_all+0x3f>
+		close(i);
+  804145:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804148:	89 c7                	mov    %eax,%edi
+  80414a:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  804151:	ff ff ff 
+  804154:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804158:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  80415a:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80415e:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  804162:	7e e1                	jle    804145 <close_all+0x26>
+}
+  804164:	90                   	nop
+  804165:	90                   	nop
+  804166:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80416a:	c9                   	leave
+  80416b:	c3                   	ret
+
+000000000080416c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80416c:	55                   	push   %rbp
+  80416d:	48 89 e5             	mov    %rsp,%rbp
+  804170:	41 57                	push   %r15
+  804172:	53                   	push   %rbx
+  804173:	48 83 ec 40          	sub    $0x40,%rsp
+  804177:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804177 <dup+0xb>
+  80417e:	49 bb c9 6e 00 00 00 	movabs $0x6ec9,%r11
+  804185:	00 00 00 
+  804188:	4c 01 db             	add    %r11,%rbx
+  80418b:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80418e:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  804191:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  804195:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  804198:	48 89 d6             	mov    %rdx,%rsi
+  80419b:	89 c7                	mov    %eax,%edi
+  80419d:	48 b8 e4 8d ff ff ff 	movabs $0xffffffffffff8de4,%rax
+  8041a4:	ff ff ff 
+  8041a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041ab:	ff d0                	call   *%rax
+  8041ad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041b0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041b4:	79 08                	jns    8041be <dup+0x52>
+		return r;
+  8041b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041b9:	e9 a4 01 00 00       	jmp    804362 <dup+0x1f6>
+	close(newfdnum);
+  8041be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8041c1:	89 c7                	mov    %eax,%edi
+  8041c3:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  8041ca:	ff ff ff 
+  8041cd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041d1:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  8041d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8041d6:	48 98                	cltq
+  8041d8:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8041de:	48 c1 e0 0c          	shl    $0xc,%rax
+  8041e2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  8041e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041ea:	48 89 c7             	mov    %rax,%rdi
+  8041ed:	48 b8 eb 8c ff ff ff 	movabs $0xffffffffffff8ceb,%rax
+  8041f4:	ff ff ff 
+  8041f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041fb:	ff d0                	call   *%rax
+  8041fd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  804201:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804205:	48 89 c7             	mov    %rax,%rdi
+  804208:	48 b8 eb 8c ff ff ff 	movabs $0xffffffffffff8ceb,%rax
+  80420f:	ff ff ff 
+  804212:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804216:	ff d0                	call   *%rax
+  804218:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80421c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804220:	48 c1 e8 15          	shr    $0x15,%rax
+  804224:	48 89 c2             	mov    %rax,%rdx
+  804227:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80422e:	ff ff ff 
+  804231:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804235:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804239:	83 e0 01             	and    $0x1,%eax
+  80423c:	48 85 c0             	test   %rax,%rax
+  80423f:	74 7f                	je     8042c0 <dup+0x154>
+  804241:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804245:	48 c1 e8 0c          	shr    $0xc,%rax
+  804249:	48 89 c2             	mov    %rax,%rdx
+  80424c:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804253:	ff ff ff 
+  804256:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80425a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80425e:	83 e0 01             	and    $0x1,%eax
+  804261:	48 85 c0             	test   %rax,%rax
+  804264:	74 5a                	je     8042c0 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  804266:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80426a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80426e:	48 89 c2             	mov    %rax,%rdx
+  804271:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804278:	ff ff ff 
+  80427b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80427f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804283:	25 07 0e 00 00       	and    $0xe07,%eax
+  804288:	89 c1                	mov    %eax,%ecx
+  80428a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80428e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804292:	41 89 c8             	mov    %ecx,%r8d
+  804295:	48 89 d1             	mov    %rdx,%rcx
+  804298:	ba 00 00 00 00       	mov    $0x0,%edx
+  80429d:	48 89 c6             	mov    %rax,%rsi
+  8042a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042a5:	49 89 df             	mov    %rbx,%r15
+  8042a8:	48 b8 e4 79 ff ff ff 	movabs $0xffffffffffff79e4,%rax
+  8042af:	ff ff ff 
+  8042b2:	48 01 d8             	add    %rbx,%rax
+  8042b5:	ff d0                	call   *%rax
+  8042b7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042ba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042be:	78 5f                	js     80431f <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8042c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042c4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8042c8:	48 89 c2             	mov    %rax,%rdx
+  8042cb:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8042d2:	ff ff ff 
+  8042d5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8042d9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8042dd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8042e2:	89 c1                	mov    %eax,%ecx
+  8042e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042e8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8042ec:	41 89 c8             	mov    %ecx,%r8d
+  8042ef:	48 89 d1             	mov    %rdx,%rcx
+  8042f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042f7:	48 89 c6             	mov    %rax,%rsi
+  8042fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042ff:	49 89 df             	mov    %rbx,%r15
+  804302:	48 b8 e4 79 ff ff ff 	movabs $0xffffffffffff79e4,%rax
+  804309:	ff ff ff 
+  80430c:	48 01 d8             	add    %rbx,%rax
+  80430f:	ff d0                	call   *%rax
+  804311:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804314:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804318:	78 08                	js     804322 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  80431a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80431d:	eb 43                	jmp    804362 <dup+0x1f6>
+			goto err;
+  80431f:	90                   	nop
+  804320:	eb 01                	jmp    804323 <dup+0x1b7>
+		goto err;
+  804322:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  804323:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804327:	48 89 c6             	mov    %rax,%rsi
+  80432a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80432f:	49 89 df             	mov    %rbx,%r15
+  804332:	48 b8 57 7a ff ff ff 	movabs $0xffffffffffff7a57,%rax
+  804339:	ff ff ff 
+  80433c:	48 01 d8             	add    %rbx,%rax
+  80433f:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  804341:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804345:	48 89 c6             	mov    %rax,%rsi
+  804348:	bf 00 00 00 00       	mov    $0x0,%edi
+  80434d:	49 89 df             	mov    %rbx,%r15
+  804350:	48 b8 57 7a ff ff ff 	movabs $0xffffffffffff7a57,%rax
+  804357:	ff ff ff 
+  80435a:	48 01 d8             	add    %rbx,%rax
+  80435d:	ff d0                	call   *%rax
+	return r;
+  80435f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804362:	48 83 c4 40          	add    $0x40,%rsp
+  804366:	5b                   	pop    %rbx
+  804367:	41 5f                	pop    %r15
+  804369:	5d                   	pop    %rbp
+  80436a:	c3                   	ret
+
+000000000080436b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80436b:	55                   	push   %rbp
+  80436c:	48 89 e5             	mov    %rsp,%rbp
+  80436f:	41 57                	push   %r15
+  804371:	53                   	push   %rbx
+  804372:	48 83 ec 40          	sub    $0x40,%rsp
+  804376:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804376 <read+0xb>
+  80437d:	49 bb ca 6c 00 00 00 	movabs $0x6cca,%r11
+  804384:	00 00 00 
+  804387:	4c 01 db             	add    %r11,%rbx
+  80438a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80438d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804391:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804395:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804399:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80439c:	48 89 d6             	mov    %rdx,%rsi
+  80439f:	89 c7                	mov    %eax,%edi
+  8043a1:	48 b8 e4 8d ff ff ff 	movabs $0xffffffffffff8de4,%rax
+  8043a8:	ff ff ff 
+  8043ab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043af:	ff d0                	call   *%rax
+  8043b1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043b4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043b8:	78 28                	js     8043e2 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8043ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043be:	8b 00                	mov    (%rax),%eax
+  8043c0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8043c4:	48 89 d6             	mov    %rdx,%rsi
+  8043c7:	89 c7                	mov    %eax,%edi
+  8043c9:	48 b8 8a 8f ff ff ff 	movabs $0xffffffffffff8f8a,%rax
+  8043d0:	ff ff ff 
+  8043d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043d7:	ff d0                	call   *%rax
+  8043d9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043dc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043e0:	79 08                	jns    8043ea <read+0x7f>
+		return r;
+  8043e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043e5:	e9 8b 00 00 00       	jmp    804475 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8043ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043ee:	8b 40 08             	mov    0x8(%rax),%eax
+  8043f1:	83 e0 03             	and    $0x3,%eax
+  8043f4:	83 f8 01             	cmp    $0x1,%eax
+  8043f7:	75 4b                	jne    804444 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8043f9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804400:	ff ff ff 
+  804403:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804407:	48 8b 00             	mov    (%rax),%rax
+  80440a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804410:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804413:	89 c6                	mov    %eax,%esi
+  804415:	48 b8 df db ff ff ff 	movabs $0xffffffffffffdbdf,%rax
+  80441c:	ff ff ff 
+  80441f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804423:	48 89 c7             	mov    %rax,%rdi
+  804426:	49 89 df             	mov    %rbx,%r15
+  804429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80442e:	48 b9 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rcx
+  804435:	ff ff ff 
+  804438:	48 01 d9             	add    %rbx,%rcx
+  80443b:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80443d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804442:	eb 31                	jmp    804475 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  804444:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804448:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80444c:	48 85 c0             	test   %rax,%rax
+  80444f:	75 07                	jne    804458 <read+0xed>
+		return -E_NOT_SUPP;
+  804451:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804456:	eb 1d                	jmp    804475 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  804458:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80445c:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  804460:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804464:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804468:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80446c:	48 89 ce             	mov    %rcx,%rsi
+  80446f:	48 89 c7             	mov    %rax,%rdi
+  804472:	41 ff d0             	call   *%r8
+}
+  804475:	48 83 c4 40          	add    $0x40,%rsp
+  804479:	5b                   	pop    %rbx
+  80447a:	41 5f                	pop    %r15
+  80447c:	5d                   	pop    %rbp
+  80447d:	c3                   	ret
+
+000000000080447e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80447e:	55                   	push   %rbp
+  80447f:	48 89 e5             	mov    %rsp,%rbp
+  804482:	53                   	push   %rbx
+  804483:	48 83 ec 38          	sub    $0x38,%rsp
+  804487:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804487 <readn+0x9>
+  80448e:	49 bb b9 6b 00 00 00 	movabs $0x6bb9,%r11
+  804495:	00 00 00 
+  804498:	4c 01 db             	add    %r11,%rbx
+  80449b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80449e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8044a2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8044a6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8044ad:	eb 4b                	jmp    8044fa <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8044af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044b2:	48 98                	cltq
+  8044b4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044b8:	48 29 c2             	sub    %rax,%rdx
+  8044bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044be:	48 63 c8             	movslq %eax,%rcx
+  8044c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8044c5:	48 01 c1             	add    %rax,%rcx
+  8044c8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044cb:	48 89 ce             	mov    %rcx,%rsi
+  8044ce:	89 c7                	mov    %eax,%edi
+  8044d0:	48 b8 2b 93 ff ff ff 	movabs $0xffffffffffff932b,%rax
+  8044d7:	ff ff ff 
+  8044da:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044de:	ff d0                	call   *%rax
+  8044e0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  8044e3:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8044e7:	79 05                	jns    8044ee <readn+0x70>
+			return m;
+  8044e9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8044ec:	eb 1d                	jmp    80450b <readn+0x8d>
+		if (m == 0)
+  8044ee:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8044f2:	74 13                	je     804507 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  8044f4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8044f7:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8044fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044fd:	48 98                	cltq
+  8044ff:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  804503:	72 aa                	jb     8044af <readn+0x31>
+  804505:	eb 01                	jmp    804508 <readn+0x8a>
+			break;
+  804507:	90                   	nop
+	}
+	return tot;
+  804508:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80450b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80450f:	c9                   	leave
+  804510:	c3                   	ret
+
+0000000000804511 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  804511:	55                   	push   %rbp
+  804512:	48 89 e5             	mov    %rsp,%rbp
+  804515:	41 57                	push   %r15
+  804517:	53                   	push   %rbx
+  804518:	48 83 ec 40          	sub    $0x40,%rsp
+  80451c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80451c <write+0xb>
+  804523:	49 bb 24 6b 00 00 00 	movabs $0x6b24,%r11
+  80452a:	00 00 00 
+  80452d:	4c 01 db             	add    %r11,%rbx
+  804530:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804533:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804537:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80453b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80453f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804542:	48 89 d6             	mov    %rdx,%rsi
+  804545:	89 c7                	mov    %eax,%edi
+  804547:	48 b8 e4 8d ff ff ff 	movabs $0xffffffffffff8de4,%rax
+  80454e:	ff ff ff 
+  804551:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804555:	ff d0                	call   *%rax
+  804557:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80455a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80455e:	78 28                	js     804588 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804560:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804564:	8b 00                	mov    (%rax),%eax
+  804566:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80456a:	48 89 d6             	mov    %rdx,%rsi
+  80456d:	89 c7                	mov    %eax,%edi
+  80456f:	48 b8 8a 8f ff ff ff 	movabs $0xffffffffffff8f8a,%rax
+  804576:	ff ff ff 
+  804579:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80457d:	ff d0                	call   *%rax
+  80457f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804582:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804586:	79 08                	jns    804590 <write+0x7f>
+		return r;
+  804588:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80458b:	e9 8a 00 00 00       	jmp    80461a <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804590:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804594:	8b 40 08             	mov    0x8(%rax),%eax
+  804597:	83 e0 03             	and    $0x3,%eax
+  80459a:	85 c0                	test   %eax,%eax
+  80459c:	75 4b                	jne    8045e9 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80459e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8045a5:	ff ff ff 
+  8045a8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8045ac:	48 8b 00             	mov    (%rax),%rax
+  8045af:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8045b5:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8045b8:	89 c6                	mov    %eax,%esi
+  8045ba:	48 b8 fb db ff ff ff 	movabs $0xffffffffffffdbfb,%rax
+  8045c1:	ff ff ff 
+  8045c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045c8:	48 89 c7             	mov    %rax,%rdi
+  8045cb:	49 89 df             	mov    %rbx,%r15
+  8045ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045d3:	48 b9 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rcx
+  8045da:	ff ff ff 
+  8045dd:	48 01 d9             	add    %rbx,%rcx
+  8045e0:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8045e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8045e7:	eb 31                	jmp    80461a <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8045e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045ed:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8045f1:	48 85 c0             	test   %rax,%rax
+  8045f4:	75 07                	jne    8045fd <write+0xec>
+		return -E_NOT_SUPP;
+  8045f6:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8045fb:	eb 1d                	jmp    80461a <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  8045fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804601:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  804605:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804609:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80460d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804611:	48 89 ce             	mov    %rcx,%rsi
+  804614:	48 89 c7             	mov    %rax,%rdi
+  804617:	41 ff d0             	call   *%r8
+}
+  80461a:	48 83 c4 40          	add    $0x40,%rsp
+  80461e:	5b                   	pop    %rbx
+  80461f:	41 5f                	pop    %r15
+  804621:	5d                   	pop    %rbp
+  804622:	c3                   	ret
+
+0000000000804623 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  804623:	55                   	push   %rbp
+  804624:	48 89 e5             	mov    %rsp,%rbp
+  804627:	48 83 ec 18          	sub    $0x18,%rsp
+  80462b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80462b <seek+0x8>
+  804632:	49 bb 15 6a 00 00 00 	movabs $0x6a15,%r11
+  804639:	00 00 00 
+  80463c:	4c 01 d8             	add    %r11,%rax
+  80463f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804642:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804645:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  804649:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80464c:	48 89 ce             	mov    %rcx,%rsi
+  80464f:	89 d7                	mov    %edx,%edi
+  804651:	48 ba e4 8d ff ff ff 	movabs $0xffffffffffff8de4,%rdx
+  804658:	ff ff ff 
+  80465b:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80465f:	ff d0                	call   *%rax
+  804661:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804664:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804668:	79 05                	jns    80466f <seek+0x4c>
+		return r;
+  80466a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80466d:	eb 0f                	jmp    80467e <seek+0x5b>
+	fd->fd_offset = offset;
+  80466f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804673:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804676:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  804679:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80467e:	c9                   	leave
+  80467f:	c3                   	ret
+
+0000000000804680 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  804680:	55                   	push   %rbp
+  804681:	48 89 e5             	mov    %rsp,%rbp
+  804684:	41 57                	push   %r15
+  804686:	53                   	push   %rbx
+  804687:	48 83 ec 30          	sub    $0x30,%rsp
+  80468b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80468b <ftruncate+0xb>
+  804692:	49 bb b5 69 00 00 00 	movabs $0x69b5,%r11
+  804699:	00 00 00 
+  80469c:	4c 01 db             	add    %r11,%rbx
+  80469f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8046a2:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8046a5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8046a9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8046ac:	48 89 d6             	mov    %rdx,%rsi
+  8046af:	89 c7                	mov    %eax,%edi
+  8046b1:	48 b8 e4 8d ff ff ff 	movabs $0xffffffffffff8de4,%rax
+  8046b8:	ff ff ff 
+  8046bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046bf:	ff d0                	call   *%rax
+  8046c1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046c4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046c8:	78 28                	js     8046f2 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8046ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046ce:	8b 00                	mov    (%rax),%eax
+  8046d0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8046d4:	48 89 d6             	mov    %rdx,%rsi
+  8046d7:	89 c7                	mov    %eax,%edi
+  8046d9:	48 b8 8a 8f ff ff ff 	movabs $0xffffffffffff8f8a,%rax
+  8046e0:	ff ff ff 
+  8046e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046e7:	ff d0                	call   *%rax
+  8046e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046f0:	79 08                	jns    8046fa <ftruncate+0x7a>
+		return r;
+  8046f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046f5:	e9 83 00 00 00       	jmp    80477d <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8046fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046fe:	8b 40 08             	mov    0x8(%rax),%eax
+  804701:	83 e0 03             	and    $0x3,%eax
+  804704:	85 c0                	test   %eax,%eax
+  804706:	75 4b                	jne    804753 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  804708:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80470f:	ff ff ff 
+  804712:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804716:	48 8b 00             	mov    (%rax),%rax
+  804719:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80471f:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804722:	89 c6                	mov    %eax,%esi
+  804724:	48 b8 18 dc ff ff ff 	movabs $0xffffffffffffdc18,%rax
+  80472b:	ff ff ff 
+  80472e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804732:	48 89 c7             	mov    %rax,%rdi
+  804735:	49 89 df             	mov    %rbx,%r15
+  804738:	b8 00 00 00 00       	mov    $0x0,%eax
+  80473d:	48 b9 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rcx
+  804744:	ff ff ff 
+  804747:	48 01 d9             	add    %rbx,%rcx
+  80474a:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80474c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804751:	eb 2a                	jmp    80477d <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  804753:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804757:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80475b:	48 85 c0             	test   %rax,%rax
+  80475e:	75 07                	jne    804767 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  804760:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804765:	eb 16                	jmp    80477d <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  804767:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80476b:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80476f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804773:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  804776:	89 d6                	mov    %edx,%esi
+  804778:	48 89 c7             	mov    %rax,%rdi
+  80477b:	ff d1                	call   *%rcx
+}
+  80477d:	48 83 c4 30          	add    $0x30,%rsp
+  804781:	5b                   	pop    %rbx
+  804782:	41 5f                	pop    %r15
+  804784:	5d                   	pop    %rbp
+  804785:	c3                   	ret
+
+0000000000804786 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  804786:	55                   	push   %rbp
+  804787:	48 89 e5             	mov    %rsp,%rbp
+  80478a:	53                   	push   %rbx
+  80478b:	48 83 ec 38          	sub    $0x38,%rsp
+  80478f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80478f <fstat+0x9>
+  804796:	49 bb b1 68 00 00 00 	movabs $0x68b1,%r11
+  80479d:	00 00 00 
+  8047a0:	4c 01 db             	add    %r11,%rbx
+  8047a3:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8047a6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8047aa:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8047ae:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8047b1:	48 89 d6             	mov    %rdx,%rsi
+  8047b4:	89 c7                	mov    %eax,%edi
+  8047b6:	48 b8 e4 8d ff ff ff 	movabs $0xffffffffffff8de4,%rax
+  8047bd:	ff ff ff 
+  8047c0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047c4:	ff d0                	call   *%rax
+  8047c6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047c9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047cd:	78 28                	js     8047f7 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8047cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047d3:	8b 00                	mov    (%rax),%eax
+  8047d5:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8047d9:	48 89 d6             	mov    %rdx,%rsi
+  8047dc:	89 c7                	mov    %eax,%edi
+  8047de:	48 b8 8a 8f ff ff ff 	movabs $0xffffffffffff8f8a,%rax
+  8047e5:	ff ff ff 
+  8047e8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047ec:	ff d0                	call   *%rax
+  8047ee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047f1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047f5:	79 05                	jns    8047fc <fstat+0x76>
+		return r;
+  8047f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047fa:	eb 5e                	jmp    80485a <fstat+0xd4>
+	if (!dev->dev_stat)
+  8047fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804800:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804804:	48 85 c0             	test   %rax,%rax
+  804807:	75 07                	jne    804810 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  804809:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80480e:	eb 4a                	jmp    80485a <fstat+0xd4>
+	stat->st_name[0] = 0;
+  804810:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804814:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  804817:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80481b:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804822:	00 00 00 
+	stat->st_isdir = 0;
+  804825:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804829:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804830:	00 00 00 
+	stat->st_dev = dev;
+  804833:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804837:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80483b:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  804842:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804846:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80484a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80484e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804852:	48 89 d6             	mov    %rdx,%rsi
+  804855:	48 89 c7             	mov    %rax,%rdi
+  804858:	ff d1                	call   *%rcx
+}
+  80485a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80485e:	c9                   	leave
+  80485f:	c3                   	ret
+
+0000000000804860 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804860:	55                   	push   %rbp
+  804861:	48 89 e5             	mov    %rsp,%rbp
+  804864:	41 57                	push   %r15
+  804866:	53                   	push   %rbx
+  804867:	48 83 ec 20          	sub    $0x20,%rsp
+  80486b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80486b <stat+0xb>
+  804872:	49 bb d5 67 00 00 00 	movabs $0x67d5,%r11
+  804879:	00 00 00 
+  80487c:	4c 01 db             	add    %r11,%rbx
+  80487f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804883:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804887:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80488b:	be 00 00 00 00       	mov    $0x0,%esi
+  804890:	48 89 c7             	mov    %rax,%rdi
+  804893:	49 89 df             	mov    %rbx,%r15
+  804896:	48 b8 fa 9a ff ff ff 	movabs $0xffffffffffff9afa,%rax
+  80489d:	ff ff ff 
+  8048a0:	48 01 d8             	add    %rbx,%rax
+  8048a3:	ff d0                	call   *%rax
+  8048a5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8048a8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8048ac:	79 05                	jns    8048b3 <stat+0x53>
+		return fd;
+  8048ae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048b1:	eb 37                	jmp    8048ea <stat+0x8a>
+	r = fstat(fd, stat);
+  8048b3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8048b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048ba:	48 89 d6             	mov    %rdx,%rsi
+  8048bd:	89 c7                	mov    %eax,%edi
+  8048bf:	48 b8 46 97 ff ff ff 	movabs $0xffffffffffff9746,%rax
+  8048c6:	ff ff ff 
+  8048c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048cd:	ff d0                	call   *%rax
+  8048cf:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8048d2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048d5:	89 c7                	mov    %eax,%edi
+  8048d7:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  8048de:	ff ff ff 
+  8048e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048e5:	ff d0                	call   *%rax
+	return r;
+  8048e7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8048ea:	48 83 c4 20          	add    $0x20,%rsp
+  8048ee:	5b                   	pop    %rbx
+  8048ef:	41 5f                	pop    %r15
+  8048f1:	5d                   	pop    %rbp
+  8048f2:	c3                   	ret
+
+00000000008048f3 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8048f3:	55                   	push   %rbp
+  8048f4:	48 89 e5             	mov    %rsp,%rbp
+  8048f7:	41 57                	push   %r15
+  8048f9:	53                   	push   %rbx
+  8048fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8048fe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048fe <fsipc+0xb>
+  804905:	49 bb 42 67 00 00 00 	movabs $0x6742,%r11
+  80490c:	00 00 00 
+  80490f:	4c 01 db             	add    %r11,%rbx
+  804912:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804915:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  804919:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804920:	00 00 00 
+  804923:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804926:	85 c0                	test   %eax,%eax
+  804928:	75 24                	jne    80494e <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80492a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80492f:	49 89 df             	mov    %rbx,%r15
+  804932:	48 b8 ac d3 ff ff ff 	movabs $0xffffffffffffd3ac,%rax
+  804939:	ff ff ff 
+  80493c:	48 01 d8             	add    %rbx,%rax
+  80493f:	ff d0                	call   *%rax
+  804941:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804948:	00 00 00 
+  80494b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  80494e:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804955:	00 00 00 
+  804958:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80495b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80495f:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804962:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804968:	49 89 d0             	mov    %rdx,%r8
+  80496b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804970:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804977:	00 00 00 
+  80497a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80497e:	89 c7                	mov    %eax,%edi
+  804980:	49 89 df             	mov    %rbx,%r15
+  804983:	48 b8 cb cd ff ff ff 	movabs $0xffffffffffffcdcb,%rax
+  80498a:	ff ff ff 
+  80498d:	48 01 d8             	add    %rbx,%rax
+  804990:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  804992:	48 83 c4 10          	add    $0x10,%rsp
+  804996:	5b                   	pop    %rbx
+  804997:	41 5f                	pop    %r15
+  804999:	5d                   	pop    %rbp
+  80499a:	c3                   	ret
+
+000000000080499b <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  80499b:	55                   	push   %rbp
+  80499c:	48 89 e5             	mov    %rsp,%rbp
+  80499f:	41 57                	push   %r15
+  8049a1:	53                   	push   %rbx
+  8049a2:	48 83 ec 20          	sub    $0x20,%rsp
+  8049a6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049a6 <fsipc_words+0xb>
+  8049ad:	49 bb 9a 66 00 00 00 	movabs $0x669a,%r11
+  8049b4:	00 00 00 
+  8049b7:	4c 01 db             	add    %r11,%rbx
+  8049ba:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8049bd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8049c1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8049c5:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8049cc:	00 00 00 
+  8049cf:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8049d2:	85 c0                	test   %eax,%eax
+  8049d4:	75 24                	jne    8049fa <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8049d6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8049db:	49 89 df             	mov    %rbx,%r15
+  8049de:	48 b8 ac d3 ff ff ff 	movabs $0xffffffffffffd3ac,%rax
+  8049e5:	ff ff ff 
+  8049e8:	48 01 d8             	add    %rbx,%rax
+  8049eb:	ff d0                	call   *%rax
+  8049ed:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8049f4:	00 00 00 
+  8049f7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  8049fa:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804a01:	00 00 00 
+  804a04:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a07:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804a0b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804a0f:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804a12:	89 c7                	mov    %eax,%edi
+  804a14:	49 89 df             	mov    %rbx,%r15
+  804a17:	48 b8 b6 ce ff ff ff 	movabs $0xffffffffffffceb6,%rax
+  804a1e:	ff ff ff 
+  804a21:	48 01 d8             	add    %rbx,%rax
+  804a24:	ff d0                	call   *%rax
+}
+  804a26:	48 83 c4 20          	add    $0x20,%rsp
+  804a2a:	5b                   	pop    %rbx
+  804a2b:	41 5f                	pop    %r15
+  804a2d:	5d                   	pop    %rbp
+  804a2e:	c3                   	ret
+
+0000000000804a2f <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804a2f:	55                   	push   %rbp
+  804a30:	48 89 e5             	mov    %rsp,%rbp
+  804a33:	41 57                	push   %r15
+  804a35:	53                   	push   %rbx
+  804a36:	48 83 ec 40          	sub    $0x40,%rsp
+  804a3a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a3a <fsipc_pages+0xb>
+  804a41:	49 bb 06 66 00 00 00 	movabs $0x6606,%r11
+  804a48:	00 00 00 
+  804a4b:	4c 01 db             	add    %r11,%rbx
+  804a4e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804a51:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804a55:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804a59:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  804a5c:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804a63:	00 00 00 
+  804a66:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a69:	85 c0                	test   %eax,%eax
+  804a6b:	75 24                	jne    804a91 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804a6d:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a72:	49 89 df             	mov    %rbx,%r15
+  804a75:	48 b8 ac d3 ff ff ff 	movabs $0xffffffffffffd3ac,%rax
+  804a7c:	ff ff ff 
+  804a7f:	48 01 d8             	add    %rbx,%rax
+  804a82:	ff d0                	call   *%rax
+  804a84:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804a8b:	00 00 00 
+  804a8e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  804a91:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804a96:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804a9a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804a9d:	48 98                	cltq
+  804a9f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  804aa3:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804aa7:	0f 95 c0             	setne  %al
+  804aaa:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804aad:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804ab4:	00 
+  804ab5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804ab9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804abd:	48 01 d0             	add    %rdx,%rax
+  804ac0:	48 83 e8 01          	sub    $0x1,%rax
+  804ac4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804ac8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804acc:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ad1:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804ad5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ad9:	48 29 d0             	sub    %rdx,%rax
+  804adc:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804ae0:	41 89 c2             	mov    %eax,%r10d
+  804ae3:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804aea:	00 00 00 
+  804aed:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804af0:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804af4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804af8:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804afb:	48 83 ec 08          	sub    $0x8,%rsp
+  804aff:	6a 40                	push   $0x40
+  804b01:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804b06:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804b0d:	00 
+  804b0e:	6a 05                	push   $0x5
+  804b10:	41 89 f9             	mov    %edi,%r9d
+  804b13:	49 89 c8             	mov    %rcx,%r8
+  804b16:	44 89 d1             	mov    %r10d,%ecx
+  804b19:	89 c7                	mov    %eax,%edi
+  804b1b:	49 89 df             	mov    %rbx,%r15
+  804b1e:	48 b8 b4 cf ff ff ff 	movabs $0xffffffffffffcfb4,%rax
+  804b25:	ff ff ff 
+  804b28:	48 01 d8             	add    %rbx,%rax
+  804b2b:	ff d0                	call   *%rax
+  804b2d:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804b31:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804b35:	5b                   	pop    %rbx
+  804b36:	41 5f                	pop    %r15
+  804b38:	5d                   	pop    %rbp
+  804b39:	c3                   	ret
+
+0000000000804b3a <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804b3a:	55                   	push   %rbp
+  804b3b:	48 89 e5             	mov    %rsp,%rbp
+  804b3e:	41 57                	push   %r15
+  804b40:	53                   	push   %rbx
+  804b41:	48 83 ec 20          	sub    $0x20,%rsp
+  804b45:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b45 <open+0xb>
+  804b4c:	49 bb fb 64 00 00 00 	movabs $0x64fb,%r11
+  804b53:	00 00 00 
+  804b56:	4c 01 db             	add    %r11,%rbx
+  804b59:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804b5d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804b60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b64:	48 89 c7             	mov    %rax,%rdi
+  804b67:	49 89 df             	mov    %rbx,%r15
+  804b6a:	48 b8 2f 6c ff ff ff 	movabs $0xffffffffffff6c2f,%rax
+  804b71:	ff ff ff 
+  804b74:	48 01 d8             	add    %rbx,%rax
+  804b77:	ff d0                	call   *%rax
+  804b79:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804b7e:	7e 0a                	jle    804b8a <open+0x50>
+		return -E_BAD_PATH;
+  804b80:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804b85:	e9 18 01 00 00       	jmp    804ca2 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804b8a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804b8e:	48 89 c7             	mov    %rax,%rdi
+  804b91:	49 89 df             	mov    %rbx,%r15
+  804b94:	48 b8 2e 8d ff ff ff 	movabs $0xffffffffffff8d2e,%rax
+  804b9b:	ff ff ff 
+  804b9e:	48 01 d8             	add    %rbx,%rax
+  804ba1:	ff d0                	call   *%rax
+  804ba3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ba6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804baa:	74 08                	je     804bb4 <open+0x7a>
+		return r;
+  804bac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804baf:	e9 ee 00 00 00       	jmp    804ca2 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804bb4:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804bbb:	00 00 00 
+  804bbe:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804bc1:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804bc8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bcc:	48 89 c6             	mov    %rax,%rsi
+  804bcf:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804bd6:	00 00 00 
+  804bd9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bdd:	48 89 c7             	mov    %rax,%rdi
+  804be0:	49 89 df             	mov    %rbx,%r15
+  804be3:	48 b8 c3 6c ff ff ff 	movabs $0xffffffffffff6cc3,%rax
+  804bea:	ff ff ff 
+  804bed:	48 01 d8             	add    %rbx,%rax
+  804bf0:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804bf2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bf6:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804bfb:	48 89 c6             	mov    %rax,%rsi
+  804bfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c03:	49 89 df             	mov    %rbx,%r15
+  804c06:	48 b8 7f 79 ff ff ff 	movabs $0xffffffffffff797f,%rax
+  804c0d:	ff ff ff 
+  804c10:	48 01 d8             	add    %rbx,%rax
+  804c13:	ff d0                	call   *%rax
+  804c15:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c18:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c1c:	74 23                	je     804c41 <open+0x107>
+		fd_close(fd,0);
+  804c1e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c22:	be 00 00 00 00       	mov    $0x0,%esi
+  804c27:	48 89 c7             	mov    %rax,%rdi
+  804c2a:	49 89 df             	mov    %rbx,%r15
+  804c2d:	48 b8 8f 8e ff ff ff 	movabs $0xffffffffffff8e8f,%rax
+  804c34:	ff ff ff 
+  804c37:	48 01 d8             	add    %rbx,%rax
+  804c3a:	ff d0                	call   *%rax
+		return r;
+  804c3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c3f:	eb 61                	jmp    804ca2 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804c41:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c45:	48 89 c6             	mov    %rax,%rsi
+  804c48:	bf 01 00 00 00       	mov    $0x1,%edi
+  804c4d:	48 b8 b3 98 ff ff ff 	movabs $0xffffffffffff98b3,%rax
+  804c54:	ff ff ff 
+  804c57:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c5b:	ff d0                	call   *%rax
+  804c5d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c60:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c64:	74 23                	je     804c89 <open+0x14f>
+		fd_close(fd,0);
+  804c66:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c6a:	be 00 00 00 00       	mov    $0x0,%esi
+  804c6f:	48 89 c7             	mov    %rax,%rdi
+  804c72:	49 89 df             	mov    %rbx,%r15
+  804c75:	48 b8 8f 8e ff ff ff 	movabs $0xffffffffffff8e8f,%rax
+  804c7c:	ff ff ff 
+  804c7f:	48 01 d8             	add    %rbx,%rax
+  804c82:	ff d0                	call   *%rax
+		return r;
+  804c84:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c87:	eb 19                	jmp    804ca2 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804c89:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c8d:	48 89 c7             	mov    %rax,%rdi
+  804c90:	49 89 df             	mov    %rbx,%r15
+  804c93:	48 b8 b4 8c ff ff ff 	movabs $0xffffffffffff8cb4,%rax
+  804c9a:	ff ff ff 
+  804c9d:	48 01 d8             	add    %rbx,%rax
+  804ca0:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804ca2:	48 83 c4 20          	add    $0x20,%rsp
+  804ca6:	5b                   	pop    %rbx
+  804ca7:	41 5f                	pop    %r15
+  804ca9:	5d                   	pop    %rbp
+  804caa:	c3                   	ret
+
+0000000000804cab <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804cab:	55                   	push   %rbp
+  804cac:	48 89 e5             	mov    %rsp,%rbp
+  804caf:	48 83 ec 20          	sub    $0x20,%rsp
+  804cb3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804cb3 <devfile_flush+0x8>
+  804cba:	49 bb 8d 63 00 00 00 	movabs $0x638d,%r11
+  804cc1:	00 00 00 
+  804cc4:	4c 01 d8             	add    %r11,%rax
+  804cc7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804ccb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ccf:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804cd2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804cd5:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804cd9:	ba 04 00 00 00       	mov    $0x4,%edx
+  804cde:	48 89 ce             	mov    %rcx,%rsi
+  804ce1:	bf 06 00 00 00       	mov    $0x6,%edi
+  804ce6:	48 b9 5b 99 ff ff ff 	movabs $0xffffffffffff995b,%rcx
+  804ced:	ff ff ff 
+  804cf0:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804cf4:	ff d0                	call   *%rax
+}
+  804cf6:	c9                   	leave
+  804cf7:	c3                   	ret
+
+0000000000804cf8 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804cf8:	55                   	push   %rbp
+  804cf9:	48 89 e5             	mov    %rsp,%rbp
+  804cfc:	41 57                	push   %r15
+  804cfe:	53                   	push   %rbx
+  804cff:	48 83 ec 60          	sub    $0x60,%rsp
+  804d03:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d03 <devfile_read+0xb>
+  804d0a:	49 bb 3d 63 00 00 00 	movabs $0x633d,%r11
+  804d11:	00 00 00 
+  804d14:	4c 01 db             	add    %r11,%rbx
+  804d17:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804d1b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804d1f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804d23:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804d27:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804d2b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804d2f:	8b 50 0c             	mov    0xc(%rax),%edx
+  804d32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d36:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804d38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d3c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804d40:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804d44:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804d48:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804d4d:	ba 10 00 00 00       	mov    $0x10,%edx
+  804d52:	48 89 c6             	mov    %rax,%rsi
+  804d55:	bf 03 00 00 00       	mov    $0x3,%edi
+  804d5a:	48 b8 ef 99 ff ff ff 	movabs $0xffffffffffff99ef,%rax
+  804d61:	ff ff ff 
+  804d64:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d68:	ff d0                	call   *%rax
+  804d6a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804d6d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804d71:	79 05                	jns    804d78 <devfile_read+0x80>
+		return r;
+  804d73:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804d76:	eb 64                	jmp    804ddc <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804d78:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804d7b:	48 63 d0             	movslq %eax,%rdx
+  804d7e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804d82:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804d87:	48 01 c1             	add    %rax,%rcx
+  804d8a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804d8e:	48 89 ce             	mov    %rcx,%rsi
+  804d91:	48 89 c7             	mov    %rax,%rdi
+  804d94:	49 89 df             	mov    %rbx,%r15
+  804d97:	48 b8 a3 70 ff ff ff 	movabs $0xffffffffffff70a3,%rax
+  804d9e:	ff ff ff 
+  804da1:	48 01 d8             	add    %rbx,%rax
+  804da4:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804da6:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804dad:	ff ff ff 
+  804db0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804db4:	48 8b 00             	mov    (%rax),%rax
+  804db7:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804dbd:	89 c6                	mov    %eax,%esi
+  804dbf:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804dc4:	48 89 c7             	mov    %rax,%rdi
+  804dc7:	49 89 df             	mov    %rbx,%r15
+  804dca:	48 b8 66 d3 ff ff ff 	movabs $0xffffffffffffd366,%rax
+  804dd1:	ff ff ff 
+  804dd4:	48 01 d8             	add    %rbx,%rax
+  804dd7:	ff d0                	call   *%rax
+	return r;
+  804dd9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804ddc:	48 83 c4 60          	add    $0x60,%rsp
+  804de0:	5b                   	pop    %rbx
+  804de1:	41 5f                	pop    %r15
+  804de3:	5d                   	pop    %rbp
+  804de4:	c3                   	ret
+
+0000000000804de5 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804de5:	55                   	push   %rbp
+  804de6:	48 89 e5             	mov    %rsp,%rbp
+  804de9:	41 57                	push   %r15
+  804deb:	53                   	push   %rbx
+  804dec:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804df0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804df0 <devfile_write+0xb>
+  804df7:	49 bb 50 62 00 00 00 	movabs $0x6250,%r11
+  804dfe:	00 00 00 
+  804e01:	4c 01 db             	add    %r11,%rbx
+  804e04:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804e08:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804e0c:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804e13:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804e17:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804e1b:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804e22:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804e26:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804e2d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e30:	48 63 d0             	movslq %eax,%rdx
+  804e33:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e37:	48 39 c2             	cmp    %rax,%rdx
+  804e3a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804e3e:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804e45:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804e4c:	00 
+  804e4d:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804e54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e58:	48 01 d0             	add    %rdx,%rax
+  804e5b:	48 83 e8 01          	sub    $0x1,%rax
+  804e5f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804e63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e67:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e6c:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804e70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e74:	48 29 d0             	sub    %rdx,%rax
+  804e77:	48 c1 e8 0c          	shr    $0xc,%rax
+  804e7b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804e7e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804e81:	89 c6                	mov    %eax,%esi
+  804e83:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804e88:	48 89 c7             	mov    %rax,%rdi
+  804e8b:	49 89 df             	mov    %rbx,%r15
+  804e8e:	48 b8 20 d3 ff ff ff 	movabs $0xffffffffffffd320,%rax
+  804e95:	ff ff ff 
+  804e98:	48 01 d8             	add    %rbx,%rax
+  804e9b:	ff d0                	call   *%rax
+  804e9d:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804ea0:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804ea4:	79 08                	jns    804eae <devfile_write+0xc9>
+		return r;
+  804ea6:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804ea9:	e9 8f 00 00 00       	jmp    804f3d <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804eae:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804eb5:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804eb9:	48 89 c6             	mov    %rax,%rsi
+  804ebc:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804ec1:	48 89 c7             	mov    %rax,%rdi
+  804ec4:	49 89 df             	mov    %rbx,%r15
+  804ec7:	48 b8 a3 70 ff ff ff 	movabs $0xffffffffffff70a3,%rax
+  804ece:	ff ff ff 
+  804ed1:	48 01 d8             	add    %rbx,%rax
+  804ed4:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804ed6:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804eda:	8b 50 0c             	mov    0xc(%rax),%edx
+  804edd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee1:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804ee3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee7:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804eee:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804ef2:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804ef5:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804ef9:	89 d1                	mov    %edx,%ecx
+  804efb:	ba 10 00 00 00       	mov    $0x10,%edx
+  804f00:	48 89 c6             	mov    %rax,%rsi
+  804f03:	bf 04 00 00 00       	mov    $0x4,%edi
+  804f08:	48 b8 ef 99 ff ff ff 	movabs $0xffffffffffff99ef,%rax
+  804f0f:	ff ff ff 
+  804f12:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f16:	ff d0                	call   *%rax
+  804f18:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804f1b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804f1e:	89 c6                	mov    %eax,%esi
+  804f20:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804f25:	48 89 c7             	mov    %rax,%rdi
+  804f28:	49 89 df             	mov    %rbx,%r15
+  804f2b:	48 b8 66 d3 ff ff ff 	movabs $0xffffffffffffd366,%rax
+  804f32:	ff ff ff 
+  804f35:	48 01 d8             	add    %rbx,%rax
+  804f38:	ff d0                	call   *%rax
+	return r;
+  804f3a:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804f3d:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804f41:	5b                   	pop    %rbx
+  804f42:	41 5f                	pop    %r15
+  804f44:	5d                   	pop    %rbp
+  804f45:	c3                   	ret
+
+0000000000804f46 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804f46:	55                   	push   %rbp
+  804f47:	48 89 e5             	mov    %rsp,%rbp
+  804f4a:	41 57                	push   %r15
+  804f4c:	53                   	push   %rbx
+  804f4d:	48 83 ec 20          	sub    $0x20,%rsp
+  804f51:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f51 <devfile_stat+0xb>
+  804f58:	49 bb ef 60 00 00 00 	movabs $0x60ef,%r11
+  804f5f:	00 00 00 
+  804f62:	4c 01 db             	add    %r11,%rbx
+  804f65:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804f69:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804f6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f71:	8b 40 0c             	mov    0xc(%rax),%eax
+  804f74:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804f7b:	00 00 00 
+  804f7e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804f81:	be 00 00 00 00       	mov    $0x0,%esi
+  804f86:	bf 05 00 00 00       	mov    $0x5,%edi
+  804f8b:	48 b8 b3 98 ff ff ff 	movabs $0xffffffffffff98b3,%rax
+  804f92:	ff ff ff 
+  804f95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f99:	ff d0                	call   *%rax
+  804f9b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f9e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804fa2:	79 05                	jns    804fa9 <devfile_stat+0x63>
+		return r;
+  804fa4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fa7:	eb 65                	jmp    80500e <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804fa9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fad:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804fb4:	00 00 00 
+  804fb7:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804fbb:	48 89 d6             	mov    %rdx,%rsi
+  804fbe:	48 89 c7             	mov    %rax,%rdi
+  804fc1:	49 89 df             	mov    %rbx,%r15
+  804fc4:	48 b8 c3 6c ff ff ff 	movabs $0xffffffffffff6cc3,%rax
+  804fcb:	ff ff ff 
+  804fce:	48 01 d8             	add    %rbx,%rax
+  804fd1:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804fd3:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804fda:	00 00 00 
+  804fdd:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804fe4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fe8:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804fee:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804ff5:	00 00 00 
+  804ff8:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804fff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805003:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  805009:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80500e:	48 83 c4 20          	add    $0x20,%rsp
+  805012:	5b                   	pop    %rbx
+  805013:	41 5f                	pop    %r15
+  805015:	5d                   	pop    %rbp
+  805016:	c3                   	ret
+
+0000000000805017 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  805017:	55                   	push   %rbp
+  805018:	48 89 e5             	mov    %rsp,%rbp
+  80501b:	48 83 ec 20          	sub    $0x20,%rsp
+  80501f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80501f <devfile_trunc+0x8>
+  805026:	49 bb 21 60 00 00 00 	movabs $0x6021,%r11
+  80502d:	00 00 00 
+  805030:	4c 01 d8             	add    %r11,%rax
+  805033:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805037:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  80503a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80503e:	8b 52 0c             	mov    0xc(%rdx),%edx
+  805041:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  805044:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805047:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  80504a:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80504e:	ba 08 00 00 00       	mov    $0x8,%edx
+  805053:	48 89 ce             	mov    %rcx,%rsi
+  805056:	bf 02 00 00 00       	mov    $0x2,%edi
+  80505b:	48 b9 5b 99 ff ff ff 	movabs $0xffffffffffff995b,%rcx
+  805062:	ff ff ff 
+  805065:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805069:	ff d0                	call   *%rax
+}
+  80506b:	c9                   	leave
+  80506c:	c3                   	ret
+
+000000000080506d <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80506d:	55                   	push   %rbp
+  80506e:	48 89 e5             	mov    %rsp,%rbp
+  805071:	41 57                	push   %r15
+  805073:	53                   	push   %rbx
+  805074:	48 83 ec 10          	sub    $0x10,%rsp
+  805078:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805078 <remove+0xb>
+  80507f:	49 bb c8 5f 00 00 00 	movabs $0x5fc8,%r11
+  805086:	00 00 00 
+  805089:	4c 01 db             	add    %r11,%rbx
+  80508c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  805090:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805094:	48 89 c7             	mov    %rax,%rdi
+  805097:	49 89 df             	mov    %rbx,%r15
+  80509a:	48 b8 2f 6c ff ff ff 	movabs $0xffffffffffff6c2f,%rax
+  8050a1:	ff ff ff 
+  8050a4:	48 01 d8             	add    %rbx,%rax
+  8050a7:	ff d0                	call   *%rax
+  8050a9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8050ae:	7e 07                	jle    8050b7 <remove+0x4a>
+		return -E_BAD_PATH;
+  8050b0:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8050b5:	eb 44                	jmp    8050fb <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8050b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050bb:	48 89 c6             	mov    %rax,%rsi
+  8050be:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8050c5:	00 00 00 
+  8050c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050cc:	48 89 c7             	mov    %rax,%rdi
+  8050cf:	49 89 df             	mov    %rbx,%r15
+  8050d2:	48 b8 c3 6c ff ff ff 	movabs $0xffffffffffff6cc3,%rax
+  8050d9:	ff ff ff 
+  8050dc:	48 01 d8             	add    %rbx,%rax
+  8050df:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  8050e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8050e6:	bf 07 00 00 00       	mov    $0x7,%edi
+  8050eb:	48 b8 b3 98 ff ff ff 	movabs $0xffffffffffff98b3,%rax
+  8050f2:	ff ff ff 
+  8050f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050f9:	ff d0                	call   *%rax
+}
+  8050fb:	48 83 c4 10          	add    $0x10,%rsp
+  8050ff:	5b                   	pop    %rbx
+  805100:	41 5f                	pop    %r15
+  805102:	5d                   	pop    %rbp
+  805103:	c3                   	ret
+
+0000000000805104 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  805104:	55                   	push   %rbp
+  805105:	48 89 e5             	mov    %rsp,%rbp
+  805108:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805108 <sync+0x4>
+  80510f:	49 bb 38 5f 00 00 00 	movabs $0x5f38,%r11
+  805116:	00 00 00 
+  805119:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  80511c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805121:	be 00 00 00 00       	mov    $0x0,%esi
+  805126:	bf 08 00 00 00       	mov    $0x8,%edi
+  80512b:	48 b9 5b 99 ff ff ff 	movabs $0xffffffffffff995b,%rcx
+  805132:	ff ff ff 
+  805135:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805139:	ff d0                	call   *%rax
+}
+  80513b:	5d                   	pop    %rbp
+  80513c:	c3                   	ret
+
+000000000080513d <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  80513d:	55                   	push   %rbp
+  80513e:	48 89 e5             	mov    %rsp,%rbp
+  805141:	41 57                	push   %r15
+  805143:	53                   	push   %rbx
+  805144:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  80514b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80514b <copy+0xe>
+  805152:	49 bb f5 5e 00 00 00 	movabs $0x5ef5,%r11
+  805159:	00 00 00 
+  80515c:	4c 01 db             	add    %r11,%rbx
+  80515f:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  805166:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  80516d:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  805174:	be 00 00 00 00       	mov    $0x0,%esi
+  805179:	48 89 c7             	mov    %rax,%rdi
+  80517c:	48 b8 fa 9a ff ff ff 	movabs $0xffffffffffff9afa,%rax
+  805183:	ff ff ff 
+  805186:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80518a:	ff d0                	call   *%rax
+  80518c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  80518f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805193:	79 35                	jns    8051ca <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  805195:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805198:	89 c6                	mov    %eax,%esi
+  80519a:	48 b8 3e dc ff ff ff 	movabs $0xffffffffffffdc3e,%rax
+  8051a1:	ff ff ff 
+  8051a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051a8:	48 89 c7             	mov    %rax,%rdi
+  8051ab:	49 89 df             	mov    %rbx,%r15
+  8051ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051b3:	48 ba 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rdx
+  8051ba:	ff ff ff 
+  8051bd:	48 01 da             	add    %rbx,%rdx
+  8051c0:	ff d2                	call   *%rdx
+		return fd_src;
+  8051c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051c5:	e9 d7 01 00 00       	jmp    8053a1 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  8051ca:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  8051d1:	be 01 01 00 00       	mov    $0x101,%esi
+  8051d6:	48 89 c7             	mov    %rax,%rdi
+  8051d9:	48 b8 fa 9a ff ff ff 	movabs $0xffffffffffff9afa,%rax
+  8051e0:	ff ff ff 
+  8051e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051e7:	ff d0                	call   *%rax
+  8051e9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  8051ec:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8051f0:	0f 89 df 00 00 00    	jns    8052d5 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  8051f6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8051f9:	89 c6                	mov    %eax,%esi
+  8051fb:	48 b8 54 dc ff ff ff 	movabs $0xffffffffffffdc54,%rax
+  805202:	ff ff ff 
+  805205:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805209:	48 89 c7             	mov    %rax,%rdi
+  80520c:	49 89 df             	mov    %rbx,%r15
+  80520f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805214:	48 ba 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rdx
+  80521b:	ff ff ff 
+  80521e:	48 01 da             	add    %rbx,%rdx
+  805221:	ff d2                	call   *%rdx
+		close(fd_src);
+  805223:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805226:	89 c7                	mov    %eax,%edi
+  805228:	49 89 df             	mov    %rbx,%r15
+  80522b:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  805232:	ff ff ff 
+  805235:	48 01 d8             	add    %rbx,%rax
+  805238:	ff d0                	call   *%rax
+		return fd_dest;
+  80523a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80523d:	e9 5f 01 00 00       	jmp    8053a1 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  805242:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805245:	48 63 d0             	movslq %eax,%rdx
+  805248:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  80524f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805252:	48 89 ce             	mov    %rcx,%rsi
+  805255:	89 c7                	mov    %eax,%edi
+  805257:	49 89 df             	mov    %rbx,%r15
+  80525a:	48 b8 d1 94 ff ff ff 	movabs $0xffffffffffff94d1,%rax
+  805261:	ff ff ff 
+  805264:	48 01 d8             	add    %rbx,%rax
+  805267:	ff d0                	call   *%rax
+  805269:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  80526c:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  805270:	79 63                	jns    8052d5 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  805272:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805275:	89 c6                	mov    %eax,%esi
+  805277:	48 b8 6e dc ff ff ff 	movabs $0xffffffffffffdc6e,%rax
+  80527e:	ff ff ff 
+  805281:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805285:	48 89 c7             	mov    %rax,%rdi
+  805288:	49 89 df             	mov    %rbx,%r15
+  80528b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805290:	48 ba 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rdx
+  805297:	ff ff ff 
+  80529a:	48 01 da             	add    %rbx,%rdx
+  80529d:	ff d2                	call   *%rdx
+			close(fd_src);
+  80529f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052a2:	89 c7                	mov    %eax,%edi
+  8052a4:	49 89 df             	mov    %rbx,%r15
+  8052a7:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  8052ae:	ff ff ff 
+  8052b1:	48 01 d8             	add    %rbx,%rax
+  8052b4:	ff d0                	call   *%rax
+			close(fd_dest);
+  8052b6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8052b9:	89 c7                	mov    %eax,%edi
+  8052bb:	49 89 df             	mov    %rbx,%r15
+  8052be:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  8052c5:	ff ff ff 
+  8052c8:	48 01 d8             	add    %rbx,%rax
+  8052cb:	ff d0                	call   *%rax
+			return write_size;
+  8052cd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8052d0:	e9 cc 00 00 00       	jmp    8053a1 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  8052d5:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8052dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052df:	ba 00 02 00 00       	mov    $0x200,%edx
+  8052e4:	48 89 ce             	mov    %rcx,%rsi
+  8052e7:	89 c7                	mov    %eax,%edi
+  8052e9:	49 89 df             	mov    %rbx,%r15
+  8052ec:	48 b8 2b 93 ff ff ff 	movabs $0xffffffffffff932b,%rax
+  8052f3:	ff ff ff 
+  8052f6:	48 01 d8             	add    %rbx,%rax
+  8052f9:	ff d0                	call   *%rax
+  8052fb:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8052fe:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805302:	0f 8f 3a ff ff ff    	jg     805242 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  805308:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80530c:	79 60                	jns    80536e <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  80530e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805311:	89 c6                	mov    %eax,%esi
+  805313:	48 b8 81 dc ff ff ff 	movabs $0xffffffffffffdc81,%rax
+  80531a:	ff ff ff 
+  80531d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805321:	48 89 c7             	mov    %rax,%rdi
+  805324:	49 89 df             	mov    %rbx,%r15
+  805327:	b8 00 00 00 00       	mov    $0x0,%eax
+  80532c:	48 ba 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rdx
+  805333:	ff ff ff 
+  805336:	48 01 da             	add    %rbx,%rdx
+  805339:	ff d2                	call   *%rdx
+		close(fd_src);
+  80533b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80533e:	89 c7                	mov    %eax,%edi
+  805340:	49 89 df             	mov    %rbx,%r15
+  805343:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  80534a:	ff ff ff 
+  80534d:	48 01 d8             	add    %rbx,%rax
+  805350:	ff d0                	call   *%rax
+		close(fd_dest);
+  805352:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805355:	89 c7                	mov    %eax,%edi
+  805357:	49 89 df             	mov    %rbx,%r15
+  80535a:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  805361:	ff ff ff 
+  805364:	48 01 d8             	add    %rbx,%rax
+  805367:	ff d0                	call   *%rax
+		return read_size;
+  805369:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80536c:	eb 33                	jmp    8053a1 <copy+0x264>
+	}
+	close(fd_src);
+  80536e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805371:	89 c7                	mov    %eax,%edi
+  805373:	49 89 df             	mov    %rbx,%r15
+  805376:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  80537d:	ff ff ff 
+  805380:	48 01 d8             	add    %rbx,%rax
+  805383:	ff d0                	call   *%rax
+	close(fd_dest);
+  805385:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805388:	89 c7                	mov    %eax,%edi
+  80538a:	49 89 df             	mov    %rbx,%r15
+  80538d:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  805394:	ff ff ff 
+  805397:	48 01 d8             	add    %rbx,%rax
+  80539a:	ff d0                	call   *%rax
+	return 0;
+  80539c:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  8053a1:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  8053a8:	5b                   	pop    %rbx
+  8053a9:	41 5f                	pop    %r15
+  8053ab:	5d                   	pop    %rbp
+  8053ac:	c3                   	ret
+
+00000000008053ad <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8053ad:	55                   	push   %rbp
+  8053ae:	48 89 e5             	mov    %rsp,%rbp
+  8053b1:	41 57                	push   %r15
+  8053b3:	53                   	push   %rbx
+  8053b4:	48 81 ec 00 03 00 00 	sub    $0x300,%rsp
+  8053bb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053bb <spawn+0xe>
+  8053c2:	49 bb 85 5c 00 00 00 	movabs $0x5c85,%r11
+  8053c9:	00 00 00 
+  8053cc:	4c 01 db             	add    %r11,%rbx
+  8053cf:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  8053d6:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  8053dd:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  8053e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8053e9:	48 89 c7             	mov    %rax,%rdi
+  8053ec:	49 89 df             	mov    %rbx,%r15
+  8053ef:	48 b8 fa 9a ff ff ff 	movabs $0xffffffffffff9afa,%rax
+  8053f6:	ff ff ff 
+  8053f9:	48 01 d8             	add    %rbx,%rax
+  8053fc:	ff d0                	call   *%rax
+  8053fe:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805401:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805405:	79 08                	jns    80540f <spawn+0x62>
+		return r;
+  805407:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80540a:	e9 9e 04 00 00       	jmp    8058ad <spawn+0x500>
+	fd = r;
+  80540f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805412:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+  805415:	48 8d 85 c0 fd ff ff 	lea    -0x240(%rbp),%rax
+  80541c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  805420:	48 8d 8d c0 fd ff ff 	lea    -0x240(%rbp),%rcx
+  805427:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80542a:	ba 00 02 00 00       	mov    $0x200,%edx
+  80542f:	48 89 ce             	mov    %rcx,%rsi
+  805432:	89 c7                	mov    %eax,%edi
+  805434:	49 89 df             	mov    %rbx,%r15
+  805437:	48 b8 3e 94 ff ff ff 	movabs $0xffffffffffff943e,%rax
+  80543e:	ff ff ff 
+  805441:	48 01 d8             	add    %rbx,%rax
+  805444:	ff d0                	call   *%rax
+  805446:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80544b:	75 0d                	jne    80545a <spawn+0xad>
+            || elf->e_magic != ELF_MAGIC) {
+  80544d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805451:	8b 00                	mov    (%rax),%eax
+  805453:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  805458:	74 56                	je     8054b0 <spawn+0x103>
+		close(fd);
+  80545a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80545d:	89 c7                	mov    %eax,%edi
+  80545f:	49 89 df             	mov    %rbx,%r15
+  805462:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  805469:	ff ff ff 
+  80546c:	48 01 d8             	add    %rbx,%rax
+  80546f:	ff d0                	call   *%rax
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  805471:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805475:	8b 00                	mov    (%rax),%eax
+  805477:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  80547c:	89 c6                	mov    %eax,%esi
+  80547e:	48 b8 98 dc ff ff ff 	movabs $0xffffffffffffdc98,%rax
+  805485:	ff ff ff 
+  805488:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80548c:	48 89 c7             	mov    %rax,%rdi
+  80548f:	49 89 df             	mov    %rbx,%r15
+  805492:	b8 00 00 00 00       	mov    $0x0,%eax
+  805497:	48 b9 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%rcx
+  80549e:	ff ff ff 
+  8054a1:	48 01 d9             	add    %rbx,%rcx
+  8054a4:	ff d1                	call   *%rcx
+		return -E_NOT_EXEC;
+  8054a6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8054ab:	e9 fd 03 00 00       	jmp    8058ad <spawn+0x500>
+	__asm __volatile("int %2"
+  8054b0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8054b5:	cd 30                	int    $0x30
+  8054b7:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	return ret;
+  8054ba:	8b 45 c0             	mov    -0x40(%rbp),%eax
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8054bd:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8054c0:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8054c4:	79 08                	jns    8054ce <spawn+0x121>
+		return r;
+  8054c6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8054c9:	e9 df 03 00 00       	jmp    8058ad <spawn+0x500>
+	child = r;
+  8054ce:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8054d1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  8054d4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8054d7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8054dc:	89 c1                	mov    %eax,%ecx
+  8054de:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  8054e5:	ff ff ff 
+  8054e8:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  8054ec:	48 63 c1             	movslq %ecx,%rax
+  8054ef:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8054f6:	48 01 d0             	add    %rdx,%rax
+  8054f9:	48 8b 30             	mov    (%rax),%rsi
+  8054fc:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  805500:	48 89 b5 00 fd ff ff 	mov    %rsi,-0x300(%rbp)
+  805507:	48 89 bd 08 fd ff ff 	mov    %rdi,-0x2f8(%rbp)
+  80550e:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  805512:	48 8b 78 18          	mov    0x18(%rax),%rdi
+  805516:	48 89 b5 10 fd ff ff 	mov    %rsi,-0x2f0(%rbp)
+  80551d:	48 89 bd 18 fd ff ff 	mov    %rdi,-0x2e8(%rbp)
+  805524:	48 8b 70 20          	mov    0x20(%rax),%rsi
+  805528:	48 8b 78 28          	mov    0x28(%rax),%rdi
+  80552c:	48 89 b5 20 fd ff ff 	mov    %rsi,-0x2e0(%rbp)
+  805533:	48 89 bd 28 fd ff ff 	mov    %rdi,-0x2d8(%rbp)
+  80553a:	48 8b 70 30          	mov    0x30(%rax),%rsi
+  80553e:	48 8b 78 38          	mov    0x38(%rax),%rdi
+  805542:	48 89 b5 30 fd ff ff 	mov    %rsi,-0x2d0(%rbp)
+  805549:	48 89 bd 38 fd ff ff 	mov    %rdi,-0x2c8(%rbp)
+  805550:	48 8b 70 40          	mov    0x40(%rax),%rsi
+  805554:	48 8b 78 48          	mov    0x48(%rax),%rdi
+  805558:	48 89 b5 40 fd ff ff 	mov    %rsi,-0x2c0(%rbp)
+  80555f:	48 89 bd 48 fd ff ff 	mov    %rdi,-0x2b8(%rbp)
+  805566:	48 8b 70 50          	mov    0x50(%rax),%rsi
+  80556a:	48 8b 78 58          	mov    0x58(%rax),%rdi
+  80556e:	48 89 b5 50 fd ff ff 	mov    %rsi,-0x2b0(%rbp)
+  805575:	48 89 bd 58 fd ff ff 	mov    %rdi,-0x2a8(%rbp)
+  80557c:	48 8b 70 60          	mov    0x60(%rax),%rsi
+  805580:	48 8b 78 68          	mov    0x68(%rax),%rdi
+  805584:	48 89 b5 60 fd ff ff 	mov    %rsi,-0x2a0(%rbp)
+  80558b:	48 89 bd 68 fd ff ff 	mov    %rdi,-0x298(%rbp)
+  805592:	48 8b 70 70          	mov    0x70(%rax),%rsi
+  805596:	48 8b 78 78          	mov    0x78(%rax),%rdi
+  80559a:	48 89 b5 70 fd ff ff 	mov    %rsi,-0x290(%rbp)
+  8055a1:	48 89 bd 78 fd ff ff 	mov    %rdi,-0x288(%rbp)
+  8055a8:	48 8b b0 80 00 00 00 	mov    0x80(%rax),%rsi
+  8055af:	48 8b b8 88 00 00 00 	mov    0x88(%rax),%rdi
+  8055b6:	48 89 b5 80 fd ff ff 	mov    %rsi,-0x280(%rbp)
+  8055bd:	48 89 bd 88 fd ff ff 	mov    %rdi,-0x278(%rbp)
+  8055c4:	48 8b b0 90 00 00 00 	mov    0x90(%rax),%rsi
+  8055cb:	48 8b b8 98 00 00 00 	mov    0x98(%rax),%rdi
+  8055d2:	48 89 b5 90 fd ff ff 	mov    %rsi,-0x270(%rbp)
+  8055d9:	48 89 bd 98 fd ff ff 	mov    %rdi,-0x268(%rbp)
+  8055e0:	48 8b b0 a0 00 00 00 	mov    0xa0(%rax),%rsi
+  8055e7:	48 8b b8 a8 00 00 00 	mov    0xa8(%rax),%rdi
+  8055ee:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  8055f5:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  8055fc:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  805603:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  80560a:	48 89 85 b0 fd ff ff 	mov    %rax,-0x250(%rbp)
+  805611:	48 89 95 b8 fd ff ff 	mov    %rdx,-0x248(%rbp)
+	child_tf.tf_rip = elf->e_entry;
+  805618:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80561c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  805620:	48 89 85 98 fd ff ff 	mov    %rax,-0x268(%rbp)
+
+	if ((r = init_stack(child, argv, &child_tf.tf_rsp)) < 0)
+  805627:	48 8d 85 00 fd ff ff 	lea    -0x300(%rbp),%rax
+  80562e:	48 8d 90 b0 00 00 00 	lea    0xb0(%rax),%rdx
+  805635:	48 8b 8d f0 fc ff ff 	mov    -0x310(%rbp),%rcx
+  80563c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80563f:	48 89 ce             	mov    %rcx,%rsi
+  805642:	89 c7                	mov    %eax,%edi
+  805644:	48 b8 fb aa ff ff ff 	movabs $0xffffffffffffaafb,%rax
+  80564b:	ff ff ff 
+  80564e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805652:	ff d0                	call   *%rax
+  805654:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805657:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80565b:	79 08                	jns    805665 <spawn+0x2b8>
+		return r;
+  80565d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805660:	e9 48 02 00 00       	jmp    8058ad <spawn+0x500>
+
+	// Set up program segments as defined in ELF header.
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  805665:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805669:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80566d:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  805674:	48 01 d0             	add    %rdx,%rax
+  805677:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80567b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805682:	e9 84 00 00 00       	jmp    80570b <spawn+0x35e>
+		if (ph->p_type != ELF_PROG_LOAD)
+  805687:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80568b:	8b 00                	mov    (%rax),%eax
+  80568d:	83 f8 01             	cmp    $0x1,%eax
+  805690:	75 6f                	jne    805701 <spawn+0x354>
+			continue;
+		perm = PTE_P | PTE_U;
+  805692:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%rbp)
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  805699:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80569d:	8b 40 04             	mov    0x4(%rax),%eax
+  8056a0:	83 e0 02             	and    $0x2,%eax
+  8056a3:	85 c0                	test   %eax,%eax
+  8056a5:	74 04                	je     8056ab <spawn+0x2fe>
+			perm |= PTE_W;
+  8056a7:	83 4d dc 02          	orl    $0x2,-0x24(%rbp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+				     fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  8056ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056af:	48 8b 40 08          	mov    0x8(%rax),%rax
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8056b3:	41 89 c1             	mov    %eax,%r9d
+  8056b6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056ba:	4c 8b 40 20          	mov    0x20(%rax),%r8
+  8056be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056c2:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  8056c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056ca:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  8056ce:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8056d1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8056d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8056d8:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8056db:	57                   	push   %rdi
+  8056dc:	89 c7                	mov    %eax,%edi
+  8056de:	48 b8 0d ae ff ff ff 	movabs $0xffffffffffffae0d,%rax
+  8056e5:	ff ff ff 
+  8056e8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056ec:	ff d0                	call   *%rax
+  8056ee:	48 83 c4 10          	add    $0x10,%rsp
+  8056f2:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8056f5:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8056f9:	0f 88 7c 01 00 00    	js     80587b <spawn+0x4ce>
+  8056ff:	eb 01                	jmp    805702 <spawn+0x355>
+			continue;
+  805701:	90                   	nop
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  805702:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805706:	48 83 45 e0 38       	addq   $0x38,-0x20(%rbp)
+  80570b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80570f:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  805713:	0f b7 c0             	movzwl %ax,%eax
+  805716:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805719:	0f 8c 68 ff ff ff    	jl     805687 <spawn+0x2da>
+			goto error;
+	}
+	close(fd);
+  80571f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805722:	89 c7                	mov    %eax,%edi
+  805724:	49 89 df             	mov    %rbx,%r15
+  805727:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  80572e:	ff ff ff 
+  805731:	48 01 d8             	add    %rbx,%rax
+  805734:	ff d0                	call   *%rax
+	fd = -1;
+  805736:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+	// Copy shared library state.
+	if ((r = copy_shared_pages(child)) < 0)
+  80573d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805740:	89 c7                	mov    %eax,%edi
+  805742:	48 b8 d4 b2 ff ff ff 	movabs $0xffffffffffffb2d4,%rax
+  805749:	ff ff ff 
+  80574c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805750:	ff d0                	call   *%rax
+  805752:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805755:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805759:	79 44                	jns    80579f <spawn+0x3f2>
+		panic("copy_shared_pages: %e", r);
+  80575b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80575e:	89 c1                	mov    %eax,%ecx
+  805760:	48 b8 b2 dc ff ff ff 	movabs $0xffffffffffffdcb2,%rax
+  805767:	ff ff ff 
+  80576a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80576e:	48 89 c2             	mov    %rax,%rdx
+  805771:	be 82 00 00 00       	mov    $0x82,%esi
+  805776:	48 b8 c8 dc ff ff ff 	movabs $0xffffffffffffdcc8,%rax
+  80577d:	ff ff ff 
+  805780:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805784:	48 89 c7             	mov    %rax,%rdi
+  805787:	49 89 df             	mov    %rbx,%r15
+  80578a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80578f:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  805796:	ff ff ff 
+  805799:	49 01 d8             	add    %rbx,%r8
+  80579c:	41 ff d0             	call   *%r8
+
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  80579f:	48 8d 95 00 fd ff ff 	lea    -0x300(%rbp),%rdx
+  8057a6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8057a9:	48 89 d6             	mov    %rdx,%rsi
+  8057ac:	89 c7                	mov    %eax,%edi
+  8057ae:	49 89 df             	mov    %rbx,%r15
+  8057b1:	48 b8 16 7b ff ff ff 	movabs $0xffffffffffff7b16,%rax
+  8057b8:	ff ff ff 
+  8057bb:	48 01 d8             	add    %rbx,%rax
+  8057be:	ff d0                	call   *%rax
+  8057c0:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8057c3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8057c7:	79 44                	jns    80580d <spawn+0x460>
+		panic("sys_env_set_trapframe: %e", r);
+  8057c9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8057cc:	89 c1                	mov    %eax,%ecx
+  8057ce:	48 b8 d4 dc ff ff ff 	movabs $0xffffffffffffdcd4,%rax
+  8057d5:	ff ff ff 
+  8057d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057dc:	48 89 c2             	mov    %rax,%rdx
+  8057df:	be 85 00 00 00       	mov    $0x85,%esi
+  8057e4:	48 b8 c8 dc ff ff ff 	movabs $0xffffffffffffdcc8,%rax
+  8057eb:	ff ff ff 
+  8057ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057f2:	48 89 c7             	mov    %rax,%rdi
+  8057f5:	49 89 df             	mov    %rbx,%r15
+  8057f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057fd:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  805804:	ff ff ff 
+  805807:	49 01 d8             	add    %rbx,%r8
+  80580a:	41 ff d0             	call   *%r8
+
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80580d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805810:	be 02 00 00 00       	mov    $0x2,%esi
+  805815:	89 c7                	mov    %eax,%edi
+  805817:	49 89 df             	mov    %rbx,%r15
+  80581a:	48 b8 b6 7a ff ff ff 	movabs $0xffffffffffff7ab6,%rax
+  805821:	ff ff ff 
+  805824:	48 01 d8             	add    %rbx,%rax
+  805827:	ff d0                	call   *%rax
+  805829:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80582c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805830:	79 44                	jns    805876 <spawn+0x4c9>
+		panic("sys_env_set_status: %e", r);
+  805832:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805835:	89 c1                	mov    %eax,%ecx
+  805837:	48 b8 ee dc ff ff ff 	movabs $0xffffffffffffdcee,%rax
+  80583e:	ff ff ff 
+  805841:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805845:	48 89 c2             	mov    %rax,%rdx
+  805848:	be 88 00 00 00       	mov    $0x88,%esi
+  80584d:	48 b8 c8 dc ff ff ff 	movabs $0xffffffffffffdcc8,%rax
+  805854:	ff ff ff 
+  805857:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80585b:	48 89 c7             	mov    %rax,%rdi
+  80585e:	49 89 df             	mov    %rbx,%r15
+  805861:	b8 00 00 00 00       	mov    $0x0,%eax
+  805866:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  80586d:	ff ff ff 
+  805870:	49 01 d8             	add    %rbx,%r8
+  805873:	41 ff d0             	call   *%r8
+
+	return child;
+  805876:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805879:	eb 32                	jmp    8058ad <spawn+0x500>
+			goto error;
+  80587b:	90                   	nop
+
+error:
+	sys_env_destroy(child);
+  80587c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80587f:	89 c7                	mov    %eax,%edi
+  805881:	49 89 df             	mov    %rbx,%r15
+  805884:	48 b8 7a 78 ff ff ff 	movabs $0xffffffffffff787a,%rax
+  80588b:	ff ff ff 
+  80588e:	48 01 d8             	add    %rbx,%rax
+  805891:	ff d0                	call   *%rax
+	close(fd);
+  805893:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805896:	89 c7                	mov    %eax,%edi
+  805898:	49 89 df             	mov    %rbx,%r15
+  80589b:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  8058a2:	ff ff ff 
+  8058a5:	48 01 d8             	add    %rbx,%rax
+  8058a8:	ff d0                	call   *%rax
+	return r;
+  8058aa:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+  8058ad:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8058b1:	5b                   	pop    %rbx
+  8058b2:	41 5f                	pop    %r15
+  8058b4:	5d                   	pop    %rbp
+  8058b5:	c3                   	ret
+
+00000000008058b6 <spawnl>:
+// Spawn, taking command-line arguments array directly on the stack.
+// NOTE: Must have a sentinal of NULL at the end of the args
+// (none of the args may be NULL).
+int
+spawnl(const char *prog, const char *arg0, ...)
+{
+  8058b6:	55                   	push   %rbp
+  8058b7:	48 89 e5             	mov    %rsp,%rbp
+  8058ba:	41 57                	push   %r15
+  8058bc:	41 56                	push   %r14
+  8058be:	41 55                	push   %r13
+  8058c0:	41 54                	push   %r12
+  8058c2:	53                   	push   %rbx
+  8058c3:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8058ca:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8058ca <spawnl+0x14>
+  8058d1:	49 bb 76 57 00 00 00 	movabs $0x5776,%r11
+  8058d8:	00 00 00 
+  8058db:	4d 01 da             	add    %r11,%r10
+  8058de:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8058e5:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  8058ec:	48 89 95 30 ff ff ff 	mov    %rdx,-0xd0(%rbp)
+  8058f3:	48 89 8d 38 ff ff ff 	mov    %rcx,-0xc8(%rbp)
+  8058fa:	4c 89 85 40 ff ff ff 	mov    %r8,-0xc0(%rbp)
+  805901:	4c 89 8d 48 ff ff ff 	mov    %r9,-0xb8(%rbp)
+  805908:	84 c0                	test   %al,%al
+  80590a:	74 29                	je     805935 <spawnl+0x7f>
+  80590c:	0f 29 85 50 ff ff ff 	movaps %xmm0,-0xb0(%rbp)
+  805913:	0f 29 8d 60 ff ff ff 	movaps %xmm1,-0xa0(%rbp)
+  80591a:	0f 29 95 70 ff ff ff 	movaps %xmm2,-0x90(%rbp)
+  805921:	0f 29 5d 80          	movaps %xmm3,-0x80(%rbp)
+  805925:	0f 29 65 90          	movaps %xmm4,-0x70(%rbp)
+  805929:	0f 29 6d a0          	movaps %xmm5,-0x60(%rbp)
+  80592d:	0f 29 75 b0          	movaps %xmm6,-0x50(%rbp)
+  805931:	0f 29 7d c0          	movaps %xmm7,-0x40(%rbp)
+  805935:	48 89 e0             	mov    %rsp,%rax
+  805938:	48 89 c3             	mov    %rax,%rbx
+	// We calculate argc by advancing the args until we hit NULL.
+	// The contract of the function guarantees that the last
+	// argument will always be NULL, and that none of the other
+	// arguments will be NULL.
+	int argc=0;
+  80593b:	c7 85 1c ff ff ff 00 	movl   $0x0,-0xe4(%rbp)
+  805942:	00 00 00 
+	va_list vl;
+	va_start(vl, arg0);
+  805945:	c7 85 f0 fe ff ff 10 	movl   $0x10,-0x110(%rbp)
+  80594c:	00 00 00 
+  80594f:	c7 85 f4 fe ff ff 30 	movl   $0x30,-0x10c(%rbp)
+  805956:	00 00 00 
+  805959:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80595d:	48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+  805964:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  80596b:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+	while(va_arg(vl, void *) != NULL)
+  805972:	eb 07                	jmp    80597b <spawnl+0xc5>
+		argc++;
+  805974:	83 85 1c ff ff ff 01 	addl   $0x1,-0xe4(%rbp)
+	while(va_arg(vl, void *) != NULL)
+  80597b:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  805981:	83 f8 2f             	cmp    $0x2f,%eax
+  805984:	77 23                	ja     8059a9 <spawnl+0xf3>
+  805986:	48 8b 85 00 ff ff ff 	mov    -0x100(%rbp),%rax
+  80598d:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  805993:	89 d2                	mov    %edx,%edx
+  805995:	48 01 d0             	add    %rdx,%rax
+  805998:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  80599e:	83 c2 08             	add    $0x8,%edx
+  8059a1:	89 95 f0 fe ff ff    	mov    %edx,-0x110(%rbp)
+  8059a7:	eb 12                	jmp    8059bb <spawnl+0x105>
+  8059a9:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8059b0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8059b4:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8059bb:	48 8b 00             	mov    (%rax),%rax
+  8059be:	48 85 c0             	test   %rax,%rax
+  8059c1:	75 b1                	jne    805974 <spawnl+0xbe>
+	va_end(vl);
+
+	// Now that we have the size of the args, do a second pass
+	// and store the values in a VLA, which has the format of argv
+	const char *argv[argc+2];
+  8059c3:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  8059c9:	83 c0 02             	add    $0x2,%eax
+  8059cc:	48 63 d0             	movslq %eax,%rdx
+  8059cf:	48 83 ea 01          	sub    $0x1,%rdx
+  8059d3:	48 89 95 10 ff ff ff 	mov    %rdx,-0xf0(%rbp)
+  8059da:	48 63 d0             	movslq %eax,%rdx
+  8059dd:	49 89 d6             	mov    %rdx,%r14
+  8059e0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8059e6:	48 63 d0             	movslq %eax,%rdx
+  8059e9:	49 89 d4             	mov    %rdx,%r12
+  8059ec:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8059f2:	48 98                	cltq
+  8059f4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8059fb:	00 
+  8059fc:	b8 10 00 00 00       	mov    $0x10,%eax
+  805a01:	48 83 e8 01          	sub    $0x1,%rax
+  805a05:	48 01 d0             	add    %rdx,%rax
+  805a08:	be 10 00 00 00       	mov    $0x10,%esi
+  805a0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a12:	48 f7 f6             	div    %rsi
+  805a15:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  805a19:	48 29 c4             	sub    %rax,%rsp
+  805a1c:	48 89 e0             	mov    %rsp,%rax
+  805a1f:	48 83 c0 07          	add    $0x7,%rax
+  805a23:	48 c1 e8 03          	shr    $0x3,%rax
+  805a27:	48 c1 e0 03          	shl    $0x3,%rax
+  805a2b:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+	argv[0] = arg0;
+  805a32:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805a39:	48 8b 95 e0 fe ff ff 	mov    -0x120(%rbp),%rdx
+  805a40:	48 89 10             	mov    %rdx,(%rax)
+	argv[argc+1] = NULL;
+  805a43:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  805a49:	8d 50 01             	lea    0x1(%rax),%edx
+  805a4c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805a53:	48 63 d2             	movslq %edx,%rdx
+  805a56:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  805a5d:	00 
+
+	va_start(vl, arg0);
+  805a5e:	c7 85 f0 fe ff ff 10 	movl   $0x10,-0x110(%rbp)
+  805a65:	00 00 00 
+  805a68:	c7 85 f4 fe ff ff 30 	movl   $0x30,-0x10c(%rbp)
+  805a6f:	00 00 00 
+  805a72:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805a76:	48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+  805a7d:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  805a84:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+	unsigned i;
+	for(i=0;i<argc;i++)
+  805a8b:	c7 85 18 ff ff ff 00 	movl   $0x0,-0xe8(%rbp)
+  805a92:	00 00 00 
+  805a95:	eb 60                	jmp    805af7 <spawnl+0x241>
+		argv[i+1] = va_arg(vl, const char *);
+  805a97:	8b 85 18 ff ff ff    	mov    -0xe8(%rbp),%eax
+  805a9d:	8d 48 01             	lea    0x1(%rax),%ecx
+  805aa0:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  805aa6:	83 f8 2f             	cmp    $0x2f,%eax
+  805aa9:	77 23                	ja     805ace <spawnl+0x218>
+  805aab:	48 8b 85 00 ff ff ff 	mov    -0x100(%rbp),%rax
+  805ab2:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  805ab8:	89 d2                	mov    %edx,%edx
+  805aba:	48 01 d0             	add    %rdx,%rax
+  805abd:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  805ac3:	83 c2 08             	add    $0x8,%edx
+  805ac6:	89 95 f0 fe ff ff    	mov    %edx,-0x110(%rbp)
+  805acc:	eb 12                	jmp    805ae0 <spawnl+0x22a>
+  805ace:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  805ad5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  805ad9:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  805ae0:	48 8b 10             	mov    (%rax),%rdx
+  805ae3:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805aea:	89 c9                	mov    %ecx,%ecx
+  805aec:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+	for(i=0;i<argc;i++)
+  805af0:	83 85 18 ff ff ff 01 	addl   $0x1,-0xe8(%rbp)
+  805af7:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  805afd:	39 85 18 ff ff ff    	cmp    %eax,-0xe8(%rbp)
+  805b03:	72 92                	jb     805a97 <spawnl+0x1e1>
+	va_end(vl);
+	return spawn(prog, argv);
+  805b05:	48 8b 95 08 ff ff ff 	mov    -0xf8(%rbp),%rdx
+  805b0c:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  805b13:	48 89 d6             	mov    %rdx,%rsi
+  805b16:	48 89 c7             	mov    %rax,%rdi
+  805b19:	48 b8 6d a3 ff ff ff 	movabs $0xffffffffffffa36d,%rax
+  805b20:	ff ff ff 
+  805b23:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  805b27:	ff d0                	call   *%rax
+  805b29:	48 89 dc             	mov    %rbx,%rsp
+}
+  805b2c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  805b30:	5b                   	pop    %rbx
+  805b31:	41 5c                	pop    %r12
+  805b33:	41 5d                	pop    %r13
+  805b35:	41 5e                	pop    %r14
+  805b37:	41 5f                	pop    %r15
+  805b39:	5d                   	pop    %rbp
+  805b3a:	c3                   	ret
+
+0000000000805b3b <init_stack>:
+// On success, returns 0 and sets *init_esp
+// to the initial stack pointer with which the child should start.
+// Returns < 0 on failure.
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_esp)
+{
+  805b3b:	55                   	push   %rbp
+  805b3c:	48 89 e5             	mov    %rsp,%rbp
+  805b3f:	41 57                	push   %r15
+  805b41:	53                   	push   %rbx
+  805b42:	48 83 ec 50          	sub    $0x50,%rsp
+  805b46:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b46 <init_stack+0xb>
+  805b4d:	49 bb fa 54 00 00 00 	movabs $0x54fa,%r11
+  805b54:	00 00 00 
+  805b57:	4c 01 db             	add    %r11,%rbx
+  805b5a:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  805b5d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  805b61:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	char *string_store;
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+  805b65:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805b6c:	00 
+	for (argc = 0; argv[argc] != 0; argc++)
+  805b6d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  805b74:	eb 39                	jmp    805baf <init_stack+0x74>
+		string_size += strlen(argv[argc]) + 1;
+  805b76:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805b79:	48 98                	cltq
+  805b7b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  805b82:	00 
+  805b83:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805b87:	48 01 d0             	add    %rdx,%rax
+  805b8a:	48 8b 00             	mov    (%rax),%rax
+  805b8d:	48 89 c7             	mov    %rax,%rdi
+  805b90:	49 89 df             	mov    %rbx,%r15
+  805b93:	48 b8 2f 6c ff ff ff 	movabs $0xffffffffffff6c2f,%rax
+  805b9a:	ff ff ff 
+  805b9d:	48 01 d8             	add    %rbx,%rax
+  805ba0:	ff d0                	call   *%rax
+  805ba2:	83 c0 01             	add    $0x1,%eax
+  805ba5:	48 98                	cltq
+  805ba7:	48 01 45 e8          	add    %rax,-0x18(%rbp)
+	for (argc = 0; argv[argc] != 0; argc++)
+  805bab:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  805baf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805bb2:	48 98                	cltq
+  805bb4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  805bbb:	00 
+  805bbc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805bc0:	48 01 d0             	add    %rdx,%rax
+  805bc3:	48 8b 00             	mov    (%rax),%rax
+  805bc6:	48 85 c0             	test   %rax,%rax
+  805bc9:	75 ab                	jne    805b76 <init_stack+0x3b>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  805bcb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bcf:	48 f7 d8             	neg    %rax
+  805bd2:	48 05 00 10 40 00    	add    $0x401000,%rax
+  805bd8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 8) - 8 * (argc + 1));
+  805bdc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805be0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805be4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805be8:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  805bec:	48 89 c2             	mov    %rax,%rdx
+  805bef:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805bf2:	83 c0 01             	add    $0x1,%eax
+  805bf5:	c1 e0 03             	shl    $0x3,%eax
+  805bf8:	48 98                	cltq
+  805bfa:	48 f7 d8             	neg    %rax
+  805bfd:	48 01 d0             	add    %rdx,%rax
+  805c00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  805c04:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805c08:	48 83 e8 10          	sub    $0x10,%rax
+  805c0c:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  805c12:	77 0a                	ja     805c1e <init_stack+0xe3>
+		return -E_NO_MEM;
+  805c14:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  805c19:	e9 26 02 00 00       	jmp    805e44 <init_stack+0x309>
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  805c1e:	ba 07 00 00 00       	mov    $0x7,%edx
+  805c23:	be 00 00 40 00       	mov    $0x400000,%esi
+  805c28:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c2d:	49 89 df             	mov    %rbx,%r15
+  805c30:	48 b8 7f 79 ff ff ff 	movabs $0xffffffffffff797f,%rax
+  805c37:	ff ff ff 
+  805c3a:	48 01 d8             	add    %rbx,%rax
+  805c3d:	ff d0                	call   *%rax
+  805c3f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  805c42:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805c46:	79 08                	jns    805c50 <init_stack+0x115>
+		return r;
+  805c48:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c4b:	e9 f4 01 00 00       	jmp    805e44 <init_stack+0x309>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  805c50:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+  805c57:	e9 96 00 00 00       	jmp    805cf2 <init_stack+0x1b7>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  805c5c:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  805c61:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c65:	48 01 d0             	add    %rdx,%rax
+  805c68:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  805c6f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c72:	48 98                	cltq
+  805c74:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  805c7b:	00 
+  805c7c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805c80:	48 01 c8             	add    %rcx,%rax
+  805c83:	48 89 10             	mov    %rdx,(%rax)
+		strcpy(string_store, argv[i]);
+  805c86:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c89:	48 98                	cltq
+  805c8b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  805c92:	00 
+  805c93:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805c97:	48 01 d0             	add    %rdx,%rax
+  805c9a:	48 8b 10             	mov    (%rax),%rdx
+  805c9d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805ca1:	48 89 d6             	mov    %rdx,%rsi
+  805ca4:	48 89 c7             	mov    %rax,%rdi
+  805ca7:	49 89 df             	mov    %rbx,%r15
+  805caa:	48 b8 c3 6c ff ff ff 	movabs $0xffffffffffff6cc3,%rax
+  805cb1:	ff ff ff 
+  805cb4:	48 01 d8             	add    %rbx,%rax
+  805cb7:	ff d0                	call   *%rax
+		string_store += strlen(argv[i]) + 1;
+  805cb9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805cbc:	48 98                	cltq
+  805cbe:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  805cc5:	00 
+  805cc6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805cca:	48 01 d0             	add    %rdx,%rax
+  805ccd:	48 8b 00             	mov    (%rax),%rax
+  805cd0:	48 89 c7             	mov    %rax,%rdi
+  805cd3:	49 89 df             	mov    %rbx,%r15
+  805cd6:	48 b8 2f 6c ff ff ff 	movabs $0xffffffffffff6c2f,%rax
+  805cdd:	ff ff ff 
+  805ce0:	48 01 d8             	add    %rbx,%rax
+  805ce3:	ff d0                	call   *%rax
+  805ce5:	83 c0 01             	add    $0x1,%eax
+  805ce8:	48 98                	cltq
+  805cea:	48 01 45 d0          	add    %rax,-0x30(%rbp)
+	for (i = 0; i < argc; i++) {
+  805cee:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+  805cf2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805cf5:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  805cf8:	0f 8c 5e ff ff ff    	jl     805c5c <init_stack+0x121>
+	}
+	argv_store[argc] = 0;
+  805cfe:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805d01:	48 98                	cltq
+  805d03:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  805d0a:	00 
+  805d0b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d0f:	48 01 d0             	add    %rdx,%rax
+  805d12:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  805d19:	48 81 7d d0 00 10 40 	cmpq   $0x401000,-0x30(%rbp)
+  805d20:	00 
+  805d21:	74 50                	je     805d73 <init_stack+0x238>
+  805d23:	48 b8 08 dd ff ff ff 	movabs $0xffffffffffffdd08,%rax
+  805d2a:	ff ff ff 
+  805d2d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d31:	48 89 c1             	mov    %rax,%rcx
+  805d34:	48 b8 2e dd ff ff ff 	movabs $0xffffffffffffdd2e,%rax
+  805d3b:	ff ff ff 
+  805d3e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d42:	48 89 c2             	mov    %rax,%rdx
+  805d45:	be f1 00 00 00       	mov    $0xf1,%esi
+  805d4a:	48 b8 c8 dc ff ff ff 	movabs $0xffffffffffffdcc8,%rax
+  805d51:	ff ff ff 
+  805d54:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d58:	48 89 c7             	mov    %rax,%rdi
+  805d5b:	49 89 df             	mov    %rbx,%r15
+  805d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d63:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  805d6a:	ff ff ff 
+  805d6d:	49 01 d8             	add    %rbx,%r8
+  805d70:	41 ff d0             	call   *%r8
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  805d73:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  805d78:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d7c:	48 01 d0             	add    %rdx,%rax
+  805d7f:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  805d86:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d8a:	48 83 e8 08          	sub    $0x8,%rax
+  805d8e:	48 89 10             	mov    %rdx,(%rax)
+	argv_store[-2] = argc;
+  805d91:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d95:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  805d99:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805d9c:	48 98                	cltq
+  805d9e:	48 89 02             	mov    %rax,(%rdx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  805da1:	ba f0 cf 7f ef       	mov    $0xef7fcff0,%edx
+  805da6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805daa:	48 01 d0             	add    %rdx,%rax
+  805dad:	48 2d 00 00 40 00    	sub    $0x400000,%rax
+  805db3:	48 89 c2             	mov    %rax,%rdx
+  805db6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805dba:	48 89 10             	mov    %rdx,(%rax)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  805dbd:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805dc0:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  805dc6:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  805dcb:	48 89 d1             	mov    %rdx,%rcx
+  805dce:	89 c2                	mov    %eax,%edx
+  805dd0:	be 00 00 40 00       	mov    $0x400000,%esi
+  805dd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  805dda:	49 89 df             	mov    %rbx,%r15
+  805ddd:	48 b8 e4 79 ff ff ff 	movabs $0xffffffffffff79e4,%rax
+  805de4:	ff ff ff 
+  805de7:	48 01 d8             	add    %rbx,%rax
+  805dea:	ff d0                	call   *%rax
+  805dec:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  805def:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805df3:	78 2c                	js     805e21 <init_stack+0x2e6>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  805df5:	be 00 00 40 00       	mov    $0x400000,%esi
+  805dfa:	bf 00 00 00 00       	mov    $0x0,%edi
+  805dff:	49 89 df             	mov    %rbx,%r15
+  805e02:	48 b8 57 7a ff ff ff 	movabs $0xffffffffffff7a57,%rax
+  805e09:	ff ff ff 
+  805e0c:	48 01 d8             	add    %rbx,%rax
+  805e0f:	ff d0                	call   *%rax
+  805e11:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  805e14:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805e18:	78 0a                	js     805e24 <init_stack+0x2e9>
+		goto error;
+
+	return 0;
+  805e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e1f:	eb 23                	jmp    805e44 <init_stack+0x309>
+		goto error;
+  805e21:	90                   	nop
+  805e22:	eb 01                	jmp    805e25 <init_stack+0x2ea>
+		goto error;
+  805e24:	90                   	nop
+
+error:
+	sys_page_unmap(0, UTEMP);
+  805e25:	be 00 00 40 00       	mov    $0x400000,%esi
+  805e2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e2f:	49 89 df             	mov    %rbx,%r15
+  805e32:	48 b8 57 7a ff ff ff 	movabs $0xffffffffffff7a57,%rax
+  805e39:	ff ff ff 
+  805e3c:	48 01 d8             	add    %rbx,%rax
+  805e3f:	ff d0                	call   *%rax
+	return r;
+  805e41:	8b 45 dc             	mov    -0x24(%rbp),%eax
+}
+  805e44:	48 83 c4 50          	add    $0x50,%rsp
+  805e48:	5b                   	pop    %rbx
+  805e49:	41 5f                	pop    %r15
+  805e4b:	5d                   	pop    %rbp
+  805e4c:	c3                   	ret
+
+0000000000805e4d <map_segment>:
+#define SEG_BATCH	PAGE_BATCH_CHUNK
+
+static int
+map_segment(envid_t child, uintptr_t va, size_t memsz,
+	    int fd, size_t filesz, off_t fileoffset, int perm)
+{
+  805e4d:	55                   	push   %rbp
+  805e4e:	48 89 e5             	mov    %rsp,%rbp
+  805e51:	41 57                	push   %r15
+  805e53:	53                   	push   %rbx
+  805e54:	48 81 ec 70 0c 00 00 	sub    $0xc70,%rsp
+  805e5b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e5b <map_segment+0xe>
+  805e62:	49 bb e5 51 00 00 00 	movabs $0x51e5,%r11
+  805e69:	00 00 00 
+  805e6c:	4c 01 db             	add    %r11,%rbx
+  805e6f:	89 bd ac f3 ff ff    	mov    %edi,-0xc54(%rbp)
+  805e75:	48 89 b5 a0 f3 ff ff 	mov    %rsi,-0xc60(%rbp)
+  805e7c:	48 89 95 98 f3 ff ff 	mov    %rdx,-0xc68(%rbp)
+  805e83:	89 8d a8 f3 ff ff    	mov    %ecx,-0xc58(%rbp)
+  805e89:	4c 89 85 90 f3 ff ff 	mov    %r8,-0xc70(%rbp)
+  805e90:	44 89 8d 8c f3 ff ff 	mov    %r9d,-0xc74(%rbp)
+	int i, j, n, nfile, r;
+	void *tmp;
+
+	//cprintf("map_segment %x+%x\n", va, memsz);
+
+	if ((i = PGOFF(va))) {
+  805e97:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  805e9e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  805ea3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ea6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805eaa:	74 2d                	je     805ed9 <map_segment+0x8c>
+		va -= i;
+  805eac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805eaf:	48 98                	cltq
+  805eb1:	48 29 85 a0 f3 ff ff 	sub    %rax,-0xc60(%rbp)
+		memsz += i;
+  805eb8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ebb:	48 98                	cltq
+  805ebd:	48 01 85 98 f3 ff ff 	add    %rax,-0xc68(%rbp)
+		filesz += i;
+  805ec4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ec7:	48 98                	cltq
+  805ec9:	48 01 85 90 f3 ff ff 	add    %rax,-0xc70(%rbp)
+		fileoffset -= i;
+  805ed0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ed3:	29 85 8c f3 ff ff    	sub    %eax,-0xc74(%rbp)
+	}
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  805ed9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805ee0:	e9 db 03 00 00       	jmp    8062c0 <map_segment+0x473>
+		n = MIN((memsz - i + PGSIZE - 1) / PGSIZE, SEG_BATCH);
+  805ee5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ee8:	48 98                	cltq
+  805eea:	48 8b 95 98 f3 ff ff 	mov    -0xc68(%rbp),%rdx
+  805ef1:	48 29 c2             	sub    %rax,%rdx
+  805ef4:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  805efb:	48 c1 e8 0c          	shr    $0xc,%rax
+  805eff:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  805f03:	c7 45 d4 20 00 00 00 	movl   $0x20,-0x2c(%rbp)
+  805f0a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805f0d:	48 63 d0             	movslq %eax,%rdx
+  805f10:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f14:	48 39 c2             	cmp    %rax,%rdx
+  805f17:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805f1b:	89 45 d0             	mov    %eax,-0x30(%rbp)
+
+		// Allocate blank pages straight into the child, and pages
+		// for the file's contents at UTEMP in our address space.
+		nfile = 0;
+  805f1e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+		for (j = 0; j < n; j++) {
+  805f25:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  805f2c:	e9 ea 01 00 00       	jmp    80611b <map_segment+0x2ce>
+			if (i + j * PGSIZE < filesz) {
+  805f31:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805f34:	c1 e0 0c             	shl    $0xc,%eax
+  805f37:	89 c2                	mov    %eax,%edx
+  805f39:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f3c:	01 d0                	add    %edx,%eax
+  805f3e:	48 98                	cltq
+  805f40:	48 3b 85 90 f3 ff ff 	cmp    -0xc70(%rbp),%rax
+  805f47:	0f 83 57 01 00 00    	jae    8060a4 <map_segment+0x257>
+				tmp = UTEMP + nfile * PGSIZE;
+  805f4d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f50:	c1 e0 0c             	shl    $0xc,%eax
+  805f53:	48 98                	cltq
+  805f55:	48 05 00 00 40 00    	add    $0x400000,%rax
+  805f5b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+				alloc[j].dstenvid = 0;
+  805f5f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805f62:	48 98                	cltq
+  805f64:	48 c1 e0 05          	shl    $0x5,%rax
+  805f68:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805f6c:	48 01 e8             	add    %rbp,%rax
+  805f6f:	48 2d 3c 04 00 00    	sub    $0x43c,%rax
+  805f75:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				alloc[j].dstva = (uintptr_t) tmp;
+  805f7b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805f7f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805f82:	48 63 d2             	movslq %edx,%rdx
+  805f85:	48 c1 e2 05          	shl    $0x5,%rdx
+  805f89:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  805f8d:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  805f91:	48 81 ea 30 04 00 00 	sub    $0x430,%rdx
+  805f98:	48 89 02             	mov    %rax,(%rdx)
+				alloc[j].perm = PTE_P|PTE_U|PTE_W;
+  805f9b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805f9e:	48 98                	cltq
+  805fa0:	48 c1 e0 05          	shl    $0x5,%rax
+  805fa4:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805fa8:	48 01 e8             	add    %rbp,%rax
+  805fab:	48 2d 28 04 00 00    	sub    $0x428,%rax
+  805fb1:	c7 00 07 00 00 00    	movl   $0x7,(%rax)
+				map[nfile].srcenvid = 0;
+  805fb7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805fba:	48 98                	cltq
+  805fbc:	48 c1 e0 05          	shl    $0x5,%rax
+  805fc0:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805fc4:	48 01 e8             	add    %rbp,%rax
+  805fc7:	48 2d 40 08 00 00    	sub    $0x840,%rax
+  805fcd:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				map[nfile].srcva = (uintptr_t) tmp;
+  805fd3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805fd7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805fda:	48 63 d2             	movslq %edx,%rdx
+  805fdd:	48 c1 e2 05          	shl    $0x5,%rdx
+  805fe1:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  805fe5:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  805fe9:	48 81 ea 38 08 00 00 	sub    $0x838,%rdx
+  805ff0:	48 89 02             	mov    %rax,(%rdx)
+				map[nfile].dstenvid = child;
+  805ff3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805ff6:	48 98                	cltq
+  805ff8:	48 c1 e0 05          	shl    $0x5,%rax
+  805ffc:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806000:	48 01 e8             	add    %rbp,%rax
+  806003:	48 8d 90 c4 f7 ff ff 	lea    -0x83c(%rax),%rdx
+  80600a:	8b 85 ac f3 ff ff    	mov    -0xc54(%rbp),%eax
+  806010:	89 02                	mov    %eax,(%rdx)
+				map[nfile].dstva = va + i + j * PGSIZE;
+  806012:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806015:	48 63 d0             	movslq %eax,%rdx
+  806018:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  80601f:	48 01 c2             	add    %rax,%rdx
+  806022:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806025:	c1 e0 0c             	shl    $0xc,%eax
+  806028:	48 98                	cltq
+  80602a:	48 01 c2             	add    %rax,%rdx
+  80602d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806030:	48 98                	cltq
+  806032:	48 c1 e0 05          	shl    $0x5,%rax
+  806036:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80603a:	48 01 e8             	add    %rbp,%rax
+  80603d:	48 2d 30 08 00 00    	sub    $0x830,%rax
+  806043:	48 89 10             	mov    %rdx,(%rax)
+				map[nfile].perm = perm;
+  806046:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806049:	48 98                	cltq
+  80604b:	48 c1 e0 05          	shl    $0x5,%rax
+  80604f:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806053:	48 01 e8             	add    %rbp,%rax
+  806056:	48 8d 90 d8 f7 ff ff 	lea    -0x828(%rax),%rdx
+  80605d:	8b 45 10             	mov    0x10(%rbp),%eax
+  806060:	89 02                	mov    %eax,(%rdx)
+				unmap[nfile].dstenvid = 0;
+  806062:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806065:	48 98                	cltq
+  806067:	48 c1 e0 05          	shl    $0x5,%rax
+  80606b:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80606f:	48 01 e8             	add    %rbp,%rax
+  806072:	48 2d 3c 0c 00 00    	sub    $0xc3c,%rax
+  806078:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				unmap[nfile].dstva = (uintptr_t) tmp;
+  80607e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  806082:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  806085:	48 63 d2             	movslq %edx,%rdx
+  806088:	48 c1 e2 05          	shl    $0x5,%rdx
+  80608c:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  806090:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  806094:	48 81 ea 30 0c 00 00 	sub    $0xc30,%rdx
+  80609b:	48 89 02             	mov    %rax,(%rdx)
+				nfile++;
+  80609e:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  8060a2:	eb 73                	jmp    806117 <map_segment+0x2ca>
+			} else {
+				// Blank (BSS) pages are only allocated
+				// once the child writes to them.
+				alloc[j].dstenvid = child;
+  8060a4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8060a7:	48 98                	cltq
+  8060a9:	48 c1 e0 05          	shl    $0x5,%rax
+  8060ad:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8060b1:	48 01 e8             	add    %rbp,%rax
+  8060b4:	48 8d 90 c4 fb ff ff 	lea    -0x43c(%rax),%rdx
+  8060bb:	8b 85 ac f3 ff ff    	mov    -0xc54(%rbp),%eax
+  8060c1:	89 02                	mov    %eax,(%rdx)
+				alloc[j].dstva = va + i + j * PGSIZE;
+  8060c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8060c6:	48 63 d0             	movslq %eax,%rdx
+  8060c9:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  8060d0:	48 01 c2             	add    %rax,%rdx
+  8060d3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8060d6:	c1 e0 0c             	shl    $0xc,%eax
+  8060d9:	48 98                	cltq
+  8060db:	48 01 c2             	add    %rax,%rdx
+  8060de:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8060e1:	48 98                	cltq
+  8060e3:	48 c1 e0 05          	shl    $0x5,%rax
+  8060e7:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8060eb:	48 01 e8             	add    %rbp,%rax
+  8060ee:	48 2d 30 04 00 00    	sub    $0x430,%rax
+  8060f4:	48 89 10             	mov    %rdx,(%rax)
+				alloc[j].perm = perm | PTE_LAZY;
+  8060f7:	8b 45 10             	mov    0x10(%rbp),%eax
+  8060fa:	80 cc 10             	or     $0x10,%ah
+  8060fd:	89 c2                	mov    %eax,%edx
+  8060ff:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806102:	48 98                	cltq
+  806104:	48 c1 e0 05          	shl    $0x5,%rax
+  806108:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80610c:	48 01 e8             	add    %rbp,%rax
+  80610f:	48 2d 28 04 00 00    	sub    $0x428,%rax
+  806115:	89 10                	mov    %edx,(%rax)
+		for (j = 0; j < n; j++) {
+  806117:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  80611b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80611e:	3b 45 d0             	cmp    -0x30(%rbp),%eax
+  806121:	0f 8c 0a fe ff ff    	jl     805f31 <map_segment+0xe4>
+			}
+		}
+		if ((r = sys_page_alloc_batch(alloc, n)) < 0)
+  806127:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80612a:	48 63 d0             	movslq %eax,%rdx
+  80612d:	48 8d 85 b0 fb ff ff 	lea    -0x450(%rbp),%rax
+  806134:	48 89 d6             	mov    %rdx,%rsi
+  806137:	48 89 c7             	mov    %rax,%rdi
+  80613a:	49 89 df             	mov    %rbx,%r15
+  80613d:	48 b8 18 80 ff ff ff 	movabs $0xffffffffffff8018,%rax
+  806144:	ff ff ff 
+  806147:	48 01 d8             	add    %rbx,%rax
+  80614a:	ff d0                	call   *%rax
+  80614c:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  80614f:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  806153:	0f 88 80 01 00 00    	js     8062d9 <map_segment+0x48c>
+			goto out;
+
+		// from file
+		for (j = 0; j < nfile; j++) {
+  806159:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  806160:	e9 af 00 00 00       	jmp    806214 <map_segment+0x3c7>
+			if ((r = seek(fd, fileoffset + i + j * PGSIZE)) < 0)
+  806165:	8b 95 8c f3 ff ff    	mov    -0xc74(%rbp),%edx
+  80616b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80616e:	01 c2                	add    %eax,%edx
+  806170:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806173:	c1 e0 0c             	shl    $0xc,%eax
+  806176:	01 c2                	add    %eax,%edx
+  806178:	8b 85 a8 f3 ff ff    	mov    -0xc58(%rbp),%eax
+  80617e:	89 d6                	mov    %edx,%esi
+  806180:	89 c7                	mov    %eax,%edi
+  806182:	49 89 df             	mov    %rbx,%r15
+  806185:	48 b8 e3 95 ff ff ff 	movabs $0xffffffffffff95e3,%rax
+  80618c:	ff ff ff 
+  80618f:	48 01 d8             	add    %rbx,%rax
+  806192:	ff d0                	call   *%rax
+  806194:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  806197:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80619b:	0f 88 3b 01 00 00    	js     8062dc <map_segment+0x48f>
+				goto out;
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+				       MIN(PGSIZE, filesz - i - j * PGSIZE))) < 0)
+  8061a1:	c7 45 cc 00 10 00 00 	movl   $0x1000,-0x34(%rbp)
+  8061a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061ab:	48 98                	cltq
+  8061ad:	48 8b 95 90 f3 ff ff 	mov    -0xc70(%rbp),%rdx
+  8061b4:	48 29 c2             	sub    %rax,%rdx
+  8061b7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8061ba:	c1 e0 0c             	shl    $0xc,%eax
+  8061bd:	48 98                	cltq
+  8061bf:	48 29 c2             	sub    %rax,%rdx
+  8061c2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8061c6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8061c9:	48 63 d0             	movslq %eax,%rdx
+  8061cc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8061d0:	48 39 c2             	cmp    %rax,%rdx
+  8061d3:	48 0f 47 d0          	cmova  %rax,%rdx
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+  8061d7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8061da:	c1 e0 0c             	shl    $0xc,%eax
+  8061dd:	48 98                	cltq
+  8061df:	48 8d 88 00 00 40 00 	lea    0x400000(%rax),%rcx
+  8061e6:	8b 85 a8 f3 ff ff    	mov    -0xc58(%rbp),%eax
+  8061ec:	48 89 ce             	mov    %rcx,%rsi
+  8061ef:	89 c7                	mov    %eax,%edi
+  8061f1:	49 89 df             	mov    %rbx,%r15
+  8061f4:	48 b8 3e 94 ff ff ff 	movabs $0xffffffffffff943e,%rax
+  8061fb:	ff ff ff 
+  8061fe:	48 01 d8             	add    %rbx,%rax
+  806201:	ff d0                	call   *%rax
+  806203:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  806206:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80620a:	0f 88 cf 00 00 00    	js     8062df <map_segment+0x492>
+		for (j = 0; j < nfile; j++) {
+  806210:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  806214:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806217:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80621a:	0f 8c 45 ff ff ff    	jl     806165 <map_segment+0x318>
+				goto out;
+		}
+		if ((r = sys_page_map_batch(map, nfile)) < 0)
+  806220:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806223:	48 63 d0             	movslq %eax,%rdx
+  806226:	48 8d 85 b0 f7 ff ff 	lea    -0x850(%rbp),%rax
+  80622d:	48 89 d6             	mov    %rdx,%rsi
+  806230:	48 89 c7             	mov    %rax,%rdi
+  806233:	49 89 df             	mov    %rbx,%r15
+  806236:	48 b8 ba 7f ff ff ff 	movabs $0xffffffffffff7fba,%rax
+  80623d:	ff ff ff 
+  806240:	48 01 d8             	add    %rbx,%rax
+  806243:	ff d0                	call   *%rax
+  806245:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  806248:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80624c:	79 44                	jns    806292 <map_segment+0x445>
+			panic("spawn: sys_page_map_batch data: %e", r);
+  80624e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806251:	89 c1                	mov    %eax,%ecx
+  806253:	48 b8 48 dd ff ff ff 	movabs $0xffffffffffffdd48,%rax
+  80625a:	ff ff ff 
+  80625d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806261:	48 89 c2             	mov    %rax,%rdx
+  806264:	be 43 01 00 00       	mov    $0x143,%esi
+  806269:	48 b8 c8 dc ff ff ff 	movabs $0xffffffffffffdcc8,%rax
+  806270:	ff ff ff 
+  806273:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806277:	48 89 c7             	mov    %rax,%rdi
+  80627a:	49 89 df             	mov    %rbx,%r15
+  80627d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806282:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  806289:	ff ff ff 
+  80628c:	49 01 d8             	add    %rbx,%r8
+  80628f:	41 ff d0             	call   *%r8
+		sys_page_unmap_batch(unmap, nfile);
+  806292:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806295:	48 63 d0             	movslq %eax,%rdx
+  806298:	48 8d 85 b0 f3 ff ff 	lea    -0xc50(%rbp),%rax
+  80629f:	48 89 d6             	mov    %rdx,%rsi
+  8062a2:	48 89 c7             	mov    %rax,%rdi
+  8062a5:	49 89 df             	mov    %rbx,%r15
+  8062a8:	48 b8 76 80 ff ff ff 	movabs $0xffffffffffff8076,%rax
+  8062af:	ff ff ff 
+  8062b2:	48 01 d8             	add    %rbx,%rax
+  8062b5:	ff d0                	call   *%rax
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  8062b7:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8062ba:	c1 e0 0c             	shl    $0xc,%eax
+  8062bd:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8062c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062c3:	48 98                	cltq
+  8062c5:	48 3b 85 98 f3 ff ff 	cmp    -0xc68(%rbp),%rax
+  8062cc:	0f 82 13 fc ff ff    	jb     805ee5 <map_segment+0x98>
+	}
+	return 0;
+  8062d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062d7:	eb 2f                	jmp    806308 <map_segment+0x4bb>
+			goto out;
+  8062d9:	90                   	nop
+  8062da:	eb 04                	jmp    8062e0 <map_segment+0x493>
+				goto out;
+  8062dc:	90                   	nop
+  8062dd:	eb 01                	jmp    8062e0 <map_segment+0x493>
+				goto out;
+  8062df:	90                   	nop
+
+out:
+	sys_page_unmap_batch(unmap, nfile);
+  8062e0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8062e3:	48 63 d0             	movslq %eax,%rdx
+  8062e6:	48 8d 85 b0 f3 ff ff 	lea    -0xc50(%rbp),%rax
+  8062ed:	48 89 d6             	mov    %rdx,%rsi
+  8062f0:	48 89 c7             	mov    %rax,%rdi
+  8062f3:	49 89 df             	mov    %rbx,%r15
+  8062f6:	48 b8 76 80 ff ff ff 	movabs $0xffffffffffff8076,%rax
+  8062fd:	ff ff ff 
+  806300:	48 01 d8             	add    %rbx,%rax
+  806303:	ff d0                	call   *%rax
+	return r;
+  806305:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  806308:	48 81 c4 70 0c 00 00 	add    $0xc70,%rsp
+  80630f:	5b                   	pop    %rbx
+  806310:	41 5f                	pop    %r15
+  806312:	5d                   	pop    %rbp
+  806313:	c3                   	ret
+
+0000000000806314 <copy_shared_pages>:
+
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  806314:	55                   	push   %rbp
+  806315:	48 89 e5             	mov    %rsp,%rbp
+  806318:	41 57                	push   %r15
+  80631a:	53                   	push   %rbx
+  80631b:	48 83 ec 30          	sub    $0x30,%rsp
+  80631f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80631f <copy_shared_pages+0xb>
+  806326:	49 bb 21 4d 00 00 00 	movabs $0x4d21,%r11
+  80632d:	00 00 00 
+  806330:	4c 01 db             	add    %r11,%rbx
+  806333:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	int r;
+	uint64_t addr = 0;
+  806336:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80633d:	00 
+	for (; addr < USTACKTOP;){
+  80633e:	e9 7f 02 00 00       	jmp    8065c2 <copy_shared_pages+0x2ae>
+		if (uvpde[VPDPE(addr)] & PTE_P){
+  806343:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806347:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80634b:	48 89 c2             	mov    %rax,%rdx
+  80634e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806355:	ff ff ff 
+  806358:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80635c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806360:	83 e0 01             	and    $0x1,%eax
+  806363:	48 85 c0             	test   %rax,%rax
+  806366:	0f 84 4e 02 00 00    	je     8065ba <copy_shared_pages+0x2a6>
+			//a 2MB page is described by its PDE, not by uvpt
+			if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  80636c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806370:	48 c1 e8 15          	shr    $0x15,%rax
+  806374:	48 89 c2             	mov    %rax,%rdx
+  806377:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80637e:	ff ff ff 
+  806381:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806385:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806389:	25 81 00 00 00       	and    $0x81,%eax
+  80638e:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  806394:	0f 85 cf 00 00 00    	jne    806469 <copy_shared_pages+0x155>
+				if (uvpd[VPD(addr)] & PTE_SHARE){
+  80639a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80639e:	48 c1 e8 15          	shr    $0x15,%rax
+  8063a2:	48 89 c2             	mov    %rax,%rdx
+  8063a5:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8063ac:	ff ff ff 
+  8063af:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8063b3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8063b7:	25 00 04 00 00       	and    $0x400,%eax
+  8063bc:	48 85 c0             	test   %rax,%rax
+  8063bf:	0f 84 97 00 00 00    	je     80645c <copy_shared_pages+0x148>
+					unsigned int perm = uvpd[VPD(addr)] & (PTE_SYSCALL);
+  8063c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063c9:	48 c1 e8 15          	shr    $0x15,%rax
+  8063cd:	48 89 c2             	mov    %rax,%rdx
+  8063d0:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8063d7:	ff ff ff 
+  8063da:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8063de:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8063e2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8063e7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+  8063ea:	8b 75 dc             	mov    -0x24(%rbp),%esi
+  8063ed:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8063f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063f5:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8063f8:	41 89 f0             	mov    %esi,%r8d
+  8063fb:	48 89 c6             	mov    %rax,%rsi
+  8063fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  806403:	49 89 df             	mov    %rbx,%r15
+  806406:	48 b8 e4 79 ff ff ff 	movabs $0xffffffffffff79e4,%rax
+  80640d:	ff ff ff 
+  806410:	48 01 d8             	add    %rbx,%rax
+  806413:	ff d0                	call   *%rax
+  806415:	89 45 e0             	mov    %eax,-0x20(%rbp)
+					if (r < 0)
+  806418:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80641c:	79 3e                	jns    80645c <copy_shared_pages+0x148>
+						panic("sys_page_map in copy_shared_pages failed\n");
+  80641e:	48 b8 70 dd ff ff ff 	movabs $0xffffffffffffdd70,%rax
+  806425:	ff ff ff 
+  806428:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80642c:	48 89 c2             	mov    %rax,%rdx
+  80642f:	be 5b 01 00 00       	mov    $0x15b,%esi
+  806434:	48 b8 c8 dc ff ff ff 	movabs $0xffffffffffffdcc8,%rax
+  80643b:	ff ff ff 
+  80643e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806442:	48 89 c7             	mov    %rax,%rdi
+  806445:	49 89 df             	mov    %rbx,%r15
+  806448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80644d:	48 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%rcx
+  806454:	ff ff ff 
+  806457:	48 01 d9             	add    %rbx,%rcx
+  80645a:	ff d1                	call   *%rcx
+				}
+				addr += PTSIZE;
+  80645c:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  806463:	00 
+  806464:	e9 59 01 00 00       	jmp    8065c2 <copy_shared_pages+0x2ae>
+			}
+			else if (uvpd[VPD(addr)] & PTE_P){
+  806469:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80646d:	48 c1 e8 15          	shr    $0x15,%rax
+  806471:	48 89 c2             	mov    %rax,%rdx
+  806474:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80647b:	ff ff ff 
+  80647e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806482:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806486:	83 e0 01             	and    $0x1,%eax
+  806489:	48 85 c0             	test   %rax,%rax
+  80648c:	0f 84 1e 01 00 00    	je     8065b0 <copy_shared_pages+0x29c>
+				if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_SHARE && uvpt[VPN(addr)] & PTE_U){
+  806492:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806496:	48 c1 e8 0c          	shr    $0xc,%rax
+  80649a:	48 89 c2             	mov    %rax,%rdx
+  80649d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8064a4:	ff ff ff 
+  8064a7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8064ab:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8064af:	83 e0 01             	and    $0x1,%eax
+  8064b2:	48 85 c0             	test   %rax,%rax
+  8064b5:	0f 84 eb 00 00 00    	je     8065a6 <copy_shared_pages+0x292>
+  8064bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8064bf:	48 c1 e8 0c          	shr    $0xc,%rax
+  8064c3:	48 89 c2             	mov    %rax,%rdx
+  8064c6:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8064cd:	ff ff ff 
+  8064d0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8064d4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8064d8:	25 00 04 00 00       	and    $0x400,%eax
+  8064dd:	48 85 c0             	test   %rax,%rax
+  8064e0:	0f 84 c0 00 00 00    	je     8065a6 <copy_shared_pages+0x292>
+  8064e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8064ea:	48 c1 e8 0c          	shr    $0xc,%rax
+  8064ee:	48 89 c2             	mov    %rax,%rdx
+  8064f1:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8064f8:	ff ff ff 
+  8064fb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8064ff:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806503:	83 e0 04             	and    $0x4,%eax
+  806506:	48 85 c0             	test   %rax,%rax
+  806509:	0f 84 97 00 00 00    	je     8065a6 <copy_shared_pages+0x292>
+					unsigned int perm = uvpt[VPN(addr)] & (PTE_SYSCALL);
+  80650f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806513:	48 c1 e8 0c          	shr    $0xc,%rax
+  806517:	48 89 c2             	mov    %rax,%rdx
+  80651a:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  806521:	ff ff ff 
+  806524:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806528:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80652c:	25 07 0e 00 00       	and    $0xe07,%eax
+  806531:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+  806534:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  806537:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80653b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80653f:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  806542:	41 89 f0             	mov    %esi,%r8d
+  806545:	48 89 c6             	mov    %rax,%rsi
+  806548:	bf 00 00 00 00       	mov    $0x0,%edi
+  80654d:	49 89 df             	mov    %rbx,%r15
+  806550:	48 b8 e4 79 ff ff ff 	movabs $0xffffffffffff79e4,%rax
+  806557:	ff ff ff 
+  80655a:	48 01 d8             	add    %rbx,%rax
+  80655d:	ff d0                	call   *%rax
+  80655f:	89 45 e0             	mov    %eax,-0x20(%rbp)
+					if (r < 0)
+  806562:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  806566:	79 3e                	jns    8065a6 <copy_shared_pages+0x292>
+						panic("sys_page_map in copy_shared_pages failed\n");
+  806568:	48 b8 70 dd ff ff ff 	movabs $0xffffffffffffdd70,%rax
+  80656f:	ff ff ff 
+  806572:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806576:	48 89 c2             	mov    %rax,%rdx
+  806579:	be 64 01 00 00       	mov    $0x164,%esi
+  80657e:	48 b8 c8 dc ff ff ff 	movabs $0xffffffffffffdcc8,%rax
+  806585:	ff ff ff 
+  806588:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80658c:	48 89 c7             	mov    %rax,%rdi
+  80658f:	49 89 df             	mov    %rbx,%r15
+  806592:	b8 00 00 00 00       	mov    $0x0,%eax
+  806597:	48 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%rcx
+  80659e:	ff ff ff 
+  8065a1:	48 01 d9             	add    %rbx,%rcx
+  8065a4:	ff d1                	call   *%rcx
+				}
+				addr += PGSIZE;
+  8065a6:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  8065ad:	00 
+  8065ae:	eb 12                	jmp    8065c2 <copy_shared_pages+0x2ae>
+			}
+			//we will discover a PDE not present is at 
+			//a multiple of PTSIZE;
+			else {
+				addr += PTSIZE;
+  8065b0:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8065b7:	00 
+  8065b8:	eb 08                	jmp    8065c2 <copy_shared_pages+0x2ae>
+			}
+		}
+		//we will discover a PDPE not present is at
+		//a multiple of PTSIZE * NPDENTRIES;    
+		else {
+			addr += PTSIZE * NPDENTRIES;
+  8065ba:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  8065c1:	40 
+	for (; addr < USTACKTOP;){
+  8065c2:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  8065c7:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8065cb:	0f 83 72 fd ff ff    	jae    806343 <copy_shared_pages+0x2f>
+        	}
+        }
+
+	return 0;
+  8065d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8065d6:	48 83 c4 30          	add    $0x30,%rsp
+  8065da:	5b                   	pop    %rbx
+  8065db:	41 5f                	pop    %r15
+  8065dd:	5d                   	pop    %rbp
+  8065de:	c3                   	ret
+
+00000000008065df <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  8065df:	55                   	push   %rbp
+  8065e0:	48 89 e5             	mov    %rsp,%rbp
+  8065e3:	41 57                	push   %r15
+  8065e5:	53                   	push   %rbx
+  8065e6:	48 83 ec 20          	sub    $0x20,%rsp
+  8065ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065ea <fd2sockid+0xb>
+  8065f1:	49 bb 56 4a 00 00 00 	movabs $0x4a56,%r11
+  8065f8:	00 00 00 
+  8065fb:	4c 01 db             	add    %r11,%rbx
+  8065fe:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  806601:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806605:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806608:	48 89 d6             	mov    %rdx,%rsi
+  80660b:	89 c7                	mov    %eax,%edi
+  80660d:	49 89 df             	mov    %rbx,%r15
+  806610:	48 b8 e4 8d ff ff ff 	movabs $0xffffffffffff8de4,%rax
+  806617:	ff ff ff 
+  80661a:	48 01 d8             	add    %rbx,%rax
+  80661d:	ff d0                	call   *%rax
+  80661f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806622:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806626:	79 05                	jns    80662d <fd2sockid+0x4e>
+		return r;
+  806628:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80662b:	eb 25                	jmp    806652 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80662d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806631:	8b 10                	mov    (%rax),%edx
+  806633:	48 b8 a0 00 00 00 00 	movabs $0xa0,%rax
+  80663a:	00 00 00 
+  80663d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806640:	39 c2                	cmp    %eax,%edx
+  806642:	74 07                	je     80664b <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  806644:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  806649:	eb 07                	jmp    806652 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  80664b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80664f:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  806652:	48 83 c4 20          	add    $0x20,%rsp
+  806656:	5b                   	pop    %rbx
+  806657:	41 5f                	pop    %r15
+  806659:	5d                   	pop    %rbp
+  80665a:	c3                   	ret
+
+000000000080665b <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  80665b:	55                   	push   %rbp
+  80665c:	48 89 e5             	mov    %rsp,%rbp
+  80665f:	41 57                	push   %r15
+  806661:	53                   	push   %rbx
+  806662:	48 83 ec 20          	sub    $0x20,%rsp
+  806666:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806666 <alloc_sockfd+0xb>
+  80666d:	49 bb da 49 00 00 00 	movabs $0x49da,%r11
+  806674:	00 00 00 
+  806677:	4c 01 db             	add    %r11,%rbx
+  80667a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  80667d:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806681:	48 89 c7             	mov    %rax,%rdi
+  806684:	49 89 df             	mov    %rbx,%r15
+  806687:	48 b8 2e 8d ff ff ff 	movabs $0xffffffffffff8d2e,%rax
+  80668e:	ff ff ff 
+  806691:	48 01 d8             	add    %rbx,%rax
+  806694:	ff d0                	call   *%rax
+  806696:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806699:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80669d:	78 2c                	js     8066cb <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80669f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066a3:	ba 07 04 00 00       	mov    $0x407,%edx
+  8066a8:	48 89 c6             	mov    %rax,%rsi
+  8066ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8066b0:	49 89 df             	mov    %rbx,%r15
+  8066b3:	48 b8 7f 79 ff ff ff 	movabs $0xffffffffffff797f,%rax
+  8066ba:	ff ff ff 
+  8066bd:	48 01 d8             	add    %rbx,%rax
+  8066c0:	ff d0                	call   *%rax
+  8066c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8066c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066c9:	79 1c                	jns    8066e7 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  8066cb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8066ce:	89 c7                	mov    %eax,%edi
+  8066d0:	49 89 df             	mov    %rbx,%r15
+  8066d3:	48 b8 0f be ff ff ff 	movabs $0xffffffffffffbe0f,%rax
+  8066da:	ff ff ff 
+  8066dd:	48 01 d8             	add    %rbx,%rax
+  8066e0:	ff d0                	call   *%rax
+		return r;
+  8066e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066e5:	eb 41                	jmp    806728 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  8066e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066eb:	48 ba a0 00 00 00 00 	movabs $0xa0,%rdx
+  8066f2:	00 00 00 
+  8066f5:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8066f8:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  8066fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066fe:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  806705:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806709:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80670c:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  80670f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806713:	48 89 c7             	mov    %rax,%rdi
+  806716:	49 89 df             	mov    %rbx,%r15
+  806719:	48 b8 b4 8c ff ff ff 	movabs $0xffffffffffff8cb4,%rax
+  806720:	ff ff ff 
+  806723:	48 01 d8             	add    %rbx,%rax
+  806726:	ff d0                	call   *%rax
+}
+  806728:	48 83 c4 20          	add    $0x20,%rsp
+  80672c:	5b                   	pop    %rbx
+  80672d:	41 5f                	pop    %r15
+  80672f:	5d                   	pop    %rbp
+  806730:	c3                   	ret
+
+0000000000806731 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  806731:	55                   	push   %rbp
+  806732:	48 89 e5             	mov    %rsp,%rbp
+  806735:	41 57                	push   %r15
+  806737:	53                   	push   %rbx
+  806738:	48 83 ec 30          	sub    $0x30,%rsp
+  80673c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80673c <accept+0xb>
+  806743:	49 bb 04 49 00 00 00 	movabs $0x4904,%r11
+  80674a:	00 00 00 
+  80674d:	4c 01 db             	add    %r11,%rbx
+  806750:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806753:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806757:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80675b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80675e:	89 c7                	mov    %eax,%edi
+  806760:	48 b8 9f b5 ff ff ff 	movabs $0xffffffffffffb59f,%rax
+  806767:	ff ff ff 
+  80676a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80676e:	ff d0                	call   *%rax
+  806770:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806773:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806777:	79 05                	jns    80677e <accept+0x4d>
+		return r;
+  806779:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80677c:	eb 45                	jmp    8067c3 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80677e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806782:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  806786:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806789:	48 89 ce             	mov    %rcx,%rsi
+  80678c:	89 c7                	mov    %eax,%edi
+  80678e:	49 89 df             	mov    %rbx,%r15
+  806791:	48 b8 7d bc ff ff ff 	movabs $0xffffffffffffbc7d,%rax
+  806798:	ff ff ff 
+  80679b:	48 01 d8             	add    %rbx,%rax
+  80679e:	ff d0                	call   *%rax
+  8067a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8067a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067a7:	79 05                	jns    8067ae <accept+0x7d>
+		return r;
+  8067a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067ac:	eb 15                	jmp    8067c3 <accept+0x92>
+	return alloc_sockfd(r);
+  8067ae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067b1:	89 c7                	mov    %eax,%edi
+  8067b3:	48 b8 1b b6 ff ff ff 	movabs $0xffffffffffffb61b,%rax
+  8067ba:	ff ff ff 
+  8067bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8067c1:	ff d0                	call   *%rax
+}
+  8067c3:	48 83 c4 30          	add    $0x30,%rsp
+  8067c7:	5b                   	pop    %rbx
+  8067c8:	41 5f                	pop    %r15
+  8067ca:	5d                   	pop    %rbp
+  8067cb:	c3                   	ret
+
+00000000008067cc <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8067cc:	55                   	push   %rbp
+  8067cd:	48 89 e5             	mov    %rsp,%rbp
+  8067d0:	41 57                	push   %r15
+  8067d2:	53                   	push   %rbx
+  8067d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8067d7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067d7 <bind+0xb>
+  8067de:	49 bb 69 48 00 00 00 	movabs $0x4869,%r11
+  8067e5:	00 00 00 
+  8067e8:	4c 01 db             	add    %r11,%rbx
+  8067eb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8067ee:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8067f2:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8067f5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8067f8:	89 c7                	mov    %eax,%edi
+  8067fa:	48 b8 9f b5 ff ff ff 	movabs $0xffffffffffffb59f,%rax
+  806801:	ff ff ff 
+  806804:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806808:	ff d0                	call   *%rax
+  80680a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80680d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806811:	79 05                	jns    806818 <bind+0x4c>
+		return r;
+  806813:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806816:	eb 21                	jmp    806839 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  806818:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80681b:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80681f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806822:	48 89 ce             	mov    %rcx,%rsi
+  806825:	89 c7                	mov    %eax,%edi
+  806827:	49 89 df             	mov    %rbx,%r15
+  80682a:	48 b8 29 bd ff ff ff 	movabs $0xffffffffffffbd29,%rax
+  806831:	ff ff ff 
+  806834:	48 01 d8             	add    %rbx,%rax
+  806837:	ff d0                	call   *%rax
+}
+  806839:	48 83 c4 20          	add    $0x20,%rsp
+  80683d:	5b                   	pop    %rbx
+  80683e:	41 5f                	pop    %r15
+  806840:	5d                   	pop    %rbp
+  806841:	c3                   	ret
+
+0000000000806842 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  806842:	55                   	push   %rbp
+  806843:	48 89 e5             	mov    %rsp,%rbp
+  806846:	41 57                	push   %r15
+  806848:	53                   	push   %rbx
+  806849:	48 83 ec 20          	sub    $0x20,%rsp
+  80684d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80684d <shutdown+0xb>
+  806854:	49 bb f3 47 00 00 00 	movabs $0x47f3,%r11
+  80685b:	00 00 00 
+  80685e:	4c 01 db             	add    %r11,%rbx
+  806861:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806864:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  806867:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80686a:	89 c7                	mov    %eax,%edi
+  80686c:	48 b8 9f b5 ff ff ff 	movabs $0xffffffffffffb59f,%rax
+  806873:	ff ff ff 
+  806876:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80687a:	ff d0                	call   *%rax
+  80687c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80687f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806883:	79 05                	jns    80688a <shutdown+0x48>
+		return r;
+  806885:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806888:	eb 1c                	jmp    8068a6 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  80688a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80688d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806890:	89 d6                	mov    %edx,%esi
+  806892:	89 c7                	mov    %eax,%edi
+  806894:	49 89 df             	mov    %rbx,%r15
+  806897:	48 b8 be bd ff ff ff 	movabs $0xffffffffffffbdbe,%rax
+  80689e:	ff ff ff 
+  8068a1:	48 01 d8             	add    %rbx,%rax
+  8068a4:	ff d0                	call   *%rax
+}
+  8068a6:	48 83 c4 20          	add    $0x20,%rsp
+  8068aa:	5b                   	pop    %rbx
+  8068ab:	41 5f                	pop    %r15
+  8068ad:	5d                   	pop    %rbp
+  8068ae:	c3                   	ret
+
+00000000008068af <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8068af:	55                   	push   %rbp
+  8068b0:	48 89 e5             	mov    %rsp,%rbp
+  8068b3:	41 57                	push   %r15
+  8068b5:	53                   	push   %rbx
+  8068b6:	48 83 ec 10          	sub    $0x10,%rsp
+  8068ba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068ba <devsock_close+0xb>
+  8068c1:	49 bb 86 47 00 00 00 	movabs $0x4786,%r11
+  8068c8:	00 00 00 
+  8068cb:	4c 01 db             	add    %r11,%rbx
+  8068ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  8068d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8068d6:	48 89 c7             	mov    %rax,%rdi
+  8068d9:	49 89 df             	mov    %rbx,%r15
+  8068dc:	48 b8 3b d4 ff ff ff 	movabs $0xffffffffffffd43b,%rax
+  8068e3:	ff ff ff 
+  8068e6:	48 01 d8             	add    %rbx,%rax
+  8068e9:	ff d0                	call   *%rax
+  8068eb:	83 f8 01             	cmp    $0x1,%eax
+  8068ee:	75 1d                	jne    80690d <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  8068f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8068f4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8068f7:	89 c7                	mov    %eax,%edi
+  8068f9:	49 89 df             	mov    %rbx,%r15
+  8068fc:	48 b8 0f be ff ff ff 	movabs $0xffffffffffffbe0f,%rax
+  806903:	ff ff ff 
+  806906:	48 01 d8             	add    %rbx,%rax
+  806909:	ff d0                	call   *%rax
+  80690b:	eb 05                	jmp    806912 <devsock_close+0x63>
+	else
+		return 0;
+  80690d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806912:	48 83 c4 10          	add    $0x10,%rsp
+  806916:	5b                   	pop    %rbx
+  806917:	41 5f                	pop    %r15
+  806919:	5d                   	pop    %rbp
+  80691a:	c3                   	ret
+
+000000000080691b <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80691b:	55                   	push   %rbp
+  80691c:	48 89 e5             	mov    %rsp,%rbp
+  80691f:	41 57                	push   %r15
+  806921:	53                   	push   %rbx
+  806922:	48 83 ec 20          	sub    $0x20,%rsp
+  806926:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806926 <connect+0xb>
+  80692d:	49 bb 1a 47 00 00 00 	movabs $0x471a,%r11
+  806934:	00 00 00 
+  806937:	4c 01 db             	add    %r11,%rbx
+  80693a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80693d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806941:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  806944:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806947:	89 c7                	mov    %eax,%edi
+  806949:	48 b8 9f b5 ff ff ff 	movabs $0xffffffffffffb59f,%rax
+  806950:	ff ff ff 
+  806953:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806957:	ff d0                	call   *%rax
+  806959:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80695c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806960:	79 05                	jns    806967 <connect+0x4c>
+		return r;
+  806962:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806965:	eb 21                	jmp    806988 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  806967:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80696a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80696e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806971:	48 89 ce             	mov    %rcx,%rsi
+  806974:	89 c7                	mov    %eax,%edi
+  806976:	49 89 df             	mov    %rbx,%r15
+  806979:	48 b8 57 be ff ff ff 	movabs $0xffffffffffffbe57,%rax
+  806980:	ff ff ff 
+  806983:	48 01 d8             	add    %rbx,%rax
+  806986:	ff d0                	call   *%rax
+}
+  806988:	48 83 c4 20          	add    $0x20,%rsp
+  80698c:	5b                   	pop    %rbx
+  80698d:	41 5f                	pop    %r15
+  80698f:	5d                   	pop    %rbp
+  806990:	c3                   	ret
+
+0000000000806991 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  806991:	55                   	push   %rbp
+  806992:	48 89 e5             	mov    %rsp,%rbp
+  806995:	41 57                	push   %r15
+  806997:	53                   	push   %rbx
+  806998:	48 83 ec 20          	sub    $0x20,%rsp
+  80699c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80699c <listen+0xb>
+  8069a3:	49 bb a4 46 00 00 00 	movabs $0x46a4,%r11
+  8069aa:	00 00 00 
+  8069ad:	4c 01 db             	add    %r11,%rbx
+  8069b0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8069b3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8069b6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8069b9:	89 c7                	mov    %eax,%edi
+  8069bb:	48 b8 9f b5 ff ff ff 	movabs $0xffffffffffffb59f,%rax
+  8069c2:	ff ff ff 
+  8069c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8069c9:	ff d0                	call   *%rax
+  8069cb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8069ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8069d2:	79 05                	jns    8069d9 <listen+0x48>
+		return r;
+  8069d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069d7:	eb 1c                	jmp    8069f5 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  8069d9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8069dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069df:	89 d6                	mov    %edx,%esi
+  8069e1:	89 c7                	mov    %eax,%edi
+  8069e3:	49 89 df             	mov    %rbx,%r15
+  8069e6:	48 b8 ec be ff ff ff 	movabs $0xffffffffffffbeec,%rax
+  8069ed:	ff ff ff 
+  8069f0:	48 01 d8             	add    %rbx,%rax
+  8069f3:	ff d0                	call   *%rax
+}
+  8069f5:	48 83 c4 20          	add    $0x20,%rsp
+  8069f9:	5b                   	pop    %rbx
+  8069fa:	41 5f                	pop    %r15
+  8069fc:	5d                   	pop    %rbp
+  8069fd:	c3                   	ret
+
+00000000008069fe <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  8069fe:	55                   	push   %rbp
+  8069ff:	48 89 e5             	mov    %rsp,%rbp
+  806a02:	41 57                	push   %r15
+  806a04:	48 83 ec 28          	sub    $0x28,%rsp
+  806a08:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a08 <devsock_read+0xa>
+  806a0f:	49 bb 38 46 00 00 00 	movabs $0x4638,%r11
+  806a16:	00 00 00 
+  806a19:	4c 01 d8             	add    %r11,%rax
+  806a1c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806a20:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806a24:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  806a28:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806a2c:	41 89 d0             	mov    %edx,%r8d
+  806a2f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806a33:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  806a36:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  806a3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806a3f:	44 89 c2             	mov    %r8d,%edx
+  806a42:	49 89 c7             	mov    %rax,%r15
+  806a45:	49 b8 3d bf ff ff ff 	movabs $0xffffffffffffbf3d,%r8
+  806a4c:	ff ff ff 
+  806a4f:	49 01 c0             	add    %rax,%r8
+  806a52:	41 ff d0             	call   *%r8
+}
+  806a55:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806a59:	c9                   	leave
+  806a5a:	c3                   	ret
+
+0000000000806a5b <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  806a5b:	55                   	push   %rbp
+  806a5c:	48 89 e5             	mov    %rsp,%rbp
+  806a5f:	41 57                	push   %r15
+  806a61:	48 83 ec 28          	sub    $0x28,%rsp
+  806a65:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a65 <devsock_write+0xa>
+  806a6c:	49 bb db 45 00 00 00 	movabs $0x45db,%r11
+  806a73:	00 00 00 
+  806a76:	4c 01 d8             	add    %r11,%rax
+  806a79:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806a7d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806a81:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  806a85:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806a89:	41 89 d0             	mov    %edx,%r8d
+  806a8c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806a90:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  806a93:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  806a97:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806a9c:	44 89 c2             	mov    %r8d,%edx
+  806a9f:	49 89 c7             	mov    %rax,%r15
+  806aa2:	49 b8 5a c0 ff ff ff 	movabs $0xffffffffffffc05a,%r8
+  806aa9:	ff ff ff 
+  806aac:	49 01 c0             	add    %rax,%r8
+  806aaf:	41 ff d0             	call   *%r8
+}
+  806ab2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806ab6:	c9                   	leave
+  806ab7:	c3                   	ret
+
+0000000000806ab8 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  806ab8:	55                   	push   %rbp
+  806ab9:	48 89 e5             	mov    %rsp,%rbp
+  806abc:	41 57                	push   %r15
+  806abe:	48 83 ec 18          	sub    $0x18,%rsp
+  806ac2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806ac2 <devsock_stat+0xa>
+  806ac9:	49 bb 7e 45 00 00 00 	movabs $0x457e,%r11
+  806ad0:	00 00 00 
+  806ad3:	4c 01 d8             	add    %r11,%rax
+  806ad6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806ada:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  806ade:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806ae2:	48 b9 9f dd ff ff ff 	movabs $0xffffffffffffdd9f,%rcx
+  806ae9:	ff ff ff 
+  806aec:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806af0:	48 89 ce             	mov    %rcx,%rsi
+  806af3:	48 89 d7             	mov    %rdx,%rdi
+  806af6:	49 89 c7             	mov    %rax,%r15
+  806af9:	48 ba c3 6c ff ff ff 	movabs $0xffffffffffff6cc3,%rdx
+  806b00:	ff ff ff 
+  806b03:	48 01 c2             	add    %rax,%rdx
+  806b06:	ff d2                	call   *%rdx
+	return 0;
+  806b08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806b0d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806b11:	c9                   	leave
+  806b12:	c3                   	ret
+
+0000000000806b13 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  806b13:	55                   	push   %rbp
+  806b14:	48 89 e5             	mov    %rsp,%rbp
+  806b17:	41 57                	push   %r15
+  806b19:	53                   	push   %rbx
+  806b1a:	48 83 ec 20          	sub    $0x20,%rsp
+  806b1e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b1e <socket+0xb>
+  806b25:	49 bb 22 45 00 00 00 	movabs $0x4522,%r11
+  806b2c:	00 00 00 
+  806b2f:	4c 01 db             	add    %r11,%rbx
+  806b32:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806b35:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806b38:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  806b3b:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  806b3e:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  806b41:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b44:	89 ce                	mov    %ecx,%esi
+  806b46:	89 c7                	mov    %eax,%edi
+  806b48:	49 89 df             	mov    %rbx,%r15
+  806b4b:	48 b8 31 c2 ff ff ff 	movabs $0xffffffffffffc231,%rax
+  806b52:	ff ff ff 
+  806b55:	48 01 d8             	add    %rbx,%rax
+  806b58:	ff d0                	call   *%rax
+  806b5a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806b5d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b61:	79 05                	jns    806b68 <socket+0x55>
+		return r;
+  806b63:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b66:	eb 15                	jmp    806b7d <socket+0x6a>
+	return alloc_sockfd(r);
+  806b68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b6b:	89 c7                	mov    %eax,%edi
+  806b6d:	48 b8 1b b6 ff ff ff 	movabs $0xffffffffffffb61b,%rax
+  806b74:	ff ff ff 
+  806b77:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806b7b:	ff d0                	call   *%rax
+}
+  806b7d:	48 83 c4 20          	add    $0x20,%rsp
+  806b81:	5b                   	pop    %rbx
+  806b82:	41 5f                	pop    %r15
+  806b84:	5d                   	pop    %rbp
+  806b85:	c3                   	ret
+
+0000000000806b86 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  806b86:	55                   	push   %rbp
+  806b87:	48 89 e5             	mov    %rsp,%rbp
+  806b8a:	41 57                	push   %r15
+  806b8c:	53                   	push   %rbx
+  806b8d:	48 83 ec 10          	sub    $0x10,%rsp
+  806b91:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b91 <nsipc+0xb>
+  806b98:	49 bb af 44 00 00 00 	movabs $0x44af,%r11
+  806b9f:	00 00 00 
+  806ba2:	4c 01 db             	add    %r11,%rbx
+  806ba5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  806ba8:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  806baf:	00 00 00 
+  806bb2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806bb5:	85 c0                	test   %eax,%eax
+  806bb7:	75 24                	jne    806bdd <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  806bb9:	bf 02 00 00 00       	mov    $0x2,%edi
+  806bbe:	49 89 df             	mov    %rbx,%r15
+  806bc1:	48 b8 ac d3 ff ff ff 	movabs $0xffffffffffffd3ac,%rax
+  806bc8:	ff ff ff 
+  806bcb:	48 01 d8             	add    %rbx,%rax
+  806bce:	ff d0                	call   *%rax
+  806bd0:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  806bd7:	00 00 00 
+  806bda:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  806bdd:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  806be4:	00 00 00 
+  806be7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806bea:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  806bed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806bf3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  806bf9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806bfe:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806c05:	00 00 00 
+  806c08:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806c0c:	89 c7                	mov    %eax,%edi
+  806c0e:	49 89 df             	mov    %rbx,%r15
+  806c11:	48 b8 cb cd ff ff ff 	movabs $0xffffffffffffcdcb,%rax
+  806c18:	ff ff ff 
+  806c1b:	48 01 d8             	add    %rbx,%rax
+  806c1e:	ff d0                	call   *%rax
+}
+  806c20:	48 83 c4 10          	add    $0x10,%rsp
+  806c24:	5b                   	pop    %rbx
+  806c25:	41 5f                	pop    %r15
+  806c27:	5d                   	pop    %rbp
+  806c28:	c3                   	ret
+
+0000000000806c29 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  806c29:	55                   	push   %rbp
+  806c2a:	48 89 e5             	mov    %rsp,%rbp
+  806c2d:	41 57                	push   %r15
+  806c2f:	53                   	push   %rbx
+  806c30:	48 83 ec 20          	sub    $0x20,%rsp
+  806c34:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806c34 <nsipc_words+0xb>
+  806c3b:	49 bb 0c 44 00 00 00 	movabs $0x440c,%r11
+  806c42:	00 00 00 
+  806c45:	4c 01 db             	add    %r11,%rbx
+  806c48:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806c4b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806c4f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  806c53:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  806c5a:	00 00 00 
+  806c5d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806c60:	85 c0                	test   %eax,%eax
+  806c62:	75 24                	jne    806c88 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  806c64:	bf 02 00 00 00       	mov    $0x2,%edi
+  806c69:	49 89 df             	mov    %rbx,%r15
+  806c6c:	48 b8 ac d3 ff ff ff 	movabs $0xffffffffffffd3ac,%rax
+  806c73:	ff ff ff 
+  806c76:	48 01 d8             	add    %rbx,%rax
+  806c79:	ff d0                	call   *%rax
+  806c7b:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  806c82:	00 00 00 
+  806c85:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  806c88:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  806c8f:	00 00 00 
+  806c92:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806c95:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  806c99:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806c9d:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  806ca0:	89 c7                	mov    %eax,%edi
+  806ca2:	49 89 df             	mov    %rbx,%r15
+  806ca5:	48 b8 b6 ce ff ff ff 	movabs $0xffffffffffffceb6,%rax
+  806cac:	ff ff ff 
+  806caf:	48 01 d8             	add    %rbx,%rax
+  806cb2:	ff d0                	call   *%rax
+}
+  806cb4:	48 83 c4 20          	add    $0x20,%rsp
+  806cb8:	5b                   	pop    %rbx
+  806cb9:	41 5f                	pop    %r15
+  806cbb:	5d                   	pop    %rbp
+  806cbc:	c3                   	ret
+
+0000000000806cbd <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  806cbd:	55                   	push   %rbp
+  806cbe:	48 89 e5             	mov    %rsp,%rbp
+  806cc1:	41 57                	push   %r15
+  806cc3:	53                   	push   %rbx
+  806cc4:	48 83 ec 30          	sub    $0x30,%rsp
+  806cc8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806cc8 <nsipc_accept+0xb>
+  806ccf:	49 bb 78 43 00 00 00 	movabs $0x4378,%r11
+  806cd6:	00 00 00 
+  806cd9:	4c 01 db             	add    %r11,%rbx
+  806cdc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806cdf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806ce3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  806ce7:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806cee:	00 00 00 
+  806cf1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806cf4:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  806cf7:	bf 01 00 00 00       	mov    $0x1,%edi
+  806cfc:	48 b8 46 bb ff ff ff 	movabs $0xffffffffffffbb46,%rax
+  806d03:	ff ff ff 
+  806d06:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806d0a:	ff d0                	call   *%rax
+  806d0c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806d0f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806d13:	78 48                	js     806d5d <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  806d15:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  806d1c:	00 00 00 
+  806d1f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806d23:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  806d27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806d2b:	8b 40 10             	mov    0x10(%rax),%eax
+  806d2e:	89 c2                	mov    %eax,%edx
+  806d30:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  806d34:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806d38:	48 89 ce             	mov    %rcx,%rsi
+  806d3b:	48 89 c7             	mov    %rax,%rdi
+  806d3e:	49 89 df             	mov    %rbx,%r15
+  806d41:	48 b8 a3 70 ff ff ff 	movabs $0xffffffffffff70a3,%rax
+  806d48:	ff ff ff 
+  806d4b:	48 01 d8             	add    %rbx,%rax
+  806d4e:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  806d50:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806d54:	8b 50 10             	mov    0x10(%rax),%edx
+  806d57:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806d5b:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  806d5d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806d60:	48 83 c4 30          	add    $0x30,%rsp
+  806d64:	5b                   	pop    %rbx
+  806d65:	41 5f                	pop    %r15
+  806d67:	5d                   	pop    %rbp
+  806d68:	c3                   	ret
+
+0000000000806d69 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  806d69:	55                   	push   %rbp
+  806d6a:	48 89 e5             	mov    %rsp,%rbp
+  806d6d:	41 57                	push   %r15
+  806d6f:	53                   	push   %rbx
+  806d70:	48 83 ec 10          	sub    $0x10,%rsp
+  806d74:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806d74 <nsipc_bind+0xb>
+  806d7b:	49 bb cc 42 00 00 00 	movabs $0x42cc,%r11
+  806d82:	00 00 00 
+  806d85:	4c 01 db             	add    %r11,%rbx
+  806d88:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806d8b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806d8f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  806d92:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806d99:	00 00 00 
+  806d9c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d9f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  806da2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806da5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806da9:	48 89 c6             	mov    %rax,%rsi
+  806dac:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  806db3:	00 00 00 
+  806db6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806dba:	48 89 c7             	mov    %rax,%rdi
+  806dbd:	49 89 df             	mov    %rbx,%r15
+  806dc0:	48 b8 a3 70 ff ff ff 	movabs $0xffffffffffff70a3,%rax
+  806dc7:	ff ff ff 
+  806dca:	48 01 d8             	add    %rbx,%rax
+  806dcd:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  806dcf:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806dd6:	00 00 00 
+  806dd9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806ddc:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  806de0:	bf 02 00 00 00       	mov    $0x2,%edi
+  806de5:	48 b8 46 bb ff ff ff 	movabs $0xffffffffffffbb46,%rax
+  806dec:	ff ff ff 
+  806def:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806df3:	ff d0                	call   *%rax
+}
+  806df5:	48 83 c4 10          	add    $0x10,%rsp
+  806df9:	5b                   	pop    %rbx
+  806dfa:	41 5f                	pop    %r15
+  806dfc:	5d                   	pop    %rbp
+  806dfd:	c3                   	ret
+
+0000000000806dfe <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  806dfe:	55                   	push   %rbp
+  806dff:	48 89 e5             	mov    %rsp,%rbp
+  806e02:	48 83 ec 20          	sub    $0x20,%rsp
+  806e06:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806e06 <nsipc_shutdown+0x8>
+  806e0d:	49 bb 3a 42 00 00 00 	movabs $0x423a,%r11
+  806e14:	00 00 00 
+  806e17:	4c 01 d8             	add    %r11,%rax
+  806e1a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806e1d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  806e20:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  806e23:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  806e26:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806e29:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  806e2c:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  806e30:	ba 08 00 00 00       	mov    $0x8,%edx
+  806e35:	48 89 ce             	mov    %rcx,%rsi
+  806e38:	bf 03 00 00 00       	mov    $0x3,%edi
+  806e3d:	48 b9 e9 bb ff ff ff 	movabs $0xffffffffffffbbe9,%rcx
+  806e44:	ff ff ff 
+  806e47:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  806e4b:	ff d0                	call   *%rax
+}
+  806e4d:	c9                   	leave
+  806e4e:	c3                   	ret
+
+0000000000806e4f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  806e4f:	55                   	push   %rbp
+  806e50:	48 89 e5             	mov    %rsp,%rbp
+  806e53:	48 83 ec 20          	sub    $0x20,%rsp
+  806e57:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806e57 <nsipc_close+0x8>
+  806e5e:	49 bb e9 41 00 00 00 	movabs $0x41e9,%r11
+  806e65:	00 00 00 
+  806e68:	4c 01 d8             	add    %r11,%rax
+  806e6b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  806e6e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  806e71:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  806e74:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  806e78:	ba 04 00 00 00       	mov    $0x4,%edx
+  806e7d:	48 89 ce             	mov    %rcx,%rsi
+  806e80:	bf 04 00 00 00       	mov    $0x4,%edi
+  806e85:	48 b9 e9 bb ff ff ff 	movabs $0xffffffffffffbbe9,%rcx
+  806e8c:	ff ff ff 
+  806e8f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  806e93:	ff d0                	call   *%rax
+}
+  806e95:	c9                   	leave
+  806e96:	c3                   	ret
+
+0000000000806e97 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  806e97:	55                   	push   %rbp
+  806e98:	48 89 e5             	mov    %rsp,%rbp
+  806e9b:	41 57                	push   %r15
+  806e9d:	53                   	push   %rbx
+  806e9e:	48 83 ec 10          	sub    $0x10,%rsp
+  806ea2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ea2 <nsipc_connect+0xb>
+  806ea9:	49 bb 9e 41 00 00 00 	movabs $0x419e,%r11
+  806eb0:	00 00 00 
+  806eb3:	4c 01 db             	add    %r11,%rbx
+  806eb6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806eb9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806ebd:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  806ec0:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806ec7:	00 00 00 
+  806eca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ecd:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  806ed0:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806ed3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806ed7:	48 89 c6             	mov    %rax,%rsi
+  806eda:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  806ee1:	00 00 00 
+  806ee4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806ee8:	48 89 c7             	mov    %rax,%rdi
+  806eeb:	49 89 df             	mov    %rbx,%r15
+  806eee:	48 b8 a3 70 ff ff ff 	movabs $0xffffffffffff70a3,%rax
+  806ef5:	ff ff ff 
+  806ef8:	48 01 d8             	add    %rbx,%rax
+  806efb:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  806efd:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806f04:	00 00 00 
+  806f07:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806f0a:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  806f0e:	bf 05 00 00 00       	mov    $0x5,%edi
+  806f13:	48 b8 46 bb ff ff ff 	movabs $0xffffffffffffbb46,%rax
+  806f1a:	ff ff ff 
+  806f1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806f21:	ff d0                	call   *%rax
+}
+  806f23:	48 83 c4 10          	add    $0x10,%rsp
+  806f27:	5b                   	pop    %rbx
+  806f28:	41 5f                	pop    %r15
+  806f2a:	5d                   	pop    %rbp
+  806f2b:	c3                   	ret
+
+0000000000806f2c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  806f2c:	55                   	push   %rbp
+  806f2d:	48 89 e5             	mov    %rsp,%rbp
+  806f30:	48 83 ec 20          	sub    $0x20,%rsp
+  806f34:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806f34 <nsipc_listen+0x8>
+  806f3b:	49 bb 0c 41 00 00 00 	movabs $0x410c,%r11
+  806f42:	00 00 00 
+  806f45:	4c 01 d8             	add    %r11,%rax
+  806f48:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806f4b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  806f4e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  806f51:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  806f54:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806f57:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  806f5a:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  806f5e:	ba 08 00 00 00       	mov    $0x8,%edx
+  806f63:	48 89 ce             	mov    %rcx,%rsi
+  806f66:	bf 06 00 00 00       	mov    $0x6,%edi
+  806f6b:	48 b9 e9 bb ff ff ff 	movabs $0xffffffffffffbbe9,%rcx
+  806f72:	ff ff ff 
+  806f75:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  806f79:	ff d0                	call   *%rax
+}
+  806f7b:	c9                   	leave
+  806f7c:	c3                   	ret
+
+0000000000806f7d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  806f7d:	55                   	push   %rbp
+  806f7e:	48 89 e5             	mov    %rsp,%rbp
+  806f81:	41 57                	push   %r15
+  806f83:	53                   	push   %rbx
+  806f84:	48 83 ec 30          	sub    $0x30,%rsp
+  806f88:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806f88 <nsipc_recv+0xb>
+  806f8f:	49 bb b8 40 00 00 00 	movabs $0x40b8,%r11
+  806f96:	00 00 00 
+  806f99:	4c 01 db             	add    %r11,%rbx
+  806f9c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806f9f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806fa3:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  806fa6:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  806fa9:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806fb0:	00 00 00 
+  806fb3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806fb6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  806fb9:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806fc0:	00 00 00 
+  806fc3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806fc6:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  806fca:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  806fd1:	00 00 00 
+  806fd4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806fd7:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  806fdb:	bf 07 00 00 00       	mov    $0x7,%edi
+  806fe0:	48 b8 46 bb ff ff ff 	movabs $0xffffffffffffbb46,%rax
+  806fe7:	ff ff ff 
+  806fea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806fee:	ff d0                	call   *%rax
+  806ff0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806ff3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806ff7:	0f 88 91 00 00 00    	js     80708e <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  806ffd:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  807004:	7f 08                	jg     80700e <nsipc_recv+0x91>
+  807006:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807009:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  80700c:	7e 50                	jle    80705e <nsipc_recv+0xe1>
+  80700e:	48 b8 a6 dd ff ff ff 	movabs $0xffffffffffffdda6,%rax
+  807015:	ff ff ff 
+  807018:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80701c:	48 89 c1             	mov    %rax,%rcx
+  80701f:	48 b8 bb dd ff ff ff 	movabs $0xffffffffffffddbb,%rax
+  807026:	ff ff ff 
+  807029:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80702d:	48 89 c2             	mov    %rax,%rdx
+  807030:	be 79 00 00 00       	mov    $0x79,%esi
+  807035:	48 b8 d0 dd ff ff ff 	movabs $0xffffffffffffddd0,%rax
+  80703c:	ff ff ff 
+  80703f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807043:	48 89 c7             	mov    %rax,%rdi
+  807046:	49 89 df             	mov    %rbx,%r15
+  807049:	b8 00 00 00 00       	mov    $0x0,%eax
+  80704e:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  807055:	ff ff ff 
+  807058:	49 01 d8             	add    %rbx,%r8
+  80705b:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80705e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807061:	48 63 d0             	movslq %eax,%rdx
+  807064:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  807068:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80706f:	00 00 00 
+  807072:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  807076:	48 89 ce             	mov    %rcx,%rsi
+  807079:	48 89 c7             	mov    %rax,%rdi
+  80707c:	49 89 df             	mov    %rbx,%r15
+  80707f:	48 b8 a3 70 ff ff ff 	movabs $0xffffffffffff70a3,%rax
+  807086:	ff ff ff 
+  807089:	48 01 d8             	add    %rbx,%rax
+  80708c:	ff d0                	call   *%rax
+	}
+
+	return r;
+  80708e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  807091:	48 83 c4 30          	add    $0x30,%rsp
+  807095:	5b                   	pop    %rbx
+  807096:	41 5f                	pop    %r15
+  807098:	5d                   	pop    %rbp
+  807099:	c3                   	ret
+
+000000000080709a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80709a:	55                   	push   %rbp
+  80709b:	48 89 e5             	mov    %rsp,%rbp
+  80709e:	41 57                	push   %r15
+  8070a0:	53                   	push   %rbx
+  8070a1:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8070a8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8070a8 <nsipc_send+0xe>
+  8070af:	49 bb 98 3f 00 00 00 	movabs $0x3f98,%r11
+  8070b6:	00 00 00 
+  8070b9:	4c 01 db             	add    %r11,%rbx
+  8070bc:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8070c2:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  8070c9:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  8070cf:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  8070d5:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8070d9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  8070dd:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8070e4:	00 00 00 
+  8070e7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8070ea:	85 c0                	test   %eax,%eax
+  8070ec:	75 24                	jne    807112 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8070ee:	bf 02 00 00 00       	mov    $0x2,%edi
+  8070f3:	49 89 df             	mov    %rbx,%r15
+  8070f6:	48 b8 ac d3 ff ff ff 	movabs $0xffffffffffffd3ac,%rax
+  8070fd:	ff ff ff 
+  807100:	48 01 d8             	add    %rbx,%rax
+  807103:	ff d0                	call   *%rax
+  807105:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  80710c:	00 00 00 
+  80710f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  807112:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  807118:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80711b:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  807122:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  807125:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807128:	39 c2                	cmp    %eax,%edx
+  80712a:	0f 4e c2             	cmovle %edx,%eax
+  80712d:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  807133:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  807139:	48 63 d0             	movslq %eax,%rdx
+  80713c:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  807143:	48 89 c6             	mov    %rax,%rsi
+  807146:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  80714d:	00 00 00 
+  807150:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807154:	48 89 c7             	mov    %rax,%rdi
+  807157:	49 89 df             	mov    %rbx,%r15
+  80715a:	48 b8 a3 70 ff ff ff 	movabs $0xffffffffffff70a3,%rax
+  807161:	ff ff ff 
+  807164:	48 01 d8             	add    %rbx,%rax
+  807167:	ff d0                	call   *%rax
+	req->req_s = s;
+  807169:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80716d:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  807173:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  807175:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807179:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  80717f:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  807182:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807186:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  80718c:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  80718f:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  807196:	00 00 00 
+  807199:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80719d:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  8071a1:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8071a8:	00 
+  8071a9:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8071af:	48 63 d0             	movslq %eax,%rdx
+  8071b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8071b6:	48 01 d0             	add    %rdx,%rax
+  8071b9:	48 83 e8 01          	sub    $0x1,%rax
+  8071bd:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8071c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8071c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8071ca:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8071ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8071d2:	48 29 d0             	sub    %rdx,%rax
+  8071d5:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8071db:	85 c0                	test   %eax,%eax
+  8071dd:	0f 48 c2             	cmovs  %edx,%eax
+  8071e0:	c1 f8 0c             	sar    $0xc,%eax
+  8071e3:	48 98                	cltq
+  8071e5:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  8071e9:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8071ed:	48 85 c0             	test   %rax,%rax
+  8071f0:	0f 95 c0             	setne  %al
+  8071f3:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8071f6:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8071fd:	00 
+  8071fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807202:	48 83 c0 0b          	add    $0xb,%rax
+  807206:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80720a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80720e:	ba 00 00 00 00       	mov    $0x0,%edx
+  807213:	48 f7 75 c8          	divq   -0x38(%rbp)
+  807217:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80721b:	48 29 d0             	sub    %rdx,%rax
+  80721e:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  807222:	89 c7                	mov    %eax,%edi
+  807224:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80722b:	00 00 00 
+  80722e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  807231:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  807235:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  807239:	48 83 ec 08          	sub    $0x8,%rsp
+  80723d:	6a 00                	push   $0x0
+  80723f:	6a 00                	push   $0x0
+  807241:	6a 05                	push   $0x5
+  807243:	41 89 f1             	mov    %esi,%r9d
+  807246:	49 89 c8             	mov    %rcx,%r8
+  807249:	89 f9                	mov    %edi,%ecx
+  80724b:	be 08 00 00 00       	mov    $0x8,%esi
+  807250:	89 c7                	mov    %eax,%edi
+  807252:	49 89 df             	mov    %rbx,%r15
+  807255:	48 b8 b4 cf ff ff ff 	movabs $0xffffffffffffcfb4,%rax
+  80725c:	ff ff ff 
+  80725f:	48 01 d8             	add    %rbx,%rax
+  807262:	ff d0                	call   *%rax
+  807264:	48 83 c4 20          	add    $0x20,%rsp
+}
+  807268:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80726c:	5b                   	pop    %rbx
+  80726d:	41 5f                	pop    %r15
+  80726f:	5d                   	pop    %rbp
+  807270:	c3                   	ret
+
+0000000000807271 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  807271:	55                   	push   %rbp
+  807272:	48 89 e5             	mov    %rsp,%rbp
+  807275:	48 83 ec 10          	sub    $0x10,%rsp
+  807279:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807279 <nsipc_socket+0x8>
+  807280:	49 bb c7 3d 00 00 00 	movabs $0x3dc7,%r11
+  807287:	00 00 00 
+  80728a:	4c 01 d8             	add    %r11,%rax
+  80728d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  807290:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  807293:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  807296:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80729d:	00 00 00 
+  8072a0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8072a3:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8072a6:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8072ad:	00 00 00 
+  8072b0:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8072b3:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8072b7:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8072be:	00 00 00 
+  8072c1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8072c4:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8072c8:	bf 09 00 00 00       	mov    $0x9,%edi
+  8072cd:	48 ba 46 bb ff ff ff 	movabs $0xffffffffffffbb46,%rdx
+  8072d4:	ff ff ff 
+  8072d7:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8072db:	ff d0                	call   *%rax
+}
+  8072dd:	c9                   	leave
+  8072de:	c3                   	ret
+
+00000000008072df <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  8072df:	55                   	push   %rbp
+  8072e0:	48 89 e5             	mov    %rsp,%rbp
+  8072e3:	41 57                	push   %r15
+  8072e5:	53                   	push   %rbx
+  8072e6:	48 83 ec 30          	sub    $0x30,%rsp
+  8072ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8072ea <pipe+0xb>
+  8072f1:	49 bb 56 3d 00 00 00 	movabs $0x3d56,%r11
+  8072f8:	00 00 00 
+  8072fb:	4c 01 db             	add    %r11,%rbx
+  8072fe:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  807302:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  807306:	48 89 c7             	mov    %rax,%rdi
+  807309:	49 89 df             	mov    %rbx,%r15
+  80730c:	48 b8 2e 8d ff ff ff 	movabs $0xffffffffffff8d2e,%rax
+  807313:	ff ff ff 
+  807316:	48 01 d8             	add    %rbx,%rax
+  807319:	ff d0                	call   *%rax
+  80731b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80731e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807322:	0f 88 12 02 00 00    	js     80753a <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  807328:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80732c:	ba 07 04 00 00       	mov    $0x407,%edx
+  807331:	48 89 c6             	mov    %rax,%rsi
+  807334:	bf 00 00 00 00       	mov    $0x0,%edi
+  807339:	49 89 df             	mov    %rbx,%r15
+  80733c:	48 b8 7f 79 ff ff ff 	movabs $0xffffffffffff797f,%rax
+  807343:	ff ff ff 
+  807346:	48 01 d8             	add    %rbx,%rax
+  807349:	ff d0                	call   *%rax
+  80734b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80734e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807352:	0f 88 e2 01 00 00    	js     80753a <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  807358:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80735c:	48 89 c7             	mov    %rax,%rdi
+  80735f:	49 89 df             	mov    %rbx,%r15
+  807362:	48 b8 2e 8d ff ff ff 	movabs $0xffffffffffff8d2e,%rax
+  807369:	ff ff ff 
+  80736c:	48 01 d8             	add    %rbx,%rax
+  80736f:	ff d0                	call   *%rax
+  807371:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807374:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807378:	0f 88 9b 01 00 00    	js     807519 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80737e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  807382:	ba 07 04 00 00       	mov    $0x407,%edx
+  807387:	48 89 c6             	mov    %rax,%rsi
+  80738a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80738f:	49 89 df             	mov    %rbx,%r15
+  807392:	48 b8 7f 79 ff ff ff 	movabs $0xffffffffffff797f,%rax
+  807399:	ff ff ff 
+  80739c:	48 01 d8             	add    %rbx,%rax
+  80739f:	ff d0                	call   *%rax
+  8073a1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8073a4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8073a8:	0f 88 6b 01 00 00    	js     807519 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8073ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8073b2:	48 89 c7             	mov    %rax,%rdi
+  8073b5:	49 89 df             	mov    %rbx,%r15
+  8073b8:	48 b8 eb 8c ff ff ff 	movabs $0xffffffffffff8ceb,%rax
+  8073bf:	ff ff ff 
+  8073c2:	48 01 d8             	add    %rbx,%rax
+  8073c5:	ff d0                	call   *%rax
+  8073c7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8073cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8073cf:	ba 07 04 00 00       	mov    $0x407,%edx
+  8073d4:	48 89 c6             	mov    %rax,%rsi
+  8073d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8073dc:	49 89 df             	mov    %rbx,%r15
+  8073df:	48 b8 7f 79 ff ff ff 	movabs $0xffffffffffff797f,%rax
+  8073e6:	ff ff ff 
+  8073e9:	48 01 d8             	add    %rbx,%rax
+  8073ec:	ff d0                	call   *%rax
+  8073ee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8073f1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8073f5:	0f 88 fd 00 00 00    	js     8074f8 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8073fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8073ff:	48 89 c7             	mov    %rax,%rdi
+  807402:	49 89 df             	mov    %rbx,%r15
+  807405:	48 b8 eb 8c ff ff ff 	movabs $0xffffffffffff8ceb,%rax
+  80740c:	ff ff ff 
+  80740f:	48 01 d8             	add    %rbx,%rax
+  807412:	ff d0                	call   *%rax
+  807414:	48 89 c2             	mov    %rax,%rdx
+  807417:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80741b:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  807421:	48 89 d1             	mov    %rdx,%rcx
+  807424:	ba 00 00 00 00       	mov    $0x0,%edx
+  807429:	48 89 c6             	mov    %rax,%rsi
+  80742c:	bf 00 00 00 00       	mov    $0x0,%edi
+  807431:	49 89 df             	mov    %rbx,%r15
+  807434:	48 b8 e4 79 ff ff ff 	movabs $0xffffffffffff79e4,%rax
+  80743b:	ff ff ff 
+  80743e:	48 01 d8             	add    %rbx,%rax
+  807441:	ff d0                	call   *%rax
+  807443:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807446:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80744a:	0f 88 87 00 00 00    	js     8074d7 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  807450:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807454:	48 ba e0 00 00 00 00 	movabs $0xe0,%rdx
+  80745b:	00 00 00 
+  80745e:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  807461:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  807463:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807467:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  80746e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  807472:	48 ba e0 00 00 00 00 	movabs $0xe0,%rdx
+  807479:	00 00 00 
+  80747c:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80747f:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  807481:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  807485:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  80748c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807490:	48 89 c7             	mov    %rax,%rdi
+  807493:	49 89 df             	mov    %rbx,%r15
+  807496:	48 b8 b4 8c ff ff ff 	movabs $0xffffffffffff8cb4,%rax
+  80749d:	ff ff ff 
+  8074a0:	48 01 d8             	add    %rbx,%rax
+  8074a3:	ff d0                	call   *%rax
+  8074a5:	89 c2                	mov    %eax,%edx
+  8074a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8074ab:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  8074ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8074b1:	48 89 c7             	mov    %rax,%rdi
+  8074b4:	49 89 df             	mov    %rbx,%r15
+  8074b7:	48 b8 b4 8c ff ff ff 	movabs $0xffffffffffff8cb4,%rax
+  8074be:	ff ff ff 
+  8074c1:	48 01 d8             	add    %rbx,%rax
+  8074c4:	ff d0                	call   *%rax
+  8074c6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8074ca:	48 83 c2 04          	add    $0x4,%rdx
+  8074ce:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  8074d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8074d5:	eb 67                	jmp    80753e <pipe+0x25f>
+		goto err3;
+  8074d7:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  8074d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8074dc:	48 89 c6             	mov    %rax,%rsi
+  8074df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8074e4:	49 89 df             	mov    %rbx,%r15
+  8074e7:	48 b8 57 7a ff ff ff 	movabs $0xffffffffffff7a57,%rax
+  8074ee:	ff ff ff 
+  8074f1:	48 01 d8             	add    %rbx,%rax
+  8074f4:	ff d0                	call   *%rax
+  8074f6:	eb 01                	jmp    8074f9 <pipe+0x21a>
+		goto err2;
+  8074f8:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  8074f9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8074fd:	48 89 c6             	mov    %rax,%rsi
+  807500:	bf 00 00 00 00       	mov    $0x0,%edi
+  807505:	49 89 df             	mov    %rbx,%r15
+  807508:	48 b8 57 7a ff ff ff 	movabs $0xffffffffffff7a57,%rax
+  80750f:	ff ff ff 
+  807512:	48 01 d8             	add    %rbx,%rax
+  807515:	ff d0                	call   *%rax
+  807517:	eb 01                	jmp    80751a <pipe+0x23b>
+		goto err1;
+  807519:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  80751a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80751e:	48 89 c6             	mov    %rax,%rsi
+  807521:	bf 00 00 00 00       	mov    $0x0,%edi
+  807526:	49 89 df             	mov    %rbx,%r15
+  807529:	48 b8 57 7a ff ff ff 	movabs $0xffffffffffff7a57,%rax
+  807530:	ff ff ff 
+  807533:	48 01 d8             	add    %rbx,%rax
+  807536:	ff d0                	call   *%rax
+  807538:	eb 01                	jmp    80753b <pipe+0x25c>
+		goto err;
+  80753a:	90                   	nop
+err:
+	return r;
+  80753b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80753e:	48 83 c4 30          	add    $0x30,%rsp
+  807542:	5b                   	pop    %rbx
+  807543:	41 5f                	pop    %r15
+  807545:	5d                   	pop    %rbp
+  807546:	c3                   	ret
+
+0000000000807547 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  807547:	55                   	push   %rbp
+  807548:	48 89 e5             	mov    %rsp,%rbp
+  80754b:	41 57                	push   %r15
+  80754d:	41 54                	push   %r12
+  80754f:	53                   	push   %rbx
+  807550:	48 83 ec 28          	sub    $0x28,%rsp
+  807554:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807554 <_pipeisclosed+0xd>
+  80755b:	49 bb ec 3a 00 00 00 	movabs $0x3aec,%r11
+  807562:	00 00 00 
+  807565:	4c 01 db             	add    %r11,%rbx
+  807568:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80756c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  807570:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807577:	ff ff ff 
+  80757a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80757e:	48 8b 00             	mov    (%rax),%rax
+  807581:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  807587:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  80758a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80758e:	48 89 c7             	mov    %rax,%rdi
+  807591:	49 89 df             	mov    %rbx,%r15
+  807594:	48 b8 3b d4 ff ff ff 	movabs $0xffffffffffffd43b,%rax
+  80759b:	ff ff ff 
+  80759e:	48 01 d8             	add    %rbx,%rax
+  8075a1:	ff d0                	call   *%rax
+  8075a3:	41 89 c4             	mov    %eax,%r12d
+  8075a6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8075aa:	48 89 c7             	mov    %rax,%rdi
+  8075ad:	49 89 df             	mov    %rbx,%r15
+  8075b0:	48 b8 3b d4 ff ff ff 	movabs $0xffffffffffffd43b,%rax
+  8075b7:	ff ff ff 
+  8075ba:	48 01 d8             	add    %rbx,%rax
+  8075bd:	ff d0                	call   *%rax
+  8075bf:	41 39 c4             	cmp    %eax,%r12d
+  8075c2:	0f 94 c0             	sete   %al
+  8075c5:	0f b6 c0             	movzbl %al,%eax
+  8075c8:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  8075cb:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8075d2:	ff ff ff 
+  8075d5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8075d9:	48 8b 00             	mov    (%rax),%rax
+  8075dc:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8075e2:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  8075e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8075e8:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8075eb:	75 05                	jne    8075f2 <_pipeisclosed+0xab>
+			return ret;
+  8075ed:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8075f0:	eb 63                	jmp    807655 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  8075f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8075f5:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8075f8:	0f 84 72 ff ff ff    	je     807570 <_pipeisclosed+0x29>
+  8075fe:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  807602:	0f 85 68 ff ff ff    	jne    807570 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  807608:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80760f:	ff ff ff 
+  807612:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807616:	48 8b 00             	mov    (%rax),%rax
+  807619:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  80761f:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  807622:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807625:	89 c6                	mov    %eax,%esi
+  807627:	48 b8 e1 dd ff ff ff 	movabs $0xffffffffffffdde1,%rax
+  80762e:	ff ff ff 
+  807631:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807635:	48 89 c7             	mov    %rax,%rdi
+  807638:	49 89 df             	mov    %rbx,%r15
+  80763b:	b8 00 00 00 00       	mov    $0x0,%eax
+  807640:	49 b8 01 5f ff ff ff 	movabs $0xffffffffffff5f01,%r8
+  807647:	ff ff ff 
+  80764a:	49 01 d8             	add    %rbx,%r8
+  80764d:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  807650:	e9 1b ff ff ff       	jmp    807570 <_pipeisclosed+0x29>
+	}
+}
+  807655:	48 83 c4 28          	add    $0x28,%rsp
+  807659:	5b                   	pop    %rbx
+  80765a:	41 5c                	pop    %r12
+  80765c:	41 5f                	pop    %r15
+  80765e:	5d                   	pop    %rbp
+  80765f:	c3                   	ret
+
+0000000000807660 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  807660:	55                   	push   %rbp
+  807661:	48 89 e5             	mov    %rsp,%rbp
+  807664:	41 57                	push   %r15
+  807666:	53                   	push   %rbx
+  807667:	48 83 ec 30          	sub    $0x30,%rsp
+  80766b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80766b <pipeisclosed+0xb>
+  807672:	49 bb d5 39 00 00 00 	movabs $0x39d5,%r11
+  807679:	00 00 00 
+  80767c:	4c 01 db             	add    %r11,%rbx
+  80767f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  807682:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  807686:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  807689:	48 89 d6             	mov    %rdx,%rsi
+  80768c:	89 c7                	mov    %eax,%edi
+  80768e:	49 89 df             	mov    %rbx,%r15
+  807691:	48 b8 e4 8d ff ff ff 	movabs $0xffffffffffff8de4,%rax
+  807698:	ff ff ff 
+  80769b:	48 01 d8             	add    %rbx,%rax
+  80769e:	ff d0                	call   *%rax
+  8076a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8076a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8076a7:	79 05                	jns    8076ae <pipeisclosed+0x4e>
+		return r;
+  8076a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8076ac:	eb 3b                	jmp    8076e9 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8076ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8076b2:	48 89 c7             	mov    %rax,%rdi
+  8076b5:	49 89 df             	mov    %rbx,%r15
+  8076b8:	48 b8 eb 8c ff ff ff 	movabs $0xffffffffffff8ceb,%rax
+  8076bf:	ff ff ff 
+  8076c2:	48 01 d8             	add    %rbx,%rax
+  8076c5:	ff d0                	call   *%rax
+  8076c7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  8076cb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8076cf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8076d3:	48 89 d6             	mov    %rdx,%rsi
+  8076d6:	48 89 c7             	mov    %rax,%rdi
+  8076d9:	48 b8 07 c5 ff ff ff 	movabs $0xffffffffffffc507,%rax
+  8076e0:	ff ff ff 
+  8076e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8076e7:	ff d0                	call   *%rax
+}
+  8076e9:	48 83 c4 30          	add    $0x30,%rsp
+  8076ed:	5b                   	pop    %rbx
+  8076ee:	41 5f                	pop    %r15
+  8076f0:	5d                   	pop    %rbp
+  8076f1:	c3                   	ret
+
+00000000008076f2 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8076f2:	55                   	push   %rbp
+  8076f3:	48 89 e5             	mov    %rsp,%rbp
+  8076f6:	41 57                	push   %r15
+  8076f8:	53                   	push   %rbx
+  8076f9:	48 83 ec 40          	sub    $0x40,%rsp
+  8076fd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8076fd <devpipe_read+0xb>
+  807704:	49 bb 43 39 00 00 00 	movabs $0x3943,%r11
+  80770b:	00 00 00 
+  80770e:	4c 01 db             	add    %r11,%rbx
+  807711:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  807715:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  807719:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  80771d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807721:	48 89 c7             	mov    %rax,%rdi
+  807724:	49 89 df             	mov    %rbx,%r15
+  807727:	48 b8 eb 8c ff ff ff 	movabs $0xffffffffffff8ceb,%rax
+  80772e:	ff ff ff 
+  807731:	48 01 d8             	add    %rbx,%rax
+  807734:	ff d0                	call   *%rax
+  807736:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  80773a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80773e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  807742:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  807749:	00 
+  80774a:	e9 a1 00 00 00       	jmp    8077f0 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  80774f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  807754:	74 09                	je     80775f <devpipe_read+0x6d>
+				return i;
+  807756:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80775a:	e9 9f 00 00 00       	jmp    8077fe <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  80775f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807763:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807767:	48 89 d6             	mov    %rdx,%rsi
+  80776a:	48 89 c7             	mov    %rax,%rdi
+  80776d:	48 b8 07 c5 ff ff ff 	movabs $0xffffffffffffc507,%rax
+  807774:	ff ff ff 
+  807777:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80777b:	ff d0                	call   *%rax
+  80777d:	85 c0                	test   %eax,%eax
+  80777f:	74 07                	je     807788 <devpipe_read+0x96>
+				return 0;
+  807781:	b8 00 00 00 00       	mov    $0x0,%eax
+  807786:	eb 76                	jmp    8077fe <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  807788:	49 89 df             	mov    %rbx,%r15
+  80778b:	48 b8 2a 79 ff ff ff 	movabs $0xffffffffffff792a,%rax
+  807792:	ff ff ff 
+  807795:	48 01 d8             	add    %rbx,%rax
+  807798:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  80779a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80779e:	8b 10                	mov    (%rax),%edx
+  8077a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8077a4:	8b 40 04             	mov    0x4(%rax),%eax
+  8077a7:	39 c2                	cmp    %eax,%edx
+  8077a9:	74 a4                	je     80774f <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8077ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8077af:	8b 10                	mov    (%rax),%edx
+  8077b1:	89 d0                	mov    %edx,%eax
+  8077b3:	c1 f8 1f             	sar    $0x1f,%eax
+  8077b6:	c1 e8 1b             	shr    $0x1b,%eax
+  8077b9:	01 c2                	add    %eax,%edx
+  8077bb:	83 e2 1f             	and    $0x1f,%edx
+  8077be:	29 c2                	sub    %eax,%edx
+  8077c0:	89 d6                	mov    %edx,%esi
+  8077c2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8077c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8077ca:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8077ce:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8077d2:	48 63 c6             	movslq %esi,%rax
+  8077d5:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  8077da:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  8077dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8077e0:	8b 00                	mov    (%rax),%eax
+  8077e2:	8d 50 01             	lea    0x1(%rax),%edx
+  8077e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8077e9:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  8077eb:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8077f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8077f4:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8077f8:	72 a0                	jb     80779a <devpipe_read+0xa8>
+	}
+	return i;
+  8077fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8077fe:	48 83 c4 40          	add    $0x40,%rsp
+  807802:	5b                   	pop    %rbx
+  807803:	41 5f                	pop    %r15
+  807805:	5d                   	pop    %rbp
+  807806:	c3                   	ret
+
+0000000000807807 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  807807:	55                   	push   %rbp
+  807808:	48 89 e5             	mov    %rsp,%rbp
+  80780b:	41 57                	push   %r15
+  80780d:	53                   	push   %rbx
+  80780e:	48 83 ec 40          	sub    $0x40,%rsp
+  807812:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807812 <devpipe_write+0xb>
+  807819:	49 bb 2e 38 00 00 00 	movabs $0x382e,%r11
+  807820:	00 00 00 
+  807823:	4c 01 db             	add    %r11,%rbx
+  807826:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80782a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80782e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  807832:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807836:	48 89 c7             	mov    %rax,%rdi
+  807839:	49 89 df             	mov    %rbx,%r15
+  80783c:	48 b8 eb 8c ff ff ff 	movabs $0xffffffffffff8ceb,%rax
+  807843:	ff ff ff 
+  807846:	48 01 d8             	add    %rbx,%rax
+  807849:	ff d0                	call   *%rax
+  80784b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  80784f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  807853:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  807857:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80785e:	00 
+  80785f:	e9 a0 00 00 00       	jmp    807904 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  807864:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807868:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80786c:	48 89 d6             	mov    %rdx,%rsi
+  80786f:	48 89 c7             	mov    %rax,%rdi
+  807872:	48 b8 07 c5 ff ff ff 	movabs $0xffffffffffffc507,%rax
+  807879:	ff ff ff 
+  80787c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807880:	ff d0                	call   *%rax
+  807882:	85 c0                	test   %eax,%eax
+  807884:	74 0a                	je     807890 <devpipe_write+0x89>
+				return 0;
+  807886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80788b:	e9 82 00 00 00       	jmp    807912 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  807890:	49 89 df             	mov    %rbx,%r15
+  807893:	48 b8 2a 79 ff ff ff 	movabs $0xffffffffffff792a,%rax
+  80789a:	ff ff ff 
+  80789d:	48 01 d8             	add    %rbx,%rax
+  8078a0:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8078a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8078a6:	8b 40 04             	mov    0x4(%rax),%eax
+  8078a9:	48 63 d0             	movslq %eax,%rdx
+  8078ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8078b0:	8b 00                	mov    (%rax),%eax
+  8078b2:	48 98                	cltq
+  8078b4:	48 83 c0 20          	add    $0x20,%rax
+  8078b8:	48 39 c2             	cmp    %rax,%rdx
+  8078bb:	73 a7                	jae    807864 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8078bd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8078c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8078c5:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8078c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8078cd:	8b 50 04             	mov    0x4(%rax),%edx
+  8078d0:	89 d0                	mov    %edx,%eax
+  8078d2:	c1 f8 1f             	sar    $0x1f,%eax
+  8078d5:	c1 e8 1b             	shr    $0x1b,%eax
+  8078d8:	01 c2                	add    %eax,%edx
+  8078da:	83 e2 1f             	and    $0x1f,%edx
+  8078dd:	29 c2                	sub    %eax,%edx
+  8078df:	89 d0                	mov    %edx,%eax
+  8078e1:	0f b6 09             	movzbl (%rcx),%ecx
+  8078e4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8078e8:	48 98                	cltq
+  8078ea:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  8078ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8078f2:	8b 40 04             	mov    0x4(%rax),%eax
+  8078f5:	8d 50 01             	lea    0x1(%rax),%edx
+  8078f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8078fc:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  8078ff:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  807904:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807908:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80790c:	72 94                	jb     8078a2 <devpipe_write+0x9b>
+	}
+
+	return i;
+  80790e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  807912:	48 83 c4 40          	add    $0x40,%rsp
+  807916:	5b                   	pop    %rbx
+  807917:	41 5f                	pop    %r15
+  807919:	5d                   	pop    %rbp
+  80791a:	c3                   	ret
+
+000000000080791b <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80791b:	55                   	push   %rbp
+  80791c:	48 89 e5             	mov    %rsp,%rbp
+  80791f:	41 57                	push   %r15
+  807921:	53                   	push   %rbx
+  807922:	48 83 ec 20          	sub    $0x20,%rsp
+  807926:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807926 <devpipe_stat+0xb>
+  80792d:	49 bb 1a 37 00 00 00 	movabs $0x371a,%r11
+  807934:	00 00 00 
+  807937:	4c 01 db             	add    %r11,%rbx
+  80793a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80793e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  807942:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807946:	48 89 c7             	mov    %rax,%rdi
+  807949:	49 89 df             	mov    %rbx,%r15
+  80794c:	48 b8 eb 8c ff ff ff 	movabs $0xffffffffffff8ceb,%rax
+  807953:	ff ff ff 
+  807956:	48 01 d8             	add    %rbx,%rax
+  807959:	ff d0                	call   *%rax
+  80795b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  80795f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  807963:	48 ba f4 dd ff ff ff 	movabs $0xffffffffffffddf4,%rdx
+  80796a:	ff ff ff 
+  80796d:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  807971:	48 89 d6             	mov    %rdx,%rsi
+  807974:	48 89 c7             	mov    %rax,%rdi
+  807977:	49 89 df             	mov    %rbx,%r15
+  80797a:	48 b8 c3 6c ff ff ff 	movabs $0xffffffffffff6cc3,%rax
+  807981:	ff ff ff 
+  807984:	48 01 d8             	add    %rbx,%rax
+  807987:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  807989:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80798d:	8b 50 04             	mov    0x4(%rax),%edx
+  807990:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807994:	8b 00                	mov    (%rax),%eax
+  807996:	29 c2                	sub    %eax,%edx
+  807998:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80799c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8079a2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8079a6:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8079ad:	00 00 00 
+	stat->st_dev = &devpipe;
+  8079b0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8079b4:	48 ba e0 00 00 00 00 	movabs $0xe0,%rdx
+  8079bb:	00 00 00 
+  8079be:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8079c2:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  8079c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8079ce:	48 83 c4 20          	add    $0x20,%rsp
+  8079d2:	5b                   	pop    %rbx
+  8079d3:	41 5f                	pop    %r15
+  8079d5:	5d                   	pop    %rbp
+  8079d6:	c3                   	ret
+
+00000000008079d7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8079d7:	55                   	push   %rbp
+  8079d8:	48 89 e5             	mov    %rsp,%rbp
+  8079db:	41 57                	push   %r15
+  8079dd:	53                   	push   %rbx
+  8079de:	48 83 ec 10          	sub    $0x10,%rsp
+  8079e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8079e2 <devpipe_close+0xb>
+  8079e9:	49 bb 5e 36 00 00 00 	movabs $0x365e,%r11
+  8079f0:	00 00 00 
+  8079f3:	4c 01 db             	add    %r11,%rbx
+  8079f6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  8079fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8079fe:	48 89 c6             	mov    %rax,%rsi
+  807a01:	bf 00 00 00 00       	mov    $0x0,%edi
+  807a06:	49 89 df             	mov    %rbx,%r15
+  807a09:	48 b8 57 7a ff ff ff 	movabs $0xffffffffffff7a57,%rax
+  807a10:	ff ff ff 
+  807a13:	48 01 d8             	add    %rbx,%rax
+  807a16:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  807a18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807a1c:	48 89 c7             	mov    %rax,%rdi
+  807a1f:	49 89 df             	mov    %rbx,%r15
+  807a22:	48 b8 eb 8c ff ff ff 	movabs $0xffffffffffff8ceb,%rax
+  807a29:	ff ff ff 
+  807a2c:	48 01 d8             	add    %rbx,%rax
+  807a2f:	ff d0                	call   *%rax
+  807a31:	48 89 c6             	mov    %rax,%rsi
+  807a34:	bf 00 00 00 00       	mov    $0x0,%edi
+  807a39:	49 89 df             	mov    %rbx,%r15
+  807a3c:	48 b8 57 7a ff ff ff 	movabs $0xffffffffffff7a57,%rax
+  807a43:	ff ff ff 
+  807a46:	48 01 d8             	add    %rbx,%rax
+  807a49:	ff d0                	call   *%rax
+}
+  807a4b:	48 83 c4 10          	add    $0x10,%rsp
+  807a4f:	5b                   	pop    %rbx
+  807a50:	41 5f                	pop    %r15
+  807a52:	5d                   	pop    %rbp
+  807a53:	c3                   	ret
+
+0000000000807a54 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  807a54:	55                   	push   %rbp
+  807a55:	48 89 e5             	mov    %rsp,%rbp
+  807a58:	41 57                	push   %r15
+  807a5a:	53                   	push   %rbx
+  807a5b:	48 83 ec 20          	sub    $0x20,%rsp
+  807a5f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807a5f <wait+0xb>
+  807a66:	49 bb e1 35 00 00 00 	movabs $0x35e1,%r11
+  807a6d:	00 00 00 
+  807a70:	4c 01 db             	add    %r11,%rbx
+  807a73:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  807a76:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  807a7a:	75 50                	jne    807acc <wait+0x78>
+  807a7c:	48 b8 fb dd ff ff ff 	movabs $0xffffffffffffddfb,%rax
+  807a83:	ff ff ff 
+  807a86:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807a8a:	48 89 c1             	mov    %rax,%rcx
+  807a8d:	48 b8 06 de ff ff ff 	movabs $0xffffffffffffde06,%rax
+  807a94:	ff ff ff 
+  807a97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807a9b:	48 89 c2             	mov    %rax,%rdx
+  807a9e:	be 09 00 00 00       	mov    $0x9,%esi
+  807aa3:	48 b8 1b de ff ff ff 	movabs $0xffffffffffffde1b,%rax
+  807aaa:	ff ff ff 
+  807aad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807ab1:	48 89 c7             	mov    %rax,%rdi
+  807ab4:	49 89 df             	mov    %rbx,%r15
+  807ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+  807abc:	49 b8 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%r8
+  807ac3:	ff ff ff 
+  807ac6:	49 01 d8             	add    %rbx,%r8
+  807ac9:	41 ff d0             	call   *%r8
+	e = &envs[ENVX(envid)];
+  807acc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807acf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  807ad4:	48 98                	cltq
+  807ad6:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  807add:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  807ae4:	ff ff ff 
+  807ae7:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  807aeb:	48 01 d0             	add    %rdx,%rax
+  807aee:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  807af2:	eb 12                	jmp    807b06 <wait+0xb2>
+		sys_yield();
+  807af4:	49 89 df             	mov    %rbx,%r15
+  807af7:	48 b8 2a 79 ff ff ff 	movabs $0xffffffffffff792a,%rax
+  807afe:	ff ff ff 
+  807b01:	48 01 d8             	add    %rbx,%rax
+  807b04:	ff d0                	call   *%rax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  807b06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807b0a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  807b10:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  807b13:	75 0e                	jne    807b23 <wait+0xcf>
+  807b15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807b19:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  807b1f:	85 c0                	test   %eax,%eax
+  807b21:	75 d1                	jne    807af4 <wait+0xa0>
+}
+  807b23:	90                   	nop
+  807b24:	48 83 c4 20          	add    $0x20,%rsp
+  807b28:	5b                   	pop    %rbx
+  807b29:	41 5f                	pop    %r15
+  807b2b:	5d                   	pop    %rbp
+  807b2c:	c3                   	ret
+
+0000000000807b2d <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  807b2d:	55                   	push   %rbp
+  807b2e:	48 89 e5             	mov    %rsp,%rbp
+  807b31:	41 57                	push   %r15
+  807b33:	53                   	push   %rbx
+  807b34:	48 83 ec 20          	sub    $0x20,%rsp
+  807b38:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807b38 <set_pgfault_handler+0xb>
+  807b3f:	49 bb 08 35 00 00 00 	movabs $0x3508,%r11
+  807b46:	00 00 00 
+  807b49:	4c 01 db             	add    %r11,%rbx
+  807b4c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  807b50:	49 89 df             	mov    %rbx,%r15
+  807b53:	48 b8 d6 78 ff ff ff 	movabs $0xffffffffffff78d6,%rax
+  807b5a:	ff ff ff 
+  807b5d:	48 01 d8             	add    %rbx,%rax
+  807b60:	ff d0                	call   *%rax
+  807b62:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  807b65:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  807b6c:	00 00 00 
+  807b6f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807b73:	48 85 c0             	test   %rax,%rax
+  807b76:	75 6b                	jne    807be3 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  807b78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807b7b:	ba 07 00 00 00       	mov    $0x7,%edx
+  807b80:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  807b85:	48 89 ce             	mov    %rcx,%rsi
+  807b88:	89 c7                	mov    %eax,%edi
+  807b8a:	49 89 df             	mov    %rbx,%r15
+  807b8d:	48 b8 7f 79 ff ff ff 	movabs $0xffffffffffff797f,%rax
+  807b94:	ff ff ff 
+  807b97:	48 01 d8             	add    %rbx,%rax
+  807b9a:	ff d0                	call   *%rax
+  807b9c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  807b9f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  807ba3:	74 3e                	je     807be3 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  807ba5:	48 b8 28 de ff ff ff 	movabs $0xffffffffffffde28,%rax
+  807bac:	ff ff ff 
+  807baf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807bb3:	48 89 c2             	mov    %rax,%rdx
+  807bb6:	be 23 00 00 00       	mov    $0x23,%esi
+  807bbb:	48 b8 56 de ff ff ff 	movabs $0xffffffffffffde56,%rax
+  807bc2:	ff ff ff 
+  807bc5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807bc9:	48 89 c7             	mov    %rax,%rdi
+  807bcc:	49 89 df             	mov    %rbx,%r15
+  807bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  807bd4:	48 b9 2a 5c ff ff ff 	movabs $0xffffffffffff5c2a,%rcx
+  807bdb:	ff ff ff 
+  807bde:	48 01 d9             	add    %rbx,%rcx
+  807be1:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  807be3:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  807bea:	00 00 00 
+  807bed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807bf1:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  807bf5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807bf8:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  807bff:	ff ff ff 
+  807c02:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  807c06:	48 89 d6             	mov    %rdx,%rsi
+  807c09:	89 c7                	mov    %eax,%edi
+  807c0b:	49 89 df             	mov    %rbx,%r15
+  807c0e:	48 b8 75 7b ff ff ff 	movabs $0xffffffffffff7b75,%rax
+  807c15:	ff ff ff 
+  807c18:	48 01 d8             	add    %rbx,%rax
+  807c1b:	ff d0                	call   *%rax
+}
+  807c1d:	90                   	nop
+  807c1e:	48 83 c4 20          	add    $0x20,%rsp
+  807c22:	5b                   	pop    %rbx
+  807c23:	41 5f                	pop    %r15
+  807c25:	5d                   	pop    %rbp
+  807c26:	c3                   	ret
+
+0000000000807c27 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  807c27:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  807c2a:	48 a1 00 10 82 00 00 	movabs 0x821000,%rax
+  807c31:	00 00 00 
+call *%rax
+  807c34:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  807c36:	58                   	pop    %rax
+	popq %rax;
+  807c37:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  807c38:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  807c3f:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  807c43:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  807c47:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  807c4b:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  807c4f:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  807c53:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  807c56:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  807c5a:	4c 8b 3c 24          	mov    (%rsp),%r15
+  807c5e:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  807c63:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  807c68:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  807c6d:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  807c72:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  807c77:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  807c7c:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  807c81:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  807c86:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  807c8b:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  807c90:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  807c95:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  807c9a:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  807c9f:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  807ca4:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  807ca8:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  807cac:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  807cad:	5c                   	pop    %rsp
+	ret;			//return
+  807cae:	c3                   	ret
+
+0000000000807caf <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  807caf:	55                   	push   %rbp
+  807cb0:	48 89 e5             	mov    %rsp,%rbp
+  807cb3:	41 57                	push   %r15
+  807cb5:	53                   	push   %rbx
+  807cb6:	48 83 ec 30          	sub    $0x30,%rsp
+  807cba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807cba <ipc_recv+0xb>
+  807cc1:	49 bb 86 33 00 00 00 	movabs $0x3386,%r11
+  807cc8:	00 00 00 
+  807ccb:	4c 01 db             	add    %r11,%rbx
+  807cce:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  807cd2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  807cd6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  807cda:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  807cdf:	75 0e                	jne    807cef <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  807ce1:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  807ce8:	00 00 00 
+  807ceb:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  807cef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  807cf3:	48 89 c7             	mov    %rax,%rdi
+  807cf6:	49 89 df             	mov    %rbx,%r15
+  807cf9:	48 b8 a8 7c ff ff ff 	movabs $0xffffffffffff7ca8,%rax
+  807d00:	ff ff ff 
+  807d03:	48 01 d8             	add    %rbx,%rax
+  807d06:	ff d0                	call   *%rax
+  807d08:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  807d0b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  807d10:	74 2a                	je     807d3c <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  807d12:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807d16:	75 19                	jne    807d31 <ipc_recv+0x82>
+  807d18:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807d1f:	ff ff ff 
+  807d22:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807d26:	48 8b 00             	mov    (%rax),%rax
+  807d29:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  807d2f:	eb 05                	jmp    807d36 <ipc_recv+0x87>
+  807d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  807d36:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  807d3a:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  807d3c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  807d41:	74 2a                	je     807d6d <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  807d43:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807d47:	75 19                	jne    807d62 <ipc_recv+0xb3>
+  807d49:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807d50:	ff ff ff 
+  807d53:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807d57:	48 8b 00             	mov    (%rax),%rax
+  807d5a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  807d60:	eb 05                	jmp    807d67 <ipc_recv+0xb8>
+  807d62:	b8 00 00 00 00       	mov    $0x0,%eax
+  807d67:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  807d6b:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  807d6d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807d71:	74 05                	je     807d78 <ipc_recv+0xc9>
+		return res;
+  807d73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807d76:	eb 17                	jmp    807d8f <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  807d78:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807d7f:	ff ff ff 
+  807d82:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807d86:	48 8b 00             	mov    (%rax),%rax
+  807d89:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  807d8f:	48 83 c4 30          	add    $0x30,%rsp
+  807d93:	5b                   	pop    %rbx
+  807d94:	41 5f                	pop    %r15
+  807d96:	5d                   	pop    %rbp
+  807d97:	c3                   	ret
+
+0000000000807d98 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  807d98:	55                   	push   %rbp
+  807d99:	48 89 e5             	mov    %rsp,%rbp
+  807d9c:	41 57                	push   %r15
+  807d9e:	53                   	push   %rbx
+  807d9f:	48 83 ec 20          	sub    $0x20,%rsp
+  807da3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807da3 <ipc_send+0xb>
+  807daa:	49 bb 9d 32 00 00 00 	movabs $0x329d,%r11
+  807db1:	00 00 00 
+  807db4:	4c 01 db             	add    %r11,%rbx
+  807db7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  807dba:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  807dbd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  807dc1:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  807dc4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  807dc9:	75 0e                	jne    807dd9 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  807dcb:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  807dd2:	00 00 00 
+  807dd5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  807dd9:	90                   	nop
+  807dda:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  807ddd:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  807de0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807de4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807de7:	89 c7                	mov    %eax,%edi
+  807de9:	49 89 df             	mov    %rbx,%r15
+  807dec:	48 b8 3e 7c ff ff ff 	movabs $0xffffffffffff7c3e,%rax
+  807df3:	ff ff ff 
+  807df6:	48 01 d8             	add    %rbx,%rax
+  807df9:	ff d0                	call   *%rax
+  807dfb:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  807dfe:	74 da                	je     807dda <ipc_send+0x42>
+		;
+}
+  807e00:	90                   	nop
+  807e01:	90                   	nop
+  807e02:	48 83 c4 20          	add    $0x20,%rsp
+  807e06:	5b                   	pop    %rbx
+  807e07:	41 5f                	pop    %r15
+  807e09:	5d                   	pop    %rbp
+  807e0a:	c3                   	ret
+
+0000000000807e0b <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  807e0b:	55                   	push   %rbp
+  807e0c:	48 89 e5             	mov    %rsp,%rbp
+  807e0f:	41 57                	push   %r15
+  807e11:	53                   	push   %rbx
+  807e12:	48 83 ec 40          	sub    $0x40,%rsp
+  807e16:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807e16 <ipc_call+0xb>
+  807e1d:	49 bb 2a 32 00 00 00 	movabs $0x322a,%r11
+  807e24:	00 00 00 
+  807e27:	4c 01 db             	add    %r11,%rbx
+  807e2a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  807e2d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  807e30:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  807e34:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  807e37:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  807e3b:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  807e3f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  807e44:	75 0e                	jne    807e54 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  807e46:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  807e4d:	00 00 00 
+  807e50:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  807e54:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  807e59:	75 0e                	jne    807e69 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  807e5b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  807e62:	00 00 00 
+  807e65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  807e69:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  807e6c:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  807e70:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  807e73:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  807e77:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807e7a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  807e80:	49 89 f8             	mov    %rdi,%r8
+  807e83:	89 c7                	mov    %eax,%edi
+  807e85:	49 89 df             	mov    %rbx,%r15
+  807e88:	48 b8 01 7d ff ff ff 	movabs $0xffffffffffff7d01,%rax
+  807e8f:	ff ff ff 
+  807e92:	48 01 d8             	add    %rbx,%rax
+  807e95:	ff d0                	call   *%rax
+  807e97:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  807e9a:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  807e9f:	74 2a                	je     807ecb <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  807ea1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807ea5:	75 19                	jne    807ec0 <ipc_call+0xb5>
+  807ea7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807eae:	ff ff ff 
+  807eb1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807eb5:	48 8b 00             	mov    (%rax),%rax
+  807eb8:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  807ebe:	eb 05                	jmp    807ec5 <ipc_call+0xba>
+  807ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+  807ec5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  807ec9:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  807ecb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807ecf:	74 05                	je     807ed6 <ipc_call+0xcb>
+		return r;
+  807ed1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807ed4:	eb 17                	jmp    807eed <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  807ed6:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807edd:	ff ff ff 
+  807ee0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807ee4:	48 8b 00             	mov    (%rax),%rax
+  807ee7:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  807eed:	48 83 c4 40          	add    $0x40,%rsp
+  807ef1:	5b                   	pop    %rbx
+  807ef2:	41 5f                	pop    %r15
+  807ef4:	5d                   	pop    %rbp
+  807ef5:	c3                   	ret
+
+0000000000807ef6 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  807ef6:	55                   	push   %rbp
+  807ef7:	48 89 e5             	mov    %rsp,%rbp
+  807efa:	41 57                	push   %r15
+  807efc:	53                   	push   %rbx
+  807efd:	48 83 ec 70          	sub    $0x70,%rsp
+  807f01:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807f01 <ipc_callw+0xb>
+  807f08:	49 bb 3f 31 00 00 00 	movabs $0x313f,%r11
+  807f0f:	00 00 00 
+  807f12:	4c 01 db             	add    %r11,%rbx
+  807f15:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  807f18:	89 75 98             	mov    %esi,-0x68(%rbp)
+  807f1b:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  807f1f:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  807f23:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  807f28:	76 0a                	jbe    807f34 <ipc_callw+0x3e>
+		return -E_INVAL;
+  807f2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807f2f:	e9 b7 00 00 00       	jmp    807feb <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  807f34:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  807f38:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  807f3c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  807f40:	48 89 ce             	mov    %rcx,%rsi
+  807f43:	48 89 c7             	mov    %rax,%rdi
+  807f46:	49 89 df             	mov    %rbx,%r15
+  807f49:	48 b8 a3 70 ff ff ff 	movabs $0xffffffffffff70a3,%rax
+  807f50:	ff ff ff 
+  807f53:	48 01 d8             	add    %rbx,%rax
+  807f56:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  807f58:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  807f5f:	00 
+  807f60:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  807f64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807f68:	48 01 d0             	add    %rdx,%rax
+  807f6b:	48 83 e8 01          	sub    $0x1,%rax
+  807f6f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  807f73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807f77:	ba 00 00 00 00       	mov    $0x0,%edx
+  807f7c:	48 f7 75 e8          	divq   -0x18(%rbp)
+  807f80:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807f84:	48 29 d0             	sub    %rdx,%rax
+  807f87:	48 c1 e8 03          	shr    $0x3,%rax
+  807f8b:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  807f8f:	89 c1                	mov    %eax,%ecx
+  807f91:	8b 75 98             	mov    -0x68(%rbp),%esi
+  807f94:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  807f98:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  807f9b:	49 89 d1             	mov    %rdx,%r9
+  807f9e:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  807fa5:	00 00 00 
+  807fa8:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  807faf:	00 00 00 
+  807fb2:	89 c7                	mov    %eax,%edi
+  807fb4:	49 89 df             	mov    %rbx,%r15
+  807fb7:	48 b8 01 7d ff ff ff 	movabs $0xffffffffffff7d01,%rax
+  807fbe:	ff ff ff 
+  807fc1:	48 01 d8             	add    %rbx,%rax
+  807fc4:	ff d0                	call   *%rax
+  807fc6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  807fc9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  807fcd:	74 05                	je     807fd4 <ipc_callw+0xde>
+		return r;
+  807fcf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807fd2:	eb 17                	jmp    807feb <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  807fd4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807fdb:	ff ff ff 
+  807fde:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807fe2:	48 8b 00             	mov    (%rax),%rax
+  807fe5:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  807feb:	48 83 c4 70          	add    $0x70,%rsp
+  807fef:	5b                   	pop    %rbx
+  807ff0:	41 5f                	pop    %r15
+  807ff2:	5d                   	pop    %rbp
+  807ff3:	c3                   	ret
+
+0000000000807ff4 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  807ff4:	55                   	push   %rbp
+  807ff5:	48 89 e5             	mov    %rsp,%rbp
+  807ff8:	41 57                	push   %r15
+  807ffa:	53                   	push   %rbx
+  807ffb:	48 83 ec 40          	sub    $0x40,%rsp
+  807fff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807fff <ipc_callv+0xb>
+  808006:	49 bb 41 30 00 00 00 	movabs $0x3041,%r11
+  80800d:	00 00 00 
+  808010:	4c 01 db             	add    %r11,%rbx
+  808013:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  808016:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  808019:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80801d:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  808020:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  808024:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  808028:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80802f:	00 00 00 
+  808032:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  808036:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  80803a:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80803e:	74 11                	je     808051 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  808040:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  808044:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  808048:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80804b:	c1 e0 14             	shl    $0x14,%eax
+  80804e:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  808051:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  808055:	74 14                	je     80806b <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  808057:	8b 45 20             	mov    0x20(%rbp),%eax
+  80805a:	83 e8 01             	sub    $0x1,%eax
+  80805d:	48 63 d0             	movslq %eax,%rdx
+  808060:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  808064:	48 09 d0             	or     %rdx,%rax
+  808067:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  80806b:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80806e:	c1 e0 10             	shl    $0x10,%eax
+  808071:	0b 45 10             	or     0x10(%rbp),%eax
+  808074:	89 c1                	mov    %eax,%ecx
+  808076:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  808079:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  80807d:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  808081:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  808085:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  808088:	4d 89 c1             	mov    %r8,%r9
+  80808b:	49 89 f8             	mov    %rdi,%r8
+  80808e:	89 c7                	mov    %eax,%edi
+  808090:	49 89 df             	mov    %rbx,%r15
+  808093:	48 b8 01 7d ff ff ff 	movabs $0xffffffffffff7d01,%rax
+  80809a:	ff ff ff 
+  80809d:	48 01 d8             	add    %rbx,%rax
+  8080a0:	ff d0                	call   *%rax
+  8080a2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8080a5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8080a9:	74 05                	je     8080b0 <ipc_callv+0xbc>
+		return r;
+  8080ab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8080ae:	eb 17                	jmp    8080c7 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  8080b0:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8080b7:	ff ff ff 
+  8080ba:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8080be:	48 8b 00             	mov    (%rax),%rax
+  8080c1:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8080c7:	48 83 c4 40          	add    $0x40,%rsp
+  8080cb:	5b                   	pop    %rbx
+  8080cc:	41 5f                	pop    %r15
+  8080ce:	5d                   	pop    %rbp
+  8080cf:	c3                   	ret
+
+00000000008080d0 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8080d0:	55                   	push   %rbp
+  8080d1:	48 89 e5             	mov    %rsp,%rbp
+  8080d4:	41 57                	push   %r15
+  8080d6:	53                   	push   %rbx
+  8080d7:	48 83 ec 40          	sub    $0x40,%rsp
+  8080db:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8080db <ipc_reply_recv+0xb>
+  8080e2:	49 bb 65 2f 00 00 00 	movabs $0x2f65,%r11
+  8080e9:	00 00 00 
+  8080ec:	4c 01 db             	add    %r11,%rbx
+  8080ef:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8080f2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8080f5:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8080f9:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8080fc:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  808100:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  808104:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  808109:	75 0e                	jne    808119 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  80810b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  808112:	00 00 00 
+  808115:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  808119:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80811e:	75 0e                	jne    80812e <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  808120:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  808127:	00 00 00 
+  80812a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  80812e:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  808131:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  808135:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  808139:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80813c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  808140:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808143:	4d 89 c1             	mov    %r8,%r9
+  808146:	49 89 f8             	mov    %rdi,%r8
+  808149:	89 c7                	mov    %eax,%edi
+  80814b:	49 89 df             	mov    %rbx,%r15
+  80814e:	48 b8 75 7d ff ff ff 	movabs $0xffffffffffff7d75,%rax
+  808155:	ff ff ff 
+  808158:	48 01 d8             	add    %rbx,%rax
+  80815b:	ff d0                	call   *%rax
+  80815d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  808160:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  808165:	74 2a                	je     808191 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  808167:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80816b:	75 19                	jne    808186 <ipc_reply_recv+0xb6>
+  80816d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  808174:	ff ff ff 
+  808177:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80817b:	48 8b 00             	mov    (%rax),%rax
+  80817e:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  808184:	eb 05                	jmp    80818b <ipc_reply_recv+0xbb>
+  808186:	b8 00 00 00 00       	mov    $0x0,%eax
+  80818b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80818f:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  808191:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  808196:	74 2a                	je     8081c2 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  808198:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80819c:	75 19                	jne    8081b7 <ipc_reply_recv+0xe7>
+  80819e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8081a5:	ff ff ff 
+  8081a8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8081ac:	48 8b 00             	mov    (%rax),%rax
+  8081af:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8081b5:	eb 05                	jmp    8081bc <ipc_reply_recv+0xec>
+  8081b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8081bc:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  8081c0:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8081c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8081c6:	74 05                	je     8081cd <ipc_reply_recv+0xfd>
+		return r;
+  8081c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8081cb:	eb 17                	jmp    8081e4 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  8081cd:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8081d4:	ff ff ff 
+  8081d7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8081db:	48 8b 00             	mov    (%rax),%rax
+  8081de:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8081e4:	48 83 c4 40          	add    $0x40,%rsp
+  8081e8:	5b                   	pop    %rbx
+  8081e9:	41 5f                	pop    %r15
+  8081eb:	5d                   	pop    %rbp
+  8081ec:	c3                   	ret
+
+00000000008081ed <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  8081ed:	55                   	push   %rbp
+  8081ee:	48 89 e5             	mov    %rsp,%rbp
+  8081f1:	41 57                	push   %r15
+  8081f3:	53                   	push   %rbx
+  8081f4:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  8081fb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8081fb <ipc_window_batch+0xe>
+  808202:	49 bb 45 2e 00 00 00 	movabs $0x2e45,%r11
+  808209:	00 00 00 
+  80820c:	4c 01 db             	add    %r11,%rbx
+  80820f:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  808215:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  80821c:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  808222:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  808228:	e9 15 01 00 00       	jmp    808342 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  80822d:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  808233:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  808236:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  80823d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  808240:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  808243:	39 c2                	cmp    %eax,%edx
+  808245:	0f 4e c2             	cmovle %edx,%eax
+  808248:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  80824b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  808252:	eb 6b                	jmp    8082bf <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  808254:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808257:	48 98                	cltq
+  808259:	48 c1 e0 05          	shl    $0x5,%rax
+  80825d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  808261:	48 01 e8             	add    %rbp,%rax
+  808264:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  80826a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  808270:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808273:	c1 e0 0c             	shl    $0xc,%eax
+  808276:	48 63 d0             	movslq %eax,%rdx
+  808279:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  808280:	48 01 c2             	add    %rax,%rdx
+  808283:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808286:	48 98                	cltq
+  808288:	48 c1 e0 05          	shl    $0x5,%rax
+  80828c:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  808290:	48 01 e8             	add    %rbp,%rax
+  808293:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  808299:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  80829c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80829f:	48 98                	cltq
+  8082a1:	48 c1 e0 05          	shl    $0x5,%rax
+  8082a5:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8082a9:	48 01 e8             	add    %rbp,%rax
+  8082ac:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  8082b3:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  8082b9:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  8082bb:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8082bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8082c2:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  8082c5:	7c 8d                	jl     808254 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  8082c7:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8082ce:	74 27                	je     8082f7 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8082d0:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8082d3:	48 63 d0             	movslq %eax,%rdx
+  8082d6:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8082dd:	48 89 d6             	mov    %rdx,%rsi
+  8082e0:	48 89 c7             	mov    %rax,%rdi
+  8082e3:	49 89 df             	mov    %rbx,%r15
+  8082e6:	48 b8 18 80 ff ff ff 	movabs $0xffffffffffff8018,%rax
+  8082ed:	ff ff ff 
+  8082f0:	48 01 d8             	add    %rbx,%rax
+  8082f3:	ff d0                	call   *%rax
+  8082f5:	eb 25                	jmp    80831c <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  8082f7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8082fa:	48 63 d0             	movslq %eax,%rdx
+  8082fd:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  808304:	48 89 d6             	mov    %rdx,%rsi
+  808307:	48 89 c7             	mov    %rax,%rdi
+  80830a:	49 89 df             	mov    %rbx,%r15
+  80830d:	48 b8 76 80 ff ff ff 	movabs $0xffffffffffff8076,%rax
+  808314:	ff ff ff 
+  808317:	48 01 d8             	add    %rbx,%rax
+  80831a:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  80831c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  80831f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  808323:	79 05                	jns    80832a <ipc_window_batch+0x13d>
+			return r;
+  808325:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808328:	eb 2a                	jmp    808354 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  80832a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80832d:	c1 e0 0c             	shl    $0xc,%eax
+  808330:	48 98                	cltq
+  808332:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  808339:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80833c:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  808342:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  808349:	0f 8f de fe ff ff    	jg     80822d <ipc_window_batch+0x40>
+	}
+	return 0;
+  80834f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808354:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  80835b:	5b                   	pop    %rbx
+  80835c:	41 5f                	pop    %r15
+  80835e:	5d                   	pop    %rbp
+  80835f:	c3                   	ret
+
+0000000000808360 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  808360:	55                   	push   %rbp
+  808361:	48 89 e5             	mov    %rsp,%rbp
+  808364:	48 83 ec 10          	sub    $0x10,%rsp
+  808368:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 808368 <ipc_map_window+0x8>
+  80836f:	49 bb d8 2c 00 00 00 	movabs $0x2cd8,%r11
+  808376:	00 00 00 
+  808379:	4c 01 d8             	add    %r11,%rax
+  80837c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  808380:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  808383:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  808386:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80838a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80838f:	bf 01 00 00 00       	mov    $0x1,%edi
+  808394:	49 b8 ad d1 ff ff ff 	movabs $0xffffffffffffd1ad,%r8
+  80839b:	ff ff ff 
+  80839e:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8083a2:	ff d0                	call   *%rax
+}
+  8083a4:	c9                   	leave
+  8083a5:	c3                   	ret
+
+00000000008083a6 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  8083a6:	55                   	push   %rbp
+  8083a7:	48 89 e5             	mov    %rsp,%rbp
+  8083aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8083ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8083ae <ipc_unmap_window+0x8>
+  8083b5:	49 bb 92 2c 00 00 00 	movabs $0x2c92,%r11
+  8083bc:	00 00 00 
+  8083bf:	4c 01 d8             	add    %r11,%rax
+  8083c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8083c6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  8083c9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8083cc:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8083d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8083d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8083da:	49 b8 ad d1 ff ff ff 	movabs $0xffffffffffffd1ad,%r8
+  8083e1:	ff ff ff 
+  8083e4:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8083e8:	ff d0                	call   *%rax
+}
+  8083ea:	c9                   	leave
+  8083eb:	c3                   	ret
+
+00000000008083ec <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8083ec:	55                   	push   %rbp
+  8083ed:	48 89 e5             	mov    %rsp,%rbp
+  8083f0:	48 83 ec 18          	sub    $0x18,%rsp
+  8083f4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8083f4 <ipc_find_env+0x8>
+  8083fb:	49 bb 4c 2c 00 00 00 	movabs $0x2c4c,%r11
+  808402:	00 00 00 
+  808405:	4c 01 d8             	add    %r11,%rax
+  808408:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  80840b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  808412:	eb 57                	jmp    80846b <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  808414:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80841b:	ff ff ff 
+  80841e:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  808422:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  808425:	48 63 d2             	movslq %edx,%rdx
+  808428:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  80842f:	48 01 ca             	add    %rcx,%rdx
+  808432:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  808439:	8b 12                	mov    (%rdx),%edx
+  80843b:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  80843e:	75 27                	jne    808467 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  808440:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  808447:	ff ff ff 
+  80844a:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80844e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  808451:	48 98                	cltq
+  808453:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80845a:	48 01 d0             	add    %rdx,%rax
+  80845d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  808463:	8b 00                	mov    (%rax),%eax
+  808465:	eb 12                	jmp    808479 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  808467:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80846b:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  808472:	7e a0                	jle    808414 <ipc_find_env+0x28>
+	}
+	return 0;
+  808474:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808479:	c9                   	leave
+  80847a:	c3                   	ret
+
+000000000080847b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80847b:	55                   	push   %rbp
+  80847c:	48 89 e5             	mov    %rsp,%rbp
+  80847f:	48 83 ec 18          	sub    $0x18,%rsp
+  808483:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 808483 <pageref+0x8>
+  80848a:	49 bb bd 2b 00 00 00 	movabs $0x2bbd,%r11
+  808491:	00 00 00 
+  808494:	4c 01 d8             	add    %r11,%rax
+  808497:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  80849b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80849f:	48 89 d1             	mov    %rdx,%rcx
+  8084a2:	48 c1 e9 15          	shr    $0x15,%rcx
+  8084a6:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8084ad:	ff ff ff 
+  8084b0:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8084b4:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8084b8:	83 e2 01             	and    $0x1,%edx
+  8084bb:	48 85 d2             	test   %rdx,%rdx
+  8084be:	75 07                	jne    8084c7 <pageref+0x4c>
+		return 0;
+  8084c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8084c5:	eb 64                	jmp    80852b <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  8084c7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8084cb:	48 89 d1             	mov    %rdx,%rcx
+  8084ce:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8084d2:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8084d9:	ff ff ff 
+  8084dc:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8084e0:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8084e4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  8084e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8084ec:	83 e2 01             	and    $0x1,%edx
+  8084ef:	48 85 d2             	test   %rdx,%rdx
+  8084f2:	75 07                	jne    8084fb <pageref+0x80>
+		return 0;
+  8084f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8084f9:	eb 30                	jmp    80852b <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  8084fb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8084ff:	48 c1 ea 0c          	shr    $0xc,%rdx
+  808503:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  80850a:	ff ff ff 
+  80850d:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  808511:	48 89 d0             	mov    %rdx,%rax
+  808514:	48 01 c0             	add    %rax,%rax
+  808517:	48 01 d0             	add    %rdx,%rax
+  80851a:	48 c1 e0 03          	shl    $0x3,%rax
+  80851e:	48 01 c8             	add    %rcx,%rax
+  808521:	48 83 c0 08          	add    $0x8,%rax
+  808525:	0f b7 00             	movzwl (%rax),%eax
+  808528:	0f b7 c0             	movzwl %ax,%eax
+}
+  80852b:	c9                   	leave
+  80852c:	c3                   	ret
@@ -0,0 +1,9424 @@
+
+obj/user/testtime:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 15 02 00 00       	call   800256 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <sleep>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+sleep(int sec)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <sleep+0xb>
+  800055:	49 bb e2 7f 00 00 00 	movabs $0x7fe2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	unsigned now = sys_time_msec();
+  800065:	49 89 df             	mov    %rbx,%r15
+  800068:	48 b8 ac a5 ff ff ff 	movabs $0xffffffffffffa5ac,%rax
+  80006f:	ff ff ff 
+  800072:	48 01 d8             	add    %rbx,%rax
+  800075:	ff d0                	call   *%rax
+  800077:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	unsigned end = now + sec * 1000;
+  80007a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80007d:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  800083:	89 c2                	mov    %eax,%edx
+  800085:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800088:	01 d0                	add    %edx,%eax
+  80008a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+
+	if ((int)now < 0 && (int)now > -MAXERROR)
+  80008d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800090:	85 c0                	test   %eax,%eax
+  800092:	79 4c                	jns    8000e0 <sleep+0x9d>
+  800094:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800097:	83 f8 eb             	cmp    $0xffffffeb,%eax
+  80009a:	7c 44                	jl     8000e0 <sleep+0x9d>
+		panic("sys_time_msec: %e", (int)now);
+  80009c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80009f:	89 c1                	mov    %eax,%ecx
+  8000a1:	48 b8 b8 df ff ff ff 	movabs $0xffffffffffffdfb8,%rax
+  8000a8:	ff ff ff 
+  8000ab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000af:	48 89 c2             	mov    %rax,%rdx
+  8000b2:	be 0b 00 00 00       	mov    $0xb,%esi
+  8000b7:	48 b8 ca df ff ff ff 	movabs $0xffffffffffffdfca,%rax
+  8000be:	ff ff ff 
+  8000c1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000c5:	48 89 c7             	mov    %rax,%rdi
+  8000c8:	49 89 df             	mov    %rbx,%r15
+  8000cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d0:	49 b8 30 83 ff ff ff 	movabs $0xffffffffffff8330,%r8
+  8000d7:	ff ff ff 
+  8000da:	49 01 d8             	add    %rbx,%r8
+  8000dd:	41 ff d0             	call   *%r8
+	if (end < now)
+  8000e0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8000e3:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  8000e6:	73 50                	jae    800138 <sleep+0xf5>
+		panic("sleep: wrap");
+  8000e8:	48 b8 da df ff ff ff 	movabs $0xffffffffffffdfda,%rax
+  8000ef:	ff ff ff 
+  8000f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000f6:	48 89 c2             	mov    %rax,%rdx
+  8000f9:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000fe:	48 b8 ca df ff ff ff 	movabs $0xffffffffffffdfca,%rax
+  800105:	ff ff ff 
+  800108:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80010c:	48 89 c7             	mov    %rax,%rdi
+  80010f:	49 89 df             	mov    %rbx,%r15
+  800112:	b8 00 00 00 00       	mov    $0x0,%eax
+  800117:	48 b9 30 83 ff ff ff 	movabs $0xffffffffffff8330,%rcx
+  80011e:	ff ff ff 
+  800121:	48 01 d9             	add    %rbx,%rcx
+  800124:	ff d1                	call   *%rcx
+
+	while (sys_time_msec() < end)
+		sys_yield();
+  800126:	49 89 df             	mov    %rbx,%r15
+  800129:	48 b8 30 a0 ff ff ff 	movabs $0xffffffffffffa030,%rax
+  800130:	ff ff ff 
+  800133:	48 01 d8             	add    %rbx,%rax
+  800136:	ff d0                	call   *%rax
+	while (sys_time_msec() < end)
+  800138:	49 89 df             	mov    %rbx,%r15
+  80013b:	48 b8 ac a5 ff ff ff 	movabs $0xffffffffffffa5ac,%rax
+  800142:	ff ff ff 
+  800145:	48 01 d8             	add    %rbx,%rax
+  800148:	ff d0                	call   *%rax
+  80014a:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+  80014d:	72 d7                	jb     800126 <sleep+0xe3>
+}
+  80014f:	90                   	nop
+  800150:	90                   	nop
+  800151:	48 83 c4 20          	add    $0x20,%rsp
+  800155:	5b                   	pop    %rbx
+  800156:	41 5f                	pop    %r15
+  800158:	5d                   	pop    %rbp
+  800159:	c3                   	ret
+
+000000000080015a <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80015a:	55                   	push   %rbp
+  80015b:	48 89 e5             	mov    %rsp,%rbp
+  80015e:	41 57                	push   %r15
+  800160:	53                   	push   %rbx
+  800161:	48 83 ec 20          	sub    $0x20,%rsp
+  800165:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800165 <umain+0xb>
+  80016c:	49 bb cb 7e 00 00 00 	movabs $0x7ecb,%r11
+  800173:	00 00 00 
+  800176:	4c 01 db             	add    %r11,%rbx
+  800179:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80017c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+
+	// Wait for the console to calm down
+	for (i = 0; i < 50; i++)
+  800180:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800187:	eb 16                	jmp    80019f <umain+0x45>
+		sys_yield();
+  800189:	49 89 df             	mov    %rbx,%r15
+  80018c:	48 b8 30 a0 ff ff ff 	movabs $0xffffffffffffa030,%rax
+  800193:	ff ff ff 
+  800196:	48 01 d8             	add    %rbx,%rax
+  800199:	ff d0                	call   *%rax
+	for (i = 0; i < 50; i++)
+  80019b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80019f:	83 7d ec 31          	cmpl   $0x31,-0x14(%rbp)
+  8001a3:	7e e4                	jle    800189 <umain+0x2f>
+
+	cprintf("starting count down: ");
+  8001a5:	48 b8 e6 df ff ff ff 	movabs $0xffffffffffffdfe6,%rax
+  8001ac:	ff ff ff 
+  8001af:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001b3:	48 89 c7             	mov    %rax,%rdi
+  8001b6:	49 89 df             	mov    %rbx,%r15
+  8001b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001be:	48 ba 07 86 ff ff ff 	movabs $0xffffffffffff8607,%rdx
+  8001c5:	ff ff ff 
+  8001c8:	48 01 da             	add    %rbx,%rdx
+  8001cb:	ff d2                	call   *%rdx
+	for (i = 5; i >= 0; i--) {
+  8001cd:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+  8001d4:	eb 46                	jmp    80021c <umain+0xc2>
+		cprintf("%d ", i);
+  8001d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001d9:	89 c6                	mov    %eax,%esi
+  8001db:	48 b8 fc df ff ff ff 	movabs $0xffffffffffffdffc,%rax
+  8001e2:	ff ff ff 
+  8001e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001e9:	48 89 c7             	mov    %rax,%rdi
+  8001ec:	49 89 df             	mov    %rbx,%r15
+  8001ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f4:	48 ba 07 86 ff ff ff 	movabs $0xffffffffffff8607,%rdx
+  8001fb:	ff ff ff 
+  8001fe:	48 01 da             	add    %rbx,%rdx
+  800201:	ff d2                	call   *%rdx
+		sleep(1);
+  800203:	bf 01 00 00 00       	mov    $0x1,%edi
+  800208:	48 b8 13 80 ff ff ff 	movabs $0xffffffffffff8013,%rax
+  80020f:	ff ff ff 
+  800212:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800216:	ff d0                	call   *%rax
+	for (i = 5; i >= 0; i--) {
+  800218:	83 6d ec 01          	subl   $0x1,-0x14(%rbp)
+  80021c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800220:	79 b4                	jns    8001d6 <umain+0x7c>
+	}
+	cprintf("\n");
+  800222:	48 b8 00 e0 ff ff ff 	movabs $0xffffffffffffe000,%rax
+  800229:	ff ff ff 
+  80022c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800230:	48 89 c7             	mov    %rax,%rdi
+  800233:	49 89 df             	mov    %rbx,%r15
+  800236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023b:	48 ba 07 86 ff ff ff 	movabs $0xffffffffffff8607,%rdx
+  800242:	ff ff ff 
+  800245:	48 01 da             	add    %rbx,%rdx
+  800248:	ff d2                	call   *%rdx
+static __inline void read_gdtr (uint64_t *gdtbase, uint16_t *gdtlimit) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  80024a:	cc                   	int3
+}
+  80024b:	90                   	nop
+	breakpoint();
+}
+  80024c:	90                   	nop
+  80024d:	48 83 c4 20          	add    $0x20,%rsp
+  800251:	5b                   	pop    %rbx
+  800252:	41 5f                	pop    %r15
+  800254:	5d                   	pop    %rbp
+  800255:	c3                   	ret
+
+0000000000800256 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800256:	55                   	push   %rbp
+  800257:	48 89 e5             	mov    %rsp,%rbp
+  80025a:	41 57                	push   %r15
+  80025c:	53                   	push   %rbx
+  80025d:	48 83 ec 20          	sub    $0x20,%rsp
+  800261:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800261 <libmain+0xb>
+  800268:	49 bb cf 7d 00 00 00 	movabs $0x7dcf,%r11
+  80026f:	00 00 00 
+  800272:	4c 01 db             	add    %r11,%rbx
+  800275:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800278:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  80027c:	49 89 df             	mov    %rbx,%r15
+  80027f:	48 b8 dc 9f ff ff ff 	movabs $0xffffffffffff9fdc,%rax
+  800286:	ff ff ff 
+  800289:	48 01 d8             	add    %rbx,%rax
+  80028c:	ff d0                	call   *%rax
+  80028e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800291:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800294:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800299:	48 98                	cltq
+  80029b:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8002a2:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8002a9:	ff ff ff 
+  8002ac:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8002b0:	48 01 c2             	add    %rax,%rdx
+  8002b3:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  8002ba:	00 00 00 
+  8002bd:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002c1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8002c5:	7e 15                	jle    8002dc <libmain+0x86>
+		binaryname = argv[0];
+  8002c7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8002cb:	48 8b 00             	mov    (%rax),%rax
+  8002ce:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  8002d5:	00 00 00 
+  8002d8:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8002dc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8002e0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8002e3:	48 89 d6             	mov    %rdx,%rsi
+  8002e6:	89 c7                	mov    %eax,%edi
+  8002e8:	49 89 df             	mov    %rbx,%r15
+  8002eb:	48 b8 2a 81 ff ff ff 	movabs $0xffffffffffff812a,%rax
+  8002f2:	ff ff ff 
+  8002f5:	48 01 d8             	add    %rbx,%rax
+  8002f8:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8002fa:	49 89 df             	mov    %rbx,%r15
+  8002fd:	48 b8 e6 82 ff ff ff 	movabs $0xffffffffffff82e6,%rax
+  800304:	ff ff ff 
+  800307:	48 01 d8             	add    %rbx,%rax
+  80030a:	ff d0                	call   *%rax
+}
+  80030c:	90                   	nop
+  80030d:	48 83 c4 20          	add    $0x20,%rsp
+  800311:	5b                   	pop    %rbx
+  800312:	41 5f                	pop    %r15
+  800314:	5d                   	pop    %rbp
+  800315:	c3                   	ret
+
+0000000000800316 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800316:	55                   	push   %rbp
+  800317:	48 89 e5             	mov    %rsp,%rbp
+  80031a:	41 57                	push   %r15
+  80031c:	53                   	push   %rbx
+  80031d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80031d <exit+0x7>
+  800324:	49 bb 13 7d 00 00 00 	movabs $0x7d13,%r11
+  80032b:	00 00 00 
+  80032e:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800331:	49 89 df             	mov    %rbx,%r15
+  800334:	48 b8 59 ac ff ff ff 	movabs $0xffffffffffffac59,%rax
+  80033b:	ff ff ff 
+  80033e:	48 01 d8             	add    %rbx,%rax
+  800341:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800343:	bf 00 00 00 00       	mov    $0x0,%edi
+  800348:	49 89 df             	mov    %rbx,%r15
+  80034b:	48 b8 80 9f ff ff ff 	movabs $0xffffffffffff9f80,%rax
+  800352:	ff ff ff 
+  800355:	48 01 d8             	add    %rbx,%rax
+  800358:	ff d0                	call   *%rax
+}
+  80035a:	90                   	nop
+  80035b:	5b                   	pop    %rbx
+  80035c:	41 5f                	pop    %r15
+  80035e:	5d                   	pop    %rbp
+  80035f:	c3                   	ret
+
+0000000000800360 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800360:	55                   	push   %rbp
+  800361:	48 89 e5             	mov    %rsp,%rbp
+  800364:	41 57                	push   %r15
+  800366:	41 54                	push   %r12
+  800368:	53                   	push   %rbx
+  800369:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800370:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800370 <_panic+0x10>
+  800377:	49 bb c0 7c 00 00 00 	movabs $0x7cc0,%r11
+  80037e:	00 00 00 
+  800381:	4c 01 db             	add    %r11,%rbx
+  800384:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80038b:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800391:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800398:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80039f:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8003a6:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8003ad:	84 c0                	test   %al,%al
+  8003af:	74 26                	je     8003d7 <_panic+0x77>
+  8003b1:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8003b8:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8003bf:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8003c3:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8003c7:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8003cb:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8003cf:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8003d3:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003d7:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8003de:	00 00 00 
+  8003e1:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8003e8:	00 00 00 
+  8003eb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003ef:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8003f6:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8003fd:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800404:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80040b:	ff ff ff 
+  80040e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800412:	4c 8b 20             	mov    (%rax),%r12
+  800415:	49 89 df             	mov    %rbx,%r15
+  800418:	48 b8 dc 9f ff ff ff 	movabs $0xffffffffffff9fdc,%rax
+  80041f:	ff ff ff 
+  800422:	48 01 d8             	add    %rbx,%rax
+  800425:	ff d0                	call   *%rax
+  800427:	89 c6                	mov    %eax,%esi
+  800429:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80042f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800436:	41 89 d0             	mov    %edx,%r8d
+  800439:	48 89 c1             	mov    %rax,%rcx
+  80043c:	4c 89 e2             	mov    %r12,%rdx
+  80043f:	48 b8 10 e0 ff ff ff 	movabs $0xffffffffffffe010,%rax
+  800446:	ff ff ff 
+  800449:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80044d:	48 89 c7             	mov    %rax,%rdi
+  800450:	49 89 df             	mov    %rbx,%r15
+  800453:	b8 00 00 00 00       	mov    $0x0,%eax
+  800458:	49 b9 07 86 ff ff ff 	movabs $0xffffffffffff8607,%r9
+  80045f:	ff ff ff 
+  800462:	49 01 d9             	add    %rbx,%r9
+  800465:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800468:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80046f:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800476:	48 89 d6             	mov    %rdx,%rsi
+  800479:	48 89 c7             	mov    %rax,%rdi
+  80047c:	49 89 df             	mov    %rbx,%r15
+  80047f:	48 b8 27 85 ff ff ff 	movabs $0xffffffffffff8527,%rax
+  800486:	ff ff ff 
+  800489:	48 01 d8             	add    %rbx,%rax
+  80048c:	ff d0                	call   *%rax
+	cprintf("\n");
+  80048e:	48 b8 33 e0 ff ff ff 	movabs $0xffffffffffffe033,%rax
+  800495:	ff ff ff 
+  800498:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80049c:	48 89 c7             	mov    %rax,%rdi
+  80049f:	49 89 df             	mov    %rbx,%r15
+  8004a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a7:	48 ba 07 86 ff ff ff 	movabs $0xffffffffffff8607,%rdx
+  8004ae:	ff ff ff 
+  8004b1:	48 01 da             	add    %rbx,%rdx
+  8004b4:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8004b6:	cc                   	int3
+  8004b7:	eb fd                	jmp    8004b6 <_panic+0x156>
+
+00000000008004b9 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8004b9:	55                   	push   %rbp
+  8004ba:	48 89 e5             	mov    %rsp,%rbp
+  8004bd:	41 57                	push   %r15
+  8004bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8004c3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8004c3 <putch+0xa>
+  8004ca:	49 bb 6d 7b 00 00 00 	movabs $0x7b6d,%r11
+  8004d1:	00 00 00 
+  8004d4:	4c 01 d8             	add    %r11,%rax
+  8004d7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8004da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8004de:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8004e2:	8b 12                	mov    (%rdx),%edx
+  8004e4:	8d 72 01             	lea    0x1(%rdx),%esi
+  8004e7:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8004eb:	89 31                	mov    %esi,(%rcx)
+  8004ed:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8004f0:	89 ce                	mov    %ecx,%esi
+  8004f2:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8004f6:	48 63 d2             	movslq %edx,%rdx
+  8004f9:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8004fe:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800502:	8b 12                	mov    (%rdx),%edx
+  800504:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80050a:	75 33                	jne    80053f <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80050c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800510:	8b 12                	mov    (%rdx),%edx
+  800512:	48 63 d2             	movslq %edx,%rdx
+  800515:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800519:	48 83 c1 08          	add    $0x8,%rcx
+  80051d:	48 89 d6             	mov    %rdx,%rsi
+  800520:	48 89 cf             	mov    %rcx,%rdi
+  800523:	49 89 c7             	mov    %rax,%r15
+  800526:	48 ba cd 9e ff ff ff 	movabs $0xffffffffffff9ecd,%rdx
+  80052d:	ff ff ff 
+  800530:	48 01 c2             	add    %rax,%rdx
+  800533:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800535:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800539:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  80053f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800543:	8b 40 04             	mov    0x4(%rax),%eax
+  800546:	8d 50 01             	lea    0x1(%rax),%edx
+  800549:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80054d:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800550:	90                   	nop
+  800551:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800555:	c9                   	leave
+  800556:	c3                   	ret
+
+0000000000800557 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800557:	55                   	push   %rbp
+  800558:	48 89 e5             	mov    %rsp,%rbp
+  80055b:	41 57                	push   %r15
+  80055d:	53                   	push   %rbx
+  80055e:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800565:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800565 <vcprintf+0xe>
+  80056c:	49 bb cb 7a 00 00 00 	movabs $0x7acb,%r11
+  800573:	00 00 00 
+  800576:	4c 01 db             	add    %r11,%rbx
+  800579:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800580:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800587:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80058e:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800595:	48 8b 06             	mov    (%rsi),%rax
+  800598:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80059c:	48 89 01             	mov    %rax,(%rcx)
+  80059f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8005a3:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8005a7:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8005ab:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8005b2:	00 00 00 
+    b.cnt = 0;
+  8005b5:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8005bc:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8005bf:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8005c6:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8005cd:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8005d4:	48 89 c6             	mov    %rax,%rsi
+  8005d7:	48 b8 89 84 ff ff ff 	movabs $0xffffffffffff8489,%rax
+  8005de:	ff ff ff 
+  8005e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005e5:	48 89 c7             	mov    %rax,%rdi
+  8005e8:	49 89 df             	mov    %rbx,%r15
+  8005eb:	48 b8 4b 8a ff ff ff 	movabs $0xffffffffffff8a4b,%rax
+  8005f2:	ff ff ff 
+  8005f5:	48 01 d8             	add    %rbx,%rax
+  8005f8:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8005fa:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800600:	48 98                	cltq
+  800602:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800609:	48 83 c2 08          	add    $0x8,%rdx
+  80060d:	48 89 c6             	mov    %rax,%rsi
+  800610:	48 89 d7             	mov    %rdx,%rdi
+  800613:	49 89 df             	mov    %rbx,%r15
+  800616:	48 b8 cd 9e ff ff ff 	movabs $0xffffffffffff9ecd,%rax
+  80061d:	ff ff ff 
+  800620:	48 01 d8             	add    %rbx,%rax
+  800623:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800625:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  80062b:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800632:	5b                   	pop    %rbx
+  800633:	41 5f                	pop    %r15
+  800635:	5d                   	pop    %rbp
+  800636:	c3                   	ret
+
+0000000000800637 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800637:	55                   	push   %rbp
+  800638:	48 89 e5             	mov    %rsp,%rbp
+  80063b:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800642:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800642 <cprintf+0xb>
+  800649:	49 bb ee 79 00 00 00 	movabs $0x79ee,%r11
+  800650:	00 00 00 
+  800653:	4d 01 da             	add    %r11,%r10
+  800656:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80065d:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800664:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80066b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800672:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800679:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800680:	84 c0                	test   %al,%al
+  800682:	74 20                	je     8006a4 <cprintf+0x6d>
+  800684:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800688:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80068c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800690:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800694:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800698:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80069c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8006a0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8006a4:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8006ab:	00 00 00 
+  8006ae:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8006b5:	00 00 00 
+  8006b8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006bc:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8006c3:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8006ca:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8006d1:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8006d8:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8006df:	48 8b 06             	mov    (%rsi),%rax
+  8006e2:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006e6:	48 89 01             	mov    %rax,(%rcx)
+  8006e9:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006ed:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006f1:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8006f5:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8006fc:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800703:	48 89 d6             	mov    %rdx,%rsi
+  800706:	48 89 c7             	mov    %rax,%rdi
+  800709:	48 b8 27 85 ff ff ff 	movabs $0xffffffffffff8527,%rax
+  800710:	ff ff ff 
+  800713:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800717:	ff d0                	call   *%rax
+  800719:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80071f:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800725:	c9                   	leave
+  800726:	c3                   	ret
+
+0000000000800727 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800727:	55                   	push   %rbp
+  800728:	48 89 e5             	mov    %rsp,%rbp
+  80072b:	53                   	push   %rbx
+  80072c:	48 83 ec 38          	sub    $0x38,%rsp
+  800730:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800730 <printnum+0x9>
+  800737:	49 bb 00 79 00 00 00 	movabs $0x7900,%r11
+  80073e:	00 00 00 
+  800741:	4c 01 db             	add    %r11,%rbx
+  800744:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800748:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80074c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800750:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800753:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800757:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80075b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80075e:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800762:	72 58                	jb     8007bc <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800764:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800767:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80076a:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  80076d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800771:	ba 00 00 00 00       	mov    $0x0,%edx
+  800776:	48 f7 f6             	div    %rsi
+  800779:	49 89 c2             	mov    %rax,%r10
+  80077c:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80077f:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800782:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800786:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80078a:	41 89 c9             	mov    %ecx,%r9d
+  80078d:	41 89 f8             	mov    %edi,%r8d
+  800790:	89 d1                	mov    %edx,%ecx
+  800792:	4c 89 d2             	mov    %r10,%rdx
+  800795:	48 89 c7             	mov    %rax,%rdi
+  800798:	48 b8 f7 86 ff ff ff 	movabs $0xffffffffffff86f7,%rax
+  80079f:	ff ff ff 
+  8007a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007a6:	ff d0                	call   *%rax
+  8007a8:	eb 1c                	jmp    8007c6 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007aa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007ae:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8007b1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8007b5:	48 89 d6             	mov    %rdx,%rsi
+  8007b8:	89 c7                	mov    %eax,%edi
+  8007ba:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8007bc:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8007c0:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8007c4:	7f e4                	jg     8007aa <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007c6:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8007c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8007cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007d2:	48 f7 f1             	div    %rcx
+  8007d5:	48 b8 6f e1 ff ff ff 	movabs $0xffffffffffffe16f,%rax
+  8007dc:	ff ff ff 
+  8007df:	48 01 d8             	add    %rbx,%rax
+  8007e2:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8007e6:	0f be c0             	movsbl %al,%eax
+  8007e9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007ed:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8007f1:	48 89 d6             	mov    %rdx,%rsi
+  8007f4:	89 c7                	mov    %eax,%edi
+  8007f6:	ff d1                	call   *%rcx
+}
+  8007f8:	90                   	nop
+  8007f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007fd:	c9                   	leave
+  8007fe:	c3                   	ret
+
+00000000008007ff <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8007ff:	55                   	push   %rbp
+  800800:	48 89 e5             	mov    %rsp,%rbp
+  800803:	48 83 ec 20          	sub    $0x20,%rsp
+  800807:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800807 <getuint+0x8>
+  80080e:	49 bb 29 78 00 00 00 	movabs $0x7829,%r11
+  800815:	00 00 00 
+  800818:	4c 01 d8             	add    %r11,%rax
+  80081b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80081f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800822:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800826:	7e 4f                	jle    800877 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800828:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80082c:	8b 00                	mov    (%rax),%eax
+  80082e:	83 f8 2f             	cmp    $0x2f,%eax
+  800831:	77 24                	ja     800857 <getuint+0x58>
+  800833:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800837:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80083b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80083f:	8b 00                	mov    (%rax),%eax
+  800841:	89 c0                	mov    %eax,%eax
+  800843:	48 01 d0             	add    %rdx,%rax
+  800846:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80084a:	8b 12                	mov    (%rdx),%edx
+  80084c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80084f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800853:	89 0a                	mov    %ecx,(%rdx)
+  800855:	eb 14                	jmp    80086b <getuint+0x6c>
+  800857:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80085b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80085f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800863:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800867:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80086b:	48 8b 00             	mov    (%rax),%rax
+  80086e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800872:	e9 9d 00 00 00       	jmp    800914 <getuint+0x115>
+	else if (lflag)
+  800877:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80087b:	74 4c                	je     8008c9 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  80087d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800881:	8b 00                	mov    (%rax),%eax
+  800883:	83 f8 2f             	cmp    $0x2f,%eax
+  800886:	77 24                	ja     8008ac <getuint+0xad>
+  800888:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80088c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800890:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800894:	8b 00                	mov    (%rax),%eax
+  800896:	89 c0                	mov    %eax,%eax
+  800898:	48 01 d0             	add    %rdx,%rax
+  80089b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80089f:	8b 12                	mov    (%rdx),%edx
+  8008a1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008a4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008a8:	89 0a                	mov    %ecx,(%rdx)
+  8008aa:	eb 14                	jmp    8008c0 <getuint+0xc1>
+  8008ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008b0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008b4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008b8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008bc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008c0:	48 8b 00             	mov    (%rax),%rax
+  8008c3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8008c7:	eb 4b                	jmp    800914 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8008c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008cd:	8b 00                	mov    (%rax),%eax
+  8008cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d2:	77 24                	ja     8008f8 <getuint+0xf9>
+  8008d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008d8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008e0:	8b 00                	mov    (%rax),%eax
+  8008e2:	89 c0                	mov    %eax,%eax
+  8008e4:	48 01 d0             	add    %rdx,%rax
+  8008e7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008eb:	8b 12                	mov    (%rdx),%edx
+  8008ed:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008f0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008f4:	89 0a                	mov    %ecx,(%rdx)
+  8008f6:	eb 14                	jmp    80090c <getuint+0x10d>
+  8008f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008fc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800900:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800904:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800908:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80090c:	8b 00                	mov    (%rax),%eax
+  80090e:	89 c0                	mov    %eax,%eax
+  800910:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800914:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800918:	c9                   	leave
+  800919:	c3                   	ret
+
+000000000080091a <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  80091a:	55                   	push   %rbp
+  80091b:	48 89 e5             	mov    %rsp,%rbp
+  80091e:	48 83 ec 20          	sub    $0x20,%rsp
+  800922:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800922 <printfloat+0x8>
+  800929:	49 bb 0e 77 00 00 00 	movabs $0x770e,%r11
+  800930:	00 00 00 
+  800933:	4c 01 d8             	add    %r11,%rax
+  800936:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80093a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80093e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800942:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800946:	48 85 c0             	test   %rax,%rax
+  800949:	79 12                	jns    80095d <printfloat+0x43>
+		putch('-',putdat);
+  80094b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80094f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800953:	48 89 c6             	mov    %rax,%rsi
+  800956:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80095b:	ff d2                	call   *%rdx
+	
+}
+  80095d:	90                   	nop
+  80095e:	c9                   	leave
+  80095f:	c3                   	ret
+
+0000000000800960 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800960:	55                   	push   %rbp
+  800961:	48 89 e5             	mov    %rsp,%rbp
+  800964:	48 83 ec 20          	sub    $0x20,%rsp
+  800968:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800968 <getint+0x8>
+  80096f:	49 bb c8 76 00 00 00 	movabs $0x76c8,%r11
+  800976:	00 00 00 
+  800979:	4c 01 d8             	add    %r11,%rax
+  80097c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800980:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800983:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800987:	7e 4f                	jle    8009d8 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800989:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80098d:	8b 00                	mov    (%rax),%eax
+  80098f:	83 f8 2f             	cmp    $0x2f,%eax
+  800992:	77 24                	ja     8009b8 <getint+0x58>
+  800994:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800998:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80099c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009a0:	8b 00                	mov    (%rax),%eax
+  8009a2:	89 c0                	mov    %eax,%eax
+  8009a4:	48 01 d0             	add    %rdx,%rax
+  8009a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009ab:	8b 12                	mov    (%rdx),%edx
+  8009ad:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009b0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009b4:	89 0a                	mov    %ecx,(%rdx)
+  8009b6:	eb 14                	jmp    8009cc <getint+0x6c>
+  8009b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009bc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009c0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009c4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009c8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009cc:	48 8b 00             	mov    (%rax),%rax
+  8009cf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009d3:	e9 9d 00 00 00       	jmp    800a75 <getint+0x115>
+	else if (lflag)
+  8009d8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8009dc:	74 4c                	je     800a2a <getint+0xca>
+		x=va_arg(*ap, long);
+  8009de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009e2:	8b 00                	mov    (%rax),%eax
+  8009e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e7:	77 24                	ja     800a0d <getint+0xad>
+  8009e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ed:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009f5:	8b 00                	mov    (%rax),%eax
+  8009f7:	89 c0                	mov    %eax,%eax
+  8009f9:	48 01 d0             	add    %rdx,%rax
+  8009fc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a00:	8b 12                	mov    (%rdx),%edx
+  800a02:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a05:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a09:	89 0a                	mov    %ecx,(%rdx)
+  800a0b:	eb 14                	jmp    800a21 <getint+0xc1>
+  800a0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a11:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a15:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a19:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a1d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a21:	48 8b 00             	mov    (%rax),%rax
+  800a24:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a28:	eb 4b                	jmp    800a75 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800a2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a2e:	8b 00                	mov    (%rax),%eax
+  800a30:	83 f8 2f             	cmp    $0x2f,%eax
+  800a33:	77 24                	ja     800a59 <getint+0xf9>
+  800a35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a39:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a41:	8b 00                	mov    (%rax),%eax
+  800a43:	89 c0                	mov    %eax,%eax
+  800a45:	48 01 d0             	add    %rdx,%rax
+  800a48:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a4c:	8b 12                	mov    (%rdx),%edx
+  800a4e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a51:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a55:	89 0a                	mov    %ecx,(%rdx)
+  800a57:	eb 14                	jmp    800a6d <getint+0x10d>
+  800a59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a5d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a61:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a65:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a69:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a6d:	8b 00                	mov    (%rax),%eax
+  800a6f:	48 98                	cltq
+  800a71:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800a75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a79:	c9                   	leave
+  800a7a:	c3                   	ret
+
+0000000000800a7b <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800a7b:	55                   	push   %rbp
+  800a7c:	48 89 e5             	mov    %rsp,%rbp
+  800a7f:	41 57                	push   %r15
+  800a81:	41 55                	push   %r13
+  800a83:	41 54                	push   %r12
+  800a85:	53                   	push   %rbx
+  800a86:	48 83 ec 60          	sub    $0x60,%rsp
+  800a8a:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800a8a <vprintfmt+0xf>
+  800a91:	49 bb a6 75 00 00 00 	movabs $0x75a6,%r11
+  800a98:	00 00 00 
+  800a9b:	4d 01 dc             	add    %r11,%r12
+  800a9e:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800aa2:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800aa6:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800aaa:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800aae:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800ab5:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800ab9:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800abd:	48 8b 06             	mov    (%rsi),%rax
+  800ac0:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800ac4:	48 89 01             	mov    %rax,(%rcx)
+  800ac7:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800acb:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800acf:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ad3:	eb 17                	jmp    800aec <vprintfmt+0x71>
+			if (ch == '\0')
+  800ad5:	85 db                	test   %ebx,%ebx
+  800ad7:	0f 84 97 05 00 00    	je     801074 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800add:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ae1:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ae5:	48 89 c6             	mov    %rax,%rsi
+  800ae8:	89 df                	mov    %ebx,%edi
+  800aea:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800aec:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800af0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800af4:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800af8:	0f b6 00             	movzbl (%rax),%eax
+  800afb:	0f b6 d8             	movzbl %al,%ebx
+  800afe:	83 fb 25             	cmp    $0x25,%ebx
+  800b01:	75 d2                	jne    800ad5 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800b03:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800b07:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800b0e:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800b15:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800b1c:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800b23:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b27:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800b2b:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800b2f:	0f b6 00             	movzbl (%rax),%eax
+  800b32:	0f b6 d8             	movzbl %al,%ebx
+  800b35:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800b38:	83 f8 55             	cmp    $0x55,%eax
+  800b3b:	0f 87 00 05 00 00    	ja     801041 <vprintfmt+0x5c6>
+  800b41:	89 c0                	mov    %eax,%eax
+  800b43:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800b4a:	00 
+  800b4b:	48 8d 05 76 56 00 00 	lea    0x5676(%rip),%rax        # 8061c8 <.LC18+0xc>
+  800b52:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800b56:	48 8d 15 6b 56 00 00 	lea    0x566b(%rip),%rdx        # 8061c8 <.LC18+0xc>
+  800b5d:	48 01 d0             	add    %rdx,%rax
+  800b60:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800b62:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800b66:	eb bb                	jmp    800b23 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800b68:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800b6c:	eb b5                	jmp    800b23 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800b6e:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800b75:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800b78:	89 d0                	mov    %edx,%eax
+  800b7a:	c1 e0 02             	shl    $0x2,%eax
+  800b7d:	01 d0                	add    %edx,%eax
+  800b7f:	01 c0                	add    %eax,%eax
+  800b81:	01 d8                	add    %ebx,%eax
+  800b83:	83 e8 30             	sub    $0x30,%eax
+  800b86:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800b89:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b8d:	0f b6 00             	movzbl (%rax),%eax
+  800b90:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800b93:	83 fb 2f             	cmp    $0x2f,%ebx
+  800b96:	7e 60                	jle    800bf8 <vprintfmt+0x17d>
+  800b98:	83 fb 39             	cmp    $0x39,%ebx
+  800b9b:	7f 5b                	jg     800bf8 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800b9d:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800ba2:	eb d1                	jmp    800b75 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800ba4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ba7:	83 f8 2f             	cmp    $0x2f,%eax
+  800baa:	77 17                	ja     800bc3 <vprintfmt+0x148>
+  800bac:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800bb0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800bb3:	89 d2                	mov    %edx,%edx
+  800bb5:	48 01 d0             	add    %rdx,%rax
+  800bb8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800bbb:	83 c2 08             	add    $0x8,%edx
+  800bbe:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800bc1:	eb 0c                	jmp    800bcf <vprintfmt+0x154>
+  800bc3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bc7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bcb:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800bcf:	8b 00                	mov    (%rax),%eax
+  800bd1:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800bd4:	eb 23                	jmp    800bf9 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800bd6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800bda:	0f 89 43 ff ff ff    	jns    800b23 <vprintfmt+0xa8>
+				width = 0;
+  800be0:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800be7:	e9 37 ff ff ff       	jmp    800b23 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800bec:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800bf3:	e9 2b ff ff ff       	jmp    800b23 <vprintfmt+0xa8>
+			goto process_precision;
+  800bf8:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800bf9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800bfd:	0f 89 20 ff ff ff    	jns    800b23 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800c03:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800c06:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800c09:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800c10:	e9 0e ff ff ff       	jmp    800b23 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800c15:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800c19:	e9 05 ff ff ff       	jmp    800b23 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800c1e:	83 fb 39             	cmp    $0x39,%ebx
+  800c21:	7f 0b                	jg     800c2e <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800c23:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800c26:	c1 e0 08             	shl    $0x8,%eax
+  800c29:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800c2c:	eb 21                	jmp    800c4f <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800c2e:	83 fb 60             	cmp    $0x60,%ebx
+  800c31:	7e 10                	jle    800c43 <vprintfmt+0x1c8>
+  800c33:	83 fb 66             	cmp    $0x66,%ebx
+  800c36:	7f 0b                	jg     800c43 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800c38:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800c3b:	c1 e0 08             	shl    $0x8,%eax
+  800c3e:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800c41:	eb 0c                	jmp    800c4f <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800c43:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800c4a:	e9 04 01 00 00       	jmp    800d53 <vprintfmt+0x2d8>
+  800c4f:	e9 ff 00 00 00       	jmp    800d53 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800c54:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c57:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5a:	77 17                	ja     800c73 <vprintfmt+0x1f8>
+  800c5c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c60:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c63:	89 d2                	mov    %edx,%edx
+  800c65:	48 01 d0             	add    %rdx,%rax
+  800c68:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c6b:	83 c2 08             	add    $0x8,%edx
+  800c6e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c71:	eb 0c                	jmp    800c7f <vprintfmt+0x204>
+  800c73:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c77:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c7b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c7f:	8b 00                	mov    (%rax),%eax
+  800c81:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800c85:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800c89:	48 89 d6             	mov    %rdx,%rsi
+  800c8c:	89 c7                	mov    %eax,%edi
+  800c8e:	ff d1                	call   *%rcx
+			break;
+  800c90:	e9 da 03 00 00       	jmp    80106f <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800c95:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c98:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9b:	77 17                	ja     800cb4 <vprintfmt+0x239>
+  800c9d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ca1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ca4:	89 d2                	mov    %edx,%edx
+  800ca6:	48 01 d0             	add    %rdx,%rax
+  800ca9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cac:	83 c2 08             	add    $0x8,%edx
+  800caf:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800cb2:	eb 0c                	jmp    800cc0 <vprintfmt+0x245>
+  800cb4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800cb8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cbc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800cc0:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800cc2:	85 db                	test   %ebx,%ebx
+  800cc4:	79 02                	jns    800cc8 <vprintfmt+0x24d>
+				err = -err;
+  800cc6:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800cc8:	83 fb 15             	cmp    $0x15,%ebx
+  800ccb:	7f 19                	jg     800ce6 <vprintfmt+0x26b>
+  800ccd:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  800cd4:	00 00 00 
+  800cd7:	48 63 c3             	movslq %ebx,%rax
+  800cda:	4c 01 e2             	add    %r12,%rdx
+  800cdd:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800ce1:	4d 85 ed             	test   %r13,%r13
+  800ce4:	75 36                	jne    800d1c <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800ce6:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800cea:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800cee:	89 d9                	mov    %ebx,%ecx
+  800cf0:	48 ba 80 e1 ff ff ff 	movabs $0xffffffffffffe180,%rdx
+  800cf7:	ff ff ff 
+  800cfa:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800cfe:	48 89 c7             	mov    %rax,%rdi
+  800d01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d06:	49 b8 52 90 ff ff ff 	movabs $0xffffffffffff9052,%r8
+  800d0d:	ff ff ff 
+  800d10:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800d14:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800d17:	e9 53 03 00 00       	jmp    80106f <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800d1c:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800d20:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d24:	4c 89 e9             	mov    %r13,%rcx
+  800d27:	48 ba 89 e1 ff ff ff 	movabs $0xffffffffffffe189,%rdx
+  800d2e:	ff ff ff 
+  800d31:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800d35:	48 89 c7             	mov    %rax,%rdi
+  800d38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3d:	49 b8 52 90 ff ff ff 	movabs $0xffffffffffff9052,%r8
+  800d44:	ff ff ff 
+  800d47:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800d4b:	41 ff d0             	call   *%r8
+			break;
+  800d4e:	e9 1c 03 00 00       	jmp    80106f <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800d53:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d56:	83 f8 2f             	cmp    $0x2f,%eax
+  800d59:	77 17                	ja     800d72 <vprintfmt+0x2f7>
+  800d5b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d5f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d62:	89 d2                	mov    %edx,%edx
+  800d64:	48 01 d0             	add    %rdx,%rax
+  800d67:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d6a:	83 c2 08             	add    $0x8,%edx
+  800d6d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d70:	eb 0c                	jmp    800d7e <vprintfmt+0x303>
+  800d72:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d76:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d7a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d7e:	4c 8b 28             	mov    (%rax),%r13
+  800d81:	4d 85 ed             	test   %r13,%r13
+  800d84:	75 0e                	jne    800d94 <vprintfmt+0x319>
+				p = "(null)";
+  800d86:	48 b8 8c e1 ff ff ff 	movabs $0xffffffffffffe18c,%rax
+  800d8d:	ff ff ff 
+  800d90:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800d94:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d98:	0f 8e 84 00 00 00    	jle    800e22 <vprintfmt+0x3a7>
+  800d9e:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800da2:	74 7e                	je     800e22 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800da4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800da7:	48 98                	cltq
+  800da9:	48 89 c6             	mov    %rax,%rsi
+  800dac:	4c 89 ef             	mov    %r13,%rdi
+  800daf:	4d 89 e7             	mov    %r12,%r15
+  800db2:	48 b8 77 93 ff ff ff 	movabs $0xffffffffffff9377,%rax
+  800db9:	ff ff ff 
+  800dbc:	4c 01 e0             	add    %r12,%rax
+  800dbf:	ff d0                	call   *%rax
+  800dc1:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800dc4:	eb 17                	jmp    800ddd <vprintfmt+0x362>
+					putch(padc, putdat);
+  800dc6:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800dca:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800dce:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800dd2:	48 89 d6             	mov    %rdx,%rsi
+  800dd5:	89 c7                	mov    %eax,%edi
+  800dd7:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800dd9:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ddd:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800de1:	7f e3                	jg     800dc6 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800de3:	eb 3d                	jmp    800e22 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800de5:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800de9:	74 1e                	je     800e09 <vprintfmt+0x38e>
+  800deb:	83 fb 1f             	cmp    $0x1f,%ebx
+  800dee:	7e 05                	jle    800df5 <vprintfmt+0x37a>
+  800df0:	83 fb 7e             	cmp    $0x7e,%ebx
+  800df3:	7e 14                	jle    800e09 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800df5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800df9:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800dfd:	48 89 c6             	mov    %rax,%rsi
+  800e00:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800e05:	ff d2                	call   *%rdx
+  800e07:	eb 15                	jmp    800e1e <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800e09:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800e0c:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800e0f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e13:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e17:	48 89 c6             	mov    %rax,%rsi
+  800e1a:	89 cf                	mov    %ecx,%edi
+  800e1c:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e1e:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800e22:	4c 89 e8             	mov    %r13,%rax
+  800e25:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800e29:	0f b6 00             	movzbl (%rax),%eax
+  800e2c:	0f be d8             	movsbl %al,%ebx
+  800e2f:	85 db                	test   %ebx,%ebx
+  800e31:	74 28                	je     800e5b <vprintfmt+0x3e0>
+  800e33:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800e37:	78 ac                	js     800de5 <vprintfmt+0x36a>
+  800e39:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800e3d:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800e41:	79 a2                	jns    800de5 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800e43:	eb 16                	jmp    800e5b <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800e45:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e49:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e4d:	48 89 c6             	mov    %rax,%rsi
+  800e50:	bf 20 00 00 00       	mov    $0x20,%edi
+  800e55:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800e57:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800e5b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e5f:	7f e4                	jg     800e45 <vprintfmt+0x3ca>
+			break;
+  800e61:	e9 09 02 00 00       	jmp    80106f <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800e66:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800e6a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800e6e:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800e72:	0f b6 00             	movzbl (%rax),%eax
+  800e75:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800e78:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800e79:	83 fb 2f             	cmp    $0x2f,%ebx
+  800e7c:	0f 8e ac fd ff ff    	jle    800c2e <vprintfmt+0x1b3>
+  800e82:	e9 97 fd ff ff       	jmp    800c1e <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800e87:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e8b:	be 03 00 00 00       	mov    $0x3,%esi
+  800e90:	48 89 c7             	mov    %rax,%rdi
+  800e93:	48 b8 30 89 ff ff ff 	movabs $0xffffffffffff8930,%rax
+  800e9a:	ff ff ff 
+  800e9d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ea1:	ff d0                	call   *%rax
+  800ea3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800ea7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800eab:	48 85 c0             	test   %rax,%rax
+  800eae:	79 1d                	jns    800ecd <vprintfmt+0x452>
+				putch('-', putdat);
+  800eb0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800eb4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800eb8:	48 89 c6             	mov    %rax,%rsi
+  800ebb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ec0:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800ec2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ec6:	48 f7 d8             	neg    %rax
+  800ec9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800ecd:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800ed4:	e9 de 00 00 00       	jmp    800fb7 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800ed9:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800edd:	be 03 00 00 00       	mov    $0x3,%esi
+  800ee2:	48 89 c7             	mov    %rax,%rdi
+  800ee5:	48 b8 cf 87 ff ff ff 	movabs $0xffffffffffff87cf,%rax
+  800eec:	ff ff ff 
+  800eef:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ef3:	ff d0                	call   *%rax
+  800ef5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800ef9:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800f00:	e9 b2 00 00 00       	jmp    800fb7 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800f05:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f09:	be 03 00 00 00       	mov    $0x3,%esi
+  800f0e:	48 89 c7             	mov    %rax,%rdi
+  800f11:	48 b8 cf 87 ff ff ff 	movabs $0xffffffffffff87cf,%rax
+  800f18:	ff ff ff 
+  800f1b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f1f:	ff d0                	call   *%rax
+  800f21:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800f25:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800f2c:	e9 86 00 00 00       	jmp    800fb7 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800f31:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f35:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f39:	48 89 c6             	mov    %rax,%rsi
+  800f3c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800f41:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800f43:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f47:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f4b:	48 89 c6             	mov    %rax,%rsi
+  800f4e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800f53:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800f55:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f58:	83 f8 2f             	cmp    $0x2f,%eax
+  800f5b:	77 17                	ja     800f74 <vprintfmt+0x4f9>
+  800f5d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f61:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f64:	89 d2                	mov    %edx,%edx
+  800f66:	48 01 d0             	add    %rdx,%rax
+  800f69:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f6c:	83 c2 08             	add    $0x8,%edx
+  800f6f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f72:	eb 0c                	jmp    800f80 <vprintfmt+0x505>
+  800f74:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f78:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f7c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f80:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800f83:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800f87:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800f8e:	eb 27                	jmp    800fb7 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800f90:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f94:	be 03 00 00 00       	mov    $0x3,%esi
+  800f99:	48 89 c7             	mov    %rax,%rdi
+  800f9c:	48 b8 cf 87 ff ff ff 	movabs $0xffffffffffff87cf,%rax
+  800fa3:	ff ff ff 
+  800fa6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800faa:	ff d0                	call   *%rax
+  800fac:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800fb0:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800fb7:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800fbc:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800fbf:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800fc2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800fc6:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800fca:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800fce:	45 89 c1             	mov    %r8d,%r9d
+  800fd1:	41 89 f8             	mov    %edi,%r8d
+  800fd4:	48 89 c7             	mov    %rax,%rdi
+  800fd7:	48 b8 f7 86 ff ff ff 	movabs $0xffffffffffff86f7,%rax
+  800fde:	ff ff ff 
+  800fe1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fe5:	ff d0                	call   *%rax
+			break;
+  800fe7:	e9 83 00 00 00       	jmp    80106f <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800fec:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800ff0:	be 03 00 00 00       	mov    $0x3,%esi
+  800ff5:	48 89 c7             	mov    %rax,%rdi
+  800ff8:	48 b8 cf 87 ff ff ff 	movabs $0xffffffffffff87cf,%rax
+  800fff:	ff ff ff 
+  801002:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801006:	ff d0                	call   *%rax
+  801008:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  80100c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801010:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801014:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801018:	48 89 ce             	mov    %rcx,%rsi
+  80101b:	48 89 c7             	mov    %rax,%rdi
+  80101e:	48 b8 ea 88 ff ff ff 	movabs $0xffffffffffff88ea,%rax
+  801025:	ff ff ff 
+  801028:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80102c:	ff d0                	call   *%rax
+	
+			break;
+  80102e:	eb 3f                	jmp    80106f <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801030:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801034:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801038:	48 89 c6             	mov    %rax,%rsi
+  80103b:	89 df                	mov    %ebx,%edi
+  80103d:	ff d2                	call   *%rdx
+			break;
+  80103f:	eb 2e                	jmp    80106f <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801041:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801045:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801049:	48 89 c6             	mov    %rax,%rsi
+  80104c:	bf 25 00 00 00       	mov    $0x25,%edi
+  801051:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801053:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801058:	eb 05                	jmp    80105f <vprintfmt+0x5e4>
+  80105a:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80105f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801063:	48 83 e8 01          	sub    $0x1,%rax
+  801067:	0f b6 00             	movzbl (%rax),%eax
+  80106a:	3c 25                	cmp    $0x25,%al
+  80106c:	75 ec                	jne    80105a <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  80106e:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80106f:	e9 78 fa ff ff       	jmp    800aec <vprintfmt+0x71>
+				return;
+  801074:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801075:	48 83 c4 60          	add    $0x60,%rsp
+  801079:	5b                   	pop    %rbx
+  80107a:	41 5c                	pop    %r12
+  80107c:	41 5d                	pop    %r13
+  80107e:	41 5f                	pop    %r15
+  801080:	5d                   	pop    %rbp
+  801081:	c3                   	ret
+
+0000000000801082 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801082:	55                   	push   %rbp
+  801083:	48 89 e5             	mov    %rsp,%rbp
+  801086:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80108d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80108d <printfmt+0xb>
+  801094:	49 bb a3 6f 00 00 00 	movabs $0x6fa3,%r11
+  80109b:	00 00 00 
+  80109e:	4d 01 da             	add    %r11,%r10
+  8010a1:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8010a8:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8010af:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8010b6:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8010bd:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010c4:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8010cb:	84 c0                	test   %al,%al
+  8010cd:	74 20                	je     8010ef <printfmt+0x6d>
+  8010cf:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8010d3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8010d7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8010db:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8010df:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8010e3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010e7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010eb:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8010ef:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8010f6:	00 00 00 
+  8010f9:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801100:	00 00 00 
+  801103:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801107:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80110e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801115:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80111c:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801123:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80112a:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801131:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801138:	48 89 c7             	mov    %rax,%rdi
+  80113b:	48 b8 4b 8a ff ff ff 	movabs $0xffffffffffff8a4b,%rax
+  801142:	ff ff ff 
+  801145:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801149:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  80114b:	90                   	nop
+  80114c:	c9                   	leave
+  80114d:	c3                   	ret
+
+000000000080114e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80114e:	55                   	push   %rbp
+  80114f:	48 89 e5             	mov    %rsp,%rbp
+  801152:	48 83 ec 10          	sub    $0x10,%rsp
+  801156:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801156 <sprintputch+0x8>
+  80115d:	49 bb da 6e 00 00 00 	movabs $0x6eda,%r11
+  801164:	00 00 00 
+  801167:	4c 01 d8             	add    %r11,%rax
+  80116a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80116d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801171:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801175:	8b 40 10             	mov    0x10(%rax),%eax
+  801178:	8d 50 01             	lea    0x1(%rax),%edx
+  80117b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80117f:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801182:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801186:	48 8b 10             	mov    (%rax),%rdx
+  801189:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80118d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801191:	48 39 c2             	cmp    %rax,%rdx
+  801194:	73 17                	jae    8011ad <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801196:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80119a:	48 8b 00             	mov    (%rax),%rax
+  80119d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011a1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8011a5:	48 89 0a             	mov    %rcx,(%rdx)
+  8011a8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8011ab:	88 10                	mov    %dl,(%rax)
+}
+  8011ad:	90                   	nop
+  8011ae:	c9                   	leave
+  8011af:	c3                   	ret
+
+00000000008011b0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8011b0:	55                   	push   %rbp
+  8011b1:	48 89 e5             	mov    %rsp,%rbp
+  8011b4:	53                   	push   %rbx
+  8011b5:	48 83 ec 58          	sub    $0x58,%rsp
+  8011b9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011b9 <vsnprintf+0x9>
+  8011c0:	49 bb 77 6e 00 00 00 	movabs $0x6e77,%r11
+  8011c7:	00 00 00 
+  8011ca:	4c 01 d8             	add    %r11,%rax
+  8011cd:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8011d1:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8011d4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8011d8:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8011dc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8011e0:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8011e4:	48 8b 0e             	mov    (%rsi),%rcx
+  8011e7:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8011eb:	48 89 0a             	mov    %rcx,(%rdx)
+  8011ee:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8011f2:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8011f6:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8011fa:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8011fe:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801202:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801205:	48 63 d2             	movslq %edx,%rdx
+  801208:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80120c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801210:	48 01 ca             	add    %rcx,%rdx
+  801213:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801217:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  80121e:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801223:	74 06                	je     80122b <vsnprintf+0x7b>
+  801225:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801229:	7f 07                	jg     801232 <vsnprintf+0x82>
+		return -E_INVAL;
+  80122b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801230:	eb 34                	jmp    801266 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801232:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801236:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80123a:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80123e:	48 bf 1e 91 ff ff ff 	movabs $0xffffffffffff911e,%rdi
+  801245:	ff ff ff 
+  801248:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  80124c:	49 b8 4b 8a ff ff ff 	movabs $0xffffffffffff8a4b,%r8
+  801253:	ff ff ff 
+  801256:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80125a:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  80125c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801260:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801263:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801266:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126a:	c9                   	leave
+  80126b:	c3                   	ret
+
+000000000080126c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80126c:	55                   	push   %rbp
+  80126d:	48 89 e5             	mov    %rsp,%rbp
+  801270:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801277:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801277 <snprintf+0xb>
+  80127e:	49 bb b9 6d 00 00 00 	movabs $0x6db9,%r11
+  801285:	00 00 00 
+  801288:	4d 01 da             	add    %r11,%r10
+  80128b:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801292:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801298:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80129f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8012a6:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8012ad:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8012b4:	84 c0                	test   %al,%al
+  8012b6:	74 20                	je     8012d8 <snprintf+0x6c>
+  8012b8:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8012bc:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8012c0:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8012c4:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8012c8:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8012cc:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8012d0:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8012d4:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8012d8:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8012df:	00 00 00 
+  8012e2:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8012e9:	00 00 00 
+  8012ec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8012f0:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8012f7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8012fe:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801305:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80130c:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801313:	48 8b 06             	mov    (%rsi),%rax
+  801316:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80131a:	48 89 01             	mov    %rax,(%rcx)
+  80131d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801321:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801325:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801329:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801330:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801337:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  80133d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801344:	48 89 c7             	mov    %rax,%rdi
+  801347:	48 b8 80 91 ff ff ff 	movabs $0xffffffffffff9180,%rax
+  80134e:	ff ff ff 
+  801351:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801355:	ff d0                	call   *%rax
+  801357:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  80135d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801363:	c9                   	leave
+  801364:	c3                   	ret
+
+0000000000801365 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801365:	55                   	push   %rbp
+  801366:	48 89 e5             	mov    %rsp,%rbp
+  801369:	48 83 ec 18          	sub    $0x18,%rsp
+  80136d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80136d <strlen+0x8>
+  801374:	49 bb c3 6c 00 00 00 	movabs $0x6cc3,%r11
+  80137b:	00 00 00 
+  80137e:	4c 01 d8             	add    %r11,%rax
+  801381:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801385:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80138c:	eb 09                	jmp    801397 <strlen+0x32>
+		n++;
+  80138e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801392:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801397:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80139b:	0f b6 00             	movzbl (%rax),%eax
+  80139e:	84 c0                	test   %al,%al
+  8013a0:	75 ec                	jne    80138e <strlen+0x29>
+	return n;
+  8013a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8013a5:	c9                   	leave
+  8013a6:	c3                   	ret
+
+00000000008013a7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8013a7:	55                   	push   %rbp
+  8013a8:	48 89 e5             	mov    %rsp,%rbp
+  8013ab:	48 83 ec 20          	sub    $0x20,%rsp
+  8013af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013af <strnlen+0x8>
+  8013b6:	49 bb 81 6c 00 00 00 	movabs $0x6c81,%r11
+  8013bd:	00 00 00 
+  8013c0:	4c 01 d8             	add    %r11,%rax
+  8013c3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013cb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8013d2:	eb 0e                	jmp    8013e2 <strnlen+0x3b>
+		n++;
+  8013d4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013d8:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8013dd:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8013e2:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8013e7:	74 0b                	je     8013f4 <strnlen+0x4d>
+  8013e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013ed:	0f b6 00             	movzbl (%rax),%eax
+  8013f0:	84 c0                	test   %al,%al
+  8013f2:	75 e0                	jne    8013d4 <strnlen+0x2d>
+	return n;
+  8013f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8013f7:	c9                   	leave
+  8013f8:	c3                   	ret
+
+00000000008013f9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8013f9:	55                   	push   %rbp
+  8013fa:	48 89 e5             	mov    %rsp,%rbp
+  8013fd:	48 83 ec 20          	sub    $0x20,%rsp
+  801401:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801401 <strcpy+0x8>
+  801408:	49 bb 2f 6c 00 00 00 	movabs $0x6c2f,%r11
+  80140f:	00 00 00 
+  801412:	4c 01 d8             	add    %r11,%rax
+  801415:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801419:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80141d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801421:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801425:	90                   	nop
+  801426:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80142a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80142e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801432:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801436:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80143a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80143e:	0f b6 12             	movzbl (%rdx),%edx
+  801441:	88 10                	mov    %dl,(%rax)
+  801443:	0f b6 00             	movzbl (%rax),%eax
+  801446:	84 c0                	test   %al,%al
+  801448:	75 dc                	jne    801426 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  80144a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80144e:	c9                   	leave
+  80144f:	c3                   	ret
+
+0000000000801450 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801450:	55                   	push   %rbp
+  801451:	48 89 e5             	mov    %rsp,%rbp
+  801454:	53                   	push   %rbx
+  801455:	48 83 ec 20          	sub    $0x20,%rsp
+  801459:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801459 <strcat+0x9>
+  801460:	49 bb d7 6b 00 00 00 	movabs $0x6bd7,%r11
+  801467:	00 00 00 
+  80146a:	4c 01 db             	add    %r11,%rbx
+  80146d:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801471:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801475:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801479:	48 89 c7             	mov    %rax,%rdi
+  80147c:	48 b8 35 93 ff ff ff 	movabs $0xffffffffffff9335,%rax
+  801483:	ff ff ff 
+  801486:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80148a:	ff d0                	call   *%rax
+  80148c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  80148f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801492:	48 63 d0             	movslq %eax,%rdx
+  801495:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801499:	48 01 c2             	add    %rax,%rdx
+  80149c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014a0:	48 89 c6             	mov    %rax,%rsi
+  8014a3:	48 89 d7             	mov    %rdx,%rdi
+  8014a6:	48 b8 c9 93 ff ff ff 	movabs $0xffffffffffff93c9,%rax
+  8014ad:	ff ff ff 
+  8014b0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8014b4:	ff d0                	call   *%rax
+	return dst;
+  8014b6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8014ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014be:	c9                   	leave
+  8014bf:	c3                   	ret
+
+00000000008014c0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8014c0:	55                   	push   %rbp
+  8014c1:	48 89 e5             	mov    %rsp,%rbp
+  8014c4:	48 83 ec 28          	sub    $0x28,%rsp
+  8014c8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014c8 <strncpy+0x8>
+  8014cf:	49 bb 68 6b 00 00 00 	movabs $0x6b68,%r11
+  8014d6:	00 00 00 
+  8014d9:	4c 01 d8             	add    %r11,%rax
+  8014dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014e0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014e4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8014e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014ec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8014f0:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8014f7:	00 
+  8014f8:	eb 2a                	jmp    801524 <strncpy+0x64>
+		*dst++ = *src;
+  8014fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014fe:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801502:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801506:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80150a:	0f b6 12             	movzbl (%rdx),%edx
+  80150d:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80150f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801513:	0f b6 00             	movzbl (%rax),%eax
+  801516:	84 c0                	test   %al,%al
+  801518:	74 05                	je     80151f <strncpy+0x5f>
+			src++;
+  80151a:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80151f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801524:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801528:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80152c:	72 cc                	jb     8014fa <strncpy+0x3a>
+	}
+	return ret;
+  80152e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801532:	c9                   	leave
+  801533:	c3                   	ret
+
+0000000000801534 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801534:	55                   	push   %rbp
+  801535:	48 89 e5             	mov    %rsp,%rbp
+  801538:	48 83 ec 28          	sub    $0x28,%rsp
+  80153c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80153c <strlcpy+0x8>
+  801543:	49 bb f4 6a 00 00 00 	movabs $0x6af4,%r11
+  80154a:	00 00 00 
+  80154d:	4c 01 d8             	add    %r11,%rax
+  801550:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801554:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801558:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80155c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801560:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801564:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801569:	74 3d                	je     8015a8 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  80156b:	eb 1d                	jmp    80158a <strlcpy+0x56>
+			*dst++ = *src++;
+  80156d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801571:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801575:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801579:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80157d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801581:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801585:	0f b6 12             	movzbl (%rdx),%edx
+  801588:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80158a:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80158f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801594:	74 0b                	je     8015a1 <strlcpy+0x6d>
+  801596:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80159a:	0f b6 00             	movzbl (%rax),%eax
+  80159d:	84 c0                	test   %al,%al
+  80159f:	75 cc                	jne    80156d <strlcpy+0x39>
+		*dst = '\0';
+  8015a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015a5:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8015a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015ac:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8015b0:	c9                   	leave
+  8015b1:	c3                   	ret
+
+00000000008015b2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8015b2:	55                   	push   %rbp
+  8015b3:	48 89 e5             	mov    %rsp,%rbp
+  8015b6:	48 83 ec 10          	sub    $0x10,%rsp
+  8015ba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015ba <strcmp+0x8>
+  8015c1:	49 bb 76 6a 00 00 00 	movabs $0x6a76,%r11
+  8015c8:	00 00 00 
+  8015cb:	4c 01 d8             	add    %r11,%rax
+  8015ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015d2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8015d6:	eb 0a                	jmp    8015e2 <strcmp+0x30>
+		p++, q++;
+  8015d8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015dd:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8015e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e6:	0f b6 00             	movzbl (%rax),%eax
+  8015e9:	84 c0                	test   %al,%al
+  8015eb:	74 12                	je     8015ff <strcmp+0x4d>
+  8015ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f1:	0f b6 10             	movzbl (%rax),%edx
+  8015f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015f8:	0f b6 00             	movzbl (%rax),%eax
+  8015fb:	38 c2                	cmp    %al,%dl
+  8015fd:	74 d9                	je     8015d8 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8015ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801603:	0f b6 00             	movzbl (%rax),%eax
+  801606:	0f b6 d0             	movzbl %al,%edx
+  801609:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80160d:	0f b6 00             	movzbl (%rax),%eax
+  801610:	0f b6 c0             	movzbl %al,%eax
+  801613:	29 c2                	sub    %eax,%edx
+  801615:	89 d0                	mov    %edx,%eax
+}
+  801617:	c9                   	leave
+  801618:	c3                   	ret
+
+0000000000801619 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801619:	55                   	push   %rbp
+  80161a:	48 89 e5             	mov    %rsp,%rbp
+  80161d:	48 83 ec 18          	sub    $0x18,%rsp
+  801621:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801621 <strncmp+0x8>
+  801628:	49 bb 0f 6a 00 00 00 	movabs $0x6a0f,%r11
+  80162f:	00 00 00 
+  801632:	4c 01 d8             	add    %r11,%rax
+  801635:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801639:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80163d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801641:	eb 0f                	jmp    801652 <strncmp+0x39>
+		n--, p++, q++;
+  801643:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801648:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80164d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801652:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801657:	74 1d                	je     801676 <strncmp+0x5d>
+  801659:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80165d:	0f b6 00             	movzbl (%rax),%eax
+  801660:	84 c0                	test   %al,%al
+  801662:	74 12                	je     801676 <strncmp+0x5d>
+  801664:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801668:	0f b6 10             	movzbl (%rax),%edx
+  80166b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80166f:	0f b6 00             	movzbl (%rax),%eax
+  801672:	38 c2                	cmp    %al,%dl
+  801674:	74 cd                	je     801643 <strncmp+0x2a>
+	if (n == 0)
+  801676:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80167b:	75 07                	jne    801684 <strncmp+0x6b>
+		return 0;
+  80167d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801682:	eb 16                	jmp    80169a <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801684:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801688:	0f b6 00             	movzbl (%rax),%eax
+  80168b:	0f b6 d0             	movzbl %al,%edx
+  80168e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801692:	0f b6 00             	movzbl (%rax),%eax
+  801695:	0f b6 c0             	movzbl %al,%eax
+  801698:	29 c2                	sub    %eax,%edx
+}
+  80169a:	89 d0                	mov    %edx,%eax
+  80169c:	c9                   	leave
+  80169d:	c3                   	ret
+
+000000000080169e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80169e:	55                   	push   %rbp
+  80169f:	48 89 e5             	mov    %rsp,%rbp
+  8016a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8016a6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016a6 <strchr+0x8>
+  8016ad:	49 bb 8a 69 00 00 00 	movabs $0x698a,%r11
+  8016b4:	00 00 00 
+  8016b7:	4c 01 d8             	add    %r11,%rax
+  8016ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016be:	89 f0                	mov    %esi,%eax
+  8016c0:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8016c3:	eb 17                	jmp    8016dc <strchr+0x3e>
+		if (*s == c)
+  8016c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016c9:	0f b6 00             	movzbl (%rax),%eax
+  8016cc:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8016cf:	75 06                	jne    8016d7 <strchr+0x39>
+			return (char *) s;
+  8016d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016d5:	eb 15                	jmp    8016ec <strchr+0x4e>
+	for (; *s; s++)
+  8016d7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016e0:	0f b6 00             	movzbl (%rax),%eax
+  8016e3:	84 c0                	test   %al,%al
+  8016e5:	75 de                	jne    8016c5 <strchr+0x27>
+	return 0;
+  8016e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016ec:	c9                   	leave
+  8016ed:	c3                   	ret
+
+00000000008016ee <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8016ee:	55                   	push   %rbp
+  8016ef:	48 89 e5             	mov    %rsp,%rbp
+  8016f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8016f6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016f6 <strfind+0x8>
+  8016fd:	49 bb 3a 69 00 00 00 	movabs $0x693a,%r11
+  801704:	00 00 00 
+  801707:	4c 01 d8             	add    %r11,%rax
+  80170a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80170e:	89 f0                	mov    %esi,%eax
+  801710:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801713:	eb 11                	jmp    801726 <strfind+0x38>
+		if (*s == c)
+  801715:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801719:	0f b6 00             	movzbl (%rax),%eax
+  80171c:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80171f:	74 12                	je     801733 <strfind+0x45>
+	for (; *s; s++)
+  801721:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801726:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80172a:	0f b6 00             	movzbl (%rax),%eax
+  80172d:	84 c0                	test   %al,%al
+  80172f:	75 e4                	jne    801715 <strfind+0x27>
+  801731:	eb 01                	jmp    801734 <strfind+0x46>
+			break;
+  801733:	90                   	nop
+	return (char *) s;
+  801734:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801738:	c9                   	leave
+  801739:	c3                   	ret
+
+000000000080173a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80173a:	55                   	push   %rbp
+  80173b:	48 89 e5             	mov    %rsp,%rbp
+  80173e:	48 83 ec 18          	sub    $0x18,%rsp
+  801742:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801742 <memset+0x8>
+  801749:	49 bb ee 68 00 00 00 	movabs $0x68ee,%r11
+  801750:	00 00 00 
+  801753:	4c 01 d8             	add    %r11,%rax
+  801756:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80175a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80175d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801761:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801766:	75 06                	jne    80176e <memset+0x34>
+		return v;
+  801768:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80176c:	eb 69                	jmp    8017d7 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  80176e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801772:	83 e0 03             	and    $0x3,%eax
+  801775:	48 85 c0             	test   %rax,%rax
+  801778:	75 48                	jne    8017c2 <memset+0x88>
+  80177a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80177e:	83 e0 03             	and    $0x3,%eax
+  801781:	48 85 c0             	test   %rax,%rax
+  801784:	75 3c                	jne    8017c2 <memset+0x88>
+		c &= 0xFF;
+  801786:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  80178d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801790:	c1 e0 18             	shl    $0x18,%eax
+  801793:	89 c2                	mov    %eax,%edx
+  801795:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801798:	c1 e0 10             	shl    $0x10,%eax
+  80179b:	09 c2                	or     %eax,%edx
+  80179d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017a0:	c1 e0 08             	shl    $0x8,%eax
+  8017a3:	09 d0                	or     %edx,%eax
+  8017a5:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8017a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017ac:	48 c1 e8 02          	shr    $0x2,%rax
+  8017b0:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8017b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017b7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017ba:	48 89 d7             	mov    %rdx,%rdi
+  8017bd:	fc                   	cld
+  8017be:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8017c0:	eb 11                	jmp    8017d3 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8017c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017c6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017c9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8017cd:	48 89 d7             	mov    %rdx,%rdi
+  8017d0:	fc                   	cld
+  8017d1:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8017d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8017d7:	c9                   	leave
+  8017d8:	c3                   	ret
+
+00000000008017d9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8017d9:	55                   	push   %rbp
+  8017da:	48 89 e5             	mov    %rsp,%rbp
+  8017dd:	48 83 ec 28          	sub    $0x28,%rsp
+  8017e1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017e1 <memmove+0x8>
+  8017e8:	49 bb 4f 68 00 00 00 	movabs $0x684f,%r11
+  8017ef:	00 00 00 
+  8017f2:	4c 01 d8             	add    %r11,%rax
+  8017f5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017f9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017fd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801801:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801805:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801809:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80180d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801811:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801815:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801819:	0f 83 88 00 00 00    	jae    8018a7 <memmove+0xce>
+  80181f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801823:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801827:	48 01 d0             	add    %rdx,%rax
+  80182a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80182e:	73 77                	jae    8018a7 <memmove+0xce>
+		s += n;
+  801830:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801834:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801838:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80183c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801840:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801844:	83 e0 03             	and    $0x3,%eax
+  801847:	48 85 c0             	test   %rax,%rax
+  80184a:	75 3b                	jne    801887 <memmove+0xae>
+  80184c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801850:	83 e0 03             	and    $0x3,%eax
+  801853:	48 85 c0             	test   %rax,%rax
+  801856:	75 2f                	jne    801887 <memmove+0xae>
+  801858:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80185c:	83 e0 03             	and    $0x3,%eax
+  80185f:	48 85 c0             	test   %rax,%rax
+  801862:	75 23                	jne    801887 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801864:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801868:	48 83 e8 04          	sub    $0x4,%rax
+  80186c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801870:	48 83 ea 04          	sub    $0x4,%rdx
+  801874:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801878:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80187c:	48 89 c7             	mov    %rax,%rdi
+  80187f:	48 89 d6             	mov    %rdx,%rsi
+  801882:	fd                   	std
+  801883:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801885:	eb 1d                	jmp    8018a4 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801887:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80188b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80188f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801893:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801897:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80189b:	48 89 d7             	mov    %rdx,%rdi
+  80189e:	48 89 c1             	mov    %rax,%rcx
+  8018a1:	fd                   	std
+  8018a2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8018a4:	fc                   	cld
+  8018a5:	eb 57                	jmp    8018fe <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8018a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018ab:	83 e0 03             	and    $0x3,%eax
+  8018ae:	48 85 c0             	test   %rax,%rax
+  8018b1:	75 36                	jne    8018e9 <memmove+0x110>
+  8018b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018b7:	83 e0 03             	and    $0x3,%eax
+  8018ba:	48 85 c0             	test   %rax,%rax
+  8018bd:	75 2a                	jne    8018e9 <memmove+0x110>
+  8018bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018c3:	83 e0 03             	and    $0x3,%eax
+  8018c6:	48 85 c0             	test   %rax,%rax
+  8018c9:	75 1e                	jne    8018e9 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8018cb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018cf:	48 c1 e8 02          	shr    $0x2,%rax
+  8018d3:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8018d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018da:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018de:	48 89 c7             	mov    %rax,%rdi
+  8018e1:	48 89 d6             	mov    %rdx,%rsi
+  8018e4:	fc                   	cld
+  8018e5:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8018e7:	eb 15                	jmp    8018fe <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  8018e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018ed:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018f1:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8018f5:	48 89 c7             	mov    %rax,%rdi
+  8018f8:	48 89 d6             	mov    %rdx,%rsi
+  8018fb:	fc                   	cld
+  8018fc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  8018fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801902:	c9                   	leave
+  801903:	c3                   	ret
+
+0000000000801904 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801904:	55                   	push   %rbp
+  801905:	48 89 e5             	mov    %rsp,%rbp
+  801908:	48 83 ec 18          	sub    $0x18,%rsp
+  80190c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80190c <memcpy+0x8>
+  801913:	49 bb 24 67 00 00 00 	movabs $0x6724,%r11
+  80191a:	00 00 00 
+  80191d:	4c 01 d8             	add    %r11,%rax
+  801920:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801924:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801928:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  80192c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801930:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801934:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801938:	48 89 cf             	mov    %rcx,%rdi
+  80193b:	48 b9 a9 97 ff ff ff 	movabs $0xffffffffffff97a9,%rcx
+  801942:	ff ff ff 
+  801945:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801949:	ff d0                	call   *%rax
+}
+  80194b:	c9                   	leave
+  80194c:	c3                   	ret
+
+000000000080194d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80194d:	55                   	push   %rbp
+  80194e:	48 89 e5             	mov    %rsp,%rbp
+  801951:	48 83 ec 28          	sub    $0x28,%rsp
+  801955:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801955 <memcmp+0x8>
+  80195c:	49 bb db 66 00 00 00 	movabs $0x66db,%r11
+  801963:	00 00 00 
+  801966:	4c 01 d8             	add    %r11,%rax
+  801969:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80196d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801971:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801975:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801979:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  80197d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801981:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801985:	eb 34                	jmp    8019bb <memcmp+0x6e>
+		if (*s1 != *s2)
+  801987:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80198b:	0f b6 10             	movzbl (%rax),%edx
+  80198e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801992:	0f b6 00             	movzbl (%rax),%eax
+  801995:	38 c2                	cmp    %al,%dl
+  801997:	74 18                	je     8019b1 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801999:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80199d:	0f b6 00             	movzbl (%rax),%eax
+  8019a0:	0f b6 d0             	movzbl %al,%edx
+  8019a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019a7:	0f b6 00             	movzbl (%rax),%eax
+  8019aa:	0f b6 c0             	movzbl %al,%eax
+  8019ad:	29 c2                	sub    %eax,%edx
+  8019af:	eb 20                	jmp    8019d1 <memcmp+0x84>
+		s1++, s2++;
+  8019b1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019b6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  8019bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019bf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019c3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8019c7:	48 85 c0             	test   %rax,%rax
+  8019ca:	75 bb                	jne    801987 <memcmp+0x3a>
+	}
+
+	return 0;
+  8019cc:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8019d1:	89 d0                	mov    %edx,%eax
+  8019d3:	c9                   	leave
+  8019d4:	c3                   	ret
+
+00000000008019d5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8019d5:	55                   	push   %rbp
+  8019d6:	48 89 e5             	mov    %rsp,%rbp
+  8019d9:	48 83 ec 28          	sub    $0x28,%rsp
+  8019dd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019dd <memfind+0x8>
+  8019e4:	49 bb 53 66 00 00 00 	movabs $0x6653,%r11
+  8019eb:	00 00 00 
+  8019ee:	4c 01 d8             	add    %r11,%rax
+  8019f1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019f5:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8019f8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  8019fc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a04:	48 01 d0             	add    %rdx,%rax
+  801a07:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801a0b:	eb 13                	jmp    801a20 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801a0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a11:	0f b6 00             	movzbl (%rax),%eax
+  801a14:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801a17:	38 d0                	cmp    %dl,%al
+  801a19:	74 11                	je     801a2c <memfind+0x57>
+	for (; s < ends; s++)
+  801a1b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801a20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a24:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801a28:	72 e3                	jb     801a0d <memfind+0x38>
+  801a2a:	eb 01                	jmp    801a2d <memfind+0x58>
+			break;
+  801a2c:	90                   	nop
+	return (void *) s;
+  801a2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a31:	c9                   	leave
+  801a32:	c3                   	ret
+
+0000000000801a33 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801a33:	55                   	push   %rbp
+  801a34:	48 89 e5             	mov    %rsp,%rbp
+  801a37:	48 83 ec 38          	sub    $0x38,%rsp
+  801a3b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a3b <strtol+0x8>
+  801a42:	49 bb f5 65 00 00 00 	movabs $0x65f5,%r11
+  801a49:	00 00 00 
+  801a4c:	4c 01 d8             	add    %r11,%rax
+  801a4f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a53:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a57:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801a5a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801a61:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801a68:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801a69:	eb 05                	jmp    801a70 <strtol+0x3d>
+		s++;
+  801a6b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801a70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a74:	0f b6 00             	movzbl (%rax),%eax
+  801a77:	3c 20                	cmp    $0x20,%al
+  801a79:	74 f0                	je     801a6b <strtol+0x38>
+  801a7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a7f:	0f b6 00             	movzbl (%rax),%eax
+  801a82:	3c 09                	cmp    $0x9,%al
+  801a84:	74 e5                	je     801a6b <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801a86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a8a:	0f b6 00             	movzbl (%rax),%eax
+  801a8d:	3c 2b                	cmp    $0x2b,%al
+  801a8f:	75 07                	jne    801a98 <strtol+0x65>
+		s++;
+  801a91:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a96:	eb 17                	jmp    801aaf <strtol+0x7c>
+	else if (*s == '-')
+  801a98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a9c:	0f b6 00             	movzbl (%rax),%eax
+  801a9f:	3c 2d                	cmp    $0x2d,%al
+  801aa1:	75 0c                	jne    801aaf <strtol+0x7c>
+		s++, neg = 1;
+  801aa3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801aa8:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801aaf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ab3:	74 06                	je     801abb <strtol+0x88>
+  801ab5:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801ab9:	75 28                	jne    801ae3 <strtol+0xb0>
+  801abb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801abf:	0f b6 00             	movzbl (%rax),%eax
+  801ac2:	3c 30                	cmp    $0x30,%al
+  801ac4:	75 1d                	jne    801ae3 <strtol+0xb0>
+  801ac6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aca:	48 83 c0 01          	add    $0x1,%rax
+  801ace:	0f b6 00             	movzbl (%rax),%eax
+  801ad1:	3c 78                	cmp    $0x78,%al
+  801ad3:	75 0e                	jne    801ae3 <strtol+0xb0>
+		s += 2, base = 16;
+  801ad5:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801ada:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801ae1:	eb 2c                	jmp    801b0f <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801ae3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ae7:	75 19                	jne    801b02 <strtol+0xcf>
+  801ae9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aed:	0f b6 00             	movzbl (%rax),%eax
+  801af0:	3c 30                	cmp    $0x30,%al
+  801af2:	75 0e                	jne    801b02 <strtol+0xcf>
+		s++, base = 8;
+  801af4:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801af9:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801b00:	eb 0d                	jmp    801b0f <strtol+0xdc>
+	else if (base == 0)
+  801b02:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801b06:	75 07                	jne    801b0f <strtol+0xdc>
+		base = 10;
+  801b08:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801b0f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b13:	0f b6 00             	movzbl (%rax),%eax
+  801b16:	3c 2f                	cmp    $0x2f,%al
+  801b18:	7e 1d                	jle    801b37 <strtol+0x104>
+  801b1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b1e:	0f b6 00             	movzbl (%rax),%eax
+  801b21:	3c 39                	cmp    $0x39,%al
+  801b23:	7f 12                	jg     801b37 <strtol+0x104>
+			dig = *s - '0';
+  801b25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b29:	0f b6 00             	movzbl (%rax),%eax
+  801b2c:	0f be c0             	movsbl %al,%eax
+  801b2f:	83 e8 30             	sub    $0x30,%eax
+  801b32:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801b35:	eb 4e                	jmp    801b85 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801b37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b3b:	0f b6 00             	movzbl (%rax),%eax
+  801b3e:	3c 60                	cmp    $0x60,%al
+  801b40:	7e 1d                	jle    801b5f <strtol+0x12c>
+  801b42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b46:	0f b6 00             	movzbl (%rax),%eax
+  801b49:	3c 7a                	cmp    $0x7a,%al
+  801b4b:	7f 12                	jg     801b5f <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801b4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b51:	0f b6 00             	movzbl (%rax),%eax
+  801b54:	0f be c0             	movsbl %al,%eax
+  801b57:	83 e8 57             	sub    $0x57,%eax
+  801b5a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801b5d:	eb 26                	jmp    801b85 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801b5f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b63:	0f b6 00             	movzbl (%rax),%eax
+  801b66:	3c 40                	cmp    $0x40,%al
+  801b68:	7e 47                	jle    801bb1 <strtol+0x17e>
+  801b6a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b6e:	0f b6 00             	movzbl (%rax),%eax
+  801b71:	3c 5a                	cmp    $0x5a,%al
+  801b73:	7f 3c                	jg     801bb1 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801b75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b79:	0f b6 00             	movzbl (%rax),%eax
+  801b7c:	0f be c0             	movsbl %al,%eax
+  801b7f:	83 e8 37             	sub    $0x37,%eax
+  801b82:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801b85:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b88:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801b8b:	7d 23                	jge    801bb0 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801b8d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b92:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801b95:	48 98                	cltq
+  801b97:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801b9c:	48 89 c2             	mov    %rax,%rdx
+  801b9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ba2:	48 98                	cltq
+  801ba4:	48 01 d0             	add    %rdx,%rax
+  801ba7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801bab:	e9 5f ff ff ff       	jmp    801b0f <strtol+0xdc>
+			break;
+  801bb0:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801bb1:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801bb6:	74 0b                	je     801bc3 <strtol+0x190>
+		*endptr = (char *) s;
+  801bb8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bbc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801bc0:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801bc3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801bc7:	74 09                	je     801bd2 <strtol+0x19f>
+  801bc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bcd:	48 f7 d8             	neg    %rax
+  801bd0:	eb 04                	jmp    801bd6 <strtol+0x1a3>
+  801bd2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801bd6:	c9                   	leave
+  801bd7:	c3                   	ret
+
+0000000000801bd8 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801bd8:	55                   	push   %rbp
+  801bd9:	48 89 e5             	mov    %rsp,%rbp
+  801bdc:	53                   	push   %rbx
+  801bdd:	48 83 ec 30          	sub    $0x30,%rsp
+  801be1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801be1 <strstr+0x9>
+  801be8:	49 bb 4f 64 00 00 00 	movabs $0x644f,%r11
+  801bef:	00 00 00 
+  801bf2:	4c 01 db             	add    %r11,%rbx
+  801bf5:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801bf9:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801bfd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c01:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c05:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c09:	0f b6 00             	movzbl (%rax),%eax
+  801c0c:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801c0f:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801c13:	75 06                	jne    801c1b <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801c15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c19:	eb 73                	jmp    801c8e <strstr+0xb6>
+
+	len = strlen(str);
+  801c1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c1f:	48 89 c7             	mov    %rax,%rdi
+  801c22:	48 b8 35 93 ff ff ff 	movabs $0xffffffffffff9335,%rax
+  801c29:	ff ff ff 
+  801c2c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c30:	ff d0                	call   *%rax
+  801c32:	48 98                	cltq
+  801c34:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801c38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c3c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c40:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801c44:	0f b6 00             	movzbl (%rax),%eax
+  801c47:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801c4a:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801c4e:	75 07                	jne    801c57 <strstr+0x7f>
+				return (char *) 0;
+  801c50:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c55:	eb 37                	jmp    801c8e <strstr+0xb6>
+		} while (sc != c);
+  801c57:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801c5b:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801c5e:	75 d8                	jne    801c38 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801c60:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c64:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801c68:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c6c:	48 89 ce             	mov    %rcx,%rsi
+  801c6f:	48 89 c7             	mov    %rax,%rdi
+  801c72:	48 b8 e9 95 ff ff ff 	movabs $0xffffffffffff95e9,%rax
+  801c79:	ff ff ff 
+  801c7c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c80:	ff d0                	call   *%rax
+  801c82:	85 c0                	test   %eax,%eax
+  801c84:	75 b2                	jne    801c38 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801c86:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c8a:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801c8e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c92:	c9                   	leave
+  801c93:	c3                   	ret
+
+0000000000801c94 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801c94:	55                   	push   %rbp
+  801c95:	48 89 e5             	mov    %rsp,%rbp
+  801c98:	41 57                	push   %r15
+  801c9a:	53                   	push   %rbx
+  801c9b:	48 83 ec 40          	sub    $0x40,%rsp
+  801c9f:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801c9f <syscall+0xb>
+  801ca6:	49 bb 91 63 00 00 00 	movabs $0x6391,%r11
+  801cad:	00 00 00 
+  801cb0:	4d 01 da             	add    %r11,%r10
+  801cb3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801cb6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801cb9:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801cbd:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801cc1:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801cc5:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801cc9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ccc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801cd0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801cd4:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801cd8:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801cdc:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ce0:	4c 89 c3             	mov    %r8,%rbx
+  801ce3:	cd 30                	int    $0x30
+  801ce5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801ce9:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801ced:	74 52                	je     801d41 <syscall+0xad>
+  801cef:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801cf4:	7e 4b                	jle    801d41 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801cf6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cfa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801cfd:	49 89 d0             	mov    %rdx,%r8
+  801d00:	89 c1                	mov    %eax,%ecx
+  801d02:	48 b8 48 e4 ff ff ff 	movabs $0xffffffffffffe448,%rax
+  801d09:	ff ff ff 
+  801d0c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801d10:	48 89 c2             	mov    %rax,%rdx
+  801d13:	be 23 00 00 00       	mov    $0x23,%esi
+  801d18:	48 b8 65 e4 ff ff ff 	movabs $0xffffffffffffe465,%rax
+  801d1f:	ff ff ff 
+  801d22:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801d26:	48 89 c7             	mov    %rax,%rdi
+  801d29:	4d 89 d7             	mov    %r10,%r15
+  801d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d31:	49 b9 30 83 ff ff ff 	movabs $0xffffffffffff8330,%r9
+  801d38:	ff ff ff 
+  801d3b:	4d 01 d1             	add    %r10,%r9
+  801d3e:	41 ff d1             	call   *%r9
+
+	return ret;
+  801d41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d45:	48 83 c4 40          	add    $0x40,%rsp
+  801d49:	5b                   	pop    %rbx
+  801d4a:	41 5f                	pop    %r15
+  801d4c:	5d                   	pop    %rbp
+  801d4d:	c3                   	ret
+
+0000000000801d4e <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801d4e:	55                   	push   %rbp
+  801d4f:	48 89 e5             	mov    %rsp,%rbp
+  801d52:	41 57                	push   %r15
+  801d54:	41 56                	push   %r14
+  801d56:	41 55                	push   %r13
+  801d58:	41 54                	push   %r12
+  801d5a:	53                   	push   %rbx
+  801d5b:	48 83 ec 48          	sub    $0x48,%rsp
+  801d5f:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801d5f <syscall_words+0x11>
+  801d66:	49 bb d1 62 00 00 00 	movabs $0x62d1,%r11
+  801d6d:	00 00 00 
+  801d70:	4d 01 de             	add    %r11,%r14
+  801d73:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801d76:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801d79:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801d7d:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801d81:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801d85:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801d89:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d8e:	74 09                	je     801d99 <syscall_words+0x4b>
+  801d90:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d94:	48 8b 00             	mov    (%rax),%rax
+  801d97:	eb 05                	jmp    801d9e <syscall_words+0x50>
+  801d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9e:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801da1:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801da6:	74 0a                	je     801db2 <syscall_words+0x64>
+  801da8:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801db0:	eb 05                	jmp    801db7 <syscall_words+0x69>
+  801db2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db7:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801dba:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801dbf:	74 0a                	je     801dcb <syscall_words+0x7d>
+  801dc1:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dc5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801dc9:	eb 05                	jmp    801dd0 <syscall_words+0x82>
+  801dcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd0:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801dd3:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801dd8:	74 0a                	je     801de4 <syscall_words+0x96>
+  801dda:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dde:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801de2:	eb 05                	jmp    801de9 <syscall_words+0x9b>
+  801de4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de9:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801dec:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801df1:	74 0a                	je     801dfd <syscall_words+0xaf>
+  801df3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801df7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801dfb:	eb 05                	jmp    801e02 <syscall_words+0xb4>
+  801dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e02:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801e05:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e0a:	74 0a                	je     801e16 <syscall_words+0xc8>
+  801e0c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e10:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801e14:	eb 05                	jmp    801e1b <syscall_words+0xcd>
+  801e16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1b:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801e1e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801e21:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801e25:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801e29:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801e2d:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801e31:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801e35:	cd 30                	int    $0x30
+  801e37:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801e3b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e40:	74 50                	je     801e92 <syscall_words+0x144>
+		words[0] = r8;
+  801e42:	4c 89 c2             	mov    %r8,%rdx
+  801e45:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e49:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801e4c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e50:	48 83 c0 08          	add    $0x8,%rax
+  801e54:	4c 89 ca             	mov    %r9,%rdx
+  801e57:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801e5a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e5e:	48 83 c0 10          	add    $0x10,%rax
+  801e62:	4c 89 d2             	mov    %r10,%rdx
+  801e65:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801e68:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e6c:	48 83 c0 18          	add    $0x18,%rax
+  801e70:	4c 89 da             	mov    %r11,%rdx
+  801e73:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801e76:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e7a:	48 83 c0 20          	add    $0x20,%rax
+  801e7e:	4c 89 e2             	mov    %r12,%rdx
+  801e81:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801e84:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e88:	48 83 c0 28          	add    $0x28,%rax
+  801e8c:	4c 89 ea             	mov    %r13,%rdx
+  801e8f:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801e92:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801e96:	74 52                	je     801eea <syscall_words+0x19c>
+  801e98:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801e9d:	7e 4b                	jle    801eea <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e9f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ea3:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801ea6:	49 89 d0             	mov    %rdx,%r8
+  801ea9:	89 c1                	mov    %eax,%ecx
+  801eab:	48 b8 48 e4 ff ff ff 	movabs $0xffffffffffffe448,%rax
+  801eb2:	ff ff ff 
+  801eb5:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801eb9:	48 89 c2             	mov    %rax,%rdx
+  801ebc:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801ec1:	48 b8 65 e4 ff ff ff 	movabs $0xffffffffffffe465,%rax
+  801ec8:	ff ff ff 
+  801ecb:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801ecf:	48 89 c7             	mov    %rax,%rdi
+  801ed2:	4d 89 f7             	mov    %r14,%r15
+  801ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eda:	49 b9 30 83 ff ff ff 	movabs $0xffffffffffff8330,%r9
+  801ee1:	ff ff ff 
+  801ee4:	4d 01 f1             	add    %r14,%r9
+  801ee7:	41 ff d1             	call   *%r9
+
+	return ret;
+  801eea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801eee:	48 83 c4 48          	add    $0x48,%rsp
+  801ef2:	5b                   	pop    %rbx
+  801ef3:	41 5c                	pop    %r12
+  801ef5:	41 5d                	pop    %r13
+  801ef7:	41 5e                	pop    %r14
+  801ef9:	41 5f                	pop    %r15
+  801efb:	5d                   	pop    %rbp
+  801efc:	c3                   	ret
+
+0000000000801efd <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801efd:	55                   	push   %rbp
+  801efe:	48 89 e5             	mov    %rsp,%rbp
+  801f01:	48 83 ec 10          	sub    $0x10,%rsp
+  801f05:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f05 <sys_cputs+0x8>
+  801f0c:	49 bb 2b 61 00 00 00 	movabs $0x612b,%r11
+  801f13:	00 00 00 
+  801f16:	4c 01 d8             	add    %r11,%rax
+  801f19:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f1d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801f21:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801f25:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f29:	48 83 ec 08          	sub    $0x8,%rsp
+  801f2d:	6a 00                	push   $0x0
+  801f2f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f35:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f3b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f40:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f45:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  801f4c:	ff ff ff 
+  801f4f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f53:	ff d0                	call   *%rax
+  801f55:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f59:	90                   	nop
+  801f5a:	c9                   	leave
+  801f5b:	c3                   	ret
+
+0000000000801f5c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801f5c:	55                   	push   %rbp
+  801f5d:	48 89 e5             	mov    %rsp,%rbp
+  801f60:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f60 <sys_cgetc+0x4>
+  801f67:	49 bb d0 60 00 00 00 	movabs $0x60d0,%r11
+  801f6e:	00 00 00 
+  801f71:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801f74:	48 83 ec 08          	sub    $0x8,%rsp
+  801f78:	6a 00                	push   $0x0
+  801f7a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f80:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f90:	be 00 00 00 00       	mov    $0x0,%esi
+  801f95:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f9a:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  801fa1:	ff ff ff 
+  801fa4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fa8:	ff d0                	call   *%rax
+  801faa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fae:	c9                   	leave
+  801faf:	c3                   	ret
+
+0000000000801fb0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801fb0:	55                   	push   %rbp
+  801fb1:	48 89 e5             	mov    %rsp,%rbp
+  801fb4:	48 83 ec 10          	sub    $0x10,%rsp
+  801fb8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fb8 <sys_env_destroy+0x8>
+  801fbf:	49 bb 78 60 00 00 00 	movabs $0x6078,%r11
+  801fc6:	00 00 00 
+  801fc9:	4c 01 d8             	add    %r11,%rax
+  801fcc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801fcf:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801fd2:	48 63 d2             	movslq %edx,%rdx
+  801fd5:	48 83 ec 08          	sub    $0x8,%rsp
+  801fd9:	6a 00                	push   $0x0
+  801fdb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fe1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fe7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fec:	be 01 00 00 00       	mov    $0x1,%esi
+  801ff1:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ff6:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  801ffd:	ff ff ff 
+  802000:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802004:	ff d0                	call   *%rax
+  802006:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80200a:	c9                   	leave
+  80200b:	c3                   	ret
+
+000000000080200c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80200c:	55                   	push   %rbp
+  80200d:	48 89 e5             	mov    %rsp,%rbp
+  802010:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802010 <sys_getenvid+0x4>
+  802017:	49 bb 20 60 00 00 00 	movabs $0x6020,%r11
+  80201e:	00 00 00 
+  802021:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802024:	48 83 ec 08          	sub    $0x8,%rsp
+  802028:	6a 00                	push   $0x0
+  80202a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802030:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802036:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80203b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802040:	be 00 00 00 00       	mov    $0x0,%esi
+  802045:	bf 02 00 00 00       	mov    $0x2,%edi
+  80204a:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  802051:	ff ff ff 
+  802054:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802058:	ff d0                	call   *%rax
+  80205a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80205e:	c9                   	leave
+  80205f:	c3                   	ret
+
+0000000000802060 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802060:	55                   	push   %rbp
+  802061:	48 89 e5             	mov    %rsp,%rbp
+  802064:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802064 <sys_yield+0x4>
+  80206b:	49 bb cc 5f 00 00 00 	movabs $0x5fcc,%r11
+  802072:	00 00 00 
+  802075:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802078:	48 83 ec 08          	sub    $0x8,%rsp
+  80207c:	6a 00                	push   $0x0
+  80207e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802084:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80208a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80208f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802094:	be 00 00 00 00       	mov    $0x0,%esi
+  802099:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80209e:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  8020a5:	ff ff ff 
+  8020a8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020ac:	ff d0                	call   *%rax
+  8020ae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020b2:	90                   	nop
+  8020b3:	c9                   	leave
+  8020b4:	c3                   	ret
+
+00000000008020b5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8020b5:	55                   	push   %rbp
+  8020b6:	48 89 e5             	mov    %rsp,%rbp
+  8020b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8020bd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020bd <sys_page_alloc+0x8>
+  8020c4:	49 bb 73 5f 00 00 00 	movabs $0x5f73,%r11
+  8020cb:	00 00 00 
+  8020ce:	4c 01 d8             	add    %r11,%rax
+  8020d1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020d4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020d8:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8020db:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020de:	48 63 f2             	movslq %edx,%rsi
+  8020e1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020e5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020e8:	48 63 d2             	movslq %edx,%rdx
+  8020eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8020ef:	6a 00                	push   $0x0
+  8020f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020f7:	49 89 f0             	mov    %rsi,%r8
+  8020fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8020ff:	bf 04 00 00 00       	mov    $0x4,%edi
+  802104:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  80210b:	ff ff ff 
+  80210e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802112:	ff d0                	call   *%rax
+  802114:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802118:	c9                   	leave
+  802119:	c3                   	ret
+
+000000000080211a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80211a:	55                   	push   %rbp
+  80211b:	48 89 e5             	mov    %rsp,%rbp
+  80211e:	48 83 ec 20          	sub    $0x20,%rsp
+  802122:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802122 <sys_page_map+0x8>
+  802129:	49 bb 0e 5f 00 00 00 	movabs $0x5f0e,%r11
+  802130:	00 00 00 
+  802133:	4c 01 d8             	add    %r11,%rax
+  802136:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802139:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80213d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802140:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802144:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802148:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80214b:	48 63 f2             	movslq %edx,%rsi
+  80214e:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802152:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802155:	48 63 fa             	movslq %edx,%rdi
+  802158:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80215c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80215f:	48 63 d2             	movslq %edx,%rdx
+  802162:	48 83 ec 08          	sub    $0x8,%rsp
+  802166:	56                   	push   %rsi
+  802167:	4d 89 c1             	mov    %r8,%r9
+  80216a:	49 89 f8             	mov    %rdi,%r8
+  80216d:	be 01 00 00 00       	mov    $0x1,%esi
+  802172:	bf 05 00 00 00       	mov    $0x5,%edi
+  802177:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  80217e:	ff ff ff 
+  802181:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802185:	ff d0                	call   *%rax
+  802187:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80218b:	c9                   	leave
+  80218c:	c3                   	ret
+
+000000000080218d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80218d:	55                   	push   %rbp
+  80218e:	48 89 e5             	mov    %rsp,%rbp
+  802191:	48 83 ec 10          	sub    $0x10,%rsp
+  802195:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802195 <sys_page_unmap+0x8>
+  80219c:	49 bb 9b 5e 00 00 00 	movabs $0x5e9b,%r11
+  8021a3:	00 00 00 
+  8021a6:	4c 01 d8             	add    %r11,%rax
+  8021a9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021ac:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8021b0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021b4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021b7:	48 63 d2             	movslq %edx,%rdx
+  8021ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8021be:	6a 00                	push   $0x0
+  8021c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021cc:	be 01 00 00 00       	mov    $0x1,%esi
+  8021d1:	bf 06 00 00 00       	mov    $0x6,%edi
+  8021d6:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  8021dd:	ff ff ff 
+  8021e0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021e4:	ff d0                	call   *%rax
+  8021e6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021ea:	c9                   	leave
+  8021eb:	c3                   	ret
+
+00000000008021ec <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8021ec:	55                   	push   %rbp
+  8021ed:	48 89 e5             	mov    %rsp,%rbp
+  8021f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8021f4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021f4 <sys_env_set_status+0x8>
+  8021fb:	49 bb 3c 5e 00 00 00 	movabs $0x5e3c,%r11
+  802202:	00 00 00 
+  802205:	4c 01 d8             	add    %r11,%rax
+  802208:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80220b:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80220e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802211:	48 63 ca             	movslq %edx,%rcx
+  802214:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802217:	48 63 d2             	movslq %edx,%rdx
+  80221a:	48 83 ec 08          	sub    $0x8,%rsp
+  80221e:	6a 00                	push   $0x0
+  802220:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802226:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80222c:	be 01 00 00 00       	mov    $0x1,%esi
+  802231:	bf 08 00 00 00       	mov    $0x8,%edi
+  802236:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  80223d:	ff ff ff 
+  802240:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802244:	ff d0                	call   *%rax
+  802246:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80224a:	c9                   	leave
+  80224b:	c3                   	ret
+
+000000000080224c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80224c:	55                   	push   %rbp
+  80224d:	48 89 e5             	mov    %rsp,%rbp
+  802250:	48 83 ec 10          	sub    $0x10,%rsp
+  802254:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802254 <sys_env_set_trapframe+0x8>
+  80225b:	49 bb dc 5d 00 00 00 	movabs $0x5ddc,%r11
+  802262:	00 00 00 
+  802265:	4c 01 d8             	add    %r11,%rax
+  802268:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80226b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  80226f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802273:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802276:	48 63 d2             	movslq %edx,%rdx
+  802279:	48 83 ec 08          	sub    $0x8,%rsp
+  80227d:	6a 00                	push   $0x0
+  80227f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802285:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80228b:	be 01 00 00 00       	mov    $0x1,%esi
+  802290:	bf 09 00 00 00       	mov    $0x9,%edi
+  802295:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  80229c:	ff ff ff 
+  80229f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022a3:	ff d0                	call   *%rax
+  8022a5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a9:	c9                   	leave
+  8022aa:	c3                   	ret
+
+00000000008022ab <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8022ab:	55                   	push   %rbp
+  8022ac:	48 89 e5             	mov    %rsp,%rbp
+  8022af:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022b3 <sys_env_set_pgfault_upcall+0x8>
+  8022ba:	49 bb 7d 5d 00 00 00 	movabs $0x5d7d,%r11
+  8022c1:	00 00 00 
+  8022c4:	4c 01 d8             	add    %r11,%rax
+  8022c7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8022ce:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022d2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022d5:	48 63 d2             	movslq %edx,%rdx
+  8022d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8022dc:	6a 00                	push   $0x0
+  8022de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8022ef:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8022f4:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  8022fb:	ff ff ff 
+  8022fe:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802302:	ff d0                	call   *%rax
+  802304:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802308:	c9                   	leave
+  802309:	c3                   	ret
+
+000000000080230a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80230a:	55                   	push   %rbp
+  80230b:	48 89 e5             	mov    %rsp,%rbp
+  80230e:	48 83 ec 20          	sub    $0x20,%rsp
+  802312:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802312 <sys_ipc_try_send+0x8>
+  802319:	49 bb 1e 5d 00 00 00 	movabs $0x5d1e,%r11
+  802320:	00 00 00 
+  802323:	4c 01 d8             	add    %r11,%rax
+  802326:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802329:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80232d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802331:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802334:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802337:	48 63 fa             	movslq %edx,%rdi
+  80233a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80233e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802341:	48 63 d2             	movslq %edx,%rdx
+  802344:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802348:	48 83 ec 08          	sub    $0x8,%rsp
+  80234c:	6a 00                	push   $0x0
+  80234e:	49 89 f9             	mov    %rdi,%r9
+  802351:	49 89 f0             	mov    %rsi,%r8
+  802354:	be 00 00 00 00       	mov    $0x0,%esi
+  802359:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80235e:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  802365:	ff ff ff 
+  802368:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80236c:	ff d0                	call   *%rax
+  80236e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802372:	c9                   	leave
+  802373:	c3                   	ret
+
+0000000000802374 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802374:	55                   	push   %rbp
+  802375:	48 89 e5             	mov    %rsp,%rbp
+  802378:	48 83 ec 20          	sub    $0x20,%rsp
+  80237c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80237c <sys_ipc_send+0x8>
+  802383:	49 bb b4 5c 00 00 00 	movabs $0x5cb4,%r11
+  80238a:	00 00 00 
+  80238d:	4c 01 d8             	add    %r11,%rax
+  802390:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802393:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802397:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80239b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80239e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023a1:	48 63 fa             	movslq %edx,%rdi
+  8023a4:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8023a8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023ab:	48 63 d2             	movslq %edx,%rdx
+  8023ae:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b6:	6a 00                	push   $0x0
+  8023b8:	49 89 f9             	mov    %rdi,%r9
+  8023bb:	49 89 f0             	mov    %rsi,%r8
+  8023be:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c3:	bf 17 00 00 00       	mov    $0x17,%edi
+  8023c8:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  8023cf:	ff ff ff 
+  8023d2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023d6:	ff d0                	call   *%rax
+  8023d8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023dc:	c9                   	leave
+  8023dd:	c3                   	ret
+
+00000000008023de <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8023de:	55                   	push   %rbp
+  8023df:	48 89 e5             	mov    %rsp,%rbp
+  8023e2:	48 83 ec 10          	sub    $0x10,%rsp
+  8023e6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023e6 <sys_ipc_recv+0x8>
+  8023ed:	49 bb 4a 5c 00 00 00 	movabs $0x5c4a,%r11
+  8023f4:	00 00 00 
+  8023f7:	4c 01 d8             	add    %r11,%rax
+  8023fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8023fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802402:	6a 00                	push   $0x0
+  802404:	6a 00                	push   $0x0
+  802406:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80240c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802412:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802417:	be 01 00 00 00       	mov    $0x1,%esi
+  80241c:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802421:	49 ba 1e 9d ff ff ff 	movabs $0xffffffffffff9d1e,%r10
+  802428:	ff ff ff 
+  80242b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80242f:	ff d0                	call   *%rax
+  802431:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802435:	c9                   	leave
+  802436:	c3                   	ret
+
+0000000000802437 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802437:	55                   	push   %rbp
+  802438:	48 89 e5             	mov    %rsp,%rbp
+  80243b:	48 83 ec 30          	sub    $0x30,%rsp
+  80243f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80243f <sys_ipc_call+0x8>
+  802446:	49 bb f1 5b 00 00 00 	movabs $0x5bf1,%r11
+  80244d:	00 00 00 
+  802450:	4c 01 d8             	add    %r11,%rax
+  802453:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802456:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80245a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80245e:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802461:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802465:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802469:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80246d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802470:	4c 63 c2             	movslq %edx,%r8
+  802473:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802477:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80247a:	48 63 d2             	movslq %edx,%rdx
+  80247d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802481:	ff 75 d8             	push   -0x28(%rbp)
+  802484:	56                   	push   %rsi
+  802485:	4d 89 c1             	mov    %r8,%r9
+  802488:	49 89 f8             	mov    %rdi,%r8
+  80248b:	be 00 00 00 00       	mov    $0x0,%esi
+  802490:	bf 18 00 00 00       	mov    $0x18,%edi
+  802495:	49 ba 1e 9d ff ff ff 	movabs $0xffffffffffff9d1e,%r10
+  80249c:	ff ff ff 
+  80249f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024a3:	ff d0                	call   *%rax
+  8024a5:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8024a9:	c9                   	leave
+  8024aa:	c3                   	ret
+
+00000000008024ab <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8024ab:	55                   	push   %rbp
+  8024ac:	48 89 e5             	mov    %rsp,%rbp
+  8024af:	48 83 ec 30          	sub    $0x30,%rsp
+  8024b3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024b3 <sys_ipc_reply_recv+0x8>
+  8024ba:	49 bb 7d 5b 00 00 00 	movabs $0x5b7d,%r11
+  8024c1:	00 00 00 
+  8024c4:	4c 01 d8             	add    %r11,%rax
+  8024c7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024ce:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024d2:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8024d5:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8024d9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8024dd:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8024e1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024e4:	4c 63 c2             	movslq %edx,%r8
+  8024e7:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8024eb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024ee:	48 63 d2             	movslq %edx,%rdx
+  8024f1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024f5:	ff 75 d8             	push   -0x28(%rbp)
+  8024f8:	56                   	push   %rsi
+  8024f9:	4d 89 c1             	mov    %r8,%r9
+  8024fc:	49 89 f8             	mov    %rdi,%r8
+  8024ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802504:	bf 19 00 00 00       	mov    $0x19,%edi
+  802509:	49 ba 1e 9d ff ff ff 	movabs $0xffffffffffff9d1e,%r10
+  802510:	ff ff ff 
+  802513:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802517:	ff d0                	call   *%rax
+  802519:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  80251d:	c9                   	leave
+  80251e:	c3                   	ret
+
+000000000080251f <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80251f:	55                   	push   %rbp
+  802520:	48 89 e5             	mov    %rsp,%rbp
+  802523:	48 83 ec 10          	sub    $0x10,%rsp
+  802527:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802527 <sys_env_set_priority+0x8>
+  80252e:	49 bb 09 5b 00 00 00 	movabs $0x5b09,%r11
+  802535:	00 00 00 
+  802538:	4c 01 d8             	add    %r11,%rax
+  80253b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80253e:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802541:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802544:	48 63 ca             	movslq %edx,%rcx
+  802547:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80254a:	48 63 d2             	movslq %edx,%rdx
+  80254d:	48 83 ec 08          	sub    $0x8,%rsp
+  802551:	6a 00                	push   $0x0
+  802553:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802559:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80255f:	be 01 00 00 00       	mov    $0x1,%esi
+  802564:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802569:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  802570:	ff ff ff 
+  802573:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802577:	ff d0                	call   *%rax
+  802579:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80257d:	c9                   	leave
+  80257e:	c3                   	ret
+
+000000000080257f <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80257f:	55                   	push   %rbp
+  802580:	48 89 e5             	mov    %rsp,%rbp
+  802583:	48 83 ec 10          	sub    $0x10,%rsp
+  802587:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802587 <sys_env_set_affinity+0x8>
+  80258e:	49 bb a9 5a 00 00 00 	movabs $0x5aa9,%r11
+  802595:	00 00 00 
+  802598:	4c 01 d8             	add    %r11,%rax
+  80259b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80259e:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8025a1:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8025a4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025a7:	48 63 d2             	movslq %edx,%rdx
+  8025aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ae:	6a 00                	push   $0x0
+  8025b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025bc:	be 01 00 00 00       	mov    $0x1,%esi
+  8025c1:	bf 10 00 00 00       	mov    $0x10,%edi
+  8025c6:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  8025cd:	ff ff ff 
+  8025d0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025d4:	ff d0                	call   *%rax
+  8025d6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025da:	c9                   	leave
+  8025db:	c3                   	ret
+
+00000000008025dc <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8025dc:	55                   	push   %rbp
+  8025dd:	48 89 e5             	mov    %rsp,%rbp
+  8025e0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025e0 <sys_time_msec+0x4>
+  8025e7:	49 bb 50 5a 00 00 00 	movabs $0x5a50,%r11
+  8025ee:	00 00 00 
+  8025f1:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8025f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f8:	6a 00                	push   $0x0
+  8025fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802600:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802606:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80260b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802610:	be 00 00 00 00       	mov    $0x0,%esi
+  802615:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80261a:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  802621:	ff ff ff 
+  802624:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802628:	ff d0                	call   *%rax
+  80262a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80262e:	c9                   	leave
+  80262f:	c3                   	ret
+
+0000000000802630 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802630:	55                   	push   %rbp
+  802631:	48 89 e5             	mov    %rsp,%rbp
+  802634:	48 83 ec 10          	sub    $0x10,%rsp
+  802638:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802638 <sys_sleep_usec+0x8>
+  80263f:	49 bb f8 59 00 00 00 	movabs $0x59f8,%r11
+  802646:	00 00 00 
+  802649:	4c 01 d8             	add    %r11,%rax
+  80264c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802650:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802654:	48 83 ec 08          	sub    $0x8,%rsp
+  802658:	6a 00                	push   $0x0
+  80265a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802660:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802666:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80266b:	be 00 00 00 00       	mov    $0x0,%esi
+  802670:	bf 11 00 00 00       	mov    $0x11,%edi
+  802675:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  80267c:	ff ff ff 
+  80267f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802683:	ff d0                	call   *%rax
+  802685:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802689:	c9                   	leave
+  80268a:	c3                   	ret
+
+000000000080268b <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  80268b:	55                   	push   %rbp
+  80268c:	48 89 e5             	mov    %rsp,%rbp
+  80268f:	48 83 ec 10          	sub    $0x10,%rsp
+  802693:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802693 <sys_page_alloc_huge+0x8>
+  80269a:	49 bb 9d 59 00 00 00 	movabs $0x599d,%r11
+  8026a1:	00 00 00 
+  8026a4:	4c 01 d8             	add    %r11,%rax
+  8026a7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026ae:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8026b1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026b4:	48 63 f2             	movslq %edx,%rsi
+  8026b7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026bb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026be:	48 63 d2             	movslq %edx,%rdx
+  8026c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8026c5:	6a 00                	push   $0x0
+  8026c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026cd:	49 89 f0             	mov    %rsi,%r8
+  8026d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8026d5:	bf 12 00 00 00       	mov    $0x12,%edi
+  8026da:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  8026e1:	ff ff ff 
+  8026e4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026e8:	ff d0                	call   *%rax
+  8026ea:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026ee:	c9                   	leave
+  8026ef:	c3                   	ret
+
+00000000008026f0 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8026f0:	55                   	push   %rbp
+  8026f1:	48 89 e5             	mov    %rsp,%rbp
+  8026f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8026f8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026f8 <sys_page_map_batch+0x8>
+  8026ff:	49 bb 38 59 00 00 00 	movabs $0x5938,%r11
+  802706:	00 00 00 
+  802709:	4c 01 d8             	add    %r11,%rax
+  80270c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802710:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802714:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802718:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80271c:	48 83 ec 08          	sub    $0x8,%rsp
+  802720:	6a 00                	push   $0x0
+  802722:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802728:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80272e:	be 01 00 00 00       	mov    $0x1,%esi
+  802733:	bf 13 00 00 00       	mov    $0x13,%edi
+  802738:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  80273f:	ff ff ff 
+  802742:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802746:	ff d0                	call   *%rax
+  802748:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+
+000000000080274e <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  80274e:	55                   	push   %rbp
+  80274f:	48 89 e5             	mov    %rsp,%rbp
+  802752:	48 83 ec 10          	sub    $0x10,%rsp
+  802756:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802756 <sys_page_alloc_batch+0x8>
+  80275d:	49 bb da 58 00 00 00 	movabs $0x58da,%r11
+  802764:	00 00 00 
+  802767:	4c 01 d8             	add    %r11,%rax
+  80276a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80276e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802772:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802776:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80277a:	48 83 ec 08          	sub    $0x8,%rsp
+  80277e:	6a 00                	push   $0x0
+  802780:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802786:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80278c:	be 01 00 00 00       	mov    $0x1,%esi
+  802791:	bf 14 00 00 00       	mov    $0x14,%edi
+  802796:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  80279d:	ff ff ff 
+  8027a0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027a4:	ff d0                	call   *%rax
+  8027a6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027aa:	c9                   	leave
+  8027ab:	c3                   	ret
+
+00000000008027ac <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8027ac:	55                   	push   %rbp
+  8027ad:	48 89 e5             	mov    %rsp,%rbp
+  8027b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8027b4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027b4 <sys_page_unmap_batch+0x8>
+  8027bb:	49 bb 7c 58 00 00 00 	movabs $0x587c,%r11
+  8027c2:	00 00 00 
+  8027c5:	4c 01 d8             	add    %r11,%rax
+  8027c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8027d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027d4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8027dc:	6a 00                	push   $0x0
+  8027de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8027ef:	bf 15 00 00 00       	mov    $0x15,%edi
+  8027f4:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  8027fb:	ff ff ff 
+  8027fe:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802802:	ff d0                	call   *%rax
+  802804:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802808:	c9                   	leave
+  802809:	c3                   	ret
+
+000000000080280a <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80280a:	55                   	push   %rbp
+  80280b:	48 89 e5             	mov    %rsp,%rbp
+  80280e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80280e <sys_fork+0x4>
+  802815:	49 bb 22 58 00 00 00 	movabs $0x5822,%r11
+  80281c:	00 00 00 
+  80281f:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802822:	48 83 ec 08          	sub    $0x8,%rsp
+  802826:	6a 00                	push   $0x0
+  802828:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80282e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802834:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802839:	ba 00 00 00 00       	mov    $0x0,%edx
+  80283e:	be 00 00 00 00       	mov    $0x0,%esi
+  802843:	bf 16 00 00 00       	mov    $0x16,%edi
+  802848:	49 ba 64 9c ff ff ff 	movabs $0xffffffffffff9c64,%r10
+  80284f:	ff ff ff 
+  802852:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802856:	ff d0                	call   *%rax
+  802858:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80285c:	c9                   	leave
+  80285d:	c3                   	ret
+
+000000000080285e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  80285e:	55                   	push   %rbp
+  80285f:	48 89 e5             	mov    %rsp,%rbp
+  802862:	48 83 ec 08          	sub    $0x8,%rsp
+  802866:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802866 <fd2num+0x8>
+  80286d:	49 bb ca 57 00 00 00 	movabs $0x57ca,%r11
+  802874:	00 00 00 
+  802877:	4c 01 d8             	add    %r11,%rax
+  80287a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80287e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802882:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802889:	ff ff ff 
+  80288c:	48 01 d0             	add    %rdx,%rax
+  80288f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802893:	c9                   	leave
+  802894:	c3                   	ret
+
+0000000000802895 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802895:	55                   	push   %rbp
+  802896:	48 89 e5             	mov    %rsp,%rbp
+  802899:	48 83 ec 08          	sub    $0x8,%rsp
+  80289d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80289d <fd2data+0x8>
+  8028a4:	49 bb 93 57 00 00 00 	movabs $0x5793,%r11
+  8028ab:	00 00 00 
+  8028ae:	4c 01 d8             	add    %r11,%rax
+  8028b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  8028b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028b9:	48 89 d7             	mov    %rdx,%rdi
+  8028bc:	48 ba 2e a8 ff ff ff 	movabs $0xffffffffffffa82e,%rdx
+  8028c3:	ff ff ff 
+  8028c6:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8028ca:	ff d0                	call   *%rax
+  8028cc:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8028d2:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8028d6:	c9                   	leave
+  8028d7:	c3                   	ret
+
+00000000008028d8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8028d8:	55                   	push   %rbp
+  8028d9:	48 89 e5             	mov    %rsp,%rbp
+  8028dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8028e0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028e0 <fd_alloc+0x8>
+  8028e7:	49 bb 50 57 00 00 00 	movabs $0x5750,%r11
+  8028ee:	00 00 00 
+  8028f1:	4c 01 d8             	add    %r11,%rax
+  8028f4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8028f8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8028ff:	eb 75                	jmp    802976 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  802901:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802904:	48 63 d2             	movslq %edx,%rdx
+  802907:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  80290e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802912:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802916:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80291a:	48 89 d1             	mov    %rdx,%rcx
+  80291d:	48 c1 e9 15          	shr    $0x15,%rcx
+  802921:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802928:	ff ff ff 
+  80292b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80292f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802933:	83 e2 01             	and    $0x1,%edx
+  802936:	48 85 d2             	test   %rdx,%rdx
+  802939:	74 25                	je     802960 <fd_alloc+0x88>
+  80293b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80293f:	48 89 d1             	mov    %rdx,%rcx
+  802942:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802946:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80294d:	ff ff ff 
+  802950:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802954:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802958:	83 e2 01             	and    $0x1,%edx
+  80295b:	48 85 d2             	test   %rdx,%rdx
+  80295e:	75 12                	jne    802972 <fd_alloc+0x9a>
+			*fd_store = fd;
+  802960:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802964:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802968:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80296b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802970:	eb 1a                	jmp    80298c <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802972:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802976:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80297a:	7e 85                	jle    802901 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  80297c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802980:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802987:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  80298c:	c9                   	leave
+  80298d:	c3                   	ret
+
+000000000080298e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80298e:	55                   	push   %rbp
+  80298f:	48 89 e5             	mov    %rsp,%rbp
+  802992:	48 83 ec 20          	sub    $0x20,%rsp
+  802996:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802996 <fd_lookup+0x8>
+  80299d:	49 bb 9a 56 00 00 00 	movabs $0x569a,%r11
+  8029a4:	00 00 00 
+  8029a7:	4c 01 d8             	add    %r11,%rax
+  8029aa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8029ad:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8029b1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8029b5:	78 06                	js     8029bd <fd_lookup+0x2f>
+  8029b7:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8029bb:	7e 07                	jle    8029c4 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8029bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029c2:	eb 73                	jmp    802a37 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  8029c4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8029c7:	48 63 d2             	movslq %edx,%rdx
+  8029ca:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8029d1:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8029d5:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8029d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029dd:	48 89 d1             	mov    %rdx,%rcx
+  8029e0:	48 c1 e9 15          	shr    $0x15,%rcx
+  8029e4:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8029eb:	ff ff ff 
+  8029ee:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8029f2:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8029f6:	83 e2 01             	and    $0x1,%edx
+  8029f9:	48 85 d2             	test   %rdx,%rdx
+  8029fc:	74 22                	je     802a20 <fd_lookup+0x92>
+  8029fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a02:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802a06:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  802a0d:	ff ff ff 
+  802a10:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802a14:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a18:	83 e0 01             	and    $0x1,%eax
+  802a1b:	48 85 c0             	test   %rax,%rax
+  802a1e:	75 07                	jne    802a27 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802a20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a25:	eb 10                	jmp    802a37 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802a27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a2b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a2f:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802a32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a37:	c9                   	leave
+  802a38:	c3                   	ret
+
+0000000000802a39 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802a39:	55                   	push   %rbp
+  802a3a:	48 89 e5             	mov    %rsp,%rbp
+  802a3d:	41 57                	push   %r15
+  802a3f:	53                   	push   %rbx
+  802a40:	48 83 ec 30          	sub    $0x30,%rsp
+  802a44:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a44 <fd_close+0xb>
+  802a4b:	49 bb ec 55 00 00 00 	movabs $0x55ec,%r11
+  802a52:	00 00 00 
+  802a55:	4c 01 db             	add    %r11,%rbx
+  802a58:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802a5c:	89 f0                	mov    %esi,%eax
+  802a5e:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802a61:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a65:	48 89 c7             	mov    %rax,%rdi
+  802a68:	48 b8 2e a8 ff ff ff 	movabs $0xffffffffffffa82e,%rax
+  802a6f:	ff ff ff 
+  802a72:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a76:	ff d0                	call   *%rax
+  802a78:	89 c2                	mov    %eax,%edx
+  802a7a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802a7e:	48 89 c6             	mov    %rax,%rsi
+  802a81:	89 d7                	mov    %edx,%edi
+  802a83:	48 b8 5e a9 ff ff ff 	movabs $0xffffffffffffa95e,%rax
+  802a8a:	ff ff ff 
+  802a8d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a91:	ff d0                	call   *%rax
+  802a93:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802a96:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802a9a:	78 0a                	js     802aa6 <fd_close+0x6d>
+	    || fd != fd2)
+  802a9c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802aa0:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802aa4:	74 12                	je     802ab8 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802aa6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802aaa:	74 05                	je     802ab1 <fd_close+0x78>
+  802aac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802aaf:	eb 7a                	jmp    802b2b <fd_close+0xf2>
+  802ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab6:	eb 73                	jmp    802b2b <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802ab8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802abc:	8b 00                	mov    (%rax),%eax
+  802abe:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802ac2:	48 89 d6             	mov    %rdx,%rsi
+  802ac5:	89 c7                	mov    %eax,%edi
+  802ac7:	48 b8 04 ab ff ff ff 	movabs $0xffffffffffffab04,%rax
+  802ace:	ff ff ff 
+  802ad1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ad5:	ff d0                	call   *%rax
+  802ad7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ada:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ade:	78 2a                	js     802b0a <fd_close+0xd1>
+		if (dev->dev_close)
+  802ae0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ae4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802ae8:	48 85 c0             	test   %rax,%rax
+  802aeb:	74 16                	je     802b03 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802aed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802af1:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802af5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802af9:	48 89 c7             	mov    %rax,%rdi
+  802afc:	ff d2                	call   *%rdx
+  802afe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b01:	eb 07                	jmp    802b0a <fd_close+0xd1>
+		else
+			r = 0;
+  802b03:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802b0a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b0e:	48 89 c6             	mov    %rax,%rsi
+  802b11:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b16:	49 89 df             	mov    %rbx,%r15
+  802b19:	48 b8 5d a1 ff ff ff 	movabs $0xffffffffffffa15d,%rax
+  802b20:	ff ff ff 
+  802b23:	48 01 d8             	add    %rbx,%rax
+  802b26:	ff d0                	call   *%rax
+	return r;
+  802b28:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802b2b:	48 83 c4 30          	add    $0x30,%rsp
+  802b2f:	5b                   	pop    %rbx
+  802b30:	41 5f                	pop    %r15
+  802b32:	5d                   	pop    %rbp
+  802b33:	c3                   	ret
+
+0000000000802b34 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802b34:	55                   	push   %rbp
+  802b35:	48 89 e5             	mov    %rsp,%rbp
+  802b38:	41 57                	push   %r15
+  802b3a:	48 83 ec 28          	sub    $0x28,%rsp
+  802b3e:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802b3e <dev_lookup+0xa>
+  802b45:	49 bb f2 54 00 00 00 	movabs $0x54f2,%r11
+  802b4c:	00 00 00 
+  802b4f:	4c 01 d9             	add    %r11,%rcx
+  802b52:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802b55:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802b59:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802b60:	eb 45                	jmp    802ba7 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802b62:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802b69:	00 00 00 
+  802b6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b6f:	48 98                	cltq
+  802b71:	48 01 ca             	add    %rcx,%rdx
+  802b74:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b78:	8b 00                	mov    (%rax),%eax
+  802b7a:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802b7d:	75 24                	jne    802ba3 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802b7f:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802b86:	00 00 00 
+  802b89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b8c:	48 98                	cltq
+  802b8e:	48 01 ca             	add    %rcx,%rdx
+  802b91:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b95:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b99:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba1:	eb 74                	jmp    802c17 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802ba3:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802ba7:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802bae:	00 00 00 
+  802bb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bb4:	48 98                	cltq
+  802bb6:	48 01 ca             	add    %rcx,%rdx
+  802bb9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802bbd:	48 85 c0             	test   %rax,%rax
+  802bc0:	75 a0                	jne    802b62 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802bc2:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802bc9:	ff ff ff 
+  802bcc:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802bd0:	48 8b 00             	mov    (%rax),%rax
+  802bd3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802bd9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802bdc:	89 c6                	mov    %eax,%esi
+  802bde:	48 b8 78 e4 ff ff ff 	movabs $0xffffffffffffe478,%rax
+  802be5:	ff ff ff 
+  802be8:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802bec:	48 89 c7             	mov    %rax,%rdi
+  802bef:	49 89 cf             	mov    %rcx,%r15
+  802bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf7:	49 b8 07 86 ff ff ff 	movabs $0xffffffffffff8607,%r8
+  802bfe:	ff ff ff 
+  802c01:	49 01 c8             	add    %rcx,%r8
+  802c04:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802c07:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c0b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802c12:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c17:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802c1b:	c9                   	leave
+  802c1c:	c3                   	ret
+
+0000000000802c1d <close>:
+
+int
+close(int fdnum)
+{
+  802c1d:	55                   	push   %rbp
+  802c1e:	48 89 e5             	mov    %rsp,%rbp
+  802c21:	53                   	push   %rbx
+  802c22:	48 83 ec 28          	sub    $0x28,%rsp
+  802c26:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c26 <close+0x9>
+  802c2d:	49 bb 0a 54 00 00 00 	movabs $0x540a,%r11
+  802c34:	00 00 00 
+  802c37:	4c 01 db             	add    %r11,%rbx
+  802c3a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c3d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802c41:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802c44:	48 89 d6             	mov    %rdx,%rsi
+  802c47:	89 c7                	mov    %eax,%edi
+  802c49:	48 b8 5e a9 ff ff ff 	movabs $0xffffffffffffa95e,%rax
+  802c50:	ff ff ff 
+  802c53:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c57:	ff d0                	call   *%rax
+  802c59:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c5c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c60:	79 05                	jns    802c67 <close+0x4a>
+		return r;
+  802c62:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c65:	eb 1c                	jmp    802c83 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802c67:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c6b:	be 01 00 00 00       	mov    $0x1,%esi
+  802c70:	48 89 c7             	mov    %rax,%rdi
+  802c73:	48 b8 09 aa ff ff ff 	movabs $0xffffffffffffaa09,%rax
+  802c7a:	ff ff ff 
+  802c7d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c81:	ff d0                	call   *%rax
+}
+  802c83:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c87:	c9                   	leave
+  802c88:	c3                   	ret
+
+0000000000802c89 <close_all>:
+
+void
+close_all(void)
+{
+  802c89:	55                   	push   %rbp
+  802c8a:	48 89 e5             	mov    %rsp,%rbp
+  802c8d:	53                   	push   %rbx
+  802c8e:	48 83 ec 18          	sub    $0x18,%rsp
+  802c92:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c92 <close_all+0x9>
+  802c99:	49 bb 9e 53 00 00 00 	movabs $0x539e,%r11
+  802ca0:	00 00 00 
+  802ca3:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802ca6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802cad:	eb 19                	jmp    802cc8 <close_all+0x3f>
+		close(i);
+  802caf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cb2:	89 c7                	mov    %eax,%edi
+  802cb4:	48 b8 ed ab ff ff ff 	movabs $0xffffffffffffabed,%rax
+  802cbb:	ff ff ff 
+  802cbe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cc2:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802cc4:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802cc8:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802ccc:	7e e1                	jle    802caf <close_all+0x26>
+}
+  802cce:	90                   	nop
+  802ccf:	90                   	nop
+  802cd0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cd4:	c9                   	leave
+  802cd5:	c3                   	ret
+
+0000000000802cd6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802cd6:	55                   	push   %rbp
+  802cd7:	48 89 e5             	mov    %rsp,%rbp
+  802cda:	41 57                	push   %r15
+  802cdc:	53                   	push   %rbx
+  802cdd:	48 83 ec 40          	sub    $0x40,%rsp
+  802ce1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ce1 <dup+0xb>
+  802ce8:	49 bb 4f 53 00 00 00 	movabs $0x534f,%r11
+  802cef:	00 00 00 
+  802cf2:	4c 01 db             	add    %r11,%rbx
+  802cf5:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802cf8:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802cfb:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802cff:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802d02:	48 89 d6             	mov    %rdx,%rsi
+  802d05:	89 c7                	mov    %eax,%edi
+  802d07:	48 b8 5e a9 ff ff ff 	movabs $0xffffffffffffa95e,%rax
+  802d0e:	ff ff ff 
+  802d11:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d15:	ff d0                	call   *%rax
+  802d17:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d1a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d1e:	79 08                	jns    802d28 <dup+0x52>
+		return r;
+  802d20:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d23:	e9 a4 01 00 00       	jmp    802ecc <dup+0x1f6>
+	close(newfdnum);
+  802d28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d2b:	89 c7                	mov    %eax,%edi
+  802d2d:	48 b8 ed ab ff ff ff 	movabs $0xffffffffffffabed,%rax
+  802d34:	ff ff ff 
+  802d37:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d3b:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802d3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d40:	48 98                	cltq
+  802d42:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802d48:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d4c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802d50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d54:	48 89 c7             	mov    %rax,%rdi
+  802d57:	48 b8 65 a8 ff ff ff 	movabs $0xffffffffffffa865,%rax
+  802d5e:	ff ff ff 
+  802d61:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d65:	ff d0                	call   *%rax
+  802d67:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802d6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d6f:	48 89 c7             	mov    %rax,%rdi
+  802d72:	48 b8 65 a8 ff ff ff 	movabs $0xffffffffffffa865,%rax
+  802d79:	ff ff ff 
+  802d7c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d80:	ff d0                	call   *%rax
+  802d82:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802d86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d8a:	48 c1 e8 15          	shr    $0x15,%rax
+  802d8e:	48 89 c2             	mov    %rax,%rdx
+  802d91:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802d98:	ff ff ff 
+  802d9b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d9f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802da3:	83 e0 01             	and    $0x1,%eax
+  802da6:	48 85 c0             	test   %rax,%rax
+  802da9:	74 7f                	je     802e2a <dup+0x154>
+  802dab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802daf:	48 c1 e8 0c          	shr    $0xc,%rax
+  802db3:	48 89 c2             	mov    %rax,%rdx
+  802db6:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802dbd:	ff ff ff 
+  802dc0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802dc4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802dc8:	83 e0 01             	and    $0x1,%eax
+  802dcb:	48 85 c0             	test   %rax,%rax
+  802dce:	74 5a                	je     802e2a <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802dd0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802dd4:	48 c1 e8 0c          	shr    $0xc,%rax
+  802dd8:	48 89 c2             	mov    %rax,%rdx
+  802ddb:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802de2:	ff ff ff 
+  802de5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802de9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ded:	25 07 0e 00 00       	and    $0xe07,%eax
+  802df2:	89 c1                	mov    %eax,%ecx
+  802df4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802df8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802dfc:	41 89 c8             	mov    %ecx,%r8d
+  802dff:	48 89 d1             	mov    %rdx,%rcx
+  802e02:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e07:	48 89 c6             	mov    %rax,%rsi
+  802e0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e0f:	49 89 df             	mov    %rbx,%r15
+  802e12:	48 b8 ea a0 ff ff ff 	movabs $0xffffffffffffa0ea,%rax
+  802e19:	ff ff ff 
+  802e1c:	48 01 d8             	add    %rbx,%rax
+  802e1f:	ff d0                	call   *%rax
+  802e21:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e24:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e28:	78 5f                	js     802e89 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802e2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e2e:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e32:	48 89 c2             	mov    %rax,%rdx
+  802e35:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802e3c:	ff ff ff 
+  802e3f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e43:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e47:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e4c:	89 c1                	mov    %eax,%ecx
+  802e4e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e52:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e56:	41 89 c8             	mov    %ecx,%r8d
+  802e59:	48 89 d1             	mov    %rdx,%rcx
+  802e5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e61:	48 89 c6             	mov    %rax,%rsi
+  802e64:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e69:	49 89 df             	mov    %rbx,%r15
+  802e6c:	48 b8 ea a0 ff ff ff 	movabs $0xffffffffffffa0ea,%rax
+  802e73:	ff ff ff 
+  802e76:	48 01 d8             	add    %rbx,%rax
+  802e79:	ff d0                	call   *%rax
+  802e7b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e7e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e82:	78 08                	js     802e8c <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802e84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e87:	eb 43                	jmp    802ecc <dup+0x1f6>
+			goto err;
+  802e89:	90                   	nop
+  802e8a:	eb 01                	jmp    802e8d <dup+0x1b7>
+		goto err;
+  802e8c:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802e8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e91:	48 89 c6             	mov    %rax,%rsi
+  802e94:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e99:	49 89 df             	mov    %rbx,%r15
+  802e9c:	48 b8 5d a1 ff ff ff 	movabs $0xffffffffffffa15d,%rax
+  802ea3:	ff ff ff 
+  802ea6:	48 01 d8             	add    %rbx,%rax
+  802ea9:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802eab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802eaf:	48 89 c6             	mov    %rax,%rsi
+  802eb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb7:	49 89 df             	mov    %rbx,%r15
+  802eba:	48 b8 5d a1 ff ff ff 	movabs $0xffffffffffffa15d,%rax
+  802ec1:	ff ff ff 
+  802ec4:	48 01 d8             	add    %rbx,%rax
+  802ec7:	ff d0                	call   *%rax
+	return r;
+  802ec9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802ecc:	48 83 c4 40          	add    $0x40,%rsp
+  802ed0:	5b                   	pop    %rbx
+  802ed1:	41 5f                	pop    %r15
+  802ed3:	5d                   	pop    %rbp
+  802ed4:	c3                   	ret
+
+0000000000802ed5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802ed5:	55                   	push   %rbp
+  802ed6:	48 89 e5             	mov    %rsp,%rbp
+  802ed9:	41 57                	push   %r15
+  802edb:	53                   	push   %rbx
+  802edc:	48 83 ec 40          	sub    $0x40,%rsp
+  802ee0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ee0 <read+0xb>
+  802ee7:	49 bb 50 51 00 00 00 	movabs $0x5150,%r11
+  802eee:	00 00 00 
+  802ef1:	4c 01 db             	add    %r11,%rbx
+  802ef4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802ef7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802efb:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802eff:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802f03:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802f06:	48 89 d6             	mov    %rdx,%rsi
+  802f09:	89 c7                	mov    %eax,%edi
+  802f0b:	48 b8 5e a9 ff ff ff 	movabs $0xffffffffffffa95e,%rax
+  802f12:	ff ff ff 
+  802f15:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f19:	ff d0                	call   *%rax
+  802f1b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f1e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f22:	78 28                	js     802f4c <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802f24:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f28:	8b 00                	mov    (%rax),%eax
+  802f2a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802f2e:	48 89 d6             	mov    %rdx,%rsi
+  802f31:	89 c7                	mov    %eax,%edi
+  802f33:	48 b8 04 ab ff ff ff 	movabs $0xffffffffffffab04,%rax
+  802f3a:	ff ff ff 
+  802f3d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f41:	ff d0                	call   *%rax
+  802f43:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f46:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f4a:	79 08                	jns    802f54 <read+0x7f>
+		return r;
+  802f4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f4f:	e9 8b 00 00 00       	jmp    802fdf <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802f54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f58:	8b 40 08             	mov    0x8(%rax),%eax
+  802f5b:	83 e0 03             	and    $0x3,%eax
+  802f5e:	83 f8 01             	cmp    $0x1,%eax
+  802f61:	75 4b                	jne    802fae <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802f63:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802f6a:	ff ff ff 
+  802f6d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f71:	48 8b 00             	mov    (%rax),%rax
+  802f74:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802f7a:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  802f7d:	89 c6                	mov    %eax,%esi
+  802f7f:	48 b8 97 e4 ff ff ff 	movabs $0xffffffffffffe497,%rax
+  802f86:	ff ff ff 
+  802f89:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f8d:	48 89 c7             	mov    %rax,%rdi
+  802f90:	49 89 df             	mov    %rbx,%r15
+  802f93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f98:	48 b9 07 86 ff ff ff 	movabs $0xffffffffffff8607,%rcx
+  802f9f:	ff ff ff 
+  802fa2:	48 01 d9             	add    %rbx,%rcx
+  802fa5:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802fa7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fac:	eb 31                	jmp    802fdf <read+0x10a>
+	}
+	if (!dev->dev_read)
+  802fae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fb2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802fb6:	48 85 c0             	test   %rax,%rax
+  802fb9:	75 07                	jne    802fc2 <read+0xed>
+		return -E_NOT_SUPP;
+  802fbb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802fc0:	eb 1d                	jmp    802fdf <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  802fc2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fc6:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802fca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fce:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802fd2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802fd6:	48 89 ce             	mov    %rcx,%rsi
+  802fd9:	48 89 c7             	mov    %rax,%rdi
+  802fdc:	41 ff d0             	call   *%r8
+}
+  802fdf:	48 83 c4 40          	add    $0x40,%rsp
+  802fe3:	5b                   	pop    %rbx
+  802fe4:	41 5f                	pop    %r15
+  802fe6:	5d                   	pop    %rbp
+  802fe7:	c3                   	ret
+
+0000000000802fe8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802fe8:	55                   	push   %rbp
+  802fe9:	48 89 e5             	mov    %rsp,%rbp
+  802fec:	53                   	push   %rbx
+  802fed:	48 83 ec 38          	sub    $0x38,%rsp
+  802ff1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ff1 <readn+0x9>
+  802ff8:	49 bb 3f 50 00 00 00 	movabs $0x503f,%r11
+  802fff:	00 00 00 
+  803002:	4c 01 db             	add    %r11,%rbx
+  803005:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803008:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80300c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803010:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803017:	eb 4b                	jmp    803064 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803019:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80301c:	48 98                	cltq
+  80301e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803022:	48 29 c2             	sub    %rax,%rdx
+  803025:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803028:	48 63 c8             	movslq %eax,%rcx
+  80302b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80302f:	48 01 c1             	add    %rax,%rcx
+  803032:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803035:	48 89 ce             	mov    %rcx,%rsi
+  803038:	89 c7                	mov    %eax,%edi
+  80303a:	48 b8 a5 ae ff ff ff 	movabs $0xffffffffffffaea5,%rax
+  803041:	ff ff ff 
+  803044:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803048:	ff d0                	call   *%rax
+  80304a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80304d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803051:	79 05                	jns    803058 <readn+0x70>
+			return m;
+  803053:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803056:	eb 1d                	jmp    803075 <readn+0x8d>
+		if (m == 0)
+  803058:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80305c:	74 13                	je     803071 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  80305e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803061:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803064:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803067:	48 98                	cltq
+  803069:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80306d:	72 aa                	jb     803019 <readn+0x31>
+  80306f:	eb 01                	jmp    803072 <readn+0x8a>
+			break;
+  803071:	90                   	nop
+	}
+	return tot;
+  803072:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803075:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803079:	c9                   	leave
+  80307a:	c3                   	ret
+
+000000000080307b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80307b:	55                   	push   %rbp
+  80307c:	48 89 e5             	mov    %rsp,%rbp
+  80307f:	41 57                	push   %r15
+  803081:	53                   	push   %rbx
+  803082:	48 83 ec 40          	sub    $0x40,%rsp
+  803086:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803086 <write+0xb>
+  80308d:	49 bb aa 4f 00 00 00 	movabs $0x4faa,%r11
+  803094:	00 00 00 
+  803097:	4c 01 db             	add    %r11,%rbx
+  80309a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80309d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8030a1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8030a5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8030a9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8030ac:	48 89 d6             	mov    %rdx,%rsi
+  8030af:	89 c7                	mov    %eax,%edi
+  8030b1:	48 b8 5e a9 ff ff ff 	movabs $0xffffffffffffa95e,%rax
+  8030b8:	ff ff ff 
+  8030bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030bf:	ff d0                	call   *%rax
+  8030c1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8030c4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8030c8:	78 28                	js     8030f2 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030ce:	8b 00                	mov    (%rax),%eax
+  8030d0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8030d4:	48 89 d6             	mov    %rdx,%rsi
+  8030d7:	89 c7                	mov    %eax,%edi
+  8030d9:	48 b8 04 ab ff ff ff 	movabs $0xffffffffffffab04,%rax
+  8030e0:	ff ff ff 
+  8030e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030e7:	ff d0                	call   *%rax
+  8030e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8030ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8030f0:	79 08                	jns    8030fa <write+0x7f>
+		return r;
+  8030f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030f5:	e9 8a 00 00 00       	jmp    803184 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8030fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030fe:	8b 40 08             	mov    0x8(%rax),%eax
+  803101:	83 e0 03             	and    $0x3,%eax
+  803104:	85 c0                	test   %eax,%eax
+  803106:	75 4b                	jne    803153 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803108:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80310f:	ff ff ff 
+  803112:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803116:	48 8b 00             	mov    (%rax),%rax
+  803119:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80311f:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803122:	89 c6                	mov    %eax,%esi
+  803124:	48 b8 b3 e4 ff ff ff 	movabs $0xffffffffffffe4b3,%rax
+  80312b:	ff ff ff 
+  80312e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803132:	48 89 c7             	mov    %rax,%rdi
+  803135:	49 89 df             	mov    %rbx,%r15
+  803138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80313d:	48 b9 07 86 ff ff ff 	movabs $0xffffffffffff8607,%rcx
+  803144:	ff ff ff 
+  803147:	48 01 d9             	add    %rbx,%rcx
+  80314a:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80314c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803151:	eb 31                	jmp    803184 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803153:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803157:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80315b:	48 85 c0             	test   %rax,%rax
+  80315e:	75 07                	jne    803167 <write+0xec>
+		return -E_NOT_SUPP;
+  803160:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803165:	eb 1d                	jmp    803184 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803167:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80316b:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80316f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803173:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803177:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80317b:	48 89 ce             	mov    %rcx,%rsi
+  80317e:	48 89 c7             	mov    %rax,%rdi
+  803181:	41 ff d0             	call   *%r8
+}
+  803184:	48 83 c4 40          	add    $0x40,%rsp
+  803188:	5b                   	pop    %rbx
+  803189:	41 5f                	pop    %r15
+  80318b:	5d                   	pop    %rbp
+  80318c:	c3                   	ret
+
+000000000080318d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80318d:	55                   	push   %rbp
+  80318e:	48 89 e5             	mov    %rsp,%rbp
+  803191:	48 83 ec 18          	sub    $0x18,%rsp
+  803195:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803195 <seek+0x8>
+  80319c:	49 bb 9b 4e 00 00 00 	movabs $0x4e9b,%r11
+  8031a3:	00 00 00 
+  8031a6:	4c 01 d8             	add    %r11,%rax
+  8031a9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8031ac:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031af:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8031b3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8031b6:	48 89 ce             	mov    %rcx,%rsi
+  8031b9:	89 d7                	mov    %edx,%edi
+  8031bb:	48 ba 5e a9 ff ff ff 	movabs $0xffffffffffffa95e,%rdx
+  8031c2:	ff ff ff 
+  8031c5:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8031c9:	ff d0                	call   *%rax
+  8031cb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031ce:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031d2:	79 05                	jns    8031d9 <seek+0x4c>
+		return r;
+  8031d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031d7:	eb 0f                	jmp    8031e8 <seek+0x5b>
+	fd->fd_offset = offset;
+  8031d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031dd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8031e0:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8031e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031e8:	c9                   	leave
+  8031e9:	c3                   	ret
+
+00000000008031ea <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8031ea:	55                   	push   %rbp
+  8031eb:	48 89 e5             	mov    %rsp,%rbp
+  8031ee:	41 57                	push   %r15
+  8031f0:	53                   	push   %rbx
+  8031f1:	48 83 ec 30          	sub    $0x30,%rsp
+  8031f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031f5 <ftruncate+0xb>
+  8031fc:	49 bb 3b 4e 00 00 00 	movabs $0x4e3b,%r11
+  803203:	00 00 00 
+  803206:	4c 01 db             	add    %r11,%rbx
+  803209:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80320c:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80320f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803213:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803216:	48 89 d6             	mov    %rdx,%rsi
+  803219:	89 c7                	mov    %eax,%edi
+  80321b:	48 b8 5e a9 ff ff ff 	movabs $0xffffffffffffa95e,%rax
+  803222:	ff ff ff 
+  803225:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803229:	ff d0                	call   *%rax
+  80322b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80322e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803232:	78 28                	js     80325c <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803234:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803238:	8b 00                	mov    (%rax),%eax
+  80323a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80323e:	48 89 d6             	mov    %rdx,%rsi
+  803241:	89 c7                	mov    %eax,%edi
+  803243:	48 b8 04 ab ff ff ff 	movabs $0xffffffffffffab04,%rax
+  80324a:	ff ff ff 
+  80324d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803251:	ff d0                	call   *%rax
+  803253:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803256:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80325a:	79 08                	jns    803264 <ftruncate+0x7a>
+		return r;
+  80325c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80325f:	e9 83 00 00 00       	jmp    8032e7 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803264:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803268:	8b 40 08             	mov    0x8(%rax),%eax
+  80326b:	83 e0 03             	and    $0x3,%eax
+  80326e:	85 c0                	test   %eax,%eax
+  803270:	75 4b                	jne    8032bd <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803272:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803279:	ff ff ff 
+  80327c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803280:	48 8b 00             	mov    (%rax),%rax
+  803283:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803289:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80328c:	89 c6                	mov    %eax,%esi
+  80328e:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  803295:	ff ff ff 
+  803298:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80329c:	48 89 c7             	mov    %rax,%rdi
+  80329f:	49 89 df             	mov    %rbx,%r15
+  8032a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a7:	48 b9 07 86 ff ff ff 	movabs $0xffffffffffff8607,%rcx
+  8032ae:	ff ff ff 
+  8032b1:	48 01 d9             	add    %rbx,%rcx
+  8032b4:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8032b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032bb:	eb 2a                	jmp    8032e7 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8032bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032c1:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8032c5:	48 85 c0             	test   %rax,%rax
+  8032c8:	75 07                	jne    8032d1 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8032ca:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8032cf:	eb 16                	jmp    8032e7 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8032d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032d5:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8032d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032dd:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8032e0:	89 d6                	mov    %edx,%esi
+  8032e2:	48 89 c7             	mov    %rax,%rdi
+  8032e5:	ff d1                	call   *%rcx
+}
+  8032e7:	48 83 c4 30          	add    $0x30,%rsp
+  8032eb:	5b                   	pop    %rbx
+  8032ec:	41 5f                	pop    %r15
+  8032ee:	5d                   	pop    %rbp
+  8032ef:	c3                   	ret
+
+00000000008032f0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8032f0:	55                   	push   %rbp
+  8032f1:	48 89 e5             	mov    %rsp,%rbp
+  8032f4:	53                   	push   %rbx
+  8032f5:	48 83 ec 38          	sub    $0x38,%rsp
+  8032f9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032f9 <fstat+0x9>
+  803300:	49 bb 37 4d 00 00 00 	movabs $0x4d37,%r11
+  803307:	00 00 00 
+  80330a:	4c 01 db             	add    %r11,%rbx
+  80330d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803310:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803314:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803318:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80331b:	48 89 d6             	mov    %rdx,%rsi
+  80331e:	89 c7                	mov    %eax,%edi
+  803320:	48 b8 5e a9 ff ff ff 	movabs $0xffffffffffffa95e,%rax
+  803327:	ff ff ff 
+  80332a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80332e:	ff d0                	call   *%rax
+  803330:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803333:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803337:	78 28                	js     803361 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803339:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80333d:	8b 00                	mov    (%rax),%eax
+  80333f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803343:	48 89 d6             	mov    %rdx,%rsi
+  803346:	89 c7                	mov    %eax,%edi
+  803348:	48 b8 04 ab ff ff ff 	movabs $0xffffffffffffab04,%rax
+  80334f:	ff ff ff 
+  803352:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803356:	ff d0                	call   *%rax
+  803358:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80335b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80335f:	79 05                	jns    803366 <fstat+0x76>
+		return r;
+  803361:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803364:	eb 5e                	jmp    8033c4 <fstat+0xd4>
+	if (!dev->dev_stat)
+  803366:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80336a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80336e:	48 85 c0             	test   %rax,%rax
+  803371:	75 07                	jne    80337a <fstat+0x8a>
+		return -E_NOT_SUPP;
+  803373:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803378:	eb 4a                	jmp    8033c4 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  80337a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80337e:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803381:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803385:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80338c:	00 00 00 
+	stat->st_isdir = 0;
+  80338f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803393:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80339a:	00 00 00 
+	stat->st_dev = dev;
+  80339d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033a1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8033a5:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8033ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033b0:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8033b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033bc:	48 89 d6             	mov    %rdx,%rsi
+  8033bf:	48 89 c7             	mov    %rax,%rdi
+  8033c2:	ff d1                	call   *%rcx
+}
+  8033c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033c8:	c9                   	leave
+  8033c9:	c3                   	ret
+
+00000000008033ca <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8033ca:	55                   	push   %rbp
+  8033cb:	48 89 e5             	mov    %rsp,%rbp
+  8033ce:	41 57                	push   %r15
+  8033d0:	53                   	push   %rbx
+  8033d1:	48 83 ec 20          	sub    $0x20,%rsp
+  8033d5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033d5 <stat+0xb>
+  8033dc:	49 bb 5b 4c 00 00 00 	movabs $0x4c5b,%r11
+  8033e3:	00 00 00 
+  8033e6:	4c 01 db             	add    %r11,%rbx
+  8033e9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8033ed:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8033f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8033fa:	48 89 c7             	mov    %rax,%rdi
+  8033fd:	49 89 df             	mov    %rbx,%r15
+  803400:	48 b8 74 b6 ff ff ff 	movabs $0xffffffffffffb674,%rax
+  803407:	ff ff ff 
+  80340a:	48 01 d8             	add    %rbx,%rax
+  80340d:	ff d0                	call   *%rax
+  80340f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803412:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803416:	79 05                	jns    80341d <stat+0x53>
+		return fd;
+  803418:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80341b:	eb 37                	jmp    803454 <stat+0x8a>
+	r = fstat(fd, stat);
+  80341d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803421:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803424:	48 89 d6             	mov    %rdx,%rsi
+  803427:	89 c7                	mov    %eax,%edi
+  803429:	48 b8 c0 b2 ff ff ff 	movabs $0xffffffffffffb2c0,%rax
+  803430:	ff ff ff 
+  803433:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803437:	ff d0                	call   *%rax
+  803439:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  80343c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80343f:	89 c7                	mov    %eax,%edi
+  803441:	48 b8 ed ab ff ff ff 	movabs $0xffffffffffffabed,%rax
+  803448:	ff ff ff 
+  80344b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80344f:	ff d0                	call   *%rax
+	return r;
+  803451:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803454:	48 83 c4 20          	add    $0x20,%rsp
+  803458:	5b                   	pop    %rbx
+  803459:	41 5f                	pop    %r15
+  80345b:	5d                   	pop    %rbp
+  80345c:	c3                   	ret
+
+000000000080345d <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80345d:	55                   	push   %rbp
+  80345e:	48 89 e5             	mov    %rsp,%rbp
+  803461:	41 57                	push   %r15
+  803463:	53                   	push   %rbx
+  803464:	48 83 ec 10          	sub    $0x10,%rsp
+  803468:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803468 <fsipc+0xb>
+  80346f:	49 bb c8 4b 00 00 00 	movabs $0x4bc8,%r11
+  803476:	00 00 00 
+  803479:	4c 01 db             	add    %r11,%rbx
+  80347c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80347f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803483:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80348a:	00 00 00 
+  80348d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803490:	85 c0                	test   %eax,%eax
+  803492:	75 24                	jne    8034b8 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803494:	bf 01 00 00 00       	mov    $0x1,%edi
+  803499:	49 89 df             	mov    %rbx,%r15
+  80349c:	48 b8 74 de ff ff ff 	movabs $0xffffffffffffde74,%rax
+  8034a3:	ff ff ff 
+  8034a6:	48 01 d8             	add    %rbx,%rax
+  8034a9:	ff d0                	call   *%rax
+  8034ab:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8034b2:	00 00 00 
+  8034b5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8034b8:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8034bf:	00 00 00 
+  8034c2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8034c5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034c9:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8034cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8034d2:	49 89 d0             	mov    %rdx,%r8
+  8034d5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8034da:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8034e1:	00 00 00 
+  8034e4:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8034e8:	89 c7                	mov    %eax,%edi
+  8034ea:	49 89 df             	mov    %rbx,%r15
+  8034ed:	48 b8 93 d8 ff ff ff 	movabs $0xffffffffffffd893,%rax
+  8034f4:	ff ff ff 
+  8034f7:	48 01 d8             	add    %rbx,%rax
+  8034fa:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8034fc:	48 83 c4 10          	add    $0x10,%rsp
+  803500:	5b                   	pop    %rbx
+  803501:	41 5f                	pop    %r15
+  803503:	5d                   	pop    %rbp
+  803504:	c3                   	ret
+
+0000000000803505 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803505:	55                   	push   %rbp
+  803506:	48 89 e5             	mov    %rsp,%rbp
+  803509:	41 57                	push   %r15
+  80350b:	53                   	push   %rbx
+  80350c:	48 83 ec 20          	sub    $0x20,%rsp
+  803510:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803510 <fsipc_words+0xb>
+  803517:	49 bb 20 4b 00 00 00 	movabs $0x4b20,%r11
+  80351e:	00 00 00 
+  803521:	4c 01 db             	add    %r11,%rbx
+  803524:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803527:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80352b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  80352f:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803536:	00 00 00 
+  803539:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80353c:	85 c0                	test   %eax,%eax
+  80353e:	75 24                	jne    803564 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803540:	bf 01 00 00 00       	mov    $0x1,%edi
+  803545:	49 89 df             	mov    %rbx,%r15
+  803548:	48 b8 74 de ff ff ff 	movabs $0xffffffffffffde74,%rax
+  80354f:	ff ff ff 
+  803552:	48 01 d8             	add    %rbx,%rax
+  803555:	ff d0                	call   *%rax
+  803557:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  80355e:	00 00 00 
+  803561:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803564:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80356b:	00 00 00 
+  80356e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803571:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803575:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803579:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80357c:	89 c7                	mov    %eax,%edi
+  80357e:	49 89 df             	mov    %rbx,%r15
+  803581:	48 b8 7e d9 ff ff ff 	movabs $0xffffffffffffd97e,%rax
+  803588:	ff ff ff 
+  80358b:	48 01 d8             	add    %rbx,%rax
+  80358e:	ff d0                	call   *%rax
+}
+  803590:	48 83 c4 20          	add    $0x20,%rsp
+  803594:	5b                   	pop    %rbx
+  803595:	41 5f                	pop    %r15
+  803597:	5d                   	pop    %rbp
+  803598:	c3                   	ret
+
+0000000000803599 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803599:	55                   	push   %rbp
+  80359a:	48 89 e5             	mov    %rsp,%rbp
+  80359d:	41 57                	push   %r15
+  80359f:	53                   	push   %rbx
+  8035a0:	48 83 ec 40          	sub    $0x40,%rsp
+  8035a4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035a4 <fsipc_pages+0xb>
+  8035ab:	49 bb 8c 4a 00 00 00 	movabs $0x4a8c,%r11
+  8035b2:	00 00 00 
+  8035b5:	4c 01 db             	add    %r11,%rbx
+  8035b8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8035bb:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8035bf:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8035c3:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8035c6:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8035cd:	00 00 00 
+  8035d0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8035d3:	85 c0                	test   %eax,%eax
+  8035d5:	75 24                	jne    8035fb <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8035d7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035dc:	49 89 df             	mov    %rbx,%r15
+  8035df:	48 b8 74 de ff ff ff 	movabs $0xffffffffffffde74,%rax
+  8035e6:	ff ff ff 
+  8035e9:	48 01 d8             	add    %rbx,%rax
+  8035ec:	ff d0                	call   *%rax
+  8035ee:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8035f5:	00 00 00 
+  8035f8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8035fb:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803600:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  803604:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803607:	48 98                	cltq
+  803609:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  80360d:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  803611:	0f 95 c0             	setne  %al
+  803614:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803617:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80361e:	00 
+  80361f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803623:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803627:	48 01 d0             	add    %rdx,%rax
+  80362a:	48 83 e8 01          	sub    $0x1,%rax
+  80362e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803632:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803636:	ba 00 00 00 00       	mov    $0x0,%edx
+  80363b:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80363f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803643:	48 29 d0             	sub    %rdx,%rax
+  803646:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  80364a:	41 89 c2             	mov    %eax,%r10d
+  80364d:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803654:	00 00 00 
+  803657:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80365a:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80365e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803662:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803665:	48 83 ec 08          	sub    $0x8,%rsp
+  803669:	6a 40                	push   $0x40
+  80366b:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  803670:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  803677:	00 
+  803678:	6a 05                	push   $0x5
+  80367a:	41 89 f9             	mov    %edi,%r9d
+  80367d:	49 89 c8             	mov    %rcx,%r8
+  803680:	44 89 d1             	mov    %r10d,%ecx
+  803683:	89 c7                	mov    %eax,%edi
+  803685:	49 89 df             	mov    %rbx,%r15
+  803688:	48 b8 7c da ff ff ff 	movabs $0xffffffffffffda7c,%rax
+  80368f:	ff ff ff 
+  803692:	48 01 d8             	add    %rbx,%rax
+  803695:	ff d0                	call   *%rax
+  803697:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80369b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80369f:	5b                   	pop    %rbx
+  8036a0:	41 5f                	pop    %r15
+  8036a2:	5d                   	pop    %rbp
+  8036a3:	c3                   	ret
+
+00000000008036a4 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8036a4:	55                   	push   %rbp
+  8036a5:	48 89 e5             	mov    %rsp,%rbp
+  8036a8:	41 57                	push   %r15
+  8036aa:	53                   	push   %rbx
+  8036ab:	48 83 ec 20          	sub    $0x20,%rsp
+  8036af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036af <open+0xb>
+  8036b6:	49 bb 81 49 00 00 00 	movabs $0x4981,%r11
+  8036bd:	00 00 00 
+  8036c0:	4c 01 db             	add    %r11,%rbx
+  8036c3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8036c7:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8036ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036ce:	48 89 c7             	mov    %rax,%rdi
+  8036d1:	49 89 df             	mov    %rbx,%r15
+  8036d4:	48 b8 35 93 ff ff ff 	movabs $0xffffffffffff9335,%rax
+  8036db:	ff ff ff 
+  8036de:	48 01 d8             	add    %rbx,%rax
+  8036e1:	ff d0                	call   *%rax
+  8036e3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8036e8:	7e 0a                	jle    8036f4 <open+0x50>
+		return -E_BAD_PATH;
+  8036ea:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8036ef:	e9 18 01 00 00       	jmp    80380c <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8036f4:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8036f8:	48 89 c7             	mov    %rax,%rdi
+  8036fb:	49 89 df             	mov    %rbx,%r15
+  8036fe:	48 b8 a8 a8 ff ff ff 	movabs $0xffffffffffffa8a8,%rax
+  803705:	ff ff ff 
+  803708:	48 01 d8             	add    %rbx,%rax
+  80370b:	ff d0                	call   *%rax
+  80370d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803710:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803714:	74 08                	je     80371e <open+0x7a>
+		return r;
+  803716:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803719:	e9 ee 00 00 00       	jmp    80380c <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80371e:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803725:	00 00 00 
+  803728:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80372b:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  803732:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803736:	48 89 c6             	mov    %rax,%rsi
+  803739:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803740:	00 00 00 
+  803743:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803747:	48 89 c7             	mov    %rax,%rdi
+  80374a:	49 89 df             	mov    %rbx,%r15
+  80374d:	48 b8 c9 93 ff ff ff 	movabs $0xffffffffffff93c9,%rax
+  803754:	ff ff ff 
+  803757:	48 01 d8             	add    %rbx,%rax
+  80375a:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  80375c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803760:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  803765:	48 89 c6             	mov    %rax,%rsi
+  803768:	bf 00 00 00 00       	mov    $0x0,%edi
+  80376d:	49 89 df             	mov    %rbx,%r15
+  803770:	48 b8 85 a0 ff ff ff 	movabs $0xffffffffffffa085,%rax
+  803777:	ff ff ff 
+  80377a:	48 01 d8             	add    %rbx,%rax
+  80377d:	ff d0                	call   *%rax
+  80377f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803782:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803786:	74 23                	je     8037ab <open+0x107>
+		fd_close(fd,0);
+  803788:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80378c:	be 00 00 00 00       	mov    $0x0,%esi
+  803791:	48 89 c7             	mov    %rax,%rdi
+  803794:	49 89 df             	mov    %rbx,%r15
+  803797:	48 b8 09 aa ff ff ff 	movabs $0xffffffffffffaa09,%rax
+  80379e:	ff ff ff 
+  8037a1:	48 01 d8             	add    %rbx,%rax
+  8037a4:	ff d0                	call   *%rax
+		return r;
+  8037a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037a9:	eb 61                	jmp    80380c <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8037ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037af:	48 89 c6             	mov    %rax,%rsi
+  8037b2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8037b7:	48 b8 2d b4 ff ff ff 	movabs $0xffffffffffffb42d,%rax
+  8037be:	ff ff ff 
+  8037c1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037c5:	ff d0                	call   *%rax
+  8037c7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037ce:	74 23                	je     8037f3 <open+0x14f>
+		fd_close(fd,0);
+  8037d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8037d9:	48 89 c7             	mov    %rax,%rdi
+  8037dc:	49 89 df             	mov    %rbx,%r15
+  8037df:	48 b8 09 aa ff ff ff 	movabs $0xffffffffffffaa09,%rax
+  8037e6:	ff ff ff 
+  8037e9:	48 01 d8             	add    %rbx,%rax
+  8037ec:	ff d0                	call   *%rax
+		return r;
+  8037ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037f1:	eb 19                	jmp    80380c <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8037f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037f7:	48 89 c7             	mov    %rax,%rdi
+  8037fa:	49 89 df             	mov    %rbx,%r15
+  8037fd:	48 b8 2e a8 ff ff ff 	movabs $0xffffffffffffa82e,%rax
+  803804:	ff ff ff 
+  803807:	48 01 d8             	add    %rbx,%rax
+  80380a:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  80380c:	48 83 c4 20          	add    $0x20,%rsp
+  803810:	5b                   	pop    %rbx
+  803811:	41 5f                	pop    %r15
+  803813:	5d                   	pop    %rbp
+  803814:	c3                   	ret
+
+0000000000803815 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  803815:	55                   	push   %rbp
+  803816:	48 89 e5             	mov    %rsp,%rbp
+  803819:	48 83 ec 20          	sub    $0x20,%rsp
+  80381d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80381d <devfile_flush+0x8>
+  803824:	49 bb 13 48 00 00 00 	movabs $0x4813,%r11
+  80382b:	00 00 00 
+  80382e:	4c 01 d8             	add    %r11,%rax
+  803831:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  803835:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803839:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80383c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  80383f:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  803843:	ba 04 00 00 00       	mov    $0x4,%edx
+  803848:	48 89 ce             	mov    %rcx,%rsi
+  80384b:	bf 06 00 00 00       	mov    $0x6,%edi
+  803850:	48 b9 d5 b4 ff ff ff 	movabs $0xffffffffffffb4d5,%rcx
+  803857:	ff ff ff 
+  80385a:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80385e:	ff d0                	call   *%rax
+}
+  803860:	c9                   	leave
+  803861:	c3                   	ret
+
+0000000000803862 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803862:	55                   	push   %rbp
+  803863:	48 89 e5             	mov    %rsp,%rbp
+  803866:	41 57                	push   %r15
+  803868:	53                   	push   %rbx
+  803869:	48 83 ec 60          	sub    $0x60,%rsp
+  80386d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80386d <devfile_read+0xb>
+  803874:	49 bb c3 47 00 00 00 	movabs $0x47c3,%r11
+  80387b:	00 00 00 
+  80387e:	4c 01 db             	add    %r11,%rbx
+  803881:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803885:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803889:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80388d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803891:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  803895:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803899:	8b 50 0c             	mov    0xc(%rax),%edx
+  80389c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038a0:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8038a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038a6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8038aa:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  8038ae:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8038b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8038b7:	ba 10 00 00 00       	mov    $0x10,%edx
+  8038bc:	48 89 c6             	mov    %rax,%rsi
+  8038bf:	bf 03 00 00 00       	mov    $0x3,%edi
+  8038c4:	48 b8 69 b5 ff ff ff 	movabs $0xffffffffffffb569,%rax
+  8038cb:	ff ff ff 
+  8038ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038d2:	ff d0                	call   *%rax
+  8038d4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8038d7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8038db:	79 05                	jns    8038e2 <devfile_read+0x80>
+		return r;
+  8038dd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8038e0:	eb 64                	jmp    803946 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8038e2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8038e5:	48 63 d0             	movslq %eax,%rdx
+  8038e8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8038ec:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8038f1:	48 01 c1             	add    %rax,%rcx
+  8038f4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038f8:	48 89 ce             	mov    %rcx,%rsi
+  8038fb:	48 89 c7             	mov    %rax,%rdi
+  8038fe:	49 89 df             	mov    %rbx,%r15
+  803901:	48 b8 a9 97 ff ff ff 	movabs $0xffffffffffff97a9,%rax
+  803908:	ff ff ff 
+  80390b:	48 01 d8             	add    %rbx,%rax
+  80390e:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  803910:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803917:	ff ff ff 
+  80391a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80391e:	48 8b 00             	mov    (%rax),%rax
+  803921:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803927:	89 c6                	mov    %eax,%esi
+  803929:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  80392e:	48 89 c7             	mov    %rax,%rdi
+  803931:	49 89 df             	mov    %rbx,%r15
+  803934:	48 b8 2e de ff ff ff 	movabs $0xffffffffffffde2e,%rax
+  80393b:	ff ff ff 
+  80393e:	48 01 d8             	add    %rbx,%rax
+  803941:	ff d0                	call   *%rax
+	return r;
+  803943:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803946:	48 83 c4 60          	add    $0x60,%rsp
+  80394a:	5b                   	pop    %rbx
+  80394b:	41 5f                	pop    %r15
+  80394d:	5d                   	pop    %rbp
+  80394e:	c3                   	ret
+
+000000000080394f <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80394f:	55                   	push   %rbp
+  803950:	48 89 e5             	mov    %rsp,%rbp
+  803953:	41 57                	push   %r15
+  803955:	53                   	push   %rbx
+  803956:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  80395a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80395a <devfile_write+0xb>
+  803961:	49 bb d6 46 00 00 00 	movabs $0x46d6,%r11
+  803968:	00 00 00 
+  80396b:	4c 01 db             	add    %r11,%rbx
+  80396e:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803972:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803976:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  80397d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803981:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803985:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  80398c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803990:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803997:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80399a:	48 63 d0             	movslq %eax,%rdx
+  80399d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039a1:	48 39 c2             	cmp    %rax,%rdx
+  8039a4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8039a8:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8039af:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  8039b6:	00 
+  8039b7:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8039be:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039c2:	48 01 d0             	add    %rdx,%rax
+  8039c5:	48 83 e8 01          	sub    $0x1,%rax
+  8039c9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8039cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039d6:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8039da:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039de:	48 29 d0             	sub    %rdx,%rax
+  8039e1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8039e5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8039e8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8039eb:	89 c6                	mov    %eax,%esi
+  8039ed:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8039f2:	48 89 c7             	mov    %rax,%rdi
+  8039f5:	49 89 df             	mov    %rbx,%r15
+  8039f8:	48 b8 e8 dd ff ff ff 	movabs $0xffffffffffffdde8,%rax
+  8039ff:	ff ff ff 
+  803a02:	48 01 d8             	add    %rbx,%rax
+  803a05:	ff d0                	call   *%rax
+  803a07:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803a0a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803a0e:	79 08                	jns    803a18 <devfile_write+0xc9>
+		return r;
+  803a10:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803a13:	e9 8f 00 00 00       	jmp    803aa7 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803a18:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803a1f:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803a23:	48 89 c6             	mov    %rax,%rsi
+  803a26:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803a2b:	48 89 c7             	mov    %rax,%rdi
+  803a2e:	49 89 df             	mov    %rbx,%r15
+  803a31:	48 b8 a9 97 ff ff ff 	movabs $0xffffffffffff97a9,%rax
+  803a38:	ff ff ff 
+  803a3b:	48 01 d8             	add    %rbx,%rax
+  803a3e:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803a40:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803a44:	8b 50 0c             	mov    0xc(%rax),%edx
+  803a47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a4b:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803a4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a51:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803a58:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803a5c:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803a5f:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803a63:	89 d1                	mov    %edx,%ecx
+  803a65:	ba 10 00 00 00       	mov    $0x10,%edx
+  803a6a:	48 89 c6             	mov    %rax,%rsi
+  803a6d:	bf 04 00 00 00       	mov    $0x4,%edi
+  803a72:	48 b8 69 b5 ff ff ff 	movabs $0xffffffffffffb569,%rax
+  803a79:	ff ff ff 
+  803a7c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a80:	ff d0                	call   *%rax
+  803a82:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803a85:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803a88:	89 c6                	mov    %eax,%esi
+  803a8a:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803a8f:	48 89 c7             	mov    %rax,%rdi
+  803a92:	49 89 df             	mov    %rbx,%r15
+  803a95:	48 b8 2e de ff ff ff 	movabs $0xffffffffffffde2e,%rax
+  803a9c:	ff ff ff 
+  803a9f:	48 01 d8             	add    %rbx,%rax
+  803aa2:	ff d0                	call   *%rax
+	return r;
+  803aa4:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803aa7:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803aab:	5b                   	pop    %rbx
+  803aac:	41 5f                	pop    %r15
+  803aae:	5d                   	pop    %rbp
+  803aaf:	c3                   	ret
+
+0000000000803ab0 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803ab0:	55                   	push   %rbp
+  803ab1:	48 89 e5             	mov    %rsp,%rbp
+  803ab4:	41 57                	push   %r15
+  803ab6:	53                   	push   %rbx
+  803ab7:	48 83 ec 20          	sub    $0x20,%rsp
+  803abb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803abb <devfile_stat+0xb>
+  803ac2:	49 bb 75 45 00 00 00 	movabs $0x4575,%r11
+  803ac9:	00 00 00 
+  803acc:	4c 01 db             	add    %r11,%rbx
+  803acf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ad3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803ad7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803adb:	8b 40 0c             	mov    0xc(%rax),%eax
+  803ade:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803ae5:	00 00 00 
+  803ae8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803aeb:	be 00 00 00 00       	mov    $0x0,%esi
+  803af0:	bf 05 00 00 00       	mov    $0x5,%edi
+  803af5:	48 b8 2d b4 ff ff ff 	movabs $0xffffffffffffb42d,%rax
+  803afc:	ff ff ff 
+  803aff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b03:	ff d0                	call   *%rax
+  803b05:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b08:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b0c:	79 05                	jns    803b13 <devfile_stat+0x63>
+		return r;
+  803b0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b11:	eb 65                	jmp    803b78 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803b13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b17:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803b1e:	00 00 00 
+  803b21:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803b25:	48 89 d6             	mov    %rdx,%rsi
+  803b28:	48 89 c7             	mov    %rax,%rdi
+  803b2b:	49 89 df             	mov    %rbx,%r15
+  803b2e:	48 b8 c9 93 ff ff ff 	movabs $0xffffffffffff93c9,%rax
+  803b35:	ff ff ff 
+  803b38:	48 01 d8             	add    %rbx,%rax
+  803b3b:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803b3d:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803b44:	00 00 00 
+  803b47:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803b4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b52:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803b58:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803b5f:	00 00 00 
+  803b62:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803b69:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b6d:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803b73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b78:	48 83 c4 20          	add    $0x20,%rsp
+  803b7c:	5b                   	pop    %rbx
+  803b7d:	41 5f                	pop    %r15
+  803b7f:	5d                   	pop    %rbp
+  803b80:	c3                   	ret
+
+0000000000803b81 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803b81:	55                   	push   %rbp
+  803b82:	48 89 e5             	mov    %rsp,%rbp
+  803b85:	48 83 ec 20          	sub    $0x20,%rsp
+  803b89:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b89 <devfile_trunc+0x8>
+  803b90:	49 bb a7 44 00 00 00 	movabs $0x44a7,%r11
+  803b97:	00 00 00 
+  803b9a:	4c 01 d8             	add    %r11,%rax
+  803b9d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803ba1:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803ba4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803ba8:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803bab:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803bae:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803bb1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803bb4:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803bb8:	ba 08 00 00 00       	mov    $0x8,%edx
+  803bbd:	48 89 ce             	mov    %rcx,%rsi
+  803bc0:	bf 02 00 00 00       	mov    $0x2,%edi
+  803bc5:	48 b9 d5 b4 ff ff ff 	movabs $0xffffffffffffb4d5,%rcx
+  803bcc:	ff ff ff 
+  803bcf:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803bd3:	ff d0                	call   *%rax
+}
+  803bd5:	c9                   	leave
+  803bd6:	c3                   	ret
+
+0000000000803bd7 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803bd7:	55                   	push   %rbp
+  803bd8:	48 89 e5             	mov    %rsp,%rbp
+  803bdb:	41 57                	push   %r15
+  803bdd:	53                   	push   %rbx
+  803bde:	48 83 ec 10          	sub    $0x10,%rsp
+  803be2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803be2 <remove+0xb>
+  803be9:	49 bb 4e 44 00 00 00 	movabs $0x444e,%r11
+  803bf0:	00 00 00 
+  803bf3:	4c 01 db             	add    %r11,%rbx
+  803bf6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803bfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bfe:	48 89 c7             	mov    %rax,%rdi
+  803c01:	49 89 df             	mov    %rbx,%r15
+  803c04:	48 b8 35 93 ff ff ff 	movabs $0xffffffffffff9335,%rax
+  803c0b:	ff ff ff 
+  803c0e:	48 01 d8             	add    %rbx,%rax
+  803c11:	ff d0                	call   *%rax
+  803c13:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803c18:	7e 07                	jle    803c21 <remove+0x4a>
+		return -E_BAD_PATH;
+  803c1a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803c1f:	eb 44                	jmp    803c65 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803c21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c25:	48 89 c6             	mov    %rax,%rsi
+  803c28:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803c2f:	00 00 00 
+  803c32:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c36:	48 89 c7             	mov    %rax,%rdi
+  803c39:	49 89 df             	mov    %rbx,%r15
+  803c3c:	48 b8 c9 93 ff ff ff 	movabs $0xffffffffffff93c9,%rax
+  803c43:	ff ff ff 
+  803c46:	48 01 d8             	add    %rbx,%rax
+  803c49:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803c4b:	be 00 00 00 00       	mov    $0x0,%esi
+  803c50:	bf 07 00 00 00       	mov    $0x7,%edi
+  803c55:	48 b8 2d b4 ff ff ff 	movabs $0xffffffffffffb42d,%rax
+  803c5c:	ff ff ff 
+  803c5f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c63:	ff d0                	call   *%rax
+}
+  803c65:	48 83 c4 10          	add    $0x10,%rsp
+  803c69:	5b                   	pop    %rbx
+  803c6a:	41 5f                	pop    %r15
+  803c6c:	5d                   	pop    %rbp
+  803c6d:	c3                   	ret
+
+0000000000803c6e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803c6e:	55                   	push   %rbp
+  803c6f:	48 89 e5             	mov    %rsp,%rbp
+  803c72:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c72 <sync+0x4>
+  803c79:	49 bb be 43 00 00 00 	movabs $0x43be,%r11
+  803c80:	00 00 00 
+  803c83:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803c86:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c8b:	be 00 00 00 00       	mov    $0x0,%esi
+  803c90:	bf 08 00 00 00       	mov    $0x8,%edi
+  803c95:	48 b9 d5 b4 ff ff ff 	movabs $0xffffffffffffb4d5,%rcx
+  803c9c:	ff ff ff 
+  803c9f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803ca3:	ff d0                	call   *%rax
+}
+  803ca5:	5d                   	pop    %rbp
+  803ca6:	c3                   	ret
+
+0000000000803ca7 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803ca7:	55                   	push   %rbp
+  803ca8:	48 89 e5             	mov    %rsp,%rbp
+  803cab:	41 57                	push   %r15
+  803cad:	53                   	push   %rbx
+  803cae:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803cb5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cb5 <copy+0xe>
+  803cbc:	49 bb 7b 43 00 00 00 	movabs $0x437b,%r11
+  803cc3:	00 00 00 
+  803cc6:	4c 01 db             	add    %r11,%rbx
+  803cc9:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803cd0:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803cd7:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803cde:	be 00 00 00 00       	mov    $0x0,%esi
+  803ce3:	48 89 c7             	mov    %rax,%rdi
+  803ce6:	48 b8 74 b6 ff ff ff 	movabs $0xffffffffffffb674,%rax
+  803ced:	ff ff ff 
+  803cf0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cf4:	ff d0                	call   *%rax
+  803cf6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803cf9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803cfd:	79 35                	jns    803d34 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803cff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d02:	89 c6                	mov    %eax,%esi
+  803d04:	48 b8 f6 e4 ff ff ff 	movabs $0xffffffffffffe4f6,%rax
+  803d0b:	ff ff ff 
+  803d0e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d12:	48 89 c7             	mov    %rax,%rdi
+  803d15:	49 89 df             	mov    %rbx,%r15
+  803d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d1d:	48 ba 07 86 ff ff ff 	movabs $0xffffffffffff8607,%rdx
+  803d24:	ff ff ff 
+  803d27:	48 01 da             	add    %rbx,%rdx
+  803d2a:	ff d2                	call   *%rdx
+		return fd_src;
+  803d2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d2f:	e9 d7 01 00 00       	jmp    803f0b <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803d34:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803d3b:	be 01 01 00 00       	mov    $0x101,%esi
+  803d40:	48 89 c7             	mov    %rax,%rdi
+  803d43:	48 b8 74 b6 ff ff ff 	movabs $0xffffffffffffb674,%rax
+  803d4a:	ff ff ff 
+  803d4d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d51:	ff d0                	call   *%rax
+  803d53:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803d56:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803d5a:	0f 89 df 00 00 00    	jns    803e3f <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803d60:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d63:	89 c6                	mov    %eax,%esi
+  803d65:	48 b8 0c e5 ff ff ff 	movabs $0xffffffffffffe50c,%rax
+  803d6c:	ff ff ff 
+  803d6f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d73:	48 89 c7             	mov    %rax,%rdi
+  803d76:	49 89 df             	mov    %rbx,%r15
+  803d79:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d7e:	48 ba 07 86 ff ff ff 	movabs $0xffffffffffff8607,%rdx
+  803d85:	ff ff ff 
+  803d88:	48 01 da             	add    %rbx,%rdx
+  803d8b:	ff d2                	call   *%rdx
+		close(fd_src);
+  803d8d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d90:	89 c7                	mov    %eax,%edi
+  803d92:	49 89 df             	mov    %rbx,%r15
+  803d95:	48 b8 ed ab ff ff ff 	movabs $0xffffffffffffabed,%rax
+  803d9c:	ff ff ff 
+  803d9f:	48 01 d8             	add    %rbx,%rax
+  803da2:	ff d0                	call   *%rax
+		return fd_dest;
+  803da4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803da7:	e9 5f 01 00 00       	jmp    803f0b <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803dac:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803daf:	48 63 d0             	movslq %eax,%rdx
+  803db2:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803db9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803dbc:	48 89 ce             	mov    %rcx,%rsi
+  803dbf:	89 c7                	mov    %eax,%edi
+  803dc1:	49 89 df             	mov    %rbx,%r15
+  803dc4:	48 b8 4b b0 ff ff ff 	movabs $0xffffffffffffb04b,%rax
+  803dcb:	ff ff ff 
+  803dce:	48 01 d8             	add    %rbx,%rax
+  803dd1:	ff d0                	call   *%rax
+  803dd3:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803dd6:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803dda:	79 63                	jns    803e3f <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803ddc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803ddf:	89 c6                	mov    %eax,%esi
+  803de1:	48 b8 26 e5 ff ff ff 	movabs $0xffffffffffffe526,%rax
+  803de8:	ff ff ff 
+  803deb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803def:	48 89 c7             	mov    %rax,%rdi
+  803df2:	49 89 df             	mov    %rbx,%r15
+  803df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dfa:	48 ba 07 86 ff ff ff 	movabs $0xffffffffffff8607,%rdx
+  803e01:	ff ff ff 
+  803e04:	48 01 da             	add    %rbx,%rdx
+  803e07:	ff d2                	call   *%rdx
+			close(fd_src);
+  803e09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e0c:	89 c7                	mov    %eax,%edi
+  803e0e:	49 89 df             	mov    %rbx,%r15
+  803e11:	48 b8 ed ab ff ff ff 	movabs $0xffffffffffffabed,%rax
+  803e18:	ff ff ff 
+  803e1b:	48 01 d8             	add    %rbx,%rax
+  803e1e:	ff d0                	call   *%rax
+			close(fd_dest);
+  803e20:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e23:	89 c7                	mov    %eax,%edi
+  803e25:	49 89 df             	mov    %rbx,%r15
+  803e28:	48 b8 ed ab ff ff ff 	movabs $0xffffffffffffabed,%rax
+  803e2f:	ff ff ff 
+  803e32:	48 01 d8             	add    %rbx,%rax
+  803e35:	ff d0                	call   *%rax
+			return write_size;
+  803e37:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803e3a:	e9 cc 00 00 00       	jmp    803f0b <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803e3f:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803e46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e49:	ba 00 02 00 00       	mov    $0x200,%edx
+  803e4e:	48 89 ce             	mov    %rcx,%rsi
+  803e51:	89 c7                	mov    %eax,%edi
+  803e53:	49 89 df             	mov    %rbx,%r15
+  803e56:	48 b8 a5 ae ff ff ff 	movabs $0xffffffffffffaea5,%rax
+  803e5d:	ff ff ff 
+  803e60:	48 01 d8             	add    %rbx,%rax
+  803e63:	ff d0                	call   *%rax
+  803e65:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803e68:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803e6c:	0f 8f 3a ff ff ff    	jg     803dac <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803e72:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803e76:	79 60                	jns    803ed8 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803e78:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803e7b:	89 c6                	mov    %eax,%esi
+  803e7d:	48 b8 39 e5 ff ff ff 	movabs $0xffffffffffffe539,%rax
+  803e84:	ff ff ff 
+  803e87:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e8b:	48 89 c7             	mov    %rax,%rdi
+  803e8e:	49 89 df             	mov    %rbx,%r15
+  803e91:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e96:	48 ba 07 86 ff ff ff 	movabs $0xffffffffffff8607,%rdx
+  803e9d:	ff ff ff 
+  803ea0:	48 01 da             	add    %rbx,%rdx
+  803ea3:	ff d2                	call   *%rdx
+		close(fd_src);
+  803ea5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ea8:	89 c7                	mov    %eax,%edi
+  803eaa:	49 89 df             	mov    %rbx,%r15
+  803ead:	48 b8 ed ab ff ff ff 	movabs $0xffffffffffffabed,%rax
+  803eb4:	ff ff ff 
+  803eb7:	48 01 d8             	add    %rbx,%rax
+  803eba:	ff d0                	call   *%rax
+		close(fd_dest);
+  803ebc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ebf:	89 c7                	mov    %eax,%edi
+  803ec1:	49 89 df             	mov    %rbx,%r15
+  803ec4:	48 b8 ed ab ff ff ff 	movabs $0xffffffffffffabed,%rax
+  803ecb:	ff ff ff 
+  803ece:	48 01 d8             	add    %rbx,%rax
+  803ed1:	ff d0                	call   *%rax
+		return read_size;
+  803ed3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ed6:	eb 33                	jmp    803f0b <copy+0x264>
+	}
+	close(fd_src);
+  803ed8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803edb:	89 c7                	mov    %eax,%edi
+  803edd:	49 89 df             	mov    %rbx,%r15
+  803ee0:	48 b8 ed ab ff ff ff 	movabs $0xffffffffffffabed,%rax
+  803ee7:	ff ff ff 
+  803eea:	48 01 d8             	add    %rbx,%rax
+  803eed:	ff d0                	call   *%rax
+	close(fd_dest);
+  803eef:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ef2:	89 c7                	mov    %eax,%edi
+  803ef4:	49 89 df             	mov    %rbx,%r15
+  803ef7:	48 b8 ed ab ff ff ff 	movabs $0xffffffffffffabed,%rax
+  803efe:	ff ff ff 
+  803f01:	48 01 d8             	add    %rbx,%rax
+  803f04:	ff d0                	call   *%rax
+	return 0;
+  803f06:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  803f0b:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  803f12:	5b                   	pop    %rbx
+  803f13:	41 5f                	pop    %r15
+  803f15:	5d                   	pop    %rbp
+  803f16:	c3                   	ret
+
+0000000000803f17 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  803f17:	55                   	push   %rbp
+  803f18:	48 89 e5             	mov    %rsp,%rbp
+  803f1b:	41 57                	push   %r15
+  803f1d:	53                   	push   %rbx
+  803f1e:	48 83 ec 20          	sub    $0x20,%rsp
+  803f22:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f22 <fd2sockid+0xb>
+  803f29:	49 bb 0e 41 00 00 00 	movabs $0x410e,%r11
+  803f30:	00 00 00 
+  803f33:	4c 01 db             	add    %r11,%rbx
+  803f36:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803f39:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803f3d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f40:	48 89 d6             	mov    %rdx,%rsi
+  803f43:	89 c7                	mov    %eax,%edi
+  803f45:	49 89 df             	mov    %rbx,%r15
+  803f48:	48 b8 5e a9 ff ff ff 	movabs $0xffffffffffffa95e,%rax
+  803f4f:	ff ff ff 
+  803f52:	48 01 d8             	add    %rbx,%rax
+  803f55:	ff d0                	call   *%rax
+  803f57:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f5a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f5e:	79 05                	jns    803f65 <fd2sockid+0x4e>
+		return r;
+  803f60:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f63:	eb 25                	jmp    803f8a <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803f65:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f69:	8b 10                	mov    (%rax),%edx
+  803f6b:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  803f72:	00 00 00 
+  803f75:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803f78:	39 c2                	cmp    %eax,%edx
+  803f7a:	74 07                	je     803f83 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  803f7c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803f81:	eb 07                	jmp    803f8a <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  803f83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f87:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  803f8a:	48 83 c4 20          	add    $0x20,%rsp
+  803f8e:	5b                   	pop    %rbx
+  803f8f:	41 5f                	pop    %r15
+  803f91:	5d                   	pop    %rbp
+  803f92:	c3                   	ret
+
+0000000000803f93 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  803f93:	55                   	push   %rbp
+  803f94:	48 89 e5             	mov    %rsp,%rbp
+  803f97:	41 57                	push   %r15
+  803f99:	53                   	push   %rbx
+  803f9a:	48 83 ec 20          	sub    $0x20,%rsp
+  803f9e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f9e <alloc_sockfd+0xb>
+  803fa5:	49 bb 92 40 00 00 00 	movabs $0x4092,%r11
+  803fac:	00 00 00 
+  803faf:	4c 01 db             	add    %r11,%rbx
+  803fb2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  803fb5:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803fb9:	48 89 c7             	mov    %rax,%rdi
+  803fbc:	49 89 df             	mov    %rbx,%r15
+  803fbf:	48 b8 a8 a8 ff ff ff 	movabs $0xffffffffffffa8a8,%rax
+  803fc6:	ff ff ff 
+  803fc9:	48 01 d8             	add    %rbx,%rax
+  803fcc:	ff d0                	call   *%rax
+  803fce:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803fd1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fd5:	78 2c                	js     804003 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803fd7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fdb:	ba 07 04 00 00       	mov    $0x407,%edx
+  803fe0:	48 89 c6             	mov    %rax,%rsi
+  803fe3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fe8:	49 89 df             	mov    %rbx,%r15
+  803feb:	48 b8 85 a0 ff ff ff 	movabs $0xffffffffffffa085,%rax
+  803ff2:	ff ff ff 
+  803ff5:	48 01 d8             	add    %rbx,%rax
+  803ff8:	ff d0                	call   *%rax
+  803ffa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ffd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804001:	79 1c                	jns    80401f <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804003:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804006:	89 c7                	mov    %eax,%edi
+  804008:	49 89 df             	mov    %rbx,%r15
+  80400b:	48 b8 57 c7 ff ff ff 	movabs $0xffffffffffffc757,%rax
+  804012:	ff ff ff 
+  804015:	48 01 d8             	add    %rbx,%rax
+  804018:	ff d0                	call   *%rax
+		return r;
+  80401a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80401d:	eb 41                	jmp    804060 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80401f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804023:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  80402a:	00 00 00 
+  80402d:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804030:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804032:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804036:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  80403d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804041:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804044:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804047:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80404b:	48 89 c7             	mov    %rax,%rdi
+  80404e:	49 89 df             	mov    %rbx,%r15
+  804051:	48 b8 2e a8 ff ff ff 	movabs $0xffffffffffffa82e,%rax
+  804058:	ff ff ff 
+  80405b:	48 01 d8             	add    %rbx,%rax
+  80405e:	ff d0                	call   *%rax
+}
+  804060:	48 83 c4 20          	add    $0x20,%rsp
+  804064:	5b                   	pop    %rbx
+  804065:	41 5f                	pop    %r15
+  804067:	5d                   	pop    %rbp
+  804068:	c3                   	ret
+
+0000000000804069 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804069:	55                   	push   %rbp
+  80406a:	48 89 e5             	mov    %rsp,%rbp
+  80406d:	41 57                	push   %r15
+  80406f:	53                   	push   %rbx
+  804070:	48 83 ec 30          	sub    $0x30,%rsp
+  804074:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804074 <accept+0xb>
+  80407b:	49 bb bc 3f 00 00 00 	movabs $0x3fbc,%r11
+  804082:	00 00 00 
+  804085:	4c 01 db             	add    %r11,%rbx
+  804088:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80408b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80408f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804093:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804096:	89 c7                	mov    %eax,%edi
+  804098:	48 b8 e7 be ff ff ff 	movabs $0xffffffffffffbee7,%rax
+  80409f:	ff ff ff 
+  8040a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040a6:	ff d0                	call   *%rax
+  8040a8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040ab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040af:	79 05                	jns    8040b6 <accept+0x4d>
+		return r;
+  8040b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040b4:	eb 45                	jmp    8040fb <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8040b6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8040ba:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8040be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040c1:	48 89 ce             	mov    %rcx,%rsi
+  8040c4:	89 c7                	mov    %eax,%edi
+  8040c6:	49 89 df             	mov    %rbx,%r15
+  8040c9:	48 b8 c5 c5 ff ff ff 	movabs $0xffffffffffffc5c5,%rax
+  8040d0:	ff ff ff 
+  8040d3:	48 01 d8             	add    %rbx,%rax
+  8040d6:	ff d0                	call   *%rax
+  8040d8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040db:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040df:	79 05                	jns    8040e6 <accept+0x7d>
+		return r;
+  8040e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040e4:	eb 15                	jmp    8040fb <accept+0x92>
+	return alloc_sockfd(r);
+  8040e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040e9:	89 c7                	mov    %eax,%edi
+  8040eb:	48 b8 63 bf ff ff ff 	movabs $0xffffffffffffbf63,%rax
+  8040f2:	ff ff ff 
+  8040f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040f9:	ff d0                	call   *%rax
+}
+  8040fb:	48 83 c4 30          	add    $0x30,%rsp
+  8040ff:	5b                   	pop    %rbx
+  804100:	41 5f                	pop    %r15
+  804102:	5d                   	pop    %rbp
+  804103:	c3                   	ret
+
+0000000000804104 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804104:	55                   	push   %rbp
+  804105:	48 89 e5             	mov    %rsp,%rbp
+  804108:	41 57                	push   %r15
+  80410a:	53                   	push   %rbx
+  80410b:	48 83 ec 20          	sub    $0x20,%rsp
+  80410f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80410f <bind+0xb>
+  804116:	49 bb 21 3f 00 00 00 	movabs $0x3f21,%r11
+  80411d:	00 00 00 
+  804120:	4c 01 db             	add    %r11,%rbx
+  804123:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804126:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80412a:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80412d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804130:	89 c7                	mov    %eax,%edi
+  804132:	48 b8 e7 be ff ff ff 	movabs $0xffffffffffffbee7,%rax
+  804139:	ff ff ff 
+  80413c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804140:	ff d0                	call   *%rax
+  804142:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804145:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804149:	79 05                	jns    804150 <bind+0x4c>
+		return r;
+  80414b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80414e:	eb 21                	jmp    804171 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804150:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804153:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804157:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80415a:	48 89 ce             	mov    %rcx,%rsi
+  80415d:	89 c7                	mov    %eax,%edi
+  80415f:	49 89 df             	mov    %rbx,%r15
+  804162:	48 b8 71 c6 ff ff ff 	movabs $0xffffffffffffc671,%rax
+  804169:	ff ff ff 
+  80416c:	48 01 d8             	add    %rbx,%rax
+  80416f:	ff d0                	call   *%rax
+}
+  804171:	48 83 c4 20          	add    $0x20,%rsp
+  804175:	5b                   	pop    %rbx
+  804176:	41 5f                	pop    %r15
+  804178:	5d                   	pop    %rbp
+  804179:	c3                   	ret
+
+000000000080417a <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  80417a:	55                   	push   %rbp
+  80417b:	48 89 e5             	mov    %rsp,%rbp
+  80417e:	41 57                	push   %r15
+  804180:	53                   	push   %rbx
+  804181:	48 83 ec 20          	sub    $0x20,%rsp
+  804185:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804185 <shutdown+0xb>
+  80418c:	49 bb ab 3e 00 00 00 	movabs $0x3eab,%r11
+  804193:	00 00 00 
+  804196:	4c 01 db             	add    %r11,%rbx
+  804199:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80419c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80419f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041a2:	89 c7                	mov    %eax,%edi
+  8041a4:	48 b8 e7 be ff ff ff 	movabs $0xffffffffffffbee7,%rax
+  8041ab:	ff ff ff 
+  8041ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041b2:	ff d0                	call   *%rax
+  8041b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041bb:	79 05                	jns    8041c2 <shutdown+0x48>
+		return r;
+  8041bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041c0:	eb 1c                	jmp    8041de <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8041c2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8041c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041c8:	89 d6                	mov    %edx,%esi
+  8041ca:	89 c7                	mov    %eax,%edi
+  8041cc:	49 89 df             	mov    %rbx,%r15
+  8041cf:	48 b8 06 c7 ff ff ff 	movabs $0xffffffffffffc706,%rax
+  8041d6:	ff ff ff 
+  8041d9:	48 01 d8             	add    %rbx,%rax
+  8041dc:	ff d0                	call   *%rax
+}
+  8041de:	48 83 c4 20          	add    $0x20,%rsp
+  8041e2:	5b                   	pop    %rbx
+  8041e3:	41 5f                	pop    %r15
+  8041e5:	5d                   	pop    %rbp
+  8041e6:	c3                   	ret
+
+00000000008041e7 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8041e7:	55                   	push   %rbp
+  8041e8:	48 89 e5             	mov    %rsp,%rbp
+  8041eb:	41 57                	push   %r15
+  8041ed:	53                   	push   %rbx
+  8041ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8041f2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041f2 <devsock_close+0xb>
+  8041f9:	49 bb 3e 3e 00 00 00 	movabs $0x3e3e,%r11
+  804200:	00 00 00 
+  804203:	4c 01 db             	add    %r11,%rbx
+  804206:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  80420a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80420e:	48 89 c7             	mov    %rax,%rdi
+  804211:	49 89 df             	mov    %rbx,%r15
+  804214:	48 b8 03 df ff ff ff 	movabs $0xffffffffffffdf03,%rax
+  80421b:	ff ff ff 
+  80421e:	48 01 d8             	add    %rbx,%rax
+  804221:	ff d0                	call   *%rax
+  804223:	83 f8 01             	cmp    $0x1,%eax
+  804226:	75 1d                	jne    804245 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804228:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80422c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80422f:	89 c7                	mov    %eax,%edi
+  804231:	49 89 df             	mov    %rbx,%r15
+  804234:	48 b8 57 c7 ff ff ff 	movabs $0xffffffffffffc757,%rax
+  80423b:	ff ff ff 
+  80423e:	48 01 d8             	add    %rbx,%rax
+  804241:	ff d0                	call   *%rax
+  804243:	eb 05                	jmp    80424a <devsock_close+0x63>
+	else
+		return 0;
+  804245:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80424a:	48 83 c4 10          	add    $0x10,%rsp
+  80424e:	5b                   	pop    %rbx
+  80424f:	41 5f                	pop    %r15
+  804251:	5d                   	pop    %rbp
+  804252:	c3                   	ret
+
+0000000000804253 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804253:	55                   	push   %rbp
+  804254:	48 89 e5             	mov    %rsp,%rbp
+  804257:	41 57                	push   %r15
+  804259:	53                   	push   %rbx
+  80425a:	48 83 ec 20          	sub    $0x20,%rsp
+  80425e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80425e <connect+0xb>
+  804265:	49 bb d2 3d 00 00 00 	movabs $0x3dd2,%r11
+  80426c:	00 00 00 
+  80426f:	4c 01 db             	add    %r11,%rbx
+  804272:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804275:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804279:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80427c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80427f:	89 c7                	mov    %eax,%edi
+  804281:	48 b8 e7 be ff ff ff 	movabs $0xffffffffffffbee7,%rax
+  804288:	ff ff ff 
+  80428b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80428f:	ff d0                	call   *%rax
+  804291:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804294:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804298:	79 05                	jns    80429f <connect+0x4c>
+		return r;
+  80429a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80429d:	eb 21                	jmp    8042c0 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  80429f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8042a2:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8042a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042a9:	48 89 ce             	mov    %rcx,%rsi
+  8042ac:	89 c7                	mov    %eax,%edi
+  8042ae:	49 89 df             	mov    %rbx,%r15
+  8042b1:	48 b8 9f c7 ff ff ff 	movabs $0xffffffffffffc79f,%rax
+  8042b8:	ff ff ff 
+  8042bb:	48 01 d8             	add    %rbx,%rax
+  8042be:	ff d0                	call   *%rax
+}
+  8042c0:	48 83 c4 20          	add    $0x20,%rsp
+  8042c4:	5b                   	pop    %rbx
+  8042c5:	41 5f                	pop    %r15
+  8042c7:	5d                   	pop    %rbp
+  8042c8:	c3                   	ret
+
+00000000008042c9 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8042c9:	55                   	push   %rbp
+  8042ca:	48 89 e5             	mov    %rsp,%rbp
+  8042cd:	41 57                	push   %r15
+  8042cf:	53                   	push   %rbx
+  8042d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8042d4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042d4 <listen+0xb>
+  8042db:	49 bb 5c 3d 00 00 00 	movabs $0x3d5c,%r11
+  8042e2:	00 00 00 
+  8042e5:	4c 01 db             	add    %r11,%rbx
+  8042e8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8042eb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8042ee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8042f1:	89 c7                	mov    %eax,%edi
+  8042f3:	48 b8 e7 be ff ff ff 	movabs $0xffffffffffffbee7,%rax
+  8042fa:	ff ff ff 
+  8042fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804301:	ff d0                	call   *%rax
+  804303:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804306:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80430a:	79 05                	jns    804311 <listen+0x48>
+		return r;
+  80430c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80430f:	eb 1c                	jmp    80432d <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804311:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804314:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804317:	89 d6                	mov    %edx,%esi
+  804319:	89 c7                	mov    %eax,%edi
+  80431b:	49 89 df             	mov    %rbx,%r15
+  80431e:	48 b8 34 c8 ff ff ff 	movabs $0xffffffffffffc834,%rax
+  804325:	ff ff ff 
+  804328:	48 01 d8             	add    %rbx,%rax
+  80432b:	ff d0                	call   *%rax
+}
+  80432d:	48 83 c4 20          	add    $0x20,%rsp
+  804331:	5b                   	pop    %rbx
+  804332:	41 5f                	pop    %r15
+  804334:	5d                   	pop    %rbp
+  804335:	c3                   	ret
+
+0000000000804336 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804336:	55                   	push   %rbp
+  804337:	48 89 e5             	mov    %rsp,%rbp
+  80433a:	41 57                	push   %r15
+  80433c:	48 83 ec 28          	sub    $0x28,%rsp
+  804340:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804340 <devsock_read+0xa>
+  804347:	49 bb f0 3c 00 00 00 	movabs $0x3cf0,%r11
+  80434e:	00 00 00 
+  804351:	4c 01 d8             	add    %r11,%rax
+  804354:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804358:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80435c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  804360:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804364:	41 89 d0             	mov    %edx,%r8d
+  804367:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80436b:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80436e:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804372:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804377:	44 89 c2             	mov    %r8d,%edx
+  80437a:	49 89 c7             	mov    %rax,%r15
+  80437d:	49 b8 85 c8 ff ff ff 	movabs $0xffffffffffffc885,%r8
+  804384:	ff ff ff 
+  804387:	49 01 c0             	add    %rax,%r8
+  80438a:	41 ff d0             	call   *%r8
+}
+  80438d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804391:	c9                   	leave
+  804392:	c3                   	ret
+
+0000000000804393 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804393:	55                   	push   %rbp
+  804394:	48 89 e5             	mov    %rsp,%rbp
+  804397:	41 57                	push   %r15
+  804399:	48 83 ec 28          	sub    $0x28,%rsp
+  80439d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80439d <devsock_write+0xa>
+  8043a4:	49 bb 93 3c 00 00 00 	movabs $0x3c93,%r11
+  8043ab:	00 00 00 
+  8043ae:	4c 01 d8             	add    %r11,%rax
+  8043b1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8043b5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8043b9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8043bd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8043c1:	41 89 d0             	mov    %edx,%r8d
+  8043c4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043c8:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8043cb:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8043cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8043d4:	44 89 c2             	mov    %r8d,%edx
+  8043d7:	49 89 c7             	mov    %rax,%r15
+  8043da:	49 b8 a2 c9 ff ff ff 	movabs $0xffffffffffffc9a2,%r8
+  8043e1:	ff ff ff 
+  8043e4:	49 01 c0             	add    %rax,%r8
+  8043e7:	41 ff d0             	call   *%r8
+}
+  8043ea:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8043ee:	c9                   	leave
+  8043ef:	c3                   	ret
+
+00000000008043f0 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8043f0:	55                   	push   %rbp
+  8043f1:	48 89 e5             	mov    %rsp,%rbp
+  8043f4:	41 57                	push   %r15
+  8043f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8043fa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8043fa <devsock_stat+0xa>
+  804401:	49 bb 36 3c 00 00 00 	movabs $0x3c36,%r11
+  804408:	00 00 00 
+  80440b:	4c 01 d8             	add    %r11,%rax
+  80440e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804412:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804416:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80441a:	48 b9 54 e5 ff ff ff 	movabs $0xffffffffffffe554,%rcx
+  804421:	ff ff ff 
+  804424:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804428:	48 89 ce             	mov    %rcx,%rsi
+  80442b:	48 89 d7             	mov    %rdx,%rdi
+  80442e:	49 89 c7             	mov    %rax,%r15
+  804431:	48 ba c9 93 ff ff ff 	movabs $0xffffffffffff93c9,%rdx
+  804438:	ff ff ff 
+  80443b:	48 01 c2             	add    %rax,%rdx
+  80443e:	ff d2                	call   *%rdx
+	return 0;
+  804440:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804445:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804449:	c9                   	leave
+  80444a:	c3                   	ret
+
+000000000080444b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80444b:	55                   	push   %rbp
+  80444c:	48 89 e5             	mov    %rsp,%rbp
+  80444f:	41 57                	push   %r15
+  804451:	53                   	push   %rbx
+  804452:	48 83 ec 20          	sub    $0x20,%rsp
+  804456:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804456 <socket+0xb>
+  80445d:	49 bb da 3b 00 00 00 	movabs $0x3bda,%r11
+  804464:	00 00 00 
+  804467:	4c 01 db             	add    %r11,%rbx
+  80446a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80446d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  804470:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  804473:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804476:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804479:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80447c:	89 ce                	mov    %ecx,%esi
+  80447e:	89 c7                	mov    %eax,%edi
+  804480:	49 89 df             	mov    %rbx,%r15
+  804483:	48 b8 79 cb ff ff ff 	movabs $0xffffffffffffcb79,%rax
+  80448a:	ff ff ff 
+  80448d:	48 01 d8             	add    %rbx,%rax
+  804490:	ff d0                	call   *%rax
+  804492:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804495:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804499:	79 05                	jns    8044a0 <socket+0x55>
+		return r;
+  80449b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80449e:	eb 15                	jmp    8044b5 <socket+0x6a>
+	return alloc_sockfd(r);
+  8044a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044a3:	89 c7                	mov    %eax,%edi
+  8044a5:	48 b8 63 bf ff ff ff 	movabs $0xffffffffffffbf63,%rax
+  8044ac:	ff ff ff 
+  8044af:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044b3:	ff d0                	call   *%rax
+}
+  8044b5:	48 83 c4 20          	add    $0x20,%rsp
+  8044b9:	5b                   	pop    %rbx
+  8044ba:	41 5f                	pop    %r15
+  8044bc:	5d                   	pop    %rbp
+  8044bd:	c3                   	ret
+
+00000000008044be <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8044be:	55                   	push   %rbp
+  8044bf:	48 89 e5             	mov    %rsp,%rbp
+  8044c2:	41 57                	push   %r15
+  8044c4:	53                   	push   %rbx
+  8044c5:	48 83 ec 10          	sub    $0x10,%rsp
+  8044c9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044c9 <nsipc+0xb>
+  8044d0:	49 bb 67 3b 00 00 00 	movabs $0x3b67,%r11
+  8044d7:	00 00 00 
+  8044da:	4c 01 db             	add    %r11,%rbx
+  8044dd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8044e0:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8044e7:	00 00 00 
+  8044ea:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8044ed:	85 c0                	test   %eax,%eax
+  8044ef:	75 24                	jne    804515 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8044f1:	bf 02 00 00 00       	mov    $0x2,%edi
+  8044f6:	49 89 df             	mov    %rbx,%r15
+  8044f9:	48 b8 74 de ff ff ff 	movabs $0xffffffffffffde74,%rax
+  804500:	ff ff ff 
+  804503:	48 01 d8             	add    %rbx,%rax
+  804506:	ff d0                	call   *%rax
+  804508:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  80450f:	00 00 00 
+  804512:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  804515:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  80451c:	00 00 00 
+  80451f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804522:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804525:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80452b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804531:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804536:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80453d:	00 00 00 
+  804540:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804544:	89 c7                	mov    %eax,%edi
+  804546:	49 89 df             	mov    %rbx,%r15
+  804549:	48 b8 93 d8 ff ff ff 	movabs $0xffffffffffffd893,%rax
+  804550:	ff ff ff 
+  804553:	48 01 d8             	add    %rbx,%rax
+  804556:	ff d0                	call   *%rax
+}
+  804558:	48 83 c4 10          	add    $0x10,%rsp
+  80455c:	5b                   	pop    %rbx
+  80455d:	41 5f                	pop    %r15
+  80455f:	5d                   	pop    %rbp
+  804560:	c3                   	ret
+
+0000000000804561 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  804561:	55                   	push   %rbp
+  804562:	48 89 e5             	mov    %rsp,%rbp
+  804565:	41 57                	push   %r15
+  804567:	53                   	push   %rbx
+  804568:	48 83 ec 20          	sub    $0x20,%rsp
+  80456c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80456c <nsipc_words+0xb>
+  804573:	49 bb c4 3a 00 00 00 	movabs $0x3ac4,%r11
+  80457a:	00 00 00 
+  80457d:	4c 01 db             	add    %r11,%rbx
+  804580:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804583:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804587:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  80458b:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804592:	00 00 00 
+  804595:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804598:	85 c0                	test   %eax,%eax
+  80459a:	75 24                	jne    8045c0 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80459c:	bf 02 00 00 00       	mov    $0x2,%edi
+  8045a1:	49 89 df             	mov    %rbx,%r15
+  8045a4:	48 b8 74 de ff ff ff 	movabs $0xffffffffffffde74,%rax
+  8045ab:	ff ff ff 
+  8045ae:	48 01 d8             	add    %rbx,%rax
+  8045b1:	ff d0                	call   *%rax
+  8045b3:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  8045ba:	00 00 00 
+  8045bd:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8045c0:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8045c7:	00 00 00 
+  8045ca:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8045cd:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8045d1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8045d5:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8045d8:	89 c7                	mov    %eax,%edi
+  8045da:	49 89 df             	mov    %rbx,%r15
+  8045dd:	48 b8 7e d9 ff ff ff 	movabs $0xffffffffffffd97e,%rax
+  8045e4:	ff ff ff 
+  8045e7:	48 01 d8             	add    %rbx,%rax
+  8045ea:	ff d0                	call   *%rax
+}
+  8045ec:	48 83 c4 20          	add    $0x20,%rsp
+  8045f0:	5b                   	pop    %rbx
+  8045f1:	41 5f                	pop    %r15
+  8045f3:	5d                   	pop    %rbp
+  8045f4:	c3                   	ret
+
+00000000008045f5 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8045f5:	55                   	push   %rbp
+  8045f6:	48 89 e5             	mov    %rsp,%rbp
+  8045f9:	41 57                	push   %r15
+  8045fb:	53                   	push   %rbx
+  8045fc:	48 83 ec 30          	sub    $0x30,%rsp
+  804600:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804600 <nsipc_accept+0xb>
+  804607:	49 bb 30 3a 00 00 00 	movabs $0x3a30,%r11
+  80460e:	00 00 00 
+  804611:	4c 01 db             	add    %r11,%rbx
+  804614:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804617:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80461b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80461f:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804626:	00 00 00 
+  804629:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80462c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80462f:	bf 01 00 00 00       	mov    $0x1,%edi
+  804634:	48 b8 8e c4 ff ff ff 	movabs $0xffffffffffffc48e,%rax
+  80463b:	ff ff ff 
+  80463e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804642:	ff d0                	call   *%rax
+  804644:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804647:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80464b:	78 48                	js     804695 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  80464d:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  804654:	00 00 00 
+  804657:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80465b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80465f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804663:	8b 40 10             	mov    0x10(%rax),%eax
+  804666:	89 c2                	mov    %eax,%edx
+  804668:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80466c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804670:	48 89 ce             	mov    %rcx,%rsi
+  804673:	48 89 c7             	mov    %rax,%rdi
+  804676:	49 89 df             	mov    %rbx,%r15
+  804679:	48 b8 a9 97 ff ff ff 	movabs $0xffffffffffff97a9,%rax
+  804680:	ff ff ff 
+  804683:	48 01 d8             	add    %rbx,%rax
+  804686:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  804688:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80468c:	8b 50 10             	mov    0x10(%rax),%edx
+  80468f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804693:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  804695:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804698:	48 83 c4 30          	add    $0x30,%rsp
+  80469c:	5b                   	pop    %rbx
+  80469d:	41 5f                	pop    %r15
+  80469f:	5d                   	pop    %rbp
+  8046a0:	c3                   	ret
+
+00000000008046a1 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8046a1:	55                   	push   %rbp
+  8046a2:	48 89 e5             	mov    %rsp,%rbp
+  8046a5:	41 57                	push   %r15
+  8046a7:	53                   	push   %rbx
+  8046a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8046ac:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046ac <nsipc_bind+0xb>
+  8046b3:	49 bb 84 39 00 00 00 	movabs $0x3984,%r11
+  8046ba:	00 00 00 
+  8046bd:	4c 01 db             	add    %r11,%rbx
+  8046c0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8046c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8046c7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8046ca:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8046d1:	00 00 00 
+  8046d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046d7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8046da:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8046dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046e1:	48 89 c6             	mov    %rax,%rsi
+  8046e4:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  8046eb:	00 00 00 
+  8046ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046f2:	48 89 c7             	mov    %rax,%rdi
+  8046f5:	49 89 df             	mov    %rbx,%r15
+  8046f8:	48 b8 a9 97 ff ff ff 	movabs $0xffffffffffff97a9,%rax
+  8046ff:	ff ff ff 
+  804702:	48 01 d8             	add    %rbx,%rax
+  804705:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  804707:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80470e:	00 00 00 
+  804711:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804714:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  804718:	bf 02 00 00 00       	mov    $0x2,%edi
+  80471d:	48 b8 8e c4 ff ff ff 	movabs $0xffffffffffffc48e,%rax
+  804724:	ff ff ff 
+  804727:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80472b:	ff d0                	call   *%rax
+}
+  80472d:	48 83 c4 10          	add    $0x10,%rsp
+  804731:	5b                   	pop    %rbx
+  804732:	41 5f                	pop    %r15
+  804734:	5d                   	pop    %rbp
+  804735:	c3                   	ret
+
+0000000000804736 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  804736:	55                   	push   %rbp
+  804737:	48 89 e5             	mov    %rsp,%rbp
+  80473a:	48 83 ec 20          	sub    $0x20,%rsp
+  80473e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80473e <nsipc_shutdown+0x8>
+  804745:	49 bb f2 38 00 00 00 	movabs $0x38f2,%r11
+  80474c:	00 00 00 
+  80474f:	4c 01 d8             	add    %r11,%rax
+  804752:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804755:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  804758:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80475b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  80475e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804761:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  804764:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804768:	ba 08 00 00 00       	mov    $0x8,%edx
+  80476d:	48 89 ce             	mov    %rcx,%rsi
+  804770:	bf 03 00 00 00       	mov    $0x3,%edi
+  804775:	48 b9 31 c5 ff ff ff 	movabs $0xffffffffffffc531,%rcx
+  80477c:	ff ff ff 
+  80477f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804783:	ff d0                	call   *%rax
+}
+  804785:	c9                   	leave
+  804786:	c3                   	ret
+
+0000000000804787 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  804787:	55                   	push   %rbp
+  804788:	48 89 e5             	mov    %rsp,%rbp
+  80478b:	48 83 ec 20          	sub    $0x20,%rsp
+  80478f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80478f <nsipc_close+0x8>
+  804796:	49 bb a1 38 00 00 00 	movabs $0x38a1,%r11
+  80479d:	00 00 00 
+  8047a0:	4c 01 d8             	add    %r11,%rax
+  8047a3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8047a6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8047a9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8047ac:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8047b0:	ba 04 00 00 00       	mov    $0x4,%edx
+  8047b5:	48 89 ce             	mov    %rcx,%rsi
+  8047b8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8047bd:	48 b9 31 c5 ff ff ff 	movabs $0xffffffffffffc531,%rcx
+  8047c4:	ff ff ff 
+  8047c7:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8047cb:	ff d0                	call   *%rax
+}
+  8047cd:	c9                   	leave
+  8047ce:	c3                   	ret
+
+00000000008047cf <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8047cf:	55                   	push   %rbp
+  8047d0:	48 89 e5             	mov    %rsp,%rbp
+  8047d3:	41 57                	push   %r15
+  8047d5:	53                   	push   %rbx
+  8047d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8047da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047da <nsipc_connect+0xb>
+  8047e1:	49 bb 56 38 00 00 00 	movabs $0x3856,%r11
+  8047e8:	00 00 00 
+  8047eb:	4c 01 db             	add    %r11,%rbx
+  8047ee:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8047f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8047f5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8047f8:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8047ff:	00 00 00 
+  804802:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804805:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  804808:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80480b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80480f:	48 89 c6             	mov    %rax,%rsi
+  804812:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  804819:	00 00 00 
+  80481c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804820:	48 89 c7             	mov    %rax,%rdi
+  804823:	49 89 df             	mov    %rbx,%r15
+  804826:	48 b8 a9 97 ff ff ff 	movabs $0xffffffffffff97a9,%rax
+  80482d:	ff ff ff 
+  804830:	48 01 d8             	add    %rbx,%rax
+  804833:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  804835:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80483c:	00 00 00 
+  80483f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804842:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  804846:	bf 05 00 00 00       	mov    $0x5,%edi
+  80484b:	48 b8 8e c4 ff ff ff 	movabs $0xffffffffffffc48e,%rax
+  804852:	ff ff ff 
+  804855:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804859:	ff d0                	call   *%rax
+}
+  80485b:	48 83 c4 10          	add    $0x10,%rsp
+  80485f:	5b                   	pop    %rbx
+  804860:	41 5f                	pop    %r15
+  804862:	5d                   	pop    %rbp
+  804863:	c3                   	ret
+
+0000000000804864 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  804864:	55                   	push   %rbp
+  804865:	48 89 e5             	mov    %rsp,%rbp
+  804868:	48 83 ec 20          	sub    $0x20,%rsp
+  80486c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80486c <nsipc_listen+0x8>
+  804873:	49 bb c4 37 00 00 00 	movabs $0x37c4,%r11
+  80487a:	00 00 00 
+  80487d:	4c 01 d8             	add    %r11,%rax
+  804880:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804883:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  804886:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804889:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  80488c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80488f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  804892:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804896:	ba 08 00 00 00       	mov    $0x8,%edx
+  80489b:	48 89 ce             	mov    %rcx,%rsi
+  80489e:	bf 06 00 00 00       	mov    $0x6,%edi
+  8048a3:	48 b9 31 c5 ff ff ff 	movabs $0xffffffffffffc531,%rcx
+  8048aa:	ff ff ff 
+  8048ad:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8048b1:	ff d0                	call   *%rax
+}
+  8048b3:	c9                   	leave
+  8048b4:	c3                   	ret
+
+00000000008048b5 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8048b5:	55                   	push   %rbp
+  8048b6:	48 89 e5             	mov    %rsp,%rbp
+  8048b9:	41 57                	push   %r15
+  8048bb:	53                   	push   %rbx
+  8048bc:	48 83 ec 30          	sub    $0x30,%rsp
+  8048c0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048c0 <nsipc_recv+0xb>
+  8048c7:	49 bb 70 37 00 00 00 	movabs $0x3770,%r11
+  8048ce:	00 00 00 
+  8048d1:	4c 01 db             	add    %r11,%rbx
+  8048d4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8048d7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8048db:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8048de:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8048e1:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8048e8:	00 00 00 
+  8048eb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048ee:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  8048f1:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8048f8:	00 00 00 
+  8048fb:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8048fe:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  804902:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804909:	00 00 00 
+  80490c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80490f:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804913:	bf 07 00 00 00       	mov    $0x7,%edi
+  804918:	48 b8 8e c4 ff ff ff 	movabs $0xffffffffffffc48e,%rax
+  80491f:	ff ff ff 
+  804922:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804926:	ff d0                	call   *%rax
+  804928:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80492b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80492f:	0f 88 91 00 00 00    	js     8049c6 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  804935:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  80493c:	7f 08                	jg     804946 <nsipc_recv+0x91>
+  80493e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804941:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  804944:	7e 50                	jle    804996 <nsipc_recv+0xe1>
+  804946:	48 b8 5b e5 ff ff ff 	movabs $0xffffffffffffe55b,%rax
+  80494d:	ff ff ff 
+  804950:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804954:	48 89 c1             	mov    %rax,%rcx
+  804957:	48 b8 70 e5 ff ff ff 	movabs $0xffffffffffffe570,%rax
+  80495e:	ff ff ff 
+  804961:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804965:	48 89 c2             	mov    %rax,%rdx
+  804968:	be 79 00 00 00       	mov    $0x79,%esi
+  80496d:	48 b8 85 e5 ff ff ff 	movabs $0xffffffffffffe585,%rax
+  804974:	ff ff ff 
+  804977:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80497b:	48 89 c7             	mov    %rax,%rdi
+  80497e:	49 89 df             	mov    %rbx,%r15
+  804981:	b8 00 00 00 00       	mov    $0x0,%eax
+  804986:	49 b8 30 83 ff ff ff 	movabs $0xffffffffffff8330,%r8
+  80498d:	ff ff ff 
+  804990:	49 01 d8             	add    %rbx,%r8
+  804993:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804996:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804999:	48 63 d0             	movslq %eax,%rdx
+  80499c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049a0:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  8049a7:	00 00 00 
+  8049aa:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  8049ae:	48 89 ce             	mov    %rcx,%rsi
+  8049b1:	48 89 c7             	mov    %rax,%rdi
+  8049b4:	49 89 df             	mov    %rbx,%r15
+  8049b7:	48 b8 a9 97 ff ff ff 	movabs $0xffffffffffff97a9,%rax
+  8049be:	ff ff ff 
+  8049c1:	48 01 d8             	add    %rbx,%rax
+  8049c4:	ff d0                	call   *%rax
+	}
+
+	return r;
+  8049c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8049c9:	48 83 c4 30          	add    $0x30,%rsp
+  8049cd:	5b                   	pop    %rbx
+  8049ce:	41 5f                	pop    %r15
+  8049d0:	5d                   	pop    %rbp
+  8049d1:	c3                   	ret
+
+00000000008049d2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8049d2:	55                   	push   %rbp
+  8049d3:	48 89 e5             	mov    %rsp,%rbp
+  8049d6:	41 57                	push   %r15
+  8049d8:	53                   	push   %rbx
+  8049d9:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8049e0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049e0 <nsipc_send+0xe>
+  8049e7:	49 bb 50 36 00 00 00 	movabs $0x3650,%r11
+  8049ee:	00 00 00 
+  8049f1:	4c 01 db             	add    %r11,%rbx
+  8049f4:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8049fa:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804a01:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804a07:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  804a0d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804a11:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804a15:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804a1c:	00 00 00 
+  804a1f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a22:	85 c0                	test   %eax,%eax
+  804a24:	75 24                	jne    804a4a <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804a26:	bf 02 00 00 00       	mov    $0x2,%edi
+  804a2b:	49 89 df             	mov    %rbx,%r15
+  804a2e:	48 b8 74 de ff ff ff 	movabs $0xffffffffffffde74,%rax
+  804a35:	ff ff ff 
+  804a38:	48 01 d8             	add    %rbx,%rax
+  804a3b:	ff d0                	call   *%rax
+  804a3d:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804a44:	00 00 00 
+  804a47:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  804a4a:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804a50:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804a53:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804a5a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804a5d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804a60:	39 c2                	cmp    %eax,%edx
+  804a62:	0f 4e c2             	cmovle %edx,%eax
+  804a65:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  804a6b:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804a71:	48 63 d0             	movslq %eax,%rdx
+  804a74:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  804a7b:	48 89 c6             	mov    %rax,%rsi
+  804a7e:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804a85:	00 00 00 
+  804a88:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a8c:	48 89 c7             	mov    %rax,%rdi
+  804a8f:	49 89 df             	mov    %rbx,%r15
+  804a92:	48 b8 a9 97 ff ff ff 	movabs $0xffffffffffff97a9,%rax
+  804a99:	ff ff ff 
+  804a9c:	48 01 d8             	add    %rbx,%rax
+  804a9f:	ff d0                	call   *%rax
+	req->req_s = s;
+  804aa1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804aa5:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  804aab:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  804aad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ab1:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  804ab7:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  804aba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804abe:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  804ac4:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  804ac7:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804ace:	00 00 00 
+  804ad1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ad5:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804ad9:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  804ae0:	00 
+  804ae1:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804ae7:	48 63 d0             	movslq %eax,%rdx
+  804aea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804aee:	48 01 d0             	add    %rdx,%rax
+  804af1:	48 83 e8 01          	sub    $0x1,%rax
+  804af5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804af9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804afd:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b02:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804b06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b0a:	48 29 d0             	sub    %rdx,%rax
+  804b0d:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804b13:	85 c0                	test   %eax,%eax
+  804b15:	0f 48 c2             	cmovs  %edx,%eax
+  804b18:	c1 f8 0c             	sar    $0xc,%eax
+  804b1b:	48 98                	cltq
+  804b1d:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  804b21:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804b25:	48 85 c0             	test   %rax,%rax
+  804b28:	0f 95 c0             	setne  %al
+  804b2b:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  804b2e:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  804b35:	00 
+  804b36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b3a:	48 83 c0 0b          	add    $0xb,%rax
+  804b3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804b42:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b46:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b4b:	48 f7 75 c8          	divq   -0x38(%rbp)
+  804b4f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b53:	48 29 d0             	sub    %rdx,%rax
+  804b56:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804b5a:	89 c7                	mov    %eax,%edi
+  804b5c:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804b63:	00 00 00 
+  804b66:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b69:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  804b6d:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  804b71:	48 83 ec 08          	sub    $0x8,%rsp
+  804b75:	6a 00                	push   $0x0
+  804b77:	6a 00                	push   $0x0
+  804b79:	6a 05                	push   $0x5
+  804b7b:	41 89 f1             	mov    %esi,%r9d
+  804b7e:	49 89 c8             	mov    %rcx,%r8
+  804b81:	89 f9                	mov    %edi,%ecx
+  804b83:	be 08 00 00 00       	mov    $0x8,%esi
+  804b88:	89 c7                	mov    %eax,%edi
+  804b8a:	49 89 df             	mov    %rbx,%r15
+  804b8d:	48 b8 7c da ff ff ff 	movabs $0xffffffffffffda7c,%rax
+  804b94:	ff ff ff 
+  804b97:	48 01 d8             	add    %rbx,%rax
+  804b9a:	ff d0                	call   *%rax
+  804b9c:	48 83 c4 20          	add    $0x20,%rsp
+}
+  804ba0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804ba4:	5b                   	pop    %rbx
+  804ba5:	41 5f                	pop    %r15
+  804ba7:	5d                   	pop    %rbp
+  804ba8:	c3                   	ret
+
+0000000000804ba9 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804ba9:	55                   	push   %rbp
+  804baa:	48 89 e5             	mov    %rsp,%rbp
+  804bad:	48 83 ec 10          	sub    $0x10,%rsp
+  804bb1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804bb1 <nsipc_socket+0x8>
+  804bb8:	49 bb 7f 34 00 00 00 	movabs $0x347f,%r11
+  804bbf:	00 00 00 
+  804bc2:	4c 01 d8             	add    %r11,%rax
+  804bc5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804bc8:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  804bcb:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  804bce:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804bd5:	00 00 00 
+  804bd8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804bdb:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  804bde:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804be5:	00 00 00 
+  804be8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  804beb:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  804bef:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804bf6:	00 00 00 
+  804bf9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804bfc:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  804c00:	bf 09 00 00 00       	mov    $0x9,%edi
+  804c05:	48 ba 8e c4 ff ff ff 	movabs $0xffffffffffffc48e,%rdx
+  804c0c:	ff ff ff 
+  804c0f:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804c13:	ff d0                	call   *%rax
+}
+  804c15:	c9                   	leave
+  804c16:	c3                   	ret
+
+0000000000804c17 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  804c17:	55                   	push   %rbp
+  804c18:	48 89 e5             	mov    %rsp,%rbp
+  804c1b:	41 57                	push   %r15
+  804c1d:	53                   	push   %rbx
+  804c1e:	48 83 ec 30          	sub    $0x30,%rsp
+  804c22:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c22 <pipe+0xb>
+  804c29:	49 bb 0e 34 00 00 00 	movabs $0x340e,%r11
+  804c30:	00 00 00 
+  804c33:	4c 01 db             	add    %r11,%rbx
+  804c36:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  804c3a:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  804c3e:	48 89 c7             	mov    %rax,%rdi
+  804c41:	49 89 df             	mov    %rbx,%r15
+  804c44:	48 b8 a8 a8 ff ff ff 	movabs $0xffffffffffffa8a8,%rax
+  804c4b:	ff ff ff 
+  804c4e:	48 01 d8             	add    %rbx,%rax
+  804c51:	ff d0                	call   *%rax
+  804c53:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c56:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c5a:	0f 88 12 02 00 00    	js     804e72 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804c60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c64:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c69:	48 89 c6             	mov    %rax,%rsi
+  804c6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c71:	49 89 df             	mov    %rbx,%r15
+  804c74:	48 b8 85 a0 ff ff ff 	movabs $0xffffffffffffa085,%rax
+  804c7b:	ff ff ff 
+  804c7e:	48 01 d8             	add    %rbx,%rax
+  804c81:	ff d0                	call   *%rax
+  804c83:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c86:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c8a:	0f 88 e2 01 00 00    	js     804e72 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  804c90:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804c94:	48 89 c7             	mov    %rax,%rdi
+  804c97:	49 89 df             	mov    %rbx,%r15
+  804c9a:	48 b8 a8 a8 ff ff ff 	movabs $0xffffffffffffa8a8,%rax
+  804ca1:	ff ff ff 
+  804ca4:	48 01 d8             	add    %rbx,%rax
+  804ca7:	ff d0                	call   *%rax
+  804ca9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cac:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cb0:	0f 88 9b 01 00 00    	js     804e51 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804cb6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804cba:	ba 07 04 00 00       	mov    $0x407,%edx
+  804cbf:	48 89 c6             	mov    %rax,%rsi
+  804cc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cc7:	49 89 df             	mov    %rbx,%r15
+  804cca:	48 b8 85 a0 ff ff ff 	movabs $0xffffffffffffa085,%rax
+  804cd1:	ff ff ff 
+  804cd4:	48 01 d8             	add    %rbx,%rax
+  804cd7:	ff d0                	call   *%rax
+  804cd9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cdc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ce0:	0f 88 6b 01 00 00    	js     804e51 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  804ce6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cea:	48 89 c7             	mov    %rax,%rdi
+  804ced:	49 89 df             	mov    %rbx,%r15
+  804cf0:	48 b8 65 a8 ff ff ff 	movabs $0xffffffffffffa865,%rax
+  804cf7:	ff ff ff 
+  804cfa:	48 01 d8             	add    %rbx,%rax
+  804cfd:	ff d0                	call   *%rax
+  804cff:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804d03:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d07:	ba 07 04 00 00       	mov    $0x407,%edx
+  804d0c:	48 89 c6             	mov    %rax,%rsi
+  804d0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d14:	49 89 df             	mov    %rbx,%r15
+  804d17:	48 b8 85 a0 ff ff ff 	movabs $0xffffffffffffa085,%rax
+  804d1e:	ff ff ff 
+  804d21:	48 01 d8             	add    %rbx,%rax
+  804d24:	ff d0                	call   *%rax
+  804d26:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d29:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d2d:	0f 88 fd 00 00 00    	js     804e30 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804d33:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d37:	48 89 c7             	mov    %rax,%rdi
+  804d3a:	49 89 df             	mov    %rbx,%r15
+  804d3d:	48 b8 65 a8 ff ff ff 	movabs $0xffffffffffffa865,%rax
+  804d44:	ff ff ff 
+  804d47:	48 01 d8             	add    %rbx,%rax
+  804d4a:	ff d0                	call   *%rax
+  804d4c:	48 89 c2             	mov    %rax,%rdx
+  804d4f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d53:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804d59:	48 89 d1             	mov    %rdx,%rcx
+  804d5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d61:	48 89 c6             	mov    %rax,%rsi
+  804d64:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d69:	49 89 df             	mov    %rbx,%r15
+  804d6c:	48 b8 ea a0 ff ff ff 	movabs $0xffffffffffffa0ea,%rax
+  804d73:	ff ff ff 
+  804d76:	48 01 d8             	add    %rbx,%rax
+  804d79:	ff d0                	call   *%rax
+  804d7b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d7e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d82:	0f 88 87 00 00 00    	js     804e0f <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  804d88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d8c:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804d93:	00 00 00 
+  804d96:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804d99:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  804d9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d9f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  804da6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804daa:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804db1:	00 00 00 
+  804db4:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804db7:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  804db9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804dbd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  804dc4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804dc8:	48 89 c7             	mov    %rax,%rdi
+  804dcb:	49 89 df             	mov    %rbx,%r15
+  804dce:	48 b8 2e a8 ff ff ff 	movabs $0xffffffffffffa82e,%rax
+  804dd5:	ff ff ff 
+  804dd8:	48 01 d8             	add    %rbx,%rax
+  804ddb:	ff d0                	call   *%rax
+  804ddd:	89 c2                	mov    %eax,%edx
+  804ddf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804de3:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  804de5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804de9:	48 89 c7             	mov    %rax,%rdi
+  804dec:	49 89 df             	mov    %rbx,%r15
+  804def:	48 b8 2e a8 ff ff ff 	movabs $0xffffffffffffa82e,%rax
+  804df6:	ff ff ff 
+  804df9:	48 01 d8             	add    %rbx,%rax
+  804dfc:	ff d0                	call   *%rax
+  804dfe:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804e02:	48 83 c2 04          	add    $0x4,%rdx
+  804e06:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  804e08:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e0d:	eb 67                	jmp    804e76 <pipe+0x25f>
+		goto err3;
+  804e0f:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  804e10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e14:	48 89 c6             	mov    %rax,%rsi
+  804e17:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e1c:	49 89 df             	mov    %rbx,%r15
+  804e1f:	48 b8 5d a1 ff ff ff 	movabs $0xffffffffffffa15d,%rax
+  804e26:	ff ff ff 
+  804e29:	48 01 d8             	add    %rbx,%rax
+  804e2c:	ff d0                	call   *%rax
+  804e2e:	eb 01                	jmp    804e31 <pipe+0x21a>
+		goto err2;
+  804e30:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  804e31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e35:	48 89 c6             	mov    %rax,%rsi
+  804e38:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e3d:	49 89 df             	mov    %rbx,%r15
+  804e40:	48 b8 5d a1 ff ff ff 	movabs $0xffffffffffffa15d,%rax
+  804e47:	ff ff ff 
+  804e4a:	48 01 d8             	add    %rbx,%rax
+  804e4d:	ff d0                	call   *%rax
+  804e4f:	eb 01                	jmp    804e52 <pipe+0x23b>
+		goto err1;
+  804e51:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  804e52:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e56:	48 89 c6             	mov    %rax,%rsi
+  804e59:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e5e:	49 89 df             	mov    %rbx,%r15
+  804e61:	48 b8 5d a1 ff ff ff 	movabs $0xffffffffffffa15d,%rax
+  804e68:	ff ff ff 
+  804e6b:	48 01 d8             	add    %rbx,%rax
+  804e6e:	ff d0                	call   *%rax
+  804e70:	eb 01                	jmp    804e73 <pipe+0x25c>
+		goto err;
+  804e72:	90                   	nop
+err:
+	return r;
+  804e73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804e76:	48 83 c4 30          	add    $0x30,%rsp
+  804e7a:	5b                   	pop    %rbx
+  804e7b:	41 5f                	pop    %r15
+  804e7d:	5d                   	pop    %rbp
+  804e7e:	c3                   	ret
+
+0000000000804e7f <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  804e7f:	55                   	push   %rbp
+  804e80:	48 89 e5             	mov    %rsp,%rbp
+  804e83:	41 57                	push   %r15
+  804e85:	41 54                	push   %r12
+  804e87:	53                   	push   %rbx
+  804e88:	48 83 ec 28          	sub    $0x28,%rsp
+  804e8c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e8c <_pipeisclosed+0xd>
+  804e93:	49 bb a4 31 00 00 00 	movabs $0x31a4,%r11
+  804e9a:	00 00 00 
+  804e9d:	4c 01 db             	add    %r11,%rbx
+  804ea0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804ea4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804ea8:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804eaf:	ff ff ff 
+  804eb2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804eb6:	48 8b 00             	mov    (%rax),%rax
+  804eb9:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804ebf:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  804ec2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ec6:	48 89 c7             	mov    %rax,%rdi
+  804ec9:	49 89 df             	mov    %rbx,%r15
+  804ecc:	48 b8 03 df ff ff ff 	movabs $0xffffffffffffdf03,%rax
+  804ed3:	ff ff ff 
+  804ed6:	48 01 d8             	add    %rbx,%rax
+  804ed9:	ff d0                	call   *%rax
+  804edb:	41 89 c4             	mov    %eax,%r12d
+  804ede:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ee2:	48 89 c7             	mov    %rax,%rdi
+  804ee5:	49 89 df             	mov    %rbx,%r15
+  804ee8:	48 b8 03 df ff ff ff 	movabs $0xffffffffffffdf03,%rax
+  804eef:	ff ff ff 
+  804ef2:	48 01 d8             	add    %rbx,%rax
+  804ef5:	ff d0                	call   *%rax
+  804ef7:	41 39 c4             	cmp    %eax,%r12d
+  804efa:	0f 94 c0             	sete   %al
+  804efd:	0f b6 c0             	movzbl %al,%eax
+  804f00:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  804f03:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804f0a:	ff ff ff 
+  804f0d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804f11:	48 8b 00             	mov    (%rax),%rax
+  804f14:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804f1a:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  804f1d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f20:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804f23:	75 05                	jne    804f2a <_pipeisclosed+0xab>
+			return ret;
+  804f25:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804f28:	eb 63                	jmp    804f8d <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  804f2a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f2d:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804f30:	0f 84 72 ff ff ff    	je     804ea8 <_pipeisclosed+0x29>
+  804f36:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  804f3a:	0f 85 68 ff ff ff    	jne    804ea8 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  804f40:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804f47:	ff ff ff 
+  804f4a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804f4e:	48 8b 00             	mov    (%rax),%rax
+  804f51:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  804f57:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804f5a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f5d:	89 c6                	mov    %eax,%esi
+  804f5f:	48 b8 96 e5 ff ff ff 	movabs $0xffffffffffffe596,%rax
+  804f66:	ff ff ff 
+  804f69:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f6d:	48 89 c7             	mov    %rax,%rdi
+  804f70:	49 89 df             	mov    %rbx,%r15
+  804f73:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f78:	49 b8 07 86 ff ff ff 	movabs $0xffffffffffff8607,%r8
+  804f7f:	ff ff ff 
+  804f82:	49 01 d8             	add    %rbx,%r8
+  804f85:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  804f88:	e9 1b ff ff ff       	jmp    804ea8 <_pipeisclosed+0x29>
+	}
+}
+  804f8d:	48 83 c4 28          	add    $0x28,%rsp
+  804f91:	5b                   	pop    %rbx
+  804f92:	41 5c                	pop    %r12
+  804f94:	41 5f                	pop    %r15
+  804f96:	5d                   	pop    %rbp
+  804f97:	c3                   	ret
+
+0000000000804f98 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  804f98:	55                   	push   %rbp
+  804f99:	48 89 e5             	mov    %rsp,%rbp
+  804f9c:	41 57                	push   %r15
+  804f9e:	53                   	push   %rbx
+  804f9f:	48 83 ec 30          	sub    $0x30,%rsp
+  804fa3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804fa3 <pipeisclosed+0xb>
+  804faa:	49 bb 8d 30 00 00 00 	movabs $0x308d,%r11
+  804fb1:	00 00 00 
+  804fb4:	4c 01 db             	add    %r11,%rbx
+  804fb7:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804fba:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804fbe:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804fc1:	48 89 d6             	mov    %rdx,%rsi
+  804fc4:	89 c7                	mov    %eax,%edi
+  804fc6:	49 89 df             	mov    %rbx,%r15
+  804fc9:	48 b8 5e a9 ff ff ff 	movabs $0xffffffffffffa95e,%rax
+  804fd0:	ff ff ff 
+  804fd3:	48 01 d8             	add    %rbx,%rax
+  804fd6:	ff d0                	call   *%rax
+  804fd8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804fdb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804fdf:	79 05                	jns    804fe6 <pipeisclosed+0x4e>
+		return r;
+  804fe1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fe4:	eb 3b                	jmp    805021 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  804fe6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fea:	48 89 c7             	mov    %rax,%rdi
+  804fed:	49 89 df             	mov    %rbx,%r15
+  804ff0:	48 b8 65 a8 ff ff ff 	movabs $0xffffffffffffa865,%rax
+  804ff7:	ff ff ff 
+  804ffa:	48 01 d8             	add    %rbx,%rax
+  804ffd:	ff d0                	call   *%rax
+  804fff:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805003:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805007:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80500b:	48 89 d6             	mov    %rdx,%rsi
+  80500e:	48 89 c7             	mov    %rax,%rdi
+  805011:	48 b8 4f ce ff ff ff 	movabs $0xffffffffffffce4f,%rax
+  805018:	ff ff ff 
+  80501b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80501f:	ff d0                	call   *%rax
+}
+  805021:	48 83 c4 30          	add    $0x30,%rsp
+  805025:	5b                   	pop    %rbx
+  805026:	41 5f                	pop    %r15
+  805028:	5d                   	pop    %rbp
+  805029:	c3                   	ret
+
+000000000080502a <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80502a:	55                   	push   %rbp
+  80502b:	48 89 e5             	mov    %rsp,%rbp
+  80502e:	41 57                	push   %r15
+  805030:	53                   	push   %rbx
+  805031:	48 83 ec 40          	sub    $0x40,%rsp
+  805035:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805035 <devpipe_read+0xb>
+  80503c:	49 bb fb 2f 00 00 00 	movabs $0x2ffb,%r11
+  805043:	00 00 00 
+  805046:	4c 01 db             	add    %r11,%rbx
+  805049:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80504d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805051:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805055:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805059:	48 89 c7             	mov    %rax,%rdi
+  80505c:	49 89 df             	mov    %rbx,%r15
+  80505f:	48 b8 65 a8 ff ff ff 	movabs $0xffffffffffffa865,%rax
+  805066:	ff ff ff 
+  805069:	48 01 d8             	add    %rbx,%rax
+  80506c:	ff d0                	call   *%rax
+  80506e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805072:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805076:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80507a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805081:	00 
+  805082:	e9 a1 00 00 00       	jmp    805128 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805087:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80508c:	74 09                	je     805097 <devpipe_read+0x6d>
+				return i;
+  80508e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805092:	e9 9f 00 00 00       	jmp    805136 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805097:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80509b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80509f:	48 89 d6             	mov    %rdx,%rsi
+  8050a2:	48 89 c7             	mov    %rax,%rdi
+  8050a5:	48 b8 4f ce ff ff ff 	movabs $0xffffffffffffce4f,%rax
+  8050ac:	ff ff ff 
+  8050af:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050b3:	ff d0                	call   *%rax
+  8050b5:	85 c0                	test   %eax,%eax
+  8050b7:	74 07                	je     8050c0 <devpipe_read+0x96>
+				return 0;
+  8050b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050be:	eb 76                	jmp    805136 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8050c0:	49 89 df             	mov    %rbx,%r15
+  8050c3:	48 b8 30 a0 ff ff ff 	movabs $0xffffffffffffa030,%rax
+  8050ca:	ff ff ff 
+  8050cd:	48 01 d8             	add    %rbx,%rax
+  8050d0:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8050d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050d6:	8b 10                	mov    (%rax),%edx
+  8050d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050dc:	8b 40 04             	mov    0x4(%rax),%eax
+  8050df:	39 c2                	cmp    %eax,%edx
+  8050e1:	74 a4                	je     805087 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8050e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050e7:	8b 10                	mov    (%rax),%edx
+  8050e9:	89 d0                	mov    %edx,%eax
+  8050eb:	c1 f8 1f             	sar    $0x1f,%eax
+  8050ee:	c1 e8 1b             	shr    $0x1b,%eax
+  8050f1:	01 c2                	add    %eax,%edx
+  8050f3:	83 e2 1f             	and    $0x1f,%edx
+  8050f6:	29 c2                	sub    %eax,%edx
+  8050f8:	89 d6                	mov    %edx,%esi
+  8050fa:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8050fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805102:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805106:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80510a:	48 63 c6             	movslq %esi,%rax
+  80510d:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805112:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805114:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805118:	8b 00                	mov    (%rax),%eax
+  80511a:	8d 50 01             	lea    0x1(%rax),%edx
+  80511d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805121:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805123:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805128:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80512c:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805130:	72 a0                	jb     8050d2 <devpipe_read+0xa8>
+	}
+	return i;
+  805132:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805136:	48 83 c4 40          	add    $0x40,%rsp
+  80513a:	5b                   	pop    %rbx
+  80513b:	41 5f                	pop    %r15
+  80513d:	5d                   	pop    %rbp
+  80513e:	c3                   	ret
+
+000000000080513f <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80513f:	55                   	push   %rbp
+  805140:	48 89 e5             	mov    %rsp,%rbp
+  805143:	41 57                	push   %r15
+  805145:	53                   	push   %rbx
+  805146:	48 83 ec 40          	sub    $0x40,%rsp
+  80514a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80514a <devpipe_write+0xb>
+  805151:	49 bb e6 2e 00 00 00 	movabs $0x2ee6,%r11
+  805158:	00 00 00 
+  80515b:	4c 01 db             	add    %r11,%rbx
+  80515e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805162:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805166:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  80516a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80516e:	48 89 c7             	mov    %rax,%rdi
+  805171:	49 89 df             	mov    %rbx,%r15
+  805174:	48 b8 65 a8 ff ff ff 	movabs $0xffffffffffffa865,%rax
+  80517b:	ff ff ff 
+  80517e:	48 01 d8             	add    %rbx,%rax
+  805181:	ff d0                	call   *%rax
+  805183:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805187:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80518b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80518f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805196:	00 
+  805197:	e9 a0 00 00 00       	jmp    80523c <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  80519c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8051a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051a4:	48 89 d6             	mov    %rdx,%rsi
+  8051a7:	48 89 c7             	mov    %rax,%rdi
+  8051aa:	48 b8 4f ce ff ff ff 	movabs $0xffffffffffffce4f,%rax
+  8051b1:	ff ff ff 
+  8051b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051b8:	ff d0                	call   *%rax
+  8051ba:	85 c0                	test   %eax,%eax
+  8051bc:	74 0a                	je     8051c8 <devpipe_write+0x89>
+				return 0;
+  8051be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051c3:	e9 82 00 00 00       	jmp    80524a <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8051c8:	49 89 df             	mov    %rbx,%r15
+  8051cb:	48 b8 30 a0 ff ff ff 	movabs $0xffffffffffffa030,%rax
+  8051d2:	ff ff ff 
+  8051d5:	48 01 d8             	add    %rbx,%rax
+  8051d8:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8051da:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051de:	8b 40 04             	mov    0x4(%rax),%eax
+  8051e1:	48 63 d0             	movslq %eax,%rdx
+  8051e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051e8:	8b 00                	mov    (%rax),%eax
+  8051ea:	48 98                	cltq
+  8051ec:	48 83 c0 20          	add    $0x20,%rax
+  8051f0:	48 39 c2             	cmp    %rax,%rdx
+  8051f3:	73 a7                	jae    80519c <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8051f5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8051f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051fd:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805201:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805205:	8b 50 04             	mov    0x4(%rax),%edx
+  805208:	89 d0                	mov    %edx,%eax
+  80520a:	c1 f8 1f             	sar    $0x1f,%eax
+  80520d:	c1 e8 1b             	shr    $0x1b,%eax
+  805210:	01 c2                	add    %eax,%edx
+  805212:	83 e2 1f             	and    $0x1f,%edx
+  805215:	29 c2                	sub    %eax,%edx
+  805217:	89 d0                	mov    %edx,%eax
+  805219:	0f b6 09             	movzbl (%rcx),%ecx
+  80521c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805220:	48 98                	cltq
+  805222:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805226:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80522a:	8b 40 04             	mov    0x4(%rax),%eax
+  80522d:	8d 50 01             	lea    0x1(%rax),%edx
+  805230:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805234:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805237:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80523c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805240:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805244:	72 94                	jb     8051da <devpipe_write+0x9b>
+	}
+
+	return i;
+  805246:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80524a:	48 83 c4 40          	add    $0x40,%rsp
+  80524e:	5b                   	pop    %rbx
+  80524f:	41 5f                	pop    %r15
+  805251:	5d                   	pop    %rbp
+  805252:	c3                   	ret
+
+0000000000805253 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805253:	55                   	push   %rbp
+  805254:	48 89 e5             	mov    %rsp,%rbp
+  805257:	41 57                	push   %r15
+  805259:	53                   	push   %rbx
+  80525a:	48 83 ec 20          	sub    $0x20,%rsp
+  80525e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80525e <devpipe_stat+0xb>
+  805265:	49 bb d2 2d 00 00 00 	movabs $0x2dd2,%r11
+  80526c:	00 00 00 
+  80526f:	4c 01 db             	add    %r11,%rbx
+  805272:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805276:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80527a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80527e:	48 89 c7             	mov    %rax,%rdi
+  805281:	49 89 df             	mov    %rbx,%r15
+  805284:	48 b8 65 a8 ff ff ff 	movabs $0xffffffffffffa865,%rax
+  80528b:	ff ff ff 
+  80528e:	48 01 d8             	add    %rbx,%rax
+  805291:	ff d0                	call   *%rax
+  805293:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805297:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80529b:	48 ba a9 e5 ff ff ff 	movabs $0xffffffffffffe5a9,%rdx
+  8052a2:	ff ff ff 
+  8052a5:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8052a9:	48 89 d6             	mov    %rdx,%rsi
+  8052ac:	48 89 c7             	mov    %rax,%rdi
+  8052af:	49 89 df             	mov    %rbx,%r15
+  8052b2:	48 b8 c9 93 ff ff ff 	movabs $0xffffffffffff93c9,%rax
+  8052b9:	ff ff ff 
+  8052bc:	48 01 d8             	add    %rbx,%rax
+  8052bf:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8052c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052c5:	8b 50 04             	mov    0x4(%rax),%edx
+  8052c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052cc:	8b 00                	mov    (%rax),%eax
+  8052ce:	29 c2                	sub    %eax,%edx
+  8052d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8052d4:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8052da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8052de:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8052e5:	00 00 00 
+	stat->st_dev = &devpipe;
+  8052e8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8052ec:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  8052f3:	00 00 00 
+  8052f6:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8052fa:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805301:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805306:	48 83 c4 20          	add    $0x20,%rsp
+  80530a:	5b                   	pop    %rbx
+  80530b:	41 5f                	pop    %r15
+  80530d:	5d                   	pop    %rbp
+  80530e:	c3                   	ret
+
+000000000080530f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80530f:	55                   	push   %rbp
+  805310:	48 89 e5             	mov    %rsp,%rbp
+  805313:	41 57                	push   %r15
+  805315:	53                   	push   %rbx
+  805316:	48 83 ec 10          	sub    $0x10,%rsp
+  80531a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80531a <devpipe_close+0xb>
+  805321:	49 bb 16 2d 00 00 00 	movabs $0x2d16,%r11
+  805328:	00 00 00 
+  80532b:	4c 01 db             	add    %r11,%rbx
+  80532e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805332:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805336:	48 89 c6             	mov    %rax,%rsi
+  805339:	bf 00 00 00 00       	mov    $0x0,%edi
+  80533e:	49 89 df             	mov    %rbx,%r15
+  805341:	48 b8 5d a1 ff ff ff 	movabs $0xffffffffffffa15d,%rax
+  805348:	ff ff ff 
+  80534b:	48 01 d8             	add    %rbx,%rax
+  80534e:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  805350:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805354:	48 89 c7             	mov    %rax,%rdi
+  805357:	49 89 df             	mov    %rbx,%r15
+  80535a:	48 b8 65 a8 ff ff ff 	movabs $0xffffffffffffa865,%rax
+  805361:	ff ff ff 
+  805364:	48 01 d8             	add    %rbx,%rax
+  805367:	ff d0                	call   *%rax
+  805369:	48 89 c6             	mov    %rax,%rsi
+  80536c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805371:	49 89 df             	mov    %rbx,%r15
+  805374:	48 b8 5d a1 ff ff ff 	movabs $0xffffffffffffa15d,%rax
+  80537b:	ff ff ff 
+  80537e:	48 01 d8             	add    %rbx,%rax
+  805381:	ff d0                	call   *%rax
+}
+  805383:	48 83 c4 10          	add    $0x10,%rsp
+  805387:	5b                   	pop    %rbx
+  805388:	41 5f                	pop    %r15
+  80538a:	5d                   	pop    %rbp
+  80538b:	c3                   	ret
+
+000000000080538c <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80538c:	55                   	push   %rbp
+  80538d:	48 89 e5             	mov    %rsp,%rbp
+  805390:	41 57                	push   %r15
+  805392:	48 83 ec 28          	sub    $0x28,%rsp
+  805396:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805396 <cputchar+0xa>
+  80539d:	49 bb 9a 2c 00 00 00 	movabs $0x2c9a,%r11
+  8053a4:	00 00 00 
+  8053a7:	4c 01 d8             	add    %r11,%rax
+  8053aa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8053ad:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8053b0:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8053b3:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8053b7:	be 01 00 00 00       	mov    $0x1,%esi
+  8053bc:	48 89 d7             	mov    %rdx,%rdi
+  8053bf:	49 89 c7             	mov    %rax,%r15
+  8053c2:	48 ba cd 9e ff ff ff 	movabs $0xffffffffffff9ecd,%rdx
+  8053c9:	ff ff ff 
+  8053cc:	48 01 c2             	add    %rax,%rdx
+  8053cf:	ff d2                	call   *%rdx
+}
+  8053d1:	90                   	nop
+  8053d2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8053d6:	c9                   	leave
+  8053d7:	c3                   	ret
+
+00000000008053d8 <getchar>:
+
+int
+getchar(void)
+{
+  8053d8:	55                   	push   %rbp
+  8053d9:	48 89 e5             	mov    %rsp,%rbp
+  8053dc:	41 57                	push   %r15
+  8053de:	48 83 ec 18          	sub    $0x18,%rsp
+  8053e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8053e2 <getchar+0xa>
+  8053e9:	49 bb 4e 2c 00 00 00 	movabs $0x2c4e,%r11
+  8053f0:	00 00 00 
+  8053f3:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8053f6:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8053fa:	ba 01 00 00 00       	mov    $0x1,%edx
+  8053ff:	48 89 ce             	mov    %rcx,%rsi
+  805402:	bf 00 00 00 00       	mov    $0x0,%edi
+  805407:	49 89 c7             	mov    %rax,%r15
+  80540a:	48 b9 a5 ae ff ff ff 	movabs $0xffffffffffffaea5,%rcx
+  805411:	ff ff ff 
+  805414:	48 01 c1             	add    %rax,%rcx
+  805417:	ff d1                	call   *%rcx
+  805419:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80541c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805420:	79 05                	jns    805427 <getchar+0x4f>
+		return r;
+  805422:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805425:	eb 14                	jmp    80543b <getchar+0x63>
+	if (r < 1)
+  805427:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80542b:	7f 07                	jg     805434 <getchar+0x5c>
+		return -E_EOF;
+  80542d:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  805432:	eb 07                	jmp    80543b <getchar+0x63>
+	return c;
+  805434:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  805438:	0f b6 c0             	movzbl %al,%eax
+}
+  80543b:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80543f:	c9                   	leave
+  805440:	c3                   	ret
+
+0000000000805441 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  805441:	55                   	push   %rbp
+  805442:	48 89 e5             	mov    %rsp,%rbp
+  805445:	41 57                	push   %r15
+  805447:	53                   	push   %rbx
+  805448:	48 83 ec 20          	sub    $0x20,%rsp
+  80544c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80544c <iscons+0xb>
+  805453:	49 bb e4 2b 00 00 00 	movabs $0x2be4,%r11
+  80545a:	00 00 00 
+  80545d:	4c 01 db             	add    %r11,%rbx
+  805460:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805463:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805467:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80546a:	48 89 d6             	mov    %rdx,%rsi
+  80546d:	89 c7                	mov    %eax,%edi
+  80546f:	49 89 df             	mov    %rbx,%r15
+  805472:	48 b8 5e a9 ff ff ff 	movabs $0xffffffffffffa95e,%rax
+  805479:	ff ff ff 
+  80547c:	48 01 d8             	add    %rbx,%rax
+  80547f:	ff d0                	call   *%rax
+  805481:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805484:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805488:	79 05                	jns    80548f <iscons+0x4e>
+		return r;
+  80548a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80548d:	eb 1b                	jmp    8054aa <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  80548f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805493:	8b 10                	mov    (%rax),%edx
+  805495:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  80549c:	00 00 00 
+  80549f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8054a2:	39 c2                	cmp    %eax,%edx
+  8054a4:	0f 94 c0             	sete   %al
+  8054a7:	0f b6 c0             	movzbl %al,%eax
+}
+  8054aa:	48 83 c4 20          	add    $0x20,%rsp
+  8054ae:	5b                   	pop    %rbx
+  8054af:	41 5f                	pop    %r15
+  8054b1:	5d                   	pop    %rbp
+  8054b2:	c3                   	ret
+
+00000000008054b3 <opencons>:
+
+int
+opencons(void)
+{
+  8054b3:	55                   	push   %rbp
+  8054b4:	48 89 e5             	mov    %rsp,%rbp
+  8054b7:	41 57                	push   %r15
+  8054b9:	53                   	push   %rbx
+  8054ba:	48 83 ec 10          	sub    $0x10,%rsp
+  8054be:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054be <opencons+0xb>
+  8054c5:	49 bb 72 2b 00 00 00 	movabs $0x2b72,%r11
+  8054cc:	00 00 00 
+  8054cf:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8054d2:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8054d6:	48 89 c7             	mov    %rax,%rdi
+  8054d9:	49 89 df             	mov    %rbx,%r15
+  8054dc:	48 b8 a8 a8 ff ff ff 	movabs $0xffffffffffffa8a8,%rax
+  8054e3:	ff ff ff 
+  8054e6:	48 01 d8             	add    %rbx,%rax
+  8054e9:	ff d0                	call   *%rax
+  8054eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054f2:	79 05                	jns    8054f9 <opencons+0x46>
+		return r;
+  8054f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054f7:	eb 68                	jmp    805561 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8054f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054fd:	ba 07 04 00 00       	mov    $0x407,%edx
+  805502:	48 89 c6             	mov    %rax,%rsi
+  805505:	bf 00 00 00 00       	mov    $0x0,%edi
+  80550a:	49 89 df             	mov    %rbx,%r15
+  80550d:	48 b8 85 a0 ff ff ff 	movabs $0xffffffffffffa085,%rax
+  805514:	ff ff ff 
+  805517:	48 01 d8             	add    %rbx,%rax
+  80551a:	ff d0                	call   *%rax
+  80551c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80551f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805523:	79 05                	jns    80552a <opencons+0x77>
+		return r;
+  805525:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805528:	eb 37                	jmp    805561 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  80552a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80552e:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  805535:	00 00 00 
+  805538:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80553b:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  80553d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805541:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  805548:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80554c:	48 89 c7             	mov    %rax,%rdi
+  80554f:	49 89 df             	mov    %rbx,%r15
+  805552:	48 b8 2e a8 ff ff ff 	movabs $0xffffffffffffa82e,%rax
+  805559:	ff ff ff 
+  80555c:	48 01 d8             	add    %rbx,%rax
+  80555f:	ff d0                	call   *%rax
+}
+  805561:	48 83 c4 10          	add    $0x10,%rsp
+  805565:	5b                   	pop    %rbx
+  805566:	41 5f                	pop    %r15
+  805568:	5d                   	pop    %rbp
+  805569:	c3                   	ret
+
+000000000080556a <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80556a:	55                   	push   %rbp
+  80556b:	48 89 e5             	mov    %rsp,%rbp
+  80556e:	41 57                	push   %r15
+  805570:	53                   	push   %rbx
+  805571:	48 83 ec 30          	sub    $0x30,%rsp
+  805575:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805575 <devcons_read+0xb>
+  80557c:	49 bb bb 2a 00 00 00 	movabs $0x2abb,%r11
+  805583:	00 00 00 
+  805586:	4c 01 db             	add    %r11,%rbx
+  805589:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80558d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805591:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  805595:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80559a:	75 19                	jne    8055b5 <devcons_read+0x4b>
+		return 0;
+  80559c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055a1:	eb 55                	jmp    8055f8 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8055a3:	49 89 df             	mov    %rbx,%r15
+  8055a6:	48 b8 30 a0 ff ff ff 	movabs $0xffffffffffffa030,%rax
+  8055ad:	ff ff ff 
+  8055b0:	48 01 d8             	add    %rbx,%rax
+  8055b3:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8055b5:	49 89 df             	mov    %rbx,%r15
+  8055b8:	48 b8 2c 9f ff ff ff 	movabs $0xffffffffffff9f2c,%rax
+  8055bf:	ff ff ff 
+  8055c2:	48 01 d8             	add    %rbx,%rax
+  8055c5:	ff d0                	call   *%rax
+  8055c7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055ce:	74 d3                	je     8055a3 <devcons_read+0x39>
+	if (c < 0)
+  8055d0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055d4:	79 05                	jns    8055db <devcons_read+0x71>
+		return c;
+  8055d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055d9:	eb 1d                	jmp    8055f8 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8055db:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8055df:	75 07                	jne    8055e8 <devcons_read+0x7e>
+		return 0;
+  8055e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055e6:	eb 10                	jmp    8055f8 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  8055e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055eb:	89 c2                	mov    %eax,%edx
+  8055ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8055f1:	88 10                	mov    %dl,(%rax)
+	return 1;
+  8055f3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8055f8:	48 83 c4 30          	add    $0x30,%rsp
+  8055fc:	5b                   	pop    %rbx
+  8055fd:	41 5f                	pop    %r15
+  8055ff:	5d                   	pop    %rbp
+  805600:	c3                   	ret
+
+0000000000805601 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805601:	55                   	push   %rbp
+  805602:	48 89 e5             	mov    %rsp,%rbp
+  805605:	41 57                	push   %r15
+  805607:	53                   	push   %rbx
+  805608:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80560f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80560f <devcons_write+0xe>
+  805616:	49 bb 21 2a 00 00 00 	movabs $0x2a21,%r11
+  80561d:	00 00 00 
+  805620:	4c 01 db             	add    %r11,%rbx
+  805623:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  80562a:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  805631:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  805638:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80563f:	e9 80 00 00 00       	jmp    8056c4 <devcons_write+0xc3>
+		m = n - tot;
+  805644:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80564b:	89 c2                	mov    %eax,%edx
+  80564d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805650:	29 c2                	sub    %eax,%edx
+  805652:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  805655:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805658:	83 f8 7f             	cmp    $0x7f,%eax
+  80565b:	76 07                	jbe    805664 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  80565d:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  805664:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805667:	48 63 d0             	movslq %eax,%rdx
+  80566a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80566d:	48 63 c8             	movslq %eax,%rcx
+  805670:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  805677:	48 01 c1             	add    %rax,%rcx
+  80567a:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805681:	48 89 ce             	mov    %rcx,%rsi
+  805684:	48 89 c7             	mov    %rax,%rdi
+  805687:	49 89 df             	mov    %rbx,%r15
+  80568a:	48 b8 a9 97 ff ff ff 	movabs $0xffffffffffff97a9,%rax
+  805691:	ff ff ff 
+  805694:	48 01 d8             	add    %rbx,%rax
+  805697:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  805699:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80569c:	48 63 d0             	movslq %eax,%rdx
+  80569f:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8056a6:	48 89 d6             	mov    %rdx,%rsi
+  8056a9:	48 89 c7             	mov    %rax,%rdi
+  8056ac:	49 89 df             	mov    %rbx,%r15
+  8056af:	48 b8 cd 9e ff ff ff 	movabs $0xffffffffffff9ecd,%rax
+  8056b6:	ff ff ff 
+  8056b9:	48 01 d8             	add    %rbx,%rax
+  8056bc:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8056be:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8056c1:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8056c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056c7:	48 98                	cltq
+  8056c9:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8056d0:	0f 82 6e ff ff ff    	jb     805644 <devcons_write+0x43>
+	}
+	return tot;
+  8056d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8056d9:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8056e0:	5b                   	pop    %rbx
+  8056e1:	41 5f                	pop    %r15
+  8056e3:	5d                   	pop    %rbp
+  8056e4:	c3                   	ret
+
+00000000008056e5 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  8056e5:	55                   	push   %rbp
+  8056e6:	48 89 e5             	mov    %rsp,%rbp
+  8056e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8056ed:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8056ed <devcons_close+0x8>
+  8056f4:	49 bb 43 29 00 00 00 	movabs $0x2943,%r11
+  8056fb:	00 00 00 
+  8056fe:	4c 01 d8             	add    %r11,%rax
+  805701:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  805705:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80570a:	c9                   	leave
+  80570b:	c3                   	ret
+
+000000000080570c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80570c:	55                   	push   %rbp
+  80570d:	48 89 e5             	mov    %rsp,%rbp
+  805710:	41 57                	push   %r15
+  805712:	48 83 ec 18          	sub    $0x18,%rsp
+  805716:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805716 <devcons_stat+0xa>
+  80571d:	49 bb 1a 29 00 00 00 	movabs $0x291a,%r11
+  805724:	00 00 00 
+  805727:	4c 01 d8             	add    %r11,%rax
+  80572a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80572e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  805732:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805736:	48 b9 b5 e5 ff ff ff 	movabs $0xffffffffffffe5b5,%rcx
+  80573d:	ff ff ff 
+  805740:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805744:	48 89 ce             	mov    %rcx,%rsi
+  805747:	48 89 d7             	mov    %rdx,%rdi
+  80574a:	49 89 c7             	mov    %rax,%r15
+  80574d:	48 ba c9 93 ff ff ff 	movabs $0xffffffffffff93c9,%rdx
+  805754:	ff ff ff 
+  805757:	48 01 c2             	add    %rax,%rdx
+  80575a:	ff d2                	call   *%rdx
+	return 0;
+  80575c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805761:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805765:	c9                   	leave
+  805766:	c3                   	ret
+
+0000000000805767 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805767:	55                   	push   %rbp
+  805768:	48 89 e5             	mov    %rsp,%rbp
+  80576b:	41 57                	push   %r15
+  80576d:	53                   	push   %rbx
+  80576e:	48 83 ec 30          	sub    $0x30,%rsp
+  805772:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805772 <ipc_recv+0xb>
+  805779:	49 bb be 28 00 00 00 	movabs $0x28be,%r11
+  805780:	00 00 00 
+  805783:	4c 01 db             	add    %r11,%rbx
+  805786:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80578a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80578e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  805792:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805797:	75 0e                	jne    8057a7 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  805799:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8057a0:	00 00 00 
+  8057a3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8057a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057ab:	48 89 c7             	mov    %rax,%rdi
+  8057ae:	49 89 df             	mov    %rbx,%r15
+  8057b1:	48 b8 ae a3 ff ff ff 	movabs $0xffffffffffffa3ae,%rax
+  8057b8:	ff ff ff 
+  8057bb:	48 01 d8             	add    %rbx,%rax
+  8057be:	ff d0                	call   *%rax
+  8057c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8057c3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8057c8:	74 2a                	je     8057f4 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8057ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057ce:	75 19                	jne    8057e9 <ipc_recv+0x82>
+  8057d0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8057d7:	ff ff ff 
+  8057da:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8057de:	48 8b 00             	mov    (%rax),%rax
+  8057e1:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8057e7:	eb 05                	jmp    8057ee <ipc_recv+0x87>
+  8057e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057ee:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8057f2:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8057f4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8057f9:	74 2a                	je     805825 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  8057fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057ff:	75 19                	jne    80581a <ipc_recv+0xb3>
+  805801:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805808:	ff ff ff 
+  80580b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80580f:	48 8b 00             	mov    (%rax),%rax
+  805812:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805818:	eb 05                	jmp    80581f <ipc_recv+0xb8>
+  80581a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80581f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805823:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  805825:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805829:	74 05                	je     805830 <ipc_recv+0xc9>
+		return res;
+  80582b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80582e:	eb 17                	jmp    805847 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805830:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805837:	ff ff ff 
+  80583a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80583e:	48 8b 00             	mov    (%rax),%rax
+  805841:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805847:	48 83 c4 30          	add    $0x30,%rsp
+  80584b:	5b                   	pop    %rbx
+  80584c:	41 5f                	pop    %r15
+  80584e:	5d                   	pop    %rbp
+  80584f:	c3                   	ret
+
+0000000000805850 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805850:	55                   	push   %rbp
+  805851:	48 89 e5             	mov    %rsp,%rbp
+  805854:	41 57                	push   %r15
+  805856:	53                   	push   %rbx
+  805857:	48 83 ec 20          	sub    $0x20,%rsp
+  80585b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80585b <ipc_send+0xb>
+  805862:	49 bb d5 27 00 00 00 	movabs $0x27d5,%r11
+  805869:	00 00 00 
+  80586c:	4c 01 db             	add    %r11,%rbx
+  80586f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805872:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805875:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805879:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  80587c:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805881:	75 0e                	jne    805891 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  805883:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80588a:	00 00 00 
+  80588d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  805891:	90                   	nop
+  805892:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805895:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805898:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80589c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80589f:	89 c7                	mov    %eax,%edi
+  8058a1:	49 89 df             	mov    %rbx,%r15
+  8058a4:	48 b8 44 a3 ff ff ff 	movabs $0xffffffffffffa344,%rax
+  8058ab:	ff ff ff 
+  8058ae:	48 01 d8             	add    %rbx,%rax
+  8058b1:	ff d0                	call   *%rax
+  8058b3:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8058b6:	74 da                	je     805892 <ipc_send+0x42>
+		;
+}
+  8058b8:	90                   	nop
+  8058b9:	90                   	nop
+  8058ba:	48 83 c4 20          	add    $0x20,%rsp
+  8058be:	5b                   	pop    %rbx
+  8058bf:	41 5f                	pop    %r15
+  8058c1:	5d                   	pop    %rbp
+  8058c2:	c3                   	ret
+
+00000000008058c3 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8058c3:	55                   	push   %rbp
+  8058c4:	48 89 e5             	mov    %rsp,%rbp
+  8058c7:	41 57                	push   %r15
+  8058c9:	53                   	push   %rbx
+  8058ca:	48 83 ec 40          	sub    $0x40,%rsp
+  8058ce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058ce <ipc_call+0xb>
+  8058d5:	49 bb 62 27 00 00 00 	movabs $0x2762,%r11
+  8058dc:	00 00 00 
+  8058df:	4c 01 db             	add    %r11,%rbx
+  8058e2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8058e5:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8058e8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8058ec:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8058ef:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8058f3:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8058f7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8058fc:	75 0e                	jne    80590c <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  8058fe:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805905:	00 00 00 
+  805908:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80590c:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805911:	75 0e                	jne    805921 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805913:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80591a:	00 00 00 
+  80591d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805921:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805924:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805928:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80592b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80592f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805932:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805938:	49 89 f8             	mov    %rdi,%r8
+  80593b:	89 c7                	mov    %eax,%edi
+  80593d:	49 89 df             	mov    %rbx,%r15
+  805940:	48 b8 07 a4 ff ff ff 	movabs $0xffffffffffffa407,%rax
+  805947:	ff ff ff 
+  80594a:	48 01 d8             	add    %rbx,%rax
+  80594d:	ff d0                	call   *%rax
+  80594f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805952:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805957:	74 2a                	je     805983 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805959:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80595d:	75 19                	jne    805978 <ipc_call+0xb5>
+  80595f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805966:	ff ff ff 
+  805969:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80596d:	48 8b 00             	mov    (%rax),%rax
+  805970:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805976:	eb 05                	jmp    80597d <ipc_call+0xba>
+  805978:	b8 00 00 00 00       	mov    $0x0,%eax
+  80597d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805981:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805983:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805987:	74 05                	je     80598e <ipc_call+0xcb>
+		return r;
+  805989:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80598c:	eb 17                	jmp    8059a5 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  80598e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805995:	ff ff ff 
+  805998:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80599c:	48 8b 00             	mov    (%rax),%rax
+  80599f:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8059a5:	48 83 c4 40          	add    $0x40,%rsp
+  8059a9:	5b                   	pop    %rbx
+  8059aa:	41 5f                	pop    %r15
+  8059ac:	5d                   	pop    %rbp
+  8059ad:	c3                   	ret
+
+00000000008059ae <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8059ae:	55                   	push   %rbp
+  8059af:	48 89 e5             	mov    %rsp,%rbp
+  8059b2:	41 57                	push   %r15
+  8059b4:	53                   	push   %rbx
+  8059b5:	48 83 ec 70          	sub    $0x70,%rsp
+  8059b9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059b9 <ipc_callw+0xb>
+  8059c0:	49 bb 77 26 00 00 00 	movabs $0x2677,%r11
+  8059c7:	00 00 00 
+  8059ca:	4c 01 db             	add    %r11,%rbx
+  8059cd:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8059d0:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8059d3:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  8059d7:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  8059db:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  8059e0:	76 0a                	jbe    8059ec <ipc_callw+0x3e>
+		return -E_INVAL;
+  8059e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8059e7:	e9 b7 00 00 00       	jmp    805aa3 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  8059ec:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8059f0:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8059f4:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8059f8:	48 89 ce             	mov    %rcx,%rsi
+  8059fb:	48 89 c7             	mov    %rax,%rdi
+  8059fe:	49 89 df             	mov    %rbx,%r15
+  805a01:	48 b8 a9 97 ff ff ff 	movabs $0xffffffffffff97a9,%rax
+  805a08:	ff ff ff 
+  805a0b:	48 01 d8             	add    %rbx,%rax
+  805a0e:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805a10:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805a17:	00 
+  805a18:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805a1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a20:	48 01 d0             	add    %rdx,%rax
+  805a23:	48 83 e8 01          	sub    $0x1,%rax
+  805a27:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805a2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a34:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805a38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a3c:	48 29 d0             	sub    %rdx,%rax
+  805a3f:	48 c1 e8 03          	shr    $0x3,%rax
+  805a43:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805a47:	89 c1                	mov    %eax,%ecx
+  805a49:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805a4c:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805a50:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805a53:	49 89 d1             	mov    %rdx,%r9
+  805a56:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805a5d:	00 00 00 
+  805a60:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  805a67:	00 00 00 
+  805a6a:	89 c7                	mov    %eax,%edi
+  805a6c:	49 89 df             	mov    %rbx,%r15
+  805a6f:	48 b8 07 a4 ff ff ff 	movabs $0xffffffffffffa407,%rax
+  805a76:	ff ff ff 
+  805a79:	48 01 d8             	add    %rbx,%rax
+  805a7c:	ff d0                	call   *%rax
+  805a7e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805a81:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805a85:	74 05                	je     805a8c <ipc_callw+0xde>
+		return r;
+  805a87:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a8a:	eb 17                	jmp    805aa3 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805a8c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a93:	ff ff ff 
+  805a96:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a9a:	48 8b 00             	mov    (%rax),%rax
+  805a9d:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805aa3:	48 83 c4 70          	add    $0x70,%rsp
+  805aa7:	5b                   	pop    %rbx
+  805aa8:	41 5f                	pop    %r15
+  805aaa:	5d                   	pop    %rbp
+  805aab:	c3                   	ret
+
+0000000000805aac <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805aac:	55                   	push   %rbp
+  805aad:	48 89 e5             	mov    %rsp,%rbp
+  805ab0:	41 57                	push   %r15
+  805ab2:	53                   	push   %rbx
+  805ab3:	48 83 ec 40          	sub    $0x40,%rsp
+  805ab7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ab7 <ipc_callv+0xb>
+  805abe:	49 bb 79 25 00 00 00 	movabs $0x2579,%r11
+  805ac5:	00 00 00 
+  805ac8:	4c 01 db             	add    %r11,%rbx
+  805acb:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805ace:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805ad1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805ad5:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805ad8:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805adc:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805ae0:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805ae7:	00 00 00 
+  805aea:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805aee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805af2:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805af6:	74 11                	je     805b09 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805af8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805afc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805b00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805b03:	c1 e0 14             	shl    $0x14,%eax
+  805b06:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805b09:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805b0d:	74 14                	je     805b23 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805b0f:	8b 45 20             	mov    0x20(%rbp),%eax
+  805b12:	83 e8 01             	sub    $0x1,%eax
+  805b15:	48 63 d0             	movslq %eax,%rdx
+  805b18:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805b1c:	48 09 d0             	or     %rdx,%rax
+  805b1f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805b23:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805b26:	c1 e0 10             	shl    $0x10,%eax
+  805b29:	0b 45 10             	or     0x10(%rbp),%eax
+  805b2c:	89 c1                	mov    %eax,%ecx
+  805b2e:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805b31:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805b35:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805b39:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805b3d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805b40:	4d 89 c1             	mov    %r8,%r9
+  805b43:	49 89 f8             	mov    %rdi,%r8
+  805b46:	89 c7                	mov    %eax,%edi
+  805b48:	49 89 df             	mov    %rbx,%r15
+  805b4b:	48 b8 07 a4 ff ff ff 	movabs $0xffffffffffffa407,%rax
+  805b52:	ff ff ff 
+  805b55:	48 01 d8             	add    %rbx,%rax
+  805b58:	ff d0                	call   *%rax
+  805b5a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805b5d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805b61:	74 05                	je     805b68 <ipc_callv+0xbc>
+		return r;
+  805b63:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b66:	eb 17                	jmp    805b7f <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805b68:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b6f:	ff ff ff 
+  805b72:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b76:	48 8b 00             	mov    (%rax),%rax
+  805b79:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805b7f:	48 83 c4 40          	add    $0x40,%rsp
+  805b83:	5b                   	pop    %rbx
+  805b84:	41 5f                	pop    %r15
+  805b86:	5d                   	pop    %rbp
+  805b87:	c3                   	ret
+
+0000000000805b88 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805b88:	55                   	push   %rbp
+  805b89:	48 89 e5             	mov    %rsp,%rbp
+  805b8c:	41 57                	push   %r15
+  805b8e:	53                   	push   %rbx
+  805b8f:	48 83 ec 40          	sub    $0x40,%rsp
+  805b93:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b93 <ipc_reply_recv+0xb>
+  805b9a:	49 bb 9d 24 00 00 00 	movabs $0x249d,%r11
+  805ba1:	00 00 00 
+  805ba4:	4c 01 db             	add    %r11,%rbx
+  805ba7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805baa:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805bad:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805bb1:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805bb4:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805bb8:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805bbc:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805bc1:	75 0e                	jne    805bd1 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805bc3:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805bca:	00 00 00 
+  805bcd:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805bd1:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805bd6:	75 0e                	jne    805be6 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805bd8:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805bdf:	00 00 00 
+  805be2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805be6:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805be9:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805bed:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805bf1:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805bf4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805bf8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bfb:	4d 89 c1             	mov    %r8,%r9
+  805bfe:	49 89 f8             	mov    %rdi,%r8
+  805c01:	89 c7                	mov    %eax,%edi
+  805c03:	49 89 df             	mov    %rbx,%r15
+  805c06:	48 b8 7b a4 ff ff ff 	movabs $0xffffffffffffa47b,%rax
+  805c0d:	ff ff ff 
+  805c10:	48 01 d8             	add    %rbx,%rax
+  805c13:	ff d0                	call   *%rax
+  805c15:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805c18:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805c1d:	74 2a                	je     805c49 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805c1f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c23:	75 19                	jne    805c3e <ipc_reply_recv+0xb6>
+  805c25:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805c2c:	ff ff ff 
+  805c2f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c33:	48 8b 00             	mov    (%rax),%rax
+  805c36:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805c3c:	eb 05                	jmp    805c43 <ipc_reply_recv+0xbb>
+  805c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c43:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805c47:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805c49:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805c4e:	74 2a                	je     805c7a <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805c50:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c54:	75 19                	jne    805c6f <ipc_reply_recv+0xe7>
+  805c56:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805c5d:	ff ff ff 
+  805c60:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c64:	48 8b 00             	mov    (%rax),%rax
+  805c67:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805c6d:	eb 05                	jmp    805c74 <ipc_reply_recv+0xec>
+  805c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c74:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805c78:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805c7a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c7e:	74 05                	je     805c85 <ipc_reply_recv+0xfd>
+		return r;
+  805c80:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c83:	eb 17                	jmp    805c9c <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805c85:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805c8c:	ff ff ff 
+  805c8f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c93:	48 8b 00             	mov    (%rax),%rax
+  805c96:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805c9c:	48 83 c4 40          	add    $0x40,%rsp
+  805ca0:	5b                   	pop    %rbx
+  805ca1:	41 5f                	pop    %r15
+  805ca3:	5d                   	pop    %rbp
+  805ca4:	c3                   	ret
+
+0000000000805ca5 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805ca5:	55                   	push   %rbp
+  805ca6:	48 89 e5             	mov    %rsp,%rbp
+  805ca9:	41 57                	push   %r15
+  805cab:	53                   	push   %rbx
+  805cac:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805cb3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805cb3 <ipc_window_batch+0xe>
+  805cba:	49 bb 7d 23 00 00 00 	movabs $0x237d,%r11
+  805cc1:	00 00 00 
+  805cc4:	4c 01 db             	add    %r11,%rbx
+  805cc7:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805ccd:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805cd4:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805cda:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805ce0:	e9 15 01 00 00       	jmp    805dfa <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805ce5:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805ceb:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805cee:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805cf5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805cf8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805cfb:	39 c2                	cmp    %eax,%edx
+  805cfd:	0f 4e c2             	cmovle %edx,%eax
+  805d00:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805d03:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805d0a:	eb 6b                	jmp    805d77 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805d0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d0f:	48 98                	cltq
+  805d11:	48 c1 e0 05          	shl    $0x5,%rax
+  805d15:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805d19:	48 01 e8             	add    %rbp,%rax
+  805d1c:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805d22:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805d28:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d2b:	c1 e0 0c             	shl    $0xc,%eax
+  805d2e:	48 63 d0             	movslq %eax,%rdx
+  805d31:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805d38:	48 01 c2             	add    %rax,%rdx
+  805d3b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d3e:	48 98                	cltq
+  805d40:	48 c1 e0 05          	shl    $0x5,%rax
+  805d44:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805d48:	48 01 e8             	add    %rbp,%rax
+  805d4b:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805d51:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805d54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d57:	48 98                	cltq
+  805d59:	48 c1 e0 05          	shl    $0x5,%rax
+  805d5d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805d61:	48 01 e8             	add    %rbp,%rax
+  805d64:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805d6b:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805d71:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805d73:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805d77:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d7a:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805d7d:	7c 8d                	jl     805d0c <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805d7f:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805d86:	74 27                	je     805daf <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805d88:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805d8b:	48 63 d0             	movslq %eax,%rdx
+  805d8e:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805d95:	48 89 d6             	mov    %rdx,%rsi
+  805d98:	48 89 c7             	mov    %rax,%rdi
+  805d9b:	49 89 df             	mov    %rbx,%r15
+  805d9e:	48 b8 1e a7 ff ff ff 	movabs $0xffffffffffffa71e,%rax
+  805da5:	ff ff ff 
+  805da8:	48 01 d8             	add    %rbx,%rax
+  805dab:	ff d0                	call   *%rax
+  805dad:	eb 25                	jmp    805dd4 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805daf:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805db2:	48 63 d0             	movslq %eax,%rdx
+  805db5:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805dbc:	48 89 d6             	mov    %rdx,%rsi
+  805dbf:	48 89 c7             	mov    %rax,%rdi
+  805dc2:	49 89 df             	mov    %rbx,%r15
+  805dc5:	48 b8 7c a7 ff ff ff 	movabs $0xffffffffffffa77c,%rax
+  805dcc:	ff ff ff 
+  805dcf:	48 01 d8             	add    %rbx,%rax
+  805dd2:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805dd4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805dd7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805ddb:	79 05                	jns    805de2 <ipc_window_batch+0x13d>
+			return r;
+  805ddd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805de0:	eb 2a                	jmp    805e0c <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805de2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805de5:	c1 e0 0c             	shl    $0xc,%eax
+  805de8:	48 98                	cltq
+  805dea:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  805df1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805df4:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  805dfa:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  805e01:	0f 8f de fe ff ff    	jg     805ce5 <ipc_window_batch+0x40>
+	}
+	return 0;
+  805e07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e0c:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  805e13:	5b                   	pop    %rbx
+  805e14:	41 5f                	pop    %r15
+  805e16:	5d                   	pop    %rbp
+  805e17:	c3                   	ret
+
+0000000000805e18 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  805e18:	55                   	push   %rbp
+  805e19:	48 89 e5             	mov    %rsp,%rbp
+  805e1c:	48 83 ec 10          	sub    $0x10,%rsp
+  805e20:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805e20 <ipc_map_window+0x8>
+  805e27:	49 bb 10 22 00 00 00 	movabs $0x2210,%r11
+  805e2e:	00 00 00 
+  805e31:	4c 01 d8             	add    %r11,%rax
+  805e34:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805e38:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  805e3b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805e3e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805e42:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805e47:	bf 01 00 00 00       	mov    $0x1,%edi
+  805e4c:	49 b8 75 dc ff ff ff 	movabs $0xffffffffffffdc75,%r8
+  805e53:	ff ff ff 
+  805e56:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805e5a:	ff d0                	call   *%rax
+}
+  805e5c:	c9                   	leave
+  805e5d:	c3                   	ret
+
+0000000000805e5e <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  805e5e:	55                   	push   %rbp
+  805e5f:	48 89 e5             	mov    %rsp,%rbp
+  805e62:	48 83 ec 10          	sub    $0x10,%rsp
+  805e66:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805e66 <ipc_unmap_window+0x8>
+  805e6d:	49 bb ca 21 00 00 00 	movabs $0x21ca,%r11
+  805e74:	00 00 00 
+  805e77:	4c 01 d8             	add    %r11,%rax
+  805e7a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805e7e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  805e81:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805e84:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805e88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805e8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e92:	49 b8 75 dc ff ff ff 	movabs $0xffffffffffffdc75,%r8
+  805e99:	ff ff ff 
+  805e9c:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805ea0:	ff d0                	call   *%rax
+}
+  805ea2:	c9                   	leave
+  805ea3:	c3                   	ret
+
+0000000000805ea4 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805ea4:	55                   	push   %rbp
+  805ea5:	48 89 e5             	mov    %rsp,%rbp
+  805ea8:	48 83 ec 18          	sub    $0x18,%rsp
+  805eac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805eac <ipc_find_env+0x8>
+  805eb3:	49 bb 84 21 00 00 00 	movabs $0x2184,%r11
+  805eba:	00 00 00 
+  805ebd:	4c 01 d8             	add    %r11,%rax
+  805ec0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  805ec3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805eca:	eb 57                	jmp    805f23 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  805ecc:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805ed3:	ff ff ff 
+  805ed6:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  805eda:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805edd:	48 63 d2             	movslq %edx,%rdx
+  805ee0:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  805ee7:	48 01 ca             	add    %rcx,%rdx
+  805eea:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  805ef1:	8b 12                	mov    (%rdx),%edx
+  805ef3:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  805ef6:	75 27                	jne    805f1f <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  805ef8:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805eff:	ff ff ff 
+  805f02:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805f06:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f09:	48 98                	cltq
+  805f0b:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  805f12:	48 01 d0             	add    %rdx,%rax
+  805f15:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805f1b:	8b 00                	mov    (%rax),%eax
+  805f1d:	eb 12                	jmp    805f31 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  805f1f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805f23:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805f2a:	7e a0                	jle    805ecc <ipc_find_env+0x28>
+	}
+	return 0;
+  805f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805f31:	c9                   	leave
+  805f32:	c3                   	ret
+
+0000000000805f33 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  805f33:	55                   	push   %rbp
+  805f34:	48 89 e5             	mov    %rsp,%rbp
+  805f37:	48 83 ec 18          	sub    $0x18,%rsp
+  805f3b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f3b <pageref+0x8>
+  805f42:	49 bb f5 20 00 00 00 	movabs $0x20f5,%r11
+  805f49:	00 00 00 
+  805f4c:	4c 01 d8             	add    %r11,%rax
+  805f4f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  805f53:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805f57:	48 89 d1             	mov    %rdx,%rcx
+  805f5a:	48 c1 e9 15          	shr    $0x15,%rcx
+  805f5e:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  805f65:	ff ff ff 
+  805f68:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805f6c:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805f70:	83 e2 01             	and    $0x1,%edx
+  805f73:	48 85 d2             	test   %rdx,%rdx
+  805f76:	75 07                	jne    805f7f <pageref+0x4c>
+		return 0;
+  805f78:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f7d:	eb 64                	jmp    805fe3 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  805f7f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805f83:	48 89 d1             	mov    %rdx,%rcx
+  805f86:	48 c1 e9 0c          	shr    $0xc,%rcx
+  805f8a:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  805f91:	ff ff ff 
+  805f94:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805f98:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805f9c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  805fa0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805fa4:	83 e2 01             	and    $0x1,%edx
+  805fa7:	48 85 d2             	test   %rdx,%rdx
+  805faa:	75 07                	jne    805fb3 <pageref+0x80>
+		return 0;
+  805fac:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fb1:	eb 30                	jmp    805fe3 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  805fb3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805fb7:	48 c1 ea 0c          	shr    $0xc,%rdx
+  805fbb:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  805fc2:	ff ff ff 
+  805fc5:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  805fc9:	48 89 d0             	mov    %rdx,%rax
+  805fcc:	48 01 c0             	add    %rax,%rax
+  805fcf:	48 01 d0             	add    %rdx,%rax
+  805fd2:	48 c1 e0 03          	shl    $0x3,%rax
+  805fd6:	48 01 c8             	add    %rcx,%rax
+  805fd9:	48 83 c0 08          	add    $0x8,%rax
+  805fdd:	0f b7 00             	movzwl (%rax),%eax
+  805fe0:	0f b7 c0             	movzwl %ax,%eax
+}
+  805fe3:	c9                   	leave
+  805fe4:	c3                   	ret
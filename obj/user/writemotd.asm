@@ -0,0 +1,9563 @@
+
+obj/user/writemotd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 64 04 00 00       	call   8004a5 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  800051:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800051 <umain+0xe>
+  800058:	49 bb df 7f 00 00 00 	movabs $0x7fdf,%r11
+  80005f:	00 00 00 
+  800062:	4c 01 db             	add    %r11,%rbx
+  800065:	89 bd dc fd ff ff    	mov    %edi,-0x224(%rbp)
+  80006b:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int rfd, wfd;
+	char buf[512];
+	int n, r;
+
+	if ((rfd = open("/newmotd", O_RDONLY)) < 0)
+  800072:	be 00 00 00 00       	mov    $0x0,%esi
+  800077:	48 b8 08 e2 ff ff ff 	movabs $0xffffffffffffe208,%rax
+  80007e:	ff ff ff 
+  800081:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800085:	48 89 c7             	mov    %rax,%rdi
+  800088:	49 89 df             	mov    %rbx,%r15
+  80008b:	48 b8 c3 b8 ff ff ff 	movabs $0xffffffffffffb8c3,%rax
+  800092:	ff ff ff 
+  800095:	48 01 d8             	add    %rbx,%rax
+  800098:	ff d0                	call   *%rax
+  80009a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80009d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000a1:	79 44                	jns    8000e7 <umain+0xa4>
+		panic("open /newmotd: %e", rfd);
+  8000a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000a6:	89 c1                	mov    %eax,%ecx
+  8000a8:	48 b8 11 e2 ff ff ff 	movabs $0xffffffffffffe211,%rax
+  8000af:	ff ff ff 
+  8000b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000b6:	48 89 c2             	mov    %rax,%rdx
+  8000b9:	be 0b 00 00 00       	mov    $0xb,%esi
+  8000be:	48 b8 23 e2 ff ff ff 	movabs $0xffffffffffffe223,%rax
+  8000c5:	ff ff ff 
+  8000c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000cc:	48 89 c7             	mov    %rax,%rdi
+  8000cf:	49 89 df             	mov    %rbx,%r15
+  8000d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d7:	49 b8 7f 85 ff ff ff 	movabs $0xffffffffffff857f,%r8
+  8000de:	ff ff ff 
+  8000e1:	49 01 d8             	add    %rbx,%r8
+  8000e4:	41 ff d0             	call   *%r8
+	if ((wfd = open("/motd", O_RDWR)) < 0)
+  8000e7:	be 02 00 00 00       	mov    $0x2,%esi
+  8000ec:	48 b8 34 e2 ff ff ff 	movabs $0xffffffffffffe234,%rax
+  8000f3:	ff ff ff 
+  8000f6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000fa:	48 89 c7             	mov    %rax,%rdi
+  8000fd:	49 89 df             	mov    %rbx,%r15
+  800100:	48 b8 c3 b8 ff ff ff 	movabs $0xffffffffffffb8c3,%rax
+  800107:	ff ff ff 
+  80010a:	48 01 d8             	add    %rbx,%rax
+  80010d:	ff d0                	call   *%rax
+  80010f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800112:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800116:	79 44                	jns    80015c <umain+0x119>
+		panic("open /motd: %e", wfd);
+  800118:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80011b:	89 c1                	mov    %eax,%ecx
+  80011d:	48 b8 3a e2 ff ff ff 	movabs $0xffffffffffffe23a,%rax
+  800124:	ff ff ff 
+  800127:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80012b:	48 89 c2             	mov    %rax,%rdx
+  80012e:	be 0d 00 00 00       	mov    $0xd,%esi
+  800133:	48 b8 23 e2 ff ff ff 	movabs $0xffffffffffffe223,%rax
+  80013a:	ff ff ff 
+  80013d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800141:	48 89 c7             	mov    %rax,%rdi
+  800144:	49 89 df             	mov    %rbx,%r15
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014c:	49 b8 7f 85 ff ff ff 	movabs $0xffffffffffff857f,%r8
+  800153:	ff ff ff 
+  800156:	49 01 d8             	add    %rbx,%r8
+  800159:	41 ff d0             	call   *%r8
+	cprintf("file descriptors %d %d\n", rfd, wfd);
+  80015c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80015f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800162:	89 c6                	mov    %eax,%esi
+  800164:	48 b8 49 e2 ff ff ff 	movabs $0xffffffffffffe249,%rax
+  80016b:	ff ff ff 
+  80016e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800172:	48 89 c7             	mov    %rax,%rdi
+  800175:	49 89 df             	mov    %rbx,%r15
+  800178:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017d:	48 b9 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rcx
+  800184:	ff ff ff 
+  800187:	48 01 d9             	add    %rbx,%rcx
+  80018a:	ff d1                	call   *%rcx
+	if (rfd == wfd)
+  80018c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80018f:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+  800192:	75 3e                	jne    8001d2 <umain+0x18f>
+		panic("open /newmotd and /motd give same file descriptor");
+  800194:	48 b8 68 e2 ff ff ff 	movabs $0xffffffffffffe268,%rax
+  80019b:	ff ff ff 
+  80019e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001a2:	48 89 c2             	mov    %rax,%rdx
+  8001a5:	be 10 00 00 00       	mov    $0x10,%esi
+  8001aa:	48 b8 23 e2 ff ff ff 	movabs $0xffffffffffffe223,%rax
+  8001b1:	ff ff ff 
+  8001b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001b8:	48 89 c7             	mov    %rax,%rdi
+  8001bb:	49 89 df             	mov    %rbx,%r15
+  8001be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c3:	48 b9 7f 85 ff ff ff 	movabs $0xffffffffffff857f,%rcx
+  8001ca:	ff ff ff 
+  8001cd:	48 01 d9             	add    %rbx,%rcx
+  8001d0:	ff d1                	call   *%rcx
+
+	cprintf("OLD MOTD\n===\n");
+  8001d2:	48 b8 9a e2 ff ff ff 	movabs $0xffffffffffffe29a,%rax
+  8001d9:	ff ff ff 
+  8001dc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001e0:	48 89 c7             	mov    %rax,%rdi
+  8001e3:	49 89 df             	mov    %rbx,%r15
+  8001e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001eb:	48 ba 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rdx
+  8001f2:	ff ff ff 
+  8001f5:	48 01 da             	add    %rbx,%rdx
+  8001f8:	ff d2                	call   *%rdx
+	while ((n = read(wfd, buf, sizeof buf-1)) > 0)
+  8001fa:	eb 25                	jmp    800221 <umain+0x1de>
+		sys_cputs(buf, n);
+  8001fc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8001ff:	48 63 d0             	movslq %eax,%rdx
+  800202:	48 8d 85 e0 fd ff ff 	lea    -0x220(%rbp),%rax
+  800209:	48 89 d6             	mov    %rdx,%rsi
+  80020c:	48 89 c7             	mov    %rax,%rdi
+  80020f:	49 89 df             	mov    %rbx,%r15
+  800212:	48 b8 1c a1 ff ff ff 	movabs $0xffffffffffffa11c,%rax
+  800219:	ff ff ff 
+  80021c:	48 01 d8             	add    %rbx,%rax
+  80021f:	ff d0                	call   *%rax
+	while ((n = read(wfd, buf, sizeof buf-1)) > 0)
+  800221:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  800228:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80022b:	ba ff 01 00 00       	mov    $0x1ff,%edx
+  800230:	48 89 ce             	mov    %rcx,%rsi
+  800233:	89 c7                	mov    %eax,%edi
+  800235:	49 89 df             	mov    %rbx,%r15
+  800238:	48 b8 f4 b0 ff ff ff 	movabs $0xffffffffffffb0f4,%rax
+  80023f:	ff ff ff 
+  800242:	48 01 d8             	add    %rbx,%rax
+  800245:	ff d0                	call   *%rax
+  800247:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80024a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80024e:	7f ac                	jg     8001fc <umain+0x1b9>
+	cprintf("===\n");
+  800250:	48 b8 a8 e2 ff ff ff 	movabs $0xffffffffffffe2a8,%rax
+  800257:	ff ff ff 
+  80025a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80025e:	48 89 c7             	mov    %rax,%rdi
+  800261:	49 89 df             	mov    %rbx,%r15
+  800264:	b8 00 00 00 00       	mov    $0x0,%eax
+  800269:	48 ba 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rdx
+  800270:	ff ff ff 
+  800273:	48 01 da             	add    %rbx,%rdx
+  800276:	ff d2                	call   *%rdx
+	seek(wfd, 0);
+  800278:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80027b:	be 00 00 00 00       	mov    $0x0,%esi
+  800280:	89 c7                	mov    %eax,%edi
+  800282:	49 89 df             	mov    %rbx,%r15
+  800285:	48 b8 ac b3 ff ff ff 	movabs $0xffffffffffffb3ac,%rax
+  80028c:	ff ff ff 
+  80028f:	48 01 d8             	add    %rbx,%rax
+  800292:	ff d0                	call   *%rax
+
+	if ((r = ftruncate(wfd, 0)) < 0)
+  800294:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800297:	be 00 00 00 00       	mov    $0x0,%esi
+  80029c:	89 c7                	mov    %eax,%edi
+  80029e:	49 89 df             	mov    %rbx,%r15
+  8002a1:	48 b8 09 b4 ff ff ff 	movabs $0xffffffffffffb409,%rax
+  8002a8:	ff ff ff 
+  8002ab:	48 01 d8             	add    %rbx,%rax
+  8002ae:	ff d0                	call   *%rax
+  8002b0:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  8002b3:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8002b7:	79 44                	jns    8002fd <umain+0x2ba>
+		panic("truncate /motd: %e", r);
+  8002b9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8002bc:	89 c1                	mov    %eax,%ecx
+  8002be:	48 b8 ad e2 ff ff ff 	movabs $0xffffffffffffe2ad,%rax
+  8002c5:	ff ff ff 
+  8002c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002cc:	48 89 c2             	mov    %rax,%rdx
+  8002cf:	be 19 00 00 00       	mov    $0x19,%esi
+  8002d4:	48 b8 23 e2 ff ff ff 	movabs $0xffffffffffffe223,%rax
+  8002db:	ff ff ff 
+  8002de:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002e2:	48 89 c7             	mov    %rax,%rdi
+  8002e5:	49 89 df             	mov    %rbx,%r15
+  8002e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ed:	49 b8 7f 85 ff ff ff 	movabs $0xffffffffffff857f,%r8
+  8002f4:	ff ff ff 
+  8002f7:	49 01 d8             	add    %rbx,%r8
+  8002fa:	41 ff d0             	call   *%r8
+
+	cprintf("NEW MOTD\n===\n");
+  8002fd:	48 b8 c0 e2 ff ff ff 	movabs $0xffffffffffffe2c0,%rax
+  800304:	ff ff ff 
+  800307:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80030b:	48 89 c7             	mov    %rax,%rdi
+  80030e:	49 89 df             	mov    %rbx,%r15
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	48 ba 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rdx
+  80031d:	ff ff ff 
+  800320:	48 01 da             	add    %rbx,%rdx
+  800323:	ff d2                	call   *%rdx
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0) {
+  800325:	e9 9b 00 00 00       	jmp    8003c5 <umain+0x382>
+		sys_cputs(buf, n);
+  80032a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80032d:	48 63 d0             	movslq %eax,%rdx
+  800330:	48 8d 85 e0 fd ff ff 	lea    -0x220(%rbp),%rax
+  800337:	48 89 d6             	mov    %rdx,%rsi
+  80033a:	48 89 c7             	mov    %rax,%rdi
+  80033d:	49 89 df             	mov    %rbx,%r15
+  800340:	48 b8 1c a1 ff ff ff 	movabs $0xffffffffffffa11c,%rax
+  800347:	ff ff ff 
+  80034a:	48 01 d8             	add    %rbx,%rax
+  80034d:	ff d0                	call   *%rax
+		if ((r = write(wfd, buf, n)) != n)
+  80034f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800352:	48 63 d0             	movslq %eax,%rdx
+  800355:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  80035c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80035f:	48 89 ce             	mov    %rcx,%rsi
+  800362:	89 c7                	mov    %eax,%edi
+  800364:	49 89 df             	mov    %rbx,%r15
+  800367:	48 b8 9a b2 ff ff ff 	movabs $0xffffffffffffb29a,%rax
+  80036e:	ff ff ff 
+  800371:	48 01 d8             	add    %rbx,%rax
+  800374:	ff d0                	call   *%rax
+  800376:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  800379:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80037c:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80037f:	74 44                	je     8003c5 <umain+0x382>
+			panic("write /motd: %e", r);
+  800381:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800384:	89 c1                	mov    %eax,%ecx
+  800386:	48 b8 ce e2 ff ff ff 	movabs $0xffffffffffffe2ce,%rax
+  80038d:	ff ff ff 
+  800390:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800394:	48 89 c2             	mov    %rax,%rdx
+  800397:	be 1f 00 00 00       	mov    $0x1f,%esi
+  80039c:	48 b8 23 e2 ff ff ff 	movabs $0xffffffffffffe223,%rax
+  8003a3:	ff ff ff 
+  8003a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003aa:	48 89 c7             	mov    %rax,%rdi
+  8003ad:	49 89 df             	mov    %rbx,%r15
+  8003b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b5:	49 b8 7f 85 ff ff ff 	movabs $0xffffffffffff857f,%r8
+  8003bc:	ff ff ff 
+  8003bf:	49 01 d8             	add    %rbx,%r8
+  8003c2:	41 ff d0             	call   *%r8
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0) {
+  8003c5:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8003cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003cf:	ba ff 01 00 00       	mov    $0x1ff,%edx
+  8003d4:	48 89 ce             	mov    %rcx,%rsi
+  8003d7:	89 c7                	mov    %eax,%edi
+  8003d9:	49 89 df             	mov    %rbx,%r15
+  8003dc:	48 b8 f4 b0 ff ff ff 	movabs $0xffffffffffffb0f4,%rax
+  8003e3:	ff ff ff 
+  8003e6:	48 01 d8             	add    %rbx,%rax
+  8003e9:	ff d0                	call   *%rax
+  8003eb:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8003ee:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8003f2:	0f 8f 32 ff ff ff    	jg     80032a <umain+0x2e7>
+	}
+	cprintf("===\n");
+  8003f8:	48 b8 a8 e2 ff ff ff 	movabs $0xffffffffffffe2a8,%rax
+  8003ff:	ff ff ff 
+  800402:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800406:	48 89 c7             	mov    %rax,%rdi
+  800409:	49 89 df             	mov    %rbx,%r15
+  80040c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800411:	48 ba 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rdx
+  800418:	ff ff ff 
+  80041b:	48 01 da             	add    %rbx,%rdx
+  80041e:	ff d2                	call   *%rdx
+
+	if (n < 0)
+  800420:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800424:	79 44                	jns    80046a <umain+0x427>
+		panic("read /newmotd: %e", n);
+  800426:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800429:	89 c1                	mov    %eax,%ecx
+  80042b:	48 b8 de e2 ff ff ff 	movabs $0xffffffffffffe2de,%rax
+  800432:	ff ff ff 
+  800435:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800439:	48 89 c2             	mov    %rax,%rdx
+  80043c:	be 24 00 00 00       	mov    $0x24,%esi
+  800441:	48 b8 23 e2 ff ff ff 	movabs $0xffffffffffffe223,%rax
+  800448:	ff ff ff 
+  80044b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80044f:	48 89 c7             	mov    %rax,%rdi
+  800452:	49 89 df             	mov    %rbx,%r15
+  800455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045a:	49 b8 7f 85 ff ff ff 	movabs $0xffffffffffff857f,%r8
+  800461:	ff ff ff 
+  800464:	49 01 d8             	add    %rbx,%r8
+  800467:	41 ff d0             	call   *%r8
+
+	close(rfd);
+  80046a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80046d:	89 c7                	mov    %eax,%edi
+  80046f:	49 89 df             	mov    %rbx,%r15
+  800472:	48 b8 3c ae ff ff ff 	movabs $0xffffffffffffae3c,%rax
+  800479:	ff ff ff 
+  80047c:	48 01 d8             	add    %rbx,%rax
+  80047f:	ff d0                	call   *%rax
+	close(wfd);
+  800481:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800484:	89 c7                	mov    %eax,%edi
+  800486:	49 89 df             	mov    %rbx,%r15
+  800489:	48 b8 3c ae ff ff ff 	movabs $0xffffffffffffae3c,%rax
+  800490:	ff ff ff 
+  800493:	48 01 d8             	add    %rbx,%rax
+  800496:	ff d0                	call   *%rax
+}
+  800498:	90                   	nop
+  800499:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  8004a0:	5b                   	pop    %rbx
+  8004a1:	41 5f                	pop    %r15
+  8004a3:	5d                   	pop    %rbp
+  8004a4:	c3                   	ret
+
+00000000008004a5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004a5:	55                   	push   %rbp
+  8004a6:	48 89 e5             	mov    %rsp,%rbp
+  8004a9:	41 57                	push   %r15
+  8004ab:	53                   	push   %rbx
+  8004ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8004b0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004b0 <libmain+0xb>
+  8004b7:	49 bb 80 7b 00 00 00 	movabs $0x7b80,%r11
+  8004be:	00 00 00 
+  8004c1:	4c 01 db             	add    %r11,%rbx
+  8004c4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8004c7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8004cb:	49 89 df             	mov    %rbx,%r15
+  8004ce:	48 b8 2b a2 ff ff ff 	movabs $0xffffffffffffa22b,%rax
+  8004d5:	ff ff ff 
+  8004d8:	48 01 d8             	add    %rbx,%rax
+  8004db:	ff d0                	call   *%rax
+  8004dd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8004e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8004e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004e8:	48 98                	cltq
+  8004ea:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8004f1:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8004f8:	ff ff ff 
+  8004fb:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8004ff:	48 01 c2             	add    %rax,%rdx
+  800502:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  800509:	00 00 00 
+  80050c:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800510:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800514:	7e 15                	jle    80052b <libmain+0x86>
+		binaryname = argv[0];
+  800516:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80051a:	48 8b 00             	mov    (%rax),%rax
+  80051d:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  800524:	00 00 00 
+  800527:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  80052b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80052f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800532:	48 89 d6             	mov    %rdx,%rsi
+  800535:	89 c7                	mov    %eax,%edi
+  800537:	49 89 df             	mov    %rbx,%r15
+  80053a:	48 b8 13 80 ff ff ff 	movabs $0xffffffffffff8013,%rax
+  800541:	ff ff ff 
+  800544:	48 01 d8             	add    %rbx,%rax
+  800547:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800549:	49 89 df             	mov    %rbx,%r15
+  80054c:	48 b8 35 85 ff ff ff 	movabs $0xffffffffffff8535,%rax
+  800553:	ff ff ff 
+  800556:	48 01 d8             	add    %rbx,%rax
+  800559:	ff d0                	call   *%rax
+}
+  80055b:	90                   	nop
+  80055c:	48 83 c4 20          	add    $0x20,%rsp
+  800560:	5b                   	pop    %rbx
+  800561:	41 5f                	pop    %r15
+  800563:	5d                   	pop    %rbp
+  800564:	c3                   	ret
+
+0000000000800565 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800565:	55                   	push   %rbp
+  800566:	48 89 e5             	mov    %rsp,%rbp
+  800569:	41 57                	push   %r15
+  80056b:	53                   	push   %rbx
+  80056c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80056c <exit+0x7>
+  800573:	49 bb c4 7a 00 00 00 	movabs $0x7ac4,%r11
+  80057a:	00 00 00 
+  80057d:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800580:	49 89 df             	mov    %rbx,%r15
+  800583:	48 b8 a8 ae ff ff ff 	movabs $0xffffffffffffaea8,%rax
+  80058a:	ff ff ff 
+  80058d:	48 01 d8             	add    %rbx,%rax
+  800590:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800592:	bf 00 00 00 00       	mov    $0x0,%edi
+  800597:	49 89 df             	mov    %rbx,%r15
+  80059a:	48 b8 cf a1 ff ff ff 	movabs $0xffffffffffffa1cf,%rax
+  8005a1:	ff ff ff 
+  8005a4:	48 01 d8             	add    %rbx,%rax
+  8005a7:	ff d0                	call   *%rax
+}
+  8005a9:	90                   	nop
+  8005aa:	5b                   	pop    %rbx
+  8005ab:	41 5f                	pop    %r15
+  8005ad:	5d                   	pop    %rbp
+  8005ae:	c3                   	ret
+
+00000000008005af <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8005af:	55                   	push   %rbp
+  8005b0:	48 89 e5             	mov    %rsp,%rbp
+  8005b3:	41 57                	push   %r15
+  8005b5:	41 54                	push   %r12
+  8005b7:	53                   	push   %rbx
+  8005b8:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8005bf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8005bf <_panic+0x10>
+  8005c6:	49 bb 71 7a 00 00 00 	movabs $0x7a71,%r11
+  8005cd:	00 00 00 
+  8005d0:	4c 01 db             	add    %r11,%rbx
+  8005d3:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8005da:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8005e0:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8005e7:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8005ee:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8005f5:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8005fc:	84 c0                	test   %al,%al
+  8005fe:	74 26                	je     800626 <_panic+0x77>
+  800600:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800607:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80060e:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800612:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800616:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80061a:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80061e:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800622:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800626:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80062d:	00 00 00 
+  800630:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800637:	00 00 00 
+  80063a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80063e:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800645:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80064c:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800653:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80065a:	ff ff ff 
+  80065d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800661:	4c 8b 20             	mov    (%rax),%r12
+  800664:	49 89 df             	mov    %rbx,%r15
+  800667:	48 b8 2b a2 ff ff ff 	movabs $0xffffffffffffa22b,%rax
+  80066e:	ff ff ff 
+  800671:	48 01 d8             	add    %rbx,%rax
+  800674:	ff d0                	call   *%rax
+  800676:	89 c6                	mov    %eax,%esi
+  800678:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80067e:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800685:	41 89 d0             	mov    %edx,%r8d
+  800688:	48 89 c1             	mov    %rax,%rcx
+  80068b:	4c 89 e2             	mov    %r12,%rdx
+  80068e:	48 b8 00 e3 ff ff ff 	movabs $0xffffffffffffe300,%rax
+  800695:	ff ff ff 
+  800698:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80069c:	48 89 c7             	mov    %rax,%rdi
+  80069f:	49 89 df             	mov    %rbx,%r15
+  8006a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a7:	49 b9 56 88 ff ff ff 	movabs $0xffffffffffff8856,%r9
+  8006ae:	ff ff ff 
+  8006b1:	49 01 d9             	add    %rbx,%r9
+  8006b4:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8006b7:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8006be:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8006c5:	48 89 d6             	mov    %rdx,%rsi
+  8006c8:	48 89 c7             	mov    %rax,%rdi
+  8006cb:	49 89 df             	mov    %rbx,%r15
+  8006ce:	48 b8 76 87 ff ff ff 	movabs $0xffffffffffff8776,%rax
+  8006d5:	ff ff ff 
+  8006d8:	48 01 d8             	add    %rbx,%rax
+  8006db:	ff d0                	call   *%rax
+	cprintf("\n");
+  8006dd:	48 b8 23 e3 ff ff ff 	movabs $0xffffffffffffe323,%rax
+  8006e4:	ff ff ff 
+  8006e7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006eb:	48 89 c7             	mov    %rax,%rdi
+  8006ee:	49 89 df             	mov    %rbx,%r15
+  8006f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f6:	48 ba 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rdx
+  8006fd:	ff ff ff 
+  800700:	48 01 da             	add    %rbx,%rdx
+  800703:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800705:	cc                   	int3
+  800706:	eb fd                	jmp    800705 <_panic+0x156>
+
+0000000000800708 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800708:	55                   	push   %rbp
+  800709:	48 89 e5             	mov    %rsp,%rbp
+  80070c:	41 57                	push   %r15
+  80070e:	48 83 ec 18          	sub    $0x18,%rsp
+  800712:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800712 <putch+0xa>
+  800719:	49 bb 1e 79 00 00 00 	movabs $0x791e,%r11
+  800720:	00 00 00 
+  800723:	4c 01 d8             	add    %r11,%rax
+  800726:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800729:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80072d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800731:	8b 12                	mov    (%rdx),%edx
+  800733:	8d 72 01             	lea    0x1(%rdx),%esi
+  800736:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80073a:	89 31                	mov    %esi,(%rcx)
+  80073c:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80073f:	89 ce                	mov    %ecx,%esi
+  800741:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800745:	48 63 d2             	movslq %edx,%rdx
+  800748:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80074d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800751:	8b 12                	mov    (%rdx),%edx
+  800753:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800759:	75 33                	jne    80078e <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80075b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80075f:	8b 12                	mov    (%rdx),%edx
+  800761:	48 63 d2             	movslq %edx,%rdx
+  800764:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800768:	48 83 c1 08          	add    $0x8,%rcx
+  80076c:	48 89 d6             	mov    %rdx,%rsi
+  80076f:	48 89 cf             	mov    %rcx,%rdi
+  800772:	49 89 c7             	mov    %rax,%r15
+  800775:	48 ba 1c a1 ff ff ff 	movabs $0xffffffffffffa11c,%rdx
+  80077c:	ff ff ff 
+  80077f:	48 01 c2             	add    %rax,%rdx
+  800782:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800784:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800788:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  80078e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800792:	8b 40 04             	mov    0x4(%rax),%eax
+  800795:	8d 50 01             	lea    0x1(%rax),%edx
+  800798:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80079c:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80079f:	90                   	nop
+  8007a0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8007a4:	c9                   	leave
+  8007a5:	c3                   	ret
+
+00000000008007a6 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8007a6:	55                   	push   %rbp
+  8007a7:	48 89 e5             	mov    %rsp,%rbp
+  8007aa:	41 57                	push   %r15
+  8007ac:	53                   	push   %rbx
+  8007ad:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8007b4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8007b4 <vcprintf+0xe>
+  8007bb:	49 bb 7c 78 00 00 00 	movabs $0x787c,%r11
+  8007c2:	00 00 00 
+  8007c5:	4c 01 db             	add    %r11,%rbx
+  8007c8:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  8007cf:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8007d6:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8007dd:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8007e4:	48 8b 06             	mov    (%rsi),%rax
+  8007e7:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007eb:	48 89 01             	mov    %rax,(%rcx)
+  8007ee:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8007f2:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8007f6:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8007fa:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800801:	00 00 00 
+    b.cnt = 0;
+  800804:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80080b:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  80080e:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800815:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  80081c:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800823:	48 89 c6             	mov    %rax,%rsi
+  800826:	48 b8 d8 86 ff ff ff 	movabs $0xffffffffffff86d8,%rax
+  80082d:	ff ff ff 
+  800830:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800834:	48 89 c7             	mov    %rax,%rdi
+  800837:	49 89 df             	mov    %rbx,%r15
+  80083a:	48 b8 9a 8c ff ff ff 	movabs $0xffffffffffff8c9a,%rax
+  800841:	ff ff ff 
+  800844:	48 01 d8             	add    %rbx,%rax
+  800847:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800849:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80084f:	48 98                	cltq
+  800851:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800858:	48 83 c2 08          	add    $0x8,%rdx
+  80085c:	48 89 c6             	mov    %rax,%rsi
+  80085f:	48 89 d7             	mov    %rdx,%rdi
+  800862:	49 89 df             	mov    %rbx,%r15
+  800865:	48 b8 1c a1 ff ff ff 	movabs $0xffffffffffffa11c,%rax
+  80086c:	ff ff ff 
+  80086f:	48 01 d8             	add    %rbx,%rax
+  800872:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800874:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  80087a:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800881:	5b                   	pop    %rbx
+  800882:	41 5f                	pop    %r15
+  800884:	5d                   	pop    %rbp
+  800885:	c3                   	ret
+
+0000000000800886 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800886:	55                   	push   %rbp
+  800887:	48 89 e5             	mov    %rsp,%rbp
+  80088a:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800891:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800891 <cprintf+0xb>
+  800898:	49 bb 9f 77 00 00 00 	movabs $0x779f,%r11
+  80089f:	00 00 00 
+  8008a2:	4d 01 da             	add    %r11,%r10
+  8008a5:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8008ac:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8008b3:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8008ba:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8008c1:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8008c8:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8008cf:	84 c0                	test   %al,%al
+  8008d1:	74 20                	je     8008f3 <cprintf+0x6d>
+  8008d3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8008d7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8008db:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8008df:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8008e3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8008e7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8008eb:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8008ef:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8008f3:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8008fa:	00 00 00 
+  8008fd:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800904:	00 00 00 
+  800907:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80090b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800912:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800919:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800920:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800927:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80092e:	48 8b 06             	mov    (%rsi),%rax
+  800931:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800935:	48 89 01             	mov    %rax,(%rcx)
+  800938:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80093c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800940:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800944:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80094b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800952:	48 89 d6             	mov    %rdx,%rsi
+  800955:	48 89 c7             	mov    %rax,%rdi
+  800958:	48 b8 76 87 ff ff ff 	movabs $0xffffffffffff8776,%rax
+  80095f:	ff ff ff 
+  800962:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800966:	ff d0                	call   *%rax
+  800968:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80096e:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800974:	c9                   	leave
+  800975:	c3                   	ret
+
+0000000000800976 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800976:	55                   	push   %rbp
+  800977:	48 89 e5             	mov    %rsp,%rbp
+  80097a:	53                   	push   %rbx
+  80097b:	48 83 ec 38          	sub    $0x38,%rsp
+  80097f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80097f <printnum+0x9>
+  800986:	49 bb b1 76 00 00 00 	movabs $0x76b1,%r11
+  80098d:	00 00 00 
+  800990:	4c 01 db             	add    %r11,%rbx
+  800993:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800997:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80099b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80099f:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8009a2:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8009a6:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8009aa:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8009ad:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8009b1:	72 58                	jb     800a0b <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8009b3:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8009b6:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8009b9:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8009bc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009c5:	48 f7 f6             	div    %rsi
+  8009c8:	49 89 c2             	mov    %rax,%r10
+  8009cb:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8009ce:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8009d1:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8009d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009d9:	41 89 c9             	mov    %ecx,%r9d
+  8009dc:	41 89 f8             	mov    %edi,%r8d
+  8009df:	89 d1                	mov    %edx,%ecx
+  8009e1:	4c 89 d2             	mov    %r10,%rdx
+  8009e4:	48 89 c7             	mov    %rax,%rdi
+  8009e7:	48 b8 46 89 ff ff ff 	movabs $0xffffffffffff8946,%rax
+  8009ee:	ff ff ff 
+  8009f1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009f5:	ff d0                	call   *%rax
+  8009f7:	eb 1c                	jmp    800a15 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8009f9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8009fd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800a00:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800a04:	48 89 d6             	mov    %rdx,%rsi
+  800a07:	89 c7                	mov    %eax,%edi
+  800a09:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800a0b:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800a0f:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800a13:	7f e4                	jg     8009f9 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800a15:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800a18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a21:	48 f7 f1             	div    %rcx
+  800a24:	48 b8 5f e4 ff ff ff 	movabs $0xffffffffffffe45f,%rax
+  800a2b:	ff ff ff 
+  800a2e:	48 01 d8             	add    %rbx,%rax
+  800a31:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800a35:	0f be c0             	movsbl %al,%eax
+  800a38:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a3c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800a40:	48 89 d6             	mov    %rdx,%rsi
+  800a43:	89 c7                	mov    %eax,%edi
+  800a45:	ff d1                	call   *%rcx
+}
+  800a47:	90                   	nop
+  800a48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a4c:	c9                   	leave
+  800a4d:	c3                   	ret
+
+0000000000800a4e <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800a4e:	55                   	push   %rbp
+  800a4f:	48 89 e5             	mov    %rsp,%rbp
+  800a52:	48 83 ec 20          	sub    $0x20,%rsp
+  800a56:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a56 <getuint+0x8>
+  800a5d:	49 bb da 75 00 00 00 	movabs $0x75da,%r11
+  800a64:	00 00 00 
+  800a67:	4c 01 d8             	add    %r11,%rax
+  800a6a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a6e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800a71:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800a75:	7e 4f                	jle    800ac6 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800a77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a7b:	8b 00                	mov    (%rax),%eax
+  800a7d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a80:	77 24                	ja     800aa6 <getuint+0x58>
+  800a82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a86:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a8e:	8b 00                	mov    (%rax),%eax
+  800a90:	89 c0                	mov    %eax,%eax
+  800a92:	48 01 d0             	add    %rdx,%rax
+  800a95:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a99:	8b 12                	mov    (%rdx),%edx
+  800a9b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a9e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aa2:	89 0a                	mov    %ecx,(%rdx)
+  800aa4:	eb 14                	jmp    800aba <getuint+0x6c>
+  800aa6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aaa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800aae:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ab2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ab6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800aba:	48 8b 00             	mov    (%rax),%rax
+  800abd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800ac1:	e9 9d 00 00 00       	jmp    800b63 <getuint+0x115>
+	else if (lflag)
+  800ac6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800aca:	74 4c                	je     800b18 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800acc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad0:	8b 00                	mov    (%rax),%eax
+  800ad2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad5:	77 24                	ja     800afb <getuint+0xad>
+  800ad7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800adb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800adf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ae3:	8b 00                	mov    (%rax),%eax
+  800ae5:	89 c0                	mov    %eax,%eax
+  800ae7:	48 01 d0             	add    %rdx,%rax
+  800aea:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aee:	8b 12                	mov    (%rdx),%edx
+  800af0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800af3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800af7:	89 0a                	mov    %ecx,(%rdx)
+  800af9:	eb 14                	jmp    800b0f <getuint+0xc1>
+  800afb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aff:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b03:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b0b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b0f:	48 8b 00             	mov    (%rax),%rax
+  800b12:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b16:	eb 4b                	jmp    800b63 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800b18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b1c:	8b 00                	mov    (%rax),%eax
+  800b1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b21:	77 24                	ja     800b47 <getuint+0xf9>
+  800b23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b27:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b2f:	8b 00                	mov    (%rax),%eax
+  800b31:	89 c0                	mov    %eax,%eax
+  800b33:	48 01 d0             	add    %rdx,%rax
+  800b36:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b3a:	8b 12                	mov    (%rdx),%edx
+  800b3c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b3f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b43:	89 0a                	mov    %ecx,(%rdx)
+  800b45:	eb 14                	jmp    800b5b <getuint+0x10d>
+  800b47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b4b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b4f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b53:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b57:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b5b:	8b 00                	mov    (%rax),%eax
+  800b5d:	89 c0                	mov    %eax,%eax
+  800b5f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800b63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800b67:	c9                   	leave
+  800b68:	c3                   	ret
+
+0000000000800b69 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800b69:	55                   	push   %rbp
+  800b6a:	48 89 e5             	mov    %rsp,%rbp
+  800b6d:	48 83 ec 20          	sub    $0x20,%rsp
+  800b71:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b71 <printfloat+0x8>
+  800b78:	49 bb bf 74 00 00 00 	movabs $0x74bf,%r11
+  800b7f:	00 00 00 
+  800b82:	4c 01 d8             	add    %r11,%rax
+  800b85:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800b89:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800b8d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800b91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b95:	48 85 c0             	test   %rax,%rax
+  800b98:	79 12                	jns    800bac <printfloat+0x43>
+		putch('-',putdat);
+  800b9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b9e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ba2:	48 89 c6             	mov    %rax,%rsi
+  800ba5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800baa:	ff d2                	call   *%rdx
+	
+}
+  800bac:	90                   	nop
+  800bad:	c9                   	leave
+  800bae:	c3                   	ret
+
+0000000000800baf <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800baf:	55                   	push   %rbp
+  800bb0:	48 89 e5             	mov    %rsp,%rbp
+  800bb3:	48 83 ec 20          	sub    $0x20,%rsp
+  800bb7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800bb7 <getint+0x8>
+  800bbe:	49 bb 79 74 00 00 00 	movabs $0x7479,%r11
+  800bc5:	00 00 00 
+  800bc8:	4c 01 d8             	add    %r11,%rax
+  800bcb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bcf:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800bd2:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800bd6:	7e 4f                	jle    800c27 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800bd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bdc:	8b 00                	mov    (%rax),%eax
+  800bde:	83 f8 2f             	cmp    $0x2f,%eax
+  800be1:	77 24                	ja     800c07 <getint+0x58>
+  800be3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800be7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800beb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bef:	8b 00                	mov    (%rax),%eax
+  800bf1:	89 c0                	mov    %eax,%eax
+  800bf3:	48 01 d0             	add    %rdx,%rax
+  800bf6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bfa:	8b 12                	mov    (%rdx),%edx
+  800bfc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800bff:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c03:	89 0a                	mov    %ecx,(%rdx)
+  800c05:	eb 14                	jmp    800c1b <getint+0x6c>
+  800c07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c0b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c0f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c13:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c17:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c1b:	48 8b 00             	mov    (%rax),%rax
+  800c1e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800c22:	e9 9d 00 00 00       	jmp    800cc4 <getint+0x115>
+	else if (lflag)
+  800c27:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800c2b:	74 4c                	je     800c79 <getint+0xca>
+		x=va_arg(*ap, long);
+  800c2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c31:	8b 00                	mov    (%rax),%eax
+  800c33:	83 f8 2f             	cmp    $0x2f,%eax
+  800c36:	77 24                	ja     800c5c <getint+0xad>
+  800c38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c3c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c40:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c44:	8b 00                	mov    (%rax),%eax
+  800c46:	89 c0                	mov    %eax,%eax
+  800c48:	48 01 d0             	add    %rdx,%rax
+  800c4b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c4f:	8b 12                	mov    (%rdx),%edx
+  800c51:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c54:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c58:	89 0a                	mov    %ecx,(%rdx)
+  800c5a:	eb 14                	jmp    800c70 <getint+0xc1>
+  800c5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c60:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c64:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c68:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c6c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c70:	48 8b 00             	mov    (%rax),%rax
+  800c73:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800c77:	eb 4b                	jmp    800cc4 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800c79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c7d:	8b 00                	mov    (%rax),%eax
+  800c7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c82:	77 24                	ja     800ca8 <getint+0xf9>
+  800c84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c88:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c90:	8b 00                	mov    (%rax),%eax
+  800c92:	89 c0                	mov    %eax,%eax
+  800c94:	48 01 d0             	add    %rdx,%rax
+  800c97:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c9b:	8b 12                	mov    (%rdx),%edx
+  800c9d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ca0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ca4:	89 0a                	mov    %ecx,(%rdx)
+  800ca6:	eb 14                	jmp    800cbc <getint+0x10d>
+  800ca8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800cb0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800cb4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cb8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800cbc:	8b 00                	mov    (%rax),%eax
+  800cbe:	48 98                	cltq
+  800cc0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800cc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800cc8:	c9                   	leave
+  800cc9:	c3                   	ret
+
+0000000000800cca <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800cca:	55                   	push   %rbp
+  800ccb:	48 89 e5             	mov    %rsp,%rbp
+  800cce:	41 57                	push   %r15
+  800cd0:	41 55                	push   %r13
+  800cd2:	41 54                	push   %r12
+  800cd4:	53                   	push   %rbx
+  800cd5:	48 83 ec 60          	sub    $0x60,%rsp
+  800cd9:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800cd9 <vprintfmt+0xf>
+  800ce0:	49 bb 57 73 00 00 00 	movabs $0x7357,%r11
+  800ce7:	00 00 00 
+  800cea:	4d 01 dc             	add    %r11,%r12
+  800ced:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800cf1:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800cf5:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800cf9:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800cfd:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800d04:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800d08:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800d0c:	48 8b 06             	mov    (%rsi),%rax
+  800d0f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800d13:	48 89 01             	mov    %rax,(%rcx)
+  800d16:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d1a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800d1e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800d22:	eb 17                	jmp    800d3b <vprintfmt+0x71>
+			if (ch == '\0')
+  800d24:	85 db                	test   %ebx,%ebx
+  800d26:	0f 84 97 05 00 00    	je     8012c3 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800d2c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d30:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d34:	48 89 c6             	mov    %rax,%rsi
+  800d37:	89 df                	mov    %ebx,%edi
+  800d39:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800d3b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d3f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d43:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d47:	0f b6 00             	movzbl (%rax),%eax
+  800d4a:	0f b6 d8             	movzbl %al,%ebx
+  800d4d:	83 fb 25             	cmp    $0x25,%ebx
+  800d50:	75 d2                	jne    800d24 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800d52:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800d56:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800d5d:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800d64:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800d6b:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800d72:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d76:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d7a:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d7e:	0f b6 00             	movzbl (%rax),%eax
+  800d81:	0f b6 d8             	movzbl %al,%ebx
+  800d84:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800d87:	83 f8 55             	cmp    $0x55,%eax
+  800d8a:	0f 87 00 05 00 00    	ja     801290 <vprintfmt+0x5c6>
+  800d90:	89 c0                	mov    %eax,%eax
+  800d92:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800d99:	00 
+  800d9a:	48 8d 05 17 57 00 00 	lea    0x5717(%rip),%rax        # 8064b8 <.LC18+0xc>
+  800da1:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800da5:	48 8d 15 0c 57 00 00 	lea    0x570c(%rip),%rdx        # 8064b8 <.LC18+0xc>
+  800dac:	48 01 d0             	add    %rdx,%rax
+  800daf:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800db1:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800db5:	eb bb                	jmp    800d72 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800db7:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800dbb:	eb b5                	jmp    800d72 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800dbd:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800dc4:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800dc7:	89 d0                	mov    %edx,%eax
+  800dc9:	c1 e0 02             	shl    $0x2,%eax
+  800dcc:	01 d0                	add    %edx,%eax
+  800dce:	01 c0                	add    %eax,%eax
+  800dd0:	01 d8                	add    %ebx,%eax
+  800dd2:	83 e8 30             	sub    $0x30,%eax
+  800dd5:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800dd8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ddc:	0f b6 00             	movzbl (%rax),%eax
+  800ddf:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800de2:	83 fb 2f             	cmp    $0x2f,%ebx
+  800de5:	7e 60                	jle    800e47 <vprintfmt+0x17d>
+  800de7:	83 fb 39             	cmp    $0x39,%ebx
+  800dea:	7f 5b                	jg     800e47 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800dec:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800df1:	eb d1                	jmp    800dc4 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800df3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800df6:	83 f8 2f             	cmp    $0x2f,%eax
+  800df9:	77 17                	ja     800e12 <vprintfmt+0x148>
+  800dfb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800dff:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e02:	89 d2                	mov    %edx,%edx
+  800e04:	48 01 d0             	add    %rdx,%rax
+  800e07:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e0a:	83 c2 08             	add    $0x8,%edx
+  800e0d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e10:	eb 0c                	jmp    800e1e <vprintfmt+0x154>
+  800e12:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e16:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e1a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e1e:	8b 00                	mov    (%rax),%eax
+  800e20:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800e23:	eb 23                	jmp    800e48 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800e25:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e29:	0f 89 43 ff ff ff    	jns    800d72 <vprintfmt+0xa8>
+				width = 0;
+  800e2f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800e36:	e9 37 ff ff ff       	jmp    800d72 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800e3b:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800e42:	e9 2b ff ff ff       	jmp    800d72 <vprintfmt+0xa8>
+			goto process_precision;
+  800e47:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800e48:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e4c:	0f 89 20 ff ff ff    	jns    800d72 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800e52:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800e55:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800e58:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800e5f:	e9 0e ff ff ff       	jmp    800d72 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800e64:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800e68:	e9 05 ff ff ff       	jmp    800d72 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800e6d:	83 fb 39             	cmp    $0x39,%ebx
+  800e70:	7f 0b                	jg     800e7d <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800e72:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800e75:	c1 e0 08             	shl    $0x8,%eax
+  800e78:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800e7b:	eb 21                	jmp    800e9e <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800e7d:	83 fb 60             	cmp    $0x60,%ebx
+  800e80:	7e 10                	jle    800e92 <vprintfmt+0x1c8>
+  800e82:	83 fb 66             	cmp    $0x66,%ebx
+  800e85:	7f 0b                	jg     800e92 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800e87:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800e8a:	c1 e0 08             	shl    $0x8,%eax
+  800e8d:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800e90:	eb 0c                	jmp    800e9e <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800e92:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800e99:	e9 04 01 00 00       	jmp    800fa2 <vprintfmt+0x2d8>
+  800e9e:	e9 ff 00 00 00       	jmp    800fa2 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800ea3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ea6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ea9:	77 17                	ja     800ec2 <vprintfmt+0x1f8>
+  800eab:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800eaf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800eb2:	89 d2                	mov    %edx,%edx
+  800eb4:	48 01 d0             	add    %rdx,%rax
+  800eb7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800eba:	83 c2 08             	add    $0x8,%edx
+  800ebd:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ec0:	eb 0c                	jmp    800ece <vprintfmt+0x204>
+  800ec2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ec6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800eca:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ece:	8b 00                	mov    (%rax),%eax
+  800ed0:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800ed4:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800ed8:	48 89 d6             	mov    %rdx,%rsi
+  800edb:	89 c7                	mov    %eax,%edi
+  800edd:	ff d1                	call   *%rcx
+			break;
+  800edf:	e9 da 03 00 00       	jmp    8012be <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800ee4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ee7:	83 f8 2f             	cmp    $0x2f,%eax
+  800eea:	77 17                	ja     800f03 <vprintfmt+0x239>
+  800eec:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ef0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ef3:	89 d2                	mov    %edx,%edx
+  800ef5:	48 01 d0             	add    %rdx,%rax
+  800ef8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800efb:	83 c2 08             	add    $0x8,%edx
+  800efe:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f01:	eb 0c                	jmp    800f0f <vprintfmt+0x245>
+  800f03:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f07:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f0b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f0f:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800f11:	85 db                	test   %ebx,%ebx
+  800f13:	79 02                	jns    800f17 <vprintfmt+0x24d>
+				err = -err;
+  800f15:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800f17:	83 fb 15             	cmp    $0x15,%ebx
+  800f1a:	7f 19                	jg     800f35 <vprintfmt+0x26b>
+  800f1c:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  800f23:	00 00 00 
+  800f26:	48 63 c3             	movslq %ebx,%rax
+  800f29:	4c 01 e2             	add    %r12,%rdx
+  800f2c:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800f30:	4d 85 ed             	test   %r13,%r13
+  800f33:	75 36                	jne    800f6b <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800f35:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f39:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f3d:	89 d9                	mov    %ebx,%ecx
+  800f3f:	48 ba 70 e4 ff ff ff 	movabs $0xffffffffffffe470,%rdx
+  800f46:	ff ff ff 
+  800f49:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800f4d:	48 89 c7             	mov    %rax,%rdi
+  800f50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f55:	49 b8 a1 92 ff ff ff 	movabs $0xffffffffffff92a1,%r8
+  800f5c:	ff ff ff 
+  800f5f:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800f63:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800f66:	e9 53 03 00 00       	jmp    8012be <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800f6b:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f6f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f73:	4c 89 e9             	mov    %r13,%rcx
+  800f76:	48 ba 79 e4 ff ff ff 	movabs $0xffffffffffffe479,%rdx
+  800f7d:	ff ff ff 
+  800f80:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800f84:	48 89 c7             	mov    %rax,%rdi
+  800f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8c:	49 b8 a1 92 ff ff ff 	movabs $0xffffffffffff92a1,%r8
+  800f93:	ff ff ff 
+  800f96:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800f9a:	41 ff d0             	call   *%r8
+			break;
+  800f9d:	e9 1c 03 00 00       	jmp    8012be <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800fa2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800fa5:	83 f8 2f             	cmp    $0x2f,%eax
+  800fa8:	77 17                	ja     800fc1 <vprintfmt+0x2f7>
+  800faa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800fae:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800fb1:	89 d2                	mov    %edx,%edx
+  800fb3:	48 01 d0             	add    %rdx,%rax
+  800fb6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800fb9:	83 c2 08             	add    $0x8,%edx
+  800fbc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800fbf:	eb 0c                	jmp    800fcd <vprintfmt+0x303>
+  800fc1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800fc5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800fc9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800fcd:	4c 8b 28             	mov    (%rax),%r13
+  800fd0:	4d 85 ed             	test   %r13,%r13
+  800fd3:	75 0e                	jne    800fe3 <vprintfmt+0x319>
+				p = "(null)";
+  800fd5:	48 b8 7c e4 ff ff ff 	movabs $0xffffffffffffe47c,%rax
+  800fdc:	ff ff ff 
+  800fdf:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800fe3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800fe7:	0f 8e 84 00 00 00    	jle    801071 <vprintfmt+0x3a7>
+  800fed:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800ff1:	74 7e                	je     801071 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ff3:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ff6:	48 98                	cltq
+  800ff8:	48 89 c6             	mov    %rax,%rsi
+  800ffb:	4c 89 ef             	mov    %r13,%rdi
+  800ffe:	4d 89 e7             	mov    %r12,%r15
+  801001:	48 b8 c6 95 ff ff ff 	movabs $0xffffffffffff95c6,%rax
+  801008:	ff ff ff 
+  80100b:	4c 01 e0             	add    %r12,%rax
+  80100e:	ff d0                	call   *%rax
+  801010:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  801013:	eb 17                	jmp    80102c <vprintfmt+0x362>
+					putch(padc, putdat);
+  801015:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  801019:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80101d:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801021:	48 89 d6             	mov    %rdx,%rsi
+  801024:	89 c7                	mov    %eax,%edi
+  801026:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801028:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80102c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801030:	7f e3                	jg     801015 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801032:	eb 3d                	jmp    801071 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801034:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  801038:	74 1e                	je     801058 <vprintfmt+0x38e>
+  80103a:	83 fb 1f             	cmp    $0x1f,%ebx
+  80103d:	7e 05                	jle    801044 <vprintfmt+0x37a>
+  80103f:	83 fb 7e             	cmp    $0x7e,%ebx
+  801042:	7e 14                	jle    801058 <vprintfmt+0x38e>
+					putch('?', putdat);
+  801044:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801048:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80104c:	48 89 c6             	mov    %rax,%rsi
+  80104f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801054:	ff d2                	call   *%rdx
+  801056:	eb 15                	jmp    80106d <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  801058:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80105b:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  80105e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801062:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801066:	48 89 c6             	mov    %rax,%rsi
+  801069:	89 cf                	mov    %ecx,%edi
+  80106b:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80106d:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801071:	4c 89 e8             	mov    %r13,%rax
+  801074:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  801078:	0f b6 00             	movzbl (%rax),%eax
+  80107b:	0f be d8             	movsbl %al,%ebx
+  80107e:	85 db                	test   %ebx,%ebx
+  801080:	74 28                	je     8010aa <vprintfmt+0x3e0>
+  801082:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801086:	78 ac                	js     801034 <vprintfmt+0x36a>
+  801088:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  80108c:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801090:	79 a2                	jns    801034 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  801092:	eb 16                	jmp    8010aa <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  801094:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801098:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80109c:	48 89 c6             	mov    %rax,%rsi
+  80109f:	bf 20 00 00 00       	mov    $0x20,%edi
+  8010a4:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  8010a6:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8010aa:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8010ae:	7f e4                	jg     801094 <vprintfmt+0x3ca>
+			break;
+  8010b0:	e9 09 02 00 00       	jmp    8012be <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  8010b5:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8010b9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8010bd:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8010c1:	0f b6 00             	movzbl (%rax),%eax
+  8010c4:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  8010c7:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  8010c8:	83 fb 2f             	cmp    $0x2f,%ebx
+  8010cb:	0f 8e ac fd ff ff    	jle    800e7d <vprintfmt+0x1b3>
+  8010d1:	e9 97 fd ff ff       	jmp    800e6d <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  8010d6:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010da:	be 03 00 00 00       	mov    $0x3,%esi
+  8010df:	48 89 c7             	mov    %rax,%rdi
+  8010e2:	48 b8 7f 8b ff ff ff 	movabs $0xffffffffffff8b7f,%rax
+  8010e9:	ff ff ff 
+  8010ec:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010f0:	ff d0                	call   *%rax
+  8010f2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  8010f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010fa:	48 85 c0             	test   %rax,%rax
+  8010fd:	79 1d                	jns    80111c <vprintfmt+0x452>
+				putch('-', putdat);
+  8010ff:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801103:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801107:	48 89 c6             	mov    %rax,%rsi
+  80110a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80110f:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  801111:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801115:	48 f7 d8             	neg    %rax
+  801118:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  80111c:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801123:	e9 de 00 00 00       	jmp    801206 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  801128:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80112c:	be 03 00 00 00       	mov    $0x3,%esi
+  801131:	48 89 c7             	mov    %rax,%rdi
+  801134:	48 b8 1e 8a ff ff ff 	movabs $0xffffffffffff8a1e,%rax
+  80113b:	ff ff ff 
+  80113e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801142:	ff d0                	call   *%rax
+  801144:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801148:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80114f:	e9 b2 00 00 00       	jmp    801206 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  801154:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801158:	be 03 00 00 00       	mov    $0x3,%esi
+  80115d:	48 89 c7             	mov    %rax,%rdi
+  801160:	48 b8 1e 8a ff ff ff 	movabs $0xffffffffffff8a1e,%rax
+  801167:	ff ff ff 
+  80116a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80116e:	ff d0                	call   *%rax
+  801170:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801174:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  80117b:	e9 86 00 00 00       	jmp    801206 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  801180:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801184:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801188:	48 89 c6             	mov    %rax,%rsi
+  80118b:	bf 30 00 00 00       	mov    $0x30,%edi
+  801190:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801192:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801196:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80119a:	48 89 c6             	mov    %rax,%rsi
+  80119d:	bf 78 00 00 00       	mov    $0x78,%edi
+  8011a2:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  8011a4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8011a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8011aa:	77 17                	ja     8011c3 <vprintfmt+0x4f9>
+  8011ac:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011b0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8011b3:	89 d2                	mov    %edx,%edx
+  8011b5:	48 01 d0             	add    %rdx,%rax
+  8011b8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8011bb:	83 c2 08             	add    $0x8,%edx
+  8011be:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8011c1:	eb 0c                	jmp    8011cf <vprintfmt+0x505>
+  8011c3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011c7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8011cb:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8011cf:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  8011d2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8011d6:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8011dd:	eb 27                	jmp    801206 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8011df:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8011e3:	be 03 00 00 00       	mov    $0x3,%esi
+  8011e8:	48 89 c7             	mov    %rax,%rdi
+  8011eb:	48 b8 1e 8a ff ff ff 	movabs $0xffffffffffff8a1e,%rax
+  8011f2:	ff ff ff 
+  8011f5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011f9:	ff d0                	call   *%rax
+  8011fb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8011ff:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801206:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  80120b:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80120e:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801211:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801215:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801219:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80121d:	45 89 c1             	mov    %r8d,%r9d
+  801220:	41 89 f8             	mov    %edi,%r8d
+  801223:	48 89 c7             	mov    %rax,%rdi
+  801226:	48 b8 46 89 ff ff ff 	movabs $0xffffffffffff8946,%rax
+  80122d:	ff ff ff 
+  801230:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801234:	ff d0                	call   *%rax
+			break;
+  801236:	e9 83 00 00 00       	jmp    8012be <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  80123b:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80123f:	be 03 00 00 00       	mov    $0x3,%esi
+  801244:	48 89 c7             	mov    %rax,%rdi
+  801247:	48 b8 1e 8a ff ff ff 	movabs $0xffffffffffff8a1e,%rax
+  80124e:	ff ff ff 
+  801251:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801255:	ff d0                	call   *%rax
+  801257:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  80125b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80125f:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801263:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801267:	48 89 ce             	mov    %rcx,%rsi
+  80126a:	48 89 c7             	mov    %rax,%rdi
+  80126d:	48 b8 39 8b ff ff ff 	movabs $0xffffffffffff8b39,%rax
+  801274:	ff ff ff 
+  801277:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80127b:	ff d0                	call   *%rax
+	
+			break;
+  80127d:	eb 3f                	jmp    8012be <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  80127f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801283:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801287:	48 89 c6             	mov    %rax,%rsi
+  80128a:	89 df                	mov    %ebx,%edi
+  80128c:	ff d2                	call   *%rdx
+			break;
+  80128e:	eb 2e                	jmp    8012be <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801290:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801294:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801298:	48 89 c6             	mov    %rax,%rsi
+  80129b:	bf 25 00 00 00       	mov    $0x25,%edi
+  8012a0:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8012a2:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8012a7:	eb 05                	jmp    8012ae <vprintfmt+0x5e4>
+  8012a9:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8012ae:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8012b2:	48 83 e8 01          	sub    $0x1,%rax
+  8012b6:	0f b6 00             	movzbl (%rax),%eax
+  8012b9:	3c 25                	cmp    $0x25,%al
+  8012bb:	75 ec                	jne    8012a9 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  8012bd:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8012be:	e9 78 fa ff ff       	jmp    800d3b <vprintfmt+0x71>
+				return;
+  8012c3:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  8012c4:	48 83 c4 60          	add    $0x60,%rsp
+  8012c8:	5b                   	pop    %rbx
+  8012c9:	41 5c                	pop    %r12
+  8012cb:	41 5d                	pop    %r13
+  8012cd:	41 5f                	pop    %r15
+  8012cf:	5d                   	pop    %rbp
+  8012d0:	c3                   	ret
+
+00000000008012d1 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  8012d1:	55                   	push   %rbp
+  8012d2:	48 89 e5             	mov    %rsp,%rbp
+  8012d5:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8012dc:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8012dc <printfmt+0xb>
+  8012e3:	49 bb 54 6d 00 00 00 	movabs $0x6d54,%r11
+  8012ea:	00 00 00 
+  8012ed:	4d 01 da             	add    %r11,%r10
+  8012f0:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8012f7:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8012fe:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801305:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80130c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801313:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80131a:	84 c0                	test   %al,%al
+  80131c:	74 20                	je     80133e <printfmt+0x6d>
+  80131e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801322:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801326:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80132a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80132e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801332:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801336:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80133a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80133e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801345:	00 00 00 
+  801348:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80134f:	00 00 00 
+  801352:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801356:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80135d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801364:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80136b:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801372:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801379:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801380:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801387:	48 89 c7             	mov    %rax,%rdi
+  80138a:	48 b8 9a 8c ff ff ff 	movabs $0xffffffffffff8c9a,%rax
+  801391:	ff ff ff 
+  801394:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801398:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  80139a:	90                   	nop
+  80139b:	c9                   	leave
+  80139c:	c3                   	ret
+
+000000000080139d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80139d:	55                   	push   %rbp
+  80139e:	48 89 e5             	mov    %rsp,%rbp
+  8013a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8013a5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013a5 <sprintputch+0x8>
+  8013ac:	49 bb 8b 6c 00 00 00 	movabs $0x6c8b,%r11
+  8013b3:	00 00 00 
+  8013b6:	4c 01 d8             	add    %r11,%rax
+  8013b9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8013bc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  8013c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013c4:	8b 40 10             	mov    0x10(%rax),%eax
+  8013c7:	8d 50 01             	lea    0x1(%rax),%edx
+  8013ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013ce:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  8013d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013d5:	48 8b 10             	mov    (%rax),%rdx
+  8013d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013dc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8013e0:	48 39 c2             	cmp    %rax,%rdx
+  8013e3:	73 17                	jae    8013fc <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8013e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013e9:	48 8b 00             	mov    (%rax),%rax
+  8013ec:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013f0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8013f4:	48 89 0a             	mov    %rcx,(%rdx)
+  8013f7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8013fa:	88 10                	mov    %dl,(%rax)
+}
+  8013fc:	90                   	nop
+  8013fd:	c9                   	leave
+  8013fe:	c3                   	ret
+
+00000000008013ff <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8013ff:	55                   	push   %rbp
+  801400:	48 89 e5             	mov    %rsp,%rbp
+  801403:	53                   	push   %rbx
+  801404:	48 83 ec 58          	sub    $0x58,%rsp
+  801408:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801408 <vsnprintf+0x9>
+  80140f:	49 bb 28 6c 00 00 00 	movabs $0x6c28,%r11
+  801416:	00 00 00 
+  801419:	4c 01 d8             	add    %r11,%rax
+  80141c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801420:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801423:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801427:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  80142b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80142f:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801433:	48 8b 0e             	mov    (%rsi),%rcx
+  801436:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  80143a:	48 89 0a             	mov    %rcx,(%rdx)
+  80143d:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801441:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801445:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801449:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80144d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801451:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801454:	48 63 d2             	movslq %edx,%rdx
+  801457:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80145b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80145f:	48 01 ca             	add    %rcx,%rdx
+  801462:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801466:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  80146d:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801472:	74 06                	je     80147a <vsnprintf+0x7b>
+  801474:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801478:	7f 07                	jg     801481 <vsnprintf+0x82>
+		return -E_INVAL;
+  80147a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80147f:	eb 34                	jmp    8014b5 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801481:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801485:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801489:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80148d:	48 bf 6d 93 ff ff ff 	movabs $0xffffffffffff936d,%rdi
+  801494:	ff ff ff 
+  801497:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  80149b:	49 b8 9a 8c ff ff ff 	movabs $0xffffffffffff8c9a,%r8
+  8014a2:	ff ff ff 
+  8014a5:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8014a9:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8014ab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8014af:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8014b2:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8014b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b9:	c9                   	leave
+  8014ba:	c3                   	ret
+
+00000000008014bb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8014bb:	55                   	push   %rbp
+  8014bc:	48 89 e5             	mov    %rsp,%rbp
+  8014bf:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8014c6:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8014c6 <snprintf+0xb>
+  8014cd:	49 bb 6a 6b 00 00 00 	movabs $0x6b6a,%r11
+  8014d4:	00 00 00 
+  8014d7:	4d 01 da             	add    %r11,%r10
+  8014da:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8014e1:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8014e7:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8014ee:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8014f5:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8014fc:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801503:	84 c0                	test   %al,%al
+  801505:	74 20                	je     801527 <snprintf+0x6c>
+  801507:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80150b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80150f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801513:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801517:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80151b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80151f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801523:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801527:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80152e:	00 00 00 
+  801531:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801538:	00 00 00 
+  80153b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80153f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801546:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80154d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801554:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80155b:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801562:	48 8b 06             	mov    (%rsi),%rax
+  801565:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801569:	48 89 01             	mov    %rax,(%rcx)
+  80156c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801570:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801574:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801578:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80157f:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801586:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  80158c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801593:	48 89 c7             	mov    %rax,%rdi
+  801596:	48 b8 cf 93 ff ff ff 	movabs $0xffffffffffff93cf,%rax
+  80159d:	ff ff ff 
+  8015a0:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8015a4:	ff d0                	call   *%rax
+  8015a6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8015ac:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8015b2:	c9                   	leave
+  8015b3:	c3                   	ret
+
+00000000008015b4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8015b4:	55                   	push   %rbp
+  8015b5:	48 89 e5             	mov    %rsp,%rbp
+  8015b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8015bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015bc <strlen+0x8>
+  8015c3:	49 bb 74 6a 00 00 00 	movabs $0x6a74,%r11
+  8015ca:	00 00 00 
+  8015cd:	4c 01 d8             	add    %r11,%rax
+  8015d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8015d4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8015db:	eb 09                	jmp    8015e6 <strlen+0x32>
+		n++;
+  8015dd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8015e1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8015e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015ea:	0f b6 00             	movzbl (%rax),%eax
+  8015ed:	84 c0                	test   %al,%al
+  8015ef:	75 ec                	jne    8015dd <strlen+0x29>
+	return n;
+  8015f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8015f4:	c9                   	leave
+  8015f5:	c3                   	ret
+
+00000000008015f6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8015f6:	55                   	push   %rbp
+  8015f7:	48 89 e5             	mov    %rsp,%rbp
+  8015fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8015fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015fe <strnlen+0x8>
+  801605:	49 bb 32 6a 00 00 00 	movabs $0x6a32,%r11
+  80160c:	00 00 00 
+  80160f:	4c 01 d8             	add    %r11,%rax
+  801612:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801616:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80161a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801621:	eb 0e                	jmp    801631 <strnlen+0x3b>
+		n++;
+  801623:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801627:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80162c:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801631:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801636:	74 0b                	je     801643 <strnlen+0x4d>
+  801638:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80163c:	0f b6 00             	movzbl (%rax),%eax
+  80163f:	84 c0                	test   %al,%al
+  801641:	75 e0                	jne    801623 <strnlen+0x2d>
+	return n;
+  801643:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801646:	c9                   	leave
+  801647:	c3                   	ret
+
+0000000000801648 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801648:	55                   	push   %rbp
+  801649:	48 89 e5             	mov    %rsp,%rbp
+  80164c:	48 83 ec 20          	sub    $0x20,%rsp
+  801650:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801650 <strcpy+0x8>
+  801657:	49 bb e0 69 00 00 00 	movabs $0x69e0,%r11
+  80165e:	00 00 00 
+  801661:	4c 01 d8             	add    %r11,%rax
+  801664:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801668:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80166c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801670:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801674:	90                   	nop
+  801675:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801679:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80167d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801681:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801685:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801689:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80168d:	0f b6 12             	movzbl (%rdx),%edx
+  801690:	88 10                	mov    %dl,(%rax)
+  801692:	0f b6 00             	movzbl (%rax),%eax
+  801695:	84 c0                	test   %al,%al
+  801697:	75 dc                	jne    801675 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801699:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80169d:	c9                   	leave
+  80169e:	c3                   	ret
+
+000000000080169f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80169f:	55                   	push   %rbp
+  8016a0:	48 89 e5             	mov    %rsp,%rbp
+  8016a3:	53                   	push   %rbx
+  8016a4:	48 83 ec 20          	sub    $0x20,%rsp
+  8016a8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8016a8 <strcat+0x9>
+  8016af:	49 bb 88 69 00 00 00 	movabs $0x6988,%r11
+  8016b6:	00 00 00 
+  8016b9:	4c 01 db             	add    %r11,%rbx
+  8016bc:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8016c0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8016c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016c8:	48 89 c7             	mov    %rax,%rdi
+  8016cb:	48 b8 84 95 ff ff ff 	movabs $0xffffffffffff9584,%rax
+  8016d2:	ff ff ff 
+  8016d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8016d9:	ff d0                	call   *%rax
+  8016db:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8016de:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016e1:	48 63 d0             	movslq %eax,%rdx
+  8016e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016e8:	48 01 c2             	add    %rax,%rdx
+  8016eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016ef:	48 89 c6             	mov    %rax,%rsi
+  8016f2:	48 89 d7             	mov    %rdx,%rdi
+  8016f5:	48 b8 18 96 ff ff ff 	movabs $0xffffffffffff9618,%rax
+  8016fc:	ff ff ff 
+  8016ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801703:	ff d0                	call   *%rax
+	return dst;
+  801705:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801709:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80170d:	c9                   	leave
+  80170e:	c3                   	ret
+
+000000000080170f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+  801713:	48 83 ec 28          	sub    $0x28,%rsp
+  801717:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801717 <strncpy+0x8>
+  80171e:	49 bb 19 69 00 00 00 	movabs $0x6919,%r11
+  801725:	00 00 00 
+  801728:	4c 01 d8             	add    %r11,%rax
+  80172b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80172f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801733:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801737:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80173b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80173f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801746:	00 
+  801747:	eb 2a                	jmp    801773 <strncpy+0x64>
+		*dst++ = *src;
+  801749:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80174d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801751:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801755:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801759:	0f b6 12             	movzbl (%rdx),%edx
+  80175c:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80175e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801762:	0f b6 00             	movzbl (%rax),%eax
+  801765:	84 c0                	test   %al,%al
+  801767:	74 05                	je     80176e <strncpy+0x5f>
+			src++;
+  801769:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80176e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801777:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80177b:	72 cc                	jb     801749 <strncpy+0x3a>
+	}
+	return ret;
+  80177d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801781:	c9                   	leave
+  801782:	c3                   	ret
+
+0000000000801783 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801783:	55                   	push   %rbp
+  801784:	48 89 e5             	mov    %rsp,%rbp
+  801787:	48 83 ec 28          	sub    $0x28,%rsp
+  80178b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80178b <strlcpy+0x8>
+  801792:	49 bb a5 68 00 00 00 	movabs $0x68a5,%r11
+  801799:	00 00 00 
+  80179c:	4c 01 d8             	add    %r11,%rax
+  80179f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017a7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8017ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017af:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8017b3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017b8:	74 3d                	je     8017f7 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8017ba:	eb 1d                	jmp    8017d9 <strlcpy+0x56>
+			*dst++ = *src++;
+  8017bc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8017c0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8017c4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8017c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017cc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8017d0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017d4:	0f b6 12             	movzbl (%rdx),%edx
+  8017d7:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8017d9:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8017de:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017e3:	74 0b                	je     8017f0 <strlcpy+0x6d>
+  8017e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017e9:	0f b6 00             	movzbl (%rax),%eax
+  8017ec:	84 c0                	test   %al,%al
+  8017ee:	75 cc                	jne    8017bc <strlcpy+0x39>
+		*dst = '\0';
+  8017f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f4:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8017f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017fb:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8017ff:	c9                   	leave
+  801800:	c3                   	ret
+
+0000000000801801 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801801:	55                   	push   %rbp
+  801802:	48 89 e5             	mov    %rsp,%rbp
+  801805:	48 83 ec 10          	sub    $0x10,%rsp
+  801809:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801809 <strcmp+0x8>
+  801810:	49 bb 27 68 00 00 00 	movabs $0x6827,%r11
+  801817:	00 00 00 
+  80181a:	4c 01 d8             	add    %r11,%rax
+  80181d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801821:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801825:	eb 0a                	jmp    801831 <strcmp+0x30>
+		p++, q++;
+  801827:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80182c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801831:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801835:	0f b6 00             	movzbl (%rax),%eax
+  801838:	84 c0                	test   %al,%al
+  80183a:	74 12                	je     80184e <strcmp+0x4d>
+  80183c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801840:	0f b6 10             	movzbl (%rax),%edx
+  801843:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801847:	0f b6 00             	movzbl (%rax),%eax
+  80184a:	38 c2                	cmp    %al,%dl
+  80184c:	74 d9                	je     801827 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80184e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801852:	0f b6 00             	movzbl (%rax),%eax
+  801855:	0f b6 d0             	movzbl %al,%edx
+  801858:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80185c:	0f b6 00             	movzbl (%rax),%eax
+  80185f:	0f b6 c0             	movzbl %al,%eax
+  801862:	29 c2                	sub    %eax,%edx
+  801864:	89 d0                	mov    %edx,%eax
+}
+  801866:	c9                   	leave
+  801867:	c3                   	ret
+
+0000000000801868 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801868:	55                   	push   %rbp
+  801869:	48 89 e5             	mov    %rsp,%rbp
+  80186c:	48 83 ec 18          	sub    $0x18,%rsp
+  801870:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801870 <strncmp+0x8>
+  801877:	49 bb c0 67 00 00 00 	movabs $0x67c0,%r11
+  80187e:	00 00 00 
+  801881:	4c 01 d8             	add    %r11,%rax
+  801884:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801888:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80188c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801890:	eb 0f                	jmp    8018a1 <strncmp+0x39>
+		n--, p++, q++;
+  801892:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801897:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80189c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8018a1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018a6:	74 1d                	je     8018c5 <strncmp+0x5d>
+  8018a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018ac:	0f b6 00             	movzbl (%rax),%eax
+  8018af:	84 c0                	test   %al,%al
+  8018b1:	74 12                	je     8018c5 <strncmp+0x5d>
+  8018b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018b7:	0f b6 10             	movzbl (%rax),%edx
+  8018ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018be:	0f b6 00             	movzbl (%rax),%eax
+  8018c1:	38 c2                	cmp    %al,%dl
+  8018c3:	74 cd                	je     801892 <strncmp+0x2a>
+	if (n == 0)
+  8018c5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018ca:	75 07                	jne    8018d3 <strncmp+0x6b>
+		return 0;
+  8018cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d1:	eb 16                	jmp    8018e9 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8018d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018d7:	0f b6 00             	movzbl (%rax),%eax
+  8018da:	0f b6 d0             	movzbl %al,%edx
+  8018dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018e1:	0f b6 00             	movzbl (%rax),%eax
+  8018e4:	0f b6 c0             	movzbl %al,%eax
+  8018e7:	29 c2                	sub    %eax,%edx
+}
+  8018e9:	89 d0                	mov    %edx,%eax
+  8018eb:	c9                   	leave
+  8018ec:	c3                   	ret
+
+00000000008018ed <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8018ed:	55                   	push   %rbp
+  8018ee:	48 89 e5             	mov    %rsp,%rbp
+  8018f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8018f5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018f5 <strchr+0x8>
+  8018fc:	49 bb 3b 67 00 00 00 	movabs $0x673b,%r11
+  801903:	00 00 00 
+  801906:	4c 01 d8             	add    %r11,%rax
+  801909:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80190d:	89 f0                	mov    %esi,%eax
+  80190f:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801912:	eb 17                	jmp    80192b <strchr+0x3e>
+		if (*s == c)
+  801914:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801918:	0f b6 00             	movzbl (%rax),%eax
+  80191b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80191e:	75 06                	jne    801926 <strchr+0x39>
+			return (char *) s;
+  801920:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801924:	eb 15                	jmp    80193b <strchr+0x4e>
+	for (; *s; s++)
+  801926:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80192b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80192f:	0f b6 00             	movzbl (%rax),%eax
+  801932:	84 c0                	test   %al,%al
+  801934:	75 de                	jne    801914 <strchr+0x27>
+	return 0;
+  801936:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80193b:	c9                   	leave
+  80193c:	c3                   	ret
+
+000000000080193d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80193d:	55                   	push   %rbp
+  80193e:	48 89 e5             	mov    %rsp,%rbp
+  801941:	48 83 ec 10          	sub    $0x10,%rsp
+  801945:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801945 <strfind+0x8>
+  80194c:	49 bb eb 66 00 00 00 	movabs $0x66eb,%r11
+  801953:	00 00 00 
+  801956:	4c 01 d8             	add    %r11,%rax
+  801959:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80195d:	89 f0                	mov    %esi,%eax
+  80195f:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801962:	eb 11                	jmp    801975 <strfind+0x38>
+		if (*s == c)
+  801964:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801968:	0f b6 00             	movzbl (%rax),%eax
+  80196b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80196e:	74 12                	je     801982 <strfind+0x45>
+	for (; *s; s++)
+  801970:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801975:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801979:	0f b6 00             	movzbl (%rax),%eax
+  80197c:	84 c0                	test   %al,%al
+  80197e:	75 e4                	jne    801964 <strfind+0x27>
+  801980:	eb 01                	jmp    801983 <strfind+0x46>
+			break;
+  801982:	90                   	nop
+	return (char *) s;
+  801983:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801987:	c9                   	leave
+  801988:	c3                   	ret
+
+0000000000801989 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801989:	55                   	push   %rbp
+  80198a:	48 89 e5             	mov    %rsp,%rbp
+  80198d:	48 83 ec 18          	sub    $0x18,%rsp
+  801991:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801991 <memset+0x8>
+  801998:	49 bb 9f 66 00 00 00 	movabs $0x669f,%r11
+  80199f:	00 00 00 
+  8019a2:	4c 01 d8             	add    %r11,%rax
+  8019a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019a9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8019ac:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  8019b0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8019b5:	75 06                	jne    8019bd <memset+0x34>
+		return v;
+  8019b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019bb:	eb 69                	jmp    801a26 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8019bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019c1:	83 e0 03             	and    $0x3,%eax
+  8019c4:	48 85 c0             	test   %rax,%rax
+  8019c7:	75 48                	jne    801a11 <memset+0x88>
+  8019c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019cd:	83 e0 03             	and    $0x3,%eax
+  8019d0:	48 85 c0             	test   %rax,%rax
+  8019d3:	75 3c                	jne    801a11 <memset+0x88>
+		c &= 0xFF;
+  8019d5:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8019dc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019df:	c1 e0 18             	shl    $0x18,%eax
+  8019e2:	89 c2                	mov    %eax,%edx
+  8019e4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019e7:	c1 e0 10             	shl    $0x10,%eax
+  8019ea:	09 c2                	or     %eax,%edx
+  8019ec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019ef:	c1 e0 08             	shl    $0x8,%eax
+  8019f2:	09 d0                	or     %edx,%eax
+  8019f4:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8019f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019fb:	48 c1 e8 02          	shr    $0x2,%rax
+  8019ff:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801a02:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a06:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a09:	48 89 d7             	mov    %rdx,%rdi
+  801a0c:	fc                   	cld
+  801a0d:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801a0f:	eb 11                	jmp    801a22 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801a11:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a15:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a18:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801a1c:	48 89 d7             	mov    %rdx,%rdi
+  801a1f:	fc                   	cld
+  801a20:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801a22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a26:	c9                   	leave
+  801a27:	c3                   	ret
+
+0000000000801a28 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801a28:	55                   	push   %rbp
+  801a29:	48 89 e5             	mov    %rsp,%rbp
+  801a2c:	48 83 ec 28          	sub    $0x28,%rsp
+  801a30:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a30 <memmove+0x8>
+  801a37:	49 bb 00 66 00 00 00 	movabs $0x6600,%r11
+  801a3e:	00 00 00 
+  801a41:	4c 01 d8             	add    %r11,%rax
+  801a44:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a48:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a4c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801a50:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a54:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801a58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a5c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801a60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a64:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801a68:	0f 83 88 00 00 00    	jae    801af6 <memmove+0xce>
+  801a6e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a76:	48 01 d0             	add    %rdx,%rax
+  801a79:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801a7d:	73 77                	jae    801af6 <memmove+0xce>
+		s += n;
+  801a7f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a83:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801a87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a8b:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801a8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a93:	83 e0 03             	and    $0x3,%eax
+  801a96:	48 85 c0             	test   %rax,%rax
+  801a99:	75 3b                	jne    801ad6 <memmove+0xae>
+  801a9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a9f:	83 e0 03             	and    $0x3,%eax
+  801aa2:	48 85 c0             	test   %rax,%rax
+  801aa5:	75 2f                	jne    801ad6 <memmove+0xae>
+  801aa7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aab:	83 e0 03             	and    $0x3,%eax
+  801aae:	48 85 c0             	test   %rax,%rax
+  801ab1:	75 23                	jne    801ad6 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801ab3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ab7:	48 83 e8 04          	sub    $0x4,%rax
+  801abb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801abf:	48 83 ea 04          	sub    $0x4,%rdx
+  801ac3:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801ac7:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801acb:	48 89 c7             	mov    %rax,%rdi
+  801ace:	48 89 d6             	mov    %rdx,%rsi
+  801ad1:	fd                   	std
+  801ad2:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801ad4:	eb 1d                	jmp    801af3 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801ad6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ada:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ade:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ae2:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801ae6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aea:	48 89 d7             	mov    %rdx,%rdi
+  801aed:	48 89 c1             	mov    %rax,%rcx
+  801af0:	fd                   	std
+  801af1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801af3:	fc                   	cld
+  801af4:	eb 57                	jmp    801b4d <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801af6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801afa:	83 e0 03             	and    $0x3,%eax
+  801afd:	48 85 c0             	test   %rax,%rax
+  801b00:	75 36                	jne    801b38 <memmove+0x110>
+  801b02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b06:	83 e0 03             	and    $0x3,%eax
+  801b09:	48 85 c0             	test   %rax,%rax
+  801b0c:	75 2a                	jne    801b38 <memmove+0x110>
+  801b0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b12:	83 e0 03             	and    $0x3,%eax
+  801b15:	48 85 c0             	test   %rax,%rax
+  801b18:	75 1e                	jne    801b38 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801b1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b1e:	48 c1 e8 02          	shr    $0x2,%rax
+  801b22:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801b25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b29:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b2d:	48 89 c7             	mov    %rax,%rdi
+  801b30:	48 89 d6             	mov    %rdx,%rsi
+  801b33:	fc                   	cld
+  801b34:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801b36:	eb 15                	jmp    801b4d <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801b38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b3c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b40:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801b44:	48 89 c7             	mov    %rax,%rdi
+  801b47:	48 89 d6             	mov    %rdx,%rsi
+  801b4a:	fc                   	cld
+  801b4b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801b4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b51:	c9                   	leave
+  801b52:	c3                   	ret
+
+0000000000801b53 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801b53:	55                   	push   %rbp
+  801b54:	48 89 e5             	mov    %rsp,%rbp
+  801b57:	48 83 ec 18          	sub    $0x18,%rsp
+  801b5b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b5b <memcpy+0x8>
+  801b62:	49 bb d5 64 00 00 00 	movabs $0x64d5,%r11
+  801b69:	00 00 00 
+  801b6c:	4c 01 d8             	add    %r11,%rax
+  801b6f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b73:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801b77:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801b7b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b7f:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801b83:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b87:	48 89 cf             	mov    %rcx,%rdi
+  801b8a:	48 b9 f8 99 ff ff ff 	movabs $0xffffffffffff99f8,%rcx
+  801b91:	ff ff ff 
+  801b94:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801b98:	ff d0                	call   *%rax
+}
+  801b9a:	c9                   	leave
+  801b9b:	c3                   	ret
+
+0000000000801b9c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801b9c:	55                   	push   %rbp
+  801b9d:	48 89 e5             	mov    %rsp,%rbp
+  801ba0:	48 83 ec 28          	sub    $0x28,%rsp
+  801ba4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ba4 <memcmp+0x8>
+  801bab:	49 bb 8c 64 00 00 00 	movabs $0x648c,%r11
+  801bb2:	00 00 00 
+  801bb5:	4c 01 d8             	add    %r11,%rax
+  801bb8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801bbc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801bc0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801bc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bc8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801bcc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bd0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801bd4:	eb 34                	jmp    801c0a <memcmp+0x6e>
+		if (*s1 != *s2)
+  801bd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bda:	0f b6 10             	movzbl (%rax),%edx
+  801bdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801be1:	0f b6 00             	movzbl (%rax),%eax
+  801be4:	38 c2                	cmp    %al,%dl
+  801be6:	74 18                	je     801c00 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801be8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bec:	0f b6 00             	movzbl (%rax),%eax
+  801bef:	0f b6 d0             	movzbl %al,%edx
+  801bf2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bf6:	0f b6 00             	movzbl (%rax),%eax
+  801bf9:	0f b6 c0             	movzbl %al,%eax
+  801bfc:	29 c2                	sub    %eax,%edx
+  801bfe:	eb 20                	jmp    801c20 <memcmp+0x84>
+		s1++, s2++;
+  801c00:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c05:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801c0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c0e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c12:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801c16:	48 85 c0             	test   %rax,%rax
+  801c19:	75 bb                	jne    801bd6 <memcmp+0x3a>
+	}
+
+	return 0;
+  801c1b:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801c20:	89 d0                	mov    %edx,%eax
+  801c22:	c9                   	leave
+  801c23:	c3                   	ret
+
+0000000000801c24 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801c24:	55                   	push   %rbp
+  801c25:	48 89 e5             	mov    %rsp,%rbp
+  801c28:	48 83 ec 28          	sub    $0x28,%rsp
+  801c2c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c2c <memfind+0x8>
+  801c33:	49 bb 04 64 00 00 00 	movabs $0x6404,%r11
+  801c3a:	00 00 00 
+  801c3d:	4c 01 d8             	add    %r11,%rax
+  801c40:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c44:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801c47:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801c4b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c53:	48 01 d0             	add    %rdx,%rax
+  801c56:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801c5a:	eb 13                	jmp    801c6f <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801c5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c60:	0f b6 00             	movzbl (%rax),%eax
+  801c63:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801c66:	38 d0                	cmp    %dl,%al
+  801c68:	74 11                	je     801c7b <memfind+0x57>
+	for (; s < ends; s++)
+  801c6a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801c6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c73:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801c77:	72 e3                	jb     801c5c <memfind+0x38>
+  801c79:	eb 01                	jmp    801c7c <memfind+0x58>
+			break;
+  801c7b:	90                   	nop
+	return (void *) s;
+  801c7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c80:	c9                   	leave
+  801c81:	c3                   	ret
+
+0000000000801c82 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801c82:	55                   	push   %rbp
+  801c83:	48 89 e5             	mov    %rsp,%rbp
+  801c86:	48 83 ec 38          	sub    $0x38,%rsp
+  801c8a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c8a <strtol+0x8>
+  801c91:	49 bb a6 63 00 00 00 	movabs $0x63a6,%r11
+  801c98:	00 00 00 
+  801c9b:	4c 01 d8             	add    %r11,%rax
+  801c9e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ca2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801ca6:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801ca9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801cb0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801cb7:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801cb8:	eb 05                	jmp    801cbf <strtol+0x3d>
+		s++;
+  801cba:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801cbf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc3:	0f b6 00             	movzbl (%rax),%eax
+  801cc6:	3c 20                	cmp    $0x20,%al
+  801cc8:	74 f0                	je     801cba <strtol+0x38>
+  801cca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cce:	0f b6 00             	movzbl (%rax),%eax
+  801cd1:	3c 09                	cmp    $0x9,%al
+  801cd3:	74 e5                	je     801cba <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801cd5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cd9:	0f b6 00             	movzbl (%rax),%eax
+  801cdc:	3c 2b                	cmp    $0x2b,%al
+  801cde:	75 07                	jne    801ce7 <strtol+0x65>
+		s++;
+  801ce0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ce5:	eb 17                	jmp    801cfe <strtol+0x7c>
+	else if (*s == '-')
+  801ce7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ceb:	0f b6 00             	movzbl (%rax),%eax
+  801cee:	3c 2d                	cmp    $0x2d,%al
+  801cf0:	75 0c                	jne    801cfe <strtol+0x7c>
+		s++, neg = 1;
+  801cf2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cf7:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801cfe:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d02:	74 06                	je     801d0a <strtol+0x88>
+  801d04:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801d08:	75 28                	jne    801d32 <strtol+0xb0>
+  801d0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d0e:	0f b6 00             	movzbl (%rax),%eax
+  801d11:	3c 30                	cmp    $0x30,%al
+  801d13:	75 1d                	jne    801d32 <strtol+0xb0>
+  801d15:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d19:	48 83 c0 01          	add    $0x1,%rax
+  801d1d:	0f b6 00             	movzbl (%rax),%eax
+  801d20:	3c 78                	cmp    $0x78,%al
+  801d22:	75 0e                	jne    801d32 <strtol+0xb0>
+		s += 2, base = 16;
+  801d24:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801d29:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801d30:	eb 2c                	jmp    801d5e <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801d32:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d36:	75 19                	jne    801d51 <strtol+0xcf>
+  801d38:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d3c:	0f b6 00             	movzbl (%rax),%eax
+  801d3f:	3c 30                	cmp    $0x30,%al
+  801d41:	75 0e                	jne    801d51 <strtol+0xcf>
+		s++, base = 8;
+  801d43:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d48:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801d4f:	eb 0d                	jmp    801d5e <strtol+0xdc>
+	else if (base == 0)
+  801d51:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d55:	75 07                	jne    801d5e <strtol+0xdc>
+		base = 10;
+  801d57:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801d5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d62:	0f b6 00             	movzbl (%rax),%eax
+  801d65:	3c 2f                	cmp    $0x2f,%al
+  801d67:	7e 1d                	jle    801d86 <strtol+0x104>
+  801d69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d6d:	0f b6 00             	movzbl (%rax),%eax
+  801d70:	3c 39                	cmp    $0x39,%al
+  801d72:	7f 12                	jg     801d86 <strtol+0x104>
+			dig = *s - '0';
+  801d74:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d78:	0f b6 00             	movzbl (%rax),%eax
+  801d7b:	0f be c0             	movsbl %al,%eax
+  801d7e:	83 e8 30             	sub    $0x30,%eax
+  801d81:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d84:	eb 4e                	jmp    801dd4 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801d86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d8a:	0f b6 00             	movzbl (%rax),%eax
+  801d8d:	3c 60                	cmp    $0x60,%al
+  801d8f:	7e 1d                	jle    801dae <strtol+0x12c>
+  801d91:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d95:	0f b6 00             	movzbl (%rax),%eax
+  801d98:	3c 7a                	cmp    $0x7a,%al
+  801d9a:	7f 12                	jg     801dae <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801d9c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801da0:	0f b6 00             	movzbl (%rax),%eax
+  801da3:	0f be c0             	movsbl %al,%eax
+  801da6:	83 e8 57             	sub    $0x57,%eax
+  801da9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801dac:	eb 26                	jmp    801dd4 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801dae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801db2:	0f b6 00             	movzbl (%rax),%eax
+  801db5:	3c 40                	cmp    $0x40,%al
+  801db7:	7e 47                	jle    801e00 <strtol+0x17e>
+  801db9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dbd:	0f b6 00             	movzbl (%rax),%eax
+  801dc0:	3c 5a                	cmp    $0x5a,%al
+  801dc2:	7f 3c                	jg     801e00 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801dc4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dc8:	0f b6 00             	movzbl (%rax),%eax
+  801dcb:	0f be c0             	movsbl %al,%eax
+  801dce:	83 e8 37             	sub    $0x37,%eax
+  801dd1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801dd4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801dd7:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801dda:	7d 23                	jge    801dff <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801ddc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801de1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801de4:	48 98                	cltq
+  801de6:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801deb:	48 89 c2             	mov    %rax,%rdx
+  801dee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801df1:	48 98                	cltq
+  801df3:	48 01 d0             	add    %rdx,%rax
+  801df6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801dfa:	e9 5f ff ff ff       	jmp    801d5e <strtol+0xdc>
+			break;
+  801dff:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801e00:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801e05:	74 0b                	je     801e12 <strtol+0x190>
+		*endptr = (char *) s;
+  801e07:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e0b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801e0f:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801e12:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801e16:	74 09                	je     801e21 <strtol+0x19f>
+  801e18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e1c:	48 f7 d8             	neg    %rax
+  801e1f:	eb 04                	jmp    801e25 <strtol+0x1a3>
+  801e21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801e25:	c9                   	leave
+  801e26:	c3                   	ret
+
+0000000000801e27 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801e27:	55                   	push   %rbp
+  801e28:	48 89 e5             	mov    %rsp,%rbp
+  801e2b:	53                   	push   %rbx
+  801e2c:	48 83 ec 30          	sub    $0x30,%rsp
+  801e30:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801e30 <strstr+0x9>
+  801e37:	49 bb 00 62 00 00 00 	movabs $0x6200,%r11
+  801e3e:	00 00 00 
+  801e41:	4c 01 db             	add    %r11,%rbx
+  801e44:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801e48:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801e4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e50:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e54:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e58:	0f b6 00             	movzbl (%rax),%eax
+  801e5b:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801e5e:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801e62:	75 06                	jne    801e6a <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801e64:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e68:	eb 73                	jmp    801edd <strstr+0xb6>
+
+	len = strlen(str);
+  801e6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e6e:	48 89 c7             	mov    %rax,%rdi
+  801e71:	48 b8 84 95 ff ff ff 	movabs $0xffffffffffff9584,%rax
+  801e78:	ff ff ff 
+  801e7b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e7f:	ff d0                	call   *%rax
+  801e81:	48 98                	cltq
+  801e83:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801e87:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e8b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e8f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801e93:	0f b6 00             	movzbl (%rax),%eax
+  801e96:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801e99:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801e9d:	75 07                	jne    801ea6 <strstr+0x7f>
+				return (char *) 0;
+  801e9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea4:	eb 37                	jmp    801edd <strstr+0xb6>
+		} while (sc != c);
+  801ea6:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801eaa:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801ead:	75 d8                	jne    801e87 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801eaf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801eb3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801eb7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ebb:	48 89 ce             	mov    %rcx,%rsi
+  801ebe:	48 89 c7             	mov    %rax,%rdi
+  801ec1:	48 b8 38 98 ff ff ff 	movabs $0xffffffffffff9838,%rax
+  801ec8:	ff ff ff 
+  801ecb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801ecf:	ff d0                	call   *%rax
+  801ed1:	85 c0                	test   %eax,%eax
+  801ed3:	75 b2                	jne    801e87 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801ed5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ed9:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801edd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ee1:	c9                   	leave
+  801ee2:	c3                   	ret
+
+0000000000801ee3 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801ee3:	55                   	push   %rbp
+  801ee4:	48 89 e5             	mov    %rsp,%rbp
+  801ee7:	41 57                	push   %r15
+  801ee9:	53                   	push   %rbx
+  801eea:	48 83 ec 40          	sub    $0x40,%rsp
+  801eee:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801eee <syscall+0xb>
+  801ef5:	49 bb 42 61 00 00 00 	movabs $0x6142,%r11
+  801efc:	00 00 00 
+  801eff:	4d 01 da             	add    %r11,%r10
+  801f02:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801f05:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801f08:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801f0c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801f10:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801f14:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801f18:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f1b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801f1f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801f23:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801f27:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801f2b:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f2f:	4c 89 c3             	mov    %r8,%rbx
+  801f32:	cd 30                	int    $0x30
+  801f34:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801f38:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801f3c:	74 52                	je     801f90 <syscall+0xad>
+  801f3e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f43:	7e 4b                	jle    801f90 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f45:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f49:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f4c:	49 89 d0             	mov    %rdx,%r8
+  801f4f:	89 c1                	mov    %eax,%ecx
+  801f51:	48 b8 38 e7 ff ff ff 	movabs $0xffffffffffffe738,%rax
+  801f58:	ff ff ff 
+  801f5b:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801f5f:	48 89 c2             	mov    %rax,%rdx
+  801f62:	be 23 00 00 00       	mov    $0x23,%esi
+  801f67:	48 b8 55 e7 ff ff ff 	movabs $0xffffffffffffe755,%rax
+  801f6e:	ff ff ff 
+  801f71:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801f75:	48 89 c7             	mov    %rax,%rdi
+  801f78:	4d 89 d7             	mov    %r10,%r15
+  801f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f80:	49 b9 7f 85 ff ff ff 	movabs $0xffffffffffff857f,%r9
+  801f87:	ff ff ff 
+  801f8a:	4d 01 d1             	add    %r10,%r9
+  801f8d:	41 ff d1             	call   *%r9
+
+	return ret;
+  801f90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801f94:	48 83 c4 40          	add    $0x40,%rsp
+  801f98:	5b                   	pop    %rbx
+  801f99:	41 5f                	pop    %r15
+  801f9b:	5d                   	pop    %rbp
+  801f9c:	c3                   	ret
+
+0000000000801f9d <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801f9d:	55                   	push   %rbp
+  801f9e:	48 89 e5             	mov    %rsp,%rbp
+  801fa1:	41 57                	push   %r15
+  801fa3:	41 56                	push   %r14
+  801fa5:	41 55                	push   %r13
+  801fa7:	41 54                	push   %r12
+  801fa9:	53                   	push   %rbx
+  801faa:	48 83 ec 48          	sub    $0x48,%rsp
+  801fae:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801fae <syscall_words+0x11>
+  801fb5:	49 bb 82 60 00 00 00 	movabs $0x6082,%r11
+  801fbc:	00 00 00 
+  801fbf:	4d 01 de             	add    %r11,%r14
+  801fc2:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801fc5:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801fc8:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801fcc:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801fd0:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801fd4:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801fd8:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fdd:	74 09                	je     801fe8 <syscall_words+0x4b>
+  801fdf:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fe3:	48 8b 00             	mov    (%rax),%rax
+  801fe6:	eb 05                	jmp    801fed <syscall_words+0x50>
+  801fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fed:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801ff0:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ff5:	74 0a                	je     802001 <syscall_words+0x64>
+  801ff7:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ffb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fff:	eb 05                	jmp    802006 <syscall_words+0x69>
+  802001:	b8 00 00 00 00       	mov    $0x0,%eax
+  802006:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  802009:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80200e:	74 0a                	je     80201a <syscall_words+0x7d>
+  802010:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802014:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802018:	eb 05                	jmp    80201f <syscall_words+0x82>
+  80201a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201f:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  802022:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802027:	74 0a                	je     802033 <syscall_words+0x96>
+  802029:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80202d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802031:	eb 05                	jmp    802038 <syscall_words+0x9b>
+  802033:	b8 00 00 00 00       	mov    $0x0,%eax
+  802038:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  80203b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802040:	74 0a                	je     80204c <syscall_words+0xaf>
+  802042:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802046:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80204a:	eb 05                	jmp    802051 <syscall_words+0xb4>
+  80204c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802051:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  802054:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802059:	74 0a                	je     802065 <syscall_words+0xc8>
+  80205b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80205f:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802063:	eb 05                	jmp    80206a <syscall_words+0xcd>
+  802065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80206a:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  80206d:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802070:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802074:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802078:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  80207c:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  802080:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802084:	cd 30                	int    $0x30
+  802086:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  80208a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80208f:	74 50                	je     8020e1 <syscall_words+0x144>
+		words[0] = r8;
+  802091:	4c 89 c2             	mov    %r8,%rdx
+  802094:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802098:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  80209b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80209f:	48 83 c0 08          	add    $0x8,%rax
+  8020a3:	4c 89 ca             	mov    %r9,%rdx
+  8020a6:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  8020a9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020ad:	48 83 c0 10          	add    $0x10,%rax
+  8020b1:	4c 89 d2             	mov    %r10,%rdx
+  8020b4:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  8020b7:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020bb:	48 83 c0 18          	add    $0x18,%rax
+  8020bf:	4c 89 da             	mov    %r11,%rdx
+  8020c2:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  8020c5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020c9:	48 83 c0 20          	add    $0x20,%rax
+  8020cd:	4c 89 e2             	mov    %r12,%rdx
+  8020d0:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  8020d3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020d7:	48 83 c0 28          	add    $0x28,%rax
+  8020db:	4c 89 ea             	mov    %r13,%rdx
+  8020de:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  8020e1:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8020e5:	74 52                	je     802139 <syscall_words+0x19c>
+  8020e7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8020ec:	7e 4b                	jle    802139 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020ee:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8020f2:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8020f5:	49 89 d0             	mov    %rdx,%r8
+  8020f8:	89 c1                	mov    %eax,%ecx
+  8020fa:	48 b8 38 e7 ff ff ff 	movabs $0xffffffffffffe738,%rax
+  802101:	ff ff ff 
+  802104:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802108:	48 89 c2             	mov    %rax,%rdx
+  80210b:	be 4e 00 00 00       	mov    $0x4e,%esi
+  802110:	48 b8 55 e7 ff ff ff 	movabs $0xffffffffffffe755,%rax
+  802117:	ff ff ff 
+  80211a:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  80211e:	48 89 c7             	mov    %rax,%rdi
+  802121:	4d 89 f7             	mov    %r14,%r15
+  802124:	b8 00 00 00 00       	mov    $0x0,%eax
+  802129:	49 b9 7f 85 ff ff ff 	movabs $0xffffffffffff857f,%r9
+  802130:	ff ff ff 
+  802133:	4d 01 f1             	add    %r14,%r9
+  802136:	41 ff d1             	call   *%r9
+
+	return ret;
+  802139:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80213d:	48 83 c4 48          	add    $0x48,%rsp
+  802141:	5b                   	pop    %rbx
+  802142:	41 5c                	pop    %r12
+  802144:	41 5d                	pop    %r13
+  802146:	41 5e                	pop    %r14
+  802148:	41 5f                	pop    %r15
+  80214a:	5d                   	pop    %rbp
+  80214b:	c3                   	ret
+
+000000000080214c <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80214c:	55                   	push   %rbp
+  80214d:	48 89 e5             	mov    %rsp,%rbp
+  802150:	48 83 ec 10          	sub    $0x10,%rsp
+  802154:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802154 <sys_cputs+0x8>
+  80215b:	49 bb dc 5e 00 00 00 	movabs $0x5edc,%r11
+  802162:	00 00 00 
+  802165:	4c 01 d8             	add    %r11,%rax
+  802168:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80216c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802170:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802174:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802178:	48 83 ec 08          	sub    $0x8,%rsp
+  80217c:	6a 00                	push   $0x0
+  80217e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802184:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80218a:	be 00 00 00 00       	mov    $0x0,%esi
+  80218f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802194:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  80219b:	ff ff ff 
+  80219e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021a2:	ff d0                	call   *%rax
+  8021a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021a8:	90                   	nop
+  8021a9:	c9                   	leave
+  8021aa:	c3                   	ret
+
+00000000008021ab <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8021ab:	55                   	push   %rbp
+  8021ac:	48 89 e5             	mov    %rsp,%rbp
+  8021af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021af <sys_cgetc+0x4>
+  8021b6:	49 bb 81 5e 00 00 00 	movabs $0x5e81,%r11
+  8021bd:	00 00 00 
+  8021c0:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8021c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c7:	6a 00                	push   $0x0
+  8021c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021df:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021e9:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  8021f0:	ff ff ff 
+  8021f3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021f7:	ff d0                	call   *%rax
+  8021f9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021fd:	c9                   	leave
+  8021fe:	c3                   	ret
+
+00000000008021ff <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8021ff:	55                   	push   %rbp
+  802200:	48 89 e5             	mov    %rsp,%rbp
+  802203:	48 83 ec 10          	sub    $0x10,%rsp
+  802207:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802207 <sys_env_destroy+0x8>
+  80220e:	49 bb 29 5e 00 00 00 	movabs $0x5e29,%r11
+  802215:	00 00 00 
+  802218:	4c 01 d8             	add    %r11,%rax
+  80221b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80221e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802221:	48 63 d2             	movslq %edx,%rdx
+  802224:	48 83 ec 08          	sub    $0x8,%rsp
+  802228:	6a 00                	push   $0x0
+  80222a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802230:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802236:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80223b:	be 01 00 00 00       	mov    $0x1,%esi
+  802240:	bf 03 00 00 00       	mov    $0x3,%edi
+  802245:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  80224c:	ff ff ff 
+  80224f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802253:	ff d0                	call   *%rax
+  802255:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802259:	c9                   	leave
+  80225a:	c3                   	ret
+
+000000000080225b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80225b:	55                   	push   %rbp
+  80225c:	48 89 e5             	mov    %rsp,%rbp
+  80225f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80225f <sys_getenvid+0x4>
+  802266:	49 bb d1 5d 00 00 00 	movabs $0x5dd1,%r11
+  80226d:	00 00 00 
+  802270:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802273:	48 83 ec 08          	sub    $0x8,%rsp
+  802277:	6a 00                	push   $0x0
+  802279:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80227f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802285:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80228a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228f:	be 00 00 00 00       	mov    $0x0,%esi
+  802294:	bf 02 00 00 00       	mov    $0x2,%edi
+  802299:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  8022a0:	ff ff ff 
+  8022a3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022a7:	ff d0                	call   *%rax
+  8022a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ad:	c9                   	leave
+  8022ae:	c3                   	ret
+
+00000000008022af <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8022af:	55                   	push   %rbp
+  8022b0:	48 89 e5             	mov    %rsp,%rbp
+  8022b3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022b3 <sys_yield+0x4>
+  8022ba:	49 bb 7d 5d 00 00 00 	movabs $0x5d7d,%r11
+  8022c1:	00 00 00 
+  8022c4:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8022c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8022cb:	6a 00                	push   $0x0
+  8022cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8022ed:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  8022f4:	ff ff ff 
+  8022f7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022fb:	ff d0                	call   *%rax
+  8022fd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802301:	90                   	nop
+  802302:	c9                   	leave
+  802303:	c3                   	ret
+
+0000000000802304 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802304:	55                   	push   %rbp
+  802305:	48 89 e5             	mov    %rsp,%rbp
+  802308:	48 83 ec 10          	sub    $0x10,%rsp
+  80230c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80230c <sys_page_alloc+0x8>
+  802313:	49 bb 24 5d 00 00 00 	movabs $0x5d24,%r11
+  80231a:	00 00 00 
+  80231d:	4c 01 d8             	add    %r11,%rax
+  802320:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802323:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802327:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80232a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80232d:	48 63 f2             	movslq %edx,%rsi
+  802330:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802334:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802337:	48 63 d2             	movslq %edx,%rdx
+  80233a:	48 83 ec 08          	sub    $0x8,%rsp
+  80233e:	6a 00                	push   $0x0
+  802340:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802346:	49 89 f0             	mov    %rsi,%r8
+  802349:	be 01 00 00 00       	mov    $0x1,%esi
+  80234e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802353:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  80235a:	ff ff ff 
+  80235d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802361:	ff d0                	call   *%rax
+  802363:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802367:	c9                   	leave
+  802368:	c3                   	ret
+
+0000000000802369 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802369:	55                   	push   %rbp
+  80236a:	48 89 e5             	mov    %rsp,%rbp
+  80236d:	48 83 ec 20          	sub    $0x20,%rsp
+  802371:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802371 <sys_page_map+0x8>
+  802378:	49 bb bf 5c 00 00 00 	movabs $0x5cbf,%r11
+  80237f:	00 00 00 
+  802382:	4c 01 d8             	add    %r11,%rax
+  802385:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802388:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80238c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80238f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802393:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802397:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80239a:	48 63 f2             	movslq %edx,%rsi
+  80239d:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8023a1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023a4:	48 63 fa             	movslq %edx,%rdi
+  8023a7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023ab:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023ae:	48 63 d2             	movslq %edx,%rdx
+  8023b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b5:	56                   	push   %rsi
+  8023b6:	4d 89 c1             	mov    %r8,%r9
+  8023b9:	49 89 f8             	mov    %rdi,%r8
+  8023bc:	be 01 00 00 00       	mov    $0x1,%esi
+  8023c1:	bf 05 00 00 00       	mov    $0x5,%edi
+  8023c6:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  8023cd:	ff ff ff 
+  8023d0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023d4:	ff d0                	call   *%rax
+  8023d6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023da:	c9                   	leave
+  8023db:	c3                   	ret
+
+00000000008023dc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8023dc:	55                   	push   %rbp
+  8023dd:	48 89 e5             	mov    %rsp,%rbp
+  8023e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8023e4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023e4 <sys_page_unmap+0x8>
+  8023eb:	49 bb 4c 5c 00 00 00 	movabs $0x5c4c,%r11
+  8023f2:	00 00 00 
+  8023f5:	4c 01 d8             	add    %r11,%rax
+  8023f8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8023ff:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802403:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802406:	48 63 d2             	movslq %edx,%rdx
+  802409:	48 83 ec 08          	sub    $0x8,%rsp
+  80240d:	6a 00                	push   $0x0
+  80240f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80241b:	be 01 00 00 00       	mov    $0x1,%esi
+  802420:	bf 06 00 00 00       	mov    $0x6,%edi
+  802425:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  80242c:	ff ff ff 
+  80242f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802433:	ff d0                	call   *%rax
+  802435:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802439:	c9                   	leave
+  80243a:	c3                   	ret
+
+000000000080243b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80243b:	55                   	push   %rbp
+  80243c:	48 89 e5             	mov    %rsp,%rbp
+  80243f:	48 83 ec 10          	sub    $0x10,%rsp
+  802443:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802443 <sys_env_set_status+0x8>
+  80244a:	49 bb ed 5b 00 00 00 	movabs $0x5bed,%r11
+  802451:	00 00 00 
+  802454:	4c 01 d8             	add    %r11,%rax
+  802457:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80245a:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80245d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802460:	48 63 ca             	movslq %edx,%rcx
+  802463:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802466:	48 63 d2             	movslq %edx,%rdx
+  802469:	48 83 ec 08          	sub    $0x8,%rsp
+  80246d:	6a 00                	push   $0x0
+  80246f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802475:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80247b:	be 01 00 00 00       	mov    $0x1,%esi
+  802480:	bf 08 00 00 00       	mov    $0x8,%edi
+  802485:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  80248c:	ff ff ff 
+  80248f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802493:	ff d0                	call   *%rax
+  802495:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802499:	c9                   	leave
+  80249a:	c3                   	ret
+
+000000000080249b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80249b:	55                   	push   %rbp
+  80249c:	48 89 e5             	mov    %rsp,%rbp
+  80249f:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024a3 <sys_env_set_trapframe+0x8>
+  8024aa:	49 bb 8d 5b 00 00 00 	movabs $0x5b8d,%r11
+  8024b1:	00 00 00 
+  8024b4:	4c 01 d8             	add    %r11,%rax
+  8024b7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8024be:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024c2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024c5:	48 63 d2             	movslq %edx,%rdx
+  8024c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8024cc:	6a 00                	push   $0x0
+  8024ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024da:	be 01 00 00 00       	mov    $0x1,%esi
+  8024df:	bf 09 00 00 00       	mov    $0x9,%edi
+  8024e4:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  8024eb:	ff ff ff 
+  8024ee:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024f2:	ff d0                	call   *%rax
+  8024f4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024f8:	c9                   	leave
+  8024f9:	c3                   	ret
+
+00000000008024fa <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8024fa:	55                   	push   %rbp
+  8024fb:	48 89 e5             	mov    %rsp,%rbp
+  8024fe:	48 83 ec 10          	sub    $0x10,%rsp
+  802502:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802502 <sys_env_set_pgfault_upcall+0x8>
+  802509:	49 bb 2e 5b 00 00 00 	movabs $0x5b2e,%r11
+  802510:	00 00 00 
+  802513:	4c 01 d8             	add    %r11,%rax
+  802516:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802519:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80251d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802521:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802524:	48 63 d2             	movslq %edx,%rdx
+  802527:	48 83 ec 08          	sub    $0x8,%rsp
+  80252b:	6a 00                	push   $0x0
+  80252d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802533:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802539:	be 01 00 00 00       	mov    $0x1,%esi
+  80253e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802543:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  80254a:	ff ff ff 
+  80254d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802551:	ff d0                	call   *%rax
+  802553:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802557:	c9                   	leave
+  802558:	c3                   	ret
+
+0000000000802559 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802559:	55                   	push   %rbp
+  80255a:	48 89 e5             	mov    %rsp,%rbp
+  80255d:	48 83 ec 20          	sub    $0x20,%rsp
+  802561:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802561 <sys_ipc_try_send+0x8>
+  802568:	49 bb cf 5a 00 00 00 	movabs $0x5acf,%r11
+  80256f:	00 00 00 
+  802572:	4c 01 d8             	add    %r11,%rax
+  802575:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802578:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80257c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802580:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802583:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802586:	48 63 fa             	movslq %edx,%rdi
+  802589:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80258d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802590:	48 63 d2             	movslq %edx,%rdx
+  802593:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802597:	48 83 ec 08          	sub    $0x8,%rsp
+  80259b:	6a 00                	push   $0x0
+  80259d:	49 89 f9             	mov    %rdi,%r9
+  8025a0:	49 89 f0             	mov    %rsi,%r8
+  8025a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a8:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8025ad:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  8025b4:	ff ff ff 
+  8025b7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025bb:	ff d0                	call   *%rax
+  8025bd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025c1:	c9                   	leave
+  8025c2:	c3                   	ret
+
+00000000008025c3 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8025c3:	55                   	push   %rbp
+  8025c4:	48 89 e5             	mov    %rsp,%rbp
+  8025c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8025cb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025cb <sys_ipc_send+0x8>
+  8025d2:	49 bb 65 5a 00 00 00 	movabs $0x5a65,%r11
+  8025d9:	00 00 00 
+  8025dc:	4c 01 d8             	add    %r11,%rax
+  8025df:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025e6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025ea:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8025ed:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025f0:	48 63 fa             	movslq %edx,%rdi
+  8025f3:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8025f7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025fa:	48 63 d2             	movslq %edx,%rdx
+  8025fd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802601:	48 83 ec 08          	sub    $0x8,%rsp
+  802605:	6a 00                	push   $0x0
+  802607:	49 89 f9             	mov    %rdi,%r9
+  80260a:	49 89 f0             	mov    %rsi,%r8
+  80260d:	be 00 00 00 00       	mov    $0x0,%esi
+  802612:	bf 17 00 00 00       	mov    $0x17,%edi
+  802617:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  80261e:	ff ff ff 
+  802621:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802625:	ff d0                	call   *%rax
+  802627:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80262b:	c9                   	leave
+  80262c:	c3                   	ret
+
+000000000080262d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80262d:	55                   	push   %rbp
+  80262e:	48 89 e5             	mov    %rsp,%rbp
+  802631:	48 83 ec 10          	sub    $0x10,%rsp
+  802635:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802635 <sys_ipc_recv+0x8>
+  80263c:	49 bb fb 59 00 00 00 	movabs $0x59fb,%r11
+  802643:	00 00 00 
+  802646:	4c 01 d8             	add    %r11,%rax
+  802649:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80264d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802651:	6a 00                	push   $0x0
+  802653:	6a 00                	push   $0x0
+  802655:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80265b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802661:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802666:	be 01 00 00 00       	mov    $0x1,%esi
+  80266b:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802670:	49 ba 6d 9f ff ff ff 	movabs $0xffffffffffff9f6d,%r10
+  802677:	ff ff ff 
+  80267a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80267e:	ff d0                	call   *%rax
+  802680:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802684:	c9                   	leave
+  802685:	c3                   	ret
+
+0000000000802686 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802686:	55                   	push   %rbp
+  802687:	48 89 e5             	mov    %rsp,%rbp
+  80268a:	48 83 ec 30          	sub    $0x30,%rsp
+  80268e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80268e <sys_ipc_call+0x8>
+  802695:	49 bb a2 59 00 00 00 	movabs $0x59a2,%r11
+  80269c:	00 00 00 
+  80269f:	4c 01 d8             	add    %r11,%rax
+  8026a2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026a5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026a9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8026ad:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8026b0:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8026b4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8026b8:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8026bc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026bf:	4c 63 c2             	movslq %edx,%r8
+  8026c2:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8026c6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026c9:	48 63 d2             	movslq %edx,%rdx
+  8026cc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026d0:	ff 75 d8             	push   -0x28(%rbp)
+  8026d3:	56                   	push   %rsi
+  8026d4:	4d 89 c1             	mov    %r8,%r9
+  8026d7:	49 89 f8             	mov    %rdi,%r8
+  8026da:	be 00 00 00 00       	mov    $0x0,%esi
+  8026df:	bf 18 00 00 00       	mov    $0x18,%edi
+  8026e4:	49 ba 6d 9f ff ff ff 	movabs $0xffffffffffff9f6d,%r10
+  8026eb:	ff ff ff 
+  8026ee:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026f2:	ff d0                	call   *%rax
+  8026f4:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8026f8:	c9                   	leave
+  8026f9:	c3                   	ret
+
+00000000008026fa <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8026fa:	55                   	push   %rbp
+  8026fb:	48 89 e5             	mov    %rsp,%rbp
+  8026fe:	48 83 ec 30          	sub    $0x30,%rsp
+  802702:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802702 <sys_ipc_reply_recv+0x8>
+  802709:	49 bb 2e 59 00 00 00 	movabs $0x592e,%r11
+  802710:	00 00 00 
+  802713:	4c 01 d8             	add    %r11,%rax
+  802716:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802719:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80271d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802721:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802724:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802728:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80272c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802730:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802733:	4c 63 c2             	movslq %edx,%r8
+  802736:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80273a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80273d:	48 63 d2             	movslq %edx,%rdx
+  802740:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802744:	ff 75 d8             	push   -0x28(%rbp)
+  802747:	56                   	push   %rsi
+  802748:	4d 89 c1             	mov    %r8,%r9
+  80274b:	49 89 f8             	mov    %rdi,%r8
+  80274e:	be 00 00 00 00       	mov    $0x0,%esi
+  802753:	bf 19 00 00 00       	mov    $0x19,%edi
+  802758:	49 ba 6d 9f ff ff ff 	movabs $0xffffffffffff9f6d,%r10
+  80275f:	ff ff ff 
+  802762:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802766:	ff d0                	call   *%rax
+  802768:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  80276c:	c9                   	leave
+  80276d:	c3                   	ret
+
+000000000080276e <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80276e:	55                   	push   %rbp
+  80276f:	48 89 e5             	mov    %rsp,%rbp
+  802772:	48 83 ec 10          	sub    $0x10,%rsp
+  802776:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802776 <sys_env_set_priority+0x8>
+  80277d:	49 bb ba 58 00 00 00 	movabs $0x58ba,%r11
+  802784:	00 00 00 
+  802787:	4c 01 d8             	add    %r11,%rax
+  80278a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80278d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802790:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802793:	48 63 ca             	movslq %edx,%rcx
+  802796:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802799:	48 63 d2             	movslq %edx,%rdx
+  80279c:	48 83 ec 08          	sub    $0x8,%rsp
+  8027a0:	6a 00                	push   $0x0
+  8027a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027ae:	be 01 00 00 00       	mov    $0x1,%esi
+  8027b3:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8027b8:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  8027bf:	ff ff ff 
+  8027c2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027c6:	ff d0                	call   *%rax
+  8027c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027cc:	c9                   	leave
+  8027cd:	c3                   	ret
+
+00000000008027ce <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8027ce:	55                   	push   %rbp
+  8027cf:	48 89 e5             	mov    %rsp,%rbp
+  8027d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8027d6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027d6 <sys_env_set_affinity+0x8>
+  8027dd:	49 bb 5a 58 00 00 00 	movabs $0x585a,%r11
+  8027e4:	00 00 00 
+  8027e7:	4c 01 d8             	add    %r11,%rax
+  8027ea:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027ed:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8027f0:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8027f3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027f6:	48 63 d2             	movslq %edx,%rdx
+  8027f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8027fd:	6a 00                	push   $0x0
+  8027ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802805:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80280b:	be 01 00 00 00       	mov    $0x1,%esi
+  802810:	bf 10 00 00 00       	mov    $0x10,%edi
+  802815:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  80281c:	ff ff ff 
+  80281f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802823:	ff d0                	call   *%rax
+  802825:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802829:	c9                   	leave
+  80282a:	c3                   	ret
+
+000000000080282b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80282b:	55                   	push   %rbp
+  80282c:	48 89 e5             	mov    %rsp,%rbp
+  80282f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80282f <sys_time_msec+0x4>
+  802836:	49 bb 01 58 00 00 00 	movabs $0x5801,%r11
+  80283d:	00 00 00 
+  802840:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802843:	48 83 ec 08          	sub    $0x8,%rsp
+  802847:	6a 00                	push   $0x0
+  802849:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80284f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802855:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80285a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80285f:	be 00 00 00 00       	mov    $0x0,%esi
+  802864:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802869:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  802870:	ff ff ff 
+  802873:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802877:	ff d0                	call   *%rax
+  802879:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80287d:	c9                   	leave
+  80287e:	c3                   	ret
+
+000000000080287f <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80287f:	55                   	push   %rbp
+  802880:	48 89 e5             	mov    %rsp,%rbp
+  802883:	48 83 ec 10          	sub    $0x10,%rsp
+  802887:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802887 <sys_sleep_usec+0x8>
+  80288e:	49 bb a9 57 00 00 00 	movabs $0x57a9,%r11
+  802895:	00 00 00 
+  802898:	4c 01 d8             	add    %r11,%rax
+  80289b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  80289f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a7:	6a 00                	push   $0x0
+  8028a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8028bf:	bf 11 00 00 00       	mov    $0x11,%edi
+  8028c4:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  8028cb:	ff ff ff 
+  8028ce:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028d2:	ff d0                	call   *%rax
+  8028d4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028d8:	c9                   	leave
+  8028d9:	c3                   	ret
+
+00000000008028da <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8028da:	55                   	push   %rbp
+  8028db:	48 89 e5             	mov    %rsp,%rbp
+  8028de:	48 83 ec 10          	sub    $0x10,%rsp
+  8028e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028e2 <sys_page_alloc_huge+0x8>
+  8028e9:	49 bb 4e 57 00 00 00 	movabs $0x574e,%r11
+  8028f0:	00 00 00 
+  8028f3:	4c 01 d8             	add    %r11,%rax
+  8028f6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028fd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802900:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802903:	48 63 f2             	movslq %edx,%rsi
+  802906:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80290a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80290d:	48 63 d2             	movslq %edx,%rdx
+  802910:	48 83 ec 08          	sub    $0x8,%rsp
+  802914:	6a 00                	push   $0x0
+  802916:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80291c:	49 89 f0             	mov    %rsi,%r8
+  80291f:	be 01 00 00 00       	mov    $0x1,%esi
+  802924:	bf 12 00 00 00       	mov    $0x12,%edi
+  802929:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  802930:	ff ff ff 
+  802933:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802937:	ff d0                	call   *%rax
+  802939:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80293d:	c9                   	leave
+  80293e:	c3                   	ret
+
+000000000080293f <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80293f:	55                   	push   %rbp
+  802940:	48 89 e5             	mov    %rsp,%rbp
+  802943:	48 83 ec 10          	sub    $0x10,%rsp
+  802947:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802947 <sys_page_map_batch+0x8>
+  80294e:	49 bb e9 56 00 00 00 	movabs $0x56e9,%r11
+  802955:	00 00 00 
+  802958:	4c 01 d8             	add    %r11,%rax
+  80295b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80295f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802963:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802967:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80296b:	48 83 ec 08          	sub    $0x8,%rsp
+  80296f:	6a 00                	push   $0x0
+  802971:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802977:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80297d:	be 01 00 00 00       	mov    $0x1,%esi
+  802982:	bf 13 00 00 00       	mov    $0x13,%edi
+  802987:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  80298e:	ff ff ff 
+  802991:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802995:	ff d0                	call   *%rax
+  802997:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80299b:	c9                   	leave
+  80299c:	c3                   	ret
+
+000000000080299d <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  80299d:	55                   	push   %rbp
+  80299e:	48 89 e5             	mov    %rsp,%rbp
+  8029a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8029a5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029a5 <sys_page_alloc_batch+0x8>
+  8029ac:	49 bb 8b 56 00 00 00 	movabs $0x568b,%r11
+  8029b3:	00 00 00 
+  8029b6:	4c 01 d8             	add    %r11,%rax
+  8029b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029bd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8029c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029c5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8029c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8029cd:	6a 00                	push   $0x0
+  8029cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029db:	be 01 00 00 00       	mov    $0x1,%esi
+  8029e0:	bf 14 00 00 00       	mov    $0x14,%edi
+  8029e5:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  8029ec:	ff ff ff 
+  8029ef:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029f3:	ff d0                	call   *%rax
+  8029f5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029f9:	c9                   	leave
+  8029fa:	c3                   	ret
+
+00000000008029fb <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8029fb:	55                   	push   %rbp
+  8029fc:	48 89 e5             	mov    %rsp,%rbp
+  8029ff:	48 83 ec 10          	sub    $0x10,%rsp
+  802a03:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a03 <sys_page_unmap_batch+0x8>
+  802a0a:	49 bb 2d 56 00 00 00 	movabs $0x562d,%r11
+  802a11:	00 00 00 
+  802a14:	4c 01 d8             	add    %r11,%rax
+  802a17:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a1b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802a1f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a23:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a27:	48 83 ec 08          	sub    $0x8,%rsp
+  802a2b:	6a 00                	push   $0x0
+  802a2d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a33:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a39:	be 01 00 00 00       	mov    $0x1,%esi
+  802a3e:	bf 15 00 00 00       	mov    $0x15,%edi
+  802a43:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  802a4a:	ff ff ff 
+  802a4d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a51:	ff d0                	call   *%rax
+  802a53:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a57:	c9                   	leave
+  802a58:	c3                   	ret
+
+0000000000802a59 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802a59:	55                   	push   %rbp
+  802a5a:	48 89 e5             	mov    %rsp,%rbp
+  802a5d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a5d <sys_fork+0x4>
+  802a64:	49 bb d3 55 00 00 00 	movabs $0x55d3,%r11
+  802a6b:	00 00 00 
+  802a6e:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802a71:	48 83 ec 08          	sub    $0x8,%rsp
+  802a75:	6a 00                	push   $0x0
+  802a77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a88:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a8d:	be 00 00 00 00       	mov    $0x0,%esi
+  802a92:	bf 16 00 00 00       	mov    $0x16,%edi
+  802a97:	49 ba b3 9e ff ff ff 	movabs $0xffffffffffff9eb3,%r10
+  802a9e:	ff ff ff 
+  802aa1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802aa5:	ff d0                	call   *%rax
+  802aa7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802aab:	c9                   	leave
+  802aac:	c3                   	ret
+
+0000000000802aad <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  802aad:	55                   	push   %rbp
+  802aae:	48 89 e5             	mov    %rsp,%rbp
+  802ab1:	48 83 ec 08          	sub    $0x8,%rsp
+  802ab5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ab5 <fd2num+0x8>
+  802abc:	49 bb 7b 55 00 00 00 	movabs $0x557b,%r11
+  802ac3:	00 00 00 
+  802ac6:	4c 01 d8             	add    %r11,%rax
+  802ac9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802acd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ad1:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802ad8:	ff ff ff 
+  802adb:	48 01 d0             	add    %rdx,%rax
+  802ade:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802ae2:	c9                   	leave
+  802ae3:	c3                   	ret
+
+0000000000802ae4 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802ae4:	55                   	push   %rbp
+  802ae5:	48 89 e5             	mov    %rsp,%rbp
+  802ae8:	48 83 ec 08          	sub    $0x8,%rsp
+  802aec:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802aec <fd2data+0x8>
+  802af3:	49 bb 44 55 00 00 00 	movabs $0x5544,%r11
+  802afa:	00 00 00 
+  802afd:	4c 01 d8             	add    %r11,%rax
+  802b00:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  802b04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b08:	48 89 d7             	mov    %rdx,%rdi
+  802b0b:	48 ba 7d aa ff ff ff 	movabs $0xffffffffffffaa7d,%rdx
+  802b12:	ff ff ff 
+  802b15:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802b19:	ff d0                	call   *%rax
+  802b1b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802b21:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802b25:	c9                   	leave
+  802b26:	c3                   	ret
+
+0000000000802b27 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802b27:	55                   	push   %rbp
+  802b28:	48 89 e5             	mov    %rsp,%rbp
+  802b2b:	48 83 ec 18          	sub    $0x18,%rsp
+  802b2f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b2f <fd_alloc+0x8>
+  802b36:	49 bb 01 55 00 00 00 	movabs $0x5501,%r11
+  802b3d:	00 00 00 
+  802b40:	4c 01 d8             	add    %r11,%rax
+  802b43:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802b47:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802b4e:	eb 75                	jmp    802bc5 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  802b50:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802b53:	48 63 d2             	movslq %edx,%rdx
+  802b56:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802b5d:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802b61:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802b65:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b69:	48 89 d1             	mov    %rdx,%rcx
+  802b6c:	48 c1 e9 15          	shr    $0x15,%rcx
+  802b70:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802b77:	ff ff ff 
+  802b7a:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802b7e:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802b82:	83 e2 01             	and    $0x1,%edx
+  802b85:	48 85 d2             	test   %rdx,%rdx
+  802b88:	74 25                	je     802baf <fd_alloc+0x88>
+  802b8a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b8e:	48 89 d1             	mov    %rdx,%rcx
+  802b91:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802b95:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802b9c:	ff ff ff 
+  802b9f:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802ba3:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802ba7:	83 e2 01             	and    $0x1,%edx
+  802baa:	48 85 d2             	test   %rdx,%rdx
+  802bad:	75 12                	jne    802bc1 <fd_alloc+0x9a>
+			*fd_store = fd;
+  802baf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bb3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802bb7:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802bba:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbf:	eb 1a                	jmp    802bdb <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802bc1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802bc5:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802bc9:	7e 85                	jle    802b50 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802bcb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bcf:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802bd6:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802bdb:	c9                   	leave
+  802bdc:	c3                   	ret
+
+0000000000802bdd <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802bdd:	55                   	push   %rbp
+  802bde:	48 89 e5             	mov    %rsp,%rbp
+  802be1:	48 83 ec 20          	sub    $0x20,%rsp
+  802be5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802be5 <fd_lookup+0x8>
+  802bec:	49 bb 4b 54 00 00 00 	movabs $0x544b,%r11
+  802bf3:	00 00 00 
+  802bf6:	4c 01 d8             	add    %r11,%rax
+  802bf9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802bfc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802c00:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c04:	78 06                	js     802c0c <fd_lookup+0x2f>
+  802c06:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802c0a:	7e 07                	jle    802c13 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802c0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c11:	eb 73                	jmp    802c86 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802c13:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802c16:	48 63 d2             	movslq %edx,%rdx
+  802c19:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802c20:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802c24:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802c28:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c2c:	48 89 d1             	mov    %rdx,%rcx
+  802c2f:	48 c1 e9 15          	shr    $0x15,%rcx
+  802c33:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802c3a:	ff ff ff 
+  802c3d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802c41:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802c45:	83 e2 01             	and    $0x1,%edx
+  802c48:	48 85 d2             	test   %rdx,%rdx
+  802c4b:	74 22                	je     802c6f <fd_lookup+0x92>
+  802c4d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c51:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802c55:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  802c5c:	ff ff ff 
+  802c5f:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802c63:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c67:	83 e0 01             	and    $0x1,%eax
+  802c6a:	48 85 c0             	test   %rax,%rax
+  802c6d:	75 07                	jne    802c76 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802c6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c74:	eb 10                	jmp    802c86 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802c76:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c7a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c7e:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802c81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c86:	c9                   	leave
+  802c87:	c3                   	ret
+
+0000000000802c88 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802c88:	55                   	push   %rbp
+  802c89:	48 89 e5             	mov    %rsp,%rbp
+  802c8c:	41 57                	push   %r15
+  802c8e:	53                   	push   %rbx
+  802c8f:	48 83 ec 30          	sub    $0x30,%rsp
+  802c93:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c93 <fd_close+0xb>
+  802c9a:	49 bb 9d 53 00 00 00 	movabs $0x539d,%r11
+  802ca1:	00 00 00 
+  802ca4:	4c 01 db             	add    %r11,%rbx
+  802ca7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802cab:	89 f0                	mov    %esi,%eax
+  802cad:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802cb0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cb4:	48 89 c7             	mov    %rax,%rdi
+  802cb7:	48 b8 7d aa ff ff ff 	movabs $0xffffffffffffaa7d,%rax
+  802cbe:	ff ff ff 
+  802cc1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cc5:	ff d0                	call   *%rax
+  802cc7:	89 c2                	mov    %eax,%edx
+  802cc9:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802ccd:	48 89 c6             	mov    %rax,%rsi
+  802cd0:	89 d7                	mov    %edx,%edi
+  802cd2:	48 b8 ad ab ff ff ff 	movabs $0xffffffffffffabad,%rax
+  802cd9:	ff ff ff 
+  802cdc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ce0:	ff d0                	call   *%rax
+  802ce2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ce5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ce9:	78 0a                	js     802cf5 <fd_close+0x6d>
+	    || fd != fd2)
+  802ceb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802cef:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802cf3:	74 12                	je     802d07 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802cf5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802cf9:	74 05                	je     802d00 <fd_close+0x78>
+  802cfb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cfe:	eb 7a                	jmp    802d7a <fd_close+0xf2>
+  802d00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d05:	eb 73                	jmp    802d7a <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802d07:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d0b:	8b 00                	mov    (%rax),%eax
+  802d0d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802d11:	48 89 d6             	mov    %rdx,%rsi
+  802d14:	89 c7                	mov    %eax,%edi
+  802d16:	48 b8 53 ad ff ff ff 	movabs $0xffffffffffffad53,%rax
+  802d1d:	ff ff ff 
+  802d20:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d24:	ff d0                	call   *%rax
+  802d26:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d29:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d2d:	78 2a                	js     802d59 <fd_close+0xd1>
+		if (dev->dev_close)
+  802d2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d33:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802d37:	48 85 c0             	test   %rax,%rax
+  802d3a:	74 16                	je     802d52 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802d3c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d40:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802d44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d48:	48 89 c7             	mov    %rax,%rdi
+  802d4b:	ff d2                	call   *%rdx
+  802d4d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d50:	eb 07                	jmp    802d59 <fd_close+0xd1>
+		else
+			r = 0;
+  802d52:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802d59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d5d:	48 89 c6             	mov    %rax,%rsi
+  802d60:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d65:	49 89 df             	mov    %rbx,%r15
+  802d68:	48 b8 ac a3 ff ff ff 	movabs $0xffffffffffffa3ac,%rax
+  802d6f:	ff ff ff 
+  802d72:	48 01 d8             	add    %rbx,%rax
+  802d75:	ff d0                	call   *%rax
+	return r;
+  802d77:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802d7a:	48 83 c4 30          	add    $0x30,%rsp
+  802d7e:	5b                   	pop    %rbx
+  802d7f:	41 5f                	pop    %r15
+  802d81:	5d                   	pop    %rbp
+  802d82:	c3                   	ret
+
+0000000000802d83 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802d83:	55                   	push   %rbp
+  802d84:	48 89 e5             	mov    %rsp,%rbp
+  802d87:	41 57                	push   %r15
+  802d89:	48 83 ec 28          	sub    $0x28,%rsp
+  802d8d:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802d8d <dev_lookup+0xa>
+  802d94:	49 bb a3 52 00 00 00 	movabs $0x52a3,%r11
+  802d9b:	00 00 00 
+  802d9e:	4c 01 d9             	add    %r11,%rcx
+  802da1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802da4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802da8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802daf:	eb 45                	jmp    802df6 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802db1:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802db8:	00 00 00 
+  802dbb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dbe:	48 98                	cltq
+  802dc0:	48 01 ca             	add    %rcx,%rdx
+  802dc3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802dc7:	8b 00                	mov    (%rax),%eax
+  802dc9:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802dcc:	75 24                	jne    802df2 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802dce:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802dd5:	00 00 00 
+  802dd8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ddb:	48 98                	cltq
+  802ddd:	48 01 ca             	add    %rcx,%rdx
+  802de0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802de4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802de8:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802deb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802df0:	eb 74                	jmp    802e66 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802df2:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802df6:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802dfd:	00 00 00 
+  802e00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e03:	48 98                	cltq
+  802e05:	48 01 ca             	add    %rcx,%rdx
+  802e08:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e0c:	48 85 c0             	test   %rax,%rax
+  802e0f:	75 a0                	jne    802db1 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802e11:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802e18:	ff ff ff 
+  802e1b:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802e1f:	48 8b 00             	mov    (%rax),%rax
+  802e22:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802e28:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802e2b:	89 c6                	mov    %eax,%esi
+  802e2d:	48 b8 68 e7 ff ff ff 	movabs $0xffffffffffffe768,%rax
+  802e34:	ff ff ff 
+  802e37:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802e3b:	48 89 c7             	mov    %rax,%rdi
+  802e3e:	49 89 cf             	mov    %rcx,%r15
+  802e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e46:	49 b8 56 88 ff ff ff 	movabs $0xffffffffffff8856,%r8
+  802e4d:	ff ff ff 
+  802e50:	49 01 c8             	add    %rcx,%r8
+  802e53:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802e56:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e5a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802e61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e66:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802e6a:	c9                   	leave
+  802e6b:	c3                   	ret
+
+0000000000802e6c <close>:
+
+int
+close(int fdnum)
+{
+  802e6c:	55                   	push   %rbp
+  802e6d:	48 89 e5             	mov    %rsp,%rbp
+  802e70:	53                   	push   %rbx
+  802e71:	48 83 ec 28          	sub    $0x28,%rsp
+  802e75:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e75 <close+0x9>
+  802e7c:	49 bb bb 51 00 00 00 	movabs $0x51bb,%r11
+  802e83:	00 00 00 
+  802e86:	4c 01 db             	add    %r11,%rbx
+  802e89:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e8c:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802e90:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e93:	48 89 d6             	mov    %rdx,%rsi
+  802e96:	89 c7                	mov    %eax,%edi
+  802e98:	48 b8 ad ab ff ff ff 	movabs $0xffffffffffffabad,%rax
+  802e9f:	ff ff ff 
+  802ea2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ea6:	ff d0                	call   *%rax
+  802ea8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802eab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802eaf:	79 05                	jns    802eb6 <close+0x4a>
+		return r;
+  802eb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802eb4:	eb 1c                	jmp    802ed2 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802eb6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802eba:	be 01 00 00 00       	mov    $0x1,%esi
+  802ebf:	48 89 c7             	mov    %rax,%rdi
+  802ec2:	48 b8 58 ac ff ff ff 	movabs $0xffffffffffffac58,%rax
+  802ec9:	ff ff ff 
+  802ecc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ed0:	ff d0                	call   *%rax
+}
+  802ed2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ed6:	c9                   	leave
+  802ed7:	c3                   	ret
+
+0000000000802ed8 <close_all>:
+
+void
+close_all(void)
+{
+  802ed8:	55                   	push   %rbp
+  802ed9:	48 89 e5             	mov    %rsp,%rbp
+  802edc:	53                   	push   %rbx
+  802edd:	48 83 ec 18          	sub    $0x18,%rsp
+  802ee1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ee1 <close_all+0x9>
+  802ee8:	49 bb 4f 51 00 00 00 	movabs $0x514f,%r11
+  802eef:	00 00 00 
+  802ef2:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802ef5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802efc:	eb 19                	jmp    802f17 <close_all+0x3f>
+		close(i);
+  802efe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f01:	89 c7                	mov    %eax,%edi
+  802f03:	48 b8 3c ae ff ff ff 	movabs $0xffffffffffffae3c,%rax
+  802f0a:	ff ff ff 
+  802f0d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f11:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802f13:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802f17:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802f1b:	7e e1                	jle    802efe <close_all+0x26>
+}
+  802f1d:	90                   	nop
+  802f1e:	90                   	nop
+  802f1f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f23:	c9                   	leave
+  802f24:	c3                   	ret
+
+0000000000802f25 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802f25:	55                   	push   %rbp
+  802f26:	48 89 e5             	mov    %rsp,%rbp
+  802f29:	41 57                	push   %r15
+  802f2b:	53                   	push   %rbx
+  802f2c:	48 83 ec 40          	sub    $0x40,%rsp
+  802f30:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f30 <dup+0xb>
+  802f37:	49 bb 00 51 00 00 00 	movabs $0x5100,%r11
+  802f3e:	00 00 00 
+  802f41:	4c 01 db             	add    %r11,%rbx
+  802f44:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802f47:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802f4a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802f4e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802f51:	48 89 d6             	mov    %rdx,%rsi
+  802f54:	89 c7                	mov    %eax,%edi
+  802f56:	48 b8 ad ab ff ff ff 	movabs $0xffffffffffffabad,%rax
+  802f5d:	ff ff ff 
+  802f60:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f64:	ff d0                	call   *%rax
+  802f66:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f69:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f6d:	79 08                	jns    802f77 <dup+0x52>
+		return r;
+  802f6f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f72:	e9 a4 01 00 00       	jmp    80311b <dup+0x1f6>
+	close(newfdnum);
+  802f77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f7a:	89 c7                	mov    %eax,%edi
+  802f7c:	48 b8 3c ae ff ff ff 	movabs $0xffffffffffffae3c,%rax
+  802f83:	ff ff ff 
+  802f86:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f8a:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802f8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f8f:	48 98                	cltq
+  802f91:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802f97:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f9b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802f9f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fa3:	48 89 c7             	mov    %rax,%rdi
+  802fa6:	48 b8 b4 aa ff ff ff 	movabs $0xffffffffffffaab4,%rax
+  802fad:	ff ff ff 
+  802fb0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fb4:	ff d0                	call   *%rax
+  802fb6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802fba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fbe:	48 89 c7             	mov    %rax,%rdi
+  802fc1:	48 b8 b4 aa ff ff ff 	movabs $0xffffffffffffaab4,%rax
+  802fc8:	ff ff ff 
+  802fcb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fcf:	ff d0                	call   *%rax
+  802fd1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802fd5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fd9:	48 c1 e8 15          	shr    $0x15,%rax
+  802fdd:	48 89 c2             	mov    %rax,%rdx
+  802fe0:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802fe7:	ff ff ff 
+  802fea:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fee:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ff2:	83 e0 01             	and    $0x1,%eax
+  802ff5:	48 85 c0             	test   %rax,%rax
+  802ff8:	74 7f                	je     803079 <dup+0x154>
+  802ffa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ffe:	48 c1 e8 0c          	shr    $0xc,%rax
+  803002:	48 89 c2             	mov    %rax,%rdx
+  803005:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80300c:	ff ff ff 
+  80300f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803013:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803017:	83 e0 01             	and    $0x1,%eax
+  80301a:	48 85 c0             	test   %rax,%rax
+  80301d:	74 5a                	je     803079 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80301f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803023:	48 c1 e8 0c          	shr    $0xc,%rax
+  803027:	48 89 c2             	mov    %rax,%rdx
+  80302a:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803031:	ff ff ff 
+  803034:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803038:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80303c:	25 07 0e 00 00       	and    $0xe07,%eax
+  803041:	89 c1                	mov    %eax,%ecx
+  803043:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803047:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80304b:	41 89 c8             	mov    %ecx,%r8d
+  80304e:	48 89 d1             	mov    %rdx,%rcx
+  803051:	ba 00 00 00 00       	mov    $0x0,%edx
+  803056:	48 89 c6             	mov    %rax,%rsi
+  803059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80305e:	49 89 df             	mov    %rbx,%r15
+  803061:	48 b8 39 a3 ff ff ff 	movabs $0xffffffffffffa339,%rax
+  803068:	ff ff ff 
+  80306b:	48 01 d8             	add    %rbx,%rax
+  80306e:	ff d0                	call   *%rax
+  803070:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803073:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803077:	78 5f                	js     8030d8 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803079:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80307d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803081:	48 89 c2             	mov    %rax,%rdx
+  803084:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80308b:	ff ff ff 
+  80308e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803092:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803096:	25 07 0e 00 00       	and    $0xe07,%eax
+  80309b:	89 c1                	mov    %eax,%ecx
+  80309d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030a1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8030a5:	41 89 c8             	mov    %ecx,%r8d
+  8030a8:	48 89 d1             	mov    %rdx,%rcx
+  8030ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b0:	48 89 c6             	mov    %rax,%rsi
+  8030b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030b8:	49 89 df             	mov    %rbx,%r15
+  8030bb:	48 b8 39 a3 ff ff ff 	movabs $0xffffffffffffa339,%rax
+  8030c2:	ff ff ff 
+  8030c5:	48 01 d8             	add    %rbx,%rax
+  8030c8:	ff d0                	call   *%rax
+  8030ca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8030cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8030d1:	78 08                	js     8030db <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  8030d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8030d6:	eb 43                	jmp    80311b <dup+0x1f6>
+			goto err;
+  8030d8:	90                   	nop
+  8030d9:	eb 01                	jmp    8030dc <dup+0x1b7>
+		goto err;
+  8030db:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  8030dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030e0:	48 89 c6             	mov    %rax,%rsi
+  8030e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030e8:	49 89 df             	mov    %rbx,%r15
+  8030eb:	48 b8 ac a3 ff ff ff 	movabs $0xffffffffffffa3ac,%rax
+  8030f2:	ff ff ff 
+  8030f5:	48 01 d8             	add    %rbx,%rax
+  8030f8:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  8030fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030fe:	48 89 c6             	mov    %rax,%rsi
+  803101:	bf 00 00 00 00       	mov    $0x0,%edi
+  803106:	49 89 df             	mov    %rbx,%r15
+  803109:	48 b8 ac a3 ff ff ff 	movabs $0xffffffffffffa3ac,%rax
+  803110:	ff ff ff 
+  803113:	48 01 d8             	add    %rbx,%rax
+  803116:	ff d0                	call   *%rax
+	return r;
+  803118:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80311b:	48 83 c4 40          	add    $0x40,%rsp
+  80311f:	5b                   	pop    %rbx
+  803120:	41 5f                	pop    %r15
+  803122:	5d                   	pop    %rbp
+  803123:	c3                   	ret
+
+0000000000803124 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803124:	55                   	push   %rbp
+  803125:	48 89 e5             	mov    %rsp,%rbp
+  803128:	41 57                	push   %r15
+  80312a:	53                   	push   %rbx
+  80312b:	48 83 ec 40          	sub    $0x40,%rsp
+  80312f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80312f <read+0xb>
+  803136:	49 bb 01 4f 00 00 00 	movabs $0x4f01,%r11
+  80313d:	00 00 00 
+  803140:	4c 01 db             	add    %r11,%rbx
+  803143:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803146:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80314a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80314e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803152:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803155:	48 89 d6             	mov    %rdx,%rsi
+  803158:	89 c7                	mov    %eax,%edi
+  80315a:	48 b8 ad ab ff ff ff 	movabs $0xffffffffffffabad,%rax
+  803161:	ff ff ff 
+  803164:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803168:	ff d0                	call   *%rax
+  80316a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80316d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803171:	78 28                	js     80319b <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803173:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803177:	8b 00                	mov    (%rax),%eax
+  803179:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80317d:	48 89 d6             	mov    %rdx,%rsi
+  803180:	89 c7                	mov    %eax,%edi
+  803182:	48 b8 53 ad ff ff ff 	movabs $0xffffffffffffad53,%rax
+  803189:	ff ff ff 
+  80318c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803190:	ff d0                	call   *%rax
+  803192:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803195:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803199:	79 08                	jns    8031a3 <read+0x7f>
+		return r;
+  80319b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80319e:	e9 8b 00 00 00       	jmp    80322e <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8031a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031a7:	8b 40 08             	mov    0x8(%rax),%eax
+  8031aa:	83 e0 03             	and    $0x3,%eax
+  8031ad:	83 f8 01             	cmp    $0x1,%eax
+  8031b0:	75 4b                	jne    8031fd <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8031b2:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8031b9:	ff ff ff 
+  8031bc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031c0:	48 8b 00             	mov    (%rax),%rax
+  8031c3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8031c9:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8031cc:	89 c6                	mov    %eax,%esi
+  8031ce:	48 b8 87 e7 ff ff ff 	movabs $0xffffffffffffe787,%rax
+  8031d5:	ff ff ff 
+  8031d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031dc:	48 89 c7             	mov    %rax,%rdi
+  8031df:	49 89 df             	mov    %rbx,%r15
+  8031e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e7:	48 b9 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rcx
+  8031ee:	ff ff ff 
+  8031f1:	48 01 d9             	add    %rbx,%rcx
+  8031f4:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8031f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031fb:	eb 31                	jmp    80322e <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8031fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803201:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803205:	48 85 c0             	test   %rax,%rax
+  803208:	75 07                	jne    803211 <read+0xed>
+		return -E_NOT_SUPP;
+  80320a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80320f:	eb 1d                	jmp    80322e <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803211:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803215:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803219:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80321d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803221:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803225:	48 89 ce             	mov    %rcx,%rsi
+  803228:	48 89 c7             	mov    %rax,%rdi
+  80322b:	41 ff d0             	call   *%r8
+}
+  80322e:	48 83 c4 40          	add    $0x40,%rsp
+  803232:	5b                   	pop    %rbx
+  803233:	41 5f                	pop    %r15
+  803235:	5d                   	pop    %rbp
+  803236:	c3                   	ret
+
+0000000000803237 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803237:	55                   	push   %rbp
+  803238:	48 89 e5             	mov    %rsp,%rbp
+  80323b:	53                   	push   %rbx
+  80323c:	48 83 ec 38          	sub    $0x38,%rsp
+  803240:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803240 <readn+0x9>
+  803247:	49 bb f0 4d 00 00 00 	movabs $0x4df0,%r11
+  80324e:	00 00 00 
+  803251:	4c 01 db             	add    %r11,%rbx
+  803254:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803257:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80325b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80325f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803266:	eb 4b                	jmp    8032b3 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803268:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80326b:	48 98                	cltq
+  80326d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803271:	48 29 c2             	sub    %rax,%rdx
+  803274:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803277:	48 63 c8             	movslq %eax,%rcx
+  80327a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80327e:	48 01 c1             	add    %rax,%rcx
+  803281:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803284:	48 89 ce             	mov    %rcx,%rsi
+  803287:	89 c7                	mov    %eax,%edi
+  803289:	48 b8 f4 b0 ff ff ff 	movabs $0xffffffffffffb0f4,%rax
+  803290:	ff ff ff 
+  803293:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803297:	ff d0                	call   *%rax
+  803299:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80329c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8032a0:	79 05                	jns    8032a7 <readn+0x70>
+			return m;
+  8032a2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8032a5:	eb 1d                	jmp    8032c4 <readn+0x8d>
+		if (m == 0)
+  8032a7:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8032ab:	74 13                	je     8032c0 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  8032ad:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8032b0:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8032b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032b6:	48 98                	cltq
+  8032b8:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  8032bc:	72 aa                	jb     803268 <readn+0x31>
+  8032be:	eb 01                	jmp    8032c1 <readn+0x8a>
+			break;
+  8032c0:	90                   	nop
+	}
+	return tot;
+  8032c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8032c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032c8:	c9                   	leave
+  8032c9:	c3                   	ret
+
+00000000008032ca <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8032ca:	55                   	push   %rbp
+  8032cb:	48 89 e5             	mov    %rsp,%rbp
+  8032ce:	41 57                	push   %r15
+  8032d0:	53                   	push   %rbx
+  8032d1:	48 83 ec 40          	sub    $0x40,%rsp
+  8032d5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032d5 <write+0xb>
+  8032dc:	49 bb 5b 4d 00 00 00 	movabs $0x4d5b,%r11
+  8032e3:	00 00 00 
+  8032e6:	4c 01 db             	add    %r11,%rbx
+  8032e9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8032ec:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8032f0:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8032f4:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8032f8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8032fb:	48 89 d6             	mov    %rdx,%rsi
+  8032fe:	89 c7                	mov    %eax,%edi
+  803300:	48 b8 ad ab ff ff ff 	movabs $0xffffffffffffabad,%rax
+  803307:	ff ff ff 
+  80330a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80330e:	ff d0                	call   *%rax
+  803310:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803313:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803317:	78 28                	js     803341 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803319:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80331d:	8b 00                	mov    (%rax),%eax
+  80331f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803323:	48 89 d6             	mov    %rdx,%rsi
+  803326:	89 c7                	mov    %eax,%edi
+  803328:	48 b8 53 ad ff ff ff 	movabs $0xffffffffffffad53,%rax
+  80332f:	ff ff ff 
+  803332:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803336:	ff d0                	call   *%rax
+  803338:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80333b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80333f:	79 08                	jns    803349 <write+0x7f>
+		return r;
+  803341:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803344:	e9 8a 00 00 00       	jmp    8033d3 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803349:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80334d:	8b 40 08             	mov    0x8(%rax),%eax
+  803350:	83 e0 03             	and    $0x3,%eax
+  803353:	85 c0                	test   %eax,%eax
+  803355:	75 4b                	jne    8033a2 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803357:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80335e:	ff ff ff 
+  803361:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803365:	48 8b 00             	mov    (%rax),%rax
+  803368:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80336e:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803371:	89 c6                	mov    %eax,%esi
+  803373:	48 b8 a3 e7 ff ff ff 	movabs $0xffffffffffffe7a3,%rax
+  80337a:	ff ff ff 
+  80337d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803381:	48 89 c7             	mov    %rax,%rdi
+  803384:	49 89 df             	mov    %rbx,%r15
+  803387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80338c:	48 b9 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rcx
+  803393:	ff ff ff 
+  803396:	48 01 d9             	add    %rbx,%rcx
+  803399:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80339b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033a0:	eb 31                	jmp    8033d3 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8033a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033a6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8033aa:	48 85 c0             	test   %rax,%rax
+  8033ad:	75 07                	jne    8033b6 <write+0xec>
+		return -E_NOT_SUPP;
+  8033af:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8033b4:	eb 1d                	jmp    8033d3 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  8033b6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033ba:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8033be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033c2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8033c6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8033ca:	48 89 ce             	mov    %rcx,%rsi
+  8033cd:	48 89 c7             	mov    %rax,%rdi
+  8033d0:	41 ff d0             	call   *%r8
+}
+  8033d3:	48 83 c4 40          	add    $0x40,%rsp
+  8033d7:	5b                   	pop    %rbx
+  8033d8:	41 5f                	pop    %r15
+  8033da:	5d                   	pop    %rbp
+  8033db:	c3                   	ret
+
+00000000008033dc <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8033dc:	55                   	push   %rbp
+  8033dd:	48 89 e5             	mov    %rsp,%rbp
+  8033e0:	48 83 ec 18          	sub    $0x18,%rsp
+  8033e4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8033e4 <seek+0x8>
+  8033eb:	49 bb 4c 4c 00 00 00 	movabs $0x4c4c,%r11
+  8033f2:	00 00 00 
+  8033f5:	4c 01 d8             	add    %r11,%rax
+  8033f8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8033fb:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033fe:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803402:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803405:	48 89 ce             	mov    %rcx,%rsi
+  803408:	89 d7                	mov    %edx,%edi
+  80340a:	48 ba ad ab ff ff ff 	movabs $0xffffffffffffabad,%rdx
+  803411:	ff ff ff 
+  803414:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803418:	ff d0                	call   *%rax
+  80341a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80341d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803421:	79 05                	jns    803428 <seek+0x4c>
+		return r;
+  803423:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803426:	eb 0f                	jmp    803437 <seek+0x5b>
+	fd->fd_offset = offset;
+  803428:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80342c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80342f:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803432:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803437:	c9                   	leave
+  803438:	c3                   	ret
+
+0000000000803439 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803439:	55                   	push   %rbp
+  80343a:	48 89 e5             	mov    %rsp,%rbp
+  80343d:	41 57                	push   %r15
+  80343f:	53                   	push   %rbx
+  803440:	48 83 ec 30          	sub    $0x30,%rsp
+  803444:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803444 <ftruncate+0xb>
+  80344b:	49 bb ec 4b 00 00 00 	movabs $0x4bec,%r11
+  803452:	00 00 00 
+  803455:	4c 01 db             	add    %r11,%rbx
+  803458:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80345b:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80345e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803462:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803465:	48 89 d6             	mov    %rdx,%rsi
+  803468:	89 c7                	mov    %eax,%edi
+  80346a:	48 b8 ad ab ff ff ff 	movabs $0xffffffffffffabad,%rax
+  803471:	ff ff ff 
+  803474:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803478:	ff d0                	call   *%rax
+  80347a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80347d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803481:	78 28                	js     8034ab <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803483:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803487:	8b 00                	mov    (%rax),%eax
+  803489:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80348d:	48 89 d6             	mov    %rdx,%rsi
+  803490:	89 c7                	mov    %eax,%edi
+  803492:	48 b8 53 ad ff ff ff 	movabs $0xffffffffffffad53,%rax
+  803499:	ff ff ff 
+  80349c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034a0:	ff d0                	call   *%rax
+  8034a2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034a5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034a9:	79 08                	jns    8034b3 <ftruncate+0x7a>
+		return r;
+  8034ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034ae:	e9 83 00 00 00       	jmp    803536 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8034b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034b7:	8b 40 08             	mov    0x8(%rax),%eax
+  8034ba:	83 e0 03             	and    $0x3,%eax
+  8034bd:	85 c0                	test   %eax,%eax
+  8034bf:	75 4b                	jne    80350c <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  8034c1:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8034c8:	ff ff ff 
+  8034cb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034cf:	48 8b 00             	mov    (%rax),%rax
+  8034d2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8034d8:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8034db:	89 c6                	mov    %eax,%esi
+  8034dd:	48 b8 c0 e7 ff ff ff 	movabs $0xffffffffffffe7c0,%rax
+  8034e4:	ff ff ff 
+  8034e7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034eb:	48 89 c7             	mov    %rax,%rdi
+  8034ee:	49 89 df             	mov    %rbx,%r15
+  8034f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f6:	48 b9 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rcx
+  8034fd:	ff ff ff 
+  803500:	48 01 d9             	add    %rbx,%rcx
+  803503:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803505:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80350a:	eb 2a                	jmp    803536 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  80350c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803510:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803514:	48 85 c0             	test   %rax,%rax
+  803517:	75 07                	jne    803520 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803519:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80351e:	eb 16                	jmp    803536 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803520:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803524:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803528:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80352c:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  80352f:	89 d6                	mov    %edx,%esi
+  803531:	48 89 c7             	mov    %rax,%rdi
+  803534:	ff d1                	call   *%rcx
+}
+  803536:	48 83 c4 30          	add    $0x30,%rsp
+  80353a:	5b                   	pop    %rbx
+  80353b:	41 5f                	pop    %r15
+  80353d:	5d                   	pop    %rbp
+  80353e:	c3                   	ret
+
+000000000080353f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80353f:	55                   	push   %rbp
+  803540:	48 89 e5             	mov    %rsp,%rbp
+  803543:	53                   	push   %rbx
+  803544:	48 83 ec 38          	sub    $0x38,%rsp
+  803548:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803548 <fstat+0x9>
+  80354f:	49 bb e8 4a 00 00 00 	movabs $0x4ae8,%r11
+  803556:	00 00 00 
+  803559:	4c 01 db             	add    %r11,%rbx
+  80355c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80355f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803563:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803567:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80356a:	48 89 d6             	mov    %rdx,%rsi
+  80356d:	89 c7                	mov    %eax,%edi
+  80356f:	48 b8 ad ab ff ff ff 	movabs $0xffffffffffffabad,%rax
+  803576:	ff ff ff 
+  803579:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80357d:	ff d0                	call   *%rax
+  80357f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803582:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803586:	78 28                	js     8035b0 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803588:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80358c:	8b 00                	mov    (%rax),%eax
+  80358e:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803592:	48 89 d6             	mov    %rdx,%rsi
+  803595:	89 c7                	mov    %eax,%edi
+  803597:	48 b8 53 ad ff ff ff 	movabs $0xffffffffffffad53,%rax
+  80359e:	ff ff ff 
+  8035a1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035a5:	ff d0                	call   *%rax
+  8035a7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8035aa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8035ae:	79 05                	jns    8035b5 <fstat+0x76>
+		return r;
+  8035b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8035b3:	eb 5e                	jmp    803613 <fstat+0xd4>
+	if (!dev->dev_stat)
+  8035b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035b9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8035bd:	48 85 c0             	test   %rax,%rax
+  8035c0:	75 07                	jne    8035c9 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8035c2:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8035c7:	eb 4a                	jmp    803613 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8035c9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035cd:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  8035d0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035d4:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8035db:	00 00 00 
+	stat->st_isdir = 0;
+  8035de:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035e2:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8035e9:	00 00 00 
+	stat->st_dev = dev;
+  8035ec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035f0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035f4:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8035fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035ff:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803603:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803607:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80360b:	48 89 d6             	mov    %rdx,%rsi
+  80360e:	48 89 c7             	mov    %rax,%rdi
+  803611:	ff d1                	call   *%rcx
+}
+  803613:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803617:	c9                   	leave
+  803618:	c3                   	ret
+
+0000000000803619 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803619:	55                   	push   %rbp
+  80361a:	48 89 e5             	mov    %rsp,%rbp
+  80361d:	41 57                	push   %r15
+  80361f:	53                   	push   %rbx
+  803620:	48 83 ec 20          	sub    $0x20,%rsp
+  803624:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803624 <stat+0xb>
+  80362b:	49 bb 0c 4a 00 00 00 	movabs $0x4a0c,%r11
+  803632:	00 00 00 
+  803635:	4c 01 db             	add    %r11,%rbx
+  803638:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80363c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803640:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803644:	be 00 00 00 00       	mov    $0x0,%esi
+  803649:	48 89 c7             	mov    %rax,%rdi
+  80364c:	49 89 df             	mov    %rbx,%r15
+  80364f:	48 b8 c3 b8 ff ff ff 	movabs $0xffffffffffffb8c3,%rax
+  803656:	ff ff ff 
+  803659:	48 01 d8             	add    %rbx,%rax
+  80365c:	ff d0                	call   *%rax
+  80365e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803661:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803665:	79 05                	jns    80366c <stat+0x53>
+		return fd;
+  803667:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80366a:	eb 37                	jmp    8036a3 <stat+0x8a>
+	r = fstat(fd, stat);
+  80366c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803670:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803673:	48 89 d6             	mov    %rdx,%rsi
+  803676:	89 c7                	mov    %eax,%edi
+  803678:	48 b8 0f b5 ff ff ff 	movabs $0xffffffffffffb50f,%rax
+  80367f:	ff ff ff 
+  803682:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803686:	ff d0                	call   *%rax
+  803688:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  80368b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80368e:	89 c7                	mov    %eax,%edi
+  803690:	48 b8 3c ae ff ff ff 	movabs $0xffffffffffffae3c,%rax
+  803697:	ff ff ff 
+  80369a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80369e:	ff d0                	call   *%rax
+	return r;
+  8036a0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8036a3:	48 83 c4 20          	add    $0x20,%rsp
+  8036a7:	5b                   	pop    %rbx
+  8036a8:	41 5f                	pop    %r15
+  8036aa:	5d                   	pop    %rbp
+  8036ab:	c3                   	ret
+
+00000000008036ac <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8036ac:	55                   	push   %rbp
+  8036ad:	48 89 e5             	mov    %rsp,%rbp
+  8036b0:	41 57                	push   %r15
+  8036b2:	53                   	push   %rbx
+  8036b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8036b7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036b7 <fsipc+0xb>
+  8036be:	49 bb 79 49 00 00 00 	movabs $0x4979,%r11
+  8036c5:	00 00 00 
+  8036c8:	4c 01 db             	add    %r11,%rbx
+  8036cb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8036ce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  8036d2:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8036d9:	00 00 00 
+  8036dc:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8036df:	85 c0                	test   %eax,%eax
+  8036e1:	75 24                	jne    803707 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8036e3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8036e8:	49 89 df             	mov    %rbx,%r15
+  8036eb:	48 b8 c3 e0 ff ff ff 	movabs $0xffffffffffffe0c3,%rax
+  8036f2:	ff ff ff 
+  8036f5:	48 01 d8             	add    %rbx,%rax
+  8036f8:	ff d0                	call   *%rax
+  8036fa:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803701:	00 00 00 
+  803704:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  803707:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80370e:	00 00 00 
+  803711:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803714:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803718:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80371b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803721:	49 89 d0             	mov    %rdx,%r8
+  803724:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803729:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803730:	00 00 00 
+  803733:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803737:	89 c7                	mov    %eax,%edi
+  803739:	49 89 df             	mov    %rbx,%r15
+  80373c:	48 b8 e2 da ff ff ff 	movabs $0xffffffffffffdae2,%rax
+  803743:	ff ff ff 
+  803746:	48 01 d8             	add    %rbx,%rax
+  803749:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  80374b:	48 83 c4 10          	add    $0x10,%rsp
+  80374f:	5b                   	pop    %rbx
+  803750:	41 5f                	pop    %r15
+  803752:	5d                   	pop    %rbp
+  803753:	c3                   	ret
+
+0000000000803754 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803754:	55                   	push   %rbp
+  803755:	48 89 e5             	mov    %rsp,%rbp
+  803758:	41 57                	push   %r15
+  80375a:	53                   	push   %rbx
+  80375b:	48 83 ec 20          	sub    $0x20,%rsp
+  80375f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80375f <fsipc_words+0xb>
+  803766:	49 bb d1 48 00 00 00 	movabs $0x48d1,%r11
+  80376d:	00 00 00 
+  803770:	4c 01 db             	add    %r11,%rbx
+  803773:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803776:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80377a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  80377e:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803785:	00 00 00 
+  803788:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80378b:	85 c0                	test   %eax,%eax
+  80378d:	75 24                	jne    8037b3 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80378f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803794:	49 89 df             	mov    %rbx,%r15
+  803797:	48 b8 c3 e0 ff ff ff 	movabs $0xffffffffffffe0c3,%rax
+  80379e:	ff ff ff 
+  8037a1:	48 01 d8             	add    %rbx,%rax
+  8037a4:	ff d0                	call   *%rax
+  8037a6:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8037ad:	00 00 00 
+  8037b0:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  8037b3:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8037ba:	00 00 00 
+  8037bd:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8037c0:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8037c4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037c8:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8037cb:	89 c7                	mov    %eax,%edi
+  8037cd:	49 89 df             	mov    %rbx,%r15
+  8037d0:	48 b8 cd db ff ff ff 	movabs $0xffffffffffffdbcd,%rax
+  8037d7:	ff ff ff 
+  8037da:	48 01 d8             	add    %rbx,%rax
+  8037dd:	ff d0                	call   *%rax
+}
+  8037df:	48 83 c4 20          	add    $0x20,%rsp
+  8037e3:	5b                   	pop    %rbx
+  8037e4:	41 5f                	pop    %r15
+  8037e6:	5d                   	pop    %rbp
+  8037e7:	c3                   	ret
+
+00000000008037e8 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8037e8:	55                   	push   %rbp
+  8037e9:	48 89 e5             	mov    %rsp,%rbp
+  8037ec:	41 57                	push   %r15
+  8037ee:	53                   	push   %rbx
+  8037ef:	48 83 ec 40          	sub    $0x40,%rsp
+  8037f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037f3 <fsipc_pages+0xb>
+  8037fa:	49 bb 3d 48 00 00 00 	movabs $0x483d,%r11
+  803801:	00 00 00 
+  803804:	4c 01 db             	add    %r11,%rbx
+  803807:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80380a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80380e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  803812:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  803815:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80381c:	00 00 00 
+  80381f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803822:	85 c0                	test   %eax,%eax
+  803824:	75 24                	jne    80384a <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803826:	bf 01 00 00 00       	mov    $0x1,%edi
+  80382b:	49 89 df             	mov    %rbx,%r15
+  80382e:	48 b8 c3 e0 ff ff ff 	movabs $0xffffffffffffe0c3,%rax
+  803835:	ff ff ff 
+  803838:	48 01 d8             	add    %rbx,%rax
+  80383b:	ff d0                	call   *%rax
+  80383d:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803844:	00 00 00 
+  803847:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  80384a:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80384f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  803853:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803856:	48 98                	cltq
+  803858:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  80385c:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  803860:	0f 95 c0             	setne  %al
+  803863:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803866:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80386d:	00 
+  80386e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803872:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803876:	48 01 d0             	add    %rdx,%rax
+  803879:	48 83 e8 01          	sub    $0x1,%rax
+  80387d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803881:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803885:	ba 00 00 00 00       	mov    $0x0,%edx
+  80388a:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80388e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803892:	48 29 d0             	sub    %rdx,%rax
+  803895:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803899:	41 89 c2             	mov    %eax,%r10d
+  80389c:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8038a3:	00 00 00 
+  8038a6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8038a9:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  8038ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038b1:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8038b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8038b8:	6a 40                	push   $0x40
+  8038ba:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  8038bf:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  8038c6:	00 
+  8038c7:	6a 05                	push   $0x5
+  8038c9:	41 89 f9             	mov    %edi,%r9d
+  8038cc:	49 89 c8             	mov    %rcx,%r8
+  8038cf:	44 89 d1             	mov    %r10d,%ecx
+  8038d2:	89 c7                	mov    %eax,%edi
+  8038d4:	49 89 df             	mov    %rbx,%r15
+  8038d7:	48 b8 cb dc ff ff ff 	movabs $0xffffffffffffdccb,%rax
+  8038de:	ff ff ff 
+  8038e1:	48 01 d8             	add    %rbx,%rax
+  8038e4:	ff d0                	call   *%rax
+  8038e6:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  8038ea:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8038ee:	5b                   	pop    %rbx
+  8038ef:	41 5f                	pop    %r15
+  8038f1:	5d                   	pop    %rbp
+  8038f2:	c3                   	ret
+
+00000000008038f3 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8038f3:	55                   	push   %rbp
+  8038f4:	48 89 e5             	mov    %rsp,%rbp
+  8038f7:	41 57                	push   %r15
+  8038f9:	53                   	push   %rbx
+  8038fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8038fe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038fe <open+0xb>
+  803905:	49 bb 32 47 00 00 00 	movabs $0x4732,%r11
+  80390c:	00 00 00 
+  80390f:	4c 01 db             	add    %r11,%rbx
+  803912:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803916:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  803919:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80391d:	48 89 c7             	mov    %rax,%rdi
+  803920:	49 89 df             	mov    %rbx,%r15
+  803923:	48 b8 84 95 ff ff ff 	movabs $0xffffffffffff9584,%rax
+  80392a:	ff ff ff 
+  80392d:	48 01 d8             	add    %rbx,%rax
+  803930:	ff d0                	call   *%rax
+  803932:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803937:	7e 0a                	jle    803943 <open+0x50>
+		return -E_BAD_PATH;
+  803939:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80393e:	e9 18 01 00 00       	jmp    803a5b <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  803943:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803947:	48 89 c7             	mov    %rax,%rdi
+  80394a:	49 89 df             	mov    %rbx,%r15
+  80394d:	48 b8 f7 aa ff ff ff 	movabs $0xffffffffffffaaf7,%rax
+  803954:	ff ff ff 
+  803957:	48 01 d8             	add    %rbx,%rax
+  80395a:	ff d0                	call   *%rax
+  80395c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80395f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803963:	74 08                	je     80396d <open+0x7a>
+		return r;
+  803965:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803968:	e9 ee 00 00 00       	jmp    803a5b <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80396d:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803974:	00 00 00 
+  803977:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80397a:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  803981:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803985:	48 89 c6             	mov    %rax,%rsi
+  803988:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  80398f:	00 00 00 
+  803992:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803996:	48 89 c7             	mov    %rax,%rdi
+  803999:	49 89 df             	mov    %rbx,%r15
+  80399c:	48 b8 18 96 ff ff ff 	movabs $0xffffffffffff9618,%rax
+  8039a3:	ff ff ff 
+  8039a6:	48 01 d8             	add    %rbx,%rax
+  8039a9:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  8039ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039af:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  8039b4:	48 89 c6             	mov    %rax,%rsi
+  8039b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039bc:	49 89 df             	mov    %rbx,%r15
+  8039bf:	48 b8 d4 a2 ff ff ff 	movabs $0xffffffffffffa2d4,%rax
+  8039c6:	ff ff ff 
+  8039c9:	48 01 d8             	add    %rbx,%rax
+  8039cc:	ff d0                	call   *%rax
+  8039ce:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8039d1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039d5:	74 23                	je     8039fa <open+0x107>
+		fd_close(fd,0);
+  8039d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039db:	be 00 00 00 00       	mov    $0x0,%esi
+  8039e0:	48 89 c7             	mov    %rax,%rdi
+  8039e3:	49 89 df             	mov    %rbx,%r15
+  8039e6:	48 b8 58 ac ff ff ff 	movabs $0xffffffffffffac58,%rax
+  8039ed:	ff ff ff 
+  8039f0:	48 01 d8             	add    %rbx,%rax
+  8039f3:	ff d0                	call   *%rax
+		return r;
+  8039f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039f8:	eb 61                	jmp    803a5b <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8039fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039fe:	48 89 c6             	mov    %rax,%rsi
+  803a01:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a06:	48 b8 7c b6 ff ff ff 	movabs $0xffffffffffffb67c,%rax
+  803a0d:	ff ff ff 
+  803a10:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a14:	ff d0                	call   *%rax
+  803a16:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a19:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a1d:	74 23                	je     803a42 <open+0x14f>
+		fd_close(fd,0);
+  803a1f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a23:	be 00 00 00 00       	mov    $0x0,%esi
+  803a28:	48 89 c7             	mov    %rax,%rdi
+  803a2b:	49 89 df             	mov    %rbx,%r15
+  803a2e:	48 b8 58 ac ff ff ff 	movabs $0xffffffffffffac58,%rax
+  803a35:	ff ff ff 
+  803a38:	48 01 d8             	add    %rbx,%rax
+  803a3b:	ff d0                	call   *%rax
+		return r;
+  803a3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a40:	eb 19                	jmp    803a5b <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  803a42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a46:	48 89 c7             	mov    %rax,%rdi
+  803a49:	49 89 df             	mov    %rbx,%r15
+  803a4c:	48 b8 7d aa ff ff ff 	movabs $0xffffffffffffaa7d,%rax
+  803a53:	ff ff ff 
+  803a56:	48 01 d8             	add    %rbx,%rax
+  803a59:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  803a5b:	48 83 c4 20          	add    $0x20,%rsp
+  803a5f:	5b                   	pop    %rbx
+  803a60:	41 5f                	pop    %r15
+  803a62:	5d                   	pop    %rbp
+  803a63:	c3                   	ret
+
+0000000000803a64 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  803a64:	55                   	push   %rbp
+  803a65:	48 89 e5             	mov    %rsp,%rbp
+  803a68:	48 83 ec 20          	sub    $0x20,%rsp
+  803a6c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803a6c <devfile_flush+0x8>
+  803a73:	49 bb c4 45 00 00 00 	movabs $0x45c4,%r11
+  803a7a:	00 00 00 
+  803a7d:	4c 01 d8             	add    %r11,%rax
+  803a80:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  803a84:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803a88:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803a8b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  803a8e:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  803a92:	ba 04 00 00 00       	mov    $0x4,%edx
+  803a97:	48 89 ce             	mov    %rcx,%rsi
+  803a9a:	bf 06 00 00 00       	mov    $0x6,%edi
+  803a9f:	48 b9 24 b7 ff ff ff 	movabs $0xffffffffffffb724,%rcx
+  803aa6:	ff ff ff 
+  803aa9:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803aad:	ff d0                	call   *%rax
+}
+  803aaf:	c9                   	leave
+  803ab0:	c3                   	ret
+
+0000000000803ab1 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803ab1:	55                   	push   %rbp
+  803ab2:	48 89 e5             	mov    %rsp,%rbp
+  803ab5:	41 57                	push   %r15
+  803ab7:	53                   	push   %rbx
+  803ab8:	48 83 ec 60          	sub    $0x60,%rsp
+  803abc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803abc <devfile_read+0xb>
+  803ac3:	49 bb 74 45 00 00 00 	movabs $0x4574,%r11
+  803aca:	00 00 00 
+  803acd:	4c 01 db             	add    %r11,%rbx
+  803ad0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803ad4:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803ad8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  803adc:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803ae0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  803ae4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803ae8:	8b 50 0c             	mov    0xc(%rax),%edx
+  803aeb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803aef:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803af1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803af5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  803af9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  803afd:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803b01:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b06:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b0b:	48 89 c6             	mov    %rax,%rsi
+  803b0e:	bf 03 00 00 00       	mov    $0x3,%edi
+  803b13:	48 b8 b8 b7 ff ff ff 	movabs $0xffffffffffffb7b8,%rax
+  803b1a:	ff ff ff 
+  803b1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b21:	ff d0                	call   *%rax
+  803b23:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803b26:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803b2a:	79 05                	jns    803b31 <devfile_read+0x80>
+		return r;
+  803b2c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b2f:	eb 64                	jmp    803b95 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  803b31:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b34:	48 63 d0             	movslq %eax,%rdx
+  803b37:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803b3b:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  803b40:	48 01 c1             	add    %rax,%rcx
+  803b43:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803b47:	48 89 ce             	mov    %rcx,%rsi
+  803b4a:	48 89 c7             	mov    %rax,%rdi
+  803b4d:	49 89 df             	mov    %rbx,%r15
+  803b50:	48 b8 f8 99 ff ff ff 	movabs $0xffffffffffff99f8,%rax
+  803b57:	ff ff ff 
+  803b5a:	48 01 d8             	add    %rbx,%rax
+  803b5d:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  803b5f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803b66:	ff ff ff 
+  803b69:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b6d:	48 8b 00             	mov    (%rax),%rax
+  803b70:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803b76:	89 c6                	mov    %eax,%esi
+  803b78:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  803b7d:	48 89 c7             	mov    %rax,%rdi
+  803b80:	49 89 df             	mov    %rbx,%r15
+  803b83:	48 b8 7d e0 ff ff ff 	movabs $0xffffffffffffe07d,%rax
+  803b8a:	ff ff ff 
+  803b8d:	48 01 d8             	add    %rbx,%rax
+  803b90:	ff d0                	call   *%rax
+	return r;
+  803b92:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803b95:	48 83 c4 60          	add    $0x60,%rsp
+  803b99:	5b                   	pop    %rbx
+  803b9a:	41 5f                	pop    %r15
+  803b9c:	5d                   	pop    %rbp
+  803b9d:	c3                   	ret
+
+0000000000803b9e <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803b9e:	55                   	push   %rbp
+  803b9f:	48 89 e5             	mov    %rsp,%rbp
+  803ba2:	41 57                	push   %r15
+  803ba4:	53                   	push   %rbx
+  803ba5:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803ba9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ba9 <devfile_write+0xb>
+  803bb0:	49 bb 87 44 00 00 00 	movabs $0x4487,%r11
+  803bb7:	00 00 00 
+  803bba:	4c 01 db             	add    %r11,%rbx
+  803bbd:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803bc1:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803bc5:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803bcc:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803bd0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803bd4:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  803bdb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803bdf:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803be6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803be9:	48 63 d0             	movslq %eax,%rdx
+  803bec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803bf0:	48 39 c2             	cmp    %rax,%rdx
+  803bf3:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803bf7:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  803bfe:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803c05:	00 
+  803c06:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803c0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c11:	48 01 d0             	add    %rdx,%rax
+  803c14:	48 83 e8 01          	sub    $0x1,%rax
+  803c18:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803c1c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c20:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c25:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803c29:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c2d:	48 29 d0             	sub    %rdx,%rax
+  803c30:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c34:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803c37:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803c3a:	89 c6                	mov    %eax,%esi
+  803c3c:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803c41:	48 89 c7             	mov    %rax,%rdi
+  803c44:	49 89 df             	mov    %rbx,%r15
+  803c47:	48 b8 37 e0 ff ff ff 	movabs $0xffffffffffffe037,%rax
+  803c4e:	ff ff ff 
+  803c51:	48 01 d8             	add    %rbx,%rax
+  803c54:	ff d0                	call   *%rax
+  803c56:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803c59:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803c5d:	79 08                	jns    803c67 <devfile_write+0xc9>
+		return r;
+  803c5f:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803c62:	e9 8f 00 00 00       	jmp    803cf6 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803c67:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803c6e:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803c72:	48 89 c6             	mov    %rax,%rsi
+  803c75:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803c7a:	48 89 c7             	mov    %rax,%rdi
+  803c7d:	49 89 df             	mov    %rbx,%r15
+  803c80:	48 b8 f8 99 ff ff ff 	movabs $0xffffffffffff99f8,%rax
+  803c87:	ff ff ff 
+  803c8a:	48 01 d8             	add    %rbx,%rax
+  803c8d:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803c8f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803c93:	8b 50 0c             	mov    0xc(%rax),%edx
+  803c96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c9a:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803c9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ca0:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803ca7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803cab:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803cae:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803cb2:	89 d1                	mov    %edx,%ecx
+  803cb4:	ba 10 00 00 00       	mov    $0x10,%edx
+  803cb9:	48 89 c6             	mov    %rax,%rsi
+  803cbc:	bf 04 00 00 00       	mov    $0x4,%edi
+  803cc1:	48 b8 b8 b7 ff ff ff 	movabs $0xffffffffffffb7b8,%rax
+  803cc8:	ff ff ff 
+  803ccb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ccf:	ff d0                	call   *%rax
+  803cd1:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803cd4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803cd7:	89 c6                	mov    %eax,%esi
+  803cd9:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803cde:	48 89 c7             	mov    %rax,%rdi
+  803ce1:	49 89 df             	mov    %rbx,%r15
+  803ce4:	48 b8 7d e0 ff ff ff 	movabs $0xffffffffffffe07d,%rax
+  803ceb:	ff ff ff 
+  803cee:	48 01 d8             	add    %rbx,%rax
+  803cf1:	ff d0                	call   *%rax
+	return r;
+  803cf3:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803cf6:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803cfa:	5b                   	pop    %rbx
+  803cfb:	41 5f                	pop    %r15
+  803cfd:	5d                   	pop    %rbp
+  803cfe:	c3                   	ret
+
+0000000000803cff <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803cff:	55                   	push   %rbp
+  803d00:	48 89 e5             	mov    %rsp,%rbp
+  803d03:	41 57                	push   %r15
+  803d05:	53                   	push   %rbx
+  803d06:	48 83 ec 20          	sub    $0x20,%rsp
+  803d0a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d0a <devfile_stat+0xb>
+  803d11:	49 bb 26 43 00 00 00 	movabs $0x4326,%r11
+  803d18:	00 00 00 
+  803d1b:	4c 01 db             	add    %r11,%rbx
+  803d1e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803d22:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803d26:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d2a:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d2d:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803d34:	00 00 00 
+  803d37:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803d3a:	be 00 00 00 00       	mov    $0x0,%esi
+  803d3f:	bf 05 00 00 00       	mov    $0x5,%edi
+  803d44:	48 b8 7c b6 ff ff ff 	movabs $0xffffffffffffb67c,%rax
+  803d4b:	ff ff ff 
+  803d4e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d52:	ff d0                	call   *%rax
+  803d54:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d57:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d5b:	79 05                	jns    803d62 <devfile_stat+0x63>
+		return r;
+  803d5d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d60:	eb 65                	jmp    803dc7 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803d62:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d66:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803d6d:	00 00 00 
+  803d70:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803d74:	48 89 d6             	mov    %rdx,%rsi
+  803d77:	48 89 c7             	mov    %rax,%rdi
+  803d7a:	49 89 df             	mov    %rbx,%r15
+  803d7d:	48 b8 18 96 ff ff ff 	movabs $0xffffffffffff9618,%rax
+  803d84:	ff ff ff 
+  803d87:	48 01 d8             	add    %rbx,%rax
+  803d8a:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803d8c:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803d93:	00 00 00 
+  803d96:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803d9d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803da1:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803da7:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803dae:	00 00 00 
+  803db1:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803db8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803dbc:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dc7:	48 83 c4 20          	add    $0x20,%rsp
+  803dcb:	5b                   	pop    %rbx
+  803dcc:	41 5f                	pop    %r15
+  803dce:	5d                   	pop    %rbp
+  803dcf:	c3                   	ret
+
+0000000000803dd0 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803dd0:	55                   	push   %rbp
+  803dd1:	48 89 e5             	mov    %rsp,%rbp
+  803dd4:	48 83 ec 20          	sub    $0x20,%rsp
+  803dd8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803dd8 <devfile_trunc+0x8>
+  803ddf:	49 bb 58 42 00 00 00 	movabs $0x4258,%r11
+  803de6:	00 00 00 
+  803de9:	4c 01 d8             	add    %r11,%rax
+  803dec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803df0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803df3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803df7:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803dfa:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803dfd:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803e00:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803e03:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803e07:	ba 08 00 00 00       	mov    $0x8,%edx
+  803e0c:	48 89 ce             	mov    %rcx,%rsi
+  803e0f:	bf 02 00 00 00       	mov    $0x2,%edi
+  803e14:	48 b9 24 b7 ff ff ff 	movabs $0xffffffffffffb724,%rcx
+  803e1b:	ff ff ff 
+  803e1e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803e22:	ff d0                	call   *%rax
+}
+  803e24:	c9                   	leave
+  803e25:	c3                   	ret
+
+0000000000803e26 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803e26:	55                   	push   %rbp
+  803e27:	48 89 e5             	mov    %rsp,%rbp
+  803e2a:	41 57                	push   %r15
+  803e2c:	53                   	push   %rbx
+  803e2d:	48 83 ec 10          	sub    $0x10,%rsp
+  803e31:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e31 <remove+0xb>
+  803e38:	49 bb ff 41 00 00 00 	movabs $0x41ff,%r11
+  803e3f:	00 00 00 
+  803e42:	4c 01 db             	add    %r11,%rbx
+  803e45:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803e49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e4d:	48 89 c7             	mov    %rax,%rdi
+  803e50:	49 89 df             	mov    %rbx,%r15
+  803e53:	48 b8 84 95 ff ff ff 	movabs $0xffffffffffff9584,%rax
+  803e5a:	ff ff ff 
+  803e5d:	48 01 d8             	add    %rbx,%rax
+  803e60:	ff d0                	call   *%rax
+  803e62:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803e67:	7e 07                	jle    803e70 <remove+0x4a>
+		return -E_BAD_PATH;
+  803e69:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803e6e:	eb 44                	jmp    803eb4 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803e70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e74:	48 89 c6             	mov    %rax,%rsi
+  803e77:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803e7e:	00 00 00 
+  803e81:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e85:	48 89 c7             	mov    %rax,%rdi
+  803e88:	49 89 df             	mov    %rbx,%r15
+  803e8b:	48 b8 18 96 ff ff ff 	movabs $0xffffffffffff9618,%rax
+  803e92:	ff ff ff 
+  803e95:	48 01 d8             	add    %rbx,%rax
+  803e98:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803e9a:	be 00 00 00 00       	mov    $0x0,%esi
+  803e9f:	bf 07 00 00 00       	mov    $0x7,%edi
+  803ea4:	48 b8 7c b6 ff ff ff 	movabs $0xffffffffffffb67c,%rax
+  803eab:	ff ff ff 
+  803eae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803eb2:	ff d0                	call   *%rax
+}
+  803eb4:	48 83 c4 10          	add    $0x10,%rsp
+  803eb8:	5b                   	pop    %rbx
+  803eb9:	41 5f                	pop    %r15
+  803ebb:	5d                   	pop    %rbp
+  803ebc:	c3                   	ret
+
+0000000000803ebd <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803ebd:	55                   	push   %rbp
+  803ebe:	48 89 e5             	mov    %rsp,%rbp
+  803ec1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ec1 <sync+0x4>
+  803ec8:	49 bb 6f 41 00 00 00 	movabs $0x416f,%r11
+  803ecf:	00 00 00 
+  803ed2:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803ed5:	ba 00 00 00 00       	mov    $0x0,%edx
+  803eda:	be 00 00 00 00       	mov    $0x0,%esi
+  803edf:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ee4:	48 b9 24 b7 ff ff ff 	movabs $0xffffffffffffb724,%rcx
+  803eeb:	ff ff ff 
+  803eee:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803ef2:	ff d0                	call   *%rax
+}
+  803ef4:	5d                   	pop    %rbp
+  803ef5:	c3                   	ret
+
+0000000000803ef6 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803ef6:	55                   	push   %rbp
+  803ef7:	48 89 e5             	mov    %rsp,%rbp
+  803efa:	41 57                	push   %r15
+  803efc:	53                   	push   %rbx
+  803efd:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803f04:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f04 <copy+0xe>
+  803f0b:	49 bb 2c 41 00 00 00 	movabs $0x412c,%r11
+  803f12:	00 00 00 
+  803f15:	4c 01 db             	add    %r11,%rbx
+  803f18:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803f1f:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803f26:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803f2d:	be 00 00 00 00       	mov    $0x0,%esi
+  803f32:	48 89 c7             	mov    %rax,%rdi
+  803f35:	48 b8 c3 b8 ff ff ff 	movabs $0xffffffffffffb8c3,%rax
+  803f3c:	ff ff ff 
+  803f3f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f43:	ff d0                	call   *%rax
+  803f45:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803f48:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f4c:	79 35                	jns    803f83 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803f4e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f51:	89 c6                	mov    %eax,%esi
+  803f53:	48 b8 e6 e7 ff ff ff 	movabs $0xffffffffffffe7e6,%rax
+  803f5a:	ff ff ff 
+  803f5d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f61:	48 89 c7             	mov    %rax,%rdi
+  803f64:	49 89 df             	mov    %rbx,%r15
+  803f67:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f6c:	48 ba 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rdx
+  803f73:	ff ff ff 
+  803f76:	48 01 da             	add    %rbx,%rdx
+  803f79:	ff d2                	call   *%rdx
+		return fd_src;
+  803f7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f7e:	e9 d7 01 00 00       	jmp    80415a <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803f83:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803f8a:	be 01 01 00 00       	mov    $0x101,%esi
+  803f8f:	48 89 c7             	mov    %rax,%rdi
+  803f92:	48 b8 c3 b8 ff ff ff 	movabs $0xffffffffffffb8c3,%rax
+  803f99:	ff ff ff 
+  803f9c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fa0:	ff d0                	call   *%rax
+  803fa2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803fa5:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803fa9:	0f 89 df 00 00 00    	jns    80408e <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803faf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803fb2:	89 c6                	mov    %eax,%esi
+  803fb4:	48 b8 fc e7 ff ff ff 	movabs $0xffffffffffffe7fc,%rax
+  803fbb:	ff ff ff 
+  803fbe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fc2:	48 89 c7             	mov    %rax,%rdi
+  803fc5:	49 89 df             	mov    %rbx,%r15
+  803fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fcd:	48 ba 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rdx
+  803fd4:	ff ff ff 
+  803fd7:	48 01 da             	add    %rbx,%rdx
+  803fda:	ff d2                	call   *%rdx
+		close(fd_src);
+  803fdc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fdf:	89 c7                	mov    %eax,%edi
+  803fe1:	49 89 df             	mov    %rbx,%r15
+  803fe4:	48 b8 3c ae ff ff ff 	movabs $0xffffffffffffae3c,%rax
+  803feb:	ff ff ff 
+  803fee:	48 01 d8             	add    %rbx,%rax
+  803ff1:	ff d0                	call   *%rax
+		return fd_dest;
+  803ff3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ff6:	e9 5f 01 00 00       	jmp    80415a <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803ffb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ffe:	48 63 d0             	movslq %eax,%rdx
+  804001:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804008:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80400b:	48 89 ce             	mov    %rcx,%rsi
+  80400e:	89 c7                	mov    %eax,%edi
+  804010:	49 89 df             	mov    %rbx,%r15
+  804013:	48 b8 9a b2 ff ff ff 	movabs $0xffffffffffffb29a,%rax
+  80401a:	ff ff ff 
+  80401d:	48 01 d8             	add    %rbx,%rax
+  804020:	ff d0                	call   *%rax
+  804022:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804025:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804029:	79 63                	jns    80408e <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  80402b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80402e:	89 c6                	mov    %eax,%esi
+  804030:	48 b8 16 e8 ff ff ff 	movabs $0xffffffffffffe816,%rax
+  804037:	ff ff ff 
+  80403a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80403e:	48 89 c7             	mov    %rax,%rdi
+  804041:	49 89 df             	mov    %rbx,%r15
+  804044:	b8 00 00 00 00       	mov    $0x0,%eax
+  804049:	48 ba 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rdx
+  804050:	ff ff ff 
+  804053:	48 01 da             	add    %rbx,%rdx
+  804056:	ff d2                	call   *%rdx
+			close(fd_src);
+  804058:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80405b:	89 c7                	mov    %eax,%edi
+  80405d:	49 89 df             	mov    %rbx,%r15
+  804060:	48 b8 3c ae ff ff ff 	movabs $0xffffffffffffae3c,%rax
+  804067:	ff ff ff 
+  80406a:	48 01 d8             	add    %rbx,%rax
+  80406d:	ff d0                	call   *%rax
+			close(fd_dest);
+  80406f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804072:	89 c7                	mov    %eax,%edi
+  804074:	49 89 df             	mov    %rbx,%r15
+  804077:	48 b8 3c ae ff ff ff 	movabs $0xffffffffffffae3c,%rax
+  80407e:	ff ff ff 
+  804081:	48 01 d8             	add    %rbx,%rax
+  804084:	ff d0                	call   *%rax
+			return write_size;
+  804086:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804089:	e9 cc 00 00 00       	jmp    80415a <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  80408e:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804095:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804098:	ba 00 02 00 00       	mov    $0x200,%edx
+  80409d:	48 89 ce             	mov    %rcx,%rsi
+  8040a0:	89 c7                	mov    %eax,%edi
+  8040a2:	49 89 df             	mov    %rbx,%r15
+  8040a5:	48 b8 f4 b0 ff ff ff 	movabs $0xffffffffffffb0f4,%rax
+  8040ac:	ff ff ff 
+  8040af:	48 01 d8             	add    %rbx,%rax
+  8040b2:	ff d0                	call   *%rax
+  8040b4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8040b7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8040bb:	0f 8f 3a ff ff ff    	jg     803ffb <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  8040c1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8040c5:	79 60                	jns    804127 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  8040c7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8040ca:	89 c6                	mov    %eax,%esi
+  8040cc:	48 b8 29 e8 ff ff ff 	movabs $0xffffffffffffe829,%rax
+  8040d3:	ff ff ff 
+  8040d6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040da:	48 89 c7             	mov    %rax,%rdi
+  8040dd:	49 89 df             	mov    %rbx,%r15
+  8040e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040e5:	48 ba 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rdx
+  8040ec:	ff ff ff 
+  8040ef:	48 01 da             	add    %rbx,%rdx
+  8040f2:	ff d2                	call   *%rdx
+		close(fd_src);
+  8040f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040f7:	89 c7                	mov    %eax,%edi
+  8040f9:	49 89 df             	mov    %rbx,%r15
+  8040fc:	48 b8 3c ae ff ff ff 	movabs $0xffffffffffffae3c,%rax
+  804103:	ff ff ff 
+  804106:	48 01 d8             	add    %rbx,%rax
+  804109:	ff d0                	call   *%rax
+		close(fd_dest);
+  80410b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80410e:	89 c7                	mov    %eax,%edi
+  804110:	49 89 df             	mov    %rbx,%r15
+  804113:	48 b8 3c ae ff ff ff 	movabs $0xffffffffffffae3c,%rax
+  80411a:	ff ff ff 
+  80411d:	48 01 d8             	add    %rbx,%rax
+  804120:	ff d0                	call   *%rax
+		return read_size;
+  804122:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804125:	eb 33                	jmp    80415a <copy+0x264>
+	}
+	close(fd_src);
+  804127:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80412a:	89 c7                	mov    %eax,%edi
+  80412c:	49 89 df             	mov    %rbx,%r15
+  80412f:	48 b8 3c ae ff ff ff 	movabs $0xffffffffffffae3c,%rax
+  804136:	ff ff ff 
+  804139:	48 01 d8             	add    %rbx,%rax
+  80413c:	ff d0                	call   *%rax
+	close(fd_dest);
+  80413e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804141:	89 c7                	mov    %eax,%edi
+  804143:	49 89 df             	mov    %rbx,%r15
+  804146:	48 b8 3c ae ff ff ff 	movabs $0xffffffffffffae3c,%rax
+  80414d:	ff ff ff 
+  804150:	48 01 d8             	add    %rbx,%rax
+  804153:	ff d0                	call   *%rax
+	return 0;
+  804155:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  80415a:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804161:	5b                   	pop    %rbx
+  804162:	41 5f                	pop    %r15
+  804164:	5d                   	pop    %rbp
+  804165:	c3                   	ret
+
+0000000000804166 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804166:	55                   	push   %rbp
+  804167:	48 89 e5             	mov    %rsp,%rbp
+  80416a:	41 57                	push   %r15
+  80416c:	53                   	push   %rbx
+  80416d:	48 83 ec 20          	sub    $0x20,%rsp
+  804171:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804171 <fd2sockid+0xb>
+  804178:	49 bb bf 3e 00 00 00 	movabs $0x3ebf,%r11
+  80417f:	00 00 00 
+  804182:	4c 01 db             	add    %r11,%rbx
+  804185:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804188:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80418c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80418f:	48 89 d6             	mov    %rdx,%rsi
+  804192:	89 c7                	mov    %eax,%edi
+  804194:	49 89 df             	mov    %rbx,%r15
+  804197:	48 b8 ad ab ff ff ff 	movabs $0xffffffffffffabad,%rax
+  80419e:	ff ff ff 
+  8041a1:	48 01 d8             	add    %rbx,%rax
+  8041a4:	ff d0                	call   *%rax
+  8041a6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041a9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041ad:	79 05                	jns    8041b4 <fd2sockid+0x4e>
+		return r;
+  8041af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041b2:	eb 25                	jmp    8041d9 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8041b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041b8:	8b 10                	mov    (%rax),%edx
+  8041ba:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  8041c1:	00 00 00 
+  8041c4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8041c7:	39 c2                	cmp    %eax,%edx
+  8041c9:	74 07                	je     8041d2 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  8041cb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8041d0:	eb 07                	jmp    8041d9 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8041d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041d6:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8041d9:	48 83 c4 20          	add    $0x20,%rsp
+  8041dd:	5b                   	pop    %rbx
+  8041de:	41 5f                	pop    %r15
+  8041e0:	5d                   	pop    %rbp
+  8041e1:	c3                   	ret
+
+00000000008041e2 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8041e2:	55                   	push   %rbp
+  8041e3:	48 89 e5             	mov    %rsp,%rbp
+  8041e6:	41 57                	push   %r15
+  8041e8:	53                   	push   %rbx
+  8041e9:	48 83 ec 20          	sub    $0x20,%rsp
+  8041ed:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041ed <alloc_sockfd+0xb>
+  8041f4:	49 bb 43 3e 00 00 00 	movabs $0x3e43,%r11
+  8041fb:	00 00 00 
+  8041fe:	4c 01 db             	add    %r11,%rbx
+  804201:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804204:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804208:	48 89 c7             	mov    %rax,%rdi
+  80420b:	49 89 df             	mov    %rbx,%r15
+  80420e:	48 b8 f7 aa ff ff ff 	movabs $0xffffffffffffaaf7,%rax
+  804215:	ff ff ff 
+  804218:	48 01 d8             	add    %rbx,%rax
+  80421b:	ff d0                	call   *%rax
+  80421d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804220:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804224:	78 2c                	js     804252 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804226:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80422a:	ba 07 04 00 00       	mov    $0x407,%edx
+  80422f:	48 89 c6             	mov    %rax,%rsi
+  804232:	bf 00 00 00 00       	mov    $0x0,%edi
+  804237:	49 89 df             	mov    %rbx,%r15
+  80423a:	48 b8 d4 a2 ff ff ff 	movabs $0xffffffffffffa2d4,%rax
+  804241:	ff ff ff 
+  804244:	48 01 d8             	add    %rbx,%rax
+  804247:	ff d0                	call   *%rax
+  804249:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80424c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804250:	79 1c                	jns    80426e <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804252:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804255:	89 c7                	mov    %eax,%edi
+  804257:	49 89 df             	mov    %rbx,%r15
+  80425a:	48 b8 a6 c9 ff ff ff 	movabs $0xffffffffffffc9a6,%rax
+  804261:	ff ff ff 
+  804264:	48 01 d8             	add    %rbx,%rax
+  804267:	ff d0                	call   *%rax
+		return r;
+  804269:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80426c:	eb 41                	jmp    8042af <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80426e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804272:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  804279:	00 00 00 
+  80427c:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80427f:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804281:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804285:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  80428c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804290:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804293:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804296:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80429a:	48 89 c7             	mov    %rax,%rdi
+  80429d:	49 89 df             	mov    %rbx,%r15
+  8042a0:	48 b8 7d aa ff ff ff 	movabs $0xffffffffffffaa7d,%rax
+  8042a7:	ff ff ff 
+  8042aa:	48 01 d8             	add    %rbx,%rax
+  8042ad:	ff d0                	call   *%rax
+}
+  8042af:	48 83 c4 20          	add    $0x20,%rsp
+  8042b3:	5b                   	pop    %rbx
+  8042b4:	41 5f                	pop    %r15
+  8042b6:	5d                   	pop    %rbp
+  8042b7:	c3                   	ret
+
+00000000008042b8 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8042b8:	55                   	push   %rbp
+  8042b9:	48 89 e5             	mov    %rsp,%rbp
+  8042bc:	41 57                	push   %r15
+  8042be:	53                   	push   %rbx
+  8042bf:	48 83 ec 30          	sub    $0x30,%rsp
+  8042c3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042c3 <accept+0xb>
+  8042ca:	49 bb 6d 3d 00 00 00 	movabs $0x3d6d,%r11
+  8042d1:	00 00 00 
+  8042d4:	4c 01 db             	add    %r11,%rbx
+  8042d7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8042da:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8042de:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8042e2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8042e5:	89 c7                	mov    %eax,%edi
+  8042e7:	48 b8 36 c1 ff ff ff 	movabs $0xffffffffffffc136,%rax
+  8042ee:	ff ff ff 
+  8042f1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042f5:	ff d0                	call   *%rax
+  8042f7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042fa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042fe:	79 05                	jns    804305 <accept+0x4d>
+		return r;
+  804300:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804303:	eb 45                	jmp    80434a <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804305:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804309:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80430d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804310:	48 89 ce             	mov    %rcx,%rsi
+  804313:	89 c7                	mov    %eax,%edi
+  804315:	49 89 df             	mov    %rbx,%r15
+  804318:	48 b8 14 c8 ff ff ff 	movabs $0xffffffffffffc814,%rax
+  80431f:	ff ff ff 
+  804322:	48 01 d8             	add    %rbx,%rax
+  804325:	ff d0                	call   *%rax
+  804327:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80432a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80432e:	79 05                	jns    804335 <accept+0x7d>
+		return r;
+  804330:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804333:	eb 15                	jmp    80434a <accept+0x92>
+	return alloc_sockfd(r);
+  804335:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804338:	89 c7                	mov    %eax,%edi
+  80433a:	48 b8 b2 c1 ff ff ff 	movabs $0xffffffffffffc1b2,%rax
+  804341:	ff ff ff 
+  804344:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804348:	ff d0                	call   *%rax
+}
+  80434a:	48 83 c4 30          	add    $0x30,%rsp
+  80434e:	5b                   	pop    %rbx
+  80434f:	41 5f                	pop    %r15
+  804351:	5d                   	pop    %rbp
+  804352:	c3                   	ret
+
+0000000000804353 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804353:	55                   	push   %rbp
+  804354:	48 89 e5             	mov    %rsp,%rbp
+  804357:	41 57                	push   %r15
+  804359:	53                   	push   %rbx
+  80435a:	48 83 ec 20          	sub    $0x20,%rsp
+  80435e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80435e <bind+0xb>
+  804365:	49 bb d2 3c 00 00 00 	movabs $0x3cd2,%r11
+  80436c:	00 00 00 
+  80436f:	4c 01 db             	add    %r11,%rbx
+  804372:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804375:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804379:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80437c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80437f:	89 c7                	mov    %eax,%edi
+  804381:	48 b8 36 c1 ff ff ff 	movabs $0xffffffffffffc136,%rax
+  804388:	ff ff ff 
+  80438b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80438f:	ff d0                	call   *%rax
+  804391:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804394:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804398:	79 05                	jns    80439f <bind+0x4c>
+		return r;
+  80439a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80439d:	eb 21                	jmp    8043c0 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  80439f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8043a2:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8043a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043a9:	48 89 ce             	mov    %rcx,%rsi
+  8043ac:	89 c7                	mov    %eax,%edi
+  8043ae:	49 89 df             	mov    %rbx,%r15
+  8043b1:	48 b8 c0 c8 ff ff ff 	movabs $0xffffffffffffc8c0,%rax
+  8043b8:	ff ff ff 
+  8043bb:	48 01 d8             	add    %rbx,%rax
+  8043be:	ff d0                	call   *%rax
+}
+  8043c0:	48 83 c4 20          	add    $0x20,%rsp
+  8043c4:	5b                   	pop    %rbx
+  8043c5:	41 5f                	pop    %r15
+  8043c7:	5d                   	pop    %rbp
+  8043c8:	c3                   	ret
+
+00000000008043c9 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  8043c9:	55                   	push   %rbp
+  8043ca:	48 89 e5             	mov    %rsp,%rbp
+  8043cd:	41 57                	push   %r15
+  8043cf:	53                   	push   %rbx
+  8043d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8043d4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043d4 <shutdown+0xb>
+  8043db:	49 bb 5c 3c 00 00 00 	movabs $0x3c5c,%r11
+  8043e2:	00 00 00 
+  8043e5:	4c 01 db             	add    %r11,%rbx
+  8043e8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8043eb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8043ee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043f1:	89 c7                	mov    %eax,%edi
+  8043f3:	48 b8 36 c1 ff ff ff 	movabs $0xffffffffffffc136,%rax
+  8043fa:	ff ff ff 
+  8043fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804401:	ff d0                	call   *%rax
+  804403:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804406:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80440a:	79 05                	jns    804411 <shutdown+0x48>
+		return r;
+  80440c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80440f:	eb 1c                	jmp    80442d <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804411:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804414:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804417:	89 d6                	mov    %edx,%esi
+  804419:	89 c7                	mov    %eax,%edi
+  80441b:	49 89 df             	mov    %rbx,%r15
+  80441e:	48 b8 55 c9 ff ff ff 	movabs $0xffffffffffffc955,%rax
+  804425:	ff ff ff 
+  804428:	48 01 d8             	add    %rbx,%rax
+  80442b:	ff d0                	call   *%rax
+}
+  80442d:	48 83 c4 20          	add    $0x20,%rsp
+  804431:	5b                   	pop    %rbx
+  804432:	41 5f                	pop    %r15
+  804434:	5d                   	pop    %rbp
+  804435:	c3                   	ret
+
+0000000000804436 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804436:	55                   	push   %rbp
+  804437:	48 89 e5             	mov    %rsp,%rbp
+  80443a:	41 57                	push   %r15
+  80443c:	53                   	push   %rbx
+  80443d:	48 83 ec 10          	sub    $0x10,%rsp
+  804441:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804441 <devsock_close+0xb>
+  804448:	49 bb ef 3b 00 00 00 	movabs $0x3bef,%r11
+  80444f:	00 00 00 
+  804452:	4c 01 db             	add    %r11,%rbx
+  804455:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804459:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80445d:	48 89 c7             	mov    %rax,%rdi
+  804460:	49 89 df             	mov    %rbx,%r15
+  804463:	48 b8 52 e1 ff ff ff 	movabs $0xffffffffffffe152,%rax
+  80446a:	ff ff ff 
+  80446d:	48 01 d8             	add    %rbx,%rax
+  804470:	ff d0                	call   *%rax
+  804472:	83 f8 01             	cmp    $0x1,%eax
+  804475:	75 1d                	jne    804494 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804477:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80447b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80447e:	89 c7                	mov    %eax,%edi
+  804480:	49 89 df             	mov    %rbx,%r15
+  804483:	48 b8 a6 c9 ff ff ff 	movabs $0xffffffffffffc9a6,%rax
+  80448a:	ff ff ff 
+  80448d:	48 01 d8             	add    %rbx,%rax
+  804490:	ff d0                	call   *%rax
+  804492:	eb 05                	jmp    804499 <devsock_close+0x63>
+	else
+		return 0;
+  804494:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804499:	48 83 c4 10          	add    $0x10,%rsp
+  80449d:	5b                   	pop    %rbx
+  80449e:	41 5f                	pop    %r15
+  8044a0:	5d                   	pop    %rbp
+  8044a1:	c3                   	ret
+
+00000000008044a2 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8044a2:	55                   	push   %rbp
+  8044a3:	48 89 e5             	mov    %rsp,%rbp
+  8044a6:	41 57                	push   %r15
+  8044a8:	53                   	push   %rbx
+  8044a9:	48 83 ec 20          	sub    $0x20,%rsp
+  8044ad:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044ad <connect+0xb>
+  8044b4:	49 bb 83 3b 00 00 00 	movabs $0x3b83,%r11
+  8044bb:	00 00 00 
+  8044be:	4c 01 db             	add    %r11,%rbx
+  8044c1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8044c4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8044c8:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8044cb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044ce:	89 c7                	mov    %eax,%edi
+  8044d0:	48 b8 36 c1 ff ff ff 	movabs $0xffffffffffffc136,%rax
+  8044d7:	ff ff ff 
+  8044da:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044de:	ff d0                	call   *%rax
+  8044e0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044e3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044e7:	79 05                	jns    8044ee <connect+0x4c>
+		return r;
+  8044e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044ec:	eb 21                	jmp    80450f <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8044ee:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8044f1:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8044f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044f8:	48 89 ce             	mov    %rcx,%rsi
+  8044fb:	89 c7                	mov    %eax,%edi
+  8044fd:	49 89 df             	mov    %rbx,%r15
+  804500:	48 b8 ee c9 ff ff ff 	movabs $0xffffffffffffc9ee,%rax
+  804507:	ff ff ff 
+  80450a:	48 01 d8             	add    %rbx,%rax
+  80450d:	ff d0                	call   *%rax
+}
+  80450f:	48 83 c4 20          	add    $0x20,%rsp
+  804513:	5b                   	pop    %rbx
+  804514:	41 5f                	pop    %r15
+  804516:	5d                   	pop    %rbp
+  804517:	c3                   	ret
+
+0000000000804518 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804518:	55                   	push   %rbp
+  804519:	48 89 e5             	mov    %rsp,%rbp
+  80451c:	41 57                	push   %r15
+  80451e:	53                   	push   %rbx
+  80451f:	48 83 ec 20          	sub    $0x20,%rsp
+  804523:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804523 <listen+0xb>
+  80452a:	49 bb 0d 3b 00 00 00 	movabs $0x3b0d,%r11
+  804531:	00 00 00 
+  804534:	4c 01 db             	add    %r11,%rbx
+  804537:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80453a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80453d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804540:	89 c7                	mov    %eax,%edi
+  804542:	48 b8 36 c1 ff ff ff 	movabs $0xffffffffffffc136,%rax
+  804549:	ff ff ff 
+  80454c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804550:	ff d0                	call   *%rax
+  804552:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804555:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804559:	79 05                	jns    804560 <listen+0x48>
+		return r;
+  80455b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80455e:	eb 1c                	jmp    80457c <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804560:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804563:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804566:	89 d6                	mov    %edx,%esi
+  804568:	89 c7                	mov    %eax,%edi
+  80456a:	49 89 df             	mov    %rbx,%r15
+  80456d:	48 b8 83 ca ff ff ff 	movabs $0xffffffffffffca83,%rax
+  804574:	ff ff ff 
+  804577:	48 01 d8             	add    %rbx,%rax
+  80457a:	ff d0                	call   *%rax
+}
+  80457c:	48 83 c4 20          	add    $0x20,%rsp
+  804580:	5b                   	pop    %rbx
+  804581:	41 5f                	pop    %r15
+  804583:	5d                   	pop    %rbp
+  804584:	c3                   	ret
+
+0000000000804585 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804585:	55                   	push   %rbp
+  804586:	48 89 e5             	mov    %rsp,%rbp
+  804589:	41 57                	push   %r15
+  80458b:	48 83 ec 28          	sub    $0x28,%rsp
+  80458f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80458f <devsock_read+0xa>
+  804596:	49 bb a1 3a 00 00 00 	movabs $0x3aa1,%r11
+  80459d:	00 00 00 
+  8045a0:	4c 01 d8             	add    %r11,%rax
+  8045a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8045a7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8045ab:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8045af:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8045b3:	41 89 d0             	mov    %edx,%r8d
+  8045b6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8045ba:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8045bd:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8045c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8045c6:	44 89 c2             	mov    %r8d,%edx
+  8045c9:	49 89 c7             	mov    %rax,%r15
+  8045cc:	49 b8 d4 ca ff ff ff 	movabs $0xffffffffffffcad4,%r8
+  8045d3:	ff ff ff 
+  8045d6:	49 01 c0             	add    %rax,%r8
+  8045d9:	41 ff d0             	call   *%r8
+}
+  8045dc:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8045e0:	c9                   	leave
+  8045e1:	c3                   	ret
+
+00000000008045e2 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8045e2:	55                   	push   %rbp
+  8045e3:	48 89 e5             	mov    %rsp,%rbp
+  8045e6:	41 57                	push   %r15
+  8045e8:	48 83 ec 28          	sub    $0x28,%rsp
+  8045ec:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8045ec <devsock_write+0xa>
+  8045f3:	49 bb 44 3a 00 00 00 	movabs $0x3a44,%r11
+  8045fa:	00 00 00 
+  8045fd:	4c 01 d8             	add    %r11,%rax
+  804600:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804604:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804608:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80460c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804610:	41 89 d0             	mov    %edx,%r8d
+  804613:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804617:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80461a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80461e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804623:	44 89 c2             	mov    %r8d,%edx
+  804626:	49 89 c7             	mov    %rax,%r15
+  804629:	49 b8 f1 cb ff ff ff 	movabs $0xffffffffffffcbf1,%r8
+  804630:	ff ff ff 
+  804633:	49 01 c0             	add    %rax,%r8
+  804636:	41 ff d0             	call   *%r8
+}
+  804639:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80463d:	c9                   	leave
+  80463e:	c3                   	ret
+
+000000000080463f <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80463f:	55                   	push   %rbp
+  804640:	48 89 e5             	mov    %rsp,%rbp
+  804643:	41 57                	push   %r15
+  804645:	48 83 ec 18          	sub    $0x18,%rsp
+  804649:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804649 <devsock_stat+0xa>
+  804650:	49 bb e7 39 00 00 00 	movabs $0x39e7,%r11
+  804657:	00 00 00 
+  80465a:	4c 01 d8             	add    %r11,%rax
+  80465d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804661:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804665:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804669:	48 b9 44 e8 ff ff ff 	movabs $0xffffffffffffe844,%rcx
+  804670:	ff ff ff 
+  804673:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804677:	48 89 ce             	mov    %rcx,%rsi
+  80467a:	48 89 d7             	mov    %rdx,%rdi
+  80467d:	49 89 c7             	mov    %rax,%r15
+  804680:	48 ba 18 96 ff ff ff 	movabs $0xffffffffffff9618,%rdx
+  804687:	ff ff ff 
+  80468a:	48 01 c2             	add    %rax,%rdx
+  80468d:	ff d2                	call   *%rdx
+	return 0;
+  80468f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804694:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804698:	c9                   	leave
+  804699:	c3                   	ret
+
+000000000080469a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80469a:	55                   	push   %rbp
+  80469b:	48 89 e5             	mov    %rsp,%rbp
+  80469e:	41 57                	push   %r15
+  8046a0:	53                   	push   %rbx
+  8046a1:	48 83 ec 20          	sub    $0x20,%rsp
+  8046a5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046a5 <socket+0xb>
+  8046ac:	49 bb 8b 39 00 00 00 	movabs $0x398b,%r11
+  8046b3:	00 00 00 
+  8046b6:	4c 01 db             	add    %r11,%rbx
+  8046b9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8046bc:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8046bf:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8046c2:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8046c5:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8046c8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8046cb:	89 ce                	mov    %ecx,%esi
+  8046cd:	89 c7                	mov    %eax,%edi
+  8046cf:	49 89 df             	mov    %rbx,%r15
+  8046d2:	48 b8 c8 cd ff ff ff 	movabs $0xffffffffffffcdc8,%rax
+  8046d9:	ff ff ff 
+  8046dc:	48 01 d8             	add    %rbx,%rax
+  8046df:	ff d0                	call   *%rax
+  8046e1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046e4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046e8:	79 05                	jns    8046ef <socket+0x55>
+		return r;
+  8046ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046ed:	eb 15                	jmp    804704 <socket+0x6a>
+	return alloc_sockfd(r);
+  8046ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046f2:	89 c7                	mov    %eax,%edi
+  8046f4:	48 b8 b2 c1 ff ff ff 	movabs $0xffffffffffffc1b2,%rax
+  8046fb:	ff ff ff 
+  8046fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804702:	ff d0                	call   *%rax
+}
+  804704:	48 83 c4 20          	add    $0x20,%rsp
+  804708:	5b                   	pop    %rbx
+  804709:	41 5f                	pop    %r15
+  80470b:	5d                   	pop    %rbp
+  80470c:	c3                   	ret
+
+000000000080470d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80470d:	55                   	push   %rbp
+  80470e:	48 89 e5             	mov    %rsp,%rbp
+  804711:	41 57                	push   %r15
+  804713:	53                   	push   %rbx
+  804714:	48 83 ec 10          	sub    $0x10,%rsp
+  804718:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804718 <nsipc+0xb>
+  80471f:	49 bb 18 39 00 00 00 	movabs $0x3918,%r11
+  804726:	00 00 00 
+  804729:	4c 01 db             	add    %r11,%rbx
+  80472c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  80472f:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804736:	00 00 00 
+  804739:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80473c:	85 c0                	test   %eax,%eax
+  80473e:	75 24                	jne    804764 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804740:	bf 02 00 00 00       	mov    $0x2,%edi
+  804745:	49 89 df             	mov    %rbx,%r15
+  804748:	48 b8 c3 e0 ff ff ff 	movabs $0xffffffffffffe0c3,%rax
+  80474f:	ff ff ff 
+  804752:	48 01 d8             	add    %rbx,%rax
+  804755:	ff d0                	call   *%rax
+  804757:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  80475e:	00 00 00 
+  804761:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  804764:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  80476b:	00 00 00 
+  80476e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804771:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804774:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80477a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804780:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804785:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80478c:	00 00 00 
+  80478f:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804793:	89 c7                	mov    %eax,%edi
+  804795:	49 89 df             	mov    %rbx,%r15
+  804798:	48 b8 e2 da ff ff ff 	movabs $0xffffffffffffdae2,%rax
+  80479f:	ff ff ff 
+  8047a2:	48 01 d8             	add    %rbx,%rax
+  8047a5:	ff d0                	call   *%rax
+}
+  8047a7:	48 83 c4 10          	add    $0x10,%rsp
+  8047ab:	5b                   	pop    %rbx
+  8047ac:	41 5f                	pop    %r15
+  8047ae:	5d                   	pop    %rbp
+  8047af:	c3                   	ret
+
+00000000008047b0 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  8047b0:	55                   	push   %rbp
+  8047b1:	48 89 e5             	mov    %rsp,%rbp
+  8047b4:	41 57                	push   %r15
+  8047b6:	53                   	push   %rbx
+  8047b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8047bb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047bb <nsipc_words+0xb>
+  8047c2:	49 bb 75 38 00 00 00 	movabs $0x3875,%r11
+  8047c9:	00 00 00 
+  8047cc:	4c 01 db             	add    %r11,%rbx
+  8047cf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8047d2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8047d6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8047da:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8047e1:	00 00 00 
+  8047e4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8047e7:	85 c0                	test   %eax,%eax
+  8047e9:	75 24                	jne    80480f <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8047eb:	bf 02 00 00 00       	mov    $0x2,%edi
+  8047f0:	49 89 df             	mov    %rbx,%r15
+  8047f3:	48 b8 c3 e0 ff ff ff 	movabs $0xffffffffffffe0c3,%rax
+  8047fa:	ff ff ff 
+  8047fd:	48 01 d8             	add    %rbx,%rax
+  804800:	ff d0                	call   *%rax
+  804802:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804809:	00 00 00 
+  80480c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  80480f:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804816:	00 00 00 
+  804819:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80481c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804820:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804824:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804827:	89 c7                	mov    %eax,%edi
+  804829:	49 89 df             	mov    %rbx,%r15
+  80482c:	48 b8 cd db ff ff ff 	movabs $0xffffffffffffdbcd,%rax
+  804833:	ff ff ff 
+  804836:	48 01 d8             	add    %rbx,%rax
+  804839:	ff d0                	call   *%rax
+}
+  80483b:	48 83 c4 20          	add    $0x20,%rsp
+  80483f:	5b                   	pop    %rbx
+  804840:	41 5f                	pop    %r15
+  804842:	5d                   	pop    %rbp
+  804843:	c3                   	ret
+
+0000000000804844 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804844:	55                   	push   %rbp
+  804845:	48 89 e5             	mov    %rsp,%rbp
+  804848:	41 57                	push   %r15
+  80484a:	53                   	push   %rbx
+  80484b:	48 83 ec 30          	sub    $0x30,%rsp
+  80484f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80484f <nsipc_accept+0xb>
+  804856:	49 bb e1 37 00 00 00 	movabs $0x37e1,%r11
+  80485d:	00 00 00 
+  804860:	4c 01 db             	add    %r11,%rbx
+  804863:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804866:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80486a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80486e:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804875:	00 00 00 
+  804878:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80487b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80487e:	bf 01 00 00 00       	mov    $0x1,%edi
+  804883:	48 b8 dd c6 ff ff ff 	movabs $0xffffffffffffc6dd,%rax
+  80488a:	ff ff ff 
+  80488d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804891:	ff d0                	call   *%rax
+  804893:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804896:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80489a:	78 48                	js     8048e4 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  80489c:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  8048a3:	00 00 00 
+  8048a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048aa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8048ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048b2:	8b 40 10             	mov    0x10(%rax),%eax
+  8048b5:	89 c2                	mov    %eax,%edx
+  8048b7:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8048bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048bf:	48 89 ce             	mov    %rcx,%rsi
+  8048c2:	48 89 c7             	mov    %rax,%rdi
+  8048c5:	49 89 df             	mov    %rbx,%r15
+  8048c8:	48 b8 f8 99 ff ff ff 	movabs $0xffffffffffff99f8,%rax
+  8048cf:	ff ff ff 
+  8048d2:	48 01 d8             	add    %rbx,%rax
+  8048d5:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8048d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048db:	8b 50 10             	mov    0x10(%rax),%edx
+  8048de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048e2:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8048e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8048e7:	48 83 c4 30          	add    $0x30,%rsp
+  8048eb:	5b                   	pop    %rbx
+  8048ec:	41 5f                	pop    %r15
+  8048ee:	5d                   	pop    %rbp
+  8048ef:	c3                   	ret
+
+00000000008048f0 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8048f0:	55                   	push   %rbp
+  8048f1:	48 89 e5             	mov    %rsp,%rbp
+  8048f4:	41 57                	push   %r15
+  8048f6:	53                   	push   %rbx
+  8048f7:	48 83 ec 10          	sub    $0x10,%rsp
+  8048fb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048fb <nsipc_bind+0xb>
+  804902:	49 bb 35 37 00 00 00 	movabs $0x3735,%r11
+  804909:	00 00 00 
+  80490c:	4c 01 db             	add    %r11,%rbx
+  80490f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804912:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804916:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  804919:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804920:	00 00 00 
+  804923:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804926:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  804929:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80492c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804930:	48 89 c6             	mov    %rax,%rsi
+  804933:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  80493a:	00 00 00 
+  80493d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804941:	48 89 c7             	mov    %rax,%rdi
+  804944:	49 89 df             	mov    %rbx,%r15
+  804947:	48 b8 f8 99 ff ff ff 	movabs $0xffffffffffff99f8,%rax
+  80494e:	ff ff ff 
+  804951:	48 01 d8             	add    %rbx,%rax
+  804954:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  804956:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80495d:	00 00 00 
+  804960:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804963:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  804967:	bf 02 00 00 00       	mov    $0x2,%edi
+  80496c:	48 b8 dd c6 ff ff ff 	movabs $0xffffffffffffc6dd,%rax
+  804973:	ff ff ff 
+  804976:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80497a:	ff d0                	call   *%rax
+}
+  80497c:	48 83 c4 10          	add    $0x10,%rsp
+  804980:	5b                   	pop    %rbx
+  804981:	41 5f                	pop    %r15
+  804983:	5d                   	pop    %rbp
+  804984:	c3                   	ret
+
+0000000000804985 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  804985:	55                   	push   %rbp
+  804986:	48 89 e5             	mov    %rsp,%rbp
+  804989:	48 83 ec 20          	sub    $0x20,%rsp
+  80498d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80498d <nsipc_shutdown+0x8>
+  804994:	49 bb a3 36 00 00 00 	movabs $0x36a3,%r11
+  80499b:	00 00 00 
+  80499e:	4c 01 d8             	add    %r11,%rax
+  8049a1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8049a4:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8049a7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8049aa:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  8049ad:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8049b0:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  8049b3:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8049b7:	ba 08 00 00 00       	mov    $0x8,%edx
+  8049bc:	48 89 ce             	mov    %rcx,%rsi
+  8049bf:	bf 03 00 00 00       	mov    $0x3,%edi
+  8049c4:	48 b9 80 c7 ff ff ff 	movabs $0xffffffffffffc780,%rcx
+  8049cb:	ff ff ff 
+  8049ce:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8049d2:	ff d0                	call   *%rax
+}
+  8049d4:	c9                   	leave
+  8049d5:	c3                   	ret
+
+00000000008049d6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8049d6:	55                   	push   %rbp
+  8049d7:	48 89 e5             	mov    %rsp,%rbp
+  8049da:	48 83 ec 20          	sub    $0x20,%rsp
+  8049de:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8049de <nsipc_close+0x8>
+  8049e5:	49 bb 52 36 00 00 00 	movabs $0x3652,%r11
+  8049ec:	00 00 00 
+  8049ef:	4c 01 d8             	add    %r11,%rax
+  8049f2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8049f5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8049f8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8049fb:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8049ff:	ba 04 00 00 00       	mov    $0x4,%edx
+  804a04:	48 89 ce             	mov    %rcx,%rsi
+  804a07:	bf 04 00 00 00       	mov    $0x4,%edi
+  804a0c:	48 b9 80 c7 ff ff ff 	movabs $0xffffffffffffc780,%rcx
+  804a13:	ff ff ff 
+  804a16:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804a1a:	ff d0                	call   *%rax
+}
+  804a1c:	c9                   	leave
+  804a1d:	c3                   	ret
+
+0000000000804a1e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804a1e:	55                   	push   %rbp
+  804a1f:	48 89 e5             	mov    %rsp,%rbp
+  804a22:	41 57                	push   %r15
+  804a24:	53                   	push   %rbx
+  804a25:	48 83 ec 10          	sub    $0x10,%rsp
+  804a29:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a29 <nsipc_connect+0xb>
+  804a30:	49 bb 07 36 00 00 00 	movabs $0x3607,%r11
+  804a37:	00 00 00 
+  804a3a:	4c 01 db             	add    %r11,%rbx
+  804a3d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804a40:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804a44:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  804a47:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804a4e:	00 00 00 
+  804a51:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a54:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  804a57:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804a5a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a5e:	48 89 c6             	mov    %rax,%rsi
+  804a61:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  804a68:	00 00 00 
+  804a6b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a6f:	48 89 c7             	mov    %rax,%rdi
+  804a72:	49 89 df             	mov    %rbx,%r15
+  804a75:	48 b8 f8 99 ff ff ff 	movabs $0xffffffffffff99f8,%rax
+  804a7c:	ff ff ff 
+  804a7f:	48 01 d8             	add    %rbx,%rax
+  804a82:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  804a84:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804a8b:	00 00 00 
+  804a8e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a91:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  804a95:	bf 05 00 00 00       	mov    $0x5,%edi
+  804a9a:	48 b8 dd c6 ff ff ff 	movabs $0xffffffffffffc6dd,%rax
+  804aa1:	ff ff ff 
+  804aa4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804aa8:	ff d0                	call   *%rax
+}
+  804aaa:	48 83 c4 10          	add    $0x10,%rsp
+  804aae:	5b                   	pop    %rbx
+  804aaf:	41 5f                	pop    %r15
+  804ab1:	5d                   	pop    %rbp
+  804ab2:	c3                   	ret
+
+0000000000804ab3 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  804ab3:	55                   	push   %rbp
+  804ab4:	48 89 e5             	mov    %rsp,%rbp
+  804ab7:	48 83 ec 20          	sub    $0x20,%rsp
+  804abb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804abb <nsipc_listen+0x8>
+  804ac2:	49 bb 75 35 00 00 00 	movabs $0x3575,%r11
+  804ac9:	00 00 00 
+  804acc:	4c 01 d8             	add    %r11,%rax
+  804acf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804ad2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  804ad5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804ad8:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  804adb:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804ade:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  804ae1:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804ae5:	ba 08 00 00 00       	mov    $0x8,%edx
+  804aea:	48 89 ce             	mov    %rcx,%rsi
+  804aed:	bf 06 00 00 00       	mov    $0x6,%edi
+  804af2:	48 b9 80 c7 ff ff ff 	movabs $0xffffffffffffc780,%rcx
+  804af9:	ff ff ff 
+  804afc:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804b00:	ff d0                	call   *%rax
+}
+  804b02:	c9                   	leave
+  804b03:	c3                   	ret
+
+0000000000804b04 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  804b04:	55                   	push   %rbp
+  804b05:	48 89 e5             	mov    %rsp,%rbp
+  804b08:	41 57                	push   %r15
+  804b0a:	53                   	push   %rbx
+  804b0b:	48 83 ec 30          	sub    $0x30,%rsp
+  804b0f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b0f <nsipc_recv+0xb>
+  804b16:	49 bb 21 35 00 00 00 	movabs $0x3521,%r11
+  804b1d:	00 00 00 
+  804b20:	4c 01 db             	add    %r11,%rbx
+  804b23:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804b26:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804b2a:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  804b2d:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  804b30:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804b37:	00 00 00 
+  804b3a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b3d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  804b40:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804b47:	00 00 00 
+  804b4a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804b4d:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  804b51:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804b58:	00 00 00 
+  804b5b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804b5e:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804b62:	bf 07 00 00 00       	mov    $0x7,%edi
+  804b67:	48 b8 dd c6 ff ff ff 	movabs $0xffffffffffffc6dd,%rax
+  804b6e:	ff ff ff 
+  804b71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b75:	ff d0                	call   *%rax
+  804b77:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b7a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b7e:	0f 88 91 00 00 00    	js     804c15 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  804b84:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  804b8b:	7f 08                	jg     804b95 <nsipc_recv+0x91>
+  804b8d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b90:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  804b93:	7e 50                	jle    804be5 <nsipc_recv+0xe1>
+  804b95:	48 b8 4b e8 ff ff ff 	movabs $0xffffffffffffe84b,%rax
+  804b9c:	ff ff ff 
+  804b9f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ba3:	48 89 c1             	mov    %rax,%rcx
+  804ba6:	48 b8 60 e8 ff ff ff 	movabs $0xffffffffffffe860,%rax
+  804bad:	ff ff ff 
+  804bb0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bb4:	48 89 c2             	mov    %rax,%rdx
+  804bb7:	be 79 00 00 00       	mov    $0x79,%esi
+  804bbc:	48 b8 75 e8 ff ff ff 	movabs $0xffffffffffffe875,%rax
+  804bc3:	ff ff ff 
+  804bc6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bca:	48 89 c7             	mov    %rax,%rdi
+  804bcd:	49 89 df             	mov    %rbx,%r15
+  804bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bd5:	49 b8 7f 85 ff ff ff 	movabs $0xffffffffffff857f,%r8
+  804bdc:	ff ff ff 
+  804bdf:	49 01 d8             	add    %rbx,%r8
+  804be2:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804be5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804be8:	48 63 d0             	movslq %eax,%rdx
+  804beb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bef:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804bf6:	00 00 00 
+  804bf9:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  804bfd:	48 89 ce             	mov    %rcx,%rsi
+  804c00:	48 89 c7             	mov    %rax,%rdi
+  804c03:	49 89 df             	mov    %rbx,%r15
+  804c06:	48 b8 f8 99 ff ff ff 	movabs $0xffffffffffff99f8,%rax
+  804c0d:	ff ff ff 
+  804c10:	48 01 d8             	add    %rbx,%rax
+  804c13:	ff d0                	call   *%rax
+	}
+
+	return r;
+  804c15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804c18:	48 83 c4 30          	add    $0x30,%rsp
+  804c1c:	5b                   	pop    %rbx
+  804c1d:	41 5f                	pop    %r15
+  804c1f:	5d                   	pop    %rbp
+  804c20:	c3                   	ret
+
+0000000000804c21 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804c21:	55                   	push   %rbp
+  804c22:	48 89 e5             	mov    %rsp,%rbp
+  804c25:	41 57                	push   %r15
+  804c27:	53                   	push   %rbx
+  804c28:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  804c2f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c2f <nsipc_send+0xe>
+  804c36:	49 bb 01 34 00 00 00 	movabs $0x3401,%r11
+  804c3d:	00 00 00 
+  804c40:	4c 01 db             	add    %r11,%rbx
+  804c43:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  804c49:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804c50:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804c56:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  804c5c:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804c60:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804c64:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804c6b:	00 00 00 
+  804c6e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c71:	85 c0                	test   %eax,%eax
+  804c73:	75 24                	jne    804c99 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804c75:	bf 02 00 00 00       	mov    $0x2,%edi
+  804c7a:	49 89 df             	mov    %rbx,%r15
+  804c7d:	48 b8 c3 e0 ff ff ff 	movabs $0xffffffffffffe0c3,%rax
+  804c84:	ff ff ff 
+  804c87:	48 01 d8             	add    %rbx,%rax
+  804c8a:	ff d0                	call   *%rax
+  804c8c:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804c93:	00 00 00 
+  804c96:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  804c99:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804c9f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804ca2:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804ca9:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804cac:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804caf:	39 c2                	cmp    %eax,%edx
+  804cb1:	0f 4e c2             	cmovle %edx,%eax
+  804cb4:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  804cba:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804cc0:	48 63 d0             	movslq %eax,%rdx
+  804cc3:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  804cca:	48 89 c6             	mov    %rax,%rsi
+  804ccd:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804cd4:	00 00 00 
+  804cd7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cdb:	48 89 c7             	mov    %rax,%rdi
+  804cde:	49 89 df             	mov    %rbx,%r15
+  804ce1:	48 b8 f8 99 ff ff ff 	movabs $0xffffffffffff99f8,%rax
+  804ce8:	ff ff ff 
+  804ceb:	48 01 d8             	add    %rbx,%rax
+  804cee:	ff d0                	call   *%rax
+	req->req_s = s;
+  804cf0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cf4:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  804cfa:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  804cfc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d00:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  804d06:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  804d09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d0d:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  804d13:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  804d16:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804d1d:	00 00 00 
+  804d20:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d24:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804d28:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  804d2f:	00 
+  804d30:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804d36:	48 63 d0             	movslq %eax,%rdx
+  804d39:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d3d:	48 01 d0             	add    %rdx,%rax
+  804d40:	48 83 e8 01          	sub    $0x1,%rax
+  804d44:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804d48:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d51:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804d55:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d59:	48 29 d0             	sub    %rdx,%rax
+  804d5c:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804d62:	85 c0                	test   %eax,%eax
+  804d64:	0f 48 c2             	cmovs  %edx,%eax
+  804d67:	c1 f8 0c             	sar    $0xc,%eax
+  804d6a:	48 98                	cltq
+  804d6c:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  804d70:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804d74:	48 85 c0             	test   %rax,%rax
+  804d77:	0f 95 c0             	setne  %al
+  804d7a:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  804d7d:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  804d84:	00 
+  804d85:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d89:	48 83 c0 0b          	add    $0xb,%rax
+  804d8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804d91:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d95:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d9a:	48 f7 75 c8          	divq   -0x38(%rbp)
+  804d9e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804da2:	48 29 d0             	sub    %rdx,%rax
+  804da5:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804da9:	89 c7                	mov    %eax,%edi
+  804dab:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804db2:	00 00 00 
+  804db5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804db8:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  804dbc:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  804dc0:	48 83 ec 08          	sub    $0x8,%rsp
+  804dc4:	6a 00                	push   $0x0
+  804dc6:	6a 00                	push   $0x0
+  804dc8:	6a 05                	push   $0x5
+  804dca:	41 89 f1             	mov    %esi,%r9d
+  804dcd:	49 89 c8             	mov    %rcx,%r8
+  804dd0:	89 f9                	mov    %edi,%ecx
+  804dd2:	be 08 00 00 00       	mov    $0x8,%esi
+  804dd7:	89 c7                	mov    %eax,%edi
+  804dd9:	49 89 df             	mov    %rbx,%r15
+  804ddc:	48 b8 cb dc ff ff ff 	movabs $0xffffffffffffdccb,%rax
+  804de3:	ff ff ff 
+  804de6:	48 01 d8             	add    %rbx,%rax
+  804de9:	ff d0                	call   *%rax
+  804deb:	48 83 c4 20          	add    $0x20,%rsp
+}
+  804def:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804df3:	5b                   	pop    %rbx
+  804df4:	41 5f                	pop    %r15
+  804df6:	5d                   	pop    %rbp
+  804df7:	c3                   	ret
+
+0000000000804df8 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804df8:	55                   	push   %rbp
+  804df9:	48 89 e5             	mov    %rsp,%rbp
+  804dfc:	48 83 ec 10          	sub    $0x10,%rsp
+  804e00:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804e00 <nsipc_socket+0x8>
+  804e07:	49 bb 30 32 00 00 00 	movabs $0x3230,%r11
+  804e0e:	00 00 00 
+  804e11:	4c 01 d8             	add    %r11,%rax
+  804e14:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804e17:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  804e1a:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  804e1d:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804e24:	00 00 00 
+  804e27:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804e2a:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  804e2d:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804e34:	00 00 00 
+  804e37:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  804e3a:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  804e3e:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804e45:	00 00 00 
+  804e48:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804e4b:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  804e4f:	bf 09 00 00 00       	mov    $0x9,%edi
+  804e54:	48 ba dd c6 ff ff ff 	movabs $0xffffffffffffc6dd,%rdx
+  804e5b:	ff ff ff 
+  804e5e:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804e62:	ff d0                	call   *%rax
+}
+  804e64:	c9                   	leave
+  804e65:	c3                   	ret
+
+0000000000804e66 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  804e66:	55                   	push   %rbp
+  804e67:	48 89 e5             	mov    %rsp,%rbp
+  804e6a:	41 57                	push   %r15
+  804e6c:	53                   	push   %rbx
+  804e6d:	48 83 ec 30          	sub    $0x30,%rsp
+  804e71:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e71 <pipe+0xb>
+  804e78:	49 bb bf 31 00 00 00 	movabs $0x31bf,%r11
+  804e7f:	00 00 00 
+  804e82:	4c 01 db             	add    %r11,%rbx
+  804e85:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  804e89:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  804e8d:	48 89 c7             	mov    %rax,%rdi
+  804e90:	49 89 df             	mov    %rbx,%r15
+  804e93:	48 b8 f7 aa ff ff ff 	movabs $0xffffffffffffaaf7,%rax
+  804e9a:	ff ff ff 
+  804e9d:	48 01 d8             	add    %rbx,%rax
+  804ea0:	ff d0                	call   *%rax
+  804ea2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ea5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ea9:	0f 88 12 02 00 00    	js     8050c1 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804eaf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804eb3:	ba 07 04 00 00       	mov    $0x407,%edx
+  804eb8:	48 89 c6             	mov    %rax,%rsi
+  804ebb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ec0:	49 89 df             	mov    %rbx,%r15
+  804ec3:	48 b8 d4 a2 ff ff ff 	movabs $0xffffffffffffa2d4,%rax
+  804eca:	ff ff ff 
+  804ecd:	48 01 d8             	add    %rbx,%rax
+  804ed0:	ff d0                	call   *%rax
+  804ed2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ed5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ed9:	0f 88 e2 01 00 00    	js     8050c1 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  804edf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804ee3:	48 89 c7             	mov    %rax,%rdi
+  804ee6:	49 89 df             	mov    %rbx,%r15
+  804ee9:	48 b8 f7 aa ff ff ff 	movabs $0xffffffffffffaaf7,%rax
+  804ef0:	ff ff ff 
+  804ef3:	48 01 d8             	add    %rbx,%rax
+  804ef6:	ff d0                	call   *%rax
+  804ef8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804efb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804eff:	0f 88 9b 01 00 00    	js     8050a0 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804f05:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f09:	ba 07 04 00 00       	mov    $0x407,%edx
+  804f0e:	48 89 c6             	mov    %rax,%rsi
+  804f11:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f16:	49 89 df             	mov    %rbx,%r15
+  804f19:	48 b8 d4 a2 ff ff ff 	movabs $0xffffffffffffa2d4,%rax
+  804f20:	ff ff ff 
+  804f23:	48 01 d8             	add    %rbx,%rax
+  804f26:	ff d0                	call   *%rax
+  804f28:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f2b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f2f:	0f 88 6b 01 00 00    	js     8050a0 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  804f35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f39:	48 89 c7             	mov    %rax,%rdi
+  804f3c:	49 89 df             	mov    %rbx,%r15
+  804f3f:	48 b8 b4 aa ff ff ff 	movabs $0xffffffffffffaab4,%rax
+  804f46:	ff ff ff 
+  804f49:	48 01 d8             	add    %rbx,%rax
+  804f4c:	ff d0                	call   *%rax
+  804f4e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804f52:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f56:	ba 07 04 00 00       	mov    $0x407,%edx
+  804f5b:	48 89 c6             	mov    %rax,%rsi
+  804f5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f63:	49 89 df             	mov    %rbx,%r15
+  804f66:	48 b8 d4 a2 ff ff ff 	movabs $0xffffffffffffa2d4,%rax
+  804f6d:	ff ff ff 
+  804f70:	48 01 d8             	add    %rbx,%rax
+  804f73:	ff d0                	call   *%rax
+  804f75:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f78:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f7c:	0f 88 fd 00 00 00    	js     80507f <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804f82:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f86:	48 89 c7             	mov    %rax,%rdi
+  804f89:	49 89 df             	mov    %rbx,%r15
+  804f8c:	48 b8 b4 aa ff ff ff 	movabs $0xffffffffffffaab4,%rax
+  804f93:	ff ff ff 
+  804f96:	48 01 d8             	add    %rbx,%rax
+  804f99:	ff d0                	call   *%rax
+  804f9b:	48 89 c2             	mov    %rax,%rdx
+  804f9e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fa2:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804fa8:	48 89 d1             	mov    %rdx,%rcx
+  804fab:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fb0:	48 89 c6             	mov    %rax,%rsi
+  804fb3:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fb8:	49 89 df             	mov    %rbx,%r15
+  804fbb:	48 b8 39 a3 ff ff ff 	movabs $0xffffffffffffa339,%rax
+  804fc2:	ff ff ff 
+  804fc5:	48 01 d8             	add    %rbx,%rax
+  804fc8:	ff d0                	call   *%rax
+  804fca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804fcd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804fd1:	0f 88 87 00 00 00    	js     80505e <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  804fd7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fdb:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804fe2:	00 00 00 
+  804fe5:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804fe8:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  804fea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fee:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  804ff5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ff9:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  805000:	00 00 00 
+  805003:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805006:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805008:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80500c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805013:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805017:	48 89 c7             	mov    %rax,%rdi
+  80501a:	49 89 df             	mov    %rbx,%r15
+  80501d:	48 b8 7d aa ff ff ff 	movabs $0xffffffffffffaa7d,%rax
+  805024:	ff ff ff 
+  805027:	48 01 d8             	add    %rbx,%rax
+  80502a:	ff d0                	call   *%rax
+  80502c:	89 c2                	mov    %eax,%edx
+  80502e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805032:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805034:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805038:	48 89 c7             	mov    %rax,%rdi
+  80503b:	49 89 df             	mov    %rbx,%r15
+  80503e:	48 b8 7d aa ff ff ff 	movabs $0xffffffffffffaa7d,%rax
+  805045:	ff ff ff 
+  805048:	48 01 d8             	add    %rbx,%rax
+  80504b:	ff d0                	call   *%rax
+  80504d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805051:	48 83 c2 04          	add    $0x4,%rdx
+  805055:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805057:	b8 00 00 00 00       	mov    $0x0,%eax
+  80505c:	eb 67                	jmp    8050c5 <pipe+0x25f>
+		goto err3;
+  80505e:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  80505f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805063:	48 89 c6             	mov    %rax,%rsi
+  805066:	bf 00 00 00 00       	mov    $0x0,%edi
+  80506b:	49 89 df             	mov    %rbx,%r15
+  80506e:	48 b8 ac a3 ff ff ff 	movabs $0xffffffffffffa3ac,%rax
+  805075:	ff ff ff 
+  805078:	48 01 d8             	add    %rbx,%rax
+  80507b:	ff d0                	call   *%rax
+  80507d:	eb 01                	jmp    805080 <pipe+0x21a>
+		goto err2;
+  80507f:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  805080:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805084:	48 89 c6             	mov    %rax,%rsi
+  805087:	bf 00 00 00 00       	mov    $0x0,%edi
+  80508c:	49 89 df             	mov    %rbx,%r15
+  80508f:	48 b8 ac a3 ff ff ff 	movabs $0xffffffffffffa3ac,%rax
+  805096:	ff ff ff 
+  805099:	48 01 d8             	add    %rbx,%rax
+  80509c:	ff d0                	call   *%rax
+  80509e:	eb 01                	jmp    8050a1 <pipe+0x23b>
+		goto err1;
+  8050a0:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  8050a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050a5:	48 89 c6             	mov    %rax,%rsi
+  8050a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050ad:	49 89 df             	mov    %rbx,%r15
+  8050b0:	48 b8 ac a3 ff ff ff 	movabs $0xffffffffffffa3ac,%rax
+  8050b7:	ff ff ff 
+  8050ba:	48 01 d8             	add    %rbx,%rax
+  8050bd:	ff d0                	call   *%rax
+  8050bf:	eb 01                	jmp    8050c2 <pipe+0x25c>
+		goto err;
+  8050c1:	90                   	nop
+err:
+	return r;
+  8050c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8050c5:	48 83 c4 30          	add    $0x30,%rsp
+  8050c9:	5b                   	pop    %rbx
+  8050ca:	41 5f                	pop    %r15
+  8050cc:	5d                   	pop    %rbp
+  8050cd:	c3                   	ret
+
+00000000008050ce <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8050ce:	55                   	push   %rbp
+  8050cf:	48 89 e5             	mov    %rsp,%rbp
+  8050d2:	41 57                	push   %r15
+  8050d4:	41 54                	push   %r12
+  8050d6:	53                   	push   %rbx
+  8050d7:	48 83 ec 28          	sub    $0x28,%rsp
+  8050db:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050db <_pipeisclosed+0xd>
+  8050e2:	49 bb 55 2f 00 00 00 	movabs $0x2f55,%r11
+  8050e9:	00 00 00 
+  8050ec:	4c 01 db             	add    %r11,%rbx
+  8050ef:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8050f3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8050f7:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8050fe:	ff ff ff 
+  805101:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805105:	48 8b 00             	mov    (%rax),%rax
+  805108:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80510e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805111:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805115:	48 89 c7             	mov    %rax,%rdi
+  805118:	49 89 df             	mov    %rbx,%r15
+  80511b:	48 b8 52 e1 ff ff ff 	movabs $0xffffffffffffe152,%rax
+  805122:	ff ff ff 
+  805125:	48 01 d8             	add    %rbx,%rax
+  805128:	ff d0                	call   *%rax
+  80512a:	41 89 c4             	mov    %eax,%r12d
+  80512d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805131:	48 89 c7             	mov    %rax,%rdi
+  805134:	49 89 df             	mov    %rbx,%r15
+  805137:	48 b8 52 e1 ff ff ff 	movabs $0xffffffffffffe152,%rax
+  80513e:	ff ff ff 
+  805141:	48 01 d8             	add    %rbx,%rax
+  805144:	ff d0                	call   *%rax
+  805146:	41 39 c4             	cmp    %eax,%r12d
+  805149:	0f 94 c0             	sete   %al
+  80514c:	0f b6 c0             	movzbl %al,%eax
+  80514f:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805152:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805159:	ff ff ff 
+  80515c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805160:	48 8b 00             	mov    (%rax),%rax
+  805163:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805169:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  80516c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80516f:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805172:	75 05                	jne    805179 <_pipeisclosed+0xab>
+			return ret;
+  805174:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805177:	eb 63                	jmp    8051dc <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805179:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80517c:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80517f:	0f 84 72 ff ff ff    	je     8050f7 <_pipeisclosed+0x29>
+  805185:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805189:	0f 85 68 ff ff ff    	jne    8050f7 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80518f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805196:	ff ff ff 
+  805199:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80519d:	48 8b 00             	mov    (%rax),%rax
+  8051a0:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  8051a6:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8051a9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8051ac:	89 c6                	mov    %eax,%esi
+  8051ae:	48 b8 86 e8 ff ff ff 	movabs $0xffffffffffffe886,%rax
+  8051b5:	ff ff ff 
+  8051b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051bc:	48 89 c7             	mov    %rax,%rdi
+  8051bf:	49 89 df             	mov    %rbx,%r15
+  8051c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051c7:	49 b8 56 88 ff ff ff 	movabs $0xffffffffffff8856,%r8
+  8051ce:	ff ff ff 
+  8051d1:	49 01 d8             	add    %rbx,%r8
+  8051d4:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8051d7:	e9 1b ff ff ff       	jmp    8050f7 <_pipeisclosed+0x29>
+	}
+}
+  8051dc:	48 83 c4 28          	add    $0x28,%rsp
+  8051e0:	5b                   	pop    %rbx
+  8051e1:	41 5c                	pop    %r12
+  8051e3:	41 5f                	pop    %r15
+  8051e5:	5d                   	pop    %rbp
+  8051e6:	c3                   	ret
+
+00000000008051e7 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8051e7:	55                   	push   %rbp
+  8051e8:	48 89 e5             	mov    %rsp,%rbp
+  8051eb:	41 57                	push   %r15
+  8051ed:	53                   	push   %rbx
+  8051ee:	48 83 ec 30          	sub    $0x30,%rsp
+  8051f2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051f2 <pipeisclosed+0xb>
+  8051f9:	49 bb 3e 2e 00 00 00 	movabs $0x2e3e,%r11
+  805200:	00 00 00 
+  805203:	4c 01 db             	add    %r11,%rbx
+  805206:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805209:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80520d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805210:	48 89 d6             	mov    %rdx,%rsi
+  805213:	89 c7                	mov    %eax,%edi
+  805215:	49 89 df             	mov    %rbx,%r15
+  805218:	48 b8 ad ab ff ff ff 	movabs $0xffffffffffffabad,%rax
+  80521f:	ff ff ff 
+  805222:	48 01 d8             	add    %rbx,%rax
+  805225:	ff d0                	call   *%rax
+  805227:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80522a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80522e:	79 05                	jns    805235 <pipeisclosed+0x4e>
+		return r;
+  805230:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805233:	eb 3b                	jmp    805270 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805235:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805239:	48 89 c7             	mov    %rax,%rdi
+  80523c:	49 89 df             	mov    %rbx,%r15
+  80523f:	48 b8 b4 aa ff ff ff 	movabs $0xffffffffffffaab4,%rax
+  805246:	ff ff ff 
+  805249:	48 01 d8             	add    %rbx,%rax
+  80524c:	ff d0                	call   *%rax
+  80524e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805252:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805256:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80525a:	48 89 d6             	mov    %rdx,%rsi
+  80525d:	48 89 c7             	mov    %rax,%rdi
+  805260:	48 b8 9e d0 ff ff ff 	movabs $0xffffffffffffd09e,%rax
+  805267:	ff ff ff 
+  80526a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80526e:	ff d0                	call   *%rax
+}
+  805270:	48 83 c4 30          	add    $0x30,%rsp
+  805274:	5b                   	pop    %rbx
+  805275:	41 5f                	pop    %r15
+  805277:	5d                   	pop    %rbp
+  805278:	c3                   	ret
+
+0000000000805279 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805279:	55                   	push   %rbp
+  80527a:	48 89 e5             	mov    %rsp,%rbp
+  80527d:	41 57                	push   %r15
+  80527f:	53                   	push   %rbx
+  805280:	48 83 ec 40          	sub    $0x40,%rsp
+  805284:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805284 <devpipe_read+0xb>
+  80528b:	49 bb ac 2d 00 00 00 	movabs $0x2dac,%r11
+  805292:	00 00 00 
+  805295:	4c 01 db             	add    %r11,%rbx
+  805298:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80529c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8052a0:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  8052a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052a8:	48 89 c7             	mov    %rax,%rdi
+  8052ab:	49 89 df             	mov    %rbx,%r15
+  8052ae:	48 b8 b4 aa ff ff ff 	movabs $0xffffffffffffaab4,%rax
+  8052b5:	ff ff ff 
+  8052b8:	48 01 d8             	add    %rbx,%rax
+  8052bb:	ff d0                	call   *%rax
+  8052bd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8052c1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8052c5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8052c9:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8052d0:	00 
+  8052d1:	e9 a1 00 00 00       	jmp    805377 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8052d6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8052db:	74 09                	je     8052e6 <devpipe_read+0x6d>
+				return i;
+  8052dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052e1:	e9 9f 00 00 00       	jmp    805385 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8052e6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8052ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052ee:	48 89 d6             	mov    %rdx,%rsi
+  8052f1:	48 89 c7             	mov    %rax,%rdi
+  8052f4:	48 b8 9e d0 ff ff ff 	movabs $0xffffffffffffd09e,%rax
+  8052fb:	ff ff ff 
+  8052fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805302:	ff d0                	call   *%rax
+  805304:	85 c0                	test   %eax,%eax
+  805306:	74 07                	je     80530f <devpipe_read+0x96>
+				return 0;
+  805308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80530d:	eb 76                	jmp    805385 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  80530f:	49 89 df             	mov    %rbx,%r15
+  805312:	48 b8 7f a2 ff ff ff 	movabs $0xffffffffffffa27f,%rax
+  805319:	ff ff ff 
+  80531c:	48 01 d8             	add    %rbx,%rax
+  80531f:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805321:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805325:	8b 10                	mov    (%rax),%edx
+  805327:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80532b:	8b 40 04             	mov    0x4(%rax),%eax
+  80532e:	39 c2                	cmp    %eax,%edx
+  805330:	74 a4                	je     8052d6 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805332:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805336:	8b 10                	mov    (%rax),%edx
+  805338:	89 d0                	mov    %edx,%eax
+  80533a:	c1 f8 1f             	sar    $0x1f,%eax
+  80533d:	c1 e8 1b             	shr    $0x1b,%eax
+  805340:	01 c2                	add    %eax,%edx
+  805342:	83 e2 1f             	and    $0x1f,%edx
+  805345:	29 c2                	sub    %eax,%edx
+  805347:	89 d6                	mov    %edx,%esi
+  805349:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80534d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805351:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805355:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805359:	48 63 c6             	movslq %esi,%rax
+  80535c:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805361:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805363:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805367:	8b 00                	mov    (%rax),%eax
+  805369:	8d 50 01             	lea    0x1(%rax),%edx
+  80536c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805370:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805372:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805377:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80537b:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80537f:	72 a0                	jb     805321 <devpipe_read+0xa8>
+	}
+	return i;
+  805381:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805385:	48 83 c4 40          	add    $0x40,%rsp
+  805389:	5b                   	pop    %rbx
+  80538a:	41 5f                	pop    %r15
+  80538c:	5d                   	pop    %rbp
+  80538d:	c3                   	ret
+
+000000000080538e <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80538e:	55                   	push   %rbp
+  80538f:	48 89 e5             	mov    %rsp,%rbp
+  805392:	41 57                	push   %r15
+  805394:	53                   	push   %rbx
+  805395:	48 83 ec 40          	sub    $0x40,%rsp
+  805399:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805399 <devpipe_write+0xb>
+  8053a0:	49 bb 97 2c 00 00 00 	movabs $0x2c97,%r11
+  8053a7:	00 00 00 
+  8053aa:	4c 01 db             	add    %r11,%rbx
+  8053ad:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8053b1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8053b5:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  8053b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8053bd:	48 89 c7             	mov    %rax,%rdi
+  8053c0:	49 89 df             	mov    %rbx,%r15
+  8053c3:	48 b8 b4 aa ff ff ff 	movabs $0xffffffffffffaab4,%rax
+  8053ca:	ff ff ff 
+  8053cd:	48 01 d8             	add    %rbx,%rax
+  8053d0:	ff d0                	call   *%rax
+  8053d2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8053d6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8053da:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8053de:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8053e5:	00 
+  8053e6:	e9 a0 00 00 00       	jmp    80548b <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8053eb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8053ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8053f3:	48 89 d6             	mov    %rdx,%rsi
+  8053f6:	48 89 c7             	mov    %rax,%rdi
+  8053f9:	48 b8 9e d0 ff ff ff 	movabs $0xffffffffffffd09e,%rax
+  805400:	ff ff ff 
+  805403:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805407:	ff d0                	call   *%rax
+  805409:	85 c0                	test   %eax,%eax
+  80540b:	74 0a                	je     805417 <devpipe_write+0x89>
+				return 0;
+  80540d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805412:	e9 82 00 00 00       	jmp    805499 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805417:	49 89 df             	mov    %rbx,%r15
+  80541a:	48 b8 7f a2 ff ff ff 	movabs $0xffffffffffffa27f,%rax
+  805421:	ff ff ff 
+  805424:	48 01 d8             	add    %rbx,%rax
+  805427:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805429:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80542d:	8b 40 04             	mov    0x4(%rax),%eax
+  805430:	48 63 d0             	movslq %eax,%rdx
+  805433:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805437:	8b 00                	mov    (%rax),%eax
+  805439:	48 98                	cltq
+  80543b:	48 83 c0 20          	add    $0x20,%rax
+  80543f:	48 39 c2             	cmp    %rax,%rdx
+  805442:	73 a7                	jae    8053eb <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805444:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805448:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80544c:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805450:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805454:	8b 50 04             	mov    0x4(%rax),%edx
+  805457:	89 d0                	mov    %edx,%eax
+  805459:	c1 f8 1f             	sar    $0x1f,%eax
+  80545c:	c1 e8 1b             	shr    $0x1b,%eax
+  80545f:	01 c2                	add    %eax,%edx
+  805461:	83 e2 1f             	and    $0x1f,%edx
+  805464:	29 c2                	sub    %eax,%edx
+  805466:	89 d0                	mov    %edx,%eax
+  805468:	0f b6 09             	movzbl (%rcx),%ecx
+  80546b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80546f:	48 98                	cltq
+  805471:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805475:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805479:	8b 40 04             	mov    0x4(%rax),%eax
+  80547c:	8d 50 01             	lea    0x1(%rax),%edx
+  80547f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805483:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805486:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80548b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80548f:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805493:	72 94                	jb     805429 <devpipe_write+0x9b>
+	}
+
+	return i;
+  805495:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805499:	48 83 c4 40          	add    $0x40,%rsp
+  80549d:	5b                   	pop    %rbx
+  80549e:	41 5f                	pop    %r15
+  8054a0:	5d                   	pop    %rbp
+  8054a1:	c3                   	ret
+
+00000000008054a2 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8054a2:	55                   	push   %rbp
+  8054a3:	48 89 e5             	mov    %rsp,%rbp
+  8054a6:	41 57                	push   %r15
+  8054a8:	53                   	push   %rbx
+  8054a9:	48 83 ec 20          	sub    $0x20,%rsp
+  8054ad:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054ad <devpipe_stat+0xb>
+  8054b4:	49 bb 83 2b 00 00 00 	movabs $0x2b83,%r11
+  8054bb:	00 00 00 
+  8054be:	4c 01 db             	add    %r11,%rbx
+  8054c1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8054c5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8054c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054cd:	48 89 c7             	mov    %rax,%rdi
+  8054d0:	49 89 df             	mov    %rbx,%r15
+  8054d3:	48 b8 b4 aa ff ff ff 	movabs $0xffffffffffffaab4,%rax
+  8054da:	ff ff ff 
+  8054dd:	48 01 d8             	add    %rbx,%rax
+  8054e0:	ff d0                	call   *%rax
+  8054e2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8054e6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054ea:	48 ba 99 e8 ff ff ff 	movabs $0xffffffffffffe899,%rdx
+  8054f1:	ff ff ff 
+  8054f4:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8054f8:	48 89 d6             	mov    %rdx,%rsi
+  8054fb:	48 89 c7             	mov    %rax,%rdi
+  8054fe:	49 89 df             	mov    %rbx,%r15
+  805501:	48 b8 18 96 ff ff ff 	movabs $0xffffffffffff9618,%rax
+  805508:	ff ff ff 
+  80550b:	48 01 d8             	add    %rbx,%rax
+  80550e:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805510:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805514:	8b 50 04             	mov    0x4(%rax),%edx
+  805517:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80551b:	8b 00                	mov    (%rax),%eax
+  80551d:	29 c2                	sub    %eax,%edx
+  80551f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805523:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805529:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80552d:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805534:	00 00 00 
+	stat->st_dev = &devpipe;
+  805537:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80553b:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  805542:	00 00 00 
+  805545:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805549:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805550:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805555:	48 83 c4 20          	add    $0x20,%rsp
+  805559:	5b                   	pop    %rbx
+  80555a:	41 5f                	pop    %r15
+  80555c:	5d                   	pop    %rbp
+  80555d:	c3                   	ret
+
+000000000080555e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80555e:	55                   	push   %rbp
+  80555f:	48 89 e5             	mov    %rsp,%rbp
+  805562:	41 57                	push   %r15
+  805564:	53                   	push   %rbx
+  805565:	48 83 ec 10          	sub    $0x10,%rsp
+  805569:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805569 <devpipe_close+0xb>
+  805570:	49 bb c7 2a 00 00 00 	movabs $0x2ac7,%r11
+  805577:	00 00 00 
+  80557a:	4c 01 db             	add    %r11,%rbx
+  80557d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805581:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805585:	48 89 c6             	mov    %rax,%rsi
+  805588:	bf 00 00 00 00       	mov    $0x0,%edi
+  80558d:	49 89 df             	mov    %rbx,%r15
+  805590:	48 b8 ac a3 ff ff ff 	movabs $0xffffffffffffa3ac,%rax
+  805597:	ff ff ff 
+  80559a:	48 01 d8             	add    %rbx,%rax
+  80559d:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80559f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055a3:	48 89 c7             	mov    %rax,%rdi
+  8055a6:	49 89 df             	mov    %rbx,%r15
+  8055a9:	48 b8 b4 aa ff ff ff 	movabs $0xffffffffffffaab4,%rax
+  8055b0:	ff ff ff 
+  8055b3:	48 01 d8             	add    %rbx,%rax
+  8055b6:	ff d0                	call   *%rax
+  8055b8:	48 89 c6             	mov    %rax,%rsi
+  8055bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055c0:	49 89 df             	mov    %rbx,%r15
+  8055c3:	48 b8 ac a3 ff ff ff 	movabs $0xffffffffffffa3ac,%rax
+  8055ca:	ff ff ff 
+  8055cd:	48 01 d8             	add    %rbx,%rax
+  8055d0:	ff d0                	call   *%rax
+}
+  8055d2:	48 83 c4 10          	add    $0x10,%rsp
+  8055d6:	5b                   	pop    %rbx
+  8055d7:	41 5f                	pop    %r15
+  8055d9:	5d                   	pop    %rbp
+  8055da:	c3                   	ret
+
+00000000008055db <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8055db:	55                   	push   %rbp
+  8055dc:	48 89 e5             	mov    %rsp,%rbp
+  8055df:	41 57                	push   %r15
+  8055e1:	48 83 ec 28          	sub    $0x28,%rsp
+  8055e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8055e5 <cputchar+0xa>
+  8055ec:	49 bb 4b 2a 00 00 00 	movabs $0x2a4b,%r11
+  8055f3:	00 00 00 
+  8055f6:	4c 01 d8             	add    %r11,%rax
+  8055f9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8055fc:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8055ff:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  805602:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  805606:	be 01 00 00 00       	mov    $0x1,%esi
+  80560b:	48 89 d7             	mov    %rdx,%rdi
+  80560e:	49 89 c7             	mov    %rax,%r15
+  805611:	48 ba 1c a1 ff ff ff 	movabs $0xffffffffffffa11c,%rdx
+  805618:	ff ff ff 
+  80561b:	48 01 c2             	add    %rax,%rdx
+  80561e:	ff d2                	call   *%rdx
+}
+  805620:	90                   	nop
+  805621:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805625:	c9                   	leave
+  805626:	c3                   	ret
+
+0000000000805627 <getchar>:
+
+int
+getchar(void)
+{
+  805627:	55                   	push   %rbp
+  805628:	48 89 e5             	mov    %rsp,%rbp
+  80562b:	41 57                	push   %r15
+  80562d:	48 83 ec 18          	sub    $0x18,%rsp
+  805631:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805631 <getchar+0xa>
+  805638:	49 bb ff 29 00 00 00 	movabs $0x29ff,%r11
+  80563f:	00 00 00 
+  805642:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  805645:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  805649:	ba 01 00 00 00       	mov    $0x1,%edx
+  80564e:	48 89 ce             	mov    %rcx,%rsi
+  805651:	bf 00 00 00 00       	mov    $0x0,%edi
+  805656:	49 89 c7             	mov    %rax,%r15
+  805659:	48 b9 f4 b0 ff ff ff 	movabs $0xffffffffffffb0f4,%rcx
+  805660:	ff ff ff 
+  805663:	48 01 c1             	add    %rax,%rcx
+  805666:	ff d1                	call   *%rcx
+  805668:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80566b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80566f:	79 05                	jns    805676 <getchar+0x4f>
+		return r;
+  805671:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805674:	eb 14                	jmp    80568a <getchar+0x63>
+	if (r < 1)
+  805676:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80567a:	7f 07                	jg     805683 <getchar+0x5c>
+		return -E_EOF;
+  80567c:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  805681:	eb 07                	jmp    80568a <getchar+0x63>
+	return c;
+  805683:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  805687:	0f b6 c0             	movzbl %al,%eax
+}
+  80568a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80568e:	c9                   	leave
+  80568f:	c3                   	ret
+
+0000000000805690 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  805690:	55                   	push   %rbp
+  805691:	48 89 e5             	mov    %rsp,%rbp
+  805694:	41 57                	push   %r15
+  805696:	53                   	push   %rbx
+  805697:	48 83 ec 20          	sub    $0x20,%rsp
+  80569b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80569b <iscons+0xb>
+  8056a2:	49 bb 95 29 00 00 00 	movabs $0x2995,%r11
+  8056a9:	00 00 00 
+  8056ac:	4c 01 db             	add    %r11,%rbx
+  8056af:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8056b2:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8056b6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8056b9:	48 89 d6             	mov    %rdx,%rsi
+  8056bc:	89 c7                	mov    %eax,%edi
+  8056be:	49 89 df             	mov    %rbx,%r15
+  8056c1:	48 b8 ad ab ff ff ff 	movabs $0xffffffffffffabad,%rax
+  8056c8:	ff ff ff 
+  8056cb:	48 01 d8             	add    %rbx,%rax
+  8056ce:	ff d0                	call   *%rax
+  8056d0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056d3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056d7:	79 05                	jns    8056de <iscons+0x4e>
+		return r;
+  8056d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056dc:	eb 1b                	jmp    8056f9 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8056de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056e2:	8b 10                	mov    (%rax),%edx
+  8056e4:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  8056eb:	00 00 00 
+  8056ee:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8056f1:	39 c2                	cmp    %eax,%edx
+  8056f3:	0f 94 c0             	sete   %al
+  8056f6:	0f b6 c0             	movzbl %al,%eax
+}
+  8056f9:	48 83 c4 20          	add    $0x20,%rsp
+  8056fd:	5b                   	pop    %rbx
+  8056fe:	41 5f                	pop    %r15
+  805700:	5d                   	pop    %rbp
+  805701:	c3                   	ret
+
+0000000000805702 <opencons>:
+
+int
+opencons(void)
+{
+  805702:	55                   	push   %rbp
+  805703:	48 89 e5             	mov    %rsp,%rbp
+  805706:	41 57                	push   %r15
+  805708:	53                   	push   %rbx
+  805709:	48 83 ec 10          	sub    $0x10,%rsp
+  80570d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80570d <opencons+0xb>
+  805714:	49 bb 23 29 00 00 00 	movabs $0x2923,%r11
+  80571b:	00 00 00 
+  80571e:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  805721:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805725:	48 89 c7             	mov    %rax,%rdi
+  805728:	49 89 df             	mov    %rbx,%r15
+  80572b:	48 b8 f7 aa ff ff ff 	movabs $0xffffffffffffaaf7,%rax
+  805732:	ff ff ff 
+  805735:	48 01 d8             	add    %rbx,%rax
+  805738:	ff d0                	call   *%rax
+  80573a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80573d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805741:	79 05                	jns    805748 <opencons+0x46>
+		return r;
+  805743:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805746:	eb 68                	jmp    8057b0 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805748:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80574c:	ba 07 04 00 00       	mov    $0x407,%edx
+  805751:	48 89 c6             	mov    %rax,%rsi
+  805754:	bf 00 00 00 00       	mov    $0x0,%edi
+  805759:	49 89 df             	mov    %rbx,%r15
+  80575c:	48 b8 d4 a2 ff ff ff 	movabs $0xffffffffffffa2d4,%rax
+  805763:	ff ff ff 
+  805766:	48 01 d8             	add    %rbx,%rax
+  805769:	ff d0                	call   *%rax
+  80576b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80576e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805772:	79 05                	jns    805779 <opencons+0x77>
+		return r;
+  805774:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805777:	eb 37                	jmp    8057b0 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  805779:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80577d:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  805784:	00 00 00 
+  805787:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80578a:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  80578c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805790:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  805797:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80579b:	48 89 c7             	mov    %rax,%rdi
+  80579e:	49 89 df             	mov    %rbx,%r15
+  8057a1:	48 b8 7d aa ff ff ff 	movabs $0xffffffffffffaa7d,%rax
+  8057a8:	ff ff ff 
+  8057ab:	48 01 d8             	add    %rbx,%rax
+  8057ae:	ff d0                	call   *%rax
+}
+  8057b0:	48 83 c4 10          	add    $0x10,%rsp
+  8057b4:	5b                   	pop    %rbx
+  8057b5:	41 5f                	pop    %r15
+  8057b7:	5d                   	pop    %rbp
+  8057b8:	c3                   	ret
+
+00000000008057b9 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8057b9:	55                   	push   %rbp
+  8057ba:	48 89 e5             	mov    %rsp,%rbp
+  8057bd:	41 57                	push   %r15
+  8057bf:	53                   	push   %rbx
+  8057c0:	48 83 ec 30          	sub    $0x30,%rsp
+  8057c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057c4 <devcons_read+0xb>
+  8057cb:	49 bb 6c 28 00 00 00 	movabs $0x286c,%r11
+  8057d2:	00 00 00 
+  8057d5:	4c 01 db             	add    %r11,%rbx
+  8057d8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8057dc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8057e0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8057e4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8057e9:	75 19                	jne    805804 <devcons_read+0x4b>
+		return 0;
+  8057eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057f0:	eb 55                	jmp    805847 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8057f2:	49 89 df             	mov    %rbx,%r15
+  8057f5:	48 b8 7f a2 ff ff ff 	movabs $0xffffffffffffa27f,%rax
+  8057fc:	ff ff ff 
+  8057ff:	48 01 d8             	add    %rbx,%rax
+  805802:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  805804:	49 89 df             	mov    %rbx,%r15
+  805807:	48 b8 7b a1 ff ff ff 	movabs $0xffffffffffffa17b,%rax
+  80580e:	ff ff ff 
+  805811:	48 01 d8             	add    %rbx,%rax
+  805814:	ff d0                	call   *%rax
+  805816:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805819:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80581d:	74 d3                	je     8057f2 <devcons_read+0x39>
+	if (c < 0)
+  80581f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805823:	79 05                	jns    80582a <devcons_read+0x71>
+		return c;
+  805825:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805828:	eb 1d                	jmp    805847 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  80582a:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80582e:	75 07                	jne    805837 <devcons_read+0x7e>
+		return 0;
+  805830:	b8 00 00 00 00       	mov    $0x0,%eax
+  805835:	eb 10                	jmp    805847 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  805837:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80583a:	89 c2                	mov    %eax,%edx
+  80583c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805840:	88 10                	mov    %dl,(%rax)
+	return 1;
+  805842:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805847:	48 83 c4 30          	add    $0x30,%rsp
+  80584b:	5b                   	pop    %rbx
+  80584c:	41 5f                	pop    %r15
+  80584e:	5d                   	pop    %rbp
+  80584f:	c3                   	ret
+
+0000000000805850 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805850:	55                   	push   %rbp
+  805851:	48 89 e5             	mov    %rsp,%rbp
+  805854:	41 57                	push   %r15
+  805856:	53                   	push   %rbx
+  805857:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80585e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80585e <devcons_write+0xe>
+  805865:	49 bb d2 27 00 00 00 	movabs $0x27d2,%r11
+  80586c:	00 00 00 
+  80586f:	4c 01 db             	add    %r11,%rbx
+  805872:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  805879:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  805880:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  805887:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80588e:	e9 80 00 00 00       	jmp    805913 <devcons_write+0xc3>
+		m = n - tot;
+  805893:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80589a:	89 c2                	mov    %eax,%edx
+  80589c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80589f:	29 c2                	sub    %eax,%edx
+  8058a1:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8058a4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8058a7:	83 f8 7f             	cmp    $0x7f,%eax
+  8058aa:	76 07                	jbe    8058b3 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8058ac:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8058b3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8058b6:	48 63 d0             	movslq %eax,%rdx
+  8058b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058bc:	48 63 c8             	movslq %eax,%rcx
+  8058bf:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8058c6:	48 01 c1             	add    %rax,%rcx
+  8058c9:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8058d0:	48 89 ce             	mov    %rcx,%rsi
+  8058d3:	48 89 c7             	mov    %rax,%rdi
+  8058d6:	49 89 df             	mov    %rbx,%r15
+  8058d9:	48 b8 f8 99 ff ff ff 	movabs $0xffffffffffff99f8,%rax
+  8058e0:	ff ff ff 
+  8058e3:	48 01 d8             	add    %rbx,%rax
+  8058e6:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8058e8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8058eb:	48 63 d0             	movslq %eax,%rdx
+  8058ee:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8058f5:	48 89 d6             	mov    %rdx,%rsi
+  8058f8:	48 89 c7             	mov    %rax,%rdi
+  8058fb:	49 89 df             	mov    %rbx,%r15
+  8058fe:	48 b8 1c a1 ff ff ff 	movabs $0xffffffffffffa11c,%rax
+  805905:	ff ff ff 
+  805908:	48 01 d8             	add    %rbx,%rax
+  80590b:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  80590d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805910:	01 45 ec             	add    %eax,-0x14(%rbp)
+  805913:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805916:	48 98                	cltq
+  805918:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  80591f:	0f 82 6e ff ff ff    	jb     805893 <devcons_write+0x43>
+	}
+	return tot;
+  805925:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805928:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  80592f:	5b                   	pop    %rbx
+  805930:	41 5f                	pop    %r15
+  805932:	5d                   	pop    %rbp
+  805933:	c3                   	ret
+
+0000000000805934 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  805934:	55                   	push   %rbp
+  805935:	48 89 e5             	mov    %rsp,%rbp
+  805938:	48 83 ec 08          	sub    $0x8,%rsp
+  80593c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80593c <devcons_close+0x8>
+  805943:	49 bb f4 26 00 00 00 	movabs $0x26f4,%r11
+  80594a:	00 00 00 
+  80594d:	4c 01 d8             	add    %r11,%rax
+  805950:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  805954:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805959:	c9                   	leave
+  80595a:	c3                   	ret
+
+000000000080595b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80595b:	55                   	push   %rbp
+  80595c:	48 89 e5             	mov    %rsp,%rbp
+  80595f:	41 57                	push   %r15
+  805961:	48 83 ec 18          	sub    $0x18,%rsp
+  805965:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805965 <devcons_stat+0xa>
+  80596c:	49 bb cb 26 00 00 00 	movabs $0x26cb,%r11
+  805973:	00 00 00 
+  805976:	4c 01 d8             	add    %r11,%rax
+  805979:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80597d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  805981:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805985:	48 b9 a5 e8 ff ff ff 	movabs $0xffffffffffffe8a5,%rcx
+  80598c:	ff ff ff 
+  80598f:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805993:	48 89 ce             	mov    %rcx,%rsi
+  805996:	48 89 d7             	mov    %rdx,%rdi
+  805999:	49 89 c7             	mov    %rax,%r15
+  80599c:	48 ba 18 96 ff ff ff 	movabs $0xffffffffffff9618,%rdx
+  8059a3:	ff ff ff 
+  8059a6:	48 01 c2             	add    %rax,%rdx
+  8059a9:	ff d2                	call   *%rdx
+	return 0;
+  8059ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8059b0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8059b4:	c9                   	leave
+  8059b5:	c3                   	ret
+
+00000000008059b6 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8059b6:	55                   	push   %rbp
+  8059b7:	48 89 e5             	mov    %rsp,%rbp
+  8059ba:	41 57                	push   %r15
+  8059bc:	53                   	push   %rbx
+  8059bd:	48 83 ec 30          	sub    $0x30,%rsp
+  8059c1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059c1 <ipc_recv+0xb>
+  8059c8:	49 bb 6f 26 00 00 00 	movabs $0x266f,%r11
+  8059cf:	00 00 00 
+  8059d2:	4c 01 db             	add    %r11,%rbx
+  8059d5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8059d9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8059dd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8059e1:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8059e6:	75 0e                	jne    8059f6 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8059e8:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8059ef:	00 00 00 
+  8059f2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8059f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8059fa:	48 89 c7             	mov    %rax,%rdi
+  8059fd:	49 89 df             	mov    %rbx,%r15
+  805a00:	48 b8 fd a5 ff ff ff 	movabs $0xffffffffffffa5fd,%rax
+  805a07:	ff ff ff 
+  805a0a:	48 01 d8             	add    %rbx,%rax
+  805a0d:	ff d0                	call   *%rax
+  805a0f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  805a12:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805a17:	74 2a                	je     805a43 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  805a19:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a1d:	75 19                	jne    805a38 <ipc_recv+0x82>
+  805a1f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a26:	ff ff ff 
+  805a29:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a2d:	48 8b 00             	mov    (%rax),%rax
+  805a30:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805a36:	eb 05                	jmp    805a3d <ipc_recv+0x87>
+  805a38:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a3d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805a41:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  805a43:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805a48:	74 2a                	je     805a74 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805a4a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a4e:	75 19                	jne    805a69 <ipc_recv+0xb3>
+  805a50:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a57:	ff ff ff 
+  805a5a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a5e:	48 8b 00             	mov    (%rax),%rax
+  805a61:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805a67:	eb 05                	jmp    805a6e <ipc_recv+0xb8>
+  805a69:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a6e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805a72:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  805a74:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a78:	74 05                	je     805a7f <ipc_recv+0xc9>
+		return res;
+  805a7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a7d:	eb 17                	jmp    805a96 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805a7f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a86:	ff ff ff 
+  805a89:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a8d:	48 8b 00             	mov    (%rax),%rax
+  805a90:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805a96:	48 83 c4 30          	add    $0x30,%rsp
+  805a9a:	5b                   	pop    %rbx
+  805a9b:	41 5f                	pop    %r15
+  805a9d:	5d                   	pop    %rbp
+  805a9e:	c3                   	ret
+
+0000000000805a9f <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805a9f:	55                   	push   %rbp
+  805aa0:	48 89 e5             	mov    %rsp,%rbp
+  805aa3:	41 57                	push   %r15
+  805aa5:	53                   	push   %rbx
+  805aa6:	48 83 ec 20          	sub    $0x20,%rsp
+  805aaa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805aaa <ipc_send+0xb>
+  805ab1:	49 bb 86 25 00 00 00 	movabs $0x2586,%r11
+  805ab8:	00 00 00 
+  805abb:	4c 01 db             	add    %r11,%rbx
+  805abe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805ac1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805ac4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805ac8:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  805acb:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805ad0:	75 0e                	jne    805ae0 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  805ad2:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805ad9:	00 00 00 
+  805adc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  805ae0:	90                   	nop
+  805ae1:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805ae4:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805ae7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805aeb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805aee:	89 c7                	mov    %eax,%edi
+  805af0:	49 89 df             	mov    %rbx,%r15
+  805af3:	48 b8 93 a5 ff ff ff 	movabs $0xffffffffffffa593,%rax
+  805afa:	ff ff ff 
+  805afd:	48 01 d8             	add    %rbx,%rax
+  805b00:	ff d0                	call   *%rax
+  805b02:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  805b05:	74 da                	je     805ae1 <ipc_send+0x42>
+		;
+}
+  805b07:	90                   	nop
+  805b08:	90                   	nop
+  805b09:	48 83 c4 20          	add    $0x20,%rsp
+  805b0d:	5b                   	pop    %rbx
+  805b0e:	41 5f                	pop    %r15
+  805b10:	5d                   	pop    %rbp
+  805b11:	c3                   	ret
+
+0000000000805b12 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805b12:	55                   	push   %rbp
+  805b13:	48 89 e5             	mov    %rsp,%rbp
+  805b16:	41 57                	push   %r15
+  805b18:	53                   	push   %rbx
+  805b19:	48 83 ec 40          	sub    $0x40,%rsp
+  805b1d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b1d <ipc_call+0xb>
+  805b24:	49 bb 13 25 00 00 00 	movabs $0x2513,%r11
+  805b2b:	00 00 00 
+  805b2e:	4c 01 db             	add    %r11,%rbx
+  805b31:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805b34:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805b37:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805b3b:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805b3e:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805b42:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805b46:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805b4b:	75 0e                	jne    805b5b <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805b4d:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805b54:	00 00 00 
+  805b57:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805b5b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805b60:	75 0e                	jne    805b70 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805b62:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805b69:	00 00 00 
+  805b6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805b70:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805b73:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805b77:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805b7a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805b7e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b81:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805b87:	49 89 f8             	mov    %rdi,%r8
+  805b8a:	89 c7                	mov    %eax,%edi
+  805b8c:	49 89 df             	mov    %rbx,%r15
+  805b8f:	48 b8 56 a6 ff ff ff 	movabs $0xffffffffffffa656,%rax
+  805b96:	ff ff ff 
+  805b99:	48 01 d8             	add    %rbx,%rax
+  805b9c:	ff d0                	call   *%rax
+  805b9e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805ba1:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805ba6:	74 2a                	je     805bd2 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805ba8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805bac:	75 19                	jne    805bc7 <ipc_call+0xb5>
+  805bae:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805bb5:	ff ff ff 
+  805bb8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bbc:	48 8b 00             	mov    (%rax),%rax
+  805bbf:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805bc5:	eb 05                	jmp    805bcc <ipc_call+0xba>
+  805bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bcc:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805bd0:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805bd2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805bd6:	74 05                	je     805bdd <ipc_call+0xcb>
+		return r;
+  805bd8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bdb:	eb 17                	jmp    805bf4 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  805bdd:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805be4:	ff ff ff 
+  805be7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805beb:	48 8b 00             	mov    (%rax),%rax
+  805bee:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805bf4:	48 83 c4 40          	add    $0x40,%rsp
+  805bf8:	5b                   	pop    %rbx
+  805bf9:	41 5f                	pop    %r15
+  805bfb:	5d                   	pop    %rbp
+  805bfc:	c3                   	ret
+
+0000000000805bfd <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805bfd:	55                   	push   %rbp
+  805bfe:	48 89 e5             	mov    %rsp,%rbp
+  805c01:	41 57                	push   %r15
+  805c03:	53                   	push   %rbx
+  805c04:	48 83 ec 70          	sub    $0x70,%rsp
+  805c08:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c08 <ipc_callw+0xb>
+  805c0f:	49 bb 28 24 00 00 00 	movabs $0x2428,%r11
+  805c16:	00 00 00 
+  805c19:	4c 01 db             	add    %r11,%rbx
+  805c1c:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805c1f:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805c22:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805c26:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805c2a:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805c2f:	76 0a                	jbe    805c3b <ipc_callw+0x3e>
+		return -E_INVAL;
+  805c31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805c36:	e9 b7 00 00 00       	jmp    805cf2 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805c3b:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805c3f:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805c43:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805c47:	48 89 ce             	mov    %rcx,%rsi
+  805c4a:	48 89 c7             	mov    %rax,%rdi
+  805c4d:	49 89 df             	mov    %rbx,%r15
+  805c50:	48 b8 f8 99 ff ff ff 	movabs $0xffffffffffff99f8,%rax
+  805c57:	ff ff ff 
+  805c5a:	48 01 d8             	add    %rbx,%rax
+  805c5d:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805c5f:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805c66:	00 
+  805c67:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805c6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c6f:	48 01 d0             	add    %rdx,%rax
+  805c72:	48 83 e8 01          	sub    $0x1,%rax
+  805c76:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805c7a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805c83:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805c87:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c8b:	48 29 d0             	sub    %rdx,%rax
+  805c8e:	48 c1 e8 03          	shr    $0x3,%rax
+  805c92:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805c96:	89 c1                	mov    %eax,%ecx
+  805c98:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805c9b:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805c9f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805ca2:	49 89 d1             	mov    %rdx,%r9
+  805ca5:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805cac:	00 00 00 
+  805caf:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  805cb6:	00 00 00 
+  805cb9:	89 c7                	mov    %eax,%edi
+  805cbb:	49 89 df             	mov    %rbx,%r15
+  805cbe:	48 b8 56 a6 ff ff ff 	movabs $0xffffffffffffa656,%rax
+  805cc5:	ff ff ff 
+  805cc8:	48 01 d8             	add    %rbx,%rax
+  805ccb:	ff d0                	call   *%rax
+  805ccd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805cd0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805cd4:	74 05                	je     805cdb <ipc_callw+0xde>
+		return r;
+  805cd6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805cd9:	eb 17                	jmp    805cf2 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805cdb:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805ce2:	ff ff ff 
+  805ce5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ce9:	48 8b 00             	mov    (%rax),%rax
+  805cec:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805cf2:	48 83 c4 70          	add    $0x70,%rsp
+  805cf6:	5b                   	pop    %rbx
+  805cf7:	41 5f                	pop    %r15
+  805cf9:	5d                   	pop    %rbp
+  805cfa:	c3                   	ret
+
+0000000000805cfb <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805cfb:	55                   	push   %rbp
+  805cfc:	48 89 e5             	mov    %rsp,%rbp
+  805cff:	41 57                	push   %r15
+  805d01:	53                   	push   %rbx
+  805d02:	48 83 ec 40          	sub    $0x40,%rsp
+  805d06:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d06 <ipc_callv+0xb>
+  805d0d:	49 bb 2a 23 00 00 00 	movabs $0x232a,%r11
+  805d14:	00 00 00 
+  805d17:	4c 01 db             	add    %r11,%rbx
+  805d1a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805d1d:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805d20:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805d24:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805d27:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805d2b:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805d2f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805d36:	00 00 00 
+  805d39:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805d3d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805d41:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805d45:	74 11                	je     805d58 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805d47:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805d4b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805d4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805d52:	c1 e0 14             	shl    $0x14,%eax
+  805d55:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805d58:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805d5c:	74 14                	je     805d72 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805d5e:	8b 45 20             	mov    0x20(%rbp),%eax
+  805d61:	83 e8 01             	sub    $0x1,%eax
+  805d64:	48 63 d0             	movslq %eax,%rdx
+  805d67:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805d6b:	48 09 d0             	or     %rdx,%rax
+  805d6e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805d72:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805d75:	c1 e0 10             	shl    $0x10,%eax
+  805d78:	0b 45 10             	or     0x10(%rbp),%eax
+  805d7b:	89 c1                	mov    %eax,%ecx
+  805d7d:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805d80:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805d84:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805d88:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805d8c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805d8f:	4d 89 c1             	mov    %r8,%r9
+  805d92:	49 89 f8             	mov    %rdi,%r8
+  805d95:	89 c7                	mov    %eax,%edi
+  805d97:	49 89 df             	mov    %rbx,%r15
+  805d9a:	48 b8 56 a6 ff ff ff 	movabs $0xffffffffffffa656,%rax
+  805da1:	ff ff ff 
+  805da4:	48 01 d8             	add    %rbx,%rax
+  805da7:	ff d0                	call   *%rax
+  805da9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805dac:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805db0:	74 05                	je     805db7 <ipc_callv+0xbc>
+		return r;
+  805db2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805db5:	eb 17                	jmp    805dce <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805db7:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805dbe:	ff ff ff 
+  805dc1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805dc5:	48 8b 00             	mov    (%rax),%rax
+  805dc8:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805dce:	48 83 c4 40          	add    $0x40,%rsp
+  805dd2:	5b                   	pop    %rbx
+  805dd3:	41 5f                	pop    %r15
+  805dd5:	5d                   	pop    %rbp
+  805dd6:	c3                   	ret
+
+0000000000805dd7 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805dd7:	55                   	push   %rbp
+  805dd8:	48 89 e5             	mov    %rsp,%rbp
+  805ddb:	41 57                	push   %r15
+  805ddd:	53                   	push   %rbx
+  805dde:	48 83 ec 40          	sub    $0x40,%rsp
+  805de2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805de2 <ipc_reply_recv+0xb>
+  805de9:	49 bb 4e 22 00 00 00 	movabs $0x224e,%r11
+  805df0:	00 00 00 
+  805df3:	4c 01 db             	add    %r11,%rbx
+  805df6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805df9:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805dfc:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805e00:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805e03:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805e07:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805e0b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805e10:	75 0e                	jne    805e20 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805e12:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805e19:	00 00 00 
+  805e1c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805e20:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805e25:	75 0e                	jne    805e35 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805e27:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805e2e:	00 00 00 
+  805e31:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805e35:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805e38:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805e3c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805e40:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805e43:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805e47:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805e4a:	4d 89 c1             	mov    %r8,%r9
+  805e4d:	49 89 f8             	mov    %rdi,%r8
+  805e50:	89 c7                	mov    %eax,%edi
+  805e52:	49 89 df             	mov    %rbx,%r15
+  805e55:	48 b8 ca a6 ff ff ff 	movabs $0xffffffffffffa6ca,%rax
+  805e5c:	ff ff ff 
+  805e5f:	48 01 d8             	add    %rbx,%rax
+  805e62:	ff d0                	call   *%rax
+  805e64:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805e67:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805e6c:	74 2a                	je     805e98 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805e6e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e72:	75 19                	jne    805e8d <ipc_reply_recv+0xb6>
+  805e74:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805e7b:	ff ff ff 
+  805e7e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e82:	48 8b 00             	mov    (%rax),%rax
+  805e85:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805e8b:	eb 05                	jmp    805e92 <ipc_reply_recv+0xbb>
+  805e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805e96:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805e98:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805e9d:	74 2a                	je     805ec9 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805e9f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ea3:	75 19                	jne    805ebe <ipc_reply_recv+0xe7>
+  805ea5:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805eac:	ff ff ff 
+  805eaf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805eb3:	48 8b 00             	mov    (%rax),%rax
+  805eb6:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805ebc:	eb 05                	jmp    805ec3 <ipc_reply_recv+0xec>
+  805ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ec3:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805ec7:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805ec9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ecd:	74 05                	je     805ed4 <ipc_reply_recv+0xfd>
+		return r;
+  805ecf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ed2:	eb 17                	jmp    805eeb <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805ed4:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805edb:	ff ff ff 
+  805ede:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ee2:	48 8b 00             	mov    (%rax),%rax
+  805ee5:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805eeb:	48 83 c4 40          	add    $0x40,%rsp
+  805eef:	5b                   	pop    %rbx
+  805ef0:	41 5f                	pop    %r15
+  805ef2:	5d                   	pop    %rbp
+  805ef3:	c3                   	ret
+
+0000000000805ef4 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805ef4:	55                   	push   %rbp
+  805ef5:	48 89 e5             	mov    %rsp,%rbp
+  805ef8:	41 57                	push   %r15
+  805efa:	53                   	push   %rbx
+  805efb:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805f02:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f02 <ipc_window_batch+0xe>
+  805f09:	49 bb 2e 21 00 00 00 	movabs $0x212e,%r11
+  805f10:	00 00 00 
+  805f13:	4c 01 db             	add    %r11,%rbx
+  805f16:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805f1c:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805f23:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805f29:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805f2f:	e9 15 01 00 00       	jmp    806049 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805f34:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805f3a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805f3d:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805f44:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805f47:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f4a:	39 c2                	cmp    %eax,%edx
+  805f4c:	0f 4e c2             	cmovle %edx,%eax
+  805f4f:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805f52:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805f59:	eb 6b                	jmp    805fc6 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805f5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f5e:	48 98                	cltq
+  805f60:	48 c1 e0 05          	shl    $0x5,%rax
+  805f64:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805f68:	48 01 e8             	add    %rbp,%rax
+  805f6b:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805f71:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805f77:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f7a:	c1 e0 0c             	shl    $0xc,%eax
+  805f7d:	48 63 d0             	movslq %eax,%rdx
+  805f80:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805f87:	48 01 c2             	add    %rax,%rdx
+  805f8a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f8d:	48 98                	cltq
+  805f8f:	48 c1 e0 05          	shl    $0x5,%rax
+  805f93:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805f97:	48 01 e8             	add    %rbp,%rax
+  805f9a:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805fa0:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805fa3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805fa6:	48 98                	cltq
+  805fa8:	48 c1 e0 05          	shl    $0x5,%rax
+  805fac:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805fb0:	48 01 e8             	add    %rbp,%rax
+  805fb3:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805fba:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805fc0:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805fc2:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805fc6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805fc9:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805fcc:	7c 8d                	jl     805f5b <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805fce:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805fd5:	74 27                	je     805ffe <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805fd7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805fda:	48 63 d0             	movslq %eax,%rdx
+  805fdd:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805fe4:	48 89 d6             	mov    %rdx,%rsi
+  805fe7:	48 89 c7             	mov    %rax,%rdi
+  805fea:	49 89 df             	mov    %rbx,%r15
+  805fed:	48 b8 6d a9 ff ff ff 	movabs $0xffffffffffffa96d,%rax
+  805ff4:	ff ff ff 
+  805ff7:	48 01 d8             	add    %rbx,%rax
+  805ffa:	ff d0                	call   *%rax
+  805ffc:	eb 25                	jmp    806023 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805ffe:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806001:	48 63 d0             	movslq %eax,%rdx
+  806004:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  80600b:	48 89 d6             	mov    %rdx,%rsi
+  80600e:	48 89 c7             	mov    %rax,%rdi
+  806011:	49 89 df             	mov    %rbx,%r15
+  806014:	48 b8 cb a9 ff ff ff 	movabs $0xffffffffffffa9cb,%rax
+  80601b:	ff ff ff 
+  80601e:	48 01 d8             	add    %rbx,%rax
+  806021:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806023:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806026:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80602a:	79 05                	jns    806031 <ipc_window_batch+0x13d>
+			return r;
+  80602c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80602f:	eb 2a                	jmp    80605b <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806031:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806034:	c1 e0 0c             	shl    $0xc,%eax
+  806037:	48 98                	cltq
+  806039:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806040:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806043:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806049:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806050:	0f 8f de fe ff ff    	jg     805f34 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806056:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80605b:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806062:	5b                   	pop    %rbx
+  806063:	41 5f                	pop    %r15
+  806065:	5d                   	pop    %rbp
+  806066:	c3                   	ret
+
+0000000000806067 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806067:	55                   	push   %rbp
+  806068:	48 89 e5             	mov    %rsp,%rbp
+  80606b:	48 83 ec 10          	sub    $0x10,%rsp
+  80606f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80606f <ipc_map_window+0x8>
+  806076:	49 bb c1 1f 00 00 00 	movabs $0x1fc1,%r11
+  80607d:	00 00 00 
+  806080:	4c 01 d8             	add    %r11,%rax
+  806083:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806087:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  80608a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80608d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806091:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806096:	bf 01 00 00 00       	mov    $0x1,%edi
+  80609b:	49 b8 c4 de ff ff ff 	movabs $0xffffffffffffdec4,%r8
+  8060a2:	ff ff ff 
+  8060a5:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8060a9:	ff d0                	call   *%rax
+}
+  8060ab:	c9                   	leave
+  8060ac:	c3                   	ret
+
+00000000008060ad <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  8060ad:	55                   	push   %rbp
+  8060ae:	48 89 e5             	mov    %rsp,%rbp
+  8060b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8060b5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8060b5 <ipc_unmap_window+0x8>
+  8060bc:	49 bb 7b 1f 00 00 00 	movabs $0x1f7b,%r11
+  8060c3:	00 00 00 
+  8060c6:	4c 01 d8             	add    %r11,%rax
+  8060c9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8060cd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  8060d0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8060d3:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8060d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8060dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060e1:	49 b8 c4 de ff ff ff 	movabs $0xffffffffffffdec4,%r8
+  8060e8:	ff ff ff 
+  8060eb:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8060ef:	ff d0                	call   *%rax
+}
+  8060f1:	c9                   	leave
+  8060f2:	c3                   	ret
+
+00000000008060f3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8060f3:	55                   	push   %rbp
+  8060f4:	48 89 e5             	mov    %rsp,%rbp
+  8060f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8060fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8060fb <ipc_find_env+0x8>
+  806102:	49 bb 35 1f 00 00 00 	movabs $0x1f35,%r11
+  806109:	00 00 00 
+  80610c:	4c 01 d8             	add    %r11,%rax
+  80610f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806112:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806119:	eb 57                	jmp    806172 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  80611b:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  806122:	ff ff ff 
+  806125:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806129:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80612c:	48 63 d2             	movslq %edx,%rdx
+  80612f:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806136:	48 01 ca             	add    %rcx,%rdx
+  806139:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806140:	8b 12                	mov    (%rdx),%edx
+  806142:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806145:	75 27                	jne    80616e <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806147:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  80614e:	ff ff ff 
+  806151:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806155:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806158:	48 98                	cltq
+  80615a:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806161:	48 01 d0             	add    %rdx,%rax
+  806164:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80616a:	8b 00                	mov    (%rax),%eax
+  80616c:	eb 12                	jmp    806180 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  80616e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806172:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806179:	7e a0                	jle    80611b <ipc_find_env+0x28>
+	}
+	return 0;
+  80617b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806180:	c9                   	leave
+  806181:	c3                   	ret
+
+0000000000806182 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806182:	55                   	push   %rbp
+  806183:	48 89 e5             	mov    %rsp,%rbp
+  806186:	48 83 ec 18          	sub    $0x18,%rsp
+  80618a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80618a <pageref+0x8>
+  806191:	49 bb a6 1e 00 00 00 	movabs $0x1ea6,%r11
+  806198:	00 00 00 
+  80619b:	4c 01 d8             	add    %r11,%rax
+  80619e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  8061a2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8061a6:	48 89 d1             	mov    %rdx,%rcx
+  8061a9:	48 c1 e9 15          	shr    $0x15,%rcx
+  8061ad:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8061b4:	ff ff ff 
+  8061b7:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8061bb:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8061bf:	83 e2 01             	and    $0x1,%edx
+  8061c2:	48 85 d2             	test   %rdx,%rdx
+  8061c5:	75 07                	jne    8061ce <pageref+0x4c>
+		return 0;
+  8061c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061cc:	eb 64                	jmp    806232 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  8061ce:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8061d2:	48 89 d1             	mov    %rdx,%rcx
+  8061d5:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8061d9:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8061e0:	ff ff ff 
+  8061e3:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8061e7:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8061eb:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  8061ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8061f3:	83 e2 01             	and    $0x1,%edx
+  8061f6:	48 85 d2             	test   %rdx,%rdx
+  8061f9:	75 07                	jne    806202 <pageref+0x80>
+		return 0;
+  8061fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  806200:	eb 30                	jmp    806232 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806202:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806206:	48 c1 ea 0c          	shr    $0xc,%rdx
+  80620a:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806211:	ff ff ff 
+  806214:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806218:	48 89 d0             	mov    %rdx,%rax
+  80621b:	48 01 c0             	add    %rax,%rax
+  80621e:	48 01 d0             	add    %rdx,%rax
+  806221:	48 c1 e0 03          	shl    $0x3,%rax
+  806225:	48 01 c8             	add    %rcx,%rax
+  806228:	48 83 c0 08          	add    $0x8,%rax
+  80622c:	0f b7 00             	movzwl (%rax),%eax
+  80622f:	0f b7 c0             	movzwl %ax,%eax
+}
+  806232:	c9                   	leave
+  806233:	c3                   	ret
@@ -0,0 +1,9318 @@
+
+obj/user/yield:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 1d 01 00 00       	call   80015e <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb e2 7f 00 00 00 	movabs $0x7fe2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+
+	cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  800069:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  800070:	ff ff ff 
+  800073:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800077:	48 8b 00             	mov    (%rax),%rax
+  80007a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800080:	89 c6                	mov    %eax,%esi
+  800082:	48 b8 c0 de ff ff ff 	movabs $0xffffffffffffdec0,%rax
+  800089:	ff ff ff 
+  80008c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800090:	48 89 c7             	mov    %rax,%rdi
+  800093:	49 89 df             	mov    %rbx,%r15
+  800096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009b:	48 ba b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%rdx
+  8000a2:	ff ff ff 
+  8000a5:	48 01 da             	add    %rbx,%rdx
+  8000a8:	ff d2                	call   *%rdx
+	for (i = 0; i < 5; i++) {
+  8000aa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8000b1:	eb 5a                	jmp    80010d <umain+0xca>
+		sys_yield();
+  8000b3:	49 89 df             	mov    %rbx,%r15
+  8000b6:	48 b8 df 9d ff ff ff 	movabs $0xffffffffffff9ddf,%rax
+  8000bd:	ff ff ff 
+  8000c0:	48 01 d8             	add    %rbx,%rax
+  8000c3:	ff d0                	call   *%rax
+		cprintf("Back in environment %08x, iteration %d.\n",
+			thisenv->env_id, i);
+  8000c5:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8000cc:	ff ff ff 
+  8000cf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8000d3:	48 8b 00             	mov    (%rax),%rax
+  8000d6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("Back in environment %08x, iteration %d.\n",
+  8000dc:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8000df:	89 c6                	mov    %eax,%esi
+  8000e1:	48 b8 e0 de ff ff ff 	movabs $0xffffffffffffdee0,%rax
+  8000e8:	ff ff ff 
+  8000eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000ef:	48 89 c7             	mov    %rax,%rdi
+  8000f2:	49 89 df             	mov    %rbx,%r15
+  8000f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fa:	48 b9 b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%rcx
+  800101:	ff ff ff 
+  800104:	48 01 d9             	add    %rbx,%rcx
+  800107:	ff d1                	call   *%rcx
+	for (i = 0; i < 5; i++) {
+  800109:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80010d:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  800111:	7e a0                	jle    8000b3 <umain+0x70>
+	}
+	cprintf("All done in environment %08x.\n", thisenv->env_id);
+  800113:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80011a:	ff ff ff 
+  80011d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800121:	48 8b 00             	mov    (%rax),%rax
+  800124:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80012a:	89 c6                	mov    %eax,%esi
+  80012c:	48 b8 10 df ff ff ff 	movabs $0xffffffffffffdf10,%rax
+  800133:	ff ff ff 
+  800136:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80013a:	48 89 c7             	mov    %rax,%rdi
+  80013d:	49 89 df             	mov    %rbx,%r15
+  800140:	b8 00 00 00 00       	mov    $0x0,%eax
+  800145:	48 ba b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%rdx
+  80014c:	ff ff ff 
+  80014f:	48 01 da             	add    %rbx,%rdx
+  800152:	ff d2                	call   *%rdx
+}
+  800154:	90                   	nop
+  800155:	48 83 c4 20          	add    $0x20,%rsp
+  800159:	5b                   	pop    %rbx
+  80015a:	41 5f                	pop    %r15
+  80015c:	5d                   	pop    %rbp
+  80015d:	c3                   	ret
+
+000000000080015e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80015e:	55                   	push   %rbp
+  80015f:	48 89 e5             	mov    %rsp,%rbp
+  800162:	41 57                	push   %r15
+  800164:	53                   	push   %rbx
+  800165:	48 83 ec 20          	sub    $0x20,%rsp
+  800169:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800169 <libmain+0xb>
+  800170:	49 bb c7 7e 00 00 00 	movabs $0x7ec7,%r11
+  800177:	00 00 00 
+  80017a:	4c 01 db             	add    %r11,%rbx
+  80017d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800180:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800184:	49 89 df             	mov    %rbx,%r15
+  800187:	48 b8 8b 9d ff ff ff 	movabs $0xffffffffffff9d8b,%rax
+  80018e:	ff ff ff 
+  800191:	48 01 d8             	add    %rbx,%rax
+  800194:	ff d0                	call   *%rax
+  800196:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800199:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80019c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001a1:	48 98                	cltq
+  8001a3:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8001aa:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8001b1:	ff ff ff 
+  8001b4:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8001b8:	48 01 c2             	add    %rax,%rdx
+  8001bb:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  8001c2:	00 00 00 
+  8001c5:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001c9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8001cd:	7e 15                	jle    8001e4 <libmain+0x86>
+		binaryname = argv[0];
+  8001cf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8001d3:	48 8b 00             	mov    (%rax),%rax
+  8001d6:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  8001dd:	00 00 00 
+  8001e0:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8001e4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8001e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8001eb:	48 89 d6             	mov    %rdx,%rsi
+  8001ee:	89 c7                	mov    %eax,%edi
+  8001f0:	49 89 df             	mov    %rbx,%r15
+  8001f3:	48 b8 13 80 ff ff ff 	movabs $0xffffffffffff8013,%rax
+  8001fa:	ff ff ff 
+  8001fd:	48 01 d8             	add    %rbx,%rax
+  800200:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800202:	49 89 df             	mov    %rbx,%r15
+  800205:	48 b8 ee 81 ff ff ff 	movabs $0xffffffffffff81ee,%rax
+  80020c:	ff ff ff 
+  80020f:	48 01 d8             	add    %rbx,%rax
+  800212:	ff d0                	call   *%rax
+}
+  800214:	90                   	nop
+  800215:	48 83 c4 20          	add    $0x20,%rsp
+  800219:	5b                   	pop    %rbx
+  80021a:	41 5f                	pop    %r15
+  80021c:	5d                   	pop    %rbp
+  80021d:	c3                   	ret
+
+000000000080021e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80021e:	55                   	push   %rbp
+  80021f:	48 89 e5             	mov    %rsp,%rbp
+  800222:	41 57                	push   %r15
+  800224:	53                   	push   %rbx
+  800225:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800225 <exit+0x7>
+  80022c:	49 bb 0b 7e 00 00 00 	movabs $0x7e0b,%r11
+  800233:	00 00 00 
+  800236:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800239:	49 89 df             	mov    %rbx,%r15
+  80023c:	48 b8 08 aa ff ff ff 	movabs $0xffffffffffffaa08,%rax
+  800243:	ff ff ff 
+  800246:	48 01 d8             	add    %rbx,%rax
+  800249:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80024b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800250:	49 89 df             	mov    %rbx,%r15
+  800253:	48 b8 2f 9d ff ff ff 	movabs $0xffffffffffff9d2f,%rax
+  80025a:	ff ff ff 
+  80025d:	48 01 d8             	add    %rbx,%rax
+  800260:	ff d0                	call   *%rax
+}
+  800262:	90                   	nop
+  800263:	5b                   	pop    %rbx
+  800264:	41 5f                	pop    %r15
+  800266:	5d                   	pop    %rbp
+  800267:	c3                   	ret
+
+0000000000800268 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800268:	55                   	push   %rbp
+  800269:	48 89 e5             	mov    %rsp,%rbp
+  80026c:	41 57                	push   %r15
+  80026e:	48 83 ec 18          	sub    $0x18,%rsp
+  800272:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800272 <putch+0xa>
+  800279:	49 bb be 7d 00 00 00 	movabs $0x7dbe,%r11
+  800280:	00 00 00 
+  800283:	4c 01 d8             	add    %r11,%rax
+  800286:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800289:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80028d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800291:	8b 12                	mov    (%rdx),%edx
+  800293:	8d 72 01             	lea    0x1(%rdx),%esi
+  800296:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80029a:	89 31                	mov    %esi,(%rcx)
+  80029c:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80029f:	89 ce                	mov    %ecx,%esi
+  8002a1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8002a5:	48 63 d2             	movslq %edx,%rdx
+  8002a8:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8002ad:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8002b1:	8b 12                	mov    (%rdx),%edx
+  8002b3:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002b9:	75 33                	jne    8002ee <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8002bb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8002bf:	8b 12                	mov    (%rdx),%edx
+  8002c1:	48 63 d2             	movslq %edx,%rdx
+  8002c4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8002c8:	48 83 c1 08          	add    $0x8,%rcx
+  8002cc:	48 89 d6             	mov    %rdx,%rsi
+  8002cf:	48 89 cf             	mov    %rcx,%rdi
+  8002d2:	49 89 c7             	mov    %rax,%r15
+  8002d5:	48 ba 7c 9c ff ff ff 	movabs $0xffffffffffff9c7c,%rdx
+  8002dc:	ff ff ff 
+  8002df:	48 01 c2             	add    %rax,%rdx
+  8002e2:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8002e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002e8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8002ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002f2:	8b 40 04             	mov    0x4(%rax),%eax
+  8002f5:	8d 50 01             	lea    0x1(%rax),%edx
+  8002f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002fc:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8002ff:	90                   	nop
+  800300:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800304:	c9                   	leave
+  800305:	c3                   	ret
+
+0000000000800306 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800306:	55                   	push   %rbp
+  800307:	48 89 e5             	mov    %rsp,%rbp
+  80030a:	41 57                	push   %r15
+  80030c:	53                   	push   %rbx
+  80030d:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800314:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800314 <vcprintf+0xe>
+  80031b:	49 bb 1c 7d 00 00 00 	movabs $0x7d1c,%r11
+  800322:	00 00 00 
+  800325:	4c 01 db             	add    %r11,%rbx
+  800328:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  80032f:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800336:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80033d:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800344:	48 8b 06             	mov    (%rsi),%rax
+  800347:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80034b:	48 89 01             	mov    %rax,(%rcx)
+  80034e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800352:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800356:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  80035a:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800361:	00 00 00 
+    b.cnt = 0;
+  800364:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80036b:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  80036e:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800375:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  80037c:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800383:	48 89 c6             	mov    %rax,%rsi
+  800386:	48 b8 38 82 ff ff ff 	movabs $0xffffffffffff8238,%rax
+  80038d:	ff ff ff 
+  800390:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800394:	48 89 c7             	mov    %rax,%rdi
+  800397:	49 89 df             	mov    %rbx,%r15
+  80039a:	48 b8 fa 87 ff ff ff 	movabs $0xffffffffffff87fa,%rax
+  8003a1:	ff ff ff 
+  8003a4:	48 01 d8             	add    %rbx,%rax
+  8003a7:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8003a9:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8003af:	48 98                	cltq
+  8003b1:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8003b8:	48 83 c2 08          	add    $0x8,%rdx
+  8003bc:	48 89 c6             	mov    %rax,%rsi
+  8003bf:	48 89 d7             	mov    %rdx,%rdi
+  8003c2:	49 89 df             	mov    %rbx,%r15
+  8003c5:	48 b8 7c 9c ff ff ff 	movabs $0xffffffffffff9c7c,%rax
+  8003cc:	ff ff ff 
+  8003cf:	48 01 d8             	add    %rbx,%rax
+  8003d2:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8003d4:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8003da:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8003e1:	5b                   	pop    %rbx
+  8003e2:	41 5f                	pop    %r15
+  8003e4:	5d                   	pop    %rbp
+  8003e5:	c3                   	ret
+
+00000000008003e6 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8003e6:	55                   	push   %rbp
+  8003e7:	48 89 e5             	mov    %rsp,%rbp
+  8003ea:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8003f1:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8003f1 <cprintf+0xb>
+  8003f8:	49 bb 3f 7c 00 00 00 	movabs $0x7c3f,%r11
+  8003ff:	00 00 00 
+  800402:	4d 01 da             	add    %r11,%r10
+  800405:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80040c:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800413:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80041a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800421:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800428:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80042f:	84 c0                	test   %al,%al
+  800431:	74 20                	je     800453 <cprintf+0x6d>
+  800433:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800437:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80043b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80043f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800443:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800447:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80044b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80044f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800453:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80045a:	00 00 00 
+  80045d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800464:	00 00 00 
+  800467:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80046b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800472:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800479:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800480:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800487:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80048e:	48 8b 06             	mov    (%rsi),%rax
+  800491:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800495:	48 89 01             	mov    %rax,(%rcx)
+  800498:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80049c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8004a0:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8004a4:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8004ab:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8004b2:	48 89 d6             	mov    %rdx,%rsi
+  8004b5:	48 89 c7             	mov    %rax,%rdi
+  8004b8:	48 b8 d6 82 ff ff ff 	movabs $0xffffffffffff82d6,%rax
+  8004bf:	ff ff ff 
+  8004c2:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8004c6:	ff d0                	call   *%rax
+  8004c8:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8004ce:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8004d4:	c9                   	leave
+  8004d5:	c3                   	ret
+
+00000000008004d6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004d6:	55                   	push   %rbp
+  8004d7:	48 89 e5             	mov    %rsp,%rbp
+  8004da:	53                   	push   %rbx
+  8004db:	48 83 ec 38          	sub    $0x38,%rsp
+  8004df:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004df <printnum+0x9>
+  8004e6:	49 bb 51 7b 00 00 00 	movabs $0x7b51,%r11
+  8004ed:	00 00 00 
+  8004f0:	4c 01 db             	add    %r11,%rbx
+  8004f3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8004f7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8004fb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8004ff:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800502:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800506:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80050a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80050d:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800511:	72 58                	jb     80056b <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800513:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800516:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800519:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  80051c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800520:	ba 00 00 00 00       	mov    $0x0,%edx
+  800525:	48 f7 f6             	div    %rsi
+  800528:	49 89 c2             	mov    %rax,%r10
+  80052b:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80052e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800531:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800535:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800539:	41 89 c9             	mov    %ecx,%r9d
+  80053c:	41 89 f8             	mov    %edi,%r8d
+  80053f:	89 d1                	mov    %edx,%ecx
+  800541:	4c 89 d2             	mov    %r10,%rdx
+  800544:	48 89 c7             	mov    %rax,%rdi
+  800547:	48 b8 a6 84 ff ff ff 	movabs $0xffffffffffff84a6,%rax
+  80054e:	ff ff ff 
+  800551:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800555:	ff d0                	call   *%rax
+  800557:	eb 1c                	jmp    800575 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800559:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80055d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800560:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800564:	48 89 d6             	mov    %rdx,%rsi
+  800567:	89 c7                	mov    %eax,%edi
+  800569:	ff d1                	call   *%rcx
+		while (--width > 0)
+  80056b:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  80056f:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800573:	7f e4                	jg     800559 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800575:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800578:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80057c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800581:	48 f7 f1             	div    %rcx
+  800584:	48 b8 77 e0 ff ff ff 	movabs $0xffffffffffffe077,%rax
+  80058b:	ff ff ff 
+  80058e:	48 01 d8             	add    %rbx,%rax
+  800591:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800595:	0f be c0             	movsbl %al,%eax
+  800598:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80059c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005a0:	48 89 d6             	mov    %rdx,%rsi
+  8005a3:	89 c7                	mov    %eax,%edi
+  8005a5:	ff d1                	call   *%rcx
+}
+  8005a7:	90                   	nop
+  8005a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005ac:	c9                   	leave
+  8005ad:	c3                   	ret
+
+00000000008005ae <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8005ae:	55                   	push   %rbp
+  8005af:	48 89 e5             	mov    %rsp,%rbp
+  8005b2:	48 83 ec 20          	sub    $0x20,%rsp
+  8005b6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8005b6 <getuint+0x8>
+  8005bd:	49 bb 7a 7a 00 00 00 	movabs $0x7a7a,%r11
+  8005c4:	00 00 00 
+  8005c7:	4c 01 d8             	add    %r11,%rax
+  8005ca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8005ce:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8005d1:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8005d5:	7e 4f                	jle    800626 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8005d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005db:	8b 00                	mov    (%rax),%eax
+  8005dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8005e0:	77 24                	ja     800606 <getuint+0x58>
+  8005e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005e6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005ee:	8b 00                	mov    (%rax),%eax
+  8005f0:	89 c0                	mov    %eax,%eax
+  8005f2:	48 01 d0             	add    %rdx,%rax
+  8005f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005f9:	8b 12                	mov    (%rdx),%edx
+  8005fb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005fe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800602:	89 0a                	mov    %ecx,(%rdx)
+  800604:	eb 14                	jmp    80061a <getuint+0x6c>
+  800606:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80060a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80060e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800612:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800616:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80061a:	48 8b 00             	mov    (%rax),%rax
+  80061d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800621:	e9 9d 00 00 00       	jmp    8006c3 <getuint+0x115>
+	else if (lflag)
+  800626:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80062a:	74 4c                	je     800678 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  80062c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800630:	8b 00                	mov    (%rax),%eax
+  800632:	83 f8 2f             	cmp    $0x2f,%eax
+  800635:	77 24                	ja     80065b <getuint+0xad>
+  800637:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80063b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80063f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800643:	8b 00                	mov    (%rax),%eax
+  800645:	89 c0                	mov    %eax,%eax
+  800647:	48 01 d0             	add    %rdx,%rax
+  80064a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80064e:	8b 12                	mov    (%rdx),%edx
+  800650:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800653:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800657:	89 0a                	mov    %ecx,(%rdx)
+  800659:	eb 14                	jmp    80066f <getuint+0xc1>
+  80065b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80065f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800663:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800667:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80066b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80066f:	48 8b 00             	mov    (%rax),%rax
+  800672:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800676:	eb 4b                	jmp    8006c3 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800678:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80067c:	8b 00                	mov    (%rax),%eax
+  80067e:	83 f8 2f             	cmp    $0x2f,%eax
+  800681:	77 24                	ja     8006a7 <getuint+0xf9>
+  800683:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800687:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80068b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80068f:	8b 00                	mov    (%rax),%eax
+  800691:	89 c0                	mov    %eax,%eax
+  800693:	48 01 d0             	add    %rdx,%rax
+  800696:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80069a:	8b 12                	mov    (%rdx),%edx
+  80069c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80069f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006a3:	89 0a                	mov    %ecx,(%rdx)
+  8006a5:	eb 14                	jmp    8006bb <getuint+0x10d>
+  8006a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006af:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006b3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006b7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006bb:	8b 00                	mov    (%rax),%eax
+  8006bd:	89 c0                	mov    %eax,%eax
+  8006bf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8006c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8006c7:	c9                   	leave
+  8006c8:	c3                   	ret
+
+00000000008006c9 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8006c9:	55                   	push   %rbp
+  8006ca:	48 89 e5             	mov    %rsp,%rbp
+  8006cd:	48 83 ec 20          	sub    $0x20,%rsp
+  8006d1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8006d1 <printfloat+0x8>
+  8006d8:	49 bb 5f 79 00 00 00 	movabs $0x795f,%r11
+  8006df:	00 00 00 
+  8006e2:	4c 01 d8             	add    %r11,%rax
+  8006e5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006e9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8006ed:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  8006f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006f5:	48 85 c0             	test   %rax,%rax
+  8006f8:	79 12                	jns    80070c <printfloat+0x43>
+		putch('-',putdat);
+  8006fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8006fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800702:	48 89 c6             	mov    %rax,%rsi
+  800705:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80070a:	ff d2                	call   *%rdx
+	
+}
+  80070c:	90                   	nop
+  80070d:	c9                   	leave
+  80070e:	c3                   	ret
+
+000000000080070f <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  80070f:	55                   	push   %rbp
+  800710:	48 89 e5             	mov    %rsp,%rbp
+  800713:	48 83 ec 20          	sub    $0x20,%rsp
+  800717:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800717 <getint+0x8>
+  80071e:	49 bb 19 79 00 00 00 	movabs $0x7919,%r11
+  800725:	00 00 00 
+  800728:	4c 01 d8             	add    %r11,%rax
+  80072b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80072f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800732:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800736:	7e 4f                	jle    800787 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800738:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80073c:	8b 00                	mov    (%rax),%eax
+  80073e:	83 f8 2f             	cmp    $0x2f,%eax
+  800741:	77 24                	ja     800767 <getint+0x58>
+  800743:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800747:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80074b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80074f:	8b 00                	mov    (%rax),%eax
+  800751:	89 c0                	mov    %eax,%eax
+  800753:	48 01 d0             	add    %rdx,%rax
+  800756:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80075a:	8b 12                	mov    (%rdx),%edx
+  80075c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80075f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800763:	89 0a                	mov    %ecx,(%rdx)
+  800765:	eb 14                	jmp    80077b <getint+0x6c>
+  800767:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80076b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80076f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800773:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800777:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80077b:	48 8b 00             	mov    (%rax),%rax
+  80077e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800782:	e9 9d 00 00 00       	jmp    800824 <getint+0x115>
+	else if (lflag)
+  800787:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80078b:	74 4c                	je     8007d9 <getint+0xca>
+		x=va_arg(*ap, long);
+  80078d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800791:	8b 00                	mov    (%rax),%eax
+  800793:	83 f8 2f             	cmp    $0x2f,%eax
+  800796:	77 24                	ja     8007bc <getint+0xad>
+  800798:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80079c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007a4:	8b 00                	mov    (%rax),%eax
+  8007a6:	89 c0                	mov    %eax,%eax
+  8007a8:	48 01 d0             	add    %rdx,%rax
+  8007ab:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007af:	8b 12                	mov    (%rdx),%edx
+  8007b1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007b4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007b8:	89 0a                	mov    %ecx,(%rdx)
+  8007ba:	eb 14                	jmp    8007d0 <getint+0xc1>
+  8007bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007c4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007c8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007cc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007d0:	48 8b 00             	mov    (%rax),%rax
+  8007d3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8007d7:	eb 4b                	jmp    800824 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  8007d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007dd:	8b 00                	mov    (%rax),%eax
+  8007df:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e2:	77 24                	ja     800808 <getint+0xf9>
+  8007e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007e8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007f0:	8b 00                	mov    (%rax),%eax
+  8007f2:	89 c0                	mov    %eax,%eax
+  8007f4:	48 01 d0             	add    %rdx,%rax
+  8007f7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007fb:	8b 12                	mov    (%rdx),%edx
+  8007fd:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800800:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800804:	89 0a                	mov    %ecx,(%rdx)
+  800806:	eb 14                	jmp    80081c <getint+0x10d>
+  800808:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80080c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800810:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800814:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800818:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80081c:	8b 00                	mov    (%rax),%eax
+  80081e:	48 98                	cltq
+  800820:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800824:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800828:	c9                   	leave
+  800829:	c3                   	ret
+
+000000000080082a <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  80082a:	55                   	push   %rbp
+  80082b:	48 89 e5             	mov    %rsp,%rbp
+  80082e:	41 57                	push   %r15
+  800830:	41 55                	push   %r13
+  800832:	41 54                	push   %r12
+  800834:	53                   	push   %rbx
+  800835:	48 83 ec 60          	sub    $0x60,%rsp
+  800839:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800839 <vprintfmt+0xf>
+  800840:	49 bb f7 77 00 00 00 	movabs $0x77f7,%r11
+  800847:	00 00 00 
+  80084a:	4d 01 dc             	add    %r11,%r12
+  80084d:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800851:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800855:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800859:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  80085d:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800864:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800868:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  80086c:	48 8b 06             	mov    (%rsi),%rax
+  80086f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800873:	48 89 01             	mov    %rax,(%rcx)
+  800876:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80087a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80087e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800882:	eb 17                	jmp    80089b <vprintfmt+0x71>
+			if (ch == '\0')
+  800884:	85 db                	test   %ebx,%ebx
+  800886:	0f 84 97 05 00 00    	je     800e23 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  80088c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800890:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800894:	48 89 c6             	mov    %rax,%rsi
+  800897:	89 df                	mov    %ebx,%edi
+  800899:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80089b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80089f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008a3:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8008a7:	0f b6 00             	movzbl (%rax),%eax
+  8008aa:	0f b6 d8             	movzbl %al,%ebx
+  8008ad:	83 fb 25             	cmp    $0x25,%ebx
+  8008b0:	75 d2                	jne    800884 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  8008b2:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  8008b6:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  8008bd:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  8008c4:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  8008cb:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  8008d2:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8008d6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008da:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8008de:	0f b6 00             	movzbl (%rax),%eax
+  8008e1:	0f b6 d8             	movzbl %al,%ebx
+  8008e4:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8008e7:	83 f8 55             	cmp    $0x55,%eax
+  8008ea:	0f 87 00 05 00 00    	ja     800df0 <vprintfmt+0x5c6>
+  8008f0:	89 c0                	mov    %eax,%eax
+  8008f2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8008f9:	00 
+  8008fa:	48 8d 05 cf 57 00 00 	lea    0x57cf(%rip),%rax        # 8060d0 <.LC18+0xc>
+  800901:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800905:	48 8d 15 c4 57 00 00 	lea    0x57c4(%rip),%rdx        # 8060d0 <.LC18+0xc>
+  80090c:	48 01 d0             	add    %rdx,%rax
+  80090f:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800911:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800915:	eb bb                	jmp    8008d2 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800917:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  80091b:	eb b5                	jmp    8008d2 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  80091d:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800924:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800927:	89 d0                	mov    %edx,%eax
+  800929:	c1 e0 02             	shl    $0x2,%eax
+  80092c:	01 d0                	add    %edx,%eax
+  80092e:	01 c0                	add    %eax,%eax
+  800930:	01 d8                	add    %ebx,%eax
+  800932:	83 e8 30             	sub    $0x30,%eax
+  800935:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800938:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80093c:	0f b6 00             	movzbl (%rax),%eax
+  80093f:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800942:	83 fb 2f             	cmp    $0x2f,%ebx
+  800945:	7e 60                	jle    8009a7 <vprintfmt+0x17d>
+  800947:	83 fb 39             	cmp    $0x39,%ebx
+  80094a:	7f 5b                	jg     8009a7 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  80094c:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800951:	eb d1                	jmp    800924 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800953:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800956:	83 f8 2f             	cmp    $0x2f,%eax
+  800959:	77 17                	ja     800972 <vprintfmt+0x148>
+  80095b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80095f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800962:	89 d2                	mov    %edx,%edx
+  800964:	48 01 d0             	add    %rdx,%rax
+  800967:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80096a:	83 c2 08             	add    $0x8,%edx
+  80096d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800970:	eb 0c                	jmp    80097e <vprintfmt+0x154>
+  800972:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800976:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80097a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80097e:	8b 00                	mov    (%rax),%eax
+  800980:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800983:	eb 23                	jmp    8009a8 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800985:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800989:	0f 89 43 ff ff ff    	jns    8008d2 <vprintfmt+0xa8>
+				width = 0;
+  80098f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800996:	e9 37 ff ff ff       	jmp    8008d2 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  80099b:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  8009a2:	e9 2b ff ff ff       	jmp    8008d2 <vprintfmt+0xa8>
+			goto process_precision;
+  8009a7:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  8009a8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8009ac:	0f 89 20 ff ff ff    	jns    8008d2 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  8009b2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8009b5:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8009b8:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  8009bf:	e9 0e ff ff ff       	jmp    8008d2 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8009c4:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  8009c8:	e9 05 ff ff ff       	jmp    8008d2 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  8009cd:	83 fb 39             	cmp    $0x39,%ebx
+  8009d0:	7f 0b                	jg     8009dd <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  8009d2:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  8009d5:	c1 e0 08             	shl    $0x8,%eax
+  8009d8:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8009db:	eb 21                	jmp    8009fe <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  8009dd:	83 fb 60             	cmp    $0x60,%ebx
+  8009e0:	7e 10                	jle    8009f2 <vprintfmt+0x1c8>
+  8009e2:	83 fb 66             	cmp    $0x66,%ebx
+  8009e5:	7f 0b                	jg     8009f2 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  8009e7:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  8009ea:	c1 e0 08             	shl    $0x8,%eax
+  8009ed:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8009f0:	eb 0c                	jmp    8009fe <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  8009f2:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  8009f9:	e9 04 01 00 00       	jmp    800b02 <vprintfmt+0x2d8>
+  8009fe:	e9 ff 00 00 00       	jmp    800b02 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800a03:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800a06:	83 f8 2f             	cmp    $0x2f,%eax
+  800a09:	77 17                	ja     800a22 <vprintfmt+0x1f8>
+  800a0b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800a0f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a12:	89 d2                	mov    %edx,%edx
+  800a14:	48 01 d0             	add    %rdx,%rax
+  800a17:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a1a:	83 c2 08             	add    $0x8,%edx
+  800a1d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800a20:	eb 0c                	jmp    800a2e <vprintfmt+0x204>
+  800a22:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a26:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a2a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800a2e:	8b 00                	mov    (%rax),%eax
+  800a30:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800a34:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800a38:	48 89 d6             	mov    %rdx,%rsi
+  800a3b:	89 c7                	mov    %eax,%edi
+  800a3d:	ff d1                	call   *%rcx
+			break;
+  800a3f:	e9 da 03 00 00       	jmp    800e1e <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800a44:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800a47:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4a:	77 17                	ja     800a63 <vprintfmt+0x239>
+  800a4c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800a50:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a53:	89 d2                	mov    %edx,%edx
+  800a55:	48 01 d0             	add    %rdx,%rax
+  800a58:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a5b:	83 c2 08             	add    $0x8,%edx
+  800a5e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800a61:	eb 0c                	jmp    800a6f <vprintfmt+0x245>
+  800a63:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a67:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a6b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800a6f:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800a71:	85 db                	test   %ebx,%ebx
+  800a73:	79 02                	jns    800a77 <vprintfmt+0x24d>
+				err = -err;
+  800a75:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a77:	83 fb 15             	cmp    $0x15,%ebx
+  800a7a:	7f 19                	jg     800a95 <vprintfmt+0x26b>
+  800a7c:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  800a83:	00 00 00 
+  800a86:	48 63 c3             	movslq %ebx,%rax
+  800a89:	4c 01 e2             	add    %r12,%rdx
+  800a8c:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800a90:	4d 85 ed             	test   %r13,%r13
+  800a93:	75 36                	jne    800acb <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800a95:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800a99:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a9d:	89 d9                	mov    %ebx,%ecx
+  800a9f:	48 ba 88 e0 ff ff ff 	movabs $0xffffffffffffe088,%rdx
+  800aa6:	ff ff ff 
+  800aa9:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800aad:	48 89 c7             	mov    %rax,%rdi
+  800ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab5:	49 b8 01 8e ff ff ff 	movabs $0xffffffffffff8e01,%r8
+  800abc:	ff ff ff 
+  800abf:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800ac3:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800ac6:	e9 53 03 00 00       	jmp    800e1e <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800acb:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800acf:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ad3:	4c 89 e9             	mov    %r13,%rcx
+  800ad6:	48 ba 91 e0 ff ff ff 	movabs $0xffffffffffffe091,%rdx
+  800add:	ff ff ff 
+  800ae0:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800ae4:	48 89 c7             	mov    %rax,%rdi
+  800ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aec:	49 b8 01 8e ff ff ff 	movabs $0xffffffffffff8e01,%r8
+  800af3:	ff ff ff 
+  800af6:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800afa:	41 ff d0             	call   *%r8
+			break;
+  800afd:	e9 1c 03 00 00       	jmp    800e1e <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800b02:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800b05:	83 f8 2f             	cmp    $0x2f,%eax
+  800b08:	77 17                	ja     800b21 <vprintfmt+0x2f7>
+  800b0a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800b0e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b11:	89 d2                	mov    %edx,%edx
+  800b13:	48 01 d0             	add    %rdx,%rax
+  800b16:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b19:	83 c2 08             	add    $0x8,%edx
+  800b1c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b1f:	eb 0c                	jmp    800b2d <vprintfmt+0x303>
+  800b21:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b25:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b29:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b2d:	4c 8b 28             	mov    (%rax),%r13
+  800b30:	4d 85 ed             	test   %r13,%r13
+  800b33:	75 0e                	jne    800b43 <vprintfmt+0x319>
+				p = "(null)";
+  800b35:	48 b8 94 e0 ff ff ff 	movabs $0xffffffffffffe094,%rax
+  800b3c:	ff ff ff 
+  800b3f:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800b43:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b47:	0f 8e 84 00 00 00    	jle    800bd1 <vprintfmt+0x3a7>
+  800b4d:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800b51:	74 7e                	je     800bd1 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b53:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800b56:	48 98                	cltq
+  800b58:	48 89 c6             	mov    %rax,%rsi
+  800b5b:	4c 89 ef             	mov    %r13,%rdi
+  800b5e:	4d 89 e7             	mov    %r12,%r15
+  800b61:	48 b8 26 91 ff ff ff 	movabs $0xffffffffffff9126,%rax
+  800b68:	ff ff ff 
+  800b6b:	4c 01 e0             	add    %r12,%rax
+  800b6e:	ff d0                	call   *%rax
+  800b70:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800b73:	eb 17                	jmp    800b8c <vprintfmt+0x362>
+					putch(padc, putdat);
+  800b75:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800b79:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800b7d:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800b81:	48 89 d6             	mov    %rdx,%rsi
+  800b84:	89 c7                	mov    %eax,%edi
+  800b86:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b88:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800b8c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b90:	7f e3                	jg     800b75 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b92:	eb 3d                	jmp    800bd1 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b94:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800b98:	74 1e                	je     800bb8 <vprintfmt+0x38e>
+  800b9a:	83 fb 1f             	cmp    $0x1f,%ebx
+  800b9d:	7e 05                	jle    800ba4 <vprintfmt+0x37a>
+  800b9f:	83 fb 7e             	cmp    $0x7e,%ebx
+  800ba2:	7e 14                	jle    800bb8 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800ba4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ba8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800bac:	48 89 c6             	mov    %rax,%rsi
+  800baf:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800bb4:	ff d2                	call   *%rdx
+  800bb6:	eb 15                	jmp    800bcd <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800bb8:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800bbb:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800bbe:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800bc2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800bc6:	48 89 c6             	mov    %rax,%rsi
+  800bc9:	89 cf                	mov    %ecx,%edi
+  800bcb:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800bcd:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800bd1:	4c 89 e8             	mov    %r13,%rax
+  800bd4:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800bd8:	0f b6 00             	movzbl (%rax),%eax
+  800bdb:	0f be d8             	movsbl %al,%ebx
+  800bde:	85 db                	test   %ebx,%ebx
+  800be0:	74 28                	je     800c0a <vprintfmt+0x3e0>
+  800be2:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800be6:	78 ac                	js     800b94 <vprintfmt+0x36a>
+  800be8:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800bec:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800bf0:	79 a2                	jns    800b94 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800bf2:	eb 16                	jmp    800c0a <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800bf4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800bf8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800bfc:	48 89 c6             	mov    %rax,%rsi
+  800bff:	bf 20 00 00 00       	mov    $0x20,%edi
+  800c04:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800c06:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800c0a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c0e:	7f e4                	jg     800bf4 <vprintfmt+0x3ca>
+			break;
+  800c10:	e9 09 02 00 00       	jmp    800e1e <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800c15:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c19:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c1d:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c21:	0f b6 00             	movzbl (%rax),%eax
+  800c24:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800c27:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800c28:	83 fb 2f             	cmp    $0x2f,%ebx
+  800c2b:	0f 8e ac fd ff ff    	jle    8009dd <vprintfmt+0x1b3>
+  800c31:	e9 97 fd ff ff       	jmp    8009cd <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800c36:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800c3a:	be 03 00 00 00       	mov    $0x3,%esi
+  800c3f:	48 89 c7             	mov    %rax,%rdi
+  800c42:	48 b8 df 86 ff ff ff 	movabs $0xffffffffffff86df,%rax
+  800c49:	ff ff ff 
+  800c4c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800c50:	ff d0                	call   *%rax
+  800c52:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800c56:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c5a:	48 85 c0             	test   %rax,%rax
+  800c5d:	79 1d                	jns    800c7c <vprintfmt+0x452>
+				putch('-', putdat);
+  800c5f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c63:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c67:	48 89 c6             	mov    %rax,%rsi
+  800c6a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c6f:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800c71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c75:	48 f7 d8             	neg    %rax
+  800c78:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800c7c:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800c83:	e9 de 00 00 00       	jmp    800d66 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800c88:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800c8c:	be 03 00 00 00       	mov    $0x3,%esi
+  800c91:	48 89 c7             	mov    %rax,%rdi
+  800c94:	48 b8 7e 85 ff ff ff 	movabs $0xffffffffffff857e,%rax
+  800c9b:	ff ff ff 
+  800c9e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ca2:	ff d0                	call   *%rax
+  800ca4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800ca8:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800caf:	e9 b2 00 00 00       	jmp    800d66 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800cb4:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800cb8:	be 03 00 00 00       	mov    $0x3,%esi
+  800cbd:	48 89 c7             	mov    %rax,%rdi
+  800cc0:	48 b8 7e 85 ff ff ff 	movabs $0xffffffffffff857e,%rax
+  800cc7:	ff ff ff 
+  800cca:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800cce:	ff d0                	call   *%rax
+  800cd0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800cd4:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800cdb:	e9 86 00 00 00       	jmp    800d66 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800ce0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ce4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ce8:	48 89 c6             	mov    %rax,%rsi
+  800ceb:	bf 30 00 00 00       	mov    $0x30,%edi
+  800cf0:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800cf2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cf6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800cfa:	48 89 c6             	mov    %rax,%rsi
+  800cfd:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d02:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800d04:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d07:	83 f8 2f             	cmp    $0x2f,%eax
+  800d0a:	77 17                	ja     800d23 <vprintfmt+0x4f9>
+  800d0c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d10:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d13:	89 d2                	mov    %edx,%edx
+  800d15:	48 01 d0             	add    %rdx,%rax
+  800d18:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d1b:	83 c2 08             	add    $0x8,%edx
+  800d1e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d21:	eb 0c                	jmp    800d2f <vprintfmt+0x505>
+  800d23:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d27:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d2b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d2f:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800d32:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800d36:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800d3d:	eb 27                	jmp    800d66 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800d3f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d43:	be 03 00 00 00       	mov    $0x3,%esi
+  800d48:	48 89 c7             	mov    %rax,%rdi
+  800d4b:	48 b8 7e 85 ff ff ff 	movabs $0xffffffffffff857e,%rax
+  800d52:	ff ff ff 
+  800d55:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d59:	ff d0                	call   *%rax
+  800d5b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800d5f:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800d66:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800d6b:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800d6e:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800d71:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800d75:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800d79:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d7d:	45 89 c1             	mov    %r8d,%r9d
+  800d80:	41 89 f8             	mov    %edi,%r8d
+  800d83:	48 89 c7             	mov    %rax,%rdi
+  800d86:	48 b8 a6 84 ff ff ff 	movabs $0xffffffffffff84a6,%rax
+  800d8d:	ff ff ff 
+  800d90:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d94:	ff d0                	call   *%rax
+			break;
+  800d96:	e9 83 00 00 00       	jmp    800e1e <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800d9b:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d9f:	be 03 00 00 00       	mov    $0x3,%esi
+  800da4:	48 89 c7             	mov    %rax,%rdi
+  800da7:	48 b8 7e 85 ff ff ff 	movabs $0xffffffffffff857e,%rax
+  800dae:	ff ff ff 
+  800db1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800db5:	ff d0                	call   *%rax
+  800db7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800dbb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800dbf:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800dc3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800dc7:	48 89 ce             	mov    %rcx,%rsi
+  800dca:	48 89 c7             	mov    %rax,%rdi
+  800dcd:	48 b8 99 86 ff ff ff 	movabs $0xffffffffffff8699,%rax
+  800dd4:	ff ff ff 
+  800dd7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ddb:	ff d0                	call   *%rax
+	
+			break;
+  800ddd:	eb 3f                	jmp    800e1e <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800ddf:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800de3:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800de7:	48 89 c6             	mov    %rax,%rsi
+  800dea:	89 df                	mov    %ebx,%edi
+  800dec:	ff d2                	call   *%rdx
+			break;
+  800dee:	eb 2e                	jmp    800e1e <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800df0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800df4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800df8:	48 89 c6             	mov    %rax,%rsi
+  800dfb:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e00:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e02:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800e07:	eb 05                	jmp    800e0e <vprintfmt+0x5e4>
+  800e09:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800e0e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800e12:	48 83 e8 01          	sub    $0x1,%rax
+  800e16:	0f b6 00             	movzbl (%rax),%eax
+  800e19:	3c 25                	cmp    $0x25,%al
+  800e1b:	75 ec                	jne    800e09 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  800e1d:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800e1e:	e9 78 fa ff ff       	jmp    80089b <vprintfmt+0x71>
+				return;
+  800e23:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800e24:	48 83 c4 60          	add    $0x60,%rsp
+  800e28:	5b                   	pop    %rbx
+  800e29:	41 5c                	pop    %r12
+  800e2b:	41 5d                	pop    %r13
+  800e2d:	41 5f                	pop    %r15
+  800e2f:	5d                   	pop    %rbp
+  800e30:	c3                   	ret
+
+0000000000800e31 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  800e31:	55                   	push   %rbp
+  800e32:	48 89 e5             	mov    %rsp,%rbp
+  800e35:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800e3c:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800e3c <printfmt+0xb>
+  800e43:	49 bb f4 71 00 00 00 	movabs $0x71f4,%r11
+  800e4a:	00 00 00 
+  800e4d:	4d 01 da             	add    %r11,%r10
+  800e50:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800e57:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800e5e:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e65:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e6c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e73:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e7a:	84 c0                	test   %al,%al
+  800e7c:	74 20                	je     800e9e <printfmt+0x6d>
+  800e7e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e82:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e86:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800e8a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800e8e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800e92:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e96:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e9a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800e9e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800ea5:	00 00 00 
+  800ea8:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800eaf:	00 00 00 
+  800eb2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800eb6:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800ebd:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800ec4:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800ecb:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800ed2:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ed9:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800ee0:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ee7:	48 89 c7             	mov    %rax,%rdi
+  800eea:	48 b8 fa 87 ff ff ff 	movabs $0xffffffffffff87fa,%rax
+  800ef1:	ff ff ff 
+  800ef4:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800ef8:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800efa:	90                   	nop
+  800efb:	c9                   	leave
+  800efc:	c3                   	ret
+
+0000000000800efd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800efd:	55                   	push   %rbp
+  800efe:	48 89 e5             	mov    %rsp,%rbp
+  800f01:	48 83 ec 10          	sub    $0x10,%rsp
+  800f05:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800f05 <sprintputch+0x8>
+  800f0c:	49 bb 2b 71 00 00 00 	movabs $0x712b,%r11
+  800f13:	00 00 00 
+  800f16:	4c 01 d8             	add    %r11,%rax
+  800f19:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f1c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800f20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f24:	8b 40 10             	mov    0x10(%rax),%eax
+  800f27:	8d 50 01             	lea    0x1(%rax),%edx
+  800f2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f2e:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800f31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f35:	48 8b 10             	mov    (%rax),%rdx
+  800f38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f3c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f40:	48 39 c2             	cmp    %rax,%rdx
+  800f43:	73 17                	jae    800f5c <sprintputch+0x5f>
+		*b->buf++ = ch;
+  800f45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f49:	48 8b 00             	mov    (%rax),%rax
+  800f4c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800f50:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f54:	48 89 0a             	mov    %rcx,(%rdx)
+  800f57:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800f5a:	88 10                	mov    %dl,(%rax)
+}
+  800f5c:	90                   	nop
+  800f5d:	c9                   	leave
+  800f5e:	c3                   	ret
+
+0000000000800f5f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800f5f:	55                   	push   %rbp
+  800f60:	48 89 e5             	mov    %rsp,%rbp
+  800f63:	53                   	push   %rbx
+  800f64:	48 83 ec 58          	sub    $0x58,%rsp
+  800f68:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800f68 <vsnprintf+0x9>
+  800f6f:	49 bb c8 70 00 00 00 	movabs $0x70c8,%r11
+  800f76:	00 00 00 
+  800f79:	4c 01 d8             	add    %r11,%rax
+  800f7c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  800f80:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  800f83:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f87:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  800f8b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  800f8f:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800f93:	48 8b 0e             	mov    (%rsi),%rcx
+  800f96:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  800f9a:	48 89 0a             	mov    %rcx,(%rdx)
+  800f9d:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  800fa1:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  800fa5:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800fa9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800fad:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800fb1:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  800fb4:	48 63 d2             	movslq %edx,%rdx
+  800fb7:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  800fbb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800fbf:	48 01 ca             	add    %rcx,%rdx
+  800fc2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800fc6:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  800fcd:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  800fd2:	74 06                	je     800fda <vsnprintf+0x7b>
+  800fd4:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  800fd8:	7f 07                	jg     800fe1 <vsnprintf+0x82>
+		return -E_INVAL;
+  800fda:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fdf:	eb 34                	jmp    801015 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  800fe1:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  800fe5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800fe9:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800fed:	48 bf cd 8e ff ff ff 	movabs $0xffffffffffff8ecd,%rdi
+  800ff4:	ff ff ff 
+  800ff7:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  800ffb:	49 b8 fa 87 ff ff ff 	movabs $0xffffffffffff87fa,%r8
+  801002:	ff ff ff 
+  801005:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801009:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  80100b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80100f:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801012:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801015:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801019:	c9                   	leave
+  80101a:	c3                   	ret
+
+000000000080101b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80101b:	55                   	push   %rbp
+  80101c:	48 89 e5             	mov    %rsp,%rbp
+  80101f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801026:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801026 <snprintf+0xb>
+  80102d:	49 bb 0a 70 00 00 00 	movabs $0x700a,%r11
+  801034:	00 00 00 
+  801037:	4d 01 da             	add    %r11,%r10
+  80103a:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801041:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801047:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80104e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801055:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80105c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801063:	84 c0                	test   %al,%al
+  801065:	74 20                	je     801087 <snprintf+0x6c>
+  801067:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80106b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80106f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801073:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801077:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80107b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80107f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801083:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801087:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80108e:	00 00 00 
+  801091:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801098:	00 00 00 
+  80109b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80109f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8010a6:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8010ad:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8010b4:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8010bb:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8010c2:	48 8b 06             	mov    (%rsi),%rax
+  8010c5:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8010c9:	48 89 01             	mov    %rax,(%rcx)
+  8010cc:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8010d0:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8010d4:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8010d8:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8010df:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8010e6:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8010ec:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8010f3:	48 89 c7             	mov    %rax,%rdi
+  8010f6:	48 b8 2f 8f ff ff ff 	movabs $0xffffffffffff8f2f,%rax
+  8010fd:	ff ff ff 
+  801100:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801104:	ff d0                	call   *%rax
+  801106:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  80110c:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801112:	c9                   	leave
+  801113:	c3                   	ret
+
+0000000000801114 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801114:	55                   	push   %rbp
+  801115:	48 89 e5             	mov    %rsp,%rbp
+  801118:	48 83 ec 18          	sub    $0x18,%rsp
+  80111c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80111c <strlen+0x8>
+  801123:	49 bb 14 6f 00 00 00 	movabs $0x6f14,%r11
+  80112a:	00 00 00 
+  80112d:	4c 01 d8             	add    %r11,%rax
+  801130:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801134:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80113b:	eb 09                	jmp    801146 <strlen+0x32>
+		n++;
+  80113d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801141:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801146:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80114a:	0f b6 00             	movzbl (%rax),%eax
+  80114d:	84 c0                	test   %al,%al
+  80114f:	75 ec                	jne    80113d <strlen+0x29>
+	return n;
+  801151:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801154:	c9                   	leave
+  801155:	c3                   	ret
+
+0000000000801156 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801156:	55                   	push   %rbp
+  801157:	48 89 e5             	mov    %rsp,%rbp
+  80115a:	48 83 ec 20          	sub    $0x20,%rsp
+  80115e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80115e <strnlen+0x8>
+  801165:	49 bb d2 6e 00 00 00 	movabs $0x6ed2,%r11
+  80116c:	00 00 00 
+  80116f:	4c 01 d8             	add    %r11,%rax
+  801172:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801176:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80117a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801181:	eb 0e                	jmp    801191 <strnlen+0x3b>
+		n++;
+  801183:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801187:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80118c:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801191:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801196:	74 0b                	je     8011a3 <strnlen+0x4d>
+  801198:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80119c:	0f b6 00             	movzbl (%rax),%eax
+  80119f:	84 c0                	test   %al,%al
+  8011a1:	75 e0                	jne    801183 <strnlen+0x2d>
+	return n;
+  8011a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8011a6:	c9                   	leave
+  8011a7:	c3                   	ret
+
+00000000008011a8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8011a8:	55                   	push   %rbp
+  8011a9:	48 89 e5             	mov    %rsp,%rbp
+  8011ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8011b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011b0 <strcpy+0x8>
+  8011b7:	49 bb 80 6e 00 00 00 	movabs $0x6e80,%r11
+  8011be:	00 00 00 
+  8011c1:	4c 01 d8             	add    %r11,%rax
+  8011c4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011c8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8011cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011d0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8011d4:	90                   	nop
+  8011d5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8011d9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8011dd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8011e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011e5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011e9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8011ed:	0f b6 12             	movzbl (%rdx),%edx
+  8011f0:	88 10                	mov    %dl,(%rax)
+  8011f2:	0f b6 00             	movzbl (%rax),%eax
+  8011f5:	84 c0                	test   %al,%al
+  8011f7:	75 dc                	jne    8011d5 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8011f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8011fd:	c9                   	leave
+  8011fe:	c3                   	ret
+
+00000000008011ff <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8011ff:	55                   	push   %rbp
+  801200:	48 89 e5             	mov    %rsp,%rbp
+  801203:	53                   	push   %rbx
+  801204:	48 83 ec 20          	sub    $0x20,%rsp
+  801208:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801208 <strcat+0x9>
+  80120f:	49 bb 28 6e 00 00 00 	movabs $0x6e28,%r11
+  801216:	00 00 00 
+  801219:	4c 01 db             	add    %r11,%rbx
+  80121c:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801220:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801224:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801228:	48 89 c7             	mov    %rax,%rdi
+  80122b:	48 b8 e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%rax
+  801232:	ff ff ff 
+  801235:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801239:	ff d0                	call   *%rax
+  80123b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  80123e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801241:	48 63 d0             	movslq %eax,%rdx
+  801244:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801248:	48 01 c2             	add    %rax,%rdx
+  80124b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80124f:	48 89 c6             	mov    %rax,%rsi
+  801252:	48 89 d7             	mov    %rdx,%rdi
+  801255:	48 b8 78 91 ff ff ff 	movabs $0xffffffffffff9178,%rax
+  80125c:	ff ff ff 
+  80125f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801263:	ff d0                	call   *%rax
+	return dst;
+  801265:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801269:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126d:	c9                   	leave
+  80126e:	c3                   	ret
+
+000000000080126f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80126f:	55                   	push   %rbp
+  801270:	48 89 e5             	mov    %rsp,%rbp
+  801273:	48 83 ec 28          	sub    $0x28,%rsp
+  801277:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801277 <strncpy+0x8>
+  80127e:	49 bb b9 6d 00 00 00 	movabs $0x6db9,%r11
+  801285:	00 00 00 
+  801288:	4c 01 d8             	add    %r11,%rax
+  80128b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80128f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801293:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801297:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80129b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80129f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8012a6:	00 
+  8012a7:	eb 2a                	jmp    8012d3 <strncpy+0x64>
+		*dst++ = *src;
+  8012a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ad:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8012b1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8012b5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012b9:	0f b6 12             	movzbl (%rdx),%edx
+  8012bc:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8012be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012c2:	0f b6 00             	movzbl (%rax),%eax
+  8012c5:	84 c0                	test   %al,%al
+  8012c7:	74 05                	je     8012ce <strncpy+0x5f>
+			src++;
+  8012c9:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8012ce:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012d7:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8012db:	72 cc                	jb     8012a9 <strncpy+0x3a>
+	}
+	return ret;
+  8012dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8012e1:	c9                   	leave
+  8012e2:	c3                   	ret
+
+00000000008012e3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8012e3:	55                   	push   %rbp
+  8012e4:	48 89 e5             	mov    %rsp,%rbp
+  8012e7:	48 83 ec 28          	sub    $0x28,%rsp
+  8012eb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012eb <strlcpy+0x8>
+  8012f2:	49 bb 45 6d 00 00 00 	movabs $0x6d45,%r11
+  8012f9:	00 00 00 
+  8012fc:	4c 01 d8             	add    %r11,%rax
+  8012ff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801303:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801307:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80130b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80130f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801313:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801318:	74 3d                	je     801357 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  80131a:	eb 1d                	jmp    801339 <strlcpy+0x56>
+			*dst++ = *src++;
+  80131c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801320:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801324:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801328:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80132c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801330:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801334:	0f b6 12             	movzbl (%rdx),%edx
+  801337:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801339:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80133e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801343:	74 0b                	je     801350 <strlcpy+0x6d>
+  801345:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801349:	0f b6 00             	movzbl (%rax),%eax
+  80134c:	84 c0                	test   %al,%al
+  80134e:	75 cc                	jne    80131c <strlcpy+0x39>
+		*dst = '\0';
+  801350:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801354:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801357:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80135b:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80135f:	c9                   	leave
+  801360:	c3                   	ret
+
+0000000000801361 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801361:	55                   	push   %rbp
+  801362:	48 89 e5             	mov    %rsp,%rbp
+  801365:	48 83 ec 10          	sub    $0x10,%rsp
+  801369:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801369 <strcmp+0x8>
+  801370:	49 bb c7 6c 00 00 00 	movabs $0x6cc7,%r11
+  801377:	00 00 00 
+  80137a:	4c 01 d8             	add    %r11,%rax
+  80137d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801381:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801385:	eb 0a                	jmp    801391 <strcmp+0x30>
+		p++, q++;
+  801387:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80138c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801391:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801395:	0f b6 00             	movzbl (%rax),%eax
+  801398:	84 c0                	test   %al,%al
+  80139a:	74 12                	je     8013ae <strcmp+0x4d>
+  80139c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013a0:	0f b6 10             	movzbl (%rax),%edx
+  8013a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013a7:	0f b6 00             	movzbl (%rax),%eax
+  8013aa:	38 c2                	cmp    %al,%dl
+  8013ac:	74 d9                	je     801387 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8013ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013b2:	0f b6 00             	movzbl (%rax),%eax
+  8013b5:	0f b6 d0             	movzbl %al,%edx
+  8013b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013bc:	0f b6 00             	movzbl (%rax),%eax
+  8013bf:	0f b6 c0             	movzbl %al,%eax
+  8013c2:	29 c2                	sub    %eax,%edx
+  8013c4:	89 d0                	mov    %edx,%eax
+}
+  8013c6:	c9                   	leave
+  8013c7:	c3                   	ret
+
+00000000008013c8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8013c8:	55                   	push   %rbp
+  8013c9:	48 89 e5             	mov    %rsp,%rbp
+  8013cc:	48 83 ec 18          	sub    $0x18,%rsp
+  8013d0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013d0 <strncmp+0x8>
+  8013d7:	49 bb 60 6c 00 00 00 	movabs $0x6c60,%r11
+  8013de:	00 00 00 
+  8013e1:	4c 01 d8             	add    %r11,%rax
+  8013e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8013e8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8013ec:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8013f0:	eb 0f                	jmp    801401 <strncmp+0x39>
+		n--, p++, q++;
+  8013f2:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8013f7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8013fc:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801401:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801406:	74 1d                	je     801425 <strncmp+0x5d>
+  801408:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80140c:	0f b6 00             	movzbl (%rax),%eax
+  80140f:	84 c0                	test   %al,%al
+  801411:	74 12                	je     801425 <strncmp+0x5d>
+  801413:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801417:	0f b6 10             	movzbl (%rax),%edx
+  80141a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80141e:	0f b6 00             	movzbl (%rax),%eax
+  801421:	38 c2                	cmp    %al,%dl
+  801423:	74 cd                	je     8013f2 <strncmp+0x2a>
+	if (n == 0)
+  801425:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80142a:	75 07                	jne    801433 <strncmp+0x6b>
+		return 0;
+  80142c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801431:	eb 16                	jmp    801449 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801433:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801437:	0f b6 00             	movzbl (%rax),%eax
+  80143a:	0f b6 d0             	movzbl %al,%edx
+  80143d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801441:	0f b6 00             	movzbl (%rax),%eax
+  801444:	0f b6 c0             	movzbl %al,%eax
+  801447:	29 c2                	sub    %eax,%edx
+}
+  801449:	89 d0                	mov    %edx,%eax
+  80144b:	c9                   	leave
+  80144c:	c3                   	ret
+
+000000000080144d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80144d:	55                   	push   %rbp
+  80144e:	48 89 e5             	mov    %rsp,%rbp
+  801451:	48 83 ec 10          	sub    $0x10,%rsp
+  801455:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801455 <strchr+0x8>
+  80145c:	49 bb db 6b 00 00 00 	movabs $0x6bdb,%r11
+  801463:	00 00 00 
+  801466:	4c 01 d8             	add    %r11,%rax
+  801469:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80146d:	89 f0                	mov    %esi,%eax
+  80146f:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801472:	eb 17                	jmp    80148b <strchr+0x3e>
+		if (*s == c)
+  801474:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801478:	0f b6 00             	movzbl (%rax),%eax
+  80147b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80147e:	75 06                	jne    801486 <strchr+0x39>
+			return (char *) s;
+  801480:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801484:	eb 15                	jmp    80149b <strchr+0x4e>
+	for (; *s; s++)
+  801486:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80148b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80148f:	0f b6 00             	movzbl (%rax),%eax
+  801492:	84 c0                	test   %al,%al
+  801494:	75 de                	jne    801474 <strchr+0x27>
+	return 0;
+  801496:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80149b:	c9                   	leave
+  80149c:	c3                   	ret
+
+000000000080149d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80149d:	55                   	push   %rbp
+  80149e:	48 89 e5             	mov    %rsp,%rbp
+  8014a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8014a5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014a5 <strfind+0x8>
+  8014ac:	49 bb 8b 6b 00 00 00 	movabs $0x6b8b,%r11
+  8014b3:	00 00 00 
+  8014b6:	4c 01 d8             	add    %r11,%rax
+  8014b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8014bd:	89 f0                	mov    %esi,%eax
+  8014bf:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8014c2:	eb 11                	jmp    8014d5 <strfind+0x38>
+		if (*s == c)
+  8014c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014c8:	0f b6 00             	movzbl (%rax),%eax
+  8014cb:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8014ce:	74 12                	je     8014e2 <strfind+0x45>
+	for (; *s; s++)
+  8014d0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014d9:	0f b6 00             	movzbl (%rax),%eax
+  8014dc:	84 c0                	test   %al,%al
+  8014de:	75 e4                	jne    8014c4 <strfind+0x27>
+  8014e0:	eb 01                	jmp    8014e3 <strfind+0x46>
+			break;
+  8014e2:	90                   	nop
+	return (char *) s;
+  8014e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8014e7:	c9                   	leave
+  8014e8:	c3                   	ret
+
+00000000008014e9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8014e9:	55                   	push   %rbp
+  8014ea:	48 89 e5             	mov    %rsp,%rbp
+  8014ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8014f1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014f1 <memset+0x8>
+  8014f8:	49 bb 3f 6b 00 00 00 	movabs $0x6b3f,%r11
+  8014ff:	00 00 00 
+  801502:	4c 01 d8             	add    %r11,%rax
+  801505:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801509:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80150c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801510:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801515:	75 06                	jne    80151d <memset+0x34>
+		return v;
+  801517:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80151b:	eb 69                	jmp    801586 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  80151d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801521:	83 e0 03             	and    $0x3,%eax
+  801524:	48 85 c0             	test   %rax,%rax
+  801527:	75 48                	jne    801571 <memset+0x88>
+  801529:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80152d:	83 e0 03             	and    $0x3,%eax
+  801530:	48 85 c0             	test   %rax,%rax
+  801533:	75 3c                	jne    801571 <memset+0x88>
+		c &= 0xFF;
+  801535:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  80153c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80153f:	c1 e0 18             	shl    $0x18,%eax
+  801542:	89 c2                	mov    %eax,%edx
+  801544:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801547:	c1 e0 10             	shl    $0x10,%eax
+  80154a:	09 c2                	or     %eax,%edx
+  80154c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80154f:	c1 e0 08             	shl    $0x8,%eax
+  801552:	09 d0                	or     %edx,%eax
+  801554:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801557:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80155b:	48 c1 e8 02          	shr    $0x2,%rax
+  80155f:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801562:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801566:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801569:	48 89 d7             	mov    %rdx,%rdi
+  80156c:	fc                   	cld
+  80156d:	f3 ab                	rep stos %eax,%es:(%rdi)
+  80156f:	eb 11                	jmp    801582 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801571:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801575:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801578:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80157c:	48 89 d7             	mov    %rdx,%rdi
+  80157f:	fc                   	cld
+  801580:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801582:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801586:	c9                   	leave
+  801587:	c3                   	ret
+
+0000000000801588 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801588:	55                   	push   %rbp
+  801589:	48 89 e5             	mov    %rsp,%rbp
+  80158c:	48 83 ec 28          	sub    $0x28,%rsp
+  801590:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801590 <memmove+0x8>
+  801597:	49 bb a0 6a 00 00 00 	movabs $0x6aa0,%r11
+  80159e:	00 00 00 
+  8015a1:	4c 01 d8             	add    %r11,%rax
+  8015a4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015a8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8015ac:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8015b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8015b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015bc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8015c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c4:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8015c8:	0f 83 88 00 00 00    	jae    801656 <memmove+0xce>
+  8015ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015d6:	48 01 d0             	add    %rdx,%rax
+  8015d9:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8015dd:	73 77                	jae    801656 <memmove+0xce>
+		s += n;
+  8015df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015e3:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8015e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015eb:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8015ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f3:	83 e0 03             	and    $0x3,%eax
+  8015f6:	48 85 c0             	test   %rax,%rax
+  8015f9:	75 3b                	jne    801636 <memmove+0xae>
+  8015fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ff:	83 e0 03             	and    $0x3,%eax
+  801602:	48 85 c0             	test   %rax,%rax
+  801605:	75 2f                	jne    801636 <memmove+0xae>
+  801607:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80160b:	83 e0 03             	and    $0x3,%eax
+  80160e:	48 85 c0             	test   %rax,%rax
+  801611:	75 23                	jne    801636 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801613:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801617:	48 83 e8 04          	sub    $0x4,%rax
+  80161b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80161f:	48 83 ea 04          	sub    $0x4,%rdx
+  801623:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801627:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80162b:	48 89 c7             	mov    %rax,%rdi
+  80162e:	48 89 d6             	mov    %rdx,%rsi
+  801631:	fd                   	std
+  801632:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801634:	eb 1d                	jmp    801653 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801636:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80163a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80163e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801642:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801646:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80164a:	48 89 d7             	mov    %rdx,%rdi
+  80164d:	48 89 c1             	mov    %rax,%rcx
+  801650:	fd                   	std
+  801651:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801653:	fc                   	cld
+  801654:	eb 57                	jmp    8016ad <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801656:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80165a:	83 e0 03             	and    $0x3,%eax
+  80165d:	48 85 c0             	test   %rax,%rax
+  801660:	75 36                	jne    801698 <memmove+0x110>
+  801662:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801666:	83 e0 03             	and    $0x3,%eax
+  801669:	48 85 c0             	test   %rax,%rax
+  80166c:	75 2a                	jne    801698 <memmove+0x110>
+  80166e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801672:	83 e0 03             	and    $0x3,%eax
+  801675:	48 85 c0             	test   %rax,%rax
+  801678:	75 1e                	jne    801698 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80167a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80167e:	48 c1 e8 02          	shr    $0x2,%rax
+  801682:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801685:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801689:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80168d:	48 89 c7             	mov    %rax,%rdi
+  801690:	48 89 d6             	mov    %rdx,%rsi
+  801693:	fc                   	cld
+  801694:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801696:	eb 15                	jmp    8016ad <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801698:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80169c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016a0:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8016a4:	48 89 c7             	mov    %rax,%rdi
+  8016a7:	48 89 d6             	mov    %rdx,%rsi
+  8016aa:	fc                   	cld
+  8016ab:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  8016ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8016b1:	c9                   	leave
+  8016b2:	c3                   	ret
+
+00000000008016b3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8016b3:	55                   	push   %rbp
+  8016b4:	48 89 e5             	mov    %rsp,%rbp
+  8016b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8016bb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016bb <memcpy+0x8>
+  8016c2:	49 bb 75 69 00 00 00 	movabs $0x6975,%r11
+  8016c9:	00 00 00 
+  8016cc:	4c 01 d8             	add    %r11,%rax
+  8016cf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016d3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8016d7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8016db:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016df:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8016e3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016e7:	48 89 cf             	mov    %rcx,%rdi
+  8016ea:	48 b9 58 95 ff ff ff 	movabs $0xffffffffffff9558,%rcx
+  8016f1:	ff ff ff 
+  8016f4:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8016f8:	ff d0                	call   *%rax
+}
+  8016fa:	c9                   	leave
+  8016fb:	c3                   	ret
+
+00000000008016fc <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8016fc:	55                   	push   %rbp
+  8016fd:	48 89 e5             	mov    %rsp,%rbp
+  801700:	48 83 ec 28          	sub    $0x28,%rsp
+  801704:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801704 <memcmp+0x8>
+  80170b:	49 bb 2c 69 00 00 00 	movabs $0x692c,%r11
+  801712:	00 00 00 
+  801715:	4c 01 d8             	add    %r11,%rax
+  801718:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80171c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801720:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801724:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801728:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  80172c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801730:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801734:	eb 34                	jmp    80176a <memcmp+0x6e>
+		if (*s1 != *s2)
+  801736:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80173a:	0f b6 10             	movzbl (%rax),%edx
+  80173d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801741:	0f b6 00             	movzbl (%rax),%eax
+  801744:	38 c2                	cmp    %al,%dl
+  801746:	74 18                	je     801760 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801748:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80174c:	0f b6 00             	movzbl (%rax),%eax
+  80174f:	0f b6 d0             	movzbl %al,%edx
+  801752:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801756:	0f b6 00             	movzbl (%rax),%eax
+  801759:	0f b6 c0             	movzbl %al,%eax
+  80175c:	29 c2                	sub    %eax,%edx
+  80175e:	eb 20                	jmp    801780 <memcmp+0x84>
+		s1++, s2++;
+  801760:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801765:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  80176a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80176e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801772:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801776:	48 85 c0             	test   %rax,%rax
+  801779:	75 bb                	jne    801736 <memcmp+0x3a>
+	}
+
+	return 0;
+  80177b:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801780:	89 d0                	mov    %edx,%eax
+  801782:	c9                   	leave
+  801783:	c3                   	ret
+
+0000000000801784 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801784:	55                   	push   %rbp
+  801785:	48 89 e5             	mov    %rsp,%rbp
+  801788:	48 83 ec 28          	sub    $0x28,%rsp
+  80178c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80178c <memfind+0x8>
+  801793:	49 bb a4 68 00 00 00 	movabs $0x68a4,%r11
+  80179a:	00 00 00 
+  80179d:	4c 01 d8             	add    %r11,%rax
+  8017a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017a4:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8017a7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  8017ab:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017b3:	48 01 d0             	add    %rdx,%rax
+  8017b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8017ba:	eb 13                	jmp    8017cf <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8017bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c0:	0f b6 00             	movzbl (%rax),%eax
+  8017c3:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8017c6:	38 d0                	cmp    %dl,%al
+  8017c8:	74 11                	je     8017db <memfind+0x57>
+	for (; s < ends; s++)
+  8017ca:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8017cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017d3:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8017d7:	72 e3                	jb     8017bc <memfind+0x38>
+  8017d9:	eb 01                	jmp    8017dc <memfind+0x58>
+			break;
+  8017db:	90                   	nop
+	return (void *) s;
+  8017dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8017e0:	c9                   	leave
+  8017e1:	c3                   	ret
+
+00000000008017e2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8017e2:	55                   	push   %rbp
+  8017e3:	48 89 e5             	mov    %rsp,%rbp
+  8017e6:	48 83 ec 38          	sub    $0x38,%rsp
+  8017ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017ea <strtol+0x8>
+  8017f1:	49 bb 46 68 00 00 00 	movabs $0x6846,%r11
+  8017f8:	00 00 00 
+  8017fb:	4c 01 d8             	add    %r11,%rax
+  8017fe:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801802:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801806:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801809:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801810:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801817:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801818:	eb 05                	jmp    80181f <strtol+0x3d>
+		s++;
+  80181a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  80181f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801823:	0f b6 00             	movzbl (%rax),%eax
+  801826:	3c 20                	cmp    $0x20,%al
+  801828:	74 f0                	je     80181a <strtol+0x38>
+  80182a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80182e:	0f b6 00             	movzbl (%rax),%eax
+  801831:	3c 09                	cmp    $0x9,%al
+  801833:	74 e5                	je     80181a <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801835:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801839:	0f b6 00             	movzbl (%rax),%eax
+  80183c:	3c 2b                	cmp    $0x2b,%al
+  80183e:	75 07                	jne    801847 <strtol+0x65>
+		s++;
+  801840:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801845:	eb 17                	jmp    80185e <strtol+0x7c>
+	else if (*s == '-')
+  801847:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80184b:	0f b6 00             	movzbl (%rax),%eax
+  80184e:	3c 2d                	cmp    $0x2d,%al
+  801850:	75 0c                	jne    80185e <strtol+0x7c>
+		s++, neg = 1;
+  801852:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801857:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80185e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801862:	74 06                	je     80186a <strtol+0x88>
+  801864:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801868:	75 28                	jne    801892 <strtol+0xb0>
+  80186a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80186e:	0f b6 00             	movzbl (%rax),%eax
+  801871:	3c 30                	cmp    $0x30,%al
+  801873:	75 1d                	jne    801892 <strtol+0xb0>
+  801875:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801879:	48 83 c0 01          	add    $0x1,%rax
+  80187d:	0f b6 00             	movzbl (%rax),%eax
+  801880:	3c 78                	cmp    $0x78,%al
+  801882:	75 0e                	jne    801892 <strtol+0xb0>
+		s += 2, base = 16;
+  801884:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801889:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801890:	eb 2c                	jmp    8018be <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801892:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801896:	75 19                	jne    8018b1 <strtol+0xcf>
+  801898:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80189c:	0f b6 00             	movzbl (%rax),%eax
+  80189f:	3c 30                	cmp    $0x30,%al
+  8018a1:	75 0e                	jne    8018b1 <strtol+0xcf>
+		s++, base = 8;
+  8018a3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8018a8:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8018af:	eb 0d                	jmp    8018be <strtol+0xdc>
+	else if (base == 0)
+  8018b1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8018b5:	75 07                	jne    8018be <strtol+0xdc>
+		base = 10;
+  8018b7:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8018be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018c2:	0f b6 00             	movzbl (%rax),%eax
+  8018c5:	3c 2f                	cmp    $0x2f,%al
+  8018c7:	7e 1d                	jle    8018e6 <strtol+0x104>
+  8018c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018cd:	0f b6 00             	movzbl (%rax),%eax
+  8018d0:	3c 39                	cmp    $0x39,%al
+  8018d2:	7f 12                	jg     8018e6 <strtol+0x104>
+			dig = *s - '0';
+  8018d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d8:	0f b6 00             	movzbl (%rax),%eax
+  8018db:	0f be c0             	movsbl %al,%eax
+  8018de:	83 e8 30             	sub    $0x30,%eax
+  8018e1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018e4:	eb 4e                	jmp    801934 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  8018e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ea:	0f b6 00             	movzbl (%rax),%eax
+  8018ed:	3c 60                	cmp    $0x60,%al
+  8018ef:	7e 1d                	jle    80190e <strtol+0x12c>
+  8018f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018f5:	0f b6 00             	movzbl (%rax),%eax
+  8018f8:	3c 7a                	cmp    $0x7a,%al
+  8018fa:	7f 12                	jg     80190e <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  8018fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801900:	0f b6 00             	movzbl (%rax),%eax
+  801903:	0f be c0             	movsbl %al,%eax
+  801906:	83 e8 57             	sub    $0x57,%eax
+  801909:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80190c:	eb 26                	jmp    801934 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  80190e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801912:	0f b6 00             	movzbl (%rax),%eax
+  801915:	3c 40                	cmp    $0x40,%al
+  801917:	7e 47                	jle    801960 <strtol+0x17e>
+  801919:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80191d:	0f b6 00             	movzbl (%rax),%eax
+  801920:	3c 5a                	cmp    $0x5a,%al
+  801922:	7f 3c                	jg     801960 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801924:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801928:	0f b6 00             	movzbl (%rax),%eax
+  80192b:	0f be c0             	movsbl %al,%eax
+  80192e:	83 e8 37             	sub    $0x37,%eax
+  801931:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801934:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801937:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80193a:	7d 23                	jge    80195f <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  80193c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801941:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801944:	48 98                	cltq
+  801946:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80194b:	48 89 c2             	mov    %rax,%rdx
+  80194e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801951:	48 98                	cltq
+  801953:	48 01 d0             	add    %rdx,%rax
+  801956:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  80195a:	e9 5f ff ff ff       	jmp    8018be <strtol+0xdc>
+			break;
+  80195f:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801960:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801965:	74 0b                	je     801972 <strtol+0x190>
+		*endptr = (char *) s;
+  801967:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80196b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80196f:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801972:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801976:	74 09                	je     801981 <strtol+0x19f>
+  801978:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80197c:	48 f7 d8             	neg    %rax
+  80197f:	eb 04                	jmp    801985 <strtol+0x1a3>
+  801981:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801985:	c9                   	leave
+  801986:	c3                   	ret
+
+0000000000801987 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801987:	55                   	push   %rbp
+  801988:	48 89 e5             	mov    %rsp,%rbp
+  80198b:	53                   	push   %rbx
+  80198c:	48 83 ec 30          	sub    $0x30,%rsp
+  801990:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801990 <strstr+0x9>
+  801997:	49 bb a0 66 00 00 00 	movabs $0x66a0,%r11
+  80199e:	00 00 00 
+  8019a1:	4c 01 db             	add    %r11,%rbx
+  8019a4:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  8019a8:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  8019ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019b0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019b4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8019b8:	0f b6 00             	movzbl (%rax),%eax
+  8019bb:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  8019be:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  8019c2:	75 06                	jne    8019ca <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  8019c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019c8:	eb 73                	jmp    801a3d <strstr+0xb6>
+
+	len = strlen(str);
+  8019ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019ce:	48 89 c7             	mov    %rax,%rdi
+  8019d1:	48 b8 e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%rax
+  8019d8:	ff ff ff 
+  8019db:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8019df:	ff d0                	call   *%rax
+  8019e1:	48 98                	cltq
+  8019e3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  8019e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019eb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019ef:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8019f3:	0f b6 00             	movzbl (%rax),%eax
+  8019f6:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  8019f9:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  8019fd:	75 07                	jne    801a06 <strstr+0x7f>
+				return (char *) 0;
+  8019ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a04:	eb 37                	jmp    801a3d <strstr+0xb6>
+		} while (sc != c);
+  801a06:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801a0a:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801a0d:	75 d8                	jne    8019e7 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801a0f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a13:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a1b:	48 89 ce             	mov    %rcx,%rsi
+  801a1e:	48 89 c7             	mov    %rax,%rdi
+  801a21:	48 b8 98 93 ff ff ff 	movabs $0xffffffffffff9398,%rax
+  801a28:	ff ff ff 
+  801a2b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801a2f:	ff d0                	call   *%rax
+  801a31:	85 c0                	test   %eax,%eax
+  801a33:	75 b2                	jne    8019e7 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801a35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a39:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801a3d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a41:	c9                   	leave
+  801a42:	c3                   	ret
+
+0000000000801a43 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801a43:	55                   	push   %rbp
+  801a44:	48 89 e5             	mov    %rsp,%rbp
+  801a47:	41 57                	push   %r15
+  801a49:	53                   	push   %rbx
+  801a4a:	48 83 ec 40          	sub    $0x40,%rsp
+  801a4e:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801a4e <syscall+0xb>
+  801a55:	49 bb e2 65 00 00 00 	movabs $0x65e2,%r11
+  801a5c:	00 00 00 
+  801a5f:	4d 01 da             	add    %r11,%r10
+  801a62:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801a65:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801a68:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801a6c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801a70:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801a74:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801a78:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a7b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801a7f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a83:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801a87:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801a8b:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801a8f:	4c 89 c3             	mov    %r8,%rbx
+  801a92:	cd 30                	int    $0x30
+  801a94:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801a98:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801a9c:	74 52                	je     801af0 <syscall+0xad>
+  801a9e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801aa3:	7e 4b                	jle    801af0 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801aa5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801aa9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801aac:	49 89 d0             	mov    %rdx,%r8
+  801aaf:	89 c1                	mov    %eax,%ecx
+  801ab1:	48 b8 50 e3 ff ff ff 	movabs $0xffffffffffffe350,%rax
+  801ab8:	ff ff ff 
+  801abb:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801abf:	48 89 c2             	mov    %rax,%rdx
+  801ac2:	be 23 00 00 00       	mov    $0x23,%esi
+  801ac7:	48 b8 6d e3 ff ff ff 	movabs $0xffffffffffffe36d,%rax
+  801ace:	ff ff ff 
+  801ad1:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801ad5:	48 89 c7             	mov    %rax,%rdi
+  801ad8:	4d 89 d7             	mov    %r10,%r15
+  801adb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae0:	49 b9 e6 d4 ff ff ff 	movabs $0xffffffffffffd4e6,%r9
+  801ae7:	ff ff ff 
+  801aea:	4d 01 d1             	add    %r10,%r9
+  801aed:	41 ff d1             	call   *%r9
+
+	return ret;
+  801af0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801af4:	48 83 c4 40          	add    $0x40,%rsp
+  801af8:	5b                   	pop    %rbx
+  801af9:	41 5f                	pop    %r15
+  801afb:	5d                   	pop    %rbp
+  801afc:	c3                   	ret
+
+0000000000801afd <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801afd:	55                   	push   %rbp
+  801afe:	48 89 e5             	mov    %rsp,%rbp
+  801b01:	41 57                	push   %r15
+  801b03:	41 56                	push   %r14
+  801b05:	41 55                	push   %r13
+  801b07:	41 54                	push   %r12
+  801b09:	53                   	push   %rbx
+  801b0a:	48 83 ec 48          	sub    $0x48,%rsp
+  801b0e:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801b0e <syscall_words+0x11>
+  801b15:	49 bb 22 65 00 00 00 	movabs $0x6522,%r11
+  801b1c:	00 00 00 
+  801b1f:	4d 01 de             	add    %r11,%r14
+  801b22:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801b25:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801b28:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801b2c:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801b30:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801b34:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801b38:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b3d:	74 09                	je     801b48 <syscall_words+0x4b>
+  801b3f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b43:	48 8b 00             	mov    (%rax),%rax
+  801b46:	eb 05                	jmp    801b4d <syscall_words+0x50>
+  801b48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4d:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801b50:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b55:	74 0a                	je     801b61 <syscall_words+0x64>
+  801b57:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b5b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801b5f:	eb 05                	jmp    801b66 <syscall_words+0x69>
+  801b61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b66:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801b69:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b6e:	74 0a                	je     801b7a <syscall_words+0x7d>
+  801b70:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b74:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b78:	eb 05                	jmp    801b7f <syscall_words+0x82>
+  801b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7f:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801b82:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b87:	74 0a                	je     801b93 <syscall_words+0x96>
+  801b89:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b8d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b91:	eb 05                	jmp    801b98 <syscall_words+0x9b>
+  801b93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b98:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801b9b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ba0:	74 0a                	je     801bac <syscall_words+0xaf>
+  801ba2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ba6:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801baa:	eb 05                	jmp    801bb1 <syscall_words+0xb4>
+  801bac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb1:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801bb4:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801bb9:	74 0a                	je     801bc5 <syscall_words+0xc8>
+  801bbb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801bbf:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801bc3:	eb 05                	jmp    801bca <syscall_words+0xcd>
+  801bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bca:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801bcd:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801bd0:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801bd4:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801bd8:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801bdc:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801be0:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801be4:	cd 30                	int    $0x30
+  801be6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801bea:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801bef:	74 50                	je     801c41 <syscall_words+0x144>
+		words[0] = r8;
+  801bf1:	4c 89 c2             	mov    %r8,%rdx
+  801bf4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801bf8:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801bfb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801bff:	48 83 c0 08          	add    $0x8,%rax
+  801c03:	4c 89 ca             	mov    %r9,%rdx
+  801c06:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801c09:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c0d:	48 83 c0 10          	add    $0x10,%rax
+  801c11:	4c 89 d2             	mov    %r10,%rdx
+  801c14:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801c17:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c1b:	48 83 c0 18          	add    $0x18,%rax
+  801c1f:	4c 89 da             	mov    %r11,%rdx
+  801c22:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801c25:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c29:	48 83 c0 20          	add    $0x20,%rax
+  801c2d:	4c 89 e2             	mov    %r12,%rdx
+  801c30:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801c33:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c37:	48 83 c0 28          	add    $0x28,%rax
+  801c3b:	4c 89 ea             	mov    %r13,%rdx
+  801c3e:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801c41:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801c45:	74 52                	je     801c99 <syscall_words+0x19c>
+  801c47:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801c4c:	7e 4b                	jle    801c99 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c4e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c52:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801c55:	49 89 d0             	mov    %rdx,%r8
+  801c58:	89 c1                	mov    %eax,%ecx
+  801c5a:	48 b8 50 e3 ff ff ff 	movabs $0xffffffffffffe350,%rax
+  801c61:	ff ff ff 
+  801c64:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801c68:	48 89 c2             	mov    %rax,%rdx
+  801c6b:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801c70:	48 b8 6d e3 ff ff ff 	movabs $0xffffffffffffe36d,%rax
+  801c77:	ff ff ff 
+  801c7a:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801c7e:	48 89 c7             	mov    %rax,%rdi
+  801c81:	4d 89 f7             	mov    %r14,%r15
+  801c84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c89:	49 b9 e6 d4 ff ff ff 	movabs $0xffffffffffffd4e6,%r9
+  801c90:	ff ff ff 
+  801c93:	4d 01 f1             	add    %r14,%r9
+  801c96:	41 ff d1             	call   *%r9
+
+	return ret;
+  801c99:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801c9d:	48 83 c4 48          	add    $0x48,%rsp
+  801ca1:	5b                   	pop    %rbx
+  801ca2:	41 5c                	pop    %r12
+  801ca4:	41 5d                	pop    %r13
+  801ca6:	41 5e                	pop    %r14
+  801ca8:	41 5f                	pop    %r15
+  801caa:	5d                   	pop    %rbp
+  801cab:	c3                   	ret
+
+0000000000801cac <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801cac:	55                   	push   %rbp
+  801cad:	48 89 e5             	mov    %rsp,%rbp
+  801cb0:	48 83 ec 10          	sub    $0x10,%rsp
+  801cb4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801cb4 <sys_cputs+0x8>
+  801cbb:	49 bb 7c 63 00 00 00 	movabs $0x637c,%r11
+  801cc2:	00 00 00 
+  801cc5:	4c 01 d8             	add    %r11,%rax
+  801cc8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ccc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801cd0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801cd4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801cd8:	48 83 ec 08          	sub    $0x8,%rsp
+  801cdc:	6a 00                	push   $0x0
+  801cde:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ce4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cea:	be 00 00 00 00       	mov    $0x0,%esi
+  801cef:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cf4:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  801cfb:	ff ff ff 
+  801cfe:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801d02:	ff d0                	call   *%rax
+  801d04:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d08:	90                   	nop
+  801d09:	c9                   	leave
+  801d0a:	c3                   	ret
+
+0000000000801d0b <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801d0b:	55                   	push   %rbp
+  801d0c:	48 89 e5             	mov    %rsp,%rbp
+  801d0f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d0f <sys_cgetc+0x4>
+  801d16:	49 bb 21 63 00 00 00 	movabs $0x6321,%r11
+  801d1d:	00 00 00 
+  801d20:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801d23:	48 83 ec 08          	sub    $0x8,%rsp
+  801d27:	6a 00                	push   $0x0
+  801d29:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d2f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3f:	be 00 00 00 00       	mov    $0x0,%esi
+  801d44:	bf 01 00 00 00       	mov    $0x1,%edi
+  801d49:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  801d50:	ff ff ff 
+  801d53:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801d57:	ff d0                	call   *%rax
+  801d59:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d5d:	c9                   	leave
+  801d5e:	c3                   	ret
+
+0000000000801d5f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801d5f:	55                   	push   %rbp
+  801d60:	48 89 e5             	mov    %rsp,%rbp
+  801d63:	48 83 ec 10          	sub    $0x10,%rsp
+  801d67:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d67 <sys_env_destroy+0x8>
+  801d6e:	49 bb c9 62 00 00 00 	movabs $0x62c9,%r11
+  801d75:	00 00 00 
+  801d78:	4c 01 d8             	add    %r11,%rax
+  801d7b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801d7e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801d81:	48 63 d2             	movslq %edx,%rdx
+  801d84:	48 83 ec 08          	sub    $0x8,%rsp
+  801d88:	6a 00                	push   $0x0
+  801d8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d9b:	be 01 00 00 00       	mov    $0x1,%esi
+  801da0:	bf 03 00 00 00       	mov    $0x3,%edi
+  801da5:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  801dac:	ff ff ff 
+  801daf:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801db3:	ff d0                	call   *%rax
+  801db5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801db9:	c9                   	leave
+  801dba:	c3                   	ret
+
+0000000000801dbb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801dbb:	55                   	push   %rbp
+  801dbc:	48 89 e5             	mov    %rsp,%rbp
+  801dbf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801dbf <sys_getenvid+0x4>
+  801dc6:	49 bb 71 62 00 00 00 	movabs $0x6271,%r11
+  801dcd:	00 00 00 
+  801dd0:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801dd3:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd7:	6a 00                	push   $0x0
+  801dd9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ddf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801de5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801def:	be 00 00 00 00       	mov    $0x0,%esi
+  801df4:	bf 02 00 00 00       	mov    $0x2,%edi
+  801df9:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  801e00:	ff ff ff 
+  801e03:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e07:	ff d0                	call   *%rax
+  801e09:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e0d:	c9                   	leave
+  801e0e:	c3                   	ret
+
+0000000000801e0f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801e0f:	55                   	push   %rbp
+  801e10:	48 89 e5             	mov    %rsp,%rbp
+  801e13:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e13 <sys_yield+0x4>
+  801e1a:	49 bb 1d 62 00 00 00 	movabs $0x621d,%r11
+  801e21:	00 00 00 
+  801e24:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801e27:	48 83 ec 08          	sub    $0x8,%rsp
+  801e2b:	6a 00                	push   $0x0
+  801e2d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e33:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e43:	be 00 00 00 00       	mov    $0x0,%esi
+  801e48:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801e4d:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  801e54:	ff ff ff 
+  801e57:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e5b:	ff d0                	call   *%rax
+  801e5d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e61:	90                   	nop
+  801e62:	c9                   	leave
+  801e63:	c3                   	ret
+
+0000000000801e64 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801e64:	55                   	push   %rbp
+  801e65:	48 89 e5             	mov    %rsp,%rbp
+  801e68:	48 83 ec 10          	sub    $0x10,%rsp
+  801e6c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e6c <sys_page_alloc+0x8>
+  801e73:	49 bb c4 61 00 00 00 	movabs $0x61c4,%r11
+  801e7a:	00 00 00 
+  801e7d:	4c 01 d8             	add    %r11,%rax
+  801e80:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e83:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e87:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801e8a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801e8d:	48 63 f2             	movslq %edx,%rsi
+  801e90:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e94:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801e97:	48 63 d2             	movslq %edx,%rdx
+  801e9a:	48 83 ec 08          	sub    $0x8,%rsp
+  801e9e:	6a 00                	push   $0x0
+  801ea0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ea6:	49 89 f0             	mov    %rsi,%r8
+  801ea9:	be 01 00 00 00       	mov    $0x1,%esi
+  801eae:	bf 04 00 00 00       	mov    $0x4,%edi
+  801eb3:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  801eba:	ff ff ff 
+  801ebd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ec1:	ff d0                	call   *%rax
+  801ec3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ec7:	c9                   	leave
+  801ec8:	c3                   	ret
+
+0000000000801ec9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801ec9:	55                   	push   %rbp
+  801eca:	48 89 e5             	mov    %rsp,%rbp
+  801ecd:	48 83 ec 20          	sub    $0x20,%rsp
+  801ed1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ed1 <sys_page_map+0x8>
+  801ed8:	49 bb 5f 61 00 00 00 	movabs $0x615f,%r11
+  801edf:	00 00 00 
+  801ee2:	4c 01 d8             	add    %r11,%rax
+  801ee5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ee8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801eec:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801eef:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801ef3:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801ef7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801efa:	48 63 f2             	movslq %edx,%rsi
+  801efd:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  801f01:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801f04:	48 63 fa             	movslq %edx,%rdi
+  801f07:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f0b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f0e:	48 63 d2             	movslq %edx,%rdx
+  801f11:	48 83 ec 08          	sub    $0x8,%rsp
+  801f15:	56                   	push   %rsi
+  801f16:	4d 89 c1             	mov    %r8,%r9
+  801f19:	49 89 f8             	mov    %rdi,%r8
+  801f1c:	be 01 00 00 00       	mov    $0x1,%esi
+  801f21:	bf 05 00 00 00       	mov    $0x5,%edi
+  801f26:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  801f2d:	ff ff ff 
+  801f30:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f34:	ff d0                	call   *%rax
+  801f36:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f3a:	c9                   	leave
+  801f3b:	c3                   	ret
+
+0000000000801f3c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801f3c:	55                   	push   %rbp
+  801f3d:	48 89 e5             	mov    %rsp,%rbp
+  801f40:	48 83 ec 10          	sub    $0x10,%rsp
+  801f44:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f44 <sys_page_unmap+0x8>
+  801f4b:	49 bb ec 60 00 00 00 	movabs $0x60ec,%r11
+  801f52:	00 00 00 
+  801f55:	4c 01 d8             	add    %r11,%rax
+  801f58:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f5b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  801f5f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f63:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f66:	48 63 d2             	movslq %edx,%rdx
+  801f69:	48 83 ec 08          	sub    $0x8,%rsp
+  801f6d:	6a 00                	push   $0x0
+  801f6f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f7b:	be 01 00 00 00       	mov    $0x1,%esi
+  801f80:	bf 06 00 00 00       	mov    $0x6,%edi
+  801f85:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  801f8c:	ff ff ff 
+  801f8f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f93:	ff d0                	call   *%rax
+  801f95:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f99:	c9                   	leave
+  801f9a:	c3                   	ret
+
+0000000000801f9b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801f9b:	55                   	push   %rbp
+  801f9c:	48 89 e5             	mov    %rsp,%rbp
+  801f9f:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fa3 <sys_env_set_status+0x8>
+  801faa:	49 bb 8d 60 00 00 00 	movabs $0x608d,%r11
+  801fb1:	00 00 00 
+  801fb4:	4c 01 d8             	add    %r11,%rax
+  801fb7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801fba:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801fbd:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801fc0:	48 63 ca             	movslq %edx,%rcx
+  801fc3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801fc6:	48 63 d2             	movslq %edx,%rdx
+  801fc9:	48 83 ec 08          	sub    $0x8,%rsp
+  801fcd:	6a 00                	push   $0x0
+  801fcf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fd5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fdb:	be 01 00 00 00       	mov    $0x1,%esi
+  801fe0:	bf 08 00 00 00       	mov    $0x8,%edi
+  801fe5:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  801fec:	ff ff ff 
+  801fef:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ff3:	ff d0                	call   *%rax
+  801ff5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ff9:	c9                   	leave
+  801ffa:	c3                   	ret
+
+0000000000801ffb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801ffb:	55                   	push   %rbp
+  801ffc:	48 89 e5             	mov    %rsp,%rbp
+  801fff:	48 83 ec 10          	sub    $0x10,%rsp
+  802003:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802003 <sys_env_set_trapframe+0x8>
+  80200a:	49 bb 2d 60 00 00 00 	movabs $0x602d,%r11
+  802011:	00 00 00 
+  802014:	4c 01 d8             	add    %r11,%rax
+  802017:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80201a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  80201e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802022:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802025:	48 63 d2             	movslq %edx,%rdx
+  802028:	48 83 ec 08          	sub    $0x8,%rsp
+  80202c:	6a 00                	push   $0x0
+  80202e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802034:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80203a:	be 01 00 00 00       	mov    $0x1,%esi
+  80203f:	bf 09 00 00 00       	mov    $0x9,%edi
+  802044:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  80204b:	ff ff ff 
+  80204e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802052:	ff d0                	call   *%rax
+  802054:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802058:	c9                   	leave
+  802059:	c3                   	ret
+
+000000000080205a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80205a:	55                   	push   %rbp
+  80205b:	48 89 e5             	mov    %rsp,%rbp
+  80205e:	48 83 ec 10          	sub    $0x10,%rsp
+  802062:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802062 <sys_env_set_pgfault_upcall+0x8>
+  802069:	49 bb ce 5f 00 00 00 	movabs $0x5fce,%r11
+  802070:	00 00 00 
+  802073:	4c 01 d8             	add    %r11,%rax
+  802076:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802079:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80207d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802081:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802084:	48 63 d2             	movslq %edx,%rdx
+  802087:	48 83 ec 08          	sub    $0x8,%rsp
+  80208b:	6a 00                	push   $0x0
+  80208d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802093:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802099:	be 01 00 00 00       	mov    $0x1,%esi
+  80209e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8020a3:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  8020aa:	ff ff ff 
+  8020ad:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020b1:	ff d0                	call   *%rax
+  8020b3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020b7:	c9                   	leave
+  8020b8:	c3                   	ret
+
+00000000008020b9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8020b9:	55                   	push   %rbp
+  8020ba:	48 89 e5             	mov    %rsp,%rbp
+  8020bd:	48 83 ec 20          	sub    $0x20,%rsp
+  8020c1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020c1 <sys_ipc_try_send+0x8>
+  8020c8:	49 bb 6f 5f 00 00 00 	movabs $0x5f6f,%r11
+  8020cf:	00 00 00 
+  8020d2:	4c 01 d8             	add    %r11,%rax
+  8020d5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020d8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020dc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8020e0:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8020e3:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020e6:	48 63 fa             	movslq %edx,%rdi
+  8020e9:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8020ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020f0:	48 63 d2             	movslq %edx,%rdx
+  8020f3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8020fb:	6a 00                	push   $0x0
+  8020fd:	49 89 f9             	mov    %rdi,%r9
+  802100:	49 89 f0             	mov    %rsi,%r8
+  802103:	be 00 00 00 00       	mov    $0x0,%esi
+  802108:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80210d:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  802114:	ff ff ff 
+  802117:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80211b:	ff d0                	call   *%rax
+  80211d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802121:	c9                   	leave
+  802122:	c3                   	ret
+
+0000000000802123 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802123:	55                   	push   %rbp
+  802124:	48 89 e5             	mov    %rsp,%rbp
+  802127:	48 83 ec 20          	sub    $0x20,%rsp
+  80212b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80212b <sys_ipc_send+0x8>
+  802132:	49 bb 05 5f 00 00 00 	movabs $0x5f05,%r11
+  802139:	00 00 00 
+  80213c:	4c 01 d8             	add    %r11,%rax
+  80213f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802142:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802146:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80214a:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80214d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802150:	48 63 fa             	movslq %edx,%rdi
+  802153:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802157:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80215a:	48 63 d2             	movslq %edx,%rdx
+  80215d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802161:	48 83 ec 08          	sub    $0x8,%rsp
+  802165:	6a 00                	push   $0x0
+  802167:	49 89 f9             	mov    %rdi,%r9
+  80216a:	49 89 f0             	mov    %rsi,%r8
+  80216d:	be 00 00 00 00       	mov    $0x0,%esi
+  802172:	bf 17 00 00 00       	mov    $0x17,%edi
+  802177:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  80217e:	ff ff ff 
+  802181:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802185:	ff d0                	call   *%rax
+  802187:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80218b:	c9                   	leave
+  80218c:	c3                   	ret
+
+000000000080218d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80218d:	55                   	push   %rbp
+  80218e:	48 89 e5             	mov    %rsp,%rbp
+  802191:	48 83 ec 10          	sub    $0x10,%rsp
+  802195:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802195 <sys_ipc_recv+0x8>
+  80219c:	49 bb 9b 5e 00 00 00 	movabs $0x5e9b,%r11
+  8021a3:	00 00 00 
+  8021a6:	4c 01 d8             	add    %r11,%rax
+  8021a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8021ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8021b1:	6a 00                	push   $0x0
+  8021b3:	6a 00                	push   $0x0
+  8021b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8021cb:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021d0:	49 ba cd 9a ff ff ff 	movabs $0xffffffffffff9acd,%r10
+  8021d7:	ff ff ff 
+  8021da:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021de:	ff d0                	call   *%rax
+  8021e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021e4:	c9                   	leave
+  8021e5:	c3                   	ret
+
+00000000008021e6 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8021e6:	55                   	push   %rbp
+  8021e7:	48 89 e5             	mov    %rsp,%rbp
+  8021ea:	48 83 ec 30          	sub    $0x30,%rsp
+  8021ee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021ee <sys_ipc_call+0x8>
+  8021f5:	49 bb 42 5e 00 00 00 	movabs $0x5e42,%r11
+  8021fc:	00 00 00 
+  8021ff:	4c 01 d8             	add    %r11,%rax
+  802202:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802205:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802209:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80220d:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802210:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802214:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802218:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80221c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80221f:	4c 63 c2             	movslq %edx,%r8
+  802222:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802226:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802229:	48 63 d2             	movslq %edx,%rdx
+  80222c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802230:	ff 75 d8             	push   -0x28(%rbp)
+  802233:	56                   	push   %rsi
+  802234:	4d 89 c1             	mov    %r8,%r9
+  802237:	49 89 f8             	mov    %rdi,%r8
+  80223a:	be 00 00 00 00       	mov    $0x0,%esi
+  80223f:	bf 18 00 00 00       	mov    $0x18,%edi
+  802244:	49 ba cd 9a ff ff ff 	movabs $0xffffffffffff9acd,%r10
+  80224b:	ff ff ff 
+  80224e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802252:	ff d0                	call   *%rax
+  802254:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802258:	c9                   	leave
+  802259:	c3                   	ret
+
+000000000080225a <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  80225a:	55                   	push   %rbp
+  80225b:	48 89 e5             	mov    %rsp,%rbp
+  80225e:	48 83 ec 30          	sub    $0x30,%rsp
+  802262:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802262 <sys_ipc_reply_recv+0x8>
+  802269:	49 bb ce 5d 00 00 00 	movabs $0x5dce,%r11
+  802270:	00 00 00 
+  802273:	4c 01 d8             	add    %r11,%rax
+  802276:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802279:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80227d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802281:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802284:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802288:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80228c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802290:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802293:	4c 63 c2             	movslq %edx,%r8
+  802296:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80229a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80229d:	48 63 d2             	movslq %edx,%rdx
+  8022a0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022a4:	ff 75 d8             	push   -0x28(%rbp)
+  8022a7:	56                   	push   %rsi
+  8022a8:	4d 89 c1             	mov    %r8,%r9
+  8022ab:	49 89 f8             	mov    %rdi,%r8
+  8022ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b3:	bf 19 00 00 00       	mov    $0x19,%edi
+  8022b8:	49 ba cd 9a ff ff ff 	movabs $0xffffffffffff9acd,%r10
+  8022bf:	ff ff ff 
+  8022c2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022c6:	ff d0                	call   *%rax
+  8022c8:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8022cc:	c9                   	leave
+  8022cd:	c3                   	ret
+
+00000000008022ce <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8022ce:	55                   	push   %rbp
+  8022cf:	48 89 e5             	mov    %rsp,%rbp
+  8022d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022d6 <sys_env_set_priority+0x8>
+  8022dd:	49 bb 5a 5d 00 00 00 	movabs $0x5d5a,%r11
+  8022e4:	00 00 00 
+  8022e7:	4c 01 d8             	add    %r11,%rax
+  8022ea:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ed:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8022f0:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022f3:	48 63 ca             	movslq %edx,%rcx
+  8022f6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022f9:	48 63 d2             	movslq %edx,%rdx
+  8022fc:	48 83 ec 08          	sub    $0x8,%rsp
+  802300:	6a 00                	push   $0x0
+  802302:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802308:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80230e:	be 01 00 00 00       	mov    $0x1,%esi
+  802313:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802318:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  80231f:	ff ff ff 
+  802322:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802326:	ff d0                	call   *%rax
+  802328:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80232c:	c9                   	leave
+  80232d:	c3                   	ret
+
+000000000080232e <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80232e:	55                   	push   %rbp
+  80232f:	48 89 e5             	mov    %rsp,%rbp
+  802332:	48 83 ec 10          	sub    $0x10,%rsp
+  802336:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802336 <sys_env_set_affinity+0x8>
+  80233d:	49 bb fa 5c 00 00 00 	movabs $0x5cfa,%r11
+  802344:	00 00 00 
+  802347:	4c 01 d8             	add    %r11,%rax
+  80234a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80234d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802350:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802353:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802356:	48 63 d2             	movslq %edx,%rdx
+  802359:	48 83 ec 08          	sub    $0x8,%rsp
+  80235d:	6a 00                	push   $0x0
+  80235f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802365:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80236b:	be 01 00 00 00       	mov    $0x1,%esi
+  802370:	bf 10 00 00 00       	mov    $0x10,%edi
+  802375:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  80237c:	ff ff ff 
+  80237f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802383:	ff d0                	call   *%rax
+  802385:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802389:	c9                   	leave
+  80238a:	c3                   	ret
+
+000000000080238b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80238b:	55                   	push   %rbp
+  80238c:	48 89 e5             	mov    %rsp,%rbp
+  80238f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80238f <sys_time_msec+0x4>
+  802396:	49 bb a1 5c 00 00 00 	movabs $0x5ca1,%r11
+  80239d:	00 00 00 
+  8023a0:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8023a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8023a7:	6a 00                	push   $0x0
+  8023a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c4:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8023c9:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  8023d0:	ff ff ff 
+  8023d3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023d7:	ff d0                	call   *%rax
+  8023d9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023dd:	c9                   	leave
+  8023de:	c3                   	ret
+
+00000000008023df <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8023df:	55                   	push   %rbp
+  8023e0:	48 89 e5             	mov    %rsp,%rbp
+  8023e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8023e7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023e7 <sys_sleep_usec+0x8>
+  8023ee:	49 bb 49 5c 00 00 00 	movabs $0x5c49,%r11
+  8023f5:	00 00 00 
+  8023f8:	4c 01 d8             	add    %r11,%rax
+  8023fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8023ff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802403:	48 83 ec 08          	sub    $0x8,%rsp
+  802407:	6a 00                	push   $0x0
+  802409:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80240f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802415:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80241a:	be 00 00 00 00       	mov    $0x0,%esi
+  80241f:	bf 11 00 00 00       	mov    $0x11,%edi
+  802424:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  80242b:	ff ff ff 
+  80242e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802432:	ff d0                	call   *%rax
+  802434:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802438:	c9                   	leave
+  802439:	c3                   	ret
+
+000000000080243a <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  80243a:	55                   	push   %rbp
+  80243b:	48 89 e5             	mov    %rsp,%rbp
+  80243e:	48 83 ec 10          	sub    $0x10,%rsp
+  802442:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802442 <sys_page_alloc_huge+0x8>
+  802449:	49 bb ee 5b 00 00 00 	movabs $0x5bee,%r11
+  802450:	00 00 00 
+  802453:	4c 01 d8             	add    %r11,%rax
+  802456:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802459:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80245d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802460:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802463:	48 63 f2             	movslq %edx,%rsi
+  802466:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80246a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80246d:	48 63 d2             	movslq %edx,%rdx
+  802470:	48 83 ec 08          	sub    $0x8,%rsp
+  802474:	6a 00                	push   $0x0
+  802476:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80247c:	49 89 f0             	mov    %rsi,%r8
+  80247f:	be 01 00 00 00       	mov    $0x1,%esi
+  802484:	bf 12 00 00 00       	mov    $0x12,%edi
+  802489:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  802490:	ff ff ff 
+  802493:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802497:	ff d0                	call   *%rax
+  802499:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80249d:	c9                   	leave
+  80249e:	c3                   	ret
+
+000000000080249f <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80249f:	55                   	push   %rbp
+  8024a0:	48 89 e5             	mov    %rsp,%rbp
+  8024a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024a7 <sys_page_map_batch+0x8>
+  8024ae:	49 bb 89 5b 00 00 00 	movabs $0x5b89,%r11
+  8024b5:	00 00 00 
+  8024b8:	4c 01 d8             	add    %r11,%rax
+  8024bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024bf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8024c3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024c7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8024cf:	6a 00                	push   $0x0
+  8024d1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024dd:	be 01 00 00 00       	mov    $0x1,%esi
+  8024e2:	bf 13 00 00 00       	mov    $0x13,%edi
+  8024e7:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  8024ee:	ff ff ff 
+  8024f1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024f5:	ff d0                	call   *%rax
+  8024f7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024fb:	c9                   	leave
+  8024fc:	c3                   	ret
+
+00000000008024fd <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8024fd:	55                   	push   %rbp
+  8024fe:	48 89 e5             	mov    %rsp,%rbp
+  802501:	48 83 ec 10          	sub    $0x10,%rsp
+  802505:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802505 <sys_page_alloc_batch+0x8>
+  80250c:	49 bb 2b 5b 00 00 00 	movabs $0x5b2b,%r11
+  802513:	00 00 00 
+  802516:	4c 01 d8             	add    %r11,%rax
+  802519:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80251d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802521:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802525:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802529:	48 83 ec 08          	sub    $0x8,%rsp
+  80252d:	6a 00                	push   $0x0
+  80252f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802535:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80253b:	be 01 00 00 00       	mov    $0x1,%esi
+  802540:	bf 14 00 00 00       	mov    $0x14,%edi
+  802545:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  80254c:	ff ff ff 
+  80254f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802553:	ff d0                	call   *%rax
+  802555:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802559:	c9                   	leave
+  80255a:	c3                   	ret
+
+000000000080255b <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  80255b:	55                   	push   %rbp
+  80255c:	48 89 e5             	mov    %rsp,%rbp
+  80255f:	48 83 ec 10          	sub    $0x10,%rsp
+  802563:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802563 <sys_page_unmap_batch+0x8>
+  80256a:	49 bb cd 5a 00 00 00 	movabs $0x5acd,%r11
+  802571:	00 00 00 
+  802574:	4c 01 d8             	add    %r11,%rax
+  802577:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80257b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80257f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802583:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802587:	48 83 ec 08          	sub    $0x8,%rsp
+  80258b:	6a 00                	push   $0x0
+  80258d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802593:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802599:	be 01 00 00 00       	mov    $0x1,%esi
+  80259e:	bf 15 00 00 00       	mov    $0x15,%edi
+  8025a3:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  8025aa:	ff ff ff 
+  8025ad:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025b1:	ff d0                	call   *%rax
+  8025b3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025b7:	c9                   	leave
+  8025b8:	c3                   	ret
+
+00000000008025b9 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8025b9:	55                   	push   %rbp
+  8025ba:	48 89 e5             	mov    %rsp,%rbp
+  8025bd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025bd <sys_fork+0x4>
+  8025c4:	49 bb 73 5a 00 00 00 	movabs $0x5a73,%r11
+  8025cb:	00 00 00 
+  8025ce:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8025d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8025d5:	6a 00                	push   $0x0
+  8025d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f2:	bf 16 00 00 00       	mov    $0x16,%edi
+  8025f7:	49 ba 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%r10
+  8025fe:	ff ff ff 
+  802601:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802605:	ff d0                	call   *%rax
+  802607:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80260b:	c9                   	leave
+  80260c:	c3                   	ret
+
+000000000080260d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  80260d:	55                   	push   %rbp
+  80260e:	48 89 e5             	mov    %rsp,%rbp
+  802611:	48 83 ec 08          	sub    $0x8,%rsp
+  802615:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802615 <fd2num+0x8>
+  80261c:	49 bb 1b 5a 00 00 00 	movabs $0x5a1b,%r11
+  802623:	00 00 00 
+  802626:	4c 01 d8             	add    %r11,%rax
+  802629:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80262d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802631:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802638:	ff ff ff 
+  80263b:	48 01 d0             	add    %rdx,%rax
+  80263e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802642:	c9                   	leave
+  802643:	c3                   	ret
+
+0000000000802644 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802644:	55                   	push   %rbp
+  802645:	48 89 e5             	mov    %rsp,%rbp
+  802648:	48 83 ec 08          	sub    $0x8,%rsp
+  80264c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80264c <fd2data+0x8>
+  802653:	49 bb e4 59 00 00 00 	movabs $0x59e4,%r11
+  80265a:	00 00 00 
+  80265d:	4c 01 d8             	add    %r11,%rax
+  802660:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  802664:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802668:	48 89 d7             	mov    %rdx,%rdi
+  80266b:	48 ba dd a5 ff ff ff 	movabs $0xffffffffffffa5dd,%rdx
+  802672:	ff ff ff 
+  802675:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802679:	ff d0                	call   *%rax
+  80267b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802681:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802685:	c9                   	leave
+  802686:	c3                   	ret
+
+0000000000802687 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802687:	55                   	push   %rbp
+  802688:	48 89 e5             	mov    %rsp,%rbp
+  80268b:	48 83 ec 18          	sub    $0x18,%rsp
+  80268f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80268f <fd_alloc+0x8>
+  802696:	49 bb a1 59 00 00 00 	movabs $0x59a1,%r11
+  80269d:	00 00 00 
+  8026a0:	4c 01 d8             	add    %r11,%rax
+  8026a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8026a7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8026ae:	eb 75                	jmp    802725 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8026b0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026b3:	48 63 d2             	movslq %edx,%rdx
+  8026b6:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8026bd:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8026c1:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8026c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026c9:	48 89 d1             	mov    %rdx,%rcx
+  8026cc:	48 c1 e9 15          	shr    $0x15,%rcx
+  8026d0:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8026d7:	ff ff ff 
+  8026da:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8026de:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8026e2:	83 e2 01             	and    $0x1,%edx
+  8026e5:	48 85 d2             	test   %rdx,%rdx
+  8026e8:	74 25                	je     80270f <fd_alloc+0x88>
+  8026ea:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026ee:	48 89 d1             	mov    %rdx,%rcx
+  8026f1:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8026f5:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8026fc:	ff ff ff 
+  8026ff:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802703:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802707:	83 e2 01             	and    $0x1,%edx
+  80270a:	48 85 d2             	test   %rdx,%rdx
+  80270d:	75 12                	jne    802721 <fd_alloc+0x9a>
+			*fd_store = fd;
+  80270f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802713:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802717:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80271a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271f:	eb 1a                	jmp    80273b <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802721:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802725:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802729:	7e 85                	jle    8026b0 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  80272b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80272f:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802736:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  80273b:	c9                   	leave
+  80273c:	c3                   	ret
+
+000000000080273d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80273d:	55                   	push   %rbp
+  80273e:	48 89 e5             	mov    %rsp,%rbp
+  802741:	48 83 ec 20          	sub    $0x20,%rsp
+  802745:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802745 <fd_lookup+0x8>
+  80274c:	49 bb eb 58 00 00 00 	movabs $0x58eb,%r11
+  802753:	00 00 00 
+  802756:	4c 01 d8             	add    %r11,%rax
+  802759:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80275c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802760:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802764:	78 06                	js     80276c <fd_lookup+0x2f>
+  802766:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80276a:	7e 07                	jle    802773 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  80276c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802771:	eb 73                	jmp    8027e6 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802773:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802776:	48 63 d2             	movslq %edx,%rdx
+  802779:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802780:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802784:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802788:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80278c:	48 89 d1             	mov    %rdx,%rcx
+  80278f:	48 c1 e9 15          	shr    $0x15,%rcx
+  802793:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80279a:	ff ff ff 
+  80279d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8027a1:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8027a5:	83 e2 01             	and    $0x1,%edx
+  8027a8:	48 85 d2             	test   %rdx,%rdx
+  8027ab:	74 22                	je     8027cf <fd_lookup+0x92>
+  8027ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027b1:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8027b5:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  8027bc:	ff ff ff 
+  8027bf:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  8027c3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8027c7:	83 e0 01             	and    $0x1,%eax
+  8027ca:	48 85 c0             	test   %rax,%rax
+  8027cd:	75 07                	jne    8027d6 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8027cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027d4:	eb 10                	jmp    8027e6 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  8027d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8027da:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027de:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  8027e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027e6:	c9                   	leave
+  8027e7:	c3                   	ret
+
+00000000008027e8 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  8027e8:	55                   	push   %rbp
+  8027e9:	48 89 e5             	mov    %rsp,%rbp
+  8027ec:	41 57                	push   %r15
+  8027ee:	53                   	push   %rbx
+  8027ef:	48 83 ec 30          	sub    $0x30,%rsp
+  8027f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8027f3 <fd_close+0xb>
+  8027fa:	49 bb 3d 58 00 00 00 	movabs $0x583d,%r11
+  802801:	00 00 00 
+  802804:	4c 01 db             	add    %r11,%rbx
+  802807:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80280b:	89 f0                	mov    %esi,%eax
+  80280d:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802810:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802814:	48 89 c7             	mov    %rax,%rdi
+  802817:	48 b8 dd a5 ff ff ff 	movabs $0xffffffffffffa5dd,%rax
+  80281e:	ff ff ff 
+  802821:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802825:	ff d0                	call   *%rax
+  802827:	89 c2                	mov    %eax,%edx
+  802829:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80282d:	48 89 c6             	mov    %rax,%rsi
+  802830:	89 d7                	mov    %edx,%edi
+  802832:	48 b8 0d a7 ff ff ff 	movabs $0xffffffffffffa70d,%rax
+  802839:	ff ff ff 
+  80283c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802840:	ff d0                	call   *%rax
+  802842:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802845:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802849:	78 0a                	js     802855 <fd_close+0x6d>
+	    || fd != fd2)
+  80284b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80284f:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802853:	74 12                	je     802867 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802855:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802859:	74 05                	je     802860 <fd_close+0x78>
+  80285b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80285e:	eb 7a                	jmp    8028da <fd_close+0xf2>
+  802860:	b8 00 00 00 00       	mov    $0x0,%eax
+  802865:	eb 73                	jmp    8028da <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802867:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80286b:	8b 00                	mov    (%rax),%eax
+  80286d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802871:	48 89 d6             	mov    %rdx,%rsi
+  802874:	89 c7                	mov    %eax,%edi
+  802876:	48 b8 b3 a8 ff ff ff 	movabs $0xffffffffffffa8b3,%rax
+  80287d:	ff ff ff 
+  802880:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802884:	ff d0                	call   *%rax
+  802886:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802889:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80288d:	78 2a                	js     8028b9 <fd_close+0xd1>
+		if (dev->dev_close)
+  80288f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802893:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802897:	48 85 c0             	test   %rax,%rax
+  80289a:	74 16                	je     8028b2 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  80289c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028a0:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8028a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028a8:	48 89 c7             	mov    %rax,%rdi
+  8028ab:	ff d2                	call   *%rdx
+  8028ad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8028b0:	eb 07                	jmp    8028b9 <fd_close+0xd1>
+		else
+			r = 0;
+  8028b2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8028b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028bd:	48 89 c6             	mov    %rax,%rsi
+  8028c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028c5:	49 89 df             	mov    %rbx,%r15
+  8028c8:	48 b8 0c 9f ff ff ff 	movabs $0xffffffffffff9f0c,%rax
+  8028cf:	ff ff ff 
+  8028d2:	48 01 d8             	add    %rbx,%rax
+  8028d5:	ff d0                	call   *%rax
+	return r;
+  8028d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8028da:	48 83 c4 30          	add    $0x30,%rsp
+  8028de:	5b                   	pop    %rbx
+  8028df:	41 5f                	pop    %r15
+  8028e1:	5d                   	pop    %rbp
+  8028e2:	c3                   	ret
+
+00000000008028e3 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8028e3:	55                   	push   %rbp
+  8028e4:	48 89 e5             	mov    %rsp,%rbp
+  8028e7:	41 57                	push   %r15
+  8028e9:	48 83 ec 28          	sub    $0x28,%rsp
+  8028ed:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8028ed <dev_lookup+0xa>
+  8028f4:	49 bb 43 57 00 00 00 	movabs $0x5743,%r11
+  8028fb:	00 00 00 
+  8028fe:	4c 01 d9             	add    %r11,%rcx
+  802901:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802904:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802908:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80290f:	eb 45                	jmp    802956 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802911:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802918:	00 00 00 
+  80291b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80291e:	48 98                	cltq
+  802920:	48 01 ca             	add    %rcx,%rdx
+  802923:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802927:	8b 00                	mov    (%rax),%eax
+  802929:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80292c:	75 24                	jne    802952 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  80292e:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802935:	00 00 00 
+  802938:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80293b:	48 98                	cltq
+  80293d:	48 01 ca             	add    %rcx,%rdx
+  802940:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802944:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802948:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80294b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802950:	eb 74                	jmp    8029c6 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802952:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802956:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  80295d:	00 00 00 
+  802960:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802963:	48 98                	cltq
+  802965:	48 01 ca             	add    %rcx,%rdx
+  802968:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80296c:	48 85 c0             	test   %rax,%rax
+  80296f:	75 a0                	jne    802911 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802971:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802978:	ff ff ff 
+  80297b:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  80297f:	48 8b 00             	mov    (%rax),%rax
+  802982:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802988:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80298b:	89 c6                	mov    %eax,%esi
+  80298d:	48 b8 80 e3 ff ff ff 	movabs $0xffffffffffffe380,%rax
+  802994:	ff ff ff 
+  802997:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80299b:	48 89 c7             	mov    %rax,%rdi
+  80299e:	49 89 cf             	mov    %rcx,%r15
+  8029a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a6:	49 b8 b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%r8
+  8029ad:	ff ff ff 
+  8029b0:	49 01 c8             	add    %rcx,%r8
+  8029b3:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8029b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029ba:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8029c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8029c6:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8029ca:	c9                   	leave
+  8029cb:	c3                   	ret
+
+00000000008029cc <close>:
+
+int
+close(int fdnum)
+{
+  8029cc:	55                   	push   %rbp
+  8029cd:	48 89 e5             	mov    %rsp,%rbp
+  8029d0:	53                   	push   %rbx
+  8029d1:	48 83 ec 28          	sub    $0x28,%rsp
+  8029d5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8029d5 <close+0x9>
+  8029dc:	49 bb 5b 56 00 00 00 	movabs $0x565b,%r11
+  8029e3:	00 00 00 
+  8029e6:	4c 01 db             	add    %r11,%rbx
+  8029e9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029ec:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8029f0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8029f3:	48 89 d6             	mov    %rdx,%rsi
+  8029f6:	89 c7                	mov    %eax,%edi
+  8029f8:	48 b8 0d a7 ff ff ff 	movabs $0xffffffffffffa70d,%rax
+  8029ff:	ff ff ff 
+  802a02:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a06:	ff d0                	call   *%rax
+  802a08:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802a0b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802a0f:	79 05                	jns    802a16 <close+0x4a>
+		return r;
+  802a11:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a14:	eb 1c                	jmp    802a32 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802a16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a1a:	be 01 00 00 00       	mov    $0x1,%esi
+  802a1f:	48 89 c7             	mov    %rax,%rdi
+  802a22:	48 b8 b8 a7 ff ff ff 	movabs $0xffffffffffffa7b8,%rax
+  802a29:	ff ff ff 
+  802a2c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a30:	ff d0                	call   *%rax
+}
+  802a32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a36:	c9                   	leave
+  802a37:	c3                   	ret
+
+0000000000802a38 <close_all>:
+
+void
+close_all(void)
+{
+  802a38:	55                   	push   %rbp
+  802a39:	48 89 e5             	mov    %rsp,%rbp
+  802a3c:	53                   	push   %rbx
+  802a3d:	48 83 ec 18          	sub    $0x18,%rsp
+  802a41:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a41 <close_all+0x9>
+  802a48:	49 bb ef 55 00 00 00 	movabs $0x55ef,%r11
+  802a4f:	00 00 00 
+  802a52:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802a55:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802a5c:	eb 19                	jmp    802a77 <close_all+0x3f>
+		close(i);
+  802a5e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a61:	89 c7                	mov    %eax,%edi
+  802a63:	48 b8 9c a9 ff ff ff 	movabs $0xffffffffffffa99c,%rax
+  802a6a:	ff ff ff 
+  802a6d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a71:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802a73:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802a77:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802a7b:	7e e1                	jle    802a5e <close_all+0x26>
+}
+  802a7d:	90                   	nop
+  802a7e:	90                   	nop
+  802a7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a83:	c9                   	leave
+  802a84:	c3                   	ret
+
+0000000000802a85 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802a85:	55                   	push   %rbp
+  802a86:	48 89 e5             	mov    %rsp,%rbp
+  802a89:	41 57                	push   %r15
+  802a8b:	53                   	push   %rbx
+  802a8c:	48 83 ec 40          	sub    $0x40,%rsp
+  802a90:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a90 <dup+0xb>
+  802a97:	49 bb a0 55 00 00 00 	movabs $0x55a0,%r11
+  802a9e:	00 00 00 
+  802aa1:	4c 01 db             	add    %r11,%rbx
+  802aa4:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802aa7:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802aaa:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802aae:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802ab1:	48 89 d6             	mov    %rdx,%rsi
+  802ab4:	89 c7                	mov    %eax,%edi
+  802ab6:	48 b8 0d a7 ff ff ff 	movabs $0xffffffffffffa70d,%rax
+  802abd:	ff ff ff 
+  802ac0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ac4:	ff d0                	call   *%rax
+  802ac6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ac9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802acd:	79 08                	jns    802ad7 <dup+0x52>
+		return r;
+  802acf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ad2:	e9 a4 01 00 00       	jmp    802c7b <dup+0x1f6>
+	close(newfdnum);
+  802ad7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ada:	89 c7                	mov    %eax,%edi
+  802adc:	48 b8 9c a9 ff ff ff 	movabs $0xffffffffffffa99c,%rax
+  802ae3:	ff ff ff 
+  802ae6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802aea:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802aec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802aef:	48 98                	cltq
+  802af1:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802af7:	48 c1 e0 0c          	shl    $0xc,%rax
+  802afb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802aff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b03:	48 89 c7             	mov    %rax,%rdi
+  802b06:	48 b8 14 a6 ff ff ff 	movabs $0xffffffffffffa614,%rax
+  802b0d:	ff ff ff 
+  802b10:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b14:	ff d0                	call   *%rax
+  802b16:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802b1a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b1e:	48 89 c7             	mov    %rax,%rdi
+  802b21:	48 b8 14 a6 ff ff ff 	movabs $0xffffffffffffa614,%rax
+  802b28:	ff ff ff 
+  802b2b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b2f:	ff d0                	call   *%rax
+  802b31:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802b35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b39:	48 c1 e8 15          	shr    $0x15,%rax
+  802b3d:	48 89 c2             	mov    %rax,%rdx
+  802b40:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802b47:	ff ff ff 
+  802b4a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b4e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b52:	83 e0 01             	and    $0x1,%eax
+  802b55:	48 85 c0             	test   %rax,%rax
+  802b58:	74 7f                	je     802bd9 <dup+0x154>
+  802b5a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b5e:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b62:	48 89 c2             	mov    %rax,%rdx
+  802b65:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802b6c:	ff ff ff 
+  802b6f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b73:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b77:	83 e0 01             	and    $0x1,%eax
+  802b7a:	48 85 c0             	test   %rax,%rax
+  802b7d:	74 5a                	je     802bd9 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802b7f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b83:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b87:	48 89 c2             	mov    %rax,%rdx
+  802b8a:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802b91:	ff ff ff 
+  802b94:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b98:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b9c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802ba1:	89 c1                	mov    %eax,%ecx
+  802ba3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ba7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bab:	41 89 c8             	mov    %ecx,%r8d
+  802bae:	48 89 d1             	mov    %rdx,%rcx
+  802bb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bb6:	48 89 c6             	mov    %rax,%rsi
+  802bb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bbe:	49 89 df             	mov    %rbx,%r15
+  802bc1:	48 b8 99 9e ff ff ff 	movabs $0xffffffffffff9e99,%rax
+  802bc8:	ff ff ff 
+  802bcb:	48 01 d8             	add    %rbx,%rax
+  802bce:	ff d0                	call   *%rax
+  802bd0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bd3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802bd7:	78 5f                	js     802c38 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802bd9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bdd:	48 c1 e8 0c          	shr    $0xc,%rax
+  802be1:	48 89 c2             	mov    %rax,%rdx
+  802be4:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802beb:	ff ff ff 
+  802bee:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802bf2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bf6:	25 07 0e 00 00       	and    $0xe07,%eax
+  802bfb:	89 c1                	mov    %eax,%ecx
+  802bfd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c01:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802c05:	41 89 c8             	mov    %ecx,%r8d
+  802c08:	48 89 d1             	mov    %rdx,%rcx
+  802c0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c10:	48 89 c6             	mov    %rax,%rsi
+  802c13:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c18:	49 89 df             	mov    %rbx,%r15
+  802c1b:	48 b8 99 9e ff ff ff 	movabs $0xffffffffffff9e99,%rax
+  802c22:	ff ff ff 
+  802c25:	48 01 d8             	add    %rbx,%rax
+  802c28:	ff d0                	call   *%rax
+  802c2a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c2d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c31:	78 08                	js     802c3b <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802c33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c36:	eb 43                	jmp    802c7b <dup+0x1f6>
+			goto err;
+  802c38:	90                   	nop
+  802c39:	eb 01                	jmp    802c3c <dup+0x1b7>
+		goto err;
+  802c3b:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802c3c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c40:	48 89 c6             	mov    %rax,%rsi
+  802c43:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c48:	49 89 df             	mov    %rbx,%r15
+  802c4b:	48 b8 0c 9f ff ff ff 	movabs $0xffffffffffff9f0c,%rax
+  802c52:	ff ff ff 
+  802c55:	48 01 d8             	add    %rbx,%rax
+  802c58:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802c5a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c5e:	48 89 c6             	mov    %rax,%rsi
+  802c61:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c66:	49 89 df             	mov    %rbx,%r15
+  802c69:	48 b8 0c 9f ff ff ff 	movabs $0xffffffffffff9f0c,%rax
+  802c70:	ff ff ff 
+  802c73:	48 01 d8             	add    %rbx,%rax
+  802c76:	ff d0                	call   *%rax
+	return r;
+  802c78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802c7b:	48 83 c4 40          	add    $0x40,%rsp
+  802c7f:	5b                   	pop    %rbx
+  802c80:	41 5f                	pop    %r15
+  802c82:	5d                   	pop    %rbp
+  802c83:	c3                   	ret
+
+0000000000802c84 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802c84:	55                   	push   %rbp
+  802c85:	48 89 e5             	mov    %rsp,%rbp
+  802c88:	41 57                	push   %r15
+  802c8a:	53                   	push   %rbx
+  802c8b:	48 83 ec 40          	sub    $0x40,%rsp
+  802c8f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c8f <read+0xb>
+  802c96:	49 bb a1 53 00 00 00 	movabs $0x53a1,%r11
+  802c9d:	00 00 00 
+  802ca0:	4c 01 db             	add    %r11,%rbx
+  802ca3:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802ca6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802caa:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802cae:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802cb2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802cb5:	48 89 d6             	mov    %rdx,%rsi
+  802cb8:	89 c7                	mov    %eax,%edi
+  802cba:	48 b8 0d a7 ff ff ff 	movabs $0xffffffffffffa70d,%rax
+  802cc1:	ff ff ff 
+  802cc4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cc8:	ff d0                	call   *%rax
+  802cca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ccd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802cd1:	78 28                	js     802cfb <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802cd3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cd7:	8b 00                	mov    (%rax),%eax
+  802cd9:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802cdd:	48 89 d6             	mov    %rdx,%rsi
+  802ce0:	89 c7                	mov    %eax,%edi
+  802ce2:	48 b8 b3 a8 ff ff ff 	movabs $0xffffffffffffa8b3,%rax
+  802ce9:	ff ff ff 
+  802cec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cf0:	ff d0                	call   *%rax
+  802cf2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802cf5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802cf9:	79 08                	jns    802d03 <read+0x7f>
+		return r;
+  802cfb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cfe:	e9 8b 00 00 00       	jmp    802d8e <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802d03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d07:	8b 40 08             	mov    0x8(%rax),%eax
+  802d0a:	83 e0 03             	and    $0x3,%eax
+  802d0d:	83 f8 01             	cmp    $0x1,%eax
+  802d10:	75 4b                	jne    802d5d <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802d12:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802d19:	ff ff ff 
+  802d1c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d20:	48 8b 00             	mov    (%rax),%rax
+  802d23:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802d29:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  802d2c:	89 c6                	mov    %eax,%esi
+  802d2e:	48 b8 9f e3 ff ff ff 	movabs $0xffffffffffffe39f,%rax
+  802d35:	ff ff ff 
+  802d38:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d3c:	48 89 c7             	mov    %rax,%rdi
+  802d3f:	49 89 df             	mov    %rbx,%r15
+  802d42:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d47:	48 b9 b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%rcx
+  802d4e:	ff ff ff 
+  802d51:	48 01 d9             	add    %rbx,%rcx
+  802d54:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802d56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d5b:	eb 31                	jmp    802d8e <read+0x10a>
+	}
+	if (!dev->dev_read)
+  802d5d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d61:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802d65:	48 85 c0             	test   %rax,%rax
+  802d68:	75 07                	jne    802d71 <read+0xed>
+		return -E_NOT_SUPP;
+  802d6a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802d6f:	eb 1d                	jmp    802d8e <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  802d71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d75:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802d79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d7d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802d81:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802d85:	48 89 ce             	mov    %rcx,%rsi
+  802d88:	48 89 c7             	mov    %rax,%rdi
+  802d8b:	41 ff d0             	call   *%r8
+}
+  802d8e:	48 83 c4 40          	add    $0x40,%rsp
+  802d92:	5b                   	pop    %rbx
+  802d93:	41 5f                	pop    %r15
+  802d95:	5d                   	pop    %rbp
+  802d96:	c3                   	ret
+
+0000000000802d97 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802d97:	55                   	push   %rbp
+  802d98:	48 89 e5             	mov    %rsp,%rbp
+  802d9b:	53                   	push   %rbx
+  802d9c:	48 83 ec 38          	sub    $0x38,%rsp
+  802da0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802da0 <readn+0x9>
+  802da7:	49 bb 90 52 00 00 00 	movabs $0x5290,%r11
+  802dae:	00 00 00 
+  802db1:	4c 01 db             	add    %r11,%rbx
+  802db4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802db7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802dbb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802dbf:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802dc6:	eb 4b                	jmp    802e13 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802dc8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dcb:	48 98                	cltq
+  802dcd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802dd1:	48 29 c2             	sub    %rax,%rdx
+  802dd4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dd7:	48 63 c8             	movslq %eax,%rcx
+  802dda:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802dde:	48 01 c1             	add    %rax,%rcx
+  802de1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802de4:	48 89 ce             	mov    %rcx,%rsi
+  802de7:	89 c7                	mov    %eax,%edi
+  802de9:	48 b8 54 ac ff ff ff 	movabs $0xffffffffffffac54,%rax
+  802df0:	ff ff ff 
+  802df3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802df7:	ff d0                	call   *%rax
+  802df9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  802dfc:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802e00:	79 05                	jns    802e07 <readn+0x70>
+			return m;
+  802e02:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802e05:	eb 1d                	jmp    802e24 <readn+0x8d>
+		if (m == 0)
+  802e07:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802e0b:	74 13                	je     802e20 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  802e0d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802e10:	01 45 ec             	add    %eax,-0x14(%rbp)
+  802e13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e16:	48 98                	cltq
+  802e18:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  802e1c:	72 aa                	jb     802dc8 <readn+0x31>
+  802e1e:	eb 01                	jmp    802e21 <readn+0x8a>
+			break;
+  802e20:	90                   	nop
+	}
+	return tot;
+  802e21:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802e24:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e28:	c9                   	leave
+  802e29:	c3                   	ret
+
+0000000000802e2a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802e2a:	55                   	push   %rbp
+  802e2b:	48 89 e5             	mov    %rsp,%rbp
+  802e2e:	41 57                	push   %r15
+  802e30:	53                   	push   %rbx
+  802e31:	48 83 ec 40          	sub    $0x40,%rsp
+  802e35:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e35 <write+0xb>
+  802e3c:	49 bb fb 51 00 00 00 	movabs $0x51fb,%r11
+  802e43:	00 00 00 
+  802e46:	4c 01 db             	add    %r11,%rbx
+  802e49:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802e4c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e50:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802e54:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802e58:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802e5b:	48 89 d6             	mov    %rdx,%rsi
+  802e5e:	89 c7                	mov    %eax,%edi
+  802e60:	48 b8 0d a7 ff ff ff 	movabs $0xffffffffffffa70d,%rax
+  802e67:	ff ff ff 
+  802e6a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e6e:	ff d0                	call   *%rax
+  802e70:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e73:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e77:	78 28                	js     802ea1 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802e79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e7d:	8b 00                	mov    (%rax),%eax
+  802e7f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802e83:	48 89 d6             	mov    %rdx,%rsi
+  802e86:	89 c7                	mov    %eax,%edi
+  802e88:	48 b8 b3 a8 ff ff ff 	movabs $0xffffffffffffa8b3,%rax
+  802e8f:	ff ff ff 
+  802e92:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e96:	ff d0                	call   *%rax
+  802e98:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e9b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e9f:	79 08                	jns    802ea9 <write+0x7f>
+		return r;
+  802ea1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ea4:	e9 8a 00 00 00       	jmp    802f33 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802ea9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ead:	8b 40 08             	mov    0x8(%rax),%eax
+  802eb0:	83 e0 03             	and    $0x3,%eax
+  802eb3:	85 c0                	test   %eax,%eax
+  802eb5:	75 4b                	jne    802f02 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802eb7:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802ebe:	ff ff ff 
+  802ec1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ec5:	48 8b 00             	mov    (%rax),%rax
+  802ec8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802ece:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  802ed1:	89 c6                	mov    %eax,%esi
+  802ed3:	48 b8 bb e3 ff ff ff 	movabs $0xffffffffffffe3bb,%rax
+  802eda:	ff ff ff 
+  802edd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ee1:	48 89 c7             	mov    %rax,%rdi
+  802ee4:	49 89 df             	mov    %rbx,%r15
+  802ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eec:	48 b9 b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%rcx
+  802ef3:	ff ff ff 
+  802ef6:	48 01 d9             	add    %rbx,%rcx
+  802ef9:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802efb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f00:	eb 31                	jmp    802f33 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802f02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f06:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802f0a:	48 85 c0             	test   %rax,%rax
+  802f0d:	75 07                	jne    802f16 <write+0xec>
+		return -E_NOT_SUPP;
+  802f0f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802f14:	eb 1d                	jmp    802f33 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  802f16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f1a:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  802f1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f22:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802f26:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f2a:	48 89 ce             	mov    %rcx,%rsi
+  802f2d:	48 89 c7             	mov    %rax,%rdi
+  802f30:	41 ff d0             	call   *%r8
+}
+  802f33:	48 83 c4 40          	add    $0x40,%rsp
+  802f37:	5b                   	pop    %rbx
+  802f38:	41 5f                	pop    %r15
+  802f3a:	5d                   	pop    %rbp
+  802f3b:	c3                   	ret
+
+0000000000802f3c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802f3c:	55                   	push   %rbp
+  802f3d:	48 89 e5             	mov    %rsp,%rbp
+  802f40:	48 83 ec 18          	sub    $0x18,%rsp
+  802f44:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f44 <seek+0x8>
+  802f4b:	49 bb ec 50 00 00 00 	movabs $0x50ec,%r11
+  802f52:	00 00 00 
+  802f55:	4c 01 d8             	add    %r11,%rax
+  802f58:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f5b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f5e:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  802f62:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802f65:	48 89 ce             	mov    %rcx,%rsi
+  802f68:	89 d7                	mov    %edx,%edi
+  802f6a:	48 ba 0d a7 ff ff ff 	movabs $0xffffffffffffa70d,%rdx
+  802f71:	ff ff ff 
+  802f74:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802f78:	ff d0                	call   *%rax
+  802f7a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f7d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f81:	79 05                	jns    802f88 <seek+0x4c>
+		return r;
+  802f83:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f86:	eb 0f                	jmp    802f97 <seek+0x5b>
+	fd->fd_offset = offset;
+  802f88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f8c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802f8f:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  802f92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f97:	c9                   	leave
+  802f98:	c3                   	ret
+
+0000000000802f99 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802f99:	55                   	push   %rbp
+  802f9a:	48 89 e5             	mov    %rsp,%rbp
+  802f9d:	41 57                	push   %r15
+  802f9f:	53                   	push   %rbx
+  802fa0:	48 83 ec 30          	sub    $0x30,%rsp
+  802fa4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802fa4 <ftruncate+0xb>
+  802fab:	49 bb 8c 50 00 00 00 	movabs $0x508c,%r11
+  802fb2:	00 00 00 
+  802fb5:	4c 01 db             	add    %r11,%rbx
+  802fb8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802fbb:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802fbe:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802fc2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802fc5:	48 89 d6             	mov    %rdx,%rsi
+  802fc8:	89 c7                	mov    %eax,%edi
+  802fca:	48 b8 0d a7 ff ff ff 	movabs $0xffffffffffffa70d,%rax
+  802fd1:	ff ff ff 
+  802fd4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fd8:	ff d0                	call   *%rax
+  802fda:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fdd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fe1:	78 28                	js     80300b <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802fe3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fe7:	8b 00                	mov    (%rax),%eax
+  802fe9:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802fed:	48 89 d6             	mov    %rdx,%rsi
+  802ff0:	89 c7                	mov    %eax,%edi
+  802ff2:	48 b8 b3 a8 ff ff ff 	movabs $0xffffffffffffa8b3,%rax
+  802ff9:	ff ff ff 
+  802ffc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803000:	ff d0                	call   *%rax
+  803002:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803005:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803009:	79 08                	jns    803013 <ftruncate+0x7a>
+		return r;
+  80300b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80300e:	e9 83 00 00 00       	jmp    803096 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803013:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803017:	8b 40 08             	mov    0x8(%rax),%eax
+  80301a:	83 e0 03             	and    $0x3,%eax
+  80301d:	85 c0                	test   %eax,%eax
+  80301f:	75 4b                	jne    80306c <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803021:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803028:	ff ff ff 
+  80302b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80302f:	48 8b 00             	mov    (%rax),%rax
+  803032:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803038:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80303b:	89 c6                	mov    %eax,%esi
+  80303d:	48 b8 d8 e3 ff ff ff 	movabs $0xffffffffffffe3d8,%rax
+  803044:	ff ff ff 
+  803047:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80304b:	48 89 c7             	mov    %rax,%rdi
+  80304e:	49 89 df             	mov    %rbx,%r15
+  803051:	b8 00 00 00 00       	mov    $0x0,%eax
+  803056:	48 b9 b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%rcx
+  80305d:	ff ff ff 
+  803060:	48 01 d9             	add    %rbx,%rcx
+  803063:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803065:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80306a:	eb 2a                	jmp    803096 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  80306c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803070:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803074:	48 85 c0             	test   %rax,%rax
+  803077:	75 07                	jne    803080 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803079:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80307e:	eb 16                	jmp    803096 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803080:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803084:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803088:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80308c:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  80308f:	89 d6                	mov    %edx,%esi
+  803091:	48 89 c7             	mov    %rax,%rdi
+  803094:	ff d1                	call   *%rcx
+}
+  803096:	48 83 c4 30          	add    $0x30,%rsp
+  80309a:	5b                   	pop    %rbx
+  80309b:	41 5f                	pop    %r15
+  80309d:	5d                   	pop    %rbp
+  80309e:	c3                   	ret
+
+000000000080309f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80309f:	55                   	push   %rbp
+  8030a0:	48 89 e5             	mov    %rsp,%rbp
+  8030a3:	53                   	push   %rbx
+  8030a4:	48 83 ec 38          	sub    $0x38,%rsp
+  8030a8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030a8 <fstat+0x9>
+  8030af:	49 bb 88 4f 00 00 00 	movabs $0x4f88,%r11
+  8030b6:	00 00 00 
+  8030b9:	4c 01 db             	add    %r11,%rbx
+  8030bc:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8030bf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8030c3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8030c7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8030ca:	48 89 d6             	mov    %rdx,%rsi
+  8030cd:	89 c7                	mov    %eax,%edi
+  8030cf:	48 b8 0d a7 ff ff ff 	movabs $0xffffffffffffa70d,%rax
+  8030d6:	ff ff ff 
+  8030d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030dd:	ff d0                	call   *%rax
+  8030df:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8030e2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8030e6:	78 28                	js     803110 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030ec:	8b 00                	mov    (%rax),%eax
+  8030ee:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8030f2:	48 89 d6             	mov    %rdx,%rsi
+  8030f5:	89 c7                	mov    %eax,%edi
+  8030f7:	48 b8 b3 a8 ff ff ff 	movabs $0xffffffffffffa8b3,%rax
+  8030fe:	ff ff ff 
+  803101:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803105:	ff d0                	call   *%rax
+  803107:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80310a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80310e:	79 05                	jns    803115 <fstat+0x76>
+		return r;
+  803110:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803113:	eb 5e                	jmp    803173 <fstat+0xd4>
+	if (!dev->dev_stat)
+  803115:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803119:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80311d:	48 85 c0             	test   %rax,%rax
+  803120:	75 07                	jne    803129 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  803122:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803127:	eb 4a                	jmp    803173 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803129:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80312d:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803130:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803134:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80313b:	00 00 00 
+	stat->st_isdir = 0;
+  80313e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803142:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803149:	00 00 00 
+	stat->st_dev = dev;
+  80314c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803150:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803154:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  80315b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80315f:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803163:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803167:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80316b:	48 89 d6             	mov    %rdx,%rsi
+  80316e:	48 89 c7             	mov    %rax,%rdi
+  803171:	ff d1                	call   *%rcx
+}
+  803173:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803177:	c9                   	leave
+  803178:	c3                   	ret
+
+0000000000803179 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803179:	55                   	push   %rbp
+  80317a:	48 89 e5             	mov    %rsp,%rbp
+  80317d:	41 57                	push   %r15
+  80317f:	53                   	push   %rbx
+  803180:	48 83 ec 20          	sub    $0x20,%rsp
+  803184:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803184 <stat+0xb>
+  80318b:	49 bb ac 4e 00 00 00 	movabs $0x4eac,%r11
+  803192:	00 00 00 
+  803195:	4c 01 db             	add    %r11,%rbx
+  803198:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80319c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8031a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8031a9:	48 89 c7             	mov    %rax,%rdi
+  8031ac:	49 89 df             	mov    %rbx,%r15
+  8031af:	48 b8 23 b4 ff ff ff 	movabs $0xffffffffffffb423,%rax
+  8031b6:	ff ff ff 
+  8031b9:	48 01 d8             	add    %rbx,%rax
+  8031bc:	ff d0                	call   *%rax
+  8031be:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031c5:	79 05                	jns    8031cc <stat+0x53>
+		return fd;
+  8031c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031ca:	eb 37                	jmp    803203 <stat+0x8a>
+	r = fstat(fd, stat);
+  8031cc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8031d0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031d3:	48 89 d6             	mov    %rdx,%rsi
+  8031d6:	89 c7                	mov    %eax,%edi
+  8031d8:	48 b8 6f b0 ff ff ff 	movabs $0xffffffffffffb06f,%rax
+  8031df:	ff ff ff 
+  8031e2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031e6:	ff d0                	call   *%rax
+  8031e8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8031eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031ee:	89 c7                	mov    %eax,%edi
+  8031f0:	48 b8 9c a9 ff ff ff 	movabs $0xffffffffffffa99c,%rax
+  8031f7:	ff ff ff 
+  8031fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031fe:	ff d0                	call   *%rax
+	return r;
+  803200:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803203:	48 83 c4 20          	add    $0x20,%rsp
+  803207:	5b                   	pop    %rbx
+  803208:	41 5f                	pop    %r15
+  80320a:	5d                   	pop    %rbp
+  80320b:	c3                   	ret
+
+000000000080320c <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80320c:	55                   	push   %rbp
+  80320d:	48 89 e5             	mov    %rsp,%rbp
+  803210:	41 57                	push   %r15
+  803212:	53                   	push   %rbx
+  803213:	48 83 ec 10          	sub    $0x10,%rsp
+  803217:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803217 <fsipc+0xb>
+  80321e:	49 bb 19 4e 00 00 00 	movabs $0x4e19,%r11
+  803225:	00 00 00 
+  803228:	4c 01 db             	add    %r11,%rbx
+  80322b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80322e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803232:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803239:	00 00 00 
+  80323c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80323f:	85 c0                	test   %eax,%eax
+  803241:	75 24                	jne    803267 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803243:	bf 01 00 00 00       	mov    $0x1,%edi
+  803248:	49 89 df             	mov    %rbx,%r15
+  80324b:	48 b8 7c dd ff ff ff 	movabs $0xffffffffffffdd7c,%rax
+  803252:	ff ff ff 
+  803255:	48 01 d8             	add    %rbx,%rax
+  803258:	ff d0                	call   *%rax
+  80325a:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803261:	00 00 00 
+  803264:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  803267:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80326e:	00 00 00 
+  803271:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803274:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803278:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80327b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803281:	49 89 d0             	mov    %rdx,%r8
+  803284:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803289:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803290:	00 00 00 
+  803293:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803297:	89 c7                	mov    %eax,%edi
+  803299:	49 89 df             	mov    %rbx,%r15
+  80329c:	48 b8 9b d7 ff ff ff 	movabs $0xffffffffffffd79b,%rax
+  8032a3:	ff ff ff 
+  8032a6:	48 01 d8             	add    %rbx,%rax
+  8032a9:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8032ab:	48 83 c4 10          	add    $0x10,%rsp
+  8032af:	5b                   	pop    %rbx
+  8032b0:	41 5f                	pop    %r15
+  8032b2:	5d                   	pop    %rbp
+  8032b3:	c3                   	ret
+
+00000000008032b4 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8032b4:	55                   	push   %rbp
+  8032b5:	48 89 e5             	mov    %rsp,%rbp
+  8032b8:	41 57                	push   %r15
+  8032ba:	53                   	push   %rbx
+  8032bb:	48 83 ec 20          	sub    $0x20,%rsp
+  8032bf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032bf <fsipc_words+0xb>
+  8032c6:	49 bb 71 4d 00 00 00 	movabs $0x4d71,%r11
+  8032cd:	00 00 00 
+  8032d0:	4c 01 db             	add    %r11,%rbx
+  8032d3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8032d6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8032da:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8032de:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8032e5:	00 00 00 
+  8032e8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8032eb:	85 c0                	test   %eax,%eax
+  8032ed:	75 24                	jne    803313 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8032ef:	bf 01 00 00 00       	mov    $0x1,%edi
+  8032f4:	49 89 df             	mov    %rbx,%r15
+  8032f7:	48 b8 7c dd ff ff ff 	movabs $0xffffffffffffdd7c,%rax
+  8032fe:	ff ff ff 
+  803301:	48 01 d8             	add    %rbx,%rax
+  803304:	ff d0                	call   *%rax
+  803306:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  80330d:	00 00 00 
+  803310:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803313:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80331a:	00 00 00 
+  80331d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803320:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803324:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803328:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80332b:	89 c7                	mov    %eax,%edi
+  80332d:	49 89 df             	mov    %rbx,%r15
+  803330:	48 b8 86 d8 ff ff ff 	movabs $0xffffffffffffd886,%rax
+  803337:	ff ff ff 
+  80333a:	48 01 d8             	add    %rbx,%rax
+  80333d:	ff d0                	call   *%rax
+}
+  80333f:	48 83 c4 20          	add    $0x20,%rsp
+  803343:	5b                   	pop    %rbx
+  803344:	41 5f                	pop    %r15
+  803346:	5d                   	pop    %rbp
+  803347:	c3                   	ret
+
+0000000000803348 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803348:	55                   	push   %rbp
+  803349:	48 89 e5             	mov    %rsp,%rbp
+  80334c:	41 57                	push   %r15
+  80334e:	53                   	push   %rbx
+  80334f:	48 83 ec 40          	sub    $0x40,%rsp
+  803353:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803353 <fsipc_pages+0xb>
+  80335a:	49 bb dd 4c 00 00 00 	movabs $0x4cdd,%r11
+  803361:	00 00 00 
+  803364:	4c 01 db             	add    %r11,%rbx
+  803367:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80336a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80336e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  803372:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  803375:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80337c:	00 00 00 
+  80337f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803382:	85 c0                	test   %eax,%eax
+  803384:	75 24                	jne    8033aa <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803386:	bf 01 00 00 00       	mov    $0x1,%edi
+  80338b:	49 89 df             	mov    %rbx,%r15
+  80338e:	48 b8 7c dd ff ff ff 	movabs $0xffffffffffffdd7c,%rax
+  803395:	ff ff ff 
+  803398:	48 01 d8             	add    %rbx,%rax
+  80339b:	ff d0                	call   *%rax
+  80339d:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8033a4:	00 00 00 
+  8033a7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8033aa:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8033af:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8033b3:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8033b6:	48 98                	cltq
+  8033b8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8033bc:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8033c0:	0f 95 c0             	setne  %al
+  8033c3:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  8033c6:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8033cd:	00 
+  8033ce:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8033d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033d6:	48 01 d0             	add    %rdx,%rax
+  8033d9:	48 83 e8 01          	sub    $0x1,%rax
+  8033dd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8033e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033ea:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8033ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033f2:	48 29 d0             	sub    %rdx,%rax
+  8033f5:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  8033f9:	41 89 c2             	mov    %eax,%r10d
+  8033fc:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803403:	00 00 00 
+  803406:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803409:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80340d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803411:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803414:	48 83 ec 08          	sub    $0x8,%rsp
+  803418:	6a 40                	push   $0x40
+  80341a:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  80341f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  803426:	00 
+  803427:	6a 05                	push   $0x5
+  803429:	41 89 f9             	mov    %edi,%r9d
+  80342c:	49 89 c8             	mov    %rcx,%r8
+  80342f:	44 89 d1             	mov    %r10d,%ecx
+  803432:	89 c7                	mov    %eax,%edi
+  803434:	49 89 df             	mov    %rbx,%r15
+  803437:	48 b8 84 d9 ff ff ff 	movabs $0xffffffffffffd984,%rax
+  80343e:	ff ff ff 
+  803441:	48 01 d8             	add    %rbx,%rax
+  803444:	ff d0                	call   *%rax
+  803446:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80344a:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80344e:	5b                   	pop    %rbx
+  80344f:	41 5f                	pop    %r15
+  803451:	5d                   	pop    %rbp
+  803452:	c3                   	ret
+
+0000000000803453 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  803453:	55                   	push   %rbp
+  803454:	48 89 e5             	mov    %rsp,%rbp
+  803457:	41 57                	push   %r15
+  803459:	53                   	push   %rbx
+  80345a:	48 83 ec 20          	sub    $0x20,%rsp
+  80345e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80345e <open+0xb>
+  803465:	49 bb d2 4b 00 00 00 	movabs $0x4bd2,%r11
+  80346c:	00 00 00 
+  80346f:	4c 01 db             	add    %r11,%rbx
+  803472:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803476:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  803479:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80347d:	48 89 c7             	mov    %rax,%rdi
+  803480:	49 89 df             	mov    %rbx,%r15
+  803483:	48 b8 e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%rax
+  80348a:	ff ff ff 
+  80348d:	48 01 d8             	add    %rbx,%rax
+  803490:	ff d0                	call   *%rax
+  803492:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803497:	7e 0a                	jle    8034a3 <open+0x50>
+		return -E_BAD_PATH;
+  803499:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80349e:	e9 18 01 00 00       	jmp    8035bb <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8034a3:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8034a7:	48 89 c7             	mov    %rax,%rdi
+  8034aa:	49 89 df             	mov    %rbx,%r15
+  8034ad:	48 b8 57 a6 ff ff ff 	movabs $0xffffffffffffa657,%rax
+  8034b4:	ff ff ff 
+  8034b7:	48 01 d8             	add    %rbx,%rax
+  8034ba:	ff d0                	call   *%rax
+  8034bc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034bf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034c3:	74 08                	je     8034cd <open+0x7a>
+		return r;
+  8034c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034c8:	e9 ee 00 00 00       	jmp    8035bb <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  8034cd:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8034d4:	00 00 00 
+  8034d7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8034da:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  8034e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034e5:	48 89 c6             	mov    %rax,%rsi
+  8034e8:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  8034ef:	00 00 00 
+  8034f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034f6:	48 89 c7             	mov    %rax,%rdi
+  8034f9:	49 89 df             	mov    %rbx,%r15
+  8034fc:	48 b8 78 91 ff ff ff 	movabs $0xffffffffffff9178,%rax
+  803503:	ff ff ff 
+  803506:	48 01 d8             	add    %rbx,%rax
+  803509:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  80350b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80350f:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  803514:	48 89 c6             	mov    %rax,%rsi
+  803517:	bf 00 00 00 00       	mov    $0x0,%edi
+  80351c:	49 89 df             	mov    %rbx,%r15
+  80351f:	48 b8 34 9e ff ff ff 	movabs $0xffffffffffff9e34,%rax
+  803526:	ff ff ff 
+  803529:	48 01 d8             	add    %rbx,%rax
+  80352c:	ff d0                	call   *%rax
+  80352e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803531:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803535:	74 23                	je     80355a <open+0x107>
+		fd_close(fd,0);
+  803537:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80353b:	be 00 00 00 00       	mov    $0x0,%esi
+  803540:	48 89 c7             	mov    %rax,%rdi
+  803543:	49 89 df             	mov    %rbx,%r15
+  803546:	48 b8 b8 a7 ff ff ff 	movabs $0xffffffffffffa7b8,%rax
+  80354d:	ff ff ff 
+  803550:	48 01 d8             	add    %rbx,%rax
+  803553:	ff d0                	call   *%rax
+		return r;
+  803555:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803558:	eb 61                	jmp    8035bb <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  80355a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80355e:	48 89 c6             	mov    %rax,%rsi
+  803561:	bf 01 00 00 00       	mov    $0x1,%edi
+  803566:	48 b8 dc b1 ff ff ff 	movabs $0xffffffffffffb1dc,%rax
+  80356d:	ff ff ff 
+  803570:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803574:	ff d0                	call   *%rax
+  803576:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803579:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80357d:	74 23                	je     8035a2 <open+0x14f>
+		fd_close(fd,0);
+  80357f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803583:	be 00 00 00 00       	mov    $0x0,%esi
+  803588:	48 89 c7             	mov    %rax,%rdi
+  80358b:	49 89 df             	mov    %rbx,%r15
+  80358e:	48 b8 b8 a7 ff ff ff 	movabs $0xffffffffffffa7b8,%rax
+  803595:	ff ff ff 
+  803598:	48 01 d8             	add    %rbx,%rax
+  80359b:	ff d0                	call   *%rax
+		return r;
+  80359d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8035a0:	eb 19                	jmp    8035bb <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8035a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035a6:	48 89 c7             	mov    %rax,%rdi
+  8035a9:	49 89 df             	mov    %rbx,%r15
+  8035ac:	48 b8 dd a5 ff ff ff 	movabs $0xffffffffffffa5dd,%rax
+  8035b3:	ff ff ff 
+  8035b6:	48 01 d8             	add    %rbx,%rax
+  8035b9:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8035bb:	48 83 c4 20          	add    $0x20,%rsp
+  8035bf:	5b                   	pop    %rbx
+  8035c0:	41 5f                	pop    %r15
+  8035c2:	5d                   	pop    %rbp
+  8035c3:	c3                   	ret
+
+00000000008035c4 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8035c4:	55                   	push   %rbp
+  8035c5:	48 89 e5             	mov    %rsp,%rbp
+  8035c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8035cc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8035cc <devfile_flush+0x8>
+  8035d3:	49 bb 64 4a 00 00 00 	movabs $0x4a64,%r11
+  8035da:	00 00 00 
+  8035dd:	4c 01 d8             	add    %r11,%rax
+  8035e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8035e4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8035e8:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8035eb:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  8035ee:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8035f2:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035f7:	48 89 ce             	mov    %rcx,%rsi
+  8035fa:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035ff:	48 b9 84 b2 ff ff ff 	movabs $0xffffffffffffb284,%rcx
+  803606:	ff ff ff 
+  803609:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80360d:	ff d0                	call   *%rax
+}
+  80360f:	c9                   	leave
+  803610:	c3                   	ret
+
+0000000000803611 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803611:	55                   	push   %rbp
+  803612:	48 89 e5             	mov    %rsp,%rbp
+  803615:	41 57                	push   %r15
+  803617:	53                   	push   %rbx
+  803618:	48 83 ec 60          	sub    $0x60,%rsp
+  80361c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80361c <devfile_read+0xb>
+  803623:	49 bb 14 4a 00 00 00 	movabs $0x4a14,%r11
+  80362a:	00 00 00 
+  80362d:	4c 01 db             	add    %r11,%rbx
+  803630:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803634:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803638:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80363c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803640:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  803644:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803648:	8b 50 0c             	mov    0xc(%rax),%edx
+  80364b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80364f:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803651:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803655:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  803659:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  80365d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803661:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803666:	ba 10 00 00 00       	mov    $0x10,%edx
+  80366b:	48 89 c6             	mov    %rax,%rsi
+  80366e:	bf 03 00 00 00       	mov    $0x3,%edi
+  803673:	48 b8 18 b3 ff ff ff 	movabs $0xffffffffffffb318,%rax
+  80367a:	ff ff ff 
+  80367d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803681:	ff d0                	call   *%rax
+  803683:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803686:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80368a:	79 05                	jns    803691 <devfile_read+0x80>
+		return r;
+  80368c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80368f:	eb 64                	jmp    8036f5 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  803691:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803694:	48 63 d0             	movslq %eax,%rdx
+  803697:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80369b:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8036a0:	48 01 c1             	add    %rax,%rcx
+  8036a3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8036a7:	48 89 ce             	mov    %rcx,%rsi
+  8036aa:	48 89 c7             	mov    %rax,%rdi
+  8036ad:	49 89 df             	mov    %rbx,%r15
+  8036b0:	48 b8 58 95 ff ff ff 	movabs $0xffffffffffff9558,%rax
+  8036b7:	ff ff ff 
+  8036ba:	48 01 d8             	add    %rbx,%rax
+  8036bd:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8036bf:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8036c6:	ff ff ff 
+  8036c9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8036cd:	48 8b 00             	mov    (%rax),%rax
+  8036d0:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8036d6:	89 c6                	mov    %eax,%esi
+  8036d8:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8036dd:	48 89 c7             	mov    %rax,%rdi
+  8036e0:	49 89 df             	mov    %rbx,%r15
+  8036e3:	48 b8 36 dd ff ff ff 	movabs $0xffffffffffffdd36,%rax
+  8036ea:	ff ff ff 
+  8036ed:	48 01 d8             	add    %rbx,%rax
+  8036f0:	ff d0                	call   *%rax
+	return r;
+  8036f2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  8036f5:	48 83 c4 60          	add    $0x60,%rsp
+  8036f9:	5b                   	pop    %rbx
+  8036fa:	41 5f                	pop    %r15
+  8036fc:	5d                   	pop    %rbp
+  8036fd:	c3                   	ret
+
+00000000008036fe <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8036fe:	55                   	push   %rbp
+  8036ff:	48 89 e5             	mov    %rsp,%rbp
+  803702:	41 57                	push   %r15
+  803704:	53                   	push   %rbx
+  803705:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803709:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803709 <devfile_write+0xb>
+  803710:	49 bb 27 49 00 00 00 	movabs $0x4927,%r11
+  803717:	00 00 00 
+  80371a:	4c 01 db             	add    %r11,%rbx
+  80371d:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803721:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803725:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  80372c:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803730:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803734:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  80373b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80373f:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803746:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803749:	48 63 d0             	movslq %eax,%rdx
+  80374c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803750:	48 39 c2             	cmp    %rax,%rdx
+  803753:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803757:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80375e:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803765:	00 
+  803766:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80376d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803771:	48 01 d0             	add    %rdx,%rax
+  803774:	48 83 e8 01          	sub    $0x1,%rax
+  803778:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80377c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803780:	ba 00 00 00 00       	mov    $0x0,%edx
+  803785:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803789:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80378d:	48 29 d0             	sub    %rdx,%rax
+  803790:	48 c1 e8 0c          	shr    $0xc,%rax
+  803794:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803797:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80379a:	89 c6                	mov    %eax,%esi
+  80379c:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8037a1:	48 89 c7             	mov    %rax,%rdi
+  8037a4:	49 89 df             	mov    %rbx,%r15
+  8037a7:	48 b8 f0 dc ff ff ff 	movabs $0xffffffffffffdcf0,%rax
+  8037ae:	ff ff ff 
+  8037b1:	48 01 d8             	add    %rbx,%rax
+  8037b4:	ff d0                	call   *%rax
+  8037b6:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8037b9:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8037bd:	79 08                	jns    8037c7 <devfile_write+0xc9>
+		return r;
+  8037bf:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8037c2:	e9 8f 00 00 00       	jmp    803856 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  8037c7:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8037ce:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  8037d2:	48 89 c6             	mov    %rax,%rsi
+  8037d5:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8037da:	48 89 c7             	mov    %rax,%rdi
+  8037dd:	49 89 df             	mov    %rbx,%r15
+  8037e0:	48 b8 58 95 ff ff ff 	movabs $0xffffffffffff9558,%rax
+  8037e7:	ff ff ff 
+  8037ea:	48 01 d8             	add    %rbx,%rax
+  8037ed:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  8037ef:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8037f3:	8b 50 0c             	mov    0xc(%rax),%edx
+  8037f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037fa:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8037fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803800:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803807:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  80380b:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80380e:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803812:	89 d1                	mov    %edx,%ecx
+  803814:	ba 10 00 00 00       	mov    $0x10,%edx
+  803819:	48 89 c6             	mov    %rax,%rsi
+  80381c:	bf 04 00 00 00       	mov    $0x4,%edi
+  803821:	48 b8 18 b3 ff ff ff 	movabs $0xffffffffffffb318,%rax
+  803828:	ff ff ff 
+  80382b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80382f:	ff d0                	call   *%rax
+  803831:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803834:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803837:	89 c6                	mov    %eax,%esi
+  803839:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80383e:	48 89 c7             	mov    %rax,%rdi
+  803841:	49 89 df             	mov    %rbx,%r15
+  803844:	48 b8 36 dd ff ff ff 	movabs $0xffffffffffffdd36,%rax
+  80384b:	ff ff ff 
+  80384e:	48 01 d8             	add    %rbx,%rax
+  803851:	ff d0                	call   *%rax
+	return r;
+  803853:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803856:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  80385a:	5b                   	pop    %rbx
+  80385b:	41 5f                	pop    %r15
+  80385d:	5d                   	pop    %rbp
+  80385e:	c3                   	ret
+
+000000000080385f <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  80385f:	55                   	push   %rbp
+  803860:	48 89 e5             	mov    %rsp,%rbp
+  803863:	41 57                	push   %r15
+  803865:	53                   	push   %rbx
+  803866:	48 83 ec 20          	sub    $0x20,%rsp
+  80386a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80386a <devfile_stat+0xb>
+  803871:	49 bb c6 47 00 00 00 	movabs $0x47c6,%r11
+  803878:	00 00 00 
+  80387b:	4c 01 db             	add    %r11,%rbx
+  80387e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803882:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803886:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80388a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80388d:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803894:	00 00 00 
+  803897:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80389a:	be 00 00 00 00       	mov    $0x0,%esi
+  80389f:	bf 05 00 00 00       	mov    $0x5,%edi
+  8038a4:	48 b8 dc b1 ff ff ff 	movabs $0xffffffffffffb1dc,%rax
+  8038ab:	ff ff ff 
+  8038ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038b2:	ff d0                	call   *%rax
+  8038b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8038b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038bb:	79 05                	jns    8038c2 <devfile_stat+0x63>
+		return r;
+  8038bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038c0:	eb 65                	jmp    803927 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8038c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038c6:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8038cd:	00 00 00 
+  8038d0:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8038d4:	48 89 d6             	mov    %rdx,%rsi
+  8038d7:	48 89 c7             	mov    %rax,%rdi
+  8038da:	49 89 df             	mov    %rbx,%r15
+  8038dd:	48 b8 78 91 ff ff ff 	movabs $0xffffffffffff9178,%rax
+  8038e4:	ff ff ff 
+  8038e7:	48 01 d8             	add    %rbx,%rax
+  8038ea:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8038ec:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  8038f3:	00 00 00 
+  8038f6:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  8038fd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803901:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803907:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  80390e:	00 00 00 
+  803911:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803918:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80391c:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803922:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803927:	48 83 c4 20          	add    $0x20,%rsp
+  80392b:	5b                   	pop    %rbx
+  80392c:	41 5f                	pop    %r15
+  80392e:	5d                   	pop    %rbp
+  80392f:	c3                   	ret
+
+0000000000803930 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803930:	55                   	push   %rbp
+  803931:	48 89 e5             	mov    %rsp,%rbp
+  803934:	48 83 ec 20          	sub    $0x20,%rsp
+  803938:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803938 <devfile_trunc+0x8>
+  80393f:	49 bb f8 46 00 00 00 	movabs $0x46f8,%r11
+  803946:	00 00 00 
+  803949:	4c 01 d8             	add    %r11,%rax
+  80394c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803950:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803953:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803957:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80395a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  80395d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803960:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803963:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803967:	ba 08 00 00 00       	mov    $0x8,%edx
+  80396c:	48 89 ce             	mov    %rcx,%rsi
+  80396f:	bf 02 00 00 00       	mov    $0x2,%edi
+  803974:	48 b9 84 b2 ff ff ff 	movabs $0xffffffffffffb284,%rcx
+  80397b:	ff ff ff 
+  80397e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803982:	ff d0                	call   *%rax
+}
+  803984:	c9                   	leave
+  803985:	c3                   	ret
+
+0000000000803986 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803986:	55                   	push   %rbp
+  803987:	48 89 e5             	mov    %rsp,%rbp
+  80398a:	41 57                	push   %r15
+  80398c:	53                   	push   %rbx
+  80398d:	48 83 ec 10          	sub    $0x10,%rsp
+  803991:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803991 <remove+0xb>
+  803998:	49 bb 9f 46 00 00 00 	movabs $0x469f,%r11
+  80399f:	00 00 00 
+  8039a2:	4c 01 db             	add    %r11,%rbx
+  8039a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8039a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039ad:	48 89 c7             	mov    %rax,%rdi
+  8039b0:	49 89 df             	mov    %rbx,%r15
+  8039b3:	48 b8 e4 90 ff ff ff 	movabs $0xffffffffffff90e4,%rax
+  8039ba:	ff ff ff 
+  8039bd:	48 01 d8             	add    %rbx,%rax
+  8039c0:	ff d0                	call   *%rax
+  8039c2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8039c7:	7e 07                	jle    8039d0 <remove+0x4a>
+		return -E_BAD_PATH;
+  8039c9:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8039ce:	eb 44                	jmp    803a14 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8039d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039d4:	48 89 c6             	mov    %rax,%rsi
+  8039d7:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  8039de:	00 00 00 
+  8039e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039e5:	48 89 c7             	mov    %rax,%rdi
+  8039e8:	49 89 df             	mov    %rbx,%r15
+  8039eb:	48 b8 78 91 ff ff ff 	movabs $0xffffffffffff9178,%rax
+  8039f2:	ff ff ff 
+  8039f5:	48 01 d8             	add    %rbx,%rax
+  8039f8:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  8039fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8039ff:	bf 07 00 00 00       	mov    $0x7,%edi
+  803a04:	48 b8 dc b1 ff ff ff 	movabs $0xffffffffffffb1dc,%rax
+  803a0b:	ff ff ff 
+  803a0e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a12:	ff d0                	call   *%rax
+}
+  803a14:	48 83 c4 10          	add    $0x10,%rsp
+  803a18:	5b                   	pop    %rbx
+  803a19:	41 5f                	pop    %r15
+  803a1b:	5d                   	pop    %rbp
+  803a1c:	c3                   	ret
+
+0000000000803a1d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803a1d:	55                   	push   %rbp
+  803a1e:	48 89 e5             	mov    %rsp,%rbp
+  803a21:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803a21 <sync+0x4>
+  803a28:	49 bb 0f 46 00 00 00 	movabs $0x460f,%r11
+  803a2f:	00 00 00 
+  803a32:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803a35:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a3a:	be 00 00 00 00       	mov    $0x0,%esi
+  803a3f:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a44:	48 b9 84 b2 ff ff ff 	movabs $0xffffffffffffb284,%rcx
+  803a4b:	ff ff ff 
+  803a4e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803a52:	ff d0                	call   *%rax
+}
+  803a54:	5d                   	pop    %rbp
+  803a55:	c3                   	ret
+
+0000000000803a56 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803a56:	55                   	push   %rbp
+  803a57:	48 89 e5             	mov    %rsp,%rbp
+  803a5a:	41 57                	push   %r15
+  803a5c:	53                   	push   %rbx
+  803a5d:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803a64:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a64 <copy+0xe>
+  803a6b:	49 bb cc 45 00 00 00 	movabs $0x45cc,%r11
+  803a72:	00 00 00 
+  803a75:	4c 01 db             	add    %r11,%rbx
+  803a78:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803a7f:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803a86:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803a8d:	be 00 00 00 00       	mov    $0x0,%esi
+  803a92:	48 89 c7             	mov    %rax,%rdi
+  803a95:	48 b8 23 b4 ff ff ff 	movabs $0xffffffffffffb423,%rax
+  803a9c:	ff ff ff 
+  803a9f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803aa3:	ff d0                	call   *%rax
+  803aa5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803aa8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803aac:	79 35                	jns    803ae3 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803aae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ab1:	89 c6                	mov    %eax,%esi
+  803ab3:	48 b8 fe e3 ff ff ff 	movabs $0xffffffffffffe3fe,%rax
+  803aba:	ff ff ff 
+  803abd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ac1:	48 89 c7             	mov    %rax,%rdi
+  803ac4:	49 89 df             	mov    %rbx,%r15
+  803ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803acc:	48 ba b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%rdx
+  803ad3:	ff ff ff 
+  803ad6:	48 01 da             	add    %rbx,%rdx
+  803ad9:	ff d2                	call   *%rdx
+		return fd_src;
+  803adb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ade:	e9 d7 01 00 00       	jmp    803cba <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803ae3:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803aea:	be 01 01 00 00       	mov    $0x101,%esi
+  803aef:	48 89 c7             	mov    %rax,%rdi
+  803af2:	48 b8 23 b4 ff ff ff 	movabs $0xffffffffffffb423,%rax
+  803af9:	ff ff ff 
+  803afc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b00:	ff d0                	call   *%rax
+  803b02:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803b05:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803b09:	0f 89 df 00 00 00    	jns    803bee <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803b0f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803b12:	89 c6                	mov    %eax,%esi
+  803b14:	48 b8 14 e4 ff ff ff 	movabs $0xffffffffffffe414,%rax
+  803b1b:	ff ff ff 
+  803b1e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b22:	48 89 c7             	mov    %rax,%rdi
+  803b25:	49 89 df             	mov    %rbx,%r15
+  803b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2d:	48 ba b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%rdx
+  803b34:	ff ff ff 
+  803b37:	48 01 da             	add    %rbx,%rdx
+  803b3a:	ff d2                	call   *%rdx
+		close(fd_src);
+  803b3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b3f:	89 c7                	mov    %eax,%edi
+  803b41:	49 89 df             	mov    %rbx,%r15
+  803b44:	48 b8 9c a9 ff ff ff 	movabs $0xffffffffffffa99c,%rax
+  803b4b:	ff ff ff 
+  803b4e:	48 01 d8             	add    %rbx,%rax
+  803b51:	ff d0                	call   *%rax
+		return fd_dest;
+  803b53:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803b56:	e9 5f 01 00 00       	jmp    803cba <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803b5b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b5e:	48 63 d0             	movslq %eax,%rdx
+  803b61:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803b68:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803b6b:	48 89 ce             	mov    %rcx,%rsi
+  803b6e:	89 c7                	mov    %eax,%edi
+  803b70:	49 89 df             	mov    %rbx,%r15
+  803b73:	48 b8 fa ad ff ff ff 	movabs $0xffffffffffffadfa,%rax
+  803b7a:	ff ff ff 
+  803b7d:	48 01 d8             	add    %rbx,%rax
+  803b80:	ff d0                	call   *%rax
+  803b82:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803b85:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803b89:	79 63                	jns    803bee <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803b8b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803b8e:	89 c6                	mov    %eax,%esi
+  803b90:	48 b8 2e e4 ff ff ff 	movabs $0xffffffffffffe42e,%rax
+  803b97:	ff ff ff 
+  803b9a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b9e:	48 89 c7             	mov    %rax,%rdi
+  803ba1:	49 89 df             	mov    %rbx,%r15
+  803ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ba9:	48 ba b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%rdx
+  803bb0:	ff ff ff 
+  803bb3:	48 01 da             	add    %rbx,%rdx
+  803bb6:	ff d2                	call   *%rdx
+			close(fd_src);
+  803bb8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bbb:	89 c7                	mov    %eax,%edi
+  803bbd:	49 89 df             	mov    %rbx,%r15
+  803bc0:	48 b8 9c a9 ff ff ff 	movabs $0xffffffffffffa99c,%rax
+  803bc7:	ff ff ff 
+  803bca:	48 01 d8             	add    %rbx,%rax
+  803bcd:	ff d0                	call   *%rax
+			close(fd_dest);
+  803bcf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803bd2:	89 c7                	mov    %eax,%edi
+  803bd4:	49 89 df             	mov    %rbx,%r15
+  803bd7:	48 b8 9c a9 ff ff ff 	movabs $0xffffffffffffa99c,%rax
+  803bde:	ff ff ff 
+  803be1:	48 01 d8             	add    %rbx,%rax
+  803be4:	ff d0                	call   *%rax
+			return write_size;
+  803be6:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803be9:	e9 cc 00 00 00       	jmp    803cba <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803bee:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803bf5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bf8:	ba 00 02 00 00       	mov    $0x200,%edx
+  803bfd:	48 89 ce             	mov    %rcx,%rsi
+  803c00:	89 c7                	mov    %eax,%edi
+  803c02:	49 89 df             	mov    %rbx,%r15
+  803c05:	48 b8 54 ac ff ff ff 	movabs $0xffffffffffffac54,%rax
+  803c0c:	ff ff ff 
+  803c0f:	48 01 d8             	add    %rbx,%rax
+  803c12:	ff d0                	call   *%rax
+  803c14:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803c17:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803c1b:	0f 8f 3a ff ff ff    	jg     803b5b <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803c21:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803c25:	79 60                	jns    803c87 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803c27:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c2a:	89 c6                	mov    %eax,%esi
+  803c2c:	48 b8 41 e4 ff ff ff 	movabs $0xffffffffffffe441,%rax
+  803c33:	ff ff ff 
+  803c36:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c3a:	48 89 c7             	mov    %rax,%rdi
+  803c3d:	49 89 df             	mov    %rbx,%r15
+  803c40:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c45:	48 ba b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%rdx
+  803c4c:	ff ff ff 
+  803c4f:	48 01 da             	add    %rbx,%rdx
+  803c52:	ff d2                	call   *%rdx
+		close(fd_src);
+  803c54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c57:	89 c7                	mov    %eax,%edi
+  803c59:	49 89 df             	mov    %rbx,%r15
+  803c5c:	48 b8 9c a9 ff ff ff 	movabs $0xffffffffffffa99c,%rax
+  803c63:	ff ff ff 
+  803c66:	48 01 d8             	add    %rbx,%rax
+  803c69:	ff d0                	call   *%rax
+		close(fd_dest);
+  803c6b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803c6e:	89 c7                	mov    %eax,%edi
+  803c70:	49 89 df             	mov    %rbx,%r15
+  803c73:	48 b8 9c a9 ff ff ff 	movabs $0xffffffffffffa99c,%rax
+  803c7a:	ff ff ff 
+  803c7d:	48 01 d8             	add    %rbx,%rax
+  803c80:	ff d0                	call   *%rax
+		return read_size;
+  803c82:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c85:	eb 33                	jmp    803cba <copy+0x264>
+	}
+	close(fd_src);
+  803c87:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c8a:	89 c7                	mov    %eax,%edi
+  803c8c:	49 89 df             	mov    %rbx,%r15
+  803c8f:	48 b8 9c a9 ff ff ff 	movabs $0xffffffffffffa99c,%rax
+  803c96:	ff ff ff 
+  803c99:	48 01 d8             	add    %rbx,%rax
+  803c9c:	ff d0                	call   *%rax
+	close(fd_dest);
+  803c9e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ca1:	89 c7                	mov    %eax,%edi
+  803ca3:	49 89 df             	mov    %rbx,%r15
+  803ca6:	48 b8 9c a9 ff ff ff 	movabs $0xffffffffffffa99c,%rax
+  803cad:	ff ff ff 
+  803cb0:	48 01 d8             	add    %rbx,%rax
+  803cb3:	ff d0                	call   *%rax
+	return 0;
+  803cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  803cba:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  803cc1:	5b                   	pop    %rbx
+  803cc2:	41 5f                	pop    %r15
+  803cc4:	5d                   	pop    %rbp
+  803cc5:	c3                   	ret
+
+0000000000803cc6 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  803cc6:	55                   	push   %rbp
+  803cc7:	48 89 e5             	mov    %rsp,%rbp
+  803cca:	41 57                	push   %r15
+  803ccc:	53                   	push   %rbx
+  803ccd:	48 83 ec 20          	sub    $0x20,%rsp
+  803cd1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cd1 <fd2sockid+0xb>
+  803cd8:	49 bb 5f 43 00 00 00 	movabs $0x435f,%r11
+  803cdf:	00 00 00 
+  803ce2:	4c 01 db             	add    %r11,%rbx
+  803ce5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803ce8:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803cec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cef:	48 89 d6             	mov    %rdx,%rsi
+  803cf2:	89 c7                	mov    %eax,%edi
+  803cf4:	49 89 df             	mov    %rbx,%r15
+  803cf7:	48 b8 0d a7 ff ff ff 	movabs $0xffffffffffffa70d,%rax
+  803cfe:	ff ff ff 
+  803d01:	48 01 d8             	add    %rbx,%rax
+  803d04:	ff d0                	call   *%rax
+  803d06:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d09:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d0d:	79 05                	jns    803d14 <fd2sockid+0x4e>
+		return r;
+  803d0f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d12:	eb 25                	jmp    803d39 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803d14:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d18:	8b 10                	mov    (%rax),%edx
+  803d1a:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  803d21:	00 00 00 
+  803d24:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803d27:	39 c2                	cmp    %eax,%edx
+  803d29:	74 07                	je     803d32 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  803d2b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803d30:	eb 07                	jmp    803d39 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  803d32:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d36:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  803d39:	48 83 c4 20          	add    $0x20,%rsp
+  803d3d:	5b                   	pop    %rbx
+  803d3e:	41 5f                	pop    %r15
+  803d40:	5d                   	pop    %rbp
+  803d41:	c3                   	ret
+
+0000000000803d42 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  803d42:	55                   	push   %rbp
+  803d43:	48 89 e5             	mov    %rsp,%rbp
+  803d46:	41 57                	push   %r15
+  803d48:	53                   	push   %rbx
+  803d49:	48 83 ec 20          	sub    $0x20,%rsp
+  803d4d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d4d <alloc_sockfd+0xb>
+  803d54:	49 bb e3 42 00 00 00 	movabs $0x42e3,%r11
+  803d5b:	00 00 00 
+  803d5e:	4c 01 db             	add    %r11,%rbx
+  803d61:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  803d64:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803d68:	48 89 c7             	mov    %rax,%rdi
+  803d6b:	49 89 df             	mov    %rbx,%r15
+  803d6e:	48 b8 57 a6 ff ff ff 	movabs $0xffffffffffffa657,%rax
+  803d75:	ff ff ff 
+  803d78:	48 01 d8             	add    %rbx,%rax
+  803d7b:	ff d0                	call   *%rax
+  803d7d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d80:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d84:	78 2c                	js     803db2 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803d86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d8a:	ba 07 04 00 00       	mov    $0x407,%edx
+  803d8f:	48 89 c6             	mov    %rax,%rsi
+  803d92:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d97:	49 89 df             	mov    %rbx,%r15
+  803d9a:	48 b8 34 9e ff ff ff 	movabs $0xffffffffffff9e34,%rax
+  803da1:	ff ff ff 
+  803da4:	48 01 d8             	add    %rbx,%rax
+  803da7:	ff d0                	call   *%rax
+  803da9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803dac:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803db0:	79 1c                	jns    803dce <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  803db2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803db5:	89 c7                	mov    %eax,%edi
+  803db7:	49 89 df             	mov    %rbx,%r15
+  803dba:	48 b8 06 c5 ff ff ff 	movabs $0xffffffffffffc506,%rax
+  803dc1:	ff ff ff 
+  803dc4:	48 01 d8             	add    %rbx,%rax
+  803dc7:	ff d0                	call   *%rax
+		return r;
+  803dc9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dcc:	eb 41                	jmp    803e0f <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  803dce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dd2:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  803dd9:	00 00 00 
+  803ddc:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  803ddf:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  803de1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803de5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  803dec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803df0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803df3:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  803df6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dfa:	48 89 c7             	mov    %rax,%rdi
+  803dfd:	49 89 df             	mov    %rbx,%r15
+  803e00:	48 b8 dd a5 ff ff ff 	movabs $0xffffffffffffa5dd,%rax
+  803e07:	ff ff ff 
+  803e0a:	48 01 d8             	add    %rbx,%rax
+  803e0d:	ff d0                	call   *%rax
+}
+  803e0f:	48 83 c4 20          	add    $0x20,%rsp
+  803e13:	5b                   	pop    %rbx
+  803e14:	41 5f                	pop    %r15
+  803e16:	5d                   	pop    %rbp
+  803e17:	c3                   	ret
+
+0000000000803e18 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803e18:	55                   	push   %rbp
+  803e19:	48 89 e5             	mov    %rsp,%rbp
+  803e1c:	41 57                	push   %r15
+  803e1e:	53                   	push   %rbx
+  803e1f:	48 83 ec 30          	sub    $0x30,%rsp
+  803e23:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e23 <accept+0xb>
+  803e2a:	49 bb 0d 42 00 00 00 	movabs $0x420d,%r11
+  803e31:	00 00 00 
+  803e34:	4c 01 db             	add    %r11,%rbx
+  803e37:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803e3a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803e3e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  803e42:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e45:	89 c7                	mov    %eax,%edi
+  803e47:	48 b8 96 bc ff ff ff 	movabs $0xffffffffffffbc96,%rax
+  803e4e:	ff ff ff 
+  803e51:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e55:	ff d0                	call   *%rax
+  803e57:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e5a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e5e:	79 05                	jns    803e65 <accept+0x4d>
+		return r;
+  803e60:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e63:	eb 45                	jmp    803eaa <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803e65:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803e69:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803e6d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e70:	48 89 ce             	mov    %rcx,%rsi
+  803e73:	89 c7                	mov    %eax,%edi
+  803e75:	49 89 df             	mov    %rbx,%r15
+  803e78:	48 b8 74 c3 ff ff ff 	movabs $0xffffffffffffc374,%rax
+  803e7f:	ff ff ff 
+  803e82:	48 01 d8             	add    %rbx,%rax
+  803e85:	ff d0                	call   *%rax
+  803e87:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e8a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e8e:	79 05                	jns    803e95 <accept+0x7d>
+		return r;
+  803e90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e93:	eb 15                	jmp    803eaa <accept+0x92>
+	return alloc_sockfd(r);
+  803e95:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e98:	89 c7                	mov    %eax,%edi
+  803e9a:	48 b8 12 bd ff ff ff 	movabs $0xffffffffffffbd12,%rax
+  803ea1:	ff ff ff 
+  803ea4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ea8:	ff d0                	call   *%rax
+}
+  803eaa:	48 83 c4 30          	add    $0x30,%rsp
+  803eae:	5b                   	pop    %rbx
+  803eaf:	41 5f                	pop    %r15
+  803eb1:	5d                   	pop    %rbp
+  803eb2:	c3                   	ret
+
+0000000000803eb3 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803eb3:	55                   	push   %rbp
+  803eb4:	48 89 e5             	mov    %rsp,%rbp
+  803eb7:	41 57                	push   %r15
+  803eb9:	53                   	push   %rbx
+  803eba:	48 83 ec 20          	sub    $0x20,%rsp
+  803ebe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ebe <bind+0xb>
+  803ec5:	49 bb 72 41 00 00 00 	movabs $0x4172,%r11
+  803ecc:	00 00 00 
+  803ecf:	4c 01 db             	add    %r11,%rbx
+  803ed2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803ed5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803ed9:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  803edc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803edf:	89 c7                	mov    %eax,%edi
+  803ee1:	48 b8 96 bc ff ff ff 	movabs $0xffffffffffffbc96,%rax
+  803ee8:	ff ff ff 
+  803eeb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803eef:	ff d0                	call   *%rax
+  803ef1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ef4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ef8:	79 05                	jns    803eff <bind+0x4c>
+		return r;
+  803efa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803efd:	eb 21                	jmp    803f20 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  803eff:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803f02:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803f06:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f09:	48 89 ce             	mov    %rcx,%rsi
+  803f0c:	89 c7                	mov    %eax,%edi
+  803f0e:	49 89 df             	mov    %rbx,%r15
+  803f11:	48 b8 20 c4 ff ff ff 	movabs $0xffffffffffffc420,%rax
+  803f18:	ff ff ff 
+  803f1b:	48 01 d8             	add    %rbx,%rax
+  803f1e:	ff d0                	call   *%rax
+}
+  803f20:	48 83 c4 20          	add    $0x20,%rsp
+  803f24:	5b                   	pop    %rbx
+  803f25:	41 5f                	pop    %r15
+  803f27:	5d                   	pop    %rbp
+  803f28:	c3                   	ret
+
+0000000000803f29 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  803f29:	55                   	push   %rbp
+  803f2a:	48 89 e5             	mov    %rsp,%rbp
+  803f2d:	41 57                	push   %r15
+  803f2f:	53                   	push   %rbx
+  803f30:	48 83 ec 20          	sub    $0x20,%rsp
+  803f34:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f34 <shutdown+0xb>
+  803f3b:	49 bb fc 40 00 00 00 	movabs $0x40fc,%r11
+  803f42:	00 00 00 
+  803f45:	4c 01 db             	add    %r11,%rbx
+  803f48:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803f4b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  803f4e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f51:	89 c7                	mov    %eax,%edi
+  803f53:	48 b8 96 bc ff ff ff 	movabs $0xffffffffffffbc96,%rax
+  803f5a:	ff ff ff 
+  803f5d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f61:	ff d0                	call   *%rax
+  803f63:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f66:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f6a:	79 05                	jns    803f71 <shutdown+0x48>
+		return r;
+  803f6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f6f:	eb 1c                	jmp    803f8d <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  803f71:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803f74:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f77:	89 d6                	mov    %edx,%esi
+  803f79:	89 c7                	mov    %eax,%edi
+  803f7b:	49 89 df             	mov    %rbx,%r15
+  803f7e:	48 b8 b5 c4 ff ff ff 	movabs $0xffffffffffffc4b5,%rax
+  803f85:	ff ff ff 
+  803f88:	48 01 d8             	add    %rbx,%rax
+  803f8b:	ff d0                	call   *%rax
+}
+  803f8d:	48 83 c4 20          	add    $0x20,%rsp
+  803f91:	5b                   	pop    %rbx
+  803f92:	41 5f                	pop    %r15
+  803f94:	5d                   	pop    %rbp
+  803f95:	c3                   	ret
+
+0000000000803f96 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  803f96:	55                   	push   %rbp
+  803f97:	48 89 e5             	mov    %rsp,%rbp
+  803f9a:	41 57                	push   %r15
+  803f9c:	53                   	push   %rbx
+  803f9d:	48 83 ec 10          	sub    $0x10,%rsp
+  803fa1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803fa1 <devsock_close+0xb>
+  803fa8:	49 bb 8f 40 00 00 00 	movabs $0x408f,%r11
+  803faf:	00 00 00 
+  803fb2:	4c 01 db             	add    %r11,%rbx
+  803fb5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  803fb9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fbd:	48 89 c7             	mov    %rax,%rdi
+  803fc0:	49 89 df             	mov    %rbx,%r15
+  803fc3:	48 b8 0b de ff ff ff 	movabs $0xffffffffffffde0b,%rax
+  803fca:	ff ff ff 
+  803fcd:	48 01 d8             	add    %rbx,%rax
+  803fd0:	ff d0                	call   *%rax
+  803fd2:	83 f8 01             	cmp    $0x1,%eax
+  803fd5:	75 1d                	jne    803ff4 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  803fd7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fdb:	8b 40 0c             	mov    0xc(%rax),%eax
+  803fde:	89 c7                	mov    %eax,%edi
+  803fe0:	49 89 df             	mov    %rbx,%r15
+  803fe3:	48 b8 06 c5 ff ff ff 	movabs $0xffffffffffffc506,%rax
+  803fea:	ff ff ff 
+  803fed:	48 01 d8             	add    %rbx,%rax
+  803ff0:	ff d0                	call   *%rax
+  803ff2:	eb 05                	jmp    803ff9 <devsock_close+0x63>
+	else
+		return 0;
+  803ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ff9:	48 83 c4 10          	add    $0x10,%rsp
+  803ffd:	5b                   	pop    %rbx
+  803ffe:	41 5f                	pop    %r15
+  804000:	5d                   	pop    %rbp
+  804001:	c3                   	ret
+
+0000000000804002 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804002:	55                   	push   %rbp
+  804003:	48 89 e5             	mov    %rsp,%rbp
+  804006:	41 57                	push   %r15
+  804008:	53                   	push   %rbx
+  804009:	48 83 ec 20          	sub    $0x20,%rsp
+  80400d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80400d <connect+0xb>
+  804014:	49 bb 23 40 00 00 00 	movabs $0x4023,%r11
+  80401b:	00 00 00 
+  80401e:	4c 01 db             	add    %r11,%rbx
+  804021:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804024:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804028:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80402b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80402e:	89 c7                	mov    %eax,%edi
+  804030:	48 b8 96 bc ff ff ff 	movabs $0xffffffffffffbc96,%rax
+  804037:	ff ff ff 
+  80403a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80403e:	ff d0                	call   *%rax
+  804040:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804043:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804047:	79 05                	jns    80404e <connect+0x4c>
+		return r;
+  804049:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80404c:	eb 21                	jmp    80406f <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  80404e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804051:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804055:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804058:	48 89 ce             	mov    %rcx,%rsi
+  80405b:	89 c7                	mov    %eax,%edi
+  80405d:	49 89 df             	mov    %rbx,%r15
+  804060:	48 b8 4e c5 ff ff ff 	movabs $0xffffffffffffc54e,%rax
+  804067:	ff ff ff 
+  80406a:	48 01 d8             	add    %rbx,%rax
+  80406d:	ff d0                	call   *%rax
+}
+  80406f:	48 83 c4 20          	add    $0x20,%rsp
+  804073:	5b                   	pop    %rbx
+  804074:	41 5f                	pop    %r15
+  804076:	5d                   	pop    %rbp
+  804077:	c3                   	ret
+
+0000000000804078 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804078:	55                   	push   %rbp
+  804079:	48 89 e5             	mov    %rsp,%rbp
+  80407c:	41 57                	push   %r15
+  80407e:	53                   	push   %rbx
+  80407f:	48 83 ec 20          	sub    $0x20,%rsp
+  804083:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804083 <listen+0xb>
+  80408a:	49 bb ad 3f 00 00 00 	movabs $0x3fad,%r11
+  804091:	00 00 00 
+  804094:	4c 01 db             	add    %r11,%rbx
+  804097:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80409a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80409d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040a0:	89 c7                	mov    %eax,%edi
+  8040a2:	48 b8 96 bc ff ff ff 	movabs $0xffffffffffffbc96,%rax
+  8040a9:	ff ff ff 
+  8040ac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040b0:	ff d0                	call   *%rax
+  8040b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040b9:	79 05                	jns    8040c0 <listen+0x48>
+		return r;
+  8040bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040be:	eb 1c                	jmp    8040dc <listen+0x64>
+	return nsipc_listen(r, backlog);
+  8040c0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8040c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040c6:	89 d6                	mov    %edx,%esi
+  8040c8:	89 c7                	mov    %eax,%edi
+  8040ca:	49 89 df             	mov    %rbx,%r15
+  8040cd:	48 b8 e3 c5 ff ff ff 	movabs $0xffffffffffffc5e3,%rax
+  8040d4:	ff ff ff 
+  8040d7:	48 01 d8             	add    %rbx,%rax
+  8040da:	ff d0                	call   *%rax
+}
+  8040dc:	48 83 c4 20          	add    $0x20,%rsp
+  8040e0:	5b                   	pop    %rbx
+  8040e1:	41 5f                	pop    %r15
+  8040e3:	5d                   	pop    %rbp
+  8040e4:	c3                   	ret
+
+00000000008040e5 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  8040e5:	55                   	push   %rbp
+  8040e6:	48 89 e5             	mov    %rsp,%rbp
+  8040e9:	41 57                	push   %r15
+  8040eb:	48 83 ec 28          	sub    $0x28,%rsp
+  8040ef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8040ef <devsock_read+0xa>
+  8040f6:	49 bb 41 3f 00 00 00 	movabs $0x3f41,%r11
+  8040fd:	00 00 00 
+  804100:	4c 01 d8             	add    %r11,%rax
+  804103:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804107:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80410b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80410f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804113:	41 89 d0             	mov    %edx,%r8d
+  804116:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80411a:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80411d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804121:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804126:	44 89 c2             	mov    %r8d,%edx
+  804129:	49 89 c7             	mov    %rax,%r15
+  80412c:	49 b8 34 c6 ff ff ff 	movabs $0xffffffffffffc634,%r8
+  804133:	ff ff ff 
+  804136:	49 01 c0             	add    %rax,%r8
+  804139:	41 ff d0             	call   *%r8
+}
+  80413c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804140:	c9                   	leave
+  804141:	c3                   	ret
+
+0000000000804142 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804142:	55                   	push   %rbp
+  804143:	48 89 e5             	mov    %rsp,%rbp
+  804146:	41 57                	push   %r15
+  804148:	48 83 ec 28          	sub    $0x28,%rsp
+  80414c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80414c <devsock_write+0xa>
+  804153:	49 bb e4 3e 00 00 00 	movabs $0x3ee4,%r11
+  80415a:	00 00 00 
+  80415d:	4c 01 d8             	add    %r11,%rax
+  804160:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804164:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804168:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80416c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804170:	41 89 d0             	mov    %edx,%r8d
+  804173:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804177:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80417a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80417e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804183:	44 89 c2             	mov    %r8d,%edx
+  804186:	49 89 c7             	mov    %rax,%r15
+  804189:	49 b8 51 c7 ff ff ff 	movabs $0xffffffffffffc751,%r8
+  804190:	ff ff ff 
+  804193:	49 01 c0             	add    %rax,%r8
+  804196:	41 ff d0             	call   *%r8
+}
+  804199:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80419d:	c9                   	leave
+  80419e:	c3                   	ret
+
+000000000080419f <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80419f:	55                   	push   %rbp
+  8041a0:	48 89 e5             	mov    %rsp,%rbp
+  8041a3:	41 57                	push   %r15
+  8041a5:	48 83 ec 18          	sub    $0x18,%rsp
+  8041a9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8041a9 <devsock_stat+0xa>
+  8041b0:	49 bb 87 3e 00 00 00 	movabs $0x3e87,%r11
+  8041b7:	00 00 00 
+  8041ba:	4c 01 d8             	add    %r11,%rax
+  8041bd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041c1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  8041c5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041c9:	48 b9 5c e4 ff ff ff 	movabs $0xffffffffffffe45c,%rcx
+  8041d0:	ff ff ff 
+  8041d3:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8041d7:	48 89 ce             	mov    %rcx,%rsi
+  8041da:	48 89 d7             	mov    %rdx,%rdi
+  8041dd:	49 89 c7             	mov    %rax,%r15
+  8041e0:	48 ba 78 91 ff ff ff 	movabs $0xffffffffffff9178,%rdx
+  8041e7:	ff ff ff 
+  8041ea:	48 01 c2             	add    %rax,%rdx
+  8041ed:	ff d2                	call   *%rdx
+	return 0;
+  8041ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041f4:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8041f8:	c9                   	leave
+  8041f9:	c3                   	ret
+
+00000000008041fa <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8041fa:	55                   	push   %rbp
+  8041fb:	48 89 e5             	mov    %rsp,%rbp
+  8041fe:	41 57                	push   %r15
+  804200:	53                   	push   %rbx
+  804201:	48 83 ec 20          	sub    $0x20,%rsp
+  804205:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804205 <socket+0xb>
+  80420c:	49 bb 2b 3e 00 00 00 	movabs $0x3e2b,%r11
+  804213:	00 00 00 
+  804216:	4c 01 db             	add    %r11,%rbx
+  804219:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80421c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80421f:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  804222:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804225:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804228:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80422b:	89 ce                	mov    %ecx,%esi
+  80422d:	89 c7                	mov    %eax,%edi
+  80422f:	49 89 df             	mov    %rbx,%r15
+  804232:	48 b8 28 c9 ff ff ff 	movabs $0xffffffffffffc928,%rax
+  804239:	ff ff ff 
+  80423c:	48 01 d8             	add    %rbx,%rax
+  80423f:	ff d0                	call   *%rax
+  804241:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804244:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804248:	79 05                	jns    80424f <socket+0x55>
+		return r;
+  80424a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80424d:	eb 15                	jmp    804264 <socket+0x6a>
+	return alloc_sockfd(r);
+  80424f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804252:	89 c7                	mov    %eax,%edi
+  804254:	48 b8 12 bd ff ff ff 	movabs $0xffffffffffffbd12,%rax
+  80425b:	ff ff ff 
+  80425e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804262:	ff d0                	call   *%rax
+}
+  804264:	48 83 c4 20          	add    $0x20,%rsp
+  804268:	5b                   	pop    %rbx
+  804269:	41 5f                	pop    %r15
+  80426b:	5d                   	pop    %rbp
+  80426c:	c3                   	ret
+
+000000000080426d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80426d:	55                   	push   %rbp
+  80426e:	48 89 e5             	mov    %rsp,%rbp
+  804271:	41 57                	push   %r15
+  804273:	53                   	push   %rbx
+  804274:	48 83 ec 10          	sub    $0x10,%rsp
+  804278:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804278 <nsipc+0xb>
+  80427f:	49 bb b8 3d 00 00 00 	movabs $0x3db8,%r11
+  804286:	00 00 00 
+  804289:	4c 01 db             	add    %r11,%rbx
+  80428c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  80428f:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804296:	00 00 00 
+  804299:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80429c:	85 c0                	test   %eax,%eax
+  80429e:	75 24                	jne    8042c4 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8042a0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8042a5:	49 89 df             	mov    %rbx,%r15
+  8042a8:	48 b8 7c dd ff ff ff 	movabs $0xffffffffffffdd7c,%rax
+  8042af:	ff ff ff 
+  8042b2:	48 01 d8             	add    %rbx,%rax
+  8042b5:	ff d0                	call   *%rax
+  8042b7:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  8042be:	00 00 00 
+  8042c1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  8042c4:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8042cb:	00 00 00 
+  8042ce:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8042d1:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8042d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8042da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8042e0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8042e5:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8042ec:	00 00 00 
+  8042ef:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8042f3:	89 c7                	mov    %eax,%edi
+  8042f5:	49 89 df             	mov    %rbx,%r15
+  8042f8:	48 b8 9b d7 ff ff ff 	movabs $0xffffffffffffd79b,%rax
+  8042ff:	ff ff ff 
+  804302:	48 01 d8             	add    %rbx,%rax
+  804305:	ff d0                	call   *%rax
+}
+  804307:	48 83 c4 10          	add    $0x10,%rsp
+  80430b:	5b                   	pop    %rbx
+  80430c:	41 5f                	pop    %r15
+  80430e:	5d                   	pop    %rbp
+  80430f:	c3                   	ret
+
+0000000000804310 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  804310:	55                   	push   %rbp
+  804311:	48 89 e5             	mov    %rsp,%rbp
+  804314:	41 57                	push   %r15
+  804316:	53                   	push   %rbx
+  804317:	48 83 ec 20          	sub    $0x20,%rsp
+  80431b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80431b <nsipc_words+0xb>
+  804322:	49 bb 15 3d 00 00 00 	movabs $0x3d15,%r11
+  804329:	00 00 00 
+  80432c:	4c 01 db             	add    %r11,%rbx
+  80432f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804332:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804336:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  80433a:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804341:	00 00 00 
+  804344:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804347:	85 c0                	test   %eax,%eax
+  804349:	75 24                	jne    80436f <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80434b:	bf 02 00 00 00       	mov    $0x2,%edi
+  804350:	49 89 df             	mov    %rbx,%r15
+  804353:	48 b8 7c dd ff ff ff 	movabs $0xffffffffffffdd7c,%rax
+  80435a:	ff ff ff 
+  80435d:	48 01 d8             	add    %rbx,%rax
+  804360:	ff d0                	call   *%rax
+  804362:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804369:	00 00 00 
+  80436c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  80436f:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804376:	00 00 00 
+  804379:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80437c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804380:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804384:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804387:	89 c7                	mov    %eax,%edi
+  804389:	49 89 df             	mov    %rbx,%r15
+  80438c:	48 b8 86 d8 ff ff ff 	movabs $0xffffffffffffd886,%rax
+  804393:	ff ff ff 
+  804396:	48 01 d8             	add    %rbx,%rax
+  804399:	ff d0                	call   *%rax
+}
+  80439b:	48 83 c4 20          	add    $0x20,%rsp
+  80439f:	5b                   	pop    %rbx
+  8043a0:	41 5f                	pop    %r15
+  8043a2:	5d                   	pop    %rbp
+  8043a3:	c3                   	ret
+
+00000000008043a4 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8043a4:	55                   	push   %rbp
+  8043a5:	48 89 e5             	mov    %rsp,%rbp
+  8043a8:	41 57                	push   %r15
+  8043aa:	53                   	push   %rbx
+  8043ab:	48 83 ec 30          	sub    $0x30,%rsp
+  8043af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043af <nsipc_accept+0xb>
+  8043b6:	49 bb 81 3c 00 00 00 	movabs $0x3c81,%r11
+  8043bd:	00 00 00 
+  8043c0:	4c 01 db             	add    %r11,%rbx
+  8043c3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8043c6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8043ca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8043ce:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8043d5:	00 00 00 
+  8043d8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043db:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8043de:	bf 01 00 00 00       	mov    $0x1,%edi
+  8043e3:	48 b8 3d c2 ff ff ff 	movabs $0xffffffffffffc23d,%rax
+  8043ea:	ff ff ff 
+  8043ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043f1:	ff d0                	call   *%rax
+  8043f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043fa:	78 48                	js     804444 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  8043fc:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  804403:	00 00 00 
+  804406:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80440a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80440e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804412:	8b 40 10             	mov    0x10(%rax),%eax
+  804415:	89 c2                	mov    %eax,%edx
+  804417:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80441b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80441f:	48 89 ce             	mov    %rcx,%rsi
+  804422:	48 89 c7             	mov    %rax,%rdi
+  804425:	49 89 df             	mov    %rbx,%r15
+  804428:	48 b8 58 95 ff ff ff 	movabs $0xffffffffffff9558,%rax
+  80442f:	ff ff ff 
+  804432:	48 01 d8             	add    %rbx,%rax
+  804435:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  804437:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80443b:	8b 50 10             	mov    0x10(%rax),%edx
+  80443e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804442:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  804444:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804447:	48 83 c4 30          	add    $0x30,%rsp
+  80444b:	5b                   	pop    %rbx
+  80444c:	41 5f                	pop    %r15
+  80444e:	5d                   	pop    %rbp
+  80444f:	c3                   	ret
+
+0000000000804450 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804450:	55                   	push   %rbp
+  804451:	48 89 e5             	mov    %rsp,%rbp
+  804454:	41 57                	push   %r15
+  804456:	53                   	push   %rbx
+  804457:	48 83 ec 10          	sub    $0x10,%rsp
+  80445b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80445b <nsipc_bind+0xb>
+  804462:	49 bb d5 3b 00 00 00 	movabs $0x3bd5,%r11
+  804469:	00 00 00 
+  80446c:	4c 01 db             	add    %r11,%rbx
+  80446f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804472:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804476:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  804479:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804480:	00 00 00 
+  804483:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804486:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  804489:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80448c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804490:	48 89 c6             	mov    %rax,%rsi
+  804493:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  80449a:	00 00 00 
+  80449d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044a1:	48 89 c7             	mov    %rax,%rdi
+  8044a4:	49 89 df             	mov    %rbx,%r15
+  8044a7:	48 b8 58 95 ff ff ff 	movabs $0xffffffffffff9558,%rax
+  8044ae:	ff ff ff 
+  8044b1:	48 01 d8             	add    %rbx,%rax
+  8044b4:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  8044b6:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8044bd:	00 00 00 
+  8044c0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8044c3:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  8044c7:	bf 02 00 00 00       	mov    $0x2,%edi
+  8044cc:	48 b8 3d c2 ff ff ff 	movabs $0xffffffffffffc23d,%rax
+  8044d3:	ff ff ff 
+  8044d6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044da:	ff d0                	call   *%rax
+}
+  8044dc:	48 83 c4 10          	add    $0x10,%rsp
+  8044e0:	5b                   	pop    %rbx
+  8044e1:	41 5f                	pop    %r15
+  8044e3:	5d                   	pop    %rbp
+  8044e4:	c3                   	ret
+
+00000000008044e5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8044e5:	55                   	push   %rbp
+  8044e6:	48 89 e5             	mov    %rsp,%rbp
+  8044e9:	48 83 ec 20          	sub    $0x20,%rsp
+  8044ed:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8044ed <nsipc_shutdown+0x8>
+  8044f4:	49 bb 43 3b 00 00 00 	movabs $0x3b43,%r11
+  8044fb:	00 00 00 
+  8044fe:	4c 01 d8             	add    %r11,%rax
+  804501:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804504:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  804507:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80450a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  80450d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804510:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  804513:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804517:	ba 08 00 00 00       	mov    $0x8,%edx
+  80451c:	48 89 ce             	mov    %rcx,%rsi
+  80451f:	bf 03 00 00 00       	mov    $0x3,%edi
+  804524:	48 b9 e0 c2 ff ff ff 	movabs $0xffffffffffffc2e0,%rcx
+  80452b:	ff ff ff 
+  80452e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804532:	ff d0                	call   *%rax
+}
+  804534:	c9                   	leave
+  804535:	c3                   	ret
+
+0000000000804536 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  804536:	55                   	push   %rbp
+  804537:	48 89 e5             	mov    %rsp,%rbp
+  80453a:	48 83 ec 20          	sub    $0x20,%rsp
+  80453e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80453e <nsipc_close+0x8>
+  804545:	49 bb f2 3a 00 00 00 	movabs $0x3af2,%r11
+  80454c:	00 00 00 
+  80454f:	4c 01 d8             	add    %r11,%rax
+  804552:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  804555:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804558:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  80455b:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80455f:	ba 04 00 00 00       	mov    $0x4,%edx
+  804564:	48 89 ce             	mov    %rcx,%rsi
+  804567:	bf 04 00 00 00       	mov    $0x4,%edi
+  80456c:	48 b9 e0 c2 ff ff ff 	movabs $0xffffffffffffc2e0,%rcx
+  804573:	ff ff ff 
+  804576:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80457a:	ff d0                	call   *%rax
+}
+  80457c:	c9                   	leave
+  80457d:	c3                   	ret
+
+000000000080457e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80457e:	55                   	push   %rbp
+  80457f:	48 89 e5             	mov    %rsp,%rbp
+  804582:	41 57                	push   %r15
+  804584:	53                   	push   %rbx
+  804585:	48 83 ec 10          	sub    $0x10,%rsp
+  804589:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804589 <nsipc_connect+0xb>
+  804590:	49 bb a7 3a 00 00 00 	movabs $0x3aa7,%r11
+  804597:	00 00 00 
+  80459a:	4c 01 db             	add    %r11,%rbx
+  80459d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8045a0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8045a4:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8045a7:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8045ae:	00 00 00 
+  8045b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045b4:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8045b7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8045ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045be:	48 89 c6             	mov    %rax,%rsi
+  8045c1:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  8045c8:	00 00 00 
+  8045cb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045cf:	48 89 c7             	mov    %rax,%rdi
+  8045d2:	49 89 df             	mov    %rbx,%r15
+  8045d5:	48 b8 58 95 ff ff ff 	movabs $0xffffffffffff9558,%rax
+  8045dc:	ff ff ff 
+  8045df:	48 01 d8             	add    %rbx,%rax
+  8045e2:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8045e4:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8045eb:	00 00 00 
+  8045ee:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8045f1:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8045f5:	bf 05 00 00 00       	mov    $0x5,%edi
+  8045fa:	48 b8 3d c2 ff ff ff 	movabs $0xffffffffffffc23d,%rax
+  804601:	ff ff ff 
+  804604:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804608:	ff d0                	call   *%rax
+}
+  80460a:	48 83 c4 10          	add    $0x10,%rsp
+  80460e:	5b                   	pop    %rbx
+  80460f:	41 5f                	pop    %r15
+  804611:	5d                   	pop    %rbp
+  804612:	c3                   	ret
+
+0000000000804613 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  804613:	55                   	push   %rbp
+  804614:	48 89 e5             	mov    %rsp,%rbp
+  804617:	48 83 ec 20          	sub    $0x20,%rsp
+  80461b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80461b <nsipc_listen+0x8>
+  804622:	49 bb 15 3a 00 00 00 	movabs $0x3a15,%r11
+  804629:	00 00 00 
+  80462c:	4c 01 d8             	add    %r11,%rax
+  80462f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804632:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  804635:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804638:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  80463b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80463e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  804641:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804645:	ba 08 00 00 00       	mov    $0x8,%edx
+  80464a:	48 89 ce             	mov    %rcx,%rsi
+  80464d:	bf 06 00 00 00       	mov    $0x6,%edi
+  804652:	48 b9 e0 c2 ff ff ff 	movabs $0xffffffffffffc2e0,%rcx
+  804659:	ff ff ff 
+  80465c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804660:	ff d0                	call   *%rax
+}
+  804662:	c9                   	leave
+  804663:	c3                   	ret
+
+0000000000804664 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  804664:	55                   	push   %rbp
+  804665:	48 89 e5             	mov    %rsp,%rbp
+  804668:	41 57                	push   %r15
+  80466a:	53                   	push   %rbx
+  80466b:	48 83 ec 30          	sub    $0x30,%rsp
+  80466f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80466f <nsipc_recv+0xb>
+  804676:	49 bb c1 39 00 00 00 	movabs $0x39c1,%r11
+  80467d:	00 00 00 
+  804680:	4c 01 db             	add    %r11,%rbx
+  804683:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804686:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80468a:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  80468d:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  804690:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804697:	00 00 00 
+  80469a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80469d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  8046a0:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8046a7:	00 00 00 
+  8046aa:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8046ad:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  8046b1:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8046b8:	00 00 00 
+  8046bb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8046be:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8046c2:	bf 07 00 00 00       	mov    $0x7,%edi
+  8046c7:	48 b8 3d c2 ff ff ff 	movabs $0xffffffffffffc23d,%rax
+  8046ce:	ff ff ff 
+  8046d1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046d5:	ff d0                	call   *%rax
+  8046d7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046da:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046de:	0f 88 91 00 00 00    	js     804775 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8046e4:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8046eb:	7f 08                	jg     8046f5 <nsipc_recv+0x91>
+  8046ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046f0:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8046f3:	7e 50                	jle    804745 <nsipc_recv+0xe1>
+  8046f5:	48 b8 63 e4 ff ff ff 	movabs $0xffffffffffffe463,%rax
+  8046fc:	ff ff ff 
+  8046ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804703:	48 89 c1             	mov    %rax,%rcx
+  804706:	48 b8 78 e4 ff ff ff 	movabs $0xffffffffffffe478,%rax
+  80470d:	ff ff ff 
+  804710:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804714:	48 89 c2             	mov    %rax,%rdx
+  804717:	be 79 00 00 00       	mov    $0x79,%esi
+  80471c:	48 b8 8d e4 ff ff ff 	movabs $0xffffffffffffe48d,%rax
+  804723:	ff ff ff 
+  804726:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80472a:	48 89 c7             	mov    %rax,%rdi
+  80472d:	49 89 df             	mov    %rbx,%r15
+  804730:	b8 00 00 00 00       	mov    $0x0,%eax
+  804735:	49 b8 e6 d4 ff ff ff 	movabs $0xffffffffffffd4e6,%r8
+  80473c:	ff ff ff 
+  80473f:	49 01 d8             	add    %rbx,%r8
+  804742:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804745:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804748:	48 63 d0             	movslq %eax,%rdx
+  80474b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80474f:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804756:	00 00 00 
+  804759:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  80475d:	48 89 ce             	mov    %rcx,%rsi
+  804760:	48 89 c7             	mov    %rax,%rdi
+  804763:	49 89 df             	mov    %rbx,%r15
+  804766:	48 b8 58 95 ff ff ff 	movabs $0xffffffffffff9558,%rax
+  80476d:	ff ff ff 
+  804770:	48 01 d8             	add    %rbx,%rax
+  804773:	ff d0                	call   *%rax
+	}
+
+	return r;
+  804775:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804778:	48 83 c4 30          	add    $0x30,%rsp
+  80477c:	5b                   	pop    %rbx
+  80477d:	41 5f                	pop    %r15
+  80477f:	5d                   	pop    %rbp
+  804780:	c3                   	ret
+
+0000000000804781 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804781:	55                   	push   %rbp
+  804782:	48 89 e5             	mov    %rsp,%rbp
+  804785:	41 57                	push   %r15
+  804787:	53                   	push   %rbx
+  804788:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  80478f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80478f <nsipc_send+0xe>
+  804796:	49 bb a1 38 00 00 00 	movabs $0x38a1,%r11
+  80479d:	00 00 00 
+  8047a0:	4c 01 db             	add    %r11,%rbx
+  8047a3:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8047a9:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  8047b0:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  8047b6:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  8047bc:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8047c0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  8047c4:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8047cb:	00 00 00 
+  8047ce:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8047d1:	85 c0                	test   %eax,%eax
+  8047d3:	75 24                	jne    8047f9 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8047d5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8047da:	49 89 df             	mov    %rbx,%r15
+  8047dd:	48 b8 7c dd ff ff ff 	movabs $0xffffffffffffdd7c,%rax
+  8047e4:	ff ff ff 
+  8047e7:	48 01 d8             	add    %rbx,%rax
+  8047ea:	ff d0                	call   *%rax
+  8047ec:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  8047f3:	00 00 00 
+  8047f6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8047f9:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8047ff:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804802:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804809:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80480c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80480f:	39 c2                	cmp    %eax,%edx
+  804811:	0f 4e c2             	cmovle %edx,%eax
+  804814:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  80481a:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804820:	48 63 d0             	movslq %eax,%rdx
+  804823:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  80482a:	48 89 c6             	mov    %rax,%rsi
+  80482d:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804834:	00 00 00 
+  804837:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80483b:	48 89 c7             	mov    %rax,%rdi
+  80483e:	49 89 df             	mov    %rbx,%r15
+  804841:	48 b8 58 95 ff ff ff 	movabs $0xffffffffffff9558,%rax
+  804848:	ff ff ff 
+  80484b:	48 01 d8             	add    %rbx,%rax
+  80484e:	ff d0                	call   *%rax
+	req->req_s = s;
+  804850:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804854:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  80485a:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  80485c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804860:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  804866:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  804869:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80486d:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  804873:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  804876:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  80487d:	00 00 00 
+  804880:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804884:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804888:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80488f:	00 
+  804890:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804896:	48 63 d0             	movslq %eax,%rdx
+  804899:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80489d:	48 01 d0             	add    %rdx,%rax
+  8048a0:	48 83 e8 01          	sub    $0x1,%rax
+  8048a4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8048a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048b1:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8048b5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048b9:	48 29 d0             	sub    %rdx,%rax
+  8048bc:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8048c2:	85 c0                	test   %eax,%eax
+  8048c4:	0f 48 c2             	cmovs  %edx,%eax
+  8048c7:	c1 f8 0c             	sar    $0xc,%eax
+  8048ca:	48 98                	cltq
+  8048cc:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  8048d0:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8048d4:	48 85 c0             	test   %rax,%rax
+  8048d7:	0f 95 c0             	setne  %al
+  8048da:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8048dd:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8048e4:	00 
+  8048e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048e9:	48 83 c0 0b          	add    $0xb,%rax
+  8048ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8048f1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048fa:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8048fe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804902:	48 29 d0             	sub    %rdx,%rax
+  804905:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804909:	89 c7                	mov    %eax,%edi
+  80490b:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804912:	00 00 00 
+  804915:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804918:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  80491c:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  804920:	48 83 ec 08          	sub    $0x8,%rsp
+  804924:	6a 00                	push   $0x0
+  804926:	6a 00                	push   $0x0
+  804928:	6a 05                	push   $0x5
+  80492a:	41 89 f1             	mov    %esi,%r9d
+  80492d:	49 89 c8             	mov    %rcx,%r8
+  804930:	89 f9                	mov    %edi,%ecx
+  804932:	be 08 00 00 00       	mov    $0x8,%esi
+  804937:	89 c7                	mov    %eax,%edi
+  804939:	49 89 df             	mov    %rbx,%r15
+  80493c:	48 b8 84 d9 ff ff ff 	movabs $0xffffffffffffd984,%rax
+  804943:	ff ff ff 
+  804946:	48 01 d8             	add    %rbx,%rax
+  804949:	ff d0                	call   *%rax
+  80494b:	48 83 c4 20          	add    $0x20,%rsp
+}
+  80494f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804953:	5b                   	pop    %rbx
+  804954:	41 5f                	pop    %r15
+  804956:	5d                   	pop    %rbp
+  804957:	c3                   	ret
+
+0000000000804958 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804958:	55                   	push   %rbp
+  804959:	48 89 e5             	mov    %rsp,%rbp
+  80495c:	48 83 ec 10          	sub    $0x10,%rsp
+  804960:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804960 <nsipc_socket+0x8>
+  804967:	49 bb d0 36 00 00 00 	movabs $0x36d0,%r11
+  80496e:	00 00 00 
+  804971:	4c 01 d8             	add    %r11,%rax
+  804974:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804977:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  80497a:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  80497d:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804984:	00 00 00 
+  804987:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80498a:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  80498d:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804994:	00 00 00 
+  804997:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80499a:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  80499e:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  8049a5:	00 00 00 
+  8049a8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8049ab:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8049af:	bf 09 00 00 00       	mov    $0x9,%edi
+  8049b4:	48 ba 3d c2 ff ff ff 	movabs $0xffffffffffffc23d,%rdx
+  8049bb:	ff ff ff 
+  8049be:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8049c2:	ff d0                	call   *%rax
+}
+  8049c4:	c9                   	leave
+  8049c5:	c3                   	ret
+
+00000000008049c6 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  8049c6:	55                   	push   %rbp
+  8049c7:	48 89 e5             	mov    %rsp,%rbp
+  8049ca:	41 57                	push   %r15
+  8049cc:	53                   	push   %rbx
+  8049cd:	48 83 ec 30          	sub    $0x30,%rsp
+  8049d1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049d1 <pipe+0xb>
+  8049d8:	49 bb 5f 36 00 00 00 	movabs $0x365f,%r11
+  8049df:	00 00 00 
+  8049e2:	4c 01 db             	add    %r11,%rbx
+  8049e5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8049e9:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8049ed:	48 89 c7             	mov    %rax,%rdi
+  8049f0:	49 89 df             	mov    %rbx,%r15
+  8049f3:	48 b8 57 a6 ff ff ff 	movabs $0xffffffffffffa657,%rax
+  8049fa:	ff ff ff 
+  8049fd:	48 01 d8             	add    %rbx,%rax
+  804a00:	ff d0                	call   *%rax
+  804a02:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a05:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a09:	0f 88 12 02 00 00    	js     804c21 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804a0f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a13:	ba 07 04 00 00       	mov    $0x407,%edx
+  804a18:	48 89 c6             	mov    %rax,%rsi
+  804a1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a20:	49 89 df             	mov    %rbx,%r15
+  804a23:	48 b8 34 9e ff ff ff 	movabs $0xffffffffffff9e34,%rax
+  804a2a:	ff ff ff 
+  804a2d:	48 01 d8             	add    %rbx,%rax
+  804a30:	ff d0                	call   *%rax
+  804a32:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a35:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a39:	0f 88 e2 01 00 00    	js     804c21 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  804a3f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804a43:	48 89 c7             	mov    %rax,%rdi
+  804a46:	49 89 df             	mov    %rbx,%r15
+  804a49:	48 b8 57 a6 ff ff ff 	movabs $0xffffffffffffa657,%rax
+  804a50:	ff ff ff 
+  804a53:	48 01 d8             	add    %rbx,%rax
+  804a56:	ff d0                	call   *%rax
+  804a58:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a5b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a5f:	0f 88 9b 01 00 00    	js     804c00 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804a65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a69:	ba 07 04 00 00       	mov    $0x407,%edx
+  804a6e:	48 89 c6             	mov    %rax,%rsi
+  804a71:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a76:	49 89 df             	mov    %rbx,%r15
+  804a79:	48 b8 34 9e ff ff ff 	movabs $0xffffffffffff9e34,%rax
+  804a80:	ff ff ff 
+  804a83:	48 01 d8             	add    %rbx,%rax
+  804a86:	ff d0                	call   *%rax
+  804a88:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a8b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a8f:	0f 88 6b 01 00 00    	js     804c00 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  804a95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a99:	48 89 c7             	mov    %rax,%rdi
+  804a9c:	49 89 df             	mov    %rbx,%r15
+  804a9f:	48 b8 14 a6 ff ff ff 	movabs $0xffffffffffffa614,%rax
+  804aa6:	ff ff ff 
+  804aa9:	48 01 d8             	add    %rbx,%rax
+  804aac:	ff d0                	call   *%rax
+  804aae:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804ab2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ab6:	ba 07 04 00 00       	mov    $0x407,%edx
+  804abb:	48 89 c6             	mov    %rax,%rsi
+  804abe:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ac3:	49 89 df             	mov    %rbx,%r15
+  804ac6:	48 b8 34 9e ff ff ff 	movabs $0xffffffffffff9e34,%rax
+  804acd:	ff ff ff 
+  804ad0:	48 01 d8             	add    %rbx,%rax
+  804ad3:	ff d0                	call   *%rax
+  804ad5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ad8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804adc:	0f 88 fd 00 00 00    	js     804bdf <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804ae2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ae6:	48 89 c7             	mov    %rax,%rdi
+  804ae9:	49 89 df             	mov    %rbx,%r15
+  804aec:	48 b8 14 a6 ff ff ff 	movabs $0xffffffffffffa614,%rax
+  804af3:	ff ff ff 
+  804af6:	48 01 d8             	add    %rbx,%rax
+  804af9:	ff d0                	call   *%rax
+  804afb:	48 89 c2             	mov    %rax,%rdx
+  804afe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b02:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804b08:	48 89 d1             	mov    %rdx,%rcx
+  804b0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b10:	48 89 c6             	mov    %rax,%rsi
+  804b13:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b18:	49 89 df             	mov    %rbx,%r15
+  804b1b:	48 b8 99 9e ff ff ff 	movabs $0xffffffffffff9e99,%rax
+  804b22:	ff ff ff 
+  804b25:	48 01 d8             	add    %rbx,%rax
+  804b28:	ff d0                	call   *%rax
+  804b2a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b2d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b31:	0f 88 87 00 00 00    	js     804bbe <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  804b37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b3b:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804b42:	00 00 00 
+  804b45:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804b48:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  804b4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b4e:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  804b55:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b59:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804b60:	00 00 00 
+  804b63:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804b66:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  804b68:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b6c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  804b73:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b77:	48 89 c7             	mov    %rax,%rdi
+  804b7a:	49 89 df             	mov    %rbx,%r15
+  804b7d:	48 b8 dd a5 ff ff ff 	movabs $0xffffffffffffa5dd,%rax
+  804b84:	ff ff ff 
+  804b87:	48 01 d8             	add    %rbx,%rax
+  804b8a:	ff d0                	call   *%rax
+  804b8c:	89 c2                	mov    %eax,%edx
+  804b8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b92:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  804b94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b98:	48 89 c7             	mov    %rax,%rdi
+  804b9b:	49 89 df             	mov    %rbx,%r15
+  804b9e:	48 b8 dd a5 ff ff ff 	movabs $0xffffffffffffa5dd,%rax
+  804ba5:	ff ff ff 
+  804ba8:	48 01 d8             	add    %rbx,%rax
+  804bab:	ff d0                	call   *%rax
+  804bad:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804bb1:	48 83 c2 04          	add    $0x4,%rdx
+  804bb5:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  804bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bbc:	eb 67                	jmp    804c25 <pipe+0x25f>
+		goto err3;
+  804bbe:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  804bbf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bc3:	48 89 c6             	mov    %rax,%rsi
+  804bc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bcb:	49 89 df             	mov    %rbx,%r15
+  804bce:	48 b8 0c 9f ff ff ff 	movabs $0xffffffffffff9f0c,%rax
+  804bd5:	ff ff ff 
+  804bd8:	48 01 d8             	add    %rbx,%rax
+  804bdb:	ff d0                	call   *%rax
+  804bdd:	eb 01                	jmp    804be0 <pipe+0x21a>
+		goto err2;
+  804bdf:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  804be0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804be4:	48 89 c6             	mov    %rax,%rsi
+  804be7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bec:	49 89 df             	mov    %rbx,%r15
+  804bef:	48 b8 0c 9f ff ff ff 	movabs $0xffffffffffff9f0c,%rax
+  804bf6:	ff ff ff 
+  804bf9:	48 01 d8             	add    %rbx,%rax
+  804bfc:	ff d0                	call   *%rax
+  804bfe:	eb 01                	jmp    804c01 <pipe+0x23b>
+		goto err1;
+  804c00:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  804c01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c05:	48 89 c6             	mov    %rax,%rsi
+  804c08:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c0d:	49 89 df             	mov    %rbx,%r15
+  804c10:	48 b8 0c 9f ff ff ff 	movabs $0xffffffffffff9f0c,%rax
+  804c17:	ff ff ff 
+  804c1a:	48 01 d8             	add    %rbx,%rax
+  804c1d:	ff d0                	call   *%rax
+  804c1f:	eb 01                	jmp    804c22 <pipe+0x25c>
+		goto err;
+  804c21:	90                   	nop
+err:
+	return r;
+  804c22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804c25:	48 83 c4 30          	add    $0x30,%rsp
+  804c29:	5b                   	pop    %rbx
+  804c2a:	41 5f                	pop    %r15
+  804c2c:	5d                   	pop    %rbp
+  804c2d:	c3                   	ret
+
+0000000000804c2e <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  804c2e:	55                   	push   %rbp
+  804c2f:	48 89 e5             	mov    %rsp,%rbp
+  804c32:	41 57                	push   %r15
+  804c34:	41 54                	push   %r12
+  804c36:	53                   	push   %rbx
+  804c37:	48 83 ec 28          	sub    $0x28,%rsp
+  804c3b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c3b <_pipeisclosed+0xd>
+  804c42:	49 bb f5 33 00 00 00 	movabs $0x33f5,%r11
+  804c49:	00 00 00 
+  804c4c:	4c 01 db             	add    %r11,%rbx
+  804c4f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804c53:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804c57:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804c5e:	ff ff ff 
+  804c61:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804c65:	48 8b 00             	mov    (%rax),%rax
+  804c68:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804c6e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  804c71:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c75:	48 89 c7             	mov    %rax,%rdi
+  804c78:	49 89 df             	mov    %rbx,%r15
+  804c7b:	48 b8 0b de ff ff ff 	movabs $0xffffffffffffde0b,%rax
+  804c82:	ff ff ff 
+  804c85:	48 01 d8             	add    %rbx,%rax
+  804c88:	ff d0                	call   *%rax
+  804c8a:	41 89 c4             	mov    %eax,%r12d
+  804c8d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c91:	48 89 c7             	mov    %rax,%rdi
+  804c94:	49 89 df             	mov    %rbx,%r15
+  804c97:	48 b8 0b de ff ff ff 	movabs $0xffffffffffffde0b,%rax
+  804c9e:	ff ff ff 
+  804ca1:	48 01 d8             	add    %rbx,%rax
+  804ca4:	ff d0                	call   *%rax
+  804ca6:	41 39 c4             	cmp    %eax,%r12d
+  804ca9:	0f 94 c0             	sete   %al
+  804cac:	0f b6 c0             	movzbl %al,%eax
+  804caf:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  804cb2:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804cb9:	ff ff ff 
+  804cbc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804cc0:	48 8b 00             	mov    (%rax),%rax
+  804cc3:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804cc9:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  804ccc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ccf:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804cd2:	75 05                	jne    804cd9 <_pipeisclosed+0xab>
+			return ret;
+  804cd4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804cd7:	eb 63                	jmp    804d3c <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  804cd9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804cdc:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804cdf:	0f 84 72 ff ff ff    	je     804c57 <_pipeisclosed+0x29>
+  804ce5:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  804ce9:	0f 85 68 ff ff ff    	jne    804c57 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  804cef:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804cf6:	ff ff ff 
+  804cf9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804cfd:	48 8b 00             	mov    (%rax),%rax
+  804d00:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  804d06:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804d09:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804d0c:	89 c6                	mov    %eax,%esi
+  804d0e:	48 b8 9e e4 ff ff ff 	movabs $0xffffffffffffe49e,%rax
+  804d15:	ff ff ff 
+  804d18:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d1c:	48 89 c7             	mov    %rax,%rdi
+  804d1f:	49 89 df             	mov    %rbx,%r15
+  804d22:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d27:	49 b8 b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%r8
+  804d2e:	ff ff ff 
+  804d31:	49 01 d8             	add    %rbx,%r8
+  804d34:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  804d37:	e9 1b ff ff ff       	jmp    804c57 <_pipeisclosed+0x29>
+	}
+}
+  804d3c:	48 83 c4 28          	add    $0x28,%rsp
+  804d40:	5b                   	pop    %rbx
+  804d41:	41 5c                	pop    %r12
+  804d43:	41 5f                	pop    %r15
+  804d45:	5d                   	pop    %rbp
+  804d46:	c3                   	ret
+
+0000000000804d47 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  804d47:	55                   	push   %rbp
+  804d48:	48 89 e5             	mov    %rsp,%rbp
+  804d4b:	41 57                	push   %r15
+  804d4d:	53                   	push   %rbx
+  804d4e:	48 83 ec 30          	sub    $0x30,%rsp
+  804d52:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d52 <pipeisclosed+0xb>
+  804d59:	49 bb de 32 00 00 00 	movabs $0x32de,%r11
+  804d60:	00 00 00 
+  804d63:	4c 01 db             	add    %r11,%rbx
+  804d66:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804d69:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804d6d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804d70:	48 89 d6             	mov    %rdx,%rsi
+  804d73:	89 c7                	mov    %eax,%edi
+  804d75:	49 89 df             	mov    %rbx,%r15
+  804d78:	48 b8 0d a7 ff ff ff 	movabs $0xffffffffffffa70d,%rax
+  804d7f:	ff ff ff 
+  804d82:	48 01 d8             	add    %rbx,%rax
+  804d85:	ff d0                	call   *%rax
+  804d87:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d8a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d8e:	79 05                	jns    804d95 <pipeisclosed+0x4e>
+		return r;
+  804d90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d93:	eb 3b                	jmp    804dd0 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  804d95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d99:	48 89 c7             	mov    %rax,%rdi
+  804d9c:	49 89 df             	mov    %rbx,%r15
+  804d9f:	48 b8 14 a6 ff ff ff 	movabs $0xffffffffffffa614,%rax
+  804da6:	ff ff ff 
+  804da9:	48 01 d8             	add    %rbx,%rax
+  804dac:	ff d0                	call   *%rax
+  804dae:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  804db2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804db6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804dba:	48 89 d6             	mov    %rdx,%rsi
+  804dbd:	48 89 c7             	mov    %rax,%rdi
+  804dc0:	48 b8 fe cb ff ff ff 	movabs $0xffffffffffffcbfe,%rax
+  804dc7:	ff ff ff 
+  804dca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804dce:	ff d0                	call   *%rax
+}
+  804dd0:	48 83 c4 30          	add    $0x30,%rsp
+  804dd4:	5b                   	pop    %rbx
+  804dd5:	41 5f                	pop    %r15
+  804dd7:	5d                   	pop    %rbp
+  804dd8:	c3                   	ret
+
+0000000000804dd9 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  804dd9:	55                   	push   %rbp
+  804dda:	48 89 e5             	mov    %rsp,%rbp
+  804ddd:	41 57                	push   %r15
+  804ddf:	53                   	push   %rbx
+  804de0:	48 83 ec 40          	sub    $0x40,%rsp
+  804de4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804de4 <devpipe_read+0xb>
+  804deb:	49 bb 4c 32 00 00 00 	movabs $0x324c,%r11
+  804df2:	00 00 00 
+  804df5:	4c 01 db             	add    %r11,%rbx
+  804df8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804dfc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804e00:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  804e04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e08:	48 89 c7             	mov    %rax,%rdi
+  804e0b:	49 89 df             	mov    %rbx,%r15
+  804e0e:	48 b8 14 a6 ff ff ff 	movabs $0xffffffffffffa614,%rax
+  804e15:	ff ff ff 
+  804e18:	48 01 d8             	add    %rbx,%rax
+  804e1b:	ff d0                	call   *%rax
+  804e1d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  804e21:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e25:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  804e29:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  804e30:	00 
+  804e31:	e9 a1 00 00 00       	jmp    804ed7 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  804e36:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804e3b:	74 09                	je     804e46 <devpipe_read+0x6d>
+				return i;
+  804e3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e41:	e9 9f 00 00 00       	jmp    804ee5 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  804e46:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e4a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e4e:	48 89 d6             	mov    %rdx,%rsi
+  804e51:	48 89 c7             	mov    %rax,%rdi
+  804e54:	48 b8 fe cb ff ff ff 	movabs $0xffffffffffffcbfe,%rax
+  804e5b:	ff ff ff 
+  804e5e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e62:	ff d0                	call   *%rax
+  804e64:	85 c0                	test   %eax,%eax
+  804e66:	74 07                	je     804e6f <devpipe_read+0x96>
+				return 0;
+  804e68:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e6d:	eb 76                	jmp    804ee5 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  804e6f:	49 89 df             	mov    %rbx,%r15
+  804e72:	48 b8 df 9d ff ff ff 	movabs $0xffffffffffff9ddf,%rax
+  804e79:	ff ff ff 
+  804e7c:	48 01 d8             	add    %rbx,%rax
+  804e7f:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  804e81:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e85:	8b 10                	mov    (%rax),%edx
+  804e87:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e8b:	8b 40 04             	mov    0x4(%rax),%eax
+  804e8e:	39 c2                	cmp    %eax,%edx
+  804e90:	74 a4                	je     804e36 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804e92:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e96:	8b 10                	mov    (%rax),%edx
+  804e98:	89 d0                	mov    %edx,%eax
+  804e9a:	c1 f8 1f             	sar    $0x1f,%eax
+  804e9d:	c1 e8 1b             	shr    $0x1b,%eax
+  804ea0:	01 c2                	add    %eax,%edx
+  804ea2:	83 e2 1f             	and    $0x1f,%edx
+  804ea5:	29 c2                	sub    %eax,%edx
+  804ea7:	89 d6                	mov    %edx,%esi
+  804ea9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804ead:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eb1:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804eb5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804eb9:	48 63 c6             	movslq %esi,%rax
+  804ebc:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  804ec1:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  804ec3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ec7:	8b 00                	mov    (%rax),%eax
+  804ec9:	8d 50 01             	lea    0x1(%rax),%edx
+  804ecc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ed0:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  804ed2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804ed7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804edb:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  804edf:	72 a0                	jb     804e81 <devpipe_read+0xa8>
+	}
+	return i;
+  804ee1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  804ee5:	48 83 c4 40          	add    $0x40,%rsp
+  804ee9:	5b                   	pop    %rbx
+  804eea:	41 5f                	pop    %r15
+  804eec:	5d                   	pop    %rbp
+  804eed:	c3                   	ret
+
+0000000000804eee <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  804eee:	55                   	push   %rbp
+  804eef:	48 89 e5             	mov    %rsp,%rbp
+  804ef2:	41 57                	push   %r15
+  804ef4:	53                   	push   %rbx
+  804ef5:	48 83 ec 40          	sub    $0x40,%rsp
+  804ef9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ef9 <devpipe_write+0xb>
+  804f00:	49 bb 37 31 00 00 00 	movabs $0x3137,%r11
+  804f07:	00 00 00 
+  804f0a:	4c 01 db             	add    %r11,%rbx
+  804f0d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804f11:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804f15:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  804f19:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f1d:	48 89 c7             	mov    %rax,%rdi
+  804f20:	49 89 df             	mov    %rbx,%r15
+  804f23:	48 b8 14 a6 ff ff ff 	movabs $0xffffffffffffa614,%rax
+  804f2a:	ff ff ff 
+  804f2d:	48 01 d8             	add    %rbx,%rax
+  804f30:	ff d0                	call   *%rax
+  804f32:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  804f36:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f3a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  804f3e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  804f45:	00 
+  804f46:	e9 a0 00 00 00       	jmp    804feb <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  804f4b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f4f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f53:	48 89 d6             	mov    %rdx,%rsi
+  804f56:	48 89 c7             	mov    %rax,%rdi
+  804f59:	48 b8 fe cb ff ff ff 	movabs $0xffffffffffffcbfe,%rax
+  804f60:	ff ff ff 
+  804f63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f67:	ff d0                	call   *%rax
+  804f69:	85 c0                	test   %eax,%eax
+  804f6b:	74 0a                	je     804f77 <devpipe_write+0x89>
+				return 0;
+  804f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f72:	e9 82 00 00 00       	jmp    804ff9 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  804f77:	49 89 df             	mov    %rbx,%r15
+  804f7a:	48 b8 df 9d ff ff ff 	movabs $0xffffffffffff9ddf,%rax
+  804f81:	ff ff ff 
+  804f84:	48 01 d8             	add    %rbx,%rax
+  804f87:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  804f89:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f8d:	8b 40 04             	mov    0x4(%rax),%eax
+  804f90:	48 63 d0             	movslq %eax,%rdx
+  804f93:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f97:	8b 00                	mov    (%rax),%eax
+  804f99:	48 98                	cltq
+  804f9b:	48 83 c0 20          	add    $0x20,%rax
+  804f9f:	48 39 c2             	cmp    %rax,%rdx
+  804fa2:	73 a7                	jae    804f4b <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804fa4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804fa8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fac:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804fb0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fb4:	8b 50 04             	mov    0x4(%rax),%edx
+  804fb7:	89 d0                	mov    %edx,%eax
+  804fb9:	c1 f8 1f             	sar    $0x1f,%eax
+  804fbc:	c1 e8 1b             	shr    $0x1b,%eax
+  804fbf:	01 c2                	add    %eax,%edx
+  804fc1:	83 e2 1f             	and    $0x1f,%edx
+  804fc4:	29 c2                	sub    %eax,%edx
+  804fc6:	89 d0                	mov    %edx,%eax
+  804fc8:	0f b6 09             	movzbl (%rcx),%ecx
+  804fcb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804fcf:	48 98                	cltq
+  804fd1:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  804fd5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fd9:	8b 40 04             	mov    0x4(%rax),%eax
+  804fdc:	8d 50 01             	lea    0x1(%rax),%edx
+  804fdf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fe3:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  804fe6:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804feb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fef:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  804ff3:	72 94                	jb     804f89 <devpipe_write+0x9b>
+	}
+
+	return i;
+  804ff5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  804ff9:	48 83 c4 40          	add    $0x40,%rsp
+  804ffd:	5b                   	pop    %rbx
+  804ffe:	41 5f                	pop    %r15
+  805000:	5d                   	pop    %rbp
+  805001:	c3                   	ret
+
+0000000000805002 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805002:	55                   	push   %rbp
+  805003:	48 89 e5             	mov    %rsp,%rbp
+  805006:	41 57                	push   %r15
+  805008:	53                   	push   %rbx
+  805009:	48 83 ec 20          	sub    $0x20,%rsp
+  80500d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80500d <devpipe_stat+0xb>
+  805014:	49 bb 23 30 00 00 00 	movabs $0x3023,%r11
+  80501b:	00 00 00 
+  80501e:	4c 01 db             	add    %r11,%rbx
+  805021:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805025:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805029:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80502d:	48 89 c7             	mov    %rax,%rdi
+  805030:	49 89 df             	mov    %rbx,%r15
+  805033:	48 b8 14 a6 ff ff ff 	movabs $0xffffffffffffa614,%rax
+  80503a:	ff ff ff 
+  80503d:	48 01 d8             	add    %rbx,%rax
+  805040:	ff d0                	call   *%rax
+  805042:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805046:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80504a:	48 ba b1 e4 ff ff ff 	movabs $0xffffffffffffe4b1,%rdx
+  805051:	ff ff ff 
+  805054:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805058:	48 89 d6             	mov    %rdx,%rsi
+  80505b:	48 89 c7             	mov    %rax,%rdi
+  80505e:	49 89 df             	mov    %rbx,%r15
+  805061:	48 b8 78 91 ff ff ff 	movabs $0xffffffffffff9178,%rax
+  805068:	ff ff ff 
+  80506b:	48 01 d8             	add    %rbx,%rax
+  80506e:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805070:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805074:	8b 50 04             	mov    0x4(%rax),%edx
+  805077:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80507b:	8b 00                	mov    (%rax),%eax
+  80507d:	29 c2                	sub    %eax,%edx
+  80507f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805083:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805089:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80508d:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805094:	00 00 00 
+	stat->st_dev = &devpipe;
+  805097:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80509b:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  8050a2:	00 00 00 
+  8050a5:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8050a9:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  8050b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050b5:	48 83 c4 20          	add    $0x20,%rsp
+  8050b9:	5b                   	pop    %rbx
+  8050ba:	41 5f                	pop    %r15
+  8050bc:	5d                   	pop    %rbp
+  8050bd:	c3                   	ret
+
+00000000008050be <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8050be:	55                   	push   %rbp
+  8050bf:	48 89 e5             	mov    %rsp,%rbp
+  8050c2:	41 57                	push   %r15
+  8050c4:	53                   	push   %rbx
+  8050c5:	48 83 ec 10          	sub    $0x10,%rsp
+  8050c9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050c9 <devpipe_close+0xb>
+  8050d0:	49 bb 67 2f 00 00 00 	movabs $0x2f67,%r11
+  8050d7:	00 00 00 
+  8050da:	4c 01 db             	add    %r11,%rbx
+  8050dd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  8050e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050e5:	48 89 c6             	mov    %rax,%rsi
+  8050e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050ed:	49 89 df             	mov    %rbx,%r15
+  8050f0:	48 b8 0c 9f ff ff ff 	movabs $0xffffffffffff9f0c,%rax
+  8050f7:	ff ff ff 
+  8050fa:	48 01 d8             	add    %rbx,%rax
+  8050fd:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8050ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805103:	48 89 c7             	mov    %rax,%rdi
+  805106:	49 89 df             	mov    %rbx,%r15
+  805109:	48 b8 14 a6 ff ff ff 	movabs $0xffffffffffffa614,%rax
+  805110:	ff ff ff 
+  805113:	48 01 d8             	add    %rbx,%rax
+  805116:	ff d0                	call   *%rax
+  805118:	48 89 c6             	mov    %rax,%rsi
+  80511b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805120:	49 89 df             	mov    %rbx,%r15
+  805123:	48 b8 0c 9f ff ff ff 	movabs $0xffffffffffff9f0c,%rax
+  80512a:	ff ff ff 
+  80512d:	48 01 d8             	add    %rbx,%rax
+  805130:	ff d0                	call   *%rax
+}
+  805132:	48 83 c4 10          	add    $0x10,%rsp
+  805136:	5b                   	pop    %rbx
+  805137:	41 5f                	pop    %r15
+  805139:	5d                   	pop    %rbp
+  80513a:	c3                   	ret
+
+000000000080513b <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80513b:	55                   	push   %rbp
+  80513c:	48 89 e5             	mov    %rsp,%rbp
+  80513f:	41 57                	push   %r15
+  805141:	48 83 ec 28          	sub    $0x28,%rsp
+  805145:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805145 <cputchar+0xa>
+  80514c:	49 bb eb 2e 00 00 00 	movabs $0x2eeb,%r11
+  805153:	00 00 00 
+  805156:	4c 01 d8             	add    %r11,%rax
+  805159:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  80515c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80515f:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  805162:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  805166:	be 01 00 00 00       	mov    $0x1,%esi
+  80516b:	48 89 d7             	mov    %rdx,%rdi
+  80516e:	49 89 c7             	mov    %rax,%r15
+  805171:	48 ba 7c 9c ff ff ff 	movabs $0xffffffffffff9c7c,%rdx
+  805178:	ff ff ff 
+  80517b:	48 01 c2             	add    %rax,%rdx
+  80517e:	ff d2                	call   *%rdx
+}
+  805180:	90                   	nop
+  805181:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805185:	c9                   	leave
+  805186:	c3                   	ret
+
+0000000000805187 <getchar>:
+
+int
+getchar(void)
+{
+  805187:	55                   	push   %rbp
+  805188:	48 89 e5             	mov    %rsp,%rbp
+  80518b:	41 57                	push   %r15
+  80518d:	48 83 ec 18          	sub    $0x18,%rsp
+  805191:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805191 <getchar+0xa>
+  805198:	49 bb 9f 2e 00 00 00 	movabs $0x2e9f,%r11
+  80519f:	00 00 00 
+  8051a2:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8051a5:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8051a9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8051ae:	48 89 ce             	mov    %rcx,%rsi
+  8051b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051b6:	49 89 c7             	mov    %rax,%r15
+  8051b9:	48 b9 54 ac ff ff ff 	movabs $0xffffffffffffac54,%rcx
+  8051c0:	ff ff ff 
+  8051c3:	48 01 c1             	add    %rax,%rcx
+  8051c6:	ff d1                	call   *%rcx
+  8051c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  8051cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051cf:	79 05                	jns    8051d6 <getchar+0x4f>
+		return r;
+  8051d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051d4:	eb 14                	jmp    8051ea <getchar+0x63>
+	if (r < 1)
+  8051d6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051da:	7f 07                	jg     8051e3 <getchar+0x5c>
+		return -E_EOF;
+  8051dc:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8051e1:	eb 07                	jmp    8051ea <getchar+0x63>
+	return c;
+  8051e3:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8051e7:	0f b6 c0             	movzbl %al,%eax
+}
+  8051ea:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8051ee:	c9                   	leave
+  8051ef:	c3                   	ret
+
+00000000008051f0 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8051f0:	55                   	push   %rbp
+  8051f1:	48 89 e5             	mov    %rsp,%rbp
+  8051f4:	41 57                	push   %r15
+  8051f6:	53                   	push   %rbx
+  8051f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8051fb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051fb <iscons+0xb>
+  805202:	49 bb 35 2e 00 00 00 	movabs $0x2e35,%r11
+  805209:	00 00 00 
+  80520c:	4c 01 db             	add    %r11,%rbx
+  80520f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805212:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805216:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805219:	48 89 d6             	mov    %rdx,%rsi
+  80521c:	89 c7                	mov    %eax,%edi
+  80521e:	49 89 df             	mov    %rbx,%r15
+  805221:	48 b8 0d a7 ff ff ff 	movabs $0xffffffffffffa70d,%rax
+  805228:	ff ff ff 
+  80522b:	48 01 d8             	add    %rbx,%rax
+  80522e:	ff d0                	call   *%rax
+  805230:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805233:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805237:	79 05                	jns    80523e <iscons+0x4e>
+		return r;
+  805239:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80523c:	eb 1b                	jmp    805259 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  80523e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805242:	8b 10                	mov    (%rax),%edx
+  805244:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  80524b:	00 00 00 
+  80524e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805251:	39 c2                	cmp    %eax,%edx
+  805253:	0f 94 c0             	sete   %al
+  805256:	0f b6 c0             	movzbl %al,%eax
+}
+  805259:	48 83 c4 20          	add    $0x20,%rsp
+  80525d:	5b                   	pop    %rbx
+  80525e:	41 5f                	pop    %r15
+  805260:	5d                   	pop    %rbp
+  805261:	c3                   	ret
+
+0000000000805262 <opencons>:
+
+int
+opencons(void)
+{
+  805262:	55                   	push   %rbp
+  805263:	48 89 e5             	mov    %rsp,%rbp
+  805266:	41 57                	push   %r15
+  805268:	53                   	push   %rbx
+  805269:	48 83 ec 10          	sub    $0x10,%rsp
+  80526d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80526d <opencons+0xb>
+  805274:	49 bb c3 2d 00 00 00 	movabs $0x2dc3,%r11
+  80527b:	00 00 00 
+  80527e:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  805281:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805285:	48 89 c7             	mov    %rax,%rdi
+  805288:	49 89 df             	mov    %rbx,%r15
+  80528b:	48 b8 57 a6 ff ff ff 	movabs $0xffffffffffffa657,%rax
+  805292:	ff ff ff 
+  805295:	48 01 d8             	add    %rbx,%rax
+  805298:	ff d0                	call   *%rax
+  80529a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80529d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052a1:	79 05                	jns    8052a8 <opencons+0x46>
+		return r;
+  8052a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052a6:	eb 68                	jmp    805310 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8052a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052ac:	ba 07 04 00 00       	mov    $0x407,%edx
+  8052b1:	48 89 c6             	mov    %rax,%rsi
+  8052b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052b9:	49 89 df             	mov    %rbx,%r15
+  8052bc:	48 b8 34 9e ff ff ff 	movabs $0xffffffffffff9e34,%rax
+  8052c3:	ff ff ff 
+  8052c6:	48 01 d8             	add    %rbx,%rax
+  8052c9:	ff d0                	call   *%rax
+  8052cb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052d2:	79 05                	jns    8052d9 <opencons+0x77>
+		return r;
+  8052d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052d7:	eb 37                	jmp    805310 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  8052d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052dd:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  8052e4:	00 00 00 
+  8052e7:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8052ea:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8052ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052f0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8052f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052fb:	48 89 c7             	mov    %rax,%rdi
+  8052fe:	49 89 df             	mov    %rbx,%r15
+  805301:	48 b8 dd a5 ff ff ff 	movabs $0xffffffffffffa5dd,%rax
+  805308:	ff ff ff 
+  80530b:	48 01 d8             	add    %rbx,%rax
+  80530e:	ff d0                	call   *%rax
+}
+  805310:	48 83 c4 10          	add    $0x10,%rsp
+  805314:	5b                   	pop    %rbx
+  805315:	41 5f                	pop    %r15
+  805317:	5d                   	pop    %rbp
+  805318:	c3                   	ret
+
+0000000000805319 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805319:	55                   	push   %rbp
+  80531a:	48 89 e5             	mov    %rsp,%rbp
+  80531d:	41 57                	push   %r15
+  80531f:	53                   	push   %rbx
+  805320:	48 83 ec 30          	sub    $0x30,%rsp
+  805324:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805324 <devcons_read+0xb>
+  80532b:	49 bb 0c 2d 00 00 00 	movabs $0x2d0c,%r11
+  805332:	00 00 00 
+  805335:	4c 01 db             	add    %r11,%rbx
+  805338:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80533c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805340:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  805344:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805349:	75 19                	jne    805364 <devcons_read+0x4b>
+		return 0;
+  80534b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805350:	eb 55                	jmp    8053a7 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  805352:	49 89 df             	mov    %rbx,%r15
+  805355:	48 b8 df 9d ff ff ff 	movabs $0xffffffffffff9ddf,%rax
+  80535c:	ff ff ff 
+  80535f:	48 01 d8             	add    %rbx,%rax
+  805362:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  805364:	49 89 df             	mov    %rbx,%r15
+  805367:	48 b8 db 9c ff ff ff 	movabs $0xffffffffffff9cdb,%rax
+  80536e:	ff ff ff 
+  805371:	48 01 d8             	add    %rbx,%rax
+  805374:	ff d0                	call   *%rax
+  805376:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805379:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80537d:	74 d3                	je     805352 <devcons_read+0x39>
+	if (c < 0)
+  80537f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805383:	79 05                	jns    80538a <devcons_read+0x71>
+		return c;
+  805385:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805388:	eb 1d                	jmp    8053a7 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  80538a:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80538e:	75 07                	jne    805397 <devcons_read+0x7e>
+		return 0;
+  805390:	b8 00 00 00 00       	mov    $0x0,%eax
+  805395:	eb 10                	jmp    8053a7 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  805397:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80539a:	89 c2                	mov    %eax,%edx
+  80539c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053a0:	88 10                	mov    %dl,(%rax)
+	return 1;
+  8053a2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8053a7:	48 83 c4 30          	add    $0x30,%rsp
+  8053ab:	5b                   	pop    %rbx
+  8053ac:	41 5f                	pop    %r15
+  8053ae:	5d                   	pop    %rbp
+  8053af:	c3                   	ret
+
+00000000008053b0 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8053b0:	55                   	push   %rbp
+  8053b1:	48 89 e5             	mov    %rsp,%rbp
+  8053b4:	41 57                	push   %r15
+  8053b6:	53                   	push   %rbx
+  8053b7:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8053be:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053be <devcons_write+0xe>
+  8053c5:	49 bb 72 2c 00 00 00 	movabs $0x2c72,%r11
+  8053cc:	00 00 00 
+  8053cf:	4c 01 db             	add    %r11,%rbx
+  8053d2:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  8053d9:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  8053e0:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  8053e7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8053ee:	e9 80 00 00 00       	jmp    805473 <devcons_write+0xc3>
+		m = n - tot;
+  8053f3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8053fa:	89 c2                	mov    %eax,%edx
+  8053fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053ff:	29 c2                	sub    %eax,%edx
+  805401:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  805404:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805407:	83 f8 7f             	cmp    $0x7f,%eax
+  80540a:	76 07                	jbe    805413 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  80540c:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  805413:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805416:	48 63 d0             	movslq %eax,%rdx
+  805419:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80541c:	48 63 c8             	movslq %eax,%rcx
+  80541f:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  805426:	48 01 c1             	add    %rax,%rcx
+  805429:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805430:	48 89 ce             	mov    %rcx,%rsi
+  805433:	48 89 c7             	mov    %rax,%rdi
+  805436:	49 89 df             	mov    %rbx,%r15
+  805439:	48 b8 58 95 ff ff ff 	movabs $0xffffffffffff9558,%rax
+  805440:	ff ff ff 
+  805443:	48 01 d8             	add    %rbx,%rax
+  805446:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  805448:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80544b:	48 63 d0             	movslq %eax,%rdx
+  80544e:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805455:	48 89 d6             	mov    %rdx,%rsi
+  805458:	48 89 c7             	mov    %rax,%rdi
+  80545b:	49 89 df             	mov    %rbx,%r15
+  80545e:	48 b8 7c 9c ff ff ff 	movabs $0xffffffffffff9c7c,%rax
+  805465:	ff ff ff 
+  805468:	48 01 d8             	add    %rbx,%rax
+  80546b:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  80546d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805470:	01 45 ec             	add    %eax,-0x14(%rbp)
+  805473:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805476:	48 98                	cltq
+  805478:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  80547f:	0f 82 6e ff ff ff    	jb     8053f3 <devcons_write+0x43>
+	}
+	return tot;
+  805485:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805488:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  80548f:	5b                   	pop    %rbx
+  805490:	41 5f                	pop    %r15
+  805492:	5d                   	pop    %rbp
+  805493:	c3                   	ret
+
+0000000000805494 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  805494:	55                   	push   %rbp
+  805495:	48 89 e5             	mov    %rsp,%rbp
+  805498:	48 83 ec 08          	sub    $0x8,%rsp
+  80549c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80549c <devcons_close+0x8>
+  8054a3:	49 bb 94 2b 00 00 00 	movabs $0x2b94,%r11
+  8054aa:	00 00 00 
+  8054ad:	4c 01 d8             	add    %r11,%rax
+  8054b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8054b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8054b9:	c9                   	leave
+  8054ba:	c3                   	ret
+
+00000000008054bb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8054bb:	55                   	push   %rbp
+  8054bc:	48 89 e5             	mov    %rsp,%rbp
+  8054bf:	41 57                	push   %r15
+  8054c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8054c5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8054c5 <devcons_stat+0xa>
+  8054cc:	49 bb 6b 2b 00 00 00 	movabs $0x2b6b,%r11
+  8054d3:	00 00 00 
+  8054d6:	4c 01 d8             	add    %r11,%rax
+  8054d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8054dd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8054e1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8054e5:	48 b9 bd e4 ff ff ff 	movabs $0xffffffffffffe4bd,%rcx
+  8054ec:	ff ff ff 
+  8054ef:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8054f3:	48 89 ce             	mov    %rcx,%rsi
+  8054f6:	48 89 d7             	mov    %rdx,%rdi
+  8054f9:	49 89 c7             	mov    %rax,%r15
+  8054fc:	48 ba 78 91 ff ff ff 	movabs $0xffffffffffff9178,%rdx
+  805503:	ff ff ff 
+  805506:	48 01 c2             	add    %rax,%rdx
+  805509:	ff d2                	call   *%rdx
+	return 0;
+  80550b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805510:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805514:	c9                   	leave
+  805515:	c3                   	ret
+
+0000000000805516 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  805516:	55                   	push   %rbp
+  805517:	48 89 e5             	mov    %rsp,%rbp
+  80551a:	41 57                	push   %r15
+  80551c:	41 54                	push   %r12
+  80551e:	53                   	push   %rbx
+  80551f:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  805526:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805526 <_panic+0x10>
+  80552d:	49 bb 0a 2b 00 00 00 	movabs $0x2b0a,%r11
+  805534:	00 00 00 
+  805537:	4c 01 db             	add    %r11,%rbx
+  80553a:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  805541:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  805547:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80554e:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  805555:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80555c:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  805563:	84 c0                	test   %al,%al
+  805565:	74 26                	je     80558d <_panic+0x77>
+  805567:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80556e:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  805575:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  805579:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80557d:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  805581:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  805585:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  805589:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80558d:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  805594:	00 00 00 
+  805597:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80559e:	00 00 00 
+  8055a1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8055a5:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8055ac:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8055b3:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8055ba:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8055c1:	ff ff ff 
+  8055c4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8055c8:	4c 8b 20             	mov    (%rax),%r12
+  8055cb:	49 89 df             	mov    %rbx,%r15
+  8055ce:	48 b8 8b 9d ff ff ff 	movabs $0xffffffffffff9d8b,%rax
+  8055d5:	ff ff ff 
+  8055d8:	48 01 d8             	add    %rbx,%rax
+  8055db:	ff d0                	call   *%rax
+  8055dd:	89 c6                	mov    %eax,%esi
+  8055df:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8055e5:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8055ec:	41 89 d0             	mov    %edx,%r8d
+  8055ef:	48 89 c1             	mov    %rax,%rcx
+  8055f2:	4c 89 e2             	mov    %r12,%rdx
+  8055f5:	48 b8 c8 e4 ff ff ff 	movabs $0xffffffffffffe4c8,%rax
+  8055fc:	ff ff ff 
+  8055ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805603:	48 89 c7             	mov    %rax,%rdi
+  805606:	49 89 df             	mov    %rbx,%r15
+  805609:	b8 00 00 00 00       	mov    $0x0,%eax
+  80560e:	49 b9 b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%r9
+  805615:	ff ff ff 
+  805618:	49 01 d9             	add    %rbx,%r9
+  80561b:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80561e:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  805625:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80562c:	48 89 d6             	mov    %rdx,%rsi
+  80562f:	48 89 c7             	mov    %rax,%rdi
+  805632:	49 89 df             	mov    %rbx,%r15
+  805635:	48 b8 d6 82 ff ff ff 	movabs $0xffffffffffff82d6,%rax
+  80563c:	ff ff ff 
+  80563f:	48 01 d8             	add    %rbx,%rax
+  805642:	ff d0                	call   *%rax
+	cprintf("\n");
+  805644:	48 b8 eb e4 ff ff ff 	movabs $0xffffffffffffe4eb,%rax
+  80564b:	ff ff ff 
+  80564e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805652:	48 89 c7             	mov    %rax,%rdi
+  805655:	49 89 df             	mov    %rbx,%r15
+  805658:	b8 00 00 00 00       	mov    $0x0,%eax
+  80565d:	48 ba b6 83 ff ff ff 	movabs $0xffffffffffff83b6,%rdx
+  805664:	ff ff ff 
+  805667:	48 01 da             	add    %rbx,%rdx
+  80566a:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80566c:	cc                   	int3
+  80566d:	eb fd                	jmp    80566c <_panic+0x156>
+
+000000000080566f <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80566f:	55                   	push   %rbp
+  805670:	48 89 e5             	mov    %rsp,%rbp
+  805673:	41 57                	push   %r15
+  805675:	53                   	push   %rbx
+  805676:	48 83 ec 30          	sub    $0x30,%rsp
+  80567a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80567a <ipc_recv+0xb>
+  805681:	49 bb b6 29 00 00 00 	movabs $0x29b6,%r11
+  805688:	00 00 00 
+  80568b:	4c 01 db             	add    %r11,%rbx
+  80568e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805692:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805696:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  80569a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80569f:	75 0e                	jne    8056af <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8056a1:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8056a8:	00 00 00 
+  8056ab:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8056af:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8056b3:	48 89 c7             	mov    %rax,%rdi
+  8056b6:	49 89 df             	mov    %rbx,%r15
+  8056b9:	48 b8 5d a1 ff ff ff 	movabs $0xffffffffffffa15d,%rax
+  8056c0:	ff ff ff 
+  8056c3:	48 01 d8             	add    %rbx,%rax
+  8056c6:	ff d0                	call   *%rax
+  8056c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8056cb:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8056d0:	74 2a                	je     8056fc <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8056d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056d6:	75 19                	jne    8056f1 <ipc_recv+0x82>
+  8056d8:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8056df:	ff ff ff 
+  8056e2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8056e6:	48 8b 00             	mov    (%rax),%rax
+  8056e9:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8056ef:	eb 05                	jmp    8056f6 <ipc_recv+0x87>
+  8056f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056f6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8056fa:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8056fc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805701:	74 2a                	je     80572d <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805703:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805707:	75 19                	jne    805722 <ipc_recv+0xb3>
+  805709:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805710:	ff ff ff 
+  805713:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805717:	48 8b 00             	mov    (%rax),%rax
+  80571a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805720:	eb 05                	jmp    805727 <ipc_recv+0xb8>
+  805722:	b8 00 00 00 00       	mov    $0x0,%eax
+  805727:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80572b:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80572d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805731:	74 05                	je     805738 <ipc_recv+0xc9>
+		return res;
+  805733:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805736:	eb 17                	jmp    80574f <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805738:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80573f:	ff ff ff 
+  805742:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805746:	48 8b 00             	mov    (%rax),%rax
+  805749:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80574f:	48 83 c4 30          	add    $0x30,%rsp
+  805753:	5b                   	pop    %rbx
+  805754:	41 5f                	pop    %r15
+  805756:	5d                   	pop    %rbp
+  805757:	c3                   	ret
+
+0000000000805758 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805758:	55                   	push   %rbp
+  805759:	48 89 e5             	mov    %rsp,%rbp
+  80575c:	41 57                	push   %r15
+  80575e:	53                   	push   %rbx
+  80575f:	48 83 ec 20          	sub    $0x20,%rsp
+  805763:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805763 <ipc_send+0xb>
+  80576a:	49 bb cd 28 00 00 00 	movabs $0x28cd,%r11
+  805771:	00 00 00 
+  805774:	4c 01 db             	add    %r11,%rbx
+  805777:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80577a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80577d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805781:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  805784:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805789:	75 0e                	jne    805799 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  80578b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805792:	00 00 00 
+  805795:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  805799:	90                   	nop
+  80579a:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80579d:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8057a0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8057a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057a7:	89 c7                	mov    %eax,%edi
+  8057a9:	49 89 df             	mov    %rbx,%r15
+  8057ac:	48 b8 f3 a0 ff ff ff 	movabs $0xffffffffffffa0f3,%rax
+  8057b3:	ff ff ff 
+  8057b6:	48 01 d8             	add    %rbx,%rax
+  8057b9:	ff d0                	call   *%rax
+  8057bb:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8057be:	74 da                	je     80579a <ipc_send+0x42>
+		;
+}
+  8057c0:	90                   	nop
+  8057c1:	90                   	nop
+  8057c2:	48 83 c4 20          	add    $0x20,%rsp
+  8057c6:	5b                   	pop    %rbx
+  8057c7:	41 5f                	pop    %r15
+  8057c9:	5d                   	pop    %rbp
+  8057ca:	c3                   	ret
+
+00000000008057cb <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8057cb:	55                   	push   %rbp
+  8057cc:	48 89 e5             	mov    %rsp,%rbp
+  8057cf:	41 57                	push   %r15
+  8057d1:	53                   	push   %rbx
+  8057d2:	48 83 ec 40          	sub    $0x40,%rsp
+  8057d6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057d6 <ipc_call+0xb>
+  8057dd:	49 bb 5a 28 00 00 00 	movabs $0x285a,%r11
+  8057e4:	00 00 00 
+  8057e7:	4c 01 db             	add    %r11,%rbx
+  8057ea:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8057ed:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8057f0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8057f4:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8057f7:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8057fb:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8057ff:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805804:	75 0e                	jne    805814 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805806:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80580d:	00 00 00 
+  805810:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805814:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805819:	75 0e                	jne    805829 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80581b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805822:	00 00 00 
+  805825:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805829:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80582c:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805830:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805833:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805837:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80583a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805840:	49 89 f8             	mov    %rdi,%r8
+  805843:	89 c7                	mov    %eax,%edi
+  805845:	49 89 df             	mov    %rbx,%r15
+  805848:	48 b8 b6 a1 ff ff ff 	movabs $0xffffffffffffa1b6,%rax
+  80584f:	ff ff ff 
+  805852:	48 01 d8             	add    %rbx,%rax
+  805855:	ff d0                	call   *%rax
+  805857:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  80585a:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80585f:	74 2a                	je     80588b <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805861:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805865:	75 19                	jne    805880 <ipc_call+0xb5>
+  805867:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80586e:	ff ff ff 
+  805871:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805875:	48 8b 00             	mov    (%rax),%rax
+  805878:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80587e:	eb 05                	jmp    805885 <ipc_call+0xba>
+  805880:	b8 00 00 00 00       	mov    $0x0,%eax
+  805885:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805889:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  80588b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80588f:	74 05                	je     805896 <ipc_call+0xcb>
+		return r;
+  805891:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805894:	eb 17                	jmp    8058ad <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  805896:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80589d:	ff ff ff 
+  8058a0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058a4:	48 8b 00             	mov    (%rax),%rax
+  8058a7:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8058ad:	48 83 c4 40          	add    $0x40,%rsp
+  8058b1:	5b                   	pop    %rbx
+  8058b2:	41 5f                	pop    %r15
+  8058b4:	5d                   	pop    %rbp
+  8058b5:	c3                   	ret
+
+00000000008058b6 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8058b6:	55                   	push   %rbp
+  8058b7:	48 89 e5             	mov    %rsp,%rbp
+  8058ba:	41 57                	push   %r15
+  8058bc:	53                   	push   %rbx
+  8058bd:	48 83 ec 70          	sub    $0x70,%rsp
+  8058c1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058c1 <ipc_callw+0xb>
+  8058c8:	49 bb 6f 27 00 00 00 	movabs $0x276f,%r11
+  8058cf:	00 00 00 
+  8058d2:	4c 01 db             	add    %r11,%rbx
+  8058d5:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8058d8:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8058db:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  8058df:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  8058e3:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  8058e8:	76 0a                	jbe    8058f4 <ipc_callw+0x3e>
+		return -E_INVAL;
+  8058ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8058ef:	e9 b7 00 00 00       	jmp    8059ab <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  8058f4:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8058f8:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8058fc:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805900:	48 89 ce             	mov    %rcx,%rsi
+  805903:	48 89 c7             	mov    %rax,%rdi
+  805906:	49 89 df             	mov    %rbx,%r15
+  805909:	48 b8 58 95 ff ff ff 	movabs $0xffffffffffff9558,%rax
+  805910:	ff ff ff 
+  805913:	48 01 d8             	add    %rbx,%rax
+  805916:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805918:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80591f:	00 
+  805920:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805924:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805928:	48 01 d0             	add    %rdx,%rax
+  80592b:	48 83 e8 01          	sub    $0x1,%rax
+  80592f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805933:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805937:	ba 00 00 00 00       	mov    $0x0,%edx
+  80593c:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805940:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805944:	48 29 d0             	sub    %rdx,%rax
+  805947:	48 c1 e8 03          	shr    $0x3,%rax
+  80594b:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  80594f:	89 c1                	mov    %eax,%ecx
+  805951:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805954:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805958:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80595b:	49 89 d1             	mov    %rdx,%r9
+  80595e:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805965:	00 00 00 
+  805968:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  80596f:	00 00 00 
+  805972:	89 c7                	mov    %eax,%edi
+  805974:	49 89 df             	mov    %rbx,%r15
+  805977:	48 b8 b6 a1 ff ff ff 	movabs $0xffffffffffffa1b6,%rax
+  80597e:	ff ff ff 
+  805981:	48 01 d8             	add    %rbx,%rax
+  805984:	ff d0                	call   *%rax
+  805986:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805989:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80598d:	74 05                	je     805994 <ipc_callw+0xde>
+		return r;
+  80598f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805992:	eb 17                	jmp    8059ab <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805994:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80599b:	ff ff ff 
+  80599e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8059a2:	48 8b 00             	mov    (%rax),%rax
+  8059a5:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8059ab:	48 83 c4 70          	add    $0x70,%rsp
+  8059af:	5b                   	pop    %rbx
+  8059b0:	41 5f                	pop    %r15
+  8059b2:	5d                   	pop    %rbp
+  8059b3:	c3                   	ret
+
+00000000008059b4 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8059b4:	55                   	push   %rbp
+  8059b5:	48 89 e5             	mov    %rsp,%rbp
+  8059b8:	41 57                	push   %r15
+  8059ba:	53                   	push   %rbx
+  8059bb:	48 83 ec 40          	sub    $0x40,%rsp
+  8059bf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059bf <ipc_callv+0xb>
+  8059c6:	49 bb 71 26 00 00 00 	movabs $0x2671,%r11
+  8059cd:	00 00 00 
+  8059d0:	4c 01 db             	add    %r11,%rbx
+  8059d3:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8059d6:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  8059d9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8059dd:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8059e0:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  8059e4:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  8059e8:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8059ef:	00 00 00 
+  8059f2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  8059f6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  8059fa:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8059fe:	74 11                	je     805a11 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805a00:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805a04:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805a08:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805a0b:	c1 e0 14             	shl    $0x14,%eax
+  805a0e:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805a11:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805a15:	74 14                	je     805a2b <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805a17:	8b 45 20             	mov    0x20(%rbp),%eax
+  805a1a:	83 e8 01             	sub    $0x1,%eax
+  805a1d:	48 63 d0             	movslq %eax,%rdx
+  805a20:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805a24:	48 09 d0             	or     %rdx,%rax
+  805a27:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805a2b:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805a2e:	c1 e0 10             	shl    $0x10,%eax
+  805a31:	0b 45 10             	or     0x10(%rbp),%eax
+  805a34:	89 c1                	mov    %eax,%ecx
+  805a36:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805a39:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805a3d:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805a41:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805a45:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805a48:	4d 89 c1             	mov    %r8,%r9
+  805a4b:	49 89 f8             	mov    %rdi,%r8
+  805a4e:	89 c7                	mov    %eax,%edi
+  805a50:	49 89 df             	mov    %rbx,%r15
+  805a53:	48 b8 b6 a1 ff ff ff 	movabs $0xffffffffffffa1b6,%rax
+  805a5a:	ff ff ff 
+  805a5d:	48 01 d8             	add    %rbx,%rax
+  805a60:	ff d0                	call   *%rax
+  805a62:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805a65:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805a69:	74 05                	je     805a70 <ipc_callv+0xbc>
+		return r;
+  805a6b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a6e:	eb 17                	jmp    805a87 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805a70:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a77:	ff ff ff 
+  805a7a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a7e:	48 8b 00             	mov    (%rax),%rax
+  805a81:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805a87:	48 83 c4 40          	add    $0x40,%rsp
+  805a8b:	5b                   	pop    %rbx
+  805a8c:	41 5f                	pop    %r15
+  805a8e:	5d                   	pop    %rbp
+  805a8f:	c3                   	ret
+
+0000000000805a90 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805a90:	55                   	push   %rbp
+  805a91:	48 89 e5             	mov    %rsp,%rbp
+  805a94:	41 57                	push   %r15
+  805a96:	53                   	push   %rbx
+  805a97:	48 83 ec 40          	sub    $0x40,%rsp
+  805a9b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a9b <ipc_reply_recv+0xb>
+  805aa2:	49 bb 95 25 00 00 00 	movabs $0x2595,%r11
+  805aa9:	00 00 00 
+  805aac:	4c 01 db             	add    %r11,%rbx
+  805aaf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805ab2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805ab5:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805ab9:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805abc:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805ac0:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805ac4:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805ac9:	75 0e                	jne    805ad9 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805acb:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805ad2:	00 00 00 
+  805ad5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805ad9:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805ade:	75 0e                	jne    805aee <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805ae0:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805ae7:	00 00 00 
+  805aea:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805aee:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805af1:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805af5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805af9:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805afc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805b00:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b03:	4d 89 c1             	mov    %r8,%r9
+  805b06:	49 89 f8             	mov    %rdi,%r8
+  805b09:	89 c7                	mov    %eax,%edi
+  805b0b:	49 89 df             	mov    %rbx,%r15
+  805b0e:	48 b8 2a a2 ff ff ff 	movabs $0xffffffffffffa22a,%rax
+  805b15:	ff ff ff 
+  805b18:	48 01 d8             	add    %rbx,%rax
+  805b1b:	ff d0                	call   *%rax
+  805b1d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805b20:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805b25:	74 2a                	je     805b51 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805b27:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b2b:	75 19                	jne    805b46 <ipc_reply_recv+0xb6>
+  805b2d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b34:	ff ff ff 
+  805b37:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b3b:	48 8b 00             	mov    (%rax),%rax
+  805b3e:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805b44:	eb 05                	jmp    805b4b <ipc_reply_recv+0xbb>
+  805b46:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805b4f:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805b51:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805b56:	74 2a                	je     805b82 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805b58:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b5c:	75 19                	jne    805b77 <ipc_reply_recv+0xe7>
+  805b5e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b65:	ff ff ff 
+  805b68:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b6c:	48 8b 00             	mov    (%rax),%rax
+  805b6f:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805b75:	eb 05                	jmp    805b7c <ipc_reply_recv+0xec>
+  805b77:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b7c:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805b80:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805b82:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b86:	74 05                	je     805b8d <ipc_reply_recv+0xfd>
+		return r;
+  805b88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b8b:	eb 17                	jmp    805ba4 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805b8d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b94:	ff ff ff 
+  805b97:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b9b:	48 8b 00             	mov    (%rax),%rax
+  805b9e:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805ba4:	48 83 c4 40          	add    $0x40,%rsp
+  805ba8:	5b                   	pop    %rbx
+  805ba9:	41 5f                	pop    %r15
+  805bab:	5d                   	pop    %rbp
+  805bac:	c3                   	ret
+
+0000000000805bad <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805bad:	55                   	push   %rbp
+  805bae:	48 89 e5             	mov    %rsp,%rbp
+  805bb1:	41 57                	push   %r15
+  805bb3:	53                   	push   %rbx
+  805bb4:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805bbb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bbb <ipc_window_batch+0xe>
+  805bc2:	49 bb 75 24 00 00 00 	movabs $0x2475,%r11
+  805bc9:	00 00 00 
+  805bcc:	4c 01 db             	add    %r11,%rbx
+  805bcf:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805bd5:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805bdc:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805be2:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805be8:	e9 15 01 00 00       	jmp    805d02 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805bed:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805bf3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805bf6:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805bfd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805c00:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805c03:	39 c2                	cmp    %eax,%edx
+  805c05:	0f 4e c2             	cmovle %edx,%eax
+  805c08:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805c0b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805c12:	eb 6b                	jmp    805c7f <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805c14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c17:	48 98                	cltq
+  805c19:	48 c1 e0 05          	shl    $0x5,%rax
+  805c1d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805c21:	48 01 e8             	add    %rbp,%rax
+  805c24:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805c2a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805c30:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c33:	c1 e0 0c             	shl    $0xc,%eax
+  805c36:	48 63 d0             	movslq %eax,%rdx
+  805c39:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805c40:	48 01 c2             	add    %rax,%rdx
+  805c43:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c46:	48 98                	cltq
+  805c48:	48 c1 e0 05          	shl    $0x5,%rax
+  805c4c:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805c50:	48 01 e8             	add    %rbp,%rax
+  805c53:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805c59:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805c5c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c5f:	48 98                	cltq
+  805c61:	48 c1 e0 05          	shl    $0x5,%rax
+  805c65:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805c69:	48 01 e8             	add    %rbp,%rax
+  805c6c:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805c73:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805c79:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805c7b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805c7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c82:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805c85:	7c 8d                	jl     805c14 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805c87:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805c8e:	74 27                	je     805cb7 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805c90:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c93:	48 63 d0             	movslq %eax,%rdx
+  805c96:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805c9d:	48 89 d6             	mov    %rdx,%rsi
+  805ca0:	48 89 c7             	mov    %rax,%rdi
+  805ca3:	49 89 df             	mov    %rbx,%r15
+  805ca6:	48 b8 cd a4 ff ff ff 	movabs $0xffffffffffffa4cd,%rax
+  805cad:	ff ff ff 
+  805cb0:	48 01 d8             	add    %rbx,%rax
+  805cb3:	ff d0                	call   *%rax
+  805cb5:	eb 25                	jmp    805cdc <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805cb7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805cba:	48 63 d0             	movslq %eax,%rdx
+  805cbd:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805cc4:	48 89 d6             	mov    %rdx,%rsi
+  805cc7:	48 89 c7             	mov    %rax,%rdi
+  805cca:	49 89 df             	mov    %rbx,%r15
+  805ccd:	48 b8 2b a5 ff ff ff 	movabs $0xffffffffffffa52b,%rax
+  805cd4:	ff ff ff 
+  805cd7:	48 01 d8             	add    %rbx,%rax
+  805cda:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805cdc:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805cdf:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805ce3:	79 05                	jns    805cea <ipc_window_batch+0x13d>
+			return r;
+  805ce5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ce8:	eb 2a                	jmp    805d14 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805cea:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805ced:	c1 e0 0c             	shl    $0xc,%eax
+  805cf0:	48 98                	cltq
+  805cf2:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  805cf9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805cfc:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  805d02:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  805d09:	0f 8f de fe ff ff    	jg     805bed <ipc_window_batch+0x40>
+	}
+	return 0;
+  805d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d14:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  805d1b:	5b                   	pop    %rbx
+  805d1c:	41 5f                	pop    %r15
+  805d1e:	5d                   	pop    %rbp
+  805d1f:	c3                   	ret
+
+0000000000805d20 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  805d20:	55                   	push   %rbp
+  805d21:	48 89 e5             	mov    %rsp,%rbp
+  805d24:	48 83 ec 10          	sub    $0x10,%rsp
+  805d28:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d28 <ipc_map_window+0x8>
+  805d2f:	49 bb 08 23 00 00 00 	movabs $0x2308,%r11
+  805d36:	00 00 00 
+  805d39:	4c 01 d8             	add    %r11,%rax
+  805d3c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805d40:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  805d43:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805d46:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805d4a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805d4f:	bf 01 00 00 00       	mov    $0x1,%edi
+  805d54:	49 b8 7d db ff ff ff 	movabs $0xffffffffffffdb7d,%r8
+  805d5b:	ff ff ff 
+  805d5e:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805d62:	ff d0                	call   *%rax
+}
+  805d64:	c9                   	leave
+  805d65:	c3                   	ret
+
+0000000000805d66 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  805d66:	55                   	push   %rbp
+  805d67:	48 89 e5             	mov    %rsp,%rbp
+  805d6a:	48 83 ec 10          	sub    $0x10,%rsp
+  805d6e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d6e <ipc_unmap_window+0x8>
+  805d75:	49 bb c2 22 00 00 00 	movabs $0x22c2,%r11
+  805d7c:	00 00 00 
+  805d7f:	4c 01 d8             	add    %r11,%rax
+  805d82:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805d86:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  805d89:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805d8c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805d90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805d95:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d9a:	49 b8 7d db ff ff ff 	movabs $0xffffffffffffdb7d,%r8
+  805da1:	ff ff ff 
+  805da4:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805da8:	ff d0                	call   *%rax
+}
+  805daa:	c9                   	leave
+  805dab:	c3                   	ret
+
+0000000000805dac <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805dac:	55                   	push   %rbp
+  805dad:	48 89 e5             	mov    %rsp,%rbp
+  805db0:	48 83 ec 18          	sub    $0x18,%rsp
+  805db4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805db4 <ipc_find_env+0x8>
+  805dbb:	49 bb 7c 22 00 00 00 	movabs $0x227c,%r11
+  805dc2:	00 00 00 
+  805dc5:	4c 01 d8             	add    %r11,%rax
+  805dc8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  805dcb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805dd2:	eb 57                	jmp    805e2b <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  805dd4:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805ddb:	ff ff ff 
+  805dde:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  805de2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805de5:	48 63 d2             	movslq %edx,%rdx
+  805de8:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  805def:	48 01 ca             	add    %rcx,%rdx
+  805df2:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  805df9:	8b 12                	mov    (%rdx),%edx
+  805dfb:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  805dfe:	75 27                	jne    805e27 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  805e00:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805e07:	ff ff ff 
+  805e0a:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805e0e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e11:	48 98                	cltq
+  805e13:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  805e1a:	48 01 d0             	add    %rdx,%rax
+  805e1d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805e23:	8b 00                	mov    (%rax),%eax
+  805e25:	eb 12                	jmp    805e39 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  805e27:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805e2b:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805e32:	7e a0                	jle    805dd4 <ipc_find_env+0x28>
+	}
+	return 0;
+  805e34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e39:	c9                   	leave
+  805e3a:	c3                   	ret
+
+0000000000805e3b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  805e3b:	55                   	push   %rbp
+  805e3c:	48 89 e5             	mov    %rsp,%rbp
+  805e3f:	48 83 ec 18          	sub    $0x18,%rsp
+  805e43:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805e43 <pageref+0x8>
+  805e4a:	49 bb ed 21 00 00 00 	movabs $0x21ed,%r11
+  805e51:	00 00 00 
+  805e54:	4c 01 d8             	add    %r11,%rax
+  805e57:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  805e5b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805e5f:	48 89 d1             	mov    %rdx,%rcx
+  805e62:	48 c1 e9 15          	shr    $0x15,%rcx
+  805e66:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  805e6d:	ff ff ff 
+  805e70:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805e74:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805e78:	83 e2 01             	and    $0x1,%edx
+  805e7b:	48 85 d2             	test   %rdx,%rdx
+  805e7e:	75 07                	jne    805e87 <pageref+0x4c>
+		return 0;
+  805e80:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e85:	eb 64                	jmp    805eeb <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  805e87:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805e8b:	48 89 d1             	mov    %rdx,%rcx
+  805e8e:	48 c1 e9 0c          	shr    $0xc,%rcx
+  805e92:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  805e99:	ff ff ff 
+  805e9c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805ea0:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805ea4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  805ea8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805eac:	83 e2 01             	and    $0x1,%edx
+  805eaf:	48 85 d2             	test   %rdx,%rdx
+  805eb2:	75 07                	jne    805ebb <pageref+0x80>
+		return 0;
+  805eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  805eb9:	eb 30                	jmp    805eeb <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  805ebb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805ebf:	48 c1 ea 0c          	shr    $0xc,%rdx
+  805ec3:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  805eca:	ff ff ff 
+  805ecd:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  805ed1:	48 89 d0             	mov    %rdx,%rax
+  805ed4:	48 01 c0             	add    %rax,%rax
+  805ed7:	48 01 d0             	add    %rdx,%rax
+  805eda:	48 c1 e0 03          	shl    $0x3,%rax
+  805ede:	48 01 c8             	add    %rcx,%rax
+  805ee1:	48 83 c0 08          	add    $0x8,%rax
+  805ee5:	0f b7 00             	movzwl (%rax),%eax
+  805ee8:	0f b7 c0             	movzwl %ax,%eax
+}
+  805eeb:	c9                   	leave
+  805eec:	c3                   	ret
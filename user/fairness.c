@@ -1,6 +1,11 @@
 // Demonstrate lack of fairness in IPC.
 // Start three instances of this program as envs 1, 2, and 3.
 // (user/idle is env 0).
+//
+// The first sender also forks a CPU-bound spinner.  The receiver spends
+// its time blocked in ipc_recv, so the scheduler keeps it at the top
+// priority level while the spinner sinks to the bottom one; the
+// receiver keeps answering promptly despite the load.
 
 #include <inc/lib.h>
 
@@ -8,15 +13,22 @@ void
 umain(int argc, char **argv)
 {
 	envid_t who, id;
+	uint32_t n;
 
 	id = sys_getenvid();
 
 	if (thisenv == &envs[1]) {
 		while (1) {
 			ipc_recv(&who, 0, 0);
-			cprintf("%x recv from %x\n", id, who);
+			cprintf("%x recv from %x (prio %d)\n", id, who, thisenv->env_prio);
 		}
 	} else {
+		if (thisenv == &envs[2] && fork() == 0) {
+			for (n = 1; ; n++)
+				if ((n & 0xffffff) == 0)
+					cprintf("%x spinning (prio %d)\n",
+						sys_getenvid(), thisenv->env_prio);
+		}
 		cprintf("%x loop sending to %x\n", id, envs[1].env_id);
 		while (1)
 			ipc_send(envs[1].env_id, 0, 0, 0);
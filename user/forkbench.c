@@ -0,0 +1,53 @@
+// Fork latency: the kernel's fork (sys_fork) against the user-level
+// fork built from sys_exofork and sys_page_map (ufork).
+// The parent first maps HEAPPAGES pages, so that fork has a realistic
+// address space to copy.  Each child exits at once; the parent waits
+// for it before forking the next.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NFORKS		100
+#define HEAPPAGES	1024
+#define HEAP		((char *) 0x10000000)
+
+static uint64_t
+bench(const char *name, envid_t (*forkfn)(void))
+{
+	uint64_t start, cycles;
+	envid_t envid;
+	int i;
+
+	start = read_tsc();
+	for (i = 0; i < NFORKS; i++) {
+		if ((envid = forkfn()) < 0)
+			panic("%s: %e", name, envid);
+		if (envid == 0)
+			exit();
+		wait(envid);
+	}
+	cycles = (read_tsc() - start) / NFORKS;
+	cprintf("forkbench: %s: %llu cycles per fork+exit+wait\n",
+		name, cycles);
+	return cycles;
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t kern, user;
+	int i, r;
+
+	for (i = 0; i < HEAPPAGES; i++) {
+		if ((r = sys_page_alloc(0, HEAP + i * PGSIZE,
+					PTE_P|PTE_U|PTE_W)) < 0)
+			panic("sys_page_alloc: %e", r);
+		HEAP[i * PGSIZE] = i;
+	}
+
+	user = bench("ufork", ufork);
+	kern = bench("fork", fork);
+	if (kern > 0)
+		cprintf("forkbench: fork is %llu.%02llux faster\n",
+			user / kern, user * 100 / kern % 100);
+}
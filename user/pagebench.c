@@ -0,0 +1,37 @@
+// Page allocation throughput across CPUs (make run-pagebench CPUS=n).
+// Each worker allocates and then unmaps NPAGES pages, NROUNDS times.
+
+#include <inc/lib.h>
+
+#define NWORKERS	8
+#define NPAGES		64
+#define NROUNDS		200
+#define BASE		((char *) 0x10000000)
+
+static void
+worker(int id)
+{
+	int i, j, r;
+
+	for (i = 0; i < NROUNDS; i++) {
+		for (j = 0; j < NPAGES; j++)
+			if ((r = sys_page_alloc(0, BASE + j * PGSIZE,
+						PTE_P|PTE_U|PTE_W)) < 0)
+				panic("sys_page_alloc: %e", r);
+		for (j = 0; j < NPAGES; j++)
+			if ((r = sys_page_unmap(0, BASE + j * PGSIZE)) < 0)
+				panic("sys_page_unmap: %e", r);
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+	unsigned ms = bench_workers(NWORKERS, worker);
+
+	cprintf("pagebench: %d page alloc/free pairs in %u ms\n",
+		NWORKERS * NROUNDS * NPAGES, ms);
+	if (ms > 0)
+		cprintf("pagebench: %u pairs/s\n",
+			NWORKERS * NROUNDS * NPAGES * 1000 / ms);
+}
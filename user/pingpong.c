@@ -1,14 +1,69 @@
 // Ping-pong a counter between two processes.
 // Only need to start one of these -- splits into two with fork.
+//
+// After the counter reaches 10, measure the IPC round trip latency:
+// first as a separate ipc_send and ipc_recv on each side, then as one
+// ipc_call by the parent and one ipc_reply_recv by the child, which
+// switch directly to each other.
 
 #include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NROUNDS		1000
+
+static uint64_t
+bench_send_recv(envid_t who, bool parent)
+{
+	uint64_t start;
+	uint32_t v;
+	int i;
+
+	start = read_tsc();
+	for (i = 0; i < NROUNDS; i++) {
+		if (parent) {
+			ipc_send(who, i, 0, 0);
+			v = ipc_recv(&who, 0, 0);
+		} else {
+			v = ipc_recv(&who, 0, 0);
+			ipc_send(who, v, 0, 0);
+		}
+	}
+	return (read_tsc() - start) / NROUNDS;
+}
+
+static uint64_t
+bench_call(envid_t who)
+{
+	uint64_t start;
+	int i;
+
+	start = read_tsc();
+	for (i = 0; i < NROUNDS; i++)
+		if (ipc_call(who, i, 0, 0, 0, 0) != i)
+			panic("ipc_call: bad reply");
+	return (read_tsc() - start) / NROUNDS;
+}
+
+static void
+serve_calls(void)
+{
+	envid_t who = 0;
+	uint32_t v = 0;
+	int i;
+
+	for (i = 0; i < NROUNDS; i++)
+		v = ipc_reply_recv(who, v, 0, 0, &who, 0, 0, 0);
+	ipc_send(who, v, 0, 0);
+}
 
 void
 umain(int argc, char **argv)
 {
 	envid_t who;
+	uint64_t sr, call;
+	bool parent;
 
-	if ((who = fork()) != 0) {
+	if ((parent = (who = fork()) != 0)) {
 		// get the ball rolling
 		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
 		ipc_send(who, 0, 0, 0);
@@ -18,12 +73,24 @@ umain(int argc, char **argv)
 		uint32_t i = ipc_recv(&who, 0, 0);
 		cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
 		if (i == 10)
-			return;
+			break;
 		i++;
 		ipc_send(who, i, 0, 0);
 		if (i == 10)
-			return;
+			break;
 	}
 
+	// The parent sent 10, the child received it.
+	if (!parent) {
+		bench_send_recv(who, 0);
+		serve_calls();
+		return;
+	}
+	sr = bench_send_recv(who, 1);
+	call = bench_call(who);
+	cprintf("pingpong: send/recv: %llu cycles per round trip\n", sr);
+	cprintf("pingpong: call/reply: %llu cycles per round trip\n", call);
+	if (call > 0)
+		cprintf("pingpong: call/reply is %llu.%02llux faster\n",
+			sr / call, sr * 100 / call % 100);
 }
-
@@ -0,0 +1,52 @@
+// Fork and IPC throughput across CPUs (make run-smpbench CPUS=n).
+// Each worker forks NFORKS children that exit at once, then plays
+// NROUNDS rounds of IPC ping-pong with one more child.
+
+#include <inc/lib.h>
+
+#define NWORKERS	4
+#define NFORKS		50
+#define NROUNDS		2000
+
+static void
+worker(int id)
+{
+	envid_t who;
+	uint32_t v;
+	int i;
+
+	for (i = 0; i < NFORKS; i++) {
+		if ((who = fork()) < 0)
+			panic("fork: %e", who);
+		if (who == 0)
+			exit();
+		wait(who);
+	}
+
+	if ((who = fork()) < 0)
+		panic("fork: %e", who);
+	if (who == 0) {
+		for (i = 0; i < NROUNDS; i++) {
+			v = ipc_recv(&who, 0, 0);
+			ipc_send(who, v, 0, 0);
+		}
+		exit();
+	}
+	for (i = 0; i < NROUNDS; i++) {
+		ipc_send(who, i, 0, 0);
+		if (ipc_recv(0, 0, 0) != i)
+			panic("worker %d: bad reply in round %d", id, i);
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+	unsigned ms = bench_workers(NWORKERS, worker);
+
+	cprintf("smpbench: %d forks, %d IPC round trips in %u ms\n",
+		NWORKERS * (NFORKS + 1), NWORKERS * NROUNDS, ms);
+	if (ms > 0)
+		cprintf("smpbench: %u round trips/s\n",
+			NWORKERS * NROUNDS * 1000 / ms);
+}
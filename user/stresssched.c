@@ -9,6 +9,16 @@ umain(int argc, char **argv)
 	int seen;
 	envid_t parent = sys_getenvid();
 
+	// Fork a CPU-bound env that never yields.  The scheduler should
+	// demote it, while the envs below, which yield all the time, keep
+	// their priority and stay responsive.
+	if (fork() == 0) {
+		for (i = 0; i < 10000000; i++)
+			counter++;
+		cprintf("[%08x] stresssched hog done at prio %d\n",
+			thisenv->env_id, thisenv->env_prio);
+		return;
+	}
 
 	// Fork several environments
 	for (i = 0; i < 20; i++)
@@ -36,6 +46,7 @@ umain(int argc, char **argv)
 
 	// Check that we see environments running on different CPUs
 	cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+	cprintf("[%08x] stresssched at prio %d\n", thisenv->env_id, thisenv->env_prio);
 
 }
 
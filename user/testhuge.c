@@ -0,0 +1,39 @@
+// Test 2MB pages: zero fill, copy-on-write across fork, and unmapping.
+
+#include <inc/lib.h>
+
+#define VA	((char *) 0xA0000000)
+
+void
+umain(int argc, char **argv)
+{
+	int i, r;
+
+	if ((r = sys_page_alloc_huge(0, VA, PTE_P|PTE_W|PTE_U)) < 0)
+		panic("sys_page_alloc_huge: %e", r);
+	for (i = 0; i < PTSIZE; i += PGSIZE)
+		if (VA[i] != 0)
+			panic("huge page not zeroed at offset %x", i);
+	VA[0] = 'p';
+	VA[PTSIZE - 1] = 'p';
+
+	// The child's write must not show up in the parent.
+	if ((r = fork()) < 0)
+		panic("fork: %e", r);
+	if (r == 0) {
+		if (VA[0] != 'p' || VA[PTSIZE - 1] != 'p')
+			panic("child does not see parent's huge page");
+		VA[0] = 'c';
+		VA[PTSIZE - 1] = 'c';
+		exit();
+	}
+	wait(r);
+	cprintf("fork handles huge pages %s\n",
+		VA[0] == 'p' && VA[PTSIZE - 1] == 'p' ? "right" : "wrong");
+
+	// Unmapping any page in it removes the whole mapping.
+	if ((r = sys_page_unmap(0, VA + PGSIZE)) < 0)
+		panic("sys_page_unmap: %e", r);
+	cprintf("unmap handles huge pages %s\n",
+		(uvpd[VPD(VA)] & PTE_P) ? "wrong" : "right");
+}
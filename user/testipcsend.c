@@ -0,0 +1,57 @@
+// Test blocking sends (sys_ipc_send): senders to an env that is not
+// receiving wait in line, and are served in the order they arrived.
+
+#include <inc/lib.h>
+
+#define NSENDERS	4
+
+// Wait until 'envid' is blocked, as a sender or receiver.
+static void
+wait_blocked(envid_t envid)
+{
+	const volatile struct Env *e = &envs[ENVX(envid)];
+
+	while (e->env_status != ENV_NOT_RUNNABLE)
+		sys_yield();
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t parent = thisenv->env_id, from, who[NSENDERS];
+	uint32_t v;
+	int i, r, inorder = 1;
+
+	for (i = 0; i < NSENDERS; i++) {
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+		if (r == 0) {
+			ipc_send(parent, i, 0, 0);
+			exit();
+		}
+		who[i] = r;
+		// Child i must be on our queue before we fork the next.
+		wait_blocked(r);
+	}
+
+	for (i = 0; i < NSENDERS; i++) {
+		v = ipc_recv(&from, 0, 0);
+		if (from != who[v])
+			panic("message %d from %08x, not %08x", v, from, who[v]);
+		if (v != i)
+			inorder = 0;
+	}
+	cprintf("senders served in order %s\n", inorder ? "right" : "wrong");
+
+	// A sender to an env that dies is let go.
+	if ((r = fork()) < 0)
+		panic("fork: %e", r);
+	if (r == 0) {
+		wait_blocked(parent);
+		exit();
+	}
+	r = sys_ipc_send(r, 0, (void *) UTOP, 0);
+	if (r != -E_BAD_ENV)
+		panic("send to an exiting env returned %e", r);
+	cprintf("send to an exiting env fails right\n");
+}
@@ -0,0 +1,53 @@
+// Test scatter-gather IPC: a vector of page runs is mapped in order
+// into the receiver's window, as far as the window goes.
+
+#include <inc/lib.h>
+
+#define RUNA		0xA0000000
+#define RUNB		0xB0000000
+#define WINDOW		0xC0000000
+#define NPAGES		5
+
+void
+umain(int argc, char **argv)
+{
+	envid_t parent = thisenv->env_id, who;
+	struct IpcSeg segs[2] = {
+		{ RUNA, 3 },
+		{ RUNB, NPAGES - 3 },
+	};
+	char *win = (char *) WINDOW;
+	int i, n, r, ok;
+
+	if ((who = fork()) < 0)
+		panic("fork: %e", who);
+	if (who == 0) {
+		for (n = 4; n <= 8; n += 4) {
+			if ((r = sys_ipc_recv(IPC_WINDOW(WINDOW, n))) < 0)
+				panic("sys_ipc_recv: %e", r);
+			ok = thisenv->env_ipc_npages == MIN(n, NPAGES);
+			for (i = 0; i < thisenv->env_ipc_npages; i++)
+				if (*(int *) (win + i * PGSIZE) != i)
+					ok = 0;
+			ipc_send(parent, ok, 0, 0);
+		}
+		exit();
+	}
+
+	for (i = 0; i < NPAGES; i++) {
+		uintptr_t va = i < 3 ? RUNA + i * PGSIZE : RUNB + (i - 3) * PGSIZE;
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+			panic("sys_page_alloc: %e", r);
+		*(int *) va = i;
+	}
+
+	r = sys_ipc_send(who, 0, (void *) UTOP, PTE_P|PTE_U|IPC_PERM_SEGS(1));
+	cprintf("vector above UTOP fails %s\n", r == -E_INVAL ? "right" : "wrong");
+
+	for (n = 4; n <= 8; n += 4) {
+		ipc_send(who, 0, segs, PTE_P|PTE_U|IPC_PERM_SEGS(2));
+		ok = ipc_recv(NULL, 0, 0);
+		cprintf("window of %d pages got %d in order %s\n", n,
+			MIN(n, NPAGES), ok ? "right" : "wrong");
+	}
+}
@@ -0,0 +1,57 @@
+// Test demand-zero pages (sys_page_alloc with PTE_LAZY): until written,
+// they all map one shared zero page; a write gives the page its own
+// zeroed copy, which fork then shares copy-on-write as usual.
+
+#include <inc/lib.h>
+
+#define VA	((char *) 0xB0000000)
+#define NPAGES	16
+
+void
+umain(int argc, char **argv)
+{
+	physaddr_t zero;
+	int i, r;
+
+	for (i = 0; i < NPAGES; i++)
+		if ((r = sys_page_alloc(0, VA + i * PGSIZE,
+					PTE_P|PTE_U|PTE_W|PTE_LAZY)) < 0)
+			panic("sys_page_alloc: %e", r);
+
+	zero = PTE_ADDR(uvpt[PGNUM(VA)]);
+	for (i = 0; i < NPAGES; i++) {
+		if (VA[i * PGSIZE] != 0 || VA[i * PGSIZE + PGSIZE - 1] != 0)
+			panic("lazy page %d not zero", i);
+		if (PTE_ADDR(uvpt[PGNUM(VA + i * PGSIZE)]) != zero)
+			panic("lazy page %d allocated by a read", i);
+	}
+	cprintf("reads share the zero page %s\n",
+		uvpt[PGNUM(VA)] & PTE_W ? "wrong" : "right");
+
+	VA[PGSIZE] = 'p';
+	cprintf("a write allocates a page %s\n",
+		PTE_ADDR(uvpt[PGNUM(VA + PGSIZE)]) != zero
+		&& (uvpt[PGNUM(VA + PGSIZE)] & PTE_W)
+		&& PTE_ADDR(uvpt[PGNUM(VA)]) == zero
+		&& VA[0] == 0 && VA[PGSIZE + 1] == 0 ? "right" : "wrong");
+
+	// Neither the child's writes nor its reads may show up here.
+	if ((r = fork()) < 0)
+		panic("fork: %e", r);
+	if (r == 0) {
+		if (VA[PGSIZE] != 'p')
+			panic("child does not see parent's write");
+		VA[0] = 'c';
+		VA[PGSIZE] = 'c';
+		exit();
+	}
+	wait(r);
+	cprintf("fork handles lazy pages %s\n",
+		VA[0] == 0 && VA[PGSIZE] == 'p'
+		&& PTE_ADDR(uvpt[PGNUM(VA)]) == zero ? "right" : "wrong");
+
+	r = sys_page_map(0, VA, 0, VA + NPAGES * PGSIZE,
+			 PTE_P|PTE_U|PTE_LAZY);
+	cprintf("PTE_LAZY only for allocation %s\n",
+		r == -E_INVAL ? "right" : "wrong");
+}